@@ -3,10 +3,36 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 #include "adapter.h"
 #include "consensus/validation.h"
+#include "chain/tx_whitelist.h"
+
+#include <algorithm>
+#include <cstring>
+
+template <size_t N>
+static bool containsTxid(const char (&txids)[N][65], const uint256& txid)
+{
+    // Same form as uint256::GetHex(), without the allocation
+    static const char hexmap[] = "0123456789abcdef";
+    char hex[65];
+    for (size_t i = 0; i < 32; ++i) {
+        const uint8_t c = txid.begin()[31 - i];
+        hex[i * 2] = hexmap[c >> 4];
+        hex[i * 2 + 1] = hexmap[c & 15];
+    }
+    hex[64] = '\0';
+
+    return std::binary_search(std::begin(txids), std::end(txids), hex,
+        [](const char* a, const char* b) { return std::memcmp(a, b, 64) < 0; });
+}
 
 bool ignoreTx(const CTransaction& tx)
 {
-    return tx_to_allow.count(tx.GetHash());
+    return containsTxid(tx_to_allow, tx.GetHash());
+}
+
+bool isTxSpendingBlacklisted(const uint256& txid)
+{
+    return containsTxid(txSpendingBlacklisted, txid);
 }
 
 bool is_output_recovery_address(const CTxOutStandard* standardOutput)
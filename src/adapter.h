@@ -11,7 +11,6 @@
 #include <validation.h>
 #include <script/standard.h>
 #include <key_io.h>
-#include "chain/tx_whitelist.h"
 
 
 bool is_output_recovery_address(const CTxOutStandard*);
@@ -30,5 +29,6 @@ inline boost::optional<std::size_t> standardOutputIndex(const std::vector<CTxOut
 }
 
 bool ignoreTx(const CTransaction &tx);
+bool isTxSpendingBlacklisted(const uint256& txid);
 
 #endif // ADAPTER_H
@@ -18,14 +18,14 @@
 
 namespace {
 
-template <typename Stream, typename Data>
-bool SerializeDB(Stream& stream, const Data& data)
+template <typename Data>
+bool SerializeDB(CDataStream& stream, const Data& data)
 {
-    // Write and commit header, data
+    // Write header, data and the hash of both, data is serialized once
     try {
-        CHashWriter hasher(SER_DISK, CLIENT_VERSION);
         stream << Params().MessageStart() << data;
-        hasher << Params().MessageStart() << data;
+        CHashWriter hasher(SER_DISK, CLIENT_VERSION);
+        hasher.write((const char*)stream.data(), stream.size());
         stream << hasher.GetHash();
     } catch (const std::exception& e) {
         return error("%s: Serialize or I/O error - %s", __func__, e.what());
@@ -37,6 +37,13 @@ bool SerializeDB(Stream& stream, const Data& data)
 template <typename Data>
 bool SerializeFileDB(const std::string& prefix, const fs::path& path, const Data& data)
 {
+    // Snapshot to memory first, locks taken by data's serialization (CAddrMan::cs)
+    // aren't held while the file is written.
+    CDataStream ssData(SER_DISK, CLIENT_VERSION);
+    if (!SerializeDB(ssData, data)) {
+        return false;
+    }
+
     // Generate random temporary filename
     uint16_t randv = 0;
     GetRandBytes((unsigned char*)&randv, sizeof(randv));
@@ -52,11 +59,12 @@ bool SerializeFileDB(const std::string& prefix, const fs::path& path, const Data
         return error("%s: Failed to open file %s", __func__, pathTmp.string());
     }
 
-    // Serialize
-    if (!SerializeDB(fileout, data)) {
+    try {
+        fileout.write((const char*)ssData.data(), ssData.size());
+    } catch (const std::exception& e) {
         fileout.fclose();
         remove(pathTmp);
-        return false;
+        return error("%s: I/O error - %s", __func__, e.what());
     }
     if (!FileCommit(fileout.Get())) {
         fileout.fclose();
@@ -114,7 +122,23 @@ bool DeserializeFileDB(const fs::path& path, Data& data)
     if (filein.IsNull())
         return error("%s: Failed to open file %s", __func__, path.string());
 
-    return DeserializeDB(filein, data);
+    // Read the file in one go, deserializing from memory avoids a read call per field
+    CDataStream ssData(SER_DISK, CLIENT_VERSION);
+    try {
+        if (fseek(filein.Get(), 0, SEEK_END) != 0) {
+            return error("%s: Failed to seek file %s", __func__, path.string());
+        }
+        long size = ftell(filein.Get());
+        if (size < 0 || fseek(filein.Get(), 0, SEEK_SET) != 0) {
+            return error("%s: Failed to seek file %s", __func__, path.string());
+        }
+        ssData.resize(size);
+        filein.read((char*)ssData.data(), size);
+    } catch (const std::exception& e) {
+        return error("%s: I/O error - %s", __func__, e.what());
+    }
+
+    return DeserializeDB(ssData, data);
 }
 
 }
@@ -23,6 +23,7 @@
 #include <set>
 #include <stdint.h>
 #include <streams.h>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -369,7 +370,8 @@ public:
 
         int nUBuckets = ADDRMAN_NEW_BUCKET_COUNT ^ (1 << 30);
         s << nUBuckets;
-        std::map<int, int> mapUnkIds;
+        std::unordered_map<int, int> mapUnkIds;
+        mapUnkIds.reserve(mapInfo.size());
         int nIds = 0;
         for (const auto& entry : mapInfo) {
             mapUnkIds[entry.first] = nIds;
@@ -490,7 +492,7 @@ public:
         nTried -= nLost;
 
         // Store positions in the new table buckets to apply later (if possible).
-        std::map<int, int> entryToBucket; // Represents which entry belonged to which bucket when serializing
+        std::vector<int> entryToBucket(nNew, 0); // Represents which entry belonged to which bucket when serializing
 
         for (int bucket = 0; bucket < nUBuckets; bucket++) {
             int nSize = 0;
@@ -513,6 +515,7 @@ public:
             s >> serialized_asmap_version;
         }
 
+        int nRebucketed = 0;
         for (int n = 0; n < nNew; n++) {
             CAddrInfo &info = mapInfo[n];
             int bucket = entryToBucket[n];
@@ -525,7 +528,7 @@ public:
             } else {
                 // In case the new table data cannot be used (format unknown, bucket count wrong or new asmap),
                 // try to give them a reference based on their primary source address.
-                LogPrint(BCLog::ADDRMAN, "Bucketing method was updated, re-bucketing addrman entries from disk\n");
+                nRebucketed++;
                 bucket = info.GetNewBucket(nKey, m_asmap);
                 nUBucketPos = info.GetBucketPosition(nKey, true, bucket);
                 if (vvNew[bucket][nUBucketPos] == -1) {
@@ -535,6 +538,10 @@ public:
             }
         }
 
+        if (nRebucketed > 0) {
+            LogPrint(BCLog::ADDRMAN, "Bucketing method was updated, re-bucketed %i addrman entries from disk\n", nRebucketed);
+        }
+
         // Prune new entries with refcount 0 (as a result of collisions).
         int nLostUnk = 0;
         for (std::map<int, CAddrInfo>::const_iterator it = mapInfo.begin(); it != mapInfo.end(); ) {
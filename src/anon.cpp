@@ -4,7 +4,10 @@
 
 #include <anon.h>
 
+#include <algorithm>
 #include <assert.h>
+#include <functional>
+#include <limits>
 #include <secp256k1.h>
 #include <secp256k1_rangeproof.h>
 #include <secp256k1_mlsag.h>
@@ -14,7 +17,10 @@
 #include <rctindex.h>
 #include <txdb.h>
 #include <util/system.h>
+#include <util/taskpool.h>
+#include <util/trace.h>
 #include <primitives/transaction.h>
+#include <proofcache.h>
 #include <validation.h>
 #include <validationinterface.h>
 #include <consensus/validation.h>
@@ -57,7 +63,128 @@ bool CheckAnonInputMempoolConflicts(const CTxIn &txin, const uint256 txhash, CTx
     return true;
 };
 
-bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
+CMLSAGCheck::CMLSAGCheck(const uint8_t *preimage, size_t nCols, size_t nRows, std::vector<uint8_t> &&vM,
+    std::vector<uint8_t> &&vCommitments, const std::vector<const uint8_t*> &vpInCommits, const std::vector<const uint8_t*> &vpOutCommits,
+    const uint8_t *pKeyImages, const uint8_t *pPc, const uint8_t *pSs)
+    : m_tally(false), m_preimage(preimage), m_cols(nCols), m_rows(nRows), m_m(std::move(vM)),
+      m_commitments(std::move(vCommitments)), m_in_commits(vpInCommits), m_out_commits(vpOutCommits),
+      m_ki(pKeyImages), m_pc(pPc), m_ss(pSs)
+{
+};
+
+CMLSAGCheck::CMLSAGCheck(std::vector<uint8_t> &&vCommitments, const std::vector<const uint8_t*> &vpInCommits, const std::vector<const uint8_t*> &vpOutCommits)
+    : m_tally(true), m_commitments(std::move(vCommitments)), m_in_commits(vpInCommits), m_out_commits(vpOutCommits)
+{
+};
+
+//! Point the commitments found in from at the same offset in to
+static void RebaseCommitments(std::vector<const uint8_t*> &commits, const std::vector<uint8_t> &from, const std::vector<uint8_t> &to)
+{
+    if (from.empty()) {
+        return;
+    }
+    const uint8_t *begin = from.data(), *end = from.data() + from.size();
+    std::less<const uint8_t*> less;
+    for (auto &p : commits) {
+        if (!less(p, begin) && less(p, end)) {
+            p = to.data() + (p - begin);
+        }
+    }
+}
+
+CMLSAGCheck::CMLSAGCheck(const CMLSAGCheck &check)
+    : m_tally(check.m_tally), m_preimage(check.m_preimage), m_cols(check.m_cols), m_rows(check.m_rows), m_m(check.m_m),
+      m_commitments(check.m_commitments), m_in_commits(check.m_in_commits), m_out_commits(check.m_out_commits),
+      m_ki(check.m_ki), m_pc(check.m_pc), m_ss(check.m_ss), m_cache_store(check.m_cache_store), m_error(check.m_error)
+{
+    RebaseCommitments(m_in_commits, check.m_commitments, m_commitments);
+    RebaseCommitments(m_out_commits, check.m_commitments, m_commitments);
+};
+
+bool CMLSAGCheck::operator()()
+{
+    int rv;
+    if (m_tally) {
+        if (1 != (rv = secp256k1_pedersen_verify_tally(secp256k1_ctx_blind,
+            (const secp256k1_pedersen_commitment* const*)m_in_commits.data(), m_in_commits.size(),
+            (const secp256k1_pedersen_commitment* const*)m_out_commits.data(), m_out_commits.size()))) {
+            LogPrintf("ERROR: %s: verify-commit-tally-failed %d\n", __func__, rv);
+            m_error = "verify-commit-tally-failed";
+            return false;
+        }
+        return true;
+    }
+
+    // Hash before secp256k1_prepare_mlsag fills in the last row of m_m
+    const uint256 cache_entry = MLSAGCacheEntry(m_preimage, m_cols, m_rows, m_m,
+        m_in_commits, m_out_commits, m_ki, m_pc, m_ss);
+    if (m_cache_store && ProofCacheTakeFailed(cache_entry, m_error)) {
+        return false;
+    }
+    if (ProofCacheContains(cache_entry, !m_cache_store)) {
+        return true;
+    }
+
+    TRACE_TIME_START(trace_start);
+    if (0 != (rv = secp256k1_prepare_mlsag(&m_m[0], nullptr,
+        m_out_commits.size(), 0, m_cols, m_rows,
+        &m_in_commits[0], &m_out_commits[0], nullptr))) {
+        LogPrintf("ERROR: %s: prepare-mlsag-failed %d\n", __func__, rv);
+        m_error = "prepare-mlsag-failed";
+        if (m_cache_store) {
+            ProofCacheAddFailed(cache_entry, m_error);
+        }
+        TRACE4(validation, mlsag_verify, m_cols, m_rows, TRACE_TIME_ELAPSED(trace_start), false);
+        return false;
+    }
+    if (0 != (rv = secp256k1_verify_mlsag(secp256k1_ctx_blind,
+        m_preimage, m_cols, m_rows,
+        &m_m[0], m_ki, m_pc, m_ss))) {
+        LogPrintf("ERROR: %s: verify-mlsag-failed %d\n", __func__, rv);
+        m_error = "verify-mlsag-failed";
+        if (m_cache_store) {
+            ProofCacheAddFailed(cache_entry, m_error);
+        }
+        TRACE4(validation, mlsag_verify, m_cols, m_rows, TRACE_TIME_ELAPSED(trace_start), false);
+        return false;
+    }
+    TRACE4(validation, mlsag_verify, m_cols, m_rows, TRACE_TIME_ELAPSED(trace_start), true);
+    if (m_cache_store) {
+        ProofCacheAdd(cache_entry);
+    }
+    return true;
+};
+
+void CMLSAGCheck::StoreVerified()
+{
+    if (m_tally) {
+        return;
+    }
+    ProofCacheAdd(MLSAGCacheEntry(m_preimage, m_cols, m_rows, m_m,
+        m_in_commits, m_out_commits, m_ki, m_pc, m_ss));
+};
+
+static bool AddOrRunMLSAGCheck(CMLSAGCheck &check, TxValidationState &state, std::vector<CMLSAGCheck> *pvChecks)
+{
+    check.SetCacheStore(state.m_cache_store);
+    if (state.m_skip_mlsag) {
+        if (state.m_cache_store) {
+            check.StoreVerified();
+        }
+        return true;
+    }
+    if (pvChecks) {
+        pvChecks->emplace_back();
+        check.swap(pvChecks->back());
+        return true;
+    }
+    if (!check()) {
+        return state.Invalid(TxValidationResult::TX_CONSENSUS, check.GetError());
+    }
+    return true;
+};
+
+bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state, std::vector<CMLSAGCheck> *pvChecks)
 {
     const Consensus::Params &consensus = Params().GetConsensus();
     bool default_accept_anon = state.m_exploit_fix_2 ? true : DEFAULT_ACCEPT_ANON_TX; // TODO: Remove after fork, set DEFAULT_ACCEPT_ANON_TX to true
@@ -67,7 +194,6 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
     }
     
 
-    int rv;
     std::set<int64_t> setHaveI; // Anon prev-outputs can only be used once per transaction.
     std::set<CCmpPubKey> setHaveKI;
     bool fSplitCommitments = tx.vin.size() > 1;
@@ -85,6 +211,7 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
     // Get commitment for unblinded amount
     uint8_t zeroBlind[32] = {0};
     secp256k1_pedersen_commitment plainCommitment;
+    memset(plainCommitment.data, 0, 33);
     if (nPlainValueOut > 0) {
         if (!secp256k1_pedersen_commit(secp256k1_ctx_blind,
             &plainCommitment, zeroBlind, (uint64_t) nPlainValueOut, &secp256k1_generator_const_h, &secp256k1_generator_const_g)) {
@@ -135,8 +262,8 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
             return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-sig-size");
         }
 
-        std::vector<secp256k1_pedersen_commitment> vCommitments;
-        vCommitments.reserve(nCols * nInputs);
+        // Ring member commitments followed by the plain commitment, pointers stay valid when moved into the check
+        std::vector<uint8_t> vCommitments((nCols * nInputs + 1) * 33);
         std::vector<const uint8_t*> vpOutCommits;
         std::vector<const uint8_t*> vpInCommits(nCols * nInputs);
         std::vector<uint8_t> vM(nCols * nRows * 33);
@@ -145,7 +272,9 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
             vpOutCommits.push_back(&vDL[(1 + (nInputs+1) * nRingSize) * 32]);
             vpInputSplitCommits.push_back(&vDL[(1 + (nInputs+1) * nRingSize) * 32]);
         } else {
-            vpOutCommits.push_back(plainCommitment.data);
+            uint8_t *pPlainCommitment = &vCommitments[nCols * nInputs * 33];
+            memcpy(pPlainCommitment, plainCommitment.data, 33);
+            vpOutCommits.push_back(pPlainCommitment);
 
             secp256k1_pedersen_commitment *pc;
             for (const auto &txout : tx.vpout) {
@@ -156,9 +285,10 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
         }
 
         size_t ofs = 0, nB = 0;
+        std::vector<int64_t> vRingIndices(nCols * nInputs);
         for (size_t k = 0; k < nInputs; ++k)
         for (size_t i = 0; i < nCols; ++i) {
-            int64_t nIndex;
+            int64_t &nIndex = vRingIndices[i+k*nCols];
 
             if (0 != part::GetVarInt(vMI, ofs, (uint64_t&)nIndex, nB)) {
                 return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-extract-i");
@@ -169,24 +299,39 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
                 LogPrintf("%s: Duplicate output: %ld\n", __func__, nIndex);
                 return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-dup-i");
             }
+        }
 
-            CAnonOutput ao;
-            if (!pblocktree->ReadRCTOutput(nIndex, ao)) {
-                LogPrintf("%s: ReadRCTOutput failed: %ld\n", __func__, nIndex);
-                return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-unknown-i");
-            }
+        // All ring members are read together, in db order
+        std::vector<CAnonOutput> vRingOutputs;
+        if (!pblocktree->ReadRCTOutputs(vRingIndices, vRingOutputs)) {
+            LogPrintf("%s: ReadRCTOutputs failed\n", __func__);
+            // A loose tx may be ahead of the chain, it's kept as an orphan until the index grows.
+            // Indices too far past the tip to be caught up to are invalid.
+            const auto minmax = std::minmax_element(vRingIndices.begin(), vRingIndices.end());
+            const bool in_reach = !state.m_in_block && ::ChainActive().Tip() && *minmax.first > 0 &&
+                *minmax.second <= ::ChainActive().Tip()->nAnonOutputs + MAX_RING_MEMBER_LOOKAHEAD;
+            return state.Invalid(in_reach ? TxValidationResult::TX_MISSING_INPUTS : TxValidationResult::TX_CONSENSUS,
+                "bad-anonin-unknown-i");
+        }
+
+        for (size_t k = 0; k < nInputs; ++k)
+        for (size_t i = 0; i < nCols; ++i) {
+            const CAnonOutput &ao = vRingOutputs[i+k*nCols];
             memcpy(&vM[(i+k*nCols)*33], ao.pubkey.begin(), 33);
-            vCommitments.push_back(ao.commitment);
-            vpInCommits[i+k*nCols] = vCommitments.back().data;
+            memcpy(&vCommitments[(i+k*nCols)*33], ao.commitment.data, 33);
+            vpInCommits[i+k*nCols] = &vCommitments[(i+k*nCols)*33];
 
             if (state.m_spend_height - ao.nBlockHeight + 1 < consensus.nMinRCTOutputDepth) {
                 LogPrint(BCLog::RINGCT, "%s: Low input depth %s\n", __func__, state.m_spend_height - ao.nBlockHeight);
-                return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-depth");
+                // The member is indexed, so it matures within nMinRCTOutputDepth blocks
+                return state.Invalid(state.m_in_block ? TxValidationResult::TX_CONSENSUS : TxValidationResult::TX_MISSING_INPUTS,
+                    "bad-anonin-depth");
             }
         }
 
+        std::vector<CCmpPubKey> vki(nInputs);
         for (size_t k = 0; k < nInputs; ++k) {
-            const CCmpPubKey &ki = *((CCmpPubKey*)&vKeyImages[k*33]);
+            const CCmpPubKey &ki = vki[k] = *((CCmpPubKey*)&vKeyImages[k*33]);
 
             if (!setHaveKI.insert(ki).second) {
                 if (LogAcceptCategory(BCLog::RINGCT)) {
@@ -194,9 +339,15 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
                 }
                 return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-dup-ki");
             }
+        }
 
-            CAnonKeyImageInfo ki_data;
-            if (pblocktree->ReadRCTKeyImage(ki, ki_data)) {
+        std::vector<CAnonKeyImageInfo> vki_data;
+        std::vector<bool> vki_spent;
+        pblocktree->ReadRCTKeyImages(vki, vki_data, vki_spent);
+        for (size_t k = 0; k < nInputs; ++k) {
+            const CCmpPubKey &ki = vki[k];
+            const CAnonKeyImageInfo &ki_data = vki_data[k];
+            if (vki_spent[k]) {
                 if (LogAcceptCategory(BCLog::RINGCT)) {
                     LogPrintf("%s: Duplicate keyimage detected %s, used in %s.\n", __func__,
                         HexStr(ki), ki_data.txid.ToString());
@@ -211,24 +362,22 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
                 }
             }
         }
-        if (0 != (rv = secp256k1_prepare_mlsag(&vM[0], nullptr,
-            vpOutCommits.size(), 0, nCols, nRows,
-            &vpInCommits[0], &vpOutCommits[0], nullptr))) {
-            LogPrintf("ERROR: %s: prepare-mlsag-failed %d\n", __func__, rv);
-            return state.Invalid(TxValidationResult::TX_CONSENSUS, "prepare-mlsag-failed");
-        }
-        if (0 != (rv = secp256k1_verify_mlsag(secp256k1_ctx_blind,
-            txhash.begin(), nCols, nRows,
-            &vM[0], &vKeyImages[0], &vDL[0], &vDL[32]))) {
-            LogPrintf("ERROR: %s: verify-mlsag-failed %d\n", __func__, rv);
-            return state.Invalid(TxValidationResult::TX_CONSENSUS, "verify-mlsag-failed");
+
+        // The preimage points into the transaction, which outlives the check
+        CMLSAGCheck check(tx.GetHash().begin(), nCols, nRows, std::move(vM),
+            std::move(vCommitments), vpInCommits, vpOutCommits,
+            &vKeyImages[0], &vDL[0], &vDL[32]);
+        if (!AddOrRunMLSAGCheck(check, state, pvChecks)) {
+            return false;
         }
     }
 
     // Verify commitment sums match
     if (fSplitCommitments) {
+        std::vector<uint8_t> vCommitments(33);
+        memcpy(vCommitments.data(), plainCommitment.data, 33);
         std::vector<const uint8_t*> vpOutCommits;
-        vpOutCommits.push_back(plainCommitment.data);
+        vpOutCommits.push_back(vCommitments.data());
 
         secp256k1_pedersen_commitment *pc;
         for (const auto &txout : tx.vpout) {
@@ -237,69 +386,67 @@ bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state)
             }
         }
 
-        if (1 != (rv = secp256k1_pedersen_verify_tally(secp256k1_ctx_blind,
-            (const secp256k1_pedersen_commitment* const*)vpInputSplitCommits.data(), vpInputSplitCommits.size(),
-            (const secp256k1_pedersen_commitment* const*)vpOutCommits.data(), vpOutCommits.size()))) {
-            LogPrintf("ERROR: %s: verify-commit-tally-failed %d\n", __func__, rv);
-            return state.Invalid(TxValidationResult::TX_CONSENSUS, "verify-commit-tally-failed");
+        CMLSAGCheck check(std::move(vCommitments), vpInputSplitCommits, vpOutCommits);
+        if (!AddOrRunMLSAGCheck(check, state, pvChecks)) {
+            return false;
         }
     }
 
     return true;
 };
 
+int64_t GetHighestRingMemberIndex(const CTransaction &tx)
+{
+    int64_t highest = -1;
+    for (const auto &txin : tx.vin) {
+        if (!txin.IsAnonInput() || txin.scriptWitness.stack.empty()) {
+            continue;
+        }
+        uint32_t nInputs, nRingSize;
+        txin.GetAnonInfo(nInputs, nRingSize);
+
+        const std::vector<uint8_t> &vMI = txin.scriptWitness.stack[0];
+        size_t ofs = 0, nB = 0;
+        for (size_t i = 0; i < (size_t)nInputs * nRingSize; ++i) {
+            uint64_t nIndex;
+            // GetVarInt reports success without reading at the end of the data
+            if (ofs >= vMI.size() || 0 != part::GetVarInt(vMI, ofs, nIndex, nB)) {
+                break;
+            }
+            ofs += nB;
+            highest = std::max(highest, (int64_t)nIndex);
+        }
+    }
+    return highest;
+};
+
 int GetKeyImage(CCmpPubKey &ki, const CCmpPubKey &pubkey, const CKey &key)
 {
     return secp256k1_get_keyimage(secp256k1_ctx_blind, ki.ncbegin(), pubkey.begin(), key.begin());
 };
 
-bool AddKeyImagesToMempool(const CTransaction &tx, CTxMemPool &pool)
+bool GetTxKeyImages(const CTransaction &tx, std::vector<CCmpPubKey> &vKeyImages)
 {
+    bool fValid = true;
+    vKeyImages.clear();
     for (const CTxIn &txin : tx.vin) {
         if (!txin.IsAnonInput()) {
             continue;
         }
-        uint256 txhash = tx.GetHash();
-        LOCK(pool.cs);
         uint32_t nInputs, nRingSize;
         txin.GetAnonInfo(nInputs, nRingSize);
 
-        const std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
-
-        if (vKeyImages.size() != nInputs * 33) {
-            return false;
+        if (txin.scriptData.stack.size() != 1
+            || txin.scriptData.stack[0].size() != nInputs * 33) {
+            fValid = false;
+            continue;
         }
-
+        const std::vector<uint8_t> &vKI = txin.scriptData.stack[0];
         for (size_t k = 0; k < nInputs; ++k) {
-            const CCmpPubKey &ki = *((CCmpPubKey*)&vKeyImages[k*33]);
-            pool.mapKeyImages[ki] = txhash;
+            vKeyImages.push_back(*((CCmpPubKey*)&vKI[k*33]));
         }
     }
-
-    return true;
-};
-
-bool RemoveKeyImagesFromMempool(const uint256 &hash, const CTxIn &txin, CTxMemPool &pool)
-{
-    if (!txin.IsAnonInput()) {
-        return false;
-    }
-    LOCK(pool.cs);
-    uint32_t nInputs, nRingSize;
-    txin.GetAnonInfo(nInputs, nRingSize);
-
-    const std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
-
-    if (vKeyImages.size() != nInputs * 33) {
-        return false;
-    }
-
-    for (size_t k = 0; k < nInputs; ++k) {
-        const CCmpPubKey &ki = *((CCmpPubKey*)&vKeyImages[k*33]);
-        pool.mapKeyImages.erase(ki);
-    }
-
-    return true;
+    return fValid;
 };
 
 
@@ -338,44 +485,76 @@ bool AllAnonOutputsUnknown(const CTransaction &tx, TxValidationState &state)
     return true;
 };
 
-bool RollBackRCTIndex(int64_t nLastValidRCTOutput, int64_t nExpectErase, int chain_height, std::set<CCmpPubKey> &setKi)
+/**
+ * Erase anon outputs from nFirst walking in direction step until one is missing or nStop is reached.
+ * Erasures are written whenever the batch grows past nDefaultDbBatchSize.
+ */
+static bool EraseRCTOutputRun(int64_t nFirst, int64_t nStop, int step, int64_t &nRemRCTOutput, size_t &num_erased)
+{
+    CDBBatch batch(*pblocktree);
+    std::vector<int64_t> vEraseRCTOutputs;
+    CAnonOutput ao;
+    for (nRemRCTOutput = nFirst; nRemRCTOutput != nStop; nRemRCTOutput += step) {
+        if (!pblocktree->ReadRCTOutput(nRemRCTOutput, ao)) {
+            break;
+        }
+        vEraseRCTOutputs.push_back(nRemRCTOutput);
+        batch.Erase(std::make_pair(DB_RCTOUTPUT_LINK, ao.pubkey));
+        if (batch.SizeEstimate() > (size_t)nDefaultDbBatchSize) {
+            if (!pblocktree->WriteRCTOutputBatch(batch, {}, vEraseRCTOutputs)) {
+                return false;
+            }
+            num_erased += vEraseRCTOutputs.size();
+            LogPrintf("%s: Erased %d anon outputs, reached %d\n", __func__, num_erased, nRemRCTOutput);
+            batch.Clear();
+            vEraseRCTOutputs.clear();
+        }
+    }
+    num_erased += vEraseRCTOutputs.size();
+    return vEraseRCTOutputs.empty() || pblocktree->WriteRCTOutputBatch(batch, {}, vEraseRCTOutputs);
+};
+
+bool RollBackRCTIndex(int64_t nLastValidRCTOutput, int64_t nExpectErase, int chain_height, std::set<CCmpPubKey> &setKi, RCTIndexRollbackStats *stats)
 {
     LogPrintf("%s: Last valid %d, expect to erase %d, num ki %d\n", __func__, nLastValidRCTOutput, nExpectErase, setKi.size());
     // This should hardly happen, if ever
 
     AssertLockHeld(cs_main);
 
-    int64_t nRemRCTOutput = nLastValidRCTOutput;
-    CAnonOutput ao;
-    while (true) {
-        nRemRCTOutput++;
-        if (!pblocktree->ReadRCTOutput(nRemRCTOutput, ao)) {
-            break;
-        }
-        pblocktree->EraseRCTOutput(nRemRCTOutput);
-        pblocktree->EraseRCTOutputLink(ao.pubkey);
+    RCTIndexRollbackStats counts;
+    int64_t nRemRCTOutput;
+    if (!EraseRCTOutputRun(nLastValidRCTOutput + 1, std::numeric_limits<int64_t>::max(), 1, nRemRCTOutput, counts.outputs_erased)) {
+        return error("%s: WriteRCTOutputBatch failed.", __func__);
     }
 
     LogPrintf("%s: Removed up to %d\n", __func__, nRemRCTOutput);
     if (nExpectErase > 0 && nExpectErase > nRemRCTOutput) {
-        nRemRCTOutput = nExpectErase;
-        while (nRemRCTOutput > nLastValidRCTOutput) {
-            if (!pblocktree->ReadRCTOutput(nRemRCTOutput, ao)) {
-                break;
-            }
-            pblocktree->EraseRCTOutput(nRemRCTOutput);
-            pblocktree->EraseRCTOutputLink(ao.pubkey);
-            nRemRCTOutput--;
+        if (!EraseRCTOutputRun(nExpectErase, nLastValidRCTOutput, -1, nRemRCTOutput, counts.outputs_erased)) {
+            return error("%s: WriteRCTOutputBatch failed.", __func__);
         }
         LogPrintf("%s: Removed down to %d\n", __func__, nRemRCTOutput);
     }
 
-    for (const auto &ki : setKi) {
-        pblocktree->EraseRCTKeyImage(ki);
+    if (!setKi.empty()) {
+        CDBBatch batch(*pblocktree);
+        for (const auto &ki : setKi) {
+            pblocktree->EraseRCTKeyImage(batch, ki);
+        }
+        if (!pblocktree->WriteBatch(batch)) {
+            return error("%s: WriteBatch failed.", __func__);
+        }
+        counts.key_images_erased += setKi.size();
     }
 
-    pblocktree->EraseRCTKeyImagesAfterHeight(chain_height);
+    size_t num_erased = 0;
+    if (!pblocktree->EraseRCTKeyImagesAfterHeight(chain_height, &num_erased)) {
+        return error("%s: EraseRCTKeyImagesAfterHeight failed.", __func__);
+    }
+    counts.key_images_erased += num_erased;
 
+    if (stats) {
+        *stats = counts;
+    }
     return true;
 };
 
@@ -390,12 +569,24 @@ bool RewindToHeight(CTxMemPool& mempool, int nToHeight, int &nBlocks, std::strin
     view.fForceDisconnect = true;
     BlockValidationState state;
 
+    if (fHavePruned) {
+        // Check before disconnecting anything, a pruned node only keeps the blocks within MIN_BLOCKS_TO_KEEP of the tip for sure
+        for (const CBlockIndex *pindex = ::ChainActive().Tip(); pindex && pindex->nHeight > nToHeight; pindex = pindex->pprev) {
+            if (!(pindex->nStatus & BLOCK_HAVE_DATA) || !(pindex->nStatus & BLOCK_HAVE_UNDO)) {
+                return errorN(false, sError, __func__, "Block %d is pruned, can't rewind past it.", pindex->nHeight);
+            }
+        }
+    }
+
     for (CBlockIndex *pindex = ::ChainActive().Tip(); pindex && pindex->pprev; pindex = pindex->pprev) {
         if (pindex->nHeight <= nToHeight) {
             break;
         }
 
         nBlocks++;
+        if (nBlocks % 1000 == 0) {
+            LogPrintf("%s: Disconnected %d blocks, at height %d\n", __func__, nBlocks, pindex->nHeight);
+        }
 
         std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
         CBlock& block = *pblock;
@@ -418,17 +609,32 @@ bool RewindToHeight(CTxMemPool& mempool, int nToHeight, int &nBlocks, std::strin
     }
     nLastRCTOutput = ::ChainActive().Tip()->nAnonOutputs;
 
-    int nRemoveOutput = nLastRCTOutput + 1;
-    CAnonOutput ao;
-    while (pblocktree->ReadRCTOutput(nRemoveOutput, ao)) {
-        pblocktree->EraseRCTOutput(nRemoveOutput);
-        pblocktree->EraseRCTOutputLink(ao.pubkey);
-        nRemoveOutput++;
+    int64_t nRemoveOutput;
+    size_t num_erased = 0;
+    if (!EraseRCTOutputRun(nLastRCTOutput + 1, std::numeric_limits<int64_t>::max(), 1, nRemoveOutput, num_erased)) {
+        return errorN(false, sError, __func__, "WriteRCTOutputBatch failed.");
     }
 
     return true;
 };
 
+int GetAnonOutputHeight(const CChain &chain, int64_t index)
+{
+    if (index < 1 || !chain.Tip() || index > chain.Tip()->nAnonOutputs) {
+        return -1;
+    }
+    int lo = 0, hi = chain.Height();
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (chain[mid]->nAnonOutputs < index) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+};
+
 bool RewindRangeProof(const std::vector<uint8_t> &rangeproof, const std::vector<uint8_t> &commitment, const uint256 &nonce,
                       std::vector<uint8_t> &blind_out, CAmount &value_out)
 {
@@ -442,3 +648,42 @@ bool RewindRangeProof(const std::vector<uint8_t> &rangeproof, const std::vector<
             (uint64_t*) &value_out, blind_out.data(), rangeproof.data(), rangeproof.size(),
             0, &commitment_type, &secp256k1_generator_const_h, nonce.begin(), nullptr, 0));
 };
+
+size_t RewindRangeProofs(std::vector<RangeProofRewind> &rewinds)
+{
+    std::atomic<size_t> num_rewound{0};
+    g_task_pool.ParallelFor(TaskPriority::NORMAL, rewinds.size(), [&rewinds, &num_rewound](size_t i) {
+        RangeProofRewind &r = rewinds[i];
+        const std::vector<uint8_t> *rangeproof = r.txout->GetPRangeproof();
+        const secp256k1_pedersen_commitment *commitment = r.txout->GetPCommitment();
+        if (!rangeproof || !commitment || r.nonce.IsNull()) {
+            return;
+        }
+        uint64_t value = 0;
+        if (rangeproof->size() < 1000) {
+            r.rewound = 1 == secp256k1_bulletproof_rangeproof_rewind(secp256k1_ctx_blind, blind_gens,
+                &value, r.blind, rangeproof->data(), rangeproof->size(),
+                0, commitment, &secp256k1_generator_const_h, r.nonce.begin(), nullptr, 0);
+        } else {
+            uint64_t min_value, max_value;
+            unsigned char msg[256]; // Narration is capped at 32 bytes
+            size_t mlen = sizeof(msg);
+            memset(msg, 0, mlen);
+            r.rewound = 1 == secp256k1_rangeproof_rewind(secp256k1_ctx_blind,
+                r.blind, &value, msg, &mlen, r.nonce.begin(),
+                &min_value, &max_value,
+                commitment, rangeproof->data(), rangeproof->size(),
+                nullptr, 0,
+                secp256k1_generator_h);
+            if (r.rewound) {
+                msg[mlen-1] = '\0';
+                r.message = std::string((const char*)msg);
+            }
+        }
+        if (r.rewound) {
+            r.value = value;
+            ++num_rewound;
+        }
+    });
+    return num_rewound;
+};
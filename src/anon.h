@@ -9,6 +9,8 @@
 #include <pubkey.h>
 #include <amount.h>
 #include <set>
+#include <string>
+#include <vector>
 
 
 extern RecursiveMutex cs_main;
@@ -17,35 +19,157 @@ class uint256;
 class CTxIn;
 class CKey;
 class CTransaction;
+class CTxOutBase;
 class CTxMemPool;
 class TxValidationState;
+class CChain;
 
 const size_t MIN_RINGSIZE = 1;
 const size_t MAX_RINGSIZE = 32;
 // const size_t MIN_RINGSIZE_AFTER_FORK = 3; // Moved to consensusParams to avoid circular dependency
 
 const size_t MAX_ANON_INPUTS = 32; // To raise see MLSAG_MAX_ROWS also
+/** Loose transactions may reference ring members this far past the last indexed anon output, waiting as orphans */
+const int64_t MAX_RING_MEMBER_LOOKAHEAD = 1000;
 
 const size_t ANON_FEE_MULTIPLIER = 2;
 
 const size_t DEFAULT_RING_SIZE = 5;
 const size_t DEFAULT_INPUTS_PER_SIG = 1;
 
+/**
+ * Closure representing one deferred MLSAG ring signature or split commitment
+ * tally verification.
+ * The database lookups are done when the check is built, the remaining work
+ * is pure curve arithmetic against the shared secp256k1_ctx_blind tables and
+ * can be run on the script check queue workers.
+ * Note that this stores pointers into the spending transaction.
+ * Commitment pointers into the owned buffer are rebased when copied.
+ */
+class CMLSAGCheck
+{
+private:
+    bool m_tally = false;
+    const uint8_t *m_preimage = nullptr;
+    size_t m_cols = 0;
+    size_t m_rows = 0;
+    std::vector<uint8_t> m_m;
+    std::vector<uint8_t> m_commitments; // Owned copies of commitments, 33 bytes each
+    std::vector<const uint8_t*> m_in_commits;
+    std::vector<const uint8_t*> m_out_commits;
+    const uint8_t *m_ki = nullptr;
+    const uint8_t *m_pc = nullptr;
+    const uint8_t *m_ss = nullptr;
+    bool m_cache_store = false;
+    std::string m_error;
+public:
+    CMLSAGCheck() {}
+    CMLSAGCheck(const CMLSAGCheck &check);
+    CMLSAGCheck(CMLSAGCheck &&check) = default;
+    CMLSAGCheck &operator=(CMLSAGCheck check)
+    {
+        swap(check);
+        return *this;
+    }
+
+    /** Ring signature check, vpInCommits and vpOutCommits may point into vCommitments, the buffer is moved not copied */
+    CMLSAGCheck(const uint8_t *preimage, size_t nCols, size_t nRows, std::vector<uint8_t> &&vM,
+                std::vector<uint8_t> &&vCommitments, const std::vector<const uint8_t*> &vpInCommits, const std::vector<const uint8_t*> &vpOutCommits,
+                const uint8_t *pKeyImages, const uint8_t *pPc, const uint8_t *pSs);
+
+    /** Split commitment tally check */
+    CMLSAGCheck(std::vector<uint8_t> &&vCommitments, const std::vector<const uint8_t*> &vpInCommits, const std::vector<const uint8_t*> &vpOutCommits);
+
+    bool operator()();
+
+    /** Store the ring signature in the proof cache without checking it, for checks known to have passed */
+    void StoreVerified();
+
+    /** Store verified ring signatures in the proof cache, otherwise cache hits are erased */
+    void SetCacheStore(bool store) { m_cache_store = store; }
+
+    void swap(CMLSAGCheck &check)
+    {
+        std::swap(m_tally, check.m_tally);
+        std::swap(m_preimage, check.m_preimage);
+        std::swap(m_cols, check.m_cols);
+        std::swap(m_rows, check.m_rows);
+        m_m.swap(check.m_m);
+        m_commitments.swap(check.m_commitments);
+        m_in_commits.swap(check.m_in_commits);
+        m_out_commits.swap(check.m_out_commits);
+        std::swap(m_ki, check.m_ki);
+        std::swap(m_pc, check.m_pc);
+        std::swap(m_ss, check.m_ss);
+        std::swap(m_cache_store, check.m_cache_store);
+        std::swap(m_error, check.m_error);
+    }
+
+    const std::string &GetError() const { return m_error; }
+};
+
 bool CheckAnonInputMempoolConflicts(const CTxIn &txin, const uint256 txhash, CTxMemPool *pmempool, TxValidationState &state);
 
-bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+/**
+ * Check the anon inputs of tx.
+ * If pvChecks is not nullptr the ring signature and commitment tally
+ * verifications are pushed onto it instead of being performed inline.
+ */
+bool VerifyMLSAG(const CTransaction &tx, TxValidationState &state, std::vector<CMLSAGCheck> *pvChecks = nullptr) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
 int GetKeyImage(CCmpPubKey &ki, const CCmpPubKey &pubkey, const CKey &key);
-bool AddKeyImagesToMempool(const CTransaction &tx, CTxMemPool &pool);
-bool RemoveKeyImagesFromMempool(const uint256 &hash, const CTxIn &txin, CTxMemPool &pool);
+/** Extract the key images of all well formed anon inputs of tx, false if any anon input is malformed */
+bool GetTxKeyImages(const CTransaction &tx, std::vector<CCmpPubKey> &vKeyImages);
 
 bool AllAnonOutputsUnknown(const CTransaction &tx, TxValidationState &state);
 
-bool RollBackRCTIndex(int64_t nLastValidRCTOutput, int64_t nExpectErase, int chain_height, std::set<CCmpPubKey> &setKi) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+/** Highest anon output index the rings of tx reference, -1 if there are none */
+int64_t GetHighestRingMemberIndex(const CTransaction &tx);
+
+/** Number of rct index records erased by RollBackRCTIndex */
+struct RCTIndexRollbackStats
+{
+    size_t outputs_erased = 0;
+    size_t key_images_erased = 0;
+};
+
+bool RollBackRCTIndex(int64_t nLastValidRCTOutput, int64_t nExpectErase, int chain_height, std::set<CCmpPubKey> &setKi, RCTIndexRollbackStats *stats = nullptr) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
 bool RewindToHeight(CTxMemPool& mempool, int nToHeight, int &nBlocks, std::string &sError) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
+/**
+ * Height of the block in chain that added anon output index, -1 if the index is
+ * beyond the tip.
+ * CBlockIndex::nAnonOutputs is the last index at each height, so this is a
+ * binary search over the active chain rather than an rct index lookup.
+ */
+int GetAnonOutputHeight(const CChain &chain, int64_t index);
+
 bool RewindRangeProof(const std::vector<uint8_t> &rangeproof, const std::vector<uint8_t> &commitment, const uint256 &nonce,
                       std::vector<uint8_t> &blind_out, CAmount &value_out);
 
+/** One output of a RewindRangeProofs batch */
+struct RangeProofRewind
+{
+    RangeProofRewind(const CTxOutBase *txout_, uint32_t n_, const uint256 &nonce_) : txout(txout_), n(n_), nonce(nonce_) {};
+
+    const CTxOutBase *txout; // CT or RingCT output, must outlive the batch
+    uint32_t n;              // Free for the caller, usually the output index
+    uint256 nonce;
+
+    bool rewound = false;
+    CAmount value = 0;
+    uint8_t blind[32] = {};
+    std::string message;     // Narration from a borromean proof, bulletproofs carry it in vData
+};
+
+/**
+ * Rewind each proof in rewinds with its nonce, split over the task pool.
+ * Proofs under 1000 bytes are bulletproofs, larger are borromean.
+ * The rewind functions only read the blinding context and generators, so
+ * the workers share secp256k1_ctx_blind.
+ * Returns the number rewound.
+ */
+size_t RewindRangeProofs(std::vector<RangeProofRewind> &rewinds);
+
 #endif // PARTICL_ANON_H
@@ -5,6 +5,7 @@
 #include <addrman.h>
 #include <bench/bench.h>
 #include <random.h>
+#include <streams.h>
 #include <util/time.h>
 
 #include <vector>
@@ -134,7 +135,39 @@ static void AddrManGood(benchmark::Bench& bench)
     });
 }
 
+static void AddrManSerialize(benchmark::Bench& bench)
+{
+    CAddrMan addrman;
+
+    FillAddrMan(addrman);
+
+    bench.run([&] {
+        CDataStream ss(SER_DISK, CLIENT_VERSION);
+        ss << addrman;
+        assert(ss.size() > 0);
+    });
+}
+
+static void AddrManDeserialize(benchmark::Bench& bench)
+{
+    CAddrMan addrman;
+
+    FillAddrMan(addrman);
+
+    CDataStream ss_full(SER_DISK, CLIENT_VERSION);
+    ss_full << addrman;
+
+    CAddrMan addrman_loaded;
+    bench.run([&] {
+        CDataStream ss(ss_full);
+        ss >> addrman_loaded;
+        assert(addrman_loaded.size() > 0);
+    });
+}
+
 BENCHMARK(AddrManAdd);
 BENCHMARK(AddrManSelect);
 BENCHMARK(AddrManGetAddr);
 BENCHMARK(AddrManGood);
+BENCHMARK(AddrManSerialize);
+BENCHMARK(AddrManDeserialize);
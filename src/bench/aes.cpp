@@ -0,0 +1,59 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <crypto/aes.h>
+
+/* Number of bytes to process per iteration */
+static const uint64_t BUFFER_SIZE_KEY = 48;
+static const uint64_t BUFFER_SIZE_MESSAGE = 4096;
+
+static void AES256CBC_ENCRYPT(benchmark::Bench& bench, size_t buffersize)
+{
+    std::vector<uint8_t> key(AES256_KEYSIZE, 1), iv(AES_BLOCKSIZE, 2);
+    AES256CBCEncrypt enc(key.data(), iv.data(), true);
+    std::vector<uint8_t> in(buffersize, 0);
+    std::vector<uint8_t> out(buffersize + AES_BLOCKSIZE, 0);
+    bench.batch(in.size()).unit("byte").run([&] {
+        enc.Encrypt(in.data(), in.size(), out.data());
+    });
+}
+
+static void AES256CBC_DECRYPT(benchmark::Bench& bench, size_t buffersize)
+{
+    std::vector<uint8_t> key(AES256_KEYSIZE, 1), iv(AES_BLOCKSIZE, 2);
+    std::vector<uint8_t> in(buffersize, 0);
+    std::vector<uint8_t> cipher(buffersize + AES_BLOCKSIZE, 0), out(buffersize + AES_BLOCKSIZE, 0);
+    cipher.resize(AES256CBCEncrypt(key.data(), iv.data(), true).Encrypt(in.data(), in.size(), cipher.data()));
+    AES256CBCDecrypt dec(key.data(), iv.data(), true);
+    bench.batch(in.size()).unit("byte").run([&] {
+        dec.Decrypt(cipher.data(), cipher.size(), out.data());
+    });
+}
+
+static void AES256CBC_DECRYPT_4096BYTES(benchmark::Bench& bench)
+{
+    AES256CBC_DECRYPT(bench, BUFFER_SIZE_MESSAGE);
+}
+
+static void AES256CBC_ENCRYPT_4096BYTES(benchmark::Bench& bench)
+{
+    AES256CBC_ENCRYPT(bench, BUFFER_SIZE_MESSAGE);
+}
+
+/* A wallet unlock sets up a fresh key schedule for every key it decrypts */
+static void AES256CBC_DECRYPT_KEY(benchmark::Bench& bench)
+{
+    std::vector<uint8_t> key(AES256_KEYSIZE, 1), iv(AES_BLOCKSIZE, 2);
+    std::vector<uint8_t> in(32, 0);
+    std::vector<uint8_t> cipher(BUFFER_SIZE_KEY, 0), out(BUFFER_SIZE_KEY, 0);
+    AES256CBCEncrypt(key.data(), iv.data(), true).Encrypt(in.data(), in.size(), cipher.data());
+    bench.batch(cipher.size()).unit("byte").run([&] {
+        AES256CBCDecrypt(key.data(), iv.data(), true).Decrypt(cipher.data(), cipher.size(), out.data());
+    });
+}
+
+BENCHMARK(AES256CBC_ENCRYPT_4096BYTES);
+BENCHMARK(AES256CBC_DECRYPT_4096BYTES);
+BENCHMARK(AES256CBC_DECRYPT_KEY);
@@ -5,10 +5,17 @@
 #include <bench/bench.h>
 
 #include <chainparams.h>
+#include <clientversion.h>
 #include <test/util/setup_common.h>
+#include <util/time.h>
 #include <validation.h>
 
+#include <univalue.h>
+
+#include <fstream>
 #include <regex>
+#include <set>
+#include <sstream>
 
 const std::function<void(const std::string&)> G_TEST_LOG_FUN{};
 
@@ -30,8 +37,113 @@ void GenerateTemplateResults(const std::vector<ankerl::nanobench::Result>& bench
     std::cout << "Created '" << filename << "'" << std::endl;
 }
 
+using ankerl::nanobench::Result;
+
+//! Median time per unit in ns, the figure compared against the baseline
+double NsPerUnit(const Result& result)
+{
+    return result.median(Result::Measure::elapsed) / result.config().mBatch * 1e9;
+}
+
+/**
+ * Results as a baseline file: the build they were taken on and, by benchmark
+ * name, the nanobench stats. A benchmark entry of a baseline may carry its own
+ * "tolerance" in percent, overriding -tolerance.
+ */
+UniValue ResultsToJSON(const std::vector<Result>& results)
+{
+    UniValue benchmarks(UniValue::VOBJ);
+    for (const auto& result : results) {
+        const double batch = result.config().mBatch;
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("unit", result.config().mUnit);
+        entry.pushKV("batch", batch);
+        entry.pushKV("ns_per_unit", NsPerUnit(result));
+        entry.pushKV("min_ns_per_unit", result.minimum(Result::Measure::elapsed) / batch * 1e9);
+        entry.pushKV("max_ns_per_unit", result.maximum(Result::Measure::elapsed) / batch * 1e9);
+        entry.pushKV("err_pct", result.medianAbsolutePercentError(Result::Measure::elapsed) * 100);
+        entry.pushKV("epochs", (uint64_t)result.size());
+        entry.pushKV("iterations", result.sum(Result::Measure::iterations));
+        benchmarks.pushKV(result.config().mBenchmarkName, entry);
+    }
+
+    UniValue out(UniValue::VOBJ);
+    out.pushKV("version", FormatFullVersion());
+    out.pushKV("client_build", CLIENT_BUILD);
+    out.pushKV("time", GetTime());
+    out.pushKV("benchmarks", benchmarks);
+    return out;
+}
+
+void WriteResults(const std::vector<Result>& results, const std::string& filename)
+{
+    if (results.empty() || filename.empty()) {
+        return;
+    }
+    std::ofstream fout(filename);
+    if (!fout.is_open()) {
+        std::cout << "Could not write to file '" << filename << "'" << std::endl;
+        return;
+    }
+    fout << ResultsToJSON(results).write(2) << std::endl;
+    std::cout << "Created '" << filename << "'" << std::endl;
+}
+
+//! Returns the number of benchmarks slower than the baseline by more than the tolerance
+int CompareToBaseline(const std::vector<Result>& results, const std::string& filename, double tolerance)
+{
+    std::ifstream fin(filename);
+    std::stringstream ss;
+    ss << fin.rdbuf();
+    UniValue baseline;
+    if (!fin.is_open() || !baseline.read(ss.str()) || !baseline["benchmarks"].isObject()) {
+        std::cout << "Could not read baseline '" << filename << "'" << std::endl;
+        return 1;
+    }
+    const UniValue& base_benchmarks = baseline["benchmarks"];
+    std::cout << "Comparing to baseline '" << filename << "' of " << baseline["version"].getValStr() << std::endl;
+    tfm::format(std::cout, "%-48s %12s %12s %11s\n", "benchmark", "baseline", "current", "change");
+
+    int regressions = 0;
+    for (const auto& result : results) {
+        const std::string& name = result.config().mBenchmarkName;
+        const UniValue& base = base_benchmarks[name];
+        if (!base.isObject() || !base["ns_per_unit"].isNum()) {
+            tfm::format(std::cout, "%-48s %12s\n", name, "no baseline");
+            continue;
+        }
+        const double base_ns = base["ns_per_unit"].get_real();
+        const double allowed = base["tolerance"].isNum() ? base["tolerance"].get_real() : tolerance;
+        const double ns = NsPerUnit(result);
+        const double change = base_ns > 0 ? (ns / base_ns - 1) * 100 : 0;
+        const bool regressed = change > allowed;
+        if (regressed) {
+            regressions++;
+        }
+        tfm::format(std::cout, "%-48s %12.2f %12.2f ns/%s %+8.1f%% %s\n",
+            name, base_ns, ns, result.config().mUnit, change, regressed ? "REGRESSED" : "ok");
+    }
+    std::cout << regressions << " regression(s) above the tolerance" << std::endl;
+    return regressions;
+}
+
 } // namespace
 
+const std::map<std::string, std::vector<std::string>>& benchmark::BenchSubsets()
+{
+    static const std::map<std::string, std::vector<std::string>> subsets{
+        {"particl-critical", {
+            "Mlsag", "MlsagBlock",
+            "Blind", "BlindBlockVerify",
+            "SmsgEncrypt1000", "SmsgDecrypt1000", "SmsgSetHash", "SmsgScanMessage100Keys",
+            "StakeKernelHashStream", "ParticlCheckStakeKernels1k", "ParticlSelectCoinsForStaking1k",
+            "InsightGetAddressDeltas10k", "InsightGetAddressBalance10k", "InsightGetSpentInfo10k",
+            "ParticlCheckBlock", "ParticlConnectBlock",
+        }},
+    };
+    return subsets;
+}
+
 benchmark::BenchRunner::BenchmarkMap& benchmark::BenchRunner::benchmarks()
 {
     static std::map<std::string, BenchFunction> benchmarks_map;
@@ -43,16 +155,29 @@ benchmark::BenchRunner::BenchRunner(std::string name, benchmark::BenchFunction f
     benchmarks().insert(std::make_pair(name, func));
 }
 
-void benchmark::BenchRunner::RunAll(const Args& args)
+bool benchmark::BenchRunner::RunAll(const Args& args)
 {
     std::regex reFilter(args.regex_filter);
     std::smatch baseMatch;
 
+    std::set<std::string> subset;
+    if (!args.subset.empty()) {
+        const auto it = BenchSubsets().find(args.subset);
+        if (it == BenchSubsets().end()) {
+            std::cout << "Unknown benchmark subset '" << args.subset << "'" << std::endl;
+            return false;
+        }
+        subset.insert(it->second.begin(), it->second.end());
+    }
+
     std::vector<ankerl::nanobench::Result> benchmarkResults;
     for (const auto& p : benchmarks()) {
         if (!std::regex_match(p.first, baseMatch, reFilter)) {
             continue;
         }
+        if (!args.subset.empty() && !subset.count(p.first)) {
+            continue;
+        }
 
         if (args.is_list_only) {
             std::cout << p.first << std::endl;
@@ -80,4 +205,10 @@ void benchmark::BenchRunner::RunAll(const Args& args)
                                                                "{{#result}}{{name}}, {{epochs}}, {{average(iterations)}}, {{sumProduct(iterations, elapsed)}}, {{minimum(elapsed)}}, {{maximum(elapsed)}}, {{median(elapsed)}}\n"
                                                                "{{/result}}");
     GenerateTemplateResults(benchmarkResults, args.output_json, ankerl::nanobench::templates::json());
+    WriteResults(benchmarkResults, args.output_results);
+
+    if (!args.baseline.empty()) {
+        return CompareToBaseline(benchmarkResults, args.baseline, args.tolerance) == 0;
+    }
+    return true;
 }
@@ -43,6 +43,10 @@ struct Args {
     std::vector<double> asymptote;
     std::string output_csv;
     std::string output_json;
+    std::string subset;
+    std::string output_results;
+    std::string baseline;
+    double tolerance;
 };
 
 class BenchRunner
@@ -53,8 +57,12 @@ class BenchRunner
 public:
     BenchRunner(std::string name, BenchFunction func);
 
-    static void RunAll(const Args& args);
+    /** Runs the selected benchmarks, false if any regressed against the baseline */
+    static bool RunAll(const Args& args);
 };
+
+/** Named sets of benchmarks, selectable with -subset */
+const std::map<std::string, std::vector<std::string>>& BenchSubsets();
 }
 // BENCHMARK(foo) expands to:  benchmark::BenchRunner bench_11foo("foo");
 #define BENCHMARK(n) \
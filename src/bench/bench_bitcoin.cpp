@@ -4,13 +4,17 @@
 
 #include <bench/bench.h>
 
+#include <crypto/aes.h>
+#include <crypto/ripemd160.h>
 #include <crypto/sha256.h>
+#include <crypto/sha512.h>
 #include <util/strencodings.h>
 #include <util/system.h>
 
 #include <memory>
 
 static const char* DEFAULT_BENCH_FILTER = ".*";
+static const double DEFAULT_BENCH_TOLERANCE = 10.0;
 
 static void SetupBenchArgs(ArgsManager& argsman)
 {
@@ -21,6 +25,10 @@ static void SetupBenchArgs(ArgsManager& argsman)
     argsman.AddArg("-asymptote=n1,n2,n3,...", strprintf("Test asymptotic growth of the runtime of an algorithm, if supported by the benchmark"), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-output_csv=<output.csv>", "Generate CSV file with the most important benchmark results.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-output_json=<output.json>", "Generate JSON file with all benchmark results.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-subset=<name>", "Run only the benchmarks of a named subset, combined with -filter. Subsets: particl-critical", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-output_results=<results.json>", "Generate a results file with the build version, usable as a -baseline.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-baseline=<results.json>", "Compare the median time per unit of each benchmark to a results file, fail if any is slower by more than the tolerance.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-tolerance=<pct>", strprintf("Percentage a benchmark may be slower than the -baseline before failing, unless the baseline entry sets its own (default: %.1f)", DEFAULT_BENCH_TOLERANCE), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 }
 
 // parses a comma separated list like "10,20,30,50"
@@ -41,6 +49,9 @@ int main(int argc, char** argv)
     ArgsManager argsman;
     SetupBenchArgs(argsman);
     SHA256AutoDetect();
+    SHA512AutoDetect();
+    RIPEMD160AutoDetect();
+    AESAutoDetect();
     std::string error;
     if (!argsman.ParseParameters(argc, argv, error)) {
         tfm::format(std::cerr, "Error parsing command line arguments: %s\n", error);
@@ -59,8 +70,18 @@ int main(int argc, char** argv)
     args.asymptote = parseAsymptote(argsman.GetArg("-asymptote", ""));
     args.output_csv = argsman.GetArg("-output_csv", "");
     args.output_json = argsman.GetArg("-output_json", "");
+    args.subset = argsman.GetArg("-subset", "");
+    args.output_results = argsman.GetArg("-output_results", "");
+    args.baseline = argsman.GetArg("-baseline", "");
+    args.tolerance = DEFAULT_BENCH_TOLERANCE;
+    if (argsman.IsArgSet("-tolerance") && !ParseDouble(argsman.GetArg("-tolerance", ""), &args.tolerance)) {
+        tfm::format(std::cerr, "Invalid -tolerance: %s\n", argsman.GetArg("-tolerance", ""));
+        return EXIT_FAILURE;
+    }
 
-    benchmark::BenchRunner::RunAll(args);
+    if (!benchmark::BenchRunner::RunAll(args)) {
+        return EXIT_FAILURE;
+    }
 
     return EXIT_SUCCESS;
 }
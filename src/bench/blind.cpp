@@ -5,11 +5,15 @@
 #include <iostream>
 
 #include <bench/bench.h>
+#include <bench/checkqueue_workers.h>
+#include <util/system.h>
 #include <util/time.h>
 
 #include <blind.h>
+#include <checkqueue.h>
 #include <random.h>
 #include <key.h>
+#include <test/util/setup_common.h>
 
 #include <secp256k1_rangeproof.h>
 
@@ -64,3 +68,47 @@ static void Blind(benchmark::Bench& bench)
 
 BENCHMARK(Blind);
 
+static const size_t BLIND_BLOCK_OUTPUTS = 100;
+static const unsigned int BLIND_QUEUE_BATCH_SIZE = 128;
+
+static void BlindBlockVerify(benchmark::Bench& bench)
+{
+    // Sets up the proof cache the checks look proofs up in
+    BasicTestingSetup test_setup{CBaseChainParams::REGTEST, {}, true};
+    ECC_Start_Blinding();
+
+    std::vector<secp256k1_pedersen_commitment> vCommitments(BLIND_BLOCK_OUTPUTS);
+    std::vector<std::vector<uint8_t> > vProofs(BLIND_BLOCK_OUTPUTS);
+    for (size_t k = 0; k < BLIND_BLOCK_OUTPUTS; ++k) {
+        uint64_t nValue = (k + 1) * COIN;
+        uint8_t blind[32], nonce[32];
+        GetStrongRandBytes(blind, 32);
+        GetStrongRandBytes(nonce, 32);
+        assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &vCommitments[k], blind, nValue, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+        const uint8_t *bp[1] = {blind};
+        size_t nRangeProofLen = 5134;
+        vProofs[k].resize(nRangeProofLen);
+        assert(secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+            vProofs[k].data(), &nRangeProofLen, &nValue, nullptr, bp, 1,
+            &secp256k1_generator_const_h, 64, nonce, nullptr, 0));
+        vProofs[k].resize(nRangeProofLen);
+    }
+
+    CCheckQueue<CRangeProofCheck> queue {BLIND_QUEUE_BATCH_SIZE};
+    benchmark::CheckQueueWorkers<CRangeProofCheck> workers(queue, GetNumCores());
+
+    bench.batch(BLIND_BLOCK_OUTPUTS).unit("proof").run([&] {
+        std::vector<CRangeProofCheck> vChecks;
+        for (size_t k = 0; k < BLIND_BLOCK_OUTPUTS; ++k) {
+            AddRangeProofCheck(vChecks, true, false, &vCommitments[k], &vProofs[k], "bad-ctout-rangeproof-verify");
+        }
+        CCheckQueueControl<CRangeProofCheck> control(&queue);
+        control.Add(vChecks);
+        assert(control.Wait());
+    });
+
+    ECC_Stop_Blinding();
+}
+
+BENCHMARK(BlindBlockVerify);
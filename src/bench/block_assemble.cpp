@@ -3,8 +3,10 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <bench/bench.h>
+#include <chainparams.h>
 #include <consensus/validation.h>
 #include <crypto/sha256.h>
+#include <miner.h>
 #include <test/util/mining.h>
 #include <test/util/setup_common.h>
 #include <test/util/wallet.h>
@@ -59,4 +61,60 @@ static void AssembleBlock(benchmark::Bench& bench)
     });
 }
 
+/** A template from a mempool of 50k txs, mempool_rebuild forces the candidate set to be rebuilt every time */
+static void AssembleBlockLargeMempool(benchmark::Bench& bench, bool mempool_rebuild)
+{
+    TestingSetup test_setup{
+        CBaseChainParams::REGTEST,
+        /* extra_args */ {
+            "-nodebuglogfile",
+            "-nodebug",
+        },
+    };
+    CTxMemPool& pool = *test_setup.m_node.mempool;
+    const CScript script_pub{CScript() << OP_TRUE};
+
+    // Independent txs at varied fee rates, the block fits a fraction of them
+    constexpr int NUM_TXS{50000};
+    FastRandomContext det_rand{true};
+    TestMemPoolEntryHelper entry;
+    auto make_tx = [&](uint32_t n) {
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(uint256::ONE, n);
+        tx.vin[0].scriptSig = CScript() << OP_1;
+        tx.vout.emplace_back(1337, script_pub);
+        return MakeTransactionRef(tx);
+    };
+    LOCK2(cs_main, pool.cs);
+    for (int i = 0; i < NUM_TXS; ++i) {
+        pool.addUnchecked(entry.Fee(1000 + det_rand.randrange(100000)).FromTx(make_tx(i)));
+    }
+
+    // Every template sees one tx enter and one leave the mempool, as between stake attempts
+    uint32_t n = NUM_TXS;
+    bench.run([&]() NO_THREAD_SAFETY_ANALYSIS {
+        CTransactionRef tx = make_tx(n++);
+        pool.addUnchecked(entry.Fee(1000 + det_rand.randrange(100000)).FromTx(tx));
+        if (mempool_rebuild) {
+            pool.m_block_candidates.MarkStale();
+        }
+        auto block_template = BlockAssembler{pool, Params()}.CreateNewBlock(script_pub, false /* fTestBlockValidity */);
+        assert(block_template->block.vtx.size() > 1);
+        pool.removeRecursive(*tx, MemPoolRemovalReason::REPLACED);
+    });
+}
+
+static void AssembleBlockLargeMempoolIncremental(benchmark::Bench& bench)
+{
+    AssembleBlockLargeMempool(bench, false);
+}
+
+static void AssembleBlockLargeMempoolRebuild(benchmark::Bench& bench)
+{
+    AssembleBlockLargeMempool(bench, true);
+}
+
 BENCHMARK(AssembleBlock);
+BENCHMARK(AssembleBlockLargeMempoolIncremental);
+BENCHMARK(AssembleBlockLargeMempoolRebuild);
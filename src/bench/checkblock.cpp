@@ -49,5 +49,43 @@ static void DeserializeAndCheckBlockTest(benchmark::Bench& bench)
     });
 }
 
+// Particl format transactions hold their outputs in vpout, one allocation each
+static void DeserializeParticlBlockTest(benchmark::Bench& bench)
+{
+    CBlock block;
+    for (int i = 0; i < 500; ++i) {
+        CMutableTransaction mtx;
+        mtx.nVersion = GHOST_TXN_VERSION;
+        mtx.vin.resize(2);
+        for (auto &txin : mtx.vin) {
+            txin.prevout = COutPoint(uint256S("0x01"), i);
+            txin.scriptWitness.stack.resize(2, std::vector<uint8_t>(33, 0x02));
+        }
+        mtx.vpout.push_back(MAKE_OUTPUT<CTxOutData>(std::vector<uint8_t>{DO_FEE, 0x01}));
+        for (int k = 0; k < 3; ++k) {
+            mtx.vpout.push_back(MAKE_OUTPUT<CTxOutStandard>(1000 + k, CScript() << OP_DUP << OP_HASH160 << std::vector<uint8_t>(20, k) << OP_EQUALVERIFY << OP_CHECKSIG));
+        }
+        auto out_ct = MAKE_OUTPUT<CTxOutCT>();
+        out_ct->vData.resize(33);
+        out_ct->scriptPubKey = CScript() << OP_HASH160 << std::vector<uint8_t>(20, 0x03) << OP_EQUAL;
+        out_ct->vRangeproof.resize(650);
+        mtx.vpout.push_back(out_ct);
+        block.vtx.push_back(MakeTransactionRef(std::move(mtx)));
+    }
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << block;
+    const size_t size = stream.size();
+    char a = '\0';
+    stream.write(&a, 1); // Prevent compaction
+
+    bench.unit("block").run([&] {
+        CBlock block_out;
+        stream >> block_out;
+        bool rewound = stream.Rewind(size);
+        assert(rewound);
+    });
+}
+
 BENCHMARK(DeserializeBlockTest);
 BENCHMARK(DeserializeAndCheckBlockTest);
+BENCHMARK(DeserializeParticlBlockTest);
@@ -3,15 +3,25 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <bench/bench.h>
+#include <bench/checkqueue_workers.h>
+#include <anon.h>
+#include <blind.h>
 #include <checkqueue.h>
 #include <key.h>
 #include <prevector.h>
 #include <pubkey.h>
 #include <random.h>
+#include <script/standard.h>
+#include <test/util/setup_common.h>
+#include <test/util/transaction_utils.h>
 #include <util/system.h>
+#include <validation.h>
 
 #include <boost/thread/thread.hpp>
 
+#include <secp256k1_mlsag.h>
+#include <secp256k1_rangeproof.h>
+
 #include <vector>
 
 static const size_t BATCHES = 101;
@@ -75,3 +85,280 @@ static void CCheckQueueSpeedPrevectorJob(benchmark::Bench& bench)
     ECC_Stop();
 }
 BENCHMARK(CCheckQueueSpeedPrevectorJob);
+
+// Checks of each workload in one simulated block
+static const size_t MLSAG_RINGS = 64;
+static const size_t RANGEPROOFS = 256;
+static const size_t SCRIPT_INPUTS = 1000;
+
+/** Signed ring data for one anon input, kept alive while the checks point into it */
+struct QueueMlsagTx
+{
+    uint8_t preimage[32];
+    uint8_t ki[2 * 33];
+    uint8_t pc[32];
+    uint8_t ss[3 * 11 * 32];
+    std::vector<secp256k1_pedersen_commitment> cm_out;
+};
+
+/**
+ * Each Particl proof workload, built once and copied into fresh checks for
+ * every block as ConnectBlock queues them, wrapped in CScriptCheck.
+ */
+class MlsagWorkload
+{
+    std::vector<QueueMlsagTx> m_txns = std::vector<QueueMlsagTx>(MLSAG_RINGS);
+    std::vector<CMLSAGCheck> m_checks;
+
+public:
+    MlsagWorkload()
+    {
+        const size_t nInputs = 2, nCols = 11, nRows = nInputs + 1, nOutputs = 2, nBlinded = 1;
+        FastRandomContext insecure_rand(true);
+        for (auto &txn : m_txns) {
+            size_t nRealCol = insecure_rand.randrange(nCols);
+            int64_t nValues[] = {1234 * COIN, 1234 * COIN, 2467 * COIN, 1 * COIN};
+            uint8_t zero32[32] = {0}, tmp32[32], blindSum[32];
+            std::vector<CKey> vKeys(nInputs), vBlindsOut(nBlinded), vBlindsIn(nInputs);
+            const uint8_t *pkeys[nInputs + 1], *pblinds[nInputs + nOutputs];
+            std::vector<const uint8_t*> pcm_in(nInputs * nCols), pcm_out(nOutputs);
+            std::vector<uint8_t> m(nRows * nCols * 33), vCommitments(nInputs * nCols * 33);
+
+            txn.cm_out.resize(nOutputs);
+            for (size_t k = 0; k < nOutputs; ++k) {
+                const uint8_t *blind = zero32;
+                if (k < nBlinded) {
+                    vBlindsOut[k].MakeNewKey(true);
+                    blind = pblinds[nInputs + k] = vBlindsOut[k].begin();
+                }
+                assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &txn.cm_out[k], blind, nValues[nInputs + k], &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+                pcm_out[k] = txn.cm_out[k].data;
+            }
+
+            for (size_t k = 0; k < nInputs; ++k)
+            for (size_t i = 0; i < nCols; ++i) {
+                secp256k1_pedersen_commitment cm;
+                CKey key, blind;
+                key.MakeNewKey(true);
+                blind.MakeNewKey(true);
+                CAmount v = 10;
+                if (i == nRealCol) {
+                    vKeys[k] = key;
+                    vBlindsIn[k] = blind;
+                    pkeys[k] = vKeys[k].begin();
+                    pblinds[k] = vBlindsIn[k].begin();
+                    v = nValues[k];
+                }
+                CPubKey pk = key.GetPubKey();
+                memcpy(&m[(i + k * nCols) * 33], pk.begin(), 33);
+                assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &cm, blind.begin(), v, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+                memcpy(&vCommitments[(i + k * nCols) * 33], cm.data, 33);
+                pcm_in[i + k * nCols] = &vCommitments[(i + k * nCols) * 33];
+            }
+
+            pkeys[nInputs] = blindSum;
+            assert(0 == secp256k1_prepare_mlsag(m.data(), blindSum,
+                nOutputs, nBlinded, nCols, nRows,
+                pcm_in.data(), pcm_out.data(), pblinds));
+
+            GetRandBytes(tmp32, 32);
+            GetRandBytes(txn.preimage, 32);
+            assert(0 == secp256k1_generate_mlsag(secp256k1_ctx_blind, txn.ki, txn.pc, txn.ss,
+                tmp32, txn.preimage, nCols, nRows, nRealCol,
+                pkeys, m.data()));
+
+            m_checks.emplace_back(txn.preimage, nCols, nRows, std::move(m),
+                std::move(vCommitments), pcm_in, pcm_out,
+                txn.ki, txn.pc, txn.ss);
+        }
+    }
+
+    size_t Items() const { return MLSAG_RINGS; }
+
+    std::vector<CScriptCheck> Checks() const
+    {
+        std::vector<CScriptCheck> vChecks;
+        vChecks.reserve(m_checks.size());
+        for (CMLSAGCheck check : m_checks) {
+            vChecks.emplace_back(check);
+        }
+        return vChecks;
+    }
+};
+
+class RangeProofWorkload
+{
+    std::vector<secp256k1_pedersen_commitment> m_commitments = std::vector<secp256k1_pedersen_commitment>(RANGEPROOFS);
+    std::vector<std::vector<uint8_t>> m_proofs = std::vector<std::vector<uint8_t>>(RANGEPROOFS);
+
+public:
+    RangeProofWorkload()
+    {
+        for (size_t k = 0; k < RANGEPROOFS; ++k) {
+            uint64_t nValue = (k + 1) * COIN;
+            uint8_t blind[32], nonce[32];
+            GetStrongRandBytes(blind, 32);
+            GetStrongRandBytes(nonce, 32);
+            assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &m_commitments[k], blind, nValue, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+            const uint8_t *bp[1] = {blind};
+            size_t nRangeProofLen = 5134;
+            m_proofs[k].resize(nRangeProofLen);
+            assert(secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+                m_proofs[k].data(), &nRangeProofLen, &nValue, nullptr, bp, 1,
+                &secp256k1_generator_const_h, 64, nonce, nullptr, 0));
+            m_proofs[k].resize(nRangeProofLen);
+        }
+    }
+
+    size_t Items() const { return RANGEPROOFS; }
+
+    // Batched by AddRangeProofCheck, RANGEPROOF_BATCH_SIZE proofs per check
+    std::vector<CScriptCheck> Checks() const
+    {
+        std::vector<CRangeProofCheck> vRangeProofChecks;
+        for (size_t k = 0; k < RANGEPROOFS; ++k) {
+            AddRangeProofCheck(vRangeProofChecks, true, false, &m_commitments[k], &m_proofs[k], "bad-ctout-rangeproof-verify");
+        }
+        std::vector<CScriptCheck> vChecks;
+        vChecks.reserve(vRangeProofChecks.size());
+        for (auto &check : vRangeProofChecks) {
+            vChecks.emplace_back(check);
+        }
+        return vChecks;
+    }
+};
+
+/** One transaction spending SCRIPT_INPUTS P2WPKH outputs of different keys */
+class ScriptWorkload
+{
+    std::vector<CTxOut> m_spent;
+    CTransactionRef m_tx;
+    std::unique_ptr<PrecomputedTransactionData> m_txdata;
+
+public:
+    ScriptWorkload()
+    {
+        CMutableTransaction spend;
+        std::vector<CKey> keys(SCRIPT_INPUTS);
+        for (auto &key : keys) {
+            key.MakeNewKey(true);
+            CScript script = GetScriptForDestination(WitnessV0KeyHash(key.GetPubKey()));
+            const CMutableTransaction credit = BuildCreditingTransaction(script, 1);
+            m_spent.push_back(credit.vout[0]);
+            spend.vin.emplace_back(COutPoint(credit.GetHash(), 0));
+        }
+        spend.vout.emplace_back(SCRIPT_INPUTS - 1, CScript() << OP_TRUE);
+
+        for (size_t k = 0; k < SCRIPT_INPUTS; ++k) {
+            const CPubKey pubkey = keys[k].GetPubKey();
+            const CScript script_code = GetScriptForDestination(PKHash(pubkey));
+            std::vector<uint8_t> vchAmount(8);
+            part::SetAmount(vchAmount, m_spent[k].nValue);
+            std::vector<uint8_t> sig;
+            bool signed_input = keys[k].Sign(SignatureHash(script_code, spend, k, SIGHASH_ALL, vchAmount, SigVersion::WITNESS_V0), sig);
+            assert(signed_input);
+            sig.push_back(static_cast<unsigned char>(SIGHASH_ALL));
+            spend.vin[k].scriptWitness.stack = {sig, ToByteVector(pubkey)};
+        }
+        m_tx = MakeTransactionRef(std::move(spend));
+        m_txdata = MakeUnique<PrecomputedTransactionData>(*m_tx);
+    }
+
+    size_t Items() const { return SCRIPT_INPUTS; }
+
+    std::vector<CScriptCheck> Checks()
+    {
+        std::vector<CScriptCheck> vChecks;
+        vChecks.reserve(SCRIPT_INPUTS);
+        for (size_t k = 0; k < SCRIPT_INPUTS; ++k) {
+            vChecks.emplace_back(m_spent[k], *m_tx, k, SCRIPT_VERIFY_P2SH | SCRIPT_VERIFY_WITNESS, false, m_txdata.get());
+        }
+        return vChecks;
+    }
+};
+
+/**
+ * A block's worth of checks of the workload verified through a queue with
+ * workers threads, the main thread counted as one as under -par, and the
+ * queue handing out up to queue_batch_size checks at a time.
+ */
+template <typename Workload>
+static void ProofQueue(benchmark::Bench& bench, const char* unit, int workers, unsigned int queue_batch_size)
+{
+    if (workers > GetNumCores()) return;
+
+    BasicTestingSetup test_setup{CBaseChainParams::REGTEST, {}, true};
+    ECC_Start_Blinding();
+    {
+    Workload workload;
+
+    CCheckQueue<CScriptCheck> queue {queue_batch_size};
+    benchmark::CheckQueueWorkers<CScriptCheck> queue_workers(queue, workers);
+
+    bench.batch(workload.Items()).unit(unit).run([&] {
+        std::vector<CScriptCheck> vChecks = workload.Checks();
+        CCheckQueueControl<CScriptCheck> control(&queue);
+        control.Add(vChecks);
+        assert(control.Wait());
+    });
+    }
+    ECC_Stop_Blinding();
+}
+
+// Worker counts past MAX_SCRIPTCHECK_THREADS + 1 show what raising the -par cap would give
+static void CCheckQueueMlsagPar1(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 1, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagPar2(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 2, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagPar4(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 4, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagPar8(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 8, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagPar16(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 16, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagPar32(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", 32, QUEUE_BATCH_SIZE); }
+static void CCheckQueueMlsagBatch1(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", GetNumCores(), 1); }
+static void CCheckQueueMlsagBatch16(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", GetNumCores(), 16); }
+static void CCheckQueueMlsagBatch1024(benchmark::Bench& bench) { ProofQueue<MlsagWorkload>(bench, "ring", GetNumCores(), 1024); }
+static void CCheckQueueRangeProofPar1(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 1, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofPar2(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 2, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofPar4(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 4, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofPar8(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 8, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofPar16(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 16, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofPar32(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", 32, QUEUE_BATCH_SIZE); }
+static void CCheckQueueRangeProofBatch1(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", GetNumCores(), 1); }
+static void CCheckQueueRangeProofBatch16(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", GetNumCores(), 16); }
+static void CCheckQueueRangeProofBatch1024(benchmark::Bench& bench) { ProofQueue<RangeProofWorkload>(bench, "proof", GetNumCores(), 1024); }
+static void CCheckQueueScriptPar1(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 1, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptPar2(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 2, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptPar4(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 4, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptPar8(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 8, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptPar16(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 16, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptPar32(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", 32, QUEUE_BATCH_SIZE); }
+static void CCheckQueueScriptBatch1(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", GetNumCores(), 1); }
+static void CCheckQueueScriptBatch16(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", GetNumCores(), 16); }
+static void CCheckQueueScriptBatch1024(benchmark::Bench& bench) { ProofQueue<ScriptWorkload>(bench, "input", GetNumCores(), 1024); }
+
+BENCHMARK(CCheckQueueMlsagPar1);
+BENCHMARK(CCheckQueueMlsagPar2);
+BENCHMARK(CCheckQueueMlsagPar4);
+BENCHMARK(CCheckQueueMlsagPar8);
+BENCHMARK(CCheckQueueMlsagPar16);
+BENCHMARK(CCheckQueueMlsagPar32);
+BENCHMARK(CCheckQueueMlsagBatch1);
+BENCHMARK(CCheckQueueMlsagBatch16);
+BENCHMARK(CCheckQueueMlsagBatch1024);
+BENCHMARK(CCheckQueueRangeProofPar1);
+BENCHMARK(CCheckQueueRangeProofPar2);
+BENCHMARK(CCheckQueueRangeProofPar4);
+BENCHMARK(CCheckQueueRangeProofPar8);
+BENCHMARK(CCheckQueueRangeProofPar16);
+BENCHMARK(CCheckQueueRangeProofPar32);
+BENCHMARK(CCheckQueueRangeProofBatch1);
+BENCHMARK(CCheckQueueRangeProofBatch16);
+BENCHMARK(CCheckQueueRangeProofBatch1024);
+BENCHMARK(CCheckQueueScriptPar1);
+BENCHMARK(CCheckQueueScriptPar2);
+BENCHMARK(CCheckQueueScriptPar4);
+BENCHMARK(CCheckQueueScriptPar8);
+BENCHMARK(CCheckQueueScriptPar16);
+BENCHMARK(CCheckQueueScriptPar32);
+BENCHMARK(CCheckQueueScriptBatch1);
+BENCHMARK(CCheckQueueScriptBatch16);
+BENCHMARK(CCheckQueueScriptBatch1024);
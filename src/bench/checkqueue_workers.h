@@ -0,0 +1,42 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_BENCH_CHECKQUEUE_WORKERS_H
+#define BITCOIN_BENCH_CHECKQUEUE_WORKERS_H
+
+#include <checkqueue.h>
+
+#include <boost/thread/thread.hpp>
+
+namespace benchmark {
+
+/**
+ * Threads servicing a check queue for the lifetime of a benchmark.
+ * The thread waiting on the queue control joins in, so one less thread is
+ * started than there are workers.
+ */
+template <typename T>
+class CheckQueueWorkers
+{
+private:
+    boost::thread_group m_threads;
+
+public:
+    CheckQueueWorkers(CCheckQueue<T>& queue, int workers)
+    {
+        for (int i = 0; i < workers - 1; ++i) {
+            m_threads.create_thread([&queue] { queue.Thread(); });
+        }
+    }
+
+    ~CheckQueueWorkers()
+    {
+        m_threads.interrupt_all();
+        m_threads.join_all();
+    }
+};
+
+} // namespace benchmark
+
+#endif // BITCOIN_BENCH_CHECKQUEUE_WORKERS_H
@@ -2,10 +2,14 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <arith_uint256.h>
 #include <bench/bench.h>
 #include <interfaces/chain.h>
 #include <node/context.h>
+#include <test/util/setup_common.h>
+#include <wallet/coincontrol.h>
 #include <wallet/coinselection.h>
+#include <wallet/hdwallet.h>
 #include <wallet/wallet.h>
 
 #include <set>
@@ -114,5 +118,76 @@ static void BnBExhaustion(benchmark::Bench& bench)
     });
 }
 
+// Changeless selection over the effective values of blinded or anon inputs, from
+// many small outputs as left by a long run of stealth receives. The search may
+// end at the try limit, as when the wallet falls back to the knapsack.
+static void BnBBlindedValues(benchmark::Bench& bench)
+{
+    const CAmount input_fee = 1000;
+    std::vector<CAmount> effective_values;
+    FastRandomContext rng(true);
+    for (int i = 0; i < 400; ++i) {
+        effective_values.push_back(COIN / 10 + rng.randrange(COIN) - input_fee);
+    }
+    const CAmount target = effective_values[3] + effective_values[17] + effective_values[250];
+
+    bench.run([&] {
+        std::vector<size_t> selected;
+        SelectValuesBnB(effective_values, target, 2048, selected);
+    });
+}
+
+// A wallet with a long history of RingCT records where each record spends the
+// anon output of the previous one, leaving one unspent output per 100 records.
+static void AvailableAnonCoins(benchmark::Bench& bench)
+{
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-nodebuglogfile", "-nodebug"}};
+    std::unique_ptr<interfaces::Chain> chain = interfaces::MakeChain(test_setup.m_node);
+    CHDWallet wallet(chain.get(), "", CreateMockWalletDatabase());
+
+    const int num_records = 50000;
+    const uint256 block_hash = uint256S("0x01");
+    {
+        CHDWalletDB wdb(wallet.GetDatabase());
+        wdb.WriteFlag("anon_vin_v2", 1);
+        uint256 prev_txid;
+        for (int i = 0; i < num_records; ++i) {
+            CTransactionRecord rtx;
+            rtx.blockHash = block_hash;
+            rtx.block_height = 1;
+            rtx.nFlags = ORF_ANON_IN;
+            if (i % 100 != 0) {
+                rtx.vin.emplace_back(prev_txid, 0);
+            }
+            COutputRecord r;
+            r.nType = OUTPUT_RINGCT;
+            r.nFlags = ORF_OWNED;
+            r.n = 0;
+            r.nValue = COIN;
+            rtx.InsertOutput(r);
+
+            uint256 txid = ArithToUint256(arith_uint256(i + 1));
+            wdb.WriteTxRecord(txid, rtx);
+            prev_txid = txid;
+        }
+    }
+    LOCK(wallet.cs_wallet);
+    wallet.SetLastBlockProcessed(100, block_hash);
+    {
+        CHDWalletDB wdb(wallet.GetDatabase());
+        bool loaded = wallet.LoadTxRecords(&wdb);
+        assert(loaded);
+    }
+
+    CCoinControl coin_control;
+    bench.run([&] {
+        std::vector<COutputR> coins;
+        wallet.AvailableAnonCoins(coins, true, &coin_control);
+        assert(coins.size() == num_records / 100);
+    });
+}
+
 BENCHMARK(CoinSelection);
 BENCHMARK(BnBExhaustion);
+BENCHMARK(BnBBlindedValues);
+BENCHMARK(AvailableAnonCoins);
@@ -0,0 +1,224 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <coldreward/coldrewardtracker.h>
+#include <random.h>
+#include <test/util/setup_common.h>
+#include <validation.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// 100k GVR addresses with a year of two minute blocks and a 30 day reward span
+static constexpr int NUM_ADDRESSES = 100000;
+static constexpr int BLOCKS_PER_YEAR = 365 * 24 * 30;
+static constexpr int REWARD_SPAN = 30 * 24 * 30;
+static constexpr int RANGES_PER_ADDRESS = 24;
+
+using AddressType = ColdRewardTracker::AddressType;
+
+static std::map<AddressType, std::vector<BlockHeightRange>> MakeRanges()
+{
+    FastRandomContext rng(true);
+    std::map<AddressType, std::vector<BlockHeightRange>> ranges;
+    for (int i = 0; i < NUM_ADDRESSES; ++i) {
+        const std::string str = "addr" + std::to_string(i);
+        std::vector<BlockHeightRange>& ar = ranges[AddressType(str.begin(), str.end())];
+        int height = rng.randrange(BLOCKS_PER_YEAR / RANGES_PER_ADDRESS);
+        unsigned prev = 0;
+        while (height < BLOCKS_PER_YEAR) {
+            const int end = std::min(height + (int)rng.randrange(2 * BLOCKS_PER_YEAR / RANGES_PER_ADDRESS), BLOCKS_PER_YEAR - 1);
+            const unsigned multiplier = 1 + rng.randrange(3);
+            ar.emplace_back(height, end, multiplier, prev);
+            prev = multiplier;
+            height = end + 1;
+        }
+    }
+    return ranges;
+}
+
+static void ColdRewardExtractMultiplier(benchmark::Bench& bench)
+{
+    const auto ranges = MakeRanges();
+    ColdRewardTracker tracker(20000 * COIN, REWARD_SPAN);
+    int height = BLOCKS_PER_YEAR;
+    bench.run([&] {
+        unsigned total = 0;
+        for (const auto& it : ranges) {
+            total += tracker.ExtractRewardMultiplierFromRanges(height, it.second);
+        }
+        assert(total > 0);
+        height++;
+    });
+}
+
+static void ColdRewardConnectBlock(benchmark::Bench& bench)
+{
+    std::map<AddressType, std::vector<BlockHeightRange>> ranges = MakeRanges();
+    std::map<AddressType, CAmount> balances;
+    for (const auto& it : ranges) {
+        balances[it.first] = 20000 * it.second.back().getRewardMultiplier() * COIN;
+    }
+    int checkpoint = 0;
+
+    ColdRewardTracker tracker(20000 * COIN, REWARD_SPAN);
+    tracker.setPersistedBalanceGetter([&](const AddressType& addr) {
+        auto it = balances.find(addr);
+        return it == balances.cend() ? 0 : it->second;
+    });
+    tracker.setPersistedBalanceSetter([&](const AddressType& addr, const CAmount& amount) { balances[addr] = amount; });
+    tracker.setPersistedRangesGetter([&](const AddressType& addr) {
+        auto it = ranges.find(addr);
+        return it == ranges.cend() ? std::vector<BlockHeightRange>() : it->second;
+    });
+    tracker.setPersistedRangesSetter([&](const AddressType& addr, const std::vector<BlockHeightRange>& r) { ranges[addr] = r; });
+    tracker.setPersistedCheckpointGetter([&]() { return checkpoint; });
+    tracker.setPersistedCheckpointSetter([&](int new_checkpoint) { checkpoint = std::max(checkpoint, new_checkpoint); });
+    tracker.setPersistedTransactionStarter([]() {});
+    tracker.setPersisterTransactionEnder([]() {});
+    tracker.setAllRangesGetter([&]() { return ranges; });
+
+    FastRandomContext rng(true);
+    std::map<int, uint256> checkpoints;
+    int height = BLOCKS_PER_YEAR;
+    tracker.getEligibleAddresses(height);
+    bench.run([&] {
+        // a block with a few GVR address transactions and a checkpoint every 100 blocks
+        height++;
+        if (height % 100 == 0) {
+            checkpoints[height - 100] = uint256();
+        }
+        tracker.startPersistedTransaction();
+        for (int i = 0; i < 10; ++i) {
+            const std::string str = "addr" + std::to_string(rng.randrange(NUM_ADDRESSES));
+            const CAmount change = ((CAmount)rng.randrange(40000) - 20000) * COIN;
+            tracker.addAddressTransaction(height, AddressType(str.begin(), str.end()), change, checkpoints);
+        }
+        tracker.endPersistedTransaction();
+        tracker.getEligibleAddresses(height);
+    });
+}
+
+// GVR address transactions in each benched block
+static constexpr int TXNS_PER_BLOCK = 50;
+
+/**
+ * The tracker of initColdReward(), reading and writing through its getters
+ * and setters into the block tree db of a TestingSetup. num_addresses GVR
+ * addresses are funded with 1 to 3 times the threshold spread over the
+ * minRewardRangeSpan window before the benched blocks.
+ */
+class PersistedTrackerSetup
+{
+public:
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-nodebuglogfile", "-nodebug"}};
+    ColdRewardTracker& tracker{initColdReward()};
+    FastRandomContext rng{true};
+    std::vector<AddressType> addresses;
+    // No checkpoints, the benched blocks can all be disconnected
+    const std::map<int, uint256> checkpoints;
+    int height;
+
+    explicit PersistedTrackerSetup(int num_addresses)
+    {
+        clearTrackedData();
+
+        const int span = tracker.MinimumRewardRangeSpan;
+        addresses.reserve(num_addresses);
+        for (int i = 0; i < num_addresses; ++i) {
+            const std::string str = "addr" + std::to_string(i);
+            addresses.emplace_back(str.begin(), str.end());
+        }
+
+        // One transaction per block with any of the addresses in it
+        int i = 0;
+        for (height = 1; height <= span; ++height) {
+            const int end = (int)((int64_t)num_addresses * height / span);
+            if (i == end) {
+                continue;
+            }
+            tracker.startPersistedTransaction();
+            for (; i < end; ++i) {
+                tracker.addAddressTransaction(height, addresses[i], (1 + rng.randrange(3)) * tracker.GVRThreshold, checkpoints);
+            }
+            tracker.endPersistedTransaction();
+        }
+        tracker.getEligibleAddresses(height);
+    }
+
+    ~PersistedTrackerSetup()
+    {
+        clearTrackedData();
+    }
+
+    /** Connect a block at height of random address transactions, returning them in connect order */
+    std::vector<std::pair<AddressType, CAmount>> ConnectBlock()
+    {
+        std::vector<std::pair<AddressType, CAmount>> changes;
+        tracker.startPersistedTransaction();
+        for (int i = 0; i < TXNS_PER_BLOCK; ++i) {
+            const AddressType& addr = addresses[rng.randrange(addresses.size())];
+            const CAmount change = ((CAmount)rng.randrange(2 * tracker.GVRThreshold / COIN) - tracker.GVRThreshold / COIN) * COIN;
+            tracker.addAddressTransaction(height, addr, change, checkpoints);
+            changes.emplace_back(addr, change);
+        }
+        tracker.endPersistedTransaction();
+        return changes;
+    }
+
+    /** Undo a block connected by ConnectBlock, as DisconnectBlock does with the undo data */
+    void DisconnectBlock(const std::vector<std::pair<AddressType, CAmount>>& changes)
+    {
+        tracker.startPersistedTransaction();
+        for (auto it = changes.rbegin(); it != changes.rend(); ++it) {
+            tracker.removeAddressTransaction(height, it->first, it->second);
+        }
+        tracker.endPersistedTransaction();
+    }
+};
+
+// A block of GVR address transactions connected on the tip and the eligible addresses of the next block
+static void ColdRewardPersistedConnect(benchmark::Bench& bench, int num_addresses)
+{
+    PersistedTrackerSetup setup(num_addresses);
+    bench.run([&] {
+        setup.ConnectBlock();
+        setup.height++;
+        setup.tracker.getEligibleAddresses(setup.height);
+    });
+}
+
+// A block connected and disconnected again, as in a one block reorg
+static void ColdRewardPersistedReorg(benchmark::Bench& bench, int num_addresses)
+{
+    PersistedTrackerSetup setup(num_addresses);
+    bench.run([&] {
+        const auto changes = setup.ConnectBlock();
+        setup.tracker.getEligibleAddresses(setup.height + 1);
+        setup.DisconnectBlock(changes);
+        setup.tracker.getEligibleAddresses(setup.height);
+    });
+}
+
+static void ColdRewardPersistedConnect1k(benchmark::Bench& bench) { ColdRewardPersistedConnect(bench, 1000); }
+static void ColdRewardPersistedConnect10k(benchmark::Bench& bench) { ColdRewardPersistedConnect(bench, 10000); }
+static void ColdRewardPersistedConnect100k(benchmark::Bench& bench) { ColdRewardPersistedConnect(bench, 100000); }
+static void ColdRewardPersistedConnect1M(benchmark::Bench& bench) { ColdRewardPersistedConnect(bench, 1000000); }
+static void ColdRewardPersistedReorg1k(benchmark::Bench& bench) { ColdRewardPersistedReorg(bench, 1000); }
+static void ColdRewardPersistedReorg10k(benchmark::Bench& bench) { ColdRewardPersistedReorg(bench, 10000); }
+static void ColdRewardPersistedReorg100k(benchmark::Bench& bench) { ColdRewardPersistedReorg(bench, 100000); }
+static void ColdRewardPersistedReorg1M(benchmark::Bench& bench) { ColdRewardPersistedReorg(bench, 1000000); }
+
+BENCHMARK(ColdRewardExtractMultiplier);
+BENCHMARK(ColdRewardConnectBlock);
+BENCHMARK(ColdRewardPersistedConnect1k);
+BENCHMARK(ColdRewardPersistedConnect10k);
+BENCHMARK(ColdRewardPersistedConnect100k);
+BENCHMARK(ColdRewardPersistedConnect1M);
+BENCHMARK(ColdRewardPersistedReorg1k);
+BENCHMARK(ColdRewardPersistedReorg10k);
+BENCHMARK(ColdRewardPersistedReorg100k);
+BENCHMARK(ColdRewardPersistedReorg1M);
@@ -5,6 +5,7 @@
 
 #include <bench/bench.h>
 #include <crypto/ripemd160.h>
+#include <crypto/hmac_sha512.h>
 #include <crypto/sha1.h>
 #include <crypto/sha256.h>
 #include <crypto/sha3.h>
@@ -80,6 +81,33 @@ static void SHA512(benchmark::Bench& bench)
     });
 }
 
+static void Hash160Batch_33b_1024(benchmark::Bench& bench)
+{
+    std::vector<uint8_t> in(33 * 1024, 0);
+    std::vector<uint8_t> out(20 * 1024);
+    bench.batch(1024).unit("hash").run([&] {
+        Hash160Batch(out.data(), in.data(), 33, 1024);
+    });
+}
+
+static void SHA512D64Midstate_1024(benchmark::Bench& bench)
+{
+    std::vector<uint64_t> midstates(8 * 1024, 0);
+    std::vector<uint8_t> in(64 * 1024, 0);
+    bench.batch(in.size()).unit("byte").run([&] {
+        SHA512D64Midstate(in.data(), midstates.data(), in.data(), 1024);
+    });
+}
+
+static void HMAC_SHA512_64b(benchmark::Bench& bench)
+{
+    uint8_t hash[CHMAC_SHA512::OUTPUT_SIZE] = {0};
+    const uint8_t key[32] = {0};
+    bench.batch(sizeof(hash)).unit("byte").run([&] {
+        CHMAC_SHA512(key, sizeof(key)).Write(hash, sizeof(hash)).Finalize(hash);
+    });
+}
+
 static void SipHash_32b(benchmark::Bench& bench)
 {
     uint256 x;
@@ -114,5 +142,8 @@ BENCHMARK(SHA3_256_1M);
 BENCHMARK(SHA256_32b);
 BENCHMARK(SipHash_32b);
 BENCHMARK(SHA256D64_1024);
+BENCHMARK(Hash160Batch_33b_1024);
+BENCHMARK(SHA512D64Midstate_1024);
+BENCHMARK(HMAC_SHA512_64b);
 BENCHMARK(FastRandom_32bit);
 BENCHMARK(FastRandom_1bit);
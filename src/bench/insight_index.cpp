@@ -0,0 +1,168 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <arith_uint256.h>
+#include <insight/addressindex.h>
+#include <insight/insight.h>
+#include <insight/rpc.h>
+#include <insight/spentindex.h>
+#include <key_io.h>
+#include <rpc/server.h>
+#include <script/standard.h>
+#include <test/util/setup_common.h>
+#include <txdb.h>
+#include <util/ref.h>
+#include <validation.h>
+
+#include <vector>
+
+// Index entries written to the db in one batch while populating
+static constexpr int ENTRIES_PER_BATCH = 10000;
+
+/**
+ * One address with num_deltas address index deltas in the block tree db of a
+ * TestingSetup. Each transaction receives an output that a later transaction
+ * spends and one that stays unspent, so a third of the deltas are spends,
+ * with spent index entries, and a third are unspent outputs.
+ */
+class InsightIndexSetup
+{
+    const bool m_address_before{fAddressIndex}, m_address_balance_before{fAddressBalanceIndex}, m_spent_before{fSpentIndex};
+
+public:
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-nodebuglogfile", "-nodebug"}};
+    util::Ref context{test_setup.m_node};
+    std::string address;
+    CSpentIndexKey spent_key;
+
+    explicit InsightIndexSetup(int num_deltas)
+    {
+        fAddressIndex = fAddressBalanceIndex = fSpentIndex = true;
+        // The insight commands are registered by init, not by the TestingSetup
+        static bool rpc_registered = false;
+        if (!rpc_registered) {
+            RegisterInsightRPCCommands(tableRPC);
+            rpc_registered = true;
+        }
+        if (RPCIsInWarmup(nullptr)) SetRPCWarmupFinished();
+
+        const PKHash dest(uint160(std::vector<uint8_t>(20, 0x01)));
+        const CScript script = GetScriptForDestination(dest);
+        address = EncodeDestination(dest);
+        uint256 hash;
+        int type;
+        bool indexed = getIndexKey(address, hash, type);
+        assert(indexed);
+
+        std::vector<std::pair<CAddressIndexKey, CAmount>> deltas;
+        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue>> unspent;
+        std::vector<std::pair<CSpentIndexKey, CSpentIndexValue>> spent;
+        for (int i = 0; i < num_deltas; ++i) {
+            const int height = 1 + i / 3;
+            const uint256 txid = ArithToUint256(arith_uint256(height));
+            const uint256 txid_prev = ArithToUint256(arith_uint256(height - 1));
+            switch (i % 3) {
+            case 0:
+                deltas.emplace_back(CAddressIndexKey(type, hash, height, 1, txid, 0, false), COIN);
+                break;
+            case 1:
+                deltas.emplace_back(CAddressIndexKey(type, hash, height, 1, txid, 1, false), COIN);
+                unspent.emplace_back(CAddressUnspentKey(type, hash, txid, 1), CAddressUnspentValue(COIN, script, height));
+                break;
+            case 2:
+                if (height == 1) {
+                    // Nothing to spend yet
+                    deltas.emplace_back(CAddressIndexKey(type, hash, height, 1, txid, 2, false), COIN);
+                    break;
+                }
+                deltas.emplace_back(CAddressIndexKey(type, hash, height, 1, txid, 0, true), -COIN);
+                spent_key = CSpentIndexKey(txid_prev, 0);
+                spent.emplace_back(spent_key, CSpentIndexValue(txid, 0, height, COIN, type, hash));
+                break;
+            }
+            if (deltas.size() >= ENTRIES_PER_BATCH || i == num_deltas - 1) {
+                bool written = pblocktree->WriteAddressIndex(deltas)
+                    && pblocktree->UpdateAddressUnspentIndex(unspent)
+                    && pblocktree->UpdateSpentIndex(spent);
+                assert(written);
+                deltas.clear();
+                unspent.clear();
+                spent.clear();
+            }
+        }
+    }
+
+    ~InsightIndexSetup()
+    {
+        fAddressIndex = m_address_before;
+        fAddressBalanceIndex = m_address_balance_before;
+        fSpentIndex = m_spent_before;
+    }
+
+    JSONRPCRequest AddressRequest(const std::string& method)
+    {
+        JSONRPCRequest request(context);
+        request.strMethod = method;
+        UniValue addresses(UniValue::VARR);
+        addresses.push_back(address);
+        UniValue options(UniValue::VOBJ);
+        options.pushKV("addresses", addresses);
+        request.params.setArray();
+        request.params.push_back(options);
+        return request;
+    }
+};
+
+static void AddressRPC(benchmark::Bench& bench, const std::string& method, int num_deltas)
+{
+    InsightIndexSetup setup(num_deltas);
+    const JSONRPCRequest request = setup.AddressRequest(method);
+    bench.run([&] {
+        UniValue result = tableRPC.execute(request);
+        assert(!result.isNull());
+    });
+}
+
+static void GetSpentInfo(benchmark::Bench& bench, int num_deltas)
+{
+    InsightIndexSetup setup(num_deltas);
+    JSONRPCRequest request(setup.context);
+    request.strMethod = "getspentinfo";
+    UniValue input(UniValue::VOBJ);
+    input.pushKV("txid", setup.spent_key.txid.GetHex());
+    input.pushKV("index", (int)setup.spent_key.outputIndex);
+    request.params.setArray();
+    request.params.push_back(input);
+    bench.run([&] {
+        UniValue result = tableRPC.execute(request);
+        assert(result.isObject());
+    });
+}
+
+static void InsightGetAddressDeltas10(benchmark::Bench& bench) { AddressRPC(bench, "getaddressdeltas", 10); }
+static void InsightGetAddressDeltas10k(benchmark::Bench& bench) { AddressRPC(bench, "getaddressdeltas", 10000); }
+static void InsightGetAddressDeltas1M(benchmark::Bench& bench) { AddressRPC(bench, "getaddressdeltas", 1000000); }
+static void InsightGetAddressBalance10(benchmark::Bench& bench) { AddressRPC(bench, "getaddressbalance", 10); }
+static void InsightGetAddressBalance10k(benchmark::Bench& bench) { AddressRPC(bench, "getaddressbalance", 10000); }
+static void InsightGetAddressBalance1M(benchmark::Bench& bench) { AddressRPC(bench, "getaddressbalance", 1000000); }
+static void InsightGetAddressUtxos10(benchmark::Bench& bench) { AddressRPC(bench, "getaddressutxos", 10); }
+static void InsightGetAddressUtxos10k(benchmark::Bench& bench) { AddressRPC(bench, "getaddressutxos", 10000); }
+static void InsightGetAddressUtxos1M(benchmark::Bench& bench) { AddressRPC(bench, "getaddressutxos", 1000000); }
+static void InsightGetSpentInfo10(benchmark::Bench& bench) { GetSpentInfo(bench, 10); }
+static void InsightGetSpentInfo10k(benchmark::Bench& bench) { GetSpentInfo(bench, 10000); }
+static void InsightGetSpentInfo1M(benchmark::Bench& bench) { GetSpentInfo(bench, 1000000); }
+
+BENCHMARK(InsightGetAddressDeltas10);
+BENCHMARK(InsightGetAddressDeltas10k);
+BENCHMARK(InsightGetAddressDeltas1M);
+BENCHMARK(InsightGetAddressBalance10);
+BENCHMARK(InsightGetAddressBalance10k);
+BENCHMARK(InsightGetAddressBalance1M);
+BENCHMARK(InsightGetAddressUtxos10);
+BENCHMARK(InsightGetAddressUtxos10k);
+BENCHMARK(InsightGetAddressUtxos1M);
+BENCHMARK(InsightGetSpentInfo10);
+BENCHMARK(InsightGetSpentInfo10k);
+BENCHMARK(InsightGetSpentInfo1M);
@@ -0,0 +1,73 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <hash.h>
+#include <pos/kernel.h>
+#include <random.h>
+#include <streams.h>
+
+#include <vector>
+
+// A staking wallet trying each of its candidates at the masked timestamps of one block
+static constexpr int NUM_CANDIDATES = 1000;
+static constexpr int NUM_TIMESTAMPS = 8;
+static constexpr uint32_t TIMESTAMP_MASK = 0xf;
+
+static std::vector<COutPoint> MakePrevouts()
+{
+    FastRandomContext rng(true);
+    std::vector<COutPoint> prevouts;
+    for (int i = 0; i < NUM_CANDIDATES; ++i) {
+        prevouts.emplace_back(rng.rand256(), rng.randrange(4));
+    }
+    return prevouts;
+}
+
+static void StakeKernelHashStream(benchmark::Bench& bench)
+{
+    const std::vector<COutPoint> prevouts = MakePrevouts();
+    const uint256 modifier = FastRandomContext(true).rand256();
+    const uint32_t nBlockFromTime = 1600000000;
+
+    uint256 hash;
+    bench.batch(NUM_CANDIDATES * NUM_TIMESTAMPS).unit("hash").run([&] {
+        for (int t = 0; t < NUM_TIMESTAMPS; ++t) {
+            const uint32_t nTime = nBlockFromTime + (t + 1) * (TIMESTAMP_MASK + 1);
+            for (const auto& prevout : prevouts) {
+                CDataStream ss(SER_GETHASH, 0);
+                ss << modifier;
+                ss << nBlockFromTime << prevout.hash << prevout.n << nTime;
+                hash = Hash(ss);
+            }
+        }
+    });
+    ankerl::nanobench::doNotOptimizeAway(hash);
+}
+
+static void StakeKernelHashPrefix(benchmark::Bench& bench)
+{
+    const std::vector<COutPoint> prevouts = MakePrevouts();
+    const uint256 modifier = FastRandomContext(true).rand256();
+    const uint32_t nBlockFromTime = 1600000000;
+
+    std::vector<CStakeKernelHasher> hashers;
+    for (const auto& prevout : prevouts) {
+        hashers.emplace_back(modifier, nBlockFromTime, prevout);
+    }
+
+    uint256 hash;
+    bench.batch(NUM_CANDIDATES * NUM_TIMESTAMPS).unit("hash").run([&] {
+        for (int t = 0; t < NUM_TIMESTAMPS; ++t) {
+            const uint32_t nTime = nBlockFromTime + (t + 1) * (TIMESTAMP_MASK + 1);
+            for (const auto& hasher : hashers) {
+                hash = hasher.GetHash(nTime);
+            }
+        }
+    });
+    ankerl::nanobench::doNotOptimizeAway(hash);
+}
+
+BENCHMARK(StakeKernelHashStream);
+BENCHMARK(StakeKernelHashPrefix);
@@ -0,0 +1,54 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <key/extkey.h>
+#include <random.h>
+
+static CKeyID RandKeyId()
+{
+    uint256 h = GetRandHash();
+    return CKeyID(uint160(h.begin(), 20));
+}
+
+// Ownership lookups of relayed txns, the ids almost never belong to the wallet
+static void ExtKeyAccountHaveKeyMiss(benchmark::Bench& bench)
+{
+    CExtKeyAccount sea;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        sea.mapLookAhead[RandKeyId()] = CEKAKey(0, i);
+        sea.mapKeys[RandKeyId()] = CEKAKey(0, i);
+    }
+
+    std::vector<CKeyID> ids;
+    for (size_t i = 0; i < 1000; ++i) {
+        ids.push_back(RandKeyId());
+    }
+
+    const CEKAKey *pak = nullptr;
+    const CEKASCKey *pasc = nullptr;
+    isminetype ismine = ISMINE_NO;
+    size_t n = 0;
+    bench.run([&] {
+        sea.HaveKey(ids[n++ % ids.size()], false, pak, pasc, ismine);
+    });
+}
+
+static void KeyIdFilterMayContain(benchmark::Bench& bench)
+{
+    CKeyIdFilter filter;
+    filter.Init(20000);
+    for (size_t i = 0; i < 20000; ++i) {
+        filter.Insert(RandKeyId());
+    }
+
+    CKeyID id = RandKeyId();
+    bench.run([&] {
+        id.begin()[0]++;
+        filter.MayContain(id);
+    });
+}
+
+BENCHMARK(ExtKeyAccountHaveKeyMiss);
+BENCHMARK(KeyIdFilterMayContain);
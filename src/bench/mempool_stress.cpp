@@ -3,6 +3,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <bench/bench.h>
+#include <crypto/common.h>
 #include <policy/policy.h>
 #include <test/util/setup_common.h>
 #include <txmempool.h>
@@ -91,4 +92,46 @@ static void ComplexMemPool(benchmark::Bench& bench)
     });
 }
 
+static CTransactionRef MakeAnonTx(uint32_t seed, size_t nInputs, CAmount nValue)
+{
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].prevout.n = COutPoint::ANON_MARKER;
+    tx.vin[0].SetAnonInfo(nInputs, 3);
+    std::vector<uint8_t> vKeyImages(nInputs * 33);
+    for (size_t k = 0; k < nInputs; ++k) {
+        vKeyImages[k * 33] = 0x02;
+        WriteLE32(&vKeyImages[k * 33 + 1], seed);
+        vKeyImages[k * 33 + 5] = k;
+    }
+    tx.vin[0].scriptData.stack.push_back(vKeyImages);
+    tx.vout.resize(1);
+    tx.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    tx.vout[0].nValue = nValue;
+    return MakeTransactionRef(tx);
+}
+
+static void MempoolKeyImages(benchmark::Bench& bench)
+{
+    // A block mining half of the anon txs in the pool and double spending the key images of the other half
+    const int n_txs = 2000;
+    std::vector<CTransactionRef> pool_txs, block;
+    for (int i = 0; i < n_txs; ++i) {
+        pool_txs.push_back(MakeAnonTx(i, 2, 10 * COIN));
+        block.push_back(i % 2 ? MakeAnonTx(i, 2, 9 * COIN) : pool_txs.back());
+    }
+
+    TestingSetup test_setup;
+    CTxMemPool pool;
+    LOCK2(cs_main, pool.cs);
+    bench.run([&]() NO_THREAD_SAFETY_ANALYSIS {
+        for (auto& tx : pool_txs) {
+            AddTx(tx, pool);
+        }
+        pool.removeForBlock(block, 2);
+        assert(pool.size() == 0);
+    });
+}
+
 BENCHMARK(ComplexMemPool);
+BENCHMARK(MempoolKeyImages);
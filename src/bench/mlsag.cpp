@@ -5,10 +5,13 @@
 #include <iostream>
 
 #include <bench/bench.h>
+#include <bench/checkqueue_workers.h>
 #include <util/time.h>
 #include <test/util/setup_common.h>
 
+#include <anon.h>
 #include <blind.h>
+#include <checkqueue.h>
 #include <random.h>
 #include <key.h>
 #include <amount.h>
@@ -115,3 +118,105 @@ static void Mlsag(benchmark::Bench& bench)
 }
 
 BENCHMARK(Mlsag);
+
+/** Signed ring data for one anon input, kept alive while the checks point into it */
+struct MlsagBlockTx
+{
+    uint8_t preimage[32];
+    uint8_t ki[2 * 33];
+    uint8_t pc[32];
+    uint8_t ss[3 * 11 * 32];
+    std::vector<secp256k1_pedersen_commitment> cm_out;
+};
+
+static const size_t MLSAG_BLOCK_TXNS = 50;
+static const unsigned int MLSAG_QUEUE_BATCH_SIZE = 128;
+
+static void MlsagBlock(benchmark::Bench& bench)
+{
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {}, true};
+
+    ECC_Start_Blinding();
+
+    const size_t nInputs = 2;
+    const size_t nCols = 11;
+    const size_t nRows = nInputs+1;
+    const size_t nOutputs = 2;
+    const size_t nBlinded = 1;
+    FastRandomContext insecure_rand(true);
+
+    std::vector<MlsagBlockTx> vTxns(MLSAG_BLOCK_TXNS);
+    std::vector<CMLSAGCheck> vChecks;
+    vChecks.reserve(MLSAG_BLOCK_TXNS);
+    for (auto &txn : vTxns) {
+        size_t nRealCol = insecure_rand.randrange(nCols);
+        int64_t nValues[] = {1234 * COIN, 1234 * COIN, 2467 * COIN, 1 * COIN};
+        uint8_t zero32[32] = {0}, tmp32[32], blindSum[32];
+        std::vector<CKey> vKeys(nInputs), vBlindsOut(nBlinded), vBlindsIn(nInputs);
+        const uint8_t *pkeys[nInputs+1], *pblinds[nInputs + nOutputs];
+        std::vector<const uint8_t*> pcm_in(nInputs * nCols), pcm_out(nOutputs);
+        std::vector<uint8_t> m(nRows * nCols * 33), vCommitments(nInputs * nCols * 33);
+
+        txn.cm_out.resize(nOutputs);
+        for (size_t k = 0; k < nOutputs; ++k) {
+            const uint8_t *blind = zero32;
+            if (k < nBlinded) {
+                vBlindsOut[k].MakeNewKey(true);
+                blind = pblinds[nInputs + k] = vBlindsOut[k].begin();
+            }
+            assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &txn.cm_out[k], blind, nValues[nInputs + k], &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+            pcm_out[k] = txn.cm_out[k].data;
+        }
+
+        for (size_t k = 0; k < nInputs; ++k)
+        for (size_t i = 0; i < nCols; ++i) {
+            secp256k1_pedersen_commitment cm;
+            CKey key, blind;
+            key.MakeNewKey(true);
+            blind.MakeNewKey(true);
+            CAmount v = 10;
+            if (i == nRealCol) {
+                vKeys[k] = key;
+                vBlindsIn[k] = blind;
+                pkeys[k] = vKeys[k].begin();
+                pblinds[k] = vBlindsIn[k].begin();
+                v = nValues[k];
+            }
+            CPubKey pk = key.GetPubKey();
+            memcpy(&m[(i+k*nCols)*33], pk.begin(), 33);
+            assert(secp256k1_pedersen_commit(secp256k1_ctx_blind, &cm, blind.begin(), v, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+            memcpy(&vCommitments[(i+k*nCols)*33], cm.data, 33);
+            pcm_in[i+k*nCols] = &vCommitments[(i+k*nCols)*33];
+        }
+
+        pkeys[nInputs] = blindSum;
+        assert(0 == secp256k1_prepare_mlsag(m.data(), blindSum,
+            nOutputs, nBlinded, nCols, nRows,
+            pcm_in.data(), pcm_out.data(), pblinds));
+
+        GetRandBytes(tmp32, 32);
+        GetRandBytes(txn.preimage, 32);
+        assert(0 == secp256k1_generate_mlsag(secp256k1_ctx_blind, txn.ki, txn.pc, txn.ss,
+            tmp32, txn.preimage, nCols, nRows, nRealCol,
+            pkeys, m.data()));
+
+        vChecks.emplace_back(txn.preimage, nCols, nRows, std::move(m),
+            std::move(vCommitments), pcm_in, pcm_out,
+            txn.ki, txn.pc, txn.ss);
+    }
+
+    CCheckQueue<CMLSAGCheck> queue {MLSAG_QUEUE_BATCH_SIZE};
+    benchmark::CheckQueueWorkers<CMLSAGCheck> workers(queue, GetNumCores());
+
+    bench.batch(MLSAG_BLOCK_TXNS).unit("tx").run([&] {
+        // Checks are consumed by the queue, submit copies.
+        std::vector<CMLSAGCheck> vBlockChecks(vChecks);
+        CCheckQueueControl<CMLSAGCheck> control(&queue);
+        control.Add(vBlockChecks);
+        assert(control.Wait());
+    });
+
+    ECC_Stop_Blinding();
+}
+
+BENCHMARK(MlsagBlock);
@@ -0,0 +1,35 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <key/mnemonic.h>
+
+#include <cassert>
+
+static const std::string BENCH_MNEMONIC = "deer clever bitter bonus unable menu satoshi chaos dwarf inmate robot drama exist nuclear raise";
+static const size_t BENCH_PASSWORDS = 16;
+
+static void MnemonicToSeed(benchmark::Bench& bench)
+{
+    std::vector<uint8_t> vSeed;
+    size_t n = 0;
+    bench.batch(1).unit("seed").run([&] {
+        assert(0 == mnemonic::ToSeed(BENCH_MNEMONIC, "candidate" + std::to_string(n++), vSeed));
+    });
+}
+
+static void MnemonicToSeedsBatch(benchmark::Bench& bench)
+{
+    std::vector<std::string> vPasswords;
+    for (size_t i = 0; i < BENCH_PASSWORDS; ++i) {
+        vPasswords.push_back("candidate" + std::to_string(i));
+    }
+    std::vector<std::vector<uint8_t> > vSeeds;
+    bench.batch(BENCH_PASSWORDS).unit("seed").run([&] {
+        assert(0 == mnemonic::ToSeeds(BENCH_MNEMONIC, vPasswords, vSeeds));
+    });
+}
+
+BENCHMARK(MnemonicToSeed);
+BENCHMARK(MnemonicToSeedsBatch);
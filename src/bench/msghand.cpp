@@ -0,0 +1,109 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <net.h>
+#include <net_processing.h>
+#include <netmessagemaker.h>
+#include <protocol.h>
+#include <random.h>
+#include <test/util/net.h>
+#include <test/util/setup_common.h>
+#include <test/util/validation.h>
+#include <validation.h>
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+static constexpr int NUM_PEERS = 256;
+static constexpr int MSGS_PER_PEER = 8;
+static constexpr int INVS_PER_MSG = 8;
+
+// Inbound peers each sending pings and tx invs, processed by the message
+// handler shards the way the msghand threads run them.
+static void MessageHandlerShards(benchmark::Bench& bench, int shards)
+{
+    TestingSetup test_setup{
+        CBaseChainParams::REGTEST,
+        /* extra_args */ {
+            "-nodebuglogfile",
+            "-nodebug",
+        },
+    };
+    ConnmanTestMsg& connman = *(ConnmanTestMsg*)test_setup.m_node.connman.get();
+    {
+        CConnman::Options options;
+        options.m_msgproc = test_setup.m_node.peerman.get();
+        options.nSendBufferMaxSize = std::numeric_limits<unsigned int>::max();
+        connman.Init(options);
+    }
+    connman.SetMessageHandlerShards(shards);
+    TestChainState& chainstate = (TestChainState&)test_setup.m_node.chainman->ActiveChainstate();
+    if (chainstate.IsInitialBlockDownload()) chainstate.JumpOutOfIbd();
+
+    std::vector<CNode*> peers;
+    for (int i = 0; i < NUM_PEERS; ++i) {
+        peers.push_back(new CNode(i, NODE_NETWORK, 0, INVALID_SOCKET, CAddress{CService{in_addr{0x0100007f}, 7777}, NODE_NETWORK}, 0, 0, CAddress{}, std::string{}, ConnectionType::INBOUND));
+        CNode& node = *peers.back();
+        node.fSuccessfullyConnected = true;
+        node.nVersion = PROTOCOL_VERSION;
+        node.SetCommonVersion(PROTOCOL_VERSION);
+        test_setup.m_node.peerman->InitializeNode(&node);
+        connman.AddTestNode(node);
+    }
+
+    const CNetMsgMaker msg_maker(PROTOCOL_VERSION);
+    FastRandomContext rng(true);
+    bench.run([&] {
+        for (CNode* node : peers) {
+            for (int i = 0; i < MSGS_PER_PEER; ++i) {
+                CSerializedNetMsg msg;
+                if (i % 2 == 0) {
+                    msg = msg_maker.Make(NetMsgType::PING, rng.rand64());
+                } else {
+                    std::vector<CInv> invs;
+                    for (int k = 0; k < INVS_PER_MSG; ++k) {
+                        invs.emplace_back(MSG_TX, rng.rand256());
+                    }
+                    msg = msg_maker.Make(NetMsgType::INV, invs);
+                }
+                connman.ReceiveMsgFrom(*node, msg);
+            }
+        }
+
+        std::vector<std::thread> threads;
+        for (int shard = 0; shard < shards; ++shard) {
+            threads.emplace_back([&connman, shard] {
+                while (connman.ProcessShardOnce(shard)) {
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (CNode* node : peers) {
+            LOCK(node->cs_vSend);
+            node->vSendMsg.clear();
+            node->nSendSize = 0;
+        }
+    });
+
+    LOCK2(::cs_main, g_cs_orphans);
+    connman.StopNodes();
+}
+
+static void MessageHandlerOneShard(benchmark::Bench& bench)
+{
+    MessageHandlerShards(bench, 1);
+}
+
+static void MessageHandlerFourShards(benchmark::Bench& bench)
+{
+    MessageHandlerShards(bench, 4);
+}
+
+BENCHMARK(MessageHandlerOneShard);
+BENCHMARK(MessageHandlerFourShards);
@@ -9,7 +9,9 @@
 #include <interfaces/chain.h>
 
 #include <validation.h>
+#include <anon.h>
 #include <blind.h>
+#include <consensus/validation.h>
 #include <rpc/rpcutil.h>
 #include <rpc/blockchain.h>
 #include <timedata.h>
@@ -18,20 +20,23 @@
 #include <util/string.h>
 #include <util/translation.h>
 
-CTransactionRef CreateTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount amount, int type_in, int type_out, int nRingSize = 5)
+CTransactionRef CreateTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount amount, int type_in, int type_out, int nRingSize = 5, size_t num_outputs = 1)
 {
     gArgs.ForceSetArg("-anonrestricted", "0");
     LOCK(pwallet->cs_wallet);
 
     assert(address.IsValid());
 
+    // The amount is split evenly over num_outputs payouts to address
     std::vector<CTempRecipient> vecSend;
     std::string sError;
-    CTempRecipient r;
-    r.nType = type_out;
-    r.SetAmount(amount);
-    r.address = address.Get();
-    vecSend.push_back(r);
+    for (size_t i = 0; i < num_outputs; ++i) {
+        CTempRecipient r;
+        r.nType = type_out;
+        r.SetAmount(amount / num_outputs);
+        r.address = address.Get();
+        vecSend.push_back(r);
+    }
 
     CTransactionRef tx_new;
     CWalletTx wtx(pwallet, tx_new);
@@ -50,7 +55,7 @@ CTransactionRef CreateTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount
     return wtx.tx;
 }
 
-static void AddAnonTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount amount, OutputTypes output_type)
+static void AddAnonTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount amount, OutputTypes output_type, size_t num_outputs = 1)
 {
     {
     gArgs.ForceSetArg("-anonrestricted", "0");
@@ -60,11 +65,13 @@ static void AddAnonTxn(CHDWallet *pwallet, CBitcoinAddress &address, CAmount amo
 
     std::vector<CTempRecipient> vecSend;
     std::string sError;
-    CTempRecipient r;
-    r.nType = output_type;
-    r.SetAmount(amount);
-    r.address = address.Get();
-    vecSend.push_back(r);
+    for (size_t i = 0; i < num_outputs; ++i) {
+        CTempRecipient r;
+        r.nType = output_type;
+        r.SetAmount(amount);
+        r.address = address.Get();
+        vecSend.push_back(r);
+    }
 
     CTransactionRef tx_new;
     CWalletTx wtx(pwallet, tx_new);
@@ -124,52 +131,105 @@ static std::shared_ptr<CHDWallet> CreateTestWallet(interfaces::Chain& chain, std
     return std::static_pointer_cast<CHDWallet>(wallet);
 }
 
-static void AddTx(benchmark::Bench& bench, const std::string from, const std::string to, const bool owned)
+/**
+ * A regtest chain with wallet a holding the genesis outputs and an empty
+ * wallet b. Proofs and signatures aren't cached, so mempool checks of the
+ * same transaction do the full work on each run.
+ */
+class AddTxSetup
 {
-    gArgs.ForceSetArg("-acceptanontxn", "1"); // TODO: remove
-    gArgs.ForceSetArg("-acceptblindtxn", "1"); // TODO: remove
-    gArgs.ForceSetArg("-anonrestricted", "0");
-
-    TestingSetup test_setup{CBaseChainParams::REGTEST, {}, true};
+public:
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-maxproofcachesize=0", "-maxsigcachesize=0"}, true};
     util::Ref context{test_setup.m_node};
+    std::unique_ptr<interfaces::Chain> m_chain;
+    std::unique_ptr<interfaces::ChainClient> m_chain_client;
+    std::shared_ptr<CHDWallet> pwallet_a;
+    std::shared_ptr<CHDWallet> pwallet_b;
 
-    ECC_Start_Stealth();
-    ECC_Start_Blinding();
+    AddTxSetup()
+    {
+        gArgs.ForceSetArg("-acceptanontxn", "1"); // TODO: remove
+        gArgs.ForceSetArg("-acceptblindtxn", "1"); // TODO: remove
+        gArgs.ForceSetArg("-anonrestricted", "0");
 
-    std::unique_ptr<interfaces::Chain> m_chain = interfaces::MakeChain(test_setup.m_node);
-    std::unique_ptr<interfaces::ChainClient> m_chain_client = interfaces::MakeWalletClient(*m_chain, *Assert(test_setup.m_node.args));
-    m_chain_client->registerRpcs();
+        ECC_Start_Stealth();
+        ECC_Start_Blinding();
 
-    std::shared_ptr<CHDWallet> pwallet_a = CreateTestWallet(*m_chain.get(), "a");
-    assert(pwallet_a.get());
-    AddWallet(pwallet_a);
+        m_chain = interfaces::MakeChain(test_setup.m_node);
+        m_chain_client = interfaces::MakeWalletClient(*m_chain, *Assert(test_setup.m_node.args));
+        m_chain_client->registerRpcs();
 
-    std::shared_ptr<CHDWallet> pwallet_b = CreateTestWallet(*m_chain.get(), "b");
-    assert(pwallet_b.get());
-    AddWallet(pwallet_b);
+        pwallet_a = CreateTestWallet(*m_chain.get(), "a");
+        assert(pwallet_a.get());
+        AddWallet(pwallet_a);
+
+        pwallet_b = CreateTestWallet(*m_chain.get(), "b");
+        assert(pwallet_b.get());
+        AddWallet(pwallet_b);
 
-    {
-        int last_height = ::ChainActive().Height();
-        uint256 last_hash = ::ChainActive().Tip()->GetBlockHash();
-        {
-            LOCK(pwallet_a->cs_wallet);
-            pwallet_a->SetLastBlockProcessed(last_height, last_hash);
-        }
         {
-            LOCK(pwallet_b->cs_wallet);
-            pwallet_b->SetLastBlockProcessed(last_height, last_hash);
+            int last_height = ::ChainActive().Height();
+            uint256 last_hash = ::ChainActive().Tip()->GetBlockHash();
+            {
+                LOCK(pwallet_a->cs_wallet);
+                pwallet_a->SetLastBlockProcessed(last_height, last_hash);
+            }
+            {
+                LOCK(pwallet_b->cs_wallet);
+                pwallet_b->SetLastBlockProcessed(last_height, last_hash);
+            }
         }
+
+        CallRPC("extkeyimportmaster tprv8ZgxMBicQKsPeK5mCpvMsd1cwyT1JZsrBN82XkoYuZY1EVK7EwDaiL9sDfqUU5SntTfbRfnRedFWjg5xkDG5i3iwd3yP7neX5F2dtdCojk4", context, "a");
+        CallRPC("extkeyimportmaster \"expect trouble pause odor utility palace ignore arena disorder frog helmet addict\"", context, "b");
+    }
+
+    ~AddTxSetup()
+    {
+        RemoveWallet(pwallet_a, nullopt);
+        pwallet_a.reset();
+
+        RemoveWallet(pwallet_b, nullopt);
+        pwallet_b.reset();
+
+        ECC_Stop_Stealth();
+        ECC_Stop_Blinding();
+    }
+
+    CBitcoinAddress NewAddress(const std::string& rpc, const std::string& wallet)
+    {
+        UniValue rv = CallRPC(rpc, context, wallet);
+        return CBitcoinAddress(part::StripQuotes(rv.write()));
+    }
+
+    void BenchAddToWallet(benchmark::Bench& bench, const CTransactionRef& tx)
+    {
+        CWalletTx::Confirmation confirm;
+        bench.run([&] {
+            LOCK(pwallet_b.get()->cs_wallet);
+            pwallet_b.get()->AddToWalletIfInvolvingMe(tx, confirm, true);
+        });
+    }
+
+    void BenchAcceptToMemoryPool(benchmark::Bench& bench, const CTransactionRef& tx)
+    {
+        bench.run([&] {
+            LOCK(cs_main);
+            TxValidationState state;
+            bool accepted = AcceptToMemoryPool(*test_setup.m_node.mempool, state, tx, nullptr, false, true /* test_accept */);
+            assert(accepted);
+        });
     }
+};
+
+static void AddTx(benchmark::Bench& bench, const std::string from, const std::string to, const bool owned, const bool send = false)
+{
+    AddTxSetup setup;
 
     std::string from_address_type, to_address_type;
     OutputTypes from_tx_type = OUTPUT_NULL;
     OutputTypes to_tx_type = OUTPUT_NULL;
 
-    UniValue rv;
-
-    CallRPC("extkeyimportmaster tprv8ZgxMBicQKsPeK5mCpvMsd1cwyT1JZsrBN82XkoYuZY1EVK7EwDaiL9sDfqUU5SntTfbRfnRedFWjg5xkDG5i3iwd3yP7neX5F2dtdCojk4", context, "a");
-    CallRPC("extkeyimportmaster \"expect trouble pause odor utility palace ignore arena disorder frog helmet addict\"", context, "b");
-
     if (from == "plain") {
         from_address_type = "getnewaddress";
         from_tx_type = OUTPUT_STANDARD;
@@ -195,46 +255,67 @@ static void AddTx(benchmark::Bench& bench, const std::string from, const std::st
     assert(from_tx_type != OUTPUT_NULL);
     assert(to_tx_type != OUTPUT_NULL);
 
-    rv = CallRPC(from_address_type, context, "a");
-    CBitcoinAddress addr_a(part::StripQuotes(rv.write()));
-
-    rv = CallRPC(to_address_type, context, "b");
-    CBitcoinAddress addr_b(part::StripQuotes(rv.write()));
+    CBitcoinAddress addr_a = setup.NewAddress(from_address_type, "a");
+    CBitcoinAddress addr_b = setup.NewAddress(to_address_type, "b");
 
     if (from == "anon" || from == "blind") {
-        AddAnonTxn(pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT);
-        AddAnonTxn(pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT);
-        AddAnonTxn(pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT);
-        AddAnonTxn(pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT);
-        AddAnonTxn(pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT);
+        AddAnonTxn(setup.pwallet_a.get(), addr_a, 1 * COIN, from == "anon" ? OUTPUT_RINGCT : OUTPUT_CT, 5);
+    }
+    if (from != "plain" || to == "anon") {
+        // New anon outputs are only accepted once the chain is past genesis
+        StakeNBlocks(setup.pwallet_a.get(), 2);
+    }
 
-        StakeNBlocks(pwallet_a.get(), 2);
+    if (send) {
+        // Time building and signing the transaction, decoy selection included
+        bench.run([&] {
+            CreateTxn(setup.pwallet_a.get(), owned ? addr_b : addr_a, 1000, from_tx_type, to_tx_type);
+        });
+        return;
     }
+    CTransactionRef tx = CreateTxn(setup.pwallet_a.get(), owned ? addr_b : addr_a, 1000, from_tx_type, to_tx_type);
+    setup.BenchAddToWallet(bench, tx);
+}
 
-    CTransactionRef tx = CreateTxn(pwallet_a.get(), owned ? addr_b : addr_a, 1000, from_tx_type, to_tx_type);
+// Anon outputs of wallet a, enough to spend 32 inputs or to fill a ring of 32
+static constexpr size_t ANON_SHAPE_OUTPUTS = 64;
+
+/**
+ * A transaction of wallet a spending num_inputs anon outputs of 1 COIN with
+ * rings of ring_size, paying num_outputs anon outputs to wallet b, timed
+ * being added to wallet b or checked for the mempool.
+ */
+static void AnonShape(benchmark::Bench& bench, size_t ring_size, size_t num_inputs, size_t num_outputs, bool mempool)
+{
+    AddTxSetup setup;
 
-    CWalletTx::Confirmation confirm;
-    bench.run([&] {
-        LOCK(pwallet_b.get()->cs_wallet);
-        pwallet_b.get()->AddToWalletIfInvolvingMe(tx, confirm, true);
-    });
+    CBitcoinAddress addr_a = setup.NewAddress("getnewstealthaddress", "a");
+    CBitcoinAddress addr_b = setup.NewAddress("getnewstealthaddress", "b");
 
-    RemoveWallet(pwallet_a, nullopt);
-    pwallet_a.reset();
+    StakeNBlocks(setup.pwallet_a.get(), 1);
+    for (size_t i = 0; i < ANON_SHAPE_OUTPUTS; i += MAX_ANON_INPUTS) {
+        AddAnonTxn(setup.pwallet_a.get(), addr_a, 1 * COIN, OUTPUT_RINGCT, MAX_ANON_INPUTS);
+    }
+    StakeNBlocks(setup.pwallet_a.get(), 2);
 
-    RemoveWallet(pwallet_b, nullopt);
-    pwallet_b.reset();
+    // Half a coin less than num_inputs outputs hold, coin selection needs all of them with the fee
+    const CAmount amount = num_inputs * COIN - COIN / 2;
+    CTransactionRef tx = CreateTxn(setup.pwallet_a.get(), addr_b, amount, OUTPUT_RINGCT, OUTPUT_RINGCT, ring_size, num_outputs);
+    assert(tx->vin.size() == num_inputs);
 
-    ECC_Stop_Stealth();
-    ECC_Stop_Blinding();
+    if (mempool) {
+        setup.BenchAcceptToMemoryPool(bench, tx);
+    } else {
+        setup.BenchAddToWallet(bench, tx);
+    }
 }
 
 static void ParticlAddTxPlainPlainNotOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "plain", false); }
 static void ParticlAddTxPlainPlainOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "plain", true); }
 static void ParticlAddTxPlainBlindNotOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "blind", false); }
 static void ParticlAddTxPlainBlindOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "blind", true); }
-// static void ParticlAddTxPlainAnonNotOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "anon", false); }
-// static void ParticlAddTxPlainAnonOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "anon", true); }
+static void ParticlAddTxPlainAnonNotOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "anon", false); }
+static void ParticlAddTxPlainAnonOwned(benchmark::Bench& bench) { AddTx(bench, "plain", "anon", true); }
 
 static void ParticlAddTxBlindPlainNotOwned(benchmark::Bench& bench) { AddTx(bench, "blind", "plain", false); }
 static void ParticlAddTxBlindPlainOwned(benchmark::Bench& bench) { AddTx(bench, "blind", "plain", true); }
@@ -250,12 +331,14 @@ static void ParticlAddTxAnonBlindOwned(benchmark::Bench& bench) { AddTx(bench, "
 static void ParticlAddTxAnonAnonNotOwned(benchmark::Bench& bench) { AddTx(bench, "anon", "anon", false); }
 static void ParticlAddTxAnonAnonOwned(benchmark::Bench& bench) { AddTx(bench, "anon", "anon", true); }
 
+static void ParticlSendAnonToAnon(benchmark::Bench& bench) { AddTx(bench, "anon", "anon", true, true); }
+
 BENCHMARK(ParticlAddTxPlainPlainNotOwned);
 BENCHMARK(ParticlAddTxPlainPlainOwned);
 BENCHMARK(ParticlAddTxPlainBlindNotOwned);
 BENCHMARK(ParticlAddTxPlainBlindOwned);
-// BENCHMARK(ParticlAddTxPlainAnonNotOwned);
-// BENCHMARK(ParticlAddTxPlainAnonOwned);
+BENCHMARK(ParticlAddTxPlainAnonNotOwned);
+BENCHMARK(ParticlAddTxPlainAnonOwned);
 
 BENCHMARK(ParticlAddTxBlindPlainNotOwned);
 BENCHMARK(ParticlAddTxBlindPlainOwned);
@@ -270,3 +353,47 @@ BENCHMARK(ParticlAddTxAnonBlindNotOwned);
 BENCHMARK(ParticlAddTxAnonBlindOwned);
 BENCHMARK(ParticlAddTxAnonAnonNotOwned);
 BENCHMARK(ParticlAddTxAnonAnonOwned);
+
+BENCHMARK(ParticlSendAnonToAnon);
+
+static void ParticlAnonRing3Wallet(benchmark::Bench& bench) { AnonShape(bench, 3, 1, 2, false); }
+static void ParticlAnonRing8Wallet(benchmark::Bench& bench) { AnonShape(bench, 8, 1, 2, false); }
+static void ParticlAnonRing16Wallet(benchmark::Bench& bench) { AnonShape(bench, 16, 1, 2, false); }
+static void ParticlAnonRing32Wallet(benchmark::Bench& bench) { AnonShape(bench, 32, 1, 2, false); }
+static void ParticlAnonRing3Mempool(benchmark::Bench& bench) { AnonShape(bench, 3, 1, 2, true); }
+static void ParticlAnonRing8Mempool(benchmark::Bench& bench) { AnonShape(bench, 8, 1, 2, true); }
+static void ParticlAnonRing16Mempool(benchmark::Bench& bench) { AnonShape(bench, 16, 1, 2, true); }
+static void ParticlAnonRing32Mempool(benchmark::Bench& bench) { AnonShape(bench, 32, 1, 2, true); }
+
+static void ParticlAnonInputs1Wallet(benchmark::Bench& bench) { AnonShape(bench, 5, 1, 2, false); }
+static void ParticlAnonInputs8Wallet(benchmark::Bench& bench) { AnonShape(bench, 5, 8, 2, false); }
+static void ParticlAnonInputs32Wallet(benchmark::Bench& bench) { AnonShape(bench, 5, 32, 2, false); }
+static void ParticlAnonInputs1Mempool(benchmark::Bench& bench) { AnonShape(bench, 5, 1, 2, true); }
+static void ParticlAnonInputs8Mempool(benchmark::Bench& bench) { AnonShape(bench, 5, 8, 2, true); }
+static void ParticlAnonInputs32Mempool(benchmark::Bench& bench) { AnonShape(bench, 5, 32, 2, true); }
+
+static void ParticlAnonOutputs8Wallet(benchmark::Bench& bench) { AnonShape(bench, 5, 2, 8, false); }
+static void ParticlAnonOutputs16Wallet(benchmark::Bench& bench) { AnonShape(bench, 5, 2, 16, false); }
+static void ParticlAnonOutputs8Mempool(benchmark::Bench& bench) { AnonShape(bench, 5, 2, 8, true); }
+static void ParticlAnonOutputs16Mempool(benchmark::Bench& bench) { AnonShape(bench, 5, 2, 16, true); }
+
+BENCHMARK(ParticlAnonRing3Wallet);
+BENCHMARK(ParticlAnonRing8Wallet);
+BENCHMARK(ParticlAnonRing16Wallet);
+BENCHMARK(ParticlAnonRing32Wallet);
+BENCHMARK(ParticlAnonRing3Mempool);
+BENCHMARK(ParticlAnonRing8Mempool);
+BENCHMARK(ParticlAnonRing16Mempool);
+BENCHMARK(ParticlAnonRing32Mempool);
+
+BENCHMARK(ParticlAnonInputs1Wallet);
+BENCHMARK(ParticlAnonInputs8Wallet);
+BENCHMARK(ParticlAnonInputs32Wallet);
+BENCHMARK(ParticlAnonInputs1Mempool);
+BENCHMARK(ParticlAnonInputs8Mempool);
+BENCHMARK(ParticlAnonInputs32Mempool);
+
+BENCHMARK(ParticlAnonOutputs8Wallet);
+BENCHMARK(ParticlAnonOutputs16Wallet);
+BENCHMARK(ParticlAnonOutputs8Mempool);
+BENCHMARK(ParticlAnonOutputs16Mempool);
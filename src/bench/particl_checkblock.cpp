@@ -0,0 +1,355 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <wallet/test/hdwallet_test_fixture.h>
+#include <bench/bench.h>
+#include <wallet/hdwallet.h>
+#include <wallet/coincontrol.h>
+#include <interfaces/chain.h>
+
+#include <anon.h>
+#include <chainparams.h>
+#include <consensus/validation.h>
+#include <crypto/common.h>
+#include <insight/insight.h>
+#include <key_io.h>
+#include <miner.h>
+#include <random.h>
+#include <rpc/rpcutil.h>
+#include <timedata.h>
+#include <util/string.h>
+#include <util/translation.h>
+#include <validation.h>
+
+#include <chrono>
+#include <thread>
+
+// Transactions of each kind in the generated block
+static constexpr size_t TXNS_PER_KIND = 8;
+// Anon outputs in the RCT index before the block, the rings draw their decoys from them
+static constexpr size_t ANON_INDEX_OUTPUTS = 256;
+// Messages paid for by each smsg funding transaction and the size charged for each
+static constexpr size_t MSGS_PER_FUNDING_TXN = 4;
+static constexpr size_t FUNDED_MSG_BYTES = 1024;
+
+static std::shared_ptr<CHDWallet> CreateBlockTestWallet(interfaces::Chain& chain, std::string wallet_name)
+{
+    DatabaseOptions options;
+    DatabaseStatus status;
+    bilingual_str error;
+    std::vector<bilingual_str> warnings;
+    options.create_flags = WALLET_FLAG_BLANK_WALLET;
+    auto database = MakeWalletDatabase(wallet_name, options, status, error);
+    auto wallet = CWallet::Create(chain, wallet_name, std::move(database), options.create_flags, error, warnings);
+
+    return std::static_pointer_cast<CHDWallet>(wallet);
+}
+
+static void SendTxn(CHDWallet *pwallet, CTxDestination &dest, OutputTypes type_in, OutputTypes type_out, CAmount amount, size_t num_outputs)
+{
+    {
+    LOCK(pwallet->cs_wallet);
+
+    std::string sError;
+    std::vector<CTempRecipient> vecSend;
+    for (size_t i = 0; i < num_outputs; ++i) {
+        vecSend.emplace_back(type_out, amount, dest);
+    }
+
+    CTransactionRef tx_new;
+    CWalletTx wtx(pwallet, tx_new);
+    CTransactionRecord rtx;
+    CAmount nFee;
+    CCoinControl coinControl;
+    int rv = type_in == OUTPUT_RINGCT ?
+        pwallet->AddAnonInputs(wtx, rtx, vecSend, true, DEFAULT_RING_SIZE, DEFAULT_INPUTS_PER_SIG, nFee, &coinControl, sError) :
+        type_in == OUTPUT_CT ?
+        pwallet->AddBlindedInputs(wtx, rtx, vecSend, true, nFee, &coinControl, sError) :
+        pwallet->AddStandardInputs(wtx, rtx, vecSend, true, nFee, &coinControl, sError);
+    assert(rv == 0);
+    assert(wtx.SubmitMemoryPoolAndRelay(sError, true));
+    }
+    SyncWithValidationInterfaceQueue();
+}
+
+/** A funding transaction as CSMSG::FundMsgs builds it, for random message ids */
+static void SendSmsgFundingTxn(CHDWallet *pwallet, size_t num_msgs)
+{
+    {
+    LOCK(pwallet->cs_wallet);
+
+    const Consensus::Params &consensus = Params().GetConsensus();
+    const CAmount msg_fee = (pwallet->chain().getSmsgFeeRate(nullptr) * FUNDED_MSG_BYTES) / 1000;
+
+    std::vector<uint8_t> vData(1 + 24 * num_msgs);
+    vData[0] = DO_FUND_MSG;
+    for (size_t k = 0; k < num_msgs; ++k) {
+        GetRandBytes(&vData[1 + k * 24], 20);
+        WriteLE32(&vData[21 + k * 24], msg_fee);
+    }
+
+    std::string sError;
+    std::vector<CTempRecipient> vecSend;
+    CTempRecipient tr;
+    tr.nType = OUTPUT_DATA;
+    tr.vData = vData;
+    vecSend.push_back(tr);
+
+    CTransactionRef tx_new;
+    CWalletTx wtx(pwallet, tx_new);
+    CTransactionRecord rtx;
+    CAmount nFee;
+    CCoinControl coinControl;
+    coinControl.m_feerate = CFeeRate(consensus.smsg_fee_funding_tx_per_k);
+    coinControl.fOverrideFeeRate = true;
+    coinControl.m_extrafee = msg_fee * num_msgs;
+    assert(0 == pwallet->AddStandardInputs(wtx, rtx, vecSend, true, nFee, &coinControl, sError));
+    assert(wtx.SubmitMemoryPoolAndRelay(sError, true));
+    }
+    SyncWithValidationInterfaceQueue();
+}
+
+/**
+ * A regtest chain with automated GVR and a treasury output every block, an
+ * RCT index of ANON_INDEX_OUTPUTS anon outputs and a staked, unconnected
+ * block on its tip. The block holds TXNS_PER_KIND each of plain, plain to
+ * blind, blind, anon and smsg funding transactions next to the coinstake.
+ * Proofs and signatures aren't cached, so each run verifies them again.
+ */
+class ParticlBlockSetup
+{
+public:
+    TestingSetup test_setup{
+        CBaseChainParams::REGTEST,
+        /* extra_args */ {
+            "-nodebuglogfile",
+            "-nodebug",
+            "-maxproofcachesize=0",
+            "-maxsigcachesize=0",
+            "-gvrthreshold=10000",
+            "-minrewardrangespan=1",
+            "-automatedgvrstartheight=0",
+        },
+        true,
+    };
+    util::Ref context{test_setup.m_node};
+    std::unique_ptr<interfaces::Chain> m_chain;
+    std::unique_ptr<interfaces::ChainClient> m_chain_client;
+    std::shared_ptr<CHDWallet> pwallet;
+    CTxDestination dest_plain, dest_stealth;
+    CBlock block;
+
+    ParticlBlockSetup()
+    {
+        gArgs.ForceSetArg("-acceptanontxn", "1"); // TODO: remove
+        gArgs.ForceSetArg("-acceptblindtxn", "1"); // TODO: remove
+        gArgs.ForceSetArg("-anonrestricted", "0");
+
+        ECC_Start_Stealth();
+        ECC_Start_Blinding();
+
+        m_chain = interfaces::MakeChain(test_setup.m_node);
+        m_chain_client = interfaces::MakeWalletClient(*m_chain, *Assert(test_setup.m_node.args));
+        m_chain_client->registerRpcs();
+
+        pwallet = CreateBlockTestWallet(*m_chain.get(), "a");
+        assert(pwallet.get());
+        AddWallet(pwallet);
+        {
+            LOCK(pwallet->cs_wallet);
+            pwallet->SetLastBlockProcessed(::ChainActive().Height(), ::ChainActive().Tip()->GetBlockHash());
+        }
+
+        CallRPC("extkeyimportmaster tprv8ZgxMBicQKsPeK5mCpvMsd1cwyT1JZsrBN82XkoYuZY1EVK7EwDaiL9sDfqUU5SntTfbRfnRedFWjg5xkDG5i3iwd3yP7neX5F2dtdCojk4", context, "a");
+
+        const std::string treasury_address = NewAddress("getnewaddress");
+        CallRPC("pushtreasuryfundsetting {\"timefrom\":0,\"fundaddress\":\"" + treasury_address + "\",\"minstakepercent\":10,\"outputperiod\":1}", context);
+
+        dest_plain = DecodeDestination(NewAddress("getnewaddress"));
+        dest_stealth = DecodeDestination(NewAddress("getnewstealthaddress"));
+
+        StakeNBlocks(pwallet.get(), 1);
+        for (size_t i = 0; i < ANON_INDEX_OUTPUTS; i += MAX_ANON_INPUTS) {
+            SendTxn(pwallet.get(), dest_stealth, OUTPUT_STANDARD, OUTPUT_RINGCT, 1 * COIN, MAX_ANON_INPUTS);
+        }
+        SendTxn(pwallet.get(), dest_stealth, OUTPUT_STANDARD, OUTPUT_CT, 1 * COIN, TXNS_PER_KIND * 2);
+        StakeNBlocks(pwallet.get(), 2);
+
+        FillMempool();
+        block = StakeBlock();
+        assert(block.vtx.size() == 1 + TXNS_PER_KIND * 5);
+    }
+
+    ~ParticlBlockSetup()
+    {
+        RemoveWallet(pwallet, nullopt);
+        pwallet.reset();
+
+        ECC_Stop_Stealth();
+        ECC_Stop_Blinding();
+    }
+
+    std::string NewAddress(const std::string& rpc)
+    {
+        UniValue rv = CallRPC(rpc, context, "a");
+        return part::StripQuotes(rv.write());
+    }
+
+    void FillMempool()
+    {
+        for (size_t i = 0; i < TXNS_PER_KIND; ++i) {
+            SendTxn(pwallet.get(), dest_plain, OUTPUT_STANDARD, OUTPUT_STANDARD, COIN / 10, 2);
+            SendTxn(pwallet.get(), dest_stealth, OUTPUT_STANDARD, OUTPUT_CT, COIN / 10, 2);
+            SendTxn(pwallet.get(), dest_stealth, OUTPUT_CT, OUTPUT_CT, COIN / 10, 2);
+            SendTxn(pwallet.get(), dest_stealth, OUTPUT_RINGCT, OUTPUT_RINGCT, COIN / 10, 2);
+            SendSmsgFundingTxn(pwallet.get(), MSGS_PER_FUNDING_TXN);
+        }
+    }
+
+    /** A block of the mempool on the tip, signed by a found kernel but not submitted */
+    CBlock StakeBlock()
+    {
+        size_t k, nTries = 10000;
+        for (k = 0; k < nTries; ++k) {
+            int nBestHeight = pwallet->chain().getHeightInt();
+            int64_t nSearchTime = GetAdjustedTime() & ~Params().GetStakeTimestampMask(nBestHeight+1);
+            if (nSearchTime > pwallet->nLastCoinStakeSearchTime) {
+                std::unique_ptr<CBlockTemplate> pblocktemplate = pwallet->CreateNewBlock();
+                assert(pblocktemplate.get());
+                if (pwallet->SignBlock(pblocktemplate.get(), nBestHeight+1, nSearchTime)) {
+                    return pblocktemplate->block;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        }
+        assert(false);
+    }
+};
+
+static void ParticlCheckBlock(benchmark::Bench& bench)
+{
+    ParticlBlockSetup setup;
+    const Consensus::Params& consensus = Params().GetConsensus();
+
+    bench.unit("block").run([&] {
+        CBlock block = setup.block;
+        block.fChecked = false; // CBlock caches its checked state
+
+        BlockValidationState state;
+        bool checked = CheckBlock(block, state, consensus);
+        assert(checked);
+    });
+}
+
+// CheckBlock, ContextualCheckBlock and ConnectBlock against the tip as
+// TestBlockValidity runs them, nothing is written so every run is the same.
+static void ParticlConnectBlock(benchmark::Bench& bench)
+{
+    ParticlBlockSetup setup;
+
+    bench.unit("block").run([&] {
+        CBlock block = setup.block;
+        block.fChecked = false;
+
+        LOCK(cs_main);
+        BlockValidationState state;
+        bool valid = TestBlockValidity(state, Params(), block, ::ChainActive().Tip(), true, true);
+        assert(valid);
+    });
+}
+
+/** The insight indexes as -addressindex -spentindex -timestampindex -balancesindex set them on a new chain */
+class InsightIndexFlags
+{
+    const bool m_address{fAddressIndex}, m_address_balance{fAddressBalanceIndex}, m_spent{fSpentIndex}, m_timestamp{fTimestampIndex}, m_balances{fBalancesIndex};
+
+public:
+    explicit InsightIndexFlags(bool enable)
+    {
+        fAddressIndex = fAddressBalanceIndex = fSpentIndex = fTimestampIndex = fBalancesIndex = enable;
+    }
+    ~InsightIndexFlags()
+    {
+        fAddressIndex = m_address;
+        fAddressBalanceIndex = m_address_balance;
+        fSpentIndex = m_spent;
+        fTimestampIndex = m_timestamp;
+        fBalancesIndex = m_balances;
+    }
+};
+
+// Blocks of the generated kind reconnected by each run
+static constexpr int INDEXED_BLOCKS = 8;
+
+/**
+ * INDEXED_BLOCKS blocks disconnected and connected again through
+ * ActivateBestChain, with or without the insight indexes. The bytes the
+ * indexes write per connected block are printed before the runs, the
+ * timings include the disconnect.
+ */
+static void ConnectBlocksIndexes(benchmark::Bench& bench, bool indexes)
+{
+    InsightIndexFlags flags(indexes);
+    ParticlBlockSetup setup;
+
+    CBlockIndex *pindex_first = nullptr;
+    for (int i = 0; i < INDEXED_BLOCKS; ++i) {
+        if (i > 0) {
+            setup.FillMempool();
+        }
+        StakeNBlocks(setup.pwallet.get(), 1);
+        if (i == 0) {
+            LOCK(cs_main);
+            pindex_first = ::ChainActive().Tip();
+        }
+    }
+    const CBlockIndex *pindex_tip = WITH_LOCK(cs_main, return ::ChainActive().Tip());
+
+    const auto disconnect = [&] {
+        BlockValidationState state;
+        bool invalidated = ::ChainstateActive().InvalidateBlock(state, Params(), pindex_first);
+        assert(invalidated);
+        LOCK(cs_main);
+        ResetBlockFailureFlags(pindex_first);
+    };
+    const auto connect = [&] {
+        BlockValidationState state;
+        bool activated = ActivateBestChain(state, Params());
+        assert(activated);
+        assert(WITH_LOCK(cs_main, return ::ChainActive().Tip()) == pindex_tip);
+    };
+
+    if (indexes && bench.output()) {
+        disconnect();
+        std::vector<uint64_t> bytes_before;
+        for (int i = 0; i < INSIGHT_STATS_MAX; ++i) {
+            bytes_before.push_back(GetInsightStats((InsightStatsType)i).nBytesWritten);
+        }
+        connect();
+        for (int i = 0; i < INSIGHT_STATS_MAX; ++i) {
+            const uint64_t bytes = GetInsightStats((InsightStatsType)i).nBytesWritten - bytes_before[i];
+            *bench.output() << InsightStatsName((InsightStatsType)i) << " index: " << bytes / INDEXED_BLOCKS << " bytes written per block\n";
+        }
+    }
+
+    bench.unit("block").batch(INDEXED_BLOCKS).run([&] {
+        disconnect();
+        connect();
+    });
+}
+
+static void ParticlConnectBlocksIndexed(benchmark::Bench& bench)
+{
+    ConnectBlocksIndexes(bench, true);
+}
+
+static void ParticlConnectBlocksUnindexed(benchmark::Bench& bench)
+{
+    ConnectBlocksIndexes(bench, false);
+}
+
+BENCHMARK(ParticlCheckBlock);
+BENCHMARK(ParticlConnectBlock);
+BENCHMARK(ParticlConnectBlocksIndexed);
+BENCHMARK(ParticlConnectBlocksUnindexed);
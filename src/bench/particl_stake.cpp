@@ -0,0 +1,229 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <wallet/test/hdwallet_test_fixture.h>
+#include <bench/bench.h>
+#include <wallet/hdwallet.h>
+#include <wallet/coincontrol.h>
+#include <interfaces/chain.h>
+
+#include <chainparams.h>
+#include <key_io.h>
+#include <miner.h>
+#include <pos/miner.h>
+#include <rpc/rpcutil.h>
+#include <timedata.h>
+#include <util/string.h>
+#include <util/translation.h>
+#include <validation.h>
+
+// Outputs per funding transaction, and funding transactions per staked block
+static constexpr size_t OUTPUTS_PER_TXN = 500;
+static constexpr size_t TXNS_PER_BLOCK = 20;
+// One in COLD_STAKE_SHARE of the outputs is a cold staking delegation to the wallet
+static constexpr size_t COLD_STAKE_SHARE = 4;
+
+static std::shared_ptr<CHDWallet> CreateStakeTestWallet(interfaces::Chain& chain, std::string wallet_name)
+{
+    DatabaseOptions options;
+    DatabaseStatus status;
+    bilingual_str error;
+    std::vector<bilingual_str> warnings;
+    options.create_flags = WALLET_FLAG_BLANK_WALLET;
+    auto database = MakeWalletDatabase(wallet_name, options, status, error);
+    auto wallet = CWallet::Create(chain, wallet_name, std::move(database), options.create_flags, error, warnings);
+
+    return std::static_pointer_cast<CHDWallet>(wallet);
+}
+
+static void SendOutputs(CHDWallet *pwallet, const CScript &script, size_t num_outputs)
+{
+    {
+    LOCK(pwallet->cs_wallet);
+
+    std::string sError;
+    std::vector<CTempRecipient> vecSend;
+    for (size_t i = 0; i < num_outputs; ++i) {
+        CTempRecipient r;
+        r.nType = OUTPUT_STANDARD;
+        r.SetAmount(COIN / 10);
+        r.fScriptSet = true;
+        r.scriptPubKey = script;
+        vecSend.push_back(r);
+    }
+
+    CTransactionRef tx_new;
+    CWalletTx wtx(pwallet, tx_new);
+    CTransactionRecord rtx;
+    CAmount nFee;
+    CCoinControl coinControl;
+    assert(0 == pwallet->AddStandardInputs(wtx, rtx, vecSend, true, nFee, &coinControl, sError));
+    assert(wtx.SubmitMemoryPoolAndRelay(sError, true));
+    }
+    SyncWithValidationInterfaceQueue();
+}
+
+/**
+ * A regtest wallet staking num_coins outputs of its own, COLD_STAKE_SHARE of
+ * them cold staking delegations it holds only the staking key for.
+ */
+class StakeSetup
+{
+public:
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-nodebuglogfile", "-nodebug"}, true};
+    util::Ref context{test_setup.m_node};
+    std::unique_ptr<interfaces::Chain> m_chain;
+    std::unique_ptr<interfaces::ChainClient> m_chain_client;
+    std::shared_ptr<CHDWallet> pwallet;
+
+    explicit StakeSetup(size_t num_coins)
+    {
+        m_chain = interfaces::MakeChain(test_setup.m_node);
+        m_chain_client = interfaces::MakeWalletClient(*m_chain, *Assert(test_setup.m_node.args));
+        m_chain_client->registerRpcs();
+
+        pwallet = CreateStakeTestWallet(*m_chain.get(), "a");
+        assert(pwallet.get());
+        AddWallet(pwallet);
+        {
+            LOCK(pwallet->cs_wallet);
+            pwallet->SetLastBlockProcessed(::ChainActive().Height(), ::ChainActive().Tip()->GetBlockHash());
+        }
+
+        CallRPC("extkeyimportmaster tprv8ZgxMBicQKsPeK5mCpvMsd1cwyT1JZsrBN82XkoYuZY1EVK7EwDaiL9sDfqUU5SntTfbRfnRedFWjg5xkDG5i3iwd3yP7neX5F2dtdCojk4", context, "a");
+
+        UniValue rv = CallRPC("getnewaddress", context, "a");
+        const CScript script_plain = GetScriptForDestination(DecodeDestination(part::StripQuotes(rv.write())));
+
+        // Staked by the wallet, spendable only by a key it doesn't have
+        CKey key_spend;
+        key_spend.MakeNewKey(true);
+        CScript script_cold = CScript() << OP_ISCOINSTAKE << OP_IF;
+        script_cold.append(script_plain);
+        script_cold << OP_ELSE
+            << OP_DUP << OP_SHA256 << ToByteVector(key_spend.GetPubKey().GetID256()) << OP_EQUALVERIFY << OP_CHECKSIG
+            << OP_ENDIF;
+
+        StakeNBlocks(pwallet.get(), 1);
+        size_t num_txns = 0;
+        for (size_t sent = 0; sent < num_coins; sent += OUTPUTS_PER_TXN) {
+            const size_t num_outputs = std::min(OUTPUTS_PER_TXN, num_coins - sent);
+            SendOutputs(pwallet.get(), num_txns % COLD_STAKE_SHARE == 0 ? script_cold : script_plain, num_outputs);
+            if (++num_txns % TXNS_PER_BLOCK == 0) {
+                StakeNBlocks(pwallet.get(), 1);
+            }
+        }
+        // Past the regtest stake min confirmations
+        StakeNBlocks(pwallet.get(), 3);
+    }
+
+    ~StakeSetup()
+    {
+        RemoveWallet(pwallet, nullopt);
+        pwallet.reset();
+    }
+
+    int64_t SearchTime() const
+    {
+        return GetAdjustedTime() & ~Params().GetStakeTimestampMask(::ChainActive().Height() + 1);
+    }
+};
+
+static void AvailableCoinsForStaking(benchmark::Bench& bench, size_t num_coins)
+{
+    StakeSetup setup(num_coins);
+    CHDWallet *pwallet = setup.pwallet.get();
+    const int64_t nTime = setup.SearchTime();
+    const int nHeight = ::ChainActive().Height() + 1;
+
+    bench.run([&] {
+        std::vector<COutput> vCoins;
+        pwallet->AvailableCoinsForStaking(vCoins, nTime, nHeight);
+        assert(vCoins.size() >= num_coins);
+    });
+}
+
+// Without the stakeable coins cached, as after each new block
+static void SelectCoinsForStaking(benchmark::Bench& bench, size_t num_coins)
+{
+    StakeSetup setup(num_coins);
+    CHDWallet *pwallet = setup.pwallet.get();
+    const int64_t nTime = setup.SearchTime();
+    const int nHeight = ::ChainActive().Height() + 1;
+
+    bench.run([&] {
+        pwallet->m_have_cached_stakeable_coins = false;
+        std::set<std::pair<const CWalletTx*, unsigned int>> setCoins;
+        int64_t nValueIn = 0;
+        bool selected = pwallet->SelectCoinsForStaking(pwallet->GetSpendableBalance(), nTime, nHeight, setCoins, nValueIn);
+        assert(selected);
+    });
+}
+
+// The kernel check of every selected coin, as CreateCoinStake runs it
+static void CheckStakeKernels(benchmark::Bench& bench, size_t num_coins)
+{
+    StakeSetup setup(num_coins);
+    CHDWallet *pwallet = setup.pwallet.get();
+    const int64_t nTime = setup.SearchTime();
+    const int nHeight = ::ChainActive().Height() + 1;
+    CBlockIndex *pindexPrev = ::ChainActive().Tip();
+
+    std::set<std::pair<const CWalletTx*, unsigned int>> setCoins;
+    int64_t nValueIn = 0;
+    bool selected = pwallet->SelectCoinsForStaking(pwallet->GetSpendableBalance(), nTime, nHeight, setCoins, nValueIn);
+    assert(selected);
+    std::vector<COutPoint> vPrevouts;
+    for (const auto &coin : setCoins) {
+        vPrevouts.emplace_back(coin.first->GetHash(), coin.second);
+    }
+    const unsigned int nBits = GetNextTargetRequired(pindexPrev);
+
+    bench.run([&] {
+        std::vector<int8_t> vKernel;
+        ::CheckStakeKernels(pindexPrev, nBits, nTime, vPrevouts, vKernel);
+    });
+}
+
+// CreateNewBlock and SignBlock as the staking thread calls them, found kernel or not
+static void CreateAndSignBlock(benchmark::Bench& bench, size_t num_coins)
+{
+    StakeSetup setup(num_coins);
+    CHDWallet *pwallet = setup.pwallet.get();
+    const int64_t nTime = setup.SearchTime();
+    const int nHeight = ::ChainActive().Height() + 1;
+
+    bench.run([&] {
+        pwallet->m_have_cached_stakeable_coins = false;
+        std::unique_ptr<CBlockTemplate> pblocktemplate = pwallet->CreateNewBlock();
+        assert(pblocktemplate.get());
+        pwallet->SignBlock(pblocktemplate.get(), nHeight, nTime);
+    });
+}
+
+static void ParticlAvailableCoinsForStaking1k(benchmark::Bench& bench) { AvailableCoinsForStaking(bench, 1000); }
+static void ParticlAvailableCoinsForStaking10k(benchmark::Bench& bench) { AvailableCoinsForStaking(bench, 10000); }
+static void ParticlAvailableCoinsForStaking100k(benchmark::Bench& bench) { AvailableCoinsForStaking(bench, 100000); }
+static void ParticlSelectCoinsForStaking1k(benchmark::Bench& bench) { SelectCoinsForStaking(bench, 1000); }
+static void ParticlSelectCoinsForStaking10k(benchmark::Bench& bench) { SelectCoinsForStaking(bench, 10000); }
+static void ParticlSelectCoinsForStaking100k(benchmark::Bench& bench) { SelectCoinsForStaking(bench, 100000); }
+static void ParticlCheckStakeKernels1k(benchmark::Bench& bench) { CheckStakeKernels(bench, 1000); }
+static void ParticlCheckStakeKernels10k(benchmark::Bench& bench) { CheckStakeKernels(bench, 10000); }
+static void ParticlCheckStakeKernels100k(benchmark::Bench& bench) { CheckStakeKernels(bench, 100000); }
+static void ParticlCreateAndSignBlock1k(benchmark::Bench& bench) { CreateAndSignBlock(bench, 1000); }
+static void ParticlCreateAndSignBlock10k(benchmark::Bench& bench) { CreateAndSignBlock(bench, 10000); }
+static void ParticlCreateAndSignBlock100k(benchmark::Bench& bench) { CreateAndSignBlock(bench, 100000); }
+
+BENCHMARK(ParticlAvailableCoinsForStaking1k);
+BENCHMARK(ParticlAvailableCoinsForStaking10k);
+BENCHMARK(ParticlAvailableCoinsForStaking100k);
+BENCHMARK(ParticlSelectCoinsForStaking1k);
+BENCHMARK(ParticlSelectCoinsForStaking10k);
+BENCHMARK(ParticlSelectCoinsForStaking100k);
+BENCHMARK(ParticlCheckStakeKernels1k);
+BENCHMARK(ParticlCheckStakeKernels10k);
+BENCHMARK(ParticlCheckStakeKernels100k);
+BENCHMARK(ParticlCreateAndSignBlock1k);
+BENCHMARK(ParticlCreateAndSignBlock10k);
+BENCHMARK(ParticlCreateAndSignBlock100k);
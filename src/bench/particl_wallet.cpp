@@ -0,0 +1,336 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <wallet/test/hdwallet_test_fixture.h>
+#include <bench/bench.h>
+#include <wallet/hdwallet.h>
+#include <wallet/hdwalletdb.h>
+#include <interfaces/chain.h>
+
+#include <key/stealth.h>
+#include <key_io.h>
+#include <random.h>
+#include <rpc/rpcutil.h>
+#include <util/string.h>
+#include <util/translation.h>
+#include <validation.h>
+
+// Wallet transactions written per db transaction while populating
+static constexpr size_t TXNS_PER_BATCH = 1000;
+// Blocks the history is spread over
+static constexpr int HISTORY_BLOCKS = 20;
+// Accounts besides the default, stealth addresses and receiving addresses the history pays to
+static constexpr size_t NUM_ACCOUNTS = 4;
+static constexpr size_t NUM_STEALTH_ADDRESSES = 8;
+static constexpr size_t NUM_ADDRESSES = 64;
+
+static std::shared_ptr<CHDWallet> OpenScaleTestWallet(interfaces::Chain& chain, std::string wallet_name, bool create)
+{
+    DatabaseOptions options;
+    DatabaseStatus status;
+    bilingual_str error;
+    std::vector<bilingual_str> warnings;
+    options.require_existing = !create;
+    options.create_flags = create ? WALLET_FLAG_BLANK_WALLET : 0;
+    auto database = MakeWalletDatabase(wallet_name, options, status, error);
+    auto wallet = CWallet::Create(chain, wallet_name, std::move(database), options.create_flags, error, warnings);
+
+    return std::static_pointer_cast<CHDWallet>(wallet);
+}
+
+/**
+ * A wallet db holding num_txns confirmed transactions, a third each plain,
+ * blind and anon. Each transaction pays one of the wallet's addresses, a
+ * share of the blind and anon outputs through its stealth addresses, and
+ * spends the change of the previous transaction of its kind.
+ * The history is written straight to the db, the wallet is closed after
+ * and Open() loads it back.
+ */
+class WalletScaleSetup
+{
+public:
+    TestingSetup test_setup{CBaseChainParams::REGTEST, {"-nodebuglogfile", "-nodebug"}, true};
+    util::Ref context{test_setup.m_node};
+    std::unique_ptr<interfaces::Chain> m_chain;
+    std::unique_ptr<interfaces::ChainClient> m_chain_client;
+    std::shared_ptr<CHDWallet> pwallet;
+    size_t num_txns;
+
+    explicit WalletScaleSetup(size_t num_txns_in) : num_txns(num_txns_in)
+    {
+        m_chain = interfaces::MakeChain(test_setup.m_node);
+        m_chain_client = interfaces::MakeWalletClient(*m_chain, *Assert(test_setup.m_node.args));
+        m_chain_client->registerRpcs();
+
+        pwallet = OpenScaleTestWallet(*m_chain.get(), "a", true);
+        assert(pwallet.get());
+        AddWallet(pwallet);
+        {
+            LOCK(pwallet->cs_wallet);
+            pwallet->SetLastBlockProcessed(::ChainActive().Height(), ::ChainActive().Tip()->GetBlockHash());
+        }
+
+        CallRPC("extkeyimportmaster tprv8ZgxMBicQKsPeK5mCpvMsd1cwyT1JZsrBN82XkoYuZY1EVK7EwDaiL9sDfqUU5SntTfbRfnRedFWjg5xkDG5i3iwd3yP7neX5F2dtdCojk4", context, "a");
+        for (size_t i = 0; i < NUM_ACCOUNTS; ++i) {
+            CallRPC(strprintf("extkey deriveaccount acc%d", i), context, "a");
+        }
+
+        std::vector<CScript> scripts;
+        for (size_t i = 0; i < NUM_ADDRESSES; ++i) {
+            UniValue rv = CallRPC("getnewaddress", context, "a");
+            scripts.push_back(GetScriptForDestination(DecodeDestination(part::StripQuotes(rv.write()))));
+        }
+        std::vector<uint32_t> stealth_ids;
+        for (size_t i = 0; i < NUM_STEALTH_ADDRESSES; ++i) {
+            UniValue rv = CallRPC("getnewstealthaddress", context, "a");
+            CStealthAddress sx;
+            bool decoded = sx.SetEncoded(part::StripQuotes(rv.write()));
+            assert(decoded);
+            CStealthAddressIndexed sxi;
+            sx.ToRaw(sxi.addrRaw);
+            uint32_t id;
+            bool indexed = pwallet->GetStealthKeyIndex(sxi, id);
+            assert(indexed);
+            stealth_ids.push_back(id);
+        }
+
+        StakeNBlocks(pwallet.get(), HISTORY_BLOCKS);
+        WriteHistory(scripts, stealth_ids);
+        Close();
+    }
+
+    ~WalletScaleSetup()
+    {
+        if (pwallet) {
+            Close();
+        }
+    }
+
+    void WriteHistory(const std::vector<CScript> &scripts, const std::vector<uint32_t> &stealth_ids)
+    {
+        LOCK(pwallet->cs_wallet);
+        CHDWalletDB wdb(pwallet->GetDatabase());
+
+        uint256 prev_txid[3];
+        for (size_t i = 0; i < num_txns; ++i) {
+            if (i % TXNS_PER_BATCH == 0) {
+                bool begun = wdb.TxnBegin();
+                assert(begun);
+            }
+            const CBlockIndex *pindex = ::ChainActive()[1 + i % HISTORY_BLOCKS];
+            const int64_t time = pindex->GetBlockTime() + i;
+            const CScript &script = scripts[i % scripts.size()];
+            const CScript &script_change = scripts[(i + 1) % scripts.size()];
+            const CAmount value = COIN + i, change = COIN / 2;
+            const size_t kind = i % 3;
+
+            bool written;
+            if (kind == 0) {
+                CMutableTransaction mtx;
+                mtx.nVersion = GHOST_TXN_VERSION;
+                mtx.vin.emplace_back(prev_txid[kind].IsNull() ? COutPoint(GetRandHash(), 0) : COutPoint(prev_txid[kind], 1));
+                mtx.vpout.push_back(MAKE_OUTPUT<CTxOutStandard>(value, script));
+                mtx.vpout.push_back(MAKE_OUTPUT<CTxOutStandard>(change, script_change));
+                CWalletTx wtx(pwallet.get(), MakeTransactionRef(std::move(mtx)));
+                wtx.m_confirm = CWalletTx::Confirmation(CWalletTx::CONFIRMED, pindex->nHeight, pindex->GetBlockHash(), 1);
+                wtx.nTimeReceived = time;
+                wtx.nOrderPos = i;
+                prev_txid[kind] = wtx.GetHash();
+                written = wdb.WriteTx(wtx);
+            } else {
+                const uint8_t output_type = kind == 1 ? OUTPUT_CT : OUTPUT_RINGCT;
+                CTransactionRecord rtx;
+                rtx.blockHash = pindex->GetBlockHash();
+                rtx.block_height = pindex->nHeight;
+                rtx.nIndex = 1;
+                rtx.nBlockTime = time;
+                rtx.nTimeReceived = time;
+                if (!prev_txid[kind].IsNull()) {
+                    rtx.nFlags |= kind == 1 ? ORF_BLIND_IN : ORF_ANON_IN;
+                    rtx.nFee = 10000;
+                    rtx.vin.emplace_back(prev_txid[kind], 1);
+                }
+
+                COutputRecord r;
+                r.nType = output_type;
+                r.nFlags = ORF_OWNED;
+                r.n = 0;
+                r.nValue = value;
+                r.scriptPubKey = script;
+                if (i % 4 < 2) {
+                    const uint32_t sx_id = stealth_ids[i % stealth_ids.size()];
+                    r.vPath.resize(5);
+                    r.vPath[0] = ORA_STEALTH;
+                    memcpy(&r.vPath[1], &sx_id, 4);
+                }
+                rtx.vout.push_back(r);
+
+                COutputRecord r_change;
+                r_change.nType = output_type;
+                r_change.nFlags = ORF_OWNED | ORF_CHANGE;
+                r_change.n = 1;
+                r_change.nValue = change;
+                r_change.scriptPubKey = script_change;
+                rtx.vout.push_back(r_change);
+
+                prev_txid[kind] = GetRandHash();
+                written = wdb.WriteTxRecord(prev_txid[kind], rtx);
+            }
+            assert(written);
+            if ((i + 1) % TXNS_PER_BATCH == 0 || i == num_txns - 1) {
+                bool committed = wdb.TxnCommit();
+                assert(committed);
+            }
+        }
+    }
+
+    void Open()
+    {
+        pwallet = OpenScaleTestWallet(*m_chain.get(), "a", false);
+        assert(pwallet.get());
+        AddWallet(pwallet);
+    }
+
+    void Close()
+    {
+        RemoveWallet(pwallet, nullopt);
+        UnloadWallet(std::move(pwallet));
+    }
+};
+
+// Reading the db and building the in memory maps, as on startup
+static void LoadWallet(benchmark::Bench& bench, size_t num_txns)
+{
+    WalletScaleSetup setup(num_txns);
+
+    bench.run([&] {
+        DatabaseOptions options;
+        DatabaseStatus status;
+        bilingual_str error;
+        options.require_existing = true;
+        std::unique_ptr<WalletDatabase> database = MakeWalletDatabase("a", options, status, error);
+        assert(database);
+        CHDWallet wallet(setup.m_chain.get(), "a", std::move(database));
+        bool first_run;
+        DBErrors rv = wallet.LoadWallet(first_run);
+        assert(rv == DBErrors::LOAD_OK);
+        LOCK(wallet.cs_wallet);
+        assert(wallet.mapRecords.size() + wallet.mapWallet.size() >= num_txns);
+    });
+}
+
+static void RescanWallet(benchmark::Bench& bench, size_t num_txns)
+{
+    WalletScaleSetup setup(num_txns);
+    setup.Open();
+    CHDWallet *pwallet = setup.pwallet.get();
+
+    bench.run([&] {
+        WalletRescanReserver reserver(*pwallet);
+        bool reserved = reserver.reserve();
+        assert(reserved);
+        CWallet::ScanResult result = pwallet->ScanForWalletTransactions(::ChainActive().Genesis()->GetBlockHash(), 0, {}, reserver, true);
+        assert(result.status == CWallet::ScanResult::SUCCESS);
+    });
+}
+
+static void GetBalances(benchmark::Bench& bench, size_t num_txns)
+{
+    WalletScaleSetup setup(num_txns);
+    setup.Open();
+    CHDWallet *pwallet = setup.pwallet.get();
+
+    bench.run([&] {
+        CHDWalletBalances bal;
+        bool got = pwallet->GetBalances(bal);
+        assert(got);
+        assert(bal.nAnon > 0);
+    });
+}
+
+// One page of the default time sorted listing, from the newest or from halfway down
+static void FilterTransactions(benchmark::Bench& bench, size_t num_txns, bool from_middle)
+{
+    WalletScaleSetup setup(num_txns);
+    setup.Open();
+    const std::string command = strprintf("filtertransactions {\"count\":100,\"skip\":%d}", from_middle ? num_txns / 2 : 0);
+
+    bench.run([&] {
+        UniValue rv = CallRPC(command, setup.context, "a");
+        assert(rv.size() == 100);
+    });
+}
+
+static void AvailableAnonCoins(benchmark::Bench& bench, size_t num_txns)
+{
+    WalletScaleSetup setup(num_txns);
+    setup.Open();
+    CHDWallet *pwallet = setup.pwallet.get();
+
+    bench.run([&] {
+        LOCK(pwallet->cs_wallet);
+        std::vector<COutputR> vCoins;
+        pwallet->AvailableAnonCoins(vCoins);
+        assert(vCoins.size() >= num_txns / 3);
+    });
+}
+
+// Filling the lookahead pool of a fresh loose chain, lookahead keys deep
+static void ExtKeyAddLookAhead(benchmark::Bench& bench, size_t lookahead)
+{
+    WalletScaleSetup setup(0);
+    setup.Open();
+    CHDWallet *pwallet = setup.pwallet.get();
+
+    std::vector<uint8_t> seed(32);
+    GetStrongRandBytes(seed.data(), seed.size());
+    CExtKey ek;
+    ek.SetSeed(seed.data(), seed.size());
+    CStoredExtKey sek;
+    sek.kp = CExtKeyPair(ek);
+    std::vector<uint8_t> v;
+    sek.mapValue[EKVT_N_LOOKAHEAD] = SetCompressedInt64(v, lookahead);
+
+    bench.run([&] {
+        LOCK(pwallet->cs_wallet);
+        sek.nLastLookAhead = 0;
+        pwallet->ExtKeyAddLookAhead(&sek);
+        assert(pwallet->mapLooseLookAhead.size() >= lookahead);
+        pwallet->mapLooseLookAhead.clear();
+    });
+}
+
+static void ParticlLoadWallet1k(benchmark::Bench& bench) { LoadWallet(bench, 1000); }
+static void ParticlLoadWallet10k(benchmark::Bench& bench) { LoadWallet(bench, 10000); }
+static void ParticlLoadWallet100k(benchmark::Bench& bench) { LoadWallet(bench, 100000); }
+static void ParticlRescanWallet1k(benchmark::Bench& bench) { RescanWallet(bench, 1000); }
+static void ParticlRescanWallet100k(benchmark::Bench& bench) { RescanWallet(bench, 100000); }
+static void ParticlGetBalances1k(benchmark::Bench& bench) { GetBalances(bench, 1000); }
+static void ParticlGetBalances10k(benchmark::Bench& bench) { GetBalances(bench, 10000); }
+static void ParticlGetBalances100k(benchmark::Bench& bench) { GetBalances(bench, 100000); }
+static void ParticlFilterTransactionsNewest10k(benchmark::Bench& bench) { FilterTransactions(bench, 10000, false); }
+static void ParticlFilterTransactionsNewest100k(benchmark::Bench& bench) { FilterTransactions(bench, 100000, false); }
+static void ParticlFilterTransactionsMiddle10k(benchmark::Bench& bench) { FilterTransactions(bench, 10000, true); }
+static void ParticlFilterTransactionsMiddle100k(benchmark::Bench& bench) { FilterTransactions(bench, 100000, true); }
+static void ParticlAvailableAnonCoins10k(benchmark::Bench& bench) { AvailableAnonCoins(bench, 10000); }
+static void ParticlAvailableAnonCoins100k(benchmark::Bench& bench) { AvailableAnonCoins(bench, 100000); }
+static void ParticlExtKeyAddLookAhead1k(benchmark::Bench& bench) { ExtKeyAddLookAhead(bench, 1000); }
+static void ParticlExtKeyAddLookAhead10k(benchmark::Bench& bench) { ExtKeyAddLookAhead(bench, 10000); }
+
+BENCHMARK(ParticlLoadWallet1k);
+BENCHMARK(ParticlLoadWallet10k);
+BENCHMARK(ParticlLoadWallet100k);
+BENCHMARK(ParticlRescanWallet1k);
+BENCHMARK(ParticlRescanWallet100k);
+BENCHMARK(ParticlGetBalances1k);
+BENCHMARK(ParticlGetBalances10k);
+BENCHMARK(ParticlGetBalances100k);
+BENCHMARK(ParticlFilterTransactionsNewest10k);
+BENCHMARK(ParticlFilterTransactionsNewest100k);
+BENCHMARK(ParticlFilterTransactionsMiddle10k);
+BENCHMARK(ParticlFilterTransactionsMiddle100k);
+BENCHMARK(ParticlAvailableAnonCoins10k);
+BENCHMARK(ParticlAvailableAnonCoins100k);
+BENCHMARK(ParticlExtKeyAddLookAhead1k);
+BENCHMARK(ParticlExtKeyAddLookAhead10k);
@@ -0,0 +1,323 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#if defined(HAVE_CONFIG_H)
+#include <config/bitcoin-config.h>
+#endif
+
+#include <bench/bench.h>
+#include <compat/endian.h>
+#include <crypto/hmac_sha256.h>
+#include <crypto/sha512.h>
+#include <random.h>
+#include <smsg/db.h>
+#include <smsg/keystore.h>
+#include <smsg/smessage.h>
+#include <test/util/setup_common.h>
+#include <util/time.h>
+
+#include <string.h>
+#include <vector>
+
+// Runs the global smsg module in a fresh data directory for the lifetime of the setup.
+class SmsgBenchSetup
+{
+public:
+    SmsgBenchSetup() : m_setup{CBaseChainParams::MAIN, {"-nodebuglogfile", "-nodebug"}, true}
+    {
+        smsgModule.m_node = &m_setup.m_node;
+        smsgModule.buckets.clear();
+        std::vector<std::shared_ptr<CWallet>> no_wallets;
+        assert(smsgModule.Start(nullptr, no_wallets, false));
+    }
+    ~SmsgBenchSetup()
+    {
+        smsgModule.Shutdown();
+        smsgModule.buckets.clear();
+    }
+
+    /** Add a receiving key to the smsg keystore without writing it to the db */
+    static CKey AddKey()
+    {
+        smsg::SecMsgKey key;
+        key.key.MakeNewKey(true);
+        key.nFlags = smsg::SMK_RECEIVE_ON | smsg::SMK_RECEIVE_ANON;
+        const CKeyID id = key.key.GetPubKey().GetID();
+        LOCK(smsgModule.cs_smsg);
+        smsgModule.keyStore.AddKey(id, key);
+        return key.key;
+    }
+
+private:
+    TestingSetup m_setup;
+};
+
+// A message with a random payload that trial decrypts as sent to pk_to, as CSMSG::Encrypt would.
+static void MakeMessage(FastRandomContext& rng, smsg::SecureMessage& smsg, std::vector<uint8_t>& payload, const CPubKey& pk_to, size_t payload_len)
+{
+    smsg.timestamp = GetTime();
+    smsg.m_ttl = smsg::SMSG_MIN_TTL;
+    GetRandBytes(smsg.iv, 16);
+    payload = rng.randbytes(payload_len);
+    smsg.nPayload = payload.size();
+
+    CKey key_r;
+    key_r.MakeNewKey(true);
+    memcpy(smsg.cpkR, key_r.GetPubKey().begin(), 33);
+    uint256 P = key_r.ECDH(pk_to);
+
+    uint8_t hashed[64];
+    CSHA512().Write(P.begin(), 32).Finalize(hashed);
+    CHMAC_SHA256 ctx(&hashed[32], 32);
+    int64_t timestamp_le = htole64(smsg.timestamp);
+    ctx.Write((uint8_t*)&timestamp_le, 8);
+    ctx.Write(smsg.iv, 16);
+    ctx.Write(payload.data(), payload.size());
+    ctx.Finalize(smsg.mac);
+}
+
+#ifdef ENABLE_WALLET
+// SecMsgCrypter only encrypts with the wallet built
+static void SmsgEncrypt(benchmark::Bench& bench, size_t message_len)
+{
+    SmsgBenchSetup setup;
+    const CKeyID id_from = SmsgBenchSetup::AddKey().GetPubKey().GetID();
+    const CKeyID id_to = SmsgBenchSetup::AddKey().GetPubKey().GetID();
+    FastRandomContext rng(true);
+    const std::vector<uint8_t> text = rng.randbytes(message_len);
+    const std::string message(text.begin(), text.end());
+
+    bench.batch(message_len).unit("byte").run([&] {
+        smsg::SecureMessage smsg;
+        int rv = smsgModule.Encrypt(smsg, id_from, id_to, message);
+        assert(rv == 0);
+    });
+}
+
+static void SmsgDecrypt(benchmark::Bench& bench, size_t message_len)
+{
+    SmsgBenchSetup setup;
+    const CKeyID id_from = SmsgBenchSetup::AddKey().GetPubKey().GetID();
+    const CKey key_to = SmsgBenchSetup::AddKey();
+    const CKeyID id_to = key_to.GetPubKey().GetID();
+    FastRandomContext rng(true);
+    const std::vector<uint8_t> text = rng.randbytes(message_len);
+    const std::string message(text.begin(), text.end());
+    smsg::SecureMessage smsg;
+    int rv = smsgModule.Encrypt(smsg, id_from, id_to, message);
+    assert(rv == 0);
+
+    bench.batch(message_len).unit("byte").run([&] {
+        smsg::MessageData msg;
+        int rv = smsgModule.Decrypt(false, key_to, id_to, smsg, msg);
+        assert(rv == 0);
+    });
+}
+
+static void SmsgEncrypt100(benchmark::Bench& bench) { SmsgEncrypt(bench, 100); }
+static void SmsgEncrypt1000(benchmark::Bench& bench) { SmsgEncrypt(bench, 1000); }
+static void SmsgEncrypt24000(benchmark::Bench& bench) { SmsgEncrypt(bench, smsg::SMSG_MAX_MSG_BYTES); }
+static void SmsgDecrypt100(benchmark::Bench& bench) { SmsgDecrypt(bench, 100); }
+static void SmsgDecrypt1000(benchmark::Bench& bench) { SmsgDecrypt(bench, 1000); }
+static void SmsgDecrypt24000(benchmark::Bench& bench) { SmsgDecrypt(bench, smsg::SMSG_MAX_MSG_BYTES); }
+#endif
+
+// Proof of work of a free message, the nonce is reset so each run does the same work.
+static void SmsgSetHash(benchmark::Bench& bench)
+{
+    SmsgBenchSetup setup;
+    FastRandomContext rng(true);
+    CKey key_to;
+    key_to.MakeNewKey(true);
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeMessage(rng, smsg, payload, key_to.GetPubKey(), 1024);
+
+    bench.run([&] {
+        memset(smsg.nonce, 0, sizeof(smsg.nonce));
+        int rv = smsgModule.SetHash(&smsg, payload.data(), payload.size());
+        assert(rv == 0);
+    });
+}
+
+// A received message addressed to none of the local keys, every key is tried.
+static void SmsgScanMessage(benchmark::Bench& bench, size_t num_keys)
+{
+    SmsgBenchSetup setup;
+    for (size_t i = 0; i < num_keys; ++i) {
+        SmsgBenchSetup::AddKey();
+    }
+    FastRandomContext rng(true);
+    CKey key_to;
+    key_to.MakeNewKey(true);
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeMessage(rng, smsg, payload, key_to.GetPubKey(), 1024);
+    unsigned char header[smsg::SMSG_HDR_LEN];
+    smsg.WriteHeader(header);
+
+    bench.run([&] {
+        bool own_message = false;
+        smsgModule.ScanMessage(header, payload.data(), payload.size(), false, own_message);
+        assert(!own_message);
+    });
+}
+
+static void SmsgScanMessage1Key(benchmark::Bench& bench) { SmsgScanMessage(bench, 1); }
+static void SmsgScanMessage100Keys(benchmark::Bench& bench) { SmsgScanMessage(bench, 100); }
+static void SmsgScanMessage10000Keys(benchmark::Bench& bench) { SmsgScanMessage(bench, 10000); }
+
+static constexpr size_t STORE_MESSAGES = 100;
+
+// Received messages appended to the bucket files, each run stores new messages.
+static void SmsgStore(benchmark::Bench& bench)
+{
+    SmsgBenchSetup setup;
+    FastRandomContext rng(true);
+    CKey key_to;
+    key_to.MakeNewKey(true);
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeMessage(rng, smsg, payload, key_to.GetPubKey(), 1024);
+    unsigned char header[smsg::SMSG_HDR_LEN];
+    smsg.WriteHeader(header);
+
+    uint64_t n = 0;
+    bench.batch(STORE_MESSAGES).unit("message").run([&] {
+        LOCK(smsgModule.cs_smsg);
+        for (size_t i = 0; i < STORE_MESSAGES; ++i) {
+            // The token sample is read from the start of the payload
+            ++n;
+            memcpy(payload.data(), &n, sizeof(n));
+            int rv = smsgModule.Store(header, payload.data(), payload.size());
+            assert(rv == 0);
+        }
+    });
+}
+
+// Own messages written to the inbox db in one transaction, as a scanned chunk is.
+static void SmsgStoreInbox(benchmark::Bench& bench)
+{
+    SmsgBenchSetup setup;
+    FastRandomContext rng(true);
+    CKey key_to;
+    key_to.MakeNewKey(true);
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeMessage(rng, smsg, payload, key_to.GetPubKey(), 1024);
+    unsigned char header[smsg::SMSG_HDR_LEN];
+    smsg.WriteHeader(header);
+    smsg::SecMsgStored stored;
+    stored.timeReceived = GetTime();
+    stored.addrTo = key_to.GetPubKey().GetID();
+
+    uint64_t n = 0;
+    bench.batch(STORE_MESSAGES).unit("message").run([&] {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        bool ok = db.Open("cw") && db.TxnBegin();
+        assert(ok);
+        for (size_t i = 0; i < STORE_MESSAGES; ++i) {
+            uint8_t chKey[30];
+            ++n;
+            memcpy(&chKey[0], smsg::DBK_INBOX.data(), 2);
+            memset(&chKey[2], 0, 28);
+            memcpy(&chKey[10], &n, sizeof(n));
+            db.WriteSmesg(chKey, stored, header, payload.data(), payload.size());
+        }
+        ok = db.TxnCommit();
+        assert(ok);
+    });
+}
+
+// Rebuild of the token state of a large bucket, as when buckets are loaded.
+static void SmsgHashBucket(benchmark::Bench& bench)
+{
+    FastRandomContext rng(true);
+    const int64_t now = GetTime();
+    const int64_t bucket_time = now - (now % smsg::SMSG_BUCKET_LEN);
+    smsg::SecMsgBucket bucket;
+    for (size_t i = 0; i < 50000; ++i) {
+        const std::vector<uint8_t> sample = rng.randbytes(8);
+        bucket.vTokens.emplace_back(bucket_time + (int64_t)(i % smsg::SMSG_BUCKET_LEN), sample.data(), 8, 0, smsg::SMSG_MIN_TTL);
+    }
+
+    bench.batch(bucket.vTokens.size()).unit("token").run([&] {
+        bucket.hashBucket(bucket_time);
+        ankerl::nanobench::doNotOptimizeAway(bucket.GetHash());
+    });
+}
+
+static constexpr size_t SYNC_MESSAGES = 2000;
+
+/**
+ * One bucket sync between two peers: the local node lists its tokens
+ * (smsgHave), sifts the tokens of a peer holding half of its messages and half
+ * unknown ones (smsgWant), then bunches the messages the peer wants (smsgMsg).
+ */
+static void SmsgBucketSync(benchmark::Bench& bench)
+{
+    SmsgBenchSetup setup;
+    FastRandomContext rng(true);
+    CKey key_to;
+    key_to.MakeNewKey(true);
+    const int64_t now = GetTime();
+    const int64_t bucket_time = now - (now % smsg::SMSG_BUCKET_LEN);
+    {
+        LOCK(smsgModule.cs_smsg);
+        smsg::SecureMessage smsg;
+        std::vector<uint8_t> payload;
+        unsigned char header[smsg::SMSG_HDR_LEN];
+        for (size_t i = 0; i < SYNC_MESSAGES; ++i) {
+            MakeMessage(rng, smsg, payload, key_to.GetPubKey(), 512);
+            smsg.timestamp = bucket_time + (int64_t)(i % (now - bucket_time + 1));
+            smsg.WriteHeader(header);
+            int rv = smsgModule.Store(header, payload.data(), payload.size());
+            assert(rv == 0);
+        }
+    }
+
+    std::vector<uint8_t> peer_have;
+    {
+        LOCK(smsgModule.cs_smsg);
+        bool ok = smsgModule.ListBucketTokens(bucket_time, 0, peer_have);
+        assert(ok);
+    }
+    // Tokens are 16 bytes after the 8 byte bucket time, the peer's second half is unknown here
+    for (size_t i = SYNC_MESSAGES / 2; i < SYNC_MESSAGES; ++i) {
+        const std::vector<uint8_t> sample = rng.randbytes(8);
+        memcpy(&peer_have[8 + i * 16 + 8], sample.data(), 8);
+    }
+    // The peer wants the messages it doesn't hold
+    std::vector<uint8_t> peer_want(peer_have.begin() + 8, peer_have.begin() + 8 + (SYNC_MESSAGES / 2) * 16);
+
+    bench.run([&] {
+        LOCK(smsgModule.cs_smsg);
+        std::vector<uint8_t> have;
+        smsgModule.ListBucketTokens(bucket_time, 0, have);
+        std::vector<uint8_t> want;
+        smsgModule.SiftBucketTokens(bucket_time, &peer_have[8], SYNC_MESSAGES, SYNC_MESSAGES, 1, want);
+        smsgModule.m_wanted_tokens.clear();
+        std::vector<std::vector<uint8_t>> bunches;
+        smsgModule.BunchBucketMessages(bucket_time, peer_want.data(), SYNC_MESSAGES / 2, SYNC_MESSAGES, bunches);
+        ankerl::nanobench::doNotOptimizeAway(bunches.size());
+    });
+}
+
+#ifdef ENABLE_WALLET
+BENCHMARK(SmsgEncrypt100);
+BENCHMARK(SmsgEncrypt1000);
+BENCHMARK(SmsgEncrypt24000);
+BENCHMARK(SmsgDecrypt100);
+BENCHMARK(SmsgDecrypt1000);
+BENCHMARK(SmsgDecrypt24000);
+#endif
+BENCHMARK(SmsgSetHash);
+BENCHMARK(SmsgScanMessage1Key);
+BENCHMARK(SmsgScanMessage100Keys);
+BENCHMARK(SmsgScanMessage10000Keys);
+BENCHMARK(SmsgStore);
+BENCHMARK(SmsgStoreInbox);
+BENCHMARK(SmsgHashBucket);
+BENCHMARK(SmsgBucketSync);
@@ -0,0 +1,68 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <random.h>
+#include <script/standard.h>
+#include <wallet/hdwallettypes.h>
+
+#include <map>
+
+static CTxDestination RandDest()
+{
+    uint256 h = GetRandHash();
+    return PKHash(uint160(h.begin(), 20));
+}
+
+// avoid_reuse coin selection on a wallet with 1M outputs, 10k of their destinations marked used
+static const size_t NUM_OUTPUTS = 1000000;
+static const size_t NUM_USED = 10000;
+
+static void SpentKeyAddressBookLookup(benchmark::Bench& bench)
+{
+    std::map<CTxDestination, std::map<std::string, std::string> > book;
+    std::vector<CScript> outputs;
+    for (size_t i = 0; i < NUM_OUTPUTS; ++i) {
+        CTxDestination dest = RandDest();
+        if (i < NUM_USED) {
+            book[dest]["used"] = "p";
+        } else {
+            book[dest];
+        }
+        outputs.push_back(GetScriptForDestination(dest));
+    }
+
+    size_t n = 0;
+    bench.run([&] {
+        CTxDestination dest;
+        ExtractDestination(outputs[n++ % outputs.size()], dest);
+        auto it = book.find(dest);
+        bool used = it != book.end() && it->second.count("used");
+        ankerl::nanobench::doNotOptimizeAway(used);
+    });
+}
+
+static void SpentKeyFingerprintLookup(benchmark::Bench& bench)
+{
+    CScriptFingerprintSet used_set;
+    std::vector<CScript> outputs;
+    for (size_t i = 0; i < NUM_OUTPUTS; ++i) {
+        CScript script = GetScriptForDestination(RandDest());
+        if (i < NUM_USED) {
+            used_set.Insert(script);
+        }
+        outputs.push_back(script);
+    }
+
+    size_t n = 0;
+    bench.run([&] {
+        CTxDestination dest;
+        ExtractDestination(outputs[n++ % outputs.size()], dest);
+        bool used = used_set.MayContain(GetScriptForDestination(dest));
+        ankerl::nanobench::doNotOptimizeAway(used);
+    });
+}
+
+BENCHMARK(SpentKeyAddressBookLookup);
+BENCHMARK(SpentKeyFingerprintLookup);
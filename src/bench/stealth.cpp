@@ -0,0 +1,104 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <bench/bench.h>
+#include <key.h>
+#include <key/stealth.h>
+#include <pubkey.h>
+
+#include <thread>
+
+// A payout txn to many stealth addresses
+static const size_t STEALTH_PAYOUTS = 200;
+
+static CStealthAddress RandStealthAddress()
+{
+    CStealthAddress sx;
+    CKey scan, spend;
+    scan.MakeNewKey(true);
+    spend.MakeNewKey(true);
+    SecretToPublicKey(scan, sx.scan_pubkey);
+    SecretToPublicKey(spend, sx.spend_pubkey);
+    sx.scan_secret = scan;
+    return sx;
+}
+
+static void StealthSendEach(benchmark::Bench& bench)
+{
+    ECC_Start();
+    ECC_Start_Stealth();
+    std::vector<CStealthAddress> addrs;
+    for (size_t i = 0; i < STEALTH_PAYOUTS; ++i) {
+        addrs.push_back(RandStealthAddress());
+    }
+
+    bench.batch(STEALTH_PAYOUTS).unit("output").run([&] {
+        for (const auto &sx : addrs) {
+            CKey sEphem, sShared;
+            ec_point pkSendTo;
+            sEphem.MakeNewKey(true);
+            assert(StealthSecret(sEphem, sx.scan_pubkey, sx.spend_pubkey, sShared, pkSendTo) == 0);
+        }
+    });
+    ECC_Stop_Stealth();
+    ECC_Stop();
+}
+
+static void StealthSendBatch(benchmark::Bench& bench)
+{
+    ECC_Start();
+    ECC_Start_Stealth();
+    std::vector<CStealthAddressPoints> points;
+    for (size_t i = 0; i < STEALTH_PAYOUTS; ++i) {
+        points.emplace_back(RandStealthAddress());
+    }
+
+    int nThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    std::vector<CStealthSendResult> results;
+    std::string sError;
+    bench.batch(STEALTH_PAYOUTS).unit("output").run([&] {
+        assert(MakeStealthOutputs(points, results, nThreads, sError) == 0);
+    });
+    ECC_Stop_Stealth();
+    ECC_Stop();
+}
+
+static void StealthFindBatch(benchmark::Bench& bench)
+{
+    ECC_Start();
+    ECC_Start_Stealth();
+    CStealthAddress sx = RandStealthAddress();
+    CStealthAddressPoints points(sx);
+
+    // Half of the outputs pay the address
+    std::vector<CStealthAddressPoints> send_to;
+    for (size_t i = 0; i < STEALTH_PAYOUTS; ++i) {
+        send_to.push_back(i % 2 ? points : CStealthAddressPoints(RandStealthAddress()));
+    }
+    std::vector<CStealthSendResult> results;
+    std::string sError;
+    assert(MakeStealthOutputs(send_to, results, 1, sError) == 0);
+    std::vector<ec_point> ephem_pubkeys;
+    std::vector<CKeyID> output_ids;
+    for (const auto &r : results) {
+        ec_point pkEphem;
+        SecretToPublicKey(r.sEphem, pkEphem);
+        ephem_pubkeys.push_back(pkEphem);
+        output_ids.push_back(CPubKey(r.pkSendTo).GetID());
+    }
+
+    int nThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    std::vector<uint8_t> vMatch;
+    std::vector<CKey> vShared;
+    bench.batch(STEALTH_PAYOUTS).unit("output").run([&] {
+        FindStealthOutputs(points, sx.scan_secret, ephem_pubkeys, output_ids, vMatch, vShared, nThreads);
+        assert(vMatch[1] && !vMatch[0]);
+    });
+    ECC_Stop_Stealth();
+    ECC_Stop();
+}
+
+BENCHMARK(StealthSendEach);
+BENCHMARK(StealthSendBatch);
+BENCHMARK(StealthFindBatch);
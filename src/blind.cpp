@@ -8,28 +8,48 @@
 #include <secp256k1_rangeproof.h>
 
 #include <support/allocators/secure.h>
+#include <proofcache.h>
 #include <random.h>
 #include <util/system.h>
+#include <util/trace.h>
 #include <serialize.h>
 #include <streams.h>
 #include <version.h>
 
 #include <bloom.h>
 #include <chain/ct_tainted.h>
-#include <chain/tx_blacklist.h>
-#include <chain/tx_whitelist.h>
-#include <set>
+
+#include <algorithm>
 
 
 secp256k1_context *secp256k1_ctx_blind = nullptr;
-secp256k1_scratch_space *blind_scratch = nullptr;
 secp256k1_bulletproof_generators *blind_gens = nullptr;
 
+static const size_t BLIND_SCRATCH_SIZE = 1024 * 1024;
+
+namespace {
+struct ThreadBlindScratch
+{
+    secp256k1_scratch_space *scratch = nullptr;
+
+    ~ThreadBlindScratch()
+    {
+        // Can run after ECC_Stop_Blinding, destroy only needs the error callback of a context
+        if (scratch) {
+            secp256k1_scratch_space_destroy(secp256k1_context_no_precomp, scratch);
+        }
+    }
+};
+} // namespace
+
+static thread_local ThreadBlindScratch thread_blind_scratch;
+
 static CBloomFilter ct_tainted_filter;
-static std::set<uint256> ct_whitelist;
-static std::set<int64_t> rct_whitelist;
-static std::set<int64_t> rct_blacklist;
-static std::set<int64_t> rct_whitelist2;
+// Sorted, unique lists searched with std::binary_search
+static std::vector<uint256> ct_whitelist;
+static std::vector<int64_t> rct_whitelist;
+static std::vector<int64_t> rct_blacklist;
+static std::vector<int64_t> rct_whitelist2;
 
 static int CountLeadingZeros(uint64_t nValueIn)
 {
@@ -74,6 +94,90 @@ static int64_t ipow(int64_t base, int exp)
 }
 
 
+bool CRangeProofCheck::VerifyOne(const Entry &entry) const
+{
+    if (m_bulletproof) {
+        return 1 == secp256k1_bulletproof_rangeproof_verify(secp256k1_ctx_blind,
+            GetBlindScratch(), blind_gens, entry.proof->data(), entry.proof->size(),
+            nullptr, entry.commitment, 1, 64, &secp256k1_generator_const_h, nullptr, 0);
+    }
+    uint64_t min_value = 0, max_value = 0;
+    return 1 == secp256k1_rangeproof_verify(secp256k1_ctx_blind, &min_value, &max_value,
+        entry.commitment, entry.proof->data(), entry.proof->size(),
+        nullptr, 0, secp256k1_generator_h);
+}
+
+bool CRangeProofCheck::operator()()
+{
+    // Drop proofs verified before, keeping the entries of the rest to store
+    std::vector<uint256> cache_entries;
+    cache_entries.reserve(m_entries.size());
+    size_t num_unverified = 0;
+    for (const auto &entry : m_entries) {
+        uint256 cache_entry = RangeProofCacheEntry(m_bulletproof, entry.commitment->data, *entry.proof);
+        if (m_cache_store && ProofCacheTakeFailed(cache_entry, m_error)) {
+            return false;
+        }
+        if (ProofCacheContains(cache_entry, !m_cache_store)) {
+            continue;
+        }
+        m_entries[num_unverified++] = entry;
+        cache_entries.push_back(cache_entry);
+    }
+    m_entries.resize(num_unverified);
+
+    TRACE_TIME_START(trace_start);
+    bool verified = false;
+    if (m_bulletproof && m_entries.size() > 1) {
+        std::vector<const unsigned char*> proofs;
+        std::vector<const secp256k1_pedersen_commitment*> commitments;
+        std::vector<secp256k1_generator> value_gens(m_entries.size(), secp256k1_generator_const_h);
+        proofs.reserve(m_entries.size());
+        commitments.reserve(m_entries.size());
+        for (const auto &entry : m_entries) {
+            proofs.push_back(entry.proof->data());
+            commitments.push_back(entry.commitment);
+        }
+        verified = 1 == secp256k1_bulletproof_rangeproof_verify_multi(secp256k1_ctx_blind,
+            GetBlindScratch(), blind_gens, proofs.data(), proofs.size(), ProofLength(),
+            nullptr, commitments.data(), 1, 64, value_gens.data(), nullptr, nullptr);
+    }
+    if (!verified) {
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            if (!VerifyOne(m_entries[i])) {
+                m_error = m_entries[i].reject_reason;
+                if (m_cache_store) {
+                    ProofCacheAddFailed(cache_entries[i], m_error);
+                }
+                TRACE4(validation, rangeproof_verify, m_bulletproof, m_entries.size(), TRACE_TIME_ELAPSED(trace_start), false);
+                return false;
+            }
+        }
+    }
+    TRACE4(validation, rangeproof_verify, m_bulletproof, m_entries.size(), TRACE_TIME_ELAPSED(trace_start), true);
+    if (m_cache_store) {
+        for (const auto &cache_entry : cache_entries) {
+            ProofCacheAdd(cache_entry);
+        }
+    }
+    return true;
+}
+
+void AddRangeProofCheck(std::vector<CRangeProofCheck> &vChecks, bool bulletproof, bool cache_store,
+    const secp256k1_pedersen_commitment *commitment, const std::vector<uint8_t> *proof, const char *reject_reason)
+{
+    for (auto it = vChecks.rbegin(); it != vChecks.rend(); ++it) {
+        if (it->IsBulletproof() == bulletproof && it->IsCacheStore() == cache_store &&
+            it->size() < RANGEPROOF_BATCH_SIZE &&
+            (!bulletproof || it->ProofLength() == proof->size())) {
+            it->Add(commitment, proof, reject_reason);
+            return;
+        }
+    }
+    vChecks.emplace_back(bulletproof, cache_store);
+    vChecks.back().Add(commitment, proof, reject_reason);
+}
+
 int SelectRangeProofParameters(uint64_t nValueIn, uint64_t &minValue, int &exponent, int &nBits)
 {
     int nLeadingZeros = CountLeadingZeros(nValueIn);
@@ -142,9 +246,18 @@ int GetRangeProofInfo(const std::vector<uint8_t> &vRangeproof, int &rexp, int &r
         &vRangeproof[0], vRangeproof.size()) == 1));
 }
 
+template <typename T>
+static void SortUnique(std::vector<T> &list)
+{
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end()), list.end());
+    list.shrink_to_fit();
+}
+
 void LoadRCTBlacklist(const int64_t indices[], size_t num_indices)
 {
-    rct_blacklist = std::set<int64_t>(indices, indices + num_indices);
+    rct_blacklist.assign(indices, indices + num_indices);
+    SortUnique(rct_blacklist);
     LogPrintf("RCT blacklist size %d\n", rct_blacklist.size());
 }
 
@@ -152,11 +265,13 @@ void LoadRCTWhitelist(const int64_t indices[], size_t num_indices, int list_id)
 {
     switch (list_id) {
         case 1:
-            rct_whitelist = std::set<int64_t>(indices, indices + num_indices);
+            rct_whitelist.assign(indices, indices + num_indices);
+            SortUnique(rct_whitelist);
             LogPrintf("RCT whitelist size %d\n", rct_whitelist.size());
             break;
         case 2:
-            rct_whitelist2 = std::set<int64_t>(indices, indices + num_indices);
+            rct_whitelist2.assign(indices, indices + num_indices);
+            SortUnique(rct_whitelist2);
             LogPrintf("RCT whitelist2 size %d\n", rct_whitelist2.size());
             break;
         default:
@@ -170,9 +285,11 @@ void LoadCTWhitelist(const unsigned char *data, size_t data_length)
     assert(data_length % 32 == 0);
 
     ct_whitelist.clear();
+    ct_whitelist.reserve(data_length / 32);
     for (size_t i = 0; i < data_length; i += 32) {
-        ct_whitelist.insert(uint256(&data[i], 32));
+        ct_whitelist.emplace_back(&data[i], 32);
     }
+    SortUnique(ct_whitelist);
     LogPrintf("CT whitelist size %d\n", ct_whitelist.size());
 }
 
@@ -185,23 +302,32 @@ void LoadCTTaintedFilter(const unsigned char *data, size_t data_length)
 bool IsFrozenBlindOutput(const uint256 &txid)
 {
     if (ct_tainted_filter.contains(txid)) {
-        return !ct_whitelist.count(txid);
+        return !std::binary_search(ct_whitelist.begin(), ct_whitelist.end(), txid);
     }
     return false;
 }
 
 bool IsBlacklistedAnonOutput(int64_t anon_index)
 {
-    return rct_blacklist.count(anon_index);
+    return std::binary_search(rct_blacklist.begin(), rct_blacklist.end(), anon_index);
 }
 
 bool IsWhitelistedAnonOutput(int64_t anon_index, int64_t time, const Consensus::Params &consensus_params)
 {
     if (time >= consensus_params.exploit_fix_3_time &&
-        rct_whitelist2.count(anon_index)) {
+        std::binary_search(rct_whitelist2.begin(), rct_whitelist2.end(), anon_index)) {
         return true;
     }
-    return rct_whitelist.count(anon_index);
+    return std::binary_search(rct_whitelist.begin(), rct_whitelist.end(), anon_index);
+}
+
+secp256k1_scratch_space *GetBlindScratch()
+{
+    if (!thread_blind_scratch.scratch) {
+        thread_blind_scratch.scratch = secp256k1_scratch_space_create(secp256k1_context_no_precomp, BLIND_SCRATCH_SIZE);
+        assert(thread_blind_scratch.scratch);
+    }
+    return thread_blind_scratch.scratch;
 }
 
 void ECC_Start_Blinding()
@@ -221,8 +347,6 @@ void ECC_Start_Blinding()
 
     secp256k1_ctx_blind = ctx;
 
-    blind_scratch = secp256k1_scratch_space_create(secp256k1_ctx_blind, 1024 * 1024);
-    assert(blind_scratch);
     blind_gens = secp256k1_bulletproof_generators_create(secp256k1_ctx_blind, &secp256k1_generator_const_g, 128);
     assert(blind_gens);
 }
@@ -230,7 +354,7 @@ void ECC_Start_Blinding()
 void ECC_Stop_Blinding()
 {
     secp256k1_bulletproof_generators_destroy(secp256k1_ctx_blind, blind_gens);
-    secp256k1_scratch_space_destroy(secp256k1_ctx_blind, blind_scratch);
+    blind_gens = nullptr;
 
     secp256k1_context *ctx = secp256k1_ctx_blind;
     secp256k1_ctx_blind = nullptr;
@@ -10,15 +10,79 @@
 #include <consensus/params.h>
 #include <amount.h>
 #include <stdint.h>
+#include <string>
 #include <vector>
 
 
 class uint256;
 
 extern secp256k1_context *secp256k1_ctx_blind;
-extern secp256k1_scratch_space *blind_scratch;
 extern secp256k1_bulletproof_generators *blind_gens;
 
+/**
+ * Bulletproof scratch space owned by the calling thread.
+ * secp256k1_ctx_blind and blind_gens are only read once built and are shared
+ * by all threads, a scratch space is written to by every proof.
+ */
+secp256k1_scratch_space *GetBlindScratch();
+
+//! Max number of rangeproofs verified by one CRangeProofCheck
+static const size_t RANGEPROOF_BATCH_SIZE = 16;
+
+/**
+ * Closure verifying a batch of rangeproofs on a script check thread.
+ * Bulletproofs of equal length are verified together with one
+ * multi-exponentiation, falling back to one at a time to find a bad proof.
+ * Proofs found in the proof cache are skipped.
+ * Only pointers are kept, the transactions must outlive the check.
+ */
+class CRangeProofCheck
+{
+private:
+    struct Entry
+    {
+        const secp256k1_pedersen_commitment *commitment;
+        const std::vector<uint8_t> *proof;
+        const char *reject_reason;
+    };
+    bool m_bulletproof = false;
+    bool m_cache_store = false;
+    std::vector<Entry> m_entries;
+    std::string m_error;
+
+    bool VerifyOne(const Entry &entry) const;
+
+public:
+    CRangeProofCheck() {}
+    explicit CRangeProofCheck(bool bulletproof, bool cache_store=false) : m_bulletproof(bulletproof), m_cache_store(cache_store) {}
+
+    bool IsBulletproof() const { return m_bulletproof; }
+    bool IsCacheStore() const { return m_cache_store; }
+    size_t ProofLength() const { return m_entries.empty() ? 0 : m_entries[0].proof->size(); }
+    size_t size() const { return m_entries.size(); }
+    void Add(const secp256k1_pedersen_commitment *commitment, const std::vector<uint8_t> *proof, const char *reject_reason)
+    {
+        m_entries.push_back({commitment, proof, reject_reason});
+    }
+
+    bool operator()();
+
+    void swap(CRangeProofCheck &check)
+    {
+        std::swap(m_bulletproof, check.m_bulletproof);
+        std::swap(m_cache_store, check.m_cache_store);
+        m_entries.swap(check.m_entries);
+        m_error.swap(check.m_error);
+    }
+
+    const std::string &GetError() const { return m_error; }
+};
+
+/** Queue a rangeproof into vChecks, joining an open batch of the same kind and proof length.
+ *  With cache_store set verified proofs are stored in the proof cache and failures recorded, otherwise cache hits are erased. */
+void AddRangeProofCheck(std::vector<CRangeProofCheck> &vChecks, bool bulletproof, bool cache_store,
+    const secp256k1_pedersen_commitment *commitment, const std::vector<uint8_t> *proof, const char *reject_reason);
+
 int SelectRangeProofParameters(uint64_t nValueIn, uint64_t &minValue, int &exponent, int &nBits);
 
 int GetRangeProofInfo(const std::vector<uint8_t> &vRangeproof, int &rexp, int &rmantissa, CAmount &min_value, CAmount &max_value);
@@ -16,6 +16,8 @@
 
 #include <unordered_map>
 
+CompactBlockStats g_compact_block_stats;
+
 CBlockHeaderAndShortTxIDs::CBlockHeaderAndShortTxIDs(const CBlock& block, bool fUseWTXID) :
         nonce(GetRand(std::numeric_limits<uint64_t>::max())),
         shorttxids(block.vtx.size() - 1), prefilledtxn(1), header(block) {
@@ -57,6 +59,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
     header = cmpctblock.header;
     vchBlockSig = cmpctblock.vchBlockSig;
     txn_available.resize(cmpctblock.BlockTxCount());
+    txn_source.assign(txn_available.size(), TX_SOURCE_MISSING);
 
     int32_t lastprefilledindex = -1;
     for (size_t i = 0; i < cmpctblock.prefilledtxn.size(); i++) {
@@ -73,6 +76,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
             return READ_STATUS_INVALID;
         }
         txn_available[lastprefilledindex] = cmpctblock.prefilledtxn[i].tx;
+        txn_source[lastprefilledindex] = TX_SOURCE_PREFILLED;
     }
     prefilled_count = cmpctblock.prefilledtxn.size();
 
@@ -113,6 +117,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
         if (idit != shorttxids.end()) {
             if (!have_txn[idit->second]) {
                 txn_available[idit->second] = pool->vTxHashes[i].second->GetSharedTx();
+                txn_source[idit->second] = TX_SOURCE_MEMPOOL;
                 have_txn[idit->second]  = true;
                 mempool_count++;
             } else {
@@ -121,6 +126,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
                 // but eating a round-trip due to FillBlock failure would be annoying
                 if (txn_available[idit->second]) {
                     txn_available[idit->second].reset();
+                    txn_source[idit->second] = TX_SOURCE_MISSING;
                     mempool_count--;
                 }
             }
@@ -139,6 +145,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
         if (idit != shorttxids.end()) {
             if (!have_txn[idit->second]) {
                 txn_available[idit->second] = extra_txn[i].second;
+                txn_source[idit->second] = TX_SOURCE_EXTRA;
                 have_txn[idit->second]  = true;
                 mempool_count++;
                 extra_count++;
@@ -152,6 +159,7 @@ ReadStatus PartiallyDownloadedBlock::InitData(const CBlockHeaderAndShortTxIDs& c
                 if (txn_available[idit->second] &&
                         txn_available[idit->second]->GetWitnessHash() != extra_txn[i].second->GetWitnessHash()) {
                     txn_available[idit->second].reset();
+                    txn_source[idit->second] = TX_SOURCE_MISSING;
                     mempool_count--;
                     extra_count--;
                 }
@@ -195,6 +203,8 @@ ReadStatus PartiallyDownloadedBlock::FillBlock(CBlock& block, const std::vector<
     // Make sure we can't call FillBlock again.
     header.SetNull();
     txn_available.clear();
+    std::vector<uint8_t> tx_sources;
+    tx_sources.swap(txn_source);
 
     if (vtx_missing.size() != tx_missing_offset)
         return READ_STATUS_INVALID;
@@ -210,6 +220,20 @@ ReadStatus PartiallyDownloadedBlock::FillBlock(CBlock& block, const std::vector<
         return READ_STATUS_CHECKBLOCK_FAILED;
     }
 
+    g_compact_block_stats.blocks++;
+    if (vtx_missing.empty()) {
+        g_compact_block_stats.blocks_no_request++;
+    }
+    for (size_t i = 0; i < block.vtx.size(); i++) {
+        const int tx_type = (int)GetFeeEstimateTxType(*block.vtx[i]);
+        switch (tx_sources[i]) {
+        case TX_SOURCE_MISSING: g_compact_block_stats.requested[tx_type]++; break;
+        case TX_SOURCE_PREFILLED: g_compact_block_stats.prefilled[tx_type]++; break;
+        case TX_SOURCE_MEMPOOL: g_compact_block_stats.mempool[tx_type]++; break;
+        case TX_SOURCE_EXTRA: g_compact_block_stats.extra[tx_type]++; break;
+        }
+    }
+
     LogPrint(BCLog::CMPCTBLOCK, "Successfully reconstructed block %s with %lu txn prefilled, %lu txn from mempool (incl at least %lu from extra pool) and %lu txn requested\n", hash.ToString(), prefilled_count, mempool_count, extra_count, vtx_missing.size());
     if (vtx_missing.size() < 5) {
         for (const auto& tx : vtx_missing) {
@@ -5,8 +5,10 @@
 #ifndef BITCOIN_BLOCKENCODINGS_H
 #define BITCOIN_BLOCKENCODINGS_H
 
+#include <policy/fees.h>
 #include <primitives/block.h>
 
+#include <atomic>
 
 class CTxMemPool;
 
@@ -129,9 +131,29 @@ public:
     }
 };
 
+/** Where the transactions of reconstructed compact blocks came from, by FeeEstimateTxType */
+struct CompactBlockStats {
+    std::atomic<uint64_t> blocks{0};
+    //! Blocks reconstructed without a getblocktxn round trip
+    std::atomic<uint64_t> blocks_no_request{0};
+    std::atomic<uint64_t> prefilled[NUM_FEE_ESTIMATE_TX_TYPES]{};
+    std::atomic<uint64_t> mempool[NUM_FEE_ESTIMATE_TX_TYPES]{};
+    std::atomic<uint64_t> extra[NUM_FEE_ESTIMATE_TX_TYPES]{};
+    std::atomic<uint64_t> requested[NUM_FEE_ESTIMATE_TX_TYPES]{};
+};
+
+extern CompactBlockStats g_compact_block_stats;
+
 class PartiallyDownloadedBlock {
 protected:
+    enum TxSource : uint8_t {
+        TX_SOURCE_MISSING,
+        TX_SOURCE_PREFILLED,
+        TX_SOURCE_MEMPOOL,
+        TX_SOURCE_EXTRA,
+    };
     std::vector<CTransactionRef> txn_available;
+    std::vector<uint8_t> txn_source;
     size_t prefilled_count = 0, mempool_count = 0, extra_count = 0;
     const CTxMemPool* pool;
 public:
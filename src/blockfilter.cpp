@@ -2,11 +2,13 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <cstring>
 #include <mutex>
 #include <sstream>
 #include <set>
 
 #include <blockfilter.h>
+#include <compat/endian.h>
 #include <crypto/siphash.h>
 #include <hash.h>
 #include <primitives/transaction.h>
@@ -22,6 +24,7 @@ static constexpr int GCS_SER_VERSION = 0;
 
 static const std::map<BlockFilterType, std::string> g_filter_types = {
     {BlockFilterType::BASIC, "basic"},
+    {BlockFilterType::PARTICL, "particl"},
 };
 
 // Map a value x that is uniformly distributed in the range [0, 2^64) to a
@@ -249,6 +252,92 @@ static GCSFilter::ElementSet BasicFilterElements(const CBlock& block,
     return elements;
 }
 
+GCSFilter::Element StealthPrefixFilterElement(uint8_t bits, uint32_t prefix)
+{
+    const uint32_t masked = htole32(prefix & (bits >= 32 ? 0xFFFFFFFF : ((1u << bits) - 1)));
+    GCSFilter::Element element(6);
+    element[0] = DO_STEALTH_PREFIX;
+    element[1] = bits;
+    memcpy(&element[2], &masked, 4);
+    return element;
+}
+
+static void AddStealthPrefix(GCSFilter::ElementSet& elements, const std::vector<uint8_t>& data, size_t offset)
+{
+    if (data.size() < offset + 5 || data[offset] != DO_STEALTH_PREFIX) {
+        return;
+    }
+    uint32_t prefix;
+    memcpy(&prefix, &data[offset + 1], 4);
+    prefix = le32toh(prefix);
+    for (uint8_t bits : PARTICL_FILTER_PREFIX_BITS) {
+        elements.insert(StealthPrefixFilterElement(bits, prefix));
+    }
+}
+
+/**
+ * The basic filter elements plus what a light wallet needs to find its
+ * Particl outputs: the scripts of standard and blinded outputs, anon output
+ * pubkeys, stealth prefixes and the key images of anon inputs.
+ */
+static GCSFilter::ElementSet ParticlFilterElements(const CBlock& block,
+                                                   const CBlockUndo& block_undo)
+{
+    GCSFilter::ElementSet elements = BasicFilterElements(block, block_undo);
+
+    for (const CTransactionRef& tx : block.vtx) {
+        for (const auto& txout : tx->vpout) {
+            switch (txout->GetType()) {
+            case OUTPUT_STANDARD:
+            case OUTPUT_CT: {
+                const CScript* script = txout->GetPScriptPubKey();
+                if (script && !script->empty() && (*script)[0] != OP_RETURN) {
+                    elements.emplace(script->begin(), script->end());
+                }
+                if (txout->IsType(OUTPUT_CT)) {
+                    // Data starts with the 33 byte ephemeral pubkey
+                    AddStealthPrefix(elements, *txout->GetPData(), 33);
+                }
+                break;
+            }
+            case OUTPUT_RINGCT: {
+                const CTxOutRingCT* txout_anon = (const CTxOutRingCT*)txout.get();
+                elements.emplace(txout_anon->pk.begin(), txout_anon->pk.end());
+                AddStealthPrefix(elements, txout_anon->vData, 33);
+                break;
+            }
+            case OUTPUT_DATA: {
+                // Stealth data for the standard output that follows it
+                const std::vector<uint8_t>& data = *txout->GetPData();
+                if (!data.empty() && data[0] == DO_STEALTH) {
+                    AddStealthPrefix(elements, data, 34);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        for (const CTxIn& txin : tx->vin) {
+            uint32_t num_inputs, ring_size;
+            if (!txin.IsAnonInput() || !txin.GetAnonInfo(num_inputs, ring_size) ||
+                txin.scriptData.stack.empty()) {
+                continue;
+            }
+            const std::vector<uint8_t>& key_images = txin.scriptData.stack[0];
+            if (key_images.size() != (size_t)num_inputs * 33) {
+                continue;
+            }
+            for (size_t k = 0; k < num_inputs; ++k) {
+                elements.emplace(key_images.begin() + k * 33, key_images.begin() + (k + 1) * 33);
+            }
+        }
+    }
+
+    return elements;
+}
+
 BlockFilter::BlockFilter(BlockFilterType filter_type, const uint256& block_hash,
                          std::vector<unsigned char> filter)
     : m_filter_type(filter_type), m_block_hash(block_hash)
@@ -267,13 +356,18 @@ BlockFilter::BlockFilter(BlockFilterType filter_type, const CBlock& block, const
     if (!BuildParams(params)) {
         throw std::invalid_argument("unknown filter_type");
     }
-    m_filter = GCSFilter(params, BasicFilterElements(block, block_undo));
+    if (m_filter_type == BlockFilterType::PARTICL) {
+        m_filter = GCSFilter(params, ParticlFilterElements(block, block_undo));
+    } else {
+        m_filter = GCSFilter(params, BasicFilterElements(block, block_undo));
+    }
 }
 
 bool BlockFilter::BuildParams(GCSFilter::Params& params) const
 {
     switch (m_filter_type) {
     case BlockFilterType::BASIC:
+    case BlockFilterType::PARTICL:
         params.m_siphash_k0 = m_block_hash.GetUint64(0);
         params.m_siphash_k1 = m_block_hash.GetUint64(1);
         params.m_P = BASIC_FILTER_P;
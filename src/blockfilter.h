@@ -88,9 +88,19 @@ constexpr uint32_t BASIC_FILTER_M = 784931;
 enum class BlockFilterType : uint8_t
 {
     BASIC = 0,
+    PARTICL = 0x50, // Outside the range BIP 157 may assign
     INVALID = 255,
 };
 
+/**
+ * Widths the stealth prefix of an output is added to a particl filter at.
+ * A wallet with a narrower prefix queries every completion to the next width.
+ */
+constexpr uint8_t PARTICL_FILTER_PREFIX_BITS[] = {8, 16};
+
+/** Filter element matching stealth prefixes whose low bits equal those of prefix. */
+GCSFilter::Element StealthPrefixFilterElement(uint8_t bits, uint32_t prefix);
+
 /** Get the human-readable name for a filter type. Returns empty string for unknown types. */
 const std::string& BlockFilterTypeName(BlockFilterType filter_type);
 
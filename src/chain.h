@@ -147,6 +147,10 @@ enum BlockStatus: uint32_t {
 class CBlockIndex
 {
 public:
+    // Members are ordered by use, the fields read when walking and comparing
+    // entries (GetAncestor, CBlockIndexWorkComparator, GetMedianTimePast) come
+    // first so a walk over many entries touches one or two cache lines of each.
+
     //! pointer to the hash of the block, if any. Memory is owned by this CBlockIndex
     const uint256* phashBlock{nullptr};
 
@@ -159,18 +163,24 @@ public:
     //! height of the entry in the chain. The genesis block has height 0
     int nHeight{0};
 
-    //! Which # file this block is stored in (blk?????.dat)
-    int nFile{0};
-
-    //! Byte offset within blk?????.dat where this block's data is stored
-    unsigned int nDataPos{0};
-
-    //! Byte offset within rev?????.dat where this block's undo data is stored
-    unsigned int nUndoPos{0};
+    //! Verification status of this block. See enum BlockStatus
+    uint32_t nStatus{0};
 
     //! (memory only) Total amount of work (expected number of hashes) in the chain up to and including this block
     arith_uint256 nChainWork{};
 
+    //! (memory only) Sequential id assigned to distinguish order in which blocks are received.
+    int32_t nSequenceId{0};
+
+    uint32_t nTime{0};
+
+    //! (memory only) Maximum nTime in the chain up to and including this block.
+    unsigned int nTimeMax{0};
+
+    uint32_t nBits{0};
+
+    unsigned int nFlags{0}; // pos: block index flags
+
     //! Number of transactions in this block.
     //! Note: in a potential headers-first mode, this number cannot be relied upon
     unsigned int nTx{0};
@@ -180,43 +190,39 @@ public:
     //! Change to 64-bit type when necessary; won't happen before 2030
     unsigned int nChainTx{0};
 
+    //! Which # file this block is stored in (blk?????.dat)
+    int nFile{0};
 
-    // proof-of-stake specific fields
-    unsigned int nFlags{0}; // pos: block index flags
-    uint256 bnStakeModifier{}; // hash modifier for proof-of-stake
-    COutPoint prevoutStake{};
-    //uint256 hashProof;
-    CAmount nMoneySupply{0};
-    int64_t nAnonOutputs{0}; // last index
+    //! Byte offset within blk?????.dat where this block's data is stored
+    unsigned int nDataPos{0};
 
-    //! Verification status of this block. See enum BlockStatus
-    uint32_t nStatus{0};
+    //! Byte offset within rev?????.dat where this block's undo data is stored
+    unsigned int nUndoPos{0};
 
-    //! block header
+    //! rest of the block header
     int32_t nVersion{0};
+    uint32_t nNonce{0};
     uint256 hashMerkleRoot{};
     uint256 hashWitnessMerkleRoot{};
-    uint32_t nTime{0};
-    uint32_t nBits{0};
-    uint32_t nNonce{0};
 
-    //! (memory only) Sequential id assigned to distinguish order in which blocks are received.
-    int32_t nSequenceId{0};
-
-    //! (memory only) Maximum nTime in the chain up to and including this block.
-    unsigned int nTimeMax{0};
+    // proof-of-stake specific fields
+    uint256 bnStakeModifier{}; // hash modifier for proof-of-stake
+    COutPoint prevoutStake{};
+    //uint256 hashProof;
+    CAmount nMoneySupply{0};
+    int64_t nAnonOutputs{0}; // last index
 
     CBlockIndex()
     {
     }
 
     explicit CBlockIndex(const CBlockHeader& block)
-        : nVersion{block.nVersion},
-          hashMerkleRoot{block.hashMerkleRoot},
-          hashWitnessMerkleRoot{block.hashWitnessMerkleRoot},
-          nTime{block.nTime},
+        : nTime{block.nTime},
           nBits{block.nBits},
-          nNonce{block.nNonce}
+          nVersion{block.nVersion},
+          nNonce{block.nNonce},
+          hashMerkleRoot{block.hashMerkleRoot},
+          hashWitnessMerkleRoot{block.hashWitnessMerkleRoot}
     {
     }
 
@@ -9,3239 +9,2334 @@
 
 // static unsigned int tx_whitelist_data_len = sizeof(tx_whitelist_data) / sizeof(unsigned char);
 
-static std::set<uint256>  tx_to_allow = {
-uint256S("c22280de808fdc24e1831a0daa91f34d01b93186d8f02e780788ed9f2c93aa24"),
-uint256S("c22280de808fdc24e1831a0daa91f34d01b93186d8f02e780788ed9f2c93aa24"),
-uint256S("7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ad"),
-uint256S("7459cd4d8e128e0e088072028d1ef1bfc8e972fbfeccd5c3ccc4e1faf477e19c"),
-uint256S("bed8610b1001f657716008c79fac4cdd1124c9c68a856f9c46c4d6733ed8bab0"),
-uint256S("bed8610b1001f657716008c79fac4cdd1124c9c68a856f9c46c4d6733ed8bab0"),
-uint256S("553e4dc979b923edc9512b3bac6e016797fe28c2ada4eef13c1a47696555842a"),
-uint256S("62f93d3e3087baba5d62cc4a593e3ec6164fbaef90200c2f0c454fb164ace61c"),
-uint256S("1343f79dba645b405e9afeb287718f448812e99536137517a0f0e16ef3cc2896"),
-uint256S("1343f79dba645b405e9afeb287718f448812e99536137517a0f0e16ef3cc2896"),
-uint256S("65634d629778e8b8eda409f0227158d1c0daf26324ee0f8e47b4758b086f26b5"),
-uint256S("65634d629778e8b8eda409f0227158d1c0daf26324ee0f8e47b4758b086f26b5"),
-uint256S("c2e59bec210c58cab2c03bf9840263c4c7ba533f79140dd1b51709647669cdd3"),
-uint256S("4163d27d2fda71eb46fd1c05775cbab32f23119ed26f7e251de1893dd53b7c04"),
-uint256S("13211c275033673693332c0555f62ceea41c9767e17c9e2adfc8b3ea290c3e53"),
-uint256S("13211c275033673693332c0555f62ceea41c9767e17c9e2adfc8b3ea290c3e53"),
-uint256S("b5de82340dad7c55cf92a13246ba97d61fccf6cf40fd63012019d225fd74d9eb"),
-uint256S("3bdf292ef3dadb4446e414dd20d9272021f1e5e7ba709c59d8822bd493e58b53"),
-uint256S("078837e9a3e7442a86c3b62802bebc70cc062e7a834514f598111a9a52836b73"),
-uint256S("078837e9a3e7442a86c3b62802bebc70cc062e7a834514f598111a9a52836b73"),
-uint256S("bfe15fde784be5370216fa17e28362fb537065eeecfb70e6c0f0db64b537432f"),
-uint256S("bfe15fde784be5370216fa17e28362fb537065eeecfb70e6c0f0db64b537432f"),
-uint256S("321f6c445b30c010dbc51ace9b4a8d6841604067959c4fc99cc50634fd76155c"),
-uint256S("321f6c445b30c010dbc51ace9b4a8d6841604067959c4fc99cc50634fd76155c"),
-uint256S("dd165775188e3919e2b60aacb1c05a9bfd4170930d0c66977b242f53fb447817"),
-uint256S("dd165775188e3919e2b60aacb1c05a9bfd4170930d0c66977b242f53fb447817"),
-uint256S("70fb3b512b166292c5ec2745f35c06e5db91d885b893dfa018fb53f588b45fe6"),
-uint256S("70fb3b512b166292c5ec2745f35c06e5db91d885b893dfa018fb53f588b45fe6"),
-uint256S("a75f7bae1926cc6ad2377cb67196fad79da1b43d4149abed4aca601e95ef9227"),
-uint256S("a75f7bae1926cc6ad2377cb67196fad79da1b43d4149abed4aca601e95ef9227"),
-uint256S("691c75d0da6f1cb58e05ba8d92b4c02c0742fe5899dd5a050f4822bfe74866f5"),
-uint256S("691c75d0da6f1cb58e05ba8d92b4c02c0742fe5899dd5a050f4822bfe74866f5"),
-uint256S("d2ef31b1bea4aca89879561c465d146fd21732a68fbf1f336d2411682f9aeeae"),
-uint256S("da437cf386e897de8d5642e0dec11837ea1e07c166a1b84d1e6d1390a10db85d"),
-uint256S("da437cf386e897de8d5642e0dec11837ea1e07c166a1b84d1e6d1390a10db85d"),
-uint256S("ec56fd3e7bdc7de43f3f4256d0516c6675e04280905e6adfd26d3fb975b31d4f"),
-uint256S("ec56fd3e7bdc7de43f3f4256d0516c6675e04280905e6adfd26d3fb975b31d4f"),
-uint256S("ff991aac154f93e0fa9077c9ddda952d5219124698e4e222c6f02b0f5e30dc62"),
-uint256S("1d024245b732891964e6c70c8fc9574f4880d3a2ba7cb5b855b67689958a6575"),
-uint256S("1d024245b732891964e6c70c8fc9574f4880d3a2ba7cb5b855b67689958a6575"),
-uint256S("4cc125e1689d901c4bca67bb73202f014e8bf2fc915d8b81cf0932dd319cacd6"),
-uint256S("4cc125e1689d901c4bca67bb73202f014e8bf2fc915d8b81cf0932dd319cacd6"),
-uint256S("580017b863c963e813cef0b8652555191b74543595f9329fe3e407599b88fe51"),
-uint256S("8ca2f69712de0caf04a93ac190304e5ddcfc763fbdb70bfa35abf22c9cff7001"),
-uint256S("bf196027b69a502b0671bc1293f1518017573d5213cf1e9a4522f435cbadadb8"),
-uint256S("e104870dc3ca958946d33f1b7ab6f4cfdce24d961b88d675a9558f9bfd85403e"),
-uint256S("1507a43f0632d00824fb4a6a6a63e4f7c51f8ea5552ac238a1c1ec734ad9dcd4"),
-uint256S("1507a43f0632d00824fb4a6a6a63e4f7c51f8ea5552ac238a1c1ec734ad9dcd4"),
-uint256S("01ddc478f6f4f5bbb33f76e22f4dd27ff3dc0149ccaec7bf3eae9a851b718b13"),
-uint256S("83ead775a6da66109b9878f32ac0b45f1170ed03e91ce046a923d4b712470144"),
-uint256S("83ead775a6da66109b9878f32ac0b45f1170ed03e91ce046a923d4b712470144"),
-uint256S("24595d6f2e14288035a47616df89e82748b9f78b4dc042375585c33b43f1ed52"),
-uint256S("2835e2b790dae5610c2960b3b80a9ac15d9bb783328fd1c1aca546488bdde7aa"),
-uint256S("2835e2b790dae5610c2960b3b80a9ac15d9bb783328fd1c1aca546488bdde7aa"),
-uint256S("07ad6cf130f3febf0ae52fa088e03b727a6c8a06451fb6b7c4a7c3be614b2660"),
-uint256S("a0d9db7865bc160175c27b35a04dfa41324e1c7462b171d5c3afb56f989770f3"),
-uint256S("a0d9db7865bc160175c27b35a04dfa41324e1c7462b171d5c3afb56f989770f3"),
-uint256S("e663badcb7347581ef4a4545329e3b44675158ae275754334f66f3c7d8a6554c"),
-uint256S("e663badcb7347581ef4a4545329e3b44675158ae275754334f66f3c7d8a6554c"),
-uint256S("599a8723102fd239f3ff72a10d8f723dd32722488e4d763a4e954f6be827b144"),
-uint256S("599a8723102fd239f3ff72a10d8f723dd32722488e4d763a4e954f6be827b144"),
-uint256S("1a0ef11e078219cdb04c621d1171b2353017b85df0059356939f34ca85d842d7"),
-uint256S("5ee96e33e6b7170c6d8a391005aa7a1e0219b930a1b91d58307385ec9cea5a33"),
-uint256S("5ee96e33e6b7170c6d8a391005aa7a1e0219b930a1b91d58307385ec9cea5a33"),
-uint256S("bfe49b8170edb20bde49a16165fbde562845b8f65447f0cbeec795385e78bb11"),
-uint256S("bfe49b8170edb20bde49a16165fbde562845b8f65447f0cbeec795385e78bb11"),
-uint256S("ca2d61aaec0d1e87736636254351adaa9cce221d2438789f667ba73e6cc12b1e"),
-uint256S("ca2d61aaec0d1e87736636254351adaa9cce221d2438789f667ba73e6cc12b1e"),
-uint256S("4a0e90fa7d005cada42fa94ed61e08c46177f52ae0d63ddaf62e4b54942f1d7b"),
-uint256S("4a0e90fa7d005cada42fa94ed61e08c46177f52ae0d63ddaf62e4b54942f1d7b"),
-uint256S("11214d88cfcc8cb105d432e9272c10d87c91c0369e9fb9346fe0bb13e0eb3fb7"),
-uint256S("11214d88cfcc8cb105d432e9272c10d87c91c0369e9fb9346fe0bb13e0eb3fb7"),
-uint256S("efd9c9a1b7749203678822d7125b163a7c67c80bb99f38ad298d1aad5b4247d2"),
-uint256S("de6492b0f677e1f73da2bc650d239e9857af35b783cc941a44a504e32e36d438"),
-uint256S("de6492b0f677e1f73da2bc650d239e9857af35b783cc941a44a504e32e36d438"),
-uint256S("0d98ea7ffb778d61f0006cd96d339ea8d727c06d84a03d904c034393cf78d86e"),
-uint256S("0d98ea7ffb778d61f0006cd96d339ea8d727c06d84a03d904c034393cf78d86e"),
-uint256S("87cc238ce509b4c48d5bf460d1c7bfe85d3b516f2cc4dd91ca8f9faa24f0eab0"),
-uint256S("59c5fb718f4818a7001dbe61af4f3ca73381328dfa13cb5fc33e8e19e7f7e118"),
-uint256S("59c5fb718f4818a7001dbe61af4f3ca73381328dfa13cb5fc33e8e19e7f7e118"),
-uint256S("65bb109f8095edd43f45915ed467ce135808da042c00f900669ccf1af22d3f01"),
-uint256S("65bb109f8095edd43f45915ed467ce135808da042c00f900669ccf1af22d3f01"),
-uint256S("b1b1109d1f273d341a2d8779752492e907435035b80c47fd7f6fd1e6e003d524"),
-uint256S("068ad16b7a61bee4978179b8a286e82cc8640546e693e5b8cbf3aa2213d7cb2c"),
-uint256S("94fda0289b525c489eb8a55f11318a8aaade9f77bdd1fd6733c15745c6252d61"),
-uint256S("94fda0289b525c489eb8a55f11318a8aaade9f77bdd1fd6733c15745c6252d61"),
-uint256S("4ecaf12f598748cc0318603547fd8c01a727e573737a861199740708ce0c7548"),
-uint256S("4ecaf12f598748cc0318603547fd8c01a727e573737a861199740708ce0c7548"),
-uint256S("033bd28d813886fca800452fdc27d9cb42083324b0f273d346a8c69d96314e63"),
-uint256S("033bd28d813886fca800452fdc27d9cb42083324b0f273d346a8c69d96314e63"),
-uint256S("62b2fbdf2f32f576e20c844ce3b686458f3ec4ae4b6922272c792cd9635363bc"),
-uint256S("cd307352b644cf036fc27945c96be2549fa5610067672bce6298d462bc830e23"),
-uint256S("ff94ba01f44100f1971ecd8f2f25d77f70bda878bf78bf4a6463f33d396049ed"),
-uint256S("ff94ba01f44100f1971ecd8f2f25d77f70bda878bf78bf4a6463f33d396049ed"),
-uint256S("a6e022c0dc7a240b0237c10530e915a1bd1986fb541eb2a68369f287aee0a2c0"),
-uint256S("a6e022c0dc7a240b0237c10530e915a1bd1986fb541eb2a68369f287aee0a2c0"),
-uint256S("ad387c540e1ccfe31b7f46beab75970527da8995843ee58340b51ad7ff4fc5f8"),
-uint256S("ad387c540e1ccfe31b7f46beab75970527da8995843ee58340b51ad7ff4fc5f8"),
-uint256S("775feebbaad6427ad44f4d2bb7e96aabc876da72e64fc41568e2f99d490f9248"),
-uint256S("78b3dbe309684691b279fff398b059669f4b47ea089e11cb05468924808529ec"),
-uint256S("78b3dbe309684691b279fff398b059669f4b47ea089e11cb05468924808529ec"),
-uint256S("ad7e2b40a9eab0302070b99f6ea40c121d1aea5da3dbec4236e9f9f08b002609"),
-uint256S("ad7e2b40a9eab0302070b99f6ea40c121d1aea5da3dbec4236e9f9f08b002609"),
-uint256S("954e5b410ad75fadc7345eec2527937ec7200c2f0c3bc52d9c91f23416c3b332"),
-uint256S("f4875a185942d2412996b4a41acdc414f051857e4ccefb47e5b5980e42fbe21b"),
-uint256S("b89b017280c6a48da2151214fcba67163c59150263889a17a0cecbdb62d5c9b7"),
-uint256S("b89b017280c6a48da2151214fcba67163c59150263889a17a0cecbdb62d5c9b7"),
-uint256S("7cfe886a17d2a7f152f56f316d190e1c7cca1f45797e5f6f3fc644b01ba7527b"),
-uint256S("ed4d113fe343eff51bbbf916cfdddd04eebedf8c0f992cd66db17eef9bb2e9ac"),
-uint256S("ed4d113fe343eff51bbbf916cfdddd04eebedf8c0f992cd66db17eef9bb2e9ac"),
-uint256S("22f61c27e977d36d980979461291edcc41b3bf35326045f34b33fc4303cdbf00"),
-uint256S("22f61c27e977d36d980979461291edcc41b3bf35326045f34b33fc4303cdbf00"),
-uint256S("d6aa4f66fd8974cc439120f2c7d42323c96fea84a72a9a6819ef273b0010205e"),
-uint256S("16a599464981cb3ca7154af327810110f688df18ee3a547d4ad95c81727b46ae"),
-uint256S("70d0431fb892cb4848420a307afad7afa7408bfa9989bad9c5020d943564b065"),
-uint256S("70d0431fb892cb4848420a307afad7afa7408bfa9989bad9c5020d943564b065"),
-uint256S("d6db87fb3d06564066142cbdb296d011cc5b3fefb98d0782021ec21afa661f0d"),
-uint256S("d6db87fb3d06564066142cbdb296d011cc5b3fefb98d0782021ec21afa661f0d"),
-uint256S("97cb48f06c95c09926584ee5ffdc56d45f3de99a7570f04646a98c00e3b8c487"),
-uint256S("bb4aab3610527e3839c6f20ca686ac5110e9c649f7f9c9a8d871ed626ba13f7b"),
-uint256S("4c9998a9b88d9e3ccea4166e9616c9cffb5594b4f2b078e445a826084797f7af"),
-uint256S("4c9998a9b88d9e3ccea4166e9616c9cffb5594b4f2b078e445a826084797f7af"),
-uint256S("221824e848f4deeb22c05a99734e67cb0085da2ae6f5d3976497fde8de0f9299"),
-uint256S("221824e848f4deeb22c05a99734e67cb0085da2ae6f5d3976497fde8de0f9299"),
-uint256S("13370a9808841ba6364b316eb8df0561d45a6e816c98f50dff828ee267148f8f"),
-uint256S("13370a9808841ba6364b316eb8df0561d45a6e816c98f50dff828ee267148f8f"),
-uint256S("ab6f74d7bed4bd481420541f7144828f9a573852449dabc023ce4c782878b1b8"),
-uint256S("ab6f74d7bed4bd481420541f7144828f9a573852449dabc023ce4c782878b1b8"),
-uint256S("fa14c6041ac91197b514ea23b22817989fb7b4cde8aa032f80eec4dcbee22569"),
-uint256S("90c6b985825d653ab0b35887650f39ea5ed6efa6006c89f9345ba540e1b73760"),
-uint256S("90c6b985825d653ab0b35887650f39ea5ed6efa6006c89f9345ba540e1b73760"),
-uint256S("a8b50db59c7c970a57328a5b84285e92cabbf76b96670fd4c262e38be3d272e7"),
-uint256S("a8b50db59c7c970a57328a5b84285e92cabbf76b96670fd4c262e38be3d272e7"),
-uint256S("51f14b98ba569ecc003a847b09bfbd4ac927c7bb1776d150aca710af6cd2b850"),
-uint256S("51f14b98ba569ecc003a847b09bfbd4ac927c7bb1776d150aca710af6cd2b850"),
-uint256S("b43869db43029f2e958f05b54639fae8aa195fb69acea86b8d016d5f757205ce"),
-uint256S("b43869db43029f2e958f05b54639fae8aa195fb69acea86b8d016d5f757205ce"),
-uint256S("537b14476cfc71f20775db1e1ad7c5edc20c466cec52c66b16c7553ffcfdc1fa"),
-uint256S("54a9384f6ee12a1638ee37d8542f730dad9563ec83165753d45a3285efe489d8"),
-uint256S("e307a4df677faa92f6e85f43312354fd6370c8a3c33518366119b25fc47a66e1"),
-uint256S("ee40740192cd453b2c641de2bba88df7474fdfb1504bd0845f03cd37fae59dcc"),
-uint256S("ee40740192cd453b2c641de2bba88df7474fdfb1504bd0845f03cd37fae59dcc"),
-uint256S("b0caadc8d70bfdbc50d86d5c8909f8f788c8d2bb8fcc95ab425d0cd520f6a30e"),
-uint256S("3e3f6d0bc58d06431fc354cf8303f49a9bda96fdec5d1932dcb590aa9384aaeb"),
-uint256S("3e3f6d0bc58d06431fc354cf8303f49a9bda96fdec5d1932dcb590aa9384aaeb"),
-uint256S("94fd14a7036eb70300bf0741e587de898a931e9deb0a9989c1a06de7f5dae8d7"),
-uint256S("94fd14a7036eb70300bf0741e587de898a931e9deb0a9989c1a06de7f5dae8d7"),
-uint256S("923f8c0b1dc6e9e02094dae9555152c66876861c3edce7ad5e690b2b2d3bf2fe"),
-uint256S("e5bef9b9f05f271c58a018fafffb1f7423e4d7ababa0b0cf19af4ca629bb342f"),
-uint256S("e5bef9b9f05f271c58a018fafffb1f7423e4d7ababa0b0cf19af4ca629bb342f"),
-uint256S("e44fc196626e8baec611870fe546dffb3a6504af6e4f0645dfa00020f44c691c"),
-uint256S("e44fc196626e8baec611870fe546dffb3a6504af6e4f0645dfa00020f44c691c"),
-uint256S("cdd1b9151a60799a9aa96ff07dd613465aaf3fdee06f7c52404292ba9d514504"),
-uint256S("cdd1b9151a60799a9aa96ff07dd613465aaf3fdee06f7c52404292ba9d514504"),
-uint256S("b660a516628a04656b996d074d8d634a3730ed997cc2f3db8bbc0995a01332e2"),
-uint256S("b660a516628a04656b996d074d8d634a3730ed997cc2f3db8bbc0995a01332e2"),
-uint256S("7c411388b16cf0466f49b84eb7c178fa399501e6fe609cca91039d77b4524325"),
-uint256S("525fa312b3ab28d613d37171db8079492c878316f0b267290e883049d866d9d5"),
-uint256S("9a588a4e81ce8d43c96d1073c3457d4415e914c86a3ff90fcb612ab106bac23f"),
-uint256S("33c9dcabd230d1f344ea91895fc16f5a91329ee446d2f376ff0aaa0f387a2298"),
-uint256S("33c9dcabd230d1f344ea91895fc16f5a91329ee446d2f376ff0aaa0f387a2298"),
-uint256S("583b95c2e0f6a23b689d7645f3962c16c8db29076ddcb3b70454ec2fc8284a59"),
-uint256S("583b95c2e0f6a23b689d7645f3962c16c8db29076ddcb3b70454ec2fc8284a59"),
-uint256S("82608916a58f5cf528651fdf59c4b81cf95579fe0083a04cd98e262a926eca35"),
-uint256S("9f46dec3e34449bd0e8692cf8b22aa55d223f7dc0ca2f39da7aeda0b6eff5428"),
-uint256S("e49237f3e4fc2160a04474a9ff106618f680b04be02a9e24183bd5f220066723"),
-uint256S("251de1c5156ebb025a82fd572914833ec2c38287c2c671bd9e4c83ded8265487"),
-uint256S("251de1c5156ebb025a82fd572914833ec2c38287c2c671bd9e4c83ded8265487"),
-uint256S("ff6a9cce4312a4b325b51c47315b0e0bf5b2b0c6caef36eca94454d9a1b0670b"),
-uint256S("ff6a9cce4312a4b325b51c47315b0e0bf5b2b0c6caef36eca94454d9a1b0670b"),
-uint256S("d24fc3761f86cdf8a45cd91cb8529c9ad0757c3c7becc4c4c9420bb75b7409bd"),
-uint256S("0b7c4aa569972716738cd7537ce84886797a92965a122c155bc045cde2bcfecc"),
-uint256S("0b7c4aa569972716738cd7537ce84886797a92965a122c155bc045cde2bcfecc"),
-uint256S("7a114026fdfbbfdcd0c14014bb8d229bf654121786087a59ceb186f62a00ba7f"),
-uint256S("7a114026fdfbbfdcd0c14014bb8d229bf654121786087a59ceb186f62a00ba7f"),
-uint256S("aab26cc88ea2900120968a8aa7443ee82f46d6031ad0651066c4cbf7e378cf31"),
-uint256S("5cc8d8711c3c967dde5247bb2f5b903812e99f09fc67672fc0d6665678aba854"),
-uint256S("5cc8d8711c3c967dde5247bb2f5b903812e99f09fc67672fc0d6665678aba854"),
-uint256S("30f7133b5ece0d5f7353383dd45af3bbb22828d12ca0269c5a0f54bbf74dcd00"),
-uint256S("30f7133b5ece0d5f7353383dd45af3bbb22828d12ca0269c5a0f54bbf74dcd00"),
-uint256S("18a3d2fe253383ec0a675155835b206946a8cd4cf47ac726cb44d34d9759d3f3"),
-uint256S("1c9b5bbc87c9f723637b341c1264af341ad1785c4699f5e649ad72877e323112"),
-uint256S("3d3f0be5b3213d6c0505c9c1b6421ea1b0410b833d4facb8347dd337070759ff"),
-uint256S("45711a1919b35a70b4ce61f599030565d49d7f8d4559bbeafd0191045b535c1f"),
-uint256S("45711a1919b35a70b4ce61f599030565d49d7f8d4559bbeafd0191045b535c1f"),
-uint256S("73495741eaa9c151c101dbda113016d013a93a784a45b4ee7e8b9214c4324d6d"),
-uint256S("73495741eaa9c151c101dbda113016d013a93a784a45b4ee7e8b9214c4324d6d"),
-uint256S("41de1d45c5ad82e9cbca93242013d1b2c453c514933ecbf7f1892b48ccc02d34"),
-uint256S("41de1d45c5ad82e9cbca93242013d1b2c453c514933ecbf7f1892b48ccc02d34"),
-uint256S("8d057ddb0c2d28128053c4d31a32376c2cd3e57157bfde62549e042abdd0b1f8"),
-uint256S("8d057ddb0c2d28128053c4d31a32376c2cd3e57157bfde62549e042abdd0b1f8"),
-uint256S("a3a46c69835b5fd06171f6a2cfc83c6f4d2f5b5f39489448d53c8c0d5e95c669"),
-uint256S("a3a46c69835b5fd06171f6a2cfc83c6f4d2f5b5f39489448d53c8c0d5e95c669"),
-uint256S("bf3388bb39347b9d560349ae7cc62f995c3659fc1e91e48b3ff26746e89efdce"),
-uint256S("9597131e6109e6f768c3569cd9d2fc7442430e4ee23ddf2b37adb78a15cc9818"),
-uint256S("9597131e6109e6f768c3569cd9d2fc7442430e4ee23ddf2b37adb78a15cc9818"),
-uint256S("726396eeb75f3d7c32017f3c1f2e2119d7e667839f6d765ad4b66f9d2efa26c2"),
-uint256S("726396eeb75f3d7c32017f3c1f2e2119d7e667839f6d765ad4b66f9d2efa26c2"),
-uint256S("6027d6f5848c6dbb6559efce783e5134d1904081986df53c2f8fb26c4f35f7b1"),
-uint256S("6027d6f5848c6dbb6559efce783e5134d1904081986df53c2f8fb26c4f35f7b1"),
-uint256S("24669f18c9a298f3535bd24add4237e4ff70e90c83fb2a90f8ee18e2171ee4a3"),
-uint256S("24669f18c9a298f3535bd24add4237e4ff70e90c83fb2a90f8ee18e2171ee4a3"),
-uint256S("d01fa8cf3e365f07f268e15e5aa71570fd6418d9d9d56cde940f47bff7d12e1e"),
-uint256S("d01fa8cf3e365f07f268e15e5aa71570fd6418d9d9d56cde940f47bff7d12e1e"),
-uint256S("35b448e7311cbe9206ef62440887877345076b8cff5ccbe45dd98770bb9fda35"),
-uint256S("52d828c3803800c6cb94f2e1f24b0ff5017b419702437a908dbca92f8dd6c932"),
-uint256S("52d828c3803800c6cb94f2e1f24b0ff5017b419702437a908dbca92f8dd6c932"),
-uint256S("74f7ac4de1c33a237406ca33a4fe50a7e869c32bd65a312f1eb567a098769a75"),
-uint256S("74f7ac4de1c33a237406ca33a4fe50a7e869c32bd65a312f1eb567a098769a75"),
-uint256S("440bc522bcd90dd3631d6f07ac2eb3baa0eaa8215c5d1e1a18a22b9a740821a0"),
-uint256S("440bc522bcd90dd3631d6f07ac2eb3baa0eaa8215c5d1e1a18a22b9a740821a0"),
-uint256S("3459aabc89425dbca9a5c94a08c3cec7abb14dd5abe1730230c286652a7a01fc"),
-uint256S("3459aabc89425dbca9a5c94a08c3cec7abb14dd5abe1730230c286652a7a01fc"),
-uint256S("92a60a6f9f95e0e5318cd8f8c7184b6fa29f43bee68f5a66bfa3b0cf780cdef9"),
-uint256S("2f045cb448caca0faf33e0e74634c762c074b8b4982c4a5d700fe75cbff1a357"),
-uint256S("2f045cb448caca0faf33e0e74634c762c074b8b4982c4a5d700fe75cbff1a357"),
-uint256S("2fb460fcf39484301fe3b8439a6d7c43659739afc1e3d4673336c07add2e7089"),
-uint256S("2fb460fcf39484301fe3b8439a6d7c43659739afc1e3d4673336c07add2e7089"),
-uint256S("6bf83bd0623894a7adfd1d959f9b7367f5a268c52e5fc4b54fe0270735e0370a"),
-uint256S("11f52c5a708bb0f9a02ec62e5925496e2810b0b1969df606d8b0a4d0895f01b0"),
-uint256S("4e83251acdf73a340731893743de8c5d407d9e8a521e1327ca25483ea0d9b911"),
-uint256S("6312d97f35525b89385b6bbf9187e7dbec34a0a35c8714c46a83ca2c456f6af4"),
-uint256S("6312d97f35525b89385b6bbf9187e7dbec34a0a35c8714c46a83ca2c456f6af4"),
-uint256S("762492fd05145c0f75f77f712c3f8be4227931d271afa0d8b70bbbc81533e74c"),
-uint256S("762492fd05145c0f75f77f712c3f8be4227931d271afa0d8b70bbbc81533e74c"),
-uint256S("fcb8c30bb82581f10524860608984d3e4d10b3d079a910669f2b9804bd41782e"),
-uint256S("fcb8c30bb82581f10524860608984d3e4d10b3d079a910669f2b9804bd41782e"),
-uint256S("4d06b8e7707677734ade11f847fd02486b8ed70a14572ca77148f8e67b26ace5"),
-uint256S("4d06b8e7707677734ade11f847fd02486b8ed70a14572ca77148f8e67b26ace5"),
-uint256S("e2cec60c12296e2b3789a9c4b8ac6bd76cda2fe7f1a50c2629b2483e3c930c55"),
-uint256S("9474c3a8772f5bff15247c36222ab7e015ad20bec691fe3dfbeace801d899dee"),
-uint256S("88920814e48038e53fb5ffb2f90c15522ca885f51acfd5b8f318743597b52e1b"),
-uint256S("e847b37d41428340c8ba50ef32ad110c9e7440f4358d975a8d39d17dd5c6c55f"),
-uint256S("e847b37d41428340c8ba50ef32ad110c9e7440f4358d975a8d39d17dd5c6c55f"),
-uint256S("3213cbb2fed34bf501c4df3a6fc7f3b8d24f0838dfb24cbc7d9e9c95fdb32710"),
-uint256S("27c28dc446b876f06eaa1e2507bb960b9ce93d6c5e41a448be2ca858bd60c6c2"),
-uint256S("abbf36b64fa4e92e460ec9307e8dd708ed3cc6d22a36749f565baaac222245c5"),
-uint256S("abbf36b64fa4e92e460ec9307e8dd708ed3cc6d22a36749f565baaac222245c5"),
-uint256S("b4fe1e1287d0242ecd3bda6ebaad951515fc8517de370f69f9ab80935e391db3"),
-uint256S("b4fe1e1287d0242ecd3bda6ebaad951515fc8517de370f69f9ab80935e391db3"),
-uint256S("365cb887058c941d684790432195b7e5cf2cd9f4c249b9c13a5a8652ee90c51d"),
-uint256S("7dc4f05873d9ef65ac664ad7144b3de96b442ec9f53ffe57826af9736c10e180"),
-uint256S("7dc4f05873d9ef65ac664ad7144b3de96b442ec9f53ffe57826af9736c10e180"),
-uint256S("31f2f19626b7c8c1fa40ede69dafa87943bb5cfeca840861b749f1956710b0e5"),
-uint256S("24c3df2e920833bd3a1abea490a9903560d44cf8b522f8d41568feaeec56a243"),
-uint256S("24c3df2e920833bd3a1abea490a9903560d44cf8b522f8d41568feaeec56a243"),
-uint256S("7c08de878eca5e09b23aa784c8a478770dd55c266c86cd106e7efc7c39be4f39"),
-uint256S("7c08de878eca5e09b23aa784c8a478770dd55c266c86cd106e7efc7c39be4f39"),
-uint256S("c79a2a921bd7aef4c4ee9446470a9c57cbb0113c7b202b4b1f113dc95ac08d55"),
-uint256S("c79a2a921bd7aef4c4ee9446470a9c57cbb0113c7b202b4b1f113dc95ac08d55"),
-uint256S("495c467cb84299d082bcfcd8d419bbe3cd964526f9061d9531fbcfb39818f75a"),
-uint256S("495c467cb84299d082bcfcd8d419bbe3cd964526f9061d9531fbcfb39818f75a"),
-uint256S("e85208179116b084b3fea974b4a7f164a0122caa212cde1ae82c795939642547"),
-uint256S("e85208179116b084b3fea974b4a7f164a0122caa212cde1ae82c795939642547"),
-uint256S("e3e8284c1188042095954cf4f6ec853423f5ce4c5996bb98d9396c0e9aa74bb9"),
-uint256S("e3e8284c1188042095954cf4f6ec853423f5ce4c5996bb98d9396c0e9aa74bb9"),
-uint256S("5e9246b5e3f95195a7cad70e208675e54711f9589fb882d951e561609727bf50"),
-uint256S("5e9246b5e3f95195a7cad70e208675e54711f9589fb882d951e561609727bf50"),
-uint256S("d3bf2c5ea2cb9db1b5dc24c2b4eefb425e270d473276bb6e8e58bfe576c2397f"),
-uint256S("d3bf2c5ea2cb9db1b5dc24c2b4eefb425e270d473276bb6e8e58bfe576c2397f"),
-uint256S("2fb6918812fe5ee094c25c7a459d562ca094f74f6756f9748fff3aa37fc3fb9e"),
-uint256S("06d712a35e1794f14b579ba2942eb69638387f23dbd22da44e9a3e038a4b5713"),
-uint256S("06d712a35e1794f14b579ba2942eb69638387f23dbd22da44e9a3e038a4b5713"),
-uint256S("8fe6926b7c6be8fb218c7d6dba47d109dc329cc95e10b5294cbe80c49932a965"),
-uint256S("c2b6c4f6171f78ab47b41cf9d05aed079baad36cdc5b3bee8f3234c8400f359a"),
-uint256S("c2b6c4f6171f78ab47b41cf9d05aed079baad36cdc5b3bee8f3234c8400f359a"),
-uint256S("23da191f7b489e788794b4f0b347ec7268d31fefa4795960ccb9d71455dfab81"),
-uint256S("45ea0960dd62449381e20b4d319354f34702433f5fbf5012df6e7506dc9c43d1"),
-uint256S("45ea0960dd62449381e20b4d319354f34702433f5fbf5012df6e7506dc9c43d1"),
-uint256S("00548601fde44901255fbab695bdc38c66f99296970a416ab719aae28ba797d9"),
-uint256S("faa34da3759411dae9a6204e173386b6e5bb7f94036efdab2166d0fb9496881c"),
-uint256S("faa34da3759411dae9a6204e173386b6e5bb7f94036efdab2166d0fb9496881c"),
-uint256S("ca7ce14a0b81290042531b7c032fd9f8089eb2b7087b686b317002dd8bbe8897"),
-uint256S("ca7ce14a0b81290042531b7c032fd9f8089eb2b7087b686b317002dd8bbe8897"),
-uint256S("d8fd80403353d74be6b70fabd8250af3e50608aa721bc25ac0ec70da68d173f4"),
-uint256S("d8fd80403353d74be6b70fabd8250af3e50608aa721bc25ac0ec70da68d173f4"),
-uint256S("cbf89e057c502578de3b8f83c0da5dbefae6427004dff9559a2a2e32bdb60aa0"),
-uint256S("cbf89e057c502578de3b8f83c0da5dbefae6427004dff9559a2a2e32bdb60aa0"),
-uint256S("b15362fa5a2be9f4e4b6bf25916a67b3794939e3945f19a0379210139cfe97cd"),
-uint256S("b15362fa5a2be9f4e4b6bf25916a67b3794939e3945f19a0379210139cfe97cd"),
-uint256S("033b325ae49576ba4ad9458d1f4e2b5388086c5d4ee9c8a6be244baa6023b42d"),
-uint256S("033b325ae49576ba4ad9458d1f4e2b5388086c5d4ee9c8a6be244baa6023b42d"),
-uint256S("caeff231d079766aae72f201e4331302151020a027aa410254f243a3ccdf4efb"),
-uint256S("e89247485988bb302570652a1e4cf3a1958ffa077d43486c2dbe2ea1cf65bf7c"),
-uint256S("804717c61d3daa6fb370e583707acf3e3640d259919ede4dde002f3cbe3bce8f"),
-uint256S("804717c61d3daa6fb370e583707acf3e3640d259919ede4dde002f3cbe3bce8f"),
-uint256S("4d5024c029f3960cc20e5f558fe136ef08c870f633147761d01ad6888aff89cd"),
-uint256S("4d5024c029f3960cc20e5f558fe136ef08c870f633147761d01ad6888aff89cd"),
-uint256S("972002ea7797057c5831ed7a2cb82aae213bcc5641339c58e8556ff928414a82"),
-uint256S("972002ea7797057c5831ed7a2cb82aae213bcc5641339c58e8556ff928414a82"),
-uint256S("ebb0b2d72619fc2d257fa52b78e65b211dd2d6ce76d32b9b324426df2e1c5ecf"),
-uint256S("8b3239dd0e0ac12abee0f0ba900be01331d51fe4a6e8b1fbc8cd609916be6993"),
-uint256S("53f3b8f80e0530558f4428e4386403290d0f04e137c404d60f68d06f77978e5d"),
-uint256S("53f3b8f80e0530558f4428e4386403290d0f04e137c404d60f68d06f77978e5d"),
-uint256S("71d1a6ab16d8f79c2abbebdb733e01dd04a37e7137017bf4b5b640ab01e394bf"),
-uint256S("71d1a6ab16d8f79c2abbebdb733e01dd04a37e7137017bf4b5b640ab01e394bf"),
-uint256S("c4a567dae1f293b6f7c00144ec9e8eed0fd3722356503ee533a775fb0dd35388"),
-uint256S("c4a567dae1f293b6f7c00144ec9e8eed0fd3722356503ee533a775fb0dd35388"),
-uint256S("2a207c489d4e6ffb142f3bca0f0db64ef4e8c21df9d8ff6db9073ea31f3b3ffb"),
-uint256S("2a207c489d4e6ffb142f3bca0f0db64ef4e8c21df9d8ff6db9073ea31f3b3ffb"),
-uint256S("538cc5eda0d02d33cb9199e981cd2ec2668aacc4904ffe317e6463b93d82c435"),
-uint256S("538cc5eda0d02d33cb9199e981cd2ec2668aacc4904ffe317e6463b93d82c435"),
-uint256S("a7bd65385cb425461f3e92ea698a982cfc752bff03281ac5a46b2c26df4b86c8"),
-uint256S("a7bd65385cb425461f3e92ea698a982cfc752bff03281ac5a46b2c26df4b86c8"),
-uint256S("c8090ae20f48fe2f57d08df2cb747722161507c18e38651a8085c32f5fa52cdd"),
-uint256S("c8090ae20f48fe2f57d08df2cb747722161507c18e38651a8085c32f5fa52cdd"),
-uint256S("fe7332fe5f0046cc2e46df0cab2fb40ec0506802d976489eea058a86bc33dfac"),
-uint256S("fe7332fe5f0046cc2e46df0cab2fb40ec0506802d976489eea058a86bc33dfac"),
-uint256S("0fe9889f8f61a7f85b1b9e69874268e0fa9619461793beeecbb0ed76c93e2c9b"),
-uint256S("0fe9889f8f61a7f85b1b9e69874268e0fa9619461793beeecbb0ed76c93e2c9b"),
-uint256S("ca156eee5b17adeb2619f7ec522746549effc647223e8fda902001f01a2dbb32"),
-uint256S("eb00929fdbf0d4cd45a8b2ee8caf1256b0603168e3b20fa29c7ebc39c0a23772"),
-uint256S("eb00929fdbf0d4cd45a8b2ee8caf1256b0603168e3b20fa29c7ebc39c0a23772"),
-uint256S("106cbb393c9192380fbe4f5199c685b5de07abe8b4f6f764f84b0fa3887a0325"),
-uint256S("106cbb393c9192380fbe4f5199c685b5de07abe8b4f6f764f84b0fa3887a0325"),
-uint256S("4db197d7e7f160e7c01a0117ab9d2c4f6a05c61e0db77f47406f15cd2b6504bc"),
-uint256S("2a692aa697be8ac1db85edc06778bea0ec983b3b950e9b57069f100c7160dd4a"),
-uint256S("2a692aa697be8ac1db85edc06778bea0ec983b3b950e9b57069f100c7160dd4a"),
-uint256S("f1de8ed83127b15a4de7e51cd60a39f3bec9f0340b20727a0de6a58f1dddf080"),
-uint256S("f1de8ed83127b15a4de7e51cd60a39f3bec9f0340b20727a0de6a58f1dddf080"),
-uint256S("094d748fefe97aca469f964ecf53419293cc5ee14ed938d1d2cc0e3f04ad5008"),
-uint256S("974a818b0e8f191fe0c1da314e53b6f4c8402bdc6a08d92ad3424a5363008741"),
-uint256S("974a818b0e8f191fe0c1da314e53b6f4c8402bdc6a08d92ad3424a5363008741"),
-uint256S("39cdd5283e348ebe5899f2bafa5dfe2e0529e9c9555b22f80c8a7ced7bd33e66"),
-uint256S("18d37633a8a68c0fa34653f527b4966c24a4b1be923cd7b61f6d50f7be2e8fca"),
-uint256S("18d37633a8a68c0fa34653f527b4966c24a4b1be923cd7b61f6d50f7be2e8fca"),
-uint256S("cfcac6db00bfe273971c230ec9243b0efaac96910bb11f568edd15b755ef7036"),
-uint256S("cfcac6db00bfe273971c230ec9243b0efaac96910bb11f568edd15b755ef7036"),
-uint256S("e5022890f5b5ecebd3722699843c45a2f08d624390c548c2f8659663ab17399e"),
-uint256S("e5022890f5b5ecebd3722699843c45a2f08d624390c548c2f8659663ab17399e"),
-uint256S("7c59b554e1ef5f501dada7dbf464a784e73cce9e8189c0040ae7eebff10e57a4"),
-uint256S("7c59b554e1ef5f501dada7dbf464a784e73cce9e8189c0040ae7eebff10e57a4"),
-uint256S("c23f05a239c2fb028add2094e7a7fba56895093941140d1afb9c763bbf3f9d8c"),
-uint256S("c23f05a239c2fb028add2094e7a7fba56895093941140d1afb9c763bbf3f9d8c"),
-uint256S("b20780731457c01345b201f2b800493a0783b816dbffd141a6fa628e40adc783"),
-uint256S("5f1471871565b086e6f43877541846e2c648d8550dd954e2a75d70561d740686"),
-uint256S("5f1471871565b086e6f43877541846e2c648d8550dd954e2a75d70561d740686"),
-uint256S("4980967d1088ecced8cdb0f1be469e1fcff430b62e6de09675aa11d2b34f1e28"),
-uint256S("4980967d1088ecced8cdb0f1be469e1fcff430b62e6de09675aa11d2b34f1e28"),
-uint256S("b716334d46162d14ed687142d1cdb6d5fa9a05e2a2f5cce78c912004c65cd110"),
-uint256S("2ab6d96d8f79767aa823488531b36f160e982f81e539df368ae31ef6fd20c5a2"),
-uint256S("2ab6d96d8f79767aa823488531b36f160e982f81e539df368ae31ef6fd20c5a2"),
-uint256S("a0e72c7c790a193074b797d5a84db291dc5922ad72ad0aaa06d3e03ee28be0ee"),
-uint256S("a0e72c7c790a193074b797d5a84db291dc5922ad72ad0aaa06d3e03ee28be0ee"),
-uint256S("050015eabf0af32a84f12e32c094eda25a81df122ca46ea38ce348f47a049ef7"),
-uint256S("050015eabf0af32a84f12e32c094eda25a81df122ca46ea38ce348f47a049ef7"),
-uint256S("e0dc4bef58f4b5c87383b90730bf2f487ce09767882a3d680f7bac103ad22e1c"),
-uint256S("e0dc4bef58f4b5c87383b90730bf2f487ce09767882a3d680f7bac103ad22e1c"),
-uint256S("2047a6b9353585d2f983e29e8baf65e5de34bf82ca8125fbf2782ff1593d9579"),
-uint256S("8e37dc36d9d37fba4653016168cde41bd3397542c0b11f93a3fbc71cd0e04ad8"),
-uint256S("8e37dc36d9d37fba4653016168cde41bd3397542c0b11f93a3fbc71cd0e04ad8"),
-uint256S("58b9831ce4fd0a9852001c35286832dc3f40c3a300bdbfb678b1b7c1d3a5d933"),
-uint256S("b47a8567d1dc496314c56b80c9331dc6e8f28247c846a11b0c1f4b5a26c487df"),
-uint256S("4a2640052fb5aca44144bdfaa84646cb9599bef013cce644eb1c279088acbab8"),
-uint256S("4a2640052fb5aca44144bdfaa84646cb9599bef013cce644eb1c279088acbab8"),
-uint256S("f0b79da81682b38adc4c6e38b8be91c189c906d0311c984ee40267cb1b89e561"),
-uint256S("c8fe952aee81054fac30664e1e748abcdcb14f45678ab260686066ba2166479d"),
-uint256S("c8fe952aee81054fac30664e1e748abcdcb14f45678ab260686066ba2166479d"),
-uint256S("0ea17be1996dfb69819d1c5b9dbd10420c5437a2d45e845cc725ded38a11c635"),
-uint256S("e61c7e20fd990664f8f844336b8e1073eb323a45913a07539fb33082ba151d1c"),
-uint256S("e61c7e20fd990664f8f844336b8e1073eb323a45913a07539fb33082ba151d1c"),
-uint256S("800939dc644b12c88da2806fe629a193eb0ebf5d368b72840a11f4dba5586b5b"),
-uint256S("4ea5738a973bb1086948d66e1978db0db539b2c27f5ec491736c8aac298c4a25"),
-uint256S("4ea5738a973bb1086948d66e1978db0db539b2c27f5ec491736c8aac298c4a25"),
-uint256S("24b759f7fcb69efb973bf5429cea54893d1b5b4adc6a3911c7d4dc14a49beaa3"),
-uint256S("6b3be0538d20a7f4cc320d84537913007ca734041e888c73e6a2cd72137f3501"),
-uint256S("6b3be0538d20a7f4cc320d84537913007ca734041e888c73e6a2cd72137f3501"),
-uint256S("bc5b47e7aa4b145f993e5a4626530a8aba0d0a9cd0c9c7a01ed9c00c472ad110"),
-uint256S("bc5b47e7aa4b145f993e5a4626530a8aba0d0a9cd0c9c7a01ed9c00c472ad110"),
-uint256S("f9b27849a69a9efeda4a6ac068938e63a8ed61670f79831d8f7e6b70df546454"),
-uint256S("f9b27849a69a9efeda4a6ac068938e63a8ed61670f79831d8f7e6b70df546454"),
-uint256S("4619503be1597b9425b2837a91c85c94016de0fe46cbf699a696790d6bfb5af8"),
-uint256S("4619503be1597b9425b2837a91c85c94016de0fe46cbf699a696790d6bfb5af8"),
-uint256S("fd7c2f510e6d33761ba2fe13192320ee9083f0a54dd6919d2fad3c03e251a07d"),
-uint256S("71087f8d2183f90e9aaabb6a8f39d66393455e6d6c41bbe5c6c8074eb4ed138a"),
-uint256S("6c2635baafb3670f9af893d9e595b5f4754b3f0bed64722b29bebb35e8e5db2c"),
-uint256S("6c2635baafb3670f9af893d9e595b5f4754b3f0bed64722b29bebb35e8e5db2c"),
-uint256S("3aa469dda8bd4807173a3424219778d34c6ffcb509d4ce6ca0bf7cf6e7520ff8"),
-uint256S("a57e862fb42d1f00165437a503bdc3cc34e2fbe9262114ba5d56a79cda30f638"),
-uint256S("a57e862fb42d1f00165437a503bdc3cc34e2fbe9262114ba5d56a79cda30f638"),
-uint256S("5c8e1cf56cd3bfe762f09e411b039ee190b6869d84062c42ff0382d0c8fa6ad8"),
-uint256S("5c8e1cf56cd3bfe762f09e411b039ee190b6869d84062c42ff0382d0c8fa6ad8"),
-uint256S("701ed0e8853ed8dad9b0d8a82285ee48068e9f3a834177db601bcc7a15107cdf"),
-uint256S("e31aa108d2238432973071b76186fc93bd7e12e55abc3619482258f5ec6cabf6"),
-uint256S("e31aa108d2238432973071b76186fc93bd7e12e55abc3619482258f5ec6cabf6"),
-uint256S("3c82fe4000d4a84a269f48ec236b1a03fe66e2b8edaea24f92f7d2a36f3a982b"),
-uint256S("3c82fe4000d4a84a269f48ec236b1a03fe66e2b8edaea24f92f7d2a36f3a982b"),
-uint256S("7394de43712120be3d6330af3b699a7c79540b122e7818b244d3cbdec2f1e947"),
-uint256S("7394de43712120be3d6330af3b699a7c79540b122e7818b244d3cbdec2f1e947"),
-uint256S("da6980c0ffcc88ff238d5d86e42225ea0f3e2f9996533495b20fe4e42a7d4929"),
-uint256S("da6980c0ffcc88ff238d5d86e42225ea0f3e2f9996533495b20fe4e42a7d4929"),
-uint256S("ceb88b36b10113e603ff936a098bdcb204b328ad3e0f894e144562d69538ea36"),
-uint256S("8966b27ef6055ffe00184140cb9a1129f056d995901ad685f556ac95d908cbdb"),
-uint256S("5a49bc13343b7783272dd688dfb406fd9401ae339ff9e207aec4e848456d2609"),
-uint256S("5a49bc13343b7783272dd688dfb406fd9401ae339ff9e207aec4e848456d2609"),
-uint256S("9586ea3200cc2b93c982777cb67f898cb83ddbc7c06fd262ef96f14f92689c58"),
-uint256S("77f11f5be1e33b49bf0d3de7b7ab99ad4f2c2ad0a1b053cf14a7396c4325fb43"),
-uint256S("77f11f5be1e33b49bf0d3de7b7ab99ad4f2c2ad0a1b053cf14a7396c4325fb43"),
-uint256S("d4e5e515d745824ec2e5dd9bed40cdb8844d6bc6bc96f626213a3ceb67a76e00"),
-uint256S("d4e5e515d745824ec2e5dd9bed40cdb8844d6bc6bc96f626213a3ceb67a76e00"),
-uint256S("752c31d7224a060ae86f47e5c61f61ab3696f070c4ed02ea1765cc06e5cf2985"),
-uint256S("f2257bececf0597c7e75b1437971c9e25e103cf2342ecbd43c8321ad4a694eb3"),
-uint256S("465cced976184ee3ce4a761ceee3ba4adce08028b96b540747271bc75d81acc4"),
-uint256S("465cced976184ee3ce4a761ceee3ba4adce08028b96b540747271bc75d81acc4"),
-uint256S("8b963ca2391862527ddf320e4bb7e4279ad731133f583e771299851bbf5124cf"),
-uint256S("8b963ca2391862527ddf320e4bb7e4279ad731133f583e771299851bbf5124cf"),
-uint256S("512fa9e5fca7a20c2b483fe63432be5570d6847e850f8f6d131bdcfc93fe2626"),
-uint256S("c2bded3cfcec43a397f3ad6902dd43239f8854ccab97785e2f3ae0836ac1adba"),
-uint256S("c2bded3cfcec43a397f3ad6902dd43239f8854ccab97785e2f3ae0836ac1adba"),
-uint256S("220ced5665280c2d53e16c65ec2f9d54ef8caaea7de3724fcef91998ceabc784"),
-uint256S("2c345aa80f50239aefa45a0e5b4d865ed0d2c890c928fa402412d899a6347119"),
-uint256S("e40e5be5285a9ce9a330dece3abbdbe407545a34e8e39ef24879580d6a391f03"),
-uint256S("b1b08b47cfb48b41a5468d165f3bd9786b9c9411257be9b2dd3307b0e8cccec7"),
-uint256S("b1b08b47cfb48b41a5468d165f3bd9786b9c9411257be9b2dd3307b0e8cccec7"),
-uint256S("e0476f0382ec0a709493843ac509cfe62b557b3f2ec043ec3ab3b2991beaefae"),
-uint256S("e0476f0382ec0a709493843ac509cfe62b557b3f2ec043ec3ab3b2991beaefae"),
-uint256S("e68589a565dd6069a2444b8834be5d3ced4835dfd129541b10c58d51dbd39985"),
-uint256S("c24c00b466b9d73443efa0a049d372bcf9c8e51aa7e4ce54194babd2c2ee0ffa"),
-uint256S("c24c00b466b9d73443efa0a049d372bcf9c8e51aa7e4ce54194babd2c2ee0ffa"),
-uint256S("1584039d062ad3b154dc6951b7c8e834bc2a700565ed9ab0ab6b9a356e12a0cc"),
-uint256S("1584039d062ad3b154dc6951b7c8e834bc2a700565ed9ab0ab6b9a356e12a0cc"),
-uint256S("ec0e758bdcb1ae68462c29fdf2d4f20c8e09d0904927264e72e2e7287b6d271b"),
-uint256S("19c727e1195d61f246cbbd156cea3d2977388c6cad31388f3c51c4c728f7466d"),
-uint256S("f7d0e158d1c48df2d4ee8f5576ca2f7cc5b63b96880889dcb6ad51e1f862a006"),
-uint256S("f7d0e158d1c48df2d4ee8f5576ca2f7cc5b63b96880889dcb6ad51e1f862a006"),
-uint256S("48140d80191278f2aa742f2156f72d548ef41eaacff66d56766b2368b5df0930"),
-uint256S("48140d80191278f2aa742f2156f72d548ef41eaacff66d56766b2368b5df0930"),
-uint256S("595bb62ffda0ba12148e306aa6a41edb7c49fa9a1d60a65f3e30ad4b1959af99"),
-uint256S("595bb62ffda0ba12148e306aa6a41edb7c49fa9a1d60a65f3e30ad4b1959af99"),
-uint256S("33bc8cf6d4c3eff7962aec5452c769375dcf7f0e6b5f13a6e7f221b50d9fa4bb"),
-uint256S("dfed688a8e9ffd7c08cc4a7c39d5cc6114ba9faa4fde6ab6aea92dc93aa18eee"),
-uint256S("dfed688a8e9ffd7c08cc4a7c39d5cc6114ba9faa4fde6ab6aea92dc93aa18eee"),
-uint256S("514ba2a189fd23dd132eaf32c7fa4f4b3b56f9b16f27eddf833b45762bbcf5f0"),
-uint256S("7b1d2a9a744ec082cf0a479282a76551103079d2f31b5b36e75bbc45dce7a998"),
-uint256S("7b1d2a9a744ec082cf0a479282a76551103079d2f31b5b36e75bbc45dce7a998"),
-uint256S("e72a6b24b3d64135592a2a1c24ffdb94018730d32e3e1d08fb9839df441bc4f7"),
-uint256S("e72a6b24b3d64135592a2a1c24ffdb94018730d32e3e1d08fb9839df441bc4f7"),
-uint256S("42e6cb85edf0cd1115102c7cefbda29de1ec55e13b7c6c4bfe5282a622c2a2d4"),
-uint256S("42e6cb85edf0cd1115102c7cefbda29de1ec55e13b7c6c4bfe5282a622c2a2d4"),
-uint256S("9a5d4049bf5949175f9bc167c0a4985aca1069fcb9ae59940e78035724707fc1"),
-uint256S("9a5d4049bf5949175f9bc167c0a4985aca1069fcb9ae59940e78035724707fc1"),
-uint256S("10a120a1810d2bf637d5338c9f53cc85f858f3262b5ae94d01667f5fe6a9319d"),
-uint256S("bbc70a7bc43142a44ba3650553f3f7472b43424a03067015fb4bca6644ccf6bb"),
-uint256S("bbc70a7bc43142a44ba3650553f3f7472b43424a03067015fb4bca6644ccf6bb"),
-uint256S("8cc0312e75c547ace14a5b57f868744728e1e80ee828e2b829b1a787f4bcc5c5"),
-uint256S("c7e6cabe9a9130bee2f521e1cb288068d74524b2eb7f6dcbe45e564c4b537d27"),
-uint256S("c7e6cabe9a9130bee2f521e1cb288068d74524b2eb7f6dcbe45e564c4b537d27"),
-uint256S("a268819b63cfa1c0d4a283462521f73003227bf35ab155e03a87af4b507a14a1"),
-uint256S("a268819b63cfa1c0d4a283462521f73003227bf35ab155e03a87af4b507a14a1"),
-uint256S("04ec410ba5285c4a320adc4f12b28d6facf6c2747f6542ecf7e58c855433ab00"),
-uint256S("04ec410ba5285c4a320adc4f12b28d6facf6c2747f6542ecf7e58c855433ab00"),
-uint256S("5f9ec426af2d88940e238cc6b0b65f82f1f71baa3f4ffd2ca2a792d2c80bfb2e"),
-uint256S("5f9ec426af2d88940e238cc6b0b65f82f1f71baa3f4ffd2ca2a792d2c80bfb2e"),
-uint256S("9931e0254af3db5754d1e08d6fcf4c3820d0947ec3672ffa830b093978c2db1e"),
-uint256S("dbee1566f0efe5a13bd30fe0f641b18cbd8e2a538cfd3a56d40cb1f4d698e262"),
-uint256S("dbee1566f0efe5a13bd30fe0f641b18cbd8e2a538cfd3a56d40cb1f4d698e262"),
-uint256S("5c1cdd9af7bf2c6c561bda9a04b6638a78930331e9782a067017ea3f36a8872f"),
-uint256S("5c1cdd9af7bf2c6c561bda9a04b6638a78930331e9782a067017ea3f36a8872f"),
-uint256S("d0a31ece766760679869ef344747901716b6325566f2504e160e00b55f6e13e0"),
-uint256S("60af4d789a2bdb18771f7576c77be27753e30cef60c020d0e1425c2b3332faeb"),
-uint256S("60af4d789a2bdb18771f7576c77be27753e30cef60c020d0e1425c2b3332faeb"),
-uint256S("833841e5e53428d23da400ed66855c242a80c139fa81a84986bbcb10f4d90eee"),
-uint256S("a44c1e6c9a3c04a3dbf168bd70b703d62c1ccd33a77065503c3ecba7b7b85f19"),
-uint256S("d3e4a4678b2084b6771173cd48f347bee11422b97f3f56504e38224163168b2c"),
-uint256S("d3e4a4678b2084b6771173cd48f347bee11422b97f3f56504e38224163168b2c"),
-uint256S("f023ff5d0ad206a1c422784c3321867f2c824cdbd09caebf5530d8511a8a56d5"),
-uint256S("e17a08f1eb0ba23a73cfbca1b48a3ec658578bc83aeb05e6126c88e6dc29aba7"),
-uint256S("e17a08f1eb0ba23a73cfbca1b48a3ec658578bc83aeb05e6126c88e6dc29aba7"),
-uint256S("9841f5b9abf575aec566f2e130bbf9a2277caedce9a414659df9dddd534f9914"),
-uint256S("9841f5b9abf575aec566f2e130bbf9a2277caedce9a414659df9dddd534f9914"),
-uint256S("7708cc2557438fdc18f7c32521d6b5ca6f297056c46b5de3d19e2a0fc954c819"),
-uint256S("397c55ba0f318089dc877c36eee8eec00276d64e672080d4e37cefb41421b3eb"),
-uint256S("397c55ba0f318089dc877c36eee8eec00276d64e672080d4e37cefb41421b3eb"),
-uint256S("cb7bd0cad8f3cef2fbd3821a0c15646b4e95284b28d3491899496d8e620e34fa"),
-uint256S("cb7bd0cad8f3cef2fbd3821a0c15646b4e95284b28d3491899496d8e620e34fa"),
-uint256S("6dcb7cd25f7c5943b2838c291ebc703e619c5a2755dfe1ebdee8341f00b5057b"),
-uint256S("6dcb7cd25f7c5943b2838c291ebc703e619c5a2755dfe1ebdee8341f00b5057b"),
-uint256S("6fe7351c0ced88d0c4d06dfc5af1a2a8bcf11f444cc36b1c9aac0698966f6994"),
-uint256S("6fe7351c0ced88d0c4d06dfc5af1a2a8bcf11f444cc36b1c9aac0698966f6994"),
-uint256S("8dc7ba494d4f101194971f8f9a879cb273c752334ff668f03142c02658d5a1a0"),
-uint256S("8dc7ba494d4f101194971f8f9a879cb273c752334ff668f03142c02658d5a1a0"),
-uint256S("291cd882090eb2fe9c40e7640b3ef2ff3de484abb84f951949343703df3ce7ee"),
-uint256S("291cd882090eb2fe9c40e7640b3ef2ff3de484abb84f951949343703df3ce7ee"),
-uint256S("1df0e2e0149ca304cab194a9f9f63326067784d0f05aa683d99b747257b1b2d4"),
-uint256S("1df0e2e0149ca304cab194a9f9f63326067784d0f05aa683d99b747257b1b2d4"),
-uint256S("56169a1786953e201dee780bc5675b2d1c042ac63070bebeeb1cb6f7e8caf446"),
-uint256S("a82a30a08f143e2ad948fde7bf1e6637ea5fd20036d4b57d8a50ee7b6e1873f6"),
-uint256S("a82a30a08f143e2ad948fde7bf1e6637ea5fd20036d4b57d8a50ee7b6e1873f6"),
-uint256S("0f42ef8bda7253c417400418c1b4f7f65c29df5edc408f64364b2953634f1500"),
-uint256S("0f42ef8bda7253c417400418c1b4f7f65c29df5edc408f64364b2953634f1500"),
-uint256S("0159425a6edc338949525309ce6f093f7ef91665759a1fb3ce77e5ac11f5ce6d"),
-uint256S("0159425a6edc338949525309ce6f093f7ef91665759a1fb3ce77e5ac11f5ce6d"),
-uint256S("53a50dd5cc6d36097c1ea027bd71c2748adcb28d6a6a30f27161a3eb9f66bf87"),
-uint256S("800a1c2a5988246a568efe3a256a434b3f9a1f9115a8a39d754ca79ae4622061"),
-uint256S("800a1c2a5988246a568efe3a256a434b3f9a1f9115a8a39d754ca79ae4622061"),
-uint256S("3e9ebee5f9cc4202a91342bea1be6eb0d5ea2d68ad90f8cc050ca6496d277f37"),
-uint256S("3e9ebee5f9cc4202a91342bea1be6eb0d5ea2d68ad90f8cc050ca6496d277f37"),
-uint256S("870f0c700f3b5f892084000be67c31177e5f113e94d36fcb22227ca527175d76"),
-uint256S("97ec7e1fcb376cb896343cccdb6ea97513c1393106fbb364e99f21d46c74d4e0"),
-uint256S("97ec7e1fcb376cb896343cccdb6ea97513c1393106fbb364e99f21d46c74d4e0"),
-uint256S("02225a177693ac2ce9b76fc8f7e4868b9b1cdd3fb3df6b2fb409e2e97f97099a"),
-uint256S("02225a177693ac2ce9b76fc8f7e4868b9b1cdd3fb3df6b2fb409e2e97f97099a"),
-uint256S("3281bcf9c9b919766f7dfbf3565273d4c5f66cd82af071eeb98d43587bff8818"),
-uint256S("67a514a0e53e6e034ceeca6519b17a30f46bc7c6e21f181b6c4a5243a2c21228"),
-uint256S("67a514a0e53e6e034ceeca6519b17a30f46bc7c6e21f181b6c4a5243a2c21228"),
-uint256S("2f3ca9042969168e5f6144127bd3fedaf606f324dbc09c99f074fbc66992adfb"),
-uint256S("2f3ca9042969168e5f6144127bd3fedaf606f324dbc09c99f074fbc66992adfb"),
-uint256S("1d802d386350ca99fc3d5b2add69b648abe891394beb9ccdb533de4227ca9276"),
-uint256S("1d802d386350ca99fc3d5b2add69b648abe891394beb9ccdb533de4227ca9276"),
-uint256S("db52fb8b748dd1f914941486d9238e078a525e57126fec2a31ed4330fcc59a41"),
-uint256S("db52fb8b748dd1f914941486d9238e078a525e57126fec2a31ed4330fcc59a41"),
-uint256S("651f2ec807bd870c4fe2e15d68e0dc779196cfde7d64411d6d900c6f9624c1df"),
-uint256S("8be307f916a838004d86ff7a56698e524d774f7bc128c97e7dbb20b6fc1e0ef6"),
-uint256S("8be307f916a838004d86ff7a56698e524d774f7bc128c97e7dbb20b6fc1e0ef6"),
-uint256S("b1f32df205ed10a70cea9ea710b5a0a8dbb26dcf853f826f2a8c955e49a87c7b"),
-uint256S("b1f32df205ed10a70cea9ea710b5a0a8dbb26dcf853f826f2a8c955e49a87c7b"),
-uint256S("c429fa8b870a00185c194676a9913f440faa3b6a6032c7f527e0581164fa7623"),
-uint256S("7115fc84a0eeac279a36563c36642d2b504ae56aff3d7897e1a24e1a644f839e"),
-uint256S("7115fc84a0eeac279a36563c36642d2b504ae56aff3d7897e1a24e1a644f839e"),
-uint256S("a9ec28f3b83254c012b447bf4bd81040e5821f6f7ed02f59eb0097f2a8e636d5"),
-uint256S("c5a6e251651bd86c68cc86af1fe8faafda5ad8f2289ca887328f52a29ee94a44"),
-uint256S("c98d49e50a31227fd5b28d4409f79d8c900297e2592dbcf9c0d02197bc905f8c"),
-uint256S("c98d49e50a31227fd5b28d4409f79d8c900297e2592dbcf9c0d02197bc905f8c"),
-uint256S("ab0640f11791b746b37779501a5d53fc3ef1bdc506d6e1cf118d894f5d93670c"),
-uint256S("ab0640f11791b746b37779501a5d53fc3ef1bdc506d6e1cf118d894f5d93670c"),
-uint256S("adbe4ba8f9d3262f8b633486bbf8f10ad9ddc58386b978c5bca3d9b49d9fc81f"),
-uint256S("309ec21c1af08b52dfc846ba3a601c67d877cef3731be0bb836c3b265ddaffa9"),
-uint256S("2f971ba4d34cb2aebfeeca3c5b9dbc170aecaabafc75cb2777e0055ce614b876"),
-uint256S("bfdb2f48ba58bb2d0e88db1f41c39b37d083d4e36b3e81d63f0e85c9ce495340"),
-uint256S("bfdb2f48ba58bb2d0e88db1f41c39b37d083d4e36b3e81d63f0e85c9ce495340"),
-uint256S("73145833e7190e4fe856c381aa3cbce8b51ed5b47867b05d0de396ed7bd30259"),
-uint256S("73145833e7190e4fe856c381aa3cbce8b51ed5b47867b05d0de396ed7bd30259"),
-uint256S("cfeac78976af263f249b15ead23fe83e6673bd386eeff12ca2fbe64f7eb545db"),
-uint256S("cfeac78976af263f249b15ead23fe83e6673bd386eeff12ca2fbe64f7eb545db"),
-uint256S("b366e491d185e966654c6177f1a15d33c4e9b918d520ff964ca8a1e20d7364b0"),
-uint256S("b366e491d185e966654c6177f1a15d33c4e9b918d520ff964ca8a1e20d7364b0"),
-uint256S("a2af0fddd50e13a3c7ed0797ecee9513d3cb410798a430a7ebad6cb5b8d71d4c"),
-uint256S("a2af0fddd50e13a3c7ed0797ecee9513d3cb410798a430a7ebad6cb5b8d71d4c"),
-uint256S("9b938c78fb3bdd9e7a34053d016cde9b7823e0ccc38c6791a3b01d15a1f370d2"),
-uint256S("9b938c78fb3bdd9e7a34053d016cde9b7823e0ccc38c6791a3b01d15a1f370d2"),
-uint256S("4f58bac5dcd63bd382b7fb8e5138d5a25b9013e1f7bfe51cce345d7976ed7eb8"),
-uint256S("4f58bac5dcd63bd382b7fb8e5138d5a25b9013e1f7bfe51cce345d7976ed7eb8"),
-uint256S("3c9eda8defced333c19b95ea4bb855242d1094a82a1f0fa336d4969b72448094"),
-uint256S("a6be80e34c86c5dc0ea53b9321512020fc38232cdb4fb7edfccfe94c1a4c8b73"),
-uint256S("a6be80e34c86c5dc0ea53b9321512020fc38232cdb4fb7edfccfe94c1a4c8b73"),
-uint256S("d7f65be17d2e568fc87f3819c83c7f31177a44fa0c59cdb3599436d16ab965bb"),
-uint256S("12382c1bd412dc0f299e156ae6d332eaca7966c5b4101e48a7405a01c377f754"),
-uint256S("12382c1bd412dc0f299e156ae6d332eaca7966c5b4101e48a7405a01c377f754"),
-uint256S("aef40fe614f4f251a3f908675de85715e6ec0954c7f604485bd0389715081735"),
-uint256S("e2a66e36540ae474803a3396ad796faf84fc8b9a7567286b50e6730b1b68ef05"),
-uint256S("e2a66e36540ae474803a3396ad796faf84fc8b9a7567286b50e6730b1b68ef05"),
-uint256S("ab60234eac7dc552b853c883d09eca591807a11280ed9f2b267400ed64c76d09"),
-uint256S("ab60234eac7dc552b853c883d09eca591807a11280ed9f2b267400ed64c76d09"),
-uint256S("02d01e6e72392e444b8f30ab47948625526071cd7b7f91632fb5c2a9d9a64a14"),
-uint256S("02d01e6e72392e444b8f30ab47948625526071cd7b7f91632fb5c2a9d9a64a14"),
-uint256S("3bf41b1381bed3416a27b3b274dc57820cb8a509cd53e0d7b39a1b953d17233e"),
-uint256S("87f602044349061e69ba1d4b114d4c72508253239da7318ae98cb1ab8860415f"),
-uint256S("87f602044349061e69ba1d4b114d4c72508253239da7318ae98cb1ab8860415f"),
-uint256S("ad217cc4bccd3c738bc382a12a9b93de26130d475212ea6ae722ea2ec9af2ee9"),
-uint256S("88470bb2fc07bb116cac1d06b5fae7d2cbaa9d300eea75a94d3e1e7d6f5f0193"),
-uint256S("88470bb2fc07bb116cac1d06b5fae7d2cbaa9d300eea75a94d3e1e7d6f5f0193"),
-uint256S("14c1b4488851750a18a130b3a7c38c09df87e90185eefe879c55257c74e90cf1"),
-uint256S("8876e1173aee8ae0f0dbd5d672e6ca566fdd52673a97310bb02b70e5c4d46d23"),
-uint256S("8876e1173aee8ae0f0dbd5d672e6ca566fdd52673a97310bb02b70e5c4d46d23"),
-uint256S("fb02bce3b91a812df5f077057babb8c9ebdf4f8fc0a2b385908e9a52874ba35a"),
-uint256S("3ed1532c438fe5166f89160f036c7b88bb7999bc90da28d5212775bb3bcfb413"),
-uint256S("3ed1532c438fe5166f89160f036c7b88bb7999bc90da28d5212775bb3bcfb413"),
-uint256S("4fddca6f73a6b798e6f5dd495e21e23d546840aa71cfe6d81a8c422c29e7290f"),
-uint256S("638bcc7580af55a7039b3a5a68ea5ae0fe8f8cbbe3aae445a30fe3ebcb1e9654"),
-uint256S("f206423a229b507f48d8d01425d50a93ab547dde4e7606a2c15a72f1a5978971"),
-uint256S("f206423a229b507f48d8d01425d50a93ab547dde4e7606a2c15a72f1a5978971"),
-uint256S("159bf34f26a1aeec2cfdbc7f329b079f061e3545e076b8b02a9f15e69e5a369e"),
-uint256S("d585572df9894e6872a65a40455ca07889776738246de9a9486562871556ae46"),
-uint256S("1091c68fa325245513524332ed2707924ffad318b719fbe13965eba600cc53f6"),
-uint256S("1091c68fa325245513524332ed2707924ffad318b719fbe13965eba600cc53f6"),
-uint256S("5a2ee5b4712d21c63e9dcfbfd58b0713026eb7e784b62c7a8e7b54700b121fed"),
-uint256S("965681e7f07358f2d196161e6860cbd829ee5966d34f3bbb46e9277d560fb989"),
-uint256S("965681e7f07358f2d196161e6860cbd829ee5966d34f3bbb46e9277d560fb989"),
-uint256S("963f433e6b7951db55713c725167dbd4216c5c6d01370b99754ceae9f4e18642"),
-uint256S("963f433e6b7951db55713c725167dbd4216c5c6d01370b99754ceae9f4e18642"),
-uint256S("3784a8888c9e26ef84747e421ff87c9a7364580715510d21711b1ab4cb09bef0"),
-uint256S("3784a8888c9e26ef84747e421ff87c9a7364580715510d21711b1ab4cb09bef0"),
-uint256S("62790ffd6700ce7a6a3e66fd99f1980f285fd9b001ca84c956bdf64cf06950ed"),
-uint256S("62790ffd6700ce7a6a3e66fd99f1980f285fd9b001ca84c956bdf64cf06950ed"),
-uint256S("51a232b53db8d941f358095e63b2e2f76a687e2680befd03826224d6a2cf5edf"),
-uint256S("51a232b53db8d941f358095e63b2e2f76a687e2680befd03826224d6a2cf5edf"),
-uint256S("1621d2ac5d56b6060be722b81e9e2483b2e608c4a35cc07259b7b7d13c461bbf"),
-uint256S("1621d2ac5d56b6060be722b81e9e2483b2e608c4a35cc07259b7b7d13c461bbf"),
-uint256S("6c4e512adb520351efded1e11afcf1f909053154904164bad5994f31398fb10c"),
-uint256S("6c4e512adb520351efded1e11afcf1f909053154904164bad5994f31398fb10c"),
-uint256S("ada8599525c94aa0c96a1bdb2a5890b75a6dcd7aa638a63bf82820a34f475d7c"),
-uint256S("ada8599525c94aa0c96a1bdb2a5890b75a6dcd7aa638a63bf82820a34f475d7c"),
-uint256S("4b044c2e6841a3648d82d8c563b21d278bc6e10ffa06841ebb1c8628c340db6a"),
-uint256S("fafb2476fbc9db2a0ede05f3f77a8d3711f042926fcc0489e0bd9e53487fc2a8"),
-uint256S("be6dab6cb11dd347c8a633cb877d1584a760eb3ab1696d97c8652d1587151ea4"),
-uint256S("be6dab6cb11dd347c8a633cb877d1584a760eb3ab1696d97c8652d1587151ea4"),
-uint256S("dd567fcc9ee8ab0e3923000210e94ba4311dfa8017903cc03619e98109184f2d"),
-uint256S("dd567fcc9ee8ab0e3923000210e94ba4311dfa8017903cc03619e98109184f2d"),
-uint256S("5a822f6fb7203594545d0238326970f3a156fa6e36d25b3b88639d66cc55aa34"),
-uint256S("88bcff969bd48c3d68a9e2fb8ef61d200eb21a3d06aeabde7949ea0aca057a70"),
-uint256S("88bcff969bd48c3d68a9e2fb8ef61d200eb21a3d06aeabde7949ea0aca057a70"),
-uint256S("51db01d7676dd893b4d8cfdc681328ccebfa0a8096f910989c24e63bbfa7a92c"),
-uint256S("51db01d7676dd893b4d8cfdc681328ccebfa0a8096f910989c24e63bbfa7a92c"),
-uint256S("bb48be9932de24498f138e9affafaf373a35f3b24e643f892cfd3d20d57c7843"),
-uint256S("bb48be9932de24498f138e9affafaf373a35f3b24e643f892cfd3d20d57c7843"),
-uint256S("72938df2954b550e74d980b4265f3b0eee84c677f6fb7c9ee3896d66ea7c7247"),
-uint256S("72938df2954b550e74d980b4265f3b0eee84c677f6fb7c9ee3896d66ea7c7247"),
-uint256S("468d67e1db6045b7c28040a205295119c16ad4f184ba4ebf12e23ee9bdb934ef"),
-uint256S("b552bdfbb79852657752014d192f93456fa022cdc2fcdda10dae74be484cad8c"),
-uint256S("63a8f4f301f6933eb753fa94dbc2046b3baab072dd87369df02625d935abf8c3"),
-uint256S("63a8f4f301f6933eb753fa94dbc2046b3baab072dd87369df02625d935abf8c3"),
-uint256S("2d5d7302f73efc3e1e4d33d04db235dd159a47982c94eb5206b30d45da4bb1cd"),
-uint256S("9323674c5c7e3f1fc2957d14742ae6438c0dbc018a8668449d56a7bc6b300850"),
-uint256S("9323674c5c7e3f1fc2957d14742ae6438c0dbc018a8668449d56a7bc6b300850"),
-uint256S("923025c56ba79c7a5a86de3db54c945b26c3ae7d48c53d694583c1eef05937c2"),
-uint256S("2f6bc2eb0f52503af6efb22b21de43f2c3efceaa3a8e95628e921b6e0370abc5"),
-uint256S("aab1d0e40935c901c20d3441c7265083425f4d2f0ad5d7874c0f4d06e07d38d7"),
-uint256S("aab1d0e40935c901c20d3441c7265083425f4d2f0ad5d7874c0f4d06e07d38d7"),
-uint256S("aae1d3d9742efb19430e7270f3e39adc361de288f9ef010826cdea74e7884f9d"),
-uint256S("aae1d3d9742efb19430e7270f3e39adc361de288f9ef010826cdea74e7884f9d"),
-uint256S("5a488ce835ff5c8956d3d2a119df4542cb78cf6d8a2b33079452e51e1949b8fc"),
-uint256S("1524409e76569cccf98cee79e37129325ef17c3167974069f84cbf29fb77efb2"),
-uint256S("1524409e76569cccf98cee79e37129325ef17c3167974069f84cbf29fb77efb2"),
-uint256S("4554e26d20bce1500e1c0ea5e7bbb3221c51967a4ff04e4a6af20abaa5b4a821"),
-uint256S("4554e26d20bce1500e1c0ea5e7bbb3221c51967a4ff04e4a6af20abaa5b4a821"),
-uint256S("717a68633bb15c6baf9a6f21ad24afd795f72f7d91450b8f444ba9fadca76a41"),
-uint256S("717a68633bb15c6baf9a6f21ad24afd795f72f7d91450b8f444ba9fadca76a41"),
-uint256S("88f20be64a3e0e99e97b0ff710aa21bc41caed617e0e2acda2c0fe513d0548ad"),
-uint256S("88f20be64a3e0e99e97b0ff710aa21bc41caed617e0e2acda2c0fe513d0548ad"),
-uint256S("9850924d93eec8e7b3b7b955569330dd8a8b5f7572b255a4dec9076c0a47bc06"),
-uint256S("a1342900481a8eabfdf48dc51ab483f5b8709f0ebed0a495b9a4c18c303dd259"),
-uint256S("8468a7d2d04c11a56d611b2750e50acae45feb989a244cefd7c5b2a0d9ee1073"),
-uint256S("8468a7d2d04c11a56d611b2750e50acae45feb989a244cefd7c5b2a0d9ee1073"),
-uint256S("736b6a36a5361df5521d733d1d2ff6afb6cb6ef8a3e5417b647ea70aff672c6d"),
-uint256S("736b6a36a5361df5521d733d1d2ff6afb6cb6ef8a3e5417b647ea70aff672c6d"),
-uint256S("16ef8aeefe9a5329119d46cd0f6003ccf326ce4fbbbe25d3a49f04420a02f8cb"),
-uint256S("16ef8aeefe9a5329119d46cd0f6003ccf326ce4fbbbe25d3a49f04420a02f8cb"),
-uint256S("6a78d325ff0318090af9c329c89de235df59d12a038a5173a7ff8383da5306fc"),
-uint256S("46caac589596d6651b4b748547b73a5622812a8cde4bb95151fbc6f790856d9f"),
-uint256S("46caac589596d6651b4b748547b73a5622812a8cde4bb95151fbc6f790856d9f"),
-uint256S("2d1d15808dee97eedee2ed8495c1e67d9932f1fa5d8dc10d2b1f362d77bed04c"),
-uint256S("f51f5467cf8218bb64d04b725ffe802c73eda331ff56eddf269207ff023d1ebf"),
-uint256S("f51f5467cf8218bb64d04b725ffe802c73eda331ff56eddf269207ff023d1ebf"),
-uint256S("91dac240294d98c96212d29b0c147ccd64b6c07fbe4f742ae036c185f7017300"),
-uint256S("87c92d64be29749e40904dfd1c24cd15156414790bb05f17f9fcb58780d6fb80"),
-uint256S("87c92d64be29749e40904dfd1c24cd15156414790bb05f17f9fcb58780d6fb80"),
-uint256S("89d73a8c009a1f8f08f6f54c621737fae1b38ae741e8a651b4ebd689db3a15be"),
-uint256S("efb580a6b2973cd9d8dbc245165b601044e0a1a9f364a4c44b4c3df6ef4faf8c"),
-uint256S("efb580a6b2973cd9d8dbc245165b601044e0a1a9f364a4c44b4c3df6ef4faf8c"),
-uint256S("9ca64483536db9da5a14162c8aac253dd33f7f018a486275c6f906456fd82878"),
-uint256S("9ca64483536db9da5a14162c8aac253dd33f7f018a486275c6f906456fd82878"),
-uint256S("ae2d264eecdfe61233d84ea194fc8d8857803f54d31c110a8e19a9e5c9ed6ee5"),
-uint256S("5eacb18058d431a8bee0ddfbeab71b0b40bf9afafbcfe80a6aa65fd5db01fb93"),
-uint256S("5eacb18058d431a8bee0ddfbeab71b0b40bf9afafbcfe80a6aa65fd5db01fb93"),
-uint256S("f1f1ce41c9198b2d90f8686465788695e323eaca14a6be29456e6129b8df7405"),
-uint256S("f1f1ce41c9198b2d90f8686465788695e323eaca14a6be29456e6129b8df7405"),
-uint256S("bfb6068036fdcac32524fb055a4ab843c92b9ca5cf91d496dc24c71f3fed3f03"),
-uint256S("bfb6068036fdcac32524fb055a4ab843c92b9ca5cf91d496dc24c71f3fed3f03"),
-uint256S("73c80fcdd9e0d60f807163ab8dd14e1fa748fb6788c04c0323b5b72272c9e28f"),
-uint256S("48994e11ca0c31002958f1cd162cb9ce654183ba8d87c009393ca276a0ecf719"),
-uint256S("12f700d50d99dfd8b8a91ce3deea9d6b91bbafa2fa07756393ea1c067a7c62a1"),
-uint256S("12f700d50d99dfd8b8a91ce3deea9d6b91bbafa2fa07756393ea1c067a7c62a1"),
-uint256S("6425be5944d9cd68f9a353b79431a346772046bff093bad4a18c72039936e27b"),
-uint256S("8736b3c75434fed5426e44f18ab9cbe1080c033d9010ed0538a6a33106cbf928"),
-uint256S("8736b3c75434fed5426e44f18ab9cbe1080c033d9010ed0538a6a33106cbf928"),
-uint256S("7fbfdf576e1e3ca22b029502fb7208bec64a7d7f99d3c0c972f1be40abc162b0"),
-uint256S("0861d2c4466e40651429ede0139fb3b14d485836f18d3b274a3f4fc3a8de555d"),
-uint256S("0861d2c4466e40651429ede0139fb3b14d485836f18d3b274a3f4fc3a8de555d"),
-uint256S("1d1fc685e9b9e5411c2826cf0c8fed71d43f4518cee8c4b10c8abf7bd30e104c"),
-uint256S("65d582c2e7bb6788a853eb5c7e873d30666a4ccde933df3c71fd618112a749ed"),
-uint256S("65d582c2e7bb6788a853eb5c7e873d30666a4ccde933df3c71fd618112a749ed"),
-uint256S("1dd4f3ac7056394a17d0f319321f72705dff7badd01755cb41025c8c3f624078"),
-uint256S("6acfc660f9765aa7696ddac7b3e5483ad60950055bc8ae9babfcc6316986a888"),
-uint256S("6acfc660f9765aa7696ddac7b3e5483ad60950055bc8ae9babfcc6316986a888"),
-uint256S("8b89e0fc7d7dffcd931d264503561ad54cbce0afb404693fce96baa90e9c6778"),
-uint256S("22fb5ded44e85b5ed1b70e8990b2c3bd56d388b3d983ae4e6e259d1f2f6d9d9f"),
-uint256S("65993c9c767f814993219345eab69b95ffc261f35ee9c5d18a9024cda9dc14ec"),
-uint256S("65993c9c767f814993219345eab69b95ffc261f35ee9c5d18a9024cda9dc14ec"),
-uint256S("7e9d78267fe6fd4735129ddb67d2a307c41d3335babb8d2fbbdcb2c98018d60e"),
-uint256S("997f53d08f3a78c3a3a5add5fbe199b27d6a888491bdd2e3a6c3fc297b220a4f"),
-uint256S("997f53d08f3a78c3a3a5add5fbe199b27d6a888491bdd2e3a6c3fc297b220a4f"),
-uint256S("68160633a4c24417b477e7dd896ff729c57c23ded37fe8659e463a16108a1d51"),
-uint256S("55f3ca2a1c3c9c199e46ca64f3987d6bddebade4e10c037244c5d7b0520fa905"),
-uint256S("cd5386f11c7db58f830bb5059e0bee94bd8302df470e12b00443644c768d4d29"),
-uint256S("cd5386f11c7db58f830bb5059e0bee94bd8302df470e12b00443644c768d4d29"),
-uint256S("8e500c220c93274e9e8d6ed9f379ca2ae2c0ba96f04aaf3dcbfcb21e1dcd0f89"),
-uint256S("a1b326f90456a57bcc8d5a6665f408b31966020d07d5dc362221744489c5d81d"),
-uint256S("ab36c982efcb8829be9a9aca69149ef611fad0416d777041892a031dd895680c"),
-uint256S("f20699cbf5d0021f5109964c0f409fa375269c08ecc18bc5c2ea683b78f077a9"),
-uint256S("0c9f1de3ec7748b58c3ed3dc268828435ca4fd1f98ae246116fe400d7980a876"),
-uint256S("0c9f1de3ec7748b58c3ed3dc268828435ca4fd1f98ae246116fe400d7980a876"),
-uint256S("f7b98db27513a908b9e06db2027732a523e7ebbd3b5ad84ccafddb4e4a7900db"),
-uint256S("635ae6d40bfb654ff1f5dfd0038d93e49684bd06892090d518314e251a51dc51"),
-uint256S("635ae6d40bfb654ff1f5dfd0038d93e49684bd06892090d518314e251a51dc51"),
-uint256S("b0dc167c5dd640bc11d80240194a08b564d846fb4de6b6a8a56dcbc91dc93f54"),
-uint256S("b0dc167c5dd640bc11d80240194a08b564d846fb4de6b6a8a56dcbc91dc93f54"),
-uint256S("a8537fabee9f869fcf8df4cd725110fc77fabede71702c3aeab3788b9f862158"),
-uint256S("a8537fabee9f869fcf8df4cd725110fc77fabede71702c3aeab3788b9f862158"),
-uint256S("d37600042a0dc24c3c52630ddaf9ada585008c875ca9c749013fcc77a4d4f849"),
-uint256S("d37600042a0dc24c3c52630ddaf9ada585008c875ca9c749013fcc77a4d4f849"),
-uint256S("269a61d9c35febacf43645dd66f52eaff8dd1375f335ff8464aa60bf5e9f5fc8"),
-uint256S("269a61d9c35febacf43645dd66f52eaff8dd1375f335ff8464aa60bf5e9f5fc8"),
-uint256S("2af3ab9fde9f3aebb063a7124700a4ab1ae0c66c1eae9dcafd2ad6407ee6d974"),
-uint256S("3f91f06414431e388c6a38d72e30da8f8917365941c71bbf4c5d93651a9096a6"),
-uint256S("3f91f06414431e388c6a38d72e30da8f8917365941c71bbf4c5d93651a9096a6"),
-uint256S("8a4313200ea5479968e893a23ed004ced97a2f027c1a14ce7602f9e75a3211f1"),
-uint256S("8a4313200ea5479968e893a23ed004ced97a2f027c1a14ce7602f9e75a3211f1"),
-uint256S("782bbde55ee4027967b26d3619e42ee8556c26e4fc2fb9ab348515d95c628514"),
-uint256S("b7480fa5353b25392a29d941ea379c49775b366c3902506c40ac239258550e6e"),
-uint256S("b7480fa5353b25392a29d941ea379c49775b366c3902506c40ac239258550e6e"),
-uint256S("0579c07265d0225d58d979c29a17c887d4c59ae46317531839eb2041fd1dd6b1"),
-uint256S("0579c07265d0225d58d979c29a17c887d4c59ae46317531839eb2041fd1dd6b1"),
-uint256S("e7bb9726671d76cf6ef5919c78e4c1d904d7fe8197ef5ff297b0015bc4c53a3b"),
-uint256S("894144e40c363b495c6c6e698299f37afd079602e2d1a683a59e08a46cd832e1"),
-uint256S("894144e40c363b495c6c6e698299f37afd079602e2d1a683a59e08a46cd832e1"),
-uint256S("2224f94be30ff40cb5be5742e4a59703d690e050f61a6f2a4739fd03e7fcfc9c"),
-uint256S("2224f94be30ff40cb5be5742e4a59703d690e050f61a6f2a4739fd03e7fcfc9c"),
-uint256S("9981b57c9dd647389deac43036c6896767ad71db1112c7301921a59ced26a23e"),
-uint256S("09c0281e7be5c365c04f750b146beeb303ebb077b836ca4b7a5b1e4ed6664048"),
-uint256S("7c235cff1907b3234a7a8ee6ecb38402b75e6b7567f547640c2908e859c4537b"),
-uint256S("7c235cff1907b3234a7a8ee6ecb38402b75e6b7567f547640c2908e859c4537b"),
-uint256S("898f81ff69a7f9d0cefabeaaed80e187830d1373a50698cd5d6d4051b49a6d68"),
-uint256S("666bae90ac46cfd4d29aa112c82c78a341fbfbaaa51319f5bd1defe91d941958"),
-uint256S("666bae90ac46cfd4d29aa112c82c78a341fbfbaaa51319f5bd1defe91d941958"),
-uint256S("ed4270e30e333bf701f20361c17d421e38227a51047bc3eae18c7f8c6dd5762c"),
-uint256S("f916464cc85a90be5238eb0fdf33dfeda3c3263a4e77a396cf24d9308460892a"),
-uint256S("f916464cc85a90be5238eb0fdf33dfeda3c3263a4e77a396cf24d9308460892a"),
-uint256S("3ae16999627bdda06e00b7caabb5398f4cd2cce3cffe4b46702a32413dc29bfd"),
-uint256S("d90de8af27792c7968d11f2525ccb70925a06593981c5c172c206290d44f5abf"),
-uint256S("d90de8af27792c7968d11f2525ccb70925a06593981c5c172c206290d44f5abf"),
-uint256S("eaaa261868a16884114b6cfbeb4e3e65a2eb137f39dd7f69b3030fa5bdd22bbc"),
-uint256S("558f81a36113029ab9aeeb36f585c64df667c4bde5752f01aeeb3c97b491b0ce"),
-uint256S("558f81a36113029ab9aeeb36f585c64df667c4bde5752f01aeeb3c97b491b0ce"),
-uint256S("7780d1f251d98d2d238429dd624b1ec828f27cddd285b828fc01eba2c4b471e1"),
-uint256S("d79098fcc974eac25a01462b39cfa188c58bb845dab8161a6ce222d8464457d2"),
-uint256S("0bec48e5253cc5b621be227342b06538ee6965a1090665137f52068640b57154"),
-uint256S("a48e0e4486abf7146953121fe061042adfdbb19052a3c44351bcd2abab5b65f6"),
-uint256S("a48e0e4486abf7146953121fe061042adfdbb19052a3c44351bcd2abab5b65f6"),
-uint256S("92e469ea57c2cb63cd99800339476f4dcfd11338668b458feb3968c384a79cb7"),
-uint256S("6ad7cc88c83b0eb0d07206ac905ecbbd5f9fd9d0f7698bc75c786846e7edbfa9"),
-uint256S("d279d7b37b88afc812eef157b9d094117a8ab406771bd51f15b0cc0ac1241c09"),
-uint256S("7e19b0e08f8481faaa07e95caa0318d3d7619130487197269f3cc14477b25116"),
-uint256S("7e19b0e08f8481faaa07e95caa0318d3d7619130487197269f3cc14477b25116"),
-uint256S("c365cc2207f9e5f9db8e00d75d5fc815731be1f575584d94bcbdbeceb8525013"),
-uint256S("dbe6f7c497228cbc1588e9883fa734595764d72b80cae2bee25db8b25acc73d6"),
-uint256S("fae874b4ce3ce46aae80f7630ad9ab9ba317df82b691e6e21cad1230ca3152d4"),
-uint256S("8c1dae80a980b58a6936f2ef7dbe6898e061bc7220605996990ef3a596482ad3"),
-uint256S("e6297d35919f0993d9ac97d0d65b570946c3f57620671805f562395dd961e1eb"),
-uint256S("e6297d35919f0993d9ac97d0d65b570946c3f57620671805f562395dd961e1eb"),
-uint256S("c4463a5a4056239f38fb3483b64ae14d3c409e54b1b03027eab21116221bc72e"),
-uint256S("c4463a5a4056239f38fb3483b64ae14d3c409e54b1b03027eab21116221bc72e"),
-uint256S("d02ce7d3d07d6869c24065937833cffb1a7be3fb390a26f1cc35cc69258bd5e3"),
-uint256S("ab64afaeb39c361bcfa07b002353825bd2aa0bb5794ffb364f7c53ca49bc465b"),
-uint256S("ab64afaeb39c361bcfa07b002353825bd2aa0bb5794ffb364f7c53ca49bc465b"),
-uint256S("fc0f6ebdde4e776b80130b4e69295923ec8c60e1e4194d497501c3328dd5b989"),
-uint256S("fc0f6ebdde4e776b80130b4e69295923ec8c60e1e4194d497501c3328dd5b989"),
-uint256S("0fd8744f94ff0e768245031206f97655675647b409e9fd0d6fa35bb0c204a667"),
-uint256S("0fd8744f94ff0e768245031206f97655675647b409e9fd0d6fa35bb0c204a667"),
-uint256S("af18893a1a9240a1f1c4c0aca5ec89951f8b65825e8d2b566024a40df8ea28b2"),
-uint256S("ad7ecf8fbee135a8ae8c5ed18d5a107fa769fd61a75f6b3b3e34a8aefe9537b5"),
-uint256S("ad7ecf8fbee135a8ae8c5ed18d5a107fa769fd61a75f6b3b3e34a8aefe9537b5"),
-uint256S("fad7be4b8fe0a26f5898dda03b6a60085b54bc5124536a429b39702cc8eb787b"),
-uint256S("b021bdfec68aed97288108afbff80d532287bb8b5494ca7ad0adbe3fdc2d4107"),
-uint256S("b021bdfec68aed97288108afbff80d532287bb8b5494ca7ad0adbe3fdc2d4107"),
-uint256S("9ac8e8218f2dbbbd1748443002cf9ad3c481c1f36ffd2427e3763be168a32799"),
-uint256S("06234a452f48d578a48f251d163ce68b46e8a74c93953ffcce0d9b713ecac07c"),
-uint256S("06234a452f48d578a48f251d163ce68b46e8a74c93953ffcce0d9b713ecac07c"),
-uint256S("b1305235b89d41c123c247b90354c5dd04b0b25dde66d030a5a33fb69c5e71a8"),
-uint256S("0f043e6cdf535938630ff042a1717138249c086ca35e7aa99ab7192fd6bc0caf"),
-uint256S("0f043e6cdf535938630ff042a1717138249c086ca35e7aa99ab7192fd6bc0caf"),
-uint256S("df33d34348370b704acdb199ddbd56abc61ef022e0f33da22eed8fece67b35a7"),
-uint256S("df33d34348370b704acdb199ddbd56abc61ef022e0f33da22eed8fece67b35a7"),
-uint256S("dd51bf6682526fa115c64634ff5553f274e3ecec7be49e6aef4ce08afba7df62"),
-uint256S("dd51bf6682526fa115c64634ff5553f274e3ecec7be49e6aef4ce08afba7df62"),
-uint256S("4e1d6ead35a9d97d9f6cfb29c308b0c66f54998846f12a5ee4bdcf0ae8f65986"),
-uint256S("4e1d6ead35a9d97d9f6cfb29c308b0c66f54998846f12a5ee4bdcf0ae8f65986"),
-uint256S("20198f11b653d62ccfb0d6c41a0cc72da0efd10846d63a175804598147f8bd1d"),
-uint256S("c2a25c245804577092ab29375c84b907d5c026018609d467bab5a8a1120047ff"),
-uint256S("c2a25c245804577092ab29375c84b907d5c026018609d467bab5a8a1120047ff"),
-uint256S("ad0dcac6db656d7d875b0ec71d1205dfbce81270bfa01483328d372bdff64c2a"),
-uint256S("abb6052674cfa72ba3ad05bfa9977ad06a581489d18a587ea047a0cfc1b678fb"),
-uint256S("abb6052674cfa72ba3ad05bfa9977ad06a581489d18a587ea047a0cfc1b678fb"),
-uint256S("144e15334a02efdced6b20655694cf3183b621afb274a4bfaa433c6d3ba47140"),
-uint256S("144e15334a02efdced6b20655694cf3183b621afb274a4bfaa433c6d3ba47140"),
-uint256S("276d02054946b2e03e4e88883f85ea0f2c013bffe90a66743967319dd056426f"),
-uint256S("276d02054946b2e03e4e88883f85ea0f2c013bffe90a66743967319dd056426f"),
-uint256S("e9035322640d48d2cfdfb9199e1064f92d2da340da305a985b896ea7b3e2e37b"),
-uint256S("e9035322640d48d2cfdfb9199e1064f92d2da340da305a985b896ea7b3e2e37b"),
-uint256S("467d60399ae016126c6c764084f3483f716152cf0035338c4aab574ddf131a8a"),
-uint256S("467d60399ae016126c6c764084f3483f716152cf0035338c4aab574ddf131a8a"),
-uint256S("d17e46cb8adbc8134005e8f61b4a71f1e8832096cb8d677973f25b89447822b5"),
-uint256S("2ac6060313e3f6191a9af3190de43073e6c7c875dba06a12dda4bef99d15ab4c"),
-uint256S("6a100940987e0f82dc697d52c5959c45a643ff70ad0c42dc4058ebbc8b6ff6d3"),
-uint256S("6a100940987e0f82dc697d52c5959c45a643ff70ad0c42dc4058ebbc8b6ff6d3"),
-uint256S("87fa6dbffcfa55bcd610228a9d010b78dd02da4487d34b3cc370c09b518a50e8"),
-uint256S("87fa6dbffcfa55bcd610228a9d010b78dd02da4487d34b3cc370c09b518a50e8"),
-uint256S("fc0be59fe23c4b2a80c89ed39e27d3c3128d5d78787462516f6fa1ed27a521d3"),
-uint256S("fc0be59fe23c4b2a80c89ed39e27d3c3128d5d78787462516f6fa1ed27a521d3"),
-uint256S("e38443201e62cb574f3397836fcd9da97ec025b546409bbff0ee2081d0951db7"),
-uint256S("c297df4e9a3a99b326036a19390ec46a58a516a0876103359e7825902f57c5f2"),
-uint256S("c297df4e9a3a99b326036a19390ec46a58a516a0876103359e7825902f57c5f2"),
-uint256S("0aa80a7c1edd9d5e6e27e56ad5b569f6a5922e113d172cf570daa93e044690a6"),
-uint256S("0aa80a7c1edd9d5e6e27e56ad5b569f6a5922e113d172cf570daa93e044690a6"),
-uint256S("b324355a3636e3856354f97c5be781d00c3826284f72afd7cf04b7f370102109"),
-uint256S("b324355a3636e3856354f97c5be781d00c3826284f72afd7cf04b7f370102109"),
-uint256S("345dcb2ffea170377dffb69fcb1fc1b5610f445fee383f5cf034799ac3e072a6"),
-uint256S("f40e1d415f4a06d636f599b117eab1f78491fda01c22b4c58d74ba763fcc9967"),
-uint256S("f40e1d415f4a06d636f599b117eab1f78491fda01c22b4c58d74ba763fcc9967"),
-uint256S("e2485ae932dd63f940f33996f9ac121da550c6cc4075528729b4b49d6d245def"),
-uint256S("e2485ae932dd63f940f33996f9ac121da550c6cc4075528729b4b49d6d245def"),
-uint256S("9e63d51bb5e02a834f000a61841175094849f0e69297a27c3ae0583e59ee4141"),
-uint256S("9e63d51bb5e02a834f000a61841175094849f0e69297a27c3ae0583e59ee4141"),
-uint256S("172a0658381ff5cd61a5cb8e386f30c8d4b9d8271a1617fa454dd476995795db"),
-uint256S("cf78ee9c9b0521a2670f2bb624c97567dfc4469ec31a8152e550c4a62cf23327"),
-uint256S("72fa3d557347ff082b854a2f43c471e83490fd391c0a2649841c555d9a50b894"),
-uint256S("72fa3d557347ff082b854a2f43c471e83490fd391c0a2649841c555d9a50b894"),
-uint256S("84df2c01ef75112d64939beb746ddcbcdebbf3443c24cb15c04be2ad5c2321df"),
-uint256S("84df2c01ef75112d64939beb746ddcbcdebbf3443c24cb15c04be2ad5c2321df"),
-uint256S("b72cbbf92c2058e8b2e6bed13e8e4a1e9e390f240697c2938db1c58ee03dad75"),
-uint256S("544b6b1c6b59ededb7dce041fe89977966b813cf0d3a9d920313fc1673f77509"),
-uint256S("5013414bf891bc3e093f2d1c2d8a7f084667b8647de584a4e8f6e4bce6b7a72b"),
-uint256S("5013414bf891bc3e093f2d1c2d8a7f084667b8647de584a4e8f6e4bce6b7a72b"),
-uint256S("bcb9c1de4b0cbdef96a5bd669bae48932caec514fdfa6ffdf26aeb296e1eb2a2"),
-uint256S("9da885ddf823559b0db93d592615454b7b5bce79b843dade389a86ef6ed8f93c"),
-uint256S("9da885ddf823559b0db93d592615454b7b5bce79b843dade389a86ef6ed8f93c"),
-uint256S("168897a46d91b522ab6722ba26e8ced9ce36576c5e2b7e03a076166e381be9d9"),
-uint256S("a2e78a487631faab40bc238b9af0b5c11b9239580c57b7910dd1303470e87385"),
-uint256S("a2e78a487631faab40bc238b9af0b5c11b9239580c57b7910dd1303470e87385"),
-uint256S("144c34f373c93cbddaf383f9254eea2dda482b15ab2b488cd9006c065ccbfcb7"),
-uint256S("a7861692be8e0bc46784cd5430a485d669bc6da8dfae7dc6e472a1f082a21e2a"),
-uint256S("f0c2299b2bb601e8063c20ffdc82726b057d34735f64d39e59f43d7aecfa97ea"),
-uint256S("f0c2299b2bb601e8063c20ffdc82726b057d34735f64d39e59f43d7aecfa97ea"),
-uint256S("daecbbf8c41835aed9d57cf7c43b085bd1d50eda6791b1046da30101cd7c4f16"),
-uint256S("daecbbf8c41835aed9d57cf7c43b085bd1d50eda6791b1046da30101cd7c4f16"),
-uint256S("06ce0432f50c5a0e092170af29b16bafd6eeda0723a5e63095d2a0796fd8351c"),
-uint256S("a0d4990925a1e0a51f7a20ab7fdb7905341a71fe98a58f3313c955cda2c87ba9"),
-uint256S("a0d4990925a1e0a51f7a20ab7fdb7905341a71fe98a58f3313c955cda2c87ba9"),
-uint256S("cd7b470ac33f62758ad9a8905764772e439ce7911a16cee350819e36898f0395"),
-uint256S("cd7b470ac33f62758ad9a8905764772e439ce7911a16cee350819e36898f0395"),
-uint256S("186283d8a8a7fce70343572230dc4d3d3d6cbcad82213d379ac5ce8be5003b9d"),
-uint256S("68189f1851e66427426f920fc877a4285ba04ac92420fae143535bd5b53447c0"),
-uint256S("68189f1851e66427426f920fc877a4285ba04ac92420fae143535bd5b53447c0"),
-uint256S("b56cd77ba15ec85f04497ab1419171c0b9f246ca333da2150b7c53f9e3c9b210"),
-uint256S("773c4552c7f5333f2e29bab27f6c407ae6d0e289d5a76cb42472ac840e1b7bdd"),
-uint256S("cc73637ad0e22b3b3585ca50243081084a5f3517cfc222852e9fc76a8e26b1bf"),
-uint256S("5aec55643bd65888e005311f43e60feec103d904f578356c4f232f2a5411226a"),
-uint256S("5aec55643bd65888e005311f43e60feec103d904f578356c4f232f2a5411226a"),
-uint256S("99ef50a1f58e37e867934e1e4fcb2368b94db126229281df3da17d9ed93a65d0"),
-uint256S("99ef50a1f58e37e867934e1e4fcb2368b94db126229281df3da17d9ed93a65d0"),
-uint256S("aea0261d3f68cf0b2f0cad9cc71c427ca7814274d602c9676c397e4d6be3de13"),
-uint256S("00f1d8d09ff14dd3d61b8293937311d776466ba683db86ca7e187636e9c5bd8e"),
-uint256S("00f1d8d09ff14dd3d61b8293937311d776466ba683db86ca7e187636e9c5bd8e"),
-uint256S("3bce22d40db6e6f9f534b5b77c3a1be6ebcb256fa19241857b03b2e921787250"),
-uint256S("1716fc72655b8e6f22d4ac577ef8dc54ea21275ebc704c7b8fbe18b369217ffc"),
-uint256S("1716fc72655b8e6f22d4ac577ef8dc54ea21275ebc704c7b8fbe18b369217ffc"),
-uint256S("79a7a9f605035514eadfa27929661b581fd60be6a23167395c9788ad7125f1b1"),
-uint256S("79a7a9f605035514eadfa27929661b581fd60be6a23167395c9788ad7125f1b1"),
-uint256S("e1b7663eba29185f3077260e878d9003bed96356af8aef9ff8c09cac3a80abd4"),
-uint256S("e1b7663eba29185f3077260e878d9003bed96356af8aef9ff8c09cac3a80abd4"),
-uint256S("2f609a6b9e08d22a0edf4de908eb1f24534038f389effa49fe5caa6e6cdc03ce"),
-uint256S("2f609a6b9e08d22a0edf4de908eb1f24534038f389effa49fe5caa6e6cdc03ce"),
-uint256S("e8204ccb0300efa2d6e121c8d4e450aa6b01b6c8d6b4e9339cf13a6731fdd461"),
-uint256S("96a5ae6015d167778c4c68b181c0f8c6884c8fe75100650c7de53f2266ccad2a"),
-uint256S("96a5ae6015d167778c4c68b181c0f8c6884c8fe75100650c7de53f2266ccad2a"),
-uint256S("a8c8e1cb7f574d1c6157c1c82dd300914e9e36acc655876273e1c9df5b2a405c"),
-uint256S("5ab32cfd7e3de67946f53173681cb5e463c713243da8144eaebe0bf845a79d9c"),
-uint256S("5ab32cfd7e3de67946f53173681cb5e463c713243da8144eaebe0bf845a79d9c"),
-uint256S("010e40b69bb394b8552146d0c89b989a410dfe5f80a7653e75087f53302f3980"),
-uint256S("010e40b69bb394b8552146d0c89b989a410dfe5f80a7653e75087f53302f3980"),
-uint256S("9e97b6e9a7e011b1b6bf78cfdd3302834a1bf96ecbc38d706c2d74f99070fae0"),
-uint256S("2a4a46683bfcefdfd4eb9a79b40bdd5ded2f6499cd21f57611833daef0d3f249"),
-uint256S("2a4a46683bfcefdfd4eb9a79b40bdd5ded2f6499cd21f57611833daef0d3f249"),
-uint256S("c99ba42dd2fc2c0a06c602bb7b645d64fcd379207bfb4111ea8ba6d884d4efc9"),
-uint256S("c99ba42dd2fc2c0a06c602bb7b645d64fcd379207bfb4111ea8ba6d884d4efc9"),
-uint256S("620c2774854277721f41189244eb6d8884777cfc3db1ec8c9f8fda38128b14da"),
-uint256S("e15bc4907478a16d067de2d86d1845d8b5d508702cad49e7a12d89d2b6101b9f"),
-uint256S("e15bc4907478a16d067de2d86d1845d8b5d508702cad49e7a12d89d2b6101b9f"),
-uint256S("f9d0535631531461caccc2c9ca35d6946de92baa74c3e21222ad404b2024cfef"),
-uint256S("5c2078aa2ee3a0d009fcc762d2e2cfeed4c938c0319a179c096839e8b517c94b"),
-uint256S("5c2078aa2ee3a0d009fcc762d2e2cfeed4c938c0319a179c096839e8b517c94b"),
-uint256S("6d7f6a36e4d63eb28d853437335203e106a304803675884c907d7dc128d9d337"),
-uint256S("6d7f6a36e4d63eb28d853437335203e106a304803675884c907d7dc128d9d337"),
-uint256S("c4a6cb1677f52319575bb026f1841bfd0fbf7f69b4d6dcc5e5408fa7e4dcaabe"),
-uint256S("c4a6cb1677f52319575bb026f1841bfd0fbf7f69b4d6dcc5e5408fa7e4dcaabe"),
-uint256S("a2b41d19043865c1ca2cca2ad25927494920ef57e46caad8e64cdc122820a686"),
-uint256S("a2b41d19043865c1ca2cca2ad25927494920ef57e46caad8e64cdc122820a686"),
-uint256S("01421356de6868fcf6b2f8adf2133f26d5c247f3afad86d55aa5f58fd79c0bd2"),
-uint256S("01421356de6868fcf6b2f8adf2133f26d5c247f3afad86d55aa5f58fd79c0bd2"),
-uint256S("9a41e8a91368140b28eb6773518a7310e98887314f62dc733f7c1a82f0a6cb1e"),
-uint256S("d2b37cc1666547f482351ab4e3a885218620b9ee2289acc488224ab9cd92e5ec"),
-uint256S("25365b9d1c9723eac42a47e0d567b22e82865f1a008aa8ae3669af90c72e8382"),
-uint256S("25365b9d1c9723eac42a47e0d567b22e82865f1a008aa8ae3669af90c72e8382"),
-uint256S("487f907246c1792ae3fb88a120acafe6a1acd1bbc487d8d2794ef34dbe53068f"),
-uint256S("487f907246c1792ae3fb88a120acafe6a1acd1bbc487d8d2794ef34dbe53068f"),
-uint256S("c4125146f423cf5d03c042b71040f51d86df826c3fe9df72f721c3b480238a97"),
-uint256S("c4125146f423cf5d03c042b71040f51d86df826c3fe9df72f721c3b480238a97"),
-uint256S("7b72cdfa40d94da668647d9933e73555a3daf3a24459bed37673a75c3b2b1224"),
-uint256S("7b72cdfa40d94da668647d9933e73555a3daf3a24459bed37673a75c3b2b1224"),
-uint256S("33dc391a57e6ab71c4e715287269a3999d6d5f6519cbfd32b0c1f0ffe34942c2"),
-uint256S("33dc391a57e6ab71c4e715287269a3999d6d5f6519cbfd32b0c1f0ffe34942c2"),
-uint256S("b06a9e1f02f54f1badf1f2ed580f44a49bc75001326ae2e052d58effc5690607"),
-uint256S("dce0b577bda7feb832b45445fe6b4587d3447c6461ea1293ad944d713ec5aa29"),
-uint256S("dce0b577bda7feb832b45445fe6b4587d3447c6461ea1293ad944d713ec5aa29"),
-uint256S("1a0febbf1a74d6252d892d233dd4a7c9d5526ab7870dbe44127274e2c4e31eb4"),
-uint256S("1a0febbf1a74d6252d892d233dd4a7c9d5526ab7870dbe44127274e2c4e31eb4"),
-uint256S("c00c1bb66bd1d35b53c5c784cbc41708a0db3bfa6463466c6572372c3adde603"),
-uint256S("6d01c83bc6dca330c9df36dc23224f5c51fef807eaa1b2502f8d314d10502639"),
-uint256S("5238c4455a21303517a5806969123188f5c090a3f751c9d4c3d12f86900f4700"),
-uint256S("5238c4455a21303517a5806969123188f5c090a3f751c9d4c3d12f86900f4700"),
-uint256S("99ba6fd5e4324acecf937c310ea21b063671782b1903c1b5a716ff5b8a9446a7"),
-uint256S("99ba6fd5e4324acecf937c310ea21b063671782b1903c1b5a716ff5b8a9446a7"),
-uint256S("ab6aa089344d4035d5eb2cb46b3154314df15741fda322499bed062b04217ad2"),
-uint256S("ab6aa089344d4035d5eb2cb46b3154314df15741fda322499bed062b04217ad2"),
-uint256S("db7f342f30d00a561706cb76ff7b83e5b829e0ca4c1e71fe84ab7270834a7fcf"),
-uint256S("9c90ae48f4d5cce2c2d8a64a533fa3c59f3cec96f0feb0145e224a430d7eff5c"),
-uint256S("76cb23179f875b2c763d6527790c40058c0d29e734fd94ec656f3cc7dcd20ce8"),
-uint256S("e542d90bd41c9b6249722d45c14f54bf47c95db03c0c9f0e3450fb094cc3d63d"),
-uint256S("303e47742dceb32cdea5518a341d75e95e91272ef30f6c5d764452254b591cba"),
-uint256S("9838fb1fecb428eafb603868da1b0f1f508bcf5bfe27e2a0d39745537a6fa4f9"),
-uint256S("9d1f4a378f3798cc8a69fb2241e71b04ed2776ca6434ae824045f7c377011a43"),
-uint256S("5c43e48d54e6fc05775663dcba4e0177cfef5afd842282431bc4e3a09dd7b780"),
-uint256S("2d01be5cc271b50635293eabafd67235a21e6ab867c311a50db0ee2f6f0291c3"),
-uint256S("2d01be5cc271b50635293eabafd67235a21e6ab867c311a50db0ee2f6f0291c3"),
-uint256S("4366736a58f3a97dbe30a1e9312653d85fbbb98f702cb4393a155f6f37067e36"),
-uint256S("4366736a58f3a97dbe30a1e9312653d85fbbb98f702cb4393a155f6f37067e36"),
-uint256S("fb2e5bc3108ccd8173fe26a2b0c43baeddd4246b0efa08e94576dd0c559565e7"),
-uint256S("fb2e5bc3108ccd8173fe26a2b0c43baeddd4246b0efa08e94576dd0c559565e7"),
-uint256S("a1c8b2d9fd079e1711590675e96815132ce5a622a0a9b07db48ad5cd9ed69dea"),
-uint256S("8b59c0f4fbf2f3141abd484e2a81d9b207a5440ec38d20c6ef8477be6808af42"),
-uint256S("65d2b6986b23cf1d6db4ab3a16cf50748c3dac4be30fcea996357d0911a1a67c"),
-uint256S("65d2b6986b23cf1d6db4ab3a16cf50748c3dac4be30fcea996357d0911a1a67c"),
-uint256S("8edec2f372270ffdadb985276fb547b4c78a2b872356df647dddcb457d6e2d25"),
-uint256S("8edec2f372270ffdadb985276fb547b4c78a2b872356df647dddcb457d6e2d25"),
-uint256S("f929a8a54e7d4f9bc11646a310cdc6b3d8a68e61597c04a97793c3116ad5d673"),
-uint256S("f929a8a54e7d4f9bc11646a310cdc6b3d8a68e61597c04a97793c3116ad5d673"),
-uint256S("c55a923e859306e9a93fbd602e0330f7ca51fb66e05e2a16db33e3e5e751be25"),
-uint256S("c55a923e859306e9a93fbd602e0330f7ca51fb66e05e2a16db33e3e5e751be25"),
-uint256S("b8ceff817144a8429163eaf703a58924fb2b2cec41c817ef8ce4e8f2ef3e660a"),
-uint256S("b8ceff817144a8429163eaf703a58924fb2b2cec41c817ef8ce4e8f2ef3e660a"),
-uint256S("df46c115235e8898f2e2358ac51feac4f2b7b3fc916c27540c1d272f20e804db"),
-uint256S("df46c115235e8898f2e2358ac51feac4f2b7b3fc916c27540c1d272f20e804db"),
-uint256S("0f9a0c404c830657db083279e70fccd987e8762b980ba48f8f5b0f50314fe852"),
-uint256S("8ef464c0065df3df1f1c9388fdab4d73be35708d6f54b19523b911ac85bc025b"),
-uint256S("3119e487ae46e414eaffc9db4dae91ddb641caf519005aea583e72aaa9b5a9ac"),
-uint256S("3119e487ae46e414eaffc9db4dae91ddb641caf519005aea583e72aaa9b5a9ac"),
-uint256S("986411302eadab035718d661aa6c735948bce8d68f4f0783eaf6825b4d9f46c9"),
-uint256S("986411302eadab035718d661aa6c735948bce8d68f4f0783eaf6825b4d9f46c9"),
-uint256S("d5e904942fcc73cd1a2251ba268341bee002355a7277486923c9165b191f5ec7"),
-uint256S("832f368c07ef04a794e43c168da95623ed7620f496c987d11a03b1916d93668f"),
-uint256S("832f368c07ef04a794e43c168da95623ed7620f496c987d11a03b1916d93668f"),
-uint256S("1d58ae17c161f27a0452c53db94e4ba072d8842cb00d32b4ccf0406dab18a04e"),
-uint256S("1d58ae17c161f27a0452c53db94e4ba072d8842cb00d32b4ccf0406dab18a04e"),
-uint256S("11b10be7297450afbcc0a3a684184aeab9155c84574711dd8cee009b629bc28b"),
-uint256S("10747694c96f6cd469c22adbdd79a7bb484eb4321e3088b7ab83dd44261c0908"),
-uint256S("10747694c96f6cd469c22adbdd79a7bb484eb4321e3088b7ab83dd44261c0908"),
-uint256S("d31c8d57f348d63bc52985934049cc7523b51e9601defefbc6eb866eb3200f66"),
-uint256S("d31c8d57f348d63bc52985934049cc7523b51e9601defefbc6eb866eb3200f66"),
-uint256S("9a995199d0baad4b45bf5c923b31cb96e32515a68a6cde373246e4e7c52cdb60"),
-uint256S("9a995199d0baad4b45bf5c923b31cb96e32515a68a6cde373246e4e7c52cdb60"),
-uint256S("3238f2a7086966f19562fdd7df69c8f784da232d7ae120b844d687f814677727"),
-uint256S("3ef7d236fd3207102413cde57430d400f2488f2abbc5456092bf2dc3215e5a96"),
-uint256S("3ef7d236fd3207102413cde57430d400f2488f2abbc5456092bf2dc3215e5a96"),
-uint256S("499003665303ba9a17f2b54fa4f2c177898a5bb1224cabd5f51d546d84f1d75c"),
-uint256S("499003665303ba9a17f2b54fa4f2c177898a5bb1224cabd5f51d546d84f1d75c"),
-uint256S("bc48536728f155b0092103fb2de751777051dc9bc1970f64f6f92a2220ea4dfc"),
-uint256S("bc48536728f155b0092103fb2de751777051dc9bc1970f64f6f92a2220ea4dfc"),
-uint256S("237cccc6b57af48f3d165b542e3afb0f97bc7882772d296190e7c128dd813cbf"),
-uint256S("8cfec8de48bfd88b11f8935b282848b526be04a21373e94b0f40faaa64eaacda"),
-uint256S("8cfec8de48bfd88b11f8935b282848b526be04a21373e94b0f40faaa64eaacda"),
-uint256S("9e7391b08efdab44040c3b6eddf6c15bf780b648c7adbd27f8e9ed0b96c13514"),
-uint256S("9e7391b08efdab44040c3b6eddf6c15bf780b648c7adbd27f8e9ed0b96c13514"),
-uint256S("b1947040320a394dde92f2834881ccc1f03cc80911cb6a5efc0d170a1395bea9"),
-uint256S("b1947040320a394dde92f2834881ccc1f03cc80911cb6a5efc0d170a1395bea9"),
-uint256S("8a6e138ec34cef03436421271485f1ffa50f2316272a013bf5b6f8a8cec19832"),
-uint256S("8a6e138ec34cef03436421271485f1ffa50f2316272a013bf5b6f8a8cec19832"),
-uint256S("9cb72f1dc8676d0df54a67bb2dd746cfbe2a4ba809a8f4d99449011d76c6ed39"),
-uint256S("90b83a2efb342111018f2d95cbd961f814747a2deae55cfc1ab665d30fde6de4"),
-uint256S("90b83a2efb342111018f2d95cbd961f814747a2deae55cfc1ab665d30fde6de4"),
-uint256S("bf7f14c8aa9b0e2ecfc5196cae1c5a4b7b9ef9cd6393653f6149712472bf04d1"),
-uint256S("bf7f14c8aa9b0e2ecfc5196cae1c5a4b7b9ef9cd6393653f6149712472bf04d1"),
-uint256S("d1099f2e68ec85718ad5b8afa0e967a375000fe811de0309b7293949512bb340"),
-uint256S("90753b25e6aa566cb92f079d4f7943548105e6f6a457ee6a360605acf485bbf5"),
-uint256S("90753b25e6aa566cb92f079d4f7943548105e6f6a457ee6a360605acf485bbf5"),
-uint256S("4ed0264773054356dc69a5d310c5cfce7bb794441ba9b7644f2af3801248fbb2"),
-uint256S("f538c15681c840ae9c04bd14422e6df2b80fb408e1b03c55de9c2351adc32dda"),
-uint256S("f538c15681c840ae9c04bd14422e6df2b80fb408e1b03c55de9c2351adc32dda"),
-uint256S("18565a967435451d5de0ffd1c200cecacdf031d9bc30c26ea144694cd75f8e1f"),
-uint256S("18565a967435451d5de0ffd1c200cecacdf031d9bc30c26ea144694cd75f8e1f"),
-uint256S("2d58a5f9e6a9c4acb6bc3673937a5a7ee6331425a4cf8afcaf7b2e195ec5b297"),
-uint256S("2d58a5f9e6a9c4acb6bc3673937a5a7ee6331425a4cf8afcaf7b2e195ec5b297"),
-uint256S("65df45d773c213db8f5e1691c40371b644cb68d559262f18ca94b67fd9136e58"),
-uint256S("65df45d773c213db8f5e1691c40371b644cb68d559262f18ca94b67fd9136e58"),
-uint256S("752863ca41e6258f639a1f7b994a2f6790d5297d559f7699414e81fb7bcddd34"),
-uint256S("752863ca41e6258f639a1f7b994a2f6790d5297d559f7699414e81fb7bcddd34"),
-uint256S("2f907f0fabe880711ffdd533b48dbec69e48a3fdbdd46dd93a62c24a7130e676"),
-uint256S("2f907f0fabe880711ffdd533b48dbec69e48a3fdbdd46dd93a62c24a7130e676"),
-uint256S("b2e76b114c737178d87265dea7d877374bbd51ded63bb6777c9d8f97a8a62e79"),
-uint256S("73078c571ab00a01b642f9894959d036836fd5c75bb5cf71a415542599ff56c0"),
-uint256S("73078c571ab00a01b642f9894959d036836fd5c75bb5cf71a415542599ff56c0"),
-uint256S("f184d62a5733704f5bf3b0d56d2067dc07c4cebccd88da18cff978680b063665"),
-uint256S("f184d62a5733704f5bf3b0d56d2067dc07c4cebccd88da18cff978680b063665"),
-uint256S("7790a739444eabc45138d38e5f37f8df56895779e17f84bfbccdd2dea1ca0e1a"),
-uint256S("fe4ca8118469dee2e99bd55809740819330d90f9f891912057938e79de6702fb"),
-uint256S("fe4ca8118469dee2e99bd55809740819330d90f9f891912057938e79de6702fb"),
-uint256S("8b4d8babfbcf7382e4c5e9fdc5822eba0059308765fb1a7441a8079fc476fd4b"),
-uint256S("8b4d8babfbcf7382e4c5e9fdc5822eba0059308765fb1a7441a8079fc476fd4b"),
-uint256S("b4797c4e9bb26448c47d02d51c3adfe38f3346a9c252335240aa7ec5da5e9445"),
-uint256S("b4797c4e9bb26448c47d02d51c3adfe38f3346a9c252335240aa7ec5da5e9445"),
-uint256S("f9a9fa28e2b655611abd82385150c3ea4c3fbe6e6afc90898afc6ef0372c8df2"),
-uint256S("c1813bece4e6b13da11afd7c430edf622a40973ed1707ce628adecc8c35d3e32"),
-uint256S("c1813bece4e6b13da11afd7c430edf622a40973ed1707ce628adecc8c35d3e32"),
-uint256S("b010df1d0ec472dedfccd4e55eeddf8ae7db2b63530b8860e98bc5e7a5f27afb"),
-uint256S("dd319175de2ad36b7aabd9caf1f82e2bc78c41e7578de8dfd7b3c83eefcf2cd2"),
-uint256S("5104abade57e5ca90024eb80216f41fc81b55d22eb64fbf5a768bf973c476b33"),
-uint256S("5104abade57e5ca90024eb80216f41fc81b55d22eb64fbf5a768bf973c476b33"),
-uint256S("79e80e8d59616456c540f438ce4d5cdada0137b56858172f718c278270c50395"),
-uint256S("35a4206a33e5fd7440c684a59e843d4130121b88c933d5ac103c40091e120753"),
-uint256S("35a4206a33e5fd7440c684a59e843d4130121b88c933d5ac103c40091e120753"),
-uint256S("481dfb6a696f2080026b5218bfb0ccfc7a432705e2c960f65a37df3e01c11d6e"),
-uint256S("528616ea0219ce24cdaccbbe812fc9d5f512148710eb888dfa1a4994e51d61dd"),
-uint256S("528616ea0219ce24cdaccbbe812fc9d5f512148710eb888dfa1a4994e51d61dd"),
-uint256S("d889ca1ef68c9517303a034feb79a92b48f7ce4e1a50640aa20a0931047f4ca4"),
-uint256S("49974fdb23bd225ac97f427c348972177ad6668cc5f2b801c5333a3dcb0a5f04"),
-uint256S("49974fdb23bd225ac97f427c348972177ad6668cc5f2b801c5333a3dcb0a5f04"),
-uint256S("1fa92a284027b4b4c495c3d4fd3f41a14dc43d5b71a4b62fa38870f3b05a6f4f"),
-uint256S("b9fb75a555490ee6eedd8c910c9cc0882068583c192de092bdacd47ba64aa627"),
-uint256S("b9fb75a555490ee6eedd8c910c9cc0882068583c192de092bdacd47ba64aa627"),
-uint256S("5b179e83b7d0f712a68c4cf0b86595a20aa9dbebaa24c98d499ad2ac29b7fd16"),
-uint256S("ac4f31071d499c8f91be89ae55a46261043315689bb5b8ce89e24313e59c8d8a"),
-uint256S("ac4f31071d499c8f91be89ae55a46261043315689bb5b8ce89e24313e59c8d8a"),
-uint256S("40342a8a63ef86fd2573c422d00564ea29aace4553784c54b1fd4e39ab4bdecb"),
-uint256S("654393b48581c41b34fea804b860605ce6114fa32a25d29ad8ec0ba9e032b89c"),
-uint256S("654393b48581c41b34fea804b860605ce6114fa32a25d29ad8ec0ba9e032b89c"),
-uint256S("99db87854457af324e0211dfe6f97ba87604bcda35a6fa10c0287405abab5765"),
-uint256S("99db87854457af324e0211dfe6f97ba87604bcda35a6fa10c0287405abab5765"),
-uint256S("9d88f67809688dafb0362304fc26b2689dcc57babaabb7c203f74cc815fc5fa5"),
-uint256S("a7a4a5a688e77ade386bc1d6bc81a64d720f503bf92ced020bcaa4122eb4c157"),
-uint256S("a7a4a5a688e77ade386bc1d6bc81a64d720f503bf92ced020bcaa4122eb4c157"),
-uint256S("97bdd087b96931caa4ea41f61d290963c804e1d8430debdac12429c679cf9f81"),
-uint256S("00640e1090a7ff67cae6040cdac4f1531f49c74271db873132b86154ebb5c733"),
-uint256S("00640e1090a7ff67cae6040cdac4f1531f49c74271db873132b86154ebb5c733"),
-uint256S("bee0e92a472f919e19ec4e908336362356694d4abdd106783aacd057c2b4b8e9"),
-uint256S("a39c48de6cb7779ef92aec3af8883cfa81d6eae519f105f38e6c0fbb73824df2"),
-uint256S("673285946afa895bbeabae68839ecf03f3cc10c1bb26bcbfb604c60dde212b0e"),
-uint256S("673285946afa895bbeabae68839ecf03f3cc10c1bb26bcbfb604c60dde212b0e"),
-uint256S("b1a6024c016549dbe652dd0688a5afacfe3141104b08f458856f266ed4fb5d78"),
-uint256S("b1a6024c016549dbe652dd0688a5afacfe3141104b08f458856f266ed4fb5d78"),
-uint256S("553c382649449c9fd1f8b6063ef215c02fc77bf8c717cb2e6b0873d118b728d0"),
-uint256S("553c382649449c9fd1f8b6063ef215c02fc77bf8c717cb2e6b0873d118b728d0"),
-uint256S("70e7a43ca58ae006d09a7eb73462e64fd8bd82067d886e5a8239bdc104ddda51"),
-uint256S("a27e44662c450c884d137adb4f47c04127eec2596e89c46ea32732928986bbae"),
-uint256S("a27e44662c450c884d137adb4f47c04127eec2596e89c46ea32732928986bbae"),
-uint256S("7aa606209ff6509146292387992916c2c6ac8fe4a03a76db276b1fe1bdd7928b"),
-uint256S("b127c3ede6e23656b6ed7e9c11f6d670ed5b3b6905be8f667d23c3bfc202af31"),
-uint256S("b127c3ede6e23656b6ed7e9c11f6d670ed5b3b6905be8f667d23c3bfc202af31"),
-uint256S("12feadb5bddf2c10c6bca3b6945963d084a9f31c84944abf5de9fe5cd7e315e6"),
-uint256S("12feadb5bddf2c10c6bca3b6945963d084a9f31c84944abf5de9fe5cd7e315e6"),
-uint256S("d954ec73765bd2a27e892d4f85f88ac89c79f19b7f8dfbf5f258e3868da91c67"),
-uint256S("680445388d7f618be7c47c80d23e50432bb24ee46916d4f26ee5aeadaef4dd0b"),
-uint256S("680445388d7f618be7c47c80d23e50432bb24ee46916d4f26ee5aeadaef4dd0b"),
-uint256S("b0505e792ffa4a61a653e8f2fc46965160b063132d6329cf454a724ed89a04ef"),
-uint256S("b0505e792ffa4a61a653e8f2fc46965160b063132d6329cf454a724ed89a04ef"),
-uint256S("106cd0812018671fc54a56f82366297b8b1a9f42b90622db9c937d48601ffd5c"),
-uint256S("106cd0812018671fc54a56f82366297b8b1a9f42b90622db9c937d48601ffd5c"),
-uint256S("7fdc5ce9328467814f77432b2123a1e79632400c43a7139253bdc8f587d447f9"),
-uint256S("7fdc5ce9328467814f77432b2123a1e79632400c43a7139253bdc8f587d447f9"),
-uint256S("8afa62ce39e13dc55560863f18b78ca39410af1f3678f2065086b2fccc3f32da"),
-uint256S("722066089cdda252ce2fa437d20a2b836d571851e92f3744c86a28952ec3c412"),
-uint256S("722066089cdda252ce2fa437d20a2b836d571851e92f3744c86a28952ec3c412"),
-uint256S("3c4ee58a40efa680199a196676a4dc25fa4e247c47e6a2db59d63baee82e8e37"),
-uint256S("1ef753580ccf5d00cb9e35d8c6b333531ce33050ddcd568ef27cad26f8d4cb4a"),
-uint256S("96818f30d9b235e68b28c316cf7029dbf20c2e0d16f2debe110caebb4a225034"),
-uint256S("96818f30d9b235e68b28c316cf7029dbf20c2e0d16f2debe110caebb4a225034"),
-uint256S("6af250b1e1b02a7080f26fc3251643e27ad11db42f3244171b275ba70c615da5"),
-uint256S("6af250b1e1b02a7080f26fc3251643e27ad11db42f3244171b275ba70c615da5"),
-uint256S("972432d2c5f9d14c7303c06b287ac2a4fa3b6209cf49313fb68310a0e717cbbd"),
-uint256S("972432d2c5f9d14c7303c06b287ac2a4fa3b6209cf49313fb68310a0e717cbbd"),
-uint256S("f189ce9504b19f3e2c9eea720d9cb95d33b91cc3a90879d9dbe06da94e7359f4"),
-uint256S("f189ce9504b19f3e2c9eea720d9cb95d33b91cc3a90879d9dbe06da94e7359f4"),
-uint256S("f1d5daa0fce126ca0af2ad5dfb227b3f26ffde13b67e5e93b5a340c5beb662cb"),
-uint256S("63fefbf04aed6bbbc43fd7e94787a6045dc47cb9fbb0f109c36c268469dabfc2"),
-uint256S("5c2088a0163babdbce10938815e7746e30a01cbe635cb5de59c670e2d7f0ce88"),
-uint256S("5c2088a0163babdbce10938815e7746e30a01cbe635cb5de59c670e2d7f0ce88"),
-uint256S("4e0bb2857774b55fed8c75ef91cd56e9dbb0b13e7a25660739e420645f364cff"),
-uint256S("94f74b89e21f073b53234b506c20265282bdb89f70413607cbe2b61c74b338bc"),
-uint256S("94f74b89e21f073b53234b506c20265282bdb89f70413607cbe2b61c74b338bc"),
-uint256S("db928a47a72f274536a4b57c322abe94fb479e0e67e04cc02701dd81c492db91"),
-uint256S("db928a47a72f274536a4b57c322abe94fb479e0e67e04cc02701dd81c492db91"),
-uint256S("32a673eeacf6a233001cf1c2d9cf1b26457a61863c2b5d52df701fd4f80c1be5"),
-uint256S("3bfa054fd418ca6f4f10c1470e7e9e99009da2663bc93d6a2211452a467b19a8"),
-uint256S("3bfa054fd418ca6f4f10c1470e7e9e99009da2663bc93d6a2211452a467b19a8"),
-uint256S("fb066f6c4d55f960a58f7faf102d1e7c3a63946ce31f6c3b0d735b6df8610246"),
-uint256S("fb066f6c4d55f960a58f7faf102d1e7c3a63946ce31f6c3b0d735b6df8610246"),
-uint256S("7983dc78a0492dea34bc90b1c119ffc0246e2292f0e45587eb6fd6d6b55ba715"),
-uint256S("7983dc78a0492dea34bc90b1c119ffc0246e2292f0e45587eb6fd6d6b55ba715"),
-uint256S("27a20c9db91ab006f5d02a255be5af843aa8180eb0a17078089e0d30d8230afd"),
-uint256S("67f912ff83baf22540896930a8a83ba625604096f21e03a1c641dd9f87a3f041"),
-uint256S("67f912ff83baf22540896930a8a83ba625604096f21e03a1c641dd9f87a3f041"),
-uint256S("e1a00654d2353cafb43c775a8624bbc4fab9f695a2c097fc8c5de50cf08f462c"),
-uint256S("75e2187b8416d79d5f4315d0edd5d5b439df56711237a6e6f2e43c8d09ac13e7"),
-uint256S("75e2187b8416d79d5f4315d0edd5d5b439df56711237a6e6f2e43c8d09ac13e7"),
-uint256S("4242c8405130ac18d4d2649cc0b10e5cbe7b9e8e6a50bff94ec75530704ade27"),
-uint256S("d8eaf385489a10740ad12007936e881f934f95aff34a6f8735e13a1b2cee4b64"),
-uint256S("d8eaf385489a10740ad12007936e881f934f95aff34a6f8735e13a1b2cee4b64"),
-uint256S("0b5e7f4423c49c41d6a915074b373546b8d845582254735e29ba285beaa0a452"),
-uint256S("0b5e7f4423c49c41d6a915074b373546b8d845582254735e29ba285beaa0a452"),
-uint256S("3763161de3f3c29e677ab9efe34dc0afa6edab68554a22c63b24c00c4cfc4285"),
-uint256S("3763161de3f3c29e677ab9efe34dc0afa6edab68554a22c63b24c00c4cfc4285"),
-uint256S("94920420cb451b348ae5a0688eaf4f20017a74fbf533bddc6c11d1b9aa604dca"),
-uint256S("06bdc5b0928429e347ca124635306dd39eb56c313062fc5cd2b152c558a8849c"),
-uint256S("06bdc5b0928429e347ca124635306dd39eb56c313062fc5cd2b152c558a8849c"),
-uint256S("6dcee1733a05d532bfbcc34f02d6a0f444cd0dfd9b0267e9f6ccb5c74adbb27e"),
-uint256S("6dcee1733a05d532bfbcc34f02d6a0f444cd0dfd9b0267e9f6ccb5c74adbb27e"),
-uint256S("63f578a4796d36a49b00da5970fa85c6b2dc260a9da766e34615e83d9ea79ac2"),
-uint256S("2a8dc956a1657e771d5f87ccede4e5b74292c77dc83bb9aec0f8e835ae103406"),
-uint256S("2a8dc956a1657e771d5f87ccede4e5b74292c77dc83bb9aec0f8e835ae103406"),
-uint256S("25a30b5132f51cc5429862b95790466b1bcff7f67328a20ffdbcf3f0d1494c6a"),
-uint256S("25a30b5132f51cc5429862b95790466b1bcff7f67328a20ffdbcf3f0d1494c6a"),
-uint256S("918daf944ec0ad804e167c304061adc71a8b4817d17ea3043d42856c6e48685d"),
-uint256S("cbf4831c8e75ee970300a4d4c7c2d87b788290011b823e6c846cd6076b2c93ab"),
-uint256S("cbf4831c8e75ee970300a4d4c7c2d87b788290011b823e6c846cd6076b2c93ab"),
-uint256S("134639e187dc5c5574712543deebf2bf75e6c027ed089ea718864cb78107764e"),
-uint256S("134639e187dc5c5574712543deebf2bf75e6c027ed089ea718864cb78107764e"),
-uint256S("2d6b5a32a6e23eb9615cf856352f26aac55bc758a0318f3d8223a4f99aa8f3ab"),
-uint256S("afcd4675ea4fbc586dc8b5eb347f4f52cfa29d5c4a9139154f319711b3cfb740"),
-uint256S("afcd4675ea4fbc586dc8b5eb347f4f52cfa29d5c4a9139154f319711b3cfb740"),
-uint256S("51f1410e24574b463e06c47a7dbff92e0f02b42f3d1e124611cc99c35e2d5310"),
-uint256S("51f1410e24574b463e06c47a7dbff92e0f02b42f3d1e124611cc99c35e2d5310"),
-uint256S("b19d41b2876b1b84fe8d2d7c07b8af3d5184b73a2a5b0800f44d12727ea2e1ad"),
-uint256S("b19d41b2876b1b84fe8d2d7c07b8af3d5184b73a2a5b0800f44d12727ea2e1ad"),
-uint256S("523f96fc027ead28fee141ced10b89b5defb009e877b1ff801f967ae96a8fd35"),
-uint256S("523f96fc027ead28fee141ced10b89b5defb009e877b1ff801f967ae96a8fd35"),
-uint256S("b506598f4eeac177b5b5e7a7ec367c56d0de98c1c1414c679d42467bf1aaea1d"),
-uint256S("b506598f4eeac177b5b5e7a7ec367c56d0de98c1c1414c679d42467bf1aaea1d"),
-uint256S("b97fafb677f13099f6aeff36293b374de69760e9e72ebcb97f61520a6c4f4b1e"),
-uint256S("b97fafb677f13099f6aeff36293b374de69760e9e72ebcb97f61520a6c4f4b1e"),
-uint256S("fe7043394b4e5d2aaa555739093d502be9e016be3e725c4bebf8e027439d1f0c"),
-uint256S("fe7043394b4e5d2aaa555739093d502be9e016be3e725c4bebf8e027439d1f0c"),
-uint256S("e0fcdb84a3d9c941ca5c1944b90b4da6d667070e0754fb8cbaf8205a9c91d567"),
-uint256S("d73d07ce202dd0d70478a177d74fad70c6beb7da15cc6960cd73a435e9d67b6f"),
-uint256S("d73d07ce202dd0d70478a177d74fad70c6beb7da15cc6960cd73a435e9d67b6f"),
-uint256S("aae3256b9027b0d33420f400d218f6c09797346ac853af28a2a4239438c8395f"),
-uint256S("aae3256b9027b0d33420f400d218f6c09797346ac853af28a2a4239438c8395f"),
-uint256S("01ad0d6fa3c9f9e682dd9ec11656f2a0010cebdb21222c06343c0dc87bdec78f"),
-uint256S("daf011df98adfc39705287b5e400987d9e0fc4543e7c66763af9ac2a5d319ab8"),
-uint256S("daf011df98adfc39705287b5e400987d9e0fc4543e7c66763af9ac2a5d319ab8"),
-uint256S("3c0635d5deda7fd11f616728ce1f1300ad2afbd5c571021c8d8fd74aea072f1b"),
-uint256S("c076b9bc74d41380e974368f8e9f5cedec650b7a34d05cb1403eae299006b36b"),
-uint256S("0cf663b3902a103caa0306b63c9e2dc73758fe665474384f2988f7a374a6186d"),
-uint256S("0cf663b3902a103caa0306b63c9e2dc73758fe665474384f2988f7a374a6186d"),
-uint256S("afc8780fb693b811bf4def3af0068643cefee9a0426d043c4847c072fe8237cc"),
-uint256S("60325b7869f88e6c141b0cbb20e4e44f3af43de6ded80ae950e83f3b425b8bff"),
-uint256S("2bf3ab4aeefde73d0219eca30c871a8bd009f34d466f107bb6d3b14e26dd6f7c"),
-uint256S("a002ee120b0c252f1bb0e33ef4a1fd661c297dd17b0c4e6c7fb9997cd58e2395"),
-uint256S("a002ee120b0c252f1bb0e33ef4a1fd661c297dd17b0c4e6c7fb9997cd58e2395"),
-uint256S("0b47736ecd789586346ead6c7e4dca53dd98c90998201eeda21e1e35b48dbb84"),
-uint256S("0b47736ecd789586346ead6c7e4dca53dd98c90998201eeda21e1e35b48dbb84"),
-uint256S("48cea1eac52627d4f55de9dab8b36a2b482922c33424b32de1fae04d5d0c0ebd"),
-uint256S("456a8d62b19ed6091823646d95ca4b3a272b8c38e52ee4cfcebbdcd161fde54f"),
-uint256S("456a8d62b19ed6091823646d95ca4b3a272b8c38e52ee4cfcebbdcd161fde54f"),
-uint256S("02d452e03869054fbb49986e5943b249255fd2f7c556b18dd8e7ff52e00eb4ac"),
-uint256S("02d452e03869054fbb49986e5943b249255fd2f7c556b18dd8e7ff52e00eb4ac"),
-uint256S("540a2db057350e0ab3d6b845776faef457ae6b856f29b980791524261d2cc3de"),
-uint256S("540a2db057350e0ab3d6b845776faef457ae6b856f29b980791524261d2cc3de"),
-uint256S("6e7baa95cacb3655763b99f312e3d7705f67bb3747d03998f04a07b3e645fad1"),
-uint256S("6e7baa95cacb3655763b99f312e3d7705f67bb3747d03998f04a07b3e645fad1"),
-uint256S("bb147e97468239c51627d277f338ccca31140285e9f004f7321700c7210c222f"),
-uint256S("bb147e97468239c51627d277f338ccca31140285e9f004f7321700c7210c222f"),
-uint256S("a2c5dbf01eb0ebedbe8e6a82fe0cfde71c48449b04ee71eb4247bd24b8767467"),
-uint256S("a2c5dbf01eb0ebedbe8e6a82fe0cfde71c48449b04ee71eb4247bd24b8767467"),
-uint256S("720d82ed718c9c0f921c3e60317694fe90efc29df9de66393883c32606ffb34e"),
-uint256S("dc9ffacc9addf3e213332023308352b5d44764685c128ddee3c10401ec97a104"),
-uint256S("ed2ea1d0093990d23b145b558b1db592615974fe713a9fd9eb5fbdea49d7608e"),
-uint256S("ed2ea1d0093990d23b145b558b1db592615974fe713a9fd9eb5fbdea49d7608e"),
-uint256S("f23f2fa868bd45fea4230ac04c5775d31733d130c053c5a7c5ebc86810685c36"),
-uint256S("f23f2fa868bd45fea4230ac04c5775d31733d130c053c5a7c5ebc86810685c36"),
-uint256S("c20e42c6aa09d6a0296fae6f955d9e6fe7498178ae53725bd4d45774bdcd6d8e"),
-uint256S("80d4d725992f7a42980f39bdc8b7c7685bc0e8305dcbd0ea57cec1915cc8e356"),
-uint256S("232cecfc246ca95ef82c61bf0cda578cfc25e770d034d684e7a8720872400533"),
-uint256S("43d519a4ef68375f93b37cee15ada050ec710517efcfafe9cba85a173147de71"),
-uint256S("2aa7ae6266df201c06bcd450d38c3e01903147c1527eb90f72213cf76dd6d7c0"),
-uint256S("8e1b24f5b370ec8457d7935fb4c690966166cb00bdd489d2ab4abd36aeda2adf"),
-uint256S("3028f5049ab85177e0f9999c4d344a3e6904cadb67bd04c7329ed3dffce3ab47"),
-uint256S("39c3a11afd385172be7fd6d57d0277bdca9f29c5ef9b75c0b93b5261df3b0bb4"),
-uint256S("0285de4f742ebf3a31fd2b9a767ce38ba3cfe1143f9cb4b7d48ad1292633dea1"),
-uint256S("0285de4f742ebf3a31fd2b9a767ce38ba3cfe1143f9cb4b7d48ad1292633dea1"),
-uint256S("b769338e4c495dd909a7eb7da084ff10d35a741d7c80067f8f2c581212fd22ea"),
-uint256S("c83908321bf4663f129472f251aa332aa61930223b82ea98fe19f8f5c57fa7ed"),
-uint256S("c83908321bf4663f129472f251aa332aa61930223b82ea98fe19f8f5c57fa7ed"),
-uint256S("c938ddf4e79af5f4d9285f2bc013dfa34e382354c0247b43743a326fffc2fa41"),
-uint256S("e2aa719e3f084e724adecf45c69537e84542302aacc047e9c3cf95ed48b0ff13"),
-uint256S("e2aa719e3f084e724adecf45c69537e84542302aacc047e9c3cf95ed48b0ff13"),
-uint256S("e9a77cf81e5d4266c13537f787c35f999862b789da7109046d3236431ac06724"),
-uint256S("e9a77cf81e5d4266c13537f787c35f999862b789da7109046d3236431ac06724"),
-uint256S("57b96a6c41b09d963f529760f6186dd2de373c538947e1ddf5cbc809b57415a9"),
-uint256S("57b96a6c41b09d963f529760f6186dd2de373c538947e1ddf5cbc809b57415a9"),
-uint256S("005749018b49ead72092011d19791cd1e060e87ca366c8df7100b18818e7de6b"),
-uint256S("ff1d6b445ad5b8e8074b8fbfd8bd567c76b56a38064d5dcae2768de6bdbb8072"),
-uint256S("39ae82121e8587c04c5c6bb7b2481707b9669f4bddb3f9a606c03d660c371b51"),
-uint256S("39ae82121e8587c04c5c6bb7b2481707b9669f4bddb3f9a606c03d660c371b51"),
-uint256S("28d0d43e7a51f4c796d884169afe06fd6a6eef9c40de67bccbbc9352044757ee"),
-uint256S("ef97cb159f44b3b69174978f478a613d1692fa421fd663753c85eb3f9780b0fc"),
-uint256S("0fcb825e8b44577eebcb7a2946a882290eca547e23df354b34aef6543e5e3939"),
-uint256S("0fcb825e8b44577eebcb7a2946a882290eca547e23df354b34aef6543e5e3939"),
-uint256S("ac8406e43e32a1bb95f9875a59a5fa114ac2787bbf05ea6597cf60694e2e9863"),
-uint256S("57dd80921167cca4085b0b368e2efc47aa958064c7c22a8b2bbe8e82e24aae31"),
-uint256S("57dd80921167cca4085b0b368e2efc47aa958064c7c22a8b2bbe8e82e24aae31"),
-uint256S("db18f45bfc28a7650c1fe69a1306e6b0324baf19ea120b7660fa15b5f5af09da"),
-uint256S("db18f45bfc28a7650c1fe69a1306e6b0324baf19ea120b7660fa15b5f5af09da"),
-uint256S("1fc7df27e0ed6b977af7417ecb4f39225e5e4b4ba9330767d4ff86eee23706f3"),
-uint256S("35e51eb7d07d32d076d740947cdbe70861fedeb4f1d6f68a2258c6f4e4437cda"),
-uint256S("35e51eb7d07d32d076d740947cdbe70861fedeb4f1d6f68a2258c6f4e4437cda"),
-uint256S("064a7bdcc2e51c305288cc6de2374527e2cc44325ec7008aa7d28dd1c054eec2"),
-uint256S("2b5a86f340c30bf7f5c415d2049f4766ad843a76d3059cc9fbd21f31a0e1770d"),
-uint256S("f48fb16798184cd8209fd58ddb485448312a682b2a4b27db494222030074c0b6"),
-uint256S("870065868bc9baf0204a1f54c4b2b3c086982271822abef9c637d79f0cc780e3"),
-uint256S("870065868bc9baf0204a1f54c4b2b3c086982271822abef9c637d79f0cc780e3"),
-uint256S("541064023a30564b1290fcb4fcf8b22594d47006b8445b32f33bcc51b4c02ca6"),
-uint256S("cda012761d9ea46f666f5040645bc39fee1e38700da30cf27bcddade5afaad02"),
-uint256S("e4b271df75c9c2b94e01ff6e7a58454ba2aca88bb4431e0445954c165ba97350"),
-uint256S("e4b271df75c9c2b94e01ff6e7a58454ba2aca88bb4431e0445954c165ba97350"),
-uint256S("868db22ba9d38c292397c85ec3f28fde1d7bf70119227974a0fa886f75fb3834"),
-uint256S("acc8e56e65dd56f7f07b9c134c28a2ce095379c6ad1c99b6f632d61d82a362a3"),
-uint256S("acc8e56e65dd56f7f07b9c134c28a2ce095379c6ad1c99b6f632d61d82a362a3"),
-uint256S("b3bfe06acdfeed6195d634e5c919ddbda471c23cf3e86f76ecbb050e502b209a"),
-uint256S("5fd3ada4947e48a8f49eab4319379b115a2ece07d15e3f18d7bc6a5b54fa893c"),
-uint256S("a79e92fa7e0fd60f2daf1de5f5ac9191533079d44aa676b4010ab64aa5ae0abd"),
-uint256S("2b3015fba0afd90bf642c824e711707399b24d125dbddab404cb7524dcd5ff19"),
-uint256S("2b3015fba0afd90bf642c824e711707399b24d125dbddab404cb7524dcd5ff19"),
-uint256S("cd7d09a20a77bfc6796285e8249d96a4a1261186bd4d9d8601baa4657459b03d"),
-uint256S("4d7b5c8fb1c98bb49ad3f395d18ab0f112fdd30f784e5ec86d8f2c2c683df8f6"),
-uint256S("4d7b5c8fb1c98bb49ad3f395d18ab0f112fdd30f784e5ec86d8f2c2c683df8f6"),
-uint256S("4ee09e069b8d7f4c904e025571bf98bc402483a12a35dcd2e66d3a0ac0cd7200"),
-uint256S("0bedc097989e43e848f709bc52a2641e3474aaa5013252886c983e5ab284577c"),
-uint256S("0bedc097989e43e848f709bc52a2641e3474aaa5013252886c983e5ab284577c"),
-uint256S("596ef5d47503ed01da4e1ac6ee89588b97b4451d1705da4443800ab5c467909b"),
-uint256S("596ef5d47503ed01da4e1ac6ee89588b97b4451d1705da4443800ab5c467909b"),
-uint256S("3a97f80b0aa43f0776d6b5e26b9be7631a7b610cf3adc9b363c057abcda3f319"),
-uint256S("dfbd41d6445ddc7f03cec7973064c5cf192b3893e35761af99a8914ba03a2a6c"),
-uint256S("6f2eeb8ea95fa28412c701c3cd2caf40b56c000914fd866dac00a552a01504e0"),
-uint256S("099f3997853b0edc8723c677ba65d5dec6e5c1d1a5438b6ee0ba469508690f75"),
-uint256S("cf2cc52a18c025b686974063811839d96fe6e11a2ac4599f8c7e799812aaae9e"),
-uint256S("c7a14721c158294649166e1c03c1f76e9e4d3d751e9fedbb459c25e702a103ce"),
-uint256S("30d37ae70b926aa9131226a722abb65903048b4eaecd1d618bdbabe7a05ac057"),
-uint256S("4a4ab8b34b98a3ccf8a2fcdb1ae3f7212f87f045c01f2b1d445d40db73e37fa3"),
-uint256S("24441714a61f8f5f5be61ec02bc8f09d4845da3580eab62d0614c87598bbfe85"),
-uint256S("24441714a61f8f5f5be61ec02bc8f09d4845da3580eab62d0614c87598bbfe85"),
-uint256S("2a8f703505c91c3acdd00d701ba980d2d369e367b7301752375a26902f74c817"),
-uint256S("01686e731bb4c747f6ee2ef3264637abe0849a7caf3f158c102777a23eb3b27a"),
-uint256S("01686e731bb4c747f6ee2ef3264637abe0849a7caf3f158c102777a23eb3b27a"),
-uint256S("b989308d1536863d9db45ac8e42878d43abc5b7df4277d8764319d968ef10423"),
-uint256S("fc342e353e05e9ddf2b41e4716fb1443561c54c05b2efa7394a3a21577536821"),
-uint256S("ee9ff5c1cb28a8c058dc5dfd50985da0f381bdc47a0473d3d23a41bdc75b3d59"),
-uint256S("ee9ff5c1cb28a8c058dc5dfd50985da0f381bdc47a0473d3d23a41bdc75b3d59"),
-uint256S("70fa728ad7925bbefe7c0285b2da46adc972f54d0255078bc45894c348e2cd2e"),
-uint256S("70fa728ad7925bbefe7c0285b2da46adc972f54d0255078bc45894c348e2cd2e"),
-uint256S("8a7a6126890070600469422c435068904ce914dbaff478c5981bf8943cc5d9a2"),
-uint256S("8a7a6126890070600469422c435068904ce914dbaff478c5981bf8943cc5d9a2"),
-uint256S("58a8736de3bfb35e59325648bb2b468a1afa4f47e25da3f6acc96bdf7d35fc4a"),
-uint256S("7a8159456d3a4afbc28e4ceeea4482c94e112f413ec7ed05f65fc89d999e3a20"),
-uint256S("173a2382416aa4892afaf8a684ddc474d32e003927baa8cbce515d3e53645df0"),
-uint256S("173a2382416aa4892afaf8a684ddc474d32e003927baa8cbce515d3e53645df0"),
-uint256S("aef4cea6053f392f4f1503d1febe5d7de5993a1ea0ac12f0f65f06ed47223a1a"),
-uint256S("7e9b2ba252adaf9a8da9b1fc90954047745490327ad7d83c5f03ae1579196d8b"),
-uint256S("b6dfb41fefbd6cebcc2b2ec74579bc56fde6a36d315d8f92d3ae1d8ba5760b95"),
-uint256S("b6dfb41fefbd6cebcc2b2ec74579bc56fde6a36d315d8f92d3ae1d8ba5760b95"),
-uint256S("88c17252229d72d2487e8c5664e290b827b85fd0500b41b5a058946c0594b5f8"),
-uint256S("88c17252229d72d2487e8c5664e290b827b85fd0500b41b5a058946c0594b5f8"),
-uint256S("700ca44131807119e7db7758f63e8ec03eaf08b2b49a752cc1095257bbf32e8e"),
-uint256S("700ca44131807119e7db7758f63e8ec03eaf08b2b49a752cc1095257bbf32e8e"),
-uint256S("a9bc81dec122ecb9de649ffd057eb949aef9f98fa3c5609565474d22d85c1184"),
-uint256S("0694086febb0a77ed5596c294174d4962b53a83d5aa71396966fe8efaebcaa9d"),
-uint256S("0c7384b1de8a7c8ef513fdc8e94671eab49b51b949ce1f7ac2bb8f1d81782590"),
-uint256S("cd5e5d5fd4de27c89de257292871f5a26caaa9afce10662dd1d93db13258b9f1"),
-uint256S("68d64d6d36617a28115d9d09e51bbe9a1883b6a536705ff1ad2aca4750b5f05e"),
-uint256S("68d64d6d36617a28115d9d09e51bbe9a1883b6a536705ff1ad2aca4750b5f05e"),
-uint256S("53433cce92f7e6a6fce7b8936d87c82d38ab984928f233e439fc9970d1effbe8"),
-uint256S("53433cce92f7e6a6fce7b8936d87c82d38ab984928f233e439fc9970d1effbe8"),
-uint256S("082860a3830b5daeff9b59dfc28f330a4c0ea0476edafddd50e9f635ae085721"),
-uint256S("082860a3830b5daeff9b59dfc28f330a4c0ea0476edafddd50e9f635ae085721"),
-uint256S("26889548d8e462a69b7c6dfe540b4972bb505ed448d6d5e5e57e064bef404236"),
-uint256S("26889548d8e462a69b7c6dfe540b4972bb505ed448d6d5e5e57e064bef404236"),
-uint256S("a5d62cd073cf491c4f3634b9eaef7fe116494c86216f693173b1e2aa4894f252"),
-uint256S("c2b5dd210196e1ef8f820f0ce5c017cd297580d3675fd76669f0b939aaeef119"),
-uint256S("4101797c673bfb172706fa4bf255c7a174b1dd2aa56e010d0c61b19b382786bf"),
-uint256S("21f94da4b0825c3243bc91204b8a6e37633345d01b4fa90c50269c456237e575"),
-uint256S("4b05dccc682fbe5906da089a966fb922db0deb6ce84dcf6ff8cb3eb625682ef6"),
-uint256S("c980317da408647218bc2b160f4c539c9f8df29c98170872905b80f3857a4677"),
-uint256S("51b1ff42d361c233710dbe4f048dcf51a51ed250a9355366cf869a8aef492c19"),
-uint256S("947558fcf4553192be6e8c27c4645a8356435e4abaae5c4c89884896ed865d00"),
-uint256S("947558fcf4553192be6e8c27c4645a8356435e4abaae5c4c89884896ed865d00"),
-uint256S("80a4f83a03611111778b4c8648c5553347788814aecaf4adb7874ac93e9f256d"),
-uint256S("68514f3992de250fc3c80b5a670f584ce90f0415ebec9ff55f3a37b836ae9246"),
-uint256S("f713c1b879c1a74b8bd908e19c50c681de042365271e5ffe48d3f70ca8715f91"),
-uint256S("f713c1b879c1a74b8bd908e19c50c681de042365271e5ffe48d3f70ca8715f91"),
-uint256S("8349d852751cf80d817605bdd027ef46f2bac875e126043170c9235aaf4db977"),
-uint256S("8326ba7e223929e3494ba36d0b45f79d2a056ec8ffcb3b18235aa269b6937cbe"),
-uint256S("8326ba7e223929e3494ba36d0b45f79d2a056ec8ffcb3b18235aa269b6937cbe"),
-uint256S("07f83954f3e320c16853a0039e55ae0af6a566ca328c78c4e55b0466f6b1da3f"),
-uint256S("6fa9c9486be94cafd5d95f04b17c41dd3ddca9508065da8a340e32093f630ed8"),
-uint256S("6fa9c9486be94cafd5d95f04b17c41dd3ddca9508065da8a340e32093f630ed8"),
-uint256S("f421b7794c933d42d0f621110fdf83e6cecb9e0daf6115a1353067656bf00154"),
-uint256S("aeb726404152cb54a5ec565605243d962cc74e2fc7c4300ac3b7a2070daf4e02"),
-uint256S("aeb726404152cb54a5ec565605243d962cc74e2fc7c4300ac3b7a2070daf4e02"),
-uint256S("9fa87fbb043ecb0fda6e2eb29a09acd6f59d23aa71a3ca75cfefef2a74680a12"),
-uint256S("25fe9f46aa6d16d857dd1105702489b4b44985e83fdfb5c77e60c2c59f5b57d1"),
-uint256S("25fe9f46aa6d16d857dd1105702489b4b44985e83fdfb5c77e60c2c59f5b57d1"),
-uint256S("d4074d3d8942dc0608d72c13579bdb22c44592d65889967f6beff27ffb0feefb"),
-uint256S("d4074d3d8942dc0608d72c13579bdb22c44592d65889967f6beff27ffb0feefb"),
-uint256S("71fec6e74ba48dbc13c4eca4f4d7ec02f0b8fb9c7db7fbf2000b68f2e2aad061"),
-uint256S("71fec6e74ba48dbc13c4eca4f4d7ec02f0b8fb9c7db7fbf2000b68f2e2aad061"),
-uint256S("5c41de8782b511601d05c8b74d3730e89487981e383a33b21c946319385a5013"),
-uint256S("ea736551ceb0ab959f62073af46b7efbb71871870c1ffb46c6e7e1f5a83e0866"),
-uint256S("7c85b11ef4cd1b2b75f1ae3ff351e6781c900a70dce3d49c99464aabe78e24f1"),
-uint256S("7c85b11ef4cd1b2b75f1ae3ff351e6781c900a70dce3d49c99464aabe78e24f1"),
-uint256S("7b8319a3a81de3081c2210a44816533443e9ee02c5b69f2de358a1d51b126677"),
-uint256S("7b8319a3a81de3081c2210a44816533443e9ee02c5b69f2de358a1d51b126677"),
-uint256S("492ad8ffa122bf554926e50515eaf8f36dc21f6fceb250e1dc910559a9f365b8"),
-uint256S("492ad8ffa122bf554926e50515eaf8f36dc21f6fceb250e1dc910559a9f365b8"),
-uint256S("73e72d07c1db561cd0dec04efc2e2a3ee40a61ab99b542907f32861eb0e22a07"),
-uint256S("73e72d07c1db561cd0dec04efc2e2a3ee40a61ab99b542907f32861eb0e22a07"),
-uint256S("29a450af799c8a8c3cfc633bfcc19a852c9cfa52781f9a24c45d3407b38e73b8"),
-uint256S("29a450af799c8a8c3cfc633bfcc19a852c9cfa52781f9a24c45d3407b38e73b8"),
-uint256S("04474dd6072bd04aae93d1d4c7ca5fed2fcbd32b482edddc8f1f8b530d123471"),
-uint256S("efc6743d0ddf8df7f5d82fb10ce827a2286379cf44323439c74b79279a73b320"),
-uint256S("f34fbe2616ebb67d9452b8de2b3a635f8ac8f901f27f0e78f90ad67cd717d01c"),
-uint256S("e8454e8bbb495307bbefe2ee5b4ce837c32892469011aeb2c09933ee8c4ebba5"),
-uint256S("e1a7f13429be4e3e73d5eb2919d7f19af3d6cbe2b610a59623ddb368164d8add"),
-uint256S("e1a7f13429be4e3e73d5eb2919d7f19af3d6cbe2b610a59623ddb368164d8add"),
-uint256S("b021c58339c27998edc6a62ba476c19d1ee4d9e93991161e77bea91a78180dde"),
-uint256S("b021c58339c27998edc6a62ba476c19d1ee4d9e93991161e77bea91a78180dde"),
-uint256S("0e360fc89fa828f8b373143624f7057cda16927b210f2bc3b74b78a9565b1b81"),
-uint256S("0e360fc89fa828f8b373143624f7057cda16927b210f2bc3b74b78a9565b1b81"),
-uint256S("bd10d7c3a56b7a3131c47129fb697fbbedaee3e5cc22d5730d82d75620cdb59f"),
-uint256S("051f5d718b36458786fc0203f9faa1ed3d18ed7d7cd70bb088055208b42f2d0c"),
-uint256S("3133918639ab2e58a6e3e532a61b49cb7bd354f4ce3caac0fa33c3faa43aa333"),
-uint256S("3133918639ab2e58a6e3e532a61b49cb7bd354f4ce3caac0fa33c3faa43aa333"),
-uint256S("0eacb2f9d9ba28b3893e6c93d9e333c85636f280de0fe29732b1f23111ce6e3d"),
-uint256S("0eacb2f9d9ba28b3893e6c93d9e333c85636f280de0fe29732b1f23111ce6e3d"),
-uint256S("8539d1fad9d43f56fbe2d9953b86c84d34fcb4ec75545336187d63971a100b93"),
-uint256S("e8ce42aac8d587beba0e3d0d715f9a2fb6ca230fc67c040902b58eb106d19f6c"),
-uint256S("e8ce42aac8d587beba0e3d0d715f9a2fb6ca230fc67c040902b58eb106d19f6c"),
-uint256S("3ca5bd2e34fbf732d290536486b3bcb84b15e63e788084cf550561d6b60bb8ff"),
-uint256S("3ca5bd2e34fbf732d290536486b3bcb84b15e63e788084cf550561d6b60bb8ff"),
-uint256S("349d509d5f998f74260da45248b1b5ebb3700c4bb8c49d4f740dc26f5ce9ec70"),
-uint256S("349d509d5f998f74260da45248b1b5ebb3700c4bb8c49d4f740dc26f5ce9ec70"),
-uint256S("93ddb72140e1f83d960d995ebcdf1f93aff6365dabd3bdb358c1a27e60817475"),
-uint256S("4f643981bb2c282fd43372aad1b4f6fbda6338a457ae4b6bff5525674a3db850"),
-uint256S("e7a87b10cc8bfcbc7a8e2530be3bf2dc23246d1e29d514049ebe87af59ea5e71"),
-uint256S("6b2f1b4f95fe78ce711c5bce9d7c447c8d7dc8929ff2a00a283af1b379615afd"),
-uint256S("4fe1c24155c8955db9dad88eb85a3c481bf1df8ea0f0d2c0d52ad13e359358c5"),
-uint256S("4fe1c24155c8955db9dad88eb85a3c481bf1df8ea0f0d2c0d52ad13e359358c5"),
-uint256S("fa5985a05a4b5ec8f1db752d817d333e5f3448389655957366870de9478bb122"),
-uint256S("fa5985a05a4b5ec8f1db752d817d333e5f3448389655957366870de9478bb122"),
-uint256S("e01c79b4cfbffd320109459ddb13457454a2976a9e125188349c77e4c5844e04"),
-uint256S("e01c79b4cfbffd320109459ddb13457454a2976a9e125188349c77e4c5844e04"),
-uint256S("eccb5a564c70cb85f91a811c662e7afffef0d3d5dc4886b06517997057b0a60f"),
-uint256S("5f9026ee5be51f0cd62988e40ad2133edb6e1919d2e99c95b744346774a2a4cd"),
-uint256S("5f9026ee5be51f0cd62988e40ad2133edb6e1919d2e99c95b744346774a2a4cd"),
-uint256S("c8506fcd09617920aa5d2119915a30e8cc6af7a4796a7bdd877718e9d305b21e"),
-uint256S("c8506fcd09617920aa5d2119915a30e8cc6af7a4796a7bdd877718e9d305b21e"),
-uint256S("5fabd559c96cbfe06acda4ceca3040ee2224f62f813a26934ef51c885b01209d"),
-uint256S("5fabd559c96cbfe06acda4ceca3040ee2224f62f813a26934ef51c885b01209d"),
-uint256S("bcb8d33c4d5800ee02204c0e5f77d99ead9e93fb2d489a185c73ce824fe6b9b1"),
-uint256S("652a62a7b2ffb3746a6fca3aef4d9d42b8973304ebdb5540c6cb542e48610e32"),
-uint256S("652a62a7b2ffb3746a6fca3aef4d9d42b8973304ebdb5540c6cb542e48610e32"),
-uint256S("5788be7af963f909d91957244c3b734c1e47ccfbd48c43cc3209064f50266559"),
-uint256S("5788be7af963f909d91957244c3b734c1e47ccfbd48c43cc3209064f50266559"),
-uint256S("5d8ec12f688be77490717c740def5de284256a48ca8f34226e7621cbee272942"),
-uint256S("0c3a3de336415e773d4a8d583e53d3eb07673472c80cc2d89d3f2446610818ae"),
-uint256S("e05909a5d0e99e16ea467b41a678f750285ae284f2129ead6c818316aa091340"),
-uint256S("e05909a5d0e99e16ea467b41a678f750285ae284f2129ead6c818316aa091340"),
-uint256S("ede85333561aed003365ad8b57174ceef9a4b0de25c28d37f9034b37f697e07c"),
-uint256S("52b66d02cab836d9d6df15390b7922d1163cbe35b04c233eda84d231d5a5ff47"),
-uint256S("52b66d02cab836d9d6df15390b7922d1163cbe35b04c233eda84d231d5a5ff47"),
-uint256S("c17fb70536e8186a27ac60fb316ff675c303b9166394de2d8902badf07575974"),
-uint256S("c17fb70536e8186a27ac60fb316ff675c303b9166394de2d8902badf07575974"),
-uint256S("8bfca3081e04058cea6495fa2b47f07d5b658b993e1fbc5d4a5e10fab00858a8"),
-uint256S("6078c59839f6e46e18c30f372cb90e9abda9998a0aa2f4a3980a0dd8814c69b9"),
-uint256S("6078c59839f6e46e18c30f372cb90e9abda9998a0aa2f4a3980a0dd8814c69b9"),
-uint256S("791d9ffe3d017c030033723d3df3715b4f15cd1e597a9b0fdfadba157691d1e9"),
-uint256S("791d9ffe3d017c030033723d3df3715b4f15cd1e597a9b0fdfadba157691d1e9"),
-uint256S("b72a8f3d170187e0f6c7c82421d6ad7b2b50cea43434a02d1e38dcae0eb0ef40"),
-uint256S("b72a8f3d170187e0f6c7c82421d6ad7b2b50cea43434a02d1e38dcae0eb0ef40"),
-uint256S("8258069aaa9067bb59e59285f53a6d59ecbc92b7dea040a0c1d633cf82cf5a71"),
-uint256S("5078be21def1815c633d3419efc007a85820ab7c3029d10218cef4d931467e6f"),
-uint256S("5078be21def1815c633d3419efc007a85820ab7c3029d10218cef4d931467e6f"),
-uint256S("e7a70b434856327affd65c039053de8fa19f800bb16fc73086a6b9d2976f1617"),
-uint256S("d8ee04f39756a0257aa27df682885db0a419553829a82ce811f94c97b65a9f22"),
-uint256S("d8ee04f39756a0257aa27df682885db0a419553829a82ce811f94c97b65a9f22"),
-uint256S("29a065266c604786397a9c6dde9fdeb98f7d269cc1dd8328b770f8306831ef13"),
-uint256S("893b194caef6f40efd8b2e6fd47bbd9a3b29667c55fd8b9ae71dba10f57d7372"),
-uint256S("893b194caef6f40efd8b2e6fd47bbd9a3b29667c55fd8b9ae71dba10f57d7372"),
-uint256S("a2c66b99927f838659b34671f6038c5b3dc2bad0c3d2c5d8752d856f483709dd"),
-uint256S("293b29d10e3988abcbf9a10ee9d559a67b0da9b1f54e13c4f087ceb3341d62cb"),
-uint256S("63c9f3a6b326ab7479fa1f5bdbf6eeb7f8fd9f629bf8f74829aed109c7b452da"),
-uint256S("0c4d3f3505a44cd87bc1faeb22ed7c063ac634d7540873769aea0abbd18731ce"),
-uint256S("0c4d3f3505a44cd87bc1faeb22ed7c063ac634d7540873769aea0abbd18731ce"),
-uint256S("e9e77d64b7698a7dad24f02f8494bcc0fbe47d10c73716ec4442f7198a8829f8"),
-uint256S("e9e77d64b7698a7dad24f02f8494bcc0fbe47d10c73716ec4442f7198a8829f8"),
-uint256S("7e2c147d83033d4db6d9c3aab43395cc59dc33e7f83f9495342d5fd07dcbedab"),
-uint256S("7e2c147d83033d4db6d9c3aab43395cc59dc33e7f83f9495342d5fd07dcbedab"),
-uint256S("dc5459e8f2ecaefedf1e4a3e0468b16be1a6747e84d93517c40728e856807f5a"),
-uint256S("7802d49842d155f52c374fc7d88eba6287d0e1de0cacbb5a47a67fe7316e7992"),
-uint256S("43fec8825cdd3aab68e75bc20ee345a6f0ca63d6a13cf2764bd9be0c7b4304bb"),
-uint256S("8aca271fd2b75dabd9e1bf7ce74a0ea25b4abed9f039a1353d986ad5ad4b470c"),
-uint256S("4d3c727ad97dc47bb23cb346c77c6d171862e9649a9d681d4a14b860df03cca9"),
-uint256S("393e46c73e898bd64de3725c8f7e9301be030594b2c8bf539cb466be71b94e84"),
-uint256S("393e46c73e898bd64de3725c8f7e9301be030594b2c8bf539cb466be71b94e84"),
-uint256S("f16706f77f543fcb26266b8bc68f4e1808de3508d28e238c8726d243dc96b0a6"),
-uint256S("152c7d6846483b732a0a3f2c68fd9e3ec6306c57b490c01392bc178ed8acc3f8"),
-uint256S("152c7d6846483b732a0a3f2c68fd9e3ec6306c57b490c01392bc178ed8acc3f8"),
-uint256S("dfe18db81df6f1f0f5b2c109a7ab71de6f06e77a010e9d369ddd5fdea0e9f5ec"),
-uint256S("4edfec66e84bccaf2d641e97c4412537a984b5ef8cff5e77eac655fe0cf61641"),
-uint256S("4edfec66e84bccaf2d641e97c4412537a984b5ef8cff5e77eac655fe0cf61641"),
-uint256S("1d9cf5592a23f3c5d60215e24171c9b5fe5d73f7c94396a078235c9010762707"),
-uint256S("1d9cf5592a23f3c5d60215e24171c9b5fe5d73f7c94396a078235c9010762707"),
-uint256S("698dab219f6ed1c1d7bd018eb1741be6aa71fd55fe35c9dc1c6e4831102a5f81"),
-uint256S("4f1558cb64fe6980e3b77a835d6a00d9ee827da010254c5f629486e76459fa08"),
-uint256S("4f1558cb64fe6980e3b77a835d6a00d9ee827da010254c5f629486e76459fa08"),
-uint256S("b8aea32235c67686125698b64969fe9dc0700ebd0785ca81d46bac3acc3713a5"),
-uint256S("b8aea32235c67686125698b64969fe9dc0700ebd0785ca81d46bac3acc3713a5"),
-uint256S("79eb52b5d5287faadf11b72323c72112556520ce62bab00b274d0c69053d1c17"),
-uint256S("8bdaf2af51d7e51898c1a93a69ba206acc26634389f9798e7d5f9989184bedb0"),
-uint256S("726dea64d8c7bb3dc8790005423d8d2703c5d6f3144d7c09f3baae3ad0586173"),
-uint256S("726dea64d8c7bb3dc8790005423d8d2703c5d6f3144d7c09f3baae3ad0586173"),
-uint256S("d9efe21a9864f1df26509a8855e9adb0b71c5705547c87badfc857765783d7c7"),
-uint256S("be3a2bac18a41222d32d9efeae26e284cb5e478aa4d05a57ed89d8bed30f7a96"),
-uint256S("6b0cd3d95ff65bdda4a2ed6c5a787e6317e77d20ce5b1c47e392017c3f0e5c94"),
-uint256S("052b6ad4c492a5f4b43bc297d47ccaf97003df2f62b8aa037f0246a4f1b0d693"),
-uint256S("094796d072ca4fe512130a6a591ab0fee64ed6ae2e5eb17ef0142ffec9a1e32d"),
-uint256S("094796d072ca4fe512130a6a591ab0fee64ed6ae2e5eb17ef0142ffec9a1e32d"),
-uint256S("0ef8b90df2ee6161ed901a05819e63823d88a5b9f1ab92d7616cfe44b51f9b6a"),
-uint256S("0ef8b90df2ee6161ed901a05819e63823d88a5b9f1ab92d7616cfe44b51f9b6a"),
-uint256S("9f784e62dd6042a5b185bfd4b0c5639334d9240d749747c7e956f68708a7c79a"),
-uint256S("9f784e62dd6042a5b185bfd4b0c5639334d9240d749747c7e956f68708a7c79a"),
-uint256S("74b4c63c2de738fd7d8bf514faa20fe6e9146f3581828c3d062331061addd9f5"),
-uint256S("17fb53063f204ed868a4eed342d10f6a4e13c6c099aecaf7041f1a911794e47f"),
-uint256S("17fb53063f204ed868a4eed342d10f6a4e13c6c099aecaf7041f1a911794e47f"),
-uint256S("92952091af7196d48b0c0e595d94d6af21fe93bb6f8eeae94132661fa9a08870"),
-uint256S("1918589fb3cda60117006128a5c4acb46cc271b1a538df32bd48a3e4a59a6894"),
-uint256S("1918589fb3cda60117006128a5c4acb46cc271b1a538df32bd48a3e4a59a6894"),
-uint256S("0489794a4220f125debc476392cdc695bd1cd024e6877a199a497de05f71aa5c"),
-uint256S("0489794a4220f125debc476392cdc695bd1cd024e6877a199a497de05f71aa5c"),
-uint256S("3d621174054962ae818c62bd75d588720eeabe1933bea2fef5f8a4dee59ce517"),
-uint256S("78222bba87d62cb1cacfc4f9e6d63aaafae902587ca68ea45b3a1ace4c2b85e7"),
-uint256S("78222bba87d62cb1cacfc4f9e6d63aaafae902587ca68ea45b3a1ace4c2b85e7"),
-uint256S("412cca8c5c52589517d76a38a4f62a1cee11a0ef11b20878bafd71afb94a0619"),
-uint256S("9f15413e8ab5759cb285356edd9f5f22b0b971ac5d8c21ee8d1586da0e43ddf7"),
-uint256S("994dabc41002868c99dcaa9d7de86ba0e18296d6785e22b8bdd08076eedfc17e"),
-uint256S("b4f98b3af9856b3f2a32b5c6877c5d5e55c43fb8300699ac0adcee7bcf33a473"),
-uint256S("b4f98b3af9856b3f2a32b5c6877c5d5e55c43fb8300699ac0adcee7bcf33a473"),
-uint256S("d9da3401efadece6f2897480019392e0899292788fbaedbee9f8fc331ea9513f"),
-uint256S("d9da3401efadece6f2897480019392e0899292788fbaedbee9f8fc331ea9513f"),
-uint256S("8d737074952f056aaf5754e723e8a402c952ca2f55cc3914e98c16c9ec6ba7c5"),
-uint256S("763988a65729e33ce0ec0f246d390c305a2bb2c6a4f14218bb9980d7ad050eaf"),
-uint256S("cbbeb9bdad9a4c678285a4de9f744b4586ec87a7fcf5ab5ddd08fe5c705b9c88"),
-uint256S("cbbeb9bdad9a4c678285a4de9f744b4586ec87a7fcf5ab5ddd08fe5c705b9c88"),
-uint256S("0bb9c970a05f11021e1ad19574a12ab001ccb7d74acf5049fec12dca4d246ba3"),
-uint256S("2a1d2c778f582666512bc0f1ae76539c9859d6d18273ea1372c45bb92773773d"),
-uint256S("83335a87e1904862c427f13dfa21a4ca4818306c30d5c1b960744006291fc1a4"),
-uint256S("83335a87e1904862c427f13dfa21a4ca4818306c30d5c1b960744006291fc1a4"),
-uint256S("0446085d679c82e42ae92b1f2a8cad65124f2ba99b7de7c271c9fff848845a32"),
-uint256S("0446085d679c82e42ae92b1f2a8cad65124f2ba99b7de7c271c9fff848845a32"),
-uint256S("7449fc5727f43609c53c3b18472b705740db03c63af9db09034e2a3044d58b96"),
-uint256S("7449fc5727f43609c53c3b18472b705740db03c63af9db09034e2a3044d58b96"),
-uint256S("ea718316bb1c56014c18f1cc819c57ad155ade5867d188529ed91446e2ceb987"),
-uint256S("ea718316bb1c56014c18f1cc819c57ad155ade5867d188529ed91446e2ceb987"),
-uint256S("47170866f84d2e7eebed561abf75a71b86925d112360692983ccfd19c756dd0e"),
-uint256S("548e0087bd1161ba05ada13165e5bdebf15639ff1688e40d74d2da97272986d5"),
-uint256S("2cc34e495fe48f1af77c28902d76e6de2f53c7e3b984ff5f06063d0d46d9327e"),
-uint256S("2cc34e495fe48f1af77c28902d76e6de2f53c7e3b984ff5f06063d0d46d9327e"),
-uint256S("983aca3bf70db67754233c526940cf73c8e1ce34e0b529565a2f70c45cbdcb3f"),
-uint256S("983aca3bf70db67754233c526940cf73c8e1ce34e0b529565a2f70c45cbdcb3f"),
-uint256S("3970b61be0fe8f43859b5136c3713d878a077908437bdbbadd4dda913c6adec4"),
-uint256S("fbc6b7b154d0fd603e8c97c6e884647a2be8693565abe421cf492921971beeae"),
-uint256S("fbc6b7b154d0fd603e8c97c6e884647a2be8693565abe421cf492921971beeae"),
-uint256S("f205bd88ccdabbb5ce92729683cf948455eb2c2c62966bee336679e19c5ae1ab"),
-uint256S("e52f77818dc681f619210d9c9256e5aa5ec7c7ef5f4e3b91a6ac3a6226f151a3"),
-uint256S("e52f77818dc681f619210d9c9256e5aa5ec7c7ef5f4e3b91a6ac3a6226f151a3"),
-uint256S("6f4351ed586e3284d2c796681aa8140567c17996d59c0f2080f00a900d28fe47"),
-uint256S("1ae7c89105b6fa354820b356b5567f46ac14afbcfcc16ac6dc42ec404e7b23dd"),
-uint256S("1ae7c89105b6fa354820b356b5567f46ac14afbcfcc16ac6dc42ec404e7b23dd"),
-uint256S("0ff7eff4a940d4ee50580cb739921ca85a90772f2c9e960f2a2b60cafb5d1d89"),
-uint256S("0ff7eff4a940d4ee50580cb739921ca85a90772f2c9e960f2a2b60cafb5d1d89"),
-uint256S("b479d44ea0799a801c8c4916fa9f5e1b640e31b2f4ed6ed18cec7ef2edad1096"),
-uint256S("b479d44ea0799a801c8c4916fa9f5e1b640e31b2f4ed6ed18cec7ef2edad1096"),
-uint256S("e00d1ccc8e0ed4afea458197263c11c7fbca81a012abb9ff24b8bff1d8d2854d"),
-uint256S("e00d1ccc8e0ed4afea458197263c11c7fbca81a012abb9ff24b8bff1d8d2854d"),
-uint256S("41a4c7918d181504375b96695db3bcb96a899c1aa0bc6d7cadf8daa0dccd5c53"),
-uint256S("41a4c7918d181504375b96695db3bcb96a899c1aa0bc6d7cadf8daa0dccd5c53"),
-uint256S("0abd1f4bb947154f9c78bf39a3c151f1c793ece47e3869673c61d303c587292d"),
-uint256S("f796f39d53cbf665f6b8de988fc2df5a49fa915ed306ec4ef39a0e556eece9ea"),
-uint256S("f796f39d53cbf665f6b8de988fc2df5a49fa915ed306ec4ef39a0e556eece9ea"),
-uint256S("ee64c03cb93b0fa45eb90ef9b87d51472183c388d340fe56c3bf9313fd83406e"),
-uint256S("ee64c03cb93b0fa45eb90ef9b87d51472183c388d340fe56c3bf9313fd83406e"),
-uint256S("574a5e22967d7f521839d1cda0fa0a2077c06d20e7271862088539e8f252ee6c"),
-uint256S("574a5e22967d7f521839d1cda0fa0a2077c06d20e7271862088539e8f252ee6c"),
-uint256S("847f2cd4b2ced6c2d46eb72eaf020fce12dd39834d1e81b5f4b41114adeadcc7"),
-uint256S("be5ab6c39ca7db26d5d64d8cdd1d3b977269dfee272aebc26822838fcda4a6a8"),
-uint256S("be5ab6c39ca7db26d5d64d8cdd1d3b977269dfee272aebc26822838fcda4a6a8"),
-uint256S("18e440e38401e03e50237e0dd28327fa3f415177c31634e9c6f4945deaa51788"),
-uint256S("b40ddc38f1ea16ded61aa940c12625e05cff36b6f2bbb986feb0951bdf4a43eb"),
-uint256S("f2a06486c21b13b3680b4e43835d95f9999d127ef24826554caad9a8281942db"),
-uint256S("f2a06486c21b13b3680b4e43835d95f9999d127ef24826554caad9a8281942db"),
-uint256S("960c7982568543e9e53ca95a4c628cbaa7bbb8577f5322615c6941af8062adf8"),
-uint256S("541ce3f8fcb6aea85afd419b0d75209ee972f4b542f813f891cc12e97b520ea6"),
-uint256S("650275bccbdb414b88b539835b4d01212b244a1f2befb897f9273411e2f820d0"),
-uint256S("56bb8ac8f6108c7a9772c59635b84035692593fc01b905a35250f883e548eb35"),
-uint256S("56bb8ac8f6108c7a9772c59635b84035692593fc01b905a35250f883e548eb35"),
-uint256S("42e3d8f530d55a9b7e66e18b6a93446b414223a5485bf4cd1fa52424e81beff4"),
-uint256S("42e3d8f530d55a9b7e66e18b6a93446b414223a5485bf4cd1fa52424e81beff4"),
-uint256S("49aca3a97b144b122a47f8b74cf7026bd63c555bdb49a3a6697eb44680dd8b45"),
-uint256S("49aca3a97b144b122a47f8b74cf7026bd63c555bdb49a3a6697eb44680dd8b45"),
-uint256S("fd583ca51085a3c6a6ecaa3d663c0cc8b24d3388da67c390def870d50108bb2a"),
-uint256S("7cd47677879e46a7b237de3b27a4c367d181ae3e1d8991a8575be14667e37ba2"),
-uint256S("7cd47677879e46a7b237de3b27a4c367d181ae3e1d8991a8575be14667e37ba2"),
-uint256S("2f8a63fad7ccb3cc853df345fcac9b7246387c5e17d2caccfc727e4475ae8691"),
-uint256S("c138d788a487a65874db4de49c6bb54a170f9abfae38113b0a3db08bb918de1b"),
-uint256S("c138d788a487a65874db4de49c6bb54a170f9abfae38113b0a3db08bb918de1b"),
-uint256S("a6d6d58fa0f10222a46c46c17f42d4b67eb7bcc124a77850be496c2423a1d2e5"),
-uint256S("a6d6d58fa0f10222a46c46c17f42d4b67eb7bcc124a77850be496c2423a1d2e5"),
-uint256S("07255a2268d2f539c13791d033bb303ab9fcb3fd54810423c4d8c0569ae223aa"),
-uint256S("9026bc7dbd785a8539683193fb7c191dd23d826534a99cbb4f2ed087d131639e"),
-uint256S("9026bc7dbd785a8539683193fb7c191dd23d826534a99cbb4f2ed087d131639e"),
-uint256S("cd835bdb131eb088abccf217a0440fdd20e976f577cf5a51e9705b54a3013d0d"),
-uint256S("e480d27c135813ce515cab88df658c8c52b58321b85978c5299166b03bc4c627"),
-uint256S("e480d27c135813ce515cab88df658c8c52b58321b85978c5299166b03bc4c627"),
-uint256S("d5c0ae171ca8419e6cf8407e910ff2915ddedafe3ca8e919f5e2af194839f1d5"),
-uint256S("b11a4e007560b8f81b1d924b590c3c2952a9adf2c2f41f4ed93df4ae67f5e8a8"),
-uint256S("b11a4e007560b8f81b1d924b590c3c2952a9adf2c2f41f4ed93df4ae67f5e8a8"),
-uint256S("f3eb0496127b3467808cf0235df55520d0503a06299de4e8f41107b15843ab77"),
-uint256S("f3eb0496127b3467808cf0235df55520d0503a06299de4e8f41107b15843ab77"),
-uint256S("7805f15d68d5103ba070dccdd54a627323be8b6a4d1653845342667182dd8603"),
-uint256S("7805f15d68d5103ba070dccdd54a627323be8b6a4d1653845342667182dd8603"),
-uint256S("bce7eae397360531add3199b1c43abfb494ac9943711983d7d397aa7a9e368d7"),
-uint256S("bce7eae397360531add3199b1c43abfb494ac9943711983d7d397aa7a9e368d7"),
-uint256S("f128f2de7c744738ddd4c057ae2b2ac6d1ceb87b1453e7cc496161378028ede3"),
-uint256S("da3be167192e4056f018562bd8813e71f8970631fa6a891166c1271465a0f2ff"),
-uint256S("da3be167192e4056f018562bd8813e71f8970631fa6a891166c1271465a0f2ff"),
-uint256S("576bcbd02f7ac7477fde0700586f921d1fbc3ee606ffd40c4a87226e2a061bc5"),
-uint256S("576bcbd02f7ac7477fde0700586f921d1fbc3ee606ffd40c4a87226e2a061bc5"),
-uint256S("0f19f77905bd8ba7f15f53552153e0f87a222921ecc0c027580c43ca1128ab33"),
-uint256S("80f353a5e986ca96780da0b7b74688d815d3c55707853775d9142ffaf8528873"),
-uint256S("80f353a5e986ca96780da0b7b74688d815d3c55707853775d9142ffaf8528873"),
-uint256S("11fb29f90dd6e5ecd2820bc4708a303c01ee3b53002008c6211a9f39785db645"),
-uint256S("4f92bfd2b74eada1eadece68e0d48fc69d611144dc378ca197f61a95d363eaff"),
-uint256S("dde574495d4b5ebf8e350da2b39f48b1146429422d48807a6283e87b598bf827"),
-uint256S("dde574495d4b5ebf8e350da2b39f48b1146429422d48807a6283e87b598bf827"),
-uint256S("7f9db14add4b874946b695a514c1acb794f214b5036f99dba80b6fdeed97d771"),
-uint256S("5dc04fdcbc89dbcf7b9ad16fe345d6c355926523131bbec3a1744466e6fffadd"),
-uint256S("5dc04fdcbc89dbcf7b9ad16fe345d6c355926523131bbec3a1744466e6fffadd"),
-uint256S("90951c4e0620a7c0a91c379ea9dcbab62e4f5face8e65fd21fc759f4ae3181eb"),
-uint256S("0010c0da2ef03f0d576a60a82be284fbcbe829ab951064304d517cf9a0bdefef"),
-uint256S("0010c0da2ef03f0d576a60a82be284fbcbe829ab951064304d517cf9a0bdefef"),
-uint256S("08705eb71cb40c0dd0ebe28095f286d09b4b5afcd5861824d64f70ef2ecb3c4f"),
-uint256S("859bf02bc0fddbb45922e0c0f8f84de3059c588d0822d9b96d2117f187e3be9a"),
-uint256S("51063410dba9fcec8e1e9981aa5e852459430d26b8b5333891c4a0b372cb9257"),
-uint256S("51063410dba9fcec8e1e9981aa5e852459430d26b8b5333891c4a0b372cb9257"),
-uint256S("8a7071083614d3b67bb3cf9b6d531fd3ecbd8aabb4a5fe85e0bbfb61c4ac4a62"),
-uint256S("5f81af77b868e586dd53f390645ab3966358588e2f03b236a5a6001eabeaac16"),
-uint256S("143537b4f748b4c0d29f933fe9818663fc9d5066cf13512748b7eac5987ce150"),
-uint256S("11057e3ca4ffa4a82bf23763793d584b3717eb205ad154edabeadcd72f26d62c"),
-uint256S("770dffb427053934e0b913b04d40a610807af3a4662e902070910087b0219c79"),
-uint256S("770dffb427053934e0b913b04d40a610807af3a4662e902070910087b0219c79"),
-uint256S("b0582da89f0501e12fb2a33358e91d808b8dc4245ab75f6b562bff0449fb812a"),
-uint256S("ce50fe6cb517389016440ca12d85e12426199aa44f2c6ca69d13ea89a77b3af3"),
-uint256S("ce50fe6cb517389016440ca12d85e12426199aa44f2c6ca69d13ea89a77b3af3"),
-uint256S("de95fae0e69a18024ccbfd963ad3e90fa8f1fe41d5dcdbc47108ad068fbec14c"),
-uint256S("5e3459c8bb54415a2083bfe1a6ec81f1f85e411720bfc78c5b38021c86091d61"),
-uint256S("5e3459c8bb54415a2083bfe1a6ec81f1f85e411720bfc78c5b38021c86091d61"),
-uint256S("29fbc161ea16c09cc33c123363445dc419c874e85c50b6c3257a93f4a2a41254"),
-uint256S("56f5aea15664725fb85344188452c3483668a885ec21a3be63db79c2c649241a"),
-uint256S("56f5aea15664725fb85344188452c3483668a885ec21a3be63db79c2c649241a"),
-uint256S("3a8b8a90bcf6f7fbbf4072470996e25b6856404e44ad76f337083e7d7ff23362"),
-uint256S("3a8b8a90bcf6f7fbbf4072470996e25b6856404e44ad76f337083e7d7ff23362"),
-uint256S("f44daf264918aada933b32c273c47d25bfa7df3b99ec9d1b7577ec1f4de5f135"),
-uint256S("167068109d8f6ae8a93a667b2cda6a3254da7af1521c0522877d0b5d2c8fcac0"),
-uint256S("167068109d8f6ae8a93a667b2cda6a3254da7af1521c0522877d0b5d2c8fcac0"),
-uint256S("d81c8a3c25545626032357cb99e74ee99fa0069f948b6502fb8e0a521fe69436"),
-uint256S("d81c8a3c25545626032357cb99e74ee99fa0069f948b6502fb8e0a521fe69436"),
-uint256S("36ca9ae2c100f1a8f02de6ce4bf3fc68e860b092918a5097e57ebd6cd9e102cd"),
-uint256S("36ca9ae2c100f1a8f02de6ce4bf3fc68e860b092918a5097e57ebd6cd9e102cd"),
-uint256S("53d974ca2367cb159be713d994c015ff30d16af1a040e11569260a73b566b019"),
-uint256S("53d974ca2367cb159be713d994c015ff30d16af1a040e11569260a73b566b019"),
-uint256S("ad3ca2892060743131421fb87ec3c0c5c19ea0993cca002c41eefe0e9388bba4"),
-uint256S("ad3ca2892060743131421fb87ec3c0c5c19ea0993cca002c41eefe0e9388bba4"),
-uint256S("42b50d6dba054bae814ab83d4498ad9eb8014af0036ed07b4f0f02b55524d54a"),
-uint256S("3faed40d1748a84d8541e1824b5dcb5fa3876d3e9cacbf3bd1ef2128a0e25f80"),
-uint256S("3faed40d1748a84d8541e1824b5dcb5fa3876d3e9cacbf3bd1ef2128a0e25f80"),
-uint256S("4eb1f6ee003c81a5c42cd493b2ea08c0d098552a0ffafa31c4dbc3d0840bea99"),
-uint256S("09b702adfeb8167b902726e1f14c845a4f603b1dcd9f8897782b7c1ec2525b15"),
-uint256S("09b702adfeb8167b902726e1f14c845a4f603b1dcd9f8897782b7c1ec2525b15"),
-uint256S("ae055fdf8a06a6f58c40f0e202fb0ac590b4ae3997ef327e8f4ce4fa33aeb87f"),
-uint256S("27af278438b01fcb2ed8ebccfb235d88cf4490d936c152af8087edb932241888"),
-uint256S("27af278438b01fcb2ed8ebccfb235d88cf4490d936c152af8087edb932241888"),
-uint256S("96d528016fc5950086f4765bda9409cd26b7df81a17fef5dba77fa336e3de9f7"),
-uint256S("be86c89f2647e9b0f74cbac6c56e08c214f08557fde69a741ddb30952ed9a01b"),
-uint256S("be86c89f2647e9b0f74cbac6c56e08c214f08557fde69a741ddb30952ed9a01b"),
-uint256S("38d7ee41bb00365df440d531011437802da05f89c706df6d1ae40a50e927008d"),
-uint256S("158a70b993df65ac69b102fe41e2bf63a9aff79c57d6015a6395af23f744c559"),
-uint256S("158a70b993df65ac69b102fe41e2bf63a9aff79c57d6015a6395af23f744c559"),
-uint256S("2f5537d2deb2c77fcb9436704614cb66461a07b519ee57b81ed10fb3297f9a2f"),
-uint256S("40a6b365714983733a5cf5cd2a1f51fa067c409d9d298f100501c54fa5889552"),
-uint256S("40a6b365714983733a5cf5cd2a1f51fa067c409d9d298f100501c54fa5889552"),
-uint256S("d273f24e1fb42c4865ae8625dedd4f0794ed7a093c946b9497f377390d17efb7"),
-uint256S("431d28cad8b7f6887e07d1cf96b8d04f10d099d4d187c1022a726762cba1c309"),
-uint256S("431d28cad8b7f6887e07d1cf96b8d04f10d099d4d187c1022a726762cba1c309"),
-uint256S("a2fdf4a3cc2b22e3fcfd689409ccf50bba1de4b7710f7c4c84484dd6ae5c497b"),
-uint256S("a2fdf4a3cc2b22e3fcfd689409ccf50bba1de4b7710f7c4c84484dd6ae5c497b"),
-uint256S("515ee9a1cecc4b0ab73fbf42b5f5ebd109f237fa73b656b5b0e3879a28b9159a"),
-uint256S("0b167d7c7e379ef518442a0e36d52950a6d1863ebffde276ff571e036ef4e72c"),
-uint256S("63f6c16067b4e7ad5174d9233dc46ee1d59e10777e1c58d18d5bd47b5bdde929"),
-uint256S("137b16d766b9c669207836ed8e5df8f384f896764996dedae80cfa3e1f9ab88f"),
-uint256S("137b16d766b9c669207836ed8e5df8f384f896764996dedae80cfa3e1f9ab88f"),
-uint256S("e386d1ff7fc0b496c07cf4c1997316acd875bced40ad59042930ab5c92343f49"),
-uint256S("e386d1ff7fc0b496c07cf4c1997316acd875bced40ad59042930ab5c92343f49"),
-uint256S("7df477b6aa751f3b284b43f6136b1db3b092a833f1ff4d4889368296e2e0ead7"),
-uint256S("7df477b6aa751f3b284b43f6136b1db3b092a833f1ff4d4889368296e2e0ead7"),
-uint256S("f764671a9cdb1a6d628362ffaaa4c1f3993127cf93338ecce6cc7e379b14836f"),
-uint256S("9e7b193868686f5a690025114b818fbf3a1d46676402666660801fc87314cbad"),
-uint256S("52db0d64d62f259ba8d7467ff0ef6acc8b3f23a7164c2e596396a57455c51e5c"),
-uint256S("9768edc125382b60ef22b5653f2fabc411a4c6fa754233a800639ebb45d99413"),
-uint256S("9768edc125382b60ef22b5653f2fabc411a4c6fa754233a800639ebb45d99413"),
-uint256S("fd62452f7250739d09be538a771b3c285c01f1c61558f0b130eaafc00c1edcda"),
-uint256S("fd62452f7250739d09be538a771b3c285c01f1c61558f0b130eaafc00c1edcda"),
-uint256S("d392c624919dfee74caa8330f9a178a5057521e4d1d545838e451a2faf982e64"),
-uint256S("d392c624919dfee74caa8330f9a178a5057521e4d1d545838e451a2faf982e64"),
-uint256S("7d42c7888709549d796f2059c61b2b8badc178d4b15ec47450c5ae22d7ad2ffc"),
-uint256S("7d42c7888709549d796f2059c61b2b8badc178d4b15ec47450c5ae22d7ad2ffc"),
-uint256S("f9f5ae9f5c18bd9da2beb8fc0024074e55c9bec996ff93b6071ee288b81c5e3b"),
-uint256S("66544da42480190da7f567dc540d1b0b1f60a4560498698c8e9e9096aa5b48ec"),
-uint256S("66544da42480190da7f567dc540d1b0b1f60a4560498698c8e9e9096aa5b48ec"),
-uint256S("e92e211fc6c86e7c1f847f960a091e175606d23b6d7aed38a72fd374ae606f7e"),
-uint256S("1d1373005da62a7f31c24f68aaf35b677014ab21633c7ba964c403cf7729f97e"),
-uint256S("64916689020df467fb7f5fec61a24f8d80ae6a0b444e8b517d2b51910afe2513"),
-uint256S("64916689020df467fb7f5fec61a24f8d80ae6a0b444e8b517d2b51910afe2513"),
-uint256S("a10d921b75fd3082ac887dd1fa5c98bb47b5f027a44c1635bad12889845c487f"),
-uint256S("d0b0edecc2754b23378a2deba86fc1567542c0fa01b31719ed7f598b004db77c"),
-uint256S("d0b0edecc2754b23378a2deba86fc1567542c0fa01b31719ed7f598b004db77c"),
-uint256S("f69639386b8d2d30dc3f027121be5fa1120e92b0a552da9e60bc455d79742755"),
-uint256S("f69639386b8d2d30dc3f027121be5fa1120e92b0a552da9e60bc455d79742755"),
-uint256S("8e5ef0a143f500ba0d2249d6f7913a40e4741d35f5c60806a2d9a4eeecbff0b7"),
-uint256S("f08a4d61f641ed81cc5a3a677f5940f46203e4f738f97692ffaaec2244229677"),
-uint256S("f08a4d61f641ed81cc5a3a677f5940f46203e4f738f97692ffaaec2244229677"),
-uint256S("4dfd9c041afe9fc72e0f9324473741c83b431dd99cd554c9c627e04c4fe678ce"),
-uint256S("5dd53112f1df6dc5b6b05d063da09da71c706c6b09b10d078193791c0fa0849c"),
-uint256S("5dd53112f1df6dc5b6b05d063da09da71c706c6b09b10d078193791c0fa0849c"),
-uint256S("09ba68bbe854369ded58efe5780065caeba1adf6bfb9a6c3dc8b0ecf321d3cc6"),
-uint256S("e624d33eb4cf551c1b8d640e44145b5acd36efb4c5fe0eacad1d403473b355de"),
-uint256S("e624d33eb4cf551c1b8d640e44145b5acd36efb4c5fe0eacad1d403473b355de"),
-uint256S("5d20973f8159fd890fc71b3de224f42d303934ceb59d838e01df9b99c72f0da0"),
-uint256S("997dd19ba7ba8a00a9eeaee531514f45f6e27c07cf466253e8f87ec0bbe0696a"),
-uint256S("997dd19ba7ba8a00a9eeaee531514f45f6e27c07cf466253e8f87ec0bbe0696a"),
-uint256S("d60657f4998a03c0524e102f0f0ada322ad099c09bee7303ae3a55ab8ec1c735"),
-uint256S("dd68eac09c01eae3fcd9a24d002e44a0f4a172ae2926beb71ccc606196cd4b1e"),
-uint256S("dd68eac09c01eae3fcd9a24d002e44a0f4a172ae2926beb71ccc606196cd4b1e"),
-uint256S("b33ae1a8485697da7e54b24534786ffcf0909fcd6ecb0446926c338e39543874"),
-uint256S("b33ae1a8485697da7e54b24534786ffcf0909fcd6ecb0446926c338e39543874"),
-uint256S("7a3b89c1b9d3d00f0c5c0b0d6e66de009e53ab7a896d087ad36da71b63f764ac"),
-uint256S("cdd144f05c394170bfe26b7997fefc88d7aab6381d928b61a89b0ccf54138a0f"),
-uint256S("cdd144f05c394170bfe26b7997fefc88d7aab6381d928b61a89b0ccf54138a0f"),
-uint256S("37822f54530879a43cccddf694a2ec8bf021af0d4d9876a071ad2d5d91e64faa"),
-uint256S("37822f54530879a43cccddf694a2ec8bf021af0d4d9876a071ad2d5d91e64faa"),
-uint256S("2e643b05d1d137800a960cf2375bc6d421c6db6b569275cc082aaf2dd784dd55"),
-uint256S("2e643b05d1d137800a960cf2375bc6d421c6db6b569275cc082aaf2dd784dd55"),
-uint256S("59b1624d5da4dd27d4ea98210b64c817d8a94f753170382d5bc55e853f215a8c"),
-uint256S("981e8950a7ad5a643f0758056804b40b68882cef1ec57929aee23a52a7941597"),
-uint256S("981e8950a7ad5a643f0758056804b40b68882cef1ec57929aee23a52a7941597"),
-uint256S("62da8c02007746671210157de7f7544b6c8ffc1f26f2c3d14f52c5a6199d877d"),
-uint256S("bea3bb5ea4707bdb78f13185719612de759c781edb72db47c78a49d45be347c1"),
-uint256S("5318cb97719f78acc3a478f1c8cf2c27cd62f472a647c507e568b1776d866353"),
-uint256S("b6c710e0ad8aec4c9431912db99b32eec4fbf639d0be7034b2cbb26aafd3b144"),
-uint256S("b6c710e0ad8aec4c9431912db99b32eec4fbf639d0be7034b2cbb26aafd3b144"),
-uint256S("055f0cbd5aa55b0701b4e97a89ee455622ed25cbf197f7a83c94fc06a6318a49"),
-uint256S("055f0cbd5aa55b0701b4e97a89ee455622ed25cbf197f7a83c94fc06a6318a49"),
-uint256S("5c7c335f81386a738d6d38e616fccbb66090aaaedf874dee7a3dbc0c1248089a"),
-uint256S("5c7c335f81386a738d6d38e616fccbb66090aaaedf874dee7a3dbc0c1248089a"),
-uint256S("a79614d2138c64508cfaa80759f8036e01e5cb47a2d02c47503a3193a99a261d"),
-uint256S("a79614d2138c64508cfaa80759f8036e01e5cb47a2d02c47503a3193a99a261d"),
-uint256S("867fd61e7399b2098c2ae89e2b980721855c28ed616d776eff35da49b1f46939"),
-uint256S("b8417aec3ac0d75ab277d573b221256c47c26edb5215e81159c6cfc3a5d3e7ad"),
-uint256S("b8417aec3ac0d75ab277d573b221256c47c26edb5215e81159c6cfc3a5d3e7ad"),
-uint256S("258e4582d02cb36427c33ecbaf0de8339b16696de493f0a3076f5649160e576d"),
-uint256S("fd428c7c219c8e6af922794eb2a0a3d57d2f3e8970a79a00d522bd3d16ba520e"),
-uint256S("fd428c7c219c8e6af922794eb2a0a3d57d2f3e8970a79a00d522bd3d16ba520e"),
-uint256S("7efc99a0a464a28be35fa64e6cbbb80957d144e66a6bb020968bdf1fd02dc388"),
-uint256S("3398789a8c25a84f8dfa4f66750e36a2b360316b10b00b8de4247977656d725f"),
-uint256S("3398789a8c25a84f8dfa4f66750e36a2b360316b10b00b8de4247977656d725f"),
-uint256S("2ad85c7292397d4015b7a95bd21be997667836172583d9d2f1a11fad3530db5e"),
-uint256S("883cb0c4412c4d83d3d0349b41e37e589e818656f6cfadb12b885b5499dbe5b6"),
-uint256S("883cb0c4412c4d83d3d0349b41e37e589e818656f6cfadb12b885b5499dbe5b6"),
-uint256S("40a547078c6580fae99f74e8e370007115dddc1cab92a8c632cdbeb612b43678"),
-uint256S("40a547078c6580fae99f74e8e370007115dddc1cab92a8c632cdbeb612b43678"),
-uint256S("a2c01880bb11231026916569ab42e0eb9d41890be718306d5d69eaac4d2f2e19"),
-uint256S("dc731dcc7644edbb5fb6cc3c985576be8243de8c62176d390bf37886f45c309b"),
-uint256S("dc731dcc7644edbb5fb6cc3c985576be8243de8c62176d390bf37886f45c309b"),
-uint256S("6fdafa0c45dc861362b84d15dec612458a7845f0c9323ac2f0d3c69c487847fb"),
-uint256S("6fdafa0c45dc861362b84d15dec612458a7845f0c9323ac2f0d3c69c487847fb"),
-uint256S("ea995b512deaccc8ea88803c8a9e996be26dcb6cf0c12c17fc3ea3854c250c8d"),
-uint256S("ea995b512deaccc8ea88803c8a9e996be26dcb6cf0c12c17fc3ea3854c250c8d"),
-uint256S("5f5e00adc357c5cc1fb4a4893160305c7c1b59cc202faf5fdeca4e0612324c84"),
-uint256S("cb4cd5414907a7bdd5d20e92fed909e48604a44afc05ec8cff70dda2cc4ae012"),
-uint256S("cb4cd5414907a7bdd5d20e92fed909e48604a44afc05ec8cff70dda2cc4ae012"),
-uint256S("b434c48f255df85d31b17e90e65dfb25c4b5bacbb19d775138143498939709d0"),
-uint256S("92cf05815f23ec1681bd718dd486a7ae38ee24d79c3bb37e91f4581abcf060fb"),
-uint256S("92cf05815f23ec1681bd718dd486a7ae38ee24d79c3bb37e91f4581abcf060fb"),
-uint256S("a0e8eefe7fb029563aacb2720bfa36bdc0cda6006110a9cd4bd6230ed19e3bdd"),
-uint256S("a0e8eefe7fb029563aacb2720bfa36bdc0cda6006110a9cd4bd6230ed19e3bdd"),
-uint256S("d61afb95c5057b269990994b5e9a9af8f5b1fec051044ad1c321c9127e35ca2b"),
-uint256S("d61afb95c5057b269990994b5e9a9af8f5b1fec051044ad1c321c9127e35ca2b"),
-uint256S("977603fcbc0b9a6fddeca93745fcba4966d3579a61e17d740702a118e8c0b070"),
-uint256S("977603fcbc0b9a6fddeca93745fcba4966d3579a61e17d740702a118e8c0b070"),
-uint256S("4326a693c233504314f79685c7b10eb5d9c65bc7c77c80a5d94f7193ee19b397"),
-uint256S("e394d03a6a5e51b3c868968f53a3548deb1292387778cb22d290472482922c5b"),
-uint256S("757951976f577986f50a753d773936ac3076f77ed09dc30aa54a1b5dd97230e5"),
-uint256S("757951976f577986f50a753d773936ac3076f77ed09dc30aa54a1b5dd97230e5"),
-uint256S("fe70d729c7d0fa221ee362e17da144fcf5e02d3ff5c2cdca30531bbd6bd4de0d"),
-uint256S("fe70d729c7d0fa221ee362e17da144fcf5e02d3ff5c2cdca30531bbd6bd4de0d"),
-uint256S("13ce32d52877f1f42c79e4c13fb1b6abf32f21edb0e8f19207e857d6027c87d7"),
-uint256S("83f4b2dea9de7252c8911171db77d7c26f449e9693f5ed9ab0937ccb318e383f"),
-uint256S("83f4b2dea9de7252c8911171db77d7c26f449e9693f5ed9ab0937ccb318e383f"),
-uint256S("5915bf02a983e9dde57b80a15b5f39015c6049b664c72f27b41c3457f8b72a27"),
-uint256S("5915bf02a983e9dde57b80a15b5f39015c6049b664c72f27b41c3457f8b72a27"),
-uint256S("052d061a2a013c8abcefbe5944f880cb9daa61097dd337c5c09e3e7d466e4808"),
-uint256S("21b2c693ddfb5569cdcd9d469e6b448585edfbac485bb11ed78e3d16f24e2cc0"),
-uint256S("6360fa404fd69b0f24619be1e2675a2da11c91f0e14ba75744f3e17d25fdf382"),
-uint256S("ead04041637e73b450c5af9995e884ffb9159d9954bcd5d1f39183bd30636a67"),
-uint256S("ead04041637e73b450c5af9995e884ffb9159d9954bcd5d1f39183bd30636a67"),
-uint256S("f2c924d2179b2469e751c66c25e4af4c1e0120a14cd75745d2bfcea3569e12a5"),
-uint256S("f2c924d2179b2469e751c66c25e4af4c1e0120a14cd75745d2bfcea3569e12a5"),
-uint256S("4d177fc11e1bb5776ec9d7e51106ed77008e8e17eae9f8ec929c08ed363a098e"),
-uint256S("4d177fc11e1bb5776ec9d7e51106ed77008e8e17eae9f8ec929c08ed363a098e"),
-uint256S("33142a9ca012d74472f97c911fc89d8b02aa83109b573afb4481597b52a62a7d"),
-uint256S("33142a9ca012d74472f97c911fc89d8b02aa83109b573afb4481597b52a62a7d"),
-uint256S("ce5c23ed07e3205b9940ab4ddb1dd95ac950ea1507d36c40d8053f592c8e2afe"),
-uint256S("ce5c23ed07e3205b9940ab4ddb1dd95ac950ea1507d36c40d8053f592c8e2afe"),
-uint256S("26186e3deb30fa23a2de081498c76ba35a5cbc73936d037de4e937b87b6ebb20"),
-uint256S("89d1bef313780a53921ef58ac4ea7f75e41b7d9d0b3c527a130ec1be63b799c8"),
-uint256S("89d1bef313780a53921ef58ac4ea7f75e41b7d9d0b3c527a130ec1be63b799c8"),
-uint256S("4e81639f8f8d9ca869a97778b2ec40f680181441601dac13264781fa97144b91"),
-uint256S("4e81639f8f8d9ca869a97778b2ec40f680181441601dac13264781fa97144b91"),
-uint256S("8e31bf75f8cb8255abfe9dc5cca04024f117f98eb4922a02248eae80ca06f93d"),
-uint256S("8e31bf75f8cb8255abfe9dc5cca04024f117f98eb4922a02248eae80ca06f93d"),
-uint256S("201899fb666409c5106f90c036d8efaeb4c00c157a03af33b9a143980c526580"),
-uint256S("201899fb666409c5106f90c036d8efaeb4c00c157a03af33b9a143980c526580"),
-uint256S("c14eeb0fd6cbf8e5a73ade705a71b9ed925d0224a6bd419da22a22d5e84824dc"),
-uint256S("c14eeb0fd6cbf8e5a73ade705a71b9ed925d0224a6bd419da22a22d5e84824dc"),
-uint256S("985f2d8cc545072610639cbcc37775d8174826ada2bd3e7ad44dc55c590745a1"),
-uint256S("985f2d8cc545072610639cbcc37775d8174826ada2bd3e7ad44dc55c590745a1"),
-uint256S("40d4d2421dc2ad00a79366880e75d7c59f7326a2d57426e2e95bdbd9c67b9080"),
-uint256S("40d4d2421dc2ad00a79366880e75d7c59f7326a2d57426e2e95bdbd9c67b9080"),
-uint256S("e1dbc1bd51bcbe5c383757398884a3817212434674e88a541c7f37a34c59352c"),
-uint256S("e1dbc1bd51bcbe5c383757398884a3817212434674e88a541c7f37a34c59352c"),
-uint256S("a2aa2442a287642c7890446a95d51d6fda39511bf0bbecf52c40c61c00d1296d"),
-uint256S("a2aa2442a287642c7890446a95d51d6fda39511bf0bbecf52c40c61c00d1296d"),
-uint256S("8ae777c4634414269d9ded0def4bcc171902bfb24ec80baf7f6fb7ae8ecccb0a"),
-uint256S("8ae777c4634414269d9ded0def4bcc171902bfb24ec80baf7f6fb7ae8ecccb0a"),
-uint256S("ae2b8aa35e8094d6346d2ebca7a480a40297d86e97017c08895e7d7c71a8fdf5"),
-uint256S("32939dccf550df27c7309c10c357fff9bbd266ec1e23043afd6e5fcc433f6192"),
-uint256S("ea47a57617a0590d7f896fe742facf77747d276bbe1b5719638992cfe4a52bf6"),
-uint256S("ea47a57617a0590d7f896fe742facf77747d276bbe1b5719638992cfe4a52bf6"),
-uint256S("1351373c6834ccb48919bba3227040d2c6674090059a5c8539001c648c304fec"),
-uint256S("1351373c6834ccb48919bba3227040d2c6674090059a5c8539001c648c304fec"),
-uint256S("b5f17df753d3c28592d92b152bddb4077c3a759479a4b5ce60d5228c34fac199"),
-uint256S("b5f17df753d3c28592d92b152bddb4077c3a759479a4b5ce60d5228c34fac199"),
-uint256S("d3ce3f3b13a9b1e3ba3931877543690a130bdcc100db730dbda358aa94377a60"),
-uint256S("d3ce3f3b13a9b1e3ba3931877543690a130bdcc100db730dbda358aa94377a60"),
-uint256S("5b87687c65c0c80aaecc81c4b783b5cc95605d0c1a018db87d2719319c63d7f8"),
-uint256S("5b87687c65c0c80aaecc81c4b783b5cc95605d0c1a018db87d2719319c63d7f8"),
-uint256S("23a4b77d70e633845bad137cc668a4ac75989ca7f574108d876e5001bd1849b1"),
-uint256S("23a4b77d70e633845bad137cc668a4ac75989ca7f574108d876e5001bd1849b1"),
-uint256S("455cd638fd76d531afbf80b54cf5ad5375a3b6259342e958ba9e4ffdc956899f"),
-uint256S("455cd638fd76d531afbf80b54cf5ad5375a3b6259342e958ba9e4ffdc956899f"),
-uint256S("ea4bcd854c3b4b6bec01d92a1cb49018e070a511c61d0bc86c4346a422073fbf"),
-uint256S("9430d59026007eb878f713bc1e30d6da2e51be3e088952735b26685b4db3f176"),
-uint256S("9430d59026007eb878f713bc1e30d6da2e51be3e088952735b26685b4db3f176"),
-uint256S("c739675dd3244bf5862c626215a5cef02f13ad267d7f2b7707df639c6065666c"),
-uint256S("c739675dd3244bf5862c626215a5cef02f13ad267d7f2b7707df639c6065666c"),
-uint256S("36d083e29dd1104d8a1597d4c1233b6ae5b428cb4924f8677a170388f05e2bb6"),
-uint256S("b76668e54d4b0653cf597c2565cc6ebd0cc5127aea2fd71318fd0a6a0ef8013f"),
-uint256S("b76668e54d4b0653cf597c2565cc6ebd0cc5127aea2fd71318fd0a6a0ef8013f"),
-uint256S("ce3e7379fdc1ceb696ceb6afe173f57a0c06dee5a9e9ee106a56ab01eb4eb989"),
-uint256S("ce3e7379fdc1ceb696ceb6afe173f57a0c06dee5a9e9ee106a56ab01eb4eb989"),
-uint256S("2949da48cc1a4929002b85b05643ededd34ad088bed898ce0e107337db47f73b"),
-uint256S("2949da48cc1a4929002b85b05643ededd34ad088bed898ce0e107337db47f73b"),
-uint256S("bb56d6bb55ea3f2a867d888f57402de5dbd1d57c64e13026fb2a9916777f4c06"),
-uint256S("93ee3d3db017ef076df33bf33e03056f6fc3e4d289e1d88b6bea3cc1a233ebc4"),
-uint256S("93ee3d3db017ef076df33bf33e03056f6fc3e4d289e1d88b6bea3cc1a233ebc4"),
-uint256S("789a6a23cadb99dbe3d252a8448742dfb7a47ba71f583a45f7633e981873fcc9"),
-uint256S("789a6a23cadb99dbe3d252a8448742dfb7a47ba71f583a45f7633e981873fcc9"),
-uint256S("fc13e4cd788b89ebb17a6a52584d328d3eb1a13f01863c4eaf1f2970264afd37"),
-uint256S("fc13e4cd788b89ebb17a6a52584d328d3eb1a13f01863c4eaf1f2970264afd37"),
-uint256S("11e9cf24559aad909ecb1273dba20a0fb5ae727d6d4870203d67bd8528c378e1"),
-uint256S("11e9cf24559aad909ecb1273dba20a0fb5ae727d6d4870203d67bd8528c378e1"),
-uint256S("5739f2ba1590c29443e29333c25d56a579990036af512f7360173be8d2715ae0"),
-uint256S("5739f2ba1590c29443e29333c25d56a579990036af512f7360173be8d2715ae0"),
-uint256S("92a2425e9944472a765f8065a427e17fa25028d65dfa77159a8f8ea798825842"),
-uint256S("6d0aa5ffc161ca38934a6bc01c5e7ea68426b13fb2494b828cae95d8ef43f9f7"),
-uint256S("6d0aa5ffc161ca38934a6bc01c5e7ea68426b13fb2494b828cae95d8ef43f9f7"),
-uint256S("761269bc4ecfa400eacb8f658078b76410e16c5337f059311185f3031eec1518"),
-uint256S("761269bc4ecfa400eacb8f658078b76410e16c5337f059311185f3031eec1518"),
-uint256S("021fac166a06326b85eea299c154bc46443be1a49197663a63806743e0b35bc4"),
-uint256S("021fac166a06326b85eea299c154bc46443be1a49197663a63806743e0b35bc4"),
-uint256S("477faabc4b8682da0ff5f30cca93af5da700c97b99620018b1f0e29af579b51f"),
-uint256S("477faabc4b8682da0ff5f30cca93af5da700c97b99620018b1f0e29af579b51f"),
-uint256S("0dafe630c36af2d7d65b14a65d361c37217e5563b5f9281a034c5ccb15fec244"),
-uint256S("0dafe630c36af2d7d65b14a65d361c37217e5563b5f9281a034c5ccb15fec244"),
-uint256S("be31a18f0e50f8a468b23f39a0596f2c281270a282250664b2171ab78fd5587a"),
-uint256S("be31a18f0e50f8a468b23f39a0596f2c281270a282250664b2171ab78fd5587a"),
-uint256S("660e5819cd485bb01536b28b3880d8c95c259a8a8e5687407bff561f654d9aad"),
-uint256S("660e5819cd485bb01536b28b3880d8c95c259a8a8e5687407bff561f654d9aad"),
-uint256S("2af8c33242ee29ef689fc8e40d103e47f2dd2c787ebb484ef5d3ce4a80e4324b"),
-uint256S("2af8c33242ee29ef689fc8e40d103e47f2dd2c787ebb484ef5d3ce4a80e4324b"),
-uint256S("4663989721878dc339adc74ea3a42dbb0943f4b9f9397fb97494762d6f538cb1"),
-uint256S("4663989721878dc339adc74ea3a42dbb0943f4b9f9397fb97494762d6f538cb1"),
-uint256S("b9c5e1b262e7637c2216c91b3b5147d49156f436d8dc441eae81048bd299c4f5"),
-uint256S("b9c5e1b262e7637c2216c91b3b5147d49156f436d8dc441eae81048bd299c4f5"),
-uint256S("f341105a56c0d5126627772041c8fd0864bd6309a70f4ad39ea9ed9b1cd73165"),
-uint256S("f341105a56c0d5126627772041c8fd0864bd6309a70f4ad39ea9ed9b1cd73165"),
-uint256S("8c799fa978cdb5639a1af8c49d21223e682d24be58f92e7f0f2ebde7058b27d8"),
-uint256S("8c799fa978cdb5639a1af8c49d21223e682d24be58f92e7f0f2ebde7058b27d8"),
-uint256S("575006d2ff6105efc2a9aebbab6562ad27b2c088b9ea358e4f618eda40700f08"),
-uint256S("575006d2ff6105efc2a9aebbab6562ad27b2c088b9ea358e4f618eda40700f08"),
-uint256S("be7b81c346320ddfd855d30143fbfc6c493b0de32637fba6f66abe6df75a9a47"),
-uint256S("be7b81c346320ddfd855d30143fbfc6c493b0de32637fba6f66abe6df75a9a47"),
-uint256S("379ef7e15779421e55396442e7bc2a63f22f01758591716ad52a55bd28f9f243"),
-uint256S("379ef7e15779421e55396442e7bc2a63f22f01758591716ad52a55bd28f9f243"),
-uint256S("e560aaa3f2b491eac0da7d7479460079d3432367a92caf3fe1b67b2db53e92a1"),
-uint256S("06c8c5f98eb7e742317a0f851663a8b19ef58f1cc572f3960cc51e6584e23b84"),
-uint256S("b48784b5970d3e335c09cb1eba026b894df76084a518b93a6c3ba6bde13a5e21"),
-uint256S("b48784b5970d3e335c09cb1eba026b894df76084a518b93a6c3ba6bde13a5e21"),
-uint256S("235bed1b441dd52550d59450d92401d9658f8931ac275f97b7852c205d8ec3d3"),
-uint256S("235bed1b441dd52550d59450d92401d9658f8931ac275f97b7852c205d8ec3d3"),
-uint256S("c450b189a303f34b8361f2033fc1ac5c3434a6c245a803f0eafa60066194aecb"),
-uint256S("c450b189a303f34b8361f2033fc1ac5c3434a6c245a803f0eafa60066194aecb"),
-uint256S("8ec96de4b8d3b8a245bba91e7971eada32ec8fe0a86a0917efa61dbe26e19c96"),
-uint256S("8ec96de4b8d3b8a245bba91e7971eada32ec8fe0a86a0917efa61dbe26e19c96"),
-uint256S("827b7813fb8db21d441926087471b139d1d8a819004826ae1d2cedb40243d4e9"),
-uint256S("587ca049491476b6e039930d8097ecdf7b7a147cf74fc42a269fc53a79d46f49"),
-uint256S("48acbec5983050c750c2cb98e24f97ed94b3cd32ec6275bc3a91146689f68dfa"),
-uint256S("48acbec5983050c750c2cb98e24f97ed94b3cd32ec6275bc3a91146689f68dfa"),
-uint256S("313f555ca77d9de322852f4fe11c3c40bf7b18c5334a72adca917518a43e4002"),
-uint256S("313f555ca77d9de322852f4fe11c3c40bf7b18c5334a72adca917518a43e4002"),
-uint256S("575ca33265e2daa57a316bab61860794a130a53ae9d2c258a9bdce1e1788d42a"),
-uint256S("cde62b6455ecd8296e6d97324c0a061cfae5f8d2234ee73af474be9a124ac9f3"),
-uint256S("cde62b6455ecd8296e6d97324c0a061cfae5f8d2234ee73af474be9a124ac9f3"),
-uint256S("9cf81d92220b94bf77429575a6a8f7b8cf085994b97be3778e2a8db94c063c3d"),
-uint256S("9cf81d92220b94bf77429575a6a8f7b8cf085994b97be3778e2a8db94c063c3d"),
-uint256S("774e2743c8c181716f7ddad5aa42c3d40c5b388f93e7bcd49d2a773c8c7b96be"),
-uint256S("1180aee6ab8984e884b5e7a4936885fd3b9ecfa2f9e3b5253dffdba2db06519a"),
-uint256S("cad024cd53277a4716ef3dac2bbc8a2657b090b1897e617db582aafff71841ab"),
-uint256S("cad024cd53277a4716ef3dac2bbc8a2657b090b1897e617db582aafff71841ab"),
-uint256S("02262e463673da8e2ce48ff3be8d3dfa290ccffa89291137595529f6c810bf94"),
-uint256S("b72c1eae23fa31246dd0e0be352cdab4113d19c36c568e298cbfc48b8486a8a2"),
-uint256S("df3133a85755734d3542bda79f6823f64f347c2d3126a845f70117c2f7f1aebd"),
-uint256S("df3133a85755734d3542bda79f6823f64f347c2d3126a845f70117c2f7f1aebd"),
-uint256S("b4de131f0835847f6c0944195ee391ac3e529e1189849b60128068df35540bd5"),
-uint256S("b4de131f0835847f6c0944195ee391ac3e529e1189849b60128068df35540bd5"),
-uint256S("1b95f2c02bdbafc2ace2fa479139af8bb87f9e974103f33b2ecd081d073accbe"),
-uint256S("ed9d1e5e5ba43e8e510e7fdda1efad9e32a1884e3ad7c2e6cd834ef45e1e3355"),
-uint256S("ed9d1e5e5ba43e8e510e7fdda1efad9e32a1884e3ad7c2e6cd834ef45e1e3355"),
-uint256S("adc6c2927f1f28f29d53b08c46c419ac8b71f5ce11a282d7c12113d47f027650"),
-uint256S("adc6c2927f1f28f29d53b08c46c419ac8b71f5ce11a282d7c12113d47f027650"),
-uint256S("c437651988e4d42b2e331085e2e0c4863678c3f45e7afd292063950c6d882913"),
-uint256S("c437651988e4d42b2e331085e2e0c4863678c3f45e7afd292063950c6d882913"),
-uint256S("6af400eec5589e9141be56dde2ed6c1827440c2c4778499838f0ae0aab70467a"),
-uint256S("6af400eec5589e9141be56dde2ed6c1827440c2c4778499838f0ae0aab70467a"),
-uint256S("ae8157073ceb87e1ee776677f49b108afad914fbbd431ccfddaa026b88f67986"),
-uint256S("ae8157073ceb87e1ee776677f49b108afad914fbbd431ccfddaa026b88f67986"),
-uint256S("7713f4dc0bdfb5b58fa70743f1c79543458dcec822c63f913ac7e4e560461795"),
-uint256S("7713f4dc0bdfb5b58fa70743f1c79543458dcec822c63f913ac7e4e560461795"),
-uint256S("bb1b6647a14149e50685f51f7af43ef4a6e6c35eb4ccada6d78a8e56c7c8ff70"),
-uint256S("bb1b6647a14149e50685f51f7af43ef4a6e6c35eb4ccada6d78a8e56c7c8ff70"),
-uint256S("dc9228d30b8b4d057e0074c0b14a392f6803bdb9f5b37422106ce691b365a9ac"),
-uint256S("4d0c2287439898e77f8a7058c6bbfb729a8e8f294965a5a8a6b87150928cd325"),
-uint256S("4d0c2287439898e77f8a7058c6bbfb729a8e8f294965a5a8a6b87150928cd325"),
-uint256S("64e24b40156b017f6e0f506a8896614a96156308c9088057038e5f05fc9e5700"),
-uint256S("baab61a00bd4d7bd2c8f04e96e79c837628ec7afbdffe6cdc88259246a5e66cd"),
-uint256S("59c22352d6ff23564a5a0bd47b35709270614e8d93b7557cf8e6260f81666e10"),
-uint256S("a546dab08d7b705bf0fb93fff30b06bdca870092ae547b929553338ce9e70d37"),
-uint256S("a546dab08d7b705bf0fb93fff30b06bdca870092ae547b929553338ce9e70d37"),
-uint256S("557122487b6c600cc3bcba531e355abc26258cd770331b14cb6d348e5b0e3b8d"),
-uint256S("557122487b6c600cc3bcba531e355abc26258cd770331b14cb6d348e5b0e3b8d"),
-uint256S("e85bdb284cf0bd0a9e63b1df14ce07ce53139eb035fb9282ebb3bf3d4af394ce"),
-uint256S("e85bdb284cf0bd0a9e63b1df14ce07ce53139eb035fb9282ebb3bf3d4af394ce"),
-uint256S("9a67364ac11ecdc5811348e89a21e119b6050eddcdc16a029a4361894e95df78"),
-uint256S("9a67364ac11ecdc5811348e89a21e119b6050eddcdc16a029a4361894e95df78"),
-uint256S("57b9472b8d4e0086b0fd68d849bfe9523cc994fb584a77bec8d4a90a1e94cf0d"),
-uint256S("57b9472b8d4e0086b0fd68d849bfe9523cc994fb584a77bec8d4a90a1e94cf0d"),
-uint256S("c5b2f42047563560de7c9fea663a6d533daf867f4bc7a9f96b8d530767dc0b6e"),
-uint256S("c5b2f42047563560de7c9fea663a6d533daf867f4bc7a9f96b8d530767dc0b6e"),
-uint256S("4f99d50ab03f129fb3b437f2d8814795dedd16d64a371bb1bc07b2ee3115d6a1"),
-uint256S("ccd4d3bf34157c3c7d35e23d3986f48df3179323b39cb6eae3b55080f055bd1a"),
-uint256S("ccd4d3bf34157c3c7d35e23d3986f48df3179323b39cb6eae3b55080f055bd1a"),
-uint256S("e3bbe57a14ba62501fdc3e3d36f78e2a38c64c445c5f22b6d966bb78a823f118"),
-uint256S("f3154baac6c2aaa1a0f60b9e6346e8527c3cbef0957e516c6510e60bb1a6b049"),
-uint256S("444825d6e6a3b2b47cdb5de174f4a2196fa2daa8312ac65184fafeee4edfef44"),
-uint256S("444825d6e6a3b2b47cdb5de174f4a2196fa2daa8312ac65184fafeee4edfef44"),
-uint256S("9467e4b6f33f12ab46dd85c680b936e79d23bfbdfb28a3a8368fcfc69cdd2854"),
-uint256S("9467e4b6f33f12ab46dd85c680b936e79d23bfbdfb28a3a8368fcfc69cdd2854"),
-uint256S("170a188722aae38fd9c989e0f53d6ab8ca999e3074f240ed326963cb480191fc"),
-uint256S("170a188722aae38fd9c989e0f53d6ab8ca999e3074f240ed326963cb480191fc"),
-uint256S("346aa5954949c5c4ea9d1ceb4bc16f4128072aef06540b05839e116fae773986"),
-uint256S("346aa5954949c5c4ea9d1ceb4bc16f4128072aef06540b05839e116fae773986"),
-uint256S("459e99998f11b763fbb15ca4ba6e10f409a15820d6db28b91d73f7040e623a40"),
-uint256S("663f2ea179223720466e49c22b12ba9267e479260ade18300306e90a7ae15794"),
-uint256S("663f2ea179223720466e49c22b12ba9267e479260ade18300306e90a7ae15794"),
-uint256S("1e8c230267685f0719262e897809d982c0ce44e9474705baaf720eb591ed5304"),
-uint256S("301891c4ab82864e1c4cb58334326ff596d08303bfddbc5b4f7b26b1e6517f16"),
-uint256S("abba5d391df7e1f9250f6f7af5b009a6acd37a028a0184fc9b836fdd8f543eca"),
-uint256S("6880e580563a678c5559767ad5a3c3aeb4e93c887f72507cf9482906e6fab313"),
-uint256S("bb60b18aeaa5133468d4d71b9718c3c36f83d335a42ee4a57552381bd595948d"),
-uint256S("bb60b18aeaa5133468d4d71b9718c3c36f83d335a42ee4a57552381bd595948d"),
-uint256S("5889f31ec1600bac54b729bda415186f83af6a7f23b25521ffa69d01b08d7b05"),
-uint256S("5889f31ec1600bac54b729bda415186f83af6a7f23b25521ffa69d01b08d7b05"),
-uint256S("9bea4fe25d3b52d19803ca35473adae1b6408ffdc9190285280ee41dcd896615"),
-uint256S("9bea4fe25d3b52d19803ca35473adae1b6408ffdc9190285280ee41dcd896615"),
-uint256S("860cd14a1c6ef0e9f642547d345946358bc0830b59f8b0dfbf08850c9d50ba1b"),
-uint256S("860cd14a1c6ef0e9f642547d345946358bc0830b59f8b0dfbf08850c9d50ba1b"),
-uint256S("3c1f1e10e2206fcd6d47e1372f07edc5ec5112f50e639755ddee740e7be6e457"),
-uint256S("3c1f1e10e2206fcd6d47e1372f07edc5ec5112f50e639755ddee740e7be6e457"),
-uint256S("7f6d1bbf0061d2161812fd46e442b111d9dcb3f34ab4273e7c1332a6da62fb3e"),
-uint256S("49c6fc1c6349381991c3aec926326578e22407d3d89e57a3315fc8ba32b1a20c"),
-uint256S("49c6fc1c6349381991c3aec926326578e22407d3d89e57a3315fc8ba32b1a20c"),
-uint256S("5e5ea1f65b5c13dfda4daf66ca1f47eb151d53a2a85a8ad5f80595d1fbdbfdf2"),
-uint256S("5e5ea1f65b5c13dfda4daf66ca1f47eb151d53a2a85a8ad5f80595d1fbdbfdf2"),
-uint256S("ff28f33e8da4974a11cda22564a183d617c00f2ac9c632d10f09dec4a9c769bb"),
-uint256S("ff28f33e8da4974a11cda22564a183d617c00f2ac9c632d10f09dec4a9c769bb"),
-uint256S("314eb3bf84b8a9fc4ce3c5357fa9d0c4c31495e44004bc67f2547485f57b9c2d"),
-uint256S("ae9041df1c77e476bdd5416f6c32a186c268c5437fec1203eda0cf4a0de0bdf0"),
-uint256S("ae9041df1c77e476bdd5416f6c32a186c268c5437fec1203eda0cf4a0de0bdf0"),
-uint256S("5ade39654e750e6dde7d9e2ed9ae8ffc561c47d7470a27cab6e274e89958931e"),
-uint256S("5ade39654e750e6dde7d9e2ed9ae8ffc561c47d7470a27cab6e274e89958931e"),
-uint256S("d19f7881418b6f9506f7b0a0cb43d071c11792039dbfef692a749417c23e548f"),
-uint256S("d19f7881418b6f9506f7b0a0cb43d071c11792039dbfef692a749417c23e548f"),
-uint256S("f7c2d8788bc6a195bdd4ba40dbb94b86976edcdcb2311544a3b343bcea916c4f"),
-uint256S("f7c2d8788bc6a195bdd4ba40dbb94b86976edcdcb2311544a3b343bcea916c4f"),
-uint256S("c1dbad0c77c358490379fe277796bb892ecdfbf3a5f9c96efaca5a2c268d1474"),
-uint256S("2d485847fec2899448340a04018509a15962b8a9de4350071397604b0b8498f0"),
-uint256S("84889638a936ab9e15e940b1282e60d33e52ff56a124bef9c223fc34338d8a98"),
-uint256S("84889638a936ab9e15e940b1282e60d33e52ff56a124bef9c223fc34338d8a98"),
-uint256S("df1d00c2efabc49714646eba80ff845452e5a8c13746e6175cef40e751e76899"),
-uint256S("df1d00c2efabc49714646eba80ff845452e5a8c13746e6175cef40e751e76899"),
-uint256S("4f74dc0cfd1d4d297a5c35039d2fe1f4d89ac0b44bce65e290a619ec38ded992"),
-uint256S("4f74dc0cfd1d4d297a5c35039d2fe1f4d89ac0b44bce65e290a619ec38ded992"),
-uint256S("a8ef8a9a5903e6791bec55022809c968810d81ea243baee538ff9b090ddf27a5"),
-uint256S("75ae4489ce216cd9ed79bdd0a93e90ce467216e7e9b28d9e7f0865cea569373c"),
-uint256S("75ae4489ce216cd9ed79bdd0a93e90ce467216e7e9b28d9e7f0865cea569373c"),
-uint256S("601ce44e93e322f1f8edbe00d95a124f1ac157b3e2fbbfca839d0647188ff048"),
-uint256S("601ce44e93e322f1f8edbe00d95a124f1ac157b3e2fbbfca839d0647188ff048"),
-uint256S("edf2e6a1590698c8054c9cf250078becfe2441df4fde73a7a558b07a0472cfef"),
-uint256S("edf2e6a1590698c8054c9cf250078becfe2441df4fde73a7a558b07a0472cfef"),
-uint256S("76c213aa50a39176d4c6c0624fef63d80b2a9ffaf545810ba43e45014bd881d4"),
-uint256S("76c213aa50a39176d4c6c0624fef63d80b2a9ffaf545810ba43e45014bd881d4"),
-uint256S("da54fa3af613f8765caa0bb59e303e5fb25f3f90b201393a4fb158610691c6ac"),
-uint256S("23bfd91c878523fd1b79181873e2b815ad479f5e79e42ce916eb9e887654e4e2"),
-uint256S("23bfd91c878523fd1b79181873e2b815ad479f5e79e42ce916eb9e887654e4e2"),
-uint256S("ef74c1e05f87f182fa2bab9285e07212e0330d2e33be0bb9a154bfb79cb20437"),
-uint256S("ef74c1e05f87f182fa2bab9285e07212e0330d2e33be0bb9a154bfb79cb20437"),
-uint256S("cc35b82369952ea465baa9369f7c179ea3b9c38d4e927fe9a0a3dff822a0e738"),
-uint256S("cc35b82369952ea465baa9369f7c179ea3b9c38d4e927fe9a0a3dff822a0e738"),
-uint256S("0e9f709f3bebbc4a5df19773979780cc88369213e15c1996dd63b74177b98b0f"),
-uint256S("163a72eb0836b74765c9bd2dd023ef3e29e97ca7d1104d981522ea4bede45dc1"),
-uint256S("163a72eb0836b74765c9bd2dd023ef3e29e97ca7d1104d981522ea4bede45dc1"),
-uint256S("d55b2cb5d18db5cc94f1d0826fe3e89ac94169c1488c9d04263d9854800bfeca"),
-uint256S("d55b2cb5d18db5cc94f1d0826fe3e89ac94169c1488c9d04263d9854800bfeca"),
-uint256S("a72ea73e55dcb6b5db4ae186ea6f1ca9bb144835ad424ec42267add919172f25"),
-uint256S("8fcaab44d5aec8170a555f40c4c20d70524cea5c6c04f4ce25051a088a6f2c33"),
-uint256S("8fcaab44d5aec8170a555f40c4c20d70524cea5c6c04f4ce25051a088a6f2c33"),
-uint256S("171c8705a487cd4d71f2c9f9843297adee4f1c24a8b3bd87b1b9174856d2951b"),
-uint256S("171c8705a487cd4d71f2c9f9843297adee4f1c24a8b3bd87b1b9174856d2951b"),
-uint256S("dc7a70c99e97f13db2c5f1eabd5514599ede49d8839486acf2b6afb859676331"),
-uint256S("dc7a70c99e97f13db2c5f1eabd5514599ede49d8839486acf2b6afb859676331"),
-uint256S("459dda630726d4a3f1aef43bbe33d1684408113b94760cde594d08dd069b7f85"),
-uint256S("16d20d47ffb7d2f78119af7db897f25133e1ea4b93f71e83b2c3ad246c2b64c7"),
-uint256S("16d20d47ffb7d2f78119af7db897f25133e1ea4b93f71e83b2c3ad246c2b64c7"),
-uint256S("6e7d6d00110e040eed67757889f276d941297f141c71cd54cce5b55f8c337819"),
-uint256S("a07c4e0faf155399c76c1fb6c200e3688748f59b771d9d41fee6f94a0f37febf"),
-uint256S("bb163f715517ee2922381723b22ed364c83f5702b7df2be73e002a6d1b346fdf"),
-uint256S("bb163f715517ee2922381723b22ed364c83f5702b7df2be73e002a6d1b346fdf"),
-uint256S("d97b8aebe877aaf37efa814ebea34025b0deda9614bf6a7af9d130f8062b3fcf"),
-uint256S("d97b8aebe877aaf37efa814ebea34025b0deda9614bf6a7af9d130f8062b3fcf"),
-uint256S("41e33c7c4e313a70af86d796aee10e1e184ebcde51a40d42f6ace172f558d0a6"),
-uint256S("41e33c7c4e313a70af86d796aee10e1e184ebcde51a40d42f6ace172f558d0a6"),
-uint256S("bc0cbd8524e5c5a58c8194358fa9f57366de89773dc6b85c66630f7211d76664"),
-uint256S("bc0cbd8524e5c5a58c8194358fa9f57366de89773dc6b85c66630f7211d76664"),
-uint256S("c2c9d2a2d37c9c64873400c8a97a48ea23756791d2c27cbdcae40c67e8e09e57"),
-uint256S("8ee266fc21b7a9408da75539266860da362ee38049994ab69871c417c07aaaf0"),
-uint256S("61fa79253892718baf4f37050d3b2a198f20b6504db47669a83ec267a0d16af8"),
-uint256S("e7f751f3af0e304f32678fbe24b4f3d7170e360571e9ef98a3d950f9ae703e4d"),
-uint256S("e7f751f3af0e304f32678fbe24b4f3d7170e360571e9ef98a3d950f9ae703e4d"),
-uint256S("2b2dd87bfbcfcdbbc7793a17ec918378fcdc7a7c922a1cf666970a6060ee88c4"),
-uint256S("190062c290cba24bdb4968efdcdb72ebcbacf0b8e241851742ee15c66a964815"),
-uint256S("190062c290cba24bdb4968efdcdb72ebcbacf0b8e241851742ee15c66a964815"),
-uint256S("783615b6491c2288fb645b3f9518046688a584fc359a29bf8e201c8b89491af0"),
-uint256S("783615b6491c2288fb645b3f9518046688a584fc359a29bf8e201c8b89491af0"),
-uint256S("7b15370deb767367e21384e662340b321504a3cbb2549fba8f4dc0f2a7c1114a"),
-uint256S("7b15370deb767367e21384e662340b321504a3cbb2549fba8f4dc0f2a7c1114a"),
-uint256S("9a57c245609b30c3d7287a865725ca5df7bfff259d3ee73e03bbc44c5ead64b6"),
-uint256S("9a57c245609b30c3d7287a865725ca5df7bfff259d3ee73e03bbc44c5ead64b6"),
-uint256S("0ac453d4dc7128751efcaf5fb607eb3a290fdbe5660322c1f4d0b1644721414b"),
-uint256S("0ac453d4dc7128751efcaf5fb607eb3a290fdbe5660322c1f4d0b1644721414b"),
-uint256S("323b9feb2521f6679716631b063b9264eb344b9854ef9660db2e0ba41f86d2e1"),
-uint256S("64b41cbfe0db5366f00b73afe1b6c299a5c9af41d8adaefe297b3e431a794099"),
-uint256S("64b41cbfe0db5366f00b73afe1b6c299a5c9af41d8adaefe297b3e431a794099"),
-uint256S("0d62614235d64e2feadc36100c0c890b6ae6fefceaddeca619300fe59e6fdab4"),
-uint256S("0d62614235d64e2feadc36100c0c890b6ae6fefceaddeca619300fe59e6fdab4"),
-uint256S("5c02f6bbe36d48c905320ae6419759a3408d911769b2862ffc34082e7530c521"),
-uint256S("5c02f6bbe36d48c905320ae6419759a3408d911769b2862ffc34082e7530c521"),
-uint256S("299395de4dcdde4fba99a9f1ca32f4ce25701296d85909b7244b553465a79b0c"),
-uint256S("5be04d427c22abe95d68d690f57b0396e3f8f6e8c2fd8a40f89d6acef07145e5"),
-uint256S("455ddafb6d0973e6f24d6c9f19e5df9ab7e76ac6476f8048a4f127dff9dcc47b"),
-uint256S("11ea39f66741f2987016d6f30ae2342ef079e017b284f886c08a753d93dbf193"),
-uint256S("b2b6d8b575c6476874e56b415a41c00a0bf7140abc083cded1267520a30b92ec"),
-uint256S("52cf5d62ed68a95dde8e3364028a357d3f348aa2e9cd3581c284c8413552bd9a"),
-uint256S("52cf5d62ed68a95dde8e3364028a357d3f348aa2e9cd3581c284c8413552bd9a"),
-uint256S("ec612369c2aa8dfbf0cefc549409a0545334ae5cfb2e56a3b5a6a9a41b06249e"),
-uint256S("5f0a6ba65e9bb0195900830b2667e115ac1cf4b14bdc989c7d6e5dbd34e35bf8"),
-uint256S("5f0a6ba65e9bb0195900830b2667e115ac1cf4b14bdc989c7d6e5dbd34e35bf8"),
-uint256S("24bec88defc02b810757fe91a4cf2016eb93a9ccc6d7296dc253b69ba96cd134"),
-uint256S("07547f16cc5188e8ee82d7b99262c7321a2cbffda2328ec3087c5ad49dd729e6"),
-uint256S("07547f16cc5188e8ee82d7b99262c7321a2cbffda2328ec3087c5ad49dd729e6"),
-uint256S("a318dfb474422bf32788017d42844ead467c15985569eef7a10e2cb73356e395"),
-uint256S("a318dfb474422bf32788017d42844ead467c15985569eef7a10e2cb73356e395"),
-uint256S("5fa07665329a8d2e5bbbb225dd6ac43d014cfe53a900c0a17d5d28f5d9bf33f0"),
-uint256S("868615cf717b98704794df4ec23cc9d507a0a849085ef78e61d992eb53b009e7"),
-uint256S("a7b16eb7763ba092874c8b8d12a7dd1d9c99b006077ded7ba15b488c647627a4"),
-uint256S("a7b16eb7763ba092874c8b8d12a7dd1d9c99b006077ded7ba15b488c647627a4"),
-uint256S("d3a3c13b88c7bb133d0b735028ebf11dd6566ec2df9e48310310a1dae38be310"),
-uint256S("d1f85e7798206e3ced658f13efa1b22f371f502416a4c76dcc84a95fdc34c14a"),
-uint256S("d1f85e7798206e3ced658f13efa1b22f371f502416a4c76dcc84a95fdc34c14a"),
-uint256S("f5f111b4d867afb0542376f4f2336d2c0207f8c7c9d656be8c597dd1ced4c5e7"),
-uint256S("14f0734342026e2da77c7e5f96bf7c1134eaf333c1aba977113707c14f9ec830"),
-uint256S("14f0734342026e2da77c7e5f96bf7c1134eaf333c1aba977113707c14f9ec830"),
-uint256S("af1fc79f3f889d1bfb4fc33bf38ae53f44b68d2748733e2a1e668991063e9ccc"),
-uint256S("10aa34d94f6c086e76cf5fa80ddbfc6cdf2ab5bec3bbb2672b0c8b02cbdec7d4"),
-uint256S("e15eb2d351043d316fe22896479dd2422674095acf45dc2db4786b5f2b43032d"),
-uint256S("e15eb2d351043d316fe22896479dd2422674095acf45dc2db4786b5f2b43032d"),
-uint256S("854ba5de535d9fac7b8a13c581ebd6013d19901d9cdfc135b029e429e3add35d"),
-uint256S("9f0adc1282a4b164553ae8f10ddefc3d303fbcb3538d24355d2cb510aba99c30"),
-uint256S("9f0adc1282a4b164553ae8f10ddefc3d303fbcb3538d24355d2cb510aba99c30"),
-uint256S("ca3c07217581a477f08ca3b132668206a492f39c462fc12647578cd7b26e1ff3"),
-uint256S("34ba734aa028ee7acc9a5e789e1dae8253bed15da8dff48b0fa63c5c6d469e50"),
-uint256S("34ba734aa028ee7acc9a5e789e1dae8253bed15da8dff48b0fa63c5c6d469e50"),
-uint256S("b6411c78662368f9e8b155e301f7e538262e199d2144e5173da27ce0a0f5b4ad"),
-uint256S("618af149f4fc0776cb129a70072414965d83bbec2545fd65cf7fd0589403844c"),
-uint256S("618af149f4fc0776cb129a70072414965d83bbec2545fd65cf7fd0589403844c"),
-uint256S("c1f43c939ddbe9742dcd3436e35e1e0e679e72405b3e9b850a46b0d0ca205fee"),
-uint256S("c1f43c939ddbe9742dcd3436e35e1e0e679e72405b3e9b850a46b0d0ca205fee"),
-uint256S("f2afcca96fa4c0d371a8968dc9854bfe3c93651138b1ba404765ac6153763abc"),
-uint256S("0f801554523971ac060885980444c1fdd984f1b443ad46c42fb84c7a4f1d7e70"),
-uint256S("e0504f2880fc45b91b1adb9cb5429a6a34a831054740a1d65c52180c8e3f9cf2"),
-uint256S("e0504f2880fc45b91b1adb9cb5429a6a34a831054740a1d65c52180c8e3f9cf2"),
-uint256S("6aa8e81a337a75d7e8c382487cdb9f9b1d94cd2166a6efd9b06710a784d238b3"),
-uint256S("6aa8e81a337a75d7e8c382487cdb9f9b1d94cd2166a6efd9b06710a784d238b3"),
-uint256S("49cf4e30a975cf080d49f00f9e9af8157779edf711a6f0d1eb32db8a2aa8bb6e"),
-uint256S("49cf4e30a975cf080d49f00f9e9af8157779edf711a6f0d1eb32db8a2aa8bb6e"),
-uint256S("e9a91c0da816a442aa627d244cfe46abe17dcca5e76a6cc7c2acf696fb8b2520"),
-uint256S("d51ac8b42924d1a9024e54e35b2a889096d48f3c53af46fb1cd26948ef9b3409"),
-uint256S("d51ac8b42924d1a9024e54e35b2a889096d48f3c53af46fb1cd26948ef9b3409"),
-uint256S("5153d846cb16e69ded0662bd0eebf07e301291571f1ce023070e46ddace8c608"),
-uint256S("2074c3ab4048eedecc1e71393ce486cce44886fcc6d301974d780610a0e4d921"),
-uint256S("2074c3ab4048eedecc1e71393ce486cce44886fcc6d301974d780610a0e4d921"),
-uint256S("ed8ce937da26adc158ce4ff419b6e1d1df32985ea28c3dfd8d5c49ccfea2d80a"),
-uint256S("ed8ce937da26adc158ce4ff419b6e1d1df32985ea28c3dfd8d5c49ccfea2d80a"),
-uint256S("4b37154651debce47171d7d9f1061cb4b327a9bf948a9b854c886c1dea6d8d06"),
-uint256S("4b37154651debce47171d7d9f1061cb4b327a9bf948a9b854c886c1dea6d8d06"),
-uint256S("c7168b63f2a1f2d425d27df11b13214c07d6e0b72930fee5a64556beb96e9b3a"),
-uint256S("c7168b63f2a1f2d425d27df11b13214c07d6e0b72930fee5a64556beb96e9b3a"),
-uint256S("f4a9d3d5240c4a3f0f6153088c7065ca8996d89eb447ce14e08b3d057f21c61b"),
-uint256S("f4a9d3d5240c4a3f0f6153088c7065ca8996d89eb447ce14e08b3d057f21c61b"),
-uint256S("6561aea6f2f5142754ba96b8a9bebf3b494e85ea6b1d716bca3923c346142b3c"),
-uint256S("6561aea6f2f5142754ba96b8a9bebf3b494e85ea6b1d716bca3923c346142b3c"),
-uint256S("b82901be1872986edddcbe9439ff720b8054c3b08a5e38bbce3015a5b6a55010"),
-uint256S("b5b7ffb7591a418f23bb6e86c2177ec46cdbb156bc165294309cba9f0bd1d6ab"),
-uint256S("b5b7ffb7591a418f23bb6e86c2177ec46cdbb156bc165294309cba9f0bd1d6ab"),
-uint256S("9e1e75477fdfd3c307fd09611f1b8a490fc6f4379a5ef71c6dbe70404b4130fc"),
-uint256S("9e1e75477fdfd3c307fd09611f1b8a490fc6f4379a5ef71c6dbe70404b4130fc"),
-uint256S("82892dbd256ef6444ab1d6b972463a8d7ac43f4ae46f1f8e962bc52d8f8540d7"),
-uint256S("82892dbd256ef6444ab1d6b972463a8d7ac43f4ae46f1f8e962bc52d8f8540d7"),
-uint256S("4a846f6c19441a3774bc9d6f49a729e0faf30ff8435c2db2f6e7d9b396b9a78c"),
-uint256S("4a846f6c19441a3774bc9d6f49a729e0faf30ff8435c2db2f6e7d9b396b9a78c"),
-uint256S("5d59e2494dc809c88200f226edd502843da724906735a9922be927ccb061fad8"),
-uint256S("5d59e2494dc809c88200f226edd502843da724906735a9922be927ccb061fad8"),
-uint256S("92161104c4d59bdded6a53e255db3366d2b8a769a383b83e8b5da1c7d45b9aea"),
-uint256S("92161104c4d59bdded6a53e255db3366d2b8a769a383b83e8b5da1c7d45b9aea"),
-uint256S("282087819e1970bd58813d38ef105f655bee376ab2e7a8b95ad30948ed3ae998"),
-uint256S("282087819e1970bd58813d38ef105f655bee376ab2e7a8b95ad30948ed3ae998"),
-uint256S("fc18492f7dcbc4d735137762c1764716197c63e4fbe3564fcc44375ba200e92d"),
-uint256S("fc18492f7dcbc4d735137762c1764716197c63e4fbe3564fcc44375ba200e92d"),
-uint256S("119e6252559fc9e4f53a7ca60199622b24fcb3d4ccc1c641077b3286ca2cb34e"),
-uint256S("119e6252559fc9e4f53a7ca60199622b24fcb3d4ccc1c641077b3286ca2cb34e"),
-uint256S("ea37b4fe424a64cbc95b7093e3a279836e19b03fe16817a74474be47f93289fc"),
-uint256S("ea37b4fe424a64cbc95b7093e3a279836e19b03fe16817a74474be47f93289fc"),
-uint256S("419ccf18b97d8d0dd9cb030a0dfb5d3efea05c61018ab6db74354a3ccb979c84"),
-uint256S("419ccf18b97d8d0dd9cb030a0dfb5d3efea05c61018ab6db74354a3ccb979c84"),
-uint256S("543370a8b0ef521cf648d897cbf8b6f5c9bb7494bd0a3e77f608f6c05ab60f92"),
-uint256S("543370a8b0ef521cf648d897cbf8b6f5c9bb7494bd0a3e77f608f6c05ab60f92"),
-uint256S("014097f4112b465a840971131c82ba78f818b3c689461fe41823fcd17a318e59"),
-uint256S("014097f4112b465a840971131c82ba78f818b3c689461fe41823fcd17a318e59"),
-uint256S("95f336a9e0c79c7fa8d74bd0a2ab57ce491cb545365eaaf41625fe3f42647540"),
-uint256S("95f336a9e0c79c7fa8d74bd0a2ab57ce491cb545365eaaf41625fe3f42647540"),
-uint256S("4e5b8787b58a2c9e0a00a3ee0d4189f62a954512abcd125122802fe5b95f61a2"),
-uint256S("4e5b8787b58a2c9e0a00a3ee0d4189f62a954512abcd125122802fe5b95f61a2"),
-uint256S("da61563e6d6a07c35b72dc38f61558cf6037b55df7733718ce08c2bac81ab3c1"),
-uint256S("da61563e6d6a07c35b72dc38f61558cf6037b55df7733718ce08c2bac81ab3c1"),
-uint256S("7ff952d702e026e759a38c2ecac7a66d41d2c57763437764334701d0054b223b"),
-uint256S("7ff952d702e026e759a38c2ecac7a66d41d2c57763437764334701d0054b223b"),
-uint256S("9baa16010f16bc7b764709f3eaf92a5bb14d76eac02c037741fd77b6dcdcd29d"),
-uint256S("efc85cddf7d1a472ccd0ec82d3a5377d33737abbf40b9065f8c1885245959464"),
-uint256S("efc85cddf7d1a472ccd0ec82d3a5377d33737abbf40b9065f8c1885245959464"),
-uint256S("9da4f52a65a206c83ee89ba3f00cbfe3cb1cd2f9ddae893d0b4511749fc14edb"),
-uint256S("9da4f52a65a206c83ee89ba3f00cbfe3cb1cd2f9ddae893d0b4511749fc14edb"),
-uint256S("52a7add129810b8aeb5b7bfadf4de225867f76cca9e6f52c44ec0d069e6cf34e"),
-uint256S("52a7add129810b8aeb5b7bfadf4de225867f76cca9e6f52c44ec0d069e6cf34e"),
-uint256S("17341c64143609e6329dafd023b9ac77e219d3aee12cbed1661e55d6b49ab037"),
-uint256S("17341c64143609e6329dafd023b9ac77e219d3aee12cbed1661e55d6b49ab037"),
-uint256S("fda52a3b10ee7ea69de6581cf73cc6743e1907793d54ea3b6bff2a6b3e30a999"),
-uint256S("fda52a3b10ee7ea69de6581cf73cc6743e1907793d54ea3b6bff2a6b3e30a999"),
-uint256S("945894b4772ac1b9e10d87bb5bc88a8689387707090fcf9c2f5c2b9706e3c667"),
-uint256S("945894b4772ac1b9e10d87bb5bc88a8689387707090fcf9c2f5c2b9706e3c667"),
-uint256S("9ecbc8b1954282733d84c3e8c56d3f26117718a60712f56c27d15716cca252a5"),
-uint256S("9ecbc8b1954282733d84c3e8c56d3f26117718a60712f56c27d15716cca252a5"),
-uint256S("599b3d15488077d9946e802846e18ea4d27038d07dee1dbe10132ee95c4f2e66"),
-uint256S("599b3d15488077d9946e802846e18ea4d27038d07dee1dbe10132ee95c4f2e66"),
-uint256S("ed26e5cf870c915a83adcdeec47e21347b5fd5b03259526ca2b81d36747c31c4"),
-uint256S("ed26e5cf870c915a83adcdeec47e21347b5fd5b03259526ca2b81d36747c31c4"),
-uint256S("2c78f730e39ce8e2c435dd260f3f1a2bae7e71171d5219911d2fa156abe93c02"),
-uint256S("2c78f730e39ce8e2c435dd260f3f1a2bae7e71171d5219911d2fa156abe93c02"),
-uint256S("6fc35b062253efd935f227b7189f4b40d011de8ee5388caedfce5757b2be3192"),
-uint256S("9d4f22ad80c8604f25a613045e51bfc44c505df99cd3d5a6d33e25413b26aa95"),
-uint256S("9d4f22ad80c8604f25a613045e51bfc44c505df99cd3d5a6d33e25413b26aa95"),
-uint256S("bba97d16b0ece6d3f905c99493c12481d6bf6d544b489d0ebfd25acca7d10283"),
-uint256S("bba97d16b0ece6d3f905c99493c12481d6bf6d544b489d0ebfd25acca7d10283"),
-uint256S("836bcffd52f83496598896ab5639eb67fff12fda848f05186ae1c59f1cc9c7e3"),
-uint256S("836bcffd52f83496598896ab5639eb67fff12fda848f05186ae1c59f1cc9c7e3"),
-uint256S("468508e689f27d3c3c35b9d4bc49d9e74dee8bb7c9c2d5c309488a9e07ec04d5"),
-uint256S("468508e689f27d3c3c35b9d4bc49d9e74dee8bb7c9c2d5c309488a9e07ec04d5"),
-uint256S("66caa09d4f423e915ebfde43cf3d7576787d305089b948b2d73464c3189577b4"),
-uint256S("66caa09d4f423e915ebfde43cf3d7576787d305089b948b2d73464c3189577b4"),
-uint256S("4cf874877904351f63f4e0d65f3f63ae33c946a23baba175193d6293be17477b"),
-uint256S("4cf874877904351f63f4e0d65f3f63ae33c946a23baba175193d6293be17477b"),
-uint256S("0c9c128476e23abed2216cd1e082d65ad53fe7ebe9b6d2696e6c69eec7e94405"),
-uint256S("7cd46ad72e122907fc2cca219d04b14d97f4885e6772818e81e9c17b7e98e21b"),
-uint256S("7cd46ad72e122907fc2cca219d04b14d97f4885e6772818e81e9c17b7e98e21b"),
-uint256S("9f44a70bd1a52be7170f84f7cb89f4528196204bcb5024f5e550874b593f5905"),
-uint256S("9f44a70bd1a52be7170f84f7cb89f4528196204bcb5024f5e550874b593f5905"),
-uint256S("74698d7eee2bfb9e0813c9515985465a1e63765c6c371a0d69639a2c6281f79b"),
-uint256S("74698d7eee2bfb9e0813c9515985465a1e63765c6c371a0d69639a2c6281f79b"),
-uint256S("de019bea69677fb2c3da1c17a1ebe53edc797216159df2a31f86ba06e05ac3fe"),
-uint256S("de019bea69677fb2c3da1c17a1ebe53edc797216159df2a31f86ba06e05ac3fe"),
-uint256S("8a6cfc37c968c6e64af6c3e65abe904ddd2300389fd2d9ff04f326e95640f2fe"),
-uint256S("8a6cfc37c968c6e64af6c3e65abe904ddd2300389fd2d9ff04f326e95640f2fe"),
-uint256S("c753dabbd381192a3ae1a2d019109c827f6222d0467bee1d33abb6db72abdf9d"),
-uint256S("c753dabbd381192a3ae1a2d019109c827f6222d0467bee1d33abb6db72abdf9d"),
-uint256S("33793ff34e232c088b2725480d5a0930f556ee1e45c7826a42653d83452f919f"),
-uint256S("33793ff34e232c088b2725480d5a0930f556ee1e45c7826a42653d83452f919f"),
-uint256S("a71e96024e61964056cfa7378e22f80ed66b68221982d1214914baeceb1b41e2"),
-uint256S("a71e96024e61964056cfa7378e22f80ed66b68221982d1214914baeceb1b41e2"),
-uint256S("b580057169beac68fce1eea9633120ef293c51ddfb33ccd45fd0f0a350b5a097"),
-uint256S("c8890ec6fad9a550656c0a4ecfcd12fbdf51b5792cde7685055a7c635b50879c"),
-uint256S("c8890ec6fad9a550656c0a4ecfcd12fbdf51b5792cde7685055a7c635b50879c"),
-uint256S("f36140917c35d7b4c19eba791635aef260423bedc0046a74aee7332fefae9b2f"),
-uint256S("f36140917c35d7b4c19eba791635aef260423bedc0046a74aee7332fefae9b2f"),
-uint256S("038601ee137f4cf5b59ec85a00fd64d7bf2436f5dff4ae573461fa760cd18251"),
-uint256S("038601ee137f4cf5b59ec85a00fd64d7bf2436f5dff4ae573461fa760cd18251"),
-uint256S("d3d27bf868136fc08a26e02f42e34f0d29dda8eefbc909d09f1e933a79bf329f"),
-uint256S("2123dbbf919538e07f454578f582ea01e41451d766b807f6d420f767573c0634"),
-uint256S("2123dbbf919538e07f454578f582ea01e41451d766b807f6d420f767573c0634"),
-uint256S("894ab031c07d72f0424e0121f4fa954c33a97f27339e719a215b488a44f902f0"),
-uint256S("894ab031c07d72f0424e0121f4fa954c33a97f27339e719a215b488a44f902f0"),
-uint256S("43a6488840026ab376f97600e2adaba3b2924e03664b8cf9c4224e3588bd249a"),
-uint256S("43a6488840026ab376f97600e2adaba3b2924e03664b8cf9c4224e3588bd249a"),
-uint256S("77709ebd97eb672e11971072438e736dc2f86a03aeb4ca637646fe1c6a658cfc"),
-uint256S("77709ebd97eb672e11971072438e736dc2f86a03aeb4ca637646fe1c6a658cfc"),
-uint256S("4c76b0aff5cf0cdc2d6129a71d9c53f25e14ca79ea1da558393480d01ef5015a"),
-uint256S("4c76b0aff5cf0cdc2d6129a71d9c53f25e14ca79ea1da558393480d01ef5015a"),
-uint256S("18e479190489d63d66a86edfa0d8efa7fca397f7ca5d3261c2816b2e57ca54e0"),
-uint256S("18e479190489d63d66a86edfa0d8efa7fca397f7ca5d3261c2816b2e57ca54e0"),
-uint256S("f92ed5df42ab0b41e5e8a59d649ed0b4cfd8c6da7d3439a87e0a68db1f3094ae"),
-uint256S("f92ed5df42ab0b41e5e8a59d649ed0b4cfd8c6da7d3439a87e0a68db1f3094ae"),
-uint256S("a786015e6ed5ba0d81a1b276d014a7557b8f02b6ab473f57d238ae68272fbb99"),
-uint256S("a786015e6ed5ba0d81a1b276d014a7557b8f02b6ab473f57d238ae68272fbb99"),
-uint256S("e91f85705296c1befa66acebad65d8e406670e3c9e23157d710897cdb99a923c"),
-uint256S("e91f85705296c1befa66acebad65d8e406670e3c9e23157d710897cdb99a923c"),
-uint256S("84e96a3c5cc2a005c6b42e3236bf19cace7e8535359dbe1f8dd0c74a15440a25"),
-uint256S("5f865520e6f16648a53fcd79a9cfa2ee25dc173aeae5f066dd00bb4092f84324"),
-uint256S("5f865520e6f16648a53fcd79a9cfa2ee25dc173aeae5f066dd00bb4092f84324"),
-uint256S("b673940453616f3593696e7d399fb7da4a2e7002eaa29d85f48681732376f0a5"),
-uint256S("b673940453616f3593696e7d399fb7da4a2e7002eaa29d85f48681732376f0a5"),
-uint256S("5427fc7e2d61f1befce50163ad021855caab8b3feff44815fb6652f9e7f0bb12"),
-uint256S("5427fc7e2d61f1befce50163ad021855caab8b3feff44815fb6652f9e7f0bb12"),
-uint256S("93944c54122f5c0536313ba4ced22f8d4d818e6966e3b7b0c36823b14d9bce7f"),
-uint256S("93944c54122f5c0536313ba4ced22f8d4d818e6966e3b7b0c36823b14d9bce7f"),
-uint256S("9e32dbbb26f1631f1f6ab2018ff015d1e9bed8519118b662bfbbfed5a68155ed"),
-uint256S("9e32dbbb26f1631f1f6ab2018ff015d1e9bed8519118b662bfbbfed5a68155ed"),
-uint256S("0f505df7675a65575ff7f090795b24c26262389d2b02ab7845e742bfbcbe3121"),
-uint256S("0f505df7675a65575ff7f090795b24c26262389d2b02ab7845e742bfbcbe3121"),
-uint256S("d8a89eb61979382bcb5f62b319416eb78f807c5b4fdbbe5f0cb3956fc4ceaffa"),
-uint256S("d8a89eb61979382bcb5f62b319416eb78f807c5b4fdbbe5f0cb3956fc4ceaffa"),
-uint256S("e5664377afca68da78e146de876a3254576d4ede63f4016f7ef35c48bbd3af12"),
-uint256S("e5664377afca68da78e146de876a3254576d4ede63f4016f7ef35c48bbd3af12"),
-uint256S("f85221328757ed6455c58bc99566385296b61ce0d81850f753497b8d903286fd"),
-uint256S("f85221328757ed6455c58bc99566385296b61ce0d81850f753497b8d903286fd"),
-uint256S("0b387ad686c994d095547fe6e358e0fca74e27943d2d076cef76b4c2c95b20fb"),
-uint256S("0b387ad686c994d095547fe6e358e0fca74e27943d2d076cef76b4c2c95b20fb"),
-uint256S("5120208fbf72dc60a3da57326b1f72ab4e02859e407751d93a08414b634a1faa"),
-uint256S("f40355a6aaffdc6abecf7841882e89f09ce22e5862412a69be27856f07c50694"),
-uint256S("f40355a6aaffdc6abecf7841882e89f09ce22e5862412a69be27856f07c50694"),
-uint256S("20facd2817d00646f8928c57f8dda39b22eafd524d7ee90ce78c230557528f90"),
-uint256S("20facd2817d00646f8928c57f8dda39b22eafd524d7ee90ce78c230557528f90"),
-uint256S("3e467a9a24c2450e58062754afce6ca4d52db70bb370260a723099a316062c85"),
-uint256S("3e467a9a24c2450e58062754afce6ca4d52db70bb370260a723099a316062c85"),
-uint256S("e9df17bfcf0545ce1d34321f955d888fd91bc4f27738ac3ff193e63e1e531583"),
-uint256S("e9df17bfcf0545ce1d34321f955d888fd91bc4f27738ac3ff193e63e1e531583"),
-uint256S("d19144f5535c41a3eb858f33f0b276e6ec419deadebd2beb5e7e9eca1c538f00"),
-uint256S("d19144f5535c41a3eb858f33f0b276e6ec419deadebd2beb5e7e9eca1c538f00"),
-uint256S("e2fab3cd4a96c1b97647ce37db013e5be35b8bb3507fb37e869aadd70f6a7625"),
-uint256S("b6ce4cbc50bb63b45d159f63e0cf327758fc54139044b8d7205651fe3ff51fbd"),
-uint256S("b6ce4cbc50bb63b45d159f63e0cf327758fc54139044b8d7205651fe3ff51fbd"),
-uint256S("161f0cc4830ae86bc6f8a4534e10f1e3dad9442e082548d9f11af6ce4bdd2e88"),
-uint256S("161f0cc4830ae86bc6f8a4534e10f1e3dad9442e082548d9f11af6ce4bdd2e88"),
-uint256S("42dba4b26c12a8772e7294630ba2e072a74fd70f1da4bdd76c567bf6972ebff5"),
-uint256S("42dba4b26c12a8772e7294630ba2e072a74fd70f1da4bdd76c567bf6972ebff5"),
-uint256S("a99487098122cd814af0c5c5f2e9012eb70828fddbdb4f86917f04a697b0d888"),
-uint256S("a0037761808460617d8f793c1cc349d48df6e8d7ae325b5c92c578b99191eec8"),
-uint256S("e21940677a5f743c2fc27e2a279b55c09bfa361384c02d07d8607d6956591685"),
-uint256S("e21940677a5f743c2fc27e2a279b55c09bfa361384c02d07d8607d6956591685"),
-uint256S("125f5cb9774551ac93a1a422b6e4703d039bfed23fd368c00d2f80d82bd935ed"),
-uint256S("125f5cb9774551ac93a1a422b6e4703d039bfed23fd368c00d2f80d82bd935ed"),
-uint256S("78d9ff2fd0301862e058af1ae955827d5863517d9dd74e059c043210f96d537f"),
-uint256S("78d9ff2fd0301862e058af1ae955827d5863517d9dd74e059c043210f96d537f"),
-uint256S("0d02f6934ed6ea98062e5fd0f75af26a910e812ceae9d04d39d528ee6fc4a652"),
-uint256S("0d02f6934ed6ea98062e5fd0f75af26a910e812ceae9d04d39d528ee6fc4a652"),
-uint256S("9f863a3287a43ce6ad4bc49caae788e2061df6ffd6c7077ae98c4e5e143237ab"),
-uint256S("9f863a3287a43ce6ad4bc49caae788e2061df6ffd6c7077ae98c4e5e143237ab"),
-uint256S("c8c4fb4cbe3feb329f331be52d2585477401ffe095a40b11fed9326673fd3a6b"),
-uint256S("c8c4fb4cbe3feb329f331be52d2585477401ffe095a40b11fed9326673fd3a6b"),
-uint256S("05810f844a2acb1ad943eb804c91665316971bfdc0a37ae615389af553aca1f9"),
-uint256S("05810f844a2acb1ad943eb804c91665316971bfdc0a37ae615389af553aca1f9"),
-uint256S("413805bd5523d0e1526c23347a29dc32cd440be449d0f99991a558bca8812d1c"),
-uint256S("413805bd5523d0e1526c23347a29dc32cd440be449d0f99991a558bca8812d1c"),
-uint256S("782f87ba008d7916fd530c0aec9bb78402096fd62fbe1927d291090cb44f2a10"),
-uint256S("782f87ba008d7916fd530c0aec9bb78402096fd62fbe1927d291090cb44f2a10"),
-uint256S("27f3cc98061ef0cde0766a4d8ad3e10b962a8f387be2ed40537ac7a2d758aed4"),
-uint256S("27f3cc98061ef0cde0766a4d8ad3e10b962a8f387be2ed40537ac7a2d758aed4"),
-uint256S("aceba79a7d5b868aff0e981fdb72cfcebc9fdf4e935171bb336901079e563c08"),
-uint256S("aceba79a7d5b868aff0e981fdb72cfcebc9fdf4e935171bb336901079e563c08"),
-uint256S("6fc51ad40c198847c9060f838d0c2f6703800c1c72405cf285ea70baf76ed6d7"),
-uint256S("6fc51ad40c198847c9060f838d0c2f6703800c1c72405cf285ea70baf76ed6d7"),
-uint256S("c75afd3787aa1f7a953873208d24289cf14e2a438d6cc9822468adf383fc0eb7"),
-uint256S("c75afd3787aa1f7a953873208d24289cf14e2a438d6cc9822468adf383fc0eb7"),
-uint256S("70f512f3e32ca6d1d7c03cf417d03fb552a60ed51ef0611a58e21b243058513d"),
-uint256S("70f512f3e32ca6d1d7c03cf417d03fb552a60ed51ef0611a58e21b243058513d"),
-uint256S("bd46a400769f028c10ccad1bd617cfc9440d654d49315565da2b52f7af40f4a1"),
-uint256S("bd46a400769f028c10ccad1bd617cfc9440d654d49315565da2b52f7af40f4a1"),
-uint256S("2f629ccf6cc6243b4dba1b432b89b7107dd4380747ffbceb13afb6ebd2b31d45"),
-uint256S("5869c7ec1cd0b726b29e192deb2b8b6fc9c8e3f59539e0f0916444db6332c2d6"),
-uint256S("5869c7ec1cd0b726b29e192deb2b8b6fc9c8e3f59539e0f0916444db6332c2d6"),
-uint256S("c4555ec46c8816a167fd0d9a57b20fd113b55533cc2f2abe9c6083fbe5692c6b"),
-uint256S("c4555ec46c8816a167fd0d9a57b20fd113b55533cc2f2abe9c6083fbe5692c6b"),
-uint256S("debf8cdbadf0a2c8e86ca675a6182dc8f00b144f56fd4ffe698b630ba2e999e1"),
-uint256S("53b709c46af519ab4fd8f493ec42d86d835ca56722db16890d6e781e3dcdb714"),
-uint256S("53b709c46af519ab4fd8f493ec42d86d835ca56722db16890d6e781e3dcdb714"),
-uint256S("f7ea2ad234f459872c9685a7474153b19b5cd3f2dde0c0b380a916cebd592904"),
-uint256S("04827205d7fd81b51464ed0f350d7d50a3b853da7567bed5d47a9c5724f4e01d"),
-uint256S("c47befd652d8409e98a59a8aca4d4e95c2542a0f351dfc522d696fcacffd994e"),
-uint256S("c47befd652d8409e98a59a8aca4d4e95c2542a0f351dfc522d696fcacffd994e"),
-uint256S("1fe47e1ebdcee6b05a75d98b28c0f774baaa1d80657e3f1c3725f86a4e54f87c"),
-uint256S("ce28d8e985ac5cf6c2f78a2f8b82e787acd73d565d62f9880a57e18c234a5f0a"),
-uint256S("ce28d8e985ac5cf6c2f78a2f8b82e787acd73d565d62f9880a57e18c234a5f0a"),
-uint256S("ab63f62721aaef0977817f0d3b9d4c668d9cc730bc9fd80f22533de2a7308820"),
-uint256S("8618159d30b4269691ec322d61ab1dd46376ed048ad2296677e892a4a0e6a1f6"),
-uint256S("8618159d30b4269691ec322d61ab1dd46376ed048ad2296677e892a4a0e6a1f6"),
-uint256S("05931dadc66f80468ad9dca785de6663e542ac5dc4193fedfc3ae476ef7c61a2"),
-uint256S("05931dadc66f80468ad9dca785de6663e542ac5dc4193fedfc3ae476ef7c61a2"),
-uint256S("cd7a2781da6ae3a3f5cf4ed30ff3cf54e722426f212e0494b7da0aecb982fe89"),
-uint256S("c718370de825454365759bbaa873018503bdf8d4adc65698976f570e12ecf1fc"),
-uint256S("56c50dc3490b3cf861eb4e5dbf3656a1f0cc58da5585ab6af151bf6744c43169"),
-uint256S("985989ca380c0564b0f689534ef7ee2b2248e01cadf692bf8e579f9aed257ba9"),
-uint256S("985989ca380c0564b0f689534ef7ee2b2248e01cadf692bf8e579f9aed257ba9"),
-uint256S("2c25984d19dbb1d0eda019f794eeef5e0f95ad687bb903b351b9e3bf0fbfcff6"),
-uint256S("2c25984d19dbb1d0eda019f794eeef5e0f95ad687bb903b351b9e3bf0fbfcff6"),
-uint256S("b2a36947b28d00ab6cfd48e521a28b9be514b54b8318de4f757661dc8394c753"),
-uint256S("b2a36947b28d00ab6cfd48e521a28b9be514b54b8318de4f757661dc8394c753"),
-uint256S("ccfcdd846b9c5d550a27beabbe245f24c435374d2f77cc0b23cc10b1337d5e79"),
-uint256S("ccfcdd846b9c5d550a27beabbe245f24c435374d2f77cc0b23cc10b1337d5e79"),
-uint256S("c04cf3a35b2924da46bb56f2c42c9eb2ac5014f30942ddd1659d3e081bf45b86"),
-uint256S("d9a7f056ac14a1b7afc343a1d6eb77d7f793be6cf5ce020e8355e79bb9107bad"),
-uint256S("d15fca50b66215ed68618e007cdf41a9074cff363191c22f5c0d94a813d83759"),
-uint256S("7a909566e1d047a8c405f04acc4566b1ca18294b03fc7326a3baf85ff6703f48"),
-uint256S("7a909566e1d047a8c405f04acc4566b1ca18294b03fc7326a3baf85ff6703f48"),
-uint256S("f1a4be51fd91c4067d6967219b67880fee84cff0d3bf61ea460c0a7e051f7a27"),
-uint256S("f1a4be51fd91c4067d6967219b67880fee84cff0d3bf61ea460c0a7e051f7a27"),
-uint256S("b12c2b0c03dc491d3ca8d4e4a76ec6455fa7d29904d25cf035da33bc3d823447"),
-uint256S("d9bf4062737d0922cf8beb419d79bd10d109918e9d3d230b6b49ff4cf946ee2a"),
-uint256S("461e19910e829d4127a8b2f83c0fe761b26dc4c032dfbe93100a4abda2d1cedd"),
-uint256S("461e19910e829d4127a8b2f83c0fe761b26dc4c032dfbe93100a4abda2d1cedd"),
-uint256S("51838c3d52da894a32e2e261d81249796d18b0ecc889131211737485d174079e"),
-uint256S("dcbb1ace2a6f7a2bd9c0e5f502157f58c539cbccb9102ad19c448420eacf46da"),
-uint256S("f78d40802fe7acf0429328f62314ddf01ed2519d18d6e53842e8dcff73e11f77"),
-uint256S("4b92cd02a5be1bd6cafe7e7140d8a2d1b10ff761ed0ca88ab9a9ba59acb5098d"),
-uint256S("550b508429406d11e9dadb370b05fb169c244b59908f4bc73df812f18997c0f8"),
-uint256S("550b508429406d11e9dadb370b05fb169c244b59908f4bc73df812f18997c0f8"),
-uint256S("d7c66a6b2ae222de3f4e4c8317611784d0f7ba4ecadc33319b1a58207d3102b6"),
-uint256S("9a4a8e482047e02144d712468fa05f77ff5d2b55024c9cdddf2e2a6520d0c2ac"),
-uint256S("9a4a8e482047e02144d712468fa05f77ff5d2b55024c9cdddf2e2a6520d0c2ac"),
-uint256S("0c963491f2b9748fa09a71826b351466eecce859c87781f853182804bd6dc61d"),
-uint256S("0c963491f2b9748fa09a71826b351466eecce859c87781f853182804bd6dc61d"),
-uint256S("ad2f12936300dc0d10db4f56c00d6fef18c3b4c69082172d8d7ab2b2e8207f02"),
-uint256S("62ef788cbd7fadb17f25c9ab2acf0a93403e84f232318c6a188bdd164c6736ba"),
-uint256S("62ef788cbd7fadb17f25c9ab2acf0a93403e84f232318c6a188bdd164c6736ba"),
-uint256S("c792e40b4687dcd3d00e5571f7509c640cc6c6dc72359117c711776fb872bd20"),
-uint256S("c792e40b4687dcd3d00e5571f7509c640cc6c6dc72359117c711776fb872bd20"),
-uint256S("c566735dea76aeca50c05d8cdd3532cfaf5196c7e483063a9042c5c0c35ba461"),
-uint256S("c566735dea76aeca50c05d8cdd3532cfaf5196c7e483063a9042c5c0c35ba461"),
-uint256S("a1df9c2322cbc95e5b65a3a267b4c3eda7feb7d0a09fa8b64c1dc974c238ff0d"),
-uint256S("66c45c853b528a3e6edfde08a3ba1435813bf2a817176c93bf7d8196dbc45913"),
-uint256S("66c45c853b528a3e6edfde08a3ba1435813bf2a817176c93bf7d8196dbc45913"),
-uint256S("a97b7411f8bfa18a080d0156b6c45e175c7f86c66739f28c1168b669a9a9eb30"),
-uint256S("a97b7411f8bfa18a080d0156b6c45e175c7f86c66739f28c1168b669a9a9eb30"),
-uint256S("c517dabe3d9fb41cef8353cc30023ed3553f84d06a940d32656a13e9fd9e89f8"),
-uint256S("4513e3c16b0636058787320aa4d511cb8a840b40f117e23c34ea322227f6fb71"),
-uint256S("4513e3c16b0636058787320aa4d511cb8a840b40f117e23c34ea322227f6fb71"),
-uint256S("dc4379991a53e3ce036cbfa02a6b99604e07d96cfc7405778c934d1a82f20fa1"),
-uint256S("dc4379991a53e3ce036cbfa02a6b99604e07d96cfc7405778c934d1a82f20fa1"),
-uint256S("1fe5a0a9aa277d65a34a21247c16650df933fc5c8691894c85ea78c23d7d29bb"),
-uint256S("1fe5a0a9aa277d65a34a21247c16650df933fc5c8691894c85ea78c23d7d29bb"),
-uint256S("5cba71402131d0afd5f860335558fd27d68ba0e545f01c027197516c41e59872"),
-uint256S("5cba71402131d0afd5f860335558fd27d68ba0e545f01c027197516c41e59872"),
-uint256S("f95827680d8086fcc57d6c0ac20c3ffbb4cf2e43284a0476eae394fd31943f60"),
-uint256S("3e79e7c1b96ec345d4aae27c11861ed8a98feb40eb286a446bb1c413ee9f5728"),
-uint256S("3e79e7c1b96ec345d4aae27c11861ed8a98feb40eb286a446bb1c413ee9f5728"),
-uint256S("dbccdfe49a853ca57bd85b5bf43253d8adbedaa5b147d4acdd0cee8374937e86"),
-uint256S("dbccdfe49a853ca57bd85b5bf43253d8adbedaa5b147d4acdd0cee8374937e86"),
-uint256S("3c28ba3d447edf1d981a4854a867c9e4342df450c7397ba9270957d21d0c22d1"),
-uint256S("3c28ba3d447edf1d981a4854a867c9e4342df450c7397ba9270957d21d0c22d1"),
-uint256S("1598e0270b049e063f231af0eab1c0b6ac837157b7605432004f638582f4f958"),
-uint256S("1598e0270b049e063f231af0eab1c0b6ac837157b7605432004f638582f4f958"),
-uint256S("fdaafef1f6ab4b4cf9402d2bbf0ceba07aa40ecbe2ebfabc0d002cb1306b05ea"),
-uint256S("fdaafef1f6ab4b4cf9402d2bbf0ceba07aa40ecbe2ebfabc0d002cb1306b05ea"),
-uint256S("c063507aedcb18ef64e1c367fd3f99dc1d6df0833ae4e06855b6e26a61a5587c"),
-uint256S("c063507aedcb18ef64e1c367fd3f99dc1d6df0833ae4e06855b6e26a61a5587c"),
-uint256S("f99bfb84eafcf721989599f816e535ff543ca419b22505cb25796a98187ef478"),
-uint256S("f99bfb84eafcf721989599f816e535ff543ca419b22505cb25796a98187ef478"),
-uint256S("07c8fec0b8e512ca5aba36ed853c13f03f53390a9e216515b3516eddbffadcb4"),
-uint256S("07c8fec0b8e512ca5aba36ed853c13f03f53390a9e216515b3516eddbffadcb4"),
-uint256S("f3be3caafbf6ce96c22e5760118ea10e5dcee54e7362b6ad5faf5d2e72bd2219"),
-uint256S("3dd4c639946660fd0ee83cf57b4ba3da3871a47d26edb0fab7d89d25f98d31ab"),
-uint256S("f38635193466e0640ded241bc65c8e6271b2e97ee6f034eb3d15e493fcc98e21"),
-uint256S("113d13b375295bb3a808d6e30b4ad9ab83d9a9f60872d7aed2d8da2ef382830a"),
-uint256S("113d13b375295bb3a808d6e30b4ad9ab83d9a9f60872d7aed2d8da2ef382830a"),
-uint256S("5b3200a52515d01eefacfce5f83a1b773d25813dbe13de9c2110a06f41f2bc06"),
-uint256S("a9b8d7fbc112848dfb04dea8aeaad6019e24ffd86355274d8117c11110e8d5ba"),
-uint256S("fcf79c1a85dcca68af117cce20b1ec6ffc8c5865f63f4168750d6a9b37789c88"),
-uint256S("fcf79c1a85dcca68af117cce20b1ec6ffc8c5865f63f4168750d6a9b37789c88"),
-uint256S("e3eb601e0015928c147e428c8d72877d8d7dc623b9cfc908b2bc1f08252ea94a"),
-uint256S("e3eb601e0015928c147e428c8d72877d8d7dc623b9cfc908b2bc1f08252ea94a"),
-uint256S("18c7df0c807cab9e5354bdd67d0fd9c63c5f9a8dfc7ae419c0479b5e41dbb260"),
-uint256S("93915b73bde4b5fece5802427e2b8609de53e1528938dd57eec22494dd8fdf2b"),
-uint256S("93915b73bde4b5fece5802427e2b8609de53e1528938dd57eec22494dd8fdf2b"),
-uint256S("f70551627671a19df2b3c0f2ee3cea32f7c51f18ed182cf9940717c50b9b21f5"),
-uint256S("2a239715223bbac03c11cb3f207f4d33e029521b648db5a6c8bf9fcd5529ad7c"),
-uint256S("88441c6e2343313cef48dbc80d7795cd4fcbb85b3ad76e41795d1ec5c221d033"),
-uint256S("88441c6e2343313cef48dbc80d7795cd4fcbb85b3ad76e41795d1ec5c221d033"),
-uint256S("9e3425f5973a7cb33b3506865031ae2b4e9e4d7e92fe16e76c3b3ef3e87fd2c9"),
-uint256S("9e3425f5973a7cb33b3506865031ae2b4e9e4d7e92fe16e76c3b3ef3e87fd2c9"),
-uint256S("fc4b293224aebbbae23f4f53de140ae63489fa625f7c5529b0556b910de0a082"),
-uint256S("c02475452dede1e89274e1b4d35608f6c8a138539e8c919ae60e88500787af85"),
-uint256S("c02475452dede1e89274e1b4d35608f6c8a138539e8c919ae60e88500787af85"),
-uint256S("d6631af71050e2bdafc41dbc3044ae68efc5fb615eb34465ed72a2f8f60b179d"),
-uint256S("d6631af71050e2bdafc41dbc3044ae68efc5fb615eb34465ed72a2f8f60b179d"),
-uint256S("b04a5b1ead9c3a8403f70b54e1811af427392810e24a097bc8654118b894add8"),
-uint256S("b04a5b1ead9c3a8403f70b54e1811af427392810e24a097bc8654118b894add8"),
-uint256S("31e15f4abb9dacc706e238234787a05cf2934d53f972969acf4bcbe5a66c6e54"),
-uint256S("31e15f4abb9dacc706e238234787a05cf2934d53f972969acf4bcbe5a66c6e54"),
-uint256S("77b6b6392b0eb5d54ae0db1fb7e478fb9acd5e852315a6935116469ae28d91ec"),
-uint256S("5158bd42c5e1f6e963a4459a3a2f5337b93ae5ec0169708ce5c4fe525ac2398e"),
-uint256S("5158bd42c5e1f6e963a4459a3a2f5337b93ae5ec0169708ce5c4fe525ac2398e"),
-uint256S("e8e607b54c98e21600974ee0b61db1777e84efb94f7731d149d2b134b833e1ab"),
-uint256S("e8e607b54c98e21600974ee0b61db1777e84efb94f7731d149d2b134b833e1ab"),
+// Txid hex strings, sorted for binary search.
+// Plain char arrays need no dynamic initialisation and sit in one contiguous block.
+static const char tx_to_allow[][65] = {
+"0010c0da2ef03f0d576a60a82be284fbcbe829ab951064304d517cf9a0bdefef",
+"00548601fde44901255fbab695bdc38c66f99296970a416ab719aae28ba797d9",
+"005749018b49ead72092011d19791cd1e060e87ca366c8df7100b18818e7de6b",
+"00640e1090a7ff67cae6040cdac4f1531f49c74271db873132b86154ebb5c733",
+"00f1d8d09ff14dd3d61b8293937311d776466ba683db86ca7e187636e9c5bd8e",
+"010e40b69bb394b8552146d0c89b989a410dfe5f80a7653e75087f53302f3980",
+"014097f4112b465a840971131c82ba78f818b3c689461fe41823fcd17a318e59",
+"01421356de6868fcf6b2f8adf2133f26d5c247f3afad86d55aa5f58fd79c0bd2",
+"0159425a6edc338949525309ce6f093f7ef91665759a1fb3ce77e5ac11f5ce6d",
+"01686e731bb4c747f6ee2ef3264637abe0849a7caf3f158c102777a23eb3b27a",
+"01ad0d6fa3c9f9e682dd9ec11656f2a0010cebdb21222c06343c0dc87bdec78f",
+"01ddc478f6f4f5bbb33f76e22f4dd27ff3dc0149ccaec7bf3eae9a851b718b13",
+"021fac166a06326b85eea299c154bc46443be1a49197663a63806743e0b35bc4",
+"02225a177693ac2ce9b76fc8f7e4868b9b1cdd3fb3df6b2fb409e2e97f97099a",
+"02262e463673da8e2ce48ff3be8d3dfa290ccffa89291137595529f6c810bf94",
+"0285de4f742ebf3a31fd2b9a767ce38ba3cfe1143f9cb4b7d48ad1292633dea1",
+"02d01e6e72392e444b8f30ab47948625526071cd7b7f91632fb5c2a9d9a64a14",
+"02d452e03869054fbb49986e5943b249255fd2f7c556b18dd8e7ff52e00eb4ac",
+"033b325ae49576ba4ad9458d1f4e2b5388086c5d4ee9c8a6be244baa6023b42d",
+"033bd28d813886fca800452fdc27d9cb42083324b0f273d346a8c69d96314e63",
+"038601ee137f4cf5b59ec85a00fd64d7bf2436f5dff4ae573461fa760cd18251",
+"0446085d679c82e42ae92b1f2a8cad65124f2ba99b7de7c271c9fff848845a32",
+"04474dd6072bd04aae93d1d4c7ca5fed2fcbd32b482edddc8f1f8b530d123471",
+"04827205d7fd81b51464ed0f350d7d50a3b853da7567bed5d47a9c5724f4e01d",
+"0489794a4220f125debc476392cdc695bd1cd024e6877a199a497de05f71aa5c",
+"04ec410ba5285c4a320adc4f12b28d6facf6c2747f6542ecf7e58c855433ab00",
+"050015eabf0af32a84f12e32c094eda25a81df122ca46ea38ce348f47a049ef7",
+"051f5d718b36458786fc0203f9faa1ed3d18ed7d7cd70bb088055208b42f2d0c",
+"052b6ad4c492a5f4b43bc297d47ccaf97003df2f62b8aa037f0246a4f1b0d693",
+"052d061a2a013c8abcefbe5944f880cb9daa61097dd337c5c09e3e7d466e4808",
+"055f0cbd5aa55b0701b4e97a89ee455622ed25cbf197f7a83c94fc06a6318a49",
+"0579c07265d0225d58d979c29a17c887d4c59ae46317531839eb2041fd1dd6b1",
+"05810f844a2acb1ad943eb804c91665316971bfdc0a37ae615389af553aca1f9",
+"05931dadc66f80468ad9dca785de6663e542ac5dc4193fedfc3ae476ef7c61a2",
+"06234a452f48d578a48f251d163ce68b46e8a74c93953ffcce0d9b713ecac07c",
+"064a7bdcc2e51c305288cc6de2374527e2cc44325ec7008aa7d28dd1c054eec2",
+"068ad16b7a61bee4978179b8a286e82cc8640546e693e5b8cbf3aa2213d7cb2c",
+"0694086febb0a77ed5596c294174d4962b53a83d5aa71396966fe8efaebcaa9d",
+"06bdc5b0928429e347ca124635306dd39eb56c313062fc5cd2b152c558a8849c",
+"06c8c5f98eb7e742317a0f851663a8b19ef58f1cc572f3960cc51e6584e23b84",
+"06ce0432f50c5a0e092170af29b16bafd6eeda0723a5e63095d2a0796fd8351c",
+"06d712a35e1794f14b579ba2942eb69638387f23dbd22da44e9a3e038a4b5713",
+"07255a2268d2f539c13791d033bb303ab9fcb3fd54810423c4d8c0569ae223aa",
+"07547f16cc5188e8ee82d7b99262c7321a2cbffda2328ec3087c5ad49dd729e6",
+"078837e9a3e7442a86c3b62802bebc70cc062e7a834514f598111a9a52836b73",
+"07ad6cf130f3febf0ae52fa088e03b727a6c8a06451fb6b7c4a7c3be614b2660",
+"07c8fec0b8e512ca5aba36ed853c13f03f53390a9e216515b3516eddbffadcb4",
+"07f83954f3e320c16853a0039e55ae0af6a566ca328c78c4e55b0466f6b1da3f",
+"082860a3830b5daeff9b59dfc28f330a4c0ea0476edafddd50e9f635ae085721",
+"0861d2c4466e40651429ede0139fb3b14d485836f18d3b274a3f4fc3a8de555d",
+"08705eb71cb40c0dd0ebe28095f286d09b4b5afcd5861824d64f70ef2ecb3c4f",
+"094796d072ca4fe512130a6a591ab0fee64ed6ae2e5eb17ef0142ffec9a1e32d",
+"094d748fefe97aca469f964ecf53419293cc5ee14ed938d1d2cc0e3f04ad5008",
+"099f3997853b0edc8723c677ba65d5dec6e5c1d1a5438b6ee0ba469508690f75",
+"09b702adfeb8167b902726e1f14c845a4f603b1dcd9f8897782b7c1ec2525b15",
+"09ba68bbe854369ded58efe5780065caeba1adf6bfb9a6c3dc8b0ecf321d3cc6",
+"09c0281e7be5c365c04f750b146beeb303ebb077b836ca4b7a5b1e4ed6664048",
+"0aa80a7c1edd9d5e6e27e56ad5b569f6a5922e113d172cf570daa93e044690a6",
+"0abd1f4bb947154f9c78bf39a3c151f1c793ece47e3869673c61d303c587292d",
+"0ac453d4dc7128751efcaf5fb607eb3a290fdbe5660322c1f4d0b1644721414b",
+"0b167d7c7e379ef518442a0e36d52950a6d1863ebffde276ff571e036ef4e72c",
+"0b387ad686c994d095547fe6e358e0fca74e27943d2d076cef76b4c2c95b20fb",
+"0b47736ecd789586346ead6c7e4dca53dd98c90998201eeda21e1e35b48dbb84",
+"0b5e7f4423c49c41d6a915074b373546b8d845582254735e29ba285beaa0a452",
+"0b7c4aa569972716738cd7537ce84886797a92965a122c155bc045cde2bcfecc",
+"0bb9c970a05f11021e1ad19574a12ab001ccb7d74acf5049fec12dca4d246ba3",
+"0bec48e5253cc5b621be227342b06538ee6965a1090665137f52068640b57154",
+"0bedc097989e43e848f709bc52a2641e3474aaa5013252886c983e5ab284577c",
+"0c3a3de336415e773d4a8d583e53d3eb07673472c80cc2d89d3f2446610818ae",
+"0c4d3f3505a44cd87bc1faeb22ed7c063ac634d7540873769aea0abbd18731ce",
+"0c7384b1de8a7c8ef513fdc8e94671eab49b51b949ce1f7ac2bb8f1d81782590",
+"0c963491f2b9748fa09a71826b351466eecce859c87781f853182804bd6dc61d",
+"0c9c128476e23abed2216cd1e082d65ad53fe7ebe9b6d2696e6c69eec7e94405",
+"0c9f1de3ec7748b58c3ed3dc268828435ca4fd1f98ae246116fe400d7980a876",
+"0cf663b3902a103caa0306b63c9e2dc73758fe665474384f2988f7a374a6186d",
+"0d02f6934ed6ea98062e5fd0f75af26a910e812ceae9d04d39d528ee6fc4a652",
+"0d62614235d64e2feadc36100c0c890b6ae6fefceaddeca619300fe59e6fdab4",
+"0d98ea7ffb778d61f0006cd96d339ea8d727c06d84a03d904c034393cf78d86e",
+"0dafe630c36af2d7d65b14a65d361c37217e5563b5f9281a034c5ccb15fec244",
+"0e360fc89fa828f8b373143624f7057cda16927b210f2bc3b74b78a9565b1b81",
+"0e9f709f3bebbc4a5df19773979780cc88369213e15c1996dd63b74177b98b0f",
+"0ea17be1996dfb69819d1c5b9dbd10420c5437a2d45e845cc725ded38a11c635",
+"0eacb2f9d9ba28b3893e6c93d9e333c85636f280de0fe29732b1f23111ce6e3d",
+"0ef8b90df2ee6161ed901a05819e63823d88a5b9f1ab92d7616cfe44b51f9b6a",
+"0f043e6cdf535938630ff042a1717138249c086ca35e7aa99ab7192fd6bc0caf",
+"0f19f77905bd8ba7f15f53552153e0f87a222921ecc0c027580c43ca1128ab33",
+"0f42ef8bda7253c417400418c1b4f7f65c29df5edc408f64364b2953634f1500",
+"0f505df7675a65575ff7f090795b24c26262389d2b02ab7845e742bfbcbe3121",
+"0f801554523971ac060885980444c1fdd984f1b443ad46c42fb84c7a4f1d7e70",
+"0f9a0c404c830657db083279e70fccd987e8762b980ba48f8f5b0f50314fe852",
+"0fcb825e8b44577eebcb7a2946a882290eca547e23df354b34aef6543e5e3939",
+"0fd8744f94ff0e768245031206f97655675647b409e9fd0d6fa35bb0c204a667",
+"0fe9889f8f61a7f85b1b9e69874268e0fa9619461793beeecbb0ed76c93e2c9b",
+"0ff7eff4a940d4ee50580cb739921ca85a90772f2c9e960f2a2b60cafb5d1d89",
+"106cbb393c9192380fbe4f5199c685b5de07abe8b4f6f764f84b0fa3887a0325",
+"106cd0812018671fc54a56f82366297b8b1a9f42b90622db9c937d48601ffd5c",
+"10747694c96f6cd469c22adbdd79a7bb484eb4321e3088b7ab83dd44261c0908",
+"1091c68fa325245513524332ed2707924ffad318b719fbe13965eba600cc53f6",
+"10a120a1810d2bf637d5338c9f53cc85f858f3262b5ae94d01667f5fe6a9319d",
+"10aa34d94f6c086e76cf5fa80ddbfc6cdf2ab5bec3bbb2672b0c8b02cbdec7d4",
+"11057e3ca4ffa4a82bf23763793d584b3717eb205ad154edabeadcd72f26d62c",
+"11214d88cfcc8cb105d432e9272c10d87c91c0369e9fb9346fe0bb13e0eb3fb7",
+"113d13b375295bb3a808d6e30b4ad9ab83d9a9f60872d7aed2d8da2ef382830a",
+"1180aee6ab8984e884b5e7a4936885fd3b9ecfa2f9e3b5253dffdba2db06519a",
+"119e6252559fc9e4f53a7ca60199622b24fcb3d4ccc1c641077b3286ca2cb34e",
+"11b10be7297450afbcc0a3a684184aeab9155c84574711dd8cee009b629bc28b",
+"11e9cf24559aad909ecb1273dba20a0fb5ae727d6d4870203d67bd8528c378e1",
+"11ea39f66741f2987016d6f30ae2342ef079e017b284f886c08a753d93dbf193",
+"11f52c5a708bb0f9a02ec62e5925496e2810b0b1969df606d8b0a4d0895f01b0",
+"11fb29f90dd6e5ecd2820bc4708a303c01ee3b53002008c6211a9f39785db645",
+"12382c1bd412dc0f299e156ae6d332eaca7966c5b4101e48a7405a01c377f754",
+"125f5cb9774551ac93a1a422b6e4703d039bfed23fd368c00d2f80d82bd935ed",
+"12f700d50d99dfd8b8a91ce3deea9d6b91bbafa2fa07756393ea1c067a7c62a1",
+"12feadb5bddf2c10c6bca3b6945963d084a9f31c84944abf5de9fe5cd7e315e6",
+"13211c275033673693332c0555f62ceea41c9767e17c9e2adfc8b3ea290c3e53",
+"13370a9808841ba6364b316eb8df0561d45a6e816c98f50dff828ee267148f8f",
+"1343f79dba645b405e9afeb287718f448812e99536137517a0f0e16ef3cc2896",
+"134639e187dc5c5574712543deebf2bf75e6c027ed089ea718864cb78107764e",
+"1351373c6834ccb48919bba3227040d2c6674090059a5c8539001c648c304fec",
+"137b16d766b9c669207836ed8e5df8f384f896764996dedae80cfa3e1f9ab88f",
+"13ce32d52877f1f42c79e4c13fb1b6abf32f21edb0e8f19207e857d6027c87d7",
+"143537b4f748b4c0d29f933fe9818663fc9d5066cf13512748b7eac5987ce150",
+"144c34f373c93cbddaf383f9254eea2dda482b15ab2b488cd9006c065ccbfcb7",
+"144e15334a02efdced6b20655694cf3183b621afb274a4bfaa433c6d3ba47140",
+"14c1b4488851750a18a130b3a7c38c09df87e90185eefe879c55257c74e90cf1",
+"14f0734342026e2da77c7e5f96bf7c1134eaf333c1aba977113707c14f9ec830",
+"1507a43f0632d00824fb4a6a6a63e4f7c51f8ea5552ac238a1c1ec734ad9dcd4",
+"1524409e76569cccf98cee79e37129325ef17c3167974069f84cbf29fb77efb2",
+"152c7d6846483b732a0a3f2c68fd9e3ec6306c57b490c01392bc178ed8acc3f8",
+"1584039d062ad3b154dc6951b7c8e834bc2a700565ed9ab0ab6b9a356e12a0cc",
+"158a70b993df65ac69b102fe41e2bf63a9aff79c57d6015a6395af23f744c559",
+"1598e0270b049e063f231af0eab1c0b6ac837157b7605432004f638582f4f958",
+"159bf34f26a1aeec2cfdbc7f329b079f061e3545e076b8b02a9f15e69e5a369e",
+"161f0cc4830ae86bc6f8a4534e10f1e3dad9442e082548d9f11af6ce4bdd2e88",
+"1621d2ac5d56b6060be722b81e9e2483b2e608c4a35cc07259b7b7d13c461bbf",
+"163a72eb0836b74765c9bd2dd023ef3e29e97ca7d1104d981522ea4bede45dc1",
+"167068109d8f6ae8a93a667b2cda6a3254da7af1521c0522877d0b5d2c8fcac0",
+"168897a46d91b522ab6722ba26e8ced9ce36576c5e2b7e03a076166e381be9d9",
+"16a599464981cb3ca7154af327810110f688df18ee3a547d4ad95c81727b46ae",
+"16d20d47ffb7d2f78119af7db897f25133e1ea4b93f71e83b2c3ad246c2b64c7",
+"16ef8aeefe9a5329119d46cd0f6003ccf326ce4fbbbe25d3a49f04420a02f8cb",
+"170a188722aae38fd9c989e0f53d6ab8ca999e3074f240ed326963cb480191fc",
+"1716fc72655b8e6f22d4ac577ef8dc54ea21275ebc704c7b8fbe18b369217ffc",
+"171c8705a487cd4d71f2c9f9843297adee4f1c24a8b3bd87b1b9174856d2951b",
+"172a0658381ff5cd61a5cb8e386f30c8d4b9d8271a1617fa454dd476995795db",
+"17341c64143609e6329dafd023b9ac77e219d3aee12cbed1661e55d6b49ab037",
+"173a2382416aa4892afaf8a684ddc474d32e003927baa8cbce515d3e53645df0",
+"17fb53063f204ed868a4eed342d10f6a4e13c6c099aecaf7041f1a911794e47f",
+"18565a967435451d5de0ffd1c200cecacdf031d9bc30c26ea144694cd75f8e1f",
+"186283d8a8a7fce70343572230dc4d3d3d6cbcad82213d379ac5ce8be5003b9d",
+"18a3d2fe253383ec0a675155835b206946a8cd4cf47ac726cb44d34d9759d3f3",
+"18c7df0c807cab9e5354bdd67d0fd9c63c5f9a8dfc7ae419c0479b5e41dbb260",
+"18d37633a8a68c0fa34653f527b4966c24a4b1be923cd7b61f6d50f7be2e8fca",
+"18e440e38401e03e50237e0dd28327fa3f415177c31634e9c6f4945deaa51788",
+"18e479190489d63d66a86edfa0d8efa7fca397f7ca5d3261c2816b2e57ca54e0",
+"190062c290cba24bdb4968efdcdb72ebcbacf0b8e241851742ee15c66a964815",
+"1918589fb3cda60117006128a5c4acb46cc271b1a538df32bd48a3e4a59a6894",
+"19c727e1195d61f246cbbd156cea3d2977388c6cad31388f3c51c4c728f7466d",
+"1a0ef11e078219cdb04c621d1171b2353017b85df0059356939f34ca85d842d7",
+"1a0febbf1a74d6252d892d233dd4a7c9d5526ab7870dbe44127274e2c4e31eb4",
+"1ae7c89105b6fa354820b356b5567f46ac14afbcfcc16ac6dc42ec404e7b23dd",
+"1b95f2c02bdbafc2ace2fa479139af8bb87f9e974103f33b2ecd081d073accbe",
+"1c9b5bbc87c9f723637b341c1264af341ad1785c4699f5e649ad72877e323112",
+"1d024245b732891964e6c70c8fc9574f4880d3a2ba7cb5b855b67689958a6575",
+"1d1373005da62a7f31c24f68aaf35b677014ab21633c7ba964c403cf7729f97e",
+"1d1fc685e9b9e5411c2826cf0c8fed71d43f4518cee8c4b10c8abf7bd30e104c",
+"1d58ae17c161f27a0452c53db94e4ba072d8842cb00d32b4ccf0406dab18a04e",
+"1d802d386350ca99fc3d5b2add69b648abe891394beb9ccdb533de4227ca9276",
+"1d9cf5592a23f3c5d60215e24171c9b5fe5d73f7c94396a078235c9010762707",
+"1dd4f3ac7056394a17d0f319321f72705dff7badd01755cb41025c8c3f624078",
+"1df0e2e0149ca304cab194a9f9f63326067784d0f05aa683d99b747257b1b2d4",
+"1e8c230267685f0719262e897809d982c0ce44e9474705baaf720eb591ed5304",
+"1ef753580ccf5d00cb9e35d8c6b333531ce33050ddcd568ef27cad26f8d4cb4a",
+"1fa92a284027b4b4c495c3d4fd3f41a14dc43d5b71a4b62fa38870f3b05a6f4f",
+"1fc7df27e0ed6b977af7417ecb4f39225e5e4b4ba9330767d4ff86eee23706f3",
+"1fe47e1ebdcee6b05a75d98b28c0f774baaa1d80657e3f1c3725f86a4e54f87c",
+"1fe5a0a9aa277d65a34a21247c16650df933fc5c8691894c85ea78c23d7d29bb",
+"201899fb666409c5106f90c036d8efaeb4c00c157a03af33b9a143980c526580",
+"20198f11b653d62ccfb0d6c41a0cc72da0efd10846d63a175804598147f8bd1d",
+"2047a6b9353585d2f983e29e8baf65e5de34bf82ca8125fbf2782ff1593d9579",
+"2074c3ab4048eedecc1e71393ce486cce44886fcc6d301974d780610a0e4d921",
+"20facd2817d00646f8928c57f8dda39b22eafd524d7ee90ce78c230557528f90",
+"2123dbbf919538e07f454578f582ea01e41451d766b807f6d420f767573c0634",
+"21b2c693ddfb5569cdcd9d469e6b448585edfbac485bb11ed78e3d16f24e2cc0",
+"21f94da4b0825c3243bc91204b8a6e37633345d01b4fa90c50269c456237e575",
+"220ced5665280c2d53e16c65ec2f9d54ef8caaea7de3724fcef91998ceabc784",
+"221824e848f4deeb22c05a99734e67cb0085da2ae6f5d3976497fde8de0f9299",
+"2224f94be30ff40cb5be5742e4a59703d690e050f61a6f2a4739fd03e7fcfc9c",
+"22f61c27e977d36d980979461291edcc41b3bf35326045f34b33fc4303cdbf00",
+"22fb5ded44e85b5ed1b70e8990b2c3bd56d388b3d983ae4e6e259d1f2f6d9d9f",
+"232cecfc246ca95ef82c61bf0cda578cfc25e770d034d684e7a8720872400533",
+"235bed1b441dd52550d59450d92401d9658f8931ac275f97b7852c205d8ec3d3",
+"237cccc6b57af48f3d165b542e3afb0f97bc7882772d296190e7c128dd813cbf",
+"23a4b77d70e633845bad137cc668a4ac75989ca7f574108d876e5001bd1849b1",
+"23bfd91c878523fd1b79181873e2b815ad479f5e79e42ce916eb9e887654e4e2",
+"23da191f7b489e788794b4f0b347ec7268d31fefa4795960ccb9d71455dfab81",
+"24441714a61f8f5f5be61ec02bc8f09d4845da3580eab62d0614c87598bbfe85",
+"24595d6f2e14288035a47616df89e82748b9f78b4dc042375585c33b43f1ed52",
+"24669f18c9a298f3535bd24add4237e4ff70e90c83fb2a90f8ee18e2171ee4a3",
+"24b759f7fcb69efb973bf5429cea54893d1b5b4adc6a3911c7d4dc14a49beaa3",
+"24bec88defc02b810757fe91a4cf2016eb93a9ccc6d7296dc253b69ba96cd134",
+"24c3df2e920833bd3a1abea490a9903560d44cf8b522f8d41568feaeec56a243",
+"251de1c5156ebb025a82fd572914833ec2c38287c2c671bd9e4c83ded8265487",
+"25365b9d1c9723eac42a47e0d567b22e82865f1a008aa8ae3669af90c72e8382",
+"258e4582d02cb36427c33ecbaf0de8339b16696de493f0a3076f5649160e576d",
+"25a30b5132f51cc5429862b95790466b1bcff7f67328a20ffdbcf3f0d1494c6a",
+"25fe9f46aa6d16d857dd1105702489b4b44985e83fdfb5c77e60c2c59f5b57d1",
+"26186e3deb30fa23a2de081498c76ba35a5cbc73936d037de4e937b87b6ebb20",
+"26889548d8e462a69b7c6dfe540b4972bb505ed448d6d5e5e57e064bef404236",
+"269a61d9c35febacf43645dd66f52eaff8dd1375f335ff8464aa60bf5e9f5fc8",
+"276d02054946b2e03e4e88883f85ea0f2c013bffe90a66743967319dd056426f",
+"27a20c9db91ab006f5d02a255be5af843aa8180eb0a17078089e0d30d8230afd",
+"27af278438b01fcb2ed8ebccfb235d88cf4490d936c152af8087edb932241888",
+"27c28dc446b876f06eaa1e2507bb960b9ce93d6c5e41a448be2ca858bd60c6c2",
+"27f3cc98061ef0cde0766a4d8ad3e10b962a8f387be2ed40537ac7a2d758aed4",
+"282087819e1970bd58813d38ef105f655bee376ab2e7a8b95ad30948ed3ae998",
+"2835e2b790dae5610c2960b3b80a9ac15d9bb783328fd1c1aca546488bdde7aa",
+"28d0d43e7a51f4c796d884169afe06fd6a6eef9c40de67bccbbc9352044757ee",
+"291cd882090eb2fe9c40e7640b3ef2ff3de484abb84f951949343703df3ce7ee",
+"293b29d10e3988abcbf9a10ee9d559a67b0da9b1f54e13c4f087ceb3341d62cb",
+"2949da48cc1a4929002b85b05643ededd34ad088bed898ce0e107337db47f73b",
+"299395de4dcdde4fba99a9f1ca32f4ce25701296d85909b7244b553465a79b0c",
+"29a065266c604786397a9c6dde9fdeb98f7d269cc1dd8328b770f8306831ef13",
+"29a450af799c8a8c3cfc633bfcc19a852c9cfa52781f9a24c45d3407b38e73b8",
+"29fbc161ea16c09cc33c123363445dc419c874e85c50b6c3257a93f4a2a41254",
+"2a1d2c778f582666512bc0f1ae76539c9859d6d18273ea1372c45bb92773773d",
+"2a207c489d4e6ffb142f3bca0f0db64ef4e8c21df9d8ff6db9073ea31f3b3ffb",
+"2a239715223bbac03c11cb3f207f4d33e029521b648db5a6c8bf9fcd5529ad7c",
+"2a4a46683bfcefdfd4eb9a79b40bdd5ded2f6499cd21f57611833daef0d3f249",
+"2a692aa697be8ac1db85edc06778bea0ec983b3b950e9b57069f100c7160dd4a",
+"2a8dc956a1657e771d5f87ccede4e5b74292c77dc83bb9aec0f8e835ae103406",
+"2a8f703505c91c3acdd00d701ba980d2d369e367b7301752375a26902f74c817",
+"2aa7ae6266df201c06bcd450d38c3e01903147c1527eb90f72213cf76dd6d7c0",
+"2ab6d96d8f79767aa823488531b36f160e982f81e539df368ae31ef6fd20c5a2",
+"2ac6060313e3f6191a9af3190de43073e6c7c875dba06a12dda4bef99d15ab4c",
+"2ad85c7292397d4015b7a95bd21be997667836172583d9d2f1a11fad3530db5e",
+"2af3ab9fde9f3aebb063a7124700a4ab1ae0c66c1eae9dcafd2ad6407ee6d974",
+"2af8c33242ee29ef689fc8e40d103e47f2dd2c787ebb484ef5d3ce4a80e4324b",
+"2b2dd87bfbcfcdbbc7793a17ec918378fcdc7a7c922a1cf666970a6060ee88c4",
+"2b3015fba0afd90bf642c824e711707399b24d125dbddab404cb7524dcd5ff19",
+"2b5a86f340c30bf7f5c415d2049f4766ad843a76d3059cc9fbd21f31a0e1770d",
+"2bf3ab4aeefde73d0219eca30c871a8bd009f34d466f107bb6d3b14e26dd6f7c",
+"2c25984d19dbb1d0eda019f794eeef5e0f95ad687bb903b351b9e3bf0fbfcff6",
+"2c345aa80f50239aefa45a0e5b4d865ed0d2c890c928fa402412d899a6347119",
+"2c78f730e39ce8e2c435dd260f3f1a2bae7e71171d5219911d2fa156abe93c02",
+"2cc34e495fe48f1af77c28902d76e6de2f53c7e3b984ff5f06063d0d46d9327e",
+"2d01be5cc271b50635293eabafd67235a21e6ab867c311a50db0ee2f6f0291c3",
+"2d1d15808dee97eedee2ed8495c1e67d9932f1fa5d8dc10d2b1f362d77bed04c",
+"2d485847fec2899448340a04018509a15962b8a9de4350071397604b0b8498f0",
+"2d58a5f9e6a9c4acb6bc3673937a5a7ee6331425a4cf8afcaf7b2e195ec5b297",
+"2d5d7302f73efc3e1e4d33d04db235dd159a47982c94eb5206b30d45da4bb1cd",
+"2d6b5a32a6e23eb9615cf856352f26aac55bc758a0318f3d8223a4f99aa8f3ab",
+"2e643b05d1d137800a960cf2375bc6d421c6db6b569275cc082aaf2dd784dd55",
+"2f045cb448caca0faf33e0e74634c762c074b8b4982c4a5d700fe75cbff1a357",
+"2f3ca9042969168e5f6144127bd3fedaf606f324dbc09c99f074fbc66992adfb",
+"2f5537d2deb2c77fcb9436704614cb66461a07b519ee57b81ed10fb3297f9a2f",
+"2f609a6b9e08d22a0edf4de908eb1f24534038f389effa49fe5caa6e6cdc03ce",
+"2f629ccf6cc6243b4dba1b432b89b7107dd4380747ffbceb13afb6ebd2b31d45",
+"2f6bc2eb0f52503af6efb22b21de43f2c3efceaa3a8e95628e921b6e0370abc5",
+"2f8a63fad7ccb3cc853df345fcac9b7246387c5e17d2caccfc727e4475ae8691",
+"2f907f0fabe880711ffdd533b48dbec69e48a3fdbdd46dd93a62c24a7130e676",
+"2f971ba4d34cb2aebfeeca3c5b9dbc170aecaabafc75cb2777e0055ce614b876",
+"2fb460fcf39484301fe3b8439a6d7c43659739afc1e3d4673336c07add2e7089",
+"2fb6918812fe5ee094c25c7a459d562ca094f74f6756f9748fff3aa37fc3fb9e",
+"301891c4ab82864e1c4cb58334326ff596d08303bfddbc5b4f7b26b1e6517f16",
+"3028f5049ab85177e0f9999c4d344a3e6904cadb67bd04c7329ed3dffce3ab47",
+"303e47742dceb32cdea5518a341d75e95e91272ef30f6c5d764452254b591cba",
+"309ec21c1af08b52dfc846ba3a601c67d877cef3731be0bb836c3b265ddaffa9",
+"30d37ae70b926aa9131226a722abb65903048b4eaecd1d618bdbabe7a05ac057",
+"30f7133b5ece0d5f7353383dd45af3bbb22828d12ca0269c5a0f54bbf74dcd00",
+"3119e487ae46e414eaffc9db4dae91ddb641caf519005aea583e72aaa9b5a9ac",
+"3133918639ab2e58a6e3e532a61b49cb7bd354f4ce3caac0fa33c3faa43aa333",
+"313f555ca77d9de322852f4fe11c3c40bf7b18c5334a72adca917518a43e4002",
+"314eb3bf84b8a9fc4ce3c5357fa9d0c4c31495e44004bc67f2547485f57b9c2d",
+"31e15f4abb9dacc706e238234787a05cf2934d53f972969acf4bcbe5a66c6e54",
+"31f2f19626b7c8c1fa40ede69dafa87943bb5cfeca840861b749f1956710b0e5",
+"3213cbb2fed34bf501c4df3a6fc7f3b8d24f0838dfb24cbc7d9e9c95fdb32710",
+"321f6c445b30c010dbc51ace9b4a8d6841604067959c4fc99cc50634fd76155c",
+"3238f2a7086966f19562fdd7df69c8f784da232d7ae120b844d687f814677727",
+"323b9feb2521f6679716631b063b9264eb344b9854ef9660db2e0ba41f86d2e1",
+"3281bcf9c9b919766f7dfbf3565273d4c5f66cd82af071eeb98d43587bff8818",
+"32939dccf550df27c7309c10c357fff9bbd266ec1e23043afd6e5fcc433f6192",
+"32a673eeacf6a233001cf1c2d9cf1b26457a61863c2b5d52df701fd4f80c1be5",
+"33142a9ca012d74472f97c911fc89d8b02aa83109b573afb4481597b52a62a7d",
+"33793ff34e232c088b2725480d5a0930f556ee1e45c7826a42653d83452f919f",
+"3398789a8c25a84f8dfa4f66750e36a2b360316b10b00b8de4247977656d725f",
+"33bc8cf6d4c3eff7962aec5452c769375dcf7f0e6b5f13a6e7f221b50d9fa4bb",
+"33c9dcabd230d1f344ea91895fc16f5a91329ee446d2f376ff0aaa0f387a2298",
+"33dc391a57e6ab71c4e715287269a3999d6d5f6519cbfd32b0c1f0ffe34942c2",
+"3459aabc89425dbca9a5c94a08c3cec7abb14dd5abe1730230c286652a7a01fc",
+"345dcb2ffea170377dffb69fcb1fc1b5610f445fee383f5cf034799ac3e072a6",
+"346aa5954949c5c4ea9d1ceb4bc16f4128072aef06540b05839e116fae773986",
+"349d509d5f998f74260da45248b1b5ebb3700c4bb8c49d4f740dc26f5ce9ec70",
+"34ba734aa028ee7acc9a5e789e1dae8253bed15da8dff48b0fa63c5c6d469e50",
+"35a4206a33e5fd7440c684a59e843d4130121b88c933d5ac103c40091e120753",
+"35b448e7311cbe9206ef62440887877345076b8cff5ccbe45dd98770bb9fda35",
+"35e51eb7d07d32d076d740947cdbe70861fedeb4f1d6f68a2258c6f4e4437cda",
+"365cb887058c941d684790432195b7e5cf2cd9f4c249b9c13a5a8652ee90c51d",
+"36ca9ae2c100f1a8f02de6ce4bf3fc68e860b092918a5097e57ebd6cd9e102cd",
+"36d083e29dd1104d8a1597d4c1233b6ae5b428cb4924f8677a170388f05e2bb6",
+"3763161de3f3c29e677ab9efe34dc0afa6edab68554a22c63b24c00c4cfc4285",
+"37822f54530879a43cccddf694a2ec8bf021af0d4d9876a071ad2d5d91e64faa",
+"3784a8888c9e26ef84747e421ff87c9a7364580715510d21711b1ab4cb09bef0",
+"379ef7e15779421e55396442e7bc2a63f22f01758591716ad52a55bd28f9f243",
+"38d7ee41bb00365df440d531011437802da05f89c706df6d1ae40a50e927008d",
+"393e46c73e898bd64de3725c8f7e9301be030594b2c8bf539cb466be71b94e84",
+"3970b61be0fe8f43859b5136c3713d878a077908437bdbbadd4dda913c6adec4",
+"397c55ba0f318089dc877c36eee8eec00276d64e672080d4e37cefb41421b3eb",
+"39ae82121e8587c04c5c6bb7b2481707b9669f4bddb3f9a606c03d660c371b51",
+"39c3a11afd385172be7fd6d57d0277bdca9f29c5ef9b75c0b93b5261df3b0bb4",
+"39cdd5283e348ebe5899f2bafa5dfe2e0529e9c9555b22f80c8a7ced7bd33e66",
+"3a8b8a90bcf6f7fbbf4072470996e25b6856404e44ad76f337083e7d7ff23362",
+"3a97f80b0aa43f0776d6b5e26b9be7631a7b610cf3adc9b363c057abcda3f319",
+"3aa469dda8bd4807173a3424219778d34c6ffcb509d4ce6ca0bf7cf6e7520ff8",
+"3ae16999627bdda06e00b7caabb5398f4cd2cce3cffe4b46702a32413dc29bfd",
+"3bce22d40db6e6f9f534b5b77c3a1be6ebcb256fa19241857b03b2e921787250",
+"3bdf292ef3dadb4446e414dd20d9272021f1e5e7ba709c59d8822bd493e58b53",
+"3bf41b1381bed3416a27b3b274dc57820cb8a509cd53e0d7b39a1b953d17233e",
+"3bfa054fd418ca6f4f10c1470e7e9e99009da2663bc93d6a2211452a467b19a8",
+"3c0635d5deda7fd11f616728ce1f1300ad2afbd5c571021c8d8fd74aea072f1b",
+"3c1f1e10e2206fcd6d47e1372f07edc5ec5112f50e639755ddee740e7be6e457",
+"3c28ba3d447edf1d981a4854a867c9e4342df450c7397ba9270957d21d0c22d1",
+"3c4ee58a40efa680199a196676a4dc25fa4e247c47e6a2db59d63baee82e8e37",
+"3c82fe4000d4a84a269f48ec236b1a03fe66e2b8edaea24f92f7d2a36f3a982b",
+"3c9eda8defced333c19b95ea4bb855242d1094a82a1f0fa336d4969b72448094",
+"3ca5bd2e34fbf732d290536486b3bcb84b15e63e788084cf550561d6b60bb8ff",
+"3d3f0be5b3213d6c0505c9c1b6421ea1b0410b833d4facb8347dd337070759ff",
+"3d621174054962ae818c62bd75d588720eeabe1933bea2fef5f8a4dee59ce517",
+"3dd4c639946660fd0ee83cf57b4ba3da3871a47d26edb0fab7d89d25f98d31ab",
+"3e3f6d0bc58d06431fc354cf8303f49a9bda96fdec5d1932dcb590aa9384aaeb",
+"3e467a9a24c2450e58062754afce6ca4d52db70bb370260a723099a316062c85",
+"3e79e7c1b96ec345d4aae27c11861ed8a98feb40eb286a446bb1c413ee9f5728",
+"3e9ebee5f9cc4202a91342bea1be6eb0d5ea2d68ad90f8cc050ca6496d277f37",
+"3ed1532c438fe5166f89160f036c7b88bb7999bc90da28d5212775bb3bcfb413",
+"3ef7d236fd3207102413cde57430d400f2488f2abbc5456092bf2dc3215e5a96",
+"3f91f06414431e388c6a38d72e30da8f8917365941c71bbf4c5d93651a9096a6",
+"3faed40d1748a84d8541e1824b5dcb5fa3876d3e9cacbf3bd1ef2128a0e25f80",
+"40342a8a63ef86fd2573c422d00564ea29aace4553784c54b1fd4e39ab4bdecb",
+"40a547078c6580fae99f74e8e370007115dddc1cab92a8c632cdbeb612b43678",
+"40a6b365714983733a5cf5cd2a1f51fa067c409d9d298f100501c54fa5889552",
+"40d4d2421dc2ad00a79366880e75d7c59f7326a2d57426e2e95bdbd9c67b9080",
+"4101797c673bfb172706fa4bf255c7a174b1dd2aa56e010d0c61b19b382786bf",
+"412cca8c5c52589517d76a38a4f62a1cee11a0ef11b20878bafd71afb94a0619",
+"413805bd5523d0e1526c23347a29dc32cd440be449d0f99991a558bca8812d1c",
+"4163d27d2fda71eb46fd1c05775cbab32f23119ed26f7e251de1893dd53b7c04",
+"419ccf18b97d8d0dd9cb030a0dfb5d3efea05c61018ab6db74354a3ccb979c84",
+"41a4c7918d181504375b96695db3bcb96a899c1aa0bc6d7cadf8daa0dccd5c53",
+"41de1d45c5ad82e9cbca93242013d1b2c453c514933ecbf7f1892b48ccc02d34",
+"41e33c7c4e313a70af86d796aee10e1e184ebcde51a40d42f6ace172f558d0a6",
+"4242c8405130ac18d4d2649cc0b10e5cbe7b9e8e6a50bff94ec75530704ade27",
+"42b50d6dba054bae814ab83d4498ad9eb8014af0036ed07b4f0f02b55524d54a",
+"42dba4b26c12a8772e7294630ba2e072a74fd70f1da4bdd76c567bf6972ebff5",
+"42e3d8f530d55a9b7e66e18b6a93446b414223a5485bf4cd1fa52424e81beff4",
+"42e6cb85edf0cd1115102c7cefbda29de1ec55e13b7c6c4bfe5282a622c2a2d4",
+"431d28cad8b7f6887e07d1cf96b8d04f10d099d4d187c1022a726762cba1c309",
+"4326a693c233504314f79685c7b10eb5d9c65bc7c77c80a5d94f7193ee19b397",
+"4366736a58f3a97dbe30a1e9312653d85fbbb98f702cb4393a155f6f37067e36",
+"43a6488840026ab376f97600e2adaba3b2924e03664b8cf9c4224e3588bd249a",
+"43d519a4ef68375f93b37cee15ada050ec710517efcfafe9cba85a173147de71",
+"43fec8825cdd3aab68e75bc20ee345a6f0ca63d6a13cf2764bd9be0c7b4304bb",
+"440bc522bcd90dd3631d6f07ac2eb3baa0eaa8215c5d1e1a18a22b9a740821a0",
+"444825d6e6a3b2b47cdb5de174f4a2196fa2daa8312ac65184fafeee4edfef44",
+"4513e3c16b0636058787320aa4d511cb8a840b40f117e23c34ea322227f6fb71",
+"4554e26d20bce1500e1c0ea5e7bbb3221c51967a4ff04e4a6af20abaa5b4a821",
+"455cd638fd76d531afbf80b54cf5ad5375a3b6259342e958ba9e4ffdc956899f",
+"455ddafb6d0973e6f24d6c9f19e5df9ab7e76ac6476f8048a4f127dff9dcc47b",
+"456a8d62b19ed6091823646d95ca4b3a272b8c38e52ee4cfcebbdcd161fde54f",
+"45711a1919b35a70b4ce61f599030565d49d7f8d4559bbeafd0191045b535c1f",
+"459dda630726d4a3f1aef43bbe33d1684408113b94760cde594d08dd069b7f85",
+"459e99998f11b763fbb15ca4ba6e10f409a15820d6db28b91d73f7040e623a40",
+"45ea0960dd62449381e20b4d319354f34702433f5fbf5012df6e7506dc9c43d1",
+"4619503be1597b9425b2837a91c85c94016de0fe46cbf699a696790d6bfb5af8",
+"461e19910e829d4127a8b2f83c0fe761b26dc4c032dfbe93100a4abda2d1cedd",
+"465cced976184ee3ce4a761ceee3ba4adce08028b96b540747271bc75d81acc4",
+"4663989721878dc339adc74ea3a42dbb0943f4b9f9397fb97494762d6f538cb1",
+"467d60399ae016126c6c764084f3483f716152cf0035338c4aab574ddf131a8a",
+"468508e689f27d3c3c35b9d4bc49d9e74dee8bb7c9c2d5c309488a9e07ec04d5",
+"468d67e1db6045b7c28040a205295119c16ad4f184ba4ebf12e23ee9bdb934ef",
+"46caac589596d6651b4b748547b73a5622812a8cde4bb95151fbc6f790856d9f",
+"47170866f84d2e7eebed561abf75a71b86925d112360692983ccfd19c756dd0e",
+"477faabc4b8682da0ff5f30cca93af5da700c97b99620018b1f0e29af579b51f",
+"48140d80191278f2aa742f2156f72d548ef41eaacff66d56766b2368b5df0930",
+"481dfb6a696f2080026b5218bfb0ccfc7a432705e2c960f65a37df3e01c11d6e",
+"487f907246c1792ae3fb88a120acafe6a1acd1bbc487d8d2794ef34dbe53068f",
+"48994e11ca0c31002958f1cd162cb9ce654183ba8d87c009393ca276a0ecf719",
+"48acbec5983050c750c2cb98e24f97ed94b3cd32ec6275bc3a91146689f68dfa",
+"48cea1eac52627d4f55de9dab8b36a2b482922c33424b32de1fae04d5d0c0ebd",
+"492ad8ffa122bf554926e50515eaf8f36dc21f6fceb250e1dc910559a9f365b8",
+"495c467cb84299d082bcfcd8d419bbe3cd964526f9061d9531fbcfb39818f75a",
+"4980967d1088ecced8cdb0f1be469e1fcff430b62e6de09675aa11d2b34f1e28",
+"499003665303ba9a17f2b54fa4f2c177898a5bb1224cabd5f51d546d84f1d75c",
+"49974fdb23bd225ac97f427c348972177ad6668cc5f2b801c5333a3dcb0a5f04",
+"49aca3a97b144b122a47f8b74cf7026bd63c555bdb49a3a6697eb44680dd8b45",
+"49c6fc1c6349381991c3aec926326578e22407d3d89e57a3315fc8ba32b1a20c",
+"49cf4e30a975cf080d49f00f9e9af8157779edf711a6f0d1eb32db8a2aa8bb6e",
+"4a0e90fa7d005cada42fa94ed61e08c46177f52ae0d63ddaf62e4b54942f1d7b",
+"4a2640052fb5aca44144bdfaa84646cb9599bef013cce644eb1c279088acbab8",
+"4a4ab8b34b98a3ccf8a2fcdb1ae3f7212f87f045c01f2b1d445d40db73e37fa3",
+"4a846f6c19441a3774bc9d6f49a729e0faf30ff8435c2db2f6e7d9b396b9a78c",
+"4b044c2e6841a3648d82d8c563b21d278bc6e10ffa06841ebb1c8628c340db6a",
+"4b05dccc682fbe5906da089a966fb922db0deb6ce84dcf6ff8cb3eb625682ef6",
+"4b37154651debce47171d7d9f1061cb4b327a9bf948a9b854c886c1dea6d8d06",
+"4b92cd02a5be1bd6cafe7e7140d8a2d1b10ff761ed0ca88ab9a9ba59acb5098d",
+"4c76b0aff5cf0cdc2d6129a71d9c53f25e14ca79ea1da558393480d01ef5015a",
+"4c9998a9b88d9e3ccea4166e9616c9cffb5594b4f2b078e445a826084797f7af",
+"4cc125e1689d901c4bca67bb73202f014e8bf2fc915d8b81cf0932dd319cacd6",
+"4cf874877904351f63f4e0d65f3f63ae33c946a23baba175193d6293be17477b",
+"4d06b8e7707677734ade11f847fd02486b8ed70a14572ca77148f8e67b26ace5",
+"4d0c2287439898e77f8a7058c6bbfb729a8e8f294965a5a8a6b87150928cd325",
+"4d177fc11e1bb5776ec9d7e51106ed77008e8e17eae9f8ec929c08ed363a098e",
+"4d3c727ad97dc47bb23cb346c77c6d171862e9649a9d681d4a14b860df03cca9",
+"4d5024c029f3960cc20e5f558fe136ef08c870f633147761d01ad6888aff89cd",
+"4d7b5c8fb1c98bb49ad3f395d18ab0f112fdd30f784e5ec86d8f2c2c683df8f6",
+"4db197d7e7f160e7c01a0117ab9d2c4f6a05c61e0db77f47406f15cd2b6504bc",
+"4dfd9c041afe9fc72e0f9324473741c83b431dd99cd554c9c627e04c4fe678ce",
+"4e0bb2857774b55fed8c75ef91cd56e9dbb0b13e7a25660739e420645f364cff",
+"4e1d6ead35a9d97d9f6cfb29c308b0c66f54998846f12a5ee4bdcf0ae8f65986",
+"4e5b8787b58a2c9e0a00a3ee0d4189f62a954512abcd125122802fe5b95f61a2",
+"4e81639f8f8d9ca869a97778b2ec40f680181441601dac13264781fa97144b91",
+"4e83251acdf73a340731893743de8c5d407d9e8a521e1327ca25483ea0d9b911",
+"4ea5738a973bb1086948d66e1978db0db539b2c27f5ec491736c8aac298c4a25",
+"4eb1f6ee003c81a5c42cd493b2ea08c0d098552a0ffafa31c4dbc3d0840bea99",
+"4ecaf12f598748cc0318603547fd8c01a727e573737a861199740708ce0c7548",
+"4ed0264773054356dc69a5d310c5cfce7bb794441ba9b7644f2af3801248fbb2",
+"4edfec66e84bccaf2d641e97c4412537a984b5ef8cff5e77eac655fe0cf61641",
+"4ee09e069b8d7f4c904e025571bf98bc402483a12a35dcd2e66d3a0ac0cd7200",
+"4f1558cb64fe6980e3b77a835d6a00d9ee827da010254c5f629486e76459fa08",
+"4f58bac5dcd63bd382b7fb8e5138d5a25b9013e1f7bfe51cce345d7976ed7eb8",
+"4f643981bb2c282fd43372aad1b4f6fbda6338a457ae4b6bff5525674a3db850",
+"4f74dc0cfd1d4d297a5c35039d2fe1f4d89ac0b44bce65e290a619ec38ded992",
+"4f92bfd2b74eada1eadece68e0d48fc69d611144dc378ca197f61a95d363eaff",
+"4f99d50ab03f129fb3b437f2d8814795dedd16d64a371bb1bc07b2ee3115d6a1",
+"4fddca6f73a6b798e6f5dd495e21e23d546840aa71cfe6d81a8c422c29e7290f",
+"4fe1c24155c8955db9dad88eb85a3c481bf1df8ea0f0d2c0d52ad13e359358c5",
+"5013414bf891bc3e093f2d1c2d8a7f084667b8647de584a4e8f6e4bce6b7a72b",
+"5078be21def1815c633d3419efc007a85820ab7c3029d10218cef4d931467e6f",
+"5104abade57e5ca90024eb80216f41fc81b55d22eb64fbf5a768bf973c476b33",
+"51063410dba9fcec8e1e9981aa5e852459430d26b8b5333891c4a0b372cb9257",
+"5120208fbf72dc60a3da57326b1f72ab4e02859e407751d93a08414b634a1faa",
+"512fa9e5fca7a20c2b483fe63432be5570d6847e850f8f6d131bdcfc93fe2626",
+"514ba2a189fd23dd132eaf32c7fa4f4b3b56f9b16f27eddf833b45762bbcf5f0",
+"5153d846cb16e69ded0662bd0eebf07e301291571f1ce023070e46ddace8c608",
+"5158bd42c5e1f6e963a4459a3a2f5337b93ae5ec0169708ce5c4fe525ac2398e",
+"515ee9a1cecc4b0ab73fbf42b5f5ebd109f237fa73b656b5b0e3879a28b9159a",
+"51838c3d52da894a32e2e261d81249796d18b0ecc889131211737485d174079e",
+"51a232b53db8d941f358095e63b2e2f76a687e2680befd03826224d6a2cf5edf",
+"51b1ff42d361c233710dbe4f048dcf51a51ed250a9355366cf869a8aef492c19",
+"51db01d7676dd893b4d8cfdc681328ccebfa0a8096f910989c24e63bbfa7a92c",
+"51f1410e24574b463e06c47a7dbff92e0f02b42f3d1e124611cc99c35e2d5310",
+"51f14b98ba569ecc003a847b09bfbd4ac927c7bb1776d150aca710af6cd2b850",
+"5238c4455a21303517a5806969123188f5c090a3f751c9d4c3d12f86900f4700",
+"523f96fc027ead28fee141ced10b89b5defb009e877b1ff801f967ae96a8fd35",
+"525fa312b3ab28d613d37171db8079492c878316f0b267290e883049d866d9d5",
+"528616ea0219ce24cdaccbbe812fc9d5f512148710eb888dfa1a4994e51d61dd",
+"52a7add129810b8aeb5b7bfadf4de225867f76cca9e6f52c44ec0d069e6cf34e",
+"52b66d02cab836d9d6df15390b7922d1163cbe35b04c233eda84d231d5a5ff47",
+"52cf5d62ed68a95dde8e3364028a357d3f348aa2e9cd3581c284c8413552bd9a",
+"52d828c3803800c6cb94f2e1f24b0ff5017b419702437a908dbca92f8dd6c932",
+"52db0d64d62f259ba8d7467ff0ef6acc8b3f23a7164c2e596396a57455c51e5c",
+"5318cb97719f78acc3a478f1c8cf2c27cd62f472a647c507e568b1776d866353",
+"53433cce92f7e6a6fce7b8936d87c82d38ab984928f233e439fc9970d1effbe8",
+"537b14476cfc71f20775db1e1ad7c5edc20c466cec52c66b16c7553ffcfdc1fa",
+"538cc5eda0d02d33cb9199e981cd2ec2668aacc4904ffe317e6463b93d82c435",
+"53a50dd5cc6d36097c1ea027bd71c2748adcb28d6a6a30f27161a3eb9f66bf87",
+"53b709c46af519ab4fd8f493ec42d86d835ca56722db16890d6e781e3dcdb714",
+"53d974ca2367cb159be713d994c015ff30d16af1a040e11569260a73b566b019",
+"53f3b8f80e0530558f4428e4386403290d0f04e137c404d60f68d06f77978e5d",
+"540a2db057350e0ab3d6b845776faef457ae6b856f29b980791524261d2cc3de",
+"541064023a30564b1290fcb4fcf8b22594d47006b8445b32f33bcc51b4c02ca6",
+"541ce3f8fcb6aea85afd419b0d75209ee972f4b542f813f891cc12e97b520ea6",
+"5427fc7e2d61f1befce50163ad021855caab8b3feff44815fb6652f9e7f0bb12",
+"543370a8b0ef521cf648d897cbf8b6f5c9bb7494bd0a3e77f608f6c05ab60f92",
+"544b6b1c6b59ededb7dce041fe89977966b813cf0d3a9d920313fc1673f77509",
+"548e0087bd1161ba05ada13165e5bdebf15639ff1688e40d74d2da97272986d5",
+"54a9384f6ee12a1638ee37d8542f730dad9563ec83165753d45a3285efe489d8",
+"550b508429406d11e9dadb370b05fb169c244b59908f4bc73df812f18997c0f8",
+"553c382649449c9fd1f8b6063ef215c02fc77bf8c717cb2e6b0873d118b728d0",
+"553e4dc979b923edc9512b3bac6e016797fe28c2ada4eef13c1a47696555842a",
+"557122487b6c600cc3bcba531e355abc26258cd770331b14cb6d348e5b0e3b8d",
+"558f81a36113029ab9aeeb36f585c64df667c4bde5752f01aeeb3c97b491b0ce",
+"55f3ca2a1c3c9c199e46ca64f3987d6bddebade4e10c037244c5d7b0520fa905",
+"56169a1786953e201dee780bc5675b2d1c042ac63070bebeeb1cb6f7e8caf446",
+"56bb8ac8f6108c7a9772c59635b84035692593fc01b905a35250f883e548eb35",
+"56c50dc3490b3cf861eb4e5dbf3656a1f0cc58da5585ab6af151bf6744c43169",
+"56f5aea15664725fb85344188452c3483668a885ec21a3be63db79c2c649241a",
+"5739f2ba1590c29443e29333c25d56a579990036af512f7360173be8d2715ae0",
+"574a5e22967d7f521839d1cda0fa0a2077c06d20e7271862088539e8f252ee6c",
+"575006d2ff6105efc2a9aebbab6562ad27b2c088b9ea358e4f618eda40700f08",
+"575ca33265e2daa57a316bab61860794a130a53ae9d2c258a9bdce1e1788d42a",
+"576bcbd02f7ac7477fde0700586f921d1fbc3ee606ffd40c4a87226e2a061bc5",
+"5788be7af963f909d91957244c3b734c1e47ccfbd48c43cc3209064f50266559",
+"57b9472b8d4e0086b0fd68d849bfe9523cc994fb584a77bec8d4a90a1e94cf0d",
+"57b96a6c41b09d963f529760f6186dd2de373c538947e1ddf5cbc809b57415a9",
+"57dd80921167cca4085b0b368e2efc47aa958064c7c22a8b2bbe8e82e24aae31",
+"580017b863c963e813cef0b8652555191b74543595f9329fe3e407599b88fe51",
+"583b95c2e0f6a23b689d7645f3962c16c8db29076ddcb3b70454ec2fc8284a59",
+"5869c7ec1cd0b726b29e192deb2b8b6fc9c8e3f59539e0f0916444db6332c2d6",
+"587ca049491476b6e039930d8097ecdf7b7a147cf74fc42a269fc53a79d46f49",
+"5889f31ec1600bac54b729bda415186f83af6a7f23b25521ffa69d01b08d7b05",
+"58a8736de3bfb35e59325648bb2b468a1afa4f47e25da3f6acc96bdf7d35fc4a",
+"58b9831ce4fd0a9852001c35286832dc3f40c3a300bdbfb678b1b7c1d3a5d933",
+"5915bf02a983e9dde57b80a15b5f39015c6049b664c72f27b41c3457f8b72a27",
+"595bb62ffda0ba12148e306aa6a41edb7c49fa9a1d60a65f3e30ad4b1959af99",
+"596ef5d47503ed01da4e1ac6ee89588b97b4451d1705da4443800ab5c467909b",
+"599a8723102fd239f3ff72a10d8f723dd32722488e4d763a4e954f6be827b144",
+"599b3d15488077d9946e802846e18ea4d27038d07dee1dbe10132ee95c4f2e66",
+"59b1624d5da4dd27d4ea98210b64c817d8a94f753170382d5bc55e853f215a8c",
+"59c22352d6ff23564a5a0bd47b35709270614e8d93b7557cf8e6260f81666e10",
+"59c5fb718f4818a7001dbe61af4f3ca73381328dfa13cb5fc33e8e19e7f7e118",
+"5a2ee5b4712d21c63e9dcfbfd58b0713026eb7e784b62c7a8e7b54700b121fed",
+"5a488ce835ff5c8956d3d2a119df4542cb78cf6d8a2b33079452e51e1949b8fc",
+"5a49bc13343b7783272dd688dfb406fd9401ae339ff9e207aec4e848456d2609",
+"5a822f6fb7203594545d0238326970f3a156fa6e36d25b3b88639d66cc55aa34",
+"5ab32cfd7e3de67946f53173681cb5e463c713243da8144eaebe0bf845a79d9c",
+"5ade39654e750e6dde7d9e2ed9ae8ffc561c47d7470a27cab6e274e89958931e",
+"5aec55643bd65888e005311f43e60feec103d904f578356c4f232f2a5411226a",
+"5b179e83b7d0f712a68c4cf0b86595a20aa9dbebaa24c98d499ad2ac29b7fd16",
+"5b3200a52515d01eefacfce5f83a1b773d25813dbe13de9c2110a06f41f2bc06",
+"5b87687c65c0c80aaecc81c4b783b5cc95605d0c1a018db87d2719319c63d7f8",
+"5be04d427c22abe95d68d690f57b0396e3f8f6e8c2fd8a40f89d6acef07145e5",
+"5c02f6bbe36d48c905320ae6419759a3408d911769b2862ffc34082e7530c521",
+"5c1cdd9af7bf2c6c561bda9a04b6638a78930331e9782a067017ea3f36a8872f",
+"5c2078aa2ee3a0d009fcc762d2e2cfeed4c938c0319a179c096839e8b517c94b",
+"5c2088a0163babdbce10938815e7746e30a01cbe635cb5de59c670e2d7f0ce88",
+"5c41de8782b511601d05c8b74d3730e89487981e383a33b21c946319385a5013",
+"5c43e48d54e6fc05775663dcba4e0177cfef5afd842282431bc4e3a09dd7b780",
+"5c7c335f81386a738d6d38e616fccbb66090aaaedf874dee7a3dbc0c1248089a",
+"5c8e1cf56cd3bfe762f09e411b039ee190b6869d84062c42ff0382d0c8fa6ad8",
+"5cba71402131d0afd5f860335558fd27d68ba0e545f01c027197516c41e59872",
+"5cc8d8711c3c967dde5247bb2f5b903812e99f09fc67672fc0d6665678aba854",
+"5d20973f8159fd890fc71b3de224f42d303934ceb59d838e01df9b99c72f0da0",
+"5d59e2494dc809c88200f226edd502843da724906735a9922be927ccb061fad8",
+"5d8ec12f688be77490717c740def5de284256a48ca8f34226e7621cbee272942",
+"5dc04fdcbc89dbcf7b9ad16fe345d6c355926523131bbec3a1744466e6fffadd",
+"5dd53112f1df6dc5b6b05d063da09da71c706c6b09b10d078193791c0fa0849c",
+"5e3459c8bb54415a2083bfe1a6ec81f1f85e411720bfc78c5b38021c86091d61",
+"5e5ea1f65b5c13dfda4daf66ca1f47eb151d53a2a85a8ad5f80595d1fbdbfdf2",
+"5e9246b5e3f95195a7cad70e208675e54711f9589fb882d951e561609727bf50",
+"5eacb18058d431a8bee0ddfbeab71b0b40bf9afafbcfe80a6aa65fd5db01fb93",
+"5ee96e33e6b7170c6d8a391005aa7a1e0219b930a1b91d58307385ec9cea5a33",
+"5f0a6ba65e9bb0195900830b2667e115ac1cf4b14bdc989c7d6e5dbd34e35bf8",
+"5f1471871565b086e6f43877541846e2c648d8550dd954e2a75d70561d740686",
+"5f5e00adc357c5cc1fb4a4893160305c7c1b59cc202faf5fdeca4e0612324c84",
+"5f81af77b868e586dd53f390645ab3966358588e2f03b236a5a6001eabeaac16",
+"5f865520e6f16648a53fcd79a9cfa2ee25dc173aeae5f066dd00bb4092f84324",
+"5f9026ee5be51f0cd62988e40ad2133edb6e1919d2e99c95b744346774a2a4cd",
+"5f9ec426af2d88940e238cc6b0b65f82f1f71baa3f4ffd2ca2a792d2c80bfb2e",
+"5fa07665329a8d2e5bbbb225dd6ac43d014cfe53a900c0a17d5d28f5d9bf33f0",
+"5fabd559c96cbfe06acda4ceca3040ee2224f62f813a26934ef51c885b01209d",
+"5fd3ada4947e48a8f49eab4319379b115a2ece07d15e3f18d7bc6a5b54fa893c",
+"601ce44e93e322f1f8edbe00d95a124f1ac157b3e2fbbfca839d0647188ff048",
+"6027d6f5848c6dbb6559efce783e5134d1904081986df53c2f8fb26c4f35f7b1",
+"60325b7869f88e6c141b0cbb20e4e44f3af43de6ded80ae950e83f3b425b8bff",
+"6078c59839f6e46e18c30f372cb90e9abda9998a0aa2f4a3980a0dd8814c69b9",
+"60af4d789a2bdb18771f7576c77be27753e30cef60c020d0e1425c2b3332faeb",
+"618af149f4fc0776cb129a70072414965d83bbec2545fd65cf7fd0589403844c",
+"61fa79253892718baf4f37050d3b2a198f20b6504db47669a83ec267a0d16af8",
+"620c2774854277721f41189244eb6d8884777cfc3db1ec8c9f8fda38128b14da",
+"62790ffd6700ce7a6a3e66fd99f1980f285fd9b001ca84c956bdf64cf06950ed",
+"62b2fbdf2f32f576e20c844ce3b686458f3ec4ae4b6922272c792cd9635363bc",
+"62da8c02007746671210157de7f7544b6c8ffc1f26f2c3d14f52c5a6199d877d",
+"62ef788cbd7fadb17f25c9ab2acf0a93403e84f232318c6a188bdd164c6736ba",
+"62f93d3e3087baba5d62cc4a593e3ec6164fbaef90200c2f0c454fb164ace61c",
+"6312d97f35525b89385b6bbf9187e7dbec34a0a35c8714c46a83ca2c456f6af4",
+"635ae6d40bfb654ff1f5dfd0038d93e49684bd06892090d518314e251a51dc51",
+"6360fa404fd69b0f24619be1e2675a2da11c91f0e14ba75744f3e17d25fdf382",
+"638bcc7580af55a7039b3a5a68ea5ae0fe8f8cbbe3aae445a30fe3ebcb1e9654",
+"63a8f4f301f6933eb753fa94dbc2046b3baab072dd87369df02625d935abf8c3",
+"63c9f3a6b326ab7479fa1f5bdbf6eeb7f8fd9f629bf8f74829aed109c7b452da",
+"63f578a4796d36a49b00da5970fa85c6b2dc260a9da766e34615e83d9ea79ac2",
+"63f6c16067b4e7ad5174d9233dc46ee1d59e10777e1c58d18d5bd47b5bdde929",
+"63fefbf04aed6bbbc43fd7e94787a6045dc47cb9fbb0f109c36c268469dabfc2",
+"6425be5944d9cd68f9a353b79431a346772046bff093bad4a18c72039936e27b",
+"64916689020df467fb7f5fec61a24f8d80ae6a0b444e8b517d2b51910afe2513",
+"64b41cbfe0db5366f00b73afe1b6c299a5c9af41d8adaefe297b3e431a794099",
+"64e24b40156b017f6e0f506a8896614a96156308c9088057038e5f05fc9e5700",
+"650275bccbdb414b88b539835b4d01212b244a1f2befb897f9273411e2f820d0",
+"651f2ec807bd870c4fe2e15d68e0dc779196cfde7d64411d6d900c6f9624c1df",
+"652a62a7b2ffb3746a6fca3aef4d9d42b8973304ebdb5540c6cb542e48610e32",
+"654393b48581c41b34fea804b860605ce6114fa32a25d29ad8ec0ba9e032b89c",
+"6561aea6f2f5142754ba96b8a9bebf3b494e85ea6b1d716bca3923c346142b3c",
+"65634d629778e8b8eda409f0227158d1c0daf26324ee0f8e47b4758b086f26b5",
+"65993c9c767f814993219345eab69b95ffc261f35ee9c5d18a9024cda9dc14ec",
+"65bb109f8095edd43f45915ed467ce135808da042c00f900669ccf1af22d3f01",
+"65d2b6986b23cf1d6db4ab3a16cf50748c3dac4be30fcea996357d0911a1a67c",
+"65d582c2e7bb6788a853eb5c7e873d30666a4ccde933df3c71fd618112a749ed",
+"65df45d773c213db8f5e1691c40371b644cb68d559262f18ca94b67fd9136e58",
+"660e5819cd485bb01536b28b3880d8c95c259a8a8e5687407bff561f654d9aad",
+"663f2ea179223720466e49c22b12ba9267e479260ade18300306e90a7ae15794",
+"66544da42480190da7f567dc540d1b0b1f60a4560498698c8e9e9096aa5b48ec",
+"666bae90ac46cfd4d29aa112c82c78a341fbfbaaa51319f5bd1defe91d941958",
+"66c45c853b528a3e6edfde08a3ba1435813bf2a817176c93bf7d8196dbc45913",
+"66caa09d4f423e915ebfde43cf3d7576787d305089b948b2d73464c3189577b4",
+"673285946afa895bbeabae68839ecf03f3cc10c1bb26bcbfb604c60dde212b0e",
+"67a514a0e53e6e034ceeca6519b17a30f46bc7c6e21f181b6c4a5243a2c21228",
+"67f912ff83baf22540896930a8a83ba625604096f21e03a1c641dd9f87a3f041",
+"680445388d7f618be7c47c80d23e50432bb24ee46916d4f26ee5aeadaef4dd0b",
+"68160633a4c24417b477e7dd896ff729c57c23ded37fe8659e463a16108a1d51",
+"68189f1851e66427426f920fc877a4285ba04ac92420fae143535bd5b53447c0",
+"68514f3992de250fc3c80b5a670f584ce90f0415ebec9ff55f3a37b836ae9246",
+"6880e580563a678c5559767ad5a3c3aeb4e93c887f72507cf9482906e6fab313",
+"68d64d6d36617a28115d9d09e51bbe9a1883b6a536705ff1ad2aca4750b5f05e",
+"691c75d0da6f1cb58e05ba8d92b4c02c0742fe5899dd5a050f4822bfe74866f5",
+"698dab219f6ed1c1d7bd018eb1741be6aa71fd55fe35c9dc1c6e4831102a5f81",
+"6a100940987e0f82dc697d52c5959c45a643ff70ad0c42dc4058ebbc8b6ff6d3",
+"6a78d325ff0318090af9c329c89de235df59d12a038a5173a7ff8383da5306fc",
+"6aa8e81a337a75d7e8c382487cdb9f9b1d94cd2166a6efd9b06710a784d238b3",
+"6acfc660f9765aa7696ddac7b3e5483ad60950055bc8ae9babfcc6316986a888",
+"6ad7cc88c83b0eb0d07206ac905ecbbd5f9fd9d0f7698bc75c786846e7edbfa9",
+"6af250b1e1b02a7080f26fc3251643e27ad11db42f3244171b275ba70c615da5",
+"6af400eec5589e9141be56dde2ed6c1827440c2c4778499838f0ae0aab70467a",
+"6b0cd3d95ff65bdda4a2ed6c5a787e6317e77d20ce5b1c47e392017c3f0e5c94",
+"6b2f1b4f95fe78ce711c5bce9d7c447c8d7dc8929ff2a00a283af1b379615afd",
+"6b3be0538d20a7f4cc320d84537913007ca734041e888c73e6a2cd72137f3501",
+"6bf83bd0623894a7adfd1d959f9b7367f5a268c52e5fc4b54fe0270735e0370a",
+"6c2635baafb3670f9af893d9e595b5f4754b3f0bed64722b29bebb35e8e5db2c",
+"6c4e512adb520351efded1e11afcf1f909053154904164bad5994f31398fb10c",
+"6d01c83bc6dca330c9df36dc23224f5c51fef807eaa1b2502f8d314d10502639",
+"6d0aa5ffc161ca38934a6bc01c5e7ea68426b13fb2494b828cae95d8ef43f9f7",
+"6d7f6a36e4d63eb28d853437335203e106a304803675884c907d7dc128d9d337",
+"6dcb7cd25f7c5943b2838c291ebc703e619c5a2755dfe1ebdee8341f00b5057b",
+"6dcee1733a05d532bfbcc34f02d6a0f444cd0dfd9b0267e9f6ccb5c74adbb27e",
+"6e7baa95cacb3655763b99f312e3d7705f67bb3747d03998f04a07b3e645fad1",
+"6e7d6d00110e040eed67757889f276d941297f141c71cd54cce5b55f8c337819",
+"6f2eeb8ea95fa28412c701c3cd2caf40b56c000914fd866dac00a552a01504e0",
+"6f4351ed586e3284d2c796681aa8140567c17996d59c0f2080f00a900d28fe47",
+"6fa9c9486be94cafd5d95f04b17c41dd3ddca9508065da8a340e32093f630ed8",
+"6fc35b062253efd935f227b7189f4b40d011de8ee5388caedfce5757b2be3192",
+"6fc51ad40c198847c9060f838d0c2f6703800c1c72405cf285ea70baf76ed6d7",
+"6fdafa0c45dc861362b84d15dec612458a7845f0c9323ac2f0d3c69c487847fb",
+"6fe7351c0ced88d0c4d06dfc5af1a2a8bcf11f444cc36b1c9aac0698966f6994",
+"700ca44131807119e7db7758f63e8ec03eaf08b2b49a752cc1095257bbf32e8e",
+"701ed0e8853ed8dad9b0d8a82285ee48068e9f3a834177db601bcc7a15107cdf",
+"70d0431fb892cb4848420a307afad7afa7408bfa9989bad9c5020d943564b065",
+"70e7a43ca58ae006d09a7eb73462e64fd8bd82067d886e5a8239bdc104ddda51",
+"70f512f3e32ca6d1d7c03cf417d03fb552a60ed51ef0611a58e21b243058513d",
+"70fa728ad7925bbefe7c0285b2da46adc972f54d0255078bc45894c348e2cd2e",
+"70fb3b512b166292c5ec2745f35c06e5db91d885b893dfa018fb53f588b45fe6",
+"71087f8d2183f90e9aaabb6a8f39d66393455e6d6c41bbe5c6c8074eb4ed138a",
+"7115fc84a0eeac279a36563c36642d2b504ae56aff3d7897e1a24e1a644f839e",
+"717a68633bb15c6baf9a6f21ad24afd795f72f7d91450b8f444ba9fadca76a41",
+"71d1a6ab16d8f79c2abbebdb733e01dd04a37e7137017bf4b5b640ab01e394bf",
+"71fec6e74ba48dbc13c4eca4f4d7ec02f0b8fb9c7db7fbf2000b68f2e2aad061",
+"720d82ed718c9c0f921c3e60317694fe90efc29df9de66393883c32606ffb34e",
+"722066089cdda252ce2fa437d20a2b836d571851e92f3744c86a28952ec3c412",
+"726396eeb75f3d7c32017f3c1f2e2119d7e667839f6d765ad4b66f9d2efa26c2",
+"726dea64d8c7bb3dc8790005423d8d2703c5d6f3144d7c09f3baae3ad0586173",
+"72938df2954b550e74d980b4265f3b0eee84c677f6fb7c9ee3896d66ea7c7247",
+"72fa3d557347ff082b854a2f43c471e83490fd391c0a2649841c555d9a50b894",
+"73078c571ab00a01b642f9894959d036836fd5c75bb5cf71a415542599ff56c0",
+"73145833e7190e4fe856c381aa3cbce8b51ed5b47867b05d0de396ed7bd30259",
+"73495741eaa9c151c101dbda113016d013a93a784a45b4ee7e8b9214c4324d6d",
+"736b6a36a5361df5521d733d1d2ff6afb6cb6ef8a3e5417b647ea70aff672c6d",
+"7394de43712120be3d6330af3b699a7c79540b122e7818b244d3cbdec2f1e947",
+"73c80fcdd9e0d60f807163ab8dd14e1fa748fb6788c04c0323b5b72272c9e28f",
+"73e72d07c1db561cd0dec04efc2e2a3ee40a61ab99b542907f32861eb0e22a07",
+"7449fc5727f43609c53c3b18472b705740db03c63af9db09034e2a3044d58b96",
+"7459cd4d8e128e0e088072028d1ef1bfc8e972fbfeccd5c3ccc4e1faf477e19c",
+"74698d7eee2bfb9e0813c9515985465a1e63765c6c371a0d69639a2c6281f79b",
+"74b4c63c2de738fd7d8bf514faa20fe6e9146f3581828c3d062331061addd9f5",
+"74f7ac4de1c33a237406ca33a4fe50a7e869c32bd65a312f1eb567a098769a75",
+"752863ca41e6258f639a1f7b994a2f6790d5297d559f7699414e81fb7bcddd34",
+"752c31d7224a060ae86f47e5c61f61ab3696f070c4ed02ea1765cc06e5cf2985",
+"757951976f577986f50a753d773936ac3076f77ed09dc30aa54a1b5dd97230e5",
+"75ae4489ce216cd9ed79bdd0a93e90ce467216e7e9b28d9e7f0865cea569373c",
+"75e2187b8416d79d5f4315d0edd5d5b439df56711237a6e6f2e43c8d09ac13e7",
+"761269bc4ecfa400eacb8f658078b76410e16c5337f059311185f3031eec1518",
+"762492fd05145c0f75f77f712c3f8be4227931d271afa0d8b70bbbc81533e74c",
+"763988a65729e33ce0ec0f246d390c305a2bb2c6a4f14218bb9980d7ad050eaf",
+"76c213aa50a39176d4c6c0624fef63d80b2a9ffaf545810ba43e45014bd881d4",
+"76cb23179f875b2c763d6527790c40058c0d29e734fd94ec656f3cc7dcd20ce8",
+"7708cc2557438fdc18f7c32521d6b5ca6f297056c46b5de3d19e2a0fc954c819",
+"770dffb427053934e0b913b04d40a610807af3a4662e902070910087b0219c79",
+"7713f4dc0bdfb5b58fa70743f1c79543458dcec822c63f913ac7e4e560461795",
+"773c4552c7f5333f2e29bab27f6c407ae6d0e289d5a76cb42472ac840e1b7bdd",
+"774e2743c8c181716f7ddad5aa42c3d40c5b388f93e7bcd49d2a773c8c7b96be",
+"775feebbaad6427ad44f4d2bb7e96aabc876da72e64fc41568e2f99d490f9248",
+"77709ebd97eb672e11971072438e736dc2f86a03aeb4ca637646fe1c6a658cfc",
+"7780d1f251d98d2d238429dd624b1ec828f27cddd285b828fc01eba2c4b471e1",
+"7790a739444eabc45138d38e5f37f8df56895779e17f84bfbccdd2dea1ca0e1a",
+"77b6b6392b0eb5d54ae0db1fb7e478fb9acd5e852315a6935116469ae28d91ec",
+"77f11f5be1e33b49bf0d3de7b7ab99ad4f2c2ad0a1b053cf14a7396c4325fb43",
+"7802d49842d155f52c374fc7d88eba6287d0e1de0cacbb5a47a67fe7316e7992",
+"7805f15d68d5103ba070dccdd54a627323be8b6a4d1653845342667182dd8603",
+"78222bba87d62cb1cacfc4f9e6d63aaafae902587ca68ea45b3a1ace4c2b85e7",
+"782bbde55ee4027967b26d3619e42ee8556c26e4fc2fb9ab348515d95c628514",
+"782f87ba008d7916fd530c0aec9bb78402096fd62fbe1927d291090cb44f2a10",
+"783615b6491c2288fb645b3f9518046688a584fc359a29bf8e201c8b89491af0",
+"789a6a23cadb99dbe3d252a8448742dfb7a47ba71f583a45f7633e981873fcc9",
+"78b3dbe309684691b279fff398b059669f4b47ea089e11cb05468924808529ec",
+"78d9ff2fd0301862e058af1ae955827d5863517d9dd74e059c043210f96d537f",
+"791d9ffe3d017c030033723d3df3715b4f15cd1e597a9b0fdfadba157691d1e9",
+"7983dc78a0492dea34bc90b1c119ffc0246e2292f0e45587eb6fd6d6b55ba715",
+"79a7a9f605035514eadfa27929661b581fd60be6a23167395c9788ad7125f1b1",
+"79e80e8d59616456c540f438ce4d5cdada0137b56858172f718c278270c50395",
+"79eb52b5d5287faadf11b72323c72112556520ce62bab00b274d0c69053d1c17",
+"7a114026fdfbbfdcd0c14014bb8d229bf654121786087a59ceb186f62a00ba7f",
+"7a3b89c1b9d3d00f0c5c0b0d6e66de009e53ab7a896d087ad36da71b63f764ac",
+"7a8159456d3a4afbc28e4ceeea4482c94e112f413ec7ed05f65fc89d999e3a20",
+"7a909566e1d047a8c405f04acc4566b1ca18294b03fc7326a3baf85ff6703f48",
+"7aa606209ff6509146292387992916c2c6ac8fe4a03a76db276b1fe1bdd7928b",
+"7b15370deb767367e21384e662340b321504a3cbb2549fba8f4dc0f2a7c1114a",
+"7b1d2a9a744ec082cf0a479282a76551103079d2f31b5b36e75bbc45dce7a998",
+"7b72cdfa40d94da668647d9933e73555a3daf3a24459bed37673a75c3b2b1224",
+"7b8319a3a81de3081c2210a44816533443e9ee02c5b69f2de358a1d51b126677",
+"7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ad",
+"7c08de878eca5e09b23aa784c8a478770dd55c266c86cd106e7efc7c39be4f39",
+"7c235cff1907b3234a7a8ee6ecb38402b75e6b7567f547640c2908e859c4537b",
+"7c411388b16cf0466f49b84eb7c178fa399501e6fe609cca91039d77b4524325",
+"7c59b554e1ef5f501dada7dbf464a784e73cce9e8189c0040ae7eebff10e57a4",
+"7c85b11ef4cd1b2b75f1ae3ff351e6781c900a70dce3d49c99464aabe78e24f1",
+"7cd46ad72e122907fc2cca219d04b14d97f4885e6772818e81e9c17b7e98e21b",
+"7cd47677879e46a7b237de3b27a4c367d181ae3e1d8991a8575be14667e37ba2",
+"7cfe886a17d2a7f152f56f316d190e1c7cca1f45797e5f6f3fc644b01ba7527b",
+"7d42c7888709549d796f2059c61b2b8badc178d4b15ec47450c5ae22d7ad2ffc",
+"7dc4f05873d9ef65ac664ad7144b3de96b442ec9f53ffe57826af9736c10e180",
+"7df477b6aa751f3b284b43f6136b1db3b092a833f1ff4d4889368296e2e0ead7",
+"7e19b0e08f8481faaa07e95caa0318d3d7619130487197269f3cc14477b25116",
+"7e2c147d83033d4db6d9c3aab43395cc59dc33e7f83f9495342d5fd07dcbedab",
+"7e9b2ba252adaf9a8da9b1fc90954047745490327ad7d83c5f03ae1579196d8b",
+"7e9d78267fe6fd4735129ddb67d2a307c41d3335babb8d2fbbdcb2c98018d60e",
+"7efc99a0a464a28be35fa64e6cbbb80957d144e66a6bb020968bdf1fd02dc388",
+"7f6d1bbf0061d2161812fd46e442b111d9dcb3f34ab4273e7c1332a6da62fb3e",
+"7f9db14add4b874946b695a514c1acb794f214b5036f99dba80b6fdeed97d771",
+"7fbfdf576e1e3ca22b029502fb7208bec64a7d7f99d3c0c972f1be40abc162b0",
+"7fdc5ce9328467814f77432b2123a1e79632400c43a7139253bdc8f587d447f9",
+"7ff952d702e026e759a38c2ecac7a66d41d2c57763437764334701d0054b223b",
+"800939dc644b12c88da2806fe629a193eb0ebf5d368b72840a11f4dba5586b5b",
+"800a1c2a5988246a568efe3a256a434b3f9a1f9115a8a39d754ca79ae4622061",
+"804717c61d3daa6fb370e583707acf3e3640d259919ede4dde002f3cbe3bce8f",
+"80a4f83a03611111778b4c8648c5553347788814aecaf4adb7874ac93e9f256d",
+"80d4d725992f7a42980f39bdc8b7c7685bc0e8305dcbd0ea57cec1915cc8e356",
+"80f353a5e986ca96780da0b7b74688d815d3c55707853775d9142ffaf8528873",
+"8258069aaa9067bb59e59285f53a6d59ecbc92b7dea040a0c1d633cf82cf5a71",
+"82608916a58f5cf528651fdf59c4b81cf95579fe0083a04cd98e262a926eca35",
+"827b7813fb8db21d441926087471b139d1d8a819004826ae1d2cedb40243d4e9",
+"82892dbd256ef6444ab1d6b972463a8d7ac43f4ae46f1f8e962bc52d8f8540d7",
+"8326ba7e223929e3494ba36d0b45f79d2a056ec8ffcb3b18235aa269b6937cbe",
+"832f368c07ef04a794e43c168da95623ed7620f496c987d11a03b1916d93668f",
+"83335a87e1904862c427f13dfa21a4ca4818306c30d5c1b960744006291fc1a4",
+"833841e5e53428d23da400ed66855c242a80c139fa81a84986bbcb10f4d90eee",
+"8349d852751cf80d817605bdd027ef46f2bac875e126043170c9235aaf4db977",
+"836bcffd52f83496598896ab5639eb67fff12fda848f05186ae1c59f1cc9c7e3",
+"83ead775a6da66109b9878f32ac0b45f1170ed03e91ce046a923d4b712470144",
+"83f4b2dea9de7252c8911171db77d7c26f449e9693f5ed9ab0937ccb318e383f",
+"8468a7d2d04c11a56d611b2750e50acae45feb989a244cefd7c5b2a0d9ee1073",
+"847f2cd4b2ced6c2d46eb72eaf020fce12dd39834d1e81b5f4b41114adeadcc7",
+"84889638a936ab9e15e940b1282e60d33e52ff56a124bef9c223fc34338d8a98",
+"84df2c01ef75112d64939beb746ddcbcdebbf3443c24cb15c04be2ad5c2321df",
+"84e96a3c5cc2a005c6b42e3236bf19cace7e8535359dbe1f8dd0c74a15440a25",
+"8539d1fad9d43f56fbe2d9953b86c84d34fcb4ec75545336187d63971a100b93",
+"854ba5de535d9fac7b8a13c581ebd6013d19901d9cdfc135b029e429e3add35d",
+"859bf02bc0fddbb45922e0c0f8f84de3059c588d0822d9b96d2117f187e3be9a",
+"860cd14a1c6ef0e9f642547d345946358bc0830b59f8b0dfbf08850c9d50ba1b",
+"8618159d30b4269691ec322d61ab1dd46376ed048ad2296677e892a4a0e6a1f6",
+"867fd61e7399b2098c2ae89e2b980721855c28ed616d776eff35da49b1f46939",
+"868615cf717b98704794df4ec23cc9d507a0a849085ef78e61d992eb53b009e7",
+"868db22ba9d38c292397c85ec3f28fde1d7bf70119227974a0fa886f75fb3834",
+"870065868bc9baf0204a1f54c4b2b3c086982271822abef9c637d79f0cc780e3",
+"870f0c700f3b5f892084000be67c31177e5f113e94d36fcb22227ca527175d76",
+"8736b3c75434fed5426e44f18ab9cbe1080c033d9010ed0538a6a33106cbf928",
+"87c92d64be29749e40904dfd1c24cd15156414790bb05f17f9fcb58780d6fb80",
+"87cc238ce509b4c48d5bf460d1c7bfe85d3b516f2cc4dd91ca8f9faa24f0eab0",
+"87f602044349061e69ba1d4b114d4c72508253239da7318ae98cb1ab8860415f",
+"87fa6dbffcfa55bcd610228a9d010b78dd02da4487d34b3cc370c09b518a50e8",
+"883cb0c4412c4d83d3d0349b41e37e589e818656f6cfadb12b885b5499dbe5b6",
+"88441c6e2343313cef48dbc80d7795cd4fcbb85b3ad76e41795d1ec5c221d033",
+"88470bb2fc07bb116cac1d06b5fae7d2cbaa9d300eea75a94d3e1e7d6f5f0193",
+"8876e1173aee8ae0f0dbd5d672e6ca566fdd52673a97310bb02b70e5c4d46d23",
+"88920814e48038e53fb5ffb2f90c15522ca885f51acfd5b8f318743597b52e1b",
+"88bcff969bd48c3d68a9e2fb8ef61d200eb21a3d06aeabde7949ea0aca057a70",
+"88c17252229d72d2487e8c5664e290b827b85fd0500b41b5a058946c0594b5f8",
+"88f20be64a3e0e99e97b0ff710aa21bc41caed617e0e2acda2c0fe513d0548ad",
+"893b194caef6f40efd8b2e6fd47bbd9a3b29667c55fd8b9ae71dba10f57d7372",
+"894144e40c363b495c6c6e698299f37afd079602e2d1a683a59e08a46cd832e1",
+"894ab031c07d72f0424e0121f4fa954c33a97f27339e719a215b488a44f902f0",
+"8966b27ef6055ffe00184140cb9a1129f056d995901ad685f556ac95d908cbdb",
+"898f81ff69a7f9d0cefabeaaed80e187830d1373a50698cd5d6d4051b49a6d68",
+"89d1bef313780a53921ef58ac4ea7f75e41b7d9d0b3c527a130ec1be63b799c8",
+"89d73a8c009a1f8f08f6f54c621737fae1b38ae741e8a651b4ebd689db3a15be",
+"8a4313200ea5479968e893a23ed004ced97a2f027c1a14ce7602f9e75a3211f1",
+"8a6cfc37c968c6e64af6c3e65abe904ddd2300389fd2d9ff04f326e95640f2fe",
+"8a6e138ec34cef03436421271485f1ffa50f2316272a013bf5b6f8a8cec19832",
+"8a7071083614d3b67bb3cf9b6d531fd3ecbd8aabb4a5fe85e0bbfb61c4ac4a62",
+"8a7a6126890070600469422c435068904ce914dbaff478c5981bf8943cc5d9a2",
+"8aca271fd2b75dabd9e1bf7ce74a0ea25b4abed9f039a1353d986ad5ad4b470c",
+"8ae777c4634414269d9ded0def4bcc171902bfb24ec80baf7f6fb7ae8ecccb0a",
+"8afa62ce39e13dc55560863f18b78ca39410af1f3678f2065086b2fccc3f32da",
+"8b3239dd0e0ac12abee0f0ba900be01331d51fe4a6e8b1fbc8cd609916be6993",
+"8b4d8babfbcf7382e4c5e9fdc5822eba0059308765fb1a7441a8079fc476fd4b",
+"8b59c0f4fbf2f3141abd484e2a81d9b207a5440ec38d20c6ef8477be6808af42",
+"8b89e0fc7d7dffcd931d264503561ad54cbce0afb404693fce96baa90e9c6778",
+"8b963ca2391862527ddf320e4bb7e4279ad731133f583e771299851bbf5124cf",
+"8bdaf2af51d7e51898c1a93a69ba206acc26634389f9798e7d5f9989184bedb0",
+"8be307f916a838004d86ff7a56698e524d774f7bc128c97e7dbb20b6fc1e0ef6",
+"8bfca3081e04058cea6495fa2b47f07d5b658b993e1fbc5d4a5e10fab00858a8",
+"8c1dae80a980b58a6936f2ef7dbe6898e061bc7220605996990ef3a596482ad3",
+"8c799fa978cdb5639a1af8c49d21223e682d24be58f92e7f0f2ebde7058b27d8",
+"8ca2f69712de0caf04a93ac190304e5ddcfc763fbdb70bfa35abf22c9cff7001",
+"8cc0312e75c547ace14a5b57f868744728e1e80ee828e2b829b1a787f4bcc5c5",
+"8cfec8de48bfd88b11f8935b282848b526be04a21373e94b0f40faaa64eaacda",
+"8d057ddb0c2d28128053c4d31a32376c2cd3e57157bfde62549e042abdd0b1f8",
+"8d737074952f056aaf5754e723e8a402c952ca2f55cc3914e98c16c9ec6ba7c5",
+"8dc7ba494d4f101194971f8f9a879cb273c752334ff668f03142c02658d5a1a0",
+"8e1b24f5b370ec8457d7935fb4c690966166cb00bdd489d2ab4abd36aeda2adf",
+"8e31bf75f8cb8255abfe9dc5cca04024f117f98eb4922a02248eae80ca06f93d",
+"8e37dc36d9d37fba4653016168cde41bd3397542c0b11f93a3fbc71cd0e04ad8",
+"8e500c220c93274e9e8d6ed9f379ca2ae2c0ba96f04aaf3dcbfcb21e1dcd0f89",
+"8e5ef0a143f500ba0d2249d6f7913a40e4741d35f5c60806a2d9a4eeecbff0b7",
+"8ec96de4b8d3b8a245bba91e7971eada32ec8fe0a86a0917efa61dbe26e19c96",
+"8edec2f372270ffdadb985276fb547b4c78a2b872356df647dddcb457d6e2d25",
+"8ee266fc21b7a9408da75539266860da362ee38049994ab69871c417c07aaaf0",
+"8ef464c0065df3df1f1c9388fdab4d73be35708d6f54b19523b911ac85bc025b",
+"8fcaab44d5aec8170a555f40c4c20d70524cea5c6c04f4ce25051a088a6f2c33",
+"8fe6926b7c6be8fb218c7d6dba47d109dc329cc95e10b5294cbe80c49932a965",
+"9026bc7dbd785a8539683193fb7c191dd23d826534a99cbb4f2ed087d131639e",
+"90753b25e6aa566cb92f079d4f7943548105e6f6a457ee6a360605acf485bbf5",
+"90951c4e0620a7c0a91c379ea9dcbab62e4f5face8e65fd21fc759f4ae3181eb",
+"90b83a2efb342111018f2d95cbd961f814747a2deae55cfc1ab665d30fde6de4",
+"90c6b985825d653ab0b35887650f39ea5ed6efa6006c89f9345ba540e1b73760",
+"918daf944ec0ad804e167c304061adc71a8b4817d17ea3043d42856c6e48685d",
+"91dac240294d98c96212d29b0c147ccd64b6c07fbe4f742ae036c185f7017300",
+"92161104c4d59bdded6a53e255db3366d2b8a769a383b83e8b5da1c7d45b9aea",
+"923025c56ba79c7a5a86de3db54c945b26c3ae7d48c53d694583c1eef05937c2",
+"923f8c0b1dc6e9e02094dae9555152c66876861c3edce7ad5e690b2b2d3bf2fe",
+"92952091af7196d48b0c0e595d94d6af21fe93bb6f8eeae94132661fa9a08870",
+"92a2425e9944472a765f8065a427e17fa25028d65dfa77159a8f8ea798825842",
+"92a60a6f9f95e0e5318cd8f8c7184b6fa29f43bee68f5a66bfa3b0cf780cdef9",
+"92cf05815f23ec1681bd718dd486a7ae38ee24d79c3bb37e91f4581abcf060fb",
+"92e469ea57c2cb63cd99800339476f4dcfd11338668b458feb3968c384a79cb7",
+"9323674c5c7e3f1fc2957d14742ae6438c0dbc018a8668449d56a7bc6b300850",
+"93915b73bde4b5fece5802427e2b8609de53e1528938dd57eec22494dd8fdf2b",
+"93944c54122f5c0536313ba4ced22f8d4d818e6966e3b7b0c36823b14d9bce7f",
+"93ddb72140e1f83d960d995ebcdf1f93aff6365dabd3bdb358c1a27e60817475",
+"93ee3d3db017ef076df33bf33e03056f6fc3e4d289e1d88b6bea3cc1a233ebc4",
+"9430d59026007eb878f713bc1e30d6da2e51be3e088952735b26685b4db3f176",
+"945894b4772ac1b9e10d87bb5bc88a8689387707090fcf9c2f5c2b9706e3c667",
+"9467e4b6f33f12ab46dd85c680b936e79d23bfbdfb28a3a8368fcfc69cdd2854",
+"9474c3a8772f5bff15247c36222ab7e015ad20bec691fe3dfbeace801d899dee",
+"947558fcf4553192be6e8c27c4645a8356435e4abaae5c4c89884896ed865d00",
+"94920420cb451b348ae5a0688eaf4f20017a74fbf533bddc6c11d1b9aa604dca",
+"94f74b89e21f073b53234b506c20265282bdb89f70413607cbe2b61c74b338bc",
+"94fd14a7036eb70300bf0741e587de898a931e9deb0a9989c1a06de7f5dae8d7",
+"94fda0289b525c489eb8a55f11318a8aaade9f77bdd1fd6733c15745c6252d61",
+"954e5b410ad75fadc7345eec2527937ec7200c2f0c3bc52d9c91f23416c3b332",
+"9586ea3200cc2b93c982777cb67f898cb83ddbc7c06fd262ef96f14f92689c58",
+"9597131e6109e6f768c3569cd9d2fc7442430e4ee23ddf2b37adb78a15cc9818",
+"95f336a9e0c79c7fa8d74bd0a2ab57ce491cb545365eaaf41625fe3f42647540",
+"960c7982568543e9e53ca95a4c628cbaa7bbb8577f5322615c6941af8062adf8",
+"963f433e6b7951db55713c725167dbd4216c5c6d01370b99754ceae9f4e18642",
+"965681e7f07358f2d196161e6860cbd829ee5966d34f3bbb46e9277d560fb989",
+"96818f30d9b235e68b28c316cf7029dbf20c2e0d16f2debe110caebb4a225034",
+"96a5ae6015d167778c4c68b181c0f8c6884c8fe75100650c7de53f2266ccad2a",
+"96d528016fc5950086f4765bda9409cd26b7df81a17fef5dba77fa336e3de9f7",
+"972002ea7797057c5831ed7a2cb82aae213bcc5641339c58e8556ff928414a82",
+"972432d2c5f9d14c7303c06b287ac2a4fa3b6209cf49313fb68310a0e717cbbd",
+"974a818b0e8f191fe0c1da314e53b6f4c8402bdc6a08d92ad3424a5363008741",
+"9768edc125382b60ef22b5653f2fabc411a4c6fa754233a800639ebb45d99413",
+"977603fcbc0b9a6fddeca93745fcba4966d3579a61e17d740702a118e8c0b070",
+"97bdd087b96931caa4ea41f61d290963c804e1d8430debdac12429c679cf9f81",
+"97cb48f06c95c09926584ee5ffdc56d45f3de99a7570f04646a98c00e3b8c487",
+"97ec7e1fcb376cb896343cccdb6ea97513c1393106fbb364e99f21d46c74d4e0",
+"981e8950a7ad5a643f0758056804b40b68882cef1ec57929aee23a52a7941597",
+"9838fb1fecb428eafb603868da1b0f1f508bcf5bfe27e2a0d39745537a6fa4f9",
+"983aca3bf70db67754233c526940cf73c8e1ce34e0b529565a2f70c45cbdcb3f",
+"9841f5b9abf575aec566f2e130bbf9a2277caedce9a414659df9dddd534f9914",
+"9850924d93eec8e7b3b7b955569330dd8a8b5f7572b255a4dec9076c0a47bc06",
+"985989ca380c0564b0f689534ef7ee2b2248e01cadf692bf8e579f9aed257ba9",
+"985f2d8cc545072610639cbcc37775d8174826ada2bd3e7ad44dc55c590745a1",
+"986411302eadab035718d661aa6c735948bce8d68f4f0783eaf6825b4d9f46c9",
+"9931e0254af3db5754d1e08d6fcf4c3820d0947ec3672ffa830b093978c2db1e",
+"994dabc41002868c99dcaa9d7de86ba0e18296d6785e22b8bdd08076eedfc17e",
+"997dd19ba7ba8a00a9eeaee531514f45f6e27c07cf466253e8f87ec0bbe0696a",
+"997f53d08f3a78c3a3a5add5fbe199b27d6a888491bdd2e3a6c3fc297b220a4f",
+"9981b57c9dd647389deac43036c6896767ad71db1112c7301921a59ced26a23e",
+"99ba6fd5e4324acecf937c310ea21b063671782b1903c1b5a716ff5b8a9446a7",
+"99db87854457af324e0211dfe6f97ba87604bcda35a6fa10c0287405abab5765",
+"99ef50a1f58e37e867934e1e4fcb2368b94db126229281df3da17d9ed93a65d0",
+"9a41e8a91368140b28eb6773518a7310e98887314f62dc733f7c1a82f0a6cb1e",
+"9a4a8e482047e02144d712468fa05f77ff5d2b55024c9cdddf2e2a6520d0c2ac",
+"9a57c245609b30c3d7287a865725ca5df7bfff259d3ee73e03bbc44c5ead64b6",
+"9a588a4e81ce8d43c96d1073c3457d4415e914c86a3ff90fcb612ab106bac23f",
+"9a5d4049bf5949175f9bc167c0a4985aca1069fcb9ae59940e78035724707fc1",
+"9a67364ac11ecdc5811348e89a21e119b6050eddcdc16a029a4361894e95df78",
+"9a995199d0baad4b45bf5c923b31cb96e32515a68a6cde373246e4e7c52cdb60",
+"9ac8e8218f2dbbbd1748443002cf9ad3c481c1f36ffd2427e3763be168a32799",
+"9b938c78fb3bdd9e7a34053d016cde9b7823e0ccc38c6791a3b01d15a1f370d2",
+"9baa16010f16bc7b764709f3eaf92a5bb14d76eac02c037741fd77b6dcdcd29d",
+"9bea4fe25d3b52d19803ca35473adae1b6408ffdc9190285280ee41dcd896615",
+"9c90ae48f4d5cce2c2d8a64a533fa3c59f3cec96f0feb0145e224a430d7eff5c",
+"9ca64483536db9da5a14162c8aac253dd33f7f018a486275c6f906456fd82878",
+"9cb72f1dc8676d0df54a67bb2dd746cfbe2a4ba809a8f4d99449011d76c6ed39",
+"9cf81d92220b94bf77429575a6a8f7b8cf085994b97be3778e2a8db94c063c3d",
+"9d1f4a378f3798cc8a69fb2241e71b04ed2776ca6434ae824045f7c377011a43",
+"9d4f22ad80c8604f25a613045e51bfc44c505df99cd3d5a6d33e25413b26aa95",
+"9d88f67809688dafb0362304fc26b2689dcc57babaabb7c203f74cc815fc5fa5",
+"9da4f52a65a206c83ee89ba3f00cbfe3cb1cd2f9ddae893d0b4511749fc14edb",
+"9da885ddf823559b0db93d592615454b7b5bce79b843dade389a86ef6ed8f93c",
+"9e1e75477fdfd3c307fd09611f1b8a490fc6f4379a5ef71c6dbe70404b4130fc",
+"9e32dbbb26f1631f1f6ab2018ff015d1e9bed8519118b662bfbbfed5a68155ed",
+"9e3425f5973a7cb33b3506865031ae2b4e9e4d7e92fe16e76c3b3ef3e87fd2c9",
+"9e63d51bb5e02a834f000a61841175094849f0e69297a27c3ae0583e59ee4141",
+"9e7391b08efdab44040c3b6eddf6c15bf780b648c7adbd27f8e9ed0b96c13514",
+"9e7b193868686f5a690025114b818fbf3a1d46676402666660801fc87314cbad",
+"9e97b6e9a7e011b1b6bf78cfdd3302834a1bf96ecbc38d706c2d74f99070fae0",
+"9ecbc8b1954282733d84c3e8c56d3f26117718a60712f56c27d15716cca252a5",
+"9f0adc1282a4b164553ae8f10ddefc3d303fbcb3538d24355d2cb510aba99c30",
+"9f15413e8ab5759cb285356edd9f5f22b0b971ac5d8c21ee8d1586da0e43ddf7",
+"9f44a70bd1a52be7170f84f7cb89f4528196204bcb5024f5e550874b593f5905",
+"9f46dec3e34449bd0e8692cf8b22aa55d223f7dc0ca2f39da7aeda0b6eff5428",
+"9f784e62dd6042a5b185bfd4b0c5639334d9240d749747c7e956f68708a7c79a",
+"9f863a3287a43ce6ad4bc49caae788e2061df6ffd6c7077ae98c4e5e143237ab",
+"9fa87fbb043ecb0fda6e2eb29a09acd6f59d23aa71a3ca75cfefef2a74680a12",
+"a002ee120b0c252f1bb0e33ef4a1fd661c297dd17b0c4e6c7fb9997cd58e2395",
+"a0037761808460617d8f793c1cc349d48df6e8d7ae325b5c92c578b99191eec8",
+"a07c4e0faf155399c76c1fb6c200e3688748f59b771d9d41fee6f94a0f37febf",
+"a0d4990925a1e0a51f7a20ab7fdb7905341a71fe98a58f3313c955cda2c87ba9",
+"a0d9db7865bc160175c27b35a04dfa41324e1c7462b171d5c3afb56f989770f3",
+"a0e72c7c790a193074b797d5a84db291dc5922ad72ad0aaa06d3e03ee28be0ee",
+"a0e8eefe7fb029563aacb2720bfa36bdc0cda6006110a9cd4bd6230ed19e3bdd",
+"a10d921b75fd3082ac887dd1fa5c98bb47b5f027a44c1635bad12889845c487f",
+"a1342900481a8eabfdf48dc51ab483f5b8709f0ebed0a495b9a4c18c303dd259",
+"a1b326f90456a57bcc8d5a6665f408b31966020d07d5dc362221744489c5d81d",
+"a1c8b2d9fd079e1711590675e96815132ce5a622a0a9b07db48ad5cd9ed69dea",
+"a1df9c2322cbc95e5b65a3a267b4c3eda7feb7d0a09fa8b64c1dc974c238ff0d",
+"a268819b63cfa1c0d4a283462521f73003227bf35ab155e03a87af4b507a14a1",
+"a27e44662c450c884d137adb4f47c04127eec2596e89c46ea32732928986bbae",
+"a2aa2442a287642c7890446a95d51d6fda39511bf0bbecf52c40c61c00d1296d",
+"a2af0fddd50e13a3c7ed0797ecee9513d3cb410798a430a7ebad6cb5b8d71d4c",
+"a2b41d19043865c1ca2cca2ad25927494920ef57e46caad8e64cdc122820a686",
+"a2c01880bb11231026916569ab42e0eb9d41890be718306d5d69eaac4d2f2e19",
+"a2c5dbf01eb0ebedbe8e6a82fe0cfde71c48449b04ee71eb4247bd24b8767467",
+"a2c66b99927f838659b34671f6038c5b3dc2bad0c3d2c5d8752d856f483709dd",
+"a2e78a487631faab40bc238b9af0b5c11b9239580c57b7910dd1303470e87385",
+"a2fdf4a3cc2b22e3fcfd689409ccf50bba1de4b7710f7c4c84484dd6ae5c497b",
+"a318dfb474422bf32788017d42844ead467c15985569eef7a10e2cb73356e395",
+"a39c48de6cb7779ef92aec3af8883cfa81d6eae519f105f38e6c0fbb73824df2",
+"a3a46c69835b5fd06171f6a2cfc83c6f4d2f5b5f39489448d53c8c0d5e95c669",
+"a44c1e6c9a3c04a3dbf168bd70b703d62c1ccd33a77065503c3ecba7b7b85f19",
+"a48e0e4486abf7146953121fe061042adfdbb19052a3c44351bcd2abab5b65f6",
+"a546dab08d7b705bf0fb93fff30b06bdca870092ae547b929553338ce9e70d37",
+"a57e862fb42d1f00165437a503bdc3cc34e2fbe9262114ba5d56a79cda30f638",
+"a5d62cd073cf491c4f3634b9eaef7fe116494c86216f693173b1e2aa4894f252",
+"a6be80e34c86c5dc0ea53b9321512020fc38232cdb4fb7edfccfe94c1a4c8b73",
+"a6d6d58fa0f10222a46c46c17f42d4b67eb7bcc124a77850be496c2423a1d2e5",
+"a6e022c0dc7a240b0237c10530e915a1bd1986fb541eb2a68369f287aee0a2c0",
+"a71e96024e61964056cfa7378e22f80ed66b68221982d1214914baeceb1b41e2",
+"a72ea73e55dcb6b5db4ae186ea6f1ca9bb144835ad424ec42267add919172f25",
+"a75f7bae1926cc6ad2377cb67196fad79da1b43d4149abed4aca601e95ef9227",
+"a786015e6ed5ba0d81a1b276d014a7557b8f02b6ab473f57d238ae68272fbb99",
+"a7861692be8e0bc46784cd5430a485d669bc6da8dfae7dc6e472a1f082a21e2a",
+"a79614d2138c64508cfaa80759f8036e01e5cb47a2d02c47503a3193a99a261d",
+"a79e92fa7e0fd60f2daf1de5f5ac9191533079d44aa676b4010ab64aa5ae0abd",
+"a7a4a5a688e77ade386bc1d6bc81a64d720f503bf92ced020bcaa4122eb4c157",
+"a7b16eb7763ba092874c8b8d12a7dd1d9c99b006077ded7ba15b488c647627a4",
+"a7bd65385cb425461f3e92ea698a982cfc752bff03281ac5a46b2c26df4b86c8",
+"a82a30a08f143e2ad948fde7bf1e6637ea5fd20036d4b57d8a50ee7b6e1873f6",
+"a8537fabee9f869fcf8df4cd725110fc77fabede71702c3aeab3788b9f862158",
+"a8b50db59c7c970a57328a5b84285e92cabbf76b96670fd4c262e38be3d272e7",
+"a8c8e1cb7f574d1c6157c1c82dd300914e9e36acc655876273e1c9df5b2a405c",
+"a8ef8a9a5903e6791bec55022809c968810d81ea243baee538ff9b090ddf27a5",
+"a97b7411f8bfa18a080d0156b6c45e175c7f86c66739f28c1168b669a9a9eb30",
+"a99487098122cd814af0c5c5f2e9012eb70828fddbdb4f86917f04a697b0d888",
+"a9b8d7fbc112848dfb04dea8aeaad6019e24ffd86355274d8117c11110e8d5ba",
+"a9bc81dec122ecb9de649ffd057eb949aef9f98fa3c5609565474d22d85c1184",
+"a9ec28f3b83254c012b447bf4bd81040e5821f6f7ed02f59eb0097f2a8e636d5",
+"aab1d0e40935c901c20d3441c7265083425f4d2f0ad5d7874c0f4d06e07d38d7",
+"aab26cc88ea2900120968a8aa7443ee82f46d6031ad0651066c4cbf7e378cf31",
+"aae1d3d9742efb19430e7270f3e39adc361de288f9ef010826cdea74e7884f9d",
+"aae3256b9027b0d33420f400d218f6c09797346ac853af28a2a4239438c8395f",
+"ab0640f11791b746b37779501a5d53fc3ef1bdc506d6e1cf118d894f5d93670c",
+"ab36c982efcb8829be9a9aca69149ef611fad0416d777041892a031dd895680c",
+"ab60234eac7dc552b853c883d09eca591807a11280ed9f2b267400ed64c76d09",
+"ab63f62721aaef0977817f0d3b9d4c668d9cc730bc9fd80f22533de2a7308820",
+"ab64afaeb39c361bcfa07b002353825bd2aa0bb5794ffb364f7c53ca49bc465b",
+"ab6aa089344d4035d5eb2cb46b3154314df15741fda322499bed062b04217ad2",
+"ab6f74d7bed4bd481420541f7144828f9a573852449dabc023ce4c782878b1b8",
+"abb6052674cfa72ba3ad05bfa9977ad06a581489d18a587ea047a0cfc1b678fb",
+"abba5d391df7e1f9250f6f7af5b009a6acd37a028a0184fc9b836fdd8f543eca",
+"abbf36b64fa4e92e460ec9307e8dd708ed3cc6d22a36749f565baaac222245c5",
+"ac4f31071d499c8f91be89ae55a46261043315689bb5b8ce89e24313e59c8d8a",
+"ac8406e43e32a1bb95f9875a59a5fa114ac2787bbf05ea6597cf60694e2e9863",
+"acc8e56e65dd56f7f07b9c134c28a2ce095379c6ad1c99b6f632d61d82a362a3",
+"aceba79a7d5b868aff0e981fdb72cfcebc9fdf4e935171bb336901079e563c08",
+"ad0dcac6db656d7d875b0ec71d1205dfbce81270bfa01483328d372bdff64c2a",
+"ad217cc4bccd3c738bc382a12a9b93de26130d475212ea6ae722ea2ec9af2ee9",
+"ad2f12936300dc0d10db4f56c00d6fef18c3b4c69082172d8d7ab2b2e8207f02",
+"ad387c540e1ccfe31b7f46beab75970527da8995843ee58340b51ad7ff4fc5f8",
+"ad3ca2892060743131421fb87ec3c0c5c19ea0993cca002c41eefe0e9388bba4",
+"ad7e2b40a9eab0302070b99f6ea40c121d1aea5da3dbec4236e9f9f08b002609",
+"ad7ecf8fbee135a8ae8c5ed18d5a107fa769fd61a75f6b3b3e34a8aefe9537b5",
+"ada8599525c94aa0c96a1bdb2a5890b75a6dcd7aa638a63bf82820a34f475d7c",
+"adbe4ba8f9d3262f8b633486bbf8f10ad9ddc58386b978c5bca3d9b49d9fc81f",
+"adc6c2927f1f28f29d53b08c46c419ac8b71f5ce11a282d7c12113d47f027650",
+"ae055fdf8a06a6f58c40f0e202fb0ac590b4ae3997ef327e8f4ce4fa33aeb87f",
+"ae2b8aa35e8094d6346d2ebca7a480a40297d86e97017c08895e7d7c71a8fdf5",
+"ae2d264eecdfe61233d84ea194fc8d8857803f54d31c110a8e19a9e5c9ed6ee5",
+"ae8157073ceb87e1ee776677f49b108afad914fbbd431ccfddaa026b88f67986",
+"ae9041df1c77e476bdd5416f6c32a186c268c5437fec1203eda0cf4a0de0bdf0",
+"aea0261d3f68cf0b2f0cad9cc71c427ca7814274d602c9676c397e4d6be3de13",
+"aeb726404152cb54a5ec565605243d962cc74e2fc7c4300ac3b7a2070daf4e02",
+"aef40fe614f4f251a3f908675de85715e6ec0954c7f604485bd0389715081735",
+"aef4cea6053f392f4f1503d1febe5d7de5993a1ea0ac12f0f65f06ed47223a1a",
+"af18893a1a9240a1f1c4c0aca5ec89951f8b65825e8d2b566024a40df8ea28b2",
+"af1fc79f3f889d1bfb4fc33bf38ae53f44b68d2748733e2a1e668991063e9ccc",
+"afc8780fb693b811bf4def3af0068643cefee9a0426d043c4847c072fe8237cc",
+"afcd4675ea4fbc586dc8b5eb347f4f52cfa29d5c4a9139154f319711b3cfb740",
+"b010df1d0ec472dedfccd4e55eeddf8ae7db2b63530b8860e98bc5e7a5f27afb",
+"b021bdfec68aed97288108afbff80d532287bb8b5494ca7ad0adbe3fdc2d4107",
+"b021c58339c27998edc6a62ba476c19d1ee4d9e93991161e77bea91a78180dde",
+"b04a5b1ead9c3a8403f70b54e1811af427392810e24a097bc8654118b894add8",
+"b0505e792ffa4a61a653e8f2fc46965160b063132d6329cf454a724ed89a04ef",
+"b0582da89f0501e12fb2a33358e91d808b8dc4245ab75f6b562bff0449fb812a",
+"b06a9e1f02f54f1badf1f2ed580f44a49bc75001326ae2e052d58effc5690607",
+"b0caadc8d70bfdbc50d86d5c8909f8f788c8d2bb8fcc95ab425d0cd520f6a30e",
+"b0dc167c5dd640bc11d80240194a08b564d846fb4de6b6a8a56dcbc91dc93f54",
+"b11a4e007560b8f81b1d924b590c3c2952a9adf2c2f41f4ed93df4ae67f5e8a8",
+"b127c3ede6e23656b6ed7e9c11f6d670ed5b3b6905be8f667d23c3bfc202af31",
+"b12c2b0c03dc491d3ca8d4e4a76ec6455fa7d29904d25cf035da33bc3d823447",
+"b1305235b89d41c123c247b90354c5dd04b0b25dde66d030a5a33fb69c5e71a8",
+"b15362fa5a2be9f4e4b6bf25916a67b3794939e3945f19a0379210139cfe97cd",
+"b1947040320a394dde92f2834881ccc1f03cc80911cb6a5efc0d170a1395bea9",
+"b19d41b2876b1b84fe8d2d7c07b8af3d5184b73a2a5b0800f44d12727ea2e1ad",
+"b1a6024c016549dbe652dd0688a5afacfe3141104b08f458856f266ed4fb5d78",
+"b1b08b47cfb48b41a5468d165f3bd9786b9c9411257be9b2dd3307b0e8cccec7",
+"b1b1109d1f273d341a2d8779752492e907435035b80c47fd7f6fd1e6e003d524",
+"b1f32df205ed10a70cea9ea710b5a0a8dbb26dcf853f826f2a8c955e49a87c7b",
+"b20780731457c01345b201f2b800493a0783b816dbffd141a6fa628e40adc783",
+"b2a36947b28d00ab6cfd48e521a28b9be514b54b8318de4f757661dc8394c753",
+"b2b6d8b575c6476874e56b415a41c00a0bf7140abc083cded1267520a30b92ec",
+"b2e76b114c737178d87265dea7d877374bbd51ded63bb6777c9d8f97a8a62e79",
+"b324355a3636e3856354f97c5be781d00c3826284f72afd7cf04b7f370102109",
+"b33ae1a8485697da7e54b24534786ffcf0909fcd6ecb0446926c338e39543874",
+"b366e491d185e966654c6177f1a15d33c4e9b918d520ff964ca8a1e20d7364b0",
+"b3bfe06acdfeed6195d634e5c919ddbda471c23cf3e86f76ecbb050e502b209a",
+"b40ddc38f1ea16ded61aa940c12625e05cff36b6f2bbb986feb0951bdf4a43eb",
+"b434c48f255df85d31b17e90e65dfb25c4b5bacbb19d775138143498939709d0",
+"b43869db43029f2e958f05b54639fae8aa195fb69acea86b8d016d5f757205ce",
+"b4797c4e9bb26448c47d02d51c3adfe38f3346a9c252335240aa7ec5da5e9445",
+"b479d44ea0799a801c8c4916fa9f5e1b640e31b2f4ed6ed18cec7ef2edad1096",
+"b47a8567d1dc496314c56b80c9331dc6e8f28247c846a11b0c1f4b5a26c487df",
+"b48784b5970d3e335c09cb1eba026b894df76084a518b93a6c3ba6bde13a5e21",
+"b4de131f0835847f6c0944195ee391ac3e529e1189849b60128068df35540bd5",
+"b4f98b3af9856b3f2a32b5c6877c5d5e55c43fb8300699ac0adcee7bcf33a473",
+"b4fe1e1287d0242ecd3bda6ebaad951515fc8517de370f69f9ab80935e391db3",
+"b506598f4eeac177b5b5e7a7ec367c56d0de98c1c1414c679d42467bf1aaea1d",
+"b552bdfbb79852657752014d192f93456fa022cdc2fcdda10dae74be484cad8c",
+"b56cd77ba15ec85f04497ab1419171c0b9f246ca333da2150b7c53f9e3c9b210",
+"b580057169beac68fce1eea9633120ef293c51ddfb33ccd45fd0f0a350b5a097",
+"b5b7ffb7591a418f23bb6e86c2177ec46cdbb156bc165294309cba9f0bd1d6ab",
+"b5de82340dad7c55cf92a13246ba97d61fccf6cf40fd63012019d225fd74d9eb",
+"b5f17df753d3c28592d92b152bddb4077c3a759479a4b5ce60d5228c34fac199",
+"b6411c78662368f9e8b155e301f7e538262e199d2144e5173da27ce0a0f5b4ad",
+"b660a516628a04656b996d074d8d634a3730ed997cc2f3db8bbc0995a01332e2",
+"b673940453616f3593696e7d399fb7da4a2e7002eaa29d85f48681732376f0a5",
+"b6c710e0ad8aec4c9431912db99b32eec4fbf639d0be7034b2cbb26aafd3b144",
+"b6ce4cbc50bb63b45d159f63e0cf327758fc54139044b8d7205651fe3ff51fbd",
+"b6dfb41fefbd6cebcc2b2ec74579bc56fde6a36d315d8f92d3ae1d8ba5760b95",
+"b716334d46162d14ed687142d1cdb6d5fa9a05e2a2f5cce78c912004c65cd110",
+"b72a8f3d170187e0f6c7c82421d6ad7b2b50cea43434a02d1e38dcae0eb0ef40",
+"b72c1eae23fa31246dd0e0be352cdab4113d19c36c568e298cbfc48b8486a8a2",
+"b72cbbf92c2058e8b2e6bed13e8e4a1e9e390f240697c2938db1c58ee03dad75",
+"b7480fa5353b25392a29d941ea379c49775b366c3902506c40ac239258550e6e",
+"b76668e54d4b0653cf597c2565cc6ebd0cc5127aea2fd71318fd0a6a0ef8013f",
+"b769338e4c495dd909a7eb7da084ff10d35a741d7c80067f8f2c581212fd22ea",
+"b82901be1872986edddcbe9439ff720b8054c3b08a5e38bbce3015a5b6a55010",
+"b8417aec3ac0d75ab277d573b221256c47c26edb5215e81159c6cfc3a5d3e7ad",
+"b89b017280c6a48da2151214fcba67163c59150263889a17a0cecbdb62d5c9b7",
+"b8aea32235c67686125698b64969fe9dc0700ebd0785ca81d46bac3acc3713a5",
+"b8ceff817144a8429163eaf703a58924fb2b2cec41c817ef8ce4e8f2ef3e660a",
+"b97fafb677f13099f6aeff36293b374de69760e9e72ebcb97f61520a6c4f4b1e",
+"b989308d1536863d9db45ac8e42878d43abc5b7df4277d8764319d968ef10423",
+"b9c5e1b262e7637c2216c91b3b5147d49156f436d8dc441eae81048bd299c4f5",
+"b9fb75a555490ee6eedd8c910c9cc0882068583c192de092bdacd47ba64aa627",
+"baab61a00bd4d7bd2c8f04e96e79c837628ec7afbdffe6cdc88259246a5e66cd",
+"bb147e97468239c51627d277f338ccca31140285e9f004f7321700c7210c222f",
+"bb163f715517ee2922381723b22ed364c83f5702b7df2be73e002a6d1b346fdf",
+"bb1b6647a14149e50685f51f7af43ef4a6e6c35eb4ccada6d78a8e56c7c8ff70",
+"bb48be9932de24498f138e9affafaf373a35f3b24e643f892cfd3d20d57c7843",
+"bb4aab3610527e3839c6f20ca686ac5110e9c649f7f9c9a8d871ed626ba13f7b",
+"bb56d6bb55ea3f2a867d888f57402de5dbd1d57c64e13026fb2a9916777f4c06",
+"bb60b18aeaa5133468d4d71b9718c3c36f83d335a42ee4a57552381bd595948d",
+"bba97d16b0ece6d3f905c99493c12481d6bf6d544b489d0ebfd25acca7d10283",
+"bbc70a7bc43142a44ba3650553f3f7472b43424a03067015fb4bca6644ccf6bb",
+"bc0cbd8524e5c5a58c8194358fa9f57366de89773dc6b85c66630f7211d76664",
+"bc48536728f155b0092103fb2de751777051dc9bc1970f64f6f92a2220ea4dfc",
+"bc5b47e7aa4b145f993e5a4626530a8aba0d0a9cd0c9c7a01ed9c00c472ad110",
+"bcb8d33c4d5800ee02204c0e5f77d99ead9e93fb2d489a185c73ce824fe6b9b1",
+"bcb9c1de4b0cbdef96a5bd669bae48932caec514fdfa6ffdf26aeb296e1eb2a2",
+"bce7eae397360531add3199b1c43abfb494ac9943711983d7d397aa7a9e368d7",
+"bd10d7c3a56b7a3131c47129fb697fbbedaee3e5cc22d5730d82d75620cdb59f",
+"bd46a400769f028c10ccad1bd617cfc9440d654d49315565da2b52f7af40f4a1",
+"be31a18f0e50f8a468b23f39a0596f2c281270a282250664b2171ab78fd5587a",
+"be3a2bac18a41222d32d9efeae26e284cb5e478aa4d05a57ed89d8bed30f7a96",
+"be5ab6c39ca7db26d5d64d8cdd1d3b977269dfee272aebc26822838fcda4a6a8",
+"be6dab6cb11dd347c8a633cb877d1584a760eb3ab1696d97c8652d1587151ea4",
+"be7b81c346320ddfd855d30143fbfc6c493b0de32637fba6f66abe6df75a9a47",
+"be86c89f2647e9b0f74cbac6c56e08c214f08557fde69a741ddb30952ed9a01b",
+"bea3bb5ea4707bdb78f13185719612de759c781edb72db47c78a49d45be347c1",
+"bed8610b1001f657716008c79fac4cdd1124c9c68a856f9c46c4d6733ed8bab0",
+"bee0e92a472f919e19ec4e908336362356694d4abdd106783aacd057c2b4b8e9",
+"bf196027b69a502b0671bc1293f1518017573d5213cf1e9a4522f435cbadadb8",
+"bf3388bb39347b9d560349ae7cc62f995c3659fc1e91e48b3ff26746e89efdce",
+"bf7f14c8aa9b0e2ecfc5196cae1c5a4b7b9ef9cd6393653f6149712472bf04d1",
+"bfb6068036fdcac32524fb055a4ab843c92b9ca5cf91d496dc24c71f3fed3f03",
+"bfdb2f48ba58bb2d0e88db1f41c39b37d083d4e36b3e81d63f0e85c9ce495340",
+"bfe15fde784be5370216fa17e28362fb537065eeecfb70e6c0f0db64b537432f",
+"bfe49b8170edb20bde49a16165fbde562845b8f65447f0cbeec795385e78bb11",
+"c00c1bb66bd1d35b53c5c784cbc41708a0db3bfa6463466c6572372c3adde603",
+"c02475452dede1e89274e1b4d35608f6c8a138539e8c919ae60e88500787af85",
+"c04cf3a35b2924da46bb56f2c42c9eb2ac5014f30942ddd1659d3e081bf45b86",
+"c063507aedcb18ef64e1c367fd3f99dc1d6df0833ae4e06855b6e26a61a5587c",
+"c076b9bc74d41380e974368f8e9f5cedec650b7a34d05cb1403eae299006b36b",
+"c138d788a487a65874db4de49c6bb54a170f9abfae38113b0a3db08bb918de1b",
+"c14eeb0fd6cbf8e5a73ade705a71b9ed925d0224a6bd419da22a22d5e84824dc",
+"c17fb70536e8186a27ac60fb316ff675c303b9166394de2d8902badf07575974",
+"c1813bece4e6b13da11afd7c430edf622a40973ed1707ce628adecc8c35d3e32",
+"c1dbad0c77c358490379fe277796bb892ecdfbf3a5f9c96efaca5a2c268d1474",
+"c1f43c939ddbe9742dcd3436e35e1e0e679e72405b3e9b850a46b0d0ca205fee",
+"c20e42c6aa09d6a0296fae6f955d9e6fe7498178ae53725bd4d45774bdcd6d8e",
+"c22280de808fdc24e1831a0daa91f34d01b93186d8f02e780788ed9f2c93aa24",
+"c23f05a239c2fb028add2094e7a7fba56895093941140d1afb9c763bbf3f9d8c",
+"c24c00b466b9d73443efa0a049d372bcf9c8e51aa7e4ce54194babd2c2ee0ffa",
+"c297df4e9a3a99b326036a19390ec46a58a516a0876103359e7825902f57c5f2",
+"c2a25c245804577092ab29375c84b907d5c026018609d467bab5a8a1120047ff",
+"c2b5dd210196e1ef8f820f0ce5c017cd297580d3675fd76669f0b939aaeef119",
+"c2b6c4f6171f78ab47b41cf9d05aed079baad36cdc5b3bee8f3234c8400f359a",
+"c2bded3cfcec43a397f3ad6902dd43239f8854ccab97785e2f3ae0836ac1adba",
+"c2c9d2a2d37c9c64873400c8a97a48ea23756791d2c27cbdcae40c67e8e09e57",
+"c2e59bec210c58cab2c03bf9840263c4c7ba533f79140dd1b51709647669cdd3",
+"c365cc2207f9e5f9db8e00d75d5fc815731be1f575584d94bcbdbeceb8525013",
+"c4125146f423cf5d03c042b71040f51d86df826c3fe9df72f721c3b480238a97",
+"c429fa8b870a00185c194676a9913f440faa3b6a6032c7f527e0581164fa7623",
+"c437651988e4d42b2e331085e2e0c4863678c3f45e7afd292063950c6d882913",
+"c4463a5a4056239f38fb3483b64ae14d3c409e54b1b03027eab21116221bc72e",
+"c450b189a303f34b8361f2033fc1ac5c3434a6c245a803f0eafa60066194aecb",
+"c4555ec46c8816a167fd0d9a57b20fd113b55533cc2f2abe9c6083fbe5692c6b",
+"c47befd652d8409e98a59a8aca4d4e95c2542a0f351dfc522d696fcacffd994e",
+"c4a567dae1f293b6f7c00144ec9e8eed0fd3722356503ee533a775fb0dd35388",
+"c4a6cb1677f52319575bb026f1841bfd0fbf7f69b4d6dcc5e5408fa7e4dcaabe",
+"c517dabe3d9fb41cef8353cc30023ed3553f84d06a940d32656a13e9fd9e89f8",
+"c55a923e859306e9a93fbd602e0330f7ca51fb66e05e2a16db33e3e5e751be25",
+"c566735dea76aeca50c05d8cdd3532cfaf5196c7e483063a9042c5c0c35ba461",
+"c5a6e251651bd86c68cc86af1fe8faafda5ad8f2289ca887328f52a29ee94a44",
+"c5b2f42047563560de7c9fea663a6d533daf867f4bc7a9f96b8d530767dc0b6e",
+"c7168b63f2a1f2d425d27df11b13214c07d6e0b72930fee5a64556beb96e9b3a",
+"c718370de825454365759bbaa873018503bdf8d4adc65698976f570e12ecf1fc",
+"c739675dd3244bf5862c626215a5cef02f13ad267d7f2b7707df639c6065666c",
+"c753dabbd381192a3ae1a2d019109c827f6222d0467bee1d33abb6db72abdf9d",
+"c75afd3787aa1f7a953873208d24289cf14e2a438d6cc9822468adf383fc0eb7",
+"c792e40b4687dcd3d00e5571f7509c640cc6c6dc72359117c711776fb872bd20",
+"c79a2a921bd7aef4c4ee9446470a9c57cbb0113c7b202b4b1f113dc95ac08d55",
+"c7a14721c158294649166e1c03c1f76e9e4d3d751e9fedbb459c25e702a103ce",
+"c7e6cabe9a9130bee2f521e1cb288068d74524b2eb7f6dcbe45e564c4b537d27",
+"c8090ae20f48fe2f57d08df2cb747722161507c18e38651a8085c32f5fa52cdd",
+"c83908321bf4663f129472f251aa332aa61930223b82ea98fe19f8f5c57fa7ed",
+"c8506fcd09617920aa5d2119915a30e8cc6af7a4796a7bdd877718e9d305b21e",
+"c8890ec6fad9a550656c0a4ecfcd12fbdf51b5792cde7685055a7c635b50879c",
+"c8c4fb4cbe3feb329f331be52d2585477401ffe095a40b11fed9326673fd3a6b",
+"c8fe952aee81054fac30664e1e748abcdcb14f45678ab260686066ba2166479d",
+"c938ddf4e79af5f4d9285f2bc013dfa34e382354c0247b43743a326fffc2fa41",
+"c980317da408647218bc2b160f4c539c9f8df29c98170872905b80f3857a4677",
+"c98d49e50a31227fd5b28d4409f79d8c900297e2592dbcf9c0d02197bc905f8c",
+"c99ba42dd2fc2c0a06c602bb7b645d64fcd379207bfb4111ea8ba6d884d4efc9",
+"ca156eee5b17adeb2619f7ec522746549effc647223e8fda902001f01a2dbb32",
+"ca2d61aaec0d1e87736636254351adaa9cce221d2438789f667ba73e6cc12b1e",
+"ca3c07217581a477f08ca3b132668206a492f39c462fc12647578cd7b26e1ff3",
+"ca7ce14a0b81290042531b7c032fd9f8089eb2b7087b686b317002dd8bbe8897",
+"cad024cd53277a4716ef3dac2bbc8a2657b090b1897e617db582aafff71841ab",
+"caeff231d079766aae72f201e4331302151020a027aa410254f243a3ccdf4efb",
+"cb4cd5414907a7bdd5d20e92fed909e48604a44afc05ec8cff70dda2cc4ae012",
+"cb7bd0cad8f3cef2fbd3821a0c15646b4e95284b28d3491899496d8e620e34fa",
+"cbbeb9bdad9a4c678285a4de9f744b4586ec87a7fcf5ab5ddd08fe5c705b9c88",
+"cbf4831c8e75ee970300a4d4c7c2d87b788290011b823e6c846cd6076b2c93ab",
+"cbf89e057c502578de3b8f83c0da5dbefae6427004dff9559a2a2e32bdb60aa0",
+"cc35b82369952ea465baa9369f7c179ea3b9c38d4e927fe9a0a3dff822a0e738",
+"cc73637ad0e22b3b3585ca50243081084a5f3517cfc222852e9fc76a8e26b1bf",
+"ccd4d3bf34157c3c7d35e23d3986f48df3179323b39cb6eae3b55080f055bd1a",
+"ccfcdd846b9c5d550a27beabbe245f24c435374d2f77cc0b23cc10b1337d5e79",
+"cd307352b644cf036fc27945c96be2549fa5610067672bce6298d462bc830e23",
+"cd5386f11c7db58f830bb5059e0bee94bd8302df470e12b00443644c768d4d29",
+"cd5e5d5fd4de27c89de257292871f5a26caaa9afce10662dd1d93db13258b9f1",
+"cd7a2781da6ae3a3f5cf4ed30ff3cf54e722426f212e0494b7da0aecb982fe89",
+"cd7b470ac33f62758ad9a8905764772e439ce7911a16cee350819e36898f0395",
+"cd7d09a20a77bfc6796285e8249d96a4a1261186bd4d9d8601baa4657459b03d",
+"cd835bdb131eb088abccf217a0440fdd20e976f577cf5a51e9705b54a3013d0d",
+"cda012761d9ea46f666f5040645bc39fee1e38700da30cf27bcddade5afaad02",
+"cdd144f05c394170bfe26b7997fefc88d7aab6381d928b61a89b0ccf54138a0f",
+"cdd1b9151a60799a9aa96ff07dd613465aaf3fdee06f7c52404292ba9d514504",
+"cde62b6455ecd8296e6d97324c0a061cfae5f8d2234ee73af474be9a124ac9f3",
+"ce28d8e985ac5cf6c2f78a2f8b82e787acd73d565d62f9880a57e18c234a5f0a",
+"ce3e7379fdc1ceb696ceb6afe173f57a0c06dee5a9e9ee106a56ab01eb4eb989",
+"ce50fe6cb517389016440ca12d85e12426199aa44f2c6ca69d13ea89a77b3af3",
+"ce5c23ed07e3205b9940ab4ddb1dd95ac950ea1507d36c40d8053f592c8e2afe",
+"ceb88b36b10113e603ff936a098bdcb204b328ad3e0f894e144562d69538ea36",
+"cf2cc52a18c025b686974063811839d96fe6e11a2ac4599f8c7e799812aaae9e",
+"cf78ee9c9b0521a2670f2bb624c97567dfc4469ec31a8152e550c4a62cf23327",
+"cfcac6db00bfe273971c230ec9243b0efaac96910bb11f568edd15b755ef7036",
+"cfeac78976af263f249b15ead23fe83e6673bd386eeff12ca2fbe64f7eb545db",
+"d01fa8cf3e365f07f268e15e5aa71570fd6418d9d9d56cde940f47bff7d12e1e",
+"d02ce7d3d07d6869c24065937833cffb1a7be3fb390a26f1cc35cc69258bd5e3",
+"d0a31ece766760679869ef344747901716b6325566f2504e160e00b55f6e13e0",
+"d0b0edecc2754b23378a2deba86fc1567542c0fa01b31719ed7f598b004db77c",
+"d1099f2e68ec85718ad5b8afa0e967a375000fe811de0309b7293949512bb340",
+"d15fca50b66215ed68618e007cdf41a9074cff363191c22f5c0d94a813d83759",
+"d17e46cb8adbc8134005e8f61b4a71f1e8832096cb8d677973f25b89447822b5",
+"d19144f5535c41a3eb858f33f0b276e6ec419deadebd2beb5e7e9eca1c538f00",
+"d19f7881418b6f9506f7b0a0cb43d071c11792039dbfef692a749417c23e548f",
+"d1f85e7798206e3ced658f13efa1b22f371f502416a4c76dcc84a95fdc34c14a",
+"d24fc3761f86cdf8a45cd91cb8529c9ad0757c3c7becc4c4c9420bb75b7409bd",
+"d273f24e1fb42c4865ae8625dedd4f0794ed7a093c946b9497f377390d17efb7",
+"d279d7b37b88afc812eef157b9d094117a8ab406771bd51f15b0cc0ac1241c09",
+"d2b37cc1666547f482351ab4e3a885218620b9ee2289acc488224ab9cd92e5ec",
+"d2ef31b1bea4aca89879561c465d146fd21732a68fbf1f336d2411682f9aeeae",
+"d31c8d57f348d63bc52985934049cc7523b51e9601defefbc6eb866eb3200f66",
+"d37600042a0dc24c3c52630ddaf9ada585008c875ca9c749013fcc77a4d4f849",
+"d392c624919dfee74caa8330f9a178a5057521e4d1d545838e451a2faf982e64",
+"d3a3c13b88c7bb133d0b735028ebf11dd6566ec2df9e48310310a1dae38be310",
+"d3bf2c5ea2cb9db1b5dc24c2b4eefb425e270d473276bb6e8e58bfe576c2397f",
+"d3ce3f3b13a9b1e3ba3931877543690a130bdcc100db730dbda358aa94377a60",
+"d3d27bf868136fc08a26e02f42e34f0d29dda8eefbc909d09f1e933a79bf329f",
+"d3e4a4678b2084b6771173cd48f347bee11422b97f3f56504e38224163168b2c",
+"d4074d3d8942dc0608d72c13579bdb22c44592d65889967f6beff27ffb0feefb",
+"d4e5e515d745824ec2e5dd9bed40cdb8844d6bc6bc96f626213a3ceb67a76e00",
+"d51ac8b42924d1a9024e54e35b2a889096d48f3c53af46fb1cd26948ef9b3409",
+"d55b2cb5d18db5cc94f1d0826fe3e89ac94169c1488c9d04263d9854800bfeca",
+"d585572df9894e6872a65a40455ca07889776738246de9a9486562871556ae46",
+"d5c0ae171ca8419e6cf8407e910ff2915ddedafe3ca8e919f5e2af194839f1d5",
+"d5e904942fcc73cd1a2251ba268341bee002355a7277486923c9165b191f5ec7",
+"d60657f4998a03c0524e102f0f0ada322ad099c09bee7303ae3a55ab8ec1c735",
+"d61afb95c5057b269990994b5e9a9af8f5b1fec051044ad1c321c9127e35ca2b",
+"d6631af71050e2bdafc41dbc3044ae68efc5fb615eb34465ed72a2f8f60b179d",
+"d6aa4f66fd8974cc439120f2c7d42323c96fea84a72a9a6819ef273b0010205e",
+"d6db87fb3d06564066142cbdb296d011cc5b3fefb98d0782021ec21afa661f0d",
+"d73d07ce202dd0d70478a177d74fad70c6beb7da15cc6960cd73a435e9d67b6f",
+"d79098fcc974eac25a01462b39cfa188c58bb845dab8161a6ce222d8464457d2",
+"d7c66a6b2ae222de3f4e4c8317611784d0f7ba4ecadc33319b1a58207d3102b6",
+"d7f65be17d2e568fc87f3819c83c7f31177a44fa0c59cdb3599436d16ab965bb",
+"d81c8a3c25545626032357cb99e74ee99fa0069f948b6502fb8e0a521fe69436",
+"d889ca1ef68c9517303a034feb79a92b48f7ce4e1a50640aa20a0931047f4ca4",
+"d8a89eb61979382bcb5f62b319416eb78f807c5b4fdbbe5f0cb3956fc4ceaffa",
+"d8eaf385489a10740ad12007936e881f934f95aff34a6f8735e13a1b2cee4b64",
+"d8ee04f39756a0257aa27df682885db0a419553829a82ce811f94c97b65a9f22",
+"d8fd80403353d74be6b70fabd8250af3e50608aa721bc25ac0ec70da68d173f4",
+"d90de8af27792c7968d11f2525ccb70925a06593981c5c172c206290d44f5abf",
+"d954ec73765bd2a27e892d4f85f88ac89c79f19b7f8dfbf5f258e3868da91c67",
+"d97b8aebe877aaf37efa814ebea34025b0deda9614bf6a7af9d130f8062b3fcf",
+"d9a7f056ac14a1b7afc343a1d6eb77d7f793be6cf5ce020e8355e79bb9107bad",
+"d9bf4062737d0922cf8beb419d79bd10d109918e9d3d230b6b49ff4cf946ee2a",
+"d9da3401efadece6f2897480019392e0899292788fbaedbee9f8fc331ea9513f",
+"d9efe21a9864f1df26509a8855e9adb0b71c5705547c87badfc857765783d7c7",
+"da3be167192e4056f018562bd8813e71f8970631fa6a891166c1271465a0f2ff",
+"da437cf386e897de8d5642e0dec11837ea1e07c166a1b84d1e6d1390a10db85d",
+"da54fa3af613f8765caa0bb59e303e5fb25f3f90b201393a4fb158610691c6ac",
+"da61563e6d6a07c35b72dc38f61558cf6037b55df7733718ce08c2bac81ab3c1",
+"da6980c0ffcc88ff238d5d86e42225ea0f3e2f9996533495b20fe4e42a7d4929",
+"daecbbf8c41835aed9d57cf7c43b085bd1d50eda6791b1046da30101cd7c4f16",
+"daf011df98adfc39705287b5e400987d9e0fc4543e7c66763af9ac2a5d319ab8",
+"db18f45bfc28a7650c1fe69a1306e6b0324baf19ea120b7660fa15b5f5af09da",
+"db52fb8b748dd1f914941486d9238e078a525e57126fec2a31ed4330fcc59a41",
+"db7f342f30d00a561706cb76ff7b83e5b829e0ca4c1e71fe84ab7270834a7fcf",
+"db928a47a72f274536a4b57c322abe94fb479e0e67e04cc02701dd81c492db91",
+"dbccdfe49a853ca57bd85b5bf43253d8adbedaa5b147d4acdd0cee8374937e86",
+"dbe6f7c497228cbc1588e9883fa734595764d72b80cae2bee25db8b25acc73d6",
+"dbee1566f0efe5a13bd30fe0f641b18cbd8e2a538cfd3a56d40cb1f4d698e262",
+"dc4379991a53e3ce036cbfa02a6b99604e07d96cfc7405778c934d1a82f20fa1",
+"dc5459e8f2ecaefedf1e4a3e0468b16be1a6747e84d93517c40728e856807f5a",
+"dc731dcc7644edbb5fb6cc3c985576be8243de8c62176d390bf37886f45c309b",
+"dc7a70c99e97f13db2c5f1eabd5514599ede49d8839486acf2b6afb859676331",
+"dc9228d30b8b4d057e0074c0b14a392f6803bdb9f5b37422106ce691b365a9ac",
+"dc9ffacc9addf3e213332023308352b5d44764685c128ddee3c10401ec97a104",
+"dcbb1ace2a6f7a2bd9c0e5f502157f58c539cbccb9102ad19c448420eacf46da",
+"dce0b577bda7feb832b45445fe6b4587d3447c6461ea1293ad944d713ec5aa29",
+"dd165775188e3919e2b60aacb1c05a9bfd4170930d0c66977b242f53fb447817",
+"dd319175de2ad36b7aabd9caf1f82e2bc78c41e7578de8dfd7b3c83eefcf2cd2",
+"dd51bf6682526fa115c64634ff5553f274e3ecec7be49e6aef4ce08afba7df62",
+"dd567fcc9ee8ab0e3923000210e94ba4311dfa8017903cc03619e98109184f2d",
+"dd68eac09c01eae3fcd9a24d002e44a0f4a172ae2926beb71ccc606196cd4b1e",
+"dde574495d4b5ebf8e350da2b39f48b1146429422d48807a6283e87b598bf827",
+"de019bea69677fb2c3da1c17a1ebe53edc797216159df2a31f86ba06e05ac3fe",
+"de6492b0f677e1f73da2bc650d239e9857af35b783cc941a44a504e32e36d438",
+"de95fae0e69a18024ccbfd963ad3e90fa8f1fe41d5dcdbc47108ad068fbec14c",
+"debf8cdbadf0a2c8e86ca675a6182dc8f00b144f56fd4ffe698b630ba2e999e1",
+"df1d00c2efabc49714646eba80ff845452e5a8c13746e6175cef40e751e76899",
+"df3133a85755734d3542bda79f6823f64f347c2d3126a845f70117c2f7f1aebd",
+"df33d34348370b704acdb199ddbd56abc61ef022e0f33da22eed8fece67b35a7",
+"df46c115235e8898f2e2358ac51feac4f2b7b3fc916c27540c1d272f20e804db",
+"dfbd41d6445ddc7f03cec7973064c5cf192b3893e35761af99a8914ba03a2a6c",
+"dfe18db81df6f1f0f5b2c109a7ab71de6f06e77a010e9d369ddd5fdea0e9f5ec",
+"dfed688a8e9ffd7c08cc4a7c39d5cc6114ba9faa4fde6ab6aea92dc93aa18eee",
+"e00d1ccc8e0ed4afea458197263c11c7fbca81a012abb9ff24b8bff1d8d2854d",
+"e01c79b4cfbffd320109459ddb13457454a2976a9e125188349c77e4c5844e04",
+"e0476f0382ec0a709493843ac509cfe62b557b3f2ec043ec3ab3b2991beaefae",
+"e0504f2880fc45b91b1adb9cb5429a6a34a831054740a1d65c52180c8e3f9cf2",
+"e05909a5d0e99e16ea467b41a678f750285ae284f2129ead6c818316aa091340",
+"e0dc4bef58f4b5c87383b90730bf2f487ce09767882a3d680f7bac103ad22e1c",
+"e0fcdb84a3d9c941ca5c1944b90b4da6d667070e0754fb8cbaf8205a9c91d567",
+"e104870dc3ca958946d33f1b7ab6f4cfdce24d961b88d675a9558f9bfd85403e",
+"e15bc4907478a16d067de2d86d1845d8b5d508702cad49e7a12d89d2b6101b9f",
+"e15eb2d351043d316fe22896479dd2422674095acf45dc2db4786b5f2b43032d",
+"e17a08f1eb0ba23a73cfbca1b48a3ec658578bc83aeb05e6126c88e6dc29aba7",
+"e1a00654d2353cafb43c775a8624bbc4fab9f695a2c097fc8c5de50cf08f462c",
+"e1a7f13429be4e3e73d5eb2919d7f19af3d6cbe2b610a59623ddb368164d8add",
+"e1b7663eba29185f3077260e878d9003bed96356af8aef9ff8c09cac3a80abd4",
+"e1dbc1bd51bcbe5c383757398884a3817212434674e88a541c7f37a34c59352c",
+"e21940677a5f743c2fc27e2a279b55c09bfa361384c02d07d8607d6956591685",
+"e2485ae932dd63f940f33996f9ac121da550c6cc4075528729b4b49d6d245def",
+"e2a66e36540ae474803a3396ad796faf84fc8b9a7567286b50e6730b1b68ef05",
+"e2aa719e3f084e724adecf45c69537e84542302aacc047e9c3cf95ed48b0ff13",
+"e2cec60c12296e2b3789a9c4b8ac6bd76cda2fe7f1a50c2629b2483e3c930c55",
+"e2fab3cd4a96c1b97647ce37db013e5be35b8bb3507fb37e869aadd70f6a7625",
+"e307a4df677faa92f6e85f43312354fd6370c8a3c33518366119b25fc47a66e1",
+"e31aa108d2238432973071b76186fc93bd7e12e55abc3619482258f5ec6cabf6",
+"e38443201e62cb574f3397836fcd9da97ec025b546409bbff0ee2081d0951db7",
+"e386d1ff7fc0b496c07cf4c1997316acd875bced40ad59042930ab5c92343f49",
+"e394d03a6a5e51b3c868968f53a3548deb1292387778cb22d290472482922c5b",
+"e3bbe57a14ba62501fdc3e3d36f78e2a38c64c445c5f22b6d966bb78a823f118",
+"e3e8284c1188042095954cf4f6ec853423f5ce4c5996bb98d9396c0e9aa74bb9",
+"e3eb601e0015928c147e428c8d72877d8d7dc623b9cfc908b2bc1f08252ea94a",
+"e40e5be5285a9ce9a330dece3abbdbe407545a34e8e39ef24879580d6a391f03",
+"e44fc196626e8baec611870fe546dffb3a6504af6e4f0645dfa00020f44c691c",
+"e480d27c135813ce515cab88df658c8c52b58321b85978c5299166b03bc4c627",
+"e49237f3e4fc2160a04474a9ff106618f680b04be02a9e24183bd5f220066723",
+"e4b271df75c9c2b94e01ff6e7a58454ba2aca88bb4431e0445954c165ba97350",
+"e5022890f5b5ecebd3722699843c45a2f08d624390c548c2f8659663ab17399e",
+"e52f77818dc681f619210d9c9256e5aa5ec7c7ef5f4e3b91a6ac3a6226f151a3",
+"e542d90bd41c9b6249722d45c14f54bf47c95db03c0c9f0e3450fb094cc3d63d",
+"e560aaa3f2b491eac0da7d7479460079d3432367a92caf3fe1b67b2db53e92a1",
+"e5664377afca68da78e146de876a3254576d4ede63f4016f7ef35c48bbd3af12",
+"e5bef9b9f05f271c58a018fafffb1f7423e4d7ababa0b0cf19af4ca629bb342f",
+"e61c7e20fd990664f8f844336b8e1073eb323a45913a07539fb33082ba151d1c",
+"e624d33eb4cf551c1b8d640e44145b5acd36efb4c5fe0eacad1d403473b355de",
+"e6297d35919f0993d9ac97d0d65b570946c3f57620671805f562395dd961e1eb",
+"e663badcb7347581ef4a4545329e3b44675158ae275754334f66f3c7d8a6554c",
+"e68589a565dd6069a2444b8834be5d3ced4835dfd129541b10c58d51dbd39985",
+"e72a6b24b3d64135592a2a1c24ffdb94018730d32e3e1d08fb9839df441bc4f7",
+"e7a70b434856327affd65c039053de8fa19f800bb16fc73086a6b9d2976f1617",
+"e7a87b10cc8bfcbc7a8e2530be3bf2dc23246d1e29d514049ebe87af59ea5e71",
+"e7bb9726671d76cf6ef5919c78e4c1d904d7fe8197ef5ff297b0015bc4c53a3b",
+"e7f751f3af0e304f32678fbe24b4f3d7170e360571e9ef98a3d950f9ae703e4d",
+"e8204ccb0300efa2d6e121c8d4e450aa6b01b6c8d6b4e9339cf13a6731fdd461",
+"e8454e8bbb495307bbefe2ee5b4ce837c32892469011aeb2c09933ee8c4ebba5",
+"e847b37d41428340c8ba50ef32ad110c9e7440f4358d975a8d39d17dd5c6c55f",
+"e85208179116b084b3fea974b4a7f164a0122caa212cde1ae82c795939642547",
+"e85bdb284cf0bd0a9e63b1df14ce07ce53139eb035fb9282ebb3bf3d4af394ce",
+"e89247485988bb302570652a1e4cf3a1958ffa077d43486c2dbe2ea1cf65bf7c",
+"e8ce42aac8d587beba0e3d0d715f9a2fb6ca230fc67c040902b58eb106d19f6c",
+"e8e607b54c98e21600974ee0b61db1777e84efb94f7731d149d2b134b833e1ab",
+"e9035322640d48d2cfdfb9199e1064f92d2da340da305a985b896ea7b3e2e37b",
+"e91f85705296c1befa66acebad65d8e406670e3c9e23157d710897cdb99a923c",
+"e92e211fc6c86e7c1f847f960a091e175606d23b6d7aed38a72fd374ae606f7e",
+"e9a77cf81e5d4266c13537f787c35f999862b789da7109046d3236431ac06724",
+"e9a91c0da816a442aa627d244cfe46abe17dcca5e76a6cc7c2acf696fb8b2520",
+"e9df17bfcf0545ce1d34321f955d888fd91bc4f27738ac3ff193e63e1e531583",
+"e9e77d64b7698a7dad24f02f8494bcc0fbe47d10c73716ec4442f7198a8829f8",
+"ea37b4fe424a64cbc95b7093e3a279836e19b03fe16817a74474be47f93289fc",
+"ea47a57617a0590d7f896fe742facf77747d276bbe1b5719638992cfe4a52bf6",
+"ea4bcd854c3b4b6bec01d92a1cb49018e070a511c61d0bc86c4346a422073fbf",
+"ea718316bb1c56014c18f1cc819c57ad155ade5867d188529ed91446e2ceb987",
+"ea736551ceb0ab959f62073af46b7efbb71871870c1ffb46c6e7e1f5a83e0866",
+"ea995b512deaccc8ea88803c8a9e996be26dcb6cf0c12c17fc3ea3854c250c8d",
+"eaaa261868a16884114b6cfbeb4e3e65a2eb137f39dd7f69b3030fa5bdd22bbc",
+"ead04041637e73b450c5af9995e884ffb9159d9954bcd5d1f39183bd30636a67",
+"eb00929fdbf0d4cd45a8b2ee8caf1256b0603168e3b20fa29c7ebc39c0a23772",
+"ebb0b2d72619fc2d257fa52b78e65b211dd2d6ce76d32b9b324426df2e1c5ecf",
+"ec0e758bdcb1ae68462c29fdf2d4f20c8e09d0904927264e72e2e7287b6d271b",
+"ec56fd3e7bdc7de43f3f4256d0516c6675e04280905e6adfd26d3fb975b31d4f",
+"ec612369c2aa8dfbf0cefc549409a0545334ae5cfb2e56a3b5a6a9a41b06249e",
+"eccb5a564c70cb85f91a811c662e7afffef0d3d5dc4886b06517997057b0a60f",
+"ed26e5cf870c915a83adcdeec47e21347b5fd5b03259526ca2b81d36747c31c4",
+"ed2ea1d0093990d23b145b558b1db592615974fe713a9fd9eb5fbdea49d7608e",
+"ed4270e30e333bf701f20361c17d421e38227a51047bc3eae18c7f8c6dd5762c",
+"ed4d113fe343eff51bbbf916cfdddd04eebedf8c0f992cd66db17eef9bb2e9ac",
+"ed8ce937da26adc158ce4ff419b6e1d1df32985ea28c3dfd8d5c49ccfea2d80a",
+"ed9d1e5e5ba43e8e510e7fdda1efad9e32a1884e3ad7c2e6cd834ef45e1e3355",
+"ede85333561aed003365ad8b57174ceef9a4b0de25c28d37f9034b37f697e07c",
+"edf2e6a1590698c8054c9cf250078becfe2441df4fde73a7a558b07a0472cfef",
+"ee40740192cd453b2c641de2bba88df7474fdfb1504bd0845f03cd37fae59dcc",
+"ee64c03cb93b0fa45eb90ef9b87d51472183c388d340fe56c3bf9313fd83406e",
+"ee9ff5c1cb28a8c058dc5dfd50985da0f381bdc47a0473d3d23a41bdc75b3d59",
+"ef74c1e05f87f182fa2bab9285e07212e0330d2e33be0bb9a154bfb79cb20437",
+"ef97cb159f44b3b69174978f478a613d1692fa421fd663753c85eb3f9780b0fc",
+"efb580a6b2973cd9d8dbc245165b601044e0a1a9f364a4c44b4c3df6ef4faf8c",
+"efc6743d0ddf8df7f5d82fb10ce827a2286379cf44323439c74b79279a73b320",
+"efc85cddf7d1a472ccd0ec82d3a5377d33737abbf40b9065f8c1885245959464",
+"efd9c9a1b7749203678822d7125b163a7c67c80bb99f38ad298d1aad5b4247d2",
+"f023ff5d0ad206a1c422784c3321867f2c824cdbd09caebf5530d8511a8a56d5",
+"f08a4d61f641ed81cc5a3a677f5940f46203e4f738f97692ffaaec2244229677",
+"f0b79da81682b38adc4c6e38b8be91c189c906d0311c984ee40267cb1b89e561",
+"f0c2299b2bb601e8063c20ffdc82726b057d34735f64d39e59f43d7aecfa97ea",
+"f128f2de7c744738ddd4c057ae2b2ac6d1ceb87b1453e7cc496161378028ede3",
+"f16706f77f543fcb26266b8bc68f4e1808de3508d28e238c8726d243dc96b0a6",
+"f184d62a5733704f5bf3b0d56d2067dc07c4cebccd88da18cff978680b063665",
+"f189ce9504b19f3e2c9eea720d9cb95d33b91cc3a90879d9dbe06da94e7359f4",
+"f1a4be51fd91c4067d6967219b67880fee84cff0d3bf61ea460c0a7e051f7a27",
+"f1d5daa0fce126ca0af2ad5dfb227b3f26ffde13b67e5e93b5a340c5beb662cb",
+"f1de8ed83127b15a4de7e51cd60a39f3bec9f0340b20727a0de6a58f1dddf080",
+"f1f1ce41c9198b2d90f8686465788695e323eaca14a6be29456e6129b8df7405",
+"f205bd88ccdabbb5ce92729683cf948455eb2c2c62966bee336679e19c5ae1ab",
+"f206423a229b507f48d8d01425d50a93ab547dde4e7606a2c15a72f1a5978971",
+"f20699cbf5d0021f5109964c0f409fa375269c08ecc18bc5c2ea683b78f077a9",
+"f2257bececf0597c7e75b1437971c9e25e103cf2342ecbd43c8321ad4a694eb3",
+"f23f2fa868bd45fea4230ac04c5775d31733d130c053c5a7c5ebc86810685c36",
+"f2a06486c21b13b3680b4e43835d95f9999d127ef24826554caad9a8281942db",
+"f2afcca96fa4c0d371a8968dc9854bfe3c93651138b1ba404765ac6153763abc",
+"f2c924d2179b2469e751c66c25e4af4c1e0120a14cd75745d2bfcea3569e12a5",
+"f3154baac6c2aaa1a0f60b9e6346e8527c3cbef0957e516c6510e60bb1a6b049",
+"f341105a56c0d5126627772041c8fd0864bd6309a70f4ad39ea9ed9b1cd73165",
+"f34fbe2616ebb67d9452b8de2b3a635f8ac8f901f27f0e78f90ad67cd717d01c",
+"f36140917c35d7b4c19eba791635aef260423bedc0046a74aee7332fefae9b2f",
+"f38635193466e0640ded241bc65c8e6271b2e97ee6f034eb3d15e493fcc98e21",
+"f3be3caafbf6ce96c22e5760118ea10e5dcee54e7362b6ad5faf5d2e72bd2219",
+"f3eb0496127b3467808cf0235df55520d0503a06299de4e8f41107b15843ab77",
+"f40355a6aaffdc6abecf7841882e89f09ce22e5862412a69be27856f07c50694",
+"f40e1d415f4a06d636f599b117eab1f78491fda01c22b4c58d74ba763fcc9967",
+"f421b7794c933d42d0f621110fdf83e6cecb9e0daf6115a1353067656bf00154",
+"f44daf264918aada933b32c273c47d25bfa7df3b99ec9d1b7577ec1f4de5f135",
+"f4875a185942d2412996b4a41acdc414f051857e4ccefb47e5b5980e42fbe21b",
+"f48fb16798184cd8209fd58ddb485448312a682b2a4b27db494222030074c0b6",
+"f4a9d3d5240c4a3f0f6153088c7065ca8996d89eb447ce14e08b3d057f21c61b",
+"f51f5467cf8218bb64d04b725ffe802c73eda331ff56eddf269207ff023d1ebf",
+"f538c15681c840ae9c04bd14422e6df2b80fb408e1b03c55de9c2351adc32dda",
+"f5f111b4d867afb0542376f4f2336d2c0207f8c7c9d656be8c597dd1ced4c5e7",
+"f69639386b8d2d30dc3f027121be5fa1120e92b0a552da9e60bc455d79742755",
+"f70551627671a19df2b3c0f2ee3cea32f7c51f18ed182cf9940717c50b9b21f5",
+"f713c1b879c1a74b8bd908e19c50c681de042365271e5ffe48d3f70ca8715f91",
+"f764671a9cdb1a6d628362ffaaa4c1f3993127cf93338ecce6cc7e379b14836f",
+"f78d40802fe7acf0429328f62314ddf01ed2519d18d6e53842e8dcff73e11f77",
+"f796f39d53cbf665f6b8de988fc2df5a49fa915ed306ec4ef39a0e556eece9ea",
+"f7b98db27513a908b9e06db2027732a523e7ebbd3b5ad84ccafddb4e4a7900db",
+"f7c2d8788bc6a195bdd4ba40dbb94b86976edcdcb2311544a3b343bcea916c4f",
+"f7d0e158d1c48df2d4ee8f5576ca2f7cc5b63b96880889dcb6ad51e1f862a006",
+"f7ea2ad234f459872c9685a7474153b19b5cd3f2dde0c0b380a916cebd592904",
+"f85221328757ed6455c58bc99566385296b61ce0d81850f753497b8d903286fd",
+"f916464cc85a90be5238eb0fdf33dfeda3c3263a4e77a396cf24d9308460892a",
+"f929a8a54e7d4f9bc11646a310cdc6b3d8a68e61597c04a97793c3116ad5d673",
+"f92ed5df42ab0b41e5e8a59d649ed0b4cfd8c6da7d3439a87e0a68db1f3094ae",
+"f95827680d8086fcc57d6c0ac20c3ffbb4cf2e43284a0476eae394fd31943f60",
+"f99bfb84eafcf721989599f816e535ff543ca419b22505cb25796a98187ef478",
+"f9a9fa28e2b655611abd82385150c3ea4c3fbe6e6afc90898afc6ef0372c8df2",
+"f9b27849a69a9efeda4a6ac068938e63a8ed61670f79831d8f7e6b70df546454",
+"f9d0535631531461caccc2c9ca35d6946de92baa74c3e21222ad404b2024cfef",
+"f9f5ae9f5c18bd9da2beb8fc0024074e55c9bec996ff93b6071ee288b81c5e3b",
+"fa14c6041ac91197b514ea23b22817989fb7b4cde8aa032f80eec4dcbee22569",
+"fa5985a05a4b5ec8f1db752d817d333e5f3448389655957366870de9478bb122",
+"faa34da3759411dae9a6204e173386b6e5bb7f94036efdab2166d0fb9496881c",
+"fad7be4b8fe0a26f5898dda03b6a60085b54bc5124536a429b39702cc8eb787b",
+"fae874b4ce3ce46aae80f7630ad9ab9ba317df82b691e6e21cad1230ca3152d4",
+"fafb2476fbc9db2a0ede05f3f77a8d3711f042926fcc0489e0bd9e53487fc2a8",
+"fb02bce3b91a812df5f077057babb8c9ebdf4f8fc0a2b385908e9a52874ba35a",
+"fb066f6c4d55f960a58f7faf102d1e7c3a63946ce31f6c3b0d735b6df8610246",
+"fb2e5bc3108ccd8173fe26a2b0c43baeddd4246b0efa08e94576dd0c559565e7",
+"fbc6b7b154d0fd603e8c97c6e884647a2be8693565abe421cf492921971beeae",
+"fc0be59fe23c4b2a80c89ed39e27d3c3128d5d78787462516f6fa1ed27a521d3",
+"fc0f6ebdde4e776b80130b4e69295923ec8c60e1e4194d497501c3328dd5b989",
+"fc13e4cd788b89ebb17a6a52584d328d3eb1a13f01863c4eaf1f2970264afd37",
+"fc18492f7dcbc4d735137762c1764716197c63e4fbe3564fcc44375ba200e92d",
+"fc342e353e05e9ddf2b41e4716fb1443561c54c05b2efa7394a3a21577536821",
+"fc4b293224aebbbae23f4f53de140ae63489fa625f7c5529b0556b910de0a082",
+"fcb8c30bb82581f10524860608984d3e4d10b3d079a910669f2b9804bd41782e",
+"fcf79c1a85dcca68af117cce20b1ec6ffc8c5865f63f4168750d6a9b37789c88",
+"fd428c7c219c8e6af922794eb2a0a3d57d2f3e8970a79a00d522bd3d16ba520e",
+"fd583ca51085a3c6a6ecaa3d663c0cc8b24d3388da67c390def870d50108bb2a",
+"fd62452f7250739d09be538a771b3c285c01f1c61558f0b130eaafc00c1edcda",
+"fd7c2f510e6d33761ba2fe13192320ee9083f0a54dd6919d2fad3c03e251a07d",
+"fda52a3b10ee7ea69de6581cf73cc6743e1907793d54ea3b6bff2a6b3e30a999",
+"fdaafef1f6ab4b4cf9402d2bbf0ceba07aa40ecbe2ebfabc0d002cb1306b05ea",
+"fe4ca8118469dee2e99bd55809740819330d90f9f891912057938e79de6702fb",
+"fe7043394b4e5d2aaa555739093d502be9e016be3e725c4bebf8e027439d1f0c",
+"fe70d729c7d0fa221ee362e17da144fcf5e02d3ff5c2cdca30531bbd6bd4de0d",
+"fe7332fe5f0046cc2e46df0cab2fb40ec0506802d976489eea058a86bc33dfac",
+"ff1d6b445ad5b8e8074b8fbfd8bd567c76b56a38064d5dcae2768de6bdbb8072",
+"ff28f33e8da4974a11cda22564a183d617c00f2ac9c632d10f09dec4a9c769bb",
+"ff6a9cce4312a4b325b51c47315b0e0bf5b2b0c6caef36eca94454d9a1b0670b",
+"ff94ba01f44100f1971ecd8f2f25d77f70bda878bf78bf4a6463f33d396049ed",
+"ff991aac154f93e0fa9077c9ddda952d5219124698e4e222c6f02b0f5e30dc62",
 };
 
-const static std::set<uint256> txSpendingBlacklisted =  {
-    uint256S("7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ad"),
-    uint256S("77b6b6392b0eb5d54ae0db1fb7e478fb9acd5e852315a6935116469ae28d91ec"),
-    uint256S("31e15f4abb9dacc706e238234787a05cf2934d53f972969acf4bcbe5a66c6e54"),
-    uint256S("fc4b293224aebbbae23f4f53de140ae63489fa625f7c5529b0556b910de0a082"),
-    uint256S("2a239715223bbac03c11cb3f207f4d33e029521b648db5a6c8bf9fcd5529ad7c"),
-    uint256S("c8992e415aa942ba5358fd5e6e53c07bf65351f3de0647fb4aeeb7def66cba86"),
-    uint256S("f70551627671a19df2b3c0f2ee3cea32f7c51f18ed182cf9940717c50b9b21f5"),
-    uint256S("18c7df0c807cab9e5354bdd67d0fd9c63c5f9a8dfc7ae419c0479b5e41dbb260"),
-    uint256S("e3eb601e0015928c147e428c8d72877d8d7dc623b9cfc908b2bc1f08252ea94a"),
-    uint256S("a9b8d7fbc112848dfb04dea8aeaad6019e24ffd86355274d8117c11110e8d5ba"),
-    uint256S("113d13b375295bb3a808d6e30b4ad9ab83d9a9f60872d7aed2d8da2ef382830a"),
-    uint256S("5b3200a52515d01eefacfce5f83a1b773d25813dbe13de9c2110a06f41f2bc06"),
-    uint256S("f38635193466e0640ded241bc65c8e6271b2e97ee6f034eb3d15e493fcc98e21"),
-    uint256S("f3be3caafbf6ce96c22e5760118ea10e5dcee54e7362b6ad5faf5d2e72bd2219"),
-    uint256S("c063507aedcb18ef64e1c367fd3f99dc1d6df0833ae4e06855b6e26a61a5587c"),
-    uint256S("3c28ba3d447edf1d981a4854a867c9e4342df450c7397ba9270957d21d0c22d1"),
-    uint256S("dbccdfe49a853ca57bd85b5bf43253d8adbedaa5b147d4acdd0cee8374937e86"),
-    uint256S("f95827680d8086fcc57d6c0ac20c3ffbb4cf2e43284a0476eae394fd31943f60"),
-    uint256S("dc4379991a53e3ce036cbfa02a6b99604e07d96cfc7405778c934d1a82f20fa1"),
-    uint256S("a1df9c2322cbc95e5b65a3a267b4c3eda7feb7d0a09fa8b64c1dc974c238ff0d"),
-    uint256S("ad2f12936300dc0d10db4f56c00d6fef18c3b4c69082172d8d7ab2b2e8207f02"),
-    uint256S("4b92cd02a5be1bd6cafe7e7140d8a2d1b10ff761ed0ca88ab9a9ba59acb5098d"),
-    uint256S("f78d40802fe7acf0429328f62314ddf01ed2519d18d6e53842e8dcff73e11f77"),
-    uint256S("dcbb1ace2a6f7a2bd9c0e5f502157f58c539cbccb9102ad19c448420eacf46da"),
-    uint256S("51838c3d52da894a32e2e261d81249796d18b0ecc889131211737485d174079e"),
-    uint256S("d9bf4062737d0922cf8beb419d79bd10d109918e9d3d230b6b49ff4cf946ee2a"),
-    uint256S("b12c2b0c03dc491d3ca8d4e4a76ec6455fa7d29904d25cf035da33bc3d823447"),
-    uint256S("d15fca50b66215ed68618e007cdf41a9074cff363191c22f5c0d94a813d83759"),
-    uint256S("d9a7f056ac14a1b7afc343a1d6eb77d7f793be6cf5ce020e8355e79bb9107bad"),
-    uint256S("c04cf3a35b2924da46bb56f2c42c9eb2ac5014f30942ddd1659d3e081bf45b86"),
-    uint256S("56c50dc3490b3cf861eb4e5dbf3656a1f0cc58da5585ab6af151bf6744c43169"),
-    uint256S("c718370de825454365759bbaa873018503bdf8d4adc65698976f570e12ecf1fc"),
-    uint256S("cd7a2781da6ae3a3f5cf4ed30ff3cf54e722426f212e0494b7da0aecb982fe89"),
-    uint256S("ce28d8e985ac5cf6c2f78a2f8b82e787acd73d565d62f9880a57e18c234a5f0a"),
-    uint256S("1fe47e1ebdcee6b05a75d98b28c0f774baaa1d80657e3f1c3725f86a4e54f87c"),
-    uint256S("c47befd652d8409e98a59a8aca4d4e95c2542a0f351dfc522d696fcacffd994e"),
-    uint256S("04827205d7fd81b51464ed0f350d7d50a3b853da7567bed5d47a9c5724f4e01d"),
-    uint256S("f7ea2ad234f459872c9685a7474153b19b5cd3f2dde0c0b380a916cebd592904"),
-    uint256S("debf8cdbadf0a2c8e86ca675a6182dc8f00b144f56fd4ffe698b630ba2e999e1"),
-    uint256S("c4555ec46c8816a167fd0d9a57b20fd113b55533cc2f2abe9c6083fbe5692c6b"),
-    uint256S("bd46a400769f028c10ccad1bd617cfc9440d654d49315565da2b52f7af40f4a1"),
-    uint256S("70f512f3e32ca6d1d7c03cf417d03fb552a60ed51ef0611a58e21b243058513d"),
-    uint256S("6fc51ad40c198847c9060f838d0c2f6703800c1c72405cf285ea70baf76ed6d7"),
-    uint256S("27f3cc98061ef0cde0766a4d8ad3e10b962a8f387be2ed40537ac7a2d758aed4"),
-    uint256S("413805bd5523d0e1526c23347a29dc32cd440be449d0f99991a558bca8812d1c"),
-    uint256S("59b97f4e2808254096c227a433f8283fd23f571a300a1838fbc20f64a725348d"),
-    uint256S("c8c4fb4cbe3feb329f331be52d2585477401ffe095a40b11fed9326673fd3a6b"),
-    uint256S("78d9ff2fd0301862e058af1ae955827d5863517d9dd74e059c043210f96d537f"),
-    uint256S("e21940677a5f743c2fc27e2a279b55c09bfa361384c02d07d8607d6956591685"),
-    uint256S("a0037761808460617d8f793c1cc349d48df6e8d7ae325b5c92c578b99191eec8"),
-    uint256S("a99487098122cd814af0c5c5f2e9012eb70828fddbdb4f86917f04a697b0d888"),
-    uint256S("3e467a9a24c2450e58062754afce6ca4d52db70bb370260a723099a316062c85"),
-    uint256S("f40355a6aaffdc6abecf7841882e89f09ce22e5862412a69be27856f07c50694"),
-    uint256S("5120208fbf72dc60a3da57326b1f72ab4e02859e407751d93a08414b634a1faa"),
-    uint256S("f85221328757ed6455c58bc99566385296b61ce0d81850f753497b8d903286fd"),
-    uint256S("d8a89eb61979382bcb5f62b319416eb78f807c5b4fdbbe5f0cb3956fc4ceaffa"),
-    uint256S("93944c54122f5c0536313ba4ced22f8d4d818e6966e3b7b0c36823b14d9bce7f"),
-    uint256S("84e96a3c5cc2a005c6b42e3236bf19cace7e8535359dbe1f8dd0c74a15440a25"),
-    uint256S("18e479190489d63d66a86edfa0d8efa7fca397f7ca5d3261c2816b2e57ca54e0"),
-    uint256S("77709ebd97eb672e11971072438e736dc2f86a03aeb4ca637646fe1c6a658cfc"),
-    uint256S("894ab031c07d72f0424e0121f4fa954c33a97f27339e719a215b488a44f902f0"),
-    uint256S("2123dbbf919538e07f454578f582ea01e41451d766b807f6d420f767573c0634"),
-    uint256S("d3d27bf868136fc08a26e02f42e34f0d29dda8eefbc909d09f1e933a79bf329f"),
-    uint256S("038601ee137f4cf5b59ec85a00fd64d7bf2436f5dff4ae573461fa760cd18251"),
-    uint256S("b580057169beac68fce1eea9633120ef293c51ddfb33ccd45fd0f0a350b5a097"),
-    uint256S("33793ff34e232c088b2725480d5a0930f556ee1e45c7826a42653d83452f919f"),
-    uint256S("c753dabbd381192a3ae1a2d019109c827f6222d0467bee1d33abb6db72abdf9d"),
-    uint256S("74698d7eee2bfb9e0813c9515985465a1e63765c6c371a0d69639a2c6281f79b"),
-    uint256S("7cd46ad72e122907fc2cca219d04b14d97f4885e6772818e81e9c17b7e98e21b"),
-    uint256S("0c9c128476e23abed2216cd1e082d65ad53fe7ebe9b6d2696e6c69eec7e94405"),
-    uint256S("836bcffd52f83496598896ab5639eb67fff12fda848f05186ae1c59f1cc9c7e3"),
-    uint256S("bba97d16b0ece6d3f905c99493c12481d6bf6d544b489d0ebfd25acca7d10283"),
-    uint256S("6fc35b062253efd935f227b7189f4b40d011de8ee5388caedfce5757b2be3192"),
-    uint256S("ed26e5cf870c915a83adcdeec47e21347b5fd5b03259526ca2b81d36747c31c4"),
-    uint256S("599b3d15488077d9946e802846e18ea4d27038d07dee1dbe10132ee95c4f2e66"),
-    uint256S("fda52a3b10ee7ea69de6581cf73cc6743e1907793d54ea3b6bff2a6b3e30a999"),
-    uint256S("52a7add129810b8aeb5b7bfadf4de225867f76cca9e6f52c44ec0d069e6cf34e"),
-    uint256S("efc85cddf7d1a472ccd0ec82d3a5377d33737abbf40b9065f8c1885245959464"),
-    uint256S("9baa16010f16bc7b764709f3eaf92a5bb14d76eac02c037741fd77b6dcdcd29d"),
-    uint256S("4e5b8787b58a2c9e0a00a3ee0d4189f62a954512abcd125122802fe5b95f61a2"),
-    uint256S("014097f4112b465a840971131c82ba78f818b3c689461fe41823fcd17a318e59"),
-    uint256S("ea37b4fe424a64cbc95b7093e3a279836e19b03fe16817a74474be47f93289fc"),
-    uint256S("5d59e2494dc809c88200f226edd502843da724906735a9922be927ccb061fad8"),
-    uint256S("b5b7ffb7591a418f23bb6e86c2177ec46cdbb156bc165294309cba9f0bd1d6ab"),
-    uint256S("b82901be1872986edddcbe9439ff720b8054c3b08a5e38bbce3015a5b6a55010"),
-    uint256S("2074c3ab4048eedecc1e71393ce486cce44886fcc6d301974d780610a0e4d921"),
-    uint256S("5153d846cb16e69ded0662bd0eebf07e301291571f1ce023070e46ddace8c608"),
-    uint256S("e9a91c0da816a442aa627d244cfe46abe17dcca5e76a6cc7c2acf696fb8b2520"),
-    uint256S("6aa8e81a337a75d7e8c382487cdb9f9b1d94cd2166a6efd9b06710a784d238b3"),
-    uint256S("e0504f2880fc45b91b1adb9cb5429a6a34a831054740a1d65c52180c8e3f9cf2"),
-    uint256S("0f801554523971ac060885980444c1fdd984f1b443ad46c42fb84c7a4f1d7e70"),
-    uint256S("f2afcca96fa4c0d371a8968dc9854bfe3c93651138b1ba404765ac6153763abc"),
-    uint256S("b6411c78662368f9e8b155e301f7e538262e199d2144e5173da27ce0a0f5b4ad"),
-    uint256S("34ba734aa028ee7acc9a5e789e1dae8253bed15da8dff48b0fa63c5c6d469e50"),
-    uint256S("ca3c07217581a477f08ca3b132668206a492f39c462fc12647578cd7b26e1ff3"),
-    uint256S("9f0adc1282a4b164553ae8f10ddefc3d303fbcb3538d24355d2cb510aba99c30"),
-    uint256S("854ba5de535d9fac7b8a13c581ebd6013d19901d9cdfc135b029e429e3add35d"),
-    uint256S("e15eb2d351043d316fe22896479dd2422674095acf45dc2db4786b5f2b43032d"),
-    uint256S("10aa34d94f6c086e76cf5fa80ddbfc6cdf2ab5bec3bbb2672b0c8b02cbdec7d4"),
-    uint256S("af1fc79f3f889d1bfb4fc33bf38ae53f44b68d2748733e2a1e668991063e9ccc"),
-    uint256S("14f0734342026e2da77c7e5f96bf7c1134eaf333c1aba977113707c14f9ec830"),
-    uint256S("f5f111b4d867afb0542376f4f2336d2c0207f8c7c9d656be8c597dd1ced4c5e7"),
-    uint256S("d1f85e7798206e3ced658f13efa1b22f371f502416a4c76dcc84a95fdc34c14a"),
-    uint256S("d3a3c13b88c7bb133d0b735028ebf11dd6566ec2df9e48310310a1dae38be310"),
-    uint256S("a7b16eb7763ba092874c8b8d12a7dd1d9c99b006077ded7ba15b488c647627a4"),
-    uint256S("868615cf717b98704794df4ec23cc9d507a0a849085ef78e61d992eb53b009e7"),
-    uint256S("5fa07665329a8d2e5bbbb225dd6ac43d014cfe53a900c0a17d5d28f5d9bf33f0"),
-    uint256S("24bec88defc02b810757fe91a4cf2016eb93a9ccc6d7296dc253b69ba96cd134"),
-    uint256S("ec612369c2aa8dfbf0cefc549409a0545334ae5cfb2e56a3b5a6a9a41b06249e"),
-    uint256S("b2b6d8b575c6476874e56b415a41c00a0bf7140abc083cded1267520a30b92ec"),
-    uint256S("11ea39f66741f2987016d6f30ae2342ef079e017b284f886c08a753d93dbf193"),
-    uint256S("455ddafb6d0973e6f24d6c9f19e5df9ab7e76ac6476f8048a4f127dff9dcc47b"),
-    uint256S("5be04d427c22abe95d68d690f57b0396e3f8f6e8c2fd8a40f89d6acef07145e5"),
-    uint256S("0d62614235d64e2feadc36100c0c890b6ae6fefceaddeca619300fe59e6fdab4"),
-    uint256S("323b9feb2521f6679716631b063b9264eb344b9854ef9660db2e0ba41f86d2e1"),
-    uint256S("783615b6491c2288fb645b3f9518046688a584fc359a29bf8e201c8b89491af0"),
-    uint256S("190062c290cba24bdb4968efdcdb72ebcbacf0b8e241851742ee15c66a964815"),
-    uint256S("2b2dd87bfbcfcdbbc7793a17ec918378fcdc7a7c922a1cf666970a6060ee88c4"),
-    uint256S("61fa79253892718baf4f37050d3b2a198f20b6504db47669a83ec267a0d16af8"),
-    uint256S("8ee266fc21b7a9408da75539266860da362ee38049994ab69871c417c07aaaf0"),
-    uint256S("c2c9d2a2d37c9c64873400c8a97a48ea23756791d2c27cbdcae40c67e8e09e57"),
-    uint256S("bc0cbd8524e5c5a58c8194358fa9f57366de89773dc6b85c66630f7211d76664"),
-    uint256S("41e33c7c4e313a70af86d796aee10e1e184ebcde51a40d42f6ace172f558d0a6"),
-    uint256S("d97b8aebe877aaf37efa814ebea34025b0deda9614bf6a7af9d130f8062b3fcf"),
-    uint256S("a07c4e0faf155399c76c1fb6c200e3688748f59b771d9d41fee6f94a0f37febf"),
-    uint256S("6e7d6d00110e040eed67757889f276d941297f141c71cd54cce5b55f8c337819"),
-    uint256S("459dda630726d4a3f1aef43bbe33d1684408113b94760cde594d08dd069b7f85"),
-    uint256S("d55b2cb5d18db5cc94f1d0826fe3e89ac94169c1488c9d04263d9854800bfeca"),
-    uint256S("163a72eb0836b74765c9bd2dd023ef3e29e97ca7d1104d981522ea4bede45dc1"),
-    uint256S("0e9f709f3bebbc4a5df19773979780cc88369213e15c1996dd63b74177b98b0f"),
-    uint256S("23bfd91c878523fd1b79181873e2b815ad479f5e79e42ce916eb9e887654e4e2"),
-    uint256S("da54fa3af613f8765caa0bb59e303e5fb25f3f90b201393a4fb158610691c6ac"),
-    uint256S("76c213aa50a39176d4c6c0624fef63d80b2a9ffaf545810ba43e45014bd881d4"),
-    uint256S("edf2e6a1590698c8054c9cf250078becfe2441df4fde73a7a558b07a0472cfef"),
-    uint256S("601ce44e93e322f1f8edbe00d95a124f1ac157b3e2fbbfca839d0647188ff048"),
-    uint256S("a8ef8a9a5903e6791bec55022809c968810d81ea243baee538ff9b090ddf27a5"),
-    uint256S("2d485847fec2899448340a04018509a15962b8a9de4350071397604b0b8498f0"),
-    uint256S("c1dbad0c77c358490379fe277796bb892ecdfbf3a5f9c96efaca5a2c268d1474"),
-    uint256S("314eb3bf84b8a9fc4ce3c5357fa9d0c4c31495e44004bc67f2547485f57b9c2d"),
-    uint256S("7f6d1bbf0061d2161812fd46e442b111d9dcb3f34ab4273e7c1332a6da62fb3e"),
-    uint256S("3c1f1e10e2206fcd6d47e1372f07edc5ec5112f50e639755ddee740e7be6e457"),
-    uint256S("860cd14a1c6ef0e9f642547d345946358bc0830b59f8b0dfbf08850c9d50ba1b"),
-    uint256S("9bea4fe25d3b52d19803ca35473adae1b6408ffdc9190285280ee41dcd896615"),
-    uint256S("6880e580563a678c5559767ad5a3c3aeb4e93c887f72507cf9482906e6fab313"),
-    uint256S("abba5d391df7e1f9250f6f7af5b009a6acd37a028a0184fc9b836fdd8f543eca"),
-    uint256S("301891c4ab82864e1c4cb58334326ff596d08303bfddbc5b4f7b26b1e6517f16"),
-    uint256S("1e8c230267685f0719262e897809d982c0ce44e9474705baaf720eb591ed5304"),
-    uint256S("459e99998f11b763fbb15ca4ba6e10f409a15820d6db28b91d73f7040e623a40"),
-    uint256S("f3154baac6c2aaa1a0f60b9e6346e8527c3cbef0957e516c6510e60bb1a6b049"),
-    uint256S("e3bbe57a14ba62501fdc3e3d36f78e2a38c64c445c5f22b6d966bb78a823f118"),
-    uint256S("4f99d50ab03f129fb3b437f2d8814795dedd16d64a371bb1bc07b2ee3115d6a1"),
-    uint256S("c5b2f42047563560de7c9fea663a6d533daf867f4bc7a9f96b8d530767dc0b6e"),
-    uint256S("57b9472b8d4e0086b0fd68d849bfe9523cc994fb584a77bec8d4a90a1e94cf0d"),
-    uint256S("9a67364ac11ecdc5811348e89a21e119b6050eddcdc16a029a4361894e95df78"),
-    uint256S("e85bdb284cf0bd0a9e63b1df14ce07ce53139eb035fb9282ebb3bf3d4af394ce"),
-    uint256S("557122487b6c600cc3bcba531e355abc26258cd770331b14cb6d348e5b0e3b8d"),
-    uint256S("59c22352d6ff23564a5a0bd47b35709270614e8d93b7557cf8e6260f81666e10"),
-    uint256S("baab61a00bd4d7bd2c8f04e96e79c837628ec7afbdffe6cdc88259246a5e66cd"),
-    uint256S("64e24b40156b017f6e0f506a8896614a96156308c9088057038e5f05fc9e5700"),
-    uint256S("dc9228d30b8b4d057e0074c0b14a392f6803bdb9f5b37422106ce691b365a9ac"),
-    uint256S("c437651988e4d42b2e331085e2e0c4863678c3f45e7afd292063950c6d882913"),
-    uint256S("ed9d1e5e5ba43e8e510e7fdda1efad9e32a1884e3ad7c2e6cd834ef45e1e3355"),
-    uint256S("1b95f2c02bdbafc2ace2fa479139af8bb87f9e974103f33b2ecd081d073accbe"),
-    uint256S("b4de131f0835847f6c0944195ee391ac3e529e1189849b60128068df35540bd5"),
-    uint256S("02262e463673da8e2ce48ff3be8d3dfa290ccffa89291137595529f6c810bf94"),
-    uint256S("1180aee6ab8984e884b5e7a4936885fd3b9ecfa2f9e3b5253dffdba2db06519a"),
-    uint256S("774e2743c8c181716f7ddad5aa42c3d40c5b388f93e7bcd49d2a773c8c7b96be"),
-    uint256S("575ca33265e2daa57a316bab61860794a130a53ae9d2c258a9bdce1e1788d42a"),
-    uint256S("587ca049491476b6e039930d8097ecdf7b7a147cf74fc42a269fc53a79d46f49"),
-    uint256S("827b7813fb8db21d441926087471b139d1d8a819004826ae1d2cedb40243d4e9"),
-    uint256S("235bed1b441dd52550d59450d92401d9658f8931ac275f97b7852c205d8ec3d3"),
-    uint256S("b48784b5970d3e335c09cb1eba026b894df76084a518b93a6c3ba6bde13a5e21"),
-    uint256S("06c8c5f98eb7e742317a0f851663a8b19ef58f1cc572f3960cc51e6584e23b84"),
-    uint256S("e560aaa3f2b491eac0da7d7479460079d3432367a92caf3fe1b67b2db53e92a1"),
-    uint256S("8c799fa978cdb5639a1af8c49d21223e682d24be58f92e7f0f2ebde7058b27d8"),
-    uint256S("b9c5e1b262e7637c2216c91b3b5147d49156f436d8dc441eae81048bd299c4f5"),
-    uint256S("660e5819cd485bb01536b28b3880d8c95c259a8a8e5687407bff561f654d9aad"),
-    uint256S("be31a18f0e50f8a468b23f39a0596f2c281270a282250664b2171ab78fd5587a"),
-    uint256S("0dafe630c36af2d7d65b14a65d361c37217e5563b5f9281a034c5ccb15fec244"),
-    uint256S("477faabc4b8682da0ff5f30cca93af5da700c97b99620018b1f0e29af579b51f"),
-    uint256S("021fac166a06326b85eea299c154bc46443be1a49197663a63806743e0b35bc4"),
-    uint256S("92a2425e9944472a765f8065a427e17fa25028d65dfa77159a8f8ea798825842"),
-    uint256S("5739f2ba1590c29443e29333c25d56a579990036af512f7360173be8d2715ae0"),
-    uint256S("11e9cf24559aad909ecb1273dba20a0fb5ae727d6d4870203d67bd8528c378e1"),
-    uint256S("93ee3d3db017ef076df33bf33e03056f6fc3e4d289e1d88b6bea3cc1a233ebc4"),
-    uint256S("bb56d6bb55ea3f2a867d888f57402de5dbd1d57c64e13026fb2a9916777f4c06"),
-    uint256S("36d083e29dd1104d8a1597d4c1233b6ae5b428cb4924f8677a170388f05e2bb6"),
-    uint256S("9430d59026007eb878f713bc1e30d6da2e51be3e088952735b26685b4db3f176"),
-    uint256S("ea4bcd854c3b4b6bec01d92a1cb49018e070a511c61d0bc86c4346a422073fbf"),
-    uint256S("d3ce3f3b13a9b1e3ba3931877543690a130bdcc100db730dbda358aa94377a60"),
-    uint256S("b5f17df753d3c28592d92b152bddb4077c3a759479a4b5ce60d5228c34fac199"),
-    uint256S("1351373c6834ccb48919bba3227040d2c6674090059a5c8539001c648c304fec"),
-    uint256S("ea47a57617a0590d7f896fe742facf77747d276bbe1b5719638992cfe4a52bf6"),
-    uint256S("32939dccf550df27c7309c10c357fff9bbd266ec1e23043afd6e5fcc433f6192"),
-    uint256S("ae2b8aa35e8094d6346d2ebca7a480a40297d86e97017c08895e7d7c71a8fdf5"),
-    uint256S("40d4d2421dc2ad00a79366880e75d7c59f7326a2d57426e2e95bdbd9c67b9080"),
-    uint256S("c14eeb0fd6cbf8e5a73ade705a71b9ed925d0224a6bd419da22a22d5e84824dc"),
-    uint256S("201899fb666409c5106f90c036d8efaeb4c00c157a03af33b9a143980c526580"),
-    uint256S("4e81639f8f8d9ca869a97778b2ec40f680181441601dac13264781fa97144b91"),
-    uint256S("26186e3deb30fa23a2de081498c76ba35a5cbc73936d037de4e937b87b6ebb20"),
-    uint256S("33142a9ca012d74472f97c911fc89d8b02aa83109b573afb4481597b52a62a7d"),
-    uint256S("6360fa404fd69b0f24619be1e2675a2da11c91f0e14ba75744f3e17d25fdf382"),
-    uint256S("21b2c693ddfb5569cdcd9d469e6b448585edfbac485bb11ed78e3d16f24e2cc0"),
-    uint256S("052d061a2a013c8abcefbe5944f880cb9daa61097dd337c5c09e3e7d466e4808"),
-    uint256S("5915bf02a983e9dde57b80a15b5f39015c6049b664c72f27b41c3457f8b72a27"),
-    uint256S("13ce32d52877f1f42c79e4c13fb1b6abf32f21edb0e8f19207e857d6027c87d7"),
-    uint256S("e394d03a6a5e51b3c868968f53a3548deb1292387778cb22d290472482922c5b"),
-    uint256S("4326a693c233504314f79685c7b10eb5d9c65bc7c77c80a5d94f7193ee19b397"),
-    uint256S("b434c48f255df85d31b17e90e65dfb25c4b5bacbb19d775138143498939709d0"),
-    uint256S("5f5e00adc357c5cc1fb4a4893160305c7c1b59cc202faf5fdeca4e0612324c84"),
-    uint256S("ea995b512deaccc8ea88803c8a9e996be26dcb6cf0c12c17fc3ea3854c250c8d"),
-    uint256S("6fdafa0c45dc861362b84d15dec612458a7845f0c9323ac2f0d3c69c487847fb"),
-    uint256S("a2c01880bb11231026916569ab42e0eb9d41890be718306d5d69eaac4d2f2e19"),
-    uint256S("883cb0c4412c4d83d3d0349b41e37e589e818656f6cfadb12b885b5499dbe5b6"),
-    uint256S("2ad85c7292397d4015b7a95bd21be997667836172583d9d2f1a11fad3530db5e"),
-    uint256S("7efc99a0a464a28be35fa64e6cbbb80957d144e66a6bb020968bdf1fd02dc388"),
-    uint256S("258e4582d02cb36427c33ecbaf0de8339b16696de493f0a3076f5649160e576d"),
-    uint256S("867fd61e7399b2098c2ae89e2b980721855c28ed616d776eff35da49b1f46939"),
-    uint256S("b6c710e0ad8aec4c9431912db99b32eec4fbf639d0be7034b2cbb26aafd3b144"),
-    uint256S("5318cb97719f78acc3a478f1c8cf2c27cd62f472a647c507e568b1776d866353"),
-    uint256S("bea3bb5ea4707bdb78f13185719612de759c781edb72db47c78a49d45be347c1"),
-    uint256S("62da8c02007746671210157de7f7544b6c8ffc1f26f2c3d14f52c5a6199d877d"),
-    uint256S("59b1624d5da4dd27d4ea98210b64c817d8a94f753170382d5bc55e853f215a8c"),
-    uint256S("7a3b89c1b9d3d00f0c5c0b0d6e66de009e53ab7a896d087ad36da71b63f764ac"),
-    uint256S("d60657f4998a03c0524e102f0f0ada322ad099c09bee7303ae3a55ab8ec1c735"),
-    uint256S("5d20973f8159fd890fc71b3de224f42d303934ceb59d838e01df9b99c72f0da0"),
-    uint256S("09ba68bbe854369ded58efe5780065caeba1adf6bfb9a6c3dc8b0ecf321d3cc6"),
-    uint256S("4dfd9c041afe9fc72e0f9324473741c83b431dd99cd554c9c627e04c4fe678ce"),
-    uint256S("8e5ef0a143f500ba0d2249d6f7913a40e4741d35f5c60806a2d9a4eeecbff0b7"),
-    uint256S("d0b0edecc2754b23378a2deba86fc1567542c0fa01b31719ed7f598b004db77c"),
-    uint256S("a10d921b75fd3082ac887dd1fa5c98bb47b5f027a44c1635bad12889845c487f"),
-    uint256S("64916689020df467fb7f5fec61a24f8d80ae6a0b444e8b517d2b51910afe2513"),
-    uint256S("1d1373005da62a7f31c24f68aaf35b677014ab21633c7ba964c403cf7729f97e"),
-    uint256S("e92e211fc6c86e7c1f847f960a091e175606d23b6d7aed38a72fd374ae606f7e"),
-    uint256S("66544da42480190da7f567dc540d1b0b1f60a4560498698c8e9e9096aa5b48ec"),
-    uint256S("f9f5ae9f5c18bd9da2beb8fc0024074e55c9bec996ff93b6071ee288b81c5e3b"),
-    uint256S("52db0d64d62f259ba8d7467ff0ef6acc8b3f23a7164c2e596396a57455c51e5c"),
-    uint256S("9e7b193868686f5a690025114b818fbf3a1d46676402666660801fc87314cbad"),
-    uint256S("f764671a9cdb1a6d628362ffaaa4c1f3993127cf93338ecce6cc7e379b14836f"),
-    uint256S("63f6c16067b4e7ad5174d9233dc46ee1d59e10777e1c58d18d5bd47b5bdde929"),
-    uint256S("0b167d7c7e379ef518442a0e36d52950a6d1863ebffde276ff571e036ef4e72c"),
-    uint256S("515ee9a1cecc4b0ab73fbf42b5f5ebd109f237fa73b656b5b0e3879a28b9159a"),
-    uint256S("d273f24e1fb42c4865ae8625dedd4f0794ed7a093c946b9497f377390d17efb7"),
-    uint256S("2f5537d2deb2c77fcb9436704614cb66461a07b519ee57b81ed10fb3297f9a2f"),
-    uint256S("38d7ee41bb00365df440d531011437802da05f89c706df6d1ae40a50e927008d"),
-    uint256S("96d528016fc5950086f4765bda9409cd26b7df81a17fef5dba77fa336e3de9f7"),
-    uint256S("ae055fdf8a06a6f58c40f0e202fb0ac590b4ae3997ef327e8f4ce4fa33aeb87f"),
-    uint256S("4eb1f6ee003c81a5c42cd493b2ea08c0d098552a0ffafa31c4dbc3d0840bea99"),
-    uint256S("42b50d6dba054bae814ab83d4498ad9eb8014af0036ed07b4f0f02b55524d54a"),
-    uint256S("f44daf264918aada933b32c273c47d25bfa7df3b99ec9d1b7577ec1f4de5f135"),
-    uint256S("3a8b8a90bcf6f7fbbf4072470996e25b6856404e44ad76f337083e7d7ff23362"),
-    uint256S("29fbc161ea16c09cc33c123363445dc419c874e85c50b6c3257a93f4a2a41254"),
-    uint256S("de95fae0e69a18024ccbfd963ad3e90fa8f1fe41d5dcdbc47108ad068fbec14c"),
-    uint256S("b0582da89f0501e12fb2a33358e91d808b8dc4245ab75f6b562bff0449fb812a"),
-    uint256S("11057e3ca4ffa4a82bf23763793d584b3717eb205ad154edabeadcd72f26d62c"),
-    uint256S("143537b4f748b4c0d29f933fe9818663fc9d5066cf13512748b7eac5987ce150"),
-    uint256S("5f81af77b868e586dd53f390645ab3966358588e2f03b236a5a6001eabeaac16"),
-    uint256S("8a7071083614d3b67bb3cf9b6d531fd3ecbd8aabb4a5fe85e0bbfb61c4ac4a62"),
-    uint256S("859bf02bc0fddbb45922e0c0f8f84de3059c588d0822d9b96d2117f187e3be9a"),
-    uint256S("08705eb71cb40c0dd0ebe28095f286d09b4b5afcd5861824d64f70ef2ecb3c4f"),
-    uint256S("90951c4e0620a7c0a91c379ea9dcbab62e4f5face8e65fd21fc759f4ae3181eb"),
-    uint256S("7f9db14add4b874946b695a514c1acb794f214b5036f99dba80b6fdeed97d771"),
-    uint256S("4f92bfd2b74eada1eadece68e0d48fc69d611144dc378ca197f61a95d363eaff"),
-    uint256S("11fb29f90dd6e5ecd2820bc4708a303c01ee3b53002008c6211a9f39785db645"),
-    uint256S("0f19f77905bd8ba7f15f53552153e0f87a222921ecc0c027580c43ca1128ab33"),
-    uint256S("f128f2de7c744738ddd4c057ae2b2ac6d1ceb87b1453e7cc496161378028ede3"),
-    uint256S("bce7eae397360531add3199b1c43abfb494ac9943711983d7d397aa7a9e368d7"),
-    uint256S("d5c0ae171ca8419e6cf8407e910ff2915ddedafe3ca8e919f5e2af194839f1d5"),
-    uint256S("cd835bdb131eb088abccf217a0440fdd20e976f577cf5a51e9705b54a3013d0d"),
-    uint256S("07255a2268d2f539c13791d033bb303ab9fcb3fd54810423c4d8c0569ae223aa"),
-    uint256S("2f8a63fad7ccb3cc853df345fcac9b7246387c5e17d2caccfc727e4475ae8691"),
-    uint256S("fd583ca51085a3c6a6ecaa3d663c0cc8b24d3388da67c390def870d50108bb2a"),
-    uint256S("650275bccbdb414b88b539835b4d01212b244a1f2befb897f9273411e2f820d0"),
-    uint256S("541ce3f8fcb6aea85afd419b0d75209ee972f4b542f813f891cc12e97b520ea6"),
-    uint256S("960c7982568543e9e53ca95a4c628cbaa7bbb8577f5322615c6941af8062adf8"),
-    uint256S("b40ddc38f1ea16ded61aa940c12625e05cff36b6f2bbb986feb0951bdf4a43eb"),
-    uint256S("18e440e38401e03e50237e0dd28327fa3f415177c31634e9c6f4945deaa51788"),
-    uint256S("847f2cd4b2ced6c2d46eb72eaf020fce12dd39834d1e81b5f4b41114adeadcc7"),
-    uint256S("0abd1f4bb947154f9c78bf39a3c151f1c793ece47e3869673c61d303c587292d"),
-    uint256S("41a4c7918d181504375b96695db3bcb96a899c1aa0bc6d7cadf8daa0dccd5c53"),
-    uint256S("e00d1ccc8e0ed4afea458197263c11c7fbca81a012abb9ff24b8bff1d8d2854d"),
-    uint256S("6f4351ed586e3284d2c796681aa8140567c17996d59c0f2080f00a900d28fe47"),
-    uint256S("f205bd88ccdabbb5ce92729683cf948455eb2c2c62966bee336679e19c5ae1ab"),
-    uint256S("3970b61be0fe8f43859b5136c3713d878a077908437bdbbadd4dda913c6adec4"),
-    uint256S("2cc34e495fe48f1af77c28902d76e6de2f53c7e3b984ff5f06063d0d46d9327e"),
-    uint256S("548e0087bd1161ba05ada13165e5bdebf15639ff1688e40d74d2da97272986d5"),
-    uint256S("47170866f84d2e7eebed561abf75a71b86925d112360692983ccfd19c756dd0e"),
-    uint256S("83335a87e1904862c427f13dfa21a4ca4818306c30d5c1b960744006291fc1a4"),
-    uint256S("2a1d2c778f582666512bc0f1ae76539c9859d6d18273ea1372c45bb92773773d"),
-    uint256S("0bb9c970a05f11021e1ad19574a12ab001ccb7d74acf5049fec12dca4d246ba3"),
-    uint256S("763988a65729e33ce0ec0f246d390c305a2bb2c6a4f14218bb9980d7ad050eaf"),
-    uint256S("8d737074952f056aaf5754e723e8a402c952ca2f55cc3914e98c16c9ec6ba7c5"),
-    uint256S("d9da3401efadece6f2897480019392e0899292788fbaedbee9f8fc331ea9513f"),
-    uint256S("b4f98b3af9856b3f2a32b5c6877c5d5e55c43fb8300699ac0adcee7bcf33a473"),
-    uint256S("994dabc41002868c99dcaa9d7de86ba0e18296d6785e22b8bdd08076eedfc17e"),
-    uint256S("9f15413e8ab5759cb285356edd9f5f22b0b971ac5d8c21ee8d1586da0e43ddf7"),
-    uint256S("412cca8c5c52589517d76a38a4f62a1cee11a0ef11b20878bafd71afb94a0619"),
-    uint256S("3d621174054962ae818c62bd75d588720eeabe1933bea2fef5f8a4dee59ce517"),
-    uint256S("0489794a4220f125debc476392cdc695bd1cd024e6877a199a497de05f71aa5c"),
-    uint256S("92952091af7196d48b0c0e595d94d6af21fe93bb6f8eeae94132661fa9a08870"),
-    uint256S("74b4c63c2de738fd7d8bf514faa20fe6e9146f3581828c3d062331061addd9f5"),
-    uint256S("052b6ad4c492a5f4b43bc297d47ccaf97003df2f62b8aa037f0246a4f1b0d693"),
-    uint256S("6b0cd3d95ff65bdda4a2ed6c5a787e6317e77d20ce5b1c47e392017c3f0e5c94"),
-    uint256S("be3a2bac18a41222d32d9efeae26e284cb5e478aa4d05a57ed89d8bed30f7a96"),
-    uint256S("d9efe21a9864f1df26509a8855e9adb0b71c5705547c87badfc857765783d7c7"),
-    uint256S("8bdaf2af51d7e51898c1a93a69ba206acc26634389f9798e7d5f9989184bedb0"),
-    uint256S("79eb52b5d5287faadf11b72323c72112556520ce62bab00b274d0c69053d1c17"),
-    uint256S("4f1558cb64fe6980e3b77a835d6a00d9ee827da010254c5f629486e76459fa08"),
-    uint256S("698dab219f6ed1c1d7bd018eb1741be6aa71fd55fe35c9dc1c6e4831102a5f81"),
-    uint256S("1d9cf5592a23f3c5d60215e24171c9b5fe5d73f7c94396a078235c9010762707"),
-    uint256S("dfe18db81df6f1f0f5b2c109a7ab71de6f06e77a010e9d369ddd5fdea0e9f5ec"),
-    uint256S("f16706f77f543fcb26266b8bc68f4e1808de3508d28e238c8726d243dc96b0a6"),
-    uint256S("4d3c727ad97dc47bb23cb346c77c6d171862e9649a9d681d4a14b860df03cca9"),
-    uint256S("8aca271fd2b75dabd9e1bf7ce74a0ea25b4abed9f039a1353d986ad5ad4b470c"),
-    uint256S("43fec8825cdd3aab68e75bc20ee345a6f0ca63d6a13cf2764bd9be0c7b4304bb"),
-    uint256S("7802d49842d155f52c374fc7d88eba6287d0e1de0cacbb5a47a67fe7316e7992"),
-    uint256S("dc5459e8f2ecaefedf1e4a3e0468b16be1a6747e84d93517c40728e856807f5a"),
-    uint256S("e9e77d64b7698a7dad24f02f8494bcc0fbe47d10c73716ec4442f7198a8829f8"),
-    uint256S("63c9f3a6b326ab7479fa1f5bdbf6eeb7f8fd9f629bf8f74829aed109c7b452da"),
-    uint256S("293b29d10e3988abcbf9a10ee9d559a67b0da9b1f54e13c4f087ceb3341d62cb"),
-    uint256S("a2c66b99927f838659b34671f6038c5b3dc2bad0c3d2c5d8752d856f483709dd"),
-    uint256S("29a065266c604786397a9c6dde9fdeb98f7d269cc1dd8328b770f8306831ef13"),
-    uint256S("e7a70b434856327affd65c039053de8fa19f800bb16fc73086a6b9d2976f1617"),
-    uint256S("8258069aaa9067bb59e59285f53a6d59ecbc92b7dea040a0c1d633cf82cf5a71"),
-    uint256S("791d9ffe3d017c030033723d3df3715b4f15cd1e597a9b0fdfadba157691d1e9"),
-    uint256S("8bfca3081e04058cea6495fa2b47f07d5b658b993e1fbc5d4a5e10fab00858a8"),
-    uint256S("c17fb70536e8186a27ac60fb316ff675c303b9166394de2d8902badf07575974"),
-    uint256S("ede85333561aed003365ad8b57174ceef9a4b0de25c28d37f9034b37f697e07c"),
-    uint256S("0c3a3de336415e773d4a8d583e53d3eb07673472c80cc2d89d3f2446610818ae"),
-    uint256S("5d8ec12f688be77490717c740def5de284256a48ca8f34226e7621cbee272942"),
-    uint256S("652a62a7b2ffb3746a6fca3aef4d9d42b8973304ebdb5540c6cb542e48610e32"),
-    uint256S("bcb8d33c4d5800ee02204c0e5f77d99ead9e93fb2d489a185c73ce824fe6b9b1"),
-    uint256S("c8506fcd09617920aa5d2119915a30e8cc6af7a4796a7bdd877718e9d305b21e"),
-    uint256S("eccb5a564c70cb85f91a811c662e7afffef0d3d5dc4886b06517997057b0a60f"),
-    uint256S("fa5985a05a4b5ec8f1db752d817d333e5f3448389655957366870de9478bb122"),
-    uint256S("6b2f1b4f95fe78ce711c5bce9d7c447c8d7dc8929ff2a00a283af1b379615afd"),
-    uint256S("e7a87b10cc8bfcbc7a8e2530be3bf2dc23246d1e29d514049ebe87af59ea5e71"),
-    uint256S("4f643981bb2c282fd43372aad1b4f6fbda6338a457ae4b6bff5525674a3db850"),
-    uint256S("93ddb72140e1f83d960d995ebcdf1f93aff6365dabd3bdb358c1a27e60817475"),
-    uint256S("349d509d5f998f74260da45248b1b5ebb3700c4bb8c49d4f740dc26f5ce9ec70"),
-    uint256S("e8ce42aac8d587beba0e3d0d715f9a2fb6ca230fc67c040902b58eb106d19f6c"),
-    uint256S("8539d1fad9d43f56fbe2d9953b86c84d34fcb4ec75545336187d63971a100b93"),
-    uint256S("051f5d718b36458786fc0203f9faa1ed3d18ed7d7cd70bb088055208b42f2d0c"),
-    uint256S("bd10d7c3a56b7a3131c47129fb697fbbedaee3e5cc22d5730d82d75620cdb59f"),
-    uint256S("e8454e8bbb495307bbefe2ee5b4ce837c32892469011aeb2c09933ee8c4ebba5"),
-    uint256S("f34fbe2616ebb67d9452b8de2b3a635f8ac8f901f27f0e78f90ad67cd717d01c"),
-    uint256S("efc6743d0ddf8df7f5d82fb10ce827a2286379cf44323439c74b79279a73b320"),
-    uint256S("04474dd6072bd04aae93d1d4c7ca5fed2fcbd32b482edddc8f1f8b530d123471"),
-    uint256S("7b8319a3a81de3081c2210a44816533443e9ee02c5b69f2de358a1d51b126677"),
-    uint256S("ea736551ceb0ab959f62073af46b7efbb71871870c1ffb46c6e7e1f5a83e0866"),
-    uint256S("5c41de8782b511601d05c8b74d3730e89487981e383a33b21c946319385a5013"),
-    uint256S("d4074d3d8942dc0608d72c13579bdb22c44592d65889967f6beff27ffb0feefb"),
-    uint256S("9fa87fbb043ecb0fda6e2eb29a09acd6f59d23aa71a3ca75cfefef2a74680a12"),
-    uint256S("aeb726404152cb54a5ec565605243d962cc74e2fc7c4300ac3b7a2070daf4e02"),
-    uint256S("f421b7794c933d42d0f621110fdf83e6cecb9e0daf6115a1353067656bf00154"),
-    uint256S("07f83954f3e320c16853a0039e55ae0af6a566ca328c78c4e55b0466f6b1da3f"),
-    uint256S("8326ba7e223929e3494ba36d0b45f79d2a056ec8ffcb3b18235aa269b6937cbe"),
-    uint256S("8349d852751cf80d817605bdd027ef46f2bac875e126043170c9235aaf4db977"),
-    uint256S("68514f3992de250fc3c80b5a670f584ce90f0415ebec9ff55f3a37b836ae9246"),
-    uint256S("80a4f83a03611111778b4c8648c5553347788814aecaf4adb7874ac93e9f256d"),
-    uint256S("947558fcf4553192be6e8c27c4645a8356435e4abaae5c4c89884896ed865d00"),
-    uint256S("51b1ff42d361c233710dbe4f048dcf51a51ed250a9355366cf869a8aef492c19"),
-    uint256S("c980317da408647218bc2b160f4c539c9f8df29c98170872905b80f3857a4677"),
-    uint256S("4b05dccc682fbe5906da089a966fb922db0deb6ce84dcf6ff8cb3eb625682ef6"),
-    uint256S("21f94da4b0825c3243bc91204b8a6e37633345d01b4fa90c50269c456237e575"),
-    uint256S("4101797c673bfb172706fa4bf255c7a174b1dd2aa56e010d0c61b19b382786bf"),
-    uint256S("c2b5dd210196e1ef8f820f0ce5c017cd297580d3675fd76669f0b939aaeef119"),
-    uint256S("a5d62cd073cf491c4f3634b9eaef7fe116494c86216f693173b1e2aa4894f252"),
-    uint256S("cd5e5d5fd4de27c89de257292871f5a26caaa9afce10662dd1d93db13258b9f1"),
-    uint256S("0c7384b1de8a7c8ef513fdc8e94671eab49b51b949ce1f7ac2bb8f1d81782590"),
-    uint256S("0694086febb0a77ed5596c294174d4962b53a83d5aa71396966fe8efaebcaa9d"),
-    uint256S("a9bc81dec122ecb9de649ffd057eb949aef9f98fa3c5609565474d22d85c1184"),
-    uint256S("7e9b2ba252adaf9a8da9b1fc90954047745490327ad7d83c5f03ae1579196d8b"),
-    uint256S("aef4cea6053f392f4f1503d1febe5d7de5993a1ea0ac12f0f65f06ed47223a1a"),
-    uint256S("7a8159456d3a4afbc28e4ceeea4482c94e112f413ec7ed05f65fc89d999e3a20"),
-    uint256S("58a8736de3bfb35e59325648bb2b468a1afa4f47e25da3f6acc96bdf7d35fc4a"),
-    uint256S("ee9ff5c1cb28a8c058dc5dfd50985da0f381bdc47a0473d3d23a41bdc75b3d59"),
-    uint256S("fc342e353e05e9ddf2b41e4716fb1443561c54c05b2efa7394a3a21577536821"),
-    uint256S("b989308d1536863d9db45ac8e42878d43abc5b7df4277d8764319d968ef10423"),
-    uint256S("01686e731bb4c747f6ee2ef3264637abe0849a7caf3f158c102777a23eb3b27a"),
-    uint256S("2a8f703505c91c3acdd00d701ba980d2d369e367b7301752375a26902f74c817"),
-    uint256S("4a4ab8b34b98a3ccf8a2fcdb1ae3f7212f87f045c01f2b1d445d40db73e37fa3"),
-    uint256S("30d37ae70b926aa9131226a722abb65903048b4eaecd1d618bdbabe7a05ac057"),
-    uint256S("c7a14721c158294649166e1c03c1f76e9e4d3d751e9fedbb459c25e702a103ce"),
-    uint256S("cf2cc52a18c025b686974063811839d96fe6e11a2ac4599f8c7e799812aaae9e"),
-    uint256S("099f3997853b0edc8723c677ba65d5dec6e5c1d1a5438b6ee0ba469508690f75"),
-    uint256S("6f2eeb8ea95fa28412c701c3cd2caf40b56c000914fd866dac00a552a01504e0"),
-    uint256S("dfbd41d6445ddc7f03cec7973064c5cf192b3893e35761af99a8914ba03a2a6c"),
-    uint256S("3a97f80b0aa43f0776d6b5e26b9be7631a7b610cf3adc9b363c057abcda3f319"),
-    uint256S("0bedc097989e43e848f709bc52a2641e3474aaa5013252886c983e5ab284577c"),
-    uint256S("4ee09e069b8d7f4c904e025571bf98bc402483a12a35dcd2e66d3a0ac0cd7200"),
-    uint256S("cd7d09a20a77bfc6796285e8249d96a4a1261186bd4d9d8601baa4657459b03d"),
-    uint256S("2b3015fba0afd90bf642c824e711707399b24d125dbddab404cb7524dcd5ff19"),
-    uint256S("a79e92fa7e0fd60f2daf1de5f5ac9191533079d44aa676b4010ab64aa5ae0abd"),
-    uint256S("5fd3ada4947e48a8f49eab4319379b115a2ece07d15e3f18d7bc6a5b54fa893c"),
-    uint256S("b3bfe06acdfeed6195d634e5c919ddbda471c23cf3e86f76ecbb050e502b209a"),
-    uint256S("868db22ba9d38c292397c85ec3f28fde1d7bf70119227974a0fa886f75fb3834"),
-    uint256S("e4b271df75c9c2b94e01ff6e7a58454ba2aca88bb4431e0445954c165ba97350"),
-    uint256S("cda012761d9ea46f666f5040645bc39fee1e38700da30cf27bcddade5afaad02"),
-    uint256S("541064023a30564b1290fcb4fcf8b22594d47006b8445b32f33bcc51b4c02ca6"),
-    uint256S("f48fb16798184cd8209fd58ddb485448312a682b2a4b27db494222030074c0b6"),
-    uint256S("2b5a86f340c30bf7f5c415d2049f4766ad843a76d3059cc9fbd21f31a0e1770d"),
-    uint256S("064a7bdcc2e51c305288cc6de2374527e2cc44325ec7008aa7d28dd1c054eec2"),
-    uint256S("1fc7df27e0ed6b977af7417ecb4f39225e5e4b4ba9330767d4ff86eee23706f3"),
-    uint256S("57dd80921167cca4085b0b368e2efc47aa958064c7c22a8b2bbe8e82e24aae31"),
-    uint256S("ac8406e43e32a1bb95f9875a59a5fa114ac2787bbf05ea6597cf60694e2e9863"),
-    uint256S("ef97cb159f44b3b69174978f478a613d1692fa421fd663753c85eb3f9780b0fc"),
-    uint256S("28d0d43e7a51f4c796d884169afe06fd6a6eef9c40de67bccbbc9352044757ee"),
-    uint256S("ff1d6b445ad5b8e8074b8fbfd8bd567c76b56a38064d5dcae2768de6bdbb8072"),
-    uint256S("005749018b49ead72092011d19791cd1e060e87ca366c8df7100b18818e7de6b"),
-    uint256S("57b96a6c41b09d963f529760f6186dd2de373c538947e1ddf5cbc809b57415a9"),
-    uint256S("c938ddf4e79af5f4d9285f2bc013dfa34e382354c0247b43743a326fffc2fa41"),
-    uint256S("b769338e4c495dd909a7eb7da084ff10d35a741d7c80067f8f2c581212fd22ea"),
-    uint256S("0285de4f742ebf3a31fd2b9a767ce38ba3cfe1143f9cb4b7d48ad1292633dea1"),
-    uint256S("39c3a11afd385172be7fd6d57d0277bdca9f29c5ef9b75c0b93b5261df3b0bb4"),
-    uint256S("3028f5049ab85177e0f9999c4d344a3e6904cadb67bd04c7329ed3dffce3ab47"),
-    uint256S("8e1b24f5b370ec8457d7935fb4c690966166cb00bdd489d2ab4abd36aeda2adf"),
-    uint256S("2aa7ae6266df201c06bcd450d38c3e01903147c1527eb90f72213cf76dd6d7c0"),
-    uint256S("43d519a4ef68375f93b37cee15ada050ec710517efcfafe9cba85a173147de71"),
-    uint256S("232cecfc246ca95ef82c61bf0cda578cfc25e770d034d684e7a8720872400533"),
-    uint256S("80d4d725992f7a42980f39bdc8b7c7685bc0e8305dcbd0ea57cec1915cc8e356"),
-    uint256S("c20e42c6aa09d6a0296fae6f955d9e6fe7498178ae53725bd4d45774bdcd6d8e"),
-    uint256S("dc9ffacc9addf3e213332023308352b5d44764685c128ddee3c10401ec97a104"),
-    uint256S("720d82ed718c9c0f921c3e60317694fe90efc29df9de66393883c32606ffb34e"),
-    uint256S("6e7baa95cacb3655763b99f312e3d7705f67bb3747d03998f04a07b3e645fad1"),
-    uint256S("540a2db057350e0ab3d6b845776faef457ae6b856f29b980791524261d2cc3de"),
-    uint256S("02d452e03869054fbb49986e5943b249255fd2f7c556b18dd8e7ff52e00eb4ac"),
-    uint256S("48cea1eac52627d4f55de9dab8b36a2b482922c33424b32de1fae04d5d0c0ebd"),
-    uint256S("2bf3ab4aeefde73d0219eca30c871a8bd009f34d466f107bb6d3b14e26dd6f7c"),
-    uint256S("60325b7869f88e6c141b0cbb20e4e44f3af43de6ded80ae950e83f3b425b8bff"),
-    uint256S("afc8780fb693b811bf4def3af0068643cefee9a0426d043c4847c072fe8237cc"),
-    uint256S("c076b9bc74d41380e974368f8e9f5cedec650b7a34d05cb1403eae299006b36b"),
-    uint256S("3c0635d5deda7fd11f616728ce1f1300ad2afbd5c571021c8d8fd74aea072f1b"),
-    uint256S("01ad0d6fa3c9f9e682dd9ec11656f2a0010cebdb21222c06343c0dc87bdec78f"),
-    uint256S("e0fcdb84a3d9c941ca5c1944b90b4da6d667070e0754fb8cbaf8205a9c91d567"),
-    uint256S("b97fafb677f13099f6aeff36293b374de69760e9e72ebcb97f61520a6c4f4b1e"),
-    uint256S("b19d41b2876b1b84fe8d2d7c07b8af3d5184b73a2a5b0800f44d12727ea2e1ad"),
-    uint256S("2d6b5a32a6e23eb9615cf856352f26aac55bc758a0318f3d8223a4f99aa8f3ab"),
-    uint256S("cbf4831c8e75ee970300a4d4c7c2d87b788290011b823e6c846cd6076b2c93ab"),
-    uint256S("918daf944ec0ad804e167c304061adc71a8b4817d17ea3043d42856c6e48685d"),
-    uint256S("2a8dc956a1657e771d5f87ccede4e5b74292c77dc83bb9aec0f8e835ae103406"),
-    uint256S("63f578a4796d36a49b00da5970fa85c6b2dc260a9da766e34615e83d9ea79ac2"),
-    uint256S("06bdc5b0928429e347ca124635306dd39eb56c313062fc5cd2b152c558a8849c"),
-    uint256S("94920420cb451b348ae5a0688eaf4f20017a74fbf533bddc6c11d1b9aa604dca"),
-    uint256S("d8eaf385489a10740ad12007936e881f934f95aff34a6f8735e13a1b2cee4b64"),
-    uint256S("4242c8405130ac18d4d2649cc0b10e5cbe7b9e8e6a50bff94ec75530704ade27"),
-    uint256S("e1a00654d2353cafb43c775a8624bbc4fab9f695a2c097fc8c5de50cf08f462c"),
-    uint256S("67f912ff83baf22540896930a8a83ba625604096f21e03a1c641dd9f87a3f041"),
-    uint256S("27a20c9db91ab006f5d02a255be5af843aa8180eb0a17078089e0d30d8230afd"),
-    uint256S("32a673eeacf6a233001cf1c2d9cf1b26457a61863c2b5d52df701fd4f80c1be5"),
-    uint256S("db928a47a72f274536a4b57c322abe94fb479e0e67e04cc02701dd81c492db91"),
-    uint256S("94f74b89e21f073b53234b506c20265282bdb89f70413607cbe2b61c74b338bc"),
-    uint256S("4e0bb2857774b55fed8c75ef91cd56e9dbb0b13e7a25660739e420645f364cff"),
-    uint256S("63fefbf04aed6bbbc43fd7e94787a6045dc47cb9fbb0f109c36c268469dabfc2"),
-    uint256S("f1d5daa0fce126ca0af2ad5dfb227b3f26ffde13b67e5e93b5a340c5beb662cb"),
-    uint256S("6af250b1e1b02a7080f26fc3251643e27ad11db42f3244171b275ba70c615da5"),
-    uint256S("96818f30d9b235e68b28c316cf7029dbf20c2e0d16f2debe110caebb4a225034"),
-    uint256S("1ef753580ccf5d00cb9e35d8c6b333531ce33050ddcd568ef27cad26f8d4cb4a"),
-    uint256S("3c4ee58a40efa680199a196676a4dc25fa4e247c47e6a2db59d63baee82e8e37"),
-    uint256S("8afa62ce39e13dc55560863f18b78ca39410af1f3678f2065086b2fccc3f32da"),
-    uint256S("d954ec73765bd2a27e892d4f85f88ac89c79f19b7f8dfbf5f258e3868da91c67"),
-    uint256S("7aa606209ff6509146292387992916c2c6ac8fe4a03a76db276b1fe1bdd7928b"),
-    uint256S("70e7a43ca58ae006d09a7eb73462e64fd8bd82067d886e5a8239bdc104ddda51"),
-    uint256S("b1a6024c016549dbe652dd0688a5afacfe3141104b08f458856f266ed4fb5d78"),
-    uint256S("a39c48de6cb7779ef92aec3af8883cfa81d6eae519f105f38e6c0fbb73824df2"),
-    uint256S("bee0e92a472f919e19ec4e908336362356694d4abdd106783aacd057c2b4b8e9"),
-    uint256S("97bdd087b96931caa4ea41f61d290963c804e1d8430debdac12429c679cf9f81"),
-    uint256S("9d88f67809688dafb0362304fc26b2689dcc57babaabb7c203f74cc815fc5fa5"),
-    uint256S("99db87854457af324e0211dfe6f97ba87604bcda35a6fa10c0287405abab5765"),
-    uint256S("654393b48581c41b34fea804b860605ce6114fa32a25d29ad8ec0ba9e032b89c"),
-    uint256S("40342a8a63ef86fd2573c422d00564ea29aace4553784c54b1fd4e39ab4bdecb"),
-    uint256S("5b179e83b7d0f712a68c4cf0b86595a20aa9dbebaa24c98d499ad2ac29b7fd16"),
-    uint256S("1fa92a284027b4b4c495c3d4fd3f41a14dc43d5b71a4b62fa38870f3b05a6f4f"),
-    uint256S("d889ca1ef68c9517303a034feb79a92b48f7ce4e1a50640aa20a0931047f4ca4"),
-    uint256S("481dfb6a696f2080026b5218bfb0ccfc7a432705e2c960f65a37df3e01c11d6e"),
-    uint256S("79e80e8d59616456c540f438ce4d5cdada0137b56858172f718c278270c50395"),
-    uint256S("dd319175de2ad36b7aabd9caf1f82e2bc78c41e7578de8dfd7b3c83eefcf2cd2"),
-    uint256S("b010df1d0ec472dedfccd4e55eeddf8ae7db2b63530b8860e98bc5e7a5f27afb"),
-    uint256S("f9a9fa28e2b655611abd82385150c3ea4c3fbe6e6afc90898afc6ef0372c8df2"),
-    uint256S("b4797c4e9bb26448c47d02d51c3adfe38f3346a9c252335240aa7ec5da5e9445"),
-    uint256S("8b4d8babfbcf7382e4c5e9fdc5822eba0059308765fb1a7441a8079fc476fd4b"),
-    uint256S("fe4ca8118469dee2e99bd55809740819330d90f9f891912057938e79de6702fb"),
-    uint256S("7790a739444eabc45138d38e5f37f8df56895779e17f84bfbccdd2dea1ca0e1a"),
-    uint256S("b2e76b114c737178d87265dea7d877374bbd51ded63bb6777c9d8f97a8a62e79"),
-    uint256S("752863ca41e6258f639a1f7b994a2f6790d5297d559f7699414e81fb7bcddd34"),
-    uint256S("18565a967435451d5de0ffd1c200cecacdf031d9bc30c26ea144694cd75f8e1f"),
-    uint256S("4ed0264773054356dc69a5d310c5cfce7bb794441ba9b7644f2af3801248fbb2"),
-    uint256S("d1099f2e68ec85718ad5b8afa0e967a375000fe811de0309b7293949512bb340"),
-    uint256S("9cb72f1dc8676d0df54a67bb2dd746cfbe2a4ba809a8f4d99449011d76c6ed39"),
-    uint256S("8a6e138ec34cef03436421271485f1ffa50f2316272a013bf5b6f8a8cec19832"),
-    uint256S("237cccc6b57af48f3d165b542e3afb0f97bc7882772d296190e7c128dd813cbf"),
-    uint256S("3238f2a7086966f19562fdd7df69c8f784da232d7ae120b844d687f814677727"),
-    uint256S("10747694c96f6cd469c22adbdd79a7bb484eb4321e3088b7ab83dd44261c0908"),
-    uint256S("11b10be7297450afbcc0a3a684184aeab9155c84574711dd8cee009b629bc28b"),
-    uint256S("d5e904942fcc73cd1a2251ba268341bee002355a7277486923c9165b191f5ec7"),
-    uint256S("986411302eadab035718d661aa6c735948bce8d68f4f0783eaf6825b4d9f46c9"),
-    uint256S("8ef464c0065df3df1f1c9388fdab4d73be35708d6f54b19523b911ac85bc025b"),
-    uint256S("0f9a0c404c830657db083279e70fccd987e8762b980ba48f8f5b0f50314fe852"),
-    uint256S("df46c115235e8898f2e2358ac51feac4f2b7b3fc916c27540c1d272f20e804db"),
-    uint256S("8edec2f372270ffdadb985276fb547b4c78a2b872356df647dddcb457d6e2d25"),
-    uint256S("65d2b6986b23cf1d6db4ab3a16cf50748c3dac4be30fcea996357d0911a1a67c"),
-    uint256S("8b59c0f4fbf2f3141abd484e2a81d9b207a5440ec38d20c6ef8477be6808af42"),
-    uint256S("a1c8b2d9fd079e1711590675e96815132ce5a622a0a9b07db48ad5cd9ed69dea"),
-    uint256S("5c43e48d54e6fc05775663dcba4e0177cfef5afd842282431bc4e3a09dd7b780"),
-    uint256S("9d1f4a378f3798cc8a69fb2241e71b04ed2776ca6434ae824045f7c377011a43"),
-    uint256S("9838fb1fecb428eafb603868da1b0f1f508bcf5bfe27e2a0d39745537a6fa4f9"),
-    uint256S("303e47742dceb32cdea5518a341d75e95e91272ef30f6c5d764452254b591cba"),
-    uint256S("e542d90bd41c9b6249722d45c14f54bf47c95db03c0c9f0e3450fb094cc3d63d"),
-    uint256S("76cb23179f875b2c763d6527790c40058c0d29e734fd94ec656f3cc7dcd20ce8"),
-    uint256S("9c90ae48f4d5cce2c2d8a64a533fa3c59f3cec96f0feb0145e224a430d7eff5c"),
-    uint256S("db7f342f30d00a561706cb76ff7b83e5b829e0ca4c1e71fe84ab7270834a7fcf"),
-    uint256S("5238c4455a21303517a5806969123188f5c090a3f751c9d4c3d12f86900f4700"),
-    uint256S("6d01c83bc6dca330c9df36dc23224f5c51fef807eaa1b2502f8d314d10502639"),
-    uint256S("c00c1bb66bd1d35b53c5c784cbc41708a0db3bfa6463466c6572372c3adde603"),
-    uint256S("b06a9e1f02f54f1badf1f2ed580f44a49bc75001326ae2e052d58effc5690607"),
-    uint256S("25365b9d1c9723eac42a47e0d567b22e82865f1a008aa8ae3669af90c72e8382"),
-    uint256S("d2b37cc1666547f482351ab4e3a885218620b9ee2289acc488224ab9cd92e5ec"),
-    uint256S("9a41e8a91368140b28eb6773518a7310e98887314f62dc733f7c1a82f0a6cb1e"),
-    uint256S("f9d0535631531461caccc2c9ca35d6946de92baa74c3e21222ad404b2024cfef"),
-    uint256S("620c2774854277721f41189244eb6d8884777cfc3db1ec8c9f8fda38128b14da"),
-    uint256S("9e97b6e9a7e011b1b6bf78cfdd3302834a1bf96ecbc38d706c2d74f99070fae0"),
-    uint256S("010e40b69bb394b8552146d0c89b989a410dfe5f80a7653e75087f53302f3980"),
-    uint256S("5ab32cfd7e3de67946f53173681cb5e463c713243da8144eaebe0bf845a79d9c"),
-    uint256S("a8c8e1cb7f574d1c6157c1c82dd300914e9e36acc655876273e1c9df5b2a405c"),
-    uint256S("e8204ccb0300efa2d6e121c8d4e450aa6b01b6c8d6b4e9339cf13a6731fdd461"),
-    uint256S("79a7a9f605035514eadfa27929661b581fd60be6a23167395c9788ad7125f1b1"),
-    uint256S("3bce22d40db6e6f9f534b5b77c3a1be6ebcb256fa19241857b03b2e921787250"),
-    uint256S("aea0261d3f68cf0b2f0cad9cc71c427ca7814274d602c9676c397e4d6be3de13"),
-    uint256S("cc73637ad0e22b3b3585ca50243081084a5f3517cfc222852e9fc76a8e26b1bf"),
-    uint256S("773c4552c7f5333f2e29bab27f6c407ae6d0e289d5a76cb42472ac840e1b7bdd"),
-    uint256S("b56cd77ba15ec85f04497ab1419171c0b9f246ca333da2150b7c53f9e3c9b210"),
-    uint256S("68189f1851e66427426f920fc877a4285ba04ac92420fae143535bd5b53447c0"),
-    uint256S("186283d8a8a7fce70343572230dc4d3d3d6cbcad82213d379ac5ce8be5003b9d"),
-    uint256S("06ce0432f50c5a0e092170af29b16bafd6eeda0723a5e63095d2a0796fd8351c"),
-    uint256S("f0c2299b2bb601e8063c20ffdc82726b057d34735f64d39e59f43d7aecfa97ea"),
-    uint256S("a7861692be8e0bc46784cd5430a485d669bc6da8dfae7dc6e472a1f082a21e2a"),
-    uint256S("144c34f373c93cbddaf383f9254eea2dda482b15ab2b488cd9006c065ccbfcb7"),
-    uint256S("168897a46d91b522ab6722ba26e8ced9ce36576c5e2b7e03a076166e381be9d9"),
-    uint256S("bcb9c1de4b0cbdef96a5bd669bae48932caec514fdfa6ffdf26aeb296e1eb2a2"),
-    uint256S("544b6b1c6b59ededb7dce041fe89977966b813cf0d3a9d920313fc1673f77509"),
-    uint256S("b72cbbf92c2058e8b2e6bed13e8e4a1e9e390f240697c2938db1c58ee03dad75"),
-    uint256S("cf78ee9c9b0521a2670f2bb624c97567dfc4469ec31a8152e550c4a62cf23327"),
-    uint256S("172a0658381ff5cd61a5cb8e386f30c8d4b9d8271a1617fa454dd476995795db"),
-    uint256S("f40e1d415f4a06d636f599b117eab1f78491fda01c22b4c58d74ba763fcc9967"),
-    uint256S("345dcb2ffea170377dffb69fcb1fc1b5610f445fee383f5cf034799ac3e072a6"),
-    uint256S("b324355a3636e3856354f97c5be781d00c3826284f72afd7cf04b7f370102109"),
-    uint256S("c297df4e9a3a99b326036a19390ec46a58a516a0876103359e7825902f57c5f2"),
-    uint256S("e38443201e62cb574f3397836fcd9da97ec025b546409bbff0ee2081d0951db7"),
-    uint256S("6a100940987e0f82dc697d52c5959c45a643ff70ad0c42dc4058ebbc8b6ff6d3"),
-    uint256S("2ac6060313e3f6191a9af3190de43073e6c7c875dba06a12dda4bef99d15ab4c"),
-    uint256S("d17e46cb8adbc8134005e8f61b4a71f1e8832096cb8d677973f25b89447822b5"),
-    uint256S("e9035322640d48d2cfdfb9199e1064f92d2da340da305a985b896ea7b3e2e37b"),
-    uint256S("abb6052674cfa72ba3ad05bfa9977ad06a581489d18a587ea047a0cfc1b678fb"),
-    uint256S("ad0dcac6db656d7d875b0ec71d1205dfbce81270bfa01483328d372bdff64c2a"),
-    uint256S("20198f11b653d62ccfb0d6c41a0cc72da0efd10846d63a175804598147f8bd1d"),
-    uint256S("dd51bf6682526fa115c64634ff5553f274e3ecec7be49e6aef4ce08afba7df62"),
-    uint256S("b1305235b89d41c123c247b90354c5dd04b0b25dde66d030a5a33fb69c5e71a8"),
-    uint256S("9ac8e8218f2dbbbd1748443002cf9ad3c481c1f36ffd2427e3763be168a32799"),
-    uint256S("fad7be4b8fe0a26f5898dda03b6a60085b54bc5124536a429b39702cc8eb787b"),
-    uint256S("af18893a1a9240a1f1c4c0aca5ec89951f8b65825e8d2b566024a40df8ea28b2"),
-    uint256S("d02ce7d3d07d6869c24065937833cffb1a7be3fb390a26f1cc35cc69258bd5e3"),
-    uint256S("8c1dae80a980b58a6936f2ef7dbe6898e061bc7220605996990ef3a596482ad3"),
-    uint256S("fae874b4ce3ce46aae80f7630ad9ab9ba317df82b691e6e21cad1230ca3152d4"),
-    uint256S("dbe6f7c497228cbc1588e9883fa734595764d72b80cae2bee25db8b25acc73d6"),
-    uint256S("c365cc2207f9e5f9db8e00d75d5fc815731be1f575584d94bcbdbeceb8525013"),
-    uint256S("d279d7b37b88afc812eef157b9d094117a8ab406771bd51f15b0cc0ac1241c09"),
-    uint256S("6ad7cc88c83b0eb0d07206ac905ecbbd5f9fd9d0f7698bc75c786846e7edbfa9"),
-    uint256S("92e469ea57c2cb63cd99800339476f4dcfd11338668b458feb3968c384a79cb7"),
-    uint256S("0bec48e5253cc5b621be227342b06538ee6965a1090665137f52068640b57154"),
-    uint256S("d79098fcc974eac25a01462b39cfa188c58bb845dab8161a6ce222d8464457d2"),
-    uint256S("7780d1f251d98d2d238429dd624b1ec828f27cddd285b828fc01eba2c4b471e1"),
-    uint256S("eaaa261868a16884114b6cfbeb4e3e65a2eb137f39dd7f69b3030fa5bdd22bbc"),
-    uint256S("3ae16999627bdda06e00b7caabb5398f4cd2cce3cffe4b46702a32413dc29bfd"),
-    uint256S("ed4270e30e333bf701f20361c17d421e38227a51047bc3eae18c7f8c6dd5762c"),
-    uint256S("898f81ff69a7f9d0cefabeaaed80e187830d1373a50698cd5d6d4051b49a6d68"),
-    uint256S("09c0281e7be5c365c04f750b146beeb303ebb077b836ca4b7a5b1e4ed6664048"),
-    uint256S("9981b57c9dd647389deac43036c6896767ad71db1112c7301921a59ced26a23e"),
-    uint256S("894144e40c363b495c6c6e698299f37afd079602e2d1a683a59e08a46cd832e1"),
-    uint256S("e7bb9726671d76cf6ef5919c78e4c1d904d7fe8197ef5ff297b0015bc4c53a3b"),
-    uint256S("782bbde55ee4027967b26d3619e42ee8556c26e4fc2fb9ab348515d95c628514"),
-    uint256S("2af3ab9fde9f3aebb063a7124700a4ab1ae0c66c1eae9dcafd2ad6407ee6d974"),
-    uint256S("d37600042a0dc24c3c52630ddaf9ada585008c875ca9c749013fcc77a4d4f849"),
-    uint256S("b0dc167c5dd640bc11d80240194a08b564d846fb4de6b6a8a56dcbc91dc93f54"),
-    uint256S("f7b98db27513a908b9e06db2027732a523e7ebbd3b5ad84ccafddb4e4a7900db"),
-    uint256S("f20699cbf5d0021f5109964c0f409fa375269c08ecc18bc5c2ea683b78f077a9"),
-    uint256S("ab36c982efcb8829be9a9aca69149ef611fad0416d777041892a031dd895680c"),
-    uint256S("a1b326f90456a57bcc8d5a6665f408b31966020d07d5dc362221744489c5d81d"),
-    uint256S("8e500c220c93274e9e8d6ed9f379ca2ae2c0ba96f04aaf3dcbfcb21e1dcd0f89"),
-    uint256S("55f3ca2a1c3c9c199e46ca64f3987d6bddebade4e10c037244c5d7b0520fa905"),
-    uint256S("68160633a4c24417b477e7dd896ff729c57c23ded37fe8659e463a16108a1d51"),
-    uint256S("7e9d78267fe6fd4735129ddb67d2a307c41d3335babb8d2fbbdcb2c98018d60e"),
-    uint256S("22fb5ded44e85b5ed1b70e8990b2c3bd56d388b3d983ae4e6e259d1f2f6d9d9f"),
-    uint256S("8b89e0fc7d7dffcd931d264503561ad54cbce0afb404693fce96baa90e9c6778"),
-    uint256S("1dd4f3ac7056394a17d0f319321f72705dff7badd01755cb41025c8c3f624078"),
-    uint256S("1d1fc685e9b9e5411c2826cf0c8fed71d43f4518cee8c4b10c8abf7bd30e104c"),
-    uint256S("7fbfdf576e1e3ca22b029502fb7208bec64a7d7f99d3c0c972f1be40abc162b0"),
-    uint256S("6425be5944d9cd68f9a353b79431a346772046bff093bad4a18c72039936e27b"),
-    uint256S("48994e11ca0c31002958f1cd162cb9ce654183ba8d87c009393ca276a0ecf719"),
-    uint256S("73c80fcdd9e0d60f807163ab8dd14e1fa748fb6788c04c0323b5b72272c9e28f"),
-    uint256S("ae2d264eecdfe61233d84ea194fc8d8857803f54d31c110a8e19a9e5c9ed6ee5"),
-    uint256S("9ca64483536db9da5a14162c8aac253dd33f7f018a486275c6f906456fd82878"),
-    uint256S("89d73a8c009a1f8f08f6f54c621737fae1b38ae741e8a651b4ebd689db3a15be"),
-    uint256S("87c92d64be29749e40904dfd1c24cd15156414790bb05f17f9fcb58780d6fb80"),
-    uint256S("91dac240294d98c96212d29b0c147ccd64b6c07fbe4f742ae036c185f7017300"),
-    uint256S("2d1d15808dee97eedee2ed8495c1e67d9932f1fa5d8dc10d2b1f362d77bed04c"),
-    uint256S("6a78d325ff0318090af9c329c89de235df59d12a038a5173a7ff8383da5306fc"),
-    uint256S("8468a7d2d04c11a56d611b2750e50acae45feb989a244cefd7c5b2a0d9ee1073"),
-    uint256S("a1342900481a8eabfdf48dc51ab483f5b8709f0ebed0a495b9a4c18c303dd259"),
-    uint256S("9850924d93eec8e7b3b7b955569330dd8a8b5f7572b255a4dec9076c0a47bc06"),
-    uint256S("88f20be64a3e0e99e97b0ff710aa21bc41caed617e0e2acda2c0fe513d0548ad"),
-    uint256S("5a488ce835ff5c8956d3d2a119df4542cb78cf6d8a2b33079452e51e1949b8fc"),
-    uint256S("2f6bc2eb0f52503af6efb22b21de43f2c3efceaa3a8e95628e921b6e0370abc5"),
-    uint256S("923025c56ba79c7a5a86de3db54c945b26c3ae7d48c53d694583c1eef05937c2"),
-    uint256S("9323674c5c7e3f1fc2957d14742ae6438c0dbc018a8668449d56a7bc6b300850"),
-    uint256S("2d5d7302f73efc3e1e4d33d04db235dd159a47982c94eb5206b30d45da4bb1cd"),
-    uint256S("b552bdfbb79852657752014d192f93456fa022cdc2fcdda10dae74be484cad8c"),
-    uint256S("468d67e1db6045b7c28040a205295119c16ad4f184ba4ebf12e23ee9bdb934ef"),
-    uint256S("5a822f6fb7203594545d0238326970f3a156fa6e36d25b3b88639d66cc55aa34"),
-    uint256S("fafb2476fbc9db2a0ede05f3f77a8d3711f042926fcc0489e0bd9e53487fc2a8"),
-    uint256S("4b044c2e6841a3648d82d8c563b21d278bc6e10ffa06841ebb1c8628c340db6a"),
-    uint256S("1621d2ac5d56b6060be722b81e9e2483b2e608c4a35cc07259b7b7d13c461bbf"),
-    uint256S("51a232b53db8d941f358095e63b2e2f76a687e2680befd03826224d6a2cf5edf"),
-    uint256S("62790ffd6700ce7a6a3e66fd99f1980f285fd9b001ca84c956bdf64cf06950ed"),
-    uint256S("3784a8888c9e26ef84747e421ff87c9a7364580715510d21711b1ab4cb09bef0"),
-    uint256S("963f433e6b7951db55713c725167dbd4216c5c6d01370b99754ceae9f4e18642"),
-    uint256S("965681e7f07358f2d196161e6860cbd829ee5966d34f3bbb46e9277d560fb989"),
-    uint256S("5a2ee5b4712d21c63e9dcfbfd58b0713026eb7e784b62c7a8e7b54700b121fed"),
-    uint256S("d585572df9894e6872a65a40455ca07889776738246de9a9486562871556ae46"),
-    uint256S("159bf34f26a1aeec2cfdbc7f329b079f061e3545e076b8b02a9f15e69e5a369e"),
-    uint256S("638bcc7580af55a7039b3a5a68ea5ae0fe8f8cbbe3aae445a30fe3ebcb1e9654"),
-    uint256S("4fddca6f73a6b798e6f5dd495e21e23d546840aa71cfe6d81a8c422c29e7290f"),
-    uint256S("3ed1532c438fe5166f89160f036c7b88bb7999bc90da28d5212775bb3bcfb413"),
-    uint256S("fb02bce3b91a812df5f077057babb8c9ebdf4f8fc0a2b385908e9a52874ba35a"),
-    uint256S("14c1b4488851750a18a130b3a7c38c09df87e90185eefe879c55257c74e90cf1"),
-    uint256S("ad217cc4bccd3c738bc382a12a9b93de26130d475212ea6ae722ea2ec9af2ee9"),
-    uint256S("3bf41b1381bed3416a27b3b274dc57820cb8a509cd53e0d7b39a1b953d17233e"),
-    uint256S("aef40fe614f4f251a3f908675de85715e6ec0954c7f604485bd0389715081735"),
-    uint256S("d7f65be17d2e568fc87f3819c83c7f31177a44fa0c59cdb3599436d16ab965bb"),
-    uint256S("3c9eda8defced333c19b95ea4bb855242d1094a82a1f0fa336d4969b72448094"),
-    uint256S("9b938c78fb3bdd9e7a34053d016cde9b7823e0ccc38c6791a3b01d15a1f370d2"),
-    uint256S("a2af0fddd50e13a3c7ed0797ecee9513d3cb410798a430a7ebad6cb5b8d71d4c"),
-    uint256S("b366e491d185e966654c6177f1a15d33c4e9b918d520ff964ca8a1e20d7364b0"),
-    uint256S("cfeac78976af263f249b15ead23fe83e6673bd386eeff12ca2fbe64f7eb545db"),
-    uint256S("bfdb2f48ba58bb2d0e88db1f41c39b37d083d4e36b3e81d63f0e85c9ce495340"),
-    uint256S("2f971ba4d34cb2aebfeeca3c5b9dbc170aecaabafc75cb2777e0055ce614b876"),
-    uint256S("309ec21c1af08b52dfc846ba3a601c67d877cef3731be0bb836c3b265ddaffa9"),
-    uint256S("adbe4ba8f9d3262f8b633486bbf8f10ad9ddc58386b978c5bca3d9b49d9fc81f"),
-    uint256S("ab0640f11791b746b37779501a5d53fc3ef1bdc506d6e1cf118d894f5d93670c"),
-    uint256S("c5a6e251651bd86c68cc86af1fe8faafda5ad8f2289ca887328f52a29ee94a44"),
-    uint256S("a9ec28f3b83254c012b447bf4bd81040e5821f6f7ed02f59eb0097f2a8e636d5"),
-    uint256S("c429fa8b870a00185c194676a9913f440faa3b6a6032c7f527e0581164fa7623"),
-    uint256S("8be307f916a838004d86ff7a56698e524d774f7bc128c97e7dbb20b6fc1e0ef6"),
-    uint256S("651f2ec807bd870c4fe2e15d68e0dc779196cfde7d64411d6d900c6f9624c1df"),
-    uint256S("2f3ca9042969168e5f6144127bd3fedaf606f324dbc09c99f074fbc66992adfb"),
-    uint256S("67a514a0e53e6e034ceeca6519b17a30f46bc7c6e21f181b6c4a5243a2c21228"),
-    uint256S("3281bcf9c9b919766f7dfbf3565273d4c5f66cd82af071eeb98d43587bff8818"),
-    uint256S("97ec7e1fcb376cb896343cccdb6ea97513c1393106fbb364e99f21d46c74d4e0"),
-    uint256S("870f0c700f3b5f892084000be67c31177e5f113e94d36fcb22227ca527175d76"),
-    uint256S("800a1c2a5988246a568efe3a256a434b3f9a1f9115a8a39d754ca79ae4622061"),
-    uint256S("53a50dd5cc6d36097c1ea027bd71c2748adcb28d6a6a30f27161a3eb9f66bf87"),
-    uint256S("0159425a6edc338949525309ce6f093f7ef91665759a1fb3ce77e5ac11f5ce6d"),
-    uint256S("0f42ef8bda7253c417400418c1b4f7f65c29df5edc408f64364b2953634f1500"),
-    uint256S("56169a1786953e201dee780bc5675b2d1c042ac63070bebeeb1cb6f7e8caf446"),
-    uint256S("291cd882090eb2fe9c40e7640b3ef2ff3de484abb84f951949343703df3ce7ee"),
-    uint256S("6fe7351c0ced88d0c4d06dfc5af1a2a8bcf11f444cc36b1c9aac0698966f6994"),
-    uint256S("7708cc2557438fdc18f7c32521d6b5ca6f297056c46b5de3d19e2a0fc954c819"),
-    uint256S("e17a08f1eb0ba23a73cfbca1b48a3ec658578bc83aeb05e6126c88e6dc29aba7"),
-    uint256S("f023ff5d0ad206a1c422784c3321867f2c824cdbd09caebf5530d8511a8a56d5"),
-    uint256S("a44c1e6c9a3c04a3dbf168bd70b703d62c1ccd33a77065503c3ecba7b7b85f19"),
-    uint256S("833841e5e53428d23da400ed66855c242a80c139fa81a84986bbcb10f4d90eee"),
-    uint256S("d0a31ece766760679869ef344747901716b6325566f2504e160e00b55f6e13e0"),
-    uint256S("dbee1566f0efe5a13bd30fe0f641b18cbd8e2a538cfd3a56d40cb1f4d698e262"),
-    uint256S("9931e0254af3db5754d1e08d6fcf4c3820d0947ec3672ffa830b093978c2db1e"),
-    uint256S("a268819b63cfa1c0d4a283462521f73003227bf35ab155e03a87af4b507a14a1"),
-    uint256S("8cc0312e75c547ace14a5b57f868744728e1e80ee828e2b829b1a787f4bcc5c5"),
-    uint256S("10a120a1810d2bf637d5338c9f53cc85f858f3262b5ae94d01667f5fe6a9319d"),
-    uint256S("42e6cb85edf0cd1115102c7cefbda29de1ec55e13b7c6c4bfe5282a622c2a2d4"),
-    uint256S("7b1d2a9a744ec082cf0a479282a76551103079d2f31b5b36e75bbc45dce7a998"),
-    uint256S("514ba2a189fd23dd132eaf32c7fa4f4b3b56f9b16f27eddf833b45762bbcf5f0"),
-    uint256S("33bc8cf6d4c3eff7962aec5452c769375dcf7f0e6b5f13a6e7f221b50d9fa4bb"),
-    uint256S("595bb62ffda0ba12148e306aa6a41edb7c49fa9a1d60a65f3e30ad4b1959af99"),
-    uint256S("f7d0e158d1c48df2d4ee8f5576ca2f7cc5b63b96880889dcb6ad51e1f862a006"),
-    uint256S("19c727e1195d61f246cbbd156cea3d2977388c6cad31388f3c51c4c728f7466d"),
-    uint256S("ec0e758bdcb1ae68462c29fdf2d4f20c8e09d0904927264e72e2e7287b6d271b"),
-    uint256S("e68589a565dd6069a2444b8834be5d3ced4835dfd129541b10c58d51dbd39985"),
-    uint256S("e40e5be5285a9ce9a330dece3abbdbe407545a34e8e39ef24879580d6a391f03"),
-    uint256S("2c345aa80f50239aefa45a0e5b4d865ed0d2c890c928fa402412d899a6347119"),
-    uint256S("220ced5665280c2d53e16c65ec2f9d54ef8caaea7de3724fcef91998ceabc784"),
-    uint256S("512fa9e5fca7a20c2b483fe63432be5570d6847e850f8f6d131bdcfc93fe2626"),
-    uint256S("f2257bececf0597c7e75b1437971c9e25e103cf2342ecbd43c8321ad4a694eb3"),
-    uint256S("752c31d7224a060ae86f47e5c61f61ab3696f070c4ed02ea1765cc06e5cf2985"),
-    uint256S("9586ea3200cc2b93c982777cb67f898cb83ddbc7c06fd262ef96f14f92689c58"),
-    uint256S("5a49bc13343b7783272dd688dfb406fd9401ae339ff9e207aec4e848456d2609"),
-    uint256S("8966b27ef6055ffe00184140cb9a1129f056d995901ad685f556ac95d908cbdb"),
-    uint256S("ceb88b36b10113e603ff936a098bdcb204b328ad3e0f894e144562d69538ea36"),
-    uint256S("7394de43712120be3d6330af3b699a7c79540b122e7818b244d3cbdec2f1e947"),
-    uint256S("701ed0e8853ed8dad9b0d8a82285ee48068e9f3a834177db601bcc7a15107cdf"),
-    uint256S("a57e862fb42d1f00165437a503bdc3cc34e2fbe9262114ba5d56a79cda30f638"),
-    uint256S("3aa469dda8bd4807173a3424219778d34c6ffcb509d4ce6ca0bf7cf6e7520ff8"),
-    uint256S("6c2635baafb3670f9af893d9e595b5f4754b3f0bed64722b29bebb35e8e5db2c"),
-    uint256S("71087f8d2183f90e9aaabb6a8f39d66393455e6d6c41bbe5c6c8074eb4ed138a"),
-    uint256S("fd7c2f510e6d33761ba2fe13192320ee9083f0a54dd6919d2fad3c03e251a07d"),
-    uint256S("bc5b47e7aa4b145f993e5a4626530a8aba0d0a9cd0c9c7a01ed9c00c472ad110"),
-    uint256S("24b759f7fcb69efb973bf5429cea54893d1b5b4adc6a3911c7d4dc14a49beaa3"),
-    uint256S("800939dc644b12c88da2806fe629a193eb0ebf5d368b72840a11f4dba5586b5b"),
-    uint256S("0ea17be1996dfb69819d1c5b9dbd10420c5437a2d45e845cc725ded38a11c635"),
-    uint256S("f0b79da81682b38adc4c6e38b8be91c189c906d0311c984ee40267cb1b89e561"),
-    uint256S("b47a8567d1dc496314c56b80c9331dc6e8f28247c846a11b0c1f4b5a26c487df"),
-    uint256S("58b9831ce4fd0a9852001c35286832dc3f40c3a300bdbfb678b1b7c1d3a5d933"),
-    uint256S("2047a6b9353585d2f983e29e8baf65e5de34bf82ca8125fbf2782ff1593d9579"),
-    uint256S("b716334d46162d14ed687142d1cdb6d5fa9a05e2a2f5cce78c912004c65cd110"),
-    uint256S("4980967d1088ecced8cdb0f1be469e1fcff430b62e6de09675aa11d2b34f1e28"),
-    uint256S("b20780731457c01345b201f2b800493a0783b816dbffd141a6fa628e40adc783"),
-    uint256S("e5022890f5b5ecebd3722699843c45a2f08d624390c548c2f8659663ab17399e"),
-    uint256S("cfcac6db00bfe273971c230ec9243b0efaac96910bb11f568edd15b755ef7036"),
-    uint256S("39cdd5283e348ebe5899f2bafa5dfe2e0529e9c9555b22f80c8a7ced7bd33e66"),
-    uint256S("094d748fefe97aca469f964ecf53419293cc5ee14ed938d1d2cc0e3f04ad5008"),
-    uint256S("2a692aa697be8ac1db85edc06778bea0ec983b3b950e9b57069f100c7160dd4a"),
-    uint256S("4db197d7e7f160e7c01a0117ab9d2c4f6a05c61e0db77f47406f15cd2b6504bc"),
-    uint256S("eb00929fdbf0d4cd45a8b2ee8caf1256b0603168e3b20fa29c7ebc39c0a23772"),
-    uint256S("fe7332fe5f0046cc2e46df0cab2fb40ec0506802d976489eea058a86bc33dfac"),
-    uint256S("a7bd65385cb425461f3e92ea698a982cfc752bff03281ac5a46b2c26df4b86c8"),
-    uint256S("538cc5eda0d02d33cb9199e981cd2ec2668aacc4904ffe317e6463b93d82c435"),
-    uint256S("c4a567dae1f293b6f7c00144ec9e8eed0fd3722356503ee533a775fb0dd35388"),
-    uint256S("53f3b8f80e0530558f4428e4386403290d0f04e137c404d60f68d06f77978e5d"),
-    uint256S("8b3239dd0e0ac12abee0f0ba900be01331d51fe4a6e8b1fbc8cd609916be6993"),
-    uint256S("ebb0b2d72619fc2d257fa52b78e65b211dd2d6ce76d32b9b324426df2e1c5ecf"),
-    uint256S("972002ea7797057c5831ed7a2cb82aae213bcc5641339c58e8556ff928414a82"),
-    uint256S("804717c61d3daa6fb370e583707acf3e3640d259919ede4dde002f3cbe3bce8f"),
-    uint256S("e89247485988bb302570652a1e4cf3a1958ffa077d43486c2dbe2ea1cf65bf7c"),
-    uint256S("caeff231d079766aae72f201e4331302151020a027aa410254f243a3ccdf4efb"),
-    uint256S("033b325ae49576ba4ad9458d1f4e2b5388086c5d4ee9c8a6be244baa6023b42d"),
-    uint256S("d8fd80403353d74be6b70fabd8250af3e50608aa721bc25ac0ec70da68d173f4"),
-    uint256S("ca7ce14a0b81290042531b7c032fd9f8089eb2b7087b686b317002dd8bbe8897"),
-    uint256S("faa34da3759411dae9a6204e173386b6e5bb7f94036efdab2166d0fb9496881c"),
-    uint256S("00548601fde44901255fbab695bdc38c66f99296970a416ab719aae28ba797d9"),
-    uint256S("45ea0960dd62449381e20b4d319354f34702433f5fbf5012df6e7506dc9c43d1"),
-    uint256S("23da191f7b489e788794b4f0b347ec7268d31fefa4795960ccb9d71455dfab81"),
-    uint256S("2fb6918812fe5ee094c25c7a459d562ca094f74f6756f9748fff3aa37fc3fb9e"),
-    uint256S("e3e8284c1188042095954cf4f6ec853423f5ce4c5996bb98d9396c0e9aa74bb9"),
-    uint256S("e85208179116b084b3fea974b4a7f164a0122caa212cde1ae82c795939642547"),
-    uint256S("495c467cb84299d082bcfcd8d419bbe3cd964526f9061d9531fbcfb39818f75a"),
-    uint256S("7c08de878eca5e09b23aa784c8a478770dd55c266c86cd106e7efc7c39be4f39"),
-    uint256S("24c3df2e920833bd3a1abea490a9903560d44cf8b522f8d41568feaeec56a243"),
-    uint256S("31f2f19626b7c8c1fa40ede69dafa87943bb5cfeca840861b749f1956710b0e5"),
-    uint256S("365cb887058c941d684790432195b7e5cf2cd9f4c249b9c13a5a8652ee90c51d"),
-    uint256S("abbf36b64fa4e92e460ec9307e8dd708ed3cc6d22a36749f565baaac222245c5"),
-    uint256S("27c28dc446b876f06eaa1e2507bb960b9ce93d6c5e41a448be2ca858bd60c6c2"),
-    uint256S("3213cbb2fed34bf501c4df3a6fc7f3b8d24f0838dfb24cbc7d9e9c95fdb32710"),
-    uint256S("88920814e48038e53fb5ffb2f90c15522ca885f51acfd5b8f318743597b52e1b"),
-    uint256S("9474c3a8772f5bff15247c36222ab7e015ad20bec691fe3dfbeace801d899dee"),
-    uint256S("e2cec60c12296e2b3789a9c4b8ac6bd76cda2fe7f1a50c2629b2483e3c930c55"),
-    uint256S("fcb8c30bb82581f10524860608984d3e4d10b3d079a910669f2b9804bd41782e"),
-    uint256S("762492fd05145c0f75f77f712c3f8be4227931d271afa0d8b70bbbc81533e74c"),
-    uint256S("6312d97f35525b89385b6bbf9187e7dbec34a0a35c8714c46a83ca2c456f6af4"),
-    uint256S("4e83251acdf73a340731893743de8c5d407d9e8a521e1327ca25483ea0d9b911"),
-    uint256S("11f52c5a708bb0f9a02ec62e5925496e2810b0b1969df606d8b0a4d0895f01b0"),
-    uint256S("6bf83bd0623894a7adfd1d959f9b7367f5a268c52e5fc4b54fe0270735e0370a"),
-    uint256S("2fb460fcf39484301fe3b8439a6d7c43659739afc1e3d4673336c07add2e7089"),
-    uint256S("92a60a6f9f95e0e5318cd8f8c7184b6fa29f43bee68f5a66bfa3b0cf780cdef9"),
-    uint256S("440bc522bcd90dd3631d6f07ac2eb3baa0eaa8215c5d1e1a18a22b9a740821a0"),
-    uint256S("52d828c3803800c6cb94f2e1f24b0ff5017b419702437a908dbca92f8dd6c932"),
-    uint256S("35b448e7311cbe9206ef62440887877345076b8cff5ccbe45dd98770bb9fda35"),
-    uint256S("6027d6f5848c6dbb6559efce783e5134d1904081986df53c2f8fb26c4f35f7b1"),
-    uint256S("9597131e6109e6f768c3569cd9d2fc7442430e4ee23ddf2b37adb78a15cc9818"),
-    uint256S("bf3388bb39347b9d560349ae7cc62f995c3659fc1e91e48b3ff26746e89efdce"),
-    uint256S("a3a46c69835b5fd06171f6a2cfc83c6f4d2f5b5f39489448d53c8c0d5e95c669"),
-    uint256S("41de1d45c5ad82e9cbca93242013d1b2c453c514933ecbf7f1892b48ccc02d34"),
-    uint256S("45711a1919b35a70b4ce61f599030565d49d7f8d4559bbeafd0191045b535c1f"),
-    uint256S("3d3f0be5b3213d6c0505c9c1b6421ea1b0410b833d4facb8347dd337070759ff"),
-    uint256S("1c9b5bbc87c9f723637b341c1264af341ad1785c4699f5e649ad72877e323112"),
-    uint256S("18a3d2fe253383ec0a675155835b206946a8cd4cf47ac726cb44d34d9759d3f3"),
-    uint256S("5cc8d8711c3c967dde5247bb2f5b903812e99f09fc67672fc0d6665678aba854"),
-    uint256S("aab26cc88ea2900120968a8aa7443ee82f46d6031ad0651066c4cbf7e378cf31"),
-    uint256S("d24fc3761f86cdf8a45cd91cb8529c9ad0757c3c7becc4c4c9420bb75b7409bd"),
-    uint256S("ff6a9cce4312a4b325b51c47315b0e0bf5b2b0c6caef36eca94454d9a1b0670b"),
-    uint256S("251de1c5156ebb025a82fd572914833ec2c38287c2c671bd9e4c83ded8265487"),
-    uint256S("e49237f3e4fc2160a04474a9ff106618f680b04be02a9e24183bd5f220066723"),
-    uint256S("9f46dec3e34449bd0e8692cf8b22aa55d223f7dc0ca2f39da7aeda0b6eff5428"),
-    uint256S("82608916a58f5cf528651fdf59c4b81cf95579fe0083a04cd98e262a926eca35"),
-    uint256S("583b95c2e0f6a23b689d7645f3962c16c8db29076ddcb3b70454ec2fc8284a59"),
-    uint256S("33c9dcabd230d1f344ea91895fc16f5a91329ee446d2f376ff0aaa0f387a2298"),
-    uint256S("9a588a4e81ce8d43c96d1073c3457d4415e914c86a3ff90fcb612ab106bac23f"),
-    uint256S("525fa312b3ab28d613d37171db8079492c878316f0b267290e883049d866d9d5"),
-    uint256S("7c411388b16cf0466f49b84eb7c178fa399501e6fe609cca91039d77b4524325"),
-    uint256S("923f8c0b1dc6e9e02094dae9555152c66876861c3edce7ad5e690b2b2d3bf2fe"),
-    uint256S("94fd14a7036eb70300bf0741e587de898a931e9deb0a9989c1a06de7f5dae8d7"),
-    uint256S("b0caadc8d70bfdbc50d86d5c8909f8f788c8d2bb8fcc95ab425d0cd520f6a30e"),
-    uint256S("ee40740192cd453b2c641de2bba88df7474fdfb1504bd0845f03cd37fae59dcc"),
-    uint256S("e307a4df677faa92f6e85f43312354fd6370c8a3c33518366119b25fc47a66e1"),
-    uint256S("54a9384f6ee12a1638ee37d8542f730dad9563ec83165753d45a3285efe489d8"),
-    uint256S("537b14476cfc71f20775db1e1ad7c5edc20c466cec52c66b16c7553ffcfdc1fa"),
-    uint256S("51f14b98ba569ecc003a847b09bfbd4ac927c7bb1776d150aca710af6cd2b850"),
-    uint256S("a8b50db59c7c970a57328a5b84285e92cabbf76b96670fd4c262e38be3d272e7"),
-    uint256S("fa14c6041ac91197b514ea23b22817989fb7b4cde8aa032f80eec4dcbee22569"),
-    uint256S("ab6f74d7bed4bd481420541f7144828f9a573852449dabc023ce4c782878b1b8"),
-    uint256S("221824e848f4deeb22c05a99734e67cb0085da2ae6f5d3976497fde8de0f9299"),
-    uint256S("4c9998a9b88d9e3ccea4166e9616c9cffb5594b4f2b078e445a826084797f7af"),
-    uint256S("bb4aab3610527e3839c6f20ca686ac5110e9c649f7f9c9a8d871ed626ba13f7b"),
-    uint256S("97cb48f06c95c09926584ee5ffdc56d45f3de99a7570f04646a98c00e3b8c487"),
-    uint256S("70d0431fb892cb4848420a307afad7afa7408bfa9989bad9c5020d943564b065"),
-    uint256S("16a599464981cb3ca7154af327810110f688df18ee3a547d4ad95c81727b46ae"),
-    uint256S("d6aa4f66fd8974cc439120f2c7d42323c96fea84a72a9a6819ef273b0010205e"),
-    uint256S("7cfe886a17d2a7f152f56f316d190e1c7cca1f45797e5f6f3fc644b01ba7527b"),
-    uint256S("f4875a185942d2412996b4a41acdc414f051857e4ccefb47e5b5980e42fbe21b"),
-    uint256S("954e5b410ad75fadc7345eec2527937ec7200c2f0c3bc52d9c91f23416c3b332"),
-    uint256S("ad7e2b40a9eab0302070b99f6ea40c121d1aea5da3dbec4236e9f9f08b002609"),
-    uint256S("78b3dbe309684691b279fff398b059669f4b47ea089e11cb05468924808529ec"),
-    uint256S("775feebbaad6427ad44f4d2bb7e96aabc876da72e64fc41568e2f99d490f9248"),
-    uint256S("a6e022c0dc7a240b0237c10530e915a1bd1986fb541eb2a68369f287aee0a2c0"),
-    uint256S("ff94ba01f44100f1971ecd8f2f25d77f70bda878bf78bf4a6463f33d396049ed"),
-    uint256S("cd307352b644cf036fc27945c96be2549fa5610067672bce6298d462bc830e23"),
-    uint256S("62b2fbdf2f32f576e20c844ce3b686458f3ec4ae4b6922272c792cd9635363bc"),
-    uint256S("033bd28d813886fca800452fdc27d9cb42083324b0f273d346a8c69d96314e63"),
-    uint256S("068ad16b7a61bee4978179b8a286e82cc8640546e693e5b8cbf3aa2213d7cb2c"),
-    uint256S("b1b1109d1f273d341a2d8779752492e907435035b80c47fd7f6fd1e6e003d524"),
-    uint256S("87cc238ce509b4c48d5bf460d1c7bfe85d3b516f2cc4dd91ca8f9faa24f0eab0"),
-    uint256S("efd9c9a1b7749203678822d7125b163a7c67c80bb99f38ad298d1aad5b4247d2"),
-    uint256S("11214d88cfcc8cb105d432e9272c10d87c91c0369e9fb9346fe0bb13e0eb3fb7"),
-    uint256S("4a0e90fa7d005cada42fa94ed61e08c46177f52ae0d63ddaf62e4b54942f1d7b"),
-    uint256S("ca2d61aaec0d1e87736636254351adaa9cce221d2438789f667ba73e6cc12b1e"),
-    uint256S("5ee96e33e6b7170c6d8a391005aa7a1e0219b930a1b91d58307385ec9cea5a33"),
-    uint256S("1a0ef11e078219cdb04c621d1171b2353017b85df0059356939f34ca85d842d7"),
-    uint256S("07ad6cf130f3febf0ae52fa088e03b727a6c8a06451fb6b7c4a7c3be614b2660"),
-    uint256S("24595d6f2e14288035a47616df89e82748b9f78b4dc042375585c33b43f1ed52"),
-    uint256S("01ddc478f6f4f5bbb33f76e22f4dd27ff3dc0149ccaec7bf3eae9a851b718b13"),
-    uint256S("1507a43f0632d00824fb4a6a6a63e4f7c51f8ea5552ac238a1c1ec734ad9dcd4"),
-    uint256S("e104870dc3ca958946d33f1b7ab6f4cfdce24d961b88d675a9558f9bfd85403e"),
-    uint256S("bf196027b69a502b0671bc1293f1518017573d5213cf1e9a4522f435cbadadb8"),
-    uint256S("8ca2f69712de0caf04a93ac190304e5ddcfc763fbdb70bfa35abf22c9cff7001"),
-    uint256S("580017b863c963e813cef0b8652555191b74543595f9329fe3e407599b88fe51"),
-    uint256S("ff991aac154f93e0fa9077c9ddda952d5219124698e4e222c6f02b0f5e30dc62"),
-    uint256S("da437cf386e897de8d5642e0dec11837ea1e07c166a1b84d1e6d1390a10db85d"),
-    uint256S("d2ef31b1bea4aca89879561c465d146fd21732a68fbf1f336d2411682f9aeeae"),
-    uint256S("a75f7bae1926cc6ad2377cb67196fad79da1b43d4149abed4aca601e95ef9227"),
-    uint256S("dd165775188e3919e2b60aacb1c05a9bfd4170930d0c66977b242f53fb447817"),
-    uint256S("078837e9a3e7442a86c3b62802bebc70cc062e7a834514f598111a9a52836b73"),
-    uint256S("3bdf292ef3dadb4446e414dd20d9272021f1e5e7ba709c59d8822bd493e58b53"),
-    uint256S("b5de82340dad7c55cf92a13246ba97d61fccf6cf40fd63012019d225fd74d9eb"),
-    uint256S("4163d27d2fda71eb46fd1c05775cbab32f23119ed26f7e251de1893dd53b7c04"),
-    uint256S("c2e59bec210c58cab2c03bf9840263c4c7ba533f79140dd1b51709647669cdd3"),
-    uint256S("65634d629778e8b8eda409f0227158d1c0daf26324ee0f8e47b4758b086f26b5"),
-    uint256S("1343f79dba645b405e9afeb287718f448812e99536137517a0f0e16ef3cc2896"),
-    uint256S("62f93d3e3087baba5d62cc4a593e3ec6164fbaef90200c2f0c454fb164ace61c"),
-    uint256S("553e4dc979b923edc9512b3bac6e016797fe28c2ada4eef13c1a47696555842a"),
-    uint256S("7459cd4d8e128e0e088072028d1ef1bfc8e972fbfeccd5c3ccc4e1faf477e19c"),
-
+static const char txSpendingBlacklisted[][65] = {
+"00548601fde44901255fbab695bdc38c66f99296970a416ab719aae28ba797d9",
+"005749018b49ead72092011d19791cd1e060e87ca366c8df7100b18818e7de6b",
+"010e40b69bb394b8552146d0c89b989a410dfe5f80a7653e75087f53302f3980",
+"014097f4112b465a840971131c82ba78f818b3c689461fe41823fcd17a318e59",
+"0159425a6edc338949525309ce6f093f7ef91665759a1fb3ce77e5ac11f5ce6d",
+"01686e731bb4c747f6ee2ef3264637abe0849a7caf3f158c102777a23eb3b27a",
+"01ad0d6fa3c9f9e682dd9ec11656f2a0010cebdb21222c06343c0dc87bdec78f",
+"01ddc478f6f4f5bbb33f76e22f4dd27ff3dc0149ccaec7bf3eae9a851b718b13",
+"021fac166a06326b85eea299c154bc46443be1a49197663a63806743e0b35bc4",
+"02262e463673da8e2ce48ff3be8d3dfa290ccffa89291137595529f6c810bf94",
+"0285de4f742ebf3a31fd2b9a767ce38ba3cfe1143f9cb4b7d48ad1292633dea1",
+"02d452e03869054fbb49986e5943b249255fd2f7c556b18dd8e7ff52e00eb4ac",
+"033b325ae49576ba4ad9458d1f4e2b5388086c5d4ee9c8a6be244baa6023b42d",
+"033bd28d813886fca800452fdc27d9cb42083324b0f273d346a8c69d96314e63",
+"038601ee137f4cf5b59ec85a00fd64d7bf2436f5dff4ae573461fa760cd18251",
+"04474dd6072bd04aae93d1d4c7ca5fed2fcbd32b482edddc8f1f8b530d123471",
+"04827205d7fd81b51464ed0f350d7d50a3b853da7567bed5d47a9c5724f4e01d",
+"0489794a4220f125debc476392cdc695bd1cd024e6877a199a497de05f71aa5c",
+"051f5d718b36458786fc0203f9faa1ed3d18ed7d7cd70bb088055208b42f2d0c",
+"052b6ad4c492a5f4b43bc297d47ccaf97003df2f62b8aa037f0246a4f1b0d693",
+"052d061a2a013c8abcefbe5944f880cb9daa61097dd337c5c09e3e7d466e4808",
+"064a7bdcc2e51c305288cc6de2374527e2cc44325ec7008aa7d28dd1c054eec2",
+"068ad16b7a61bee4978179b8a286e82cc8640546e693e5b8cbf3aa2213d7cb2c",
+"0694086febb0a77ed5596c294174d4962b53a83d5aa71396966fe8efaebcaa9d",
+"06bdc5b0928429e347ca124635306dd39eb56c313062fc5cd2b152c558a8849c",
+"06c8c5f98eb7e742317a0f851663a8b19ef58f1cc572f3960cc51e6584e23b84",
+"06ce0432f50c5a0e092170af29b16bafd6eeda0723a5e63095d2a0796fd8351c",
+"07255a2268d2f539c13791d033bb303ab9fcb3fd54810423c4d8c0569ae223aa",
+"078837e9a3e7442a86c3b62802bebc70cc062e7a834514f598111a9a52836b73",
+"07ad6cf130f3febf0ae52fa088e03b727a6c8a06451fb6b7c4a7c3be614b2660",
+"07f83954f3e320c16853a0039e55ae0af6a566ca328c78c4e55b0466f6b1da3f",
+"08705eb71cb40c0dd0ebe28095f286d09b4b5afcd5861824d64f70ef2ecb3c4f",
+"094d748fefe97aca469f964ecf53419293cc5ee14ed938d1d2cc0e3f04ad5008",
+"099f3997853b0edc8723c677ba65d5dec6e5c1d1a5438b6ee0ba469508690f75",
+"09ba68bbe854369ded58efe5780065caeba1adf6bfb9a6c3dc8b0ecf321d3cc6",
+"09c0281e7be5c365c04f750b146beeb303ebb077b836ca4b7a5b1e4ed6664048",
+"0abd1f4bb947154f9c78bf39a3c151f1c793ece47e3869673c61d303c587292d",
+"0b167d7c7e379ef518442a0e36d52950a6d1863ebffde276ff571e036ef4e72c",
+"0bb9c970a05f11021e1ad19574a12ab001ccb7d74acf5049fec12dca4d246ba3",
+"0bec48e5253cc5b621be227342b06538ee6965a1090665137f52068640b57154",
+"0bedc097989e43e848f709bc52a2641e3474aaa5013252886c983e5ab284577c",
+"0c3a3de336415e773d4a8d583e53d3eb07673472c80cc2d89d3f2446610818ae",
+"0c7384b1de8a7c8ef513fdc8e94671eab49b51b949ce1f7ac2bb8f1d81782590",
+"0c9c128476e23abed2216cd1e082d65ad53fe7ebe9b6d2696e6c69eec7e94405",
+"0d62614235d64e2feadc36100c0c890b6ae6fefceaddeca619300fe59e6fdab4",
+"0dafe630c36af2d7d65b14a65d361c37217e5563b5f9281a034c5ccb15fec244",
+"0e9f709f3bebbc4a5df19773979780cc88369213e15c1996dd63b74177b98b0f",
+"0ea17be1996dfb69819d1c5b9dbd10420c5437a2d45e845cc725ded38a11c635",
+"0f19f77905bd8ba7f15f53552153e0f87a222921ecc0c027580c43ca1128ab33",
+"0f42ef8bda7253c417400418c1b4f7f65c29df5edc408f64364b2953634f1500",
+"0f801554523971ac060885980444c1fdd984f1b443ad46c42fb84c7a4f1d7e70",
+"0f9a0c404c830657db083279e70fccd987e8762b980ba48f8f5b0f50314fe852",
+"10747694c96f6cd469c22adbdd79a7bb484eb4321e3088b7ab83dd44261c0908",
+"10a120a1810d2bf637d5338c9f53cc85f858f3262b5ae94d01667f5fe6a9319d",
+"10aa34d94f6c086e76cf5fa80ddbfc6cdf2ab5bec3bbb2672b0c8b02cbdec7d4",
+"11057e3ca4ffa4a82bf23763793d584b3717eb205ad154edabeadcd72f26d62c",
+"11214d88cfcc8cb105d432e9272c10d87c91c0369e9fb9346fe0bb13e0eb3fb7",
+"113d13b375295bb3a808d6e30b4ad9ab83d9a9f60872d7aed2d8da2ef382830a",
+"1180aee6ab8984e884b5e7a4936885fd3b9ecfa2f9e3b5253dffdba2db06519a",
+"11b10be7297450afbcc0a3a684184aeab9155c84574711dd8cee009b629bc28b",
+"11e9cf24559aad909ecb1273dba20a0fb5ae727d6d4870203d67bd8528c378e1",
+"11ea39f66741f2987016d6f30ae2342ef079e017b284f886c08a753d93dbf193",
+"11f52c5a708bb0f9a02ec62e5925496e2810b0b1969df606d8b0a4d0895f01b0",
+"11fb29f90dd6e5ecd2820bc4708a303c01ee3b53002008c6211a9f39785db645",
+"1343f79dba645b405e9afeb287718f448812e99536137517a0f0e16ef3cc2896",
+"1351373c6834ccb48919bba3227040d2c6674090059a5c8539001c648c304fec",
+"13ce32d52877f1f42c79e4c13fb1b6abf32f21edb0e8f19207e857d6027c87d7",
+"143537b4f748b4c0d29f933fe9818663fc9d5066cf13512748b7eac5987ce150",
+"144c34f373c93cbddaf383f9254eea2dda482b15ab2b488cd9006c065ccbfcb7",
+"14c1b4488851750a18a130b3a7c38c09df87e90185eefe879c55257c74e90cf1",
+"14f0734342026e2da77c7e5f96bf7c1134eaf333c1aba977113707c14f9ec830",
+"1507a43f0632d00824fb4a6a6a63e4f7c51f8ea5552ac238a1c1ec734ad9dcd4",
+"159bf34f26a1aeec2cfdbc7f329b079f061e3545e076b8b02a9f15e69e5a369e",
+"1621d2ac5d56b6060be722b81e9e2483b2e608c4a35cc07259b7b7d13c461bbf",
+"163a72eb0836b74765c9bd2dd023ef3e29e97ca7d1104d981522ea4bede45dc1",
+"168897a46d91b522ab6722ba26e8ced9ce36576c5e2b7e03a076166e381be9d9",
+"16a599464981cb3ca7154af327810110f688df18ee3a547d4ad95c81727b46ae",
+"172a0658381ff5cd61a5cb8e386f30c8d4b9d8271a1617fa454dd476995795db",
+"18565a967435451d5de0ffd1c200cecacdf031d9bc30c26ea144694cd75f8e1f",
+"186283d8a8a7fce70343572230dc4d3d3d6cbcad82213d379ac5ce8be5003b9d",
+"18a3d2fe253383ec0a675155835b206946a8cd4cf47ac726cb44d34d9759d3f3",
+"18c7df0c807cab9e5354bdd67d0fd9c63c5f9a8dfc7ae419c0479b5e41dbb260",
+"18e440e38401e03e50237e0dd28327fa3f415177c31634e9c6f4945deaa51788",
+"18e479190489d63d66a86edfa0d8efa7fca397f7ca5d3261c2816b2e57ca54e0",
+"190062c290cba24bdb4968efdcdb72ebcbacf0b8e241851742ee15c66a964815",
+"19c727e1195d61f246cbbd156cea3d2977388c6cad31388f3c51c4c728f7466d",
+"1a0ef11e078219cdb04c621d1171b2353017b85df0059356939f34ca85d842d7",
+"1b95f2c02bdbafc2ace2fa479139af8bb87f9e974103f33b2ecd081d073accbe",
+"1c9b5bbc87c9f723637b341c1264af341ad1785c4699f5e649ad72877e323112",
+"1d1373005da62a7f31c24f68aaf35b677014ab21633c7ba964c403cf7729f97e",
+"1d1fc685e9b9e5411c2826cf0c8fed71d43f4518cee8c4b10c8abf7bd30e104c",
+"1d9cf5592a23f3c5d60215e24171c9b5fe5d73f7c94396a078235c9010762707",
+"1dd4f3ac7056394a17d0f319321f72705dff7badd01755cb41025c8c3f624078",
+"1e8c230267685f0719262e897809d982c0ce44e9474705baaf720eb591ed5304",
+"1ef753580ccf5d00cb9e35d8c6b333531ce33050ddcd568ef27cad26f8d4cb4a",
+"1fa92a284027b4b4c495c3d4fd3f41a14dc43d5b71a4b62fa38870f3b05a6f4f",
+"1fc7df27e0ed6b977af7417ecb4f39225e5e4b4ba9330767d4ff86eee23706f3",
+"1fe47e1ebdcee6b05a75d98b28c0f774baaa1d80657e3f1c3725f86a4e54f87c",
+"201899fb666409c5106f90c036d8efaeb4c00c157a03af33b9a143980c526580",
+"20198f11b653d62ccfb0d6c41a0cc72da0efd10846d63a175804598147f8bd1d",
+"2047a6b9353585d2f983e29e8baf65e5de34bf82ca8125fbf2782ff1593d9579",
+"2074c3ab4048eedecc1e71393ce486cce44886fcc6d301974d780610a0e4d921",
+"2123dbbf919538e07f454578f582ea01e41451d766b807f6d420f767573c0634",
+"21b2c693ddfb5569cdcd9d469e6b448585edfbac485bb11ed78e3d16f24e2cc0",
+"21f94da4b0825c3243bc91204b8a6e37633345d01b4fa90c50269c456237e575",
+"220ced5665280c2d53e16c65ec2f9d54ef8caaea7de3724fcef91998ceabc784",
+"221824e848f4deeb22c05a99734e67cb0085da2ae6f5d3976497fde8de0f9299",
+"22fb5ded44e85b5ed1b70e8990b2c3bd56d388b3d983ae4e6e259d1f2f6d9d9f",
+"232cecfc246ca95ef82c61bf0cda578cfc25e770d034d684e7a8720872400533",
+"235bed1b441dd52550d59450d92401d9658f8931ac275f97b7852c205d8ec3d3",
+"237cccc6b57af48f3d165b542e3afb0f97bc7882772d296190e7c128dd813cbf",
+"23bfd91c878523fd1b79181873e2b815ad479f5e79e42ce916eb9e887654e4e2",
+"23da191f7b489e788794b4f0b347ec7268d31fefa4795960ccb9d71455dfab81",
+"24595d6f2e14288035a47616df89e82748b9f78b4dc042375585c33b43f1ed52",
+"24b759f7fcb69efb973bf5429cea54893d1b5b4adc6a3911c7d4dc14a49beaa3",
+"24bec88defc02b810757fe91a4cf2016eb93a9ccc6d7296dc253b69ba96cd134",
+"24c3df2e920833bd3a1abea490a9903560d44cf8b522f8d41568feaeec56a243",
+"251de1c5156ebb025a82fd572914833ec2c38287c2c671bd9e4c83ded8265487",
+"25365b9d1c9723eac42a47e0d567b22e82865f1a008aa8ae3669af90c72e8382",
+"258e4582d02cb36427c33ecbaf0de8339b16696de493f0a3076f5649160e576d",
+"26186e3deb30fa23a2de081498c76ba35a5cbc73936d037de4e937b87b6ebb20",
+"27a20c9db91ab006f5d02a255be5af843aa8180eb0a17078089e0d30d8230afd",
+"27c28dc446b876f06eaa1e2507bb960b9ce93d6c5e41a448be2ca858bd60c6c2",
+"27f3cc98061ef0cde0766a4d8ad3e10b962a8f387be2ed40537ac7a2d758aed4",
+"28d0d43e7a51f4c796d884169afe06fd6a6eef9c40de67bccbbc9352044757ee",
+"291cd882090eb2fe9c40e7640b3ef2ff3de484abb84f951949343703df3ce7ee",
+"293b29d10e3988abcbf9a10ee9d559a67b0da9b1f54e13c4f087ceb3341d62cb",
+"29a065266c604786397a9c6dde9fdeb98f7d269cc1dd8328b770f8306831ef13",
+"29fbc161ea16c09cc33c123363445dc419c874e85c50b6c3257a93f4a2a41254",
+"2a1d2c778f582666512bc0f1ae76539c9859d6d18273ea1372c45bb92773773d",
+"2a239715223bbac03c11cb3f207f4d33e029521b648db5a6c8bf9fcd5529ad7c",
+"2a692aa697be8ac1db85edc06778bea0ec983b3b950e9b57069f100c7160dd4a",
+"2a8dc956a1657e771d5f87ccede4e5b74292c77dc83bb9aec0f8e835ae103406",
+"2a8f703505c91c3acdd00d701ba980d2d369e367b7301752375a26902f74c817",
+"2aa7ae6266df201c06bcd450d38c3e01903147c1527eb90f72213cf76dd6d7c0",
+"2ac6060313e3f6191a9af3190de43073e6c7c875dba06a12dda4bef99d15ab4c",
+"2ad85c7292397d4015b7a95bd21be997667836172583d9d2f1a11fad3530db5e",
+"2af3ab9fde9f3aebb063a7124700a4ab1ae0c66c1eae9dcafd2ad6407ee6d974",
+"2b2dd87bfbcfcdbbc7793a17ec918378fcdc7a7c922a1cf666970a6060ee88c4",
+"2b3015fba0afd90bf642c824e711707399b24d125dbddab404cb7524dcd5ff19",
+"2b5a86f340c30bf7f5c415d2049f4766ad843a76d3059cc9fbd21f31a0e1770d",
+"2bf3ab4aeefde73d0219eca30c871a8bd009f34d466f107bb6d3b14e26dd6f7c",
+"2c345aa80f50239aefa45a0e5b4d865ed0d2c890c928fa402412d899a6347119",
+"2cc34e495fe48f1af77c28902d76e6de2f53c7e3b984ff5f06063d0d46d9327e",
+"2d1d15808dee97eedee2ed8495c1e67d9932f1fa5d8dc10d2b1f362d77bed04c",
+"2d485847fec2899448340a04018509a15962b8a9de4350071397604b0b8498f0",
+"2d5d7302f73efc3e1e4d33d04db235dd159a47982c94eb5206b30d45da4bb1cd",
+"2d6b5a32a6e23eb9615cf856352f26aac55bc758a0318f3d8223a4f99aa8f3ab",
+"2f3ca9042969168e5f6144127bd3fedaf606f324dbc09c99f074fbc66992adfb",
+"2f5537d2deb2c77fcb9436704614cb66461a07b519ee57b81ed10fb3297f9a2f",
+"2f6bc2eb0f52503af6efb22b21de43f2c3efceaa3a8e95628e921b6e0370abc5",
+"2f8a63fad7ccb3cc853df345fcac9b7246387c5e17d2caccfc727e4475ae8691",
+"2f971ba4d34cb2aebfeeca3c5b9dbc170aecaabafc75cb2777e0055ce614b876",
+"2fb460fcf39484301fe3b8439a6d7c43659739afc1e3d4673336c07add2e7089",
+"2fb6918812fe5ee094c25c7a459d562ca094f74f6756f9748fff3aa37fc3fb9e",
+"301891c4ab82864e1c4cb58334326ff596d08303bfddbc5b4f7b26b1e6517f16",
+"3028f5049ab85177e0f9999c4d344a3e6904cadb67bd04c7329ed3dffce3ab47",
+"303e47742dceb32cdea5518a341d75e95e91272ef30f6c5d764452254b591cba",
+"309ec21c1af08b52dfc846ba3a601c67d877cef3731be0bb836c3b265ddaffa9",
+"30d37ae70b926aa9131226a722abb65903048b4eaecd1d618bdbabe7a05ac057",
+"314eb3bf84b8a9fc4ce3c5357fa9d0c4c31495e44004bc67f2547485f57b9c2d",
+"31e15f4abb9dacc706e238234787a05cf2934d53f972969acf4bcbe5a66c6e54",
+"31f2f19626b7c8c1fa40ede69dafa87943bb5cfeca840861b749f1956710b0e5",
+"3213cbb2fed34bf501c4df3a6fc7f3b8d24f0838dfb24cbc7d9e9c95fdb32710",
+"3238f2a7086966f19562fdd7df69c8f784da232d7ae120b844d687f814677727",
+"323b9feb2521f6679716631b063b9264eb344b9854ef9660db2e0ba41f86d2e1",
+"3281bcf9c9b919766f7dfbf3565273d4c5f66cd82af071eeb98d43587bff8818",
+"32939dccf550df27c7309c10c357fff9bbd266ec1e23043afd6e5fcc433f6192",
+"32a673eeacf6a233001cf1c2d9cf1b26457a61863c2b5d52df701fd4f80c1be5",
+"33142a9ca012d74472f97c911fc89d8b02aa83109b573afb4481597b52a62a7d",
+"33793ff34e232c088b2725480d5a0930f556ee1e45c7826a42653d83452f919f",
+"33bc8cf6d4c3eff7962aec5452c769375dcf7f0e6b5f13a6e7f221b50d9fa4bb",
+"33c9dcabd230d1f344ea91895fc16f5a91329ee446d2f376ff0aaa0f387a2298",
+"345dcb2ffea170377dffb69fcb1fc1b5610f445fee383f5cf034799ac3e072a6",
+"349d509d5f998f74260da45248b1b5ebb3700c4bb8c49d4f740dc26f5ce9ec70",
+"34ba734aa028ee7acc9a5e789e1dae8253bed15da8dff48b0fa63c5c6d469e50",
+"35b448e7311cbe9206ef62440887877345076b8cff5ccbe45dd98770bb9fda35",
+"365cb887058c941d684790432195b7e5cf2cd9f4c249b9c13a5a8652ee90c51d",
+"36d083e29dd1104d8a1597d4c1233b6ae5b428cb4924f8677a170388f05e2bb6",
+"3784a8888c9e26ef84747e421ff87c9a7364580715510d21711b1ab4cb09bef0",
+"38d7ee41bb00365df440d531011437802da05f89c706df6d1ae40a50e927008d",
+"3970b61be0fe8f43859b5136c3713d878a077908437bdbbadd4dda913c6adec4",
+"39c3a11afd385172be7fd6d57d0277bdca9f29c5ef9b75c0b93b5261df3b0bb4",
+"39cdd5283e348ebe5899f2bafa5dfe2e0529e9c9555b22f80c8a7ced7bd33e66",
+"3a8b8a90bcf6f7fbbf4072470996e25b6856404e44ad76f337083e7d7ff23362",
+"3a97f80b0aa43f0776d6b5e26b9be7631a7b610cf3adc9b363c057abcda3f319",
+"3aa469dda8bd4807173a3424219778d34c6ffcb509d4ce6ca0bf7cf6e7520ff8",
+"3ae16999627bdda06e00b7caabb5398f4cd2cce3cffe4b46702a32413dc29bfd",
+"3bce22d40db6e6f9f534b5b77c3a1be6ebcb256fa19241857b03b2e921787250",
+"3bdf292ef3dadb4446e414dd20d9272021f1e5e7ba709c59d8822bd493e58b53",
+"3bf41b1381bed3416a27b3b274dc57820cb8a509cd53e0d7b39a1b953d17233e",
+"3c0635d5deda7fd11f616728ce1f1300ad2afbd5c571021c8d8fd74aea072f1b",
+"3c1f1e10e2206fcd6d47e1372f07edc5ec5112f50e639755ddee740e7be6e457",
+"3c28ba3d447edf1d981a4854a867c9e4342df450c7397ba9270957d21d0c22d1",
+"3c4ee58a40efa680199a196676a4dc25fa4e247c47e6a2db59d63baee82e8e37",
+"3c9eda8defced333c19b95ea4bb855242d1094a82a1f0fa336d4969b72448094",
+"3d3f0be5b3213d6c0505c9c1b6421ea1b0410b833d4facb8347dd337070759ff",
+"3d621174054962ae818c62bd75d588720eeabe1933bea2fef5f8a4dee59ce517",
+"3e467a9a24c2450e58062754afce6ca4d52db70bb370260a723099a316062c85",
+"3ed1532c438fe5166f89160f036c7b88bb7999bc90da28d5212775bb3bcfb413",
+"40342a8a63ef86fd2573c422d00564ea29aace4553784c54b1fd4e39ab4bdecb",
+"40d4d2421dc2ad00a79366880e75d7c59f7326a2d57426e2e95bdbd9c67b9080",
+"4101797c673bfb172706fa4bf255c7a174b1dd2aa56e010d0c61b19b382786bf",
+"412cca8c5c52589517d76a38a4f62a1cee11a0ef11b20878bafd71afb94a0619",
+"413805bd5523d0e1526c23347a29dc32cd440be449d0f99991a558bca8812d1c",
+"4163d27d2fda71eb46fd1c05775cbab32f23119ed26f7e251de1893dd53b7c04",
+"41a4c7918d181504375b96695db3bcb96a899c1aa0bc6d7cadf8daa0dccd5c53",
+"41de1d45c5ad82e9cbca93242013d1b2c453c514933ecbf7f1892b48ccc02d34",
+"41e33c7c4e313a70af86d796aee10e1e184ebcde51a40d42f6ace172f558d0a6",
+"4242c8405130ac18d4d2649cc0b10e5cbe7b9e8e6a50bff94ec75530704ade27",
+"42b50d6dba054bae814ab83d4498ad9eb8014af0036ed07b4f0f02b55524d54a",
+"42e6cb85edf0cd1115102c7cefbda29de1ec55e13b7c6c4bfe5282a622c2a2d4",
+"4326a693c233504314f79685c7b10eb5d9c65bc7c77c80a5d94f7193ee19b397",
+"43d519a4ef68375f93b37cee15ada050ec710517efcfafe9cba85a173147de71",
+"43fec8825cdd3aab68e75bc20ee345a6f0ca63d6a13cf2764bd9be0c7b4304bb",
+"440bc522bcd90dd3631d6f07ac2eb3baa0eaa8215c5d1e1a18a22b9a740821a0",
+"455ddafb6d0973e6f24d6c9f19e5df9ab7e76ac6476f8048a4f127dff9dcc47b",
+"45711a1919b35a70b4ce61f599030565d49d7f8d4559bbeafd0191045b535c1f",
+"459dda630726d4a3f1aef43bbe33d1684408113b94760cde594d08dd069b7f85",
+"459e99998f11b763fbb15ca4ba6e10f409a15820d6db28b91d73f7040e623a40",
+"45ea0960dd62449381e20b4d319354f34702433f5fbf5012df6e7506dc9c43d1",
+"468d67e1db6045b7c28040a205295119c16ad4f184ba4ebf12e23ee9bdb934ef",
+"47170866f84d2e7eebed561abf75a71b86925d112360692983ccfd19c756dd0e",
+"477faabc4b8682da0ff5f30cca93af5da700c97b99620018b1f0e29af579b51f",
+"481dfb6a696f2080026b5218bfb0ccfc7a432705e2c960f65a37df3e01c11d6e",
+"48994e11ca0c31002958f1cd162cb9ce654183ba8d87c009393ca276a0ecf719",
+"48cea1eac52627d4f55de9dab8b36a2b482922c33424b32de1fae04d5d0c0ebd",
+"495c467cb84299d082bcfcd8d419bbe3cd964526f9061d9531fbcfb39818f75a",
+"4980967d1088ecced8cdb0f1be469e1fcff430b62e6de09675aa11d2b34f1e28",
+"4a0e90fa7d005cada42fa94ed61e08c46177f52ae0d63ddaf62e4b54942f1d7b",
+"4a4ab8b34b98a3ccf8a2fcdb1ae3f7212f87f045c01f2b1d445d40db73e37fa3",
+"4b044c2e6841a3648d82d8c563b21d278bc6e10ffa06841ebb1c8628c340db6a",
+"4b05dccc682fbe5906da089a966fb922db0deb6ce84dcf6ff8cb3eb625682ef6",
+"4b92cd02a5be1bd6cafe7e7140d8a2d1b10ff761ed0ca88ab9a9ba59acb5098d",
+"4c9998a9b88d9e3ccea4166e9616c9cffb5594b4f2b078e445a826084797f7af",
+"4d3c727ad97dc47bb23cb346c77c6d171862e9649a9d681d4a14b860df03cca9",
+"4db197d7e7f160e7c01a0117ab9d2c4f6a05c61e0db77f47406f15cd2b6504bc",
+"4dfd9c041afe9fc72e0f9324473741c83b431dd99cd554c9c627e04c4fe678ce",
+"4e0bb2857774b55fed8c75ef91cd56e9dbb0b13e7a25660739e420645f364cff",
+"4e5b8787b58a2c9e0a00a3ee0d4189f62a954512abcd125122802fe5b95f61a2",
+"4e81639f8f8d9ca869a97778b2ec40f680181441601dac13264781fa97144b91",
+"4e83251acdf73a340731893743de8c5d407d9e8a521e1327ca25483ea0d9b911",
+"4eb1f6ee003c81a5c42cd493b2ea08c0d098552a0ffafa31c4dbc3d0840bea99",
+"4ed0264773054356dc69a5d310c5cfce7bb794441ba9b7644f2af3801248fbb2",
+"4ee09e069b8d7f4c904e025571bf98bc402483a12a35dcd2e66d3a0ac0cd7200",
+"4f1558cb64fe6980e3b77a835d6a00d9ee827da010254c5f629486e76459fa08",
+"4f643981bb2c282fd43372aad1b4f6fbda6338a457ae4b6bff5525674a3db850",
+"4f92bfd2b74eada1eadece68e0d48fc69d611144dc378ca197f61a95d363eaff",
+"4f99d50ab03f129fb3b437f2d8814795dedd16d64a371bb1bc07b2ee3115d6a1",
+"4fddca6f73a6b798e6f5dd495e21e23d546840aa71cfe6d81a8c422c29e7290f",
+"5120208fbf72dc60a3da57326b1f72ab4e02859e407751d93a08414b634a1faa",
+"512fa9e5fca7a20c2b483fe63432be5570d6847e850f8f6d131bdcfc93fe2626",
+"514ba2a189fd23dd132eaf32c7fa4f4b3b56f9b16f27eddf833b45762bbcf5f0",
+"5153d846cb16e69ded0662bd0eebf07e301291571f1ce023070e46ddace8c608",
+"515ee9a1cecc4b0ab73fbf42b5f5ebd109f237fa73b656b5b0e3879a28b9159a",
+"51838c3d52da894a32e2e261d81249796d18b0ecc889131211737485d174079e",
+"51a232b53db8d941f358095e63b2e2f76a687e2680befd03826224d6a2cf5edf",
+"51b1ff42d361c233710dbe4f048dcf51a51ed250a9355366cf869a8aef492c19",
+"51f14b98ba569ecc003a847b09bfbd4ac927c7bb1776d150aca710af6cd2b850",
+"5238c4455a21303517a5806969123188f5c090a3f751c9d4c3d12f86900f4700",
+"525fa312b3ab28d613d37171db8079492c878316f0b267290e883049d866d9d5",
+"52a7add129810b8aeb5b7bfadf4de225867f76cca9e6f52c44ec0d069e6cf34e",
+"52d828c3803800c6cb94f2e1f24b0ff5017b419702437a908dbca92f8dd6c932",
+"52db0d64d62f259ba8d7467ff0ef6acc8b3f23a7164c2e596396a57455c51e5c",
+"5318cb97719f78acc3a478f1c8cf2c27cd62f472a647c507e568b1776d866353",
+"537b14476cfc71f20775db1e1ad7c5edc20c466cec52c66b16c7553ffcfdc1fa",
+"538cc5eda0d02d33cb9199e981cd2ec2668aacc4904ffe317e6463b93d82c435",
+"53a50dd5cc6d36097c1ea027bd71c2748adcb28d6a6a30f27161a3eb9f66bf87",
+"53f3b8f80e0530558f4428e4386403290d0f04e137c404d60f68d06f77978e5d",
+"540a2db057350e0ab3d6b845776faef457ae6b856f29b980791524261d2cc3de",
+"541064023a30564b1290fcb4fcf8b22594d47006b8445b32f33bcc51b4c02ca6",
+"541ce3f8fcb6aea85afd419b0d75209ee972f4b542f813f891cc12e97b520ea6",
+"544b6b1c6b59ededb7dce041fe89977966b813cf0d3a9d920313fc1673f77509",
+"548e0087bd1161ba05ada13165e5bdebf15639ff1688e40d74d2da97272986d5",
+"54a9384f6ee12a1638ee37d8542f730dad9563ec83165753d45a3285efe489d8",
+"553e4dc979b923edc9512b3bac6e016797fe28c2ada4eef13c1a47696555842a",
+"557122487b6c600cc3bcba531e355abc26258cd770331b14cb6d348e5b0e3b8d",
+"55f3ca2a1c3c9c199e46ca64f3987d6bddebade4e10c037244c5d7b0520fa905",
+"56169a1786953e201dee780bc5675b2d1c042ac63070bebeeb1cb6f7e8caf446",
+"56c50dc3490b3cf861eb4e5dbf3656a1f0cc58da5585ab6af151bf6744c43169",
+"5739f2ba1590c29443e29333c25d56a579990036af512f7360173be8d2715ae0",
+"575ca33265e2daa57a316bab61860794a130a53ae9d2c258a9bdce1e1788d42a",
+"57b9472b8d4e0086b0fd68d849bfe9523cc994fb584a77bec8d4a90a1e94cf0d",
+"57b96a6c41b09d963f529760f6186dd2de373c538947e1ddf5cbc809b57415a9",
+"57dd80921167cca4085b0b368e2efc47aa958064c7c22a8b2bbe8e82e24aae31",
+"580017b863c963e813cef0b8652555191b74543595f9329fe3e407599b88fe51",
+"583b95c2e0f6a23b689d7645f3962c16c8db29076ddcb3b70454ec2fc8284a59",
+"587ca049491476b6e039930d8097ecdf7b7a147cf74fc42a269fc53a79d46f49",
+"58a8736de3bfb35e59325648bb2b468a1afa4f47e25da3f6acc96bdf7d35fc4a",
+"58b9831ce4fd0a9852001c35286832dc3f40c3a300bdbfb678b1b7c1d3a5d933",
+"5915bf02a983e9dde57b80a15b5f39015c6049b664c72f27b41c3457f8b72a27",
+"595bb62ffda0ba12148e306aa6a41edb7c49fa9a1d60a65f3e30ad4b1959af99",
+"599b3d15488077d9946e802846e18ea4d27038d07dee1dbe10132ee95c4f2e66",
+"59b1624d5da4dd27d4ea98210b64c817d8a94f753170382d5bc55e853f215a8c",
+"59b97f4e2808254096c227a433f8283fd23f571a300a1838fbc20f64a725348d",
+"59c22352d6ff23564a5a0bd47b35709270614e8d93b7557cf8e6260f81666e10",
+"5a2ee5b4712d21c63e9dcfbfd58b0713026eb7e784b62c7a8e7b54700b121fed",
+"5a488ce835ff5c8956d3d2a119df4542cb78cf6d8a2b33079452e51e1949b8fc",
+"5a49bc13343b7783272dd688dfb406fd9401ae339ff9e207aec4e848456d2609",
+"5a822f6fb7203594545d0238326970f3a156fa6e36d25b3b88639d66cc55aa34",
+"5ab32cfd7e3de67946f53173681cb5e463c713243da8144eaebe0bf845a79d9c",
+"5b179e83b7d0f712a68c4cf0b86595a20aa9dbebaa24c98d499ad2ac29b7fd16",
+"5b3200a52515d01eefacfce5f83a1b773d25813dbe13de9c2110a06f41f2bc06",
+"5be04d427c22abe95d68d690f57b0396e3f8f6e8c2fd8a40f89d6acef07145e5",
+"5c41de8782b511601d05c8b74d3730e89487981e383a33b21c946319385a5013",
+"5c43e48d54e6fc05775663dcba4e0177cfef5afd842282431bc4e3a09dd7b780",
+"5cc8d8711c3c967dde5247bb2f5b903812e99f09fc67672fc0d6665678aba854",
+"5d20973f8159fd890fc71b3de224f42d303934ceb59d838e01df9b99c72f0da0",
+"5d59e2494dc809c88200f226edd502843da724906735a9922be927ccb061fad8",
+"5d8ec12f688be77490717c740def5de284256a48ca8f34226e7621cbee272942",
+"5ee96e33e6b7170c6d8a391005aa7a1e0219b930a1b91d58307385ec9cea5a33",
+"5f5e00adc357c5cc1fb4a4893160305c7c1b59cc202faf5fdeca4e0612324c84",
+"5f81af77b868e586dd53f390645ab3966358588e2f03b236a5a6001eabeaac16",
+"5fa07665329a8d2e5bbbb225dd6ac43d014cfe53a900c0a17d5d28f5d9bf33f0",
+"5fd3ada4947e48a8f49eab4319379b115a2ece07d15e3f18d7bc6a5b54fa893c",
+"601ce44e93e322f1f8edbe00d95a124f1ac157b3e2fbbfca839d0647188ff048",
+"6027d6f5848c6dbb6559efce783e5134d1904081986df53c2f8fb26c4f35f7b1",
+"60325b7869f88e6c141b0cbb20e4e44f3af43de6ded80ae950e83f3b425b8bff",
+"61fa79253892718baf4f37050d3b2a198f20b6504db47669a83ec267a0d16af8",
+"620c2774854277721f41189244eb6d8884777cfc3db1ec8c9f8fda38128b14da",
+"62790ffd6700ce7a6a3e66fd99f1980f285fd9b001ca84c956bdf64cf06950ed",
+"62b2fbdf2f32f576e20c844ce3b686458f3ec4ae4b6922272c792cd9635363bc",
+"62da8c02007746671210157de7f7544b6c8ffc1f26f2c3d14f52c5a6199d877d",
+"62f93d3e3087baba5d62cc4a593e3ec6164fbaef90200c2f0c454fb164ace61c",
+"6312d97f35525b89385b6bbf9187e7dbec34a0a35c8714c46a83ca2c456f6af4",
+"6360fa404fd69b0f24619be1e2675a2da11c91f0e14ba75744f3e17d25fdf382",
+"638bcc7580af55a7039b3a5a68ea5ae0fe8f8cbbe3aae445a30fe3ebcb1e9654",
+"63c9f3a6b326ab7479fa1f5bdbf6eeb7f8fd9f629bf8f74829aed109c7b452da",
+"63f578a4796d36a49b00da5970fa85c6b2dc260a9da766e34615e83d9ea79ac2",
+"63f6c16067b4e7ad5174d9233dc46ee1d59e10777e1c58d18d5bd47b5bdde929",
+"63fefbf04aed6bbbc43fd7e94787a6045dc47cb9fbb0f109c36c268469dabfc2",
+"6425be5944d9cd68f9a353b79431a346772046bff093bad4a18c72039936e27b",
+"64916689020df467fb7f5fec61a24f8d80ae6a0b444e8b517d2b51910afe2513",
+"64e24b40156b017f6e0f506a8896614a96156308c9088057038e5f05fc9e5700",
+"650275bccbdb414b88b539835b4d01212b244a1f2befb897f9273411e2f820d0",
+"651f2ec807bd870c4fe2e15d68e0dc779196cfde7d64411d6d900c6f9624c1df",
+"652a62a7b2ffb3746a6fca3aef4d9d42b8973304ebdb5540c6cb542e48610e32",
+"654393b48581c41b34fea804b860605ce6114fa32a25d29ad8ec0ba9e032b89c",
+"65634d629778e8b8eda409f0227158d1c0daf26324ee0f8e47b4758b086f26b5",
+"65d2b6986b23cf1d6db4ab3a16cf50748c3dac4be30fcea996357d0911a1a67c",
+"660e5819cd485bb01536b28b3880d8c95c259a8a8e5687407bff561f654d9aad",
+"66544da42480190da7f567dc540d1b0b1f60a4560498698c8e9e9096aa5b48ec",
+"67a514a0e53e6e034ceeca6519b17a30f46bc7c6e21f181b6c4a5243a2c21228",
+"67f912ff83baf22540896930a8a83ba625604096f21e03a1c641dd9f87a3f041",
+"68160633a4c24417b477e7dd896ff729c57c23ded37fe8659e463a16108a1d51",
+"68189f1851e66427426f920fc877a4285ba04ac92420fae143535bd5b53447c0",
+"68514f3992de250fc3c80b5a670f584ce90f0415ebec9ff55f3a37b836ae9246",
+"6880e580563a678c5559767ad5a3c3aeb4e93c887f72507cf9482906e6fab313",
+"698dab219f6ed1c1d7bd018eb1741be6aa71fd55fe35c9dc1c6e4831102a5f81",
+"6a100940987e0f82dc697d52c5959c45a643ff70ad0c42dc4058ebbc8b6ff6d3",
+"6a78d325ff0318090af9c329c89de235df59d12a038a5173a7ff8383da5306fc",
+"6aa8e81a337a75d7e8c382487cdb9f9b1d94cd2166a6efd9b06710a784d238b3",
+"6ad7cc88c83b0eb0d07206ac905ecbbd5f9fd9d0f7698bc75c786846e7edbfa9",
+"6af250b1e1b02a7080f26fc3251643e27ad11db42f3244171b275ba70c615da5",
+"6b0cd3d95ff65bdda4a2ed6c5a787e6317e77d20ce5b1c47e392017c3f0e5c94",
+"6b2f1b4f95fe78ce711c5bce9d7c447c8d7dc8929ff2a00a283af1b379615afd",
+"6bf83bd0623894a7adfd1d959f9b7367f5a268c52e5fc4b54fe0270735e0370a",
+"6c2635baafb3670f9af893d9e595b5f4754b3f0bed64722b29bebb35e8e5db2c",
+"6d01c83bc6dca330c9df36dc23224f5c51fef807eaa1b2502f8d314d10502639",
+"6e7baa95cacb3655763b99f312e3d7705f67bb3747d03998f04a07b3e645fad1",
+"6e7d6d00110e040eed67757889f276d941297f141c71cd54cce5b55f8c337819",
+"6f2eeb8ea95fa28412c701c3cd2caf40b56c000914fd866dac00a552a01504e0",
+"6f4351ed586e3284d2c796681aa8140567c17996d59c0f2080f00a900d28fe47",
+"6fc35b062253efd935f227b7189f4b40d011de8ee5388caedfce5757b2be3192",
+"6fc51ad40c198847c9060f838d0c2f6703800c1c72405cf285ea70baf76ed6d7",
+"6fdafa0c45dc861362b84d15dec612458a7845f0c9323ac2f0d3c69c487847fb",
+"6fe7351c0ced88d0c4d06dfc5af1a2a8bcf11f444cc36b1c9aac0698966f6994",
+"701ed0e8853ed8dad9b0d8a82285ee48068e9f3a834177db601bcc7a15107cdf",
+"70d0431fb892cb4848420a307afad7afa7408bfa9989bad9c5020d943564b065",
+"70e7a43ca58ae006d09a7eb73462e64fd8bd82067d886e5a8239bdc104ddda51",
+"70f512f3e32ca6d1d7c03cf417d03fb552a60ed51ef0611a58e21b243058513d",
+"71087f8d2183f90e9aaabb6a8f39d66393455e6d6c41bbe5c6c8074eb4ed138a",
+"720d82ed718c9c0f921c3e60317694fe90efc29df9de66393883c32606ffb34e",
+"7394de43712120be3d6330af3b699a7c79540b122e7818b244d3cbdec2f1e947",
+"73c80fcdd9e0d60f807163ab8dd14e1fa748fb6788c04c0323b5b72272c9e28f",
+"7459cd4d8e128e0e088072028d1ef1bfc8e972fbfeccd5c3ccc4e1faf477e19c",
+"74698d7eee2bfb9e0813c9515985465a1e63765c6c371a0d69639a2c6281f79b",
+"74b4c63c2de738fd7d8bf514faa20fe6e9146f3581828c3d062331061addd9f5",
+"752863ca41e6258f639a1f7b994a2f6790d5297d559f7699414e81fb7bcddd34",
+"752c31d7224a060ae86f47e5c61f61ab3696f070c4ed02ea1765cc06e5cf2985",
+"762492fd05145c0f75f77f712c3f8be4227931d271afa0d8b70bbbc81533e74c",
+"763988a65729e33ce0ec0f246d390c305a2bb2c6a4f14218bb9980d7ad050eaf",
+"76c213aa50a39176d4c6c0624fef63d80b2a9ffaf545810ba43e45014bd881d4",
+"76cb23179f875b2c763d6527790c40058c0d29e734fd94ec656f3cc7dcd20ce8",
+"7708cc2557438fdc18f7c32521d6b5ca6f297056c46b5de3d19e2a0fc954c819",
+"773c4552c7f5333f2e29bab27f6c407ae6d0e289d5a76cb42472ac840e1b7bdd",
+"774e2743c8c181716f7ddad5aa42c3d40c5b388f93e7bcd49d2a773c8c7b96be",
+"775feebbaad6427ad44f4d2bb7e96aabc876da72e64fc41568e2f99d490f9248",
+"77709ebd97eb672e11971072438e736dc2f86a03aeb4ca637646fe1c6a658cfc",
+"7780d1f251d98d2d238429dd624b1ec828f27cddd285b828fc01eba2c4b471e1",
+"7790a739444eabc45138d38e5f37f8df56895779e17f84bfbccdd2dea1ca0e1a",
+"77b6b6392b0eb5d54ae0db1fb7e478fb9acd5e852315a6935116469ae28d91ec",
+"7802d49842d155f52c374fc7d88eba6287d0e1de0cacbb5a47a67fe7316e7992",
+"782bbde55ee4027967b26d3619e42ee8556c26e4fc2fb9ab348515d95c628514",
+"783615b6491c2288fb645b3f9518046688a584fc359a29bf8e201c8b89491af0",
+"78b3dbe309684691b279fff398b059669f4b47ea089e11cb05468924808529ec",
+"78d9ff2fd0301862e058af1ae955827d5863517d9dd74e059c043210f96d537f",
+"791d9ffe3d017c030033723d3df3715b4f15cd1e597a9b0fdfadba157691d1e9",
+"79a7a9f605035514eadfa27929661b581fd60be6a23167395c9788ad7125f1b1",
+"79e80e8d59616456c540f438ce4d5cdada0137b56858172f718c278270c50395",
+"79eb52b5d5287faadf11b72323c72112556520ce62bab00b274d0c69053d1c17",
+"7a3b89c1b9d3d00f0c5c0b0d6e66de009e53ab7a896d087ad36da71b63f764ac",
+"7a8159456d3a4afbc28e4ceeea4482c94e112f413ec7ed05f65fc89d999e3a20",
+"7aa606209ff6509146292387992916c2c6ac8fe4a03a76db276b1fe1bdd7928b",
+"7b1d2a9a744ec082cf0a479282a76551103079d2f31b5b36e75bbc45dce7a998",
+"7b8319a3a81de3081c2210a44816533443e9ee02c5b69f2de358a1d51b126677",
+"7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ad",
+"7c08de878eca5e09b23aa784c8a478770dd55c266c86cd106e7efc7c39be4f39",
+"7c411388b16cf0466f49b84eb7c178fa399501e6fe609cca91039d77b4524325",
+"7cd46ad72e122907fc2cca219d04b14d97f4885e6772818e81e9c17b7e98e21b",
+"7cfe886a17d2a7f152f56f316d190e1c7cca1f45797e5f6f3fc644b01ba7527b",
+"7e9b2ba252adaf9a8da9b1fc90954047745490327ad7d83c5f03ae1579196d8b",
+"7e9d78267fe6fd4735129ddb67d2a307c41d3335babb8d2fbbdcb2c98018d60e",
+"7efc99a0a464a28be35fa64e6cbbb80957d144e66a6bb020968bdf1fd02dc388",
+"7f6d1bbf0061d2161812fd46e442b111d9dcb3f34ab4273e7c1332a6da62fb3e",
+"7f9db14add4b874946b695a514c1acb794f214b5036f99dba80b6fdeed97d771",
+"7fbfdf576e1e3ca22b029502fb7208bec64a7d7f99d3c0c972f1be40abc162b0",
+"800939dc644b12c88da2806fe629a193eb0ebf5d368b72840a11f4dba5586b5b",
+"800a1c2a5988246a568efe3a256a434b3f9a1f9115a8a39d754ca79ae4622061",
+"804717c61d3daa6fb370e583707acf3e3640d259919ede4dde002f3cbe3bce8f",
+"80a4f83a03611111778b4c8648c5553347788814aecaf4adb7874ac93e9f256d",
+"80d4d725992f7a42980f39bdc8b7c7685bc0e8305dcbd0ea57cec1915cc8e356",
+"8258069aaa9067bb59e59285f53a6d59ecbc92b7dea040a0c1d633cf82cf5a71",
+"82608916a58f5cf528651fdf59c4b81cf95579fe0083a04cd98e262a926eca35",
+"827b7813fb8db21d441926087471b139d1d8a819004826ae1d2cedb40243d4e9",
+"8326ba7e223929e3494ba36d0b45f79d2a056ec8ffcb3b18235aa269b6937cbe",
+"83335a87e1904862c427f13dfa21a4ca4818306c30d5c1b960744006291fc1a4",
+"833841e5e53428d23da400ed66855c242a80c139fa81a84986bbcb10f4d90eee",
+"8349d852751cf80d817605bdd027ef46f2bac875e126043170c9235aaf4db977",
+"836bcffd52f83496598896ab5639eb67fff12fda848f05186ae1c59f1cc9c7e3",
+"8468a7d2d04c11a56d611b2750e50acae45feb989a244cefd7c5b2a0d9ee1073",
+"847f2cd4b2ced6c2d46eb72eaf020fce12dd39834d1e81b5f4b41114adeadcc7",
+"84e96a3c5cc2a005c6b42e3236bf19cace7e8535359dbe1f8dd0c74a15440a25",
+"8539d1fad9d43f56fbe2d9953b86c84d34fcb4ec75545336187d63971a100b93",
+"854ba5de535d9fac7b8a13c581ebd6013d19901d9cdfc135b029e429e3add35d",
+"859bf02bc0fddbb45922e0c0f8f84de3059c588d0822d9b96d2117f187e3be9a",
+"860cd14a1c6ef0e9f642547d345946358bc0830b59f8b0dfbf08850c9d50ba1b",
+"867fd61e7399b2098c2ae89e2b980721855c28ed616d776eff35da49b1f46939",
+"868615cf717b98704794df4ec23cc9d507a0a849085ef78e61d992eb53b009e7",
+"868db22ba9d38c292397c85ec3f28fde1d7bf70119227974a0fa886f75fb3834",
+"870f0c700f3b5f892084000be67c31177e5f113e94d36fcb22227ca527175d76",
+"87c92d64be29749e40904dfd1c24cd15156414790bb05f17f9fcb58780d6fb80",
+"87cc238ce509b4c48d5bf460d1c7bfe85d3b516f2cc4dd91ca8f9faa24f0eab0",
+"883cb0c4412c4d83d3d0349b41e37e589e818656f6cfadb12b885b5499dbe5b6",
+"88920814e48038e53fb5ffb2f90c15522ca885f51acfd5b8f318743597b52e1b",
+"88f20be64a3e0e99e97b0ff710aa21bc41caed617e0e2acda2c0fe513d0548ad",
+"894144e40c363b495c6c6e698299f37afd079602e2d1a683a59e08a46cd832e1",
+"894ab031c07d72f0424e0121f4fa954c33a97f27339e719a215b488a44f902f0",
+"8966b27ef6055ffe00184140cb9a1129f056d995901ad685f556ac95d908cbdb",
+"898f81ff69a7f9d0cefabeaaed80e187830d1373a50698cd5d6d4051b49a6d68",
+"89d73a8c009a1f8f08f6f54c621737fae1b38ae741e8a651b4ebd689db3a15be",
+"8a6e138ec34cef03436421271485f1ffa50f2316272a013bf5b6f8a8cec19832",
+"8a7071083614d3b67bb3cf9b6d531fd3ecbd8aabb4a5fe85e0bbfb61c4ac4a62",
+"8aca271fd2b75dabd9e1bf7ce74a0ea25b4abed9f039a1353d986ad5ad4b470c",
+"8afa62ce39e13dc55560863f18b78ca39410af1f3678f2065086b2fccc3f32da",
+"8b3239dd0e0ac12abee0f0ba900be01331d51fe4a6e8b1fbc8cd609916be6993",
+"8b4d8babfbcf7382e4c5e9fdc5822eba0059308765fb1a7441a8079fc476fd4b",
+"8b59c0f4fbf2f3141abd484e2a81d9b207a5440ec38d20c6ef8477be6808af42",
+"8b89e0fc7d7dffcd931d264503561ad54cbce0afb404693fce96baa90e9c6778",
+"8bdaf2af51d7e51898c1a93a69ba206acc26634389f9798e7d5f9989184bedb0",
+"8be307f916a838004d86ff7a56698e524d774f7bc128c97e7dbb20b6fc1e0ef6",
+"8bfca3081e04058cea6495fa2b47f07d5b658b993e1fbc5d4a5e10fab00858a8",
+"8c1dae80a980b58a6936f2ef7dbe6898e061bc7220605996990ef3a596482ad3",
+"8c799fa978cdb5639a1af8c49d21223e682d24be58f92e7f0f2ebde7058b27d8",
+"8ca2f69712de0caf04a93ac190304e5ddcfc763fbdb70bfa35abf22c9cff7001",
+"8cc0312e75c547ace14a5b57f868744728e1e80ee828e2b829b1a787f4bcc5c5",
+"8d737074952f056aaf5754e723e8a402c952ca2f55cc3914e98c16c9ec6ba7c5",
+"8e1b24f5b370ec8457d7935fb4c690966166cb00bdd489d2ab4abd36aeda2adf",
+"8e500c220c93274e9e8d6ed9f379ca2ae2c0ba96f04aaf3dcbfcb21e1dcd0f89",
+"8e5ef0a143f500ba0d2249d6f7913a40e4741d35f5c60806a2d9a4eeecbff0b7",
+"8edec2f372270ffdadb985276fb547b4c78a2b872356df647dddcb457d6e2d25",
+"8ee266fc21b7a9408da75539266860da362ee38049994ab69871c417c07aaaf0",
+"8ef464c0065df3df1f1c9388fdab4d73be35708d6f54b19523b911ac85bc025b",
+"90951c4e0620a7c0a91c379ea9dcbab62e4f5face8e65fd21fc759f4ae3181eb",
+"918daf944ec0ad804e167c304061adc71a8b4817d17ea3043d42856c6e48685d",
+"91dac240294d98c96212d29b0c147ccd64b6c07fbe4f742ae036c185f7017300",
+"923025c56ba79c7a5a86de3db54c945b26c3ae7d48c53d694583c1eef05937c2",
+"923f8c0b1dc6e9e02094dae9555152c66876861c3edce7ad5e690b2b2d3bf2fe",
+"92952091af7196d48b0c0e595d94d6af21fe93bb6f8eeae94132661fa9a08870",
+"92a2425e9944472a765f8065a427e17fa25028d65dfa77159a8f8ea798825842",
+"92a60a6f9f95e0e5318cd8f8c7184b6fa29f43bee68f5a66bfa3b0cf780cdef9",
+"92e469ea57c2cb63cd99800339476f4dcfd11338668b458feb3968c384a79cb7",
+"9323674c5c7e3f1fc2957d14742ae6438c0dbc018a8668449d56a7bc6b300850",
+"93944c54122f5c0536313ba4ced22f8d4d818e6966e3b7b0c36823b14d9bce7f",
+"93ddb72140e1f83d960d995ebcdf1f93aff6365dabd3bdb358c1a27e60817475",
+"93ee3d3db017ef076df33bf33e03056f6fc3e4d289e1d88b6bea3cc1a233ebc4",
+"9430d59026007eb878f713bc1e30d6da2e51be3e088952735b26685b4db3f176",
+"9474c3a8772f5bff15247c36222ab7e015ad20bec691fe3dfbeace801d899dee",
+"947558fcf4553192be6e8c27c4645a8356435e4abaae5c4c89884896ed865d00",
+"94920420cb451b348ae5a0688eaf4f20017a74fbf533bddc6c11d1b9aa604dca",
+"94f74b89e21f073b53234b506c20265282bdb89f70413607cbe2b61c74b338bc",
+"94fd14a7036eb70300bf0741e587de898a931e9deb0a9989c1a06de7f5dae8d7",
+"954e5b410ad75fadc7345eec2527937ec7200c2f0c3bc52d9c91f23416c3b332",
+"9586ea3200cc2b93c982777cb67f898cb83ddbc7c06fd262ef96f14f92689c58",
+"9597131e6109e6f768c3569cd9d2fc7442430e4ee23ddf2b37adb78a15cc9818",
+"960c7982568543e9e53ca95a4c628cbaa7bbb8577f5322615c6941af8062adf8",
+"963f433e6b7951db55713c725167dbd4216c5c6d01370b99754ceae9f4e18642",
+"965681e7f07358f2d196161e6860cbd829ee5966d34f3bbb46e9277d560fb989",
+"96818f30d9b235e68b28c316cf7029dbf20c2e0d16f2debe110caebb4a225034",
+"96d528016fc5950086f4765bda9409cd26b7df81a17fef5dba77fa336e3de9f7",
+"972002ea7797057c5831ed7a2cb82aae213bcc5641339c58e8556ff928414a82",
+"97bdd087b96931caa4ea41f61d290963c804e1d8430debdac12429c679cf9f81",
+"97cb48f06c95c09926584ee5ffdc56d45f3de99a7570f04646a98c00e3b8c487",
+"97ec7e1fcb376cb896343cccdb6ea97513c1393106fbb364e99f21d46c74d4e0",
+"9838fb1fecb428eafb603868da1b0f1f508bcf5bfe27e2a0d39745537a6fa4f9",
+"9850924d93eec8e7b3b7b955569330dd8a8b5f7572b255a4dec9076c0a47bc06",
+"986411302eadab035718d661aa6c735948bce8d68f4f0783eaf6825b4d9f46c9",
+"9931e0254af3db5754d1e08d6fcf4c3820d0947ec3672ffa830b093978c2db1e",
+"994dabc41002868c99dcaa9d7de86ba0e18296d6785e22b8bdd08076eedfc17e",
+"9981b57c9dd647389deac43036c6896767ad71db1112c7301921a59ced26a23e",
+"99db87854457af324e0211dfe6f97ba87604bcda35a6fa10c0287405abab5765",
+"9a41e8a91368140b28eb6773518a7310e98887314f62dc733f7c1a82f0a6cb1e",
+"9a588a4e81ce8d43c96d1073c3457d4415e914c86a3ff90fcb612ab106bac23f",
+"9a67364ac11ecdc5811348e89a21e119b6050eddcdc16a029a4361894e95df78",
+"9ac8e8218f2dbbbd1748443002cf9ad3c481c1f36ffd2427e3763be168a32799",
+"9b938c78fb3bdd9e7a34053d016cde9b7823e0ccc38c6791a3b01d15a1f370d2",
+"9baa16010f16bc7b764709f3eaf92a5bb14d76eac02c037741fd77b6dcdcd29d",
+"9bea4fe25d3b52d19803ca35473adae1b6408ffdc9190285280ee41dcd896615",
+"9c90ae48f4d5cce2c2d8a64a533fa3c59f3cec96f0feb0145e224a430d7eff5c",
+"9ca64483536db9da5a14162c8aac253dd33f7f018a486275c6f906456fd82878",
+"9cb72f1dc8676d0df54a67bb2dd746cfbe2a4ba809a8f4d99449011d76c6ed39",
+"9d1f4a378f3798cc8a69fb2241e71b04ed2776ca6434ae824045f7c377011a43",
+"9d88f67809688dafb0362304fc26b2689dcc57babaabb7c203f74cc815fc5fa5",
+"9e7b193868686f5a690025114b818fbf3a1d46676402666660801fc87314cbad",
+"9e97b6e9a7e011b1b6bf78cfdd3302834a1bf96ecbc38d706c2d74f99070fae0",
+"9f0adc1282a4b164553ae8f10ddefc3d303fbcb3538d24355d2cb510aba99c30",
+"9f15413e8ab5759cb285356edd9f5f22b0b971ac5d8c21ee8d1586da0e43ddf7",
+"9f46dec3e34449bd0e8692cf8b22aa55d223f7dc0ca2f39da7aeda0b6eff5428",
+"9fa87fbb043ecb0fda6e2eb29a09acd6f59d23aa71a3ca75cfefef2a74680a12",
+"a0037761808460617d8f793c1cc349d48df6e8d7ae325b5c92c578b99191eec8",
+"a07c4e0faf155399c76c1fb6c200e3688748f59b771d9d41fee6f94a0f37febf",
+"a10d921b75fd3082ac887dd1fa5c98bb47b5f027a44c1635bad12889845c487f",
+"a1342900481a8eabfdf48dc51ab483f5b8709f0ebed0a495b9a4c18c303dd259",
+"a1b326f90456a57bcc8d5a6665f408b31966020d07d5dc362221744489c5d81d",
+"a1c8b2d9fd079e1711590675e96815132ce5a622a0a9b07db48ad5cd9ed69dea",
+"a1df9c2322cbc95e5b65a3a267b4c3eda7feb7d0a09fa8b64c1dc974c238ff0d",
+"a268819b63cfa1c0d4a283462521f73003227bf35ab155e03a87af4b507a14a1",
+"a2af0fddd50e13a3c7ed0797ecee9513d3cb410798a430a7ebad6cb5b8d71d4c",
+"a2c01880bb11231026916569ab42e0eb9d41890be718306d5d69eaac4d2f2e19",
+"a2c66b99927f838659b34671f6038c5b3dc2bad0c3d2c5d8752d856f483709dd",
+"a39c48de6cb7779ef92aec3af8883cfa81d6eae519f105f38e6c0fbb73824df2",
+"a3a46c69835b5fd06171f6a2cfc83c6f4d2f5b5f39489448d53c8c0d5e95c669",
+"a44c1e6c9a3c04a3dbf168bd70b703d62c1ccd33a77065503c3ecba7b7b85f19",
+"a57e862fb42d1f00165437a503bdc3cc34e2fbe9262114ba5d56a79cda30f638",
+"a5d62cd073cf491c4f3634b9eaef7fe116494c86216f693173b1e2aa4894f252",
+"a6e022c0dc7a240b0237c10530e915a1bd1986fb541eb2a68369f287aee0a2c0",
+"a75f7bae1926cc6ad2377cb67196fad79da1b43d4149abed4aca601e95ef9227",
+"a7861692be8e0bc46784cd5430a485d669bc6da8dfae7dc6e472a1f082a21e2a",
+"a79e92fa7e0fd60f2daf1de5f5ac9191533079d44aa676b4010ab64aa5ae0abd",
+"a7b16eb7763ba092874c8b8d12a7dd1d9c99b006077ded7ba15b488c647627a4",
+"a7bd65385cb425461f3e92ea698a982cfc752bff03281ac5a46b2c26df4b86c8",
+"a8b50db59c7c970a57328a5b84285e92cabbf76b96670fd4c262e38be3d272e7",
+"a8c8e1cb7f574d1c6157c1c82dd300914e9e36acc655876273e1c9df5b2a405c",
+"a8ef8a9a5903e6791bec55022809c968810d81ea243baee538ff9b090ddf27a5",
+"a99487098122cd814af0c5c5f2e9012eb70828fddbdb4f86917f04a697b0d888",
+"a9b8d7fbc112848dfb04dea8aeaad6019e24ffd86355274d8117c11110e8d5ba",
+"a9bc81dec122ecb9de649ffd057eb949aef9f98fa3c5609565474d22d85c1184",
+"a9ec28f3b83254c012b447bf4bd81040e5821f6f7ed02f59eb0097f2a8e636d5",
+"aab26cc88ea2900120968a8aa7443ee82f46d6031ad0651066c4cbf7e378cf31",
+"ab0640f11791b746b37779501a5d53fc3ef1bdc506d6e1cf118d894f5d93670c",
+"ab36c982efcb8829be9a9aca69149ef611fad0416d777041892a031dd895680c",
+"ab6f74d7bed4bd481420541f7144828f9a573852449dabc023ce4c782878b1b8",
+"abb6052674cfa72ba3ad05bfa9977ad06a581489d18a587ea047a0cfc1b678fb",
+"abba5d391df7e1f9250f6f7af5b009a6acd37a028a0184fc9b836fdd8f543eca",
+"abbf36b64fa4e92e460ec9307e8dd708ed3cc6d22a36749f565baaac222245c5",
+"ac8406e43e32a1bb95f9875a59a5fa114ac2787bbf05ea6597cf60694e2e9863",
+"ad0dcac6db656d7d875b0ec71d1205dfbce81270bfa01483328d372bdff64c2a",
+"ad217cc4bccd3c738bc382a12a9b93de26130d475212ea6ae722ea2ec9af2ee9",
+"ad2f12936300dc0d10db4f56c00d6fef18c3b4c69082172d8d7ab2b2e8207f02",
+"ad7e2b40a9eab0302070b99f6ea40c121d1aea5da3dbec4236e9f9f08b002609",
+"adbe4ba8f9d3262f8b633486bbf8f10ad9ddc58386b978c5bca3d9b49d9fc81f",
+"ae055fdf8a06a6f58c40f0e202fb0ac590b4ae3997ef327e8f4ce4fa33aeb87f",
+"ae2b8aa35e8094d6346d2ebca7a480a40297d86e97017c08895e7d7c71a8fdf5",
+"ae2d264eecdfe61233d84ea194fc8d8857803f54d31c110a8e19a9e5c9ed6ee5",
+"aea0261d3f68cf0b2f0cad9cc71c427ca7814274d602c9676c397e4d6be3de13",
+"aeb726404152cb54a5ec565605243d962cc74e2fc7c4300ac3b7a2070daf4e02",
+"aef40fe614f4f251a3f908675de85715e6ec0954c7f604485bd0389715081735",
+"aef4cea6053f392f4f1503d1febe5d7de5993a1ea0ac12f0f65f06ed47223a1a",
+"af18893a1a9240a1f1c4c0aca5ec89951f8b65825e8d2b566024a40df8ea28b2",
+"af1fc79f3f889d1bfb4fc33bf38ae53f44b68d2748733e2a1e668991063e9ccc",
+"afc8780fb693b811bf4def3af0068643cefee9a0426d043c4847c072fe8237cc",
+"b010df1d0ec472dedfccd4e55eeddf8ae7db2b63530b8860e98bc5e7a5f27afb",
+"b0582da89f0501e12fb2a33358e91d808b8dc4245ab75f6b562bff0449fb812a",
+"b06a9e1f02f54f1badf1f2ed580f44a49bc75001326ae2e052d58effc5690607",
+"b0caadc8d70bfdbc50d86d5c8909f8f788c8d2bb8fcc95ab425d0cd520f6a30e",
+"b0dc167c5dd640bc11d80240194a08b564d846fb4de6b6a8a56dcbc91dc93f54",
+"b12c2b0c03dc491d3ca8d4e4a76ec6455fa7d29904d25cf035da33bc3d823447",
+"b1305235b89d41c123c247b90354c5dd04b0b25dde66d030a5a33fb69c5e71a8",
+"b19d41b2876b1b84fe8d2d7c07b8af3d5184b73a2a5b0800f44d12727ea2e1ad",
+"b1a6024c016549dbe652dd0688a5afacfe3141104b08f458856f266ed4fb5d78",
+"b1b1109d1f273d341a2d8779752492e907435035b80c47fd7f6fd1e6e003d524",
+"b20780731457c01345b201f2b800493a0783b816dbffd141a6fa628e40adc783",
+"b2b6d8b575c6476874e56b415a41c00a0bf7140abc083cded1267520a30b92ec",
+"b2e76b114c737178d87265dea7d877374bbd51ded63bb6777c9d8f97a8a62e79",
+"b324355a3636e3856354f97c5be781d00c3826284f72afd7cf04b7f370102109",
+"b366e491d185e966654c6177f1a15d33c4e9b918d520ff964ca8a1e20d7364b0",
+"b3bfe06acdfeed6195d634e5c919ddbda471c23cf3e86f76ecbb050e502b209a",
+"b40ddc38f1ea16ded61aa940c12625e05cff36b6f2bbb986feb0951bdf4a43eb",
+"b434c48f255df85d31b17e90e65dfb25c4b5bacbb19d775138143498939709d0",
+"b4797c4e9bb26448c47d02d51c3adfe38f3346a9c252335240aa7ec5da5e9445",
+"b47a8567d1dc496314c56b80c9331dc6e8f28247c846a11b0c1f4b5a26c487df",
+"b48784b5970d3e335c09cb1eba026b894df76084a518b93a6c3ba6bde13a5e21",
+"b4de131f0835847f6c0944195ee391ac3e529e1189849b60128068df35540bd5",
+"b4f98b3af9856b3f2a32b5c6877c5d5e55c43fb8300699ac0adcee7bcf33a473",
+"b552bdfbb79852657752014d192f93456fa022cdc2fcdda10dae74be484cad8c",
+"b56cd77ba15ec85f04497ab1419171c0b9f246ca333da2150b7c53f9e3c9b210",
+"b580057169beac68fce1eea9633120ef293c51ddfb33ccd45fd0f0a350b5a097",
+"b5b7ffb7591a418f23bb6e86c2177ec46cdbb156bc165294309cba9f0bd1d6ab",
+"b5de82340dad7c55cf92a13246ba97d61fccf6cf40fd63012019d225fd74d9eb",
+"b5f17df753d3c28592d92b152bddb4077c3a759479a4b5ce60d5228c34fac199",
+"b6411c78662368f9e8b155e301f7e538262e199d2144e5173da27ce0a0f5b4ad",
+"b6c710e0ad8aec4c9431912db99b32eec4fbf639d0be7034b2cbb26aafd3b144",
+"b716334d46162d14ed687142d1cdb6d5fa9a05e2a2f5cce78c912004c65cd110",
+"b72cbbf92c2058e8b2e6bed13e8e4a1e9e390f240697c2938db1c58ee03dad75",
+"b769338e4c495dd909a7eb7da084ff10d35a741d7c80067f8f2c581212fd22ea",
+"b82901be1872986edddcbe9439ff720b8054c3b08a5e38bbce3015a5b6a55010",
+"b97fafb677f13099f6aeff36293b374de69760e9e72ebcb97f61520a6c4f4b1e",
+"b989308d1536863d9db45ac8e42878d43abc5b7df4277d8764319d968ef10423",
+"b9c5e1b262e7637c2216c91b3b5147d49156f436d8dc441eae81048bd299c4f5",
+"baab61a00bd4d7bd2c8f04e96e79c837628ec7afbdffe6cdc88259246a5e66cd",
+"bb4aab3610527e3839c6f20ca686ac5110e9c649f7f9c9a8d871ed626ba13f7b",
+"bb56d6bb55ea3f2a867d888f57402de5dbd1d57c64e13026fb2a9916777f4c06",
+"bba97d16b0ece6d3f905c99493c12481d6bf6d544b489d0ebfd25acca7d10283",
+"bc0cbd8524e5c5a58c8194358fa9f57366de89773dc6b85c66630f7211d76664",
+"bc5b47e7aa4b145f993e5a4626530a8aba0d0a9cd0c9c7a01ed9c00c472ad110",
+"bcb8d33c4d5800ee02204c0e5f77d99ead9e93fb2d489a185c73ce824fe6b9b1",
+"bcb9c1de4b0cbdef96a5bd669bae48932caec514fdfa6ffdf26aeb296e1eb2a2",
+"bce7eae397360531add3199b1c43abfb494ac9943711983d7d397aa7a9e368d7",
+"bd10d7c3a56b7a3131c47129fb697fbbedaee3e5cc22d5730d82d75620cdb59f",
+"bd46a400769f028c10ccad1bd617cfc9440d654d49315565da2b52f7af40f4a1",
+"be31a18f0e50f8a468b23f39a0596f2c281270a282250664b2171ab78fd5587a",
+"be3a2bac18a41222d32d9efeae26e284cb5e478aa4d05a57ed89d8bed30f7a96",
+"bea3bb5ea4707bdb78f13185719612de759c781edb72db47c78a49d45be347c1",
+"bee0e92a472f919e19ec4e908336362356694d4abdd106783aacd057c2b4b8e9",
+"bf196027b69a502b0671bc1293f1518017573d5213cf1e9a4522f435cbadadb8",
+"bf3388bb39347b9d560349ae7cc62f995c3659fc1e91e48b3ff26746e89efdce",
+"bfdb2f48ba58bb2d0e88db1f41c39b37d083d4e36b3e81d63f0e85c9ce495340",
+"c00c1bb66bd1d35b53c5c784cbc41708a0db3bfa6463466c6572372c3adde603",
+"c04cf3a35b2924da46bb56f2c42c9eb2ac5014f30942ddd1659d3e081bf45b86",
+"c063507aedcb18ef64e1c367fd3f99dc1d6df0833ae4e06855b6e26a61a5587c",
+"c076b9bc74d41380e974368f8e9f5cedec650b7a34d05cb1403eae299006b36b",
+"c14eeb0fd6cbf8e5a73ade705a71b9ed925d0224a6bd419da22a22d5e84824dc",
+"c17fb70536e8186a27ac60fb316ff675c303b9166394de2d8902badf07575974",
+"c1dbad0c77c358490379fe277796bb892ecdfbf3a5f9c96efaca5a2c268d1474",
+"c20e42c6aa09d6a0296fae6f955d9e6fe7498178ae53725bd4d45774bdcd6d8e",
+"c297df4e9a3a99b326036a19390ec46a58a516a0876103359e7825902f57c5f2",
+"c2b5dd210196e1ef8f820f0ce5c017cd297580d3675fd76669f0b939aaeef119",
+"c2c9d2a2d37c9c64873400c8a97a48ea23756791d2c27cbdcae40c67e8e09e57",
+"c2e59bec210c58cab2c03bf9840263c4c7ba533f79140dd1b51709647669cdd3",
+"c365cc2207f9e5f9db8e00d75d5fc815731be1f575584d94bcbdbeceb8525013",
+"c429fa8b870a00185c194676a9913f440faa3b6a6032c7f527e0581164fa7623",
+"c437651988e4d42b2e331085e2e0c4863678c3f45e7afd292063950c6d882913",
+"c4555ec46c8816a167fd0d9a57b20fd113b55533cc2f2abe9c6083fbe5692c6b",
+"c47befd652d8409e98a59a8aca4d4e95c2542a0f351dfc522d696fcacffd994e",
+"c4a567dae1f293b6f7c00144ec9e8eed0fd3722356503ee533a775fb0dd35388",
+"c5a6e251651bd86c68cc86af1fe8faafda5ad8f2289ca887328f52a29ee94a44",
+"c5b2f42047563560de7c9fea663a6d533daf867f4bc7a9f96b8d530767dc0b6e",
+"c718370de825454365759bbaa873018503bdf8d4adc65698976f570e12ecf1fc",
+"c753dabbd381192a3ae1a2d019109c827f6222d0467bee1d33abb6db72abdf9d",
+"c7a14721c158294649166e1c03c1f76e9e4d3d751e9fedbb459c25e702a103ce",
+"c8506fcd09617920aa5d2119915a30e8cc6af7a4796a7bdd877718e9d305b21e",
+"c8992e415aa942ba5358fd5e6e53c07bf65351f3de0647fb4aeeb7def66cba86",
+"c8c4fb4cbe3feb329f331be52d2585477401ffe095a40b11fed9326673fd3a6b",
+"c938ddf4e79af5f4d9285f2bc013dfa34e382354c0247b43743a326fffc2fa41",
+"c980317da408647218bc2b160f4c539c9f8df29c98170872905b80f3857a4677",
+"ca2d61aaec0d1e87736636254351adaa9cce221d2438789f667ba73e6cc12b1e",
+"ca3c07217581a477f08ca3b132668206a492f39c462fc12647578cd7b26e1ff3",
+"ca7ce14a0b81290042531b7c032fd9f8089eb2b7087b686b317002dd8bbe8897",
+"caeff231d079766aae72f201e4331302151020a027aa410254f243a3ccdf4efb",
+"cbf4831c8e75ee970300a4d4c7c2d87b788290011b823e6c846cd6076b2c93ab",
+"cc73637ad0e22b3b3585ca50243081084a5f3517cfc222852e9fc76a8e26b1bf",
+"cd307352b644cf036fc27945c96be2549fa5610067672bce6298d462bc830e23",
+"cd5e5d5fd4de27c89de257292871f5a26caaa9afce10662dd1d93db13258b9f1",
+"cd7a2781da6ae3a3f5cf4ed30ff3cf54e722426f212e0494b7da0aecb982fe89",
+"cd7d09a20a77bfc6796285e8249d96a4a1261186bd4d9d8601baa4657459b03d",
+"cd835bdb131eb088abccf217a0440fdd20e976f577cf5a51e9705b54a3013d0d",
+"cda012761d9ea46f666f5040645bc39fee1e38700da30cf27bcddade5afaad02",
+"ce28d8e985ac5cf6c2f78a2f8b82e787acd73d565d62f9880a57e18c234a5f0a",
+"ceb88b36b10113e603ff936a098bdcb204b328ad3e0f894e144562d69538ea36",
+"cf2cc52a18c025b686974063811839d96fe6e11a2ac4599f8c7e799812aaae9e",
+"cf78ee9c9b0521a2670f2bb624c97567dfc4469ec31a8152e550c4a62cf23327",
+"cfcac6db00bfe273971c230ec9243b0efaac96910bb11f568edd15b755ef7036",
+"cfeac78976af263f249b15ead23fe83e6673bd386eeff12ca2fbe64f7eb545db",
+"d02ce7d3d07d6869c24065937833cffb1a7be3fb390a26f1cc35cc69258bd5e3",
+"d0a31ece766760679869ef344747901716b6325566f2504e160e00b55f6e13e0",
+"d0b0edecc2754b23378a2deba86fc1567542c0fa01b31719ed7f598b004db77c",
+"d1099f2e68ec85718ad5b8afa0e967a375000fe811de0309b7293949512bb340",
+"d15fca50b66215ed68618e007cdf41a9074cff363191c22f5c0d94a813d83759",
+"d17e46cb8adbc8134005e8f61b4a71f1e8832096cb8d677973f25b89447822b5",
+"d1f85e7798206e3ced658f13efa1b22f371f502416a4c76dcc84a95fdc34c14a",
+"d24fc3761f86cdf8a45cd91cb8529c9ad0757c3c7becc4c4c9420bb75b7409bd",
+"d273f24e1fb42c4865ae8625dedd4f0794ed7a093c946b9497f377390d17efb7",
+"d279d7b37b88afc812eef157b9d094117a8ab406771bd51f15b0cc0ac1241c09",
+"d2b37cc1666547f482351ab4e3a885218620b9ee2289acc488224ab9cd92e5ec",
+"d2ef31b1bea4aca89879561c465d146fd21732a68fbf1f336d2411682f9aeeae",
+"d37600042a0dc24c3c52630ddaf9ada585008c875ca9c749013fcc77a4d4f849",
+"d3a3c13b88c7bb133d0b735028ebf11dd6566ec2df9e48310310a1dae38be310",
+"d3ce3f3b13a9b1e3ba3931877543690a130bdcc100db730dbda358aa94377a60",
+"d3d27bf868136fc08a26e02f42e34f0d29dda8eefbc909d09f1e933a79bf329f",
+"d4074d3d8942dc0608d72c13579bdb22c44592d65889967f6beff27ffb0feefb",
+"d55b2cb5d18db5cc94f1d0826fe3e89ac94169c1488c9d04263d9854800bfeca",
+"d585572df9894e6872a65a40455ca07889776738246de9a9486562871556ae46",
+"d5c0ae171ca8419e6cf8407e910ff2915ddedafe3ca8e919f5e2af194839f1d5",
+"d5e904942fcc73cd1a2251ba268341bee002355a7277486923c9165b191f5ec7",
+"d60657f4998a03c0524e102f0f0ada322ad099c09bee7303ae3a55ab8ec1c735",
+"d6aa4f66fd8974cc439120f2c7d42323c96fea84a72a9a6819ef273b0010205e",
+"d79098fcc974eac25a01462b39cfa188c58bb845dab8161a6ce222d8464457d2",
+"d7f65be17d2e568fc87f3819c83c7f31177a44fa0c59cdb3599436d16ab965bb",
+"d889ca1ef68c9517303a034feb79a92b48f7ce4e1a50640aa20a0931047f4ca4",
+"d8a89eb61979382bcb5f62b319416eb78f807c5b4fdbbe5f0cb3956fc4ceaffa",
+"d8eaf385489a10740ad12007936e881f934f95aff34a6f8735e13a1b2cee4b64",
+"d8fd80403353d74be6b70fabd8250af3e50608aa721bc25ac0ec70da68d173f4",
+"d954ec73765bd2a27e892d4f85f88ac89c79f19b7f8dfbf5f258e3868da91c67",
+"d97b8aebe877aaf37efa814ebea34025b0deda9614bf6a7af9d130f8062b3fcf",
+"d9a7f056ac14a1b7afc343a1d6eb77d7f793be6cf5ce020e8355e79bb9107bad",
+"d9bf4062737d0922cf8beb419d79bd10d109918e9d3d230b6b49ff4cf946ee2a",
+"d9da3401efadece6f2897480019392e0899292788fbaedbee9f8fc331ea9513f",
+"d9efe21a9864f1df26509a8855e9adb0b71c5705547c87badfc857765783d7c7",
+"da437cf386e897de8d5642e0dec11837ea1e07c166a1b84d1e6d1390a10db85d",
+"da54fa3af613f8765caa0bb59e303e5fb25f3f90b201393a4fb158610691c6ac",
+"db7f342f30d00a561706cb76ff7b83e5b829e0ca4c1e71fe84ab7270834a7fcf",
+"db928a47a72f274536a4b57c322abe94fb479e0e67e04cc02701dd81c492db91",
+"dbccdfe49a853ca57bd85b5bf43253d8adbedaa5b147d4acdd0cee8374937e86",
+"dbe6f7c497228cbc1588e9883fa734595764d72b80cae2bee25db8b25acc73d6",
+"dbee1566f0efe5a13bd30fe0f641b18cbd8e2a538cfd3a56d40cb1f4d698e262",
+"dc4379991a53e3ce036cbfa02a6b99604e07d96cfc7405778c934d1a82f20fa1",
+"dc5459e8f2ecaefedf1e4a3e0468b16be1a6747e84d93517c40728e856807f5a",
+"dc9228d30b8b4d057e0074c0b14a392f6803bdb9f5b37422106ce691b365a9ac",
+"dc9ffacc9addf3e213332023308352b5d44764685c128ddee3c10401ec97a104",
+"dcbb1ace2a6f7a2bd9c0e5f502157f58c539cbccb9102ad19c448420eacf46da",
+"dd165775188e3919e2b60aacb1c05a9bfd4170930d0c66977b242f53fb447817",
+"dd319175de2ad36b7aabd9caf1f82e2bc78c41e7578de8dfd7b3c83eefcf2cd2",
+"dd51bf6682526fa115c64634ff5553f274e3ecec7be49e6aef4ce08afba7df62",
+"de95fae0e69a18024ccbfd963ad3e90fa8f1fe41d5dcdbc47108ad068fbec14c",
+"debf8cdbadf0a2c8e86ca675a6182dc8f00b144f56fd4ffe698b630ba2e999e1",
+"df46c115235e8898f2e2358ac51feac4f2b7b3fc916c27540c1d272f20e804db",
+"dfbd41d6445ddc7f03cec7973064c5cf192b3893e35761af99a8914ba03a2a6c",
+"dfe18db81df6f1f0f5b2c109a7ab71de6f06e77a010e9d369ddd5fdea0e9f5ec",
+"e00d1ccc8e0ed4afea458197263c11c7fbca81a012abb9ff24b8bff1d8d2854d",
+"e0504f2880fc45b91b1adb9cb5429a6a34a831054740a1d65c52180c8e3f9cf2",
+"e0fcdb84a3d9c941ca5c1944b90b4da6d667070e0754fb8cbaf8205a9c91d567",
+"e104870dc3ca958946d33f1b7ab6f4cfdce24d961b88d675a9558f9bfd85403e",
+"e15eb2d351043d316fe22896479dd2422674095acf45dc2db4786b5f2b43032d",
+"e17a08f1eb0ba23a73cfbca1b48a3ec658578bc83aeb05e6126c88e6dc29aba7",
+"e1a00654d2353cafb43c775a8624bbc4fab9f695a2c097fc8c5de50cf08f462c",
+"e21940677a5f743c2fc27e2a279b55c09bfa361384c02d07d8607d6956591685",
+"e2cec60c12296e2b3789a9c4b8ac6bd76cda2fe7f1a50c2629b2483e3c930c55",
+"e307a4df677faa92f6e85f43312354fd6370c8a3c33518366119b25fc47a66e1",
+"e38443201e62cb574f3397836fcd9da97ec025b546409bbff0ee2081d0951db7",
+"e394d03a6a5e51b3c868968f53a3548deb1292387778cb22d290472482922c5b",
+"e3bbe57a14ba62501fdc3e3d36f78e2a38c64c445c5f22b6d966bb78a823f118",
+"e3e8284c1188042095954cf4f6ec853423f5ce4c5996bb98d9396c0e9aa74bb9",
+"e3eb601e0015928c147e428c8d72877d8d7dc623b9cfc908b2bc1f08252ea94a",
+"e40e5be5285a9ce9a330dece3abbdbe407545a34e8e39ef24879580d6a391f03",
+"e49237f3e4fc2160a04474a9ff106618f680b04be02a9e24183bd5f220066723",
+"e4b271df75c9c2b94e01ff6e7a58454ba2aca88bb4431e0445954c165ba97350",
+"e5022890f5b5ecebd3722699843c45a2f08d624390c548c2f8659663ab17399e",
+"e542d90bd41c9b6249722d45c14f54bf47c95db03c0c9f0e3450fb094cc3d63d",
+"e560aaa3f2b491eac0da7d7479460079d3432367a92caf3fe1b67b2db53e92a1",
+"e68589a565dd6069a2444b8834be5d3ced4835dfd129541b10c58d51dbd39985",
+"e7a70b434856327affd65c039053de8fa19f800bb16fc73086a6b9d2976f1617",
+"e7a87b10cc8bfcbc7a8e2530be3bf2dc23246d1e29d514049ebe87af59ea5e71",
+"e7bb9726671d76cf6ef5919c78e4c1d904d7fe8197ef5ff297b0015bc4c53a3b",
+"e8204ccb0300efa2d6e121c8d4e450aa6b01b6c8d6b4e9339cf13a6731fdd461",
+"e8454e8bbb495307bbefe2ee5b4ce837c32892469011aeb2c09933ee8c4ebba5",
+"e85208179116b084b3fea974b4a7f164a0122caa212cde1ae82c795939642547",
+"e85bdb284cf0bd0a9e63b1df14ce07ce53139eb035fb9282ebb3bf3d4af394ce",
+"e89247485988bb302570652a1e4cf3a1958ffa077d43486c2dbe2ea1cf65bf7c",
+"e8ce42aac8d587beba0e3d0d715f9a2fb6ca230fc67c040902b58eb106d19f6c",
+"e9035322640d48d2cfdfb9199e1064f92d2da340da305a985b896ea7b3e2e37b",
+"e92e211fc6c86e7c1f847f960a091e175606d23b6d7aed38a72fd374ae606f7e",
+"e9a91c0da816a442aa627d244cfe46abe17dcca5e76a6cc7c2acf696fb8b2520",
+"e9e77d64b7698a7dad24f02f8494bcc0fbe47d10c73716ec4442f7198a8829f8",
+"ea37b4fe424a64cbc95b7093e3a279836e19b03fe16817a74474be47f93289fc",
+"ea47a57617a0590d7f896fe742facf77747d276bbe1b5719638992cfe4a52bf6",
+"ea4bcd854c3b4b6bec01d92a1cb49018e070a511c61d0bc86c4346a422073fbf",
+"ea736551ceb0ab959f62073af46b7efbb71871870c1ffb46c6e7e1f5a83e0866",
+"ea995b512deaccc8ea88803c8a9e996be26dcb6cf0c12c17fc3ea3854c250c8d",
+"eaaa261868a16884114b6cfbeb4e3e65a2eb137f39dd7f69b3030fa5bdd22bbc",
+"eb00929fdbf0d4cd45a8b2ee8caf1256b0603168e3b20fa29c7ebc39c0a23772",
+"ebb0b2d72619fc2d257fa52b78e65b211dd2d6ce76d32b9b324426df2e1c5ecf",
+"ec0e758bdcb1ae68462c29fdf2d4f20c8e09d0904927264e72e2e7287b6d271b",
+"ec612369c2aa8dfbf0cefc549409a0545334ae5cfb2e56a3b5a6a9a41b06249e",
+"eccb5a564c70cb85f91a811c662e7afffef0d3d5dc4886b06517997057b0a60f",
+"ed26e5cf870c915a83adcdeec47e21347b5fd5b03259526ca2b81d36747c31c4",
+"ed4270e30e333bf701f20361c17d421e38227a51047bc3eae18c7f8c6dd5762c",
+"ed9d1e5e5ba43e8e510e7fdda1efad9e32a1884e3ad7c2e6cd834ef45e1e3355",
+"ede85333561aed003365ad8b57174ceef9a4b0de25c28d37f9034b37f697e07c",
+"edf2e6a1590698c8054c9cf250078becfe2441df4fde73a7a558b07a0472cfef",
+"ee40740192cd453b2c641de2bba88df7474fdfb1504bd0845f03cd37fae59dcc",
+"ee9ff5c1cb28a8c058dc5dfd50985da0f381bdc47a0473d3d23a41bdc75b3d59",
+"ef97cb159f44b3b69174978f478a613d1692fa421fd663753c85eb3f9780b0fc",
+"efc6743d0ddf8df7f5d82fb10ce827a2286379cf44323439c74b79279a73b320",
+"efc85cddf7d1a472ccd0ec82d3a5377d33737abbf40b9065f8c1885245959464",
+"efd9c9a1b7749203678822d7125b163a7c67c80bb99f38ad298d1aad5b4247d2",
+"f023ff5d0ad206a1c422784c3321867f2c824cdbd09caebf5530d8511a8a56d5",
+"f0b79da81682b38adc4c6e38b8be91c189c906d0311c984ee40267cb1b89e561",
+"f0c2299b2bb601e8063c20ffdc82726b057d34735f64d39e59f43d7aecfa97ea",
+"f128f2de7c744738ddd4c057ae2b2ac6d1ceb87b1453e7cc496161378028ede3",
+"f16706f77f543fcb26266b8bc68f4e1808de3508d28e238c8726d243dc96b0a6",
+"f1d5daa0fce126ca0af2ad5dfb227b3f26ffde13b67e5e93b5a340c5beb662cb",
+"f205bd88ccdabbb5ce92729683cf948455eb2c2c62966bee336679e19c5ae1ab",
+"f20699cbf5d0021f5109964c0f409fa375269c08ecc18bc5c2ea683b78f077a9",
+"f2257bececf0597c7e75b1437971c9e25e103cf2342ecbd43c8321ad4a694eb3",
+"f2afcca96fa4c0d371a8968dc9854bfe3c93651138b1ba404765ac6153763abc",
+"f3154baac6c2aaa1a0f60b9e6346e8527c3cbef0957e516c6510e60bb1a6b049",
+"f34fbe2616ebb67d9452b8de2b3a635f8ac8f901f27f0e78f90ad67cd717d01c",
+"f38635193466e0640ded241bc65c8e6271b2e97ee6f034eb3d15e493fcc98e21",
+"f3be3caafbf6ce96c22e5760118ea10e5dcee54e7362b6ad5faf5d2e72bd2219",
+"f40355a6aaffdc6abecf7841882e89f09ce22e5862412a69be27856f07c50694",
+"f40e1d415f4a06d636f599b117eab1f78491fda01c22b4c58d74ba763fcc9967",
+"f421b7794c933d42d0f621110fdf83e6cecb9e0daf6115a1353067656bf00154",
+"f44daf264918aada933b32c273c47d25bfa7df3b99ec9d1b7577ec1f4de5f135",
+"f4875a185942d2412996b4a41acdc414f051857e4ccefb47e5b5980e42fbe21b",
+"f48fb16798184cd8209fd58ddb485448312a682b2a4b27db494222030074c0b6",
+"f5f111b4d867afb0542376f4f2336d2c0207f8c7c9d656be8c597dd1ced4c5e7",
+"f70551627671a19df2b3c0f2ee3cea32f7c51f18ed182cf9940717c50b9b21f5",
+"f764671a9cdb1a6d628362ffaaa4c1f3993127cf93338ecce6cc7e379b14836f",
+"f78d40802fe7acf0429328f62314ddf01ed2519d18d6e53842e8dcff73e11f77",
+"f7b98db27513a908b9e06db2027732a523e7ebbd3b5ad84ccafddb4e4a7900db",
+"f7d0e158d1c48df2d4ee8f5576ca2f7cc5b63b96880889dcb6ad51e1f862a006",
+"f7ea2ad234f459872c9685a7474153b19b5cd3f2dde0c0b380a916cebd592904",
+"f85221328757ed6455c58bc99566385296b61ce0d81850f753497b8d903286fd",
+"f95827680d8086fcc57d6c0ac20c3ffbb4cf2e43284a0476eae394fd31943f60",
+"f9a9fa28e2b655611abd82385150c3ea4c3fbe6e6afc90898afc6ef0372c8df2",
+"f9d0535631531461caccc2c9ca35d6946de92baa74c3e21222ad404b2024cfef",
+"f9f5ae9f5c18bd9da2beb8fc0024074e55c9bec996ff93b6071ee288b81c5e3b",
+"fa14c6041ac91197b514ea23b22817989fb7b4cde8aa032f80eec4dcbee22569",
+"fa5985a05a4b5ec8f1db752d817d333e5f3448389655957366870de9478bb122",
+"faa34da3759411dae9a6204e173386b6e5bb7f94036efdab2166d0fb9496881c",
+"fad7be4b8fe0a26f5898dda03b6a60085b54bc5124536a429b39702cc8eb787b",
+"fae874b4ce3ce46aae80f7630ad9ab9ba317df82b691e6e21cad1230ca3152d4",
+"fafb2476fbc9db2a0ede05f3f77a8d3711f042926fcc0489e0bd9e53487fc2a8",
+"fb02bce3b91a812df5f077057babb8c9ebdf4f8fc0a2b385908e9a52874ba35a",
+"fc342e353e05e9ddf2b41e4716fb1443561c54c05b2efa7394a3a21577536821",
+"fc4b293224aebbbae23f4f53de140ae63489fa625f7c5529b0556b910de0a082",
+"fcb8c30bb82581f10524860608984d3e4d10b3d079a910669f2b9804bd41782e",
+"fd583ca51085a3c6a6ecaa3d663c0cc8b24d3388da67c390def870d50108bb2a",
+"fd7c2f510e6d33761ba2fe13192320ee9083f0a54dd6919d2fad3c03e251a07d",
+"fda52a3b10ee7ea69de6581cf73cc6743e1907793d54ea3b6bff2a6b3e30a999",
+"fe4ca8118469dee2e99bd55809740819330d90f9f891912057938e79de6702fb",
+"fe7332fe5f0046cc2e46df0cab2fb40ec0506802d976489eea058a86bc33dfac",
+"ff1d6b445ad5b8e8074b8fbfd8bd567c76b56a38064d5dcae2768de6bdbb8072",
+"ff6a9cce4312a4b325b51c47315b0e0bf5b2b0c6caef36eca94454d9a1b0670b",
+"ff94ba01f44100f1971ecd8f2f25d77f70bda878bf78bf4a6463f33d396049ed",
+"ff991aac154f93e0fa9077c9ddda952d5219124698e4e222c6f02b0f5e30dc62",
 };
 // static int64_t anon_index_whitelist[] = {};
 
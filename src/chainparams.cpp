@@ -17,6 +17,7 @@
 #include <chain/chainparamsimport.h>
 
 #include <assert.h>
+#include <limits>
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -26,21 +27,10 @@ int64_t CChainParams::GetCoinYearReward(int64_t nTime) const
 {
     static const int64_t nSecondsInYear = 365 * 24 * 60 * 60;
 
-    if (strNetworkID != "regtest") {
-        // After HF2: 8%, 8%, 7%, 7%, 6%
-        // if (nTime >= consensus.exploit_fix_2_time) {
-        //     int64_t nPeriodsSinceHF2 = (nTime - consensus.exploit_fix_2_time) / (nSecondsInYear * 2);
-        //     if (nPeriodsSinceHF2 >= 0 && nPeriodsSinceHF2 < 2) {
-        //         return (8 - nPeriodsSinceHF2) * CENT;
-        //     }
-        //     return 6 * CENT;
-        // }
-
-        // Y1 5%, Y2 4%, Y3 3%, Y4 2%, ... YN 2%
-        int64_t nYearsSinceGenesis = (nTime - genesis.nTime) / nSecondsInYear;
-        if (nYearsSinceGenesis >= 0 && nYearsSinceGenesis < 3) {
-            return (5 - nYearsSinceGenesis) * CENT;
-        }
+    // Y1 5%, Y2 4%, Y3 3%, Y4 2%, ... YN 2%, fixed on regtest
+    int64_t nYearsSinceGenesis = (nTime - genesis.nTime) / nSecondsInYear;
+    if (nYearsSinceGenesis >= 0 && nYearsSinceGenesis < (int64_t)m_schedule.coin_year_reward.size()) {
+        return m_schedule.coin_year_reward[nYearsSinceGenesis];
     }
 
     return nCoinYearReward;
@@ -53,6 +43,7 @@ bool CChainParams::PushTreasuryFundSettings(int64_t time_from, TreasuryFundSetti
     }
 
     vTreasuryFundSettings.emplace_back(time_from, settings);
+    CompileSchedule();
 
     return true;
 };
@@ -113,9 +104,9 @@ CAmount CChainParams::GetProofOfStakeRewardAtYear(const int year) const
 
 CAmount CChainParams::GetProofOfStakeRewardAtHeight(const int nHeight) const
 {
-    const CAmount nBlocksInAYear = (365 * 24 * 60 * 60) / GetTargetSpacing();
-    const int currYear = nHeight / nBlocksInAYear;
-    CAmount nSubsidy = GetProofOfStakeRewardAtYear(currYear);
+    const int64_t currYear = nHeight / m_schedule.blocks_per_year;
+    const auto& year_reward = m_schedule.year_reward;
+    CAmount nSubsidy = currYear >= 0 && currYear < (int64_t)year_reward.size() ? year_reward[currYear] : year_reward.back();
     if(nHeight >= consensus.nBlockRewardIncreaseHeight)
         nSubsidy *= nBlockRewardIncrease;
 
@@ -130,14 +121,55 @@ int64_t CChainParams::GetProofOfStakeReward(const CBlockIndex *pindexPrev, const
 
 const TreasuryFundSettings *CChainParams::GetTreasuryFundSettings(int nHeight) const
 {
+    const auto& treasury = m_schedule.treasury;
+    auto it = std::upper_bound(treasury.begin(), treasury.end(), (int64_t)nHeight,
+        [](int64_t height, const std::pair<int64_t, int>& entry) { return height < entry.first; });
+    if (it == treasury.begin() || (--it)->second < 0) {
+        return nullptr;
+    }
+
+    return &vTreasuryFundSettings[it->second].second;
+}
+
+void CChainParams::CompileSchedule()
+{
+    m_schedule.blocks_per_year = std::max((int64_t)1, (int64_t)(365 * 24 * 60 * 60) / (nTargetSpacing ? nTargetSpacing : 1));
 
-    for (auto i = vTreasuryFundSettings.begin(); i != vTreasuryFundSettings.end(); ++i) {
-         if (nHeight >= i->first) {
-             return &i->second;
-         }
+    // One past the table is the rate of every later year
+    m_schedule.year_reward.clear();
+    for (size_t year = 0; year <= nBlockPerc.size(); ++year) {
+        m_schedule.year_reward.push_back(GetProofOfStakeRewardAtYear(year));
+    }
+
+    m_schedule.coin_year_reward.clear();
+    if (strNetworkID != "regtest") {
+        for (int64_t year = 0; year < 3; ++year) {
+            m_schedule.coin_year_reward.push_back((5 - year) * CENT);
+        }
     }
 
-    return nullptr;
+    // The first entry of vTreasuryFundSettings with a start at or below the
+    // height applies, resolve that at each height an entry starts from.
+    std::vector<int64_t> starts{std::numeric_limits<int64_t>::min()};
+    for (const auto& entry : vTreasuryFundSettings) {
+        starts.push_back(entry.first);
+    }
+    std::sort(starts.begin(), starts.end());
+    starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+
+    m_schedule.treasury.clear();
+    for (int64_t height : starts) {
+        int index = -1;
+        for (size_t i = 0; i < vTreasuryFundSettings.size(); ++i) {
+            if (height >= vTreasuryFundSettings[i].first) {
+                index = i;
+                break;
+            }
+        }
+        if (m_schedule.treasury.empty() || m_schedule.treasury.back().second != index) {
+            m_schedule.treasury.emplace_back(height, index);
+        }
+    }
 }
 
 bool CChainParams::IsBech32Prefix(const std::vector<unsigned char> &vchPrefixIn) const
@@ -651,7 +683,11 @@ public:
 
        anonRestricted = DEFAULT_ANON_RESTRICTED;
 
-       blacklistedAnonTxs.insert(anon_index_blacklist.begin(), anon_index_blacklist.end());
+       blacklistedAnonTxs.assign(anon_index_blacklist.begin(), anon_index_blacklist.end());
+       std::sort(blacklistedAnonTxs.begin(), blacklistedAnonTxs.end());
+       blacklistedAnonTxs.erase(std::unique(blacklistedAnonTxs.begin(), blacklistedAnonTxs.end()), blacklistedAnonTxs.end());
+
+       CompileSchedule();
     }
 
     void SetOld()
@@ -838,6 +874,8 @@ public:
             /* dTxRate  */ 0
         };
         blacklistedAnonTxs = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+
+        CompileSchedule();
     }
 };
 
@@ -954,7 +992,7 @@ public:
         anonRestricted = gArgs.GetBoolArg("-anonrestricted", DEFAULT_ANON_RESTRICTED);
 
         std::string blacklisted = gArgs.GetArg("-blacklistedanon", "");
-        blacklistedAnonTxs = GetAnonIndexFromString(blacklisted);
+        SetBlacklistedAnonOutput(GetAnonIndexFromString(blacklisted));
     }
 };
 
@@ -1067,7 +1105,7 @@ public:
         m_is_mockable_chain = true;
 
         std::string blacklisted = gArgs.GetArg("-blacklistedanon", "");
-        blacklistedAnonTxs = GetAnonIndexFromString(blacklisted);
+        SetBlacklistedAnonOutput(GetAnonIndexFromString(blacklisted));
 
         checkpointData = {
             {
@@ -1120,6 +1158,8 @@ public:
         consensus.gvrThreshold = gArgs.GetArg("-gvrthreshold", DEFAULT_GVR_THRESHOLD);
         consensus.minRewardRangeSpan = gArgs.GetArg("-minrewardrangespan", DEFAULT_MIN_REWARD_RANGE_SPAN);
         consensus.agvrStartPayingHeight = gArgs.GetArg("-startpayingheight", 0);
+
+        CompileSchedule();
     }
 
     void SetOld()
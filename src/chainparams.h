@@ -13,6 +13,7 @@
 #include <protocol.h>
 #include <validation.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -161,6 +162,7 @@ public:
     {
         assert(strNetworkID == "regtest");
         nCoinYearReward = nCoinYearReward_;
+        CompileSchedule();
     }
     Consensus::Params& GetConsensus_nc() { assert(strNetworkID == "regtest"); return consensus; }
 
@@ -168,6 +170,7 @@ public:
     {
         assert(strNetworkID == "regtest");
         nBlockReward = nBlockReward_;
+        CompileSchedule();
     }
 
     void SetAnonRestricted(bool bFlag) {
@@ -194,16 +197,16 @@ public:
         return anonMaxOutputSize;
     }
 
-    std::set<std::uint64_t> GetBlacklistedAnonOutputs() {
+    const std::vector<std::uint64_t>& GetBlacklistedAnonOutputs() const {
         return blacklistedAnonTxs;
     }
 
     bool IsBlacklistedAnonOutput(std::uint64_t index) const {
-        return blacklistedAnonTxs.count(index);
+        return std::binary_search(blacklistedAnonTxs.begin(), blacklistedAnonTxs.end(), index);
     }
 
     void SetBlacklistedAnonOutput(const std::set<std::uint64_t>& anonIndexes){
-        blacklistedAnonTxs = anonIndexes;
+        blacklistedAnonTxs.assign(anonIndexes.begin(), anonIndexes.end());
     }
 
     MapCheckpoints GetGvrCheckpoints() const {
@@ -213,6 +216,9 @@ public:
 protected:
     CChainParams() {}
 
+    /** Rebuild m_schedule, called at the end of the constructors and by the setters of the fields it reads. */
+    void CompileSchedule();
+
     Consensus::Params consensus;
     CMessageHeader::MessageStartChars pchMessageStart;
     int nDefaultPort;
@@ -237,6 +243,13 @@ protected:
     // the `first` of the pair here is the Height 
     std::vector<std::pair<int64_t, TreasuryFundSettings> > vTreasuryFundSettings;
 
+    /** Reward and treasury lookups by height, compiled from the fields above so they need no scan per block or stake attempt */
+    struct Schedule {
+        int64_t blocks_per_year = 1;
+        std::vector<CAmount> year_reward;               // base reward by year, the last entry holds for later years
+        std::vector<int64_t> coin_year_reward;          // by year since genesis, nCoinYearReward after
+        std::vector<std::pair<int64_t, int> > treasury; // ascending heights an index into vTreasuryFundSettings applies from, -1 for none
+    } m_schedule;
 
     uint64_t nPruneAfterHeight;
     uint64_t m_assumed_blockchain_size;
@@ -254,7 +267,7 @@ protected:
     bool m_is_mockable_chain;
     CCheckpointData checkpointData;
     ChainTxData chainTxData;
-    std::set<std::uint64_t> blacklistedAnonTxs;
+    std::vector<std::uint64_t> blacklistedAnonTxs; // sorted
     MapCheckpoints gvrCheckpoints;
 };
 
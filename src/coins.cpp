@@ -37,7 +37,14 @@ SaltedOutpointHasher::SaltedOutpointHasher() : k0(GetRand(std::numeric_limits<ui
 CCoinsViewCache::CCoinsViewCache(CCoinsView *baseIn) : CCoinsViewBacked(baseIn), cachedCoinsUsage(0) { }
 
 size_t CCoinsViewCache::DynamicMemoryUsage() const {
-    return memusage::DynamicUsage(cacheCoins) + cachedCoinsUsage;
+    return memusage::DynamicUsage(cacheCoins) + cachedCoinsUsage +
+           m_dirty_order.size() * sizeof(decltype(m_dirty_order)::value_type);
+}
+
+void CCoinsViewCache::NoteDirty(const COutPoint &outpoint) const {
+    if (m_track_dirty) {
+        m_dirty_order.emplace_back(m_dirty_generation, outpoint);
+    }
 }
 
 CCoinsMap::iterator CCoinsViewCache::FetchCoin(const COutPoint &outpoint) const {
@@ -93,9 +100,12 @@ void CCoinsViewCache::AddCoin(const COutPoint &outpoint, Coin&& coin, bool possi
         //
         // If the coin doesn't exist in the current cache, or is spent but not
         // DIRTY, then it can be marked FRESH.
-        fresh = !(it->second.flags & CCoinsCacheEntry::DIRTY);
+        fresh = !(it->second.flags & (CCoinsCacheEntry::DIRTY | CCoinsCacheEntry::WRITING));
     }
     it->second.coin = std::move(coin);
+    if (!(it->second.flags & CCoinsCacheEntry::DIRTY)) {
+        NoteDirty(outpoint);
+    }
     it->second.flags |= CCoinsCacheEntry::DIRTY | (fresh ? CCoinsCacheEntry::FRESH : 0);
     cachedCoinsUsage += it->second.coin.DynamicMemoryUsage();
 
@@ -147,6 +157,9 @@ bool CCoinsViewCache::SpendCoin(const COutPoint &outpoint, Coin* moveout) {
     if (it->second.flags & CCoinsCacheEntry::FRESH) {
         cacheCoins.erase(it);
     } else {
+        if (!(it->second.flags & CCoinsCacheEntry::DIRTY)) {
+            NoteDirty(outpoint);
+        }
         it->second.flags |= CCoinsCacheEntry::DIRTY;
         it->second.coin.Clear();
     }
@@ -202,6 +215,7 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlockIn
                 entry.coin = std::move(it->second.coin);
                 cachedCoinsUsage += entry.coin.DynamicMemoryUsage();
                 entry.flags = CCoinsCacheEntry::DIRTY;
+                NoteDirty(it->first);
                 // We can mark it FRESH in the parent if it was FRESH in the child
                 // Otherwise it might have just been flushed from the parent's cache
                 // and already exist in the grandparent
@@ -229,6 +243,9 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlockIn
                 cachedCoinsUsage -= itUs->second.coin.DynamicMemoryUsage();
                 itUs->second.coin = std::move(it->second.coin);
                 cachedCoinsUsage += itUs->second.coin.DynamicMemoryUsage();
+                if (!(itUs->second.flags & CCoinsCacheEntry::DIRTY)) {
+                    NoteDirty(it->first);
+                }
                 itUs->second.flags |= CCoinsCacheEntry::DIRTY;
                 // NOTE: It isn't safe to mark the coin as FRESH in the parent
                 // cache. If it already existed and was spent in the parent
@@ -238,6 +255,7 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlockIn
         }
     }
     hashBlock = hashBlockIn;
+    m_dirty_generation++;
     return true;
 }
 
@@ -245,9 +263,60 @@ bool CCoinsViewCache::Flush() {
     bool fOk = base->BatchWrite(cacheCoins, hashBlock);
     cacheCoins.clear();
     cachedCoinsUsage = 0;
+    m_dirty_order.clear();
     return fOk;
 }
 
+void CCoinsViewCache::SetTrackDirty(bool track)
+{
+    m_track_dirty = track;
+    if (!track) {
+        m_dirty_order.clear();
+        return;
+    }
+    for (const auto& entry : cacheCoins) {
+        if (entry.second.flags & CCoinsCacheEntry::DIRTY) {
+            NoteDirty(entry.first);
+        }
+    }
+}
+
+size_t CCoinsViewCache::TakeOldestDirty(CCoinsMap &batch, size_t max_entries, uint32_t min_age)
+{
+    size_t taken = 0;
+    while (taken < max_entries && !m_dirty_order.empty()) {
+        const auto& front = m_dirty_order.front();
+        if (m_dirty_generation - front.first < min_age) {
+            break;
+        }
+        CCoinsMap::iterator it = cacheCoins.find(front.second);
+        if (it != cacheCoins.end() && (it->second.flags & CCoinsCacheEntry::DIRTY)) {
+            CCoinsCacheEntry& entry = batch[it->first];
+            entry.coin = it->second.coin;
+            entry.flags = CCoinsCacheEntry::DIRTY;
+            // Once written the base has the coin, so it's no longer FRESH
+            it->second.flags = CCoinsCacheEntry::WRITING;
+            taken++;
+        }
+        m_dirty_order.pop_front();
+    }
+    return taken;
+}
+
+void CCoinsViewCache::FinishWriteback(const CCoinsMap &batch)
+{
+    for (const auto& written : batch) {
+        CCoinsMap::iterator it = cacheCoins.find(written.first);
+        if (it == cacheCoins.end()) {
+            continue;
+        }
+        it->second.flags &= ~CCoinsCacheEntry::WRITING;
+        if (it->second.flags == 0 && it->second.coin.IsSpent()) {
+            cacheCoins.erase(it);
+        }
+    }
+}
+
 void CCoinsViewCache::Uncache(const COutPoint& hash)
 {
     CCoinsMap::iterator it = cacheCoins.find(hash);
@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <stdint.h>
 
+#include <deque>
 #include <functional>
 #include <unordered_map>
 #include <insight/addressindex.h>
@@ -31,6 +32,7 @@ extern bool fParticlMode;
  * Serialized format:
  * - VARINT((coinbase ? 1 : 0) | (height << 1))
  * - the non-spent CTxOut (via TxOutCompression)
+ * - Particl: the output type and commitment (via ParticlCoinCompression)
  */
 class Coin
 {
@@ -92,12 +94,11 @@ public:
         assert(!IsSpent());
         uint32_t code = nHeight * uint32_t{2} + fCoinBase;
         ::Serialize(s, VARINT(code));
-        ::Serialize(s, Using<TxOutCompression>(out));
-        if (!fParticlMode) return;
-        ::Serialize(s, nType);
-        if (nType == OUTPUT_CT) {
-            s.write((char*)&commitment.data[0], 33);
+        if (!fParticlMode) {
+            ::Serialize(s, Using<TxOutCompression>(out));
+            return;
         }
+        ParticlCoinCompression::Ser(s, out, nType, commitment);
     }
 
     template<typename Stream>
@@ -106,12 +107,11 @@ public:
         ::Unserialize(s, VARINT(code));
         nHeight = code >> 1;
         fCoinBase = code & 1;
-        ::Unserialize(s, Using<TxOutCompression>(out));
-        if (!fParticlMode) return;
-        ::Unserialize(s, nType);
-        if (nType == OUTPUT_CT) {
-            s.read((char*)&commitment.data[0], 33);
+        if (!fParticlMode) {
+            ::Unserialize(s, Using<TxOutCompression>(out));
+            return;
         }
+        ParticlCoinCompression::Unser(s, out, nType, commitment);
     }
 
     bool IsSpent() const {
@@ -209,6 +209,13 @@ struct CCoinsCacheEntry
          * when this cache is flushed.
          */
         FRESH = (1 << 1),
+        /**
+         * WRITING means a copy of the coin taken by TakeOldestDirty is being
+         * written to the base. The entry is neither uncached nor marked
+         * FRESH until the write finished, reads from the base would return
+         * the coin as it was before.
+         */
+        WRITING = (1 << 2),
     };
 
     CCoinsCacheEntry() : flags(0) {}
@@ -322,6 +329,12 @@ public:
     mutable std::map<CCmpPubKey, uint256> keyImages;
     mutable std::vector<std::pair<COutPoint, SpentCoin> > spent_cache;
 
+    /* Outpoints in the order they became dirty, tagged with the number of batches
+     * written into this cache at the time, kept for background writeback. */
+    bool m_track_dirty = false;
+    uint32_t m_dirty_generation = 0;
+    mutable std::deque<std::pair<uint32_t, COutPoint> > m_dirty_order;
+
     bool ReadRCTOutputLink(CCmpPubKey &pk, int64_t &index)
     {
         std::map<CCmpPubKey, int64_t>::iterator it = anonOutputLinks.find(pk);
@@ -404,6 +417,20 @@ public:
      */
     void Uncache(const COutPoint &outpoint);
 
+    //! Keep the order entries become dirty in, for TakeOldestDirty
+    void SetTrackDirty(bool track);
+
+    /**
+     * Copy up to max_entries of the oldest dirty entries into batch, ignoring
+     * those dirtied in the last min_age batches written into this cache.
+     * The entries stay cached marked WRITING instead of DIRTY or FRESH, the
+     * batch must reach the base before the next Flush.
+     */
+    size_t TakeOldestDirty(CCoinsMap &batch, size_t max_entries, uint32_t min_age);
+
+    //! Clear WRITING from the entries of a batch written to the base and drop the spent ones
+    void FinishWriteback(const CCoinsMap &batch);
+
     //! Calculate the size of the cache (in number of transaction outputs)
     unsigned int GetCacheSize() const;
 
@@ -426,6 +453,8 @@ private:
      * memory usage.
      */
     CCoinsMap::iterator FetchCoin(const COutPoint &outpoint) const;
+
+    void NoteDirty(const COutPoint &outpoint) const;
 };
 
 //! Utility function to add all of a transaction's outputs to a cache.
@@ -1,6 +1,8 @@
 ﻿#include "coldrewardtracker.h"
 #include <logging.h>
 
+#include <algorithm>
+
 
 boost::optional<CAmount> ColdRewardTracker::getBalanceInCache(const AddressType& addr)
 {
@@ -61,13 +63,29 @@ int ColdRewardTracker::getCheckpoint()
     return *this->lastCheckpoint;
 }
 
+void ColdRewardTracker::updateBalanceCache(const AddressType& addr, CAmount balance)
+{
+    if (!balancesBefore.count(addr)) {
+        balancesBefore.emplace(addr, std::make_pair(getBalanceInCache(addr), dirtyBalances.count(addr) > 0));
+    }
+    balances[addr] = balance;
+    dirtyBalances.insert(addr);
+}
+
 void ColdRewardTracker::updateAddressRangesCache(const AddressType& addr, std::vector<BlockHeightRange>&& ranges)
 {
+    if (!rangesBefore.count(addr)) {
+        rangesBefore.emplace(addr, std::make_pair(getAddressRangesInCache(addr), dirtyRanges.count(addr) > 0));
+    }
     addressesRanges[addr] = ranges;
+    dirtyRanges.insert(addr);
 }
 
 void ColdRewardTracker::updateCheckpointCache(int newCheckpoint)
 {
+    if (!checkpointBefore) {
+        checkpointBefore = lastCheckpoint;
+    }
     lastCheckpoint = newCheckpoint;
 }
 
@@ -83,20 +101,70 @@ void ColdRewardTracker::startPersistedTransaction()
     transactionStarter();
 }
 
-void ColdRewardTracker::endPersistedTransaction()
+void ColdRewardTracker::writeCache()
 {
-    for (auto&& p : balances) {
-        balanceSetter(p.first, p.second);
+    for (const auto& addr : dirtyBalances) {
+        balanceSetter(addr, balances.at(addr));
     }
-    for (auto&& p : addressesRanges) {
-        rangesSetter(p.first, p.second);
+    for (const auto& addr : dirtyRanges) {
+        rangesSetter(addr, addressesRanges.at(addr));
     }
     if(lastCheckpoint) {
         checkpointSetter(*lastCheckpoint);
     }
-    transactionEnder();
+}
+
+void ColdRewardTracker::clearCache()
+{
     addressesRanges.clear();
     balances.clear();
+    dirtyBalances.clear();
+    dirtyRanges.clear();
+}
+
+void ColdRewardTracker::endPersistedTransaction()
+{
+    if (!keepCache) {
+        writeCache();
+    }
+    if (eligibleAddressesLoaded) {
+        for (const auto& it : rangesBefore) {
+            const AddressType& addr = it.first;
+            const std::vector<BlockHeightRange>& ranges = addressesRanges.at(addr);
+            if (ranges.empty()) {
+                eligibleAddresses.erase(addr);
+                continue;
+            }
+            EligibleEntry& entry = eligibleAddresses[addr];
+            entry.validFrom = std::numeric_limits<int>::max();
+            entry.validTo = std::numeric_limits<int>::min();
+            entry.ranges = ranges;
+        }
+    }
+    balancesBefore.clear();
+    rangesBefore.clear();
+    checkpointBefore = boost::none;
+    eligibleSnapshot.reset();
+    transactionEnder();
+    if (!keepCache) {
+        clearCache();
+    }
+}
+
+void ColdRewardTracker::setKeepCache(bool keep)
+{
+    if (keepCache && !keep) {
+        flushCache();
+    }
+    keepCache = keep;
+}
+
+void ColdRewardTracker::flushCache()
+{
+    transactionStarter();
+    writeCache();
+    transactionEnder();
+    clearCache();
 }
 
 const std::vector<std::pair<ColdRewardTracker::AddressType, CAmount>> ColdRewardTracker::getBalances() {
@@ -114,9 +182,41 @@ const std::vector<std::pair<ColdRewardTracker::AddressType, CAmount>> ColdReward
 
 void ColdRewardTracker::revertPersistedTransaction()
 {
-    addressesRanges.clear();
-    balances.clear();
-    transactionEnder();
+    if (keepCache) {
+        for (const auto& it : balancesBefore) {
+            if (it.second.first) {
+                balances[it.first] = *it.second.first;
+            } else {
+                balances.erase(it.first);
+            }
+            if (!it.second.second) {
+                dirtyBalances.erase(it.first);
+            }
+        }
+        for (const auto& it : rangesBefore) {
+            if (it.second.first) {
+                addressesRanges[it.first] = *it.second.first;
+            } else {
+                addressesRanges.erase(it.first);
+            }
+            if (!it.second.second) {
+                dirtyRanges.erase(it.first);
+            }
+        }
+    } else {
+        clearCache();
+    }
+    if (checkpointBefore) {
+        lastCheckpoint = *checkpointBefore;
+    }
+    balancesBefore.clear();
+    rangesBefore.clear();
+    checkpointBefore = boost::none;
+    if (transactionAborter) {
+        transactionAborter();
+    } else {
+        transactionEnder();
+    }
 }
 
 boost::optional<int> ColdRewardTracker::GetLastCheckpoint(const std::map<int, uint256> &checkpoints, int currentBlockHeight)
@@ -149,7 +249,18 @@ unsigned ColdRewardTracker::ExtractRewardMultiplierFromRanges(int currentBlockHe
 
     const auto& ar = addressRanges;
 
-    for(unsigned i = 0; i < ar.size(); i++) {
+    // Ranges are in height order, only the ones starting or ending within the last MinimumRewardRangeSpan blocks
+    // and the one before them can change the result. Older ranges with a multiplier are skipped below, and an older
+    // range without one only matters if it ends exactly MinimumRewardRangeSpan blocks ago.
+    const int windowStart = currentBlockHeight - MinimumRewardRangeSpan;
+    const std::size_t firstInWindow = std::partition_point(ar.begin(), ar.end(),
+        [windowStart](const BlockHeightRange& r) { return r.getEnd() <= windowStart && r.getStart() < windowStart; }) - ar.begin();
+    std::size_t firstToCheck = firstInWindow;
+    while (firstToCheck > 0 && (firstToCheck == firstInWindow || ar[firstToCheck - 1].getEnd() == windowStart)) {
+        firstToCheck--;
+    }
+
+    for(unsigned i = 0; i < ar.size() - firstToCheck; i++) {
         const unsigned idx = ar.size() - i - 1;
         // Now we're getting the elig addr every block
         // AssertTrue(currentBlockHeight > ar[idx].getStart(), std::string(__func__), "You can't get the reward for the past");
@@ -194,38 +305,120 @@ unsigned ColdRewardTracker::ExtractRewardMultiplierFromRanges(int currentBlockHe
     }
 }
 
+void ColdRewardTracker::loadEligibleAddresses()
+{
+    eligibleAddresses.clear();
+    for (auto&& r : allRangesGetter()) {
+        if (!r.second.empty()) {
+            eligibleAddresses[r.first].ranges = std::move(r.second);
+        }
+    }
+    // Ranges kept in the cache aren't persisted yet
+    for (const auto& addr : dirtyRanges) {
+        const std::vector<BlockHeightRange>& ranges = addressesRanges.at(addr);
+        if (ranges.empty()) {
+            eligibleAddresses.erase(addr);
+        } else {
+            eligibleAddresses[addr] = EligibleEntry();
+            eligibleAddresses[addr].ranges = ranges;
+        }
+    }
+    eligibleAddressesLoaded = true;
+    eligibleAddressesSpan = MinimumRewardRangeSpan;
+    eligibleAddressesMinHeight = std::numeric_limits<int>::min();
+}
+
+void ColdRewardTracker::updateEligibleEntry(const AddressType& addr, EligibleEntry& entry, int currentBlockHeight)
+{
+    if (!entry.ranges) {
+        const auto cached = getAddressRangesInCache(addr);
+        entry.ranges = cached ? *cached : rangesGetter(addr);
+    }
+    entry.multiplier = ExtractRewardMultiplierFromRanges(currentBlockHeight, *entry.ranges);
+
+    // ExtractRewardMultiplierFromRanges compares the distances to the start and end of each range with
+    // MinimumRewardRangeSpan (==, < and <=), its result is constant between these heights
+    entry.validFrom = std::numeric_limits<int>::min();
+    entry.validTo = std::numeric_limits<int>::max();
+    for (const auto& range : *entry.ranges) {
+        for (const int edge : {range.getStart(), range.getEnd()}) {
+            for (const int h : {edge + MinimumRewardRangeSpan, edge + MinimumRewardRangeSpan + 1}) {
+                if (h <= currentBlockHeight) {
+                    entry.validFrom = std::max(entry.validFrom, h);
+                } else {
+                    entry.validTo = std::min(entry.validTo, h);
+                }
+            }
+        }
+    }
+    if (entry.validTo == std::numeric_limits<int>::max()) {
+        entry.ranges = boost::none;
+    }
+}
+
 std::vector<std::pair<ColdRewardTracker::AddressType, unsigned>> ColdRewardTracker::getEligibleAddresses(int currentBlockHeight)
 {
-    const std::map<AddressType, std::vector<BlockHeightRange>> ranges = allRangesGetter();
+    if (!eligibleAddressesLoaded
+        || eligibleAddressesSpan != MinimumRewardRangeSpan
+        || currentBlockHeight < eligibleAddressesMinHeight) {
+        loadEligibleAddresses();
+    }
     std::vector<std::pair<AddressType, unsigned>> result;
 
-    for(const auto& r: ranges) {
-        const std::vector<BlockHeightRange>& ar = r.second;
-        // AssertTrue(ar.empty() || ar.back().getEnd() <= currentBlockHeight, __func__, "You cannot ask for addresses eligible for rewards in the past");
-        const unsigned rewardMultiplier = ExtractRewardMultiplierFromRanges(currentBlockHeight, ar);
-        if(rewardMultiplier > 0)
+    for (auto it = eligibleAddresses.begin(); it != eligibleAddresses.end(); ) {
+        EligibleEntry& entry = it->second;
+        if (currentBlockHeight < entry.validFrom || currentBlockHeight >= entry.validTo) {
+            updateEligibleEntry(it->first, entry, currentBlockHeight);
+            if (entry.multiplier == 0 && entry.validTo == std::numeric_limits<int>::max()) {
+                // can only become eligible again through a new transaction, or at a lower height
+                eligibleAddressesMinHeight = std::max(eligibleAddressesMinHeight, entry.validFrom);
+                it = eligibleAddresses.erase(it);
+                continue;
+            }
+        }
+        if(entry.multiplier > 0)
         {
             // over the range of the last MinimumRewardRangeSpan, the minimum multiplier determines the reward
             // Example: if over the last (month=MinimumRewardRangeSpan, and GVRThreshold=20k),
             // the balance goes below 40k, but remains over 20k, the max multiplier is 2 and minimum is 1, and the reward
             // multiplier is 1
-            result.push_back(std::make_pair(r.first, rewardMultiplier));
+            result.push_back(std::make_pair(it->first, entry.multiplier));
         }
+        ++it;
     }
     return result;
 }
 
-void ColdRewardTracker::RemoveOldData(int lastCheckpoint, std::vector<BlockHeightRange>& ranges)
+std::shared_ptr<const std::vector<ColdRewardTracker::EligibleBalance>> ColdRewardTracker::getEligibleSnapshot(int currentBlockHeight)
 {
-    if (ranges.size() > 0) {
-        auto itr = ranges.begin();
-        while (itr != ranges.end()) {
-            if(itr->getStart() < lastCheckpoint && itr->getEnd() < lastCheckpoint)
-                ranges.erase(itr);
-            else
-                ++itr;
-        }
+    if (eligibleSnapshot && eligibleSnapshotHeight == currentBlockHeight && eligibleSnapshotSpan == MinimumRewardRangeSpan) {
+        return eligibleSnapshot;
+    }
+    std::vector<EligibleBalance> snapshot;
+    for (auto&& it : getEligibleAddresses(currentBlockHeight)) {
+        const boost::optional<CAmount> cached = getBalanceInCache(it.first);
+        const CAmount balance = cached ? *cached : balanceGetter(it.first);
+        snapshot.push_back(EligibleBalance{std::move(it.first), it.second, balance});
     }
+    eligibleSnapshot = std::make_shared<const std::vector<EligibleBalance>>(std::move(snapshot));
+    eligibleSnapshotHeight = currentBlockHeight;
+    eligibleSnapshotSpan = MinimumRewardRangeSpan;
+    return eligibleSnapshot;
+}
+
+void ColdRewardTracker::resetEligibleAddresses()
+{
+    eligibleSnapshot.reset();
+    eligibleAddresses.clear();
+    eligibleAddressesLoaded = false;
+}
+
+void ColdRewardTracker::RemoveOldData(int lastCheckpoint, std::vector<BlockHeightRange>& ranges)
+{
+    // Ranges are appended in height order, the ones ending before the checkpoint are a prefix
+    const auto itr = std::partition_point(ranges.begin(), ranges.end(),
+        [lastCheckpoint](const BlockHeightRange& r) { return r.getEnd() < lastCheckpoint; });
+    ranges.erase(ranges.begin(), itr);
 }
 
 void ColdRewardTracker::addAddressTransaction(int blockHeight, const AddressType& address, const CAmount& balanceChange, const std::map<int, uint256>& checkpoints)
@@ -240,7 +433,7 @@ void ColdRewardTracker::addAddressTransaction(int blockHeight, const AddressType
 
     const std::size_t rangesSizeBefore = ranges.size();
 
-    balances[address] = balance;
+    updateBalanceCache(address, balance);
 
     // Don't store any range related to a negative balance
     if (balance < 0) {
@@ -286,7 +479,7 @@ void ColdRewardTracker::removeAddressTransaction(int blockHeight, const AddressT
     // Since we're allowing negative balance to be stored during addAddressTransaction
     // Negative balance here just means we saw outputs first 
     // AssertTrue(balance >= 0, __func__, "Can't apply, total address balance will be negative");
-    balances[address] = balance;                                                                                                                                                                                                                                                                                                                                                                                                                   
+    updateBalanceCache(address, balance);
     std::vector<BlockHeightRange> ranges = getAddressRanges(address);
     LogPrintf("%s Attempt to remove block at height %s for address %s ranges size %d\n", __func__, blockHeight, std::string(address.begin(), address.end()), ranges.size());
 
@@ -341,6 +534,11 @@ void ColdRewardTracker::setPersisterTransactionEnder(const std::function<void()>
     transactionEnder = func;
 }
 
+void ColdRewardTracker::setPersistedTransactionAborter(const std::function<void()>& func)
+{
+    transactionAborter = func;
+}
+
 void ColdRewardTracker::setPersistedCheckpointGetter(const std::function<int()>& func)
 {
     checkpointGetter = func;
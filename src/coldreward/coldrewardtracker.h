@@ -4,7 +4,10 @@
 #include "blockheightrange.h"
 #include <boost/optional.hpp>
 #include <functional>
+#include <limits>
 #include <map>
+#include <memory>
+#include <set>
 #include <vector>
 
 #include "amount.h"
@@ -45,25 +48,54 @@
  * For this, there are setter functions for the setters and getters of these.
  * To aid performance, all these actions should be done within a transaction.
  *
+ * Only the balances and ranges changed during the transaction are passed to the setters, the setters and the
+ * transaction functions can so collect the changes and commit them together when the transaction ends.
+ *
  * To do any change, do the following:
  * 1. call startPersistedTransaction()
  * 2. call addAddressTransaction() or removeAddressTransaction() based on your needs, to add store changes in balances
  * 3a. if you want to persist the cached results, call endPersistedTransaction()
  * 3b. if you want to revert the result, call revertPersistedTransaction()
  *
+ * Rebuilding:
+ * With setKeepCache(true) endPersistedTransaction() keeps the cached balances and ranges and doesn't pass them to the
+ * setters, flushCache() does. An address changed in many blocks is so read and written once, revertPersistedTransaction()
+ * restores the cache entries the transaction changed.
+ *
+ * Eligible addresses:
+ * getEligibleAddresses() reads all persisted ranges only once, after that endPersistedTransaction() updates the
+ * addresses that changed. The multiplier of an address only changes when the height crosses the start or end of one of
+ * its ranges plus MinimumRewardRangeSpan, so each address keeps its multiplier with the heights it holds for and is only
+ * recomputed outside of them. getEligibleSnapshot() adds the balances and keeps the result until the next transaction
+ * ends, for callers outside of block validation asking for the same height.
+ *
  */
 class ColdRewardTracker
 {
 public:
     using AddressType = std::vector<uint8_t>;
 
+    struct EligibleBalance {
+        AddressType address;
+        unsigned multiplier;
+        CAmount balance;
+    };
+
     CAmount GVRThreshold;
     int MinimumRewardRangeSpan;
 
 private:
     std::map<AddressType, std::vector<BlockHeightRange>> addressesRanges;
     std::map<AddressType, CAmount> balances;
+    std::set<AddressType> dirtyBalances;
+    std::set<AddressType> dirtyRanges;
     boost::optional<int> lastCheckpoint;
+    bool keepCache = false;
+
+    /// The cache entries and whether they were dirty before the running transaction changed them
+    std::map<AddressType, std::pair<boost::optional<CAmount>, bool>> balancesBefore;
+    std::map<AddressType, std::pair<boost::optional<std::vector<BlockHeightRange>>, bool>> rangesBefore;
+    boost::optional<boost::optional<int>> checkpointBefore;
 
     std::function<CAmount(const AddressType&)> balanceGetter;
     std::function<void(const AddressType&, const CAmount&)> balanceSetter;
@@ -77,22 +109,47 @@ private:
 
     std::function<void()> transactionStarter;
     std::function<void()> transactionEnder;
+    /// discards what the setters collected, revertPersistedTransaction calls transactionEnder if not set
+    std::function<void()> transactionAborter;
 
     std::function<std::map<AddressType, std::vector<BlockHeightRange>>()> allRangesGetter;
 
+    /// The reward multiplier of an address, valid for heights in [validFrom, validTo)
+    struct EligibleEntry {
+        unsigned multiplier = 0;
+        int validFrom = std::numeric_limits<int>::max();
+        int validTo = std::numeric_limits<int>::min();
+        /// persisted ranges, dropped once the multiplier can't change for any later height
+        boost::optional<std::vector<BlockHeightRange>> ranges;
+    };
+    std::map<AddressType, EligibleEntry> eligibleAddresses;
+    bool eligibleAddressesLoaded = false;
+    int eligibleAddressesSpan = 0;
+    /// Addresses that can't become eligible again are dropped, heights below this need a reload
+    int eligibleAddressesMinHeight = std::numeric_limits<int>::min();
+
+    std::shared_ptr<const std::vector<EligibleBalance>> eligibleSnapshot;
+    int eligibleSnapshotHeight = 0;
+    int eligibleSnapshotSpan = 0;
+
 protected:
     boost::optional<CAmount> getBalanceInCache(const AddressType& addr);
     boost::optional<std::vector<BlockHeightRange>> getAddressRangesInCache(const AddressType& addr);
     CAmount getBalance(const AddressType& addr);
     std::vector<BlockHeightRange> getAddressRanges(const AddressType& addr);
+    void updateBalanceCache(const AddressType& addr, CAmount balance);
     void updateAddressRangesCache(const AddressType& addr, std::vector<BlockHeightRange>&& ranges);
     boost::optional<int> getCheckpointInCache();
     void updateCheckpointCache(int new_checkpoint);
     int getCheckpoint();
+    void writeCache();
+    void clearCache();
 
 
     static void AssertTrue(bool valueShouldBeTrue, const std::string& functionName, const std::string& msg);
     void RemoveOldData(int lastCheckpoint, std::vector<BlockHeightRange>& ranges);
+    void loadEligibleAddresses();
+    void updateEligibleEntry(const AddressType& addr, EligibleEntry& entry, int currentBlockHeight);
 
 public:
     ColdRewardTracker() = default;
@@ -103,12 +160,22 @@ public:
     void endPersistedTransaction();
     void revertPersistedTransaction();
 
+    /// Keep the cache between transactions, turning it off flushes the cache
+    void setKeepCache(bool keep);
+    /// Pass the balances and ranges changed since the last flush to the setters in a persisted transaction
+    void flushCache();
+    std::size_t cacheSize() const { return balances.size() + addressesRanges.size(); }
+
     static boost::optional<int> GetLastCheckpoint(const std::map<int, uint256>& checkpoints, int currentBlockHeight);
     /// Given a set of ranges of an address, this gives all the multipliers that have to do with the reward at currentBlockHeight
     unsigned ExtractRewardMultiplierFromRanges(int currentBlockHeight, const std::vector<BlockHeightRange>& addressRanges);
 
 
     std::vector<std::pair<AddressType, unsigned>> getEligibleAddresses(int currentBlockHeight);
+    /// The eligible addresses at currentBlockHeight with their balances, ordered by address
+    std::shared_ptr<const std::vector<EligibleBalance>> getEligibleSnapshot(int currentBlockHeight);
+    /// Drop the eligible addresses, call when the persisted ranges were changed without this class
+    void resetEligibleAddresses();
 
     void addAddressTransaction(int blockHeight, const AddressType& address, const CAmount& balanceChange, const std::map<int, uint256>& checkpoints);
     void removeAddressTransaction(int blockHeight, const AddressType& address, const CAmount& balanceChangeInBlock);
@@ -121,6 +188,7 @@ public:
 
     void setPersistedTransactionStarter(const std::function<void()>& func);
     void setPersisterTransactionEnder(const std::function<void()>& func);
+    void setPersistedTransactionAborter(const std::function<void()>& func);
 
     void setPersistedCheckpointGetter(const std::function<int()>& func);
     void setPersistedCheckpointSetter(const std::function<void(int)>& func);
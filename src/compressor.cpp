@@ -8,6 +8,8 @@
 #include <pubkey.h>
 #include <script/standard.h>
 
+bool fCompactCoins = false;
+
 /*
  * These check for scripts for which a special case with a shorter encoding is defined.
  * They are implemented separately from the CScript test, as these test for exact byte
@@ -137,6 +139,131 @@ bool DecompressScript(CScript& script, unsigned int nSize, const std::vector<uns
     return false;
 }
 
+/*
+ * Particl scripts not covered by the special cases above. Cold staking
+ * scripts keep their stake branch as a P2PKH and are stored as the two
+ * hashes.
+ *   0x00 P2PKH256 (32), 0x01 P2SH256 (32)
+ *   0x02 cold stake to P2PKH (20 + 20), 0x03 cold stake to P2SH (20 + 20)
+ *   0x04 cold stake to P2PKH256 (20 + 32), 0x05 cold stake to P2SH256 (20 + 32)
+ */
+
+static bool IsColdStake(const CScript& script, size_t spend_size)
+{
+    const size_t end = 28 + spend_size;
+    return script.size() == end + 1
+        && script[0] == OP_ISCOINSTAKE
+        && script[1] == OP_IF
+        && script.MatchPayToPublicKeyHash(2)
+        && script[27] == OP_ELSE
+        && script[end] == OP_ENDIF;
+}
+
+bool CompressParticlScript(const CScript& script, std::vector<unsigned char> &out)
+{
+    if (script.IsPayToPublicKeyHash256()) {
+        out.resize(33);
+        out[0] = 0x00;
+        memcpy(&out[1], &script[3], 32);
+        return true;
+    }
+    if (script.IsPayToScriptHash256()) {
+        out.resize(33);
+        out[0] = 0x01;
+        memcpy(&out[1], &script[2], 32);
+        return true;
+    }
+    if (!script.StartsWithICS()) {
+        return false;
+    }
+    if (IsColdStake(script, 25) && script.MatchPayToPublicKeyHash(28)) {
+        out.resize(41);
+        out[0] = 0x02;
+        memcpy(&out[1], &script[5], 20);
+        memcpy(&out[21], &script[31], 20);
+        return true;
+    }
+    if (IsColdStake(script, 23) && script.MatchPayToScriptHash(28)) {
+        out.resize(41);
+        out[0] = 0x03;
+        memcpy(&out[1], &script[5], 20);
+        memcpy(&out[21], &script[30], 20);
+        return true;
+    }
+    if (IsColdStake(script, 37) && script.MatchPayToPublicKeyHash256(28)) {
+        out.resize(53);
+        out[0] = 0x04;
+        memcpy(&out[1], &script[5], 20);
+        memcpy(&out[21], &script[31], 32);
+        return true;
+    }
+    if (IsColdStake(script, 35) && script.MatchPayToScriptHash256(28)) {
+        out.resize(53);
+        out[0] = 0x05;
+        memcpy(&out[1], &script[5], 20);
+        memcpy(&out[21], &script[30], 32);
+        return true;
+    }
+    return false;
+}
+
+unsigned int GetParticlScriptSize(unsigned int nKind)
+{
+    if (nKind == 0x00 || nKind == 0x01)
+        return 32;
+    if (nKind == 0x02 || nKind == 0x03)
+        return 40;
+    if (nKind == 0x04 || nKind == 0x05)
+        return 52;
+    return 0;
+}
+
+bool DecompressParticlScript(CScript& script, unsigned int nKind, const std::vector<unsigned char> &in)
+{
+    if (GetParticlScriptSize(nKind) == 0 || in.size() != GetParticlScriptSize(nKind)) {
+        return false;
+    }
+    CScript spend;
+    switch (nKind) {
+    case 0x00:
+        script.resize(37);
+        script[0] = OP_DUP;
+        script[1] = OP_SHA256;
+        script[2] = 32;
+        memcpy(&script[3], in.data(), 32);
+        script[35] = OP_EQUALVERIFY;
+        script[36] = OP_CHECKSIG;
+        return true;
+    case 0x01:
+        script.resize(35);
+        script[0] = OP_SHA256;
+        script[1] = 32;
+        memcpy(&script[2], in.data(), 32);
+        script[34] = OP_EQUAL;
+        return true;
+    case 0x02:
+        DecompressScript(spend, 0x00, std::vector<unsigned char>(in.begin() + 20, in.end()));
+        break;
+    case 0x03:
+        DecompressScript(spend, 0x01, std::vector<unsigned char>(in.begin() + 20, in.end()));
+        break;
+    case 0x04:
+        DecompressParticlScript(spend, 0x00, std::vector<unsigned char>(in.begin() + 20, in.end()));
+        break;
+    case 0x05:
+        DecompressParticlScript(spend, 0x01, std::vector<unsigned char>(in.begin() + 20, in.end()));
+        break;
+    }
+    CScript stake;
+    DecompressScript(stake, 0x00, std::vector<unsigned char>(in.begin(), in.begin() + 20));
+    script = CScript() << OP_ISCOINSTAKE << OP_IF;
+    script.insert(script.end(), stake.begin(), stake.end());
+    script << OP_ELSE;
+    script.insert(script.end(), spend.begin(), spend.end());
+    script << OP_ENDIF;
+    return true;
+}
+
 // Amount compression:
 // * If the amount is 0, output 0
 // * first, divide the amount (in base units) by the largest power of 10 possible; call the exponent e (e is max 9)
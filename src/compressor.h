@@ -14,6 +14,9 @@
 bool CompressScript(const CScript& script, std::vector<unsigned char> &out);
 unsigned int GetSpecialScriptSize(unsigned int nSize);
 bool DecompressScript(CScript& script, unsigned int nSize, const std::vector<unsigned char> &out);
+bool CompressParticlScript(const CScript& script, std::vector<unsigned char> &out);
+unsigned int GetParticlScriptSize(unsigned int nKind);
+bool DecompressParticlScript(CScript& script, unsigned int nKind, const std::vector<unsigned char> &in);
 
 /**
  * Compress amount.
@@ -103,4 +106,92 @@ struct TxOutCompression
     FORMATTER_METHODS(CTxOut, obj) { READWRITE(Using<AmountCompression>(obj.nValue), Using<ScriptCompression>(obj.scriptPubKey)); }
 };
 
+/** Flags kept in the high bits of the output type byte of a stored Particl coin */
+static const uint8_t COIN_TYPE_MASK = 0x1f;
+//! CT commitment stored without its 0x08 / 0x09 prefix byte
+static const uint8_t COIN_FLAG_COMMITMENT_EVEN = 0x20;
+static const uint8_t COIN_FLAG_COMMITMENT_ODD = 0x40;
+//! scriptPubKey stored after the commitment by CompressParticlScript, the CTxOut holds an empty script
+static const uint8_t COIN_FLAG_PARTICL_SCRIPT = 0x80;
+
+/** Layouts of coins in the chainstate and of undo data, recorded in the block tree database */
+static const int COINS_FORMAT_LEGACY = 0;
+static const int COINS_FORMAT_COMPACT = 1;
+static const int COINS_FORMAT_CURRENT = COINS_FORMAT_COMPACT;
+
+/** Write coins and undo data in the compact layout. Older versions can't read
+ *  it, so it's only enabled for a chainstate built from scratch, see LoadCoinsFormat */
+extern bool fCompactCoins;
+
+/** Compact serializer for the Particl part of a stored coin.
+ *
+ *  Entries written before the flags existed have none set and read back
+ *  unchanged: the full script in the CTxOut and a 33 byte commitment.
+ *  Without fCompactCoins no flags are set when writing.
+ */
+struct ParticlCoinCompression
+{
+    template<typename Stream>
+    static void Ser(Stream &s, const CTxOut& out, uint8_t nType, const secp256k1_pedersen_commitment& commitment)
+    {
+        uint8_t flags = 0;
+        std::vector<unsigned char> compr;
+        if (fCompactCoins && CompressParticlScript(out.scriptPubKey, compr)) {
+            flags |= COIN_FLAG_PARTICL_SCRIPT;
+        }
+        if (fCompactCoins && nType == OUTPUT_CT) {
+            if (commitment.data[0] == 0x08) {
+                flags |= COIN_FLAG_COMMITMENT_EVEN;
+            } else if (commitment.data[0] == 0x09) {
+                flags |= COIN_FLAG_COMMITMENT_ODD;
+            }
+        }
+        if (flags & COIN_FLAG_PARTICL_SCRIPT) {
+            CTxOut stub(out.nValue, CScript());
+            ::Serialize(s, Using<TxOutCompression>(stub));
+        } else {
+            ::Serialize(s, Using<TxOutCompression>(out));
+        }
+        ::Serialize(s, uint8_t(nType | flags));
+        if (nType == OUTPUT_CT) {
+            if (flags & (COIN_FLAG_COMMITMENT_EVEN | COIN_FLAG_COMMITMENT_ODD)) {
+                s.write((char*)&commitment.data[1], 32);
+            } else {
+                s.write((char*)&commitment.data[0], 33);
+            }
+        }
+        if (flags & COIN_FLAG_PARTICL_SCRIPT) {
+            s << MakeSpan(compr);
+        }
+    }
+
+    template<typename Stream>
+    static void Unser(Stream &s, CTxOut& out, uint8_t& nType, secp256k1_pedersen_commitment& commitment)
+    {
+        ::Unserialize(s, Using<TxOutCompression>(out));
+        uint8_t type_flags;
+        ::Unserialize(s, type_flags);
+        nType = type_flags & COIN_TYPE_MASK;
+        if (nType == OUTPUT_CT) {
+            if (type_flags & (COIN_FLAG_COMMITMENT_EVEN | COIN_FLAG_COMMITMENT_ODD)) {
+                commitment.data[0] = (type_flags & COIN_FLAG_COMMITMENT_ODD) ? 0x09 : 0x08;
+                s.read((char*)&commitment.data[1], 32);
+            } else {
+                s.read((char*)&commitment.data[0], 33);
+            }
+        }
+        if (type_flags & COIN_FLAG_PARTICL_SCRIPT) {
+            uint8_t nKind;
+            ::Unserialize(s, nKind);
+            const unsigned int nSize = GetParticlScriptSize(nKind);
+            if (nSize == 0) {
+                throw std::ios_base::failure("Unknown compressed Particl script");
+            }
+            std::vector<unsigned char> vch(nSize, 0x00);
+            s >> MakeSpan(vch);
+            DecompressParticlScript(out.scriptPubKey, nKind, vch);
+        }
+    }
+};
+
 #endif // BITCOIN_COMPRESSOR_H
@@ -14,6 +14,7 @@
 
 #include <timedata.h>
 #include <util/system.h>
+#include <util/trace.h>
 
 // TODO remove the following dependencies
 #include <chain.h>
@@ -25,6 +26,7 @@
 
 // Ghost dependencies
 #include <blind.h>
+#include <proofcache.h>
 #include <insight/balanceindex.h>
 #include <adapter.h>
 
@@ -321,7 +323,7 @@ bool Consensus::CheckTxInputs(const CTransaction& tx, TxValidationState& state,
         }
     }
 
-    if (!txSpendingBlacklisted.count(tx.GetHash()) && state.m_spends_frozen_blinded && max_ring_size > 1) {
+    if (!isTxSpendingBlacklisted(tx.GetHash()) && state.m_spends_frozen_blinded && max_ring_size > 1) {
         return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-frozen-ringsize");
     }
 
@@ -568,13 +570,23 @@ static bool CheckBlindOutput(TxValidationState &state, const CTxOutCT *p)
     if (state.m_skip_rangeproof) {
         return true;
     }
+    if (state.m_rangeproof_checks) {
+        AddRangeProofCheck(*state.m_rangeproof_checks, state.fBulletproofsActive, state.m_cache_store,
+            &p->commitment, &p->vRangeproof, "bad-ctout-rangeproof-verify");
+        return true;
+    }
+    const uint256 cache_entry = RangeProofCacheEntry(state.fBulletproofsActive, p->commitment.data, p->vRangeproof);
+    if (ProofCacheContains(cache_entry, !state.m_cache_store)) {
+        return true;
+    }
 
     uint64_t min_value = 0, max_value = 0;
     int rv = 0;
 
+    TRACE_TIME_START(trace_start);
     if (state.fBulletproofsActive) {
         rv = secp256k1_bulletproof_rangeproof_verify(secp256k1_ctx_blind,
-            blind_scratch, blind_gens, p->vRangeproof.data(), p->vRangeproof.size(),
+            GetBlindScratch(), blind_gens, p->vRangeproof.data(), p->vRangeproof.size(),
             nullptr, &p->commitment, 1, 64, &secp256k1_generator_const_h, nullptr, 0);
     } else {
         rv = secp256k1_rangeproof_verify(secp256k1_ctx_blind, &min_value, &max_value,
@@ -582,6 +594,7 @@ static bool CheckBlindOutput(TxValidationState &state, const CTxOutCT *p)
             nullptr, 0,
             secp256k1_generator_h);
     }
+    TRACE4(validation, rangeproof_verify, state.fBulletproofsActive, 1, TRACE_TIME_ELAPSED(trace_start), rv == 1);
 
     if (LogAcceptCategory(BCLog::RINGCT)) {
         LogPrintf("%s: rv, min_value, max_value %d, %s, %s\n", __func__,
@@ -591,6 +604,9 @@ static bool CheckBlindOutput(TxValidationState &state, const CTxOutCT *p)
     if (rv != 1) {
         return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-ctout-rangeproof-verify");
     }
+    if (state.m_cache_store) {
+        ProofCacheAdd(cache_entry);
+    }
 
     return true;
 }
@@ -612,13 +628,23 @@ bool CheckAnonOutput(TxValidationState &state, const CTxOutRingCT *p)
     if (state.m_skip_rangeproof) {
         return true;
     }
+    if (state.m_rangeproof_checks) {
+        AddRangeProofCheck(*state.m_rangeproof_checks, state.fBulletproofsActive, state.m_cache_store,
+            &p->commitment, &p->vRangeproof, "bad-rctout-rangeproof-verify");
+        return true;
+    }
+    const uint256 cache_entry = RangeProofCacheEntry(state.fBulletproofsActive, p->commitment.data, p->vRangeproof);
+    if (ProofCacheContains(cache_entry, !state.m_cache_store)) {
+        return true;
+    }
 
     uint64_t min_value = 0, max_value = 0;
     int rv = 0;
 
+    TRACE_TIME_START(trace_start);
     if (state.fBulletproofsActive) {
         rv = secp256k1_bulletproof_rangeproof_verify(secp256k1_ctx_blind,
-            blind_scratch, blind_gens, p->vRangeproof.data(), p->vRangeproof.size(),
+            GetBlindScratch(), blind_gens, p->vRangeproof.data(), p->vRangeproof.size(),
             nullptr, &p->commitment, 1, 64, &secp256k1_generator_const_h, nullptr, 0);
     } else {
         rv = secp256k1_rangeproof_verify(secp256k1_ctx_blind, &min_value, &max_value,
@@ -626,6 +652,7 @@ bool CheckAnonOutput(TxValidationState &state, const CTxOutRingCT *p)
             nullptr, 0,
             secp256k1_generator_h);
     }
+    TRACE4(validation, rangeproof_verify, state.fBulletproofsActive, 1, TRACE_TIME_ELAPSED(trace_start), rv == 1);
 
     if (LogAcceptCategory(BCLog::RINGCT)) {
         LogPrintf("%s: rv, min_value, max_value %d, %s, %s\n", __func__,
@@ -635,6 +662,9 @@ bool CheckAnonOutput(TxValidationState &state, const CTxOutRingCT *p)
     if (rv != 1) {
         return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-rctout-rangeproof-verify");
     }
+    if (state.m_cache_store) {
+        ProofCacheAdd(cache_entry);
+    }
 
     return true;
 }
@@ -653,6 +683,22 @@ static bool CheckDataOutput(TxValidationState &state, const CTxOutData *p)
     return true;
 }
 
+/** Skips the rangeproof verification of a transaction found in the proof cache until the checks return */
+class CachedRangeProofs
+{
+private:
+    TxValidationState &m_state;
+    bool m_skip_rangeproof;
+public:
+    CachedRangeProofs(TxValidationState &state, bool cached) : m_state(state), m_skip_rangeproof(state.m_skip_rangeproof)
+    {
+        if (cached) {
+            m_state.m_skip_rangeproof = true;
+        }
+    }
+    ~CachedRangeProofs() { m_state.m_skip_rangeproof = m_skip_rangeproof; }
+};
+
 bool CheckTransaction(const CTransaction& tx, TxValidationState &state)
 {
     // Basic checks that don't depend on any context
@@ -674,6 +720,22 @@ bool CheckTransaction(const CTransaction& tx, TxValidationState &state)
             return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-txns-vout-not-empty");
         }
 
+        // Transactions with all rangeproofs verified on entering the mempool aren't verified again
+        bool has_rangeproofs = false;
+        for (const auto &txout : tx.vpout) {
+            if (txout->IsType(OUTPUT_CT) || txout->IsType(OUTPUT_RINGCT)) {
+                has_rangeproofs = true;
+                break;
+            }
+        }
+        uint256 tx_cache_entry;
+        bool rangeproofs_cached = false;
+        if (has_rangeproofs && !state.m_skip_rangeproof) {
+            tx_cache_entry = TxProofCacheEntry(tx.GetWitnessHash(), state.fBulletproofsActive ? 1 : 0);
+            rangeproofs_cached = ProofCacheContains(tx_cache_entry, !state.m_cache_store);
+        }
+        CachedRangeProofs cached_rangeproofs(state, rangeproofs_cached);
+
         size_t nStandardOutputs = 0, nDataOutputs = 0, nBlindOutputs = 0, nAnonOutputs = 0;
         CAmount nValueOut = 0;
         for (const auto &txout : tx.vpout) {
@@ -718,6 +780,10 @@ bool CheckTransaction(const CTransaction& tx, TxValidationState &state)
         if (nDataOutputs > max_data_outputs) {
             return state.Invalid(TxValidationResult::TX_CONSENSUS, "too-many-data-outputs");
         }
+        // Deferred rangeproofs are only known to be valid once the caller ran them
+        if (!tx_cache_entry.IsNull() && !rangeproofs_cached && state.m_cache_store && !state.m_rangeproof_checks) {
+            ProofCacheAdd(tx_cache_entry);
+        }
     } else {
         if (state.m_particl_mode) {
             return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-txn-version");
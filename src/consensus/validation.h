@@ -13,6 +13,8 @@
 #include <primitives/block.h>
 #include <consensus/params.h>
 
+class CRangeProofCheck;
+
 /** Index marker for when no witness commitment is present in a coinbase transaction. */
 static constexpr int NO_WITNESS_COMMITMENT{-1};
 
@@ -172,6 +174,9 @@ public:
     bool m_check_equal_rct_txid = true;
     CAmount tx_balances[6] = {0};
     std::set<CCmpPubKey> m_setHaveKI;
+    std::vector<CRangeProofCheck> *m_rangeproof_checks = nullptr; // If set rangeproofs are deferred to the caller
+    bool m_cache_store = false; // Store verified rangeproofs and ring signatures in the proof cache
+    bool m_skip_mlsag = false; // Ring signatures are known to be valid, they're cached without being checked
 
     void SetStateInfo(int64_t time, int spend_height, const Consensus::Params& consensusParams, bool particl_mode, bool skip_rangeproof, bool in_block=false)
     {
@@ -207,6 +212,7 @@ public:
 
         m_particl_mode = state_from.m_particl_mode;
         m_skip_rangeproof = state_from.m_skip_rangeproof;
+        m_skip_mlsag = state_from.m_skip_mlsag;
 
         m_clamp_tx_version = state_from.m_clamp_tx_version;
         m_exploit_fix_1 = state_from.m_exploit_fix_1;
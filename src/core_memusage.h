@@ -44,12 +44,27 @@ static inline size_t RecursiveDynamicUsage(const CTxOutBase *out) {
                    RecursiveDynamicUsage(*out->GetPScriptPubKey());
         case OUTPUT_STANDARD:
             return RecursiveDynamicUsage(*out->GetPScriptPubKey());
+        case OUTPUT_DATA:
+            return memusage::DynamicUsage(*out->GetPData());
         default:
             break;
     }
     return 0;
 }
 
+/** Usage of an output made by MAKE_OUTPUT, the object and its shared count are one allocation */
+static inline size_t OutputAllocationUsage(const CTxOutBase *out) {
+    size_t size = sizeof(CTxOutBase);
+    switch (out->GetType()) {
+        case OUTPUT_STANDARD: size = sizeof(CTxOutStandard); break;
+        case OUTPUT_CT: size = sizeof(CTxOutCT); break;
+        case OUTPUT_RINGCT: size = sizeof(CTxOutRingCT); break;
+        case OUTPUT_DATA: size = sizeof(CTxOutData); break;
+        default: break;
+    }
+    return memusage::MallocUsage(sizeof(memusage::stl_shared_counter) + size);
+}
+
 static inline size_t RecursiveDynamicUsage(const CTransaction& tx) {
     size_t mem = memusage::DynamicUsage(tx.vin) + memusage::DynamicUsage(tx.vout);
     for (std::vector<CTxIn>::const_iterator it = tx.vin.begin(); it != tx.vin.end(); it++) {
@@ -60,7 +75,7 @@ static inline size_t RecursiveDynamicUsage(const CTransaction& tx) {
     }
     mem += memusage::DynamicUsage(tx.vpout);
     for (const auto &txout : tx.vpout) {
-        mem += RecursiveDynamicUsage(txout.get()) + 34;
+        mem += RecursiveDynamicUsage(txout.get()) + OutputAllocationUsage(txout.get());
     }
     return mem;
 }
@@ -75,7 +90,7 @@ static inline size_t RecursiveDynamicUsage(const CMutableTransaction& tx) {
     }
     mem += memusage::DynamicUsage(tx.vpout);
     for (const auto &txout : tx.vpout) {
-        mem += RecursiveDynamicUsage(txout.get());
+        mem += RecursiveDynamicUsage(txout.get()) + OutputAllocationUsage(txout.get());
     }
     return mem;
 }
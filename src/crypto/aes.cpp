@@ -3,41 +3,171 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <crypto/aes.h>
+#include <crypto/common.h>
 
+#include <assert.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include <compat/cpuid.h>
+
+#if defined(ENABLE_ARM_AES) && !defined(BUILD_BITCOIN_INTERNAL)
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_AES
+#define HWCAP_AES (1 << 3)
+#endif
+#endif
+#endif
+
 extern "C" {
 #include <crypto/ctaes/ctaes.c>
 }
 
+namespace aes_ni
+{
+void ExpandEncrypt(unsigned char out[240], const unsigned char key[32]);
+void ExpandDecrypt(unsigned char out[240], const unsigned char key[32]);
+void Encrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks);
+void Decrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks);
+}
+
+namespace aes_arm
+{
+void ExpandEncrypt(unsigned char out[240], const unsigned char key[32]);
+void ExpandDecrypt(unsigned char out[240], const unsigned char key[32]);
+void Encrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks);
+void Decrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks);
+}
+
+namespace
+{
+typedef void (*ExpandType)(unsigned char*, const unsigned char*);
+typedef void (*CryptType)(const unsigned char*, unsigned char*, const unsigned char*, size_t);
+
+ExpandType ExpandEncrypt = nullptr;
+ExpandType ExpandDecrypt = nullptr;
+CryptType EncryptBlocks = nullptr;
+CryptType DecryptBlocks = nullptr;
+
+bool SelfTest()
+{
+    // FIPS-197 C.3, and the same block repeated to cover the interleaved path
+    static const unsigned char key[32] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f};
+    static const unsigned char plain[16] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+    static const unsigned char cipher[16] = {
+        0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89};
+    if (!EncryptBlocks) {
+        return true;
+    }
+    unsigned char rk[AES256_ROUNDKEYS_SIZE], in[80], out[80];
+    ExpandEncrypt(rk, key);
+    EncryptBlocks(rk, out, plain, 1);
+    if (!std::equal(out, out + 16, cipher)) return false;
+    ExpandDecrypt(rk, key);
+    for (int i = 0; i < 5; ++i) {
+        std::copy(cipher, cipher + 16, in + i * 16);
+    }
+    DecryptBlocks(rk, out, in, 5);
+    for (int i = 0; i < 5; ++i) {
+        if (!std::equal(out + i * 16, out + i * 16 + 16, plain)) return false;
+    }
+    return true;
+}
+} // namespace
+
+std::string AESAutoDetect()
+{
+    std::string ret = "ctaes";
+#if defined(ENABLE_AESNI) && !defined(BUILD_BITCOIN_INTERNAL) && defined(HAVE_GETCPUID)
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    if ((ecx >> 25) & 1) {
+        ExpandEncrypt = aes_ni::ExpandEncrypt;
+        ExpandDecrypt = aes_ni::ExpandDecrypt;
+        EncryptBlocks = aes_ni::Encrypt;
+        DecryptBlocks = aes_ni::Decrypt;
+        ret = "aesni";
+    }
+#endif
+
+#if defined(ENABLE_ARM_AES) && !defined(BUILD_BITCOIN_INTERNAL)
+    bool have_arm_aes = false;
+#if defined(__linux__)
+    have_arm_aes = getauxval(AT_HWCAP) & HWCAP_AES;
+#elif defined(__APPLE__)
+    have_arm_aes = true; // All Apple arm64 cores implement the crypto extension
+#endif
+    if (have_arm_aes) {
+        ExpandEncrypt = aes_arm::ExpandEncrypt;
+        ExpandDecrypt = aes_arm::ExpandDecrypt;
+        EncryptBlocks = aes_arm::Encrypt;
+        DecryptBlocks = aes_arm::Decrypt;
+        ret = "arm_aes";
+    }
+#endif
+
+    assert(SelfTest());
+    return ret;
+}
+
 AES256Encrypt::AES256Encrypt(const unsigned char key[32])
 {
-    AES256_init(&ctx, key);
+    use_hw = EncryptBlocks != nullptr;
+    if (use_hw) {
+        ExpandEncrypt(hw_keys, key);
+    } else {
+        AES256_init(&ctx, key);
+    }
 }
 
 AES256Encrypt::~AES256Encrypt()
 {
     memset(&ctx, 0, sizeof(ctx));
+    memset(hw_keys, 0, sizeof(hw_keys));
 }
 
 void AES256Encrypt::Encrypt(unsigned char ciphertext[16], const unsigned char plaintext[16]) const
 {
+    if (use_hw) {
+        EncryptBlocks(hw_keys, ciphertext, plaintext, 1);
+        return;
+    }
     AES256_encrypt(&ctx, 1, ciphertext, plaintext);
 }
 
 AES256Decrypt::AES256Decrypt(const unsigned char key[32])
 {
-    AES256_init(&ctx, key);
+    use_hw = DecryptBlocks != nullptr;
+    if (use_hw) {
+        ExpandDecrypt(hw_keys, key);
+    } else {
+        AES256_init(&ctx, key);
+    }
 }
 
 AES256Decrypt::~AES256Decrypt()
 {
     memset(&ctx, 0, sizeof(ctx));
+    memset(hw_keys, 0, sizeof(hw_keys));
 }
 
 void AES256Decrypt::Decrypt(unsigned char plaintext[16], const unsigned char ciphertext[16]) const
 {
-    AES256_decrypt(&ctx, 1, plaintext, ciphertext);
+    Decrypt(plaintext, ciphertext, 1);
+}
+
+void AES256Decrypt::Decrypt(unsigned char* plaintext, const unsigned char* ciphertext, size_t blocks) const
+{
+    if (use_hw) {
+        DecryptBlocks(hw_keys, plaintext, ciphertext, blocks);
+        return;
+    }
+    AES256_decrypt(&ctx, blocks, plaintext, ciphertext);
 }
 
 
@@ -90,13 +220,22 @@ static int CBCDecrypt(const T& dec, const unsigned char iv[AES_BLOCKSIZE], const
     if (size % AES_BLOCKSIZE != 0)
         return 0;
 
-    // Decrypt all data. Padding will be checked in the output.
+    // Decrypt all data, several blocks at a time. Padding will be checked in the output.
+    // The ciphertext is copied first so the chaining stays correct when decrypting in place.
+    static const int CHUNK_BLOCKS = 8;
+    unsigned char chunk[CHUNK_BLOCKS * AES_BLOCKSIZE], last[AES_BLOCKSIZE];
     while (written != size) {
-        dec.Decrypt(out, data + written);
-        for (int i = 0; i != AES_BLOCKSIZE; i++)
-            *out++ ^= prev[i];
-        prev = data + written;
-        written += AES_BLOCKSIZE;
+        int n = std::min(size - written, CHUNK_BLOCKS * AES_BLOCKSIZE);
+        memcpy(chunk, data + written, n);
+        dec.Decrypt(out, chunk, n / AES_BLOCKSIZE);
+        for (int b = 0; b < n; b += AES_BLOCKSIZE) {
+            for (int i = 0; i != AES_BLOCKSIZE; i++)
+                *out++ ^= prev[i];
+            prev = chunk + b;
+        }
+        memcpy(last, prev, AES_BLOCKSIZE);
+        prev = last;
+        written += n;
     }
 
     // When decrypting padding, attempt to run in constant-time
@@ -11,14 +11,21 @@ extern "C" {
 #include <crypto/ctaes/ctaes.h>
 }
 
+#include <stddef.h>
+#include <string>
+
 static const int AES_BLOCKSIZE = 16;
 static const int AES256_KEYSIZE = 32;
+static const int AES256_ROUNDKEYS_SIZE = 240;
 
 /** An encryption class for AES-256. */
 class AES256Encrypt
 {
 private:
     AES256_ctx ctx;
+    //! Round keys for the hardware backend, used instead of ctx when one was detected
+    unsigned char hw_keys[AES256_ROUNDKEYS_SIZE];
+    bool use_hw;
 
 public:
     explicit AES256Encrypt(const unsigned char key[32]);
@@ -31,11 +38,16 @@ class AES256Decrypt
 {
 private:
     AES256_ctx ctx;
+    //! Round keys for the hardware backend, used instead of ctx when one was detected
+    unsigned char hw_keys[AES256_ROUNDKEYS_SIZE];
+    bool use_hw;
 
 public:
     explicit AES256Decrypt(const unsigned char key[32]);
     ~AES256Decrypt();
     void Decrypt(unsigned char plaintext[16], const unsigned char ciphertext[16]) const;
+    //! Decrypt independent blocks, hardware backends keep several in flight
+    void Decrypt(unsigned char* plaintext, const unsigned char* ciphertext, size_t blocks) const;
 };
 
 class AES256CBCEncrypt
@@ -64,4 +76,9 @@ private:
     unsigned char iv[AES_BLOCKSIZE];
 };
 
+/** Autodetect the best available AES implementation.
+ *  Returns the name of the implementation.
+ */
+std::string AESAutoDetect();
+
 #endif // BITCOIN_CRYPTO_AES_H
@@ -0,0 +1,118 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifdef ENABLE_ARM_AES
+
+#include <stddef.h>
+#include <stdint.h>
+#include <arm_neon.h>
+
+namespace {
+
+/** SubWord through AESE, the word is replicated to every column so ShiftRows leaves it in place. */
+uint32_t inline SubWord(uint32_t w)
+{
+    return vgetq_lane_u32(vreinterpretq_u32_u8(vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(w)), vdupq_n_u8(0))), 0);
+}
+
+uint32_t inline RotWord(uint32_t w) { return (w >> 8) | (w << 24); }
+
+void ExpandKey(uint8x16_t rk[15], const unsigned char key[32])
+{
+    static const uint8_t rcon[7] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40};
+    uint32_t w[60];
+    for (int i = 0; i < 8; ++i) {
+        w[i] = (uint32_t)key[i * 4] | ((uint32_t)key[i * 4 + 1] << 8) | ((uint32_t)key[i * 4 + 2] << 16) | ((uint32_t)key[i * 4 + 3] << 24);
+    }
+    for (int i = 8; i < 60; ++i) {
+        uint32_t t = w[i - 1];
+        if (i % 8 == 0) {
+            t = RotWord(SubWord(t)) ^ rcon[i / 8 - 1];
+        } else if (i % 8 == 4) {
+            t = SubWord(t);
+        }
+        w[i] = w[i - 8] ^ t;
+    }
+    for (int i = 0; i < 15; ++i) {
+        rk[i] = vreinterpretq_u8_u32(vld1q_u32(w + i * 4));
+    }
+}
+
+} // namespace
+
+namespace aes_arm {
+void ExpandEncrypt(unsigned char out[240], const unsigned char key[32])
+{
+    uint8x16_t rk[15];
+    ExpandKey(rk, key);
+    for (int i = 0; i < 15; ++i) {
+        vst1q_u8(out + i * 16, rk[i]);
+    }
+}
+
+void ExpandDecrypt(unsigned char out[240], const unsigned char key[32])
+{
+    // Round keys for the equivalent inverse cipher, in the order they are used
+    uint8x16_t rk[15];
+    ExpandKey(rk, key);
+    vst1q_u8(out, rk[14]);
+    for (int i = 1; i < 14; ++i) {
+        vst1q_u8(out + i * 16, vaesimcq_u8(rk[14 - i]));
+    }
+    vst1q_u8(out + 224, rk[0]);
+}
+
+void Encrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    uint8x16_t k[15];
+    for (int i = 0; i < 15; ++i) {
+        k[i] = vld1q_u8(rk + i * 16);
+    }
+    while (blocks--) {
+        uint8x16_t s = vld1q_u8(in);
+        for (int i = 0; i < 13; ++i) {
+            s = vaesmcq_u8(vaeseq_u8(s, k[i]));
+        }
+        vst1q_u8(out, veorq_u8(vaeseq_u8(s, k[13]), k[14]));
+        in += 16;
+        out += 16;
+    }
+}
+
+void Decrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    uint8x16_t k[15];
+    for (int i = 0; i < 15; ++i) {
+        k[i] = vld1q_u8(rk + i * 16);
+    }
+    // Independent blocks are interleaved to hide the instruction latency
+    while (blocks >= 4) {
+        uint8x16_t s0 = vld1q_u8(in), s1 = vld1q_u8(in + 16), s2 = vld1q_u8(in + 32), s3 = vld1q_u8(in + 48);
+        for (int i = 0; i < 13; ++i) {
+            s0 = vaesimcq_u8(vaesdq_u8(s0, k[i]));
+            s1 = vaesimcq_u8(vaesdq_u8(s1, k[i]));
+            s2 = vaesimcq_u8(vaesdq_u8(s2, k[i]));
+            s3 = vaesimcq_u8(vaesdq_u8(s3, k[i]));
+        }
+        vst1q_u8(out, veorq_u8(vaesdq_u8(s0, k[13]), k[14]));
+        vst1q_u8(out + 16, veorq_u8(vaesdq_u8(s1, k[13]), k[14]));
+        vst1q_u8(out + 32, veorq_u8(vaesdq_u8(s2, k[13]), k[14]));
+        vst1q_u8(out + 48, veorq_u8(vaesdq_u8(s3, k[13]), k[14]));
+        in += 64;
+        out += 64;
+        blocks -= 4;
+    }
+    while (blocks--) {
+        uint8x16_t s = vld1q_u8(in);
+        for (int i = 0; i < 13; ++i) {
+            s = vaesimcq_u8(vaesdq_u8(s, k[i]));
+        }
+        vst1q_u8(out, veorq_u8(vaesdq_u8(s, k[13]), k[14]));
+        in += 16;
+        out += 16;
+    }
+}
+}
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifdef ENABLE_AESNI
+
+#include <stddef.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace {
+
+__m128i inline Load(const unsigned char* p) { return _mm_loadu_si128((const __m128i*)p); }
+void inline Store(unsigned char* p, __m128i v) { _mm_storeu_si128((__m128i*)p, v); }
+
+/** Combine the previous two round keys with the key generation assist word. */
+__m128i inline Expand(__m128i key, __m128i assist)
+{
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+template <int rcon>
+void inline ExpandPair(__m128i& k0, __m128i& k1, __m128i* rk)
+{
+    k0 = Expand(k0, _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k1, rcon), 0xff));
+    rk[0] = k0;
+    k1 = Expand(k1, _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k0, 0), 0xaa));
+    rk[1] = k1;
+}
+
+void ExpandKey(__m128i rk[15], const unsigned char key[32])
+{
+    __m128i k0 = Load(key), k1 = Load(key + 16);
+    rk[0] = k0;
+    rk[1] = k1;
+    ExpandPair<0x01>(k0, k1, rk + 2);
+    ExpandPair<0x02>(k0, k1, rk + 4);
+    ExpandPair<0x04>(k0, k1, rk + 6);
+    ExpandPair<0x08>(k0, k1, rk + 8);
+    ExpandPair<0x10>(k0, k1, rk + 10);
+    ExpandPair<0x20>(k0, k1, rk + 12);
+    rk[14] = Expand(k0, _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k1, 0x40), 0xff));
+}
+
+} // namespace
+
+namespace aes_ni {
+void ExpandEncrypt(unsigned char out[240], const unsigned char key[32])
+{
+    __m128i rk[15];
+    ExpandKey(rk, key);
+    for (int i = 0; i < 15; ++i) {
+        Store(out + i * 16, rk[i]);
+    }
+}
+
+void ExpandDecrypt(unsigned char out[240], const unsigned char key[32])
+{
+    // Round keys for the equivalent inverse cipher, in the order they are used
+    __m128i rk[15];
+    ExpandKey(rk, key);
+    Store(out, rk[14]);
+    for (int i = 1; i < 14; ++i) {
+        Store(out + i * 16, _mm_aesimc_si128(rk[14 - i]));
+    }
+    Store(out + 224, rk[0]);
+}
+
+void Encrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    __m128i k[15];
+    for (int i = 0; i < 15; ++i) {
+        k[i] = Load(rk + i * 16);
+    }
+    while (blocks--) {
+        __m128i s = _mm_xor_si128(Load(in), k[0]);
+        for (int i = 1; i < 14; ++i) {
+            s = _mm_aesenc_si128(s, k[i]);
+        }
+        Store(out, _mm_aesenclast_si128(s, k[14]));
+        in += 16;
+        out += 16;
+    }
+}
+
+void Decrypt(const unsigned char rk[240], unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    __m128i k[15];
+    for (int i = 0; i < 15; ++i) {
+        k[i] = Load(rk + i * 16);
+    }
+    // Independent blocks are interleaved to hide the instruction latency
+    while (blocks >= 4) {
+        __m128i s0 = _mm_xor_si128(Load(in), k[0]);
+        __m128i s1 = _mm_xor_si128(Load(in + 16), k[0]);
+        __m128i s2 = _mm_xor_si128(Load(in + 32), k[0]);
+        __m128i s3 = _mm_xor_si128(Load(in + 48), k[0]);
+        for (int i = 1; i < 14; ++i) {
+            s0 = _mm_aesdec_si128(s0, k[i]);
+            s1 = _mm_aesdec_si128(s1, k[i]);
+            s2 = _mm_aesdec_si128(s2, k[i]);
+            s3 = _mm_aesdec_si128(s3, k[i]);
+        }
+        Store(out, _mm_aesdeclast_si128(s0, k[14]));
+        Store(out + 16, _mm_aesdeclast_si128(s1, k[14]));
+        Store(out + 32, _mm_aesdeclast_si128(s2, k[14]));
+        Store(out + 48, _mm_aesdeclast_si128(s3, k[14]));
+        in += 64;
+        out += 64;
+        blocks -= 4;
+    }
+    while (blocks--) {
+        __m128i s = _mm_xor_si128(Load(in), k[0]);
+        for (int i = 1; i < 14; ++i) {
+            s = _mm_aesdec_si128(s, k[i]);
+        }
+        Store(out, _mm_aesdeclast_si128(s, k[14]));
+        in += 16;
+        out += 16;
+    }
+}
+}
+
+#endif
@@ -6,6 +6,8 @@
 
 #include <string.h>
 
+#include <vector>
+
 CHMAC_SHA512::CHMAC_SHA512(const unsigned char* key, size_t keylen)
 {
     unsigned char rkey[128];
@@ -32,3 +34,32 @@ void CHMAC_SHA512::Finalize(unsigned char hash[OUTPUT_SIZE])
     inner.Finalize(temp);
     outer.Write(temp, 64).Finalize(hash);
 }
+
+void CHMAC_SHA512::Midstates(uint64_t inner_out[8], uint64_t outer_out[8]) const
+{
+    inner.Midstate(inner_out);
+    outer.Midstate(outer_out);
+}
+
+void PBKDF2_HMAC_SHA512_64(const unsigned char* const* passwords, const size_t* password_lens,
+    const unsigned char* const* salts, const size_t* salt_lens, size_t n, size_t iterations, unsigned char* out)
+{
+    // F(P, S, c, 1) = U_1 ^ U_2 ^ ... ^ U_c, U_1 = PRF(P, S || INT(1)), U_i = PRF(P, U_{i-1})
+    static const unsigned char one_be[4] = {0, 0, 0, 1};
+    std::vector<uint64_t> inner(n * 8), outer(n * 8);
+    std::vector<unsigned char> u(n * 64), tmp(n * 64);
+    for (size_t i = 0; i < n; ++i) {
+        CHMAC_SHA512 ctx(passwords[i], password_lens[i]);
+        ctx.Midstates(&inner[i * 8], &outer[i * 8]);
+        ctx.Write(salts[i], salt_lens[i]).Write(one_be, 4).Finalize(&u[i * 64]);
+    }
+    memcpy(out, u.data(), n * 64);
+
+    for (size_t k = 1; k < iterations; ++k) {
+        SHA512D64Midstate(tmp.data(), inner.data(), u.data(), n);
+        SHA512D64Midstate(u.data(), outer.data(), tmp.data(), n);
+        for (size_t i = 0; i < n * 64; ++i) {
+            out[i] ^= u[i];
+        }
+    }
+}
@@ -27,6 +27,14 @@ public:
         return *this;
     }
     void Finalize(unsigned char hash[OUTPUT_SIZE]);
+    //! States after the padded key blocks, only valid before any data is written
+    void Midstates(uint64_t inner_out[8], uint64_t outer_out[8]) const;
 };
 
+/** PBKDF2-HMAC-SHA512 producing the first 64 byte output block for each of n password and salt pairs.
+ *  The iterations of all pairs run together through SHA512D64Midstate.
+ */
+void PBKDF2_HMAC_SHA512_64(const unsigned char* const* passwords, const size_t* password_lens,
+    const unsigned char* const* salts, const size_t* salt_lens, size_t n, size_t iterations, unsigned char* out);
+
 #endif // BITCOIN_CRYPTO_HMAC_SHA512_H
@@ -6,8 +6,18 @@
 
 #include <crypto/common.h>
 
+#include <assert.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include <compat/cpuid.h>
+
+namespace ripemd160_avx2
+{
+void TransformBlock_8way(unsigned char* out, const unsigned char* in);
+}
+
 // Internal implementation code.
 namespace
 {
@@ -233,10 +243,112 @@ void Transform(uint32_t* s, const unsigned char* chunk)
     s[4] = t + b1 + c2;
 }
 
+/** Hash one message that fits in one padded 64-byte block. */
+void TransformBlock(unsigned char* out, const unsigned char* in)
+{
+    uint32_t s[5];
+    Initialize(s);
+    Transform(s, in);
+    for (int i = 0; i < 5; ++i) {
+        WriteLE32(out + i * 4, s[i]);
+    }
+}
+
 } // namespace ripemd160
 
+typedef void (*TransformBlockType)(unsigned char*, const unsigned char*);
+
+TransformBlockType TransformBlock_8way = nullptr;
+
+bool SelfTest()
+{
+    unsigned char in[512], out[160], out_1way[20];
+    for (int i = 0; i < 512; ++i) {
+        in[i] = i * 11 + 1;
+    }
+    if (TransformBlock_8way) {
+        TransformBlock_8way(out, in);
+        for (int i = 0; i < 8; ++i) {
+            ripemd160::TransformBlock(out_1way, in + i * 64);
+            if (!std::equal(out_1way, out_1way + 20, out + i * 20)) return false;
+        }
+    }
+
+    // A padded block must hash like the streaming hasher
+    unsigned char block[64] = {0}, hash[20];
+    std::copy(in, in + 32, block);
+    block[32] = 0x80;
+    WriteLE64(block + 56, 32 * 8);
+    CRIPEMD160().Write(in, 32).Finalize(hash);
+    ripemd160::TransformBlock(out_1way, block);
+    return std::equal(hash, hash + 20, out_1way);
+}
+
+#if defined(USE_ASM) && (defined(__x86_64__) || defined(__amd64__) || defined(__i386__))
+/** Check whether the OS has enabled AVX registers. */
+bool AVXEnabled()
+{
+    uint32_t a, d;
+    __asm__("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+    return (a & 6) == 6;
+}
+#endif
 } // namespace
 
+std::string RIPEMD160AutoDetect()
+{
+    std::string ret = "standard";
+#if defined(USE_ASM) && defined(HAVE_GETCPUID)
+    bool have_xsave = false;
+    bool have_avx = false;
+    bool have_avx2 = false;
+    bool enabled_avx = false;
+
+    (void)AVXEnabled;
+    (void)have_avx;
+    (void)have_avx2;
+    (void)enabled_avx;
+
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    have_xsave = (ecx >> 27) & 1;
+    have_avx = (ecx >> 28) & 1;
+    if (have_xsave && have_avx) {
+        enabled_avx = AVXEnabled();
+    }
+    GetCPUID(7, 0, eax, ebx, ecx, edx);
+    have_avx2 = (ebx >> 5) & 1;
+
+#if defined(ENABLE_AVX2) && !defined(BUILD_BITCOIN_INTERNAL)
+    if (have_avx2 && have_avx && enabled_avx) {
+        TransformBlock_8way = ripemd160_avx2::TransformBlock_8way;
+        ret += ",avx2(8way)";
+    }
+#endif
+#endif
+
+    assert(SelfTest());
+    return ret;
+}
+
+void RIPEMD160Padded64(unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    if (TransformBlock_8way) {
+        while (blocks >= 8) {
+            TransformBlock_8way(out, in);
+            out += 160;
+            in += 512;
+            blocks -= 8;
+        }
+    }
+    while (blocks) {
+        ripemd160::TransformBlock(out, in);
+        out += 20;
+        in += 64;
+        --blocks;
+    }
+}
+
 ////// RIPEMD160
 
 CRIPEMD160::CRIPEMD160() : bytes(0)
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string>
 
 /** A hasher class for RIPEMD-160. */
 class CRIPEMD160
@@ -25,4 +26,16 @@ public:
     CRIPEMD160& Reset();
 };
 
+/** Autodetect the best available RIPEMD160 implementation.
+ *  Returns the name of the implementation.
+ */
+std::string RIPEMD160AutoDetect();
+
+/** Compute multiple RIPEMD160's of messages that each fit in one block.
+ *  output:  pointer to a blocks*20 byte output buffer
+ *  input:   pointer to a blocks*64 byte input buffer, each message already padded to 64 bytes
+ *  blocks:  the number of hashes to compute.
+ */
+void RIPEMD160Padded64(unsigned char* output, const unsigned char* input, size_t blocks);
+
 #endif // BITCOIN_CRYPTO_RIPEMD160_H
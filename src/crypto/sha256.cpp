@@ -27,6 +27,7 @@ void Transform_4way(unsigned char* out, const unsigned char* in);
 namespace sha256d64_avx2
 {
 void Transform_8way(unsigned char* out, const unsigned char* in);
+void TransformBlock_8way(unsigned char* out, const unsigned char* in);
 }
 
 namespace sha256d64_shani
@@ -461,6 +462,7 @@ TransformD64Type TransformD64 = sha256::TransformD64;
 TransformD64Type TransformD64_2way = nullptr;
 TransformD64Type TransformD64_4way = nullptr;
 TransformD64Type TransformD64_8way = nullptr;
+TransformD64Type TransformBlock_8way = nullptr;
 
 bool SelfTest() {
     // Input state (equal to the initial SHA256 state)
@@ -544,6 +546,21 @@ bool SelfTest() {
         if (!std::equal(out, out + 256, result_d64)) return false;
     }
 
+    // Test TransformBlock_8way against Transform, if available.
+    if (TransformBlock_8way) {
+        unsigned char out[256], expected[256];
+        TransformBlock_8way(out, data + 1);
+        for (int i = 0; i < 8; ++i) {
+            uint32_t state[8];
+            std::copy(init, init + 8, state);
+            Transform(state, data + 1 + i * 64, 1);
+            for (int j = 0; j < 8; ++j) {
+                WriteBE32(expected + i * 32 + j * 4, state[j]);
+            }
+        }
+        if (!std::equal(out, out + 256, expected)) return false;
+    }
+
     return true;
 }
 
@@ -618,6 +635,7 @@ std::string SHA256AutoDetect()
 #if defined(ENABLE_AVX2) && !defined(BUILD_BITCOIN_INTERNAL)
     if (have_avx2 && have_avx && enabled_avx) {
         TransformD64_8way = sha256d64_avx2::Transform_8way;
+        TransformBlock_8way = sha256d64_avx2::TransformBlock_8way;
         ret += ",avx2(8way)";
     }
 #endif
@@ -717,3 +735,26 @@ void SHA256D64(unsigned char* out, const unsigned char* in, size_t blocks)
         --blocks;
     }
 }
+
+void SHA256Padded64(unsigned char* out, const unsigned char* in, size_t blocks)
+{
+    if (TransformBlock_8way) {
+        while (blocks >= 8) {
+            TransformBlock_8way(out, in);
+            out += 256;
+            in += 512;
+            blocks -= 8;
+        }
+    }
+    while (blocks) {
+        uint32_t s[8];
+        sha256::Initialize(s);
+        Transform(s, in, 1);
+        for (int i = 0; i < 8; ++i) {
+            WriteBE32(out + i * 4, s[i]);
+        }
+        out += 32;
+        in += 64;
+        --blocks;
+    }
+}
@@ -38,4 +38,11 @@ std::string SHA256AutoDetect();
  */
 void SHA256D64(unsigned char* output, const unsigned char* input, size_t blocks);
 
+/** Compute multiple SHA256's of messages that each fit in one block.
+ *  output:  pointer to a blocks*32 byte output buffer
+ *  input:   pointer to a blocks*64 byte input buffer, each message already padded to 64 bytes
+ *  blocks:  the number of hashes to compute.
+ */
+void SHA256Padded64(unsigned char* output, const unsigned char* input, size_t blocks);
+
 #endif // BITCOIN_CRYPTO_SHA256_H
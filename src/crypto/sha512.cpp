@@ -6,8 +6,34 @@
 
 #include <crypto/common.h>
 
+#include <assert.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include <compat/cpuid.h>
+
+#if defined(ENABLE_ARM_SHA512) && !defined(BUILD_BITCOIN_INTERNAL)
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_SHA512
+#define HWCAP_SHA512 (1 << 21)
+#endif
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+#endif
+
+namespace sha512d64_avx2
+{
+void Midstate_4way(unsigned char* out, const uint64_t* midstates, const unsigned char* in);
+}
+
+namespace sha512_arm
+{
+void Transform(uint64_t* s, const unsigned char* chunk, size_t blocks);
+}
+
 // Internal implementation code.
 namespace
 {
@@ -144,10 +170,175 @@ void Transform(uint64_t* s, const unsigned char* chunk)
     s[7] += h;
 }
 
+void Transform(uint64_t* s, const unsigned char* chunk, size_t blocks)
+{
+    while (blocks--) {
+        Transform(s, chunk);
+        chunk += 128;
+    }
+}
+
+} // namespace sha512
+
+typedef void (*TransformType)(uint64_t*, const unsigned char*, size_t);
+
+TransformType Transform = sha512::Transform;
+
+namespace sha512
+{
+/** Finish one 64 byte message following a 128 byte block. */
+void Midstate(unsigned char* out, const uint64_t* midstate, const unsigned char* in, TransformType transform = Transform)
+{
+    unsigned char block[128] = {0};
+    memcpy(block, in, 64);
+    block[64] = 0x80;
+    WriteBE64(block + 120, (128 + 64) * 8);
+    uint64_t s[8];
+    std::copy(midstate, midstate + 8, s);
+    transform(s, block, 1);
+    for (int i = 0; i < 8; ++i) {
+        WriteBE64(out + i * 8, s[i]);
+    }
+}
+
 } // namespace sha512
 
+typedef void (*MidstateType)(unsigned char*, const uint64_t*, const unsigned char*);
+
+MidstateType Midstate_4way = nullptr;
+
+bool SelfTest()
+{
+    // The dispatched transform must match the generic one for 0 through 4 blocks
+    static const uint64_t init[8] = {
+        0x6a09e667f3bcc908ull, 0xbb67ae8584caa73bull, 0x3c6ef372fe94f82bull, 0xa54ff53a5f1d36f1ull,
+        0x510e527fade682d1ull, 0x9b05688c2b3e6c1full, 0x1f83d9abfb41bd6bull, 0x5be0cd19137e2179ull};
+    unsigned char data[512];
+    for (int i = 0; i < 512; ++i) {
+        data[i] = i * 13 + 5;
+    }
+    for (size_t blocks = 0; blocks <= 4; ++blocks) {
+        uint64_t state[8], expected[8];
+        std::copy(init, init + 8, state);
+        std::copy(init, init + 8, expected);
+        Transform(state, data, blocks);
+        for (size_t i = 0; i < blocks; ++i) {
+            sha512::Transform(expected, data + i * 128);
+        }
+        if (!std::equal(state, state + 8, expected)) return false;
+    }
+
+    // Distinct midstates and messages per lane
+    uint64_t midstates[32];
+    unsigned char in[256], out[256], out_1way[64];
+    for (int i = 0; i < 32; ++i) {
+        midstates[i] = 0x0123456789abcdefull * (i + 1);
+    }
+    for (int i = 0; i < 256; ++i) {
+        in[i] = i * 7 + 3;
+    }
+    if (Midstate_4way) {
+        Midstate_4way(out, midstates, in);
+        for (int i = 0; i < 4; ++i) {
+            sha512::Midstate(out_1way, midstates + i * 8, in + i * 64, sha512::Transform);
+            if (!std::equal(out_1way, out_1way + 64, out + i * 64)) return false;
+        }
+    }
+
+    // Padding and midstate must agree with the streaming hasher
+    unsigned char block[128], hash[64];
+    std::fill(block, block + 128, 0x36);
+    CSHA512 hasher;
+    hasher.Write(block, 128);
+    uint64_t midstate[8];
+    hasher.Midstate(midstate);
+    hasher.Write(in, 64).Finalize(hash);
+    sha512::Midstate(out_1way, midstate, in, sha512::Transform);
+    return std::equal(hash, hash + 64, out_1way);
+}
+
+#if defined(USE_ASM) && (defined(__x86_64__) || defined(__amd64__) || defined(__i386__))
+/** Check whether the OS has enabled AVX registers. */
+bool AVXEnabled()
+{
+    uint32_t a, d;
+    __asm__("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+    return (a & 6) == 6;
+}
+#endif
 } // namespace
 
+std::string SHA512AutoDetect()
+{
+    std::string ret = "standard";
+#if defined(USE_ASM) && defined(HAVE_GETCPUID)
+    bool have_xsave = false;
+    bool have_avx = false;
+    bool have_avx2 = false;
+    bool enabled_avx = false;
+
+    (void)AVXEnabled;
+    (void)have_avx;
+    (void)have_avx2;
+    (void)enabled_avx;
+
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    have_xsave = (ecx >> 27) & 1;
+    have_avx = (ecx >> 28) & 1;
+    if (have_xsave && have_avx) {
+        enabled_avx = AVXEnabled();
+    }
+    GetCPUID(7, 0, eax, ebx, ecx, edx);
+    have_avx2 = (ebx >> 5) & 1;
+
+#if defined(ENABLE_AVX2) && !defined(BUILD_BITCOIN_INTERNAL)
+    if (have_avx2 && have_avx && enabled_avx) {
+        Midstate_4way = sha512d64_avx2::Midstate_4way;
+        ret += ",avx2(4way)";
+    }
+#endif
+#endif
+
+#if defined(ENABLE_ARM_SHA512) && !defined(BUILD_BITCOIN_INTERNAL)
+    bool have_arm_sha512 = false;
+#if defined(__linux__)
+    have_arm_sha512 = getauxval(AT_HWCAP) & HWCAP_SHA512;
+#elif defined(__APPLE__)
+    int val = 0;
+    size_t len = sizeof(val);
+    have_arm_sha512 = sysctlbyname("hw.optional.armv8_2_sha512", &val, &len, nullptr, 0) == 0 && val;
+#endif
+    if (have_arm_sha512) {
+        Transform = sha512_arm::Transform;
+        ret = "arm_sha512(1way)";
+    }
+#endif
+
+    assert(SelfTest());
+    return ret;
+}
+
+void SHA512D64Midstate(unsigned char* out, const uint64_t* midstates, const unsigned char* in, size_t n)
+{
+    if (Midstate_4way) {
+        while (n >= 4) {
+            Midstate_4way(out, midstates, in);
+            out += 256;
+            midstates += 32;
+            in += 256;
+            n -= 4;
+        }
+    }
+    while (n) {
+        sha512::Midstate(out, midstates, in);
+        out += 64;
+        midstates += 8;
+        in += 64;
+        n -= 1;
+    }
+}
+
 
 ////// SHA-512
 
@@ -165,14 +356,15 @@ CSHA512& CSHA512::Write(const unsigned char* data, size_t len)
         memcpy(buf + bufsize, data, 128 - bufsize);
         bytes += 128 - bufsize;
         data += 128 - bufsize;
-        sha512::Transform(s, buf);
+        Transform(s, buf, 1);
         bufsize = 0;
     }
-    while (end - data >= 128) {
+    if (end - data >= 128) {
         // Process full chunks directly from the source.
-        sha512::Transform(s, data);
-        data += 128;
-        bytes += 128;
+        size_t blocks = (end - data) / 128;
+        Transform(s, data, blocks);
+        data += 128 * blocks;
+        bytes += 128 * blocks;
     }
     if (end > data) {
         // Fill the buffer with what remains.
@@ -199,6 +391,12 @@ void CSHA512::Finalize(unsigned char hash[OUTPUT_SIZE])
     WriteBE64(hash + 56, s[7]);
 }
 
+void CSHA512::Midstate(uint64_t out[8]) const
+{
+    assert(bytes % 128 == 0);
+    std::copy(s, s + 8, out);
+}
+
 CSHA512& CSHA512::Reset()
 {
     bytes = 0;
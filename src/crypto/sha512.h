@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string>
 
 /** A hasher class for SHA-512. */
 class CSHA512
@@ -24,6 +25,19 @@ public:
     void Finalize(unsigned char hash[OUTPUT_SIZE]);
     CSHA512& Reset();
     uint64_t Size() const { return bytes; }
+    //! Copy the internal state, only valid after whole 128 byte blocks were written
+    void Midstate(uint64_t out[8]) const;
 };
 
+/** Autodetect the best available SHA512 implementation.
+ *  Returns the name of the implementation.
+ */
+std::string SHA512AutoDetect();
+
+/** Finish hashing 64 byte messages that follow one 128 byte block, as in HMAC and PBKDF2 chains.
+ *  For each of the n inputs, out[64*i] is the digest of the block absorbed into midstates[8*i]
+ *  followed by in[64*i]. Groups of inputs run through multi-way transforms when available.
+ */
+void SHA512D64Midstate(unsigned char* out, const uint64_t* midstates, const unsigned char* in, size_t n);
+
 #endif // BITCOIN_CRYPTO_SHA512_H
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+//
+// Uses the ARMv8.2 SHA512 extension; each SHA512H/SHA512H2 pair performs two rounds.
+
+#ifdef ENABLE_ARM_SHA512
+
+#include <stddef.h>
+#include <stdint.h>
+#include <arm_neon.h>
+
+namespace {
+
+alignas(16) const uint64_t K[80] = {
+    0x428a2f98d728ae22ull, 0x7137449123ef65cdull, 0xb5c0fbcfec4d3b2full, 0xe9b5dba58189dbbcull,
+    0x3956c25bf348b538ull, 0x59f111f1b605d019ull, 0x923f82a4af194f9bull, 0xab1c5ed5da6d8118ull,
+    0xd807aa98a3030242ull, 0x12835b0145706fbeull, 0x243185be4ee4b28cull, 0x550c7dc3d5ffb4e2ull,
+    0x72be5d74f27b896full, 0x80deb1fe3b1696b1ull, 0x9bdc06a725c71235ull, 0xc19bf174cf692694ull,
+    0xe49b69c19ef14ad2ull, 0xefbe4786384f25e3ull, 0x0fc19dc68b8cd5b5ull, 0x240ca1cc77ac9c65ull,
+    0x2de92c6f592b0275ull, 0x4a7484aa6ea6e483ull, 0x5cb0a9dcbd41fbd4ull, 0x76f988da831153b5ull,
+    0x983e5152ee66dfabull, 0xa831c66d2db43210ull, 0xb00327c898fb213full, 0xbf597fc7beef0ee4ull,
+    0xc6e00bf33da88fc2ull, 0xd5a79147930aa725ull, 0x06ca6351e003826full, 0x142929670a0e6e70ull,
+    0x27b70a8546d22ffcull, 0x2e1b21385c26c926ull, 0x4d2c6dfc5ac42aedull, 0x53380d139d95b3dfull,
+    0x650a73548baf63deull, 0x766a0abb3c77b2a8ull, 0x81c2c92e47edaee6ull, 0x92722c851482353bull,
+    0xa2bfe8a14cf10364ull, 0xa81a664bbc423001ull, 0xc24b8b70d0f89791ull, 0xc76c51a30654be30ull,
+    0xd192e819d6ef5218ull, 0xd69906245565a910ull, 0xf40e35855771202aull, 0x106aa07032bbd1b8ull,
+    0x19a4c116b8d2d0c8ull, 0x1e376c085141ab53ull, 0x2748774cdf8eeb99ull, 0x34b0bcb5e19b48a8ull,
+    0x391c0cb3c5c95a63ull, 0x4ed8aa4ae3418acbull, 0x5b9cca4f7763e373ull, 0x682e6ff3d6b2b8a3ull,
+    0x748f82ee5defb2fcull, 0x78a5636f43172f60ull, 0x84c87814a1f0ab72ull, 0x8cc702081a6439ecull,
+    0x90befffa23631e28ull, 0xa4506cebde82bde9ull, 0xbef9a3f7b2c67915ull, 0xc67178f2e372532bull,
+    0xca273eceea26619cull, 0xd186b8c721c0c207ull, 0xeada7dd6cde0eb1eull, 0xf57d4f7fee6ed178ull,
+    0x06f067aa72176fbaull, 0x0a637dc5a2c898a6ull, 0x113f9804bef90daeull, 0x1b710b35131c471bull,
+    0x28db77f523047d84ull, 0x32caab7b40c72493ull, 0x3c9ebe0a15c9bebcull, 0x431d67c49c100d4cull,
+    0x4cc5d4becb3e42b6ull, 0x597f299cfc657e2aull, 0x5fcb6fab3ad6faecull, 0x6c44198c4a475817ull,
+};
+
+uint64x2_t inline __attribute__((always_inline)) Load(const unsigned char* in)
+{
+    return vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(in)));
+}
+
+} // namespace
+
+namespace sha512_arm {
+void Transform(uint64_t* s, const unsigned char* chunk, size_t blocks)
+{
+    uint64x2_t ab = vld1q_u64(s), cd = vld1q_u64(s + 2), ef = vld1q_u64(s + 4), gh = vld1q_u64(s + 6);
+    uint64x2_t m[8];
+
+    while (blocks--) {
+        const uint64x2_t ab_save = ab, cd_save = cd, ef_save = ef, gh_save = gh;
+        for (int i = 0; i < 8; ++i) {
+            m[i] = Load(chunk + i * 16);
+        }
+
+        for (int t = 0; t < 80; t += 2) {
+            const int i = (t / 2) % 8;
+            uint64x2_t kw = vaddq_u64(m[i], vld1q_u64(K + t));
+            kw = vextq_u64(kw, kw, 1);
+            // Lanes hold (T1[t+1], T1[t]), then fold them into the new e and a values
+            const uint64x2_t t1 = vsha512hq_u64(vaddq_u64(gh, kw), vextq_u64(ef, gh, 1), vextq_u64(cd, ef, 1));
+            const uint64x2_t ab_next = vsha512h2q_u64(t1, cd, ab);
+            gh = ef;
+            ef = vaddq_u64(cd, t1);
+            cd = ab;
+            ab = ab_next;
+            if (t < 64) {
+                m[i] = vsha512su1q_u64(vsha512su0q_u64(m[i], m[(i + 1) % 8]), m[(i + 7) % 8], vextq_u64(m[(i + 4) % 8], m[(i + 5) % 8], 1));
+            }
+        }
+
+        ab = vaddq_u64(ab, ab_save);
+        cd = vaddq_u64(cd, cd_save);
+        ef = vaddq_u64(ef, ef_save);
+        gh = vaddq_u64(gh, gh_save);
+        chunk += 128;
+    }
+
+    vst1q_u64(s, ab);
+    vst1q_u64(s + 2, cd);
+    vst1q_u64(s + 4, ef);
+    vst1q_u64(s + 6, gh);
+}
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <random.h>
+#include <util/trace.h>
 
 #include <leveldb/cache.h>
 #include <leveldb/env.h>
@@ -181,6 +182,36 @@ CDBWrapper::~CDBWrapper()
     options.env = nullptr;
 }
 
+namespace {
+//! Counts the puts and erasures of a batch by the first byte of the key
+class PrefixWriteCounter : public leveldb::WriteBatch::Handler
+{
+public:
+    explicit PrefixWriteCounter(std::array<std::atomic<uint64_t>, 256>& counts) : m_counts(counts) {}
+
+    void Put(const leveldb::Slice& key, const leveldb::Slice& value) override { Count(key); }
+    void Delete(const leveldb::Slice& key) override { Count(key); }
+
+private:
+    std::array<std::atomic<uint64_t>, 256>& m_counts;
+
+    void Count(const leveldb::Slice& key)
+    {
+        if (!key.empty()) {
+            m_counts[(uint8_t)key[0]].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+//! Keys from prefix up to the next prefix, the last prefix ends past any key likely to be stored
+std::pair<std::string, std::string> PrefixRange(uint8_t prefix)
+{
+    std::string begin(1, (char)prefix);
+    std::string end = prefix < 0xff ? std::string(1, (char)(prefix + 1)) : std::string(1024, '\xff');
+    return std::make_pair(begin, end);
+}
+} // namespace
+
 bool CDBWrapper::WriteBatch(CDBBatch& batch, bool fSync)
 {
     const bool log_memory = LogAcceptCategory(BCLog::LEVELDB);
@@ -188,8 +219,12 @@ bool CDBWrapper::WriteBatch(CDBBatch& batch, bool fSync)
     if (log_memory) {
         mem_before = DynamicMemoryUsage() / 1024.0 / 1024;
     }
+    TRACE_TIME_START(trace_start);
     leveldb::Status status = pdb->Write(fSync ? syncoptions : writeoptions, &batch.batch);
+    TRACE4(leveldb, write_batch, m_name.c_str(), batch.SizeEstimate(), fSync, TRACE_TIME_ELAPSED(trace_start));
     dbwrapper_private::HandleError(status);
+    PrefixWriteCounter counter(m_prefix_writes);
+    batch.batch.Iterate(&counter);
     if (log_memory) {
         double mem_after = DynamicMemoryUsage() / 1024.0 / 1024;
         LogPrint(BCLog::LEVELDB, "WriteBatch memory usage: db=%s, before=%.1fMiB, after=%.1fMiB\n",
@@ -207,6 +242,49 @@ size_t CDBWrapper::DynamicMemoryUsage() const {
     return stoul(memory);
 }
 
+std::map<uint8_t, CDBWrapper::PrefixStats> CDBWrapper::GetPrefixStats() const
+{
+    std::vector<std::pair<std::string, std::string>> keys(256);
+    std::vector<leveldb::Range> ranges(256);
+    for (size_t p = 0; p < 256; ++p) {
+        keys[p] = PrefixRange(p);
+        ranges[p] = leveldb::Range(keys[p].first, keys[p].second);
+    }
+    std::vector<uint64_t> sizes(256);
+    pdb->GetApproximateSizes(ranges.data(), ranges.size(), sizes.data());
+
+    std::map<uint8_t, PrefixStats> stats;
+    for (size_t p = 0; p < 256; ++p) {
+        uint64_t reads = m_prefix_reads[p].load(std::memory_order_relaxed);
+        uint64_t writes = m_prefix_writes[p].load(std::memory_order_relaxed);
+        if (sizes[p] == 0 && reads == 0 && writes == 0) {
+            continue;
+        }
+        PrefixStats &entry = stats[p];
+        entry.approximate_size = sizes[p];
+        entry.reads = reads;
+        entry.writes = writes;
+    }
+    return stats;
+}
+
+void CDBWrapper::CompactPrefix(uint8_t prefix) const
+{
+    std::pair<std::string, std::string> keys = PrefixRange(prefix);
+    leveldb::Slice slBegin(keys.first);
+    leveldb::Slice slEnd(keys.second);
+    pdb->CompactRange(&slBegin, prefix < 0xff ? &slEnd : nullptr);
+}
+
+std::string CDBWrapper::GetLevelDBStats() const
+{
+    std::string stats;
+    if (!pdb->GetProperty("leveldb.stats", &stats)) {
+        LogPrint(BCLog::LEVELDB, "Failed to get stats property\n");
+    }
+    return stats;
+}
+
 // Prefixed with null character to avoid collisions with other keys
 //
 // We must use a string constructor which specifies length so that we copy
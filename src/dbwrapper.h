@@ -15,6 +15,12 @@
 #include <leveldb/db.h>
 #include <leveldb/write_batch.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+
 static const size_t DBWRAPPER_PREALLOC_KEY_SIZE = 64;
 static const size_t DBWRAPPER_PREALLOC_VALUE_SIZE = 1024;
 
@@ -68,6 +74,12 @@ public:
         size_estimate = 0;
     }
 
+    void Append(const CDBBatch& other)
+    {
+        batch.Append(other.batch);
+        size_estimate += other.size_estimate;
+    }
+
     template <typename K, typename V>
     void Write(const K& key, const V& value)
     {
@@ -221,6 +233,17 @@ private:
 
     std::vector<unsigned char> CreateObfuscateKey() const;
 
+    //! Point reads and written puts and erasures, counted by the first byte of the key
+    mutable std::array<std::atomic<uint64_t>, 256> m_prefix_reads{};
+    std::array<std::atomic<uint64_t>, 256> m_prefix_writes{};
+
+    void CountRead(const leveldb::Slice& key) const
+    {
+        if (!key.empty()) {
+            m_prefix_reads[(uint8_t)key[0]].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
 public:
     /**
      * @param[in] path          Location in the filesystem where leveldb data will be stored.
@@ -246,6 +269,7 @@ public:
         ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
         ssKey << key;
         leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        CountRead(slKey);
 
         std::string strValue;
         leveldb::Status status = pdb->Get(readoptions, slKey, &strValue);
@@ -265,6 +289,56 @@ public:
         return true;
     }
 
+    /**
+     * Read the values of many keys, values[k] and found[k] are set for keys[k].
+     * The keys are visited in the order leveldb stores them through a single
+     * iterator, so each table block is read once and all values come from the
+     * same state of the db. Returns the number of keys found.
+     */
+    template <typename K, typename V>
+    size_t ReadMany(const std::vector<K>& keys, std::vector<V>& values, std::vector<bool>& found) const
+    {
+        std::vector<std::pair<std::string, size_t>> sorted_keys(keys.size());
+        for (size_t k = 0; k < keys.size(); ++k) {
+            CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+            ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
+            ssKey << keys[k];
+            sorted_keys[k] = std::make_pair(std::string(ssKey.begin(), ssKey.end()), k);
+        }
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+
+        values.assign(keys.size(), V());
+        found.assign(keys.size(), false);
+        size_t num_found = 0;
+        std::unique_ptr<leveldb::Iterator> it(pdb->NewIterator(readoptions));
+        for (const auto& key : sorted_keys) {
+            leveldb::Slice slKey(key.first);
+            CountRead(slKey);
+            // Repeated keys are adjacent once sorted
+            if (!it->Valid() || it->key() != slKey) {
+                it->Seek(slKey);
+            }
+            if (!it->Valid() || it->key() != slKey) {
+                continue;
+            }
+            leveldb::Slice slValue = it->value();
+            try {
+                CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+                ssValue.Xor(obfuscate_key);
+                ssValue >> values[key.second];
+            } catch (const std::exception&) {
+                continue;
+            }
+            found[key.second] = true;
+            num_found++;
+        }
+        if (!it->status().ok()) {
+            LogPrintf("LevelDB read failure: %s\n", it->status().ToString());
+            dbwrapper_private::HandleError(it->status());
+        }
+        return num_found;
+    }
+
     template <typename K>
     bool ReadStream(const K& key, CDataStream& ssValue) const
     {
@@ -272,6 +346,7 @@ public:
         ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
         ssKey << key;
         leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        CountRead(slKey);
 
         std::string strValue;
         leveldb::Status status = pdb->Get(readoptions, slKey, &strValue);
@@ -305,6 +380,7 @@ public:
         ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
         ssKey << key;
         leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        CountRead(slKey);
 
         std::string strValue;
         leveldb::Status status = pdb->Get(readoptions, slKey, &strValue);
@@ -330,11 +406,52 @@ public:
     // Get an estimate of LevelDB memory usage (in bytes).
     size_t DynamicMemoryUsage() const;
 
+    struct PrefixStats {
+        uint64_t approximate_size = 0;
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+    };
+
+    /**
+     * Statistics of the keys by their first byte, for each prefix with data on disk or
+     * read or written since the db was opened. Sizes don't include the unflushed memtable.
+     */
+    std::map<uint8_t, PrefixStats> GetPrefixStats() const;
+
+    //! Compact the keys starting with prefix
+    void CompactPrefix(uint8_t prefix) const;
+
+    //! LevelDB's own compaction statistics, per level
+    std::string GetLevelDBStats() const;
+
     CDBIterator *NewIterator()
     {
         return new CDBIterator(*this, pdb->NewIterator(iteroptions));
     }
 
+    /** Pins a consistent view of the database, for iterators that must all see the same state */
+    class Snapshot
+    {
+    public:
+        explicit Snapshot(CDBWrapper &parent) : m_parent(parent), m_snapshot(parent.pdb->GetSnapshot()) {}
+        ~Snapshot() { m_parent.pdb->ReleaseSnapshot(m_snapshot); }
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+    private:
+        CDBWrapper &m_parent;
+        const leveldb::Snapshot *m_snapshot;
+
+        friend class CDBWrapper;
+    };
+
+    CDBIterator *NewIterator(const Snapshot &snapshot)
+    {
+        leveldb::ReadOptions options = iteroptions;
+        options.snapshot = snapshot.m_snapshot;
+        return new CDBIterator(*this, pdb->NewIterator(options));
+    }
+
     /**
      * Return true if the database managed by this class contains no entries.
      */
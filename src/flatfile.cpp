@@ -10,6 +10,13 @@
 #include <tinyformat.h>
 #include <util/system.h>
 
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 FlatFileSeq::FlatFileSeq(fs::path dir, const char* prefix, size_t chunk_size) :
     m_dir(std::move(dir)),
     m_prefix(prefix),
@@ -96,3 +103,68 @@ bool FlatFileSeq::Flush(const FlatFilePos& pos, bool finalize)
     fclose(file);
     return true;
 }
+
+MappedFlatFile::~MappedFlatFile()
+{
+#ifndef WIN32
+    munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+}
+
+static std::shared_ptr<const MappedFlatFile> MapFile(const fs::path& path, size_t min_size)
+{
+#ifndef WIN32
+    int fd = open(path.string().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || (size_t)st.st_size < min_size) {
+        close(fd);
+        return nullptr;
+    }
+    void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        LogPrintf("Unable to map %s\n", path.string());
+        return nullptr;
+    }
+    return std::make_shared<const MappedFlatFile>(static_cast<const unsigned char*>(data), st.st_size);
+#else
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<const MappedFlatFile> FlatFileMapCache::Map(const FlatFileSeq& seq, const FlatFilePos& pos, size_t min_size)
+{
+    if (pos.IsNull()) {
+        return nullptr;
+    }
+    LOCK(m_mutex);
+    for (auto it = m_files.begin(); it != m_files.end(); ++it) {
+        if (it->first != pos.nFile) {
+            continue;
+        }
+        if (it->second->size() >= min_size) {
+            m_files.splice(m_files.begin(), m_files, it);
+            return it->second;
+        }
+        m_files.erase(it);
+        break;
+    }
+    auto mapped = MapFile(seq.FileName(pos), min_size);
+    if (!mapped) {
+        return nullptr;
+    }
+    m_files.emplace_front(pos.nFile, mapped);
+    if (m_files.size() > m_max_files) {
+        m_files.pop_back();
+    }
+    return mapped;
+}
+
+void FlatFileMapCache::Clear()
+{
+    LOCK(m_mutex);
+    m_files.clear();
+}
@@ -6,10 +6,13 @@
 #ifndef BITCOIN_FLATFILE_H
 #define BITCOIN_FLATFILE_H
 
+#include <list>
+#include <memory>
 #include <string>
 
 #include <fs.h>
 #include <serialize.h>
+#include <sync.h>
 
 struct FlatFilePos
 {
@@ -87,4 +90,50 @@ public:
     bool Flush(const FlatFilePos& pos, bool finalize = false);
 };
 
+/** A read-only memory mapping of a whole file. */
+class MappedFlatFile
+{
+private:
+    const unsigned char* m_data;
+    size_t m_size;
+
+public:
+    MappedFlatFile(const unsigned char* data, size_t size) : m_data(data), m_size(size) {}
+    ~MappedFlatFile();
+    MappedFlatFile(const MappedFlatFile&) = delete;
+    MappedFlatFile& operator=(const MappedFlatFile&) = delete;
+
+    const unsigned char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+};
+
+/**
+ * Keeps the most recently used files of a FlatFileSeq mapped read-only, so
+ * reads are served from the page cache without syscalls or copies into a
+ * FILE buffer. Unsupported on Windows, where Map always fails.
+ */
+class FlatFileMapCache
+{
+private:
+    const size_t m_max_files;
+    Mutex m_mutex;
+    //! Front is the most recently used
+    std::list<std::pair<int, std::shared_ptr<const MappedFlatFile>>> m_files GUARDED_BY(m_mutex);
+
+public:
+    explicit FlatFileMapCache(size_t max_files) : m_max_files(max_files) {}
+
+    /**
+     * Get a mapping of the file at pos that is at least min_size bytes long.
+     * A cached mapping that is too short, for a file that has grown since,
+     * is replaced.
+     *
+     * @return nullptr if the file can't be mapped or is shorter than min_size.
+     */
+    std::shared_ptr<const MappedFlatFile> Map(const FlatFileSeq& seq, const FlatFilePos& pos, size_t min_size);
+
+    /** Drop all mappings, existing users keep theirs alive until released. */
+    void Clear();
+};
+
 #endif // BITCOIN_FLATFILE_H
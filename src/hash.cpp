@@ -6,7 +6,9 @@
 #include <crypto/common.h>
 #include <crypto/hmac_sha512.h>
 
+#include <algorithm>
 #include <string>
+#include <string.h>
 
 inline uint32_t ROTL32(uint32_t x, int8_t r)
 {
@@ -104,3 +106,42 @@ CHashWriter TaggedHash(const std::string& tag)
     writer << taghash << taghash;
     return writer;
 }
+
+void Hash160Batch(unsigned char* output, const unsigned char* input, size_t len, size_t n)
+{
+    if (len > 55) {
+        for (size_t i = 0; i < n; ++i) {
+            CHash160().Write({input + i * len, len}).Finalize({output + i * CHash160::OUTPUT_SIZE, CHash160::OUTPUT_SIZE});
+        }
+        return;
+    }
+
+    // Both stages fit in one block, pad every message in place and run the multi-way kernels
+    static const size_t BATCH_SIZE = 64;
+    unsigned char blocks[BATCH_SIZE * 64], digests[BATCH_SIZE * CSHA256::OUTPUT_SIZE];
+    while (n) {
+        size_t batch = std::min(n, BATCH_SIZE);
+        memset(blocks, 0, batch * 64);
+        for (size_t i = 0; i < batch; ++i) {
+            unsigned char* block = blocks + i * 64;
+            memcpy(block, input + i * len, len);
+            block[len] = 0x80;
+            WriteBE64(block + 56, len * 8);
+        }
+        SHA256Padded64(digests, blocks, batch);
+
+        memset(blocks, 0, batch * 64);
+        for (size_t i = 0; i < batch; ++i) {
+            unsigned char* block = blocks + i * 64;
+            memcpy(block, digests + i * CSHA256::OUTPUT_SIZE, CSHA256::OUTPUT_SIZE);
+            block[CSHA256::OUTPUT_SIZE] = 0x80;
+            WriteLE64(block + 56, CSHA256::OUTPUT_SIZE * 8);
+        }
+        RIPEMD160Padded64(output, blocks, batch);
+
+        input += batch * len;
+        output += batch * CRIPEMD160::OUTPUT_SIZE;
+        n -= batch;
+    }
+}
+
@@ -107,6 +107,11 @@ inline uint160 Hash160(const T1& in1)
     return result;
 }
 
+/** Compute the 160-bit hashes of n messages of len bytes each, stored back to back in input.
+ *  Writes n*20 bytes to output. Messages of up to 55 bytes are hashed several at a time.
+ */
+void Hash160Batch(unsigned char* output, const unsigned char* input, size_t len, size_t n);
+
 /** A writer stream (for serialization) that computes a 256-bit hash. */
 class CHashWriter
 {
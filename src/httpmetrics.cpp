@@ -0,0 +1,149 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <httprpc.h>
+
+#include <httpserver.h>
+#include <net.h>
+#include <node/context.h>
+#include <policy/fees.h>
+#include <proofcache.h>
+#include <pubkey.h>
+#include <rpc/protocol.h>
+#include <smsg/smessage.h>
+#include <sync.h>
+#include <txmempool.h>
+#include <util/metrics.h>
+#include <util/ref.h>
+#include <validation.h>
+#include <validationstats.h>
+
+#include <tinyformat.h>
+
+static const char* METRICS_PATH = "/metrics";
+
+static void CollectNode(const util::Ref& context, MetricsWriter& writer)
+{
+    NodeContext* node = context.Has<NodeContext>() ? &context.Get<NodeContext>() : nullptr;
+    if (!node) {
+        return;
+    }
+    {
+        LOCK(cs_main);
+        writer.Family("ghost_chain_height", "gauge", "Height of the active chain");
+        writer.Sample("ghost_chain_height", "", ::ChainActive().Height());
+        writer.Family("ghost_coins_cache_bytes", "gauge", "Memory used by the coins tip cache");
+        writer.Sample("ghost_coins_cache_bytes", "", ::ChainstateActive().CoinsTip().DynamicMemoryUsage());
+    }
+    if (node->mempool) {
+        const CTxMemPool& pool = *node->mempool;
+        LOCK(pool.cs);
+        writer.Family("ghost_mempool_transactions", "gauge", "Transactions in the mempool");
+        writer.Sample("ghost_mempool_transactions", "", pool.size());
+        writer.Family("ghost_mempool_bytes", "gauge", "Virtual size of the mempool transactions");
+        writer.Sample("ghost_mempool_bytes", "", pool.GetTotalTxSize());
+        writer.Family("ghost_mempool_usage_bytes", "gauge", "Memory used by the mempool entries of each transaction type");
+        for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+            const FeeEstimateTxType tx_type = (FeeEstimateTxType)i;
+            writer.Sample("ghost_mempool_usage_bytes", strprintf("type=\"%s\"", StringForFeeEstimateTxType(tx_type)), pool.DynamicMemoryUsage(tx_type));
+        }
+    }
+    if (node->connman) {
+        writer.Family("ghost_net_peers", "gauge", "Connected peers");
+        writer.Sample("ghost_net_peers", "", node->connman->GetNodeCount(CConnman::CONNECTIONS_ALL));
+        writer.Family("ghost_net_bytes_total", "counter", "Bytes received and sent");
+        writer.Sample("ghost_net_bytes_total", "direction=\"recv\"", node->connman->GetTotalBytesRecv());
+        writer.Sample("ghost_net_bytes_total", "direction=\"sent\"", node->connman->GetTotalBytesSent());
+    }
+}
+
+static void CollectValidation(MetricsWriter& writer)
+{
+    writer.Family("ghost_validation_stage_seconds_total", "counter", "Time spent in each ConnectBlock stage");
+    writer.Family("ghost_validation_stage_items_total", "counter", "Items (transactions, checks, ...) processed by each ConnectBlock stage");
+    writer.Family("ghost_validation_stage_blocks_total", "counter", "Blocks that ran each ConnectBlock stage");
+    for (int k = 0; k < (int)ValidationBlockKind::COUNT; ++k) {
+        const ValidationBlockKind kind = (ValidationBlockKind)k;
+        const std::vector<ValidationStats::StageStats> stats = g_validation_stats.GetStats(kind);
+        for (int i = 0; i < (int)ValidationStage::COUNT; ++i) {
+            const std::string labels = strprintf("kind=\"%s\",stage=\"%s\"", ValidationBlockKindName(kind), ValidationStageName((ValidationStage)i));
+            writer.Sample("ghost_validation_stage_seconds_total", labels, stats[i].total_micros / 1e6);
+            writer.Sample("ghost_validation_stage_items_total", labels, stats[i].items);
+            writer.Sample("ghost_validation_stage_blocks_total", labels, stats[i].blocks);
+        }
+    }
+}
+
+static void CollectCaches(MetricsWriter& writer)
+{
+    uint64_t proof_hits, proof_misses;
+    GetProofCacheStats(proof_hits, proof_misses);
+    const PubKeyCacheStats pubkey_stats = GetPubKeyCacheStats();
+    writer.Family("ghost_cache_lookups_total", "counter", "Cache lookups by result");
+    writer.Sample("ghost_cache_lookups_total", "cache=\"proof\",result=\"hit\"", proof_hits);
+    writer.Sample("ghost_cache_lookups_total", "cache=\"proof\",result=\"miss\"", proof_misses);
+    writer.Sample("ghost_cache_lookups_total", "cache=\"pubkey\",result=\"hit\"", pubkey_stats.hits);
+    writer.Sample("ghost_cache_lookups_total", "cache=\"pubkey\",result=\"miss\"", pubkey_stats.misses);
+    writer.Family("ghost_cache_entries", "gauge", "Entries in the cache");
+    writer.Sample("ghost_cache_entries", "cache=\"pubkey\"", pubkey_stats.entries);
+}
+
+static void CollectSmsg(MetricsWriter& writer)
+{
+    writer.Family("ghost_smsg_enabled", "gauge", "Whether secure messaging is enabled");
+    writer.Sample("ghost_smsg_enabled", "", smsg::fSecMsgEnabled);
+    if (!smsg::fSecMsgEnabled) {
+        return;
+    }
+    size_t num_buckets;
+    {
+        LOCK(smsgModule.cs_smsg);
+        num_buckets = smsgModule.buckets.size();
+    }
+    size_t queued_messages, queued_bytes;
+    smsgModule.GetNetQueueDepth(queued_messages, queued_bytes);
+    writer.Family("ghost_smsg_buckets", "gauge", "Message buckets held");
+    writer.Sample("ghost_smsg_buckets", "", num_buckets);
+    writer.Family("ghost_smsg_net_queue_messages", "gauge", "Received smsg p2p messages waiting for the net worker threads");
+    writer.Sample("ghost_smsg_net_queue_messages", "", queued_messages);
+    writer.Family("ghost_smsg_net_queue_bytes", "gauge", "Bytes of received smsg p2p messages waiting for the net worker threads");
+    writer.Sample("ghost_smsg_net_queue_bytes", "", queued_bytes);
+    writer.Family("ghost_smsg_funding_cache_entries", "gauge", "Funding transactions in the cache");
+    writer.Sample("ghost_smsg_funding_cache_entries", "", smsgModule.FundingCacheCount());
+    writer.Family("ghost_smsg_pow_hashes_total", "counter", "Proof of work hashes tried for sent messages");
+    writer.Sample("ghost_smsg_pow_hashes_total", "", smsgModule.m_pow_hashes.load());
+}
+
+static bool HTTPReq_Metrics(HTTPRequest* req, const std::string&)
+{
+    if (req->GetRequestMethod() != HTTPRequest::GET) {
+        req->WriteReply(HTTP_BAD_METHOD, "Only GET is supported");
+        return false;
+    }
+    req->WriteHeader("Content-Type", "text/plain; version=0.0.4");
+    req->WriteReply(HTTP_OK, g_metrics.Render());
+    return true;
+}
+
+void StartHTTPMetrics(const util::Ref& context)
+{
+    g_metrics.AddCollector("node", [&context](MetricsWriter& writer) { CollectNode(context, writer); });
+    g_metrics.AddCollector("validation", CollectValidation);
+    g_metrics.AddCollector("caches", CollectCaches);
+    g_metrics.AddCollector("smsg", CollectSmsg);
+    RegisterHTTPHandler(METRICS_PATH, true, HTTPReq_Metrics);
+}
+
+void InterruptHTTPMetrics()
+{
+}
+
+void StopHTTPMetrics()
+{
+    UnregisterHTTPHandler(METRICS_PATH, true);
+    g_metrics.RemoveCollector("node");
+    g_metrics.RemoveCollector("validation");
+    g_metrics.RemoveCollector("caches");
+    g_metrics.RemoveCollector("smsg");
+}
@@ -7,6 +7,7 @@
 #include <chainparams.h>
 #include <crypto/hmac_sha256.h>
 #include <httpserver.h>
+#include <rpc/jsonstream.h>
 #include <rpc/protocol.h>
 #include <rpc/server.h>
 #include <util/strencodings.h>
@@ -213,7 +214,42 @@ static bool HTTPReq_JSONRPC(const util::Ref& context, HTTPRequest* req)
                 req->WriteReply(HTTP_FORBIDDEN);
                 return false;
             }
-            UniValue result = tableRPC.execute(jreq);
+            // Results written to the stream go out in chunks while they're produced
+            bool fReplyStarted = false;
+            auto startReply = [req, &fReplyStarted]() {
+                if (!fReplyStarted) {
+                    req->WriteHeader("Content-Type", "application/json");
+                    req->WriteReplyStart(HTTP_OK);
+                    req->WriteReplyChunk("{\"result\":");
+                    fReplyStarted = true;
+                }
+            };
+            JSONStreamWriter stream([req, &startReply](const std::string& chunk) {
+                startReply();
+                req->WriteReplyChunk(chunk);
+            });
+            jreq.stream = &stream;
+            UniValue result;
+            try {
+                result = tableRPC.execute(jreq);
+            } catch (...) {
+                if (fReplyStarted) {
+                    // The status is out, the client sees a truncated reply
+                    LogPrintf("RPC %s failed after its reply started\n", jreq.strMethod);
+                    req->WriteReplyEnd();
+                    return false;
+                }
+                stream.Discard();
+                throw;
+            }
+            if (stream.HasValue()) {
+                stream.Flush();
+                startReply();
+                req->WriteReplyChunk(",\"error\":null,\"id\":" + jreq.id.write() + "}\n");
+                req->WriteReplyEnd();
+                return true;
+            }
+            stream.Discard();
 
             // Send reply
             strReply = JSONRPCReply(result, NullUniValue, jreq.id);
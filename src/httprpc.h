@@ -33,4 +33,16 @@ void InterruptREST();
  */
 void StopREST();
 
+/** Start serving the metrics registry on /metrics.
+ * Precondition; HTTP and RPC has been started.
+ */
+void StartHTTPMetrics(const util::Ref& context);
+/** Interrupt the HTTP metrics endpoint.
+ */
+void InterruptHTTPMetrics();
+/** Stop serving metrics.
+ * Precondition; HTTP and RPC has been stopped.
+ */
+void StopHTTPMetrics();
+
 #endif
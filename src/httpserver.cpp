@@ -16,7 +16,9 @@
 #include <util/threadnames.h>
 #include <util/translation.h>
 
+#include <algorithm>
 #include <deque>
+#include <map>
 #include <memory>
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +26,9 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#ifndef WIN32
+#include <sys/un.h>
+#endif
 
 #include <event2/thread.h>
 #include <event2/buffer.h>
@@ -63,6 +68,20 @@ private:
     HTTPRequestHandler func;
 };
 
+/** Task run by an HTTP worker that isn't a request of its own */
+class HTTPTaskItem final : public HTTPClosure
+{
+public:
+    explicit HTTPTaskItem(std::function<void()> _task) : task(std::move(_task)) {}
+    void operator()() override
+    {
+        task();
+    }
+
+private:
+    std::function<void()> task;
+};
+
 /** Simple work queue for distributing work over multiple threads.
  * Work items are simply callable objects.
  */
@@ -73,9 +92,11 @@ private:
     /** Mutex protects entire object */
     Mutex cs;
     std::condition_variable cond;
-    std::deque<std::unique_ptr<WorkItem>> queue;
+    //! Items with the time they were queued
+    std::deque<std::pair<std::unique_ptr<WorkItem>, int64_t>> queue;
     bool running;
     size_t maxDepth;
+    HTTPWorkQueueStats stats;
 
 public:
     explicit WorkQueue(size_t _maxDepth) : running(true),
@@ -87,14 +108,17 @@ public:
     ~WorkQueue()
     {
     }
-    /** Enqueue a work item */
-    bool Enqueue(WorkItem* item)
+    /** Enqueue a work item, a rejected request is counted in the stats */
+    bool Enqueue(WorkItem* item, bool is_request = true)
     {
         LOCK(cs);
         if (queue.size() >= maxDepth) {
+            if (is_request) {
+                stats.rejected++;
+            }
             return false;
         }
-        queue.emplace_back(std::unique_ptr<WorkItem>(item));
+        queue.emplace_back(std::unique_ptr<WorkItem>(item), GetTimeMicros());
         cond.notify_one();
         return true;
     }
@@ -109,12 +133,25 @@ public:
                     cond.wait(lock);
                 if (!running)
                     break;
-                i = std::move(queue.front());
+                i = std::move(queue.front().first);
+                const int64_t wait = GetTimeMicros() - queue.front().second;
                 queue.pop_front();
+                size_t bucket = std::lower_bound(HTTP_QUEUE_WAIT_BOUNDS.begin(), HTTP_QUEUE_WAIT_BOUNDS.end(), wait) - HTTP_QUEUE_WAIT_BOUNDS.begin();
+                stats.wait_histogram[bucket]++;
+                stats.wait_max = std::max(stats.wait_max, wait);
+                stats.served++;
             }
             (*i)();
         }
     }
+    HTTPWorkQueueStats GetStats()
+    {
+        LOCK(cs);
+        HTTPWorkQueueStats result = stats;
+        result.depth = queue.size();
+        result.max_depth = maxDepth;
+        return result;
+    }
     /** Interrupt and exit loops */
     void Interrupt()
     {
@@ -145,10 +182,220 @@ static struct evhttp* eventHTTP = nullptr;
 static std::vector<CSubNet> rpc_allow_subnets;
 //! Work queue for handling longer requests off the event loop thread
 static WorkQueue<HTTPClosure>* workQueue = nullptr;
+/** A class of RPC methods served by their own work queue and threads */
+struct HTTPWorkQueueClass
+{
+    std::string name;
+    int threads;
+    WorkQueue<HTTPClosure>* queue;
+};
+//! Work queue classes, the first is the default queue workQueue
+static std::vector<HTTPWorkQueueClass> g_work_queues;
+//! RPC methods served by a queue class other than the default
+static std::map<std::string, size_t> g_rpc_method_queues;
+//! Queue class of requests to a wallet endpoint not mapped by method, 0 for the default queue
+static size_t g_rpc_wallet_queue = 0;
+//! Bytes of a request body searched for the JSON-RPC method name
+static const size_t RPC_METHOD_PEEK_SIZE = 1024;
+
+/** Methods served by the fast and heavy queue classes unless remapped with -rpcqueuemethod */
+static const char* const FAST_RPC_METHODS[] = {
+    "getblocktemplate", "submitblock", "submitheader", "sendrawtransaction",
+    "getbestblockhash", "getblockcount", "getblockhash", "getmininginfo",
+    "getnetworkinfo", "getrpcinfo", "uptime", "ping",
+};
+static const char* const HEAVY_RPC_METHODS[] = {
+    "gettxoutsetinfo", "gettxoutsetinfobyscript", "scantxoutset", "dumptxoutset",
+    "tallyvotes", "rescanblockchain", "verifychain", "getblockstats",
+    "getchaintxstats", "getaddressdeltas", "getaddresstxids", "getaddressutxos",
+    "getaddressbalance", "filtertransactions", "filteraddresses", "smsgscanchain",
+};
+
+/** Find the method name of a JSON-RPC request from the head of its body, without draining it */
+static std::string PeekRPCMethod(struct evhttp_request* req)
+{
+    struct evbuffer* buf = evhttp_request_get_input_buffer(req);
+    char head[RPC_METHOD_PEEK_SIZE];
+    ev_ssize_t size = evbuffer_copyout(buf, head, sizeof(head));
+    if (size <= 0) {
+        return "";
+    }
+    const std::string body(head, size);
+    size_t pos = body.find("\"method\"");
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos = body.find_first_not_of(" \t\r\n", pos + 8);
+    if (pos == std::string::npos || body[pos] != ':') {
+        return "";
+    }
+    pos = body.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string::npos || body[pos] != '"') {
+        return "";
+    }
+    size_t end = body.find('"', pos + 1);
+    if (end == std::string::npos) {
+        return "";
+    }
+    return body.substr(pos + 1, end - pos - 1);
+}
+
+/** Select the work queue class serving a request to the RPC endpoints */
+static size_t SelectWorkQueue(struct evhttp_request* req, const std::string& uri)
+{
+    if (g_work_queues.size() < 2) {
+        return 0;
+    }
+    bool wallet = uri.substr(0, 8) == "/wallet/";
+    if (uri != "/" && !wallet) {
+        return 0;
+    }
+    if (!g_rpc_method_queues.empty()) {
+        auto it = g_rpc_method_queues.find(PeekRPCMethod(req));
+        if (it != g_rpc_method_queues.end()) {
+            return it->second;
+        }
+    }
+    return wallet ? g_rpc_wallet_queue : 0;
+}
+
+/** Set up the work queue classes and the methods they serve */
+static bool InitWorkQueueClasses(int default_depth)
+{
+    std::map<std::string, int> threads{{"fast", DEFAULT_HTTP_FAST_THREADS}, {"wallet", DEFAULT_HTTP_WALLET_THREADS}, {"heavy", DEFAULT_HTTP_HEAVY_THREADS}};
+    for (const std::string& arg : gArgs.GetArgs("-rpcqueuethreads")) {
+        size_t sep = arg.find(':');
+        int n;
+        if (sep == std::string::npos || !threads.count(arg.substr(0, sep)) ||
+            !ParseInt32(arg.substr(sep + 1), &n) || n < 0) {
+            LogPrintf("Invalid -rpcqueuethreads=%s, expected <fast|wallet|heavy>:<n>\n", arg);
+            return false;
+        }
+        threads[arg.substr(0, sep)] = n;
+    }
+    std::vector<std::pair<std::string, std::string>> method_classes;
+    for (const std::string& arg : gArgs.GetArgs("-rpcqueuemethod")) {
+        size_t sep = arg.find(':');
+        const std::string name = sep == std::string::npos ? "" : arg.substr(sep + 1);
+        if (sep == 0 || (name != "default" && !threads.count(name))) {
+            LogPrintf("Invalid -rpcqueuemethod=%s, expected <method>:<default|fast|wallet|heavy>\n", arg);
+            return false;
+        }
+        method_classes.emplace_back(arg.substr(0, sep), name);
+    }
+
+    g_work_queues.clear();
+    g_work_queues.push_back({"default", std::max((int)gArgs.GetArg("-rpcthreads", DEFAULT_HTTP_THREADS), 1), workQueue});
+    for (const char* name : {"fast", "wallet", "heavy"}) {
+        if (threads[name] > 0) {
+            LogPrintf("HTTP: creating %s work queue of depth %d\n", name, default_depth);
+            g_work_queues.push_back({name, threads[name], new WorkQueue<HTTPClosure>(default_depth)});
+        }
+    }
+    auto find_class = [](const std::string& name) -> size_t {
+        for (size_t i = 0; i < g_work_queues.size(); ++i) {
+            if (g_work_queues[i].name == name) {
+                return i;
+            }
+        }
+        return 0;
+    };
+
+    g_rpc_method_queues.clear();
+    for (const char* method : FAST_RPC_METHODS) {
+        g_rpc_method_queues[method] = find_class("fast");
+    }
+    for (const char* method : HEAVY_RPC_METHODS) {
+        g_rpc_method_queues[method] = find_class("heavy");
+    }
+    for (const auto& method_class : method_classes) {
+        g_rpc_method_queues[method_class.first] = find_class(method_class.second);
+    }
+    // Methods of a class without threads fall back to the default queue
+    for (auto it = g_rpc_method_queues.begin(); it != g_rpc_method_queues.end();) {
+        it = it->second == 0 ? g_rpc_method_queues.erase(it) : std::next(it);
+    }
+    g_rpc_wallet_queue = find_class("wallet");
+    return true;
+}
 //! Handlers for (sub)paths
 static std::vector<HTTPPathHandler> pathHandlers;
 //! Bound listening sockets
 static std::vector<evhttp_bound_socket *> boundSockets;
+//! Paths of the bound Unix domain sockets, removed at shutdown
+static std::vector<std::string> g_unix_socket_paths;
+
+/** A connection that sent a request, only used on the event thread */
+struct HTTPConnectionState
+{
+    uint64_t requests{0};
+    bool local_socket{false};
+};
+static std::map<evhttp_connection*, HTTPConnectionState> g_http_connections;
+static int g_http_max_connections = DEFAULT_HTTP_MAX_CONNECTIONS;
+static bool g_http_keepalive = DEFAULT_HTTP_KEEPALIVE;
+static Mutex g_http_connection_stats_mutex;
+static HTTPConnectionStats g_http_connection_stats GUARDED_BY(g_http_connection_stats_mutex);
+
+/** Whether a connection came in on a Unix domain socket */
+static bool IsLocalSocketConnection(evhttp_connection* conn)
+{
+#ifndef WIN32
+    bufferevent* bev = evhttp_connection_get_bufferevent(conn);
+    if (!bev) {
+        return false;
+    }
+    struct sockaddr_storage addr;
+    socklen_t addr_len = sizeof(addr);
+    if (getsockname(bufferevent_getfd(bev), (struct sockaddr*)&addr, &addr_len) != 0) {
+        return false;
+    }
+    return addr.ss_family == AF_UNIX;
+#else
+    return false;
+#endif
+}
+
+/** Called by libevent when a connection that sent a request is freed */
+static void http_connection_close_cb(struct evhttp_connection* conn, void*)
+{
+    auto it = g_http_connections.find(conn);
+    if (it == g_http_connections.end()) {
+        return;
+    }
+    const uint64_t requests = it->second.requests;
+    g_http_connections.erase(it);
+    LOCK(g_http_connection_stats_mutex);
+    g_http_connection_stats.open = g_http_connections.size();
+    size_t bucket = std::lower_bound(HTTP_CONN_REQUEST_BOUNDS.begin(), HTTP_CONN_REQUEST_BOUNDS.end(), requests) - HTTP_CONN_REQUEST_BOUNDS.begin();
+    g_http_connection_stats.requests_histogram[bucket]++;
+}
+
+/** Track the connection of a request, false when it must be refused */
+static bool TrackHTTPConnection(evhttp_connection* conn, bool& local_socket)
+{
+    auto it = g_http_connections.find(conn);
+    if (it == g_http_connections.end()) {
+        if (g_http_max_connections > 0 && g_http_connections.size() >= (size_t)g_http_max_connections) {
+            LOCK(g_http_connection_stats_mutex);
+            g_http_connection_stats.refused++;
+            return false;
+        }
+        it = g_http_connections.emplace(conn, HTTPConnectionState()).first;
+        it->second.local_socket = IsLocalSocketConnection(conn);
+        evhttp_connection_set_closecb(conn, http_connection_close_cb, nullptr);
+        LOCK(g_http_connection_stats_mutex);
+        g_http_connection_stats.accepted++;
+        g_http_connection_stats.open = g_http_connections.size();
+    }
+    local_socket = it->second.local_socket;
+    LOCK(g_http_connection_stats_mutex);
+    g_http_connection_stats.requests++;
+    if (it->second.requests++ > 0) {
+        g_http_connection_stats.reused++;
+    }
+    return true;
+}
 
 /** Check if a network address is allowed to access the HTTP server */
 static bool ClientAllowed(const CNetAddr& netaddr)
@@ -228,10 +475,26 @@ static void http_request_cb(struct evhttp_request* req, void* arg)
     }
     std::unique_ptr<HTTPRequest> hreq(new HTTPRequest(req));
 
-    // Early address-based allow check
-    if (!ClientAllowed(hreq->GetPeer())) {
+    bool local_socket = false;
+    evhttp_connection* conn = evhttp_request_get_connection(req);
+    if (conn && !TrackHTTPConnection(conn, local_socket)) {
+        LogPrint(BCLog::HTTP, "HTTP request from %s rejected: %d connections open, it can be increased with the -rpcmaxconnections= setting\n",
+                 hreq->GetPeer().ToString(), g_http_max_connections);
+        hreq->WriteHeader("Connection", "close");
+        hreq->WriteReply(HTTP_SERVICE_UNAVAILABLE, "Too many connections");
+        return;
+    }
+    if (!g_http_keepalive) {
+        // libevent closes the connection after the reply
+        hreq->WriteHeader("Connection", "close");
+    }
+
+    // Early address-based allow check, a Unix domain socket is reachable from this host only
+    if (!local_socket && !ClientAllowed(hreq->GetPeer())) {
         LogPrint(BCLog::HTTP, "HTTP request from %s rejected: Client network is not allowed RPC access\n",
                  hreq->GetPeer().ToString());
+        // Don't hold a connection slot
+        hreq->WriteHeader("Connection", "close");
         hreq->WriteReply(HTTP_FORBIDDEN);
         return;
     }
@@ -266,12 +529,13 @@ static void http_request_cb(struct evhttp_request* req, void* arg)
 
     // Dispatch to worker thread
     if (i != iend) {
-        std::unique_ptr<HTTPWorkItem> item(new HTTPWorkItem(std::move(hreq), path, i->handler));
         assert(workQueue);
-        if (workQueue->Enqueue(item.get()))
+        const HTTPWorkQueueClass& queue_class = g_work_queues[SelectWorkQueue(req, strURI)];
+        std::unique_ptr<HTTPWorkItem> item(new HTTPWorkItem(std::move(hreq), path, i->handler));
+        if (queue_class.queue->Enqueue(item.get()))
             item.release(); /* if true, queue took ownership */
         else {
-            LogPrintf("WARNING: request rejected because http work queue depth exceeded, it can be increased with the -rpcworkqueue= setting\n");
+            LogPrintf("WARNING: request rejected because http %s work queue depth exceeded, it can be increased with the -rpcworkqueue= setting\n", queue_class.name);
             item->req->WriteReply(HTTP_INTERNAL_SERVER_ERROR, "Work queue depth exceeded");
         }
     } else {
@@ -297,24 +561,76 @@ static bool ThreadHTTP(struct event_base* base)
     return event_base_got_break(base) == 0;
 }
 
+/** Listen for HTTP connections on a Unix domain socket at path */
+static bool HTTPBindUnixSocket(struct evhttp* http, const std::string& path)
+{
+#ifndef WIN32
+    struct sockaddr_un addr;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+        return false;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path.c_str(), path.size());
+
+    evutil_socket_t fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    // A socket file left by an earlier run would fail the bind
+    unlink(path.c_str());
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        chmod(path.c_str(), S_IRUSR | S_IWUSR) != 0 ||
+        listen(fd, SOMAXCONN) != 0 ||
+        evutil_make_socket_nonblocking(fd) != 0) {
+        evutil_closesocket(fd);
+        return false;
+    }
+    evhttp_bound_socket* bind_handle = evhttp_accept_socket_with_handle(http, fd);
+    if (!bind_handle) {
+        evutil_closesocket(fd);
+        unlink(path.c_str());
+        return false;
+    }
+    boundSockets.push_back(bind_handle);
+    g_unix_socket_paths.push_back(path);
+    return true;
+#else
+    return false;
+#endif
+}
+
 /** Bind HTTP server to specified addresses */
 static bool HTTPBindAddresses(struct evhttp* http)
 {
     int http_port = gArgs.GetArg("-rpcport", BaseParams().RPCPort());
     std::vector<std::pair<std::string, uint16_t> > endpoints;
 
+    // Unix domain sockets are bound without -rpcallowip, they can only be reached from this host
+    std::vector<std::string> tcp_binds;
+    std::vector<std::string> unix_paths;
+    for (const std::string& strRPCBind : gArgs.GetArgs("-rpcbind")) {
+        if (strRPCBind.substr(0, 5) == "unix:") {
+            unix_paths.push_back(strRPCBind.substr(5));
+        } else {
+            tcp_binds.push_back(strRPCBind);
+        }
+    }
+
     // Determine what addresses to bind to
-    if (!(gArgs.IsArgSet("-rpcallowip") && gArgs.IsArgSet("-rpcbind"))) { // Default to loopback if not allowing external IPs
+    if (tcp_binds.empty() && !unix_paths.empty()) {
+        // Only Unix domain sockets
+    } else if (!(gArgs.IsArgSet("-rpcallowip") && !tcp_binds.empty())) { // Default to loopback if not allowing external IPs
         endpoints.push_back(std::make_pair("::1", http_port));
         endpoints.push_back(std::make_pair("127.0.0.1", http_port));
         if (gArgs.IsArgSet("-rpcallowip")) {
             LogPrintf("WARNING: option -rpcallowip was specified without -rpcbind; this doesn't usually make sense\n");
         }
-        if (gArgs.IsArgSet("-rpcbind")) {
+        if (!tcp_binds.empty()) {
             LogPrintf("WARNING: option -rpcbind was ignored because -rpcallowip was not specified, refusing to allow everyone to connect\n");
         }
-    } else if (gArgs.IsArgSet("-rpcbind")) { // Specific bind address
-        for (const std::string& strRPCBind : gArgs.GetArgs("-rpcbind")) {
+    } else { // Specific bind address
+        for (const std::string& strRPCBind : tcp_binds) {
             int port = http_port;
             std::string host;
             SplitHostPort(strRPCBind, port, host);
@@ -336,13 +652,19 @@ static bool HTTPBindAddresses(struct evhttp* http)
             LogPrintf("Binding RPC on address %s port %i failed.\n", i->first, i->second);
         }
     }
+    for (const std::string& path : unix_paths) {
+        LogPrint(BCLog::HTTP, "Binding RPC on Unix domain socket %s\n", path);
+        if (!HTTPBindUnixSocket(http, path)) {
+            LogPrintf("Binding RPC on Unix domain socket %s failed.\n", path);
+        }
+    }
     return !boundSockets.empty();
 }
 
 /** Simple wrapper to set thread name and run work queue */
-static void HTTPWorkQueueRun(WorkQueue<HTTPClosure>* queue, int worker_num)
+static void HTTPWorkQueueRun(WorkQueue<HTTPClosure>* queue, const std::string& name, int worker_num)
 {
-    util::ThreadRename(strprintf("httpworker.%i", worker_num));
+    util::ThreadRename(strprintf("%s.%i", name, worker_num));
     queue->Run();
 }
 
@@ -395,6 +717,8 @@ bool InitHTTPServer()
     evhttp_set_max_headers_size(http, MAX_HEADERS_SIZE);
     evhttp_set_max_body_size(http, MAX_SIZE);
     evhttp_set_gencb(http, http_request_cb, nullptr);
+    g_http_max_connections = std::max((int)gArgs.GetArg("-rpcmaxconnections", DEFAULT_HTTP_MAX_CONNECTIONS), 0);
+    g_http_keepalive = gArgs.GetBoolArg("-rpckeepalive", DEFAULT_HTTP_KEEPALIVE);
 
     if (!HTTPBindAddresses(http)) {
         LogPrintf("Unable to bind any endpoint for RPC server\n");
@@ -406,6 +730,11 @@ bool InitHTTPServer()
     LogPrintf("HTTP: creating work queue of depth %d\n", workQueueDepth);
 
     workQueue = new WorkQueue<HTTPClosure>(workQueueDepth);
+    if (!InitWorkQueueClasses(workQueueDepth)) {
+        delete workQueue;
+        workQueue = nullptr;
+        return false;
+    }
     // transfer ownership to eventBase/HTTP via .release()
     eventBase = base_ctr.release();
     eventHTTP = http_ctr.release();
@@ -432,13 +761,46 @@ static std::vector<std::thread> g_thread_http_workers;
 void StartHTTPServer()
 {
     LogPrint(BCLog::HTTP, "Starting HTTP server\n");
-    int rpcThreads = std::max((long)gArgs.GetArg("-rpcthreads", DEFAULT_HTTP_THREADS), 1L);
-    LogPrintf("HTTP: starting %d worker threads\n", rpcThreads);
     g_thread_http = std::thread(ThreadHTTP, eventBase);
 
-    for (int i = 0; i < rpcThreads; i++) {
-        g_thread_http_workers.emplace_back(HTTPWorkQueueRun, workQueue, i);
+    for (const HTTPWorkQueueClass& queue_class : g_work_queues) {
+        LogPrintf("HTTP: starting %d %s worker threads\n", queue_class.threads, queue_class.name);
+        const std::string thread_name = queue_class.queue == workQueue ? "httpworker" : "http" + queue_class.name;
+        for (int i = 0; i < queue_class.threads; i++) {
+            g_thread_http_workers.emplace_back(HTTPWorkQueueRun, queue_class.queue, thread_name, i);
+        }
+    }
+}
+
+bool EnqueueHTTPTask(std::function<void()> task)
+{
+    if (!workQueue) {
+        return false;
+    }
+    std::unique_ptr<HTTPTaskItem> item(new HTTPTaskItem(std::move(task)));
+    if (!workQueue->Enqueue(item.get(), /* is_request */ false)) {
+        return false;
     }
+    item.release(); /* if true, queue took ownership */
+    return true;
+}
+
+HTTPConnectionStats GetHTTPConnectionStats()
+{
+    LOCK(g_http_connection_stats_mutex);
+    return g_http_connection_stats;
+}
+
+std::vector<HTTPWorkQueueStats> GetHTTPWorkQueueStats()
+{
+    std::vector<HTTPWorkQueueStats> result;
+    for (const HTTPWorkQueueClass& queue_class : g_work_queues) {
+        HTTPWorkQueueStats stats = queue_class.queue->GetStats();
+        stats.name = queue_class.name;
+        stats.threads = queue_class.threads;
+        result.push_back(stats);
+    }
+    return result;
 }
 
 void InterruptHTTPServer()
@@ -448,8 +810,9 @@ void InterruptHTTPServer()
         // Reject requests on current connections
         evhttp_set_gencb(eventHTTP, http_reject_request_cb, nullptr);
     }
-    if (workQueue)
-        workQueue->Interrupt();
+    for (const HTTPWorkQueueClass& queue_class : g_work_queues) {
+        queue_class.queue->Interrupt();
+    }
 }
 
 void StopHTTPServer()
@@ -461,7 +824,11 @@ void StopHTTPServer()
             thread.join();
         }
         g_thread_http_workers.clear();
-        delete workQueue;
+        for (const HTTPWorkQueueClass& queue_class : g_work_queues) {
+            delete queue_class.queue;
+        }
+        g_work_queues.clear();
+        g_rpc_method_queues.clear();
         workQueue = nullptr;
     }
     // Unlisten sockets, these are what make the event loop running, which means
@@ -470,6 +837,10 @@ void StopHTTPServer()
         evhttp_del_accept_socket(eventHTTP, socket);
     }
     boundSockets.clear();
+    for (const std::string& path : g_unix_socket_paths) {
+        unlink(path.c_str());
+    }
+    g_unix_socket_paths.clear();
     if (eventBase) {
         LogPrint(BCLog::HTTP, "Waiting for HTTP event thread to exit\n");
         if (g_thread_http.joinable()) g_thread_http.join();
@@ -522,6 +893,11 @@ HTTPRequest::HTTPRequest(struct evhttp_request* _req, bool _replySent) : req(_re
 
 HTTPRequest::~HTTPRequest()
 {
+    if (replyStarted && !replySent) {
+        // A truncated body is the best that can be done once the status is out
+        LogPrintf("%s: Unfinished chunked reply\n", __func__);
+        WriteReplyEnd();
+    }
     if (!replySent) {
         // Keep track of whether reply was sent to avoid request leaks
         LogPrintf("%s: Unhandled request\n", __func__);
@@ -603,6 +979,61 @@ void HTTPRequest::WriteReply(int nStatus, const std::string& strReply)
     req = nullptr; // transferred back to main thread
 }
 
+/** The chunks are sent from the main http thread in the order they're written,
+ * events triggered from the same thread run in turn.
+ */
+void HTTPRequest::WriteReplyStart(int nStatus)
+{
+    assert(!replySent && !replyStarted && req);
+    if (ShutdownRequested()) {
+        WriteHeader("Connection", "close");
+    }
+    auto req_copy = req;
+    HTTPEvent* ev = new HTTPEvent(eventBase, true, [req_copy, nStatus]{
+        evhttp_send_reply_start(req_copy, nStatus, nullptr);
+    });
+    ev->trigger(nullptr);
+    replyStarted = true;
+}
+
+void HTTPRequest::WriteReplyChunk(const std::string& strChunk)
+{
+    assert(replyStarted && req);
+    if (strChunk.empty()) {
+        return; // An empty chunk would end the reply
+    }
+    struct evbuffer* evb = evbuffer_new();
+    assert(evb);
+    evbuffer_add(evb, strChunk.data(), strChunk.size());
+    auto req_copy = req;
+    HTTPEvent* ev = new HTTPEvent(eventBase, true, [req_copy, evb]{
+        // Does nothing if the client went away, the request is freed by evhttp_send_reply_end
+        evhttp_send_reply_chunk(req_copy, evb);
+        evbuffer_free(evb);
+    });
+    ev->trigger(nullptr);
+}
+
+void HTTPRequest::WriteReplyEnd()
+{
+    assert(replyStarted && req);
+    auto req_copy = req;
+    HTTPEvent* ev = new HTTPEvent(eventBase, true, [req_copy]{
+        evhttp_connection* conn = evhttp_request_get_connection(req_copy);
+        evhttp_send_reply_end(req_copy);
+        // Re-enable reading from the socket, as in WriteReply.
+        if (conn && event_get_version_number() >= 0x02010600 && event_get_version_number() < 0x02020001) {
+            bufferevent* bev = evhttp_connection_get_bufferevent(conn);
+            if (bev) {
+                bufferevent_enable(bev, EV_READ | EV_WRITE);
+            }
+        }
+    });
+    ev->trigger(nullptr);
+    replySent = true;
+    req = nullptr; // transferred back to main thread
+}
+
 CService HTTPRequest::GetPeer() const
 {
     evhttp_connection* con = evhttp_request_get_connection(req);
@@ -5,12 +5,27 @@
 #ifndef BITCOIN_HTTPSERVER_H
 #define BITCOIN_HTTPSERVER_H
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <functional>
+#include <vector>
 
 static const int DEFAULT_HTTP_THREADS=4;
 static const int DEFAULT_HTTP_WORKQUEUE=16;
 static const int DEFAULT_HTTP_SERVER_TIMEOUT=30;
+//! Threads of the RPC work queue classes besides the default queue, a class without threads is served by the default queue
+static const int DEFAULT_HTTP_FAST_THREADS=1;
+static const int DEFAULT_HTTP_WALLET_THREADS=0;
+static const int DEFAULT_HTTP_HEAVY_THREADS=1;
+//! Upper bounds in microseconds of the queue wait histogram buckets, the last bucket takes longer waits
+static const std::array<int64_t, 6> HTTP_QUEUE_WAIT_BOUNDS{{100, 1000, 10000, 100000, 1000000, 10000000}};
+//! Open connections the HTTP server serves, 0 for no limit
+static const int DEFAULT_HTTP_MAX_CONNECTIONS=128;
+//! Whether connections are kept open for further requests
+static const bool DEFAULT_HTTP_KEEPALIVE=true;
+//! Upper bounds of the requests per connection histogram buckets, the last bucket takes more requests
+static const std::array<uint64_t, 5> HTTP_CONN_REQUEST_BOUNDS{{1, 2, 10, 100, 1000}};
 
 struct evhttp_request;
 struct event_base;
@@ -31,6 +46,37 @@ void InterruptHTTPServer();
 /** Stop HTTP server */
 void StopHTTPServer();
 
+/** State of an HTTP work queue class, for getrpcinfo */
+struct HTTPWorkQueueStats
+{
+    std::string name;
+    int threads{0};
+    size_t depth{0};     //!< Requests waiting
+    size_t max_depth{0};
+    uint64_t served{0};
+    uint64_t rejected{0};
+    int64_t wait_max{0}; //!< Longest wait for a worker in microseconds
+    std::array<uint64_t, HTTP_QUEUE_WAIT_BOUNDS.size() + 1> wait_histogram{};
+};
+/** Stats of the work queue classes, the default queue first */
+std::vector<HTTPWorkQueueStats> GetHTTPWorkQueueStats();
+
+/** Connections of the HTTP server, for getrpcinfo */
+struct HTTPConnectionStats
+{
+    size_t open{0};
+    uint64_t accepted{0}; //!< Connections that sent a request
+    uint64_t refused{0};  //!< Connections closed because -rpcmaxconnections were open
+    uint64_t requests{0};
+    uint64_t reused{0};   //!< Requests on a connection that served a request before
+    //! Closed connections by the requests they served
+    std::array<uint64_t, HTTP_CONN_REQUEST_BOUNDS.size() + 1> requests_histogram{};
+};
+HTTPConnectionStats GetHTTPConnectionStats();
+
+/** Run task on a worker of the default work queue, false when the queue is full or not running */
+bool EnqueueHTTPTask(std::function<void()> task);
+
 /** Change logging level for libevent. Removes BCLog::LIBEVENT from log categories if
  * libevent doesn't support debug logging.*/
 bool UpdateHTTPServerLogging(bool enable);
@@ -58,6 +104,7 @@ class HTTPRequest
 private:
     struct evhttp_request* req;
     bool replySent;
+    bool replyStarted{false};
 
 public:
     explicit HTTPRequest(struct evhttp_request* req, bool replySent = false);
@@ -114,6 +161,21 @@ public:
      * main thread, do not call any other HTTPRequest methods after calling this.
      */
     void WriteReply(int nStatus, const std::string& strReply = "");
+
+    /**
+     * Send the HTTP status and headers, the body follows in chunks written
+     * with WriteReplyChunk and is finished by WriteReplyEnd. Instead of
+     * WriteReply, for replies sent while they're produced.
+     */
+    void WriteReplyStart(int nStatus);
+    void WriteReplyChunk(const std::string& strChunk);
+    /**
+     * Finish a reply begun with WriteReplyStart.
+     *
+     * @note As this will give the request back to the main thread, do not
+     * call any other HTTPRequest methods after calling this.
+     */
+    void WriteReplyEnd();
 };
 
 /** Event handler closure.
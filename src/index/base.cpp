@@ -8,6 +8,7 @@
 #include <shutdown.h>
 #include <tinyformat.h>
 #include <util/system.h>
+#include <util/taskpool.h>
 #include <util/translation.h>
 #include <validation.h>
 #include <warnings.h>
@@ -16,6 +17,7 @@ constexpr char DB_BEST_BLOCK = 'B';
 
 constexpr int64_t SYNC_LOG_INTERVAL = 30; // seconds
 constexpr int64_t SYNC_LOCATOR_WRITE_INTERVAL = 30; // seconds
+constexpr size_t SYNC_BATCH_BLOCKS = 256;
 
 template <typename... Args>
 static void FatalError(const char* fmt, const Args&... args)
@@ -90,8 +92,11 @@ void BaseIndex::ThreadSync()
     if (!m_synced) {
         auto& consensus_params = Params().GetConsensus();
 
+        const bool parallel = AllowParallelSync() && g_task_pool.NumThreads() > 1;
+
         int64_t last_log_time = 0;
         int64_t last_locator_write_time = 0;
+        std::vector<const CBlockIndex*> run;
         while (true) {
             if (m_interrupt) {
                 m_best_block_index = pindex;
@@ -118,6 +123,16 @@ void BaseIndex::ThreadSync()
                     return;
                 }
                 pindex = pindex_next;
+
+                // Blocks following on the active chain are read ahead with it
+                run.assign(1, pindex);
+                while (parallel && run.size() < SYNC_BATCH_BLOCKS) {
+                    const CBlockIndex* pindex_ahead = ::ChainActive().Next(run.back());
+                    if (!pindex_ahead) {
+                        break;
+                    }
+                    run.push_back(pindex_ahead);
+                }
             }
 
             int64_t current_time = GetTime();
@@ -134,8 +149,34 @@ void BaseIndex::ThreadSync()
                 Commit();
             }
 
+            if (run.size() > 1) {
+                std::vector<CBlock> blocks(run.size());
+                std::vector<char> read_ok(run.size(), 0);
+                const int read_flags = GetBlockReadFlags();
+                g_task_pool.ParallelFor(TaskPriority::LOW, run.size(), [&](size_t i) {
+                    read_ok[i] = ReadBlockFromDisk(blocks[i], run[i], consensus_params, read_flags);
+                });
+                for (size_t i = 0; i < run.size(); ++i) {
+                    if (!read_ok[i]) {
+                        FatalError("%s: Failed to read block %s from disk",
+                                   __func__, run[i]->GetBlockHash().ToString());
+                        return;
+                    }
+                }
+                if (!WriteBlocks(blocks, run)) {
+                    FatalError("%s: Failed to write blocks %s to %s to index database",
+                               __func__, run.front()->GetBlockHash().ToString(), run.back()->GetBlockHash().ToString());
+                    return;
+                }
+                // Each run is a checkpoint the sync resumes from after a restart
+                pindex = run.back();
+                m_best_block_index = pindex;
+                Commit();
+                continue;
+            }
+
             CBlock block;
-            if (!ReadBlockFromDisk(block, pindex, consensus_params)) {
+            if (!ReadBlockFromDisk(block, pindex, consensus_params, GetBlockReadFlags())) {
                 FatalError("%s: Failed to read block %s from disk",
                            __func__, pindex->GetBlockHash().ToString());
                 return;
@@ -155,6 +196,16 @@ void BaseIndex::ThreadSync()
     }
 }
 
+bool BaseIndex::WriteBlocks(const std::vector<CBlock>& blocks, const std::vector<const CBlockIndex*>& indexes)
+{
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        if (!WriteBlock(blocks[i], indexes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool BaseIndex::Commit()
 {
     CDBBatch batch(GetDB());
@@ -313,7 +364,7 @@ void BaseIndex::Start()
 {
     // Need to register this ValidationInterface before running Init(), so that
     // callbacks are not missed if Init sets m_synced to true.
-    RegisterValidationInterface(this);
+    RegisterValidationInterface(this, GetName());
     if (!Init()) {
         FatalError("%s: %s failed to initialize", __func__, GetName());
         return;
@@ -338,5 +389,12 @@ IndexSummary BaseIndex::GetSummary() const
     summary.name = GetName();
     summary.synced = m_synced;
     summary.best_block_height = m_best_block_index.load()->nHeight;
+    if (summary.synced) {
+        summary.progress = 1.0;
+    } else {
+        LOCK(cs_main);
+        const int chain_height = ::ChainActive().Height();
+        summary.progress = chain_height > 0 ? std::min(1.0, (double)summary.best_block_height / chain_height) : 0.0;
+    }
     return summary;
 }
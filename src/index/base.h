@@ -17,6 +17,7 @@ struct IndexSummary {
     std::string name;
     bool synced{false};
     int best_block_height{0};
+    double progress{0.0}; //!< Fraction of the active chain indexed
 };
 
 /**
@@ -89,6 +90,17 @@ protected:
     /// Write update index entries for a newly connected block.
     virtual bool WriteBlock(const CBlock& block, const CBlockIndex* pindex) { return true; }
 
+    /// Flags for reading the blocks WriteBlock is called with during sync, such as
+    /// SERIALIZE_TRANSACTION_NO_RANGEPROOF when the index never reads the rangeproofs.
+    virtual int GetBlockReadFlags() const { return 0; }
+
+    /// Whether the sync thread may read runs of blocks ahead on the task pool and pass them to
+    /// WriteBlocks, committing the best block after each run.
+    virtual bool AllowParallelSync() const { return false; }
+
+    /// Write update index entries for a run of consecutive blocks read during a parallel sync.
+    virtual bool WriteBlocks(const std::vector<CBlock>& blocks, const std::vector<const CBlockIndex*>& indexes);
+
     /// Virtual method called internally by Commit that can be overridden to atomically
     /// commit more index state.
     virtual bool CommitInternal(CDBBatch& batch);
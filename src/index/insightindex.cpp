@@ -0,0 +1,228 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <index/insightindex.h>
+
+#include <chainparams.h>
+#include <insight/addressindex.h>
+#include <insight/insight.h>
+#include <insight/spentindex.h>
+#include <insight/timestampindex.h>
+#include <txdb.h>
+#include <undo.h>
+#include <util/system.h>
+#include <validation.h>
+
+#include <algorithm>
+
+std::unique_ptr<InsightIndex> g_insight_index;
+
+InsightIndex::InsightIndex(size_t n_cache_size, bool f_memory, bool f_wipe)
+{
+    m_db = MakeUnique<BaseIndex::DB>(GetDataDir() / "indexes" / "insight", n_cache_size, f_memory, f_wipe);
+}
+
+/** The address, unspent and spent entries of a block, in the order ConnectBlock records them */
+struct InsightBlockEntries
+{
+    std::vector<std::pair<CAddressIndexKey, CAmount>> address_index;
+    std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue>> address_unspent_index;
+    std::vector<std::pair<CSpentIndexKey, CSpentIndexValue>> spent_index;
+};
+
+/** Collect the entries of a block, with the unspent and spent entries reverted if fUndo is set */
+static bool GetBlockEntries(const CBlock& block, const CBlockIndex* pindex, bool fUndo, InsightBlockEntries& entries)
+{
+    CBlockUndo block_undo;
+    if (pindex->nHeight > 0 && !UndoReadFromDisk(block_undo, pindex)) {
+        return error("%s: Failed to read undo data for block %s", __func__, pindex->GetBlockHash().ToString());
+    }
+
+    size_t n_tx_undo = 0;
+    for (size_t i = 0; i < block.vtx.size(); i++) {
+        const CTransaction &tx = *block.vtx[i];
+        const uint256 &txhash = tx.GetHash();
+
+        if (!tx.IsCoinBase()) {
+            if (n_tx_undo >= block_undo.vtxundo.size()) {
+                return error("%s: Block %s and undo data inconsistent", __func__, pindex->GetBlockHash().ToString());
+            }
+            const CTxUndo &txundo = block_undo.vtxundo[n_tx_undo++];
+
+            size_t n_prevout = 0;
+            for (size_t j = 0; j < tx.vin.size(); j++) {
+                const CTxIn &input = tx.vin[j];
+                if (input.IsAnonInput()) {
+                    continue;
+                }
+                if (n_prevout >= txundo.vprevout.size()) {
+                    return error("%s: Transaction %s and undo data inconsistent", __func__, txhash.ToString());
+                }
+                const Coin &coin = txundo.vprevout[n_prevout++];
+                if (!tx.IsParticlVersion()) {
+                    continue;
+                }
+
+                const CScript *pScript = &coin.out.scriptPubKey;
+                std::vector<uint8_t> hashBytes;
+                int scriptType = 0;
+                if (!ExtractIndexInfo(pScript, scriptType, hashBytes)) {
+                    continue;
+                }
+
+                uint256 hashAddress;
+                if (scriptType > 0) {
+                    hashAddress = uint256(hashBytes.data(), hashBytes.size());
+                }
+                if (fAddressIndex && scriptType > 0) {
+                    CAmount nValue = coin.nType == OUTPUT_CT ? 0 : coin.out.nValue;
+                    // spending activity, with the unspent index entry of the prevout removed or restored
+                    entries.address_index.push_back(std::make_pair(CAddressIndexKey(scriptType, hashAddress, pindex->nHeight, i, txhash, j, true), nValue * -1));
+                    entries.address_unspent_index.push_back(std::make_pair(CAddressUnspentKey(scriptType, hashAddress, input.prevout.hash, input.prevout.n),
+                        fUndo ? CAddressUnspentValue(nValue, *pScript, coin.nHeight) : CAddressUnspentValue()));
+                }
+                if (fSpentIndex) {
+                    CAmount nValue = coin.nType == OUTPUT_CT ? -1 : coin.out.nValue;
+                    entries.spent_index.push_back(std::make_pair(CSpentIndexKey(input.prevout.hash, input.prevout.n),
+                        fUndo ? CSpentIndexValue() : CSpentIndexValue(txhash, j, pindex->nHeight, nValue, scriptType, hashAddress)));
+                }
+            }
+        }
+
+        if (!fAddressIndex) {
+            continue;
+        }
+        for (unsigned int k = 0; k < tx.vpout.size(); k++) {
+            const CTxOutBase *out = tx.vpout[k].get();
+
+            if (!out->IsType(OUTPUT_STANDARD)
+                && !out->IsType(OUTPUT_CT)) {
+                continue;
+            }
+
+            const CScript *pScript;
+            std::vector<unsigned char> hashBytes;
+            int scriptType = 0;
+            CAmount nValue;
+            if (!ExtractIndexInfo(out, scriptType, hashBytes, nValue, pScript)
+                || scriptType == 0) {
+                continue;
+            }
+
+            // receiving activity and the unspent output
+            entries.address_index.push_back(std::make_pair(CAddressIndexKey(scriptType, uint256(hashBytes.data(), hashBytes.size()), pindex->nHeight, i, txhash, k, false), nValue));
+            entries.address_unspent_index.push_back(std::make_pair(CAddressUnspentKey(scriptType, uint256(hashBytes.data(), hashBytes.size()), txhash, k),
+                fUndo ? CAddressUnspentValue() : CAddressUnspentValue(nValue, *pScript, pindex->nHeight)));
+        }
+    }
+
+    if (fUndo) {
+        // Outputs spent within the block must end up erased, not restored
+        std::reverse(entries.address_unspent_index.begin(), entries.address_unspent_index.end());
+    }
+    return true;
+}
+
+bool InsightIndex::Init()
+{
+    CBlockLocator locator;
+    if (!GetDB().ReadBestBlock(locator)) {
+        locator.SetNull();
+    }
+
+    if (!locator.IsNull()) {
+        std::vector<const CBlockIndex*> stale_blocks;
+        {
+            LOCK(cs_main);
+            const CBlockIndex* pindex = LookupBlockIndex(locator.vHave[0]);
+            for (; pindex && !::ChainActive().Contains(pindex); pindex = pindex->pprev) {
+                stale_blocks.push_back(pindex);
+            }
+        }
+        for (const CBlockIndex* pindex : stale_blocks) {
+            CBlock block;
+            if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
+                return error("%s: Failed to read block %s from disk", __func__, pindex->GetBlockHash().ToString());
+            }
+            if (!UndoBlock(block, pindex)) {
+                return false;
+            }
+        }
+    }
+
+    return BaseIndex::Init();
+}
+
+bool InsightIndex::WriteBlock(const CBlock& block, const CBlockIndex* pindex)
+{
+    InsightBlockEntries entries;
+    if (!GetBlockEntries(block, pindex, false, entries)) {
+        return false;
+    }
+
+    if (fAddressIndex) {
+        if (!pblocktree->WriteAddressIndex(entries.address_index)) {
+            return error("%s: Failed to write address index", __func__);
+        }
+        if (!pblocktree->UpdateAddressUnspentIndex(entries.address_unspent_index)) {
+            return error("%s: Failed to write address unspent index", __func__);
+        }
+    }
+    if (fSpentIndex) {
+        if (!pblocktree->UpdateSpentIndex(entries.spent_index)) {
+            return error("%s: Failed to write spent index", __func__);
+        }
+    }
+    if (fTimestampIndex) {
+        unsigned int logicalTS = pindex->nTime;
+        if (!pblocktree->WriteTimestampIndex(CTimestampIndexKey(logicalTS, pindex->GetBlockHash()))) {
+            return error("%s: Failed to write timestamp index", __func__);
+        }
+        if (!pblocktree->WriteTimestampBlockIndex(CTimestampBlockIndexKey(pindex->GetBlockHash()), CTimestampBlockIndexValue(logicalTS))) {
+            return error("%s: Failed to write blockhash index", __func__);
+        }
+    }
+    return true;
+}
+
+bool InsightIndex::UndoBlock(const CBlock& block, const CBlockIndex* pindex)
+{
+    InsightBlockEntries entries;
+    if (!GetBlockEntries(block, pindex, true, entries)) {
+        return false;
+    }
+
+    if (fAddressIndex) {
+        if (!pblocktree->EraseAddressIndex(entries.address_index)) {
+            return error("%s: Failed to delete address index", __func__);
+        }
+        if (!pblocktree->UpdateAddressUnspentIndex(entries.address_unspent_index)) {
+            return error("%s: Failed to write address unspent index", __func__);
+        }
+    }
+    if (fSpentIndex) {
+        if (!pblocktree->UpdateSpentIndex(entries.spent_index)) {
+            return error("%s: Failed to write spent index", __func__);
+        }
+    }
+    // The timestamp entries stay, as when the index is built inline
+    return true;
+}
+
+bool InsightIndex::Rewind(const CBlockIndex* current_tip, const CBlockIndex* new_tip)
+{
+    assert(current_tip->GetAncestor(new_tip->nHeight) == new_tip);
+
+    for (const CBlockIndex* pindex = current_tip; pindex != new_tip; pindex = pindex->pprev) {
+        CBlock block;
+        if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
+            return error("%s: Failed to read block %s from disk", __func__, pindex->GetBlockHash().ToString());
+        }
+        if (!UndoBlock(block, pindex)) {
+            return false;
+        }
+    }
+
+    return BaseIndex::Rewind(current_tip, new_tip);
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_INDEX_INSIGHTINDEX_H
+#define BITCOIN_INDEX_INSIGHTINDEX_H
+
+#include <chain.h>
+#include <index/base.h>
+
+/**
+ * InsightIndex builds the address, spent and timestamp indexes from the stored blocks and
+ * undo data in the background, instead of while connecting blocks, with -insightindexasync.
+ * The entries are written to the block tree database under the same keys as when built during
+ * validation, so the insight RPCs read them unchanged. The index database only keeps the best
+ * block locator.
+ */
+class InsightIndex final : public BaseIndex
+{
+private:
+    std::unique_ptr<BaseIndex::DB> m_db;
+
+    /// Remove the entries of a block, as DisconnectBlock does when the indexes are built inline.
+    bool UndoBlock(const CBlock& block, const CBlockIndex* pindex);
+
+protected:
+    /// Undo the blocks the index is ahead of the active chain with, the locator only moves back
+    /// to the fork after a reorg when the next block gets connected.
+    bool Init() override;
+
+    bool WriteBlock(const CBlock& block, const CBlockIndex* pindex) override;
+
+    int GetBlockReadFlags() const override { return SERIALIZE_TRANSACTION_NO_RANGEPROOF; }
+
+    bool Rewind(const CBlockIndex* current_tip, const CBlockIndex* new_tip) override;
+
+    BaseIndex::DB& GetDB() const override { return *m_db; }
+
+    const char* GetName() const override { return "insightindex"; }
+
+public:
+    /// Constructs the index, which becomes available to be queried.
+    explicit InsightIndex(size_t n_cache_size, bool f_memory = false, bool f_wipe = false);
+};
+
+/// The global insight index, used by the address, spent and timestamp RPCs when built in the background.
+extern std::unique_ptr<InsightIndex> g_insight_index;
+
+#endif // BITCOIN_INDEX_INSIGHTINDEX_H
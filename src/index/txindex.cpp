@@ -7,6 +7,7 @@
 #include <node/ui_interface.h>
 #include <shutdown.h>
 #include <util/system.h>
+#include <util/taskpool.h>
 #include <util/translation.h>
 #include <validation.h>
 
@@ -242,21 +243,52 @@ bool TxIndex::Init()
     return true;
 }
 
-bool TxIndex::WriteBlock(const CBlock& block, const CBlockIndex* pindex)
+static void GetTxPositions(const CBlock& block, const CBlockIndex* pindex, std::vector<std::pair<uint256, CDiskTxPos>>& vPos)
 {
-    if (m_cs_index) {
-        IndexCSOutputs(block, pindex);
-    }
     // Exclude genesis block transaction because outputs are not spendable.
-    if (!block.IsParticlVersion() && pindex->nHeight == 0) return true;
+    if (!block.IsParticlVersion() && pindex->nHeight == 0) return;
 
     CDiskTxPos pos(pindex->GetBlockPos(), GetSizeOfCompactSize(block.vtx.size()));
-    std::vector<std::pair<uint256, CDiskTxPos>> vPos;
-    vPos.reserve(block.vtx.size());
+    vPos.reserve(vPos.size() + block.vtx.size());
     for (const auto& tx : block.vtx) {
         vPos.emplace_back(tx->GetHash(), pos);
         pos.nTxOffset += ::GetSerializeSize(*tx, CLIENT_VERSION);
     }
+}
+
+bool TxIndex::WriteBlock(const CBlock& block, const CBlockIndex* pindex)
+{
+    if (m_cs_index) {
+        IndexCSOutputs(block, pindex);
+    }
+
+    std::vector<std::pair<uint256, CDiskTxPos>> vPos;
+    GetTxPositions(block, pindex, vPos);
+    return vPos.empty() || m_db->WriteTxs(vPos);
+}
+
+bool TxIndex::WriteBlocks(const std::vector<CBlock>& blocks, const std::vector<const CBlockIndex*>& indexes)
+{
+    // The coldstake entries depend on the outputs of earlier blocks
+    if (m_cs_index) {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            IndexCSOutputs(blocks[i], indexes[i]);
+        }
+    }
+
+    std::vector<std::vector<std::pair<uint256, CDiskTxPos>>> block_pos(blocks.size());
+    g_task_pool.ParallelFor(TaskPriority::LOW, blocks.size(), [&](size_t i) {
+        GetTxPositions(blocks[i], indexes[i], block_pos[i]);
+    });
+
+    // Written as one batch in key order
+    std::vector<std::pair<uint256, CDiskTxPos>> vPos;
+    for (auto& v : block_pos) {
+        vPos.insert(vPos.end(), v.begin(), v.end());
+    }
+    std::sort(vPos.begin(), vPos.end(), [](const std::pair<uint256, CDiskTxPos>& a, const std::pair<uint256, CDiskTxPos>& b) {
+        return a.first < b.first;
+    });
     return m_db->WriteTxs(vPos);
 }
 
@@ -282,6 +314,11 @@ bool TxIndex::DisconnectBlock(const CBlock& block)
 
             ColdStakeIndexOutputKey ok(tx->GetHash(), n);
             batch.Erase(std::make_pair(DB_TXINDEX_CSOUTPUT, ok));
+            ColdStakeIndexLinkKey lk;
+            if (m_db->Read(std::make_pair(DB_TXINDEX_CSUNSPENT_LINK, ok), lk)) {
+                batch.Erase(std::make_pair(DB_TXINDEX_CSUNSPENT, ColdStakeIndexUnspentKey(lk, ok)));
+                batch.Erase(std::make_pair(DB_TXINDEX_CSUNSPENT_LINK, ok));
+            }
             erasedCSOuts.insert(COutPoint(ok.m_txnid, ok.m_n));
         }
         for (const auto &in : tx->vin) {
@@ -295,6 +332,10 @@ bool TxIndex::DisconnectBlock(const CBlock& block)
                 ov.m_spend_height = -1;
                 ov.m_spend_txid.SetNull();
                 batch.Write(std::make_pair(DB_TXINDEX_CSOUTPUT, ok), ov);
+                ColdStakeIndexLinkKey lk;
+                if (m_db->Read(std::make_pair(DB_TXINDEX_CSUNSPENT_LINK, ok), lk)) {
+                    batch.Write(std::make_pair(DB_TXINDEX_CSUNSPENT, ColdStakeIndexUnspentKey(lk, ok)), ColdStakeIndexUnspentValue(ov));
+                }
             }
         }
     }
@@ -311,6 +352,7 @@ bool TxIndex::IndexCSOutputs(const CBlock& block, const CBlockIndex* pindex)
     CDBBatch batch(*m_db);
     std::map<ColdStakeIndexOutputKey, ColdStakeIndexOutputValue> newCSOuts;
     std::map<ColdStakeIndexLinkKey, std::vector<ColdStakeIndexOutputKey> > newCSLinks;
+    std::map<ColdStakeIndexOutputKey, ColdStakeIndexLinkKey> newCSOutLinks;
 
     for (const auto &tx : block.vtx) {
         int n = -1;
@@ -375,6 +417,7 @@ bool TxIndex::IndexCSOutputs(const CBlock& block, const CBlockIndex* pindex)
 
             newCSOuts[ok] = ov;
             newCSLinks[lk].push_back(ok);
+            newCSOutLinks[ok] = lk;
         }
 
         for (const auto &in : tx->vin) {
@@ -393,16 +436,29 @@ bool TxIndex::IndexCSOutputs(const CBlock& block, const CBlockIndex* pindex)
                 ov.m_spend_height = pindex->nHeight;
                 ov.m_spend_txid = tx->GetHash();
                 batch.Write(std::make_pair(DB_TXINDEX_CSOUTPUT, ok), ov);
+                ColdStakeIndexLinkKey lk;
+                if (m_db->Read(std::make_pair(DB_TXINDEX_CSUNSPENT_LINK, ok), lk)) {
+                    batch.Erase(std::make_pair(DB_TXINDEX_CSUNSPENT, ColdStakeIndexUnspentKey(lk, ok)));
+                }
             }
         }
     }
 
     for (const auto &it : newCSOuts) {
         batch.Write(std::make_pair(DB_TXINDEX_CSOUTPUT, it.first), it.second);
+        const ColdStakeIndexLinkKey &lk = newCSOutLinks[it.first];
+        batch.Write(std::make_pair(DB_TXINDEX_CSUNSPENT_LINK, it.first), lk);
+        if (it.second.m_spend_height == -1) {
+            batch.Write(std::make_pair(DB_TXINDEX_CSUNSPENT, ColdStakeIndexUnspentKey(lk, it.first)), ColdStakeIndexUnspentValue(it.second));
+        }
     }
     for (const auto &it : newCSLinks) {
         batch.Write(std::make_pair(DB_TXINDEX_CSLINK, it.first), it.second);
     }
+    // The unspent outputs are complete only in indexes built from genesis by this version
+    if (pindex->nHeight == 0) {
+        batch.Write(DB_TXINDEX_CSUNSPENT_FLAG, true);
+    }
 
     batch.Write(DB_TXINDEX_CSBESTBLOCK, ::ChainActive().GetLocator(pindex));
 
@@ -29,6 +29,10 @@ protected:
     bool Init() override;
 
     bool WriteBlock(const CBlock& block, const CBlockIndex* pindex) override;
+
+    /// Blocks are read ahead in parallel while building, the positions of a run are written in one sorted batch.
+    bool AllowParallelSync() const override { return true; }
+    bool WriteBlocks(const std::vector<CBlock>& blocks, const std::vector<const CBlockIndex*>& indexes) override;
     bool DisconnectBlock(const CBlock& block) override;
 
     //BaseIndex::DB& GetDB() const override;
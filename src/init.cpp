@@ -17,11 +17,15 @@
 #include <chainparams.h>
 #include <compat/sanity.h>
 #include <consensus/validation.h>
+#include <crypto/aes.h>
+#include <crypto/ripemd160.h>
+#include <crypto/sha512.h>
 #include <fs.h>
 #include <hash.h>
 #include <httprpc.h>
 #include <httpserver.h>
 #include <index/blockfilterindex.h>
+#include <index/insightindex.h>
 #include <index/txindex.h>
 #include <interfaces/chain.h>
 #include <interfaces/node.h>
@@ -31,12 +35,18 @@
 #include <net_permissions.h>
 #include <net_processing.h>
 #include <netbase.h>
+#include <node/blockcache.h>
+#include <node/blockprefetch.h>
+#include <node/coinswriteback.h>
 #include <node/context.h>
+#include <node/initstages.h>
+#include <node/stealthscan.h>
 #include <node/ui_interface.h>
 #include <policy/feerate.h>
 #include <policy/fees.h>
 #include <policy/policy.h>
 #include <policy/settings.h>
+#include <proofcache.h>
 #include <protocol.h>
 #include <rpc/blockchain.h>
 #include <rpc/register.h>
@@ -56,6 +66,7 @@
 #include <util/moneystr.h>
 #include <util/string.h>
 #include <util/system.h>
+#include <util/taskpool.h>
 #include <util/threadnames.h>
 #include <util/translation.h>
 #include <validation.h>
@@ -105,7 +116,11 @@
 static bool fFeeEstimatesInitialized = false;
 static const bool DEFAULT_PROXYRANDOMIZE = true;
 static const bool DEFAULT_REST_ENABLE = false;
+static const bool DEFAULT_METRICS_ENABLE = false;
 static const bool DEFAULT_STOPAFTERBLOCKIMPORT = false;
+static const bool DEFAULT_LOCKPROFILE = false;
+//! -lockprofileinterval default (seconds)
+static const int64_t DEFAULT_LOCKPROFILE_INTERVAL = 600;
 
 #ifdef WIN32
 // Win32 LevelDB doesn't use filedescriptors, and the ones used for
@@ -256,6 +271,7 @@ void Interrupt(NodeContext& node)
     InterruptHTTPRPC();
     InterruptRPC();
     InterruptREST();
+    InterruptHTTPMetrics();
     InterruptTorControl();
     InterruptMapPort();
     if (node.connman)
@@ -263,7 +279,11 @@ void Interrupt(NodeContext& node)
     if (g_txindex) {
         g_txindex->Interrupt();
     }
+    if (g_insight_index) {
+        g_insight_index->Interrupt();
+    }
     ForEachBlockFilterIndex([](BlockFilterIndex& index) { index.Interrupt(); });
+    g_stealth_scan_server.Interrupt();
 }
 
 void Shutdown(NodeContext& node)
@@ -283,8 +303,10 @@ void Shutdown(NodeContext& node)
 
     StopHTTPRPC();
     StopREST();
+    StopHTTPMetrics();
     StopRPC();
     StopHTTPServer();
+    g_stealth_scan_server.Stop();
     smsgModule.Shutdown();
 #ifdef ENABLE_WALLET
     StopThreadStakeMiner();
@@ -320,6 +342,9 @@ void Shutdown(NodeContext& node)
     if (g_load_block.joinable()) g_load_block.join();
     threadGroup.interrupt_all();
     threadGroup.join_all();
+    g_block_prefetcher.Stop();
+    g_coins_writeback.Stop();
+    g_task_pool.Stop();
 
     // After the threads that potentially access these pointers have been stopped,
     // destruct and reset all to nullptr.
@@ -362,6 +387,10 @@ void Shutdown(NodeContext& node)
         g_txindex->Stop();
         g_txindex.reset();
     }
+    if (g_insight_index) {
+        g_insight_index->Stop();
+        g_insight_index.reset();
+    }
     ForEachBlockFilterIndex([](BlockFilterIndex& index) { index.Stop(); });
     DestroyAllBlockFilterIndexes();
 
@@ -422,6 +451,7 @@ void Shutdown(NodeContext& node)
 
     node.args = nullptr;
     LogPrintf("%s: done\n", __func__);
+    LogInstance().StopAsync();
 }
 
 /**
@@ -507,7 +537,9 @@ void SetupServerArgs(NodeContext& node)
     argsman.AddArg("-blocknotify=<cmd>", "Execute command when the best block changes (%s in cmd is replaced by block hash)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 #endif
     argsman.AddArg("-blockreconstructionextratxn=<n>", strprintf("Extra transactions to keep in memory for compact block reconstructions (default: %u)", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-blockreconstructionextraprivatetxn=<n>", strprintf("Extra CT and RingCT transactions to keep in memory for compact block reconstructions, on top of -blockreconstructionextratxn (default: %u)", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_PRIVATE_TXN), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-blocksonly", strprintf("Whether to reject transactions from network peers. Automatic broadcast and rebroadcast of any transactions from inbound peers is disabled, unless the peer has the 'forcerelay' permission. RPC transactions are not affected. (default: %u)", DEFAULT_BLOCKSONLY), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-coinswriteback=<n>", strprintf("Write the oldest changed coins to disk in the background once the coins cache is <n> percent full, 0 to disable (default: %d)", DEFAULT_COINS_WRITEBACK), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-conf=<file>", strprintf("Specify path to read-only configuration file. Relative paths will be prefixed by datadir location. (default: %s)", BITCOIN_CONF_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-datadir=<dir>", "Specify data directory", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-dbbatchsize", strprintf("Maximum database write batch size in bytes (default: %u)", nDefaultDbBatchSize), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
@@ -520,15 +552,23 @@ void SetupServerArgs(NodeContext& node)
     argsman.AddArg("-maxorphantx=<n>", strprintf("Keep at most <n> unconnectable transactions in memory (default: %u)", DEFAULT_MAX_ORPHAN_TRANSACTIONS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-mempoolexpiry=<n>", strprintf("Do not keep transactions in the mempool longer than <n> hours (default: %u)", DEFAULT_MEMPOOL_EXPIRY), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-minimumchainwork=<hex>", strprintf("Minimum work assumed to exist on a valid chain in hex (default: %s, testnet: %s)", defaultChainParams->GetConsensus().nMinimumChainWork.GetHex(), testnetChainParams->GetConsensus().nMinimumChainWork.GetHex() /*,signetChainParams->GetConsensus().nMinimumChainWork.GetHex()*/), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-blockcachemem=<n>", strprintf("Keep up to <n> MiB of recently read blocks decoded for readers asking for the same blocks, 0 to disable (default: %d)", DEFAULT_BLOCK_CACHE_MEM), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-blockprefetch=<n>", strprintf("Read up to <n> blocks ahead of sequential block readers like rescans and index syncs, 0 to disable (default: %d)", DEFAULT_BLOCK_PREFETCH), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-blockprefetchmem=<n>", strprintf("Keep at most <n> MiB of blocks read ahead (default: %d)", DEFAULT_BLOCK_PREFETCH_MEM), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-blockprefetchthreads=<n>", strprintf("Set the number of block prefetch threads (1 to %d, default: %d)", MAX_BLOCK_PREFETCH_THREADS, DEFAULT_BLOCK_PREFETCH_THREADS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-mmapblocks", strprintf("Read blocks through read-only memory mappings of the block files (default: %u)", DEFAULT_MMAP_BLOCKS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-par=<n>", strprintf("Set the number of script verification threads (%u to %d, 0 = auto, <0 = leave that many cores free, default: %d)",
         -GetNumCores(), MAX_SCRIPTCHECK_THREADS, DEFAULT_SCRIPTCHECK_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-persistmempool", strprintf("Whether to save the mempool on shutdown and load on restart (default: %u)", DEFAULT_PERSIST_MEMPOOL), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-persistmempoolproofs", strprintf("Whether to save which mempool transactions passed validation with the mempool and skip their rangeproof and ring signature checks when loaded at the same chain tip (default: %u)", DEFAULT_PERSIST_MEMPOOL_PROOFS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-pid=<file>", strprintf("Specify pid file. Relative paths will be prefixed by a net-specific datadir location. (default: %s)", BITCOIN_PID_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
-    argsman.AddArg("-prune=<n>", strprintf("Reduce storage requirements by enabling pruning (deleting) of old blocks. This allows the pruneblockchain RPC to be called to delete specific blocks, and enables automatic pruning of old blocks if a target size in MiB is provided. This mode is incompatible with -txindex and -rescan. "
+    argsman.AddArg("-prune=<n>", strprintf("Reduce storage requirements by enabling pruning (deleting) of old blocks. This allows the pruneblockchain RPC to be called to delete specific blocks, and enables automatic pruning of old blocks if a target size in MiB is provided. This mode is incompatible with -txindex, -rescan and the address, spent, timestamp and coldstaking indexes. "
+            "Staking and anon decoy selection keep working, their data is kept in the block index database. Use -voteindex to tally votes over pruned blocks. "
             "Warning: Reverting this setting requires re-downloading the entire blockchain. "
             "(default: 0 = disable pruning blocks, 1 = allow manual pruning via RPC, >=%u = automatically prune block files to stay under the specified target size in MiB)", MIN_DISK_SPACE_FOR_BLOCK_FILES / 1024 / 1024), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-reindex", "Rebuild chain state and block index from the blk*.dat files on disk", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-reindex-chainstate", "Rebuild chain state from the currently indexed blocks. When in pruning mode or if blocks on disk might be corrupted, use full -reindex instead.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-reindexthreads=<n>", strprintf("Set the number of threads checking blocks ahead of -reindex and -loadblock imports (0 to %d, default: %d)", MAX_REINDEX_CHECK_THREADS, DEFAULT_REINDEX_CHECK_THREADS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::OPTIONS);
     argsman.AddArg("-settings=<file>", strprintf("Specify path to dynamic settings data file. Can be disabled with -nosettings. File is written at runtime and not meant to be edited by users (use %s instead for custom settings). Relative paths will be prefixed by datadir location. (default: %s)", BITCOIN_CONF_FILENAME, BITCOIN_SETTINGS_FILENAME), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-skiprangeproofverify", "Skip verifying rangeproofs when reindexing or importing.", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 #if HAVE_SYSTEM
@@ -536,6 +576,7 @@ void SetupServerArgs(NodeContext& node)
 #endif
 #ifndef WIN32
     argsman.AddArg("-sysperms", "Create new files with system default permissions, instead of umask 077 (only effective with disabled wallet functionality)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-taskpoolthreads=<n>", strprintf("Set the number of threads shared by background tasks of smsg and other subsystems (up to %d, 0 = auto, <0 = leave that many cores free, default: %d)", MAX_TASKPOOL_THREADS, DEFAULT_TASKPOOL_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 #else
     hidden_args.emplace_back("-sysperms");
 #endif
@@ -551,9 +592,18 @@ void SetupServerArgs(NodeContext& node)
     argsman.AddArg("-timestampindex", strprintf("Maintain a timestamp index for block hashes, used to query blocks hashes by a range of timestamps (default: %u)", DEFAULT_TIMESTAMPINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-spentindex", strprintf("Maintain a full spent index, used to query the spending txid and input index for an outpoint (default: %u)", DEFAULT_SPENTINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-balancesindex", strprintf("Maintain a balances index per block (default: %u)", DEFAULT_BALANCESINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-voteindex", strprintf("Maintain an index of the vote cast by each coinstake, used by tallyvotes (default: %u)", DEFAULT_VOTEINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-rewardindex", strprintf("Maintain an index of the reward paid by each coinstake, used by getblockreward and getblockrewards (default: %u)", DEFAULT_REWARDINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-insightindexasync", strprintf("Build the address, spent and timestamp indexes in a background thread instead of while connecting blocks, the indexes can lag behind the chain tip (default: %u)", DEFAULT_INSIGHTINDEXASYNC), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-compactaddressindex", strprintf("Store the address index with short address ids and without repeating txids. Applies to new address indexes, an existing index is converted at startup when set explicitly (default: %u)", DEFAULT_COMPACTADDRESSINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-csindex", strprintf("Maintain an index of outputs by coldstaking address (default: %u)", DEFAULT_CSINDEX), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-cswhitelist", strprintf("Only index coldstaked outputs with matching stake address. Can be specified multiple times."), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 
+    argsman.AddArg("-insightdb", strprintf("Keep the address, spent, timestamp, balances and vote indexes in their own database with its own cache. Existing index data is moved at startup when the setting changes (default: %u)", DEFAULT_INSIGHTDB), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-insightdbdir=<dir>", "Location of the insight index database, implies -insightdb. Relative paths will be prefixed by the net-specific datadir location (default: <datadir>/indexes/insight)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-insightdbcache=<n>", "Cache of the insight index database in MiB (default: two thirds of the block index database share)", ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-rctindexcache=<n>", strprintf("Maximum size of the in-memory anon output cache in MiB, 0 to disable (default: %u)", DEFAULT_RCTINDEX_CACHE), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
+    argsman.AddArg("-utxoscanthreads=<n>", strprintf("Set the number of threads used to walk the UTXO set in gettxoutsetinfo, gettxoutsetinfobyscript and scantxoutset (up to %d, 0 = auto, <0 = leave that many cores free, default: %d)", MAX_UTXO_SCAN_THREADS, DEFAULT_UTXO_SCAN_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-dbmaxopenfiles", strprintf("Maximum number of open files parameter passed to level-db (default: %u)", DEFAULT_DB_MAX_OPEN_FILES), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
     argsman.AddArg("-dbcompression", strprintf("Database compression parameter passed to level-db (default: %s)", DEFAULT_DB_COMPRESSION ? "true" : "false"), ArgsManager::ALLOW_ANY, OptionsCategory::OPTIONS);
 
@@ -580,6 +630,7 @@ void SetupServerArgs(NodeContext& node)
     argsman.AddArg("-maxsendbuffer=<n>", strprintf("Maximum per-connection send buffer, <n>*1000 bytes (default: %u)", DEFAULT_MAXSENDBUFFER), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     argsman.AddArg("-maxtimeadjustment", strprintf("Maximum allowed median peer time offset adjustment. Local perspective of time may be influenced by peers forward or backward by this amount. (default: %u seconds)", DEFAULT_MAX_TIME_ADJUSTMENT), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     argsman.AddArg("-maxuploadtarget=<n>", strprintf("Tries to keep outbound traffic under the given target (in MiB per 24h). Limit does not apply to peers with 'download' permission. 0 = no limit (default: %d)", DEFAULT_MAX_UPLOAD_TARGET), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
+    argsman.AddArg("-msghandthreads=<n>", strprintf("Number of threads processing peer messages, peers are split between them (1 to %d, default: %d)", MAX_MSGHAND_THREADS, DEFAULT_MSGHAND_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     argsman.AddArg("-onion=<ip:port>", "Use separate SOCKS5 proxy to reach peers via Tor hidden services, set -noonion to disable (default: -proxy)", ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     argsman.AddArg("-onlynet=<net>", "Make outgoing connections only through network <net> (ipv4, ipv6 or onion). Incoming connections are not affected by this option. This option can be specified multiple times to allow multiple networks.", ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
     argsman.AddArg("-peerbloomfilters", strprintf("Support filtering of blocks and transaction with bloom filters (default: %u)", DEFAULT_PEERBLOOMFILTERS), ArgsManager::ALLOW_ANY, OptionsCategory::CONNECTION);
@@ -634,7 +685,13 @@ void SetupServerArgs(NodeContext& node)
 
     // Ghost
     argsman.AddArg("-zmqpubhashwtx=<address>", "Enable publish hash transaction received by wallets in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqqueuesize=<n>", strprintf("Number of messages queued for the ZMQ send thread, 0 sends on the notifying thread (default: %d)", CZMQAbstractNotifier::DEFAULT_ZMQ_QUEUE_SIZE), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqqueuepolicy=<policy>", strprintf("What to do with a ZMQ message when the send queue is full, block waits for space and drop drops it (default: %s)", DEFAULT_ZMQ_QUEUE_POLICY), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-zmqpubsmsg=<address>", "Enable publish secure message in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubrawwtx=<address>", "Enable publish raw transaction and wallet record of transactions received by wallets in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubrawsmsg=<address>", "Enable publish raw secure message in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqpubstealthmatch=<address>", "Enable publish outputs found by the stealth scan server in <address>", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
+    argsman.AddArg("-zmqrawsmsgdecrypt", strprintf("Append the decrypted text of messages to owned addresses to rawsmsg notifications (default: %u)", DEFAULT_ZMQ_RAWSMSG_DECRYPT), ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-serverkeyzmq=<secret_key>", "Base64 encoded string of the z85 encoded secret key for CurveZMQ.", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-newserverkeypairzmq", "Generate new key pair for CurveZMQ, print and exit.", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
     argsman.AddArg("-whitelistzmq=<IP address or network>", "Whitelist peers connecting from the given IP address (e.g. 1.2.3.4) or CIDR notated network (e.g. 1.2.3.0/24). Can be specified multiple times.", ArgsManager::ALLOW_ANY, OptionsCategory::ZMQ);
@@ -652,6 +709,12 @@ void SetupServerArgs(NodeContext& node)
 
     hidden_args.emplace_back("-zmqpubhashwtx=<address>");
     hidden_args.emplace_back("-zmqpubsmsg=<address>");
+    hidden_args.emplace_back("-zmqpubrawwtx=<address>");
+    hidden_args.emplace_back("-zmqpubrawsmsg=<address>");
+    hidden_args.emplace_back("-zmqpubstealthmatch=<address>");
+    hidden_args.emplace_back("-zmqrawsmsgdecrypt");
+    hidden_args.emplace_back("-zmqqueuesize=<n>");
+    hidden_args.emplace_back("-zmqqueuepolicy=<policy>");
     hidden_args.emplace_back("-serverkeyzmq=<secret_key>");
     hidden_args.emplace_back("-newserverkeypairzmq");
     hidden_args.emplace_back("-whitelistzmq=<IP address or network>");
@@ -675,6 +738,12 @@ void SetupServerArgs(NodeContext& node)
         "If <category> is not supplied or if <category> = 1, output all debugging information. <category> can be: " + LogInstance().LogCategoriesString() + ".",
         ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-debugexclude=<category>", strprintf("Exclude debugging information for a category. Can be used in conjunction with -debug=1 to output debug logs for all categories except one or more specified categories."), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-lockprofile", strprintf("Record the time spent waiting for and holding cs_main, cs_wallet, cs_smsg, cs_smsgDB and mempool.cs by lock site, see getlockstats (default: %u)", DEFAULT_LOCKPROFILE), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-lockprofileinterval=<n>", strprintf("Log the most contended lock sites every <n> seconds while lock profiling, 0 to disable (default: %u)", DEFAULT_LOCKPROFILE_INTERVAL), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logasync", strprintf("Write the log from a dedicated thread, logging threads only format and queue their messages (default: %u)", DEFAULT_LOGASYNC), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logasyncbuffer=<n>", strprintf("Number of messages queued for the log writer thread with -logasync, rounded up to a power of two (default: %u)", DEFAULT_LOGASYNC_BUFFER), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logasyncoverflow=<policy>", strprintf("What logging threads do when the -logasync queue is full: \"block\" to wait for space or \"drop\" to drop the message (default: %s)", DEFAULT_LOGASYNC_OVERFLOW), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-logasyncflushinterval=<n>", strprintf("Maximum time in milliseconds a message waits in the -logasync queue (default: %u)", DEFAULT_LOGASYNC_FLUSH_INTERVAL), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-logips", strprintf("Include IP addresses in debug output (default: %u)", DEFAULT_LOGIPS), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-logtimestamps", strprintf("Prepend debug output with timestamp (default: %u)", DEFAULT_LOGTIMESTAMPS), ArgsManager::ALLOW_ANY, OptionsCategory::DEBUG_TEST);
 #ifdef HAVE_THREAD_LOCAL
@@ -684,6 +753,7 @@ void SetupServerArgs(NodeContext& node)
 #endif
     argsman.AddArg("-logtimemicros", strprintf("Add microsecond precision to debug timestamps (default: %u)", DEFAULT_LOGTIMEMICROS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-mocktime=<n>", "Replace actual time with " + UNIX_EPOCH_TIME + " (default: 0)", ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
+    argsman.AddArg("-maxproofcachesize=<n>", strprintf("Limit size of the rangeproof and ring signature cache to <n> MiB (default: %u)", DEFAULT_MAX_PROOF_CACHE_SIZE), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-maxsigcachesize=<n>", strprintf("Limit sum of signature cache and script execution cache sizes to <n> MiB (default: %u)", DEFAULT_MAX_SIG_CACHE_SIZE), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-maxtipage=<n>", strprintf("Maximum tip age in seconds to consider node in initial block download (default: %u)", DEFAULT_MAX_TIP_AGE), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
     argsman.AddArg("-printpriority", strprintf("Log transaction fee per kB when mining blocks (default: %u)", DEFAULT_PRINTPRIORITY), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::DEBUG_TEST);
@@ -710,14 +780,22 @@ void SetupServerArgs(NodeContext& node)
     argsman.AddArg("-blockversion=<n>", "Override block version to test forking scenarios", ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::BLOCK_CREATION);
 
     argsman.AddArg("-rest", strprintf("Accept public REST requests (default: %u)", DEFAULT_REST_ENABLE), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-stealthscanserver", strprintf("Scan new blocks and mempool transactions for the stealth scan keys of light wallets, registered with registerscankey (default: %u)", DEFAULT_STEALTH_SCAN_SERVER), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-stealthscanmaxkeys=<n>", strprintf("Maximum number of scan keys the stealth scan server holds (default: %d)", DEFAULT_STEALTH_SCAN_MAX_KEYS), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-metrics", strprintf("Serve node, smsg and staking metrics in the Prometheus text format on the unauthenticated /metrics path of the RPC server (default: %u)", DEFAULT_METRICS_ENABLE), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcallowip=<ip>", "Allow JSON-RPC connections from specified source. Valid for <ip> are a single IP (e.g. 1.2.3.4), a network/netmask (e.g. 1.2.3.4/255.255.255.0) or a network/CIDR (e.g. 1.2.3.4/24). This option can be specified multiple times", ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcauth=<userpw>", "Username and HMAC-SHA-256 hashed password for JSON-RPC connections. The field <userpw> comes in the format: <USERNAME>:<SALT>$<HASH>. A canonical python script is included in share/rpcauth. The client then connects normally using the rpcuser=<USERNAME>/rpcpassword=<PASSWORD> pair of arguments. This option can be specified multiple times", ArgsManager::ALLOW_ANY | ArgsManager::SENSITIVE, OptionsCategory::RPC);
-    argsman.AddArg("-rpcbind=<addr>[:port]", "Bind to given address to listen for JSON-RPC connections. Do not expose the RPC server to untrusted networks such as the public internet! This option is ignored unless -rpcallowip is also passed. Port is optional and overrides -rpcport. Use [host]:port notation for IPv6. This option can be specified multiple times (default: 127.0.0.1 and ::1 i.e., localhost)", ArgsManager::ALLOW_ANY | ArgsManager::NETWORK_ONLY | ArgsManager::SENSITIVE, OptionsCategory::RPC);
+    argsman.AddArg("-rpcbind=<addr>[:port]", "Bind to given address to listen for JSON-RPC connections. Do not expose the RPC server to untrusted networks such as the public internet! This option is ignored unless -rpcallowip is also passed. Port is optional and overrides -rpcport. Use [host]:port notation for IPv6. Use unix:<path> to listen on a Unix domain socket, which doesn't need -rpcallowip. This option can be specified multiple times (default: 127.0.0.1 and ::1 i.e., localhost)", ArgsManager::ALLOW_ANY | ArgsManager::NETWORK_ONLY | ArgsManager::SENSITIVE, OptionsCategory::RPC);
+    argsman.AddArg("-rpcbatchconcurrency=<n>", strprintf("Run up to <n> entries of a JSON-RPC batch at the same time on the RPC threads, batches with wallet or smsg calls run in order (default: %d)", DEFAULT_RPC_BATCH_CONCURRENCY), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpccookiefile=<loc>", "Location of the auth cookie. Relative paths will be prefixed by a net-specific datadir location. (default: data dir)", ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-rpckeepalive", strprintf("Keep JSON-RPC connections open for further requests (default: %u)", DEFAULT_HTTP_KEEPALIVE), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
+    argsman.AddArg("-rpcmaxconnections=<n>", strprintf("Serve up to <n> open JSON-RPC connections, requests on further connections are refused, 0 for no limit (default: %d)", DEFAULT_HTTP_MAX_CONNECTIONS), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcpassword=<pw>", "Password for JSON-RPC connections", ArgsManager::ALLOW_ANY | ArgsManager::SENSITIVE, OptionsCategory::RPC);
     argsman.AddArg("-rpcport=<port>", strprintf("Listen for JSON-RPC connections on <port> (default: %u, testnet: %u, regtest: %u)", defaultBaseParams->RPCPort(), testnetBaseParams->RPCPort(), /*signetBaseParams->RPCPort(),*/ regtestBaseParams->RPCPort()), ArgsManager::ALLOW_ANY | ArgsManager::NETWORK_ONLY, OptionsCategory::RPC);
     argsman.AddArg("-rpcserialversion", strprintf("Sets the serialization of raw transaction or block hex returned in non-verbose mode, non-segwit(0) or segwit(1) (default: %d)", DEFAULT_RPC_SERIALIZE_VERSION), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcservertimeout=<n>", strprintf("Timeout during HTTP requests (default: %d)", DEFAULT_HTTP_SERVER_TIMEOUT), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::RPC);
+    argsman.AddArg("-rpcqueuemethod=<method>:<class>", "Serve RPC method from work queue class default, fast, wallet or heavy. Can be specified multiple times", ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::RPC);
+    argsman.AddArg("-rpcqueuethreads=<class>:<n>", strprintf("Set the number of threads of RPC work queue class fast, wallet or heavy, 0 serves its methods from the default queue (default: fast:%d, wallet:%d, heavy:%d)", DEFAULT_HTTP_FAST_THREADS, DEFAULT_HTTP_WALLET_THREADS, DEFAULT_HTTP_HEAVY_THREADS), ArgsManager::ALLOW_ANY | ArgsManager::DEBUG_ONLY, OptionsCategory::RPC);
     argsman.AddArg("-rpcthreads=<n>", strprintf("Set the number of threads to service RPC calls (default: %d)", DEFAULT_HTTP_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
     argsman.AddArg("-rpcuser=<user>", "Username for JSON-RPC connections", ArgsManager::ALLOW_ANY | ArgsManager::SENSITIVE, OptionsCategory::RPC);
     argsman.AddArg("-rpcwhitelist=<whitelist>", "Set a whitelist to filter incoming RPC calls for a specific user. The field <whitelist> comes in the format: <USERNAME>:<rpc 1>,<rpc 2>,...,<rpc n>. If multiple whitelists are set for a given user, they are set-intersected. See -rpcwhitelistdefault documentation for information on default whitelist behavior.", ArgsManager::ALLOW_ANY, OptionsCategory::RPC);
@@ -916,6 +994,7 @@ static void ThreadImport(ChainstateManager& chainman, std::vector<fs::path> vImp
         if (fReindexChainState || fReindex) {
             LogPrintf("%s Clearing tracked data \n", __func__);
             clearTrackedData();
+            StartRewardTrackerRebuild();
         }
 
         if (!chainstate->ActivateBestChain(state, chainparams, nullptr)) {
@@ -924,6 +1003,7 @@ static void ThreadImport(ChainstateManager& chainman, std::vector<fs::path> vImp
             //return;
         }
     }
+    FinishRewardTrackerRebuild();
 
     if (args.GetBoolArg("-stopafterblockimport", DEFAULT_STOPAFTERBLOCKIMPORT)) {
         LogPrintf("Stopping after block import\n");
@@ -967,6 +1047,7 @@ static bool AppInitServers(const util::Ref& context, NodeContext& node)
     if (!StartHTTPRPC(context))
         return false;
     if (args.GetBoolArg("-rest", DEFAULT_REST_ENABLE)) StartREST(context);
+    if (args.GetBoolArg("-metrics", DEFAULT_METRICS_ENABLE)) StartHTTPMetrics(context);
     StartHTTPServer();
     return true;
 }
@@ -1218,6 +1299,10 @@ bool AppInitParameterInteraction(const ArgsManager& args)
         CHECK_ARG_FOR_PRUNE_MODE("-spentindex", DEFAULT_SPENTINDEX)
         CHECK_ARG_FOR_PRUNE_MODE("-csindex", DEFAULT_CSINDEX)
         #undef CHECK_ARG_FOR_PRUNE_MODE
+
+        if (fParticlMode && !args.GetBoolArg("-voteindex", DEFAULT_VOTEINDEX)) {
+            LogPrintf("Prune mode without -voteindex, tallyvotes can only count unpruned blocks.\n");
+        }
     }
 
     // -bind and -whitebind can't be set when not listening
@@ -1271,6 +1356,8 @@ bool AppInitParameterInteraction(const ArgsManager& args)
 
     fCheckBlockIndex = args.GetBoolArg("-checkblockindex", chainparams.DefaultConsistencyChecks());
     fCheckpointsEnabled = args.GetBoolArg("-checkpoints", DEFAULT_CHECKPOINTS_ENABLED);
+    g_mmap_blocks = args.GetBoolArg("-mmapblocks", DEFAULT_MMAP_BLOCKS);
+    g_reindex_check_threads = std::max(0, std::min((int)args.GetArg("-reindexthreads", DEFAULT_REINDEX_CHECK_THREADS), MAX_REINDEX_CHECK_THREADS));
 
     hashAssumeValid = uint256S(args.GetArg("-assumevalid", chainparams.GetConsensus().defaultAssumeValid.GetHex()));
     if (!hashAssumeValid.IsNull())
@@ -1424,6 +1511,9 @@ bool AppInitSanityChecks()
     // Initialize elliptic curve code
     std::string sha256_algo = SHA256AutoDetect();
     LogPrintf("Using the '%s' SHA256 implementation\n", sha256_algo);
+    LogPrintf("Using the '%s' SHA512 implementation\n", SHA512AutoDetect());
+    LogPrintf("Using the '%s' RIPEMD160 implementation\n", RIPEMD160AutoDetect());
+    LogPrintf("Using the '%s' AES implementation\n", AESAutoDetect());
     RandomInit();
     ECC_Start();
     ECC_Start_Stealth();
@@ -1471,6 +1561,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 {
     const ArgsManager& args = *Assert(node.args);
     const CChainParams& chainparams = Params();
+    InitStagesBegin();
     // ********************************************************* Step 4a: application initialization
     if (!CreatePidFile(args)) {
         // Detailed error printed inside CreatePidFile().
@@ -1487,6 +1578,18 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
             return InitError(strprintf(Untranslated("Could not open debug log file %s"),
                 LogInstance().m_file_path.string()));
     }
+    if (args.GetBoolArg("-logasync", DEFAULT_LOGASYNC)) {
+        const std::string overflow = args.GetArg("-logasyncoverflow", DEFAULT_LOGASYNC_OVERFLOW);
+        if (overflow != "block" && overflow != "drop") {
+            return InitError(strprintf(_("Unknown -logasyncoverflow policy: %s"), overflow));
+        }
+        const int64_t buffer_size = args.GetArg("-logasyncbuffer", DEFAULT_LOGASYNC_BUFFER);
+        if (buffer_size < 1 || buffer_size > (1 << 24)) {
+            return InitError(Untranslated("-logasyncbuffer must be between 1 and 16777216"));
+        }
+        LogInstance().StartAsync(buffer_size, overflow == "drop",
+            std::chrono::milliseconds{args.GetArg("-logasyncflushinterval", DEFAULT_LOGASYNC_FLUSH_INTERVAL)});
+    }
 
     if (!LogInstance().m_log_timestamps)
         LogPrintf("Startup time: %s\n", FormatISO8601DateTime(GetTime()));
@@ -1521,6 +1624,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 
     InitSignatureCache();
     InitScriptExecutionCache();
+    InitProofCache();
 
     int script_threads = args.GetArg("-par", DEFAULT_SCRIPTCHECK_THREADS);
     if (script_threads <= 0) {
@@ -1543,6 +1647,24 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
         }
     }
 
+    g_block_cache.SetMaxMemory((size_t)std::max(args.GetArg("-blockcachemem", DEFAULT_BLOCK_CACHE_MEM), (int64_t)0) << 20);
+
+    const int prefetch_depth = args.GetArg("-blockprefetch", DEFAULT_BLOCK_PREFETCH);
+    if (prefetch_depth > 0) {
+        const int prefetch_threads = std::min(std::max((int)args.GetArg("-blockprefetchthreads", DEFAULT_BLOCK_PREFETCH_THREADS), 1), MAX_BLOCK_PREFETCH_THREADS);
+        const int64_t prefetch_mem = std::max(args.GetArg("-blockprefetchmem", DEFAULT_BLOCK_PREFETCH_MEM), (int64_t)1);
+        LogPrintf("Block prefetch reads up to %d blocks ahead with %d threads\n", prefetch_depth, prefetch_threads);
+        g_block_prefetcher.Start(prefetch_threads, prefetch_depth, (size_t)prefetch_mem << 20);
+    }
+
+    int task_pool_threads = args.GetArg("-taskpoolthreads", DEFAULT_TASKPOOL_THREADS);
+    if (task_pool_threads <= 0) {
+        task_pool_threads += GetNumCores();
+    }
+    task_pool_threads = std::max(1, std::min(task_pool_threads, MAX_TASKPOOL_THREADS));
+    LogPrintf("Task pool uses %d threads\n", task_pool_threads);
+    g_task_pool.Start(task_pool_threads);
+
     assert(!node.scheduler);
     node.scheduler = MakeUnique<CScheduler>();
 
@@ -1554,6 +1676,16 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
         RandAddPeriodic();
     }, std::chrono::minutes{1});
 
+    g_lock_profiling = args.GetBoolArg("-lockprofile", DEFAULT_LOCKPROFILE);
+    const int64_t lock_profile_interval = args.GetArg("-lockprofileinterval", DEFAULT_LOCKPROFILE_INTERVAL);
+    if (lock_profile_interval > 0) {
+        node.scheduler->scheduleEvery([]{
+            if (g_lock_profiling) {
+                LogLockProfile(10);
+            }
+        }, std::chrono::seconds{lock_profile_interval});
+    }
+
     GetMainSignals().RegisterBackgroundSignalScheduler(*node.scheduler);
 
     /* Register RPC commands regardless of -server setting so they will be
@@ -1584,9 +1716,12 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     }
 
     // ********************************************************* Step 5: verify wallet database integrity
-    for (const auto& client : node.chain_clients) {
-        if (!client->verify()) {
-            return false;
+    {
+        InitStageTimer timer("verify wallets");
+        for (const auto& client : node.chain_clients) {
+            if (!client->verify()) {
+                return false;
+            }
         }
     }
 
@@ -1605,6 +1740,10 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     // which are all started after this, may use it from the node context.
     assert(!node.mempool);
     node.mempool = MakeUnique<CTxMemPool>(&::feeEstimator);
+    RegisterLockProfile(&cs_main, "cs_main");
+    RegisterLockProfile(&node.mempool->cs, "mempool.cs");
+    RegisterLockProfile(&smsgModule.cs_smsg, "cs_smsg");
+    RegisterLockProfile(&smsg::cs_smsgDB, "cs_smsgDB");
     if (node.mempool) {
         int ratio = std::min<int>(std::max<int>(args.GetArg("-checkmempool", chainparams.DefaultConsistencyChecks() ? 1 : 0), 0), 1000000);
         if (ratio != 0) {
@@ -1618,7 +1757,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 
     node.peerman.reset(new PeerManager(chainparams, *node.connman, node.banman.get(), *node.scheduler, chainman, *node.mempool));
     g_peerman = node.peerman.get(); // Hack: For Misbehaving
-    RegisterValidationInterface(node.peerman.get());
+    RegisterValidationInterface(node.peerman.get(), "peerman");
 
 
     // sanitize comments per BIP-0014, format user agent and check total size
@@ -1736,9 +1875,12 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     g_zmq_notification_interface = CZMQNotificationInterface::Create();
 
     if (g_zmq_notification_interface) {
-        RegisterValidationInterface(g_zmq_notification_interface);
+        RegisterValidationInterface(g_zmq_notification_interface, "zmq");
     }
 #endif
+    if (args.GetBoolArg("-stealthscanserver", DEFAULT_STEALTH_SCAN_SERVER)) {
+        g_stealth_scan_server.Start(std::max(args.GetArg("-stealthscanmaxkeys", DEFAULT_STEALTH_SCAN_MAX_KEYS), (int64_t)1));
+    }
     uint64_t nMaxOutboundLimit = 0; //unlimited unless -maxuploadtarget is set
     uint64_t nMaxOutboundTimeframe = MAX_UPLOAD_TIMEFRAME;
 
@@ -1779,7 +1921,19 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     }
 
     //int64_t nBlockTreeDBCache = std::min(nTotalCache / 8, nMaxBlockDBCache << 20);
-    nTotalCache -= nBlockTreeDBCache;
+    const bool fInsightDB = args.IsArgSet("-insightdbdir") || args.GetBoolArg("-insightdb", DEFAULT_INSIGHTDB);
+    const fs::path insight_db_dir = args.IsArgSet("-insightdbdir") ? AbsPathForConfigVal(fs::path(args.GetArg("-insightdbdir", ""))) : GetDataDir() / "indexes" / "insight";
+    int64_t nInsightDBCache = 0;
+    if (fInsightDB) {
+        if (args.IsArgSet("-insightdbcache")) {
+            nInsightDBCache = std::min(std::max((int64_t)0, args.GetArg("-insightdbcache", 0)) << 20, nTotalCache / 2);
+            nBlockTreeDBCache = std::max(nBlockTreeDBCache - nInsightDBCache, std::min(nBlockTreeDBCache, nMaxBlockDBCache << 20));
+        } else {
+            nInsightDBCache = nBlockTreeDBCache * 2 / 3;
+            nBlockTreeDBCache -= nInsightDBCache;
+        }
+    }
+    nTotalCache -= nBlockTreeDBCache + nInsightDBCache;
     int64_t nTxIndexCache = std::min(nTotalCache / 8, args.GetBoolArg("-txindex", DEFAULT_TXINDEX) ? nMaxTxIndexCache << 20 : 0);
     nTotalCache -= nTxIndexCache;
     int64_t filter_index_cache = 0;
@@ -1794,9 +1948,13 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     nTotalCache -= nCoinDBCache;
     int64_t nCoinCacheUsage = nTotalCache; // the rest goes to in-memory cache
     int64_t nMempoolSizeMax = args.GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
+    int64_t nRCTIndexCache = std::max((int64_t)0, args.GetArg("-rctindexcache", DEFAULT_RCTINDEX_CACHE)) << 20;
     LogPrintf("Cache configuration:\n");
     LogPrintf("* Max cache setting possible %.1fMiB\n", nMaxDbCache);
     LogPrintf("* Using %.1f MiB for block index database\n", nBlockTreeDBCache * (1.0 / 1024 / 1024));
+    if (fInsightDB) {
+        LogPrintf("* Using %.1f MiB for insight index database\n", nInsightDBCache * (1.0 / 1024 / 1024));
+    }
     if (args.GetBoolArg("-txindex", DEFAULT_TXINDEX)) {
         LogPrintf("* Using %.1f MiB for transaction index database\n", nTxIndexCache * (1.0 / 1024 / 1024));
     }
@@ -1806,8 +1964,14 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     }
     LogPrintf("* Using %.1f MiB for chain state database\n", nCoinDBCache * (1.0 / 1024 / 1024));
     LogPrintf("* Using %.1f MiB for in-memory UTXO set (plus up to %.1f MiB of unused mempool space)\n", nCoinCacheUsage * (1.0 / 1024 / 1024), nMempoolSizeMax * (1.0 / 1024 / 1024));
+    LogPrintf("* Using %.1f MiB for in-memory anon output cache\n", nRCTIndexCache * (1.0 / 1024 / 1024));
 
 
+    // The smsg bucket sets don't depend on the chain, build them while it loads
+    if (fParticlMode && gArgs.GetBoolArg("-smsg", true)) {
+        smsgModule.StartPreload();
+    }
+
     bool fLoaded = false;
     while (!fLoaded && !ShutdownRequestedMainThread()) {
         bool fReset = fReindex;
@@ -1820,6 +1984,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 
         do {
             const int64_t load_block_index_start_time = GetTimeMillis();
+            InitStageTimer load_timer("load block index");
             try {
                 LOCK(cs_main);
                 chainman.InitializeChainstate(*Assert(node.mempool));
@@ -1840,6 +2005,12 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
                     pblocktree.reset();
                     pblocktree.reset(new CBlockTreeDB(nBlockTreeDBCache, false, fReset));
                 }
+                pblocktree->SetRCTOutputCacheSize(nRCTIndexCache);
+                if (!pblocktree->OpenInsightDB(fInsightDB, insight_db_dir, nInsightDBCache)) {
+                    if (ShutdownRequested()) break;
+                    strLoadError = _("Error opening insight index database");
+                    break;
+                }
 
                 if (fReset) {
                     pblocktree->WriteReindexing(true);
@@ -1884,6 +2055,18 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
                     strLoadError = _("You need to rebuild the database using -reindex to change -balancesindex");
                     break;
                 }
+                if (fVoteIndex != gArgs.GetBoolArg("-voteindex", DEFAULT_VOTEINDEX)) {
+                    strLoadError = _("You need to rebuild the database using -reindex to change -voteindex");
+                    break;
+                }
+                if (fRewardIndex != gArgs.GetBoolArg("-rewardindex", DEFAULT_REWARDINDEX)) {
+                    strLoadError = _("You need to rebuild the database using -reindex to change -rewardindex");
+                    break;
+                }
+                if (fInsightIndexAsync != gArgs.GetBoolArg("-insightindexasync", DEFAULT_INSIGHTINDEXASYNC)) {
+                    strLoadError = _("You need to rebuild the database using -reindex to change -insightindexasync");
+                    break;
+                }
 
                 // Check for changed -prune state.  What we are concerned about is a user who has pruned blocks
                 // in the past, but is now trying to run unpruned.
@@ -1901,6 +2084,25 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
                     break;
                 }
 
+                // Databases written by older versions lack the height ordered key image and spent cache keys
+                if (!pblocktree->UpgradeRCTKeyImageHeights()) {
+                    if (ShutdownRequested()) break;
+                    strLoadError = _("Error upgrading block database");
+                    break;
+                }
+                if (!pblocktree->UpgradeSpentCacheHeights()) {
+                    if (ShutdownRequested()) break;
+                    strLoadError = _("Error upgrading block database");
+                    break;
+                }
+
+                // Convert a legacy address index when -compactaddressindex is set, or resume an interrupted conversion
+                if (!pblocktree->UpgradeAddressIndex(gArgs.IsArgSet("-compactaddressindex") && gArgs.GetBoolArg("-compactaddressindex", DEFAULT_COMPACTADDRESSINDEX))) {
+                    if (ShutdownRequested()) break;
+                    strLoadError = _("Error upgrading block database");
+                    break;
+                }
+
                 // At this point we're either in reindex or we've loaded a useful
                 // block tree into BlockIndex()!
 
@@ -1918,6 +2120,14 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
                             "", CClientUIInterface::MSG_ERROR);
                     });
 
+                    // Coins and undo data take the compact layout when the chainstate is built from scratch,
+                    // a chainstate written by an older version keeps the layout that version reads
+                    if (!pblocktree->LoadCoinsFormat(fReset || fReindexChainState || chainstate->CoinsDB().GetBestBlock().IsNull())) {
+                        strLoadError = _("The block database was written in a newer format. You will need to rebuild the database using -reindex.");
+                        failed_chainstate_init = true;
+                        break;
+                    }
+
                     // If necessary, upgrade from older database format.
                     // This is a no-op if we cleared the coinsviewdb with -reindex or -reindex-chainstate
                     if (!chainstate->CoinsDB().Upgrade()) {
@@ -1986,7 +2196,9 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
                 break; // out of the chainstate activation do-while
             }
 
+            load_timer.Stop();
             bool failed_verification = false;
+            InitStageTimer verify_timer("verify blocks");
 
             try {
                 LOCK(cs_main);
@@ -2073,6 +2285,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     fFeeEstimatesInitialized = true;
 
     // ********************************************************* Step 8: start indexers
+    InitStageTimer indexers_timer("start indexers");
     if (args.GetBoolArg("-txindex", DEFAULT_TXINDEX)) {
         g_txindex = MakeUnique<TxIndex>(nTxIndexCache, false, fReindex);
 
@@ -2085,15 +2298,26 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
         g_txindex->Start();
     }
 
+    if (fInsightIndexAsync && (fAddressIndex || fSpentIndex || fTimestampIndex)) {
+        // The index database only holds the best block locator, the entries go to the block tree database
+        g_insight_index = MakeUnique<InsightIndex>(1 << 20, false, fReindex);
+        g_insight_index->Start();
+    }
+
     for (const auto& filter_type : g_enabled_filter_types) {
         InitBlockFilterIndex(filter_type, filter_index_cache, false, fReindex);
         GetBlockFilterIndex(filter_type)->Start();
     }
 
+    indexers_timer.Stop();
+
     // ********************************************************* Step 9: load wallet
-    for (const auto& client : node.chain_clients) {
-        if (!client->load()) {
-            return false;
+    {
+        InitStageTimer timer("load wallets");
+        for (const auto& client : node.chain_clients) {
+            if (!client->load()) {
+                return false;
+            }
         }
     }
 
@@ -2157,12 +2381,15 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
         vImportFiles.push_back(strFile);
     }
 
+    g_coins_writeback.Start(std::min((int)args.GetArg("-coinswriteback", DEFAULT_COINS_WRITEBACK), 100));
+
     g_load_block = std::thread(&TraceThread<std::function<void()>>, "loadblk", [=, &chainman, &args] {
         ThreadImport(chainman, vImportFiles, args);
     });
 
     // Wait for genesis block to be processed
     {
+        InitStageTimer timer("wait for genesis");
         WAIT_LOCK(g_genesis_wait_mutex, lock);
         // We previously could hang here if StartShutdown() is called prior to
         // ThreadImport getting started, so instead we just wait on a timer to
@@ -2177,6 +2404,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 
     smsgModule.m_node = &node;
     if (fParticlMode && gArgs.GetBoolArg("-smsg", true)) { // SMSG breaks functional tests with services flag, see version msg
+        InitStageTimer timer("start smsg");
 #ifdef ENABLE_WALLET
         auto vpwallets = GetWallets();
         smsgModule.Start(vpwallets.size() > 0 ? vpwallets[0] : nullptr, vpwallets, gArgs.GetBoolArg("-smsgscanchain", false));
@@ -2231,6 +2459,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
     connOptions.m_msgproc = node.peerman.get();
     connOptions.nSendBufferMaxSize = 1000 * args.GetArg("-maxsendbuffer", DEFAULT_MAXSENDBUFFER);
     connOptions.nReceiveFloodSize = 1000 * args.GetArg("-maxreceivebuffer", DEFAULT_MAXRECEIVEBUFFER);
+    connOptions.m_msghand_threads = args.GetArg("-msghandthreads", DEFAULT_MSGHAND_THREADS);
     connOptions.m_added_nodes = args.GetArgs("-addnode");
 
     connOptions.nMaxOutboundTimeframe = nMaxOutboundTimeframe;
@@ -2307,6 +2536,7 @@ bool AppInitMain(const util::Ref& context, NodeContext& node, interfaces::BlockA
 
     // ********************************************************* Step 13: finished
 
+    InitStagesFinished();
     SetRPCWarmupFinished();
     uiInterface.InitMessage(_("Done loading").translated);
 
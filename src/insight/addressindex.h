@@ -229,6 +229,216 @@ struct CAddressIndexIteratorHeightKey {
     }
 };
 
+struct CAddressIndexIteratorTxKey {
+    unsigned int type;
+    uint256 hashBytes;
+    int blockHeight;
+    unsigned int txindex;
+
+    size_t GetSerializeSize() const {
+        return 41;
+    }
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writedata8(s, type);
+        hashBytes.Serialize(s);
+        ser_writedata32be(s, blockHeight);
+        ser_writedata32be(s, txindex);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s) {
+        type = ser_readdata8(s);
+        hashBytes.Unserialize(s);
+        blockHeight = ser_readdata32be(s);
+        txindex = ser_readdata32be(s);
+    }
+
+    CAddressIndexIteratorTxKey(unsigned int addressType, uint256 addressHash, int height, unsigned int txIndex) {
+        type = addressType;
+        hashBytes = addressHash;
+        blockHeight = height;
+        txindex = txIndex;
+    }
+
+    CAddressIndexIteratorTxKey() {
+        SetNull();
+    }
+
+    void SetNull() {
+        type = ADDR_INDT_UNKNOWN;
+        hashBytes.SetNull();
+        blockHeight = 0;
+        txindex = 0;
+    }
+};
+
+/**
+ * Unsigned integers in the compact address index keys are written as a length byte followed by the
+ * big-endian bytes without leading zeros, short for small values and sorting like the values in LevelDB.
+ */
+template<typename Stream>
+inline void ser_writeordered32(Stream &s, uint32_t n)
+{
+    uint8_t buf[4];
+    uint8_t len = 0;
+    for (uint32_t v = n; v; v >>= 8) {
+        len++;
+    }
+    for (uint8_t i = 0; i < len; ++i) {
+        buf[i] = (n >> (8 * (len - 1 - i))) & 0xFF;
+    }
+    ser_writedata8(s, len);
+    s.write((const char*)buf, len);
+}
+template<typename Stream>
+inline uint32_t ser_readordered32(Stream &s)
+{
+    const uint8_t len = ser_readdata8(s);
+    if (len > 4) {
+        throw std::ios_base::failure("ser_readordered32(): length too large");
+    }
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < len; ++i) {
+        n = (n << 8) | ser_readdata8(s);
+    }
+    return n;
+}
+
+/**
+ * Compact encoding of CAddressIndexKey, the address is replaced by its short id from the address id
+ * table and the txid is kept once per tx in the tx position table, keyed by height and txindex.
+ */
+struct CAddressIndexKeyV2 {
+    uint32_t addressId;
+    int blockHeight;
+    unsigned int txindex;
+    uint32_t index;
+    bool spending;
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writeordered32(s, addressId);
+        ser_writeordered32(s, blockHeight);
+        ser_writeordered32(s, txindex);
+        WriteVarInt<Stream, VarIntMode::DEFAULT, uint32_t>(s, index);
+        ser_writedata8(s, spending);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s) {
+        addressId = ser_readordered32(s);
+        blockHeight = (int)ser_readordered32(s);
+        txindex = ser_readordered32(s);
+        index = ReadVarInt<Stream, VarIntMode::DEFAULT, uint32_t>(s);
+        spending = ser_readdata8(s);
+    }
+
+    CAddressIndexKeyV2(uint32_t id, const CAddressIndexKey &key) {
+        addressId = id;
+        blockHeight = key.blockHeight;
+        txindex = key.txindex;
+        index = key.index;
+        spending = key.spending;
+    }
+
+    CAddressIndexKeyV2() {
+        SetNull();
+    }
+
+    void SetNull() {
+        addressId = 0;
+        blockHeight = 0;
+        txindex = 0;
+        index = 0;
+        spending = false;
+    }
+};
+
+struct CAddressIndexIteratorKeyV2 {
+    uint32_t addressId;
+    int blockHeight;
+    unsigned int txindex;
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writeordered32(s, addressId);
+        ser_writeordered32(s, blockHeight);
+        ser_writeordered32(s, txindex);
+    }
+
+    CAddressIndexIteratorKeyV2(uint32_t id, int height, unsigned int txIndex) {
+        addressId = id;
+        blockHeight = height;
+        txindex = txIndex;
+    }
+};
+
+//! Amounts in the compact address index, zigzag encoded so spends stay short
+struct CAddressIndexValueV2 {
+    CAmount amount;
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        const uint64_t n = ((uint64_t)amount << 1) ^ (uint64_t)(amount >> 63);
+        WriteVarInt<Stream, VarIntMode::DEFAULT, uint64_t>(s, n);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s) {
+        const uint64_t n = ReadVarInt<Stream, VarIntMode::DEFAULT, uint64_t>(s);
+        amount = (CAmount)(n >> 1) ^ -(CAmount)(n & 1);
+    }
+
+    explicit CAddressIndexValueV2(CAmount value = 0) : amount(value) {}
+};
+
+//! Key of the tx position table, the txid of a tx with compact address index entries
+struct CTxPositionKey {
+    int blockHeight;
+    unsigned int txindex;
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writedata32be(s, blockHeight);
+        ser_writedata32be(s, txindex);
+    }
+
+    CTxPositionKey(int height, unsigned int txIndex) : blockHeight(height), txindex(txIndex) {}
+
+    bool operator<(const CTxPositionKey &b) const {
+        return blockHeight < b.blockHeight || (blockHeight == b.blockHeight && txindex < b.txindex);
+    }
+};
+
+/** Running totals of the address index entries of an address, keyed by CAddressIndexIteratorKey */
+struct CAddressBalanceValue {
+    CAmount balance;
+    CAmount received;
+    uint32_t txCount;
+    int lastHeight;
+
+    SERIALIZE_METHODS(CAddressBalanceValue, obj)
+    {
+        READWRITE(obj.balance);
+        READWRITE(obj.received);
+        READWRITE(VARINT(obj.txCount));
+        READWRITE(VARINT_MODE(obj.lastHeight, VarIntMode::NONNEGATIVE_SIGNED));
+    }
+
+    CAddressBalanceValue() {
+        SetNull();
+    }
+
+    void SetNull() {
+        balance = 0;
+        received = 0;
+        txCount = 0;
+        lastHeight = 0;
+    }
+
+    bool IsNull() const {
+        return txCount == 0;
+    }
+};
+
 struct CMempoolAddressDelta
 {
     int64_t time;
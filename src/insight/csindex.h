@@ -10,6 +10,9 @@
 constexpr char DB_TXINDEX_CSOUTPUT = 'O';
 constexpr char DB_TXINDEX_CSLINK = 'L';
 constexpr char DB_TXINDEX_CSBESTBLOCK = 'C';
+constexpr char DB_TXINDEX_CSUNSPENT = 'U';
+constexpr char DB_TXINDEX_CSUNSPENT_LINK = 'u';
+constexpr char DB_TXINDEX_CSUNSPENT_FLAG = 'V';
 
 enum CSIndexFlags
 {
@@ -98,4 +101,77 @@ public:
     }
 };
 
+static inline size_t CSIndexIdSize(TxoutType type)
+{
+    return (type == TxoutType::PUBKEYHASH256 || type == TxoutType::SCRIPTHASH256) ? 32 : 20;
+}
+
+/** Seek key for the unspent coldstake outputs of a stake address */
+class ColdStakeIndexStakeKey
+{
+public:
+    TxoutType m_stake_type = TxoutType::NONSTANDARD;
+    CKeyID256 m_stake_id;
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writedata8(s, particl::FromTxoutType(m_stake_type));
+        s.write((char*)m_stake_id.begin(), CSIndexIdSize(m_stake_type));
+    }
+};
+
+/**
+ * Unspent coldstake outputs at the index tip, ordered by stake and spend key
+ * so the outputs of a stake address are one prefix walk.
+ */
+class ColdStakeIndexUnspentKey
+{
+public:
+    TxoutType m_stake_type = TxoutType::NONSTANDARD, m_spend_type = TxoutType::NONSTANDARD;
+    CKeyID256 m_stake_id, m_spend_id;
+    unsigned int m_height = 0;
+    ColdStakeIndexOutputKey m_output;
+
+    ColdStakeIndexUnspentKey() {};
+    ColdStakeIndexUnspentKey(const ColdStakeIndexLinkKey &lk, const ColdStakeIndexOutputKey &ok)
+        : m_stake_type(lk.m_stake_type), m_spend_type(lk.m_spend_type), m_stake_id(lk.m_stake_id), m_spend_id(lk.m_spend_id), m_height(lk.m_height), m_output(ok) {};
+
+    template<typename Stream>
+    void Serialize(Stream& s) const {
+        ser_writedata8(s, particl::FromTxoutType(m_stake_type));
+        s.write((char*)m_stake_id.begin(), CSIndexIdSize(m_stake_type));
+        ser_writedata8(s, particl::FromTxoutType(m_spend_type));
+        s.write((char*)m_spend_id.begin(), CSIndexIdSize(m_spend_type));
+        ser_writedata32be(s, m_height);
+        m_output.Serialize(s);
+    }
+    template<typename Stream>
+    void Unserialize(Stream& s) {
+        m_stake_type = particl::ToTxoutType(ser_readdata8(s));
+        m_stake_id.SetNull();
+        s.read((char*)m_stake_id.begin(), CSIndexIdSize(m_stake_type));
+        m_spend_type = particl::ToTxoutType(ser_readdata8(s));
+        m_spend_id.SetNull();
+        s.read((char*)m_spend_id.begin(), CSIndexIdSize(m_spend_type));
+        m_height = ser_readdata32be(s);
+        m_output.Unserialize(s);
+    }
+};
+
+class ColdStakeIndexUnspentValue
+{
+public:
+    CAmount m_value = 0;
+    uint8_t m_flags = 0;
+
+    ColdStakeIndexUnspentValue() {};
+    explicit ColdStakeIndexUnspentValue(const ColdStakeIndexOutputValue &ov) : m_value(ov.m_value), m_flags(ov.m_flags) {};
+
+    SERIALIZE_METHODS(ColdStakeIndexUnspentValue, obj)
+    {
+        READWRITE(obj.m_value);
+        READWRITE(obj.m_flags);
+    }
+};
+
 #endif // PARTICL_INSIGHT_CSINDEX_H
@@ -6,6 +6,9 @@
 #include <insight/addressindex.h>
 #include <insight/spentindex.h>
 #include <insight/timestampindex.h>
+#include <insight/rewardindex.h>
+#include <chain.h>
+#include <chainparams.h>
 #include <validation.h>
 #include <txdb.h>
 #include <txmempool.h>
@@ -18,10 +21,17 @@
 #include <script/interpreter.h>
 #include <util/system.h>
 
+#include <algorithm>
+
 bool fAddressIndex = false;
 bool fTimestampIndex = false;
 bool fSpentIndex = false;
 bool fBalancesIndex = false;
+bool fVoteIndex = false;
+bool fRewardIndex = false;
+bool fInsightIndexAsync = false;
+bool fAddressBalanceIndex = false;
+bool fAddressIndexV2 = false;
 
 bool ExtractIndexInfo(const CScript *pScript, int &scriptType, std::vector<uint8_t> &hashBytes)
 {
@@ -79,11 +89,65 @@ bool ExtractIndexInfo(const CTxOutBase *out, int &scriptType, std::vector<uint8_
     return true;
 };
 
+static std::array<InsightIndexStats, INSIGHT_STATS_MAX> g_insight_stats;
+
+const char *InsightStatsName(InsightStatsType type)
+{
+    switch (type) {
+        case INSIGHT_STATS_ADDRESS: return "addressindex";
+        case INSIGHT_STATS_ADDRESSUNSPENT: return "addressunspentindex";
+        case INSIGHT_STATS_SPENT: return "spentindex";
+        case INSIGHT_STATS_TIMESTAMP: return "timestampindex";
+        case INSIGHT_STATS_BALANCES: return "balancesindex";
+        case INSIGHT_STATS_VOTES: return "voteindex";
+        case INSIGHT_STATS_REWARDS: return "rewardindex";
+        default: break;
+    }
+    return "unknown";
+}
+
+InsightIndexStats &GetInsightStats(InsightStatsType type)
+{
+    assert(type < INSIGHT_STATS_MAX);
+    return g_insight_stats[type];
+}
+
+void RecordInsightWrite(InsightStatsType type, size_t nKeys, size_t nBytes, int64_t nMicros)
+{
+    InsightIndexStats &stats = GetInsightStats(type);
+    stats.nWrites++;
+    stats.nKeysWritten += nKeys;
+    stats.nBytesWritten += nBytes;
+    stats.nWriteMicros += nMicros;
+    LogPrint(BCLog::BENCH, "      - %s: %u keys, %u bytes, %.2fms [%.2fs (%.2fms/batch)]\n", InsightStatsName(type),
+        nKeys, nBytes, nMicros * 0.001, stats.nWriteMicros * 0.000001, stats.nWriteMicros * 0.001 / stats.nWrites);
+}
+
+void RecordInsightRead(InsightStatsType type, int64_t nMicros)
+{
+    InsightIndexStats &stats = GetInsightStats(type);
+    stats.nReads++;
+    stats.nReadMicros += nMicros;
+    size_t bucket = 0;
+    for (int64_t bound = 1; bucket < InsightIndexStats::READ_BUCKETS - 1 && nMicros >= bound; bound *= 4) {
+        bucket++;
+    }
+    stats.read_buckets[bucket]++;
+}
+
+InsightReadTimer::InsightReadTimer(InsightStatsType type) : m_type(type), m_start(GetTimeMicros()) {}
+
+InsightReadTimer::~InsightReadTimer()
+{
+    RecordInsightRead(m_type, GetTimeMicros() - m_start);
+}
+
 bool GetTimestampIndex(const unsigned int &high, const unsigned int &low, const bool fActiveOnly, std::vector<std::pair<uint256, unsigned int> > &hashes)
 {
     if (!fTimestampIndex) {
         return error("Timestamp index not enabled");
     }
+    InsightReadTimer timer(INSIGHT_STATS_TIMESTAMP);
     if (!pblocktree->ReadTimestampIndex(high, low, fActiveOnly, hashes)) {
         return error("Unable to get hashes for timestamps");
     }
@@ -91,11 +155,54 @@ bool GetTimestampIndex(const unsigned int &high, const unsigned int &low, const
     return true;
 };
 
+bool GetTimestampIndex(unsigned int high, unsigned int low, bool fActiveOnly, size_t limit,
+                       const std::function<void(const uint256&, unsigned int)> &fn)
+{
+    if (!fTimestampIndex) {
+        return error("Timestamp index not enabled");
+    }
+
+    InsightReadTimer timer(INSIGHT_STATS_TIMESTAMP);
+    static const size_t BATCH_SIZE = 1000;
+    std::vector<std::pair<uint256, unsigned int> > batch;
+    size_t count = 0;
+    auto flush = [&]() {
+        if (fActiveOnly) {
+            LOCK(cs_main);
+            batch.erase(std::remove_if(batch.begin(), batch.end(),
+                [](const std::pair<uint256, unsigned int> &entry) EXCLUSIVE_LOCKS_REQUIRED(cs_main) { return !HashOnchainActive(entry.first); }),
+                batch.end());
+        }
+        for (const auto &entry : batch) {
+            if (limit && count >= limit) {
+                break;
+            }
+            fn(entry.first, entry.second);
+            count++;
+        }
+        batch.clear();
+    };
+
+    if (!pblocktree->ForEachTimestampIndex(low, high, [&](const CTimestampIndexKey &key) {
+            batch.emplace_back(key.blockHash, key.timestamp);
+            if (batch.size() >= BATCH_SIZE) {
+                flush();
+            }
+            return !limit || count < limit;
+        })) {
+        return error("Unable to get hashes for timestamps");
+    }
+    flush();
+
+    return true;
+};
+
 bool GetSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value, const CTxMemPool *pmempool)
 {
     if (!fSpentIndex) {
         return false;
     }
+    InsightReadTimer timer(INSIGHT_STATS_SPENT);
     if (pmempool && pmempool->getSpentIndex(key, value)) {
         return true;
     }
@@ -108,9 +215,9 @@ bool GetSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value, const CTx
 
 bool HashOnchainActive(const uint256 &hash)
 {
-    CBlockIndex* pblockindex = g_chainman.BlockIndex()[hash];
+    const CBlockIndex* pblockindex = LookupBlockIndex(hash);
 
-    if (!::ChainActive().Contains(pblockindex)) {
+    if (!pblockindex || !::ChainActive().Contains(pblockindex)) {
         return false;
     }
 
@@ -123,6 +230,7 @@ bool GetAddressIndex(const uint256 &addressHash, int type,
     if (!fAddressIndex) {
         return error("Address index not enabled");
     }
+    InsightReadTimer timer(INSIGHT_STATS_ADDRESS);
     if (!pblocktree->ReadAddressIndex(addressHash, type, addressIndex, start, end)) {
         return error("Unable to get txids for address");
     }
@@ -130,12 +238,27 @@ bool GetAddressIndex(const uint256 &addressHash, int type,
     return true;
 };
 
+bool GetAddressBalance(const uint256 &addressHash, int type, CAddressBalanceValue &value)
+{
+    if (!fAddressBalanceIndex) {
+        return error("Address balance index not enabled");
+    }
+    InsightReadTimer timer(INSIGHT_STATS_ADDRESS);
+    if (!pblocktree->ReadAddressBalance(CAddressIndexIteratorKey(type, addressHash), value)) {
+        // Addresses without entries have no record
+        value.SetNull();
+    }
+
+    return true;
+};
+
 bool GetAddressUnspent(const uint256 &addressHash, int type,
                        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &unspentOutputs)
 {
     if (!fAddressIndex) {
         return error("Address index not enabled");
     }
+    InsightReadTimer timer(INSIGHT_STATS_ADDRESSUNSPENT);
     if (!pblocktree->ReadAddressUnspentIndex(addressHash, type, unspentOutputs)) {
         return error("Unable to get txids for address");
     }
@@ -148,6 +271,7 @@ bool GetBlockBalances(const uint256 &block_hash, BlockBalances &balances)
     if (!fBalancesIndex) {
         return error("Balances index not enabled");
     }
+    InsightReadTimer timer(INSIGHT_STATS_BALANCES);
     if (!pblocktree->ReadBlockBalancesIndex(block_hash, balances)) {
         return error("Unable to get balances for block %s", block_hash.ToString());
     }
@@ -155,6 +279,136 @@ bool GetBlockBalances(const uint256 &block_hash, BlockBalances &balances)
     return true;
 };
 
+bool GetBlockVote(const uint256 &block_hash, uint32_t &vote_token)
+{
+    if (!fVoteIndex) {
+        return false;
+    }
+    InsightReadTimer timer(INSIGHT_STATS_VOTES);
+    return pblocktree->ReadBlockVoteIndex(block_hash, vote_token);
+};
+
+bool GetBlockReward(const uint256 &block_hash, BlockRewardSummary &summary)
+{
+    if (!fRewardIndex) {
+        return false;
+    }
+    InsightReadTimer timer(INSIGHT_STATS_REWARDS);
+    return pblocktree->ReadBlockRewardIndex(block_hash, summary);
+};
+
+void BuildBlockRewardSummary(const CTransaction &tx, const CBlockIndex *pindex, CAmount value_in,
+                             CAmount kernel_value, const CScript &kernel_script, BlockRewardSummary &summary)
+{
+    summary = BlockRewardSummary();
+    if (tx.IsCoinStake()) {
+        summary.coinstake = tx.GetHash();
+        summary.kernel_value = kernel_value;
+        summary.kernel_script = kernel_script;
+    }
+    if (pindex->pprev) {
+        summary.stake_reward = Params().GetProofOfStakeReward(pindex->pprev, 0);
+    }
+
+    const bool gvr_active = pindex->nHeight >= Params().GetConsensus().automatedGvrActivationHeight;
+    const TreasuryFundSettings *fundconf = Params().GetTreasuryFundSettings(pindex->nHeight);
+    CScript fund_script;
+    if (fundconf) {
+        fund_script = GetScriptForDestination(DecodeDestination(fundconf->sTreasuryFundAddresses));
+    }
+    const bool treasury_paid = fundconf && (pindex->nHeight % fundconf->nTreasuryOutputPeriod) == 0;
+
+    bool gvr_paid = false;
+    int num_data_outputs = 0;
+    CAmount value_out = 0, gvr_cfwd = 0;
+    for (const auto &txout : tx.vpout) {
+        if (gvr_active && txout->IsType(OUTPUT_DATA)) {
+            // The first data output carries the gvr cfwd when the gvr isn't paid out
+            if (num_data_outputs == 0 && !txout->GetGvrFundCfwd(gvr_cfwd)) {
+                gvr_paid = true;
+            }
+            num_data_outputs++;
+        }
+        if (!txout->IsStandardOutput()) {
+            continue;
+        }
+        const CScript &script = *txout->GetPScriptPubKey();
+        summary.outputs.emplace_back(script, txout->GetValue());
+
+        if (!gvr_active && fundconf && script == fund_script && summary.treasury_reward == 0) {
+            summary.treasury_reward = txout->GetValue();
+            continue;
+        }
+        value_out += txout->GetValue();
+    }
+
+    summary.block_reward = value_out - value_in;
+    if (gvr_active) {
+        // The treasury is paid from vpout[1] and the gvr from the output after it
+        const size_t gvr_index = treasury_paid ? 2 : 1;
+        if (gvr_paid && tx.vpout.size() > gvr_index) {
+            summary.gvr_reward = tx.vpout[gvr_index]->GetValue();
+            summary.block_reward -= summary.gvr_reward;
+        }
+        if (treasury_paid && tx.vpout.size() > 1) {
+            summary.treasury_reward = tx.vpout[1]->GetValue();
+            summary.block_reward -= summary.treasury_reward;
+        }
+    }
+    if (treasury_paid) {
+        summary.flags |= BlockRewardSummary::HAVE_TREASURY;
+    }
+    if (gvr_paid) {
+        summary.flags |= BlockRewardSummary::HAVE_GVR;
+    }
+}
+
+static bool GetIndexKey(const CTxDestination &dest, uint256 &hashBytes, int &type) {
+    if (dest.type() == typeid(PKHash)) {
+        const PKHash &id = boost::get<PKHash>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 20);
+        type = ADDR_INDT_PUBKEY_ADDRESS;
+        return true;
+    }
+    if (dest.type() == typeid(ScriptHash)) {
+        const ScriptHash& id = boost::get<ScriptHash>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 20);
+        type = ADDR_INDT_SCRIPT_ADDRESS;
+        return true;
+    }
+    if (dest.type() == typeid(CKeyID256)) {
+        const CKeyID256& id = boost::get<CKeyID256>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 32);
+        type = ADDR_INDT_PUBKEY_ADDRESS_256;
+        return true;
+    }
+    if (dest.type() == typeid(CScriptID256)) {
+        const CScriptID256& id = boost::get<CScriptID256>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 32);
+        type = ADDR_INDT_SCRIPT_ADDRESS_256;
+        return true;
+    }
+    if (dest.type() == typeid(WitnessV0KeyHash)) {
+        const WitnessV0KeyHash& id = boost::get<WitnessV0KeyHash>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 20);
+        type = ADDR_INDT_WITNESS_V0_KEYHASH;
+        return true;
+    }
+    if (dest.type() == typeid(WitnessV0ScriptHash)) {
+        const WitnessV0ScriptHash& id = boost::get<WitnessV0ScriptHash>(dest);
+        memcpy(hashBytes.begin(), id.begin(), 32);
+        type = ADDR_INDT_WITNESS_V0_SCRIPTHASH;
+        return true;
+    }
+    type = ADDR_INDT_UNKNOWN;
+    return false;
+}
+
+bool getIndexKey(const std::string &address, uint256 &hashBytes, int &type)
+{
+    return GetIndexKey(DecodeDestination(address), hashBytes, type);
+}
+
 bool getAddressFromIndex(const int &type, const uint256 &hash, std::string &address)
 {
     if (type == ADDR_INDT_SCRIPT_ADDRESS) {
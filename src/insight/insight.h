@@ -12,9 +12,12 @@
 #include <amount.h>
 #include <sync.h>
 #include <stdint.h>
+#include <array>
+#include <atomic>
 #include <vector>
 #include <string>
 #include <utility>
+#include <functional>
 
 extern RecursiveMutex cs_main;
 
@@ -22,14 +25,28 @@ extern bool fAddressIndex;
 extern bool fSpentIndex;
 extern bool fTimestampIndex;
 extern bool fBalancesIndex;
+//! The vote token cast by each coinstake is kept by block hash, read by tallyvotes
+extern bool fVoteIndex;
+//! The reward paid by each coinstake is kept by block hash, read by getblockreward
+extern bool fRewardIndex;
+//! The address, spent and timestamp indexes are built by g_insight_index instead of while connecting blocks
+extern bool fInsightIndexAsync;
+//! Running per address totals are kept with the address index, set when the address index was built from genesis with them
+extern bool fAddressBalanceIndex;
+//! The address index is stored in the compact encoding with short address ids and a tx position table
+extern bool fAddressIndexV2;
 
 class CTxOutBase;
 class CScript;
 class uint256;
 class CTxMemPool;
 class BlockBalances;
+class BlockRewardSummary;
+class CBlockIndex;
+class CTransaction;
 struct CAddressIndexKey;
 struct CAddressUnspentKey;
+struct CAddressBalanceValue;
 struct CAddressUnspentValue;
 struct CSpentIndexKey;
 struct CSpentIndexValue;
@@ -39,15 +56,77 @@ bool ExtractIndexInfo(const CTxOutBase *out, int &scriptType, std::vector<uint8_
 
 /** Functions for insight block explorer */
 bool GetTimestampIndex(const unsigned int &high, const unsigned int &low, const bool fActiveOnly, std::vector<std::pair<uint256, unsigned int> > &hashes) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+/**
+ * Pass up to limit (0 for no limit) block hashes with timestamps in [low, high) to fn in timestamp order.
+ * The index is read without cs_main, active chain membership is checked under one lock per batch of entries.
+ */
+bool GetTimestampIndex(unsigned int high, unsigned int low, bool fActiveOnly, size_t limit,
+                       const std::function<void(const uint256&, unsigned int)> &fn) LOCKS_EXCLUDED(cs_main);
 bool GetSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value, const CTxMemPool *pmempool);
 bool HashOnchainActive(const uint256 &hash) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 bool GetAddressIndex(const uint256 &addressHash, int type,
                      std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                      int start = 0, int end = 0);
+bool GetAddressBalance(const uint256 &addressHash, int type, CAddressBalanceValue &value);
 bool GetAddressUnspent(const uint256 &addressHash, int type,
                        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &unspentOutputs);
 bool GetBlockBalances(const uint256 &block_hash, BlockBalances &balances);
+/** Vote token of a coinstake block, 0 when it casts no vote. Fails for blocks without a coinstake */
+bool GetBlockVote(const uint256 &block_hash, uint32_t &vote_token);
+/** Reward summary of a block from the reward index, fails when the index is disabled or has no record of the block */
+bool GetBlockReward(const uint256 &block_hash, BlockRewardSummary &summary);
+/**
+ * Summarise what the coinstake (or genesis coinbase) of the block at pindex paid out.
+ * value_in is the value of the plain inputs it spends, kernel_value and kernel_script the first of them.
+ */
+void BuildBlockRewardSummary(const CTransaction &tx, const CBlockIndex *pindex, CAmount value_in,
+                             CAmount kernel_value, const CScript &kernel_script, BlockRewardSummary &summary);
 
 bool getAddressFromIndex(const int &type, const uint256 &hash, std::string &address);
+/** Address index type and hash of an encoded address, fails for addresses the index doesn't track */
+bool getIndexKey(const std::string &address, uint256 &hashBytes, int &type);
+
+enum InsightStatsType {
+    INSIGHT_STATS_ADDRESS,
+    INSIGHT_STATS_ADDRESSUNSPENT,
+    INSIGHT_STATS_SPENT,
+    INSIGHT_STATS_TIMESTAMP,
+    INSIGHT_STATS_BALANCES,
+    INSIGHT_STATS_VOTES,
+    INSIGHT_STATS_REWARDS,
+    INSIGHT_STATS_MAX,
+};
+
+/** Write and read counters of one insight index since startup, reported by getinsightinfo */
+struct InsightIndexStats {
+    //! Read latency bucket i counts reads faster than 4^i microseconds, the last bucket the rest
+    static constexpr size_t READ_BUCKETS = 12;
+
+    std::atomic<uint64_t> nWrites{0};
+    std::atomic<uint64_t> nKeysWritten{0};
+    std::atomic<uint64_t> nBytesWritten{0};
+    std::atomic<uint64_t> nWriteMicros{0};
+    std::atomic<uint64_t> nReads{0};
+    std::atomic<uint64_t> nReadMicros{0};
+    std::array<std::atomic<uint64_t>, READ_BUCKETS> read_buckets{};
+};
+
+const char *InsightStatsName(InsightStatsType type);
+InsightIndexStats &GetInsightStats(InsightStatsType type);
+//! Record one batch written to an index and log it with -debug=bench
+void RecordInsightWrite(InsightStatsType type, size_t nKeys, size_t nBytes, int64_t nMicros);
+void RecordInsightRead(InsightStatsType type, int64_t nMicros);
+
+/** Records the lifetime of the object as one read of an index */
+class InsightReadTimer
+{
+public:
+    explicit InsightReadTimer(InsightStatsType type);
+    ~InsightReadTimer();
+
+private:
+    const InsightStatsType m_type;
+    const int64_t m_start;
+};
 
 #endif // BITCOIN_INSIGHT_INSIGHT_H
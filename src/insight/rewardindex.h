@@ -0,0 +1,43 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_INSIGHT_REWARDINDEX_H
+#define BITCOIN_INSIGHT_REWARDINDEX_H
+
+#include <amount.h>
+#include <script/script.h>
+#include <serialize.h>
+#include <uint256.h>
+
+#include <utility>
+#include <vector>
+
+/** What a coinstake paid out, as reported by getblockreward */
+class BlockRewardSummary
+{
+public:
+    static const uint8_t HAVE_TREASURY = (1 << 0);
+    static const uint8_t HAVE_GVR = (1 << 1);
+    static const uint8_t HAVE_FEES = (1 << 2);  // Unset when built from the chain without connecting the block
+
+    uint8_t flags = 0;
+    uint256 coinstake;          // Null for the genesis block
+    CAmount stake_reward = 0;   // Newly minted coin
+    CAmount block_reward = 0;   // Paid to the staker, including fees
+    CAmount treasury_reward = 0;
+    CAmount gvr_reward = 0;
+    CAmount fees = 0;
+    CAmount kernel_value = 0;
+    CScript kernel_script;
+    std::vector<std::pair<CScript, CAmount>> outputs;  // Standard outputs of the coinstake
+
+    SERIALIZE_METHODS(BlockRewardSummary, obj)
+    {
+        READWRITE(obj.flags, obj.coinstake, obj.stake_reward, obj.block_reward,
+                  obj.treasury_reward, obj.gvr_reward, obj.fees, obj.kernel_value,
+                  obj.kernel_script, obj.outputs);
+    }
+};
+
+#endif // BITCOIN_INSIGHT_REWARDINDEX_H
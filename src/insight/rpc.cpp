@@ -2,6 +2,7 @@
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <rpc/jsonstream.h>
 #include <rpc/server.h>
 #include <rpc/util.h>
 #include <rpc/blockchain.h>
@@ -9,6 +10,7 @@
 #include <util/strencodings.h>
 #include <insight/insight.h>
 #include <insight/csindex.h>
+#include <insight/rewardindex.h>
 #include <index/txindex.h>
 #include <validation.h>
 #include <txmempool.h>
@@ -17,62 +19,25 @@
 #include <node/context.h>
 #include <script/standard.h>
 #include <shutdown.h>
+#include <streams.h>
+#include <txdb.h>
+#include <version.h>
 
 #include <univalue.h>
 
+#include <array>
+
 #include <boost/thread/thread.hpp> // boost::thread::interrupt
 
 // Avoid initialization-order-fiasco
 #define _UNIX_EPOCH_TIME "UNIX epoch time"
 
-static bool GetIndexKey(const CTxDestination &dest, uint256 &hashBytes, int &type) {
-    if (dest.type() == typeid(PKHash)) {
-        const PKHash &id = boost::get<PKHash>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 20);
-        type = ADDR_INDT_PUBKEY_ADDRESS;
-        return true;
-    }
-    if (dest.type() == typeid(ScriptHash)) {
-        const ScriptHash& id = boost::get<ScriptHash>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 20);
-        type = ADDR_INDT_SCRIPT_ADDRESS;
-        return true;
-    }
-    if (dest.type() == typeid(CKeyID256)) {
-        const CKeyID256& id = boost::get<CKeyID256>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 32);
-        type = ADDR_INDT_PUBKEY_ADDRESS_256;
-        return true;
-    }
-    if (dest.type() == typeid(CScriptID256)) {
-        const CScriptID256& id = boost::get<CScriptID256>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 32);
-        type = ADDR_INDT_SCRIPT_ADDRESS_256;
-        return true;
-    }
-    if (dest.type() == typeid(WitnessV0KeyHash)) {
-        const WitnessV0KeyHash& id = boost::get<WitnessV0KeyHash>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 20);
-        type = ADDR_INDT_WITNESS_V0_KEYHASH;
-        return true;
-    }
-    if (dest.type() == typeid(WitnessV0ScriptHash)) {
-        const WitnessV0ScriptHash& id = boost::get<WitnessV0ScriptHash>(dest);
-        memcpy(hashBytes.begin(), id.begin(), 32);
-        type = ADDR_INDT_WITNESS_V0_SCRIPTHASH;
-        return true;
-    }
-    type = ADDR_INDT_UNKNOWN;
-    return false;
-}
-
 bool getAddressesFromParams(const UniValue& params, std::vector<std::pair<uint256, int> > &addresses)
 {
     if (params[0].isStr()) {
-        auto dest = DecodeDestination(params[0].get_str());
         uint256 hashBytes;
         int type = 0;
-        if (!GetIndexKey(dest, hashBytes, type)) {
+        if (!getIndexKey(params[0].get_str(), hashBytes, type)) {
             throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
         }
         addresses.push_back(std::make_pair(hashBytes, type));
@@ -85,10 +50,9 @@ bool getAddressesFromParams(const UniValue& params, std::vector<std::pair<uint25
 
         std::vector<UniValue> values = addressValues.getValues();
         for (std::vector<UniValue>::iterator it = values.begin(); it != values.end(); ++it) {
-            auto dest = DecodeDestination(it->get_str());
             uint256 hashBytes;
             int type = 0;
-            if (!GetIndexKey(dest, hashBytes, type)) {
+            if (!getIndexKey(it->get_str(), hashBytes, type)) {
                 throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
             }
             addresses.push_back(std::make_pair(hashBytes, type));
@@ -112,6 +76,121 @@ bool timestampSort(std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> a,
     return a.second.time < b.second.time;
 }
 
+/** Where a paged address query resumes, passed to the client as an opaque hex string */
+struct AddressQueryCursor
+{
+    uint8_t kind = 0;
+    uint32_t nAddress = 0;
+    int nHeight = 0;
+    uint32_t nTxIndex = 0;
+    uint256 txhash;
+    uint32_t n = 0;
+
+    SERIALIZE_METHODS(AddressQueryCursor, obj)
+    {
+        READWRITE(obj.kind, VARINT(obj.nAddress));
+        if (obj.kind == CURSOR_UNSPENT) {
+            READWRITE(obj.txhash, VARINT(obj.n));
+        } else {
+            READWRITE(VARINT_MODE(obj.nHeight, VarIntMode::NONNEGATIVE_SIGNED), VARINT(obj.nTxIndex));
+        }
+    }
+
+    static const uint8_t CURSOR_INDEX = 1;
+    static const uint8_t CURSOR_UNSPENT = 2;
+};
+
+static std::string EncodeCursor(const AddressQueryCursor &cursor)
+{
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss << cursor;
+    return HexStr(ss);
+}
+
+/**
+ * Read the limit and cursor options of a paged address query.
+ * Returns false when no limit is set and the whole result should be returned.
+ */
+static bool GetPagingFromParams(const UniValue &params, uint8_t kind, size_t &nLimit, AddressQueryCursor &cursor)
+{
+    cursor.kind = kind;
+    if (!params[0].isObject()) {
+        return false;
+    }
+    const UniValue &limitValue = find_value(params[0].get_obj(), "limit");
+    const UniValue &cursorValue = find_value(params[0].get_obj(), "cursor");
+    if (limitValue.isNull()) {
+        if (!cursorValue.isNull()) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "cursor requires limit");
+        }
+        return false;
+    }
+    if (limitValue.get_int() < 1) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "limit is expected to be greater than zero");
+    }
+    nLimit = limitValue.get_int();
+
+    if (!cursorValue.isNull()) {
+        std::vector<uint8_t> data = ParseHexV(cursorValue, "cursor");
+        try {
+            CDataStream ss(data, SER_NETWORK, PROTOCOL_VERSION);
+            ss >> cursor;
+        } catch (const std::exception &) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid cursor");
+        }
+        if (cursor.kind != kind) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Cursor is from a different query");
+        }
+    }
+    return true;
+}
+
+/**
+ * Walk the address index entries of the addresses, resuming from cursor and ending pages on a
+ * transaction boundary once nLimit results have been added.
+ * fn returns the number of results the entry added. cursor is set to the next page, or kind 0 when done.
+ */
+static void PageAddressIndex(const std::vector<std::pair<uint256, int> > &addresses, int start, int end,
+                             size_t nLimit, AddressQueryCursor &cursor,
+                             const std::function<size_t(const CAddressIndexKey&, CAmount)> &fn)
+{
+    size_t nResults = 0;
+    bool fMore = false;
+    for (uint32_t i = cursor.nAddress; i < addresses.size() && !fMore; ++i) {
+        int nHeightFrom = std::max(start, 0);
+        uint32_t nTxIndexFrom = 0;
+        if (i == cursor.nAddress && cursor.nHeight > 0) {
+            nHeightFrom = cursor.nHeight;
+            nTxIndexFrom = cursor.nTxIndex;
+        }
+
+        int nLastHeight = -1;
+        uint32_t nLastTxIndex = 0;
+        CAddressIndexIteratorTxKey seek_key(addresses[i].second, addresses[i].first, nHeightFrom, nTxIndexFrom);
+        if (!pblocktree->ForEachAddressIndex(seek_key, [&](const CAddressIndexKey &key, CAmount value) {
+                if (end > 0 && key.blockHeight > end) {
+                    return false;
+                }
+                if (nResults >= nLimit && (key.blockHeight != nLastHeight || key.txindex != nLastTxIndex)) {
+                    cursor.nAddress = i;
+                    cursor.nHeight = key.blockHeight;
+                    cursor.nTxIndex = key.txindex;
+                    fMore = true;
+                    return false;
+                }
+                nLastHeight = key.blockHeight;
+                nLastTxIndex = key.txindex;
+                nResults += fn(key, value);
+                return true;
+            })) {
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+        }
+    }
+    if (!fMore) {
+        cursor.kind = 0;
+    }
+}
+
 UniValue getaddressmempool(const JSONRPCRequest& request)
 {
             RPCHelpMan{"getaddressmempool",
@@ -122,9 +201,10 @@ UniValue getaddressmempool(const JSONRPCRequest& request)
                             {"address", RPCArg::Type::STR, RPCArg::Optional::NO, "The base58check encoded address."},
                         },
                     },
+                    {"sincesequence", RPCArg::Type::NUM, /* default */ "", "Only return deltas of transactions added after this mempool address index sequence."},
                 },
                 RPCResult{
-                    RPCResult::Type::ARR, "", "", {
+                    RPCResult::Type::ARR, "", "With sincesequence set, an object with the deltas in \"deltas\" and the current \"sequence\"", {
                         {RPCResult::Type::OBJ, "", "", {
                             {RPCResult::Type::STR, "address", "The base58check encoded address"},
                             {RPCResult::Type::STR_HEX, "txid", "The related txids"},
@@ -154,8 +234,21 @@ UniValue getaddressmempool(const JSONRPCRequest& request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
     }
 
+    bool fSinceSequence = false;
+    uint64_t since_sequence = 0, sequence = 0;
+    if (request.params[0].isObject()) {
+        const UniValue &sequenceValue = find_value(request.params[0].get_obj(), "sincesequence");
+        if (!sequenceValue.isNull()) {
+            if (sequenceValue.get_int64() < 0) {
+                throw JSONRPCError(RPC_INVALID_PARAMETER, "sincesequence is expected to be positive");
+            }
+            fSinceSequence = true;
+            since_sequence = sequenceValue.get_int64();
+        }
+    }
+
     std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > indexes;
-    if (!mempool.getAddressIndex(addresses, indexes)) {
+    if (!mempool.getAddressIndex(addresses, since_sequence, indexes, sequence)) {
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
     }
 
@@ -184,6 +277,13 @@ UniValue getaddressmempool(const JSONRPCRequest& request)
         result.push_back(delta);
     }
 
+    if (fSinceSequence) {
+        UniValue obj(UniValue::VOBJ);
+        obj.pushKV("deltas", result);
+        obj.pushKV("sequence", sequence);
+        return obj;
+    }
+
     return result;
 }
 
@@ -198,9 +298,11 @@ UniValue getaddressutxos(const JSONRPCRequest& request)
                         },
                     },
                     {"chainInfo", RPCArg::Type::BOOL, /* default */ "false", "Include chain info in results, only applies if start and end specified."},
+                    {"limit", RPCArg::Type::NUM, /* default */ "unlimited", "Return at most limit outputs, ordered by txid instead of height, with a cursor to the next page."},
+                    {"cursor", RPCArg::Type::STR_HEX, /* default */ "", "The cursor returned with the previous page."},
                 },
                 RPCResult{
-                    RPCResult::Type::ARR, "", "", {
+                    RPCResult::Type::ARR, "", "With limit set, an object with the outputs in \"utxos\" and the \"cursor\" to the next page, if there is one", {
                         {RPCResult::Type::OBJ, "", "", {
                             {RPCResult::Type::STR, "address", "The base58check encoded address"},
                             {RPCResult::Type::STR_HEX, "txid", "The output txid"},
@@ -235,31 +337,82 @@ UniValue getaddressutxos(const JSONRPCRequest& request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
     }
 
-    std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > unspentOutputs;
-    for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
-        if (!GetAddressUnspent(it->first, it->second, unspentOutputs)) {
-            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
-        }
-    }
-
-    std::sort(unspentOutputs.begin(), unspentOutputs.end(), heightSort);
-
-    UniValue utxos(UniValue::VARR);
-
-    for (std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >::const_iterator it=unspentOutputs.begin(); it!=unspentOutputs.end(); it++) {
+    auto pushOutput = [](UniValue &utxos, const CAddressUnspentKey &key, const CAddressUnspentValue &value) {
         UniValue output(UniValue::VOBJ);
         std::string address;
-        if (!getAddressFromIndex(it->first.type, it->first.hashBytes, address)) {
+        if (!getAddressFromIndex(key.type, key.hashBytes, address)) {
             throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Unknown address type");
         }
 
         output.pushKV("address", address);
-        output.pushKV("txid", it->first.txhash.GetHex());
-        output.pushKV("outputIndex", (int)it->first.index);
-        output.pushKV("script", HexStr(it->second.script));
-        output.pushKV("satoshis", it->second.satoshis);
-        output.pushKV("height", it->second.blockHeight);
+        output.pushKV("txid", key.txhash.GetHex());
+        output.pushKV("outputIndex", (int)key.index);
+        output.pushKV("script", HexStr(value.script));
+        output.pushKV("satoshis", value.satoshis);
+        output.pushKV("height", value.blockHeight);
         utxos.push_back(output);
+    };
+
+    UniValue utxos(UniValue::VARR);
+
+    size_t nLimit = 0;
+    AddressQueryCursor cursor;
+    const bool fPaged = GetPagingFromParams(request.params, AddressQueryCursor::CURSOR_UNSPENT, nLimit, cursor);
+    if (fPaged) {
+        // Outputs are streamed in index order, seeking to the cursor
+        size_t nResults = 0;
+        bool fMore = false;
+        for (uint32_t i = cursor.nAddress; i < addresses.size() && !fMore; ++i) {
+            CAddressUnspentKey seek_key(addresses[i].second, addresses[i].first, uint256(), 0);
+            if (i == cursor.nAddress) {
+                seek_key.txhash = cursor.txhash;
+                seek_key.index = cursor.n;
+            }
+            if (!pblocktree->ForEachAddressUnspent(seek_key, [&](const CAddressUnspentKey &key, const CAddressUnspentValue &value) {
+                    if (nResults >= nLimit) {
+                        cursor.nAddress = i;
+                        cursor.txhash = key.txhash;
+                        cursor.n = key.index;
+                        fMore = true;
+                        return false;
+                    }
+                    pushOutput(utxos, key, value);
+                    nResults++;
+                    return true;
+                })) {
+                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+            }
+        }
+        if (!fMore) {
+            cursor.kind = 0;
+        }
+    } else {
+        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > unspentOutputs;
+        for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
+            if (!GetAddressUnspent(it->first, it->second, unspentOutputs)) {
+                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+            }
+        }
+
+        std::sort(unspentOutputs.begin(), unspentOutputs.end(), heightSort);
+
+        for (std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >::const_iterator it=unspentOutputs.begin(); it!=unspentOutputs.end(); it++) {
+            pushOutput(utxos, it->first, it->second);
+        }
+    }
+
+    if (fPaged) {
+        UniValue result(UniValue::VOBJ);
+        result.pushKV("utxos", utxos);
+        if (cursor.kind != 0) {
+            result.pushKV("cursor", EncodeCursor(cursor));
+        }
+        if (includeChainInfo) {
+            LOCK(cs_main);
+            result.pushKV("hash", ::ChainActive().Tip()->GetBlockHash().GetHex());
+            result.pushKV("height", (int)::ChainActive().Height());
+        }
+        return result;
     }
 
     if (includeChainInfo) {
@@ -288,9 +441,11 @@ UniValue getaddressdeltas(const JSONRPCRequest& request)
                     {"start", RPCArg::Type::NUM, /* default */ "0", "The start block height."},
                     {"end", RPCArg::Type::NUM, /* default */ "0", "The end block height."},
                     {"chainInfo", RPCArg::Type::BOOL, /* default */ "false", "Include chain info in results, only applies if start and end specified."},
+                    {"limit", RPCArg::Type::NUM, /* default */ "unlimited", "Return about limit deltas, ending on a transaction, with a cursor to the next page."},
+                    {"cursor", RPCArg::Type::STR_HEX, /* default */ "", "The cursor returned with the previous page."},
                 },
                 RPCResult{
-                    RPCResult::Type::ARR, "", "", {
+                    RPCResult::Type::ARR, "", "With limit set, an object with the changes in \"deltas\" and the \"cursor\" to the next page, if there is one", {
                         {RPCResult::Type::OBJ, "", "", {
                             {RPCResult::Type::NUM, "satoshis", "The difference of satoshis"},
                             {RPCResult::Type::STR_HEX, "txid", "The related txid"},
@@ -339,40 +494,78 @@ UniValue getaddressdeltas(const JSONRPCRequest& request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
     }
 
-    std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
-
-    for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
-        if (start > 0 && end > 0) {
-            if (!GetAddressIndex(it->first, it->second, addressIndex, start, end)) {
-                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
-            }
-        } else {
-            if (!GetAddressIndex(it->first, it->second, addressIndex)) {
-                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
-            }
-        }
-    }
-
     UniValue deltas(UniValue::VARR);
 
-    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=addressIndex.begin(); it!=addressIndex.end(); it++) {
+    // The plain list of deltas is written out as it's read when the transport can take it
+    size_t nLimit = 0;
+    AddressQueryCursor cursor;
+    const bool fPaged = GetPagingFromParams(request.params, AddressQueryCursor::CURSOR_INDEX, nLimit, cursor);
+    JSONStreamWriter *stream = !fPaged && !(includeChainInfo && start > 0 && end > 0) ? request.stream : nullptr;
+
+    auto pushDelta = [&deltas, stream](const CAddressIndexKey &key, CAmount value) {
         std::string address;
-        if (!getAddressFromIndex(it->first.type, it->first.hashBytes, address)) {
+        if (!getAddressFromIndex(key.type, key.hashBytes, address)) {
             throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Unknown address type");
         }
 
         UniValue delta(UniValue::VOBJ);
-        delta.pushKV("satoshis", it->second);
-        delta.pushKV("txid", it->first.txhash.GetHex());
-        delta.pushKV("index", (int)it->first.index);
-        delta.pushKV("blockindex", (int)it->first.txindex);
-        delta.pushKV("height", it->first.blockHeight);
+        delta.pushKV("satoshis", value);
+        delta.pushKV("txid", key.txhash.GetHex());
+        delta.pushKV("index", (int)key.index);
+        delta.pushKV("blockindex", (int)key.txindex);
+        delta.pushKV("height", key.blockHeight);
         delta.pushKV("address", address);
-        deltas.push_back(delta);
+        if (stream) {
+            stream->Value(delta);
+        } else {
+            deltas.push_back(delta);
+        }
+    };
+
+    if (fPaged) {
+        PageAddressIndex(addresses, start, end, nLimit, cursor, [&pushDelta](const CAddressIndexKey &key, CAmount value) {
+            pushDelta(key, value);
+            return size_t{1};
+        });
+    } else {
+        std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
+
+        for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
+            if (start > 0 && end > 0) {
+                if (!GetAddressIndex(it->first, it->second, addressIndex, start, end)) {
+                    throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+                }
+            } else {
+                if (!GetAddressIndex(it->first, it->second, addressIndex)) {
+                    throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+                }
+            }
+        }
+
+        if (stream) {
+            stream->BeginArray();
+        }
+        for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=addressIndex.begin(); it!=addressIndex.end(); it++) {
+            pushDelta(it->first, it->second);
+        }
+        if (stream) {
+            stream->EndArray();
+            return NullUniValue;
+        }
     }
 
     UniValue result(UniValue::VOBJ);
 
+    if (fPaged) {
+        result.pushKV("deltas", deltas);
+        if (cursor.kind != 0) {
+            result.pushKV("cursor", EncodeCursor(cursor));
+        }
+        if (!includeChainInfo || start <= 0 || end <= 0) {
+            return result;
+        }
+    }
+
     if (includeChainInfo && start > 0 && end > 0) {
         LOCK(cs_main);
 
@@ -392,7 +585,9 @@ UniValue getaddressdeltas(const JSONRPCRequest& request)
         endInfo.pushKV("hash", endIndex->GetBlockHash().GetHex());
         endInfo.pushKV("height", end);
 
-        result.pushKV("deltas", deltas);
+        if (!fPaged) {
+            result.pushKV("deltas", deltas);
+        }
         result.pushKV("start", startInfo);
         result.pushKV("end", endInfo);
 
@@ -436,22 +631,33 @@ UniValue getaddressbalance(const JSONRPCRequest& request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address");
     }
 
-    std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
+    CAmount balance = 0;
+    CAmount received = 0;
 
-    for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
-        if (!GetAddressIndex(it->first, it->second, addressIndex)) {
-            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+    if (fAddressBalanceIndex) {
+        for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
+            CAddressBalanceValue value;
+            if (!GetAddressBalance(it->first, it->second, value)) {
+                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+            }
+            balance += value.balance;
+            received += value.received;
         }
-    }
+    } else {
+        std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
 
-    CAmount balance = 0;
-    CAmount received = 0;
+        for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
+            if (!GetAddressIndex(it->first, it->second, addressIndex)) {
+                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+            }
+        }
 
-    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=addressIndex.begin(); it!=addressIndex.end(); it++) {
-        if (it->second > 0) {
-            received += it->second;
+        for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=addressIndex.begin(); it!=addressIndex.end(); it++) {
+            if (it->second > 0) {
+                received += it->second;
+            }
+            balance += it->second;
         }
-        balance += it->second;
     }
 
     UniValue result(UniValue::VOBJ);
@@ -473,9 +679,11 @@ UniValue getaddresstxids(const JSONRPCRequest& request)
                     },
                     {"start", RPCArg::Type::NUM, /* default */ "0", "The start block height."},
                     {"end", RPCArg::Type::NUM, /* default */ "0", "The end block height."},
+                    {"limit", RPCArg::Type::NUM, /* default */ "unlimited", "Return at most limit txids, per address in turn, with a cursor to the next page."},
+                    {"cursor", RPCArg::Type::STR_HEX, /* default */ "", "The cursor returned with the previous page."},
                 },
                 RPCResult{
-                    RPCResult::Type::ARR, "", "", {
+                    RPCResult::Type::ARR, "", "With limit set, an object with the txids in \"txids\" and the \"cursor\" to the next page, if there is one", {
                         {RPCResult::Type::STR_HEX, "transactionid", "The transaction txid"},
                     }
                 },
@@ -507,6 +715,34 @@ UniValue getaddresstxids(const JSONRPCRequest& request)
         }
     }
 
+    size_t nLimit = 0;
+    AddressQueryCursor cursor;
+    if (GetPagingFromParams(request.params, AddressQueryCursor::CURSOR_INDEX, nLimit, cursor)) {
+        if (start <= 0 || end <= 0) {
+            start = end = 0;
+        }
+        UniValue txids(UniValue::VARR);
+        uint256 last_txhash;
+        int nLastHeight = -1;
+        PageAddressIndex(addresses, start, end, nLimit, cursor, [&](const CAddressIndexKey &key, CAmount value) {
+            // Entries of a tx are adjacent, as they share the height and txindex
+            if (key.blockHeight == nLastHeight && key.txhash == last_txhash) {
+                return size_t{0};
+            }
+            nLastHeight = key.blockHeight;
+            last_txhash = key.txhash;
+            txids.push_back(key.txhash.GetHex());
+            return size_t{1};
+        });
+
+        UniValue result(UniValue::VOBJ);
+        result.pushKV("txids", txids);
+        if (cursor.kind != 0) {
+            result.pushKV("cursor", EncodeCursor(cursor));
+        }
+        return result;
+    }
+
     std::vector<std::pair<CAddressIndexKey, CAmount> > addressIndex;
 
     for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
@@ -792,6 +1028,7 @@ static UniValue getblockhashes(const JSONRPCRequest& request)
                         {
                             {"noOrphans", RPCArg::Type::BOOL, /* default */ "false", "Only include blocks on the main chain."},
                             {"logicalTimes", RPCArg::Type::BOOL, /* default */ "false", "Include logical timestamps with hashes."},
+                            {"limit", RPCArg::Type::NUM, /* default */ "0", "Return at most limit hashes, 0 for no limit."},
                         },
                         "options"},
                 },
@@ -818,11 +1055,13 @@ static UniValue getblockhashes(const JSONRPCRequest& request)
     unsigned int low = request.params[1].get_int();
     bool fActiveOnly = false;
     bool fLogicalTS = false;
+    int limit = 0;
 
     if (request.params.size() > 2) {
         if (request.params[2].isObject()) {
             UniValue noOrphans = find_value(request.params[2].get_obj(), "noOrphans");
             UniValue returnLogical = find_value(request.params[2].get_obj(), "logicalTimes");
+            UniValue uvLimit = find_value(request.params[2].get_obj(), "limit");
 
             if (noOrphans.isBool()) {
                 fActiveOnly = noOrphans.get_bool();
@@ -830,29 +1069,28 @@ static UniValue getblockhashes(const JSONRPCRequest& request)
             if (returnLogical.isBool()) {
                 fLogicalTS = returnLogical.get_bool();
             }
-        }
-    }
-
-    std::vector<std::pair<uint256, unsigned int> > blockHashes;
-
-    {
-        LOCK(cs_main);
-        if (!GetTimestampIndex(high, low, fActiveOnly, blockHashes)) {
-            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for block hashes");
+            if (uvLimit.isNum()) {
+                limit = uvLimit.get_int();
+                if (limit < 0) {
+                    throw JSONRPCError(RPC_INVALID_PARAMETER, "limit must not be negative");
+                }
+            }
         }
     }
 
     UniValue result(UniValue::VARR);
 
-    for (std::vector<std::pair<uint256, unsigned int> >::const_iterator it=blockHashes.begin(); it!=blockHashes.end(); it++) {
-        if (fLogicalTS) {
-            UniValue item(UniValue::VOBJ);
-            item.pushKV("blockhash", it->first.GetHex());
-            item.pushKV("logicalts", (int)it->second);
-            result.push_back(item);
-        } else {
-            result.push_back(it->first.GetHex());
-        }
+    if (!GetTimestampIndex(high, low, fActiveOnly, limit, [&](const uint256 &hash, unsigned int logicalts) {
+            if (fLogicalTS) {
+                UniValue item(UniValue::VOBJ);
+                item.pushKV("blockhash", hash.GetHex());
+                item.pushKV("logicalts", (int)logicalts);
+                result.push_back(item);
+            } else {
+                result.push_back(hash.GetHex());
+            }
+        })) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for block hashes");
     }
 
     return result;
@@ -880,25 +1118,19 @@ UniValue gettxoutsetinfobyscript(const JSONRPCRequest& request)
 
     UniValue ret(UniValue::VOBJ);
 
-    int nHeight;
-    uint256 hashBlock;
-
-    std::unique_ptr<CCoinsViewCursor> pcursor;
-    {
-        LOCK(cs_main);
-        ::ChainstateActive().ForceFlushStateToDisk();
-        pcursor = std::unique_ptr<CCoinsViewCursor>(::ChainstateActive().CoinsDB().Cursor());
-        assert(pcursor);
-        hashBlock = pcursor->GetBestBlock();
-        nHeight = g_chainman.BlockIndex().find(hashBlock)->second->nHeight;
-    }
-
     class PerScriptTypeStats {
     public:
         int64_t nPlain = 0;
         int64_t nBlinded = 0;
         int64_t nPlainValue = 0;
 
+        void Add(const PerScriptTypeStats &other)
+        {
+            nPlain += other.nPlain;
+            nBlinded += other.nBlinded;
+            nPlainValue += other.nPlainValue;
+        }
+
         UniValue ToUV()
         {
             UniValue ret(UniValue::VOBJ);
@@ -909,26 +1141,32 @@ UniValue gettxoutsetinfobyscript(const JSONRPCRequest& request)
         }
     };
 
-    PerScriptTypeStats statsPKH;
-    PerScriptTypeStats statsSH;
-    PerScriptTypeStats statsCSPKH;
-    PerScriptTypeStats statsCSSH;
-    PerScriptTypeStats statsOther;
-
-    while (pcursor->Valid()) {
-        if (ShutdownRequested()) return false;
-        COutPoint key;
-        Coin coin;
-        if (pcursor->GetKey(key) && pcursor->GetValue(coin)) {
-            PerScriptTypeStats *ps = &statsOther;
+    enum {STATS_PKH, STATS_SH, STATS_CSPKH, STATS_CSSH, STATS_OTHER, STATS_MAX};
+    using RangeStats = std::array<PerScriptTypeStats, STATS_MAX>;
+
+    int nHeight;
+    uint256 hashBlock;
+    CCoinsViewDB *coins_db;
+    {
+        LOCK(cs_main);
+        ::ChainstateActive().ForceFlushStateToDisk();
+        coins_db = &::ChainstateActive().CoinsDB();
+    }
+
+    // Walk the UTXO set in ranges on the -utxoscanthreads pool, each range keeps its own totals
+    const int n_threads = GetUTXOScanThreads();
+    std::vector<RangeStats> range_stats(n_threads * 16);
+    if (!coins_db->ForEachCoinParallel(range_stats.size(), n_threads, [&range_stats](size_t range, const COutPoint&, const Coin &coin) {
+            RangeStats &stats = range_stats[range];
+            PerScriptTypeStats *ps = &stats[STATS_OTHER];
             if (coin.out.scriptPubKey.IsPayToPublicKeyHash()) {
-                ps = &statsPKH;
+                ps = &stats[STATS_PKH];
             } else if (coin.out.scriptPubKey.IsPayToScriptHash()) {
-                ps = &statsSH;
+                ps = &stats[STATS_SH];
             } else if (coin.out.scriptPubKey.IsPayToPublicKeyHash256_CS()) {
-                ps = &statsCSPKH;
+                ps = &stats[STATS_CSPKH];
             } else if (coin.out.scriptPubKey.IsPayToScriptHash256_CS() || coin.out.scriptPubKey.IsPayToScriptHash_CS()) {
-                ps = &statsCSSH;
+                ps = &stats[STATS_CSSH];
             }
 
             if (coin.nType == OUTPUT_STANDARD) {
@@ -938,11 +1176,29 @@ UniValue gettxoutsetinfobyscript(const JSONRPCRequest& request)
             if (coin.nType == OUTPUT_CT) {
                 ps->nBlinded++;
             }
-        } else {
-            throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to read UTXO set");
+            return true;
+        }, {}, hashBlock)) {
+        if (ShutdownRequested()) {
+            return false;
         }
-        pcursor->Next();
+        throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to read UTXO set");
     }
+    {
+        LOCK(cs_main);
+        nHeight = g_chainman.BlockIndex().find(hashBlock)->second->nHeight;
+    }
+
+    RangeStats stats;
+    for (const auto &range : range_stats) {
+        for (size_t i = 0; i < STATS_MAX; ++i) {
+            stats[i].Add(range[i]);
+        }
+    }
+    PerScriptTypeStats &statsPKH = stats[STATS_PKH];
+    PerScriptTypeStats &statsSH = stats[STATS_SH];
+    PerScriptTypeStats &statsCSPKH = stats[STATS_CSPKH];
+    PerScriptTypeStats &statsCSSH = stats[STATS_CSSH];
+    PerScriptTypeStats &statsOther = stats[STATS_OTHER];
 
     ret.pushKV("height", (int64_t)nHeight);
     ret.pushKV("bestblock", hashBlock.GetHex());
@@ -983,120 +1239,23 @@ static void pushScript(UniValue &uv, const std::string &name, const CScript *scr
     uv.pushKV(name, uvs);
 }
 
-UniValue getblockreward(const JSONRPCRequest& request)
+/** Summarise the block at pindex without the reward index, resolving the coinstake's inputs through the txindex */
+static void ReadBlockRewardSummary(NodeContext &node, const CBlockIndex *pindex, BlockRewardSummary &summary)
 {
-            RPCHelpMan{"getblockreward",
-                "\nReturns the blockreward for block at height.\n",
-                {
-                    {"height", RPCArg::Type::NUM, RPCArg::Optional::NO, "The chain height of the block."},
-                },
-                RPCResult{
-                    RPCResult::Type::OBJ, "", "", {
-                        {RPCResult::Type::STR_HEX, "blockhash", "The hash of the block"},
-                        {RPCResult::Type::STR_HEX, "coinstake", "The hash of the coinstake transaction"},
-                        {RPCResult::Type::NUM_TIME, "blocktime", "The block time expressed in " _UNIX_EPOCH_TIME},
-                        {RPCResult::Type::STR_AMOUNT, "stakereward", "The stake reward portion, newly minted coin"},
-                        {RPCResult::Type::STR_AMOUNT, "blockreward", "The block reward, value paid to staker, including fees"},
-                        {RPCResult::Type::STR_AMOUNT, "treasuryreward", "The accumulated treasury reward payout, if any"},
-                        {RPCResult::Type::STR_AMOUNT, "gvrreward", "The accumulated GVR reward payout, if any"},
-                        {RPCResult::Type::OBJ, "kernelscript", "", {
-                            {RPCResult::Type::STR_HEX, "hex", "The script from the kernel output"},
-                            {RPCResult::Type::STR, "stakeaddr", "The stake address, if output script is coldstake"},
-                            {RPCResult::Type::STR, "spendaddr", "The spend address"},
-                        }},
-                        {RPCResult::Type::ARR, "", "", {
-                            {RPCResult::Type::OBJ, "script", "", {
-                                {RPCResult::Type::STR_HEX, "hex", "The script from the kernel output"},
-                                {RPCResult::Type::STR, "stakeaddr", "The stake address, if output script is coldstake"},
-                                {RPCResult::Type::STR, "spendaddr", "The spend address"},
-                            }},
-                            {RPCResult::Type::STR_AMOUNT, "value", "The value of the output"},
-                        }}
-                    }
-                },
-                RPCExamples{
-            HelpExampleCli("getblockreward", "1000") +
-            "\nAs a JSON-RPC call\n"
-            + HelpExampleRpc("getblockreward", "1000")
-                },
-        }.Check(request);
-
-    RPCTypeCheck(request.params, {UniValue::VNUM});
-
-    NodeContext& node = EnsureNodeContext(request.context);
     if (!g_txindex) {
-        throw JSONRPCError(RPC_MISC_ERROR, "Requires -txindex enabled");
-    }
-
-    int nHeight = request.params[0].get_int();
-    if (nHeight < 0 || nHeight > ::ChainActive().Height()) {
-        throw JSONRPCError(RPC_INVALID_PARAMETER, "Block height out of range");
-    }
-
-    LOCK(cs_main);
-
-    CBlockIndex *pblockindex = ::ChainActive()[nHeight];
-
-    bool gvrActivationHeight = nHeight >= ::Params().GetConsensus().automatedGvrActivationHeight;
-    CAmount stake_reward = 0;
-    if (pblockindex->pprev) {
-        stake_reward = Params().GetProofOfStakeReward(pblockindex->pprev, 0);
+        throw JSONRPCError(RPC_MISC_ERROR, "Requires -rewardindex or -txindex enabled");
     }
 
     CBlock block;
-    if (!ReadBlockFromDisk(block, pblockindex, Params().GetConsensus())) {
+    if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
         throw JSONRPCError(RPC_MISC_ERROR, "Block not found on disk");
     }
-
-    const TreasuryFundSettings* fundconf = Params().GetTreasuryFundSettings(pblockindex->nHeight);
-    CScript fundScriptPubKey;
-    if (fundconf) {
-        CTxDestination dest = DecodeDestination(fundconf->sTreasuryFundAddresses);
-        fundScriptPubKey = GetScriptForDestination(dest);
-    }
-
     const auto &tx = block.vtx[0];
 
-    UniValue outputs(UniValue::VARR);
-    CAmount value_out = 0, value_in = 0, value_treasury = 0;
-
-    bool gvrOutExists = false;
-    bool devFundExists = !fundconf? false : (pblockindex->nHeight % fundconf->nTreasuryOutputPeriod) == 0;
-    CAmount gvrAmount = 0;
-    int numDataOutput = 0;
-
-    for (const auto &txout : tx->vpout) {
-
-        if (gvrActivationHeight) {
-            if (txout->IsType(OutputTypes::OUTPUT_DATA)) {
-                if (numDataOutput == 0 && !txout->GetGvrFundCfwd(gvrAmount)) {
-                    gvrOutExists = true;
-                }
-                numDataOutput++;
-            }
-        }
-
-        if (!txout->IsStandardOutput()) {
-            continue;
-        }
-
-        UniValue output(UniValue::VOBJ);
-        pushScript(output, "script", txout->GetPScriptPubKey());
-        output.pushKV("value", ValueFromAmount(txout->GetValue()));
-        outputs.push_back(output);
-
-        if (!gvrActivationHeight && fundconf && *txout->GetPScriptPubKey() == fundScriptPubKey && value_treasury == 0) {
-            value_treasury = txout->GetValue();
-            continue;
-        }
-
-        value_out += txout->GetValue();
-    }
-
     CScript kernel_script;
-    int n = -1;
-    for (const auto& txin : tx->vin) {
-        n++;
+    CAmount value_in = 0, kernel_value = 0;
+    for (size_t n = 0; n < tx->vin.size() && !tx->IsCoinBase(); ++n) {
+        const CTxIn &txin = tx->vin[n];
         if (txin.IsAnonInput()) {
             continue;
         }
@@ -1107,61 +1266,203 @@ UniValue getblockreward(const JSONRPCRequest& request)
         if (!tx_prev) {
             throw JSONRPCError(RPC_MISC_ERROR, "Transaction not found on disk");
         }
-        if (txin.prevout.n > tx_prev->GetNumVOuts()) {
+        if (txin.prevout.n >= tx_prev->GetNumVOuts()) {
             throw JSONRPCError(RPC_MISC_ERROR, "prevout not found on disk");
         }
-        value_in += tx_prev->vpout[txin.prevout.n]->GetValue();
+        const CTxOutBase *prevout = tx_prev->vpout[txin.prevout.n].get();
+        value_in += prevout->GetValue();
         if (n == 0) {
-            kernel_script = *tx_prev->vpout[txin.prevout.n]->GetPScriptPubKey();
+            kernel_value = prevout->GetValue();
+            kernel_script = *prevout->GetPScriptPubKey();
         }
     }
 
-    CAmount block_reward = value_out - value_in;
-    short gvrIndex = 1;
-
-    if (gvrActivationHeight) {
-        if (gvrOutExists && !devFundExists) {
-            block_reward -= tx->vpout[1]->GetValue();
-            gvrIndex = 1;
-        }
-
-        if (gvrOutExists && devFundExists) {
-            block_reward -= tx->vpout[2]->GetValue();
-            gvrIndex = 2;
-        }
+    BuildBlockRewardSummary(*tx, pindex, value_in, kernel_value, kernel_script, summary);
+}
 
-        if (devFundExists) {
-            block_reward -= tx->vpout[1]->GetValue();
-            value_treasury = tx->vpout[1]->GetValue();
-        }
+static void GetBlockRewardSummary(NodeContext &node, const CBlockIndex *pindex, BlockRewardSummary &summary)
+{
+    // The genesis block has no record
+    if (!GetBlockReward(pindex->GetBlockHash(), summary)) {
+        ReadBlockRewardSummary(node, pindex, summary);
     }
+}
 
+static UniValue BlockRewardToJSON(const BlockRewardSummary &summary, const CBlockIndex *pindex)
+{
     UniValue rv(UniValue::VOBJ);
-    rv.pushKV("blockhash", pblockindex->GetBlockHash().ToString());
-    if (tx->IsCoinStake()) {
-        rv.pushKV("coinstake", tx->GetHash().ToString());
+    rv.pushKV("blockhash", pindex->GetBlockHash().ToString());
+    if (!summary.coinstake.IsNull()) {
+        rv.pushKV("coinstake", summary.coinstake.ToString());
     }
 
-    rv.pushKV("blocktime", pblockindex->GetBlockTime());
-    rv.pushKV("stakereward", ValueFromAmount(stake_reward));
-    rv.pushKV("blockreward", ValueFromAmount(block_reward));
+    rv.pushKV("blocktime", pindex->GetBlockTime());
+    rv.pushKV("stakereward", ValueFromAmount(summary.stake_reward));
+    rv.pushKV("blockreward", ValueFromAmount(summary.block_reward));
 
-    if (devFundExists) {
-        rv.pushKV("treasuryreward", ValueFromAmount(value_treasury));
+    if (summary.flags & BlockRewardSummary::HAVE_TREASURY) {
+        rv.pushKV("treasuryreward", ValueFromAmount(summary.treasury_reward));
+    }
+    if (summary.flags & BlockRewardSummary::HAVE_GVR) {
+        rv.pushKV("gvrreward", ValueFromAmount(summary.gvr_reward));
+    }
+    if (summary.flags & BlockRewardSummary::HAVE_FEES) {
+        rv.pushKV("fees", ValueFromAmount(summary.fees));
     }
 
-    if (gvrOutExists) {
-        rv.pushKV("gvrreward", ValueFromAmount(tx->vpout[gvrIndex]->GetValue()));
+    if (!summary.coinstake.IsNull()) {
+        pushScript(rv, "kernelscript", &summary.kernel_script);
+        rv.pushKV("kernelvalue", ValueFromAmount(summary.kernel_value));
     }
 
-    if (tx->IsCoinStake()) {
-        pushScript(rv, "kernelscript", &kernel_script);
+    UniValue outputs(UniValue::VARR);
+    for (const auto &out : summary.outputs) {
+        UniValue output(UniValue::VOBJ);
+        pushScript(output, "script", &out.first);
+        output.pushKV("value", ValueFromAmount(out.second));
+        outputs.push_back(output);
     }
     rv.pushKV("outputs", outputs);
 
     return rv;
 }
 
+static std::vector<RPCResult> BlockRewardResultFields(bool with_height)
+{
+    std::vector<RPCResult> fields;
+    if (with_height) {
+        fields.push_back({RPCResult::Type::NUM, "height", "The chain height of the block"});
+    }
+    for (auto &field : std::vector<RPCResult>{
+        {RPCResult::Type::STR_HEX, "blockhash", "The hash of the block"},
+        {RPCResult::Type::STR_HEX, "coinstake", "The hash of the coinstake transaction"},
+        {RPCResult::Type::NUM_TIME, "blocktime", "The block time expressed in " _UNIX_EPOCH_TIME},
+        {RPCResult::Type::STR_AMOUNT, "stakereward", "The stake reward portion, newly minted coin"},
+        {RPCResult::Type::STR_AMOUNT, "blockreward", "The block reward, value paid to staker, including fees"},
+        {RPCResult::Type::STR_AMOUNT, "treasuryreward", "The accumulated treasury reward payout, if any"},
+        {RPCResult::Type::STR_AMOUNT, "gvrreward", "The accumulated GVR reward payout, if any"},
+        {RPCResult::Type::STR_AMOUNT, "fees", /* optional */ true, "The fees of the block's transactions, with -rewardindex"},
+        {RPCResult::Type::OBJ, "kernelscript", "", {
+            {RPCResult::Type::STR_HEX, "hex", "The script from the kernel output"},
+            {RPCResult::Type::STR, "stakeaddr", "The stake address, if output script is coldstake"},
+            {RPCResult::Type::STR, "spendaddr", "The spend address"},
+        }},
+        {RPCResult::Type::STR_AMOUNT, "kernelvalue", "The value of the kernel output"},
+        {RPCResult::Type::ARR, "outputs", "", {
+            {RPCResult::Type::OBJ, "", "", {
+                {RPCResult::Type::OBJ, "script", "", {
+                    {RPCResult::Type::STR_HEX, "hex", "The script of the output"},
+                    {RPCResult::Type::STR, "stakeaddr", "The stake address, if output script is coldstake"},
+                    {RPCResult::Type::STR, "spendaddr", "The spend address"},
+                }},
+                {RPCResult::Type::STR_AMOUNT, "value", "The value of the output"},
+            }},
+        }},
+    }) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+UniValue getblockreward(const JSONRPCRequest& request)
+{
+            RPCHelpMan{"getblockreward",
+                "\nReturns the blockreward for block at height.\n"
+                "Served from the reward index with -rewardindex, otherwise the coinstake's inputs are looked up through the txindex.\n",
+                {
+                    {"height", RPCArg::Type::NUM, RPCArg::Optional::NO, "The chain height of the block."},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "", BlockRewardResultFields(false)
+                },
+                RPCExamples{
+            HelpExampleCli("getblockreward", "1000") +
+            "\nAs a JSON-RPC call\n"
+            + HelpExampleRpc("getblockreward", "1000")
+                },
+        }.Check(request);
+
+    RPCTypeCheck(request.params, {UniValue::VNUM});
+
+    NodeContext& node = EnsureNodeContext(request.context);
+    if (!fRewardIndex && !g_txindex) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Requires -rewardindex or -txindex enabled");
+    }
+
+    int nHeight = request.params[0].get_int();
+    const CBlockIndex *pblockindex;
+    {
+        LOCK(cs_main);
+        if (nHeight < 0 || nHeight > ::ChainActive().Height()) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Block height out of range");
+        }
+        pblockindex = ::ChainActive()[nHeight];
+    }
+
+    BlockRewardSummary summary;
+    GetBlockRewardSummary(node, pblockindex, summary);
+    return BlockRewardToJSON(summary, pblockindex);
+}
+
+UniValue getblockrewards(const JSONRPCRequest& request)
+{
+            RPCHelpMan{"getblockrewards",
+                "\nReturns the blockreward of each block between two heights, as getblockreward.\n"
+                "Served from the reward index with -rewardindex, otherwise the coinstake's inputs are looked up through the txindex.\n",
+                {
+                    {"start", RPCArg::Type::NUM, RPCArg::Optional::NO, "The first height"},
+                    {"end", RPCArg::Type::NUM, /* default */ "chain tip", "The last height"},
+                },
+                RPCResult{
+                    RPCResult::Type::ARR, "", "", {
+                        {RPCResult::Type::OBJ, "", "", BlockRewardResultFields(true)},
+                    }
+                },
+                RPCExamples{
+            HelpExampleCli("getblockrewards", "1000 2000") +
+            "\nAs a JSON-RPC call\n"
+            + HelpExampleRpc("getblockrewards", "1000, 2000")
+                },
+        }.Check(request);
+
+    RPCTypeCheck(request.params, {UniValue::VNUM, UniValue::VNUM}, true);
+
+    NodeContext& node = EnsureNodeContext(request.context);
+    if (!fRewardIndex && !g_txindex) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Requires -rewardindex or -txindex enabled");
+    }
+
+    const int start = request.params[0].get_int();
+    std::vector<const CBlockIndex*> blocks;
+    {
+        LOCK(cs_main);
+        const int tip_height = ::ChainActive().Height();
+        const int end = request.params[1].isNull() ? tip_height : request.params[1].get_int();
+        if (start < 0 || start > tip_height || end < start || end > tip_height) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Block heights out of range");
+        }
+        blocks.reserve(end - start + 1);
+        for (int height = start; height <= end; ++height) {
+            blocks.push_back(::ChainActive()[height]);
+        }
+    }
+
+    UniValue rv(UniValue::VARR);
+    for (const CBlockIndex *pindex : blocks) {
+        if (ShutdownRequested()) {
+            throw JSONRPCError(RPC_MISC_ERROR, "Shutting down");
+        }
+        BlockRewardSummary summary;
+        GetBlockRewardSummary(node, pindex, summary);
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("height", pindex->nHeight);
+        entry.pushKVs(BlockRewardToJSON(summary, pindex));
+        rv.push_back(entry);
+    }
+
+    return rv;
+}
+
 UniValue getblockbalances(const JSONRPCRequest& request)
 {
     RPCHelpMan{"getblockbalances",
@@ -1217,6 +1518,148 @@ UniValue getblockbalances(const JSONRPCRequest& request)
     return rv;
 }
 
+UniValue getblockbalancesrange(const JSONRPCRequest& request)
+{
+    RPCHelpMan{"getblockbalancesrange",
+        "\nReturns the block balances between two heights as a series, one point per step blocks.\n"
+        "The balances index keeps the running totals per block, each point is the totals at the last block of its step\n"
+        "and the change since the last block of the previous step.\n",
+        {
+            {"start", RPCArg::Type::NUM, RPCArg::Optional::NO, "The first height"},
+            {"end", RPCArg::Type::NUM, /* default */ "chain tip", "The last height"},
+            {"options", RPCArg::Type::OBJ, /* default */ "", "",
+                {
+                    {"step", RPCArg::Type::NUM, /* default */ "1", "Number of blocks per point"},
+                    {"in_sats", RPCArg::Type::BOOL, /* default */ "false", "Display values in satoshis"},
+                },
+                "options"},
+        },
+        RPCResult{
+            RPCResult::Type::ARR, "", "", {
+                {RPCResult::Type::OBJ, "", "", {
+                    {RPCResult::Type::NUM, "height", "The last height of the step"},
+                    {RPCResult::Type::STR_HEX, "blockhash", "The hash of the block at height"},
+                    {RPCResult::Type::STR_AMOUNT, "plain", "The plain balance at height"},
+                    {RPCResult::Type::STR_AMOUNT, "blind", "The blind balance at height"},
+                    {RPCResult::Type::STR_AMOUNT, "anon", "The anon balance at height"},
+                    {RPCResult::Type::STR_AMOUNT, "plain_change", "The change in plain balance over the step"},
+                    {RPCResult::Type::STR_AMOUNT, "blind_change", "The change in blind balance over the step"},
+                    {RPCResult::Type::STR_AMOUNT, "anon_change", "The change in anon balance over the step"},
+                }},
+            }
+        },
+        RPCExamples{
+        HelpExampleCli("getblockbalancesrange", "0 10000 '{\"step\":1000}'") +
+        "\nAs a JSON-RPC call\n"
+        + HelpExampleRpc("getblockbalancesrange", "0, 10000, {\"step\":1000}")
+        },
+    }.Check(request);
+
+    RPCTypeCheck(request.params, {UniValue::VNUM, UniValue::VNUM, UniValue::VOBJ}, true);
+
+    if (!fBalancesIndex) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Balances index is not enabled.");
+    }
+
+    int step = 1;
+    bool in_sats = false;
+    if (request.params[2].isObject()) {
+        const UniValue &options = request.params[2];
+        RPCTypeCheckObj(options,
+            {
+                {"step", UniValueType(UniValue::VNUM)},
+                {"in_sats", UniValueType(UniValue::VBOOL)},
+            },
+            true, true);
+        if (options["step"].isNum()) {
+            step = options["step"].get_int();
+        }
+        if (options["in_sats"].isBool()) {
+            in_sats = options["in_sats"].get_bool();
+        }
+    }
+    if (step < 1) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "step must be positive");
+    }
+
+    // Collect the block hashes of the step ends, and of the block before the range for the first change
+    int start = request.params[0].get_int();
+    std::vector<std::pair<int, uint256> > points;
+    uint256 hash_before;
+    {
+        LOCK(cs_main);
+        const int tip_height = ::ChainActive().Height();
+        int end = request.params[1].isNull() ? tip_height : request.params[1].get_int();
+        if (start < 0 || start > tip_height || end < start || end > tip_height) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Block heights out of range");
+        }
+        if (start > 0) {
+            hash_before = ::ChainActive()[start - 1]->GetBlockHash();
+        }
+        for (int height = std::min(end, start + step - 1); height <= end; height += step) {
+            points.emplace_back(height, ::ChainActive()[height]->GetBlockHash());
+            if (height < end && height + step > end) {
+                height = end - step;
+            }
+        }
+    }
+
+    BlockBalances prev;
+    if (!hash_before.IsNull() && !GetBlockBalances(hash_before, prev)) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Unable to get balances info");
+    }
+
+    UniValue rv(UniValue::VARR);
+    for (const auto &point : points) {
+        BlockBalances balances;
+        if (!GetBlockBalances(point.second, balances)) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Unable to get balances info");
+        }
+        UniValue uv(UniValue::VOBJ);
+        uv.pushKV("height", point.first);
+        uv.pushKV("blockhash", point.second.GetHex());
+        uv.pushKV("plain", in_sats ? balances.plain() : ValueFromAmount(balances.plain()));
+        uv.pushKV("blind", in_sats ? balances.blind() : ValueFromAmount(balances.blind()));
+        uv.pushKV("anon",  in_sats ? balances.anon()  : ValueFromAmount(balances.anon()));
+        const CAmount plain_change = balances.plain() - prev.plain();
+        const CAmount blind_change = balances.blind() - prev.blind();
+        const CAmount anon_change = balances.anon() - prev.anon();
+        uv.pushKV("plain_change", in_sats ? plain_change : ValueFromAmount(plain_change));
+        uv.pushKV("blind_change", in_sats ? blind_change : ValueFromAmount(blind_change));
+        uv.pushKV("anon_change",  in_sats ? anon_change  : ValueFromAmount(anon_change));
+        rv.push_back(uv);
+        prev = balances;
+    }
+
+    return rv;
+}
+
+static std::string CSIndexSpendAddress(TxoutType spend_type, const CKeyID256 &spend_id)
+{
+    switch (spend_type) {
+        case TxoutType::PUBKEYHASH: {
+            PKHash idk;
+            memcpy(idk.begin(), spend_id.begin(), 20);
+            return EncodeDestination(idk);
+            }
+        case TxoutType::PUBKEYHASH256:
+            return EncodeDestination(spend_id);
+        case TxoutType::SCRIPTHASH: {
+            ScriptHash ids;
+            memcpy(ids.begin(), spend_id.begin(), 20);
+            return EncodeDestination(ids);
+            }
+        case TxoutType::SCRIPTHASH256: {
+            CScriptID256 ids;
+            memcpy(ids.begin(), spend_id.begin(), 32);
+            return EncodeDestination(ids);
+            }
+        default:
+            break;
+    }
+    return "unknown_type";
+}
+
 UniValue listcoldstakeunspent(const JSONRPCRequest& request)
 {
             RPCHelpMan{"listcoldstakeunspent",
@@ -1229,17 +1672,25 @@ UniValue listcoldstakeunspent(const JSONRPCRequest& request)
                             {"mature_only", RPCArg::Type::BOOL, /* default */ "false", "Return only outputs stakeable at height."},
                             {"all_staked", RPCArg::Type::BOOL, /* default */ "false", "Ignore maturity check for outputs of coinstake transactions."},
                             {"show_outpoints", RPCArg::Type::BOOL, /* default */ "false", "Display txid and index per output."},
+                            {"by_spend_address", RPCArg::Type::BOOL, /* default */ "false", "Return the total value and number of outputs per spending address instead of the outputs."},
                         },
                         "options"},
                 },
-                RPCResult{
-                    RPCResult::Type::ARR, "", "", {
+                RPCResults{
+                    {"Default", RPCResult::Type::ARR, "", "", {
                         {RPCResult::Type::OBJ, "", "", {
                             {RPCResult::Type::NUM, "height", "The height the output was staked into the chain"},
                             {RPCResult::Type::STR_AMOUNT, "value", "The value of the output"},
                             {RPCResult::Type::STR, "addrspend", "The spending address of the output"},
                         }}
-                    }
+                    }},
+                    {"With by_spend_address", RPCResult::Type::ARR, "", "", {
+                        {RPCResult::Type::OBJ, "", "", {
+                            {RPCResult::Type::STR, "addrspend", "The spending address"},
+                            {RPCResult::Type::STR_AMOUNT, "value", "The total value of the outputs"},
+                            {RPCResult::Type::NUM, "num_outputs", "The number of outputs"},
+                        }}
+                    }},
                 },
                 RPCExamples{
             HelpExampleCli("listcoldstakeunspent", "\"Pb7FLL3DyaAVP2eGfRiEkj4U8ZJ3RHLY9g\" 1000") +
@@ -1283,6 +1734,7 @@ UniValue listcoldstakeunspent(const JSONRPCRequest& request)
     bool mature_only = false;
     bool all_staked = false;
     bool show_outpoints = false;
+    bool by_spend_address = false;
     if (request.params[2].isObject()) {
         const UniValue &options = request.params[2];
         RPCTypeCheckObj(options,
@@ -1290,6 +1742,7 @@ UniValue listcoldstakeunspent(const JSONRPCRequest& request)
                 {"mature_only", UniValueType(UniValue::VBOOL)},
                 {"all_staked", UniValueType(UniValue::VBOOL)},
                 {"show_outpoints", UniValueType(UniValue::VBOOL)},
+                {"by_spend_address", UniValueType(UniValue::VBOOL)},
             },
             true, true);
         if (options["mature_only"].isBool()) {
@@ -1301,82 +1754,110 @@ UniValue listcoldstakeunspent(const JSONRPCRequest& request)
         if (options["show_outpoints"].isBool()) {
             show_outpoints = options["show_outpoints"].get_bool();
         }
+        if (options["by_spend_address"].isBool()) {
+            by_spend_address = options["by_spend_address"].get_bool();
+        }
     }
 
     UniValue rv(UniValue::VARR);
-
-    std::unique_ptr<CDBIterator> it(db.NewIterator());
-    it->Seek(std::make_pair(DB_TXINDEX_CSLINK, seek_key));
+    std::map<std::pair<TxoutType, CKeyID256>, std::pair<CAmount, int64_t> > spend_totals;
 
     int min_kernel_depth = Params().GetStakeMinConfirmations();
-    std::pair<char, ColdStakeIndexLinkKey> key;
-    while (it->Valid() && it->StartsWith(DB_TXINDEX_CSLINK) && it->GetKey(key)) {
-        ColdStakeIndexLinkKey &lk = key.second;
+    auto add_output = [&](unsigned int output_height, const ColdStakeIndexOutputKey &ok, CAmount value, uint8_t flags, TxoutType spend_type, const CKeyID256 &spend_id) {
+        if (mature_only
+            && (!all_staked || !(flags & CSI_FROM_STAKE))) {
+            int depth = height - output_height;
+            int depth_required = std::min(min_kernel_depth-1, (int)(height / 2));
+            if (depth < depth_required) {
+                return;
+            }
+        }
 
-        if (key.first != DB_TXINDEX_CSLINK
-            || lk.m_stake_id != seek_key.m_stake_id
-            || (int)lk.m_height > height)
-            break;
+        if (by_spend_address) {
+            auto &totals = spend_totals[std::make_pair(spend_type, spend_id)];
+            totals.first += value;
+            totals.second++;
+            return;
+        }
 
-        std::vector <ColdStakeIndexOutputKey> oks;
-        ColdStakeIndexOutputValue ov;
         UniValue output(UniValue::VOBJ);
+        output.pushKV("height", (int)output_height);
+        output.pushKV("value", value);
 
-        if (it->GetValue(oks)) {
-            for (const auto &ok : oks) {
-                if (db.Read(std::make_pair(DB_TXINDEX_CSOUTPUT, ok), ov)
-                    && (ov.m_spend_height == -1 || ov.m_spend_height > height)) {
-
-                    if (mature_only
-                        && (!all_staked || !(ov.m_flags & CSI_FROM_STAKE))) {
-                        int depth = height - lk.m_height;
-                        int depth_required = std::min(min_kernel_depth-1, (int)(height / 2));
-                        if (depth < depth_required) {
-                            continue;
-                        }
-                    }
-
-                    UniValue output(UniValue::VOBJ);
-                    output.pushKV("height", (int)lk.m_height);
-                    output.pushKV("value", ov.m_value);
+        if (show_outpoints) {
+            output.pushKV("txid", ok.m_txnid.ToString());
+            output.pushKV("n", ok.m_n);
+        }
 
-                    if (show_outpoints) {
-                        output.pushKV("txid", ok.m_txnid.ToString());
-                        output.pushKV("n", ok.m_n);
-                    }
+        output.pushKV("addrspend", CSIndexSpendAddress(spend_type, spend_id));
+        rv.push_back(output);
+    };
 
-                    switch (lk.m_spend_type) {
-                        case TxoutType::PUBKEYHASH: {
-                            PKHash idk;
-                            memcpy(idk.begin(), lk.m_spend_id.begin(), 20);
-                            output.pushKV("addrspend", EncodeDestination(idk));
-                            }
-                            break;
-                        case TxoutType::PUBKEYHASH256:
-                            output.pushKV("addrspend", EncodeDestination(lk.m_spend_id));
-                            break;
-                        case TxoutType::SCRIPTHASH: {
-                            ScriptHash ids;
-                            memcpy(ids.begin(), lk.m_spend_id.begin(), 20);
-                            output.pushKV("addrspend", EncodeDestination(ids));
-                            }
-                            break;
-                        case TxoutType::SCRIPTHASH256: {
-                            CScriptID256 ids;
-                            memcpy(ids.begin(), lk.m_spend_id.begin(), 32);
-                            output.pushKV("addrspend", EncodeDestination(ids));
-                            }
-                            break;
-                        default:
-                            output.pushKV("addrspend", "unknown_type");
-                            break;
+    // At or above the csindex tip the unspent outputs can be listed directly when the index has them
+    bool fHaveUnspent = false;
+    CBlockLocator locator;
+    if (db.Read(DB_TXINDEX_CSBESTBLOCK, locator) && !locator.IsNull()) {
+        const CBlockIndex *best_cs_block_index = LookupBlockIndex(locator.vHave[0]);
+        bool fComplete = false;
+        fHaveUnspent = best_cs_block_index && height >= best_cs_block_index->nHeight
+                       && db.Read(DB_TXINDEX_CSUNSPENT_FLAG, fComplete) && fComplete;
+    }
+
+    if (fHaveUnspent) {
+        ColdStakeIndexStakeKey stake_key;
+        stake_key.m_stake_type = seek_key.m_stake_type;
+        stake_key.m_stake_id = seek_key.m_stake_id;
+
+        std::unique_ptr<CDBIterator> it(db.NewIterator());
+        it->Seek(std::make_pair(DB_TXINDEX_CSUNSPENT, stake_key));
+        std::pair<char, ColdStakeIndexUnspentKey> key;
+        for (; it->Valid() && it->GetKey(key); it->Next()) {
+            const ColdStakeIndexUnspentKey &uk = key.second;
+            if (key.first != DB_TXINDEX_CSUNSPENT
+                || uk.m_stake_type != seek_key.m_stake_type
+                || uk.m_stake_id != seek_key.m_stake_id) {
+                break;
+            }
+            ColdStakeIndexUnspentValue uv;
+            if (!it->GetValue(uv)) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to read coldstake index");
+            }
+            add_output(uk.m_height, uk.m_output, uv.m_value, uv.m_flags, uk.m_spend_type, uk.m_spend_id);
+        }
+    } else {
+        std::unique_ptr<CDBIterator> it(db.NewIterator());
+        it->Seek(std::make_pair(DB_TXINDEX_CSLINK, seek_key));
+
+        std::pair<char, ColdStakeIndexLinkKey> key;
+        while (it->Valid() && it->StartsWith(DB_TXINDEX_CSLINK) && it->GetKey(key)) {
+            ColdStakeIndexLinkKey &lk = key.second;
+
+            if (key.first != DB_TXINDEX_CSLINK
+                || lk.m_stake_id != seek_key.m_stake_id
+                || (int)lk.m_height > height)
+                break;
+
+            std::vector <ColdStakeIndexOutputKey> oks;
+            ColdStakeIndexOutputValue ov;
+
+            if (it->GetValue(oks)) {
+                for (const auto &ok : oks) {
+                    if (db.Read(std::make_pair(DB_TXINDEX_CSOUTPUT, ok), ov)
+                        && (ov.m_spend_height == -1 || ov.m_spend_height > height)) {
+                        add_output(lk.m_height, ok, ov.m_value, ov.m_flags, lk.m_spend_type, lk.m_spend_id);
                     }
-
-                    rv.push_back(output);
                 }
             }
+            it->Next();
         }
-        it->Next();
+    }
+
+    for (const auto &it : spend_totals) {
+        UniValue output(UniValue::VOBJ);
+        output.pushKV("addrspend", CSIndexSpendAddress(it.first.first, it.first.second));
+        output.pushKV("value", it.second.first);
+        output.pushKV("num_outputs", it.second.second);
+        rv.push_back(output);
     }
 
     return rv;
@@ -1392,9 +1873,28 @@ UniValue getinsightinfo(const JSONRPCRequest& request)
                 RPCResult::Type::OBJ, "", "", {
                     {RPCResult::Type::BOOL, "txindex", "True if txindex is enabled"},
                     {RPCResult::Type::BOOL, "addressindex", "True if addressindex is enabled"},
+                    {RPCResult::Type::BOOL, "compactaddressindex", "True if the address index is stored in the compact encoding"},
                     {RPCResult::Type::BOOL, "spentindex", "True if spentindex is enabled"},
                     {RPCResult::Type::BOOL, "timestampindex", "True if timestampindex is enabled"},
+                    {RPCResult::Type::BOOL, "voteindex", "True if voteindex is enabled"},
+                    {RPCResult::Type::BOOL, "rewardindex", "True if rewardindex is enabled"},
                     {RPCResult::Type::BOOL, "coldstakeindex", "True if coldstakeindex is enabled"},
+                    {RPCResult::Type::OBJ_DYN, "stats", "Counters per insight index since startup", {
+                        {RPCResult::Type::OBJ, "name", "The index name", {
+                            {RPCResult::Type::NUM, "batches_written", "Number of batches written"},
+                            {RPCResult::Type::NUM, "keys_written", "Number of keys written or erased"},
+                            {RPCResult::Type::NUM, "bytes_written", "Estimated size of the written batches"},
+                            {RPCResult::Type::NUM, "write_ms", "Total time writing batches in milliseconds"},
+                            {RPCResult::Type::NUM, "reads", "Number of lookups"},
+                            {RPCResult::Type::NUM, "read_ms", "Total time of lookups in milliseconds"},
+                            {RPCResult::Type::ARR, "read_latency", "Lookup counts by latency", {
+                                {RPCResult::Type::OBJ, "", "", {
+                                    {RPCResult::Type::NUM, "below_us", /* optional */ true, "Upper bound of the bucket in microseconds, omitted for the last bucket"},
+                                    {RPCResult::Type::NUM, "count", "Number of lookups"},
+                                }},
+                            }},
+                        }},
+                    }},
                 }
             },
             RPCExamples{
@@ -1408,11 +1908,39 @@ UniValue getinsightinfo(const JSONRPCRequest& request)
 
     ret.pushKV("txindex", (g_txindex ? true : false));
     ret.pushKV("addressindex", fAddressIndex);
+    ret.pushKV("compactaddressindex", fAddressIndexV2);
     ret.pushKV("spentindex", fSpentIndex);
     ret.pushKV("timestampindex", fTimestampIndex);
     ret.pushKV("balancesindex", fBalancesIndex);
+    ret.pushKV("voteindex", fVoteIndex);
+    ret.pushKV("rewardindex", fRewardIndex);
     ret.pushKV("coldstakeindex", (bool) (g_txindex && g_txindex->m_cs_index));
 
+    UniValue stats(UniValue::VOBJ);
+    for (int i = 0; i < INSIGHT_STATS_MAX; ++i) {
+        const InsightIndexStats &s = GetInsightStats((InsightStatsType)i);
+        UniValue uv(UniValue::VOBJ);
+        uv.pushKV("batches_written", (uint64_t)s.nWrites);
+        uv.pushKV("keys_written", (uint64_t)s.nKeysWritten);
+        uv.pushKV("bytes_written", (uint64_t)s.nBytesWritten);
+        uv.pushKV("write_ms", s.nWriteMicros / 1000.0);
+        uv.pushKV("reads", (uint64_t)s.nReads);
+        uv.pushKV("read_ms", s.nReadMicros / 1000.0);
+        UniValue buckets(UniValue::VARR);
+        int64_t bound = 1;
+        for (size_t b = 0; b < InsightIndexStats::READ_BUCKETS; ++b, bound *= 4) {
+            UniValue bucket(UniValue::VOBJ);
+            if (b < InsightIndexStats::READ_BUCKETS - 1) {
+                bucket.pushKV("below_us", bound);
+            }
+            bucket.pushKV("count", (uint64_t)s.read_buckets[b]);
+            buckets.push_back(bucket);
+        }
+        uv.pushKV("read_latency", buckets);
+        stats.pushKV(InsightStatsName((InsightStatsType)i), uv);
+    }
+    ret.pushKV("stats", stats);
+
     return ret;
 }
 
@@ -1430,7 +1958,9 @@ static const CRPCCommand commands[] =
     { "blockchain",         "getblockhashes",         &getblockhashes,         {"high","low","options"} },
     { "blockchain",         "gettxoutsetinfobyscript",&gettxoutsetinfobyscript,{} },
     { "blockchain",         "getblockreward",         &getblockreward,         {"height"} },
+    { "blockchain",         "getblockrewards",        &getblockrewards,        {"start","end"} },
     { "blockchain",         "getblockbalances",       &getblockbalances,       {"blockhash","options"} },
+    { "blockchain",         "getblockbalancesrange",  &getblockbalancesrange,  {"start","end","options"} },
 
     { "csindex",            "listcoldstakeunspent",   &listcoldstakeunspent,   {"stakeaddress","height","options"} },
 
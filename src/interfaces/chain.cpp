@@ -32,6 +32,7 @@
 #include <validation.h>
 #include <validationinterface.h>
 #include <miner.h>
+#include <anon.h>
 
 #include <memory>
 #include <utility>
@@ -87,10 +88,10 @@ public:
 class NotificationsHandlerImpl : public Handler
 {
 public:
-    explicit NotificationsHandlerImpl(std::shared_ptr<Chain::Notifications> notifications)
+    explicit NotificationsHandlerImpl(std::shared_ptr<Chain::Notifications> notifications, const std::string& queue_name)
         : m_proxy(std::make_shared<NotificationsProxy>(std::move(notifications)))
     {
-        RegisterSharedValidationInterface(m_proxy);
+        RegisterSharedValidationInterface(m_proxy, queue_name);
     }
     ~NotificationsHandlerImpl() override { disconnect(); }
     void disconnect() override
@@ -358,9 +359,9 @@ public:
     {
         ::uiInterface.ShowProgress(title, progress, resume_possible);
     }
-    std::unique_ptr<Handler> handleNotifications(std::shared_ptr<Notifications> notifications) override
+    std::unique_ptr<Handler> handleNotifications(std::shared_ptr<Notifications> notifications, const std::string& queue_name) override
     {
-        return MakeUnique<NotificationsHandlerImpl>(std::move(notifications));
+        return MakeUnique<NotificationsHandlerImpl>(std::move(notifications), queue_name);
     }
     void waitForNotificationsIfTipChanged(const uint256& old_tip) override
     {
@@ -421,6 +422,25 @@ public:
         LOCK(::cs_main);
         return ::ChainActive().Tip()->nAnonOutputs;
     }
+    int64_t getAnonOutputsAtHeight(int height) override
+    {
+        LOCK(::cs_main);
+        if (height < 0) {
+            return 0;
+        }
+        const CBlockIndex *pindex = ::ChainActive()[std::min(height, ::ChainActive().Height())];
+        return pindex ? pindex->nAnonOutputs : 0;
+    }
+    int64_t getMatureAnonOutputs(int min_depth) override
+    {
+        LOCK(::cs_main);
+        return getAnonOutputsAtHeight(::ChainActive().Height() - std::max(min_depth, 1) + 1);
+    }
+    int getAnonOutputHeight(int64_t index) override
+    {
+        LOCK(::cs_main);
+        return GetAnonOutputHeight(::ChainActive(), index);
+    }
     int64_t getSmsgFeeRate(const CBlockIndex *pindex, bool reduce_height) override
     {
         LOCK(::cs_main);
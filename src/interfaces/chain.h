@@ -254,8 +254,8 @@ public:
         virtual void chainStateFlushed(const CBlockLocator& locator) {}
     };
 
-    //! Register handler for notifications.
-    virtual std::unique_ptr<Handler> handleNotifications(std::shared_ptr<Notifications> notifications) = 0;
+    //! Register handler for notifications, queue_name labels its notification queue.
+    virtual std::unique_ptr<Handler> handleNotifications(std::shared_ptr<Notifications> notifications, const std::string& queue_name = "") = 0;
 
     //! Wait for pending notifications to be processed unless block hash points to the current
     //! chain tip.
@@ -293,6 +293,12 @@ public:
     //! Particl Specific
     virtual int getHeightInt() = 0;
     virtual size_t getAnonOutputs() = 0;
+    //! Last anon output index added at or below height
+    virtual int64_t getAnonOutputsAtHeight(int height) = 0;
+    //! Last anon output index with at least min_depth confirmations
+    virtual int64_t getMatureAnonOutputs(int min_depth) = 0;
+    //! Height of the block that added the anon output, -1 if not in the active chain
+    virtual int getAnonOutputHeight(int64_t index) = 0;
     virtual int64_t getSmsgFeeRate(const CBlockIndex *pindex, bool reduce_height=false) = 0;
     virtual bool transactionInMempool(const uint256 &txhash) = 0;
     virtual CTransactionRef transactionFromMempool(const uint256 &txhash) = 0;
@@ -26,6 +26,7 @@
 #include <wallet/rpcwallet.h>
 #include <wallet/wallet.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -432,6 +433,51 @@ public:
 
         return result;
     }
+    std::vector<uint256> getWalletTxHashes() override
+    {
+        std::vector<std::pair<int64_t, uint256>> ordered;
+        {
+            LOCK(m_wallet->cs_wallet);
+            ordered.reserve(m_wallet->wtxOrdered.size() + (m_wallet_part ? m_wallet_part->rtxOrdered.size() : 0));
+            for (const auto& entry : m_wallet->wtxOrdered) {
+                ordered.emplace_back(entry.second->GetTxTime(), entry.second->GetHash());
+            }
+            if (m_wallet_part) {
+                for (const auto& entry : m_wallet_part->rtxOrdered) {
+                    ordered.emplace_back(entry.first, entry.second->first);
+                }
+            }
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const std::pair<int64_t, uint256>& a, const std::pair<int64_t, uint256>& b) {
+            return a.first > b.first;
+        });
+        std::vector<uint256> result;
+        result.reserve(ordered.size());
+        for (const auto& entry : ordered) {
+            result.push_back(entry.second);
+        }
+        return result;
+    }
+    std::vector<WalletTx> getWalletTxs(const std::vector<uint256>& txids) override
+    {
+        LOCK(m_wallet->cs_wallet);
+        std::vector<WalletTx> result;
+        result.reserve(txids.size());
+        for (const auto& txid : txids) {
+            auto mi = m_wallet->mapWallet.find(txid);
+            if (mi != m_wallet->mapWallet.end()) {
+                result.emplace_back(MakeWalletTx(*m_wallet, mi->second));
+                continue;
+            }
+            if (m_wallet_part) {
+                const auto mri = m_wallet_part->mapRecords.find(txid);
+                if (mri != m_wallet_part->mapRecords.end()) {
+                    result.emplace_back(MakeWalletTx(*m_wallet_part, mri));
+                }
+            }
+        }
+        return result;
+    }
     bool tryGetTxStatus(const uint256& txid,
         interfaces::WalletTxStatus& tx_status,
         int& num_blocks,
@@ -652,7 +698,7 @@ public:
         if (m_wallet_part) {
             smsgModule.WalletUnloaded(m_wallet_part);
             m_wallet_part = nullptr;
-            RestartStakingThreads();
+            RemoveStakingWallet(m_wallet.get());
         }
     }
     bool isLegacy() override { return m_wallet->IsLegacy(); }
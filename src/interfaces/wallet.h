@@ -188,6 +188,12 @@ public:
     //! Get list of all wallet transactions.
     virtual std::vector<WalletTx> getWalletTxs() = 0;
 
+    //! Get hashes of all wallet transactions and records, newest first.
+    virtual std::vector<uint256> getWalletTxHashes() = 0;
+
+    //! Get the transactions in txids still in the wallet.
+    virtual std::vector<WalletTx> getWalletTxs(const std::vector<uint256>& txids) = 0;
+
     //! Try to get updated status for a particular transaction, if possible without blocking.
     virtual bool tryGetTxStatus(const uint256& txid,
         WalletTxStatus& tx_status,
@@ -6,10 +6,14 @@
 #include <key/extkey.h>
 
 #include <key_io.h>
+#include <crypto/common.h>
 #include <crypto/hmac_sha512.h>
 
 #include <stdint.h>
 
+#include <atomic>
+#include <thread>
+
 RecursiveMutex cs_extKey;
 
 CExtPubKey MakeExtPubKey(const CExtKeyPair &kp)
@@ -599,12 +603,39 @@ int CExtKeyAccount::HaveSavedKey(const CKeyID &id)
     return HK_NO;
 };
 
+bool CExtKeyAccount::MayHaveKey(const CKeyID &id)
+{
+    LOCK(cs_account);
+
+    if (!m_key_filter.IsValid() || m_key_filter.IsFull()) {
+        // Leave room for the lookahead to be refilled without a rebuild
+        m_key_filter.Init((mapKeys.size() + mapLookAhead.size() + mapStealthChildKeys.size()) * 2 + 1024);
+        for (const auto &mi : mapKeys) {
+            m_key_filter.Insert(mi.first);
+        }
+        for (const auto &mi : mapLookAhead) {
+            m_key_filter.Insert(mi.first);
+        }
+        for (const auto &mi : mapStealthChildKeys) {
+            m_key_filter.Insert(mi.first);
+        }
+    }
+
+    return m_key_filter.MayContain(id);
+};
+
 int CExtKeyAccount::HaveKey(const CKeyID &id, bool fUpdate, const CEKAKey *&pak, const CEKASCKey *&pasc, isminetype &ismine)
 {
     // If fUpdate, promote key if found in look ahead
     LOCK(cs_account);
 
     pasc = nullptr;
+    if (!MayHaveKey(id)) {
+        pak = nullptr;
+        ismine = ISMINE_NO;
+        return HK_NO;
+    }
+
     AccKeyMap::const_iterator mi = mapKeys.find(id);
     if (mi != mapKeys.end()) {
         pak = &mi->second;
@@ -789,6 +820,7 @@ bool CExtKeyAccount::SaveKey(const CKeyID &id, const CEKAKey &keyIn)
     }
 
     mapKeys[id] = keyIn;
+    AddToKeyFilter(id);
 
 
     CStoredExtKey *pc;
@@ -868,6 +900,7 @@ bool CExtKeyAccount::SaveKey(const CKeyID &id, const CEKASCKey &keyIn)
     }
 
     mapStealthChildKeys[id] = keyIn;
+    AddToKeyFilter(id);
 
     if (LogAcceptCategory(BCLog::HDWALLET)) {
         LogPrintf("SaveKey(): CEKASCKey %s, %s.\n", GetIDString58(), EncodeDestination(PKHash(id)));
@@ -945,6 +978,7 @@ int CExtKeyAccount::AddLookBehind(uint32_t nChain, uint32_t nKeys)
         }
 
         mapLookAhead[keyId] = CEKAKey(nChain, nChildOut);
+        AddToKeyFilter(keyId);
 
         if (LogAcceptCategory(BCLog::HDWALLET)) {
             LogPrintf("%s: Added %s, look-ahead size %u.\n", __func__, EncodeDestination(PKHash(keyId)), mapLookAhead.size());
@@ -954,7 +988,108 @@ int CExtKeyAccount::AddLookBehind(uint32_t nChain, uint32_t nKeys)
     return 0;
 };
 
-int CExtKeyAccount::AddLookAhead(uint32_t nChain, uint32_t nKeys)
+CExtKeyDeriveCache::CExtKeyDeriveCache(const CStoredExtKey *sek, uint32_t nChildStart, uint32_t nKeys, int nThreads)
+    : m_sek(sek), m_start(nChildStart)
+{
+    if (nKeys < MIN_THREADED_LOOKAHEAD || (nChildStart >> 31) != 0) {
+        return;
+    }
+    CPubKeyBatchDeriver deriver(m_sek->kp.pubkey, m_sek->kp.chaincode);
+    if (!deriver.IsValid()) {
+        return;
+    }
+    nKeys = std::min(nKeys, ((uint32_t)1 << 31) - nChildStart);
+
+    m_packed.resize((size_t)nKeys * CPubKey::COMPRESSED_SIZE);
+    m_ids.resize((size_t)nKeys * CHash160::OUTPUT_SIZE);
+    std::atomic<uint32_t> next{0};
+    auto worker = [&]() {
+        uint32_t i;
+        while ((i = next.fetch_add(CHUNK_SIZE)) < nKeys) {
+            uint32_t n = std::min(CHUNK_SIZE, nKeys - i);
+            deriver.DeriveRange(m_start + i, m_start + i + n, &m_packed[(size_t)i * CPubKey::COMPRESSED_SIZE]);
+            Hash160Batch(&m_ids[(size_t)i * CHash160::OUTPUT_SIZE], &m_packed[(size_t)i * CPubKey::COMPRESSED_SIZE], CPubKey::COMPRESSED_SIZE, n);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < nThreads && (uint32_t)i * CHUNK_SIZE < nKeys; ++i) {
+        threads.emplace_back([&worker]() { TraceThread("lookahead", worker); });
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+};
+
+int CExtKeyDeriveCache::DeriveKey(CPubKey &keyOut, uint32_t nChildIn, uint32_t &nChildOut) const
+{
+    if (nChildIn >= m_start && (size_t)(nChildIn - m_start) * CPubKey::COMPRESSED_SIZE < m_packed.size()) {
+        const uint8_t *p = &m_packed[(size_t)(nChildIn - m_start) * CPubKey::COMPRESSED_SIZE];
+        if (p[0] != 0) {
+            keyOut.Set(p, p + CPubKey::COMPRESSED_SIZE);
+            nChildOut = nChildIn;
+            return 0;
+        }
+    }
+    return m_sek->DeriveKey(keyOut, nChildIn, nChildOut, false);
+};
+
+int CExtKeyDeriveCache::DeriveKey(CPubKey &keyOut, CKeyID &idOut, uint32_t nChildIn, uint32_t &nChildOut) const
+{
+    if (nChildIn >= m_start && (size_t)(nChildIn - m_start) * CPubKey::COMPRESSED_SIZE < m_packed.size()) {
+        size_t i = nChildIn - m_start;
+        const uint8_t *p = &m_packed[i * CPubKey::COMPRESSED_SIZE];
+        if (p[0] != 0) {
+            keyOut.Set(p, p + CPubKey::COMPRESSED_SIZE);
+            memcpy(idOut.begin(), &m_ids[i * CHash160::OUTPUT_SIZE], CHash160::OUTPUT_SIZE);
+            nChildOut = nChildIn;
+            return 0;
+        }
+    }
+    int rv = m_sek->DeriveKey(keyOut, nChildIn, nChildOut, false);
+    if (rv == 0) {
+        idOut = keyOut.GetID();
+    }
+    return rv;
+};
+
+void CKeyIdFilter::Init(size_t nExpected)
+{
+    size_t nBits = 64;
+    while (nBits < nExpected * BITS_PER_ELEMENT) {
+        nBits <<= 1;
+    }
+    m_bits.assign(nBits / 64, 0);
+    m_mask = nBits - 1;
+    m_elements = 0;
+    m_capacity = nExpected;
+};
+
+void CKeyIdFilter::Insert(const uint160 &id)
+{
+    assert(IsValid());
+    for (size_t i = 0; i < NUM_PROBES; ++i) {
+        uint64_t n = ReadLE32(id.begin() + i * 4) & m_mask;
+        m_bits[n >> 6] |= (uint64_t)1 << (n & 63);
+    }
+    m_elements++;
+};
+
+bool CKeyIdFilter::MayContain(const uint160 &id) const
+{
+    if (!IsValid()) {
+        return true;
+    }
+    for (size_t i = 0; i < NUM_PROBES; ++i) {
+        uint64_t n = ReadLE32(id.begin() + i * 4) & m_mask;
+        if (!(m_bits[n >> 6] & ((uint64_t)1 << (n & 63)))) {
+            return false;
+        }
+    }
+    return true;
+};
+
+int CExtKeyAccount::AddLookAhead(uint32_t nChain, uint32_t nKeys, int nThreads)
 {
     // Must start from key 0
     CStoredExtKey *pc = GetChain(nChain);
@@ -970,6 +1105,7 @@ int CExtKeyAccount::AddLookAhead(uint32_t nChain, uint32_t nKeys)
         LogPrintf("%s: chain %s, keys %d, from %d.\n", __func__, pc->GetIDString58(), nKeys, nChildOut);
     }
 
+    CExtKeyDeriveCache derived(pc, nChild, nKeys, nThreads);
     CKeyID keyId;
     CPubKey pk;
     for (uint32_t k = 0; k < nKeys; ++k) {
@@ -977,14 +1113,13 @@ int CExtKeyAccount::AddLookAhead(uint32_t nChain, uint32_t nKeys)
 
         uint32_t nMaxTries = 1000; // TODO: link to lookahead size
         for (uint32_t i = 0; i < nMaxTries; ++i) { // nMaxTries > lookahead pool
-            if (pc->DeriveKey(pk, nChild, nChildOut, false) != 0) {
+            if (derived.DeriveKey(pk, keyId, nChild, nChildOut) != 0) {
                 LogPrintf("Warning: %s - DeriveKey failed, chain %d, child %d.\n", __func__, nChain, nChild);
                 nChild = nChildOut + 1;
                 continue;
             }
             nChild = nChildOut + 1;
 
-            keyId = pk.GetID();
             if ((mi = mapKeys.find(keyId)) != mapKeys.end()) {
                 if (LogAcceptCategory(BCLog::HDWALLET)) {
                     LogPrintf("%s: key exists in map skipping %s.\n", __func__, EncodeDestination(PKHash(keyId)));
@@ -1006,6 +1141,7 @@ int CExtKeyAccount::AddLookAhead(uint32_t nChain, uint32_t nKeys)
         }
 
         mapLookAhead[keyId] = CEKAKey(nChain, nChildOut);
+        AddToKeyFilter(keyId);
         pc->nLastLookAhead = nChildOut;
 
         if (LogAcceptCategory(BCLog::HDWALLET)) {
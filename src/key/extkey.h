@@ -20,6 +20,7 @@ static const uint32_t BIP32_KEY_N_BYTES = 74;   // Raw without id and checksum
 
 static const uint32_t MAX_KEY_PACK_SIZE = 128;
 static const uint32_t DEFAULT_LOOKAHEAD_SIZE = 64;
+static const uint32_t MIN_THREADED_LOOKAHEAD = 256;
 
 static const uint32_t BIP44_PURPOSE = (((uint32_t)44) | (1 << 31));
 
@@ -40,6 +41,7 @@ enum EKAddonValueTypes
     EKVT_HARDWARE_DEVICE        = 10,   // 4bytes nVendorId, 4bytes nProductId
     EKVT_STEALTH_SCAN_CHAIN     = 11,
     EKVT_STEALTH_SPEND_CHAIN    = 12,
+    EKVT_DEVICE_KEYS            = 13,   // 4byte child no of the first key, then 33byte pubkeys read ahead from a hardware device
 };
 
 extern RecursiveMutex cs_extKey;
@@ -439,6 +441,55 @@ public:
     mapEKValue_t mapValue;
 };
 
+/** Non-hardened child pubkeys of a chain derived ahead of use, split across threads.
+ *  Keys are packed 33 bytes each, from a CPubKeyBatchDeriver shared by all threads.
+ *  DeriveKey behaves as CStoredExtKey::DeriveKey, outside the prepared range or for
+ *  children that can't be derived it derives inline.
+ */
+class CExtKeyDeriveCache
+{
+public:
+    static const uint32_t CHUNK_SIZE = 1024;
+
+    CExtKeyDeriveCache(const CStoredExtKey *sek, uint32_t nChildStart, uint32_t nKeys, int nThreads);
+
+    int DeriveKey(CPubKey &keyOut, uint32_t nChildIn, uint32_t &nChildOut) const;
+    //! Also return the key id, hashed with the rest of its chunk when the key came from the cache
+    int DeriveKey(CPubKey &keyOut, CKeyID &idOut, uint32_t nChildIn, uint32_t &nChildOut) const;
+
+private:
+    const CStoredExtKey *m_sek;
+    uint32_t m_start;
+    std::vector<uint8_t> m_packed;
+    std::vector<uint8_t> m_ids;
+};
+
+/** Probabilistic set of key ids, reports false positives but never false negatives.
+ *  Key ids are hashes, their own bits are used as the probe positions.
+ */
+class CKeyIdFilter
+{
+public:
+    //! ~0.25% false positives at the sized number of elements
+    static const size_t BITS_PER_ELEMENT = 16;
+    static const size_t NUM_PROBES = 4;
+
+    void Init(size_t nExpected);
+    void Clear() { m_bits.clear(); m_elements = 0; m_capacity = 0; };
+    void Insert(const uint160 &id);
+    bool MayContain(const uint160 &id) const;
+
+    bool IsValid() const { return !m_bits.empty(); };
+    //! The false positive rate grows past the sized number of elements, the owner should rebuild the filter
+    bool IsFull() const { return m_elements > m_capacity; };
+
+private:
+    std::vector<uint64_t> m_bits;
+    uint64_t m_mask = 0;
+    size_t m_elements = 0;
+    size_t m_capacity = 0;
+};
+
 class CEKLKey
 {
 public:
@@ -710,6 +761,16 @@ public:
     };
 
     int HaveSavedKey(const CKeyID &id);
+    /** False if id is not in mapKeys, mapLookAhead or mapStealthChildKeys, builds m_key_filter on first use */
+    bool MayHaveKey(const CKeyID &id);
+    /** Must be called for every id inserted into mapKeys, mapLookAhead or mapStealthChildKeys */
+    void AddToKeyFilter(const CKeyID &id)
+    {
+        LOCK(cs_account);
+        if (m_key_filter.IsValid()) {
+            m_key_filter.Insert(id);
+        }
+    };
     int HaveKey(const CKeyID &id, bool fUpdate, const CEKAKey *&pak, const CEKASCKey *&pasc, isminetype &ismine);
     int HaveStealthKey(const CKeyID &id, const CEKASCKey *&pasc, isminetype &ismine);
     bool GetKey(const CKeyID &id, CKey &keyOut) const;
@@ -794,7 +855,7 @@ public:
     };
 
     int AddLookBehind(uint32_t nChain, uint32_t nKeys);
-    int AddLookAhead(uint32_t nChain, uint32_t nKeys);
+    int AddLookAhead(uint32_t nChain, uint32_t nKeys, int nThreads = 1);
 
     int AddLookAheadInternal(uint32_t nKeys)
     {
@@ -855,6 +916,7 @@ public:
     AccKeyMap mapLookAhead;
 
     AccKeySCMap mapStealthChildKeys; // keys derived from stealth addresses
+    CKeyIdFilter m_key_filter; // ids of mapKeys, mapLookAhead and mapStealthChildKeys
 
     AccStealthKeyMap mapStealthKeys;
     std::set<const CEKAStealthKey*> setLookAheadStealth;
@@ -20,10 +20,14 @@
 #include <util/string.h>
 #include <crypto/hmac_sha512.h>
 #include <crypto/sha256.h>
+#include <support/cleanse.h>
 
 #include <unilib/uninorms.h>
 #include <unilib/utf8.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #ifdef ENABLE_BIP39_ENGLISH
 #include <key/wordlists/english.h>
 #else
@@ -211,6 +215,54 @@ int GetWordOffset(const char *p, const char *pwl, int max, int &o)
     return 1;
 };
 
+/** Words of a language in list order and a word to offset map, both built once on first use.
+ *  Entries are normalised the same way as input so lookups are exact matches.
+ */
+struct WordListIndex
+{
+    std::vector<std::string> words;
+    std::unordered_map<std::string, int> offsets;
+};
+
+static const WordListIndex *GetWordListIndex(int nLanguage)
+{
+    static WordListIndex indices[WLL_MAX];
+    static std::once_flag built[WLL_MAX];
+
+    if (nLanguage < 1 || nLanguage >= WLL_MAX || !mnLanguages[nLanguage]) {
+        return nullptr;
+    }
+    std::call_once(built[nLanguage], [nLanguage]() {
+        WordListIndex &index = indices[nLanguage];
+        const char *pwl = (const char*) mnLanguages[nLanguage];
+        const char *pend = pwl + mnLanguageLens[nLanguage];
+        index.words.reserve(2048);
+        index.offsets.reserve(2048);
+        for (const char *p = pwl; p < pend;) {
+            const char *pnl = (const char*) memchr(p, '\n', pend - p);
+            if (!pnl) {
+                break; // List must end with \n
+            }
+            std::string sWord(p, pnl);
+            NormaliseUnicode(sWord);
+            index.offsets.emplace(sWord, (int)index.words.size());
+            index.words.push_back(std::move(sWord));
+            p = pnl + 1;
+        }
+    });
+    return &indices[nLanguage];
+};
+
+static int LookupWord(const WordListIndex *index, const char *p, int &o)
+{
+    auto it = index->offsets.find(p);
+    if (it == index->offsets.end()) {
+        return 1;
+    }
+    o = it->second;
+    return 0;
+};
+
 int GetLanguageOffset(std::string sIn)
 {
     int nLanguage = -1;
@@ -242,11 +294,10 @@ int DetectLanguage(const std::string &sWordList)
     }
 
     for (int l = 1; l < WLL_MAX; ++l) {
-        char *pwl = (char*) mnLanguages[l];
-        if (!pwl) {
+        const WordListIndex *index = GetWordListIndex(l);
+        if (!index) {
             continue;
         }
-        int m = mnLanguageLens[l];
         strcpy(tmp, sWordList.c_str());
 
         // The Chinese dialects have many words in common, match full phrase
@@ -258,7 +309,7 @@ int DetectLanguage(const std::string &sWordList)
         p = strtok_r(tmp, " ", &token);
         while (p != nullptr) {
             int ofs;
-            if (0 == GetWordOffset(p, pwl, m, ofs)) {
+            if (0 == LookupWord(index, p, ofs)) {
                 nHit++;
             } else {
                 nMiss++;
@@ -348,14 +399,12 @@ int Encode(int nLanguage, const std::vector<uint8_t> &vEntropy, std::string &sWo
         i += 11;
     }
 
-    char *pwl = (char*) mnLanguages[nLanguage];
-    int m = mnLanguageLens[nLanguage];
+    const WordListIndex *index = GetWordListIndex(nLanguage);
 
     for (size_t k = 0; k < vWord.size(); ++k) {
         int o = vWord[k];
 
-        std::string sWord;
-        if (0 != GetWord(o, pwl, m, sWord)) {
+        if (o >= (int)index->words.size()) {
             sError = strprintf("Word extract failed %d, language %d.", o, nLanguage);
             return errorN(3, "%s: %s", __func__, sError.c_str());
         }
@@ -363,7 +412,7 @@ int Encode(int nLanguage, const std::vector<uint8_t> &vEntropy, std::string &sWo
         if (sWordList != "") {
             sWordList += " ";
         }
-        sWordList += sWord;
+        sWordList += index->words[o];
     }
 
     if (nLanguage == WLL_JAPANESE) {
@@ -405,8 +454,7 @@ int Decode(int &nLanguage, const std::string &sWordListIn, std::vector<uint8_t>
 
     strcpy(tmp, sWordList.c_str());
 
-    char *pwl = (char*) mnLanguages[nLanguage];
-    int m = mnLanguageLens[nLanguage];
+    const WordListIndex *index = GetWordListIndex(nLanguage);
 
     std::vector<int> vWordInts;
 
@@ -414,7 +462,7 @@ int Decode(int &nLanguage, const std::string &sWordListIn, std::vector<uint8_t>
     p = strtok_r(tmp, " ", &token);
     while (p != nullptr) {
         int ofs;
-        if (0 != GetWordOffset(p, pwl, m, ofs)) {
+        if (0 != LookupWord(index, p, ofs)) {
             sError = strprintf("Unknown word: %s", p);
             return errorN(3, "%s: %s", __func__, sError.c_str());
         }
@@ -520,25 +568,7 @@ static int mnemonicKdf(const uint8_t *password, size_t lenPassword,
         return 1;
     }
 
-    uint8_t r[64];
-
-    const unsigned char one_be[4] = {0, 0, 0, 1};
-    CHMAC_SHA512 ctx(password, lenPassword);
-    CHMAC_SHA512 ctx_state = ctx;
-    ctx.Write(salt, lenSalt);
-    ctx.Write(one_be, 4);
-    ctx.Finalize(r);
-    memcpy(out, r, 64);
-
-    for (size_t k = 1; k < nIterations; ++k) {
-        ctx= ctx_state;
-        ctx.Write(r, 64);
-        ctx.Finalize(r);
-
-        for (size_t i = 0; i < 64; ++i) {
-            out[i] ^= r[i];
-        }
-    }
+    PBKDF2_HMAC_SHA512_64(&password, &lenPassword, &salt, &lenSalt, 1, nIterations, out);
 
     return 0;
 };
@@ -571,6 +601,39 @@ int ToSeed(const std::string &sMnemonic, const std::string &sPasswordIn, std::ve
     return 0;
 };
 
+int ToSeeds(const std::string &sMnemonic, const std::vector<std::string> &vPasswordsIn, std::vector<std::vector<uint8_t> > &vSeeds)
+{
+    std::string sWordList = sMnemonic;
+    NormaliseInput(sWordList);
+
+    if (strstr(sWordList.c_str(), "  ") != NULL) {
+        return errorN(1, "%s: Multiple spaces between words.", __func__);
+    }
+
+    size_t n = vPasswordsIn.size();
+    std::vector<std::string> vSalts(n);
+    std::vector<const uint8_t*> vpPassword(n, (const uint8_t*)sWordList.data()), vpSalt(n);
+    std::vector<size_t> vLenPassword(n, sWordList.size()), vLenSalt(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string sPassword = vPasswordsIn[i];
+        NormaliseInput(sPassword);
+        vSalts[i] = std::string("mnemonic") + sPassword;
+        vpSalt[i] = (const uint8_t*)vSalts[i].data();
+        vLenSalt[i] = vSalts[i].size();
+    }
+
+    std::vector<uint8_t> vOut(n * 64);
+    PBKDF2_HMAC_SHA512_64(vpPassword.data(), vLenPassword.data(), vpSalt.data(), vLenSalt.data(), n, 2048, vOut.data());
+
+    vSeeds.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        vSeeds[i].assign(vOut.begin() + i * 64, vOut.begin() + (i + 1) * 64);
+    }
+    memory_cleanse(vOut.data(), vOut.size());
+
+    return 0;
+};
+
 int AddChecksum(int nLanguageIn, const std::string &sWordListIn, std::string &sWordListOut, std::string &sError)
 {
     std::string sWordList = sWordListIn;
@@ -606,13 +669,12 @@ int GetWord(int nLanguage, int nWord, std::string &sWord, std::string &sError)
         return errorN(1, "%s: %s", __func__, sError.c_str());
     }
 
-    char *pwl = (char*) mnLanguages[nLanguage];
-    int m = mnLanguageLens[nLanguage];
-
-    if (0 != GetWord(nWord, pwl, m, sWord)) {
+    const WordListIndex *index = GetWordListIndex(nLanguage);
+    if (nWord < 0 || nWord >= (int)index->words.size()) {
         sError = strprintf("Word extract failed %d, language %d.", nWord, nLanguage);
         return errorN(3, "%s: %s", __func__, sError.c_str());
     }
+    sWord = index->words[nWord];
 
     return 0;
 };
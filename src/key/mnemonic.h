@@ -37,6 +37,8 @@ int DetectLanguage(const std::string &sWordList);
 int Encode(int nLanguage, const std::vector<uint8_t> &vEntropy, std::string &sWordList, std::string &sError);
 int Decode(int &nLanguage, const std::string &sWordListIn, std::vector<uint8_t> &vEntropy, std::string &sError, bool fIgnoreChecksum=false);
 int ToSeed(const std::string &sMnemonic, const std::string &sPasswordIn, std::vector<uint8_t> &vSeed);
+/** Seeds of one mnemonic for many passphrase candidates, the PBKDF2 rounds of all candidates run together */
+int ToSeeds(const std::string &sMnemonic, const std::vector<std::string> &vPasswordsIn, std::vector<std::vector<uint8_t> > &vSeeds);
 int AddChecksum(int nLanguageIn, const std::string &sWordListIn, std::string &sWordListOut, std::string &sError);
 int GetWord(int nLanguage, int nWord, std::string &sWord, std::string &sError);
 std::string GetLanguage(int nLanguage);
@@ -7,6 +7,7 @@
 
 #include <key_io.h>
 #include <key/keyutil.h>
+#include <primitives/transaction.h>
 #include <pubkey.h>
 #include <random.h>
 #include <script/script.h>
@@ -15,7 +16,9 @@
 
 #include <support/allocators/secure.h>
 
+#include <atomic>
 #include <cmath>
+#include <thread>
 #include <secp256k1.h>
 #include <secp256k1_ecdh.h>
 
@@ -226,6 +229,19 @@ int StealthSecret(const CKey &secret, const ec_point &pubkey, const ec_point &pk
         return errorN(1, "%s: secp256k1_ec_pubkey_parse R failed.", __func__);
     }
 
+    return StealthSecret(secret, Q, R, sharedSOut, pkOut);
+};
+
+bool StealthParsePoint(const ec_point &pk, secp256k1_pubkey &out)
+{
+    return pk.size() == EC_COMPRESSED_SIZE
+        && secp256k1_ec_pubkey_parse(secp256k1_ctx_stealth, &out, &pk[0], EC_COMPRESSED_SIZE);
+};
+
+int StealthSecret(const CKey &secret, const secp256k1_pubkey &Q, const secp256k1_pubkey &pkSpend, CKey &sharedSOut, ec_point &pkOut)
+{
+    secp256k1_pubkey R = pkSpend;
+
     // H(eQ)
     if (!secp256k1_ecdh(secp256k1_ctx_stealth, sharedSOut.begin_nc(), &Q, secret.begin(), nullptr, nullptr)) {
         return errorN(1, "%s: secp256k1_ctx_stealth failed.", __func__);
@@ -323,6 +339,105 @@ int StealthSharedToPublicKey(const ec_point &pkSpend, const CKey &sharedS, ec_po
     return 0;
 };
 
+bool CStealthAddressPoints::Set(const ec_point &scan_pubkey, const ec_point &spend_pubkey)
+{
+    m_valid = StealthParsePoint(scan_pubkey, m_scan) && StealthParsePoint(spend_pubkey, m_spend);
+    return m_valid;
+};
+
+int CStealthAddressPoints::SendTo(const CKey &ephem, CKey &sharedSOut, ec_point &pkOut) const
+{
+    if (!m_valid) {
+        return errorN(1, "%s: Invalid address points.", __func__);
+    }
+    return StealthSecret(ephem, m_scan, m_spend, sharedSOut, pkOut);
+};
+
+int CStealthAddressPoints::Receive(const CKey &scan_secret, const secp256k1_pubkey &ephem, CKey &sharedSOut, ec_point &pkOut) const
+{
+    if (!m_valid) {
+        return errorN(1, "%s: Invalid address points.", __func__);
+    }
+    return StealthSecret(scan_secret, ephem, m_spend, sharedSOut, pkOut);
+};
+
+template <typename F>
+static void StealthParallelFor(size_t n, int nThreads, F f)
+{
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next++) < n) {
+            f(i);
+        }
+    };
+    std::vector<std::thread> threads;
+    if (n >= MIN_THREADED_STEALTH_OUTPUTS) {
+        for (int i = 1; i < nThreads; ++i) {
+            threads.emplace_back([&worker]() { TraceThread("stealth", worker); });
+        }
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+};
+
+int MakeStealthOutputs(const std::vector<CStealthAddressPoints> &addrs, std::vector<CStealthSendResult> &results, int nThreads, std::string &sError)
+{
+    results.clear();
+    results.resize(addrs.size());
+    std::atomic<bool> failed{false};
+    StealthParallelFor(addrs.size(), nThreads, [&](size_t i) {
+        CStealthSendResult &r = results[i];
+        int k, nTries = 24;
+        for (k = 0; k < nTries; ++k) { // if StealthSecret fails try again with new ephem key
+            r.sEphem.MakeNewKey(true);
+            if (addrs[i].SendTo(r.sEphem, r.sShared, r.pkSendTo) == 0) {
+                break;
+            }
+        }
+        if (k >= nTries) {
+            failed = true;
+        }
+    });
+    if (failed) {
+        return errorN(1, sError, __func__, "Could not generate receiving public key.");
+    }
+    return 0;
+};
+
+int FindStealthOutputs(const CStealthAddressPoints &sx, const CKey &scan_secret,
+    const std::vector<ec_point> &ephem_pubkeys, const std::vector<CKeyID> &output_ids,
+    std::vector<uint8_t> &vMatch, std::vector<CKey> &vShared, int nThreads)
+{
+    if (ephem_pubkeys.size() != output_ids.size()) {
+        return errorN(1, "%s: Size mismatch.", __func__);
+    }
+    vMatch.assign(ephem_pubkeys.size(), 0);
+    vShared.assign(ephem_pubkeys.size(), CKey());
+    // Extracted pubkeys are hashed together after the point math, failures stay zeroed and can't match
+    std::vector<uint8_t> packed(ephem_pubkeys.size() * EC_COMPRESSED_SIZE, 0);
+    StealthParallelFor(ephem_pubkeys.size(), nThreads, [&](size_t i) {
+        secp256k1_pubkey ephem;
+        ec_point pkExtracted;
+        if (StealthParsePoint(ephem_pubkeys[i], ephem)
+            && sx.Receive(scan_secret, ephem, vShared[i], pkExtracted) == 0
+            && pkExtracted.size() == EC_COMPRESSED_SIZE) {
+            memcpy(&packed[i * EC_COMPRESSED_SIZE], pkExtracted.data(), EC_COMPRESSED_SIZE);
+            vMatch[i] = 1;
+        }
+    });
+    std::vector<uint8_t> hashes(ephem_pubkeys.size() * CHash160::OUTPUT_SIZE);
+    Hash160Batch(hashes.data(), packed.data(), EC_COMPRESSED_SIZE, ephem_pubkeys.size());
+    for (size_t i = 0; i < ephem_pubkeys.size(); ++i) {
+        if (vMatch[i] && memcmp(&hashes[i * CHash160::OUTPUT_SIZE], output_ids[i].begin(), CHash160::OUTPUT_SIZE) != 0) {
+            vMatch[i] = 0;
+        }
+    }
+    return 0;
+};
+
 bool IsStealthAddress(const std::string &encodedAddress)
 {
     std::vector<uint8_t> raw;
@@ -389,6 +504,18 @@ bool ExtractStealthPrefix(const char *pPrefix, uint32_t &nPrefix)
     return true;
 };
 
+bool ExtractStealthPrefix(const std::vector<uint8_t> &vData, uint32_t &prefix, size_t offset)
+{
+    prefix = 0;
+    if (vData.size() >= offset + 5 // Have prefix
+        && vData[offset] == DO_STEALTH_PREFIX) {
+        memcpy(&prefix, &vData[offset + 1], 4);
+        prefix = le32toh(prefix);
+        return true;
+    }
+    return false;
+};
+
 int MakeStealthData(const std::string &sNarration, stealth_prefix prefix, const CKey &sShared, const CPubKey &pkEphem,
     std::vector<uint8_t> &vData, uint32_t &nStealthPrefix, std::string &sError)
 {
@@ -435,22 +562,20 @@ int MakeStealthData(const std::string &sNarration, stealth_prefix prefix, const
 int PrepareStealthOutput(const CStealthAddress &sx, const std::string &sNarration,
     CScript &scriptPubKey, std::vector<uint8_t> &vData, std::string &sError)
 {
-    CKey sShared, sEphem;
-    ec_point pkSendTo;
-    int k, nTries = 24;
-    for (k = 0; k < nTries; ++k) { // if StealthSecret fails try again with new ephem key
-        sEphem.MakeNewKey(true);
-        if (StealthSecret(sEphem, sx.scan_pubkey, sx.spend_pubkey, sShared, pkSendTo) == 0)
-            break;
-    }
-    if (k >= nTries) {
-        return errorN(1, sError, __func__, "Could not generate receiving public key.");
+    CStealthAddressPoints points(sx);
+    if (!points.IsValid()) {
+        return errorN(1, sError, __func__, "Invalid stealth address.");
+    }
+    std::vector<CStealthSendResult> results;
+    if (0 != MakeStealthOutputs({points}, results, 1, sError)) {
+        return 1;
     }
-    CPubKey pkEphem = sEphem.GetPubKey();
-    scriptPubKey = GetScriptForDestination(PKHash(CPubKey(pkSendTo)));
+    const CStealthSendResult &r = results[0];
+    CPubKey pkEphem = r.sEphem.GetPubKey();
+    scriptPubKey = GetScriptForDestination(PKHash(CPubKey(r.pkSendTo)));
 
     uint32_t nStealthPrefix;
-    if (0 != MakeStealthData(sNarration, sx.prefix, sShared, pkEphem, vData, nStealthPrefix, sError)) {
+    if (0 != MakeStealthData(sNarration, sx.prefix, r.sShared, pkEphem, vData, nStealthPrefix, sError)) {
         return 1;
     }
     return 0;
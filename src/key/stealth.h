@@ -15,6 +15,8 @@
 #include <key.h>
 #include <key/types.h>
 
+#include <secp256k1.h>
+
 class CScript;
 
 const uint32_t MAX_STEALTH_NARRATION_SIZE = 48;
@@ -129,11 +131,56 @@ int SetPublicKey(const CPubKey &pk, ec_point &out);
 
 int StealthShared(const CKey &secret, const ec_point &pubkey, CKey &sharedSOut);
 int StealthSecret(const CKey &secret, const ec_point &pubkey, const ec_point &pkSpend, CKey &sharedSOut, ec_point &pkOut);
+/** Parse a compressed point once, for scanning many stealth addresses against the same ephemeral key */
+bool StealthParsePoint(const ec_point &pk, secp256k1_pubkey &out);
+int StealthSecret(const CKey &secret, const secp256k1_pubkey &pubkey, const secp256k1_pubkey &pkSpend, CKey &sharedSOut, ec_point &pkOut);
 int StealthSecretSpend(const CKey &scanSecret, const ec_point &ephemPubkey, const CKey &spendSecret, CKey &secretOut);
 int StealthSharedToSecretSpend(const CKey &sharedS, const CKey &spendSecret, CKey &secretOut);
 
 int StealthSharedToPublicKey(const ec_point &pkSpend, const CKey &sharedS, ec_point &pkOut);
 
+/** Scan and spend pubkeys of a stealth address parsed once, for many sends to or scans for the same address */
+class CStealthAddressPoints
+{
+public:
+    CStealthAddressPoints() {};
+    explicit CStealthAddressPoints(const CStealthAddress &sx) { Set(sx.scan_pubkey, sx.spend_pubkey); };
+
+    bool Set(const ec_point &scan_pubkey, const ec_point &spend_pubkey);
+    bool IsValid() const { return m_valid; };
+
+    //! Sender, c = H(eQ), pkOut = R + cG
+    int SendTo(const CKey &ephem, CKey &sharedSOut, ec_point &pkOut) const;
+    //! Recipient, c = H(dP), pkOut = R + cG
+    int Receive(const CKey &scan_secret, const secp256k1_pubkey &ephem, CKey &sharedSOut, ec_point &pkOut) const;
+
+private:
+    secp256k1_pubkey m_scan;
+    secp256k1_pubkey m_spend;
+    bool m_valid = false;
+};
+
+static const size_t MIN_THREADED_STEALTH_OUTPUTS = 16;
+
+struct CStealthSendResult
+{
+    CKey sEphem;
+    CKey sShared;
+    ec_point pkSendTo;
+};
+
+/** Draw an ephemeral key and derive the destination for each address, retrying with new
+ *  ephemeral keys as PrepareStealthOutput does. Large batches are split across nThreads.
+ */
+int MakeStealthOutputs(const std::vector<CStealthAddressPoints> &addrs, std::vector<CStealthSendResult> &results, int nThreads, std::string &sError);
+
+/** Check ephemeral pubkey and output key id pairs against one address, vMatch[i] is set for outputs
+ *  paying the address and vShared[i] to their shared secret. Large batches are split across nThreads.
+ */
+int FindStealthOutputs(const CStealthAddressPoints &sx, const CKey &scan_secret,
+    const std::vector<ec_point> &ephem_pubkeys, const std::vector<CKeyID> &output_ids,
+    std::vector<uint8_t> &vMatch, std::vector<CKey> &vShared, int nThreads);
+
 bool IsStealthAddress(const std::string &encodedAddress);
 
 inline uint32_t SetStealthMask(uint8_t nBits)
@@ -141,9 +188,26 @@ inline uint32_t SetStealthMask(uint8_t nBits)
     return (nBits == 32 ? 0xFFFFFFFF : ((1<<nBits)-1));
 };
 
+/** Whether an output with prefix, if fHavePrefix, can pay an address with nAddrBits bits of addrPrefix */
+inline bool MatchStealthPrefix(uint32_t nAddrBits, uint32_t addrPrefix, uint32_t outputPrefix, bool fHavePrefix)
+{
+    if (nAddrBits < 1) { // addresses without prefixes scan all incoming stealth outputs
+        return true;
+    }
+    if (!fHavePrefix) { // don't check when address has a prefix and no prefix on output
+        return false;
+    }
+
+    uint32_t mask = SetStealthMask(nAddrBits);
+
+    return (addrPrefix & mask) == (outputPrefix & mask);
+};
+
 uint32_t FillStealthPrefix(uint8_t nBits, uint32_t nBitfield);
 
 bool ExtractStealthPrefix(const char *pPrefix, uint32_t &nPrefix);
+/** Read the prefix following the ephemeral pubkey of an output's data, vData[offset] must be DO_STEALTH_PREFIX */
+bool ExtractStealthPrefix(const std::vector<uint8_t> &vData, uint32_t &prefix, size_t offset = 33);
 
 int MakeStealthData(const std::string &sNarration, stealth_prefix prefix, const CKey &sShared, const CPubKey &pkEphem,
     std::vector<uint8_t> &vData, uint32_t &nStealthPrefix, std::string &sError);
@@ -7,9 +7,14 @@
 #include <util/threadnames.h>
 #include <util/time.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <thread>
 
 const char * const DEFAULT_DEBUGLOGFILE = "debug.log";
+const char * const DEFAULT_LOGASYNC_OVERFLOW = "block";
 
 BCLog::Logger& LogInstance()
 {
@@ -80,6 +85,7 @@ bool BCLog::Logger::StartLogging()
 
 void BCLog::Logger::DisconnectTestLogger()
 {
+    StopAsync();
     StdLockGuard scoped_lock(m_cs);
     m_buffering = true;
     if (m_fileout != nullptr) fclose(m_fileout);
@@ -195,14 +201,14 @@ std::vector<LogCategory> BCLog::Logger::LogCategoriesList()
     return ret;
 }
 
-std::string BCLog::Logger::LogTimestampStr(const std::string& str)
+std::string BCLog::Logger::LogTimestampStr(const std::string& str, bool started_new_line)
 {
     std::string strStamped;
 
     if (!m_log_timestamps)
         return str;
 
-    if (m_started_new_line) {
+    if (started_new_line) {
         int64_t nTimeMicros = GetTimeMicros();
         strStamped = FormatISO8601DateTime(nTimeMicros/1000000);
         if (m_log_time_micros) {
@@ -242,32 +248,27 @@ namespace BCLog {
     }
 }
 
-void BCLog::Logger::LogPrintStr(const std::string& str)
+std::string BCLog::Logger::FormatLogStr(const std::string& str)
 {
-    StdLockGuard scoped_lock(m_cs);
+    const bool started_new_line = m_started_new_line.exchange(!str.empty() && str[str.size()-1] == '\n');
     std::string str_prefixed = LogEscapeMessage(str);
 
-    if (m_log_threadnames && m_started_new_line) {
+    if (m_log_threadnames && started_new_line) {
         str_prefixed.insert(0, "[" + util::ThreadGetInternalName() + "] ");
     }
 
-    str_prefixed = LogTimestampStr(str_prefixed);
-
-    m_started_new_line = !str.empty() && str[str.size()-1] == '\n';
-
-    if (m_buffering) {
-        // buffer if we haven't started logging yet
-        m_msgs_before_open.push_back(str_prefixed);
-        return;
-    }
+    return LogTimestampStr(str_prefixed, started_new_line);
+}
 
+void BCLog::Logger::WriteLogStr(const std::string& str)
+{
     if (m_print_to_console) {
         // print to console
-        fwrite(str_prefixed.data(), 1, str_prefixed.size(), stdout);
+        fwrite(str.data(), 1, str.size(), stdout);
         fflush(stdout);
     }
     for (const auto& cb : m_print_callbacks) {
-        cb(str_prefixed);
+        cb(str);
     }
     if (m_print_to_file) {
         assert(m_fileout != nullptr);
@@ -282,8 +283,208 @@ void BCLog::Logger::LogPrintStr(const std::string& str)
                 m_fileout = new_fileout;
             }
         }
-        FileWriteStr(str_prefixed, m_fileout);
+        FileWriteStr(str, m_fileout);
+    }
+}
+
+void BCLog::Logger::LogPrintStr(const std::string& str)
+{
+    if (m_async_running.load(std::memory_order_acquire) && PushAsync(str)) {
+        return;
+    }
+
+    StdLockGuard scoped_lock(m_cs);
+    std::string str_prefixed = FormatLogStr(str);
+
+    if (m_buffering) {
+        // buffer if we haven't started logging yet
+        m_msgs_before_open.push_back(str_prefixed);
+        return;
+    }
+
+    WriteLogStr(str_prefixed);
+}
+
+namespace BCLog {
+
+/**
+ * Bounded multi producer queue of formatted log records. Each cell carries a sequence number telling
+ * whether it is free for the producer at that position or filled for the consumer, so pushing and
+ * popping only take a compare and swap of the position.
+ */
+class AsyncLogWriter
+{
+private:
+    struct Cell {
+        std::atomic<size_t> seq{0};
+        std::string record;
+    };
+    /**
+     * A position padded out to its own cache line. Padding rather than alignas(64) keeps the
+     * writer at the default alignment, which plain new only guarantees before C++17.
+     */
+    struct Position {
+        char pad_before[64];
+        std::atomic<size_t> value{0};
+        char pad_after[64 - sizeof(std::atomic<size_t>)];
+    };
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    Position m_push_pos;
+    Position m_pop_pos;
+
+public:
+    const bool m_drop_on_overflow;
+    const std::chrono::milliseconds m_flush_interval;
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<bool> m_stop{false};
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    std::thread m_thread;
+
+    AsyncLogWriter(size_t size, bool drop_on_overflow, std::chrono::milliseconds flush_interval)
+        : m_mask(size - 1), m_cells(new Cell[size]), m_drop_on_overflow(drop_on_overflow), m_flush_interval(flush_interval)
+    {
+        for (size_t i = 0; i < size; ++i) {
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Capacity() const { return m_mask + 1; }
+    size_t Size() const { return m_push_pos.value.load(std::memory_order_relaxed) - m_pop_pos.value.load(std::memory_order_relaxed); }
+
+    /** Move record in, leaves it untouched when full */
+    bool TryPush(std::string& record)
+    {
+        size_t pos = m_push_pos.value.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const intptr_t diff = (intptr_t)cell->seq.load(std::memory_order_acquire) - (intptr_t)pos;
+            if (diff == 0) {
+                if (m_push_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_push_pos.value.load(std::memory_order_relaxed);
+            }
+        }
+        cell->record = std::move(record);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Only called from the writer thread */
+    bool TryPop(std::string& record)
+    {
+        const size_t pos = m_pop_pos.value.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[pos & m_mask];
+        if (cell.seq.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        m_pop_pos.value.store(pos + 1, std::memory_order_relaxed);
+        record = std::move(cell.record);
+        cell.record.clear();
+        cell.seq.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+} // namespace BCLog
+
+bool BCLog::Logger::PushAsync(const std::string& str)
+{
+    m_async_producers++;
+    if (!m_async_running.load()) {
+        m_async_producers--;
+        return false;
+    }
+
+    std::string record = FormatLogStr(str);
+    while (!m_async->TryPush(record)) {
+        if (m_async->m_drop_on_overflow) {
+            m_async->m_dropped++;
+            break;
+        }
+        m_async->m_wake.notify_one();
+        std::this_thread::yield();
+    }
+    if (m_async->Size() >= m_async->Capacity() / 2) {
+        m_async->m_wake.notify_one();
+    }
+    m_async_producers--;
+    return true;
+}
+
+bool BCLog::Logger::DrainAsync()
+{
+    // Written in one call, the file is unbuffered
+    std::string out, record;
+    while (m_async->TryPop(record)) {
+        out += record;
+    }
+    const uint64_t dropped = m_async->m_dropped.exchange(0);
+    if (dropped > 0) {
+        out += LogTimestampStr(strprintf("%u log messages dropped, the async log buffer was full\n", dropped), true);
+    }
+    if (out.empty()) {
+        return false;
+    }
+    StdLockGuard scoped_lock(m_cs);
+    WriteLogStr(out);
+    return true;
+}
+
+void BCLog::Logger::AsyncWriterThread()
+{
+    util::ThreadRename("logwriter");
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_async->m_wake_mutex);
+            m_async->m_wake.wait_for(lock, m_async->m_flush_interval, [this] {
+                return m_async->m_stop.load() || m_async->Size() >= m_async->Capacity() / 2;
+            });
+        }
+        // Stop is only set once no thread can push anymore, the drain after seeing it is the last
+        const bool stop = m_async->m_stop.load();
+        DrainAsync();
+        if (stop) {
+            break;
+        }
+    }
+}
+
+void BCLog::Logger::StartAsync(size_t buffer_size, bool drop_on_overflow, std::chrono::milliseconds flush_interval)
+{
+    assert(!m_async_running);
+    size_t size = 2;
+    while (size < buffer_size) {
+        size <<= 1;
+    }
+    m_async = new AsyncLogWriter(size, drop_on_overflow, std::max(flush_interval, std::chrono::milliseconds{1}));
+    m_async->m_thread = std::thread(&BCLog::Logger::AsyncWriterThread, this);
+    m_async_running = true;
+}
+
+void BCLog::Logger::StopAsync()
+{
+    if (!m_async_running) {
+        return;
+    }
+    m_async_running = false;
+    while (m_async_producers.load() > 0) {
+        std::this_thread::yield();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_async->m_wake_mutex);
+        m_async->m_stop = true;
     }
+    m_async->m_wake.notify_one();
+    m_async->m_thread.join();
+    delete m_async;
+    m_async = nullptr;
 }
 
 void BCLog::Logger::ShrinkDebugFile()
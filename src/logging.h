@@ -12,6 +12,7 @@
 #include <util/string.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <list>
 #include <mutex>
@@ -22,6 +23,12 @@ static const bool DEFAULT_LOGTIMEMICROS = false;
 static const bool DEFAULT_LOGIPS        = false;
 static const bool DEFAULT_LOGTIMESTAMPS = true;
 static const bool DEFAULT_LOGTHREADNAMES = false;
+static const bool DEFAULT_LOGASYNC = false;
+//! -logasyncbuffer default, records
+static const size_t DEFAULT_LOGASYNC_BUFFER = 8192;
+//! -logasyncflushinterval default, milliseconds
+static const int64_t DEFAULT_LOGASYNC_FLUSH_INTERVAL = 100;
+extern const char * const DEFAULT_LOGASYNC_OVERFLOW;
 extern const char * const DEFAULT_DEBUGLOGFILE;
 
 extern bool fLogIPs;
@@ -65,6 +72,8 @@ namespace BCLog {
         ALL         = ~(uint32_t)0,
     };
 
+    class AsyncLogWriter;
+
     class Logger
     {
     private:
@@ -84,7 +93,20 @@ namespace BCLog {
         /** Log categories bitfield. */
         std::atomic<uint32_t> m_categories{0};
 
-        std::string LogTimestampStr(const std::string& str);
+        std::string LogTimestampStr(const std::string& str, bool started_new_line);
+        /** Escape str and add the thread name and timestamp prefixes */
+        std::string FormatLogStr(const std::string& str);
+        void WriteLogStr(const std::string& str) EXCLUSIVE_LOCKS_REQUIRED(m_cs);
+
+        /** Async mode state, owned from StartAsync to StopAsync */
+        AsyncLogWriter* m_async{nullptr};
+        std::atomic<bool> m_async_running{false};
+        /** Threads inside LogPrintStr's async path, StopAsync waits for them before the last drain */
+        std::atomic<int> m_async_producers{0};
+        bool PushAsync(const std::string& str);
+        void AsyncWriterThread();
+        /** Write out the queued records, returns false if there were none */
+        bool DrainAsync();
 
         /** Slots that connect to the print signal */
         std::list<std::function<void(const std::string&)>> m_print_callbacks GUARDED_BY(m_cs) {};
@@ -127,6 +149,16 @@ namespace BCLog {
 
         /** Start logging (and flush all buffered messages) */
         bool StartLogging();
+        /**
+         * Hand log records to a writer thread through a lock-free ring of buffer_size records, flushed to the
+         * outputs every flush_interval or sooner when half full. When the ring is full the logging thread waits
+         * for space, or with drop_on_overflow the record is dropped and a count of dropped records is logged.
+         * Records still queued at a crash are lost.
+         */
+        void StartAsync(size_t buffer_size, bool drop_on_overflow, std::chrono::milliseconds flush_interval);
+        /** Write out the queued records and return to logging on the calling thread */
+        void StopAsync();
+        bool IsAsync() const { return m_async_running.load(); }
         /** Only for testing */
         void DisconnectTestLogger();
 
@@ -150,7 +150,14 @@ std::unique_ptr<CBlockTemplate> BlockAssembler::CreateNewBlock(const CScript& sc
 
     int nPackagesSelected = 0;
     int nDescendantsUpdated = 0;
-    addPackageTxs(nPackagesSelected, nDescendantsUpdated);
+    if (m_mempool.m_block_candidates.IsStale()) {
+        std::vector<BlockCandidateSet::Package> candidates;
+        addPackageTxs(nPackagesSelected, nDescendantsUpdated, &candidates);
+        m_mempool.m_block_candidates.Set(std::move(candidates));
+        inBlock.clear();
+        nPackagesSelected = 0;
+    }
+    addCandidateTxs(nPackagesSelected);
 
     int64_t nTime1 = GetTimeMicros();
 
@@ -226,7 +233,7 @@ bool BlockAssembler::TestPackage(uint64_t packageSize, int64_t packageSigOpsCost
 // - transaction finality (locktime)
 // - premature witness (in case segwit transactions are added to mempool before
 //   segwit activation)
-bool BlockAssembler::TestPackageTransactions(const CTxMemPool::setEntries& package)
+bool BlockAssembler::TestPackageTransactions(const std::vector<CTxMemPool::txiter>& package)
 {
     for (CTxMemPool::txiter it : package) {
         if (!IsFinalTx(it->GetTx(), nHeight, nLockTimeCutoff))
@@ -319,7 +326,7 @@ void BlockAssembler::SortForBlock(const CTxMemPool::setEntries& package, std::ve
 // Each time through the loop, we compare the best transaction in
 // mapModifiedTxs with the next transaction in the mempool to decide what
 // transaction package to work on next.
-void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpdated)
+void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpdated, std::vector<BlockCandidateSet::Package>* candidates)
 {
     // mapModifiedTx will store sorted packages after they are modified
     // because some of their txs are already in the block
@@ -387,12 +394,12 @@ void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpda
             packageSigOpsCost = modit->nSigOpCostWithAncestors;
         }
 
-        if (packageFees < blockMinFeeRate.GetFee(packageSize)) {
+        if (!candidates && packageFees < blockMinFeeRate.GetFee(packageSize)) {
             // Everything else we might consider has a lower fee rate
             return;
         }
 
-        if (!TestPackage(packageSize, packageSigOpsCost)) {
+        if (!candidates && !TestPackage(packageSize, packageSigOpsCost)) {
             if (fUsingModified) {
                 // Since we always look at the best entry in mapModifiedTx,
                 // we must erase failed entries so that we can consider the
@@ -419,8 +426,12 @@ void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpda
         onlyUnconfirmed(ancestors);
         ancestors.insert(iter);
 
+        // Sort the entries in a valid order.
+        std::vector<CTxMemPool::txiter> sortedEntries;
+        SortForBlock(ancestors, sortedEntries);
+
         // Test if all tx's are Final
-        if (!TestPackageTransactions(ancestors)) {
+        if (!candidates && !TestPackageTransactions(sortedEntries)) {
             if (fUsingModified) {
                 mapModifiedTx.get<ancestor_score>().erase(modit);
                 failedTx.insert(iter);
@@ -431,12 +442,22 @@ void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpda
         // This transaction will make it in; reset the failed counter.
         nConsecutiveFailed = 0;
 
-        // Package can be added. Sort the entries in a valid order.
-        std::vector<CTxMemPool::txiter> sortedEntries;
-        SortForBlock(ancestors, sortedEntries);
-
+        if (candidates) {
+            BlockCandidateSet::Package package;
+            package.fees = packageFees;
+            package.size = packageSize;
+            package.sigops = packageSigOpsCost;
+            for (const CTxMemPool::txiter& it : sortedEntries) {
+                package.txs.push_back(&*it);
+            }
+            candidates->push_back(std::move(package));
+        }
         for (size_t i=0; i<sortedEntries.size(); ++i) {
-            AddToBlock(sortedEntries[i]);
+            if (candidates) {
+                inBlock.insert(sortedEntries[i]);
+            } else {
+                AddToBlock(sortedEntries[i]);
+            }
             // Erase from the modified set, if present
             mapModifiedTx.erase(sortedEntries[i]);
         }
@@ -448,6 +469,63 @@ void BlockAssembler::addPackageTxs(int &nPackagesSelected, int &nDescendantsUpda
     }
 }
 
+void BlockAssembler::addCandidateTxs(int &nPackagesSelected)
+{
+    // See addPackageTxs
+    const int64_t MAX_CONSECUTIVE_FAILURES = 1000;
+    int64_t nConsecutiveFailed = 0;
+
+    std::vector<CTxMemPool::txiter> entries;
+    for (const auto& item : m_mempool.m_block_candidates.GetPackages()) {
+        const BlockCandidateSet::Score& score = item.first;
+        const BlockCandidateSet::Package& package = item.second;
+        if (score.fees < blockMinFeeRate.GetFee(score.size)) {
+            // Everything else has a lower fee rate
+            return;
+        }
+
+        // The package was selected assuming everything before it was added
+        bool missing_ancestor = false;
+        entries.clear();
+        for (const CTxMemPoolEntry* entry : package.txs) {
+            for (const CTxMemPoolEntry& parent : entry->GetMemPoolParentsConst()) {
+                if (!inBlock.count(m_mempool.mapTx.iterator_to(parent)) &&
+                    std::find(package.txs.begin(), package.txs.end(), &parent) == package.txs.end()) {
+                    missing_ancestor = true;
+                    break;
+                }
+            }
+            if (missing_ancestor) {
+                break;
+            }
+            entries.push_back(m_mempool.mapTx.iterator_to(*entry));
+        }
+        if (missing_ancestor) {
+            continue;
+        }
+
+        if (!TestPackage(package.size, package.sigops)) {
+            ++nConsecutiveFailed;
+            if (nConsecutiveFailed > MAX_CONSECUTIVE_FAILURES && nBlockWeight >
+                    nBlockMaxWeight - 4000) {
+                // Give up if we're close to full and haven't succeeded in a while
+                break;
+            }
+            continue;
+        }
+
+        if (!TestPackageTransactions(entries)) {
+            continue;
+        }
+
+        nConsecutiveFailed = 0;
+        for (const CTxMemPool::txiter& it : entries) {
+            AddToBlock(it);
+        }
+        ++nPackagesSelected;
+    }
+}
+
 void IncrementExtraNonce(CBlock* pblock, const CBlockIndex* pindexPrev, unsigned int& nExtraNonce)
 {
     // Update nExtraNonce
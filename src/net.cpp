@@ -695,6 +695,48 @@ bool CNode::ReceiveMsgBytes(const char *pch, unsigned int nBytes, bool& complete
     return true;
 }
 
+RecvBufferPool g_recv_buffer_pool;
+
+CSerializeData RecvBufferPool::Acquire(size_t size)
+{
+    LOCK(m_mutex);
+    // Prefer the smallest buffer large enough, else the largest one
+    auto best = std::min_element(m_buffers.begin(), m_buffers.end(), [size](const CSerializeData& a, const CSerializeData& b) {
+        const bool a_fits = a.capacity() >= size, b_fits = b.capacity() >= size;
+        if (a_fits != b_fits) return a_fits;
+        return a_fits ? a.capacity() < b.capacity() : a.capacity() > b.capacity();
+    });
+    if (best == m_buffers.end()) {
+        return {};
+    }
+    std::swap(*best, m_buffers.back());
+    CSerializeData buf = std::move(m_buffers.back());
+    m_buffers.pop_back();
+    m_bytes -= buf.capacity();
+    buf.clear();
+    return buf;
+}
+
+void RecvBufferPool::Release(CSerializeData&& buf)
+{
+    const size_t capacity = buf.capacity();
+    if (capacity == 0) {
+        return;
+    }
+    LOCK(m_mutex);
+    if (m_buffers.size() >= RECV_BUFFER_POOL_COUNT || m_bytes + capacity > RECV_BUFFER_POOL_BYTES) {
+        return;
+    }
+    m_bytes += capacity;
+    m_buffers.push_back(std::move(buf));
+}
+
+size_t RecvBufferPool::Size()
+{
+    LOCK(m_mutex);
+    return m_buffers.size();
+}
+
 int V1TransportDeserializer::readHeader(const char *pch, unsigned int nBytes)
 {
     // copy data to temporary parsing buffer
@@ -729,6 +771,11 @@ int V1TransportDeserializer::readHeader(const char *pch, unsigned int nBytes)
         return -1;
     }
 
+    // The last payload was moved on, read this one into a pooled buffer
+    if (vRecv.capacity() == 0 && hdr.nMessageSize > 0) {
+        vRecv.SetBuffer(g_recv_buffer_pool.Acquire(hdr.nMessageSize));
+    }
+
     // switch state to reading message data
     in_data = true;
 
@@ -1514,7 +1561,7 @@ void CConnman::SocketHandler()
                         pnode->nProcessQueueSize += nSizeAdded;
                         pnode->fPauseRecv = pnode->nProcessQueueSize > nReceiveFloodSize;
                     }
-                    WakeMessageHandler();
+                    WakeMessageHandler(pnode);
                 }
             }
             else if (nBytes == 0)
@@ -1570,13 +1617,17 @@ void CConnman::ThreadSocketHandler()
     }
 }
 
-void CConnman::WakeMessageHandler()
+void CConnman::WakeMessageHandler(const CNode* pnode)
 {
     {
         LOCK(mutexMsgProc);
-        fMsgProcWake = true;
+        if (pnode && !fMsgProcWake.empty()) {
+            fMsgProcWake[GetMessageHandlerShard(pnode->GetId())] = true;
+        } else {
+            fMsgProcWake.assign(fMsgProcWake.size(), true);
+        }
     }
-    condMsgProc.notify_one();
+    condMsgProc.notify_all();
 }
 
 
@@ -2222,7 +2273,33 @@ void CConnman::OpenNetworkConnection(const CAddress& addrConnect, bool fCountFai
     }
 }
 
-void CConnman::ThreadMessageHandler()
+bool CConnman::ProcessMessageHandlerShard(int shard, const std::vector<CNode*>& nodes)
+{
+    bool fMoreWork = false;
+
+    for (CNode* pnode : nodes)
+    {
+        if (pnode->fDisconnect || GetMessageHandlerShard(pnode->GetId()) != shard)
+            continue;
+
+        // Receive messages
+        bool fMoreNodeWork = m_msgproc->ProcessMessages(pnode, flagInterruptMsgProc);
+        fMoreWork |= (fMoreNodeWork && !pnode->fPauseSend);
+        if (flagInterruptMsgProc)
+            return false;
+        // Send messages
+        {
+            LOCK(pnode->cs_sendProcessing);
+            m_msgproc->SendMessages(pnode);
+        }
+
+        if (flagInterruptMsgProc)
+            return false;
+    }
+    return fMoreWork;
+}
+
+void CConnman::ThreadMessageHandler(int shard)
 {
     const int64_t nTimeDecBanThreshold = 60; // TODO: make option
     int64_t nTimeNextBanReduced = GetTime() + nTimeDecBanThreshold;
@@ -2238,30 +2315,12 @@ void CConnman::ThreadMessageHandler()
             }
         }
 
-        bool fMoreWork = false;
-
-        for (CNode* pnode : vNodesCopy)
-        {
-            if (pnode->fDisconnect)
-                continue;
-
-            // Receive messages
-            bool fMoreNodeWork = m_msgproc->ProcessMessages(pnode, flagInterruptMsgProc);
-            fMoreWork |= (fMoreNodeWork && !pnode->fPauseSend);
-            if (flagInterruptMsgProc)
-                return;
-            // Send messages
-            {
-                LOCK(pnode->cs_sendProcessing);
-                m_msgproc->SendMessages(pnode);
-            }
-
-            if (flagInterruptMsgProc)
-                return;
-        }
+        bool fMoreWork = ProcessMessageHandlerShard(shard, vNodesCopy);
+        if (flagInterruptMsgProc)
+            return;
 
         int64_t nTimeNow = GetTime();
-        if (nTimeNextBanReduced < nTimeNow) {
+        if (shard == 0 && nTimeNextBanReduced < nTimeNow) {
             LOCK(cs_main);
             CheckUnreceivedHeaders(nTimeNow);
             for (auto *pnode : vNodesCopy) {
@@ -2280,9 +2339,9 @@ void CConnman::ThreadMessageHandler()
 
         WAIT_LOCK(mutexMsgProc, lock);
         if (!fMoreWork) {
-            condMsgProc.wait_until(lock, std::chrono::steady_clock::now() + std::chrono::milliseconds(100), [this]() EXCLUSIVE_LOCKS_REQUIRED(mutexMsgProc) { return fMsgProcWake; });
+            condMsgProc.wait_until(lock, std::chrono::steady_clock::now() + std::chrono::milliseconds(100), [this, shard]() EXCLUSIVE_LOCKS_REQUIRED(mutexMsgProc) { return fMsgProcWake[shard]; });
         }
-        fMsgProcWake = false;
+        fMsgProcWake[shard] = false;
     }
 }
 
@@ -2554,7 +2613,7 @@ bool CConnman::Start(CScheduler& scheduler, const Options& connOptions)
 
     {
         LOCK(mutexMsgProc);
-        fMsgProcWake = false;
+        fMsgProcWake.assign(m_num_msghand_shards, false);
     }
 
     // Send and receive from sockets, accept connections
@@ -2580,7 +2639,9 @@ bool CConnman::Start(CScheduler& scheduler, const Options& connOptions)
         threadOpenConnections = std::thread(&TraceThread<std::function<void()> >, "opencon", std::function<void()>(std::bind(&CConnman::ThreadOpenConnections, this, connOptions.m_specified_outgoing)));
 
     // Process messages
-    threadMessageHandler = std::thread(&TraceThread<std::function<void()> >, "msghand", std::function<void()>(std::bind(&CConnman::ThreadMessageHandler, this)));
+    for (int shard = 0; shard < m_num_msghand_shards; ++shard) {
+        threadMessageHandler.emplace_back(&TraceThread<std::function<void()> >, "msghand", std::function<void()>(std::bind(&CConnman::ThreadMessageHandler, this, shard)));
+    }
 
     // Dump network addresses
     scheduler.scheduleEvery([this] { DumpAddresses(); }, DUMP_PEERS_INTERVAL);
@@ -2629,8 +2690,11 @@ void CConnman::Interrupt()
 
 void CConnman::StopThreads()
 {
-    if (threadMessageHandler.joinable())
-        threadMessageHandler.join();
+    for (auto& thread : threadMessageHandler) {
+        if (thread.joinable())
+            thread.join();
+    }
+    threadMessageHandler.clear();
     if (threadOpenConnections.joinable())
         threadOpenConnections.join();
     if (threadOpenAddedConnections.joinable())
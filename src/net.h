@@ -90,6 +90,10 @@ static const int64_t DEFAULT_PEER_CONNECT_TIMEOUT = 60;
 static const bool DEFAULT_FORCEDNSSEED = false;
 static const size_t DEFAULT_MAXRECEIVEBUFFER = 5 * 1000;
 static const size_t DEFAULT_MAXSENDBUFFER    = 1 * 1000;
+/** Default for -msghandthreads, the number of threads processing peer messages */
+static const int DEFAULT_MSGHAND_THREADS = 1;
+/** Maximum number of message handler threads */
+static const int MAX_MSGHAND_THREADS = 16;
 
 typedef int64_t NodeId;
 
@@ -217,6 +221,7 @@ public:
         uint64_t nMaxOutboundTimeframe = 0;
         uint64_t nMaxOutboundLimit = 0;
         int64_t m_peer_connect_timeout = DEFAULT_PEER_CONNECT_TIMEOUT;
+        int m_msghand_threads = DEFAULT_MSGHAND_THREADS;
         std::vector<std::string> vSeedNodes;
         std::vector<NetWhitelistPermissions> vWhitelistedRange;
         std::vector<NetWhitebindPermissions> vWhiteBinds;
@@ -244,6 +249,7 @@ public:
         nSendBufferMaxSize = connOptions.nSendBufferMaxSize;
         nReceiveFloodSize = connOptions.nReceiveFloodSize;
         m_peer_connect_timeout = connOptions.m_peer_connect_timeout;
+        m_num_msghand_shards = std::max(1, std::min(connOptions.m_msghand_threads, MAX_MSGHAND_THREADS));
         {
             LOCK(cs_totalBytesSent);
             nMaxOutboundTimeframe = connOptions.nMaxOutboundTimeframe;
@@ -399,7 +405,8 @@ public:
 
     unsigned int GetReceiveFloodSize() const;
 
-    void WakeMessageHandler();
+    /** Wake the message handler thread of pnode, or all of them if pnode is null */
+    void WakeMessageHandler(const CNode* pnode = nullptr);
 
     /** Attempts to obfuscate tx time through exponentially distributed emitting.
         Works assuming that a single interval is used.
@@ -430,7 +437,18 @@ public:
     void AddAddrFetch(const std::string& strDest);
     void ProcessAddrFetch();
     void ThreadOpenConnections(std::vector<std::string> connect);
-    void ThreadMessageHandler();
+    /**
+     * Peers are split over the message handler threads by id, a peer's
+     * messages are always processed on the same thread, in order. Peer state
+     * only touched from the message handler stays single threaded. State
+     * shared between peers is guarded as before: cs_main for validation,
+     * node state and TxRequestTracker, g_cs_orphans for the orphan pool,
+     * g_peer_mutex and the Peer mutexes for the peer map and misbehavior.
+     */
+    void ThreadMessageHandler(int shard);
+    int GetMessageHandlerShard(NodeId id) const { return id % m_num_msghand_shards; }
+    /** Process and send the messages of the nodes in shard, true if there's more work */
+    bool ProcessMessageHandlerShard(int shard, const std::vector<CNode*>& nodes);
     void AcceptConnection(const ListenSocket& hListenSocket);
     void DisconnectNodes();
     void NotifyNumConnectionsChanged();
@@ -584,8 +602,9 @@ public:
     /** SipHasher seeds for deterministic randomness */
     const uint64_t nSeed0, nSeed1;
 
-    /** flag for waking the message processor. */
-    bool fMsgProcWake GUARDED_BY(mutexMsgProc);
+    /** flags for waking the message processor, one per message handler thread. */
+    std::vector<bool> fMsgProcWake GUARDED_BY(mutexMsgProc);
+    int m_num_msghand_shards{DEFAULT_MSGHAND_THREADS};
 
     std::condition_variable condMsgProc;
     Mutex mutexMsgProc;
@@ -597,7 +616,7 @@ public:
     std::thread threadSocketHandler;
     std::thread threadOpenAddedConnections;
     std::thread threadOpenConnections;
-    std::thread threadMessageHandler;
+    std::vector<std::thread> threadMessageHandler;
 
     /** flag for deciding to connect to an extra outbound peer,
      *  in excess of m_max_outbound_full_relay
@@ -738,6 +757,33 @@ public:
  * Ideally it should only contain receive time, payload,
  * command and size.
  */
+/** Number of receive buffers kept for reuse */
+static const size_t RECV_BUFFER_POOL_COUNT = 64;
+/** Capacity of the receive buffers kept for reuse, in bytes */
+static const size_t RECV_BUFFER_POOL_BYTES = 32 * 1024 * 1024;
+
+/**
+ * Receive buffers of finished messages kept for the next ones. A payload is
+ * read into a pooled buffer and moved on to processing, the buffer comes
+ * back with its capacity once the message is done with. Large messages then
+ * rarely grow a fresh buffer in steps, copying what was read so far at each.
+ */
+class RecvBufferPool
+{
+public:
+    /** The smallest pooled buffer holding size bytes, else the largest, cleared */
+    CSerializeData Acquire(size_t size);
+    void Release(CSerializeData&& buf);
+    size_t Size();
+
+private:
+    Mutex m_mutex;
+    std::vector<CSerializeData> m_buffers GUARDED_BY(m_mutex);
+    size_t m_bytes GUARDED_BY(m_mutex){0};
+};
+
+extern RecvBufferPool g_recv_buffer_pool;
+
 class CNetMessage {
 public:
     CDataStream m_recv;                  //!< received message data
@@ -747,6 +793,13 @@ public:
     std::string m_command;
 
     CNetMessage(CDataStream&& recv_in) : m_recv(std::move(recv_in)) {}
+    CNetMessage(CNetMessage&&) = default;
+    CNetMessage& operator=(CNetMessage&&) = default;
+    ~CNetMessage()
+    {
+        // m_recv is empty if the payload was moved on
+        g_recv_buffer_pool.Release(m_recv.TakeBuffer());
+    }
 
     void SetVersion(int nVersionIn)
     {
@@ -32,6 +32,7 @@
 #include <validation.h>
 
 #include <smsg/smessage.h>
+#include <anon.h>
 
 #include <memory>
 #include <typeinfo>
@@ -94,6 +95,17 @@ static constexpr std::chrono::microseconds GETDATA_TX_INTERVAL{std::chrono::seco
 static const unsigned int MAX_GETDATA_SZ = 1000;
 /** Number of blocks that can be requested at any given time from a single peer. */
 static const int MAX_BLOCKS_IN_TRANSIT_PER_PEER = 16;
+/** Bounds of the blocks in flight from a peer, scaled from MAX_BLOCKS_IN_TRANSIT_PER_PEER by how
+ *  fast the peer serves blocks relative to all peers. */
+static const int MIN_BLOCKS_IN_TRANSIT_PER_SLOW_PEER = 4;
+static const int MAX_BLOCKS_IN_TRANSIT_PER_FAST_PEER = 32;
+/** Weight of a new sample in the block download time and rate averages */
+static const double BLOCK_DOWNLOAD_EWMA_WEIGHT = 0.2;
+/** A block holding back the download window is requested from a faster peer once it has been in
+ *  flight this many times longer than its peer usually takes per block, and at least
+ *  BLOCK_REASSIGN_MIN_WAIT. */
+static const int BLOCK_REASSIGN_FACTOR = 4;
+static constexpr std::chrono::milliseconds BLOCK_REASSIGN_MIN_WAIT{1000};
 /** Timeout in seconds during which a peer must stall block download progress before being disconnected. */
 static const unsigned int BLOCK_STALLING_TIMEOUT = 2;
 /** Number of headers sent in one getheaders result. We rely on the assumption that if a peer sends
@@ -155,6 +167,12 @@ static constexpr double MAX_ADDR_RATE_PER_SECOND{0.1};
  *  based increments won't go above this, but the MAX_ADDR_TO_SEND increment following GETADDR
  *  is exempt from this limit. */
 static constexpr size_t MAX_ADDR_PROCESSING_TOKEN_BUCKET{MAX_ADDR_TO_SEND};
+/** The average transaction validation cost, see GetTransactionValidationCost, a peer may spend
+ *  per second, about one anon transaction of maximal rings and inputs. Can be bypassed using the
+ *  NetPermissionFlags::NoBan permission. */
+static constexpr double MAX_TX_COST_PER_SECOND{2000};
+/** The limit of the transaction validation cost bucket, the burst a peer may send before it is slowed down */
+static constexpr double MAX_TX_COST_BUCKET{40000};
 
 struct COrphanTx {
     // When modifying, adapt the copy of this definition in tests/DoS_tests.
@@ -250,9 +268,13 @@ namespace {
         const CBlockIndex* pindex;                               //!< Optional.
         bool fValidatedHeaders;                                  //!< Whether this block has validated headers at the time of request.
         std::unique_ptr<PartiallyDownloadedBlock> partialBlock;  //!< Optional, used for CMPCTBLOCK downloads
+        int64_t m_requested_time;                                //!< When the block was requested (in microseconds).
     };
     std::map<uint256, std::pair<NodeId, std::list<QueuedBlock>::iterator> > mapBlocksInFlight GUARDED_BY(cs_main);
 
+    /** Average microseconds any peer takes to serve a requested block, or 0 before the first sample. */
+    double g_block_download_time GUARDED_BY(cs_main) = 0;
+
     /** Stack of nodes which we have set to announce using compact blocks */
     std::list<NodeId> lNodesAnnouncingHeaderAndIDs GUARDED_BY(cs_main);
 
@@ -289,15 +311,22 @@ namespace {
     /** Index from the parents' COutPoint into the mapOrphanTransactions. Used
      *  to remove orphan transactions from the mapOrphanTransactions */
     std::map<COutPoint, std::set<std::map<uint256, COrphanTx>::iterator, IteratorComparator>> mapOrphanTransactionsByPrev GUARDED_BY(g_cs_orphans);
+    /** Index from the highest ring member an orphan anon transaction references
+     *  into the mapOrphanTransactions. The orphans are reconsidered once that
+     *  output is deep enough in the chain to be spent */
+    std::multimap<int64_t, std::map<uint256, COrphanTx>::iterator> g_orphans_by_anon_index GUARDED_BY(g_cs_orphans);
     /** Orphan transactions in vector for quick random eviction */
     std::vector<std::map<uint256, COrphanTx>::iterator> g_orphan_list GUARDED_BY(g_cs_orphans);
 
     /** Orphan/conflicted/etc transactions that are kept for compact block reconstruction.
      *  The last -blockreconstructionextratxn/DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN of
-     *  these are kept in a ring buffer */
+     *  these are kept in a ring buffer, followed by a ring buffer of the last
+     *  -blockreconstructionextraprivatetxn CT/RingCT transactions */
     static std::vector<std::pair<uint256, CTransactionRef>> vExtraTxnForCompact GUARDED_BY(g_cs_orphans);
     /** Offset into vExtraTxnForCompact to insert the next tx */
     static size_t vExtraTxnForCompactIt GUARDED_BY(g_cs_orphans) = 0;
+    /** Offset into the CT/RingCT part of vExtraTxnForCompact to insert the next tx */
+    static size_t vExtraPrivateTxnForCompactIt GUARDED_BY(g_cs_orphans) = 0;
 } // namespace
 
 namespace {
@@ -333,6 +362,12 @@ struct CNodeState {
     int64_t nDownloadingSince;
     int nBlocksInFlight;
     int nBlocksInFlightValidHeaders;
+    //! Average microseconds the peer takes to serve a requested block, or 0 before the first sample.
+    double m_block_download_time{0};
+    //! Average bytes per second of the blocks the peer served.
+    double m_block_download_rate{0};
+    //! When the peer last delivered a requested block (in microseconds).
+    int64_t m_last_block_received{0};
     //! Whether we consider this a preferred download peer.
     bool fPreferredDownload;
     //! Whether this peer wants invs or headers (when possible) for block announcements.
@@ -506,6 +541,15 @@ struct Peer {
     /** Total number of addresses that were processed (excludes rate limited ones). */
     std::atomic<uint64_t> m_addr_processed{0};
 
+    /** Validation cost the transactions of this peer may still use. Charged before a transaction is
+     *  validated, so it goes negative after an expensive one; the peer's transactions then wait until
+     *  the bucket refills at MAX_TX_COST_PER_SECOND. */
+    double m_tx_cost_bucket{MAX_TX_COST_BUCKET};
+    /** When m_tx_cost_bucket was last updated */
+    std::chrono::microseconds m_tx_cost_timestamp{GetTime<std::chrono::microseconds>()};
+    /** Number of times the transactions of this peer went over the bucket and were deferred */
+    std::atomic<uint64_t> m_txs_deferred{0};
+
     Peer(NodeId id) : m_id(id) {}
 };
 
@@ -520,6 +564,15 @@ using PeerRef = std::shared_ptr<Peer>;
 Mutex g_peer_mutex;
 static std::map<NodeId, PeerRef> g_peer_map GUARDED_BY(g_peer_mutex);
 
+/** Refill the transaction validation cost bucket of peer for the time since it was last updated */
+static void RefillTxCostBucket(Peer& peer, std::chrono::microseconds current_time)
+{
+    const auto time_diff = std::max(current_time - peer.m_tx_cost_timestamp, std::chrono::microseconds{0});
+    const double increment = std::chrono::duration<double>(time_diff).count() * MAX_TX_COST_PER_SECOND;
+    peer.m_tx_cost_bucket = std::min<double>(peer.m_tx_cost_bucket + increment, MAX_TX_COST_BUCKET);
+    peer.m_tx_cost_timestamp = current_time;
+}
+
 /** Get a shared pointer to the Peer object.
  *  May return nullptr if the Peer object can't be found. */
 static PeerRef GetPeerRef(NodeId id)
@@ -609,7 +662,7 @@ static bool MarkBlockAsInFlight(CTxMemPool& mempool, NodeId nodeid, const uint25
     MarkBlockAsReceived(hash);
 
     std::list<QueuedBlock>::iterator it = state->vBlocksInFlight.insert(state->vBlocksInFlight.end(),
-            {hash, pindex, pindex != nullptr, std::unique_ptr<PartiallyDownloadedBlock>(pit ? new PartiallyDownloadedBlock(&mempool) : nullptr)});
+            {hash, pindex, pindex != nullptr, std::unique_ptr<PartiallyDownloadedBlock>(pit ? new PartiallyDownloadedBlock(&mempool) : nullptr), GetTime<std::chrono::microseconds>().count()});
     state->nBlocksInFlight++;
     state->nBlocksInFlightValidHeaders += it->fValidatedHeaders;
     if (state->nBlocksInFlight == 1) {
@@ -625,6 +678,36 @@ static bool MarkBlockAsInFlight(CTxMemPool& mempool, NodeId nodeid, const uint25
     return true;
 }
 
+/** Update the download time and rate of a peer that delivered a block requested from it. */
+static void RecordBlockDownload(NodeId nodeid, const uint256& hash, size_t nBytes, int64_t nNow) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+    auto itInFlight = mapBlocksInFlight.find(hash);
+    if (itInFlight == mapBlocksInFlight.end() || itInFlight->second.first != nodeid) {
+        return;
+    }
+    CNodeState *state = State(nodeid);
+    assert(state != nullptr);
+    // Requests are pipelined, the peer starts on a block once it has sent the previous one
+    int64_t nStart = std::max(itInFlight->second.second->m_requested_time, state->m_last_block_received);
+    double nTime = std::max(nNow - nStart, (int64_t)1);
+    double nRate = nBytes * 1000000.0 / nTime;
+    state->m_last_block_received = nNow;
+    auto ewma = [](double& avg, double sample) {
+        avg = avg > 0 ? avg + (sample - avg) * BLOCK_DOWNLOAD_EWMA_WEIGHT : sample;
+    };
+    ewma(state->m_block_download_time, nTime);
+    ewma(state->m_block_download_rate, nRate);
+    ewma(g_block_download_time, nTime);
+}
+
+/** Number of blocks to keep in flight from a peer, more for peers serving blocks faster than average. */
+static int BlocksInTransitLimit(const CNodeState& state) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
+    if (state.m_block_download_time <= 0 || g_block_download_time <= 0) {
+        return MAX_BLOCKS_IN_TRANSIT_PER_PEER;
+    }
+    long nLimit = std::lround(MAX_BLOCKS_IN_TRANSIT_PER_PEER * g_block_download_time / state.m_block_download_time);
+    return std::max(MIN_BLOCKS_IN_TRANSIT_PER_SLOW_PEER, (int)std::min(nLimit, (long)MAX_BLOCKS_IN_TRANSIT_PER_FAST_PEER));
+}
+
 /** Check whether the last unknown block a peer advertised is not yet known. */
 static void ProcessBlockAvailability(NodeId nodeid) EXCLUSIVE_LOCKS_REQUIRED(cs_main) {
     CNodeState *state = State(nodeid);
@@ -960,6 +1043,9 @@ bool GetNodeStateStats(NodeId nodeid, CNodeStateStats &stats) {
             if (queue.pindex)
                 stats.vHeightInFlight.push_back(queue.pindex->nHeight);
         }
+        stats.m_block_download_time = (int64_t)state->m_block_download_time;
+        stats.m_block_download_rate = state->m_block_download_rate;
+        stats.m_blocks_in_transit_limit = BlocksInTransitLimit(*state);
         auto it = map_dos_state.find(state->address);
         if (it != map_dos_state.end()) {
             stats.nDuplicateCount = it->second.m_duplicate_count;
@@ -972,6 +1058,7 @@ bool GetNodeStateStats(NodeId nodeid, CNodeStateStats &stats) {
     stats.m_misbehavior_score = WITH_LOCK(peer->m_misbehavior_mutex, return peer->m_misbehavior_score);
     stats.m_addr_processed = peer->m_addr_processed.load();
     stats.m_addr_rate_limited = peer->m_addr_rate_limited.load();
+    stats.m_txs_deferred = peer->m_txs_deferred.load();
 
     return true;
 }
@@ -981,13 +1068,27 @@ bool GetNodeStateStats(NodeId nodeid, CNodeStateStats &stats) {
 // mapOrphanTransactions
 //
 
+/** Rejected txn up to this memory usage are kept for compact block reconstruction */
+static const size_t MAX_EXTRA_TXN_USAGE = 100000;
+/** CT/RingCT txn carry their proofs, a few inputs and outputs already go past MAX_EXTRA_TXN_USAGE */
+static const size_t MAX_EXTRA_PRIVATE_TXN_USAGE = 500000;
+
 static void AddToCompactExtraTransactions(const CTransactionRef& tx) EXCLUSIVE_LOCKS_REQUIRED(g_cs_orphans)
 {
     size_t max_extra_txn = gArgs.GetArg("-blockreconstructionextratxn", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN);
-    if (max_extra_txn <= 0)
+    size_t max_extra_private_txn = gArgs.GetArg("-blockreconstructionextraprivatetxn", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_PRIVATE_TXN);
+    if (max_extra_txn + max_extra_private_txn <= 0)
         return;
     if (!vExtraTxnForCompact.size())
-        vExtraTxnForCompact.resize(max_extra_txn);
+        vExtraTxnForCompact.resize(max_extra_txn + max_extra_private_txn);
+    // CT/RingCT txn are kept apart so a flood of plain txn doesn't push them out
+    if (max_extra_private_txn > 0 && GetFeeEstimateTxType(*tx) != FeeEstimateTxType::PLAIN) {
+        vExtraTxnForCompact[max_extra_txn + vExtraPrivateTxnForCompactIt] = std::make_pair(tx->GetWitnessHash(), tx);
+        vExtraPrivateTxnForCompactIt = (vExtraPrivateTxnForCompactIt + 1) % max_extra_private_txn;
+        return;
+    }
+    if (max_extra_txn <= 0)
+        return;
     vExtraTxnForCompact[vExtraTxnForCompactIt] = std::make_pair(tx->GetWitnessHash(), tx);
     vExtraTxnForCompactIt = (vExtraTxnForCompactIt + 1) % max_extra_txn;
 }
@@ -1022,6 +1123,10 @@ bool AddOrphanTx(const CTransactionRef& tx, NodeId peer) EXCLUSIVE_LOCKS_REQUIRE
             continue;
         mapOrphanTransactionsByPrev[txin.prevout].insert(ret.first);
     }
+    const int64_t anon_index = GetHighestRingMemberIndex(*tx);
+    if (anon_index >= 0) {
+        g_orphans_by_anon_index.emplace(anon_index, ret.first);
+    }
 
     AddToCompactExtraTransactions(tx);
 
@@ -1046,6 +1151,16 @@ int static EraseOrphanTx(uint256 hash) EXCLUSIVE_LOCKS_REQUIRED(g_cs_orphans)
         if (itPrev->second.empty())
             mapOrphanTransactionsByPrev.erase(itPrev);
     }
+    const int64_t anon_index = GetHighestRingMemberIndex(*it->second.tx);
+    if (anon_index >= 0) {
+        auto range = g_orphans_by_anon_index.equal_range(anon_index);
+        for (auto ait = range.first; ait != range.second; ++ait) {
+            if (ait->second == it) {
+                g_orphans_by_anon_index.erase(ait);
+                break;
+            }
+        }
+    }
 
     size_t old_pos = it->second.list_pos;
     assert(g_orphan_list[old_pos] == it);
@@ -1574,6 +1689,27 @@ void PeerManager::BlockConnected(const std::shared_ptr<const CBlock>& pblock, co
             LogPrint(BCLog::MEMPOOL, "Erased %d orphan tx included or conflicted by block\n", nErased);
         }
 
+        // Reconsider the anon orphans whose ring members can now be spent, all
+        // outputs up to the ready index are at least nMinRCTOutputDepth deep
+        const int ready_height = pindex->nHeight + 2 - Params().GetConsensus().nMinRCTOutputDepth;
+        const CBlockIndex* pready = ready_height < 0 ? nullptr : pindex->GetAncestor(std::min(ready_height, pindex->nHeight));
+        if (pready && !g_orphans_by_anon_index.empty()) {
+            auto end = g_orphans_by_anon_index.upper_bound(pready->nAnonOutputs);
+            std::map<NodeId, std::vector<uint256>> ready_by_peer;
+            for (auto it = g_orphans_by_anon_index.begin(); it != end; ++it) {
+                ready_by_peer[it->second->second.fromPeer].push_back(it->second->first);
+            }
+            g_orphans_by_anon_index.erase(g_orphans_by_anon_index.begin(), end);
+            for (const auto& ready : ready_by_peer) {
+                PeerRef peer = GetPeerRef(ready.first);
+                if (!peer) {
+                    continue;
+                }
+                peer->m_orphan_work_set.insert(ready.second.begin(), ready.second.end());
+                LogPrint(BCLog::MEMPOOL, "Reconsidering %d anon orphan tx from peer=%d\n", ready.second.size(), ready.first);
+            }
+        }
+
         g_last_tip_update = GetTime();
     }
     {
@@ -1920,10 +2056,9 @@ void static ProcessGetBlockData(CNode& pfrom, const CChainParams& chainparams, c
             // Don't set pblock as we've sent the block
         } else {
             // Send block from disk
-            std::shared_ptr<CBlock> pblockRead = std::make_shared<CBlock>();
-            if (!ReadBlockFromDisk(*pblockRead, pindex, consensusParams))
+            pblock = ReadSharedBlockFromDisk(pindex, consensusParams);
+            if (!pblock)
                 assert(!"cannot load block from disk");
-            pblock = pblockRead;
         }
         if (pblock) {
             if (inv.IsMsgBlk()) {
@@ -2414,7 +2549,7 @@ void PeerManager::ProcessOrphanTx(std::set<uint256>& orphan_work_set)
  *
  * @param[in]   peer            The peer that we received the request from
  * @param[in]   chain_params    Chain parameters
- * @param[in]   filter_type     The filter type the request is for. Must be basic filters.
+ * @param[in]   filter_type     The filter type the request is for. Must be basic or particl filters.
  * @param[in]   start_height    The start height for the request
  * @param[in]   stop_hash       The stop_hash for the request
  * @param[in]   max_height_diff The maximum number of items permitted to request, as specified in BIP 157
@@ -2428,8 +2563,10 @@ static bool PrepareBlockFilterRequest(CNode& peer, const CChainParams& chain_par
                                       const CBlockIndex*& stop_index,
                                       BlockFilterIndex*& filter_index)
 {
+    // Particl filters are served alongside basic filters when their index is enabled
     const bool supported_filter_type =
-        (filter_type == BlockFilterType::BASIC &&
+        ((filter_type == BlockFilterType::BASIC ||
+          (filter_type == BlockFilterType::PARTICL && GetBlockFilterIndex(filter_type))) &&
          (peer.GetLocalServices() & NODE_COMPACT_FILTERS));
     if (!supported_filter_type) {
         LogPrint(BCLog::NET, "peer %d requested unsupported block filter type: %d\n",
@@ -3362,6 +3499,27 @@ void PeerManager::ProcessMessage(CNode& pfrom, const std::string& msg_type, CDat
         const uint256& txid = ptx->GetHash();
         const uint256& wtxid = ptx->GetWitnessHash();
 
+        // Verify signatures and proofs on the script check threads before
+        // taking the locks, AcceptToMemoryPool finds the results in the caches
+        bool already_have;
+        {
+            LOCK(cs_main);
+            already_have = AlreadyHaveTx(GenTxid(/* is_wtxid=*/true, wtxid), m_mempool);
+        }
+        if (!already_have) {
+            if (!pfrom.HasPermission(PF_NOBAN)) {
+                // Charge the estimate before the lookups and proofs, ProcessMessages holds back
+                // the next transactions of the peer while the bucket is negative
+                RefillTxCostBucket(*peer, GetTime<std::chrono::microseconds>());
+                peer->m_tx_cost_bucket -= GetTransactionValidationCost(tx);
+                if (peer->m_tx_cost_bucket < 0) {
+                    ++peer->m_txs_deferred;
+                    LogPrint(BCLog::NET, "peer=%d is over its transaction validation budget, deferring its transactions\n", pfrom.GetId());
+                }
+            }
+            PreValidateTransaction(m_mempool, ptx);
+        }
+
         LOCK2(cs_main, g_cs_orphans);
 
         CNodeState* nodestate = State(pfrom.GetId());
@@ -3531,7 +3689,8 @@ void PeerManager::ProcessMessage(CNode& pfrom, const std::string& msg_type, CDat
                     recentRejects->insert(tx.GetHash());
                     m_txrequest.ForgetTxHash(tx.GetHash());
                 }
-                if (RecursiveDynamicUsage(*ptx) < 100000) {
+                const size_t max_usage = GetFeeEstimateTxType(tx) == FeeEstimateTxType::PLAIN ? MAX_EXTRA_TXN_USAGE : MAX_EXTRA_PRIVATE_TXN_USAGE;
+                if (RecursiveDynamicUsage(*ptx) < max_usage) {
                     AddToCompactExtraTransactions(ptx);
                 }
             }
@@ -3901,6 +4060,7 @@ void PeerManager::ProcessMessage(CNode& pfrom, const std::string& msg_type, CDat
             return;
         }
 
+        const size_t nBlockBytes = vRecv.size();
         std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
         vRecv >> *pblock;
 
@@ -3912,6 +4072,7 @@ void PeerManager::ProcessMessage(CNode& pfrom, const std::string& msg_type, CDat
             LOCK(cs_main);
             // Also always process if we requested the block explicitly, as we may
             // need it even though it is not a candidate for a new best tip.
+            RecordBlockDownload(pfrom.GetId(), hash, nBlockBytes, GetTime<std::chrono::microseconds>().count());
             forceProcessing |= MarkBlockAsReceived(hash);
             // mapBlockSource is only used for punishing peers and setting
             // which peers send us compact blocks, so the race between here and
@@ -4184,7 +4345,8 @@ void PeerManager::ProcessMessage(CNode& pfrom, const std::string& msg_type, CDat
     }
 
     if (!(pfrom.IsAddrFetchConn() || pfrom.IsFeelerConn()) &&
-        smsg::SMSG_UNKNOWN_MESSAGE != smsgModule.ReceiveData(this, &pfrom, msg_type, vRecv)) {
+        smsg::SMSG_UNKNOWN_MESSAGE != smsgModule.QueueReceiveData(this, &pfrom, msg_type, vRecv)) {
+        // smsg messages are processed on the smsg net threads
         // If smsg::fSecMsgEnabled is false smsgModule.ReceiveData will ignore SMSGMsgType::PING messages to avoid the Unknown command message
         return;
     }
@@ -4281,6 +4443,14 @@ bool PeerManager::ProcessMessages(CNode* pfrom, std::atomic<bool>& interruptMsgP
         LOCK(pfrom->cs_vProcessMsg);
         if (pfrom->vProcessMsg.empty())
             return false;
+        // A transaction from a peer over its validation cost budget waits for the bucket to refill,
+        // other peers are served meanwhile. Messages stay in order, a block behind it waits too.
+        if (peer->m_tx_cost_bucket < 0 && pfrom->vProcessMsg.front().m_command == NetMsgType::TX) {
+            RefillTxCostBucket(*peer, GetTime<std::chrono::microseconds>());
+            if (peer->m_tx_cost_bucket < 0) {
+                return false;
+            }
+        }
         // Just take one message
         msgs.splice(msgs.begin(), pfrom->vProcessMsg, pfrom->vProcessMsg.begin());
         pfrom->nProcessQueueSize -= msgs.front().m_raw_message_size;
@@ -4952,10 +5122,29 @@ bool PeerManager::SendMessages(CNode* pto)
         // Message: getdata (blocks)
         //
         std::vector<CInv> vGetData;
-        if (!pto->fClient && ((fFetch && !pto->m_limited_node) || !::ChainstateActive().IsInitialBlockDownload()) && state.nBlocksInFlight < MAX_BLOCKS_IN_TRANSIT_PER_PEER) {
+        const int nMaxBlocksInTransit = BlocksInTransitLimit(state);
+        if (!pto->fClient && ((fFetch && !pto->m_limited_node) || !::ChainstateActive().IsInitialBlockDownload()) && state.nBlocksInFlight < nMaxBlocksInTransit) {
             std::vector<const CBlockIndex*> vToDownload;
             NodeId staller = -1;
-            FindNextBlocksToDownload(pto->GetId(), MAX_BLOCKS_IN_TRANSIT_PER_PEER - state.nBlocksInFlight, vToDownload, staller, consensusParams);
+            FindNextBlocksToDownload(pto->GetId(), nMaxBlocksInTransit - state.nBlocksInFlight, vToDownload, staller, consensusParams);
+            if (vToDownload.empty() && staller != -1 && staller != pto->GetId()) {
+                // The window is held back by a slower peer, ask this one for the oldest block
+                // requested from it rather than waiting for the stall timeout.
+                CNodeState *stallerState = State(staller);
+                if (stallerState && !stallerState->vBlocksInFlight.empty() && state.m_block_download_time > 0 &&
+                    state.m_block_download_time < stallerState->m_block_download_time) {
+                    const QueuedBlock& queued = stallerState->vBlocksInFlight.front();
+                    const int64_t nWait = std::max((int64_t)(BLOCK_REASSIGN_FACTOR * stallerState->m_block_download_time),
+                                                   (int64_t)count_microseconds(BLOCK_REASSIGN_MIN_WAIT));
+                    if (queued.pindex && queued.m_requested_time < count_microseconds(current_time) - nWait &&
+                        state.pindexBestKnownBlock && state.pindexBestKnownBlock->GetAncestor(queued.pindex->nHeight) == queued.pindex) {
+                        LogPrint(BCLog::NET, "Reassigning block %s (%d) from peer=%d to peer=%d\n", queued.hash.ToString(),
+                            queued.pindex->nHeight, staller, pto->GetId());
+                        vToDownload.push_back(queued.pindex);
+                        staller = -1;
+                    }
+                }
+            }
             for (const CBlockIndex *pindex : vToDownload) {
                 uint32_t nFetchFlags = GetFetchFlags(*pto);
                 vGetData.push_back(CInv(MSG_BLOCK | nFetchFlags, pindex->GetBlockHash()));
@@ -5056,6 +5245,7 @@ public:
         // orphan transactions
         mapOrphanTransactions.clear();
         mapOrphanTransactionsByPrev.clear();
+        g_orphans_by_anon_index.clear();
         g_orphans_by_wtxid.clear();
     }
 };
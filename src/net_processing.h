@@ -27,6 +27,8 @@ extern RecursiveMutex g_cs_orphans;
 static const unsigned int DEFAULT_MAX_ORPHAN_TRANSACTIONS = 100;
 /** Default number of orphan+recently-replaced txn to keep around for block reconstruction */
 static const unsigned int DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN = 100;
+/** Default number of CT/RingCT txn kept for block reconstruction on top of -blockreconstructionextratxn */
+static const unsigned int DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_PRIVATE_TXN = 100;
 static const bool DEFAULT_PEERBLOOMFILTERS = false;
 static const bool DEFAULT_PEERBLOCKFILTERS = false;
 /** Threshold for marking a node to be discouraged, e.g. disconnected and added to the discouragement filter. */
@@ -152,8 +154,12 @@ struct CNodeStateStats {
     int nSyncHeight = -1;
     int nCommonHeight = -1;
     std::vector<int> vHeightInFlight;
+    int64_t m_block_download_time = 0; //!< Average microseconds to serve a requested block
+    double m_block_download_rate = 0;  //!< Average bytes per second of served blocks
+    int m_blocks_in_transit_limit = 0;
     uint64_t m_addr_processed = 0;
     uint64_t m_addr_rate_limited = 0;
+    uint64_t m_txs_deferred = 0;
     int nDuplicateCount = 0;
     int nLooseHeadersCount = 0;
 };
@@ -0,0 +1,82 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <node/blockcache.h>
+
+#include <core_memusage.h>
+#include <memusage.h>
+
+BlockCache g_block_cache;
+
+void BlockCache::SetMaxMemory(size_t max_memory)
+{
+    LOCK(m_mutex);
+    m_max_memory = max_memory;
+    m_enabled = max_memory > 0;
+    Trim();
+}
+
+std::shared_ptr<const CBlock> BlockCache::Get(const uint256& hash)
+{
+    if (!m_enabled) {
+        return nullptr;
+    }
+    LOCK(m_mutex);
+    auto it = m_entries.find(hash);
+    if (it == m_entries.end()) {
+        m_misses++;
+        return nullptr;
+    }
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    m_hits++;
+    return it->second->block;
+}
+
+void BlockCache::Insert(const uint256& hash, const std::shared_ptr<const CBlock>& block)
+{
+    if (!m_enabled) {
+        return;
+    }
+    // Measured outside the lock, the transactions are shared with the caller
+    const size_t usage = RecursiveDynamicUsage(*block) + sizeof(CBlock) + sizeof(Entry) + 2 * sizeof(void*);
+
+    LOCK(m_mutex);
+    if (m_entries.count(hash) || usage > m_max_memory) {
+        return;
+    }
+    m_lru.push_front(Entry{hash, block, usage});
+    m_entries.emplace(hash, m_lru.begin());
+    m_usage += usage;
+    Trim();
+}
+
+void BlockCache::Trim()
+{
+    while (m_usage > m_max_memory && !m_lru.empty()) {
+        const Entry& entry = m_lru.back();
+        m_usage -= entry.usage;
+        m_entries.erase(entry.hash);
+        m_lru.pop_back();
+    }
+}
+
+void BlockCache::Clear()
+{
+    LOCK(m_mutex);
+    m_lru.clear();
+    m_entries.clear();
+    m_usage = 0;
+}
+
+BlockCacheStats BlockCache::GetStats() const
+{
+    BlockCacheStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    LOCK(m_mutex);
+    stats.entries = m_entries.size();
+    stats.usage = m_usage;
+    stats.max_usage = m_max_memory;
+    return stats;
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_NODE_BLOCKCACHE_H
+#define BITCOIN_NODE_BLOCKCACHE_H
+
+#include <crypto/common.h>
+#include <primitives/block.h>
+#include <sync.h>
+#include <uint256.h>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+/** Default for -blockcachemem, the memory in MiB held by recently read blocks, 0 disables */
+static const int64_t DEFAULT_BLOCK_CACHE_MEM = 32;
+
+struct BlockCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+    size_t usage = 0;
+    size_t max_usage = 0;
+};
+
+/**
+ * Recently read blocks, deserialized once and shared between readers.
+ *
+ * ReadBlockFromDisk looks blocks up by hash before reading them, so the
+ * kernel, insight and explorer RPCs, zmq and smsg funding checks asking for
+ * the same blocks share one decoded copy. Only blocks read in full are added,
+ * they also serve readers that skip the rangeproofs. Blocks taken from the
+ * prefetcher are not added, a sequential scan would flush the cache. The
+ * least recently used blocks are dropped once the memory held is over the
+ * limit.
+ */
+class BlockCache
+{
+public:
+    /** Set the memory limit, 0 disables the cache and drops the blocks held */
+    void SetMaxMemory(size_t max_memory);
+
+    /** Get the block with hash, null if it is not held */
+    std::shared_ptr<const CBlock> Get(const uint256& hash);
+
+    void Insert(const uint256& hash, const std::shared_ptr<const CBlock>& block);
+
+    void Clear();
+
+    BlockCacheStats GetStats() const;
+
+private:
+    struct Entry {
+        uint256 hash;
+        std::shared_ptr<const CBlock> block;
+        size_t usage;
+    };
+
+    struct HashHasher {
+        size_t operator()(const uint256& hash) const { return ReadLE64(hash.begin()); }
+    };
+
+    void Trim() EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    std::atomic<bool> m_enabled{false};
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+
+    mutable Mutex m_mutex;
+    size_t m_max_memory GUARDED_BY(m_mutex){0};
+    size_t m_usage GUARDED_BY(m_mutex){0};
+    //! Most recently used first
+    std::list<Entry> m_lru GUARDED_BY(m_mutex);
+    std::unordered_map<uint256, std::list<Entry>::iterator, HashHasher> m_entries GUARDED_BY(m_mutex);
+};
+
+extern BlockCache g_block_cache;
+
+#endif // BITCOIN_NODE_BLOCKCACHE_H
@@ -0,0 +1,244 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <node/blockprefetch.h>
+
+#include <chain.h>
+#include <chainparams.h>
+#include <core_memusage.h>
+#include <util/system.h>
+#include <validation.h>
+
+#include <algorithm>
+
+BlockPrefetcher g_block_prefetcher;
+
+BlockPrefetcher::~BlockPrefetcher()
+{
+    if (!m_threads.empty()) {
+        Stop();
+    }
+}
+
+void BlockPrefetcher::Start(int threads, int depth, size_t max_memory)
+{
+    Stop();
+    if (threads < 1 || depth < 1) {
+        return;
+    }
+    {
+        LOCK(m_mutex);
+        m_stop = false;
+        m_depth = depth;
+        m_max_memory = max_memory;
+    }
+    for (int i = 0; i < threads; ++i) {
+        m_threads.emplace_back(&TraceThread<std::function<void()>>, "blkprefetch", [this] { ThreadPrefetch(); });
+    }
+    m_running = true;
+}
+
+void BlockPrefetcher::Stop()
+{
+    m_running = false;
+    {
+        LOCK(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto& t : m_threads) {
+        t.join();
+    }
+    m_threads.clear();
+
+    LOCK(m_mutex);
+    m_streams.clear();
+    m_schedule.clear();
+    m_queue.clear();
+    m_entries.clear();
+    m_usage = 0;
+}
+
+size_t BlockPrefetcher::Size()
+{
+    LOCK(m_mutex);
+    return m_entries.size();
+}
+
+void BlockPrefetcher::Erase(std::map<const CBlockIndex*, std::shared_ptr<Entry>>::iterator it)
+{
+    if (it->second->state == EntryState::QUEUED) {
+        it->second->state = EntryState::CANCELLED;
+    }
+    m_usage -= it->second->usage;
+    m_entries.erase(it);
+}
+
+void BlockPrefetcher::NoteRead(const CBlockIndex* pindex)
+{
+    for (auto it = m_streams.begin(); it != m_streams.end(); ++it) {
+        if (*it == pindex) {
+            return;
+        }
+        if (pindex->pprev && *it == pindex->pprev) {
+            m_streams.erase(it);
+            m_streams.push_back(pindex);
+            m_schedule.push_back(pindex);
+            m_cv.notify_one();
+            return;
+        }
+    }
+    // A new reader, it's followed once it reads the next block
+    if (m_streams.size() >= MAX_BLOCK_PREFETCH_STREAMS) {
+        m_streams.pop_front();
+    }
+    m_streams.push_back(pindex);
+}
+
+bool BlockPrefetcher::EvictOne()
+{
+    // Only blocks none of the followed readers is about to reach can go
+    auto stale = m_entries.end();
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->second->state == EntryState::READING) {
+            continue;
+        }
+        const int height = it->first->nHeight;
+        bool wanted = false;
+        for (const CBlockIndex* tip : m_streams) {
+            if (height > tip->nHeight && height <= tip->nHeight + m_depth) {
+                wanted = true;
+                break;
+            }
+        }
+        if (!wanted && (stale == m_entries.end() || it->second->seq < stale->second->seq)) {
+            stale = it;
+        }
+    }
+    if (stale == m_entries.end()) {
+        return false;
+    }
+    Erase(stale);
+    return true;
+}
+
+void BlockPrefetcher::Schedule(const CBlockIndex* pindex, UniqueLock<Mutex>& lock)
+{
+    const int depth = m_depth;
+    std::vector<std::pair<const CBlockIndex*, FlatFilePos>> next;
+    {
+        REVERSE_LOCK(lock);
+        LOCK(cs_main);
+        if (::ChainActive()[pindex->nHeight] != pindex) {
+            return;
+        }
+        for (int height = pindex->nHeight + 1; height <= pindex->nHeight + depth; ++height) {
+            const CBlockIndex* pnext = ::ChainActive()[height];
+            if (!pnext || !(pnext->nStatus & BLOCK_HAVE_DATA)) {
+                break;
+            }
+            next.emplace_back(pnext, pnext->GetBlockPos());
+        }
+    }
+
+    const size_t max_entries = (size_t)depth * MAX_BLOCK_PREFETCH_STREAMS;
+    bool queued = false;
+    for (const auto& item : next) {
+        if (m_entries.count(item.first)) {
+            continue;
+        }
+        while (m_entries.size() >= max_entries || m_usage >= m_max_memory) {
+            if (!EvictOne()) {
+                break;
+            }
+        }
+        if (m_entries.size() >= max_entries || m_usage >= m_max_memory) {
+            break;
+        }
+        auto entry = std::make_shared<Entry>();
+        entry->pindex = item.first;
+        entry->hash = item.first->GetBlockHash();
+        entry->pos = item.second;
+        entry->seq = m_seq++;
+        m_entries.emplace(item.first, entry);
+        m_queue.push_back(entry);
+        queued = true;
+    }
+    if (queued) {
+        m_cv.notify_all();
+    }
+}
+
+void BlockPrefetcher::ThreadPrefetch()
+{
+    WAIT_LOCK(m_mutex, lock);
+    while (true) {
+        while (!m_stop && m_schedule.empty() && m_queue.empty()) {
+            m_cv.wait(lock);
+        }
+        if (m_stop) {
+            return;
+        }
+        if (!m_schedule.empty()) {
+            const CBlockIndex* pindex = m_schedule.front();
+            m_schedule.pop_front();
+            Schedule(pindex, lock);
+            continue;
+        }
+
+        std::shared_ptr<Entry> entry = m_queue.front();
+        m_queue.pop_front();
+        if (entry->state != EntryState::QUEUED) {
+            continue;
+        }
+        entry->state = EntryState::READING;
+        bool ok;
+        size_t usage = 0;
+        {
+            REVERSE_LOCK(lock);
+            ok = ReadBlockFromDisk(entry->block, entry->pos, Params().GetConsensus()) &&
+                 entry->block.GetHash() == entry->hash;
+            if (ok) {
+                usage = RecursiveDynamicUsage(entry->block);
+            }
+        }
+        // Readers wait on READING entries so the entry is still mapped
+        entry->state = ok ? EntryState::DONE : EntryState::FAILED;
+        entry->usage = usage;
+        m_usage += usage;
+        m_cv.notify_all();
+    }
+}
+
+bool BlockPrefetcher::Take(const CBlockIndex* pindex, CBlock& block)
+{
+    if (!m_running) {
+        return false;
+    }
+    WAIT_LOCK(m_mutex, lock);
+    NoteRead(pindex);
+
+    auto it = m_entries.find(pindex);
+    if (it == m_entries.end()) {
+        return false;
+    }
+    std::shared_ptr<Entry> entry = it->second;
+    if (entry->state == EntryState::QUEUED) {
+        // Reading it here is no slower than waiting for a worker
+        Erase(it);
+        return false;
+    }
+    while (entry->state == EntryState::READING) {
+        m_cv.wait(lock);
+    }
+    it = m_entries.find(pindex);
+    if (it != m_entries.end() && it->second == entry) {
+        Erase(it);
+    }
+    if (entry->state != EntryState::DONE) {
+        return false;
+    }
+    block = std::move(entry->block);
+    return true;
+}
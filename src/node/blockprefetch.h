@@ -0,0 +1,103 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_NODE_BLOCKPREFETCH_H
+#define BITCOIN_NODE_BLOCKPREFETCH_H
+
+#include <flatfile.h>
+#include <primitives/block.h>
+#include <sync.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class CBlockIndex;
+
+/** Default for -blockprefetch, the number of blocks read ahead of a sequential reader, 0 disables */
+static const int DEFAULT_BLOCK_PREFETCH = 8;
+/** Default for -blockprefetchthreads */
+static const int DEFAULT_BLOCK_PREFETCH_THREADS = 2;
+/** Maximum number of block prefetch threads */
+static const int MAX_BLOCK_PREFETCH_THREADS = 16;
+/** Default for -blockprefetchmem, the memory in MiB held by blocks read ahead */
+static const int64_t DEFAULT_BLOCK_PREFETCH_MEM = 64;
+/** Number of sequential readers followed at once */
+static const size_t MAX_BLOCK_PREFETCH_STREAMS = 8;
+
+/**
+ * Reads blocks ahead of callers walking the active chain forward, like
+ * reindexing, wallet rescans and index syncs.
+ *
+ * ReadBlockFromDisk asks the prefetcher first. A read of the child of the
+ * last block read by a stream advances that stream and the worker threads
+ * read and deserialize the next blocks of the active chain in parallel.
+ * Readers only wait for blocks already being read, blocks still queued are
+ * read by the caller.
+ */
+class BlockPrefetcher
+{
+public:
+    ~BlockPrefetcher();
+
+    void Start(int threads, int depth, size_t max_memory);
+    void Stop();
+
+    /** Take the block for pindex if it was read ahead, false if the caller must read it. */
+    bool Take(const CBlockIndex* pindex, CBlock& block);
+
+    size_t Size();
+
+private:
+    enum class EntryState {
+        QUEUED,
+        READING,
+        DONE,
+        FAILED,
+        CANCELLED,
+    };
+
+    struct Entry {
+        const CBlockIndex* pindex;
+        uint256 hash;
+        FlatFilePos pos;
+        uint64_t seq;
+        EntryState state{EntryState::QUEUED};
+        size_t usage{0};
+        CBlock block;
+    };
+
+    void ThreadPrefetch();
+    void NoteRead(const CBlockIndex* pindex) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+    void Schedule(const CBlockIndex* pindex, UniqueLock<Mutex>& lock) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+    bool EvictOne() EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+    void Erase(std::map<const CBlockIndex*, std::shared_ptr<Entry>>::iterator it) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    std::atomic<bool> m_running{false};
+
+    Mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop GUARDED_BY(m_mutex){false};
+    int m_depth GUARDED_BY(m_mutex){0};
+    size_t m_max_memory GUARDED_BY(m_mutex){0};
+    size_t m_usage GUARDED_BY(m_mutex){0};
+    uint64_t m_seq GUARDED_BY(m_mutex){0};
+    //! Last block read by each sequential reader, oldest first
+    std::deque<const CBlockIndex*> m_streams GUARDED_BY(m_mutex);
+    //! Streams that advanced and want their next blocks queued
+    std::deque<const CBlockIndex*> m_schedule GUARDED_BY(m_mutex);
+    std::deque<std::shared_ptr<Entry>> m_queue GUARDED_BY(m_mutex);
+    std::map<const CBlockIndex*, std::shared_ptr<Entry>> m_entries GUARDED_BY(m_mutex);
+
+    std::vector<std::thread> m_threads;
+};
+
+extern BlockPrefetcher g_block_prefetcher;
+
+#endif // BITCOIN_NODE_BLOCKPREFETCH_H
@@ -8,6 +8,7 @@
 #include <coins.h>
 #include <hash.h>
 #include <serialize.h>
+#include <txdb.h>
 #include <uint256.h>
 #include <util/system.h>
 #include <validation.h>
@@ -110,6 +111,57 @@ static bool GetUTXOStats(CCoinsView* view, CCoinsStats& stats, T hash_obj, const
     return true;
 }
 
+//! Calculate the unhashed statistics over ranges of the coins database in parallel
+static bool GetUTXOStatsParallel(CCoinsViewDB* view, CCoinsStats& stats, const std::function<void()>& interruption_point)
+{
+    struct RangeState {
+        CCoinsStats stats;
+        uint256 prevkey;
+        std::map<uint32_t, Coin> outputs;
+    };
+
+    stats = CCoinsStats();
+    const int n_threads = GetUTXOScanThreads();
+    std::vector<RangeState> ranges(n_threads * 16);
+    if (!view->ForEachCoinParallel(ranges.size(), n_threads, [&ranges](size_t range, const COutPoint& key, const Coin& coin) {
+            RangeState& state = ranges[range];
+            if (!state.outputs.empty() && key.hash != state.prevkey) {
+                ApplyStats(state.stats, nullptr, state.prevkey, state.outputs);
+                state.outputs.clear();
+            }
+            state.prevkey = key.hash;
+            state.outputs[key.n] = coin;
+            state.stats.coins_count++;
+            return true;
+        }, [&ranges](size_t range) {
+            RangeState& state = ranges[range];
+            if (!state.outputs.empty()) {
+                ApplyStats(state.stats, nullptr, state.prevkey, state.outputs);
+                state.outputs.clear();
+            }
+        }, stats.hashBlock)) {
+        interruption_point();
+        return error("%s: unable to read value", __func__);
+    }
+    interruption_point();
+
+    {
+        LOCK(cs_main);
+        stats.nHeight = LookupBlockIndex(stats.hashBlock)->nHeight;
+    }
+    for (const auto& range : ranges) {
+        stats.nTransactions += range.stats.nTransactions;
+        stats.nTransactionOutputs += range.stats.nTransactionOutputs;
+        stats.nBogoSize += range.stats.nBogoSize;
+        stats.nTotalAmount += range.stats.nTotalAmount;
+        stats.nBlindTransactionOutputs += range.stats.nBlindTransactionOutputs;
+        stats.coins_count += range.stats.coins_count;
+    }
+
+    stats.nDiskSize = view->EstimateSize();
+    return true;
+}
+
 bool GetUTXOStats(CCoinsView* view, CCoinsStats& stats, CoinStatsHashType hash_type, const std::function<void()>& interruption_point)
 {
     switch (hash_type) {
@@ -118,6 +170,10 @@ bool GetUTXOStats(CCoinsView* view, CCoinsStats& stats, CoinStatsHashType hash_t
         return GetUTXOStats(view, stats, ss, interruption_point);
     }
     case(CoinStatsHashType::NONE): {
+        // The serialized hash depends on the order of the coins, without it the set can be split
+        if (CCoinsViewDB* coins_db = dynamic_cast<CCoinsViewDB*>(view)) {
+            return GetUTXOStatsParallel(coins_db, stats, interruption_point);
+        }
         return GetUTXOStats(view, stats, nullptr, interruption_point);
     }
     } // no default case, so the compiler can warn about missing cases
@@ -0,0 +1,64 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <node/coinswriteback.h>
+
+#include <shutdown.h>
+#include <util/system.h>
+#include <validation.h>
+
+#include <chrono>
+
+CoinsWriteback g_coins_writeback;
+
+CoinsWriteback::~CoinsWriteback()
+{
+    if (m_thread.joinable()) {
+        Stop();
+    }
+}
+
+void CoinsWriteback::Start(int min_usage_percent)
+{
+    Stop();
+    if (min_usage_percent < 1) {
+        return;
+    }
+    {
+        LOCK(cs_main);
+        ::ChainstateActive().CoinsTip().SetTrackDirty(true);
+    }
+    {
+        LOCK(m_mutex);
+        m_stop = false;
+    }
+    m_min_usage_percent = min_usage_percent;
+    m_thread = std::thread(&TraceThread<std::function<void()>>, "coinswb", [this] { ThreadWriteback(); });
+}
+
+void CoinsWriteback::Stop()
+{
+    {
+        LOCK(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void CoinsWriteback::ThreadWriteback()
+{
+    WAIT_LOCK(m_mutex, lock);
+    while (!m_stop) {
+        m_cv.wait_for(lock, std::chrono::milliseconds{COINS_WRITEBACK_INTERVAL_MS});
+        while (!m_stop && !ShutdownRequested()) {
+            REVERSE_LOCK(lock);
+            if (!::ChainstateActive().WriteBackCoins(m_min_usage_percent)) {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_NODE_COINSWRITEBACK_H
+#define BITCOIN_NODE_COINSWRITEBACK_H
+
+#include <sync.h>
+
+#include <condition_variable>
+#include <thread>
+
+/** Interval between checks of the coins cache usage */
+static const int COINS_WRITEBACK_INTERVAL_MS = 100;
+
+/**
+ * Writes the oldest dirty coins of the active chainstate to the coins
+ * database in bounded batches while the cache fills, so the flush once
+ * -dbcache is reached has little left to write while holding cs_main.
+ */
+class CoinsWriteback
+{
+public:
+    ~CoinsWriteback();
+
+    void Start(int min_usage_percent);
+    void Stop();
+
+private:
+    void ThreadWriteback();
+
+    Mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop GUARDED_BY(m_mutex){false};
+    int m_min_usage_percent{0};
+
+    std::thread m_thread;
+};
+
+extern CoinsWriteback g_coins_writeback;
+
+#endif // BITCOIN_NODE_COINSWRITEBACK_H
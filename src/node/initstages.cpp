@@ -0,0 +1,64 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <node/initstages.h>
+
+#include <logging.h>
+#include <sync.h>
+#include <util/time.h>
+
+namespace {
+Mutex g_init_stages_mutex;
+int64_t g_init_begin GUARDED_BY(g_init_stages_mutex){0};
+int64_t g_init_duration GUARDED_BY(g_init_stages_mutex){-1};
+std::vector<InitStage> g_init_stages GUARDED_BY(g_init_stages_mutex);
+} // namespace
+
+InitStageTimer::InitStageTimer(const std::string& name, bool background)
+    : m_name(name), m_start(GetTimeMillis()), m_background(background) {}
+
+void InitStageTimer::Stop()
+{
+    if (m_stopped) {
+        return;
+    }
+    m_stopped = true;
+
+    InitStage stage;
+    stage.name = m_name;
+    stage.duration = GetTimeMillis() - m_start;
+    stage.background = m_background;
+    LogPrintf("Init stage %s: %dms%s\n", stage.name, stage.duration, stage.background ? " (background)" : "");
+
+    LOCK(g_init_stages_mutex);
+    stage.start = g_init_begin ? m_start - g_init_begin : 0;
+    g_init_stages.push_back(std::move(stage));
+}
+
+void InitStagesBegin()
+{
+    LOCK(g_init_stages_mutex);
+    g_init_begin = GetTimeMillis();
+    g_init_duration = -1;
+    g_init_stages.clear();
+}
+
+void InitStagesFinished()
+{
+    LOCK(g_init_stages_mutex);
+    g_init_duration = GetTimeMillis() - g_init_begin;
+    LogPrintf("Init finished in %dms\n", g_init_duration);
+}
+
+std::vector<InitStage> GetInitStages()
+{
+    LOCK(g_init_stages_mutex);
+    return g_init_stages;
+}
+
+int64_t GetInitDuration()
+{
+    LOCK(g_init_stages_mutex);
+    return g_init_duration;
+}
@@ -0,0 +1,48 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_NODE_INITSTAGES_H
+#define BITCOIN_NODE_INITSTAGES_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** A timed stage of node startup */
+struct InitStage {
+    std::string name;
+    int64_t start{0};       // Milliseconds after startup began
+    int64_t duration{0};    // Milliseconds
+    bool background{false}; // Ran alongside the stages of the init thread
+};
+
+/**
+ * Times a stage of AppInitMain from construction until Stop or destruction,
+ * logging it and recording it for getinitstages.
+ */
+class InitStageTimer
+{
+public:
+    explicit InitStageTimer(const std::string& name, bool background = false);
+    ~InitStageTimer() { Stop(); }
+
+    void Stop();
+
+private:
+    std::string m_name;
+    int64_t m_start;
+    bool m_background;
+    bool m_stopped{false};
+};
+
+/** Mark the start of AppInitMain, stage start times are relative to it. */
+void InitStagesBegin();
+/** Mark startup as finished. */
+void InitStagesFinished();
+
+std::vector<InitStage> GetInitStages();
+/** Milliseconds from InitStagesBegin to InitStagesFinished, -1 while starting. */
+int64_t GetInitDuration();
+
+#endif // BITCOIN_NODE_INITSTAGES_H
@@ -0,0 +1,320 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <node/stealthscan.h>
+
+#include <chain.h>
+#include <hash.h>
+#include <key/extkey.h>
+#include <logging.h>
+#include <primitives/block.h>
+#include <script/standard.h>
+#include <tinyformat.h>
+#include <util/taskpool.h>
+#include <util/time.h>
+
+StealthScanServer g_stealth_scan_server;
+
+namespace {
+//! An output that may pay a stealth address, decoded once for all keys
+struct Candidate {
+    size_t tx;
+    uint32_t n;
+    uint8_t type;
+    secp256k1_pubkey ephem;
+    uint32_t prefix{0};
+    bool have_prefix{false};
+    CKeyID id;
+};
+
+bool ParseEphem(const std::vector<uint8_t> &vData, size_t offset, secp256k1_pubkey &ephem)
+{
+    if (vData.size() < offset + EC_COMPRESSED_SIZE) {
+        return false;
+    }
+    ec_point pk(vData.begin() + offset, vData.begin() + offset + EC_COMPRESSED_SIZE);
+    return StealthParsePoint(pk, ephem);
+}
+
+bool GetKeyID(const CScript &script, CKeyID &id)
+{
+    CTxDestination dest;
+    if (!ExtractDestination(script, dest) || dest.type() != typeid(PKHash)) {
+        return false;
+    }
+    id = ToKeyID(boost::get<PKHash>(dest));
+    return true;
+}
+
+void GetCandidates(const CTransaction &tx, size_t tx_index, std::vector<Candidate> &candidates)
+{
+    for (size_t n = 0; n < tx.vpout.size(); ++n) {
+        const CTxOutBase *txout = tx.vpout[n].get();
+        Candidate c;
+        c.tx = tx_index;
+        c.n = n;
+        c.type = txout->nVersion;
+        if (txout->IsType(OUTPUT_STANDARD)) {
+            // The ephemeral pubkey is in the data output following the payment
+            if (n + 1 >= tx.vpout.size() || !tx.vpout[n + 1]->IsType(OUTPUT_DATA)) {
+                continue;
+            }
+            const std::vector<uint8_t> &vData = ((const CTxOutData*)tx.vpout[n + 1].get())->vData;
+            if (vData.size() < 34 || vData[0] != DO_STEALTH
+                || !ParseEphem(vData, 1, c.ephem)
+                || !GetKeyID(((const CTxOutStandard*)txout)->scriptPubKey, c.id)) {
+                continue;
+            }
+            c.have_prefix = ExtractStealthPrefix(vData, c.prefix, 34);
+        } else
+        if (txout->IsType(OUTPUT_CT)) {
+            const CTxOutCT *ctout = (const CTxOutCT*)txout;
+            if (!ParseEphem(ctout->vData, 0, c.ephem)
+                || !GetKeyID(ctout->scriptPubKey, c.id)) {
+                continue;
+            }
+            c.have_prefix = ExtractStealthPrefix(ctout->vData, c.prefix);
+        } else
+        if (txout->IsType(OUTPUT_RINGCT)) {
+            const CTxOutRingCT *rctout = (const CTxOutRingCT*)txout;
+            if (!ParseEphem(rctout->vData, 0, c.ephem)) {
+                continue;
+            }
+            c.id = rctout->pk.GetID();
+            c.have_prefix = ExtractStealthPrefix(rctout->vData, c.prefix);
+        } else {
+            continue;
+        }
+        candidates.push_back(c);
+    }
+}
+} // namespace
+
+void StealthScanServer::Start(size_t max_keys)
+{
+    {
+        LOCK(m_mutex);
+        m_max_keys = max_keys;
+        m_interrupted = false;
+    }
+    m_running = true;
+    RegisterValidationInterface(this, "stealthscan");
+    LogPrintf("Stealth scan server started, up to %u keys\n", max_keys);
+}
+
+void StealthScanServer::Interrupt()
+{
+    {
+        LOCK(m_mutex);
+        m_interrupted = true;
+    }
+    m_cv.notify_all();
+}
+
+void StealthScanServer::Stop()
+{
+    if (!m_running) {
+        return;
+    }
+    UnregisterValidationInterface(this);
+    m_running = false;
+    {
+        LOCK(m_mutex);
+        m_interrupted = true;
+        m_keys.clear();
+    }
+    m_cv.notify_all();
+}
+
+bool StealthScanServer::AddKey(const CStealthAddress &sx, uint256 &id, std::string &error)
+{
+    if (!m_running) {
+        error = "Stealth scan server is not enabled (-stealthscanserver)";
+        return false;
+    }
+    if (!sx.scan_secret.IsValid()) {
+        error = "Invalid scan secret";
+        return false;
+    }
+    ec_point scan_pubkey;
+    if (SecretToPublicKey(sx.scan_secret, scan_pubkey) != 0 || scan_pubkey != sx.scan_pubkey) {
+        error = "Scan secret does not match the address";
+        return false;
+    }
+    auto key = std::make_shared<Key>();
+    if (!key->points.Set(sx.scan_pubkey, sx.spend_pubkey)) {
+        error = "Invalid stealth address";
+        return false;
+    }
+    key->scan_secret = sx.scan_secret;
+    key->prefix_bits = sx.prefix.number_bits;
+    key->prefix = sx.prefix.bitfield;
+    id = Hash(sx.scan_pubkey, sx.spend_pubkey);
+
+    LOCK(m_mutex);
+    auto it = m_keys.find(id);
+    if (it != m_keys.end()) {
+        it->second.key = key;
+        return true;
+    }
+    if (m_keys.size() >= m_max_keys) {
+        error = strprintf("Too many scan keys registered (-stealthscanmaxkeys=%u)", m_max_keys);
+        return false;
+    }
+    m_keys[id].key = key;
+    return true;
+}
+
+bool StealthScanServer::RemoveKey(const uint256 &id)
+{
+    {
+        LOCK(m_mutex);
+        if (m_keys.erase(id) == 0) {
+            return false;
+        }
+    }
+    // A caller waiting on the key returns that it's gone
+    m_cv.notify_all();
+    return true;
+}
+
+bool StealthScanServer::GetMatches(const uint256 &id, uint64_t after, std::chrono::milliseconds timeout, std::vector<StealthScanMatch> &matches, uint64_t &last)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    matches.clear();
+
+    WAIT_LOCK(m_mutex, lock);
+    while (true) {
+        auto it = m_keys.find(id);
+        if (it == m_keys.end()) {
+            return false;
+        }
+        auto &queue = it->second.matches;
+        while (!queue.empty() && queue.front().seq <= after) {
+            queue.pop_front();
+        }
+        if (!queue.empty() || m_interrupted || std::chrono::steady_clock::now() >= deadline) {
+            matches.assign(queue.begin(), queue.end());
+            last = m_seq;
+            return true;
+        }
+        m_cv.wait_until(lock, deadline);
+    }
+}
+
+void StealthScanServer::ScanTransactions(const std::vector<CTransactionRef> &txns, int height, const uint256 &block_hash)
+{
+    std::vector<std::pair<uint256, std::shared_ptr<const Key>>> keys;
+    {
+        LOCK(m_mutex);
+        if (m_keys.empty()) {
+            return;
+        }
+        keys.reserve(m_keys.size());
+        for (const auto &entry : m_keys) {
+            keys.emplace_back(entry.first, entry.second.key);
+        }
+    }
+
+    const int64_t time_start = GetTimeMicros();
+    std::vector<Candidate> candidates;
+    for (size_t i = 0; i < txns.size(); ++i) {
+        GetCandidates(*txns[i], i, candidates);
+    }
+    m_txns += txns.size();
+    m_outputs += candidates.size();
+    if (candidates.empty()) {
+        return;
+    }
+
+    // One task per key, the shared secret is derived for the candidates its prefix allows
+    std::vector<std::vector<size_t>> hits(keys.size());
+    g_task_pool.ParallelFor(TaskPriority::NORMAL, keys.size(), [&](size_t k) {
+        const Key &key = *keys[k].second;
+        std::vector<size_t> tried;
+        std::vector<uint8_t> packed;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const Candidate &c = candidates[i];
+            if (!MatchStealthPrefix(key.prefix_bits, key.prefix, c.prefix, c.have_prefix)) {
+                continue;
+            }
+            CKey shared;
+            ec_point pk;
+            if (key.points.Receive(key.scan_secret, c.ephem, shared, pk) != 0
+                || pk.size() != EC_COMPRESSED_SIZE) {
+                continue;
+            }
+            tried.push_back(i);
+            packed.insert(packed.end(), pk.begin(), pk.end());
+        }
+        std::vector<uint8_t> ids(tried.size() * CHash160::OUTPUT_SIZE);
+        Hash160Batch(ids.data(), packed.data(), EC_COMPRESSED_SIZE, tried.size());
+        for (size_t j = 0; j < tried.size(); ++j) {
+            if (memcmp(&ids[j * CHash160::OUTPUT_SIZE], candidates[tried[j]].id.begin(), CHash160::OUTPUT_SIZE) == 0) {
+                hits[k].push_back(tried[j]);
+            }
+        }
+    });
+
+    std::vector<std::pair<uint256, StealthScanMatch>> found;
+    {
+        LOCK(m_mutex);
+        for (size_t k = 0; k < keys.size(); ++k) {
+            auto it = m_keys.find(keys[k].first);
+            if (hits[k].empty() || it == m_keys.end() || it->second.key != keys[k].second) {
+                continue;
+            }
+            for (size_t i : hits[k]) {
+                const Candidate &c = candidates[i];
+                StealthScanMatch match;
+                match.seq = ++m_seq;
+                match.txid = txns[c.tx]->GetHash();
+                match.n = c.n;
+                match.type = c.type;
+                match.height = height;
+                match.block_hash = block_hash;
+                it->second.matches.push_back(match);
+                found.emplace_back(keys[k].first, match);
+            }
+            while (it->second.matches.size() > MAX_STEALTH_SCAN_MATCHES) {
+                it->second.matches.pop_front();
+            }
+        }
+    }
+    m_scan_time += GetTimeMicros() - time_start;
+    if (found.empty()) {
+        return;
+    }
+    m_matches += found.size();
+    m_cv.notify_all();
+
+    for (const auto &entry : found) {
+        GetMainSignals().StealthOutputFound(entry.first, entry.second);
+    }
+}
+
+void StealthScanServer::TransactionAddedToMempool(const CTransactionRef &tx, uint64_t mempool_sequence)
+{
+    ScanTransactions({tx}, -1, uint256());
+}
+
+void StealthScanServer::BlockConnected(const std::shared_ptr<const CBlock> &block, const CBlockIndex *pindex)
+{
+    ++m_blocks;
+    ScanTransactions(block->vtx, pindex->nHeight, pindex->GetBlockHash());
+}
+
+StealthScanServer::Stats StealthScanServer::GetStats() const
+{
+    Stats stats;
+    stats.running = m_running;
+    stats.blocks = m_blocks;
+    stats.txns = m_txns;
+    stats.outputs = m_outputs;
+    stats.matches = m_matches;
+    stats.scan_time = m_scan_time;
+    LOCK(m_mutex);
+    stats.keys = m_keys.size();
+    return stats;
+}
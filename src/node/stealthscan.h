@@ -0,0 +1,129 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_NODE_STEALTHSCAN_H
+#define BITCOIN_NODE_STEALTHSCAN_H
+
+#include <key.h>
+#include <key/stealth.h>
+#include <primitives/transaction.h>
+#include <sync.h>
+#include <uint256.h>
+#include <validationinterface.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Default for -stealthscanserver */
+static const bool DEFAULT_STEALTH_SCAN_SERVER = false;
+/** Default for -stealthscanmaxkeys */
+static const int64_t DEFAULT_STEALTH_SCAN_MAX_KEYS = 10000;
+/** Matches kept for a key until the client acknowledges them, older ones are dropped */
+static const size_t MAX_STEALTH_SCAN_MATCHES = 1000;
+/** Longest a getscanmatches call waits for a match */
+static const int64_t MAX_STEALTH_SCAN_WAIT = 300;
+
+/** An output paying a registered scan key */
+struct StealthScanMatch {
+    uint64_t seq{0};        // Increases with each match of the server
+    uint256 txid;
+    uint32_t n{0};
+    uint8_t type{0};        // OUTPUT_STANDARD, OUTPUT_CT or OUTPUT_RINGCT
+    int height{-1};         // -1 for a mempool transaction
+    uint256 block_hash;
+};
+
+/**
+ * Scans new blocks and mempool transactions for outputs paying the view keys
+ * of light wallets, which can't do the ECDH over whole blocks themselves.
+ *
+ * Clients register a stealth address with its scan secret. The spend key
+ * stays with the client, so the server can only see, not spend. The outputs
+ * of each block are decoded once, then the registered keys are checked
+ * against them in parallel on the task pool. Matches are kept until
+ * acknowledged through getscanmatches, which can long-poll, and are
+ * published to the stealthmatch ZMQ topic.
+ *
+ * Keys are held in memory only and see blocks and transactions from their
+ * registration on, clients re-register after a restart.
+ */
+class StealthScanServer final : public CValidationInterface
+{
+public:
+    struct Stats {
+        bool running{false};
+        size_t keys{0};
+        uint64_t blocks{0};
+        uint64_t txns{0};
+        uint64_t outputs{0};    // Stealth outputs decoded
+        uint64_t matches{0};
+        int64_t scan_time{0};   // Microseconds spent scanning
+    };
+
+    void Start(size_t max_keys);
+    /** Wake long-polling callers, called before the RPC server is stopped */
+    void Interrupt();
+    void Stop();
+    bool IsRunning() const { return m_running; }
+
+    /** Register sx, whose scan_secret must be set. id is set to the key's id, also when it was registered before. */
+    bool AddKey(const CStealthAddress &sx, uint256 &id, std::string &error);
+    bool RemoveKey(const uint256 &id);
+
+    /**
+     * Get the matches of key id after seq after, dropping those at or before
+     * it. Waits up to timeout for a match when there are none. last is set to
+     * the newest seq of the server. False if the key is not registered.
+     */
+    bool GetMatches(const uint256 &id, uint64_t after, std::chrono::milliseconds timeout, std::vector<StealthScanMatch> &matches, uint64_t &last);
+
+    /** Scan txns, confirmed at height in block_hash or in the mempool when height is -1. */
+    void ScanTransactions(const std::vector<CTransactionRef> &txns, int height, const uint256 &block_hash);
+
+    Stats GetStats() const;
+
+protected:
+    // CValidationInterface
+    void TransactionAddedToMempool(const CTransactionRef &tx, uint64_t mempool_sequence) override;
+    void BlockConnected(const std::shared_ptr<const CBlock> &block, const CBlockIndex *pindex) override;
+
+private:
+    struct Key {
+        CStealthAddressPoints points;
+        CKey scan_secret;
+        uint8_t prefix_bits{0};
+        uint32_t prefix{0};
+    };
+
+    struct Entry {
+        std::shared_ptr<const Key> key;
+        std::deque<StealthScanMatch> matches;
+    };
+
+    std::atomic<bool> m_running{false};
+
+    mutable Mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_interrupted GUARDED_BY(m_mutex){false};
+    size_t m_max_keys GUARDED_BY(m_mutex){0};
+    uint64_t m_seq GUARDED_BY(m_mutex){0};
+    std::map<uint256, Entry> m_keys GUARDED_BY(m_mutex);
+
+    std::atomic<uint64_t> m_blocks{0};
+    std::atomic<uint64_t> m_txns{0};
+    std::atomic<uint64_t> m_outputs{0};
+    std::atomic<uint64_t> m_matches{0};
+    std::atomic<int64_t> m_scan_time{0};
+};
+
+extern StealthScanServer g_stealth_scan_server;
+
+#endif // BITCOIN_NODE_STEALTHSCAN_H
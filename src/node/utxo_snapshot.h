@@ -6,9 +6,12 @@
 #ifndef BITCOIN_NODE_UTXO_SNAPSHOT_H
 #define BITCOIN_NODE_UTXO_SNAPSHOT_H
 
+#include <amount.h>
 #include <uint256.h>
 #include <serialize.h>
 
+#include <vector>
+
 //! Metadata describing a serialized version of a UTXO set from which an
 //! assumeutxo CChainState can be constructed.
 class SnapshotMetadata
@@ -38,4 +41,52 @@ public:
     SERIALIZE_METHODS(SnapshotMetadata, obj) { READWRITE(obj.m_base_blockhash, obj.m_coins_count, obj.m_nchaintx); }
 };
 
+//! Block tree prefixes a snapshot carries after its coins: the anon output
+//! index and its links, spent key images, the spent cache window and the
+//! cold reward tracker.
+static const char SNAPSHOT_DB_PREFIXES[] = {'A', 'L', 'K', 'k', 'S', 'Q', 'g', 'v', 'r', 'h'};
+
+//! Particl chain state at the base of a snapshot, written after the coins
+//! and followed by the block tree records of each of SNAPSHOT_DB_PREFIXES.
+//! Snapshots of older versions end after the coins.
+class ParticlSnapshotState
+{
+public:
+    static constexpr uint8_t CURRENT_VERSION{1};
+
+    uint8_t m_version{CURRENT_VERSION};
+    //! Money supply and last anon output index of the base block
+    CAmount m_money_supply{0};
+    int64_t m_anon_outputs{0};
+    uint256 m_stake_modifier;
+    //! Treasury fund carried forward by the coinstake of the base block
+    CAmount m_treasury_cfwd{0};
+
+    SERIALIZE_METHODS(ParticlSnapshotState, obj) { READWRITE(obj.m_version, obj.m_money_supply, obj.m_anon_outputs, obj.m_stake_modifier, obj.m_treasury_cfwd); }
+};
+
+//! A block tree record of a snapshot, kept as stored in the database. Each
+//! record is preceded by a true flag, a false flag ends the prefix.
+class SnapshotDBRecord
+{
+public:
+    std::vector<unsigned char> m_key;
+    std::vector<unsigned char> m_value;
+
+    SERIALIZE_METHODS(SnapshotDBRecord, obj) { READWRITE(obj.m_key, obj.m_value); }
+};
+
+//! Reads the remainder of a database key or value unchanged.
+struct SnapshotRawData
+{
+    std::vector<unsigned char>& m_data;
+
+    template <typename Stream>
+    void Unserialize(Stream& s)
+    {
+        m_data.resize(s.size());
+        s.read((char*)m_data.data(), m_data.size());
+    }
+};
+
 #endif // BITCOIN_NODE_UTXO_SNAPSHOT_H
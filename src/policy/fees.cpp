@@ -26,6 +26,46 @@ std::string StringForFeeEstimateHorizon(FeeEstimateHorizon horizon) {
     return horizon_string->second;
 }
 
+std::string StringForFeeEstimateTxType(FeeEstimateTxType tx_type)
+{
+    switch (tx_type) {
+    case FeeEstimateTxType::PLAIN: return "plain";
+    case FeeEstimateTxType::BLIND: return "blind";
+    case FeeEstimateTxType::ANON: return "anon";
+    }
+    return "unknown";
+}
+
+bool FeeEstimateTxTypeFromString(const std::string& str, FeeEstimateTxType& tx_type)
+{
+    for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+        if (str == StringForFeeEstimateTxType((FeeEstimateTxType)i)) {
+            tx_type = (FeeEstimateTxType)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+FeeEstimateTxType GetFeeEstimateTxType(const CTransaction& tx)
+{
+    for (const auto& txin : tx.vin) {
+        if (txin.IsAnonInput()) {
+            return FeeEstimateTxType::ANON;
+        }
+    }
+    for (const auto& txout : tx.vpout) {
+        if (txout->IsType(OUTPUT_CT) || txout->IsType(OUTPUT_RINGCT)) {
+            return FeeEstimateTxType::BLIND;
+        }
+    }
+    CAmount ct_fee;
+    if (tx.GetCTFee(ct_fee)) {
+        return FeeEstimateTxType::BLIND;
+    }
+    return FeeEstimateTxType::PLAIN;
+}
+
 /**
  * We will instantiate an instance of this class to track transactions that were
  * included in a block. We will lump transactions into a bucket according to their
@@ -472,7 +512,15 @@ void TxConfirmStats::removeTx(unsigned int entryHeight, unsigned int nBestSeenHe
 // of no harm to try to remove them again.
 bool CBlockPolicyEstimator::removeTx(uint256 hash, bool inBlock)
 {
+    for (const auto& estimator : m_type_estimators) {
+        if (estimator) estimator->removeTx(hash, inBlock);
+    }
     LOCK(m_cs_fee_estimator);
+    return removeTxInternal(hash, inBlock);
+}
+
+bool CBlockPolicyEstimator::removeTxInternal(const uint256& hash, bool inBlock)
+{
     std::map<uint256, TxStatsInfo>::iterator pos = mapMemPoolTxs.find(hash);
     if (pos != mapMemPoolTxs.end()) {
         feeStats->removeTx(pos->second.blockHeight, nBestSeenHeight, pos->second.bucketIndex, inBlock);
@@ -486,7 +534,15 @@ bool CBlockPolicyEstimator::removeTx(uint256 hash, bool inBlock)
 }
 
 CBlockPolicyEstimator::CBlockPolicyEstimator()
-    : nBestSeenHeight(0), firstRecordedHeight(0), historicalFirst(0), historicalBest(0), trackedTxs(0), untrackedTxs(0)
+    : CBlockPolicyEstimator(false, FeeEstimateTxType::PLAIN)
+{
+    for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+        m_type_estimators[i] = std::unique_ptr<CBlockPolicyEstimator>(new CBlockPolicyEstimator(true, (FeeEstimateTxType)i));
+    }
+}
+
+CBlockPolicyEstimator::CBlockPolicyEstimator(bool typed, FeeEstimateTxType tx_type)
+    : m_typed(typed), m_tx_type(tx_type), nBestSeenHeight(0), firstRecordedHeight(0), historicalFirst(0), historicalBest(0), trackedTxs(0), untrackedTxs(0)
 {
     static_assert(MIN_BUCKET_FEERATE > 0, "Min feerate must be nonzero");
     size_t bucketIndex = 0;
@@ -507,7 +563,7 @@ CBlockPolicyEstimator::~CBlockPolicyEstimator()
 {
 }
 
-bool GetFeeRate(const CTxMemPoolEntry *entry, CFeeRate &feeRate)
+bool CBlockPolicyEstimator::GetFeeRate(const CTxMemPoolEntry *entry, CFeeRate &feeRate) const
 {
     const CTransaction &tx = entry->GetTx();
     CAmount tx_fee = entry->GetFee();
@@ -527,7 +583,7 @@ bool GetFeeRate(const CTxMemPoolEntry *entry, CFeeRate &feeRate)
         }
     }
 
-    if (has_anon_outputs) {
+    if (has_anon_outputs && !m_typed) {
         tx_fee /= ANON_FEE_MULTIPLIER;
     }
 
@@ -543,6 +599,9 @@ bool GetFeeRate(const CTxMemPoolEntry *entry, CFeeRate &feeRate)
 
 void CBlockPolicyEstimator::processTransaction(const CTxMemPoolEntry& entry, bool validFeeEstimate)
 {
+    if (!m_typed) {
+        m_type_estimators[(int)GetFeeEstimateTxType(entry.GetTx())]->processTransaction(entry, validFeeEstimate);
+    }
     LOCK(m_cs_fee_estimator);
     unsigned int txHeight = entry.GetHeight();
     uint256 hash = entry.GetTx().GetHash();
@@ -587,7 +646,7 @@ void CBlockPolicyEstimator::processTransaction(const CTxMemPoolEntry& entry, boo
 
 bool CBlockPolicyEstimator::processBlockTx(unsigned int nBlockHeight, const CTxMemPoolEntry* entry)
 {
-    if (!removeTx(entry->GetTx().GetHash(), true)) {
+    if (!removeTxInternal(entry->GetTx().GetHash(), true)) {
         // This transaction wasn't being tracked for fee estimation
         return false;
     }
@@ -618,6 +677,10 @@ bool CBlockPolicyEstimator::processBlockTx(unsigned int nBlockHeight, const CTxM
 void CBlockPolicyEstimator::processBlock(unsigned int nBlockHeight,
                                          std::vector<const CTxMemPoolEntry*>& entries)
 {
+    // Entries of other types aren't tracked by the typed estimators and are skipped
+    for (const auto& estimator : m_type_estimators) {
+        if (estimator) estimator->processBlock(nBlockHeight, entries);
+    }
     LOCK(m_cs_fee_estimator);
     if (nBlockHeight <= nBestSeenHeight) {
         // Ignore side chains and re-orgs; assuming they are random
@@ -656,8 +719,8 @@ void CBlockPolicyEstimator::processBlock(unsigned int nBlockHeight,
     }
 
 
-    LogPrint(BCLog::ESTIMATEFEE, "Blockpolicy estimates updated by %u of %u block txs, since last block %u of %u tracked, mempool map size %u, max target %u from %s\n",
-             countedTxs, entries.size(), trackedTxs, trackedTxs + untrackedTxs, mapMemPoolTxs.size(),
+    LogPrint(BCLog::ESTIMATEFEE, "Blockpolicy %s estimates updated by %u of %u block txs, since last block %u of %u tracked, mempool map size %u, max target %u from %s\n",
+             m_typed ? StringForFeeEstimateTxType(m_tx_type) : "all", countedTxs, entries.size(), trackedTxs, trackedTxs + untrackedTxs, mapMemPoolTxs.size(),
              MaxUsableEstimate(), HistoricalBlockSpan() > BlockSpan() ? "historical" : "current");
 
     trackedTxs = 0;
@@ -899,6 +962,14 @@ CFeeRate CBlockPolicyEstimator::estimateSmartFee(int confTarget, FeeCalculation
     return CFeeRate(llround(median));
 }
 
+CFeeRate CBlockPolicyEstimator::estimateSmartFee(int confTarget, FeeCalculation *feeCalc, bool conservative, FeeEstimateTxType tx_type) const
+{
+    if (m_typed) {
+        return m_tx_type == tx_type ? estimateSmartFee(confTarget, feeCalc, conservative) : CFeeRate(0);
+    }
+    return m_type_estimators[(int)tx_type]->estimateSmartFee(confTarget, feeCalc, conservative);
+}
+
 
 bool CBlockPolicyEstimator::Write(CAutoFile& fileout) const
 {
@@ -917,6 +988,10 @@ bool CBlockPolicyEstimator::Write(CAutoFile& fileout) const
         feeStats->Write(fileout);
         shortStats->Write(fileout);
         longStats->Write(fileout);
+        // Appended to the stats over all types, older versions stop reading before them
+        for (const auto& estimator : m_type_estimators) {
+            if (estimator && !estimator->Write(fileout)) return false;
+        }
     }
     catch (const std::exception&) {
         LogPrintf("CBlockPolicyEstimator::Write(): unable to write policy estimator data (non-fatal)\n");
@@ -929,70 +1004,95 @@ bool CBlockPolicyEstimator::Read(CAutoFile& filein)
 {
     try {
         LOCK(m_cs_fee_estimator);
-        int nVersionRequired, nVersionThatWrote;
-        filein >> nVersionRequired >> nVersionThatWrote;
-        if (nVersionRequired > CLIENT_VERSION)
-            return error("CBlockPolicyEstimator::Read(): up-version (%d) fee estimate file", nVersionRequired);
-
-        // Read fee estimates file into temporary variables so existing data
-        // structures aren't corrupted if there is an exception.
-        unsigned int nFileBestSeenHeight;
-        filein >> nFileBestSeenHeight;
-
-        if (nVersionRequired < 149900) {
-            LogPrintf("%s: incompatible old fee estimation data (non-fatal). Version: %d\n", __func__, nVersionRequired);
-        } else { // New format introduced in 149900
-            unsigned int nFileHistoricalFirst, nFileHistoricalBest;
-            filein >> nFileHistoricalFirst >> nFileHistoricalBest;
-            if (nFileHistoricalFirst > nFileHistoricalBest || nFileHistoricalBest > nFileBestSeenHeight) {
-                throw std::runtime_error("Corrupt estimates file. Historical block range for estimates is invalid");
-            }
-            std::vector<double> fileBuckets;
-            filein >> fileBuckets;
-            size_t numBuckets = fileBuckets.size();
-            if (numBuckets <= 1 || numBuckets > 1000)
-                throw std::runtime_error("Corrupt estimates file. Must have between 2 and 1000 feerate buckets");
-
-            std::unique_ptr<TxConfirmStats> fileFeeStats(new TxConfirmStats(buckets, bucketMap, MED_BLOCK_PERIODS, MED_DECAY, MED_SCALE));
-            std::unique_ptr<TxConfirmStats> fileShortStats(new TxConfirmStats(buckets, bucketMap, SHORT_BLOCK_PERIODS, SHORT_DECAY, SHORT_SCALE));
-            std::unique_ptr<TxConfirmStats> fileLongStats(new TxConfirmStats(buckets, bucketMap, LONG_BLOCK_PERIODS, LONG_DECAY, LONG_SCALE));
-            fileFeeStats->Read(filein, nVersionThatWrote, numBuckets);
-            fileShortStats->Read(filein, nVersionThatWrote, numBuckets);
-            fileLongStats->Read(filein, nVersionThatWrote, numBuckets);
-
-            // Fee estimates file parsed correctly
-            // Copy buckets from file and refresh our bucketmap
-            buckets = fileBuckets;
-            bucketMap.clear();
-            for (unsigned int i = 0; i < buckets.size(); i++) {
-                bucketMap[buckets[i]] = i;
-            }
-
-            // Destroy old TxConfirmStats and point to new ones that already reference buckets and bucketMap
-            feeStats = std::move(fileFeeStats);
-            shortStats = std::move(fileShortStats);
-            longStats = std::move(fileLongStats);
-
-            nBestSeenHeight = nFileBestSeenHeight;
-            historicalFirst = nFileHistoricalFirst;
-            historicalBest = nFileHistoricalBest;
+        if (!ReadStats(filein)) {
+            return false;
         }
     }
     catch (const std::exception& e) {
         LogPrintf("CBlockPolicyEstimator::Read(): unable to read policy estimator data (non-fatal): %s\n",e.what());
         return false;
     }
+
+    // Files written before the per type estimators end here
+    for (const auto& estimator : m_type_estimators) {
+        if (!estimator) continue;
+        try {
+            LOCK(estimator->m_cs_fee_estimator);
+            if (!estimator->ReadStats(filein)) break;
+        }
+        catch (const std::exception& e) {
+            LogPrint(BCLog::ESTIMATEFEE, "CBlockPolicyEstimator::Read(): no %s fee estimates read (non-fatal): %s\n",
+                StringForFeeEstimateTxType(estimator->m_tx_type), e.what());
+            break;
+        }
+    }
+    return true;
+}
+
+bool CBlockPolicyEstimator::ReadStats(CAutoFile& filein)
+{
+    int nVersionRequired, nVersionThatWrote;
+    filein >> nVersionRequired >> nVersionThatWrote;
+    if (nVersionRequired > CLIENT_VERSION)
+        return error("CBlockPolicyEstimator::Read(): up-version (%d) fee estimate file", nVersionRequired);
+
+    // Read fee estimates file into temporary variables so existing data
+    // structures aren't corrupted if there is an exception.
+    unsigned int nFileBestSeenHeight;
+    filein >> nFileBestSeenHeight;
+
+    if (nVersionRequired < 149900) {
+        LogPrintf("%s: incompatible old fee estimation data (non-fatal). Version: %d\n", __func__, nVersionRequired);
+    } else { // New format introduced in 149900
+        unsigned int nFileHistoricalFirst, nFileHistoricalBest;
+        filein >> nFileHistoricalFirst >> nFileHistoricalBest;
+        if (nFileHistoricalFirst > nFileHistoricalBest || nFileHistoricalBest > nFileBestSeenHeight) {
+            throw std::runtime_error("Corrupt estimates file. Historical block range for estimates is invalid");
+        }
+        std::vector<double> fileBuckets;
+        filein >> fileBuckets;
+        size_t numBuckets = fileBuckets.size();
+        if (numBuckets <= 1 || numBuckets > 1000)
+            throw std::runtime_error("Corrupt estimates file. Must have between 2 and 1000 feerate buckets");
+
+        std::unique_ptr<TxConfirmStats> fileFeeStats(new TxConfirmStats(buckets, bucketMap, MED_BLOCK_PERIODS, MED_DECAY, MED_SCALE));
+        std::unique_ptr<TxConfirmStats> fileShortStats(new TxConfirmStats(buckets, bucketMap, SHORT_BLOCK_PERIODS, SHORT_DECAY, SHORT_SCALE));
+        std::unique_ptr<TxConfirmStats> fileLongStats(new TxConfirmStats(buckets, bucketMap, LONG_BLOCK_PERIODS, LONG_DECAY, LONG_SCALE));
+        fileFeeStats->Read(filein, nVersionThatWrote, numBuckets);
+        fileShortStats->Read(filein, nVersionThatWrote, numBuckets);
+        fileLongStats->Read(filein, nVersionThatWrote, numBuckets);
+
+        // Fee estimates file parsed correctly
+        // Copy buckets from file and refresh our bucketmap
+        buckets = fileBuckets;
+        bucketMap.clear();
+        for (unsigned int i = 0; i < buckets.size(); i++) {
+            bucketMap[buckets[i]] = i;
+        }
+
+        // Destroy old TxConfirmStats and point to new ones that already reference buckets and bucketMap
+        feeStats = std::move(fileFeeStats);
+        shortStats = std::move(fileShortStats);
+        longStats = std::move(fileLongStats);
+
+        nBestSeenHeight = nFileBestSeenHeight;
+        historicalFirst = nFileHistoricalFirst;
+        historicalBest = nFileHistoricalBest;
+    }
     return true;
 }
 
 void CBlockPolicyEstimator::FlushUnconfirmed() {
+    for (const auto& estimator : m_type_estimators) {
+        if (estimator) estimator->FlushUnconfirmed();
+    }
     int64_t startclear = GetTimeMicros();
     LOCK(m_cs_fee_estimator);
     size_t num_entries = mapMemPoolTxs.size();
     // Remove every entry in mapMemPoolTxs
     while (!mapMemPoolTxs.empty()) {
         auto mi = mapMemPoolTxs.begin();
-        removeTx(mi->first, false); // this calls erase() on mapMemPoolTxs
+        removeTxInternal(mi->first, false); // this calls erase() on mapMemPoolTxs
     }
     int64_t endclear = GetTimeMicros();
     LogPrint(BCLog::ESTIMATEFEE, "Recorded %u unconfirmed txs from mempool in %gs\n", num_entries, (endclear - startclear)*0.000001);
@@ -1009,6 +1109,7 @@ FeeFilterRounder::FeeFilterRounder(const CFeeRate& minIncrementalFee)
 
 CAmount FeeFilterRounder::round(CAmount currentMinFee)
 {
+    LOCK(m_insecure_rand_mutex);
     std::set<double>::iterator it = feeset.lower_bound(currentMinFee);
     if ((it != feeset.begin() && insecure_rand.rand32() % 3 != 0) || it == feeset.end()) {
         it--;
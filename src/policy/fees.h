@@ -18,6 +18,7 @@
 
 class CAutoFile;
 class CFeeRate;
+class CTransaction;
 class CTxMemPoolEntry;
 class CTxMemPool;
 class TxConfirmStats;
@@ -32,6 +33,20 @@ enum class FeeEstimateHorizon {
 
 std::string StringForFeeEstimateHorizon(FeeEstimateHorizon horizon);
 
+/* Kinds of transaction tracked apart from each other, blinded and anon
+ * transactions are larger and pay their fee through a data output. */
+enum class FeeEstimateTxType {
+    PLAIN = 0,
+    BLIND = 1,
+    ANON = 2,
+};
+static constexpr int NUM_FEE_ESTIMATE_TX_TYPES = 3;
+
+std::string StringForFeeEstimateTxType(FeeEstimateTxType tx_type);
+bool FeeEstimateTxTypeFromString(const std::string& str, FeeEstimateTxType& tx_type);
+/** Anon if any input is anon, blind if any output is blinded or the fee is in a data output */
+FeeEstimateTxType GetFeeEstimateTxType(const CTransaction& tx);
+
 /* Enumeration of reason for returned fee estimate */
 enum class FeeReason {
     NONE,
@@ -120,6 +135,10 @@ struct FeeCalculation
  *  We want to be able to estimate feerates that are needed on tx's to be included in
  * a certain number of blocks.  Every time a block is added to the best chain, this class records
  * stats on the transactions included in that block
+ *
+ * Alongside the stats over all transactions one estimator per FeeEstimateTxType
+ * tracks only the transactions of that type, with their own buckets. These
+ * record the fee actually paid, anon fees aren't scaled down by ANON_FEE_MULTIPLIER.
  */
 class CBlockPolicyEstimator
 {
@@ -197,6 +216,9 @@ public:
      */
     CFeeRate estimateSmartFee(int confTarget, FeeCalculation *feeCalc, bool conservative) const;
 
+    /** Estimate from the transactions of one type only */
+    CFeeRate estimateSmartFee(int confTarget, FeeCalculation *feeCalc, bool conservative, FeeEstimateTxType tx_type) const;
+
     /** Return a specific fee estimate calculation with a given success
      * threshold and time horizon, and optionally return detailed data about
      * calculation
@@ -216,8 +238,17 @@ public:
     unsigned int HighestTargetTracked(FeeEstimateHorizon horizon) const;
 
 private:
+    /** Create an estimator tracking only transactions of tx_type if typed is set */
+    CBlockPolicyEstimator(bool typed, FeeEstimateTxType tx_type);
+
     mutable RecursiveMutex m_cs_fee_estimator;
 
+    //! Set on the estimators tracking a single type of transaction
+    const bool m_typed;
+    const FeeEstimateTxType m_tx_type;
+    //! Estimators per FeeEstimateTxType, empty on the typed estimators
+    std::unique_ptr<CBlockPolicyEstimator> m_type_estimators[NUM_FEE_ESTIMATE_TX_TYPES];
+
     unsigned int nBestSeenHeight GUARDED_BY(m_cs_fee_estimator);
     unsigned int firstRecordedHeight GUARDED_BY(m_cs_fee_estimator);
     unsigned int historicalFirst GUARDED_BY(m_cs_fee_estimator);
@@ -244,6 +275,12 @@ private:
     std::vector<double> buckets GUARDED_BY(m_cs_fee_estimator); // The upper-bound of the range for the bucket (inclusive)
     std::map<double, unsigned int> bucketMap GUARDED_BY(m_cs_fee_estimator); // Map of bucket upper-bound to index into all vectors by bucket
 
+    /** Remove a transaction from the stats of this estimator only */
+    bool removeTxInternal(const uint256& hash, bool inBlock) EXCLUSIVE_LOCKS_REQUIRED(m_cs_fee_estimator);
+    /** Fee rate the transaction is tracked at, false if it's not tracked */
+    bool GetFeeRate(const CTxMemPoolEntry* entry, CFeeRate& feeRate) const;
+    bool ReadStats(CAutoFile& filein) EXCLUSIVE_LOCKS_REQUIRED(m_cs_fee_estimator);
+
     /** Process a transaction confirmed in a block*/
     bool processBlockTx(unsigned int nBlockHeight, const CTxMemPoolEntry* entry) EXCLUSIVE_LOCKS_REQUIRED(m_cs_fee_estimator);
 
@@ -273,12 +310,14 @@ public:
     /** Create new FeeFilterRounder */
     explicit FeeFilterRounder(const CFeeRate& minIncrementalFee);
 
-    /** Quantize a minimum fee for privacy purpose before broadcast. Not thread-safe due to use of FastRandomContext */
+    /** Quantize a minimum fee for privacy purpose before broadcast. */
     CAmount round(CAmount currentMinFee);
 
 private:
     std::set<double> feeset;
-    FastRandomContext insecure_rand;
+    //! Peers are sent their fee filter from several message handler threads
+    Mutex m_insecure_rand_mutex;
+    FastRandomContext insecure_rand GUARDED_BY(m_insecure_rand_mutex);
 };
 
 #endif // BITCOIN_POLICY_FEES_H
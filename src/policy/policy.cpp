@@ -11,6 +11,7 @@
 #include <coins.h>
 #include <chainparams.h>
 #include <span.h>
+#include <anon.h>
 
 CAmount GetDustThreshold(const CTxOut& txout, const CFeeRate& dustRelayFeeIn)
 {
@@ -443,3 +444,23 @@ int64_t GetVirtualTransactionInputSize(const CTxIn& txin, int64_t nSigOpCost, un
 {
     return GetVirtualTransactionSize(GetTransactionInputWeight(txin), nSigOpCost, bytes_per_sigop);
 }
+
+int64_t GetTransactionValidationCost(const CTransaction& tx)
+{
+    int64_t cost = 0;
+    for (const auto& txin : tx.vin) {
+        if (!txin.IsAnonInput()) {
+            cost += TX_COST_PLAIN_INPUT;
+            continue;
+        }
+        uint32_t nInputs, nRingSize;
+        txin.GetAnonInfo(nInputs, nRingSize);
+        cost += (int64_t)std::min<uint32_t>(nInputs, MAX_ANON_INPUTS) * std::min<uint32_t>(nRingSize, MAX_RINGSIZE) * TX_COST_RING_MEMBER;
+    }
+    for (const auto& txout : tx.vpout) {
+        if (txout->IsType(OUTPUT_CT) || txout->IsType(OUTPUT_RINGCT)) {
+            cost += TX_COST_RANGEPROOF;
+        }
+    }
+    return cost;
+}
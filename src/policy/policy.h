@@ -117,6 +117,20 @@ int64_t GetVirtualTransactionSize(int64_t nWeight, int64_t nSigOpCost, unsigned
 int64_t GetVirtualTransactionSize(const CTransaction& tx, int64_t nSigOpCost, unsigned int bytes_per_sigop);
 int64_t GetVirtualTransactionInputSize(const CTxIn& tx, int64_t nSigOpCost, unsigned int bytes_per_sigop);
 
+/** Validation cost of a plain input, the unit of GetTransactionValidationCost */
+static const int64_t TX_COST_PLAIN_INPUT = 1;
+/** Validation cost of each ring member of an anon input, a db lookup and its share of the MLSAG */
+static const int64_t TX_COST_RING_MEMBER = 2;
+/** Validation cost of the rangeproof of a blinded output */
+static const int64_t TX_COST_RANGEPROOF = 20;
+
+/**
+ * Estimate the cost of validating tx from its shape alone, before any lookups,
+ * in plain input signature checks. Ring sizes and input counts are clamped to
+ * the consensus maximums, larger ones are rejected cheaply.
+ */
+int64_t GetTransactionValidationCost(const CTransaction& tx);
+
 static inline int64_t GetVirtualTransactionSize(const CTransaction& tx)
 {
     return GetVirtualTransactionSize(tx, 0, 0);
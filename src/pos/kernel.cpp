@@ -18,6 +18,10 @@
 #include <coins.h>
 #include <insight/insight.h>
 #include <txmempool.h>
+#include <optional.h>
+
+#include <list>
+#include <map>
 
 extern double GetDifficulty(const CBlockIndex* blockindex);
 
@@ -96,9 +100,35 @@ uint256 ComputeStakeModifierV2(const CBlockIndex *pindexPrev, const uint256 &ker
  *   quantities so as to generate blocks faster, degrading the system back into
  *   a proof-of-work situation.
  */
+CStakeKernelHasher::CStakeKernelHasher(const uint256 &bnStakeModifier, uint32_t nBlockFromTime, const COutPoint &prevout)
+    : m_prefix(SER_GETHASH, 0)
+{
+    m_prefix << bnStakeModifier;
+    m_prefix << nBlockFromTime << prevout.hash << prevout.n;
+}
+
+uint256 CStakeKernelHasher::GetHash(uint32_t nTime) const
+{
+    CHashWriter ss(m_prefix);
+    ss << nTime;
+    return ss.GetHash();
+}
+
+bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
+    uint32_t nBits, uint32_t nBlockFromTime,
+    CAmount prevOutAmount, const COutPoint &prevout, uint32_t nTime,
+    uint256 &hashProofOfStake, uint256 &targetProofOfStake,
+    bool fPrintProofOfStake)
+{
+    CStakeKernelHasher hasher(pindexPrev->bnStakeModifier, nBlockFromTime, prevout);
+    return CheckStakeKernelHash(pindexPrev, nBits, nBlockFromTime, prevOutAmount, prevout, nTime,
+        hasher, hashProofOfStake, targetProofOfStake, fPrintProofOfStake);
+}
+
 bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
     uint32_t nBits, uint32_t nBlockFromTime,
     CAmount prevOutAmount, const COutPoint &prevout, uint32_t nTime,
+    const CStakeKernelHasher &hasher,
     uint256 &hashProofOfStake, uint256 &targetProofOfStake,
     bool fPrintProofOfStake)
 {
@@ -128,10 +158,7 @@ bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
     int nStakeModifierHeight = pindexPrev->nHeight;
     int64_t nStakeModifierTime = pindexPrev->nTime;
 
-    CDataStream ss(SER_GETHASH, 0);
-    ss << bnStakeModifier;
-    ss << nBlockFromTime << prevout.hash << prevout.n << nTime;
-    hashProofOfStake = Hash(ss);
+    hashProofOfStake = hasher.GetHash(nTime);
 
     if (fPrintProofOfStake) {
         LogPrintf("%s: using modifier=%s at height=%d timestamp=%s\n",
@@ -161,6 +188,88 @@ bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
     return true;
 }
 
+namespace {
+struct KernelInfo
+{
+    Coin coin;
+    uint256 block_hash; // block at coin.nHeight
+    uint32_t spent_height = 0; // 0 if not known to be spent
+    uint256 spent_block_hash;
+};
+
+/** Least recently used first out map of kernel prevouts. */
+class KernelInfoCache
+{
+private:
+    using Entries = std::list<std::pair<COutPoint, KernelInfo>>;
+    Entries m_entries; // most recently used first
+    std::map<COutPoint, Entries::iterator> m_index;
+    size_t m_max_size;
+
+public:
+    explicit KernelInfoCache(size_t max_size) : m_max_size(max_size) {}
+
+    KernelInfo *Get(const COutPoint &prevout)
+    {
+        auto it = m_index.find(prevout);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    KernelInfo &Put(const COutPoint &prevout)
+    {
+        KernelInfo *info = Get(prevout);
+        if (info) {
+            return *info;
+        }
+        m_entries.emplace_front(prevout, KernelInfo());
+        m_index.emplace(prevout, m_entries.begin());
+        if (m_entries.size() > m_max_size) {
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+        return m_entries.front().second;
+    }
+};
+} // namespace
+
+static Mutex cs_kernel_info_cache;
+static KernelInfoCache kernel_info_cache GUARDED_BY(cs_kernel_info_cache) {KERNEL_INFO_CACHE_SIZE};
+
+/** Whether the blocks the coin and spend were read from are still in the active chain */
+static bool KernelInfoValid(const KernelInfo &info) EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    const CBlockIndex *pindex = ::ChainActive()[info.coin.nHeight];
+    if (!pindex || pindex->GetBlockHash() != info.block_hash) {
+        return false;
+    }
+    if (info.spent_height) {
+        pindex = ::ChainActive()[info.spent_height];
+        if (!pindex || pindex->GetBlockHash() != info.spent_block_hash) {
+            return false;
+        }
+        // Match the spent cache, which drops spends older than MIN_BLOCKS_TO_KEEP
+        if (::ChainActive().Height() - (int)info.spent_height > (int)MIN_BLOCKS_TO_KEEP) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AddConnectedKernel(const COutPoint &prevout, const CBlockIndex *pindex)
+{
+    LOCK(cs_kernel_info_cache);
+    KernelInfo *info = kernel_info_cache.Get(prevout);
+    if (!info) {
+        return;
+    }
+    info->spent_height = pindex->nHeight;
+    info->spent_block_hash = pindex->GetBlockHash();
+}
+
 bool GetKernelInfo(const CBlockIndex *blockindex, const CTransaction &tx, uint256 &hash, CAmount &value, CScript &script, uint256 &blockhash)
 {
     if (!blockindex->pprev) {
@@ -170,27 +279,56 @@ bool GetKernelInfo(const CBlockIndex *blockindex, const CTransaction &tx, uint25
         return false;
     }
     const COutPoint &prevout = tx.vin[0].prevout;
-    CTransactionRef txPrev;
-    CBlock blockKernel; // block containing stake kernel, GetTransaction should only fill the header.
-    if (!GetTransaction(prevout.hash, txPrev, Params().GetConsensus(), blockKernel)
-        || prevout.n >= txPrev->vpout.size()) {
-        return false;
+    uint32_t nBlockFromTime = 0;
+    {
+        LOCK2(cs_main, cs_kernel_info_cache);
+        const KernelInfo *info = kernel_info_cache.Get(prevout);
+        if (info && KernelInfoValid(*info)) {
+            value = info->coin.out.nValue;
+            script = info->coin.out.scriptPubKey;
+            blockhash = info->block_hash;
+            nBlockFromTime = ::ChainActive()[info->coin.nHeight]->nTime;
+        }
     }
-    const CTxOutBase *outPrev = txPrev->vpout[prevout.n].get();
-    if (!outPrev->IsStandardOutput()) {
-        return false;
+    if (!nBlockFromTime) {
+        // Look in the coins and the spent cache as CheckProofOfStake does, the spent cache
+        // covers the kernels of the last MIN_BLOCKS_TO_KEEP blocks, which -prune always keeps
+        LOCK(cs_main);
+        Coin coin;
+        SpentCoin spent_coin;
+        if (!::ChainstateActive().CoinsTip().GetCoin(prevout, coin) || coin.IsSpent()) {
+            coin.Clear();
+            if (pblocktree->ReadSpentCache(prevout, spent_coin)) {
+                coin = spent_coin.coin;
+            }
+        }
+        const CBlockIndex *pindex_from = coin.IsSpent() ? nullptr : ::ChainActive()[coin.nHeight];
+        if (pindex_from && coin.nType == OUTPUT_STANDARD) {
+            value = coin.out.nValue;
+            script = coin.out.scriptPubKey;
+            blockhash = pindex_from->GetBlockHash();
+            nBlockFromTime = pindex_from->nTime;
+        }
+    }
+    if (!nBlockFromTime) {
+        CTransactionRef txPrev;
+        CBlock blockKernel; // block containing stake kernel, GetTransaction should only fill the header.
+        if (!GetTransaction(prevout.hash, txPrev, Params().GetConsensus(), blockKernel)
+            || prevout.n >= txPrev->vpout.size()) {
+            return false;
+        }
+        const CTxOutBase *outPrev = txPrev->vpout[prevout.n].get();
+        if (!outPrev->IsStandardOutput()) {
+            return false;
+        }
+        value = outPrev->GetValue();
+        script = *outPrev->GetPScriptPubKey();
+        blockhash = blockKernel.GetHash();
+        nBlockFromTime = blockKernel.nTime;
     }
-    value = outPrev->GetValue();
-    script = *outPrev->GetPScriptPubKey();
-    blockhash = blockKernel.GetHash();
 
-    uint32_t nBlockFromTime = blockKernel.nTime;
     uint32_t nTime = blockindex->nTime;
-
-    CDataStream ss(SER_GETHASH, 0);
-    ss << blockindex->pprev->bnStakeModifier;
-    ss << nBlockFromTime << prevout.hash << prevout.n << nTime;
-    hash = Hash(ss);
+    hash = CStakeKernelHasher(blockindex->pprev->bnStakeModifier, nBlockFromTime, prevout).GetHash(nTime);
 
     return true;
 };
@@ -218,13 +356,27 @@ bool CheckProofOfStake(BlockValidationState &state, const CBlockIndex *pindexPre
     CAmount amount;
 
     Coin coin;
-    if (!::ChainstateActive().CoinsTip().GetCoin(txin.prevout, coin) || coin.IsSpent()) {
+    SpentCoin spent_coin;
+    bool kernel_spent = false;
+    {
+        // A kernel known to be spent in the active chain doesn't need the coin and spent cache lookups
+        LOCK(cs_kernel_info_cache);
+        const KernelInfo *info = kernel_info_cache.Get(txin.prevout);
+        if (info && info->spent_height && KernelInfoValid(*info)) {
+            spent_coin = SpentCoin(info->coin, info->spent_height);
+            kernel_spent = true;
+        }
+    }
+    if (!kernel_spent &&
+        (!::ChainstateActive().CoinsTip().GetCoin(txin.prevout, coin) || coin.IsSpent())) {
         // Read from spent cache
-        SpentCoin spent_coin;
         if (!pblocktree->ReadSpentCache(txin.prevout, spent_coin)) {
             LogPrintf("ERROR: %s: prevout-not-found\n", __func__);
             return state.Invalid(BlockValidationResult::DOS_20, "prevout-not-found");
         }
+        kernel_spent = true;
+    }
+    if (kernel_spent) {
         if (!fVerifyingDB &&
             (unsigned int)pindexPrev->nHeight > spent_coin.spent_height &&
             pindexPrev->nHeight - spent_coin.spent_height > MAX_REORG_DEPTH) {
@@ -252,6 +404,16 @@ bool CheckProofOfStake(BlockValidationState &state, const CBlockIndex *pindexPre
         return state.Invalid(BlockValidationResult::DOS_100, "invalid-stake-depth");
     }
 
+    {
+        LOCK(cs_kernel_info_cache);
+        KernelInfo &info = kernel_info_cache.Put(txin.prevout);
+        info.coin = coin;
+        info.block_hash = pindex->GetBlockHash();
+        const CBlockIndex *pindex_spent = kernel_spent ? ::ChainActive()[spent_coin.spent_height] : nullptr;
+        info.spent_height = pindex_spent ? spent_coin.spent_height : 0;
+        info.spent_block_hash = pindex_spent ? pindex_spent->GetBlockHash() : uint256();
+    }
+
     kernelPubKey = coin.out.scriptPubKey;
     amount = coin.out.nValue;
     nBlockFromTime = pindex->GetBlockTime();
@@ -334,11 +496,47 @@ bool CheckCoinStakeTimestamp(int nHeight, int64_t nTimeBlock)
     return (nTimeBlock & Params().GetStakeTimestampMask(nHeight)) == 0;
 }
 
+namespace {
+struct StakeKernelCandidate
+{
+    StakeKernelCandidate(CStakeKernelHasher hasher_in, CAmount amount_in, int64_t block_time_in)
+        : hasher(hasher_in), amount(amount_in), block_time(block_time_in) {}
+    CStakeKernelHasher hasher;
+    CAmount amount;
+    int64_t block_time;
+};
+} // namespace
+
+// The candidates CheckKernel found for the last pindexPrev, they stay valid until the tip changes
+static Mutex cs_stake_kernel_cache;
+static uint256 stake_kernel_cache_tip GUARDED_BY(cs_stake_kernel_cache);
+static std::map<COutPoint, StakeKernelCandidate> stake_kernel_cache GUARDED_BY(cs_stake_kernel_cache);
+
 // Used only when staking, not during validation
 bool CheckKernel(const CBlockIndex *pindexPrev, unsigned int nBits, int64_t nTime, const COutPoint &prevout, int64_t *pBlockTime)
 {
     uint256 hashProofOfStake, targetProofOfStake;
 
+    Optional<StakeKernelCandidate> candidate;
+    {
+        LOCK(cs_stake_kernel_cache);
+        if (stake_kernel_cache_tip != pindexPrev->GetBlockHash()) {
+            stake_kernel_cache.clear();
+            stake_kernel_cache_tip = pindexPrev->GetBlockHash();
+        }
+        auto it = stake_kernel_cache.find(prevout);
+        if (it != stake_kernel_cache.end()) {
+            candidate.emplace(it->second);
+        }
+    }
+    if (candidate) {
+        if (pBlockTime) {
+            *pBlockTime = candidate->block_time;
+        }
+        return CheckStakeKernelHash(pindexPrev, nBits, candidate->block_time,
+            candidate->amount, prevout, nTime, candidate->hasher, hashProofOfStake, targetProofOfStake);
+    }
+
     Coin coin;
     {
         LOCK(::cs_main);
@@ -364,12 +562,21 @@ bool CheckKernel(const CBlockIndex *pindexPrev, unsigned int nBits, int64_t nTim
     if (nRequiredDepth > nDepth) {
         return false;
     }
+    int64_t nBlockTime = pindex->GetBlockTime();
     if (pBlockTime) {
-        *pBlockTime = pindex->GetBlockTime();
+        *pBlockTime = nBlockTime;
     }
 
     CAmount amount = coin.out.nValue;
-    return CheckStakeKernelHash(pindexPrev, nBits, *pBlockTime,
-        amount, prevout, nTime, hashProofOfStake, targetProofOfStake);
+    CStakeKernelHasher hasher(pindexPrev->bnStakeModifier, nBlockTime, prevout);
+    {
+        LOCK(cs_stake_kernel_cache);
+        if (stake_kernel_cache_tip == pindexPrev->GetBlockHash()) {
+            stake_kernel_cache.emplace(std::piecewise_construct, std::forward_as_tuple(prevout),
+                std::forward_as_tuple(hasher, amount, nBlockTime));
+        }
+    }
+    return CheckStakeKernelHash(pindexPrev, nBits, nBlockTime,
+        amount, prevout, nTime, hasher, hashProofOfStake, targetProofOfStake);
 }
 
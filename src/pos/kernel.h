@@ -7,9 +7,12 @@
 #ifndef PARTICL_POS_KERNEL_H
 #define PARTICL_POS_KERNEL_H
 
+#include <hash.h>
 #include <validation.h>
 
 static const int MAX_REORG_DEPTH = 1024;
+//! Kernel prevouts CheckProofOfStake and GetKernelInfo keep the coin and its blocks of
+static const size_t KERNEL_INFO_CACHE_SIZE = 10000;
 
 double GetPoSKernelPS(CBlockIndex *pindex);
 
@@ -18,6 +21,20 @@ double GetPoSKernelPS(CBlockIndex *pindex);
  */
 uint256 ComputeStakeModifierV2(const CBlockIndex *pindexPrev, const uint256 &kernel);
 
+/**
+ * The stake kernel hash with everything but nTime written
+ * Copied for each nTime a staking candidate is tried at
+ */
+class CStakeKernelHasher
+{
+private:
+    CHashWriter m_prefix;
+
+public:
+    CStakeKernelHasher(const uint256 &bnStakeModifier, uint32_t nBlockFromTime, const COutPoint &prevout);
+    uint256 GetHash(uint32_t nTime) const;
+};
+
 /**
  * Check whether stake kernel meets hash target
  * Sets hashProofOfStake on success return
@@ -27,6 +44,12 @@ bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
     CAmount prevOutAmount, const COutPoint &prevout, uint32_t nTimeTx,
     uint256 &hashProofOfStake, uint256 &targetProofOfStake,
     bool fPrintProofOfStake=false);
+bool CheckStakeKernelHash(const CBlockIndex *pindexPrev,
+    uint32_t nBits, uint32_t nBlockFromTime,
+    CAmount prevOutAmount, const COutPoint &prevout, uint32_t nTimeTx,
+    const CStakeKernelHasher &hasher,
+    uint256 &hashProofOfStake, uint256 &targetProofOfStake,
+    bool fPrintProofOfStake=false);
 
 /**
  * Get kernel hash and value for blockindex and coinstake tx
@@ -39,6 +62,12 @@ bool GetKernelInfo(const CBlockIndex *blockindex, const CTransaction &tx, uint25
  */
 bool CheckProofOfStake(BlockValidationState &state, const CBlockIndex *pindexPrev, const CTransaction &tx, int64_t nTime, unsigned int nBits, uint256 &hashProofOfStake, uint256 &targetProofOfStake) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
+/**
+ * Remember that the kernel of a coinstake was spent in pindex, call when connecting the block
+ * CheckProofOfStake then skips the coin and spent cache lookups for it while pindex stays in the chain
+ */
+void AddConnectedKernel(const COutPoint &prevout, const CBlockIndex *pindex);
+
 /**
  * Check whether the coinstake timestamp meets protocol
  */
@@ -12,16 +12,26 @@
 #include <primitives/transaction.h>
 
 #include <sync.h>
+#include <checkqueue.h>
 #include <net.h>
 #include <validation.h>
+#include <validationinterface.h>
 #include <consensus/validation.h>
+#include <node/ui_interface.h>
+#include <timedata.h>
 
 #include <wallet/hdwallet.h>
+#include <util/metrics.h>
+#include <util/threadnames.h>
+#include <util/trace.h>
 
 #include <stdint.h>
 
+#include <boost/thread/thread.hpp>
+
 typedef CWallet* CWalletRef;
 std::vector<StakeThread*> vStakeThreads;
+StakeWorkQueue g_stake_work_queue;
 
 std::atomic<bool> fStopMinerProc(false);
 std::atomic<bool> fTryToSync(false);
@@ -32,6 +42,129 @@ int nMinStakeInterval = 0;  // Minimum stake interval in seconds
 int nMinerSleep = 500;  // In milliseconds
 std::atomic<int64_t> nTimeLastStake(0);
 
+static CCheckQueue<CStakeKernelCheck> stakeKernelQueue(16);
+static std::vector<boost::thread> stakeKernelThreads;
+
+// Held while waking the stake threads from outside, StopThreadStakeMiner sets fStopMinerProc with it
+static Mutex cs_stake_thread_wake;
+
+static void WakeAllStakeThreads()
+{
+    LOCK(cs_stake_thread_wake);
+    if (fStopMinerProc) {
+        return;
+    }
+    for (auto t : vStakeThreads) {
+        t->m_thread_interrupt();
+    }
+}
+
+/** Wakes the stake threads when a new tip can be staked on. */
+class StakeMinerNotifications : public CValidationInterface
+{
+protected:
+    void UpdatedBlockTip(const CBlockIndex *pindexNew, const CBlockIndex *pindexFork, bool fInitialDownload) override
+    {
+        if (!fInitialDownload) {
+            WakeAllStakeThreads();
+        }
+    }
+};
+
+void StakeWorkQueue::Add(const std::shared_ptr<CWallet> &wallet)
+{
+    LOCK(m_mutex);
+    for (const auto &e : m_entries) {
+        if (e.wallet == wallet) {
+            return;
+        }
+    }
+    Entry e;
+    e.wallet = wallet;
+    m_entries.push_back(e);
+}
+
+void StakeWorkQueue::Remove(const CWallet *wallet)
+{
+    LOCK(m_mutex);
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].wallet.get() == wallet) {
+            // A thread searching the wallet holds its own reference until it's done
+            m_entries.erase(m_entries.begin() + i);
+            if (m_next > i) {
+                m_next--;
+            }
+            return;
+        }
+    }
+}
+
+void StakeWorkQueue::Clear()
+{
+    LOCK(m_mutex);
+    m_entries.clear();
+    m_next = 0;
+}
+
+void StakeWorkQueue::Reset(const CWallet *wallet)
+{
+    LOCK(m_mutex);
+    for (auto &e : m_entries) {
+        if (e.wallet.get() == wallet) {
+            e.handed_out = 0;
+        }
+    }
+}
+
+std::shared_ptr<CWallet> StakeWorkQueue::Claim(int64_t nSearchTime)
+{
+    LOCK(m_mutex);
+    for (size_t k = 0; k < m_entries.size(); ++k) {
+        Entry &e = m_entries[(m_next + k) % m_entries.size()];
+        if (e.busy || e.handed_out >= nSearchTime) {
+            continue;
+        }
+        e.busy = true;
+        e.handed_out = nSearchTime;
+        m_next = (m_next + k + 1) % m_entries.size();
+        return e.wallet;
+    }
+    return nullptr;
+}
+
+void StakeWorkQueue::Release(const CWallet *wallet)
+{
+    LOCK(m_mutex);
+    for (auto &e : m_entries) {
+        if (e.wallet.get() == wallet) {
+            e.busy = false;
+        }
+    }
+}
+
+size_t StakeWorkQueue::Size() const
+{
+    LOCK(m_mutex);
+    return m_entries.size();
+}
+
+namespace {
+/** Releases a claimed wallet back to the queue */
+class StakeWorkClaim
+{
+public:
+    explicit StakeWorkClaim(std::shared_ptr<CWallet> wallet) : m_wallet(std::move(wallet)) {}
+    ~StakeWorkClaim() { if (m_wallet) g_stake_work_queue.Release(m_wallet.get()); }
+    CWallet *get() const { return m_wallet.get(); }
+    explicit operator bool() const { return m_wallet != nullptr; }
+private:
+    std::shared_ptr<CWallet> m_wallet;
+};
+} // namespace
+
+static std::shared_ptr<StakeMinerNotifications> g_stake_miner_notifications;
+static boost::signals2::connection g_stake_miner_connections_changed;
+
 bool CheckStake(CBlock *pblock)
 {
     uint256 proofHash, hashTarget;
@@ -168,6 +301,39 @@ bool ImportOutputs(CBlockTemplate *pblocktemplate, int nHeight)
     return true;
 };
 
+bool CStakeKernelCheck::operator()()
+{
+    // Returning false makes the queue skip the remaining checks
+    if (*m_stop || ThreadStakeMinerStopped() || WITH_LOCK(cs_main, return ::ChainActive().Tip()) != m_pindex_prev) {
+        *m_stop = true;
+        return false;
+    }
+    int64_t nBlockTime;
+    *m_result = CheckKernel(m_pindex_prev, m_bits, m_time, m_prevout, &nBlockTime) ? 1 : 0;
+    if (*m_result) {
+        *m_stop = true;
+        return false;
+    }
+    return true;
+}
+
+bool CheckStakeKernels(const CBlockIndex *pindexPrev, unsigned int nBits, int64_t nTime, const std::vector<COutPoint> &vPrevouts, std::vector<int8_t> &vKernel)
+{
+    vKernel.assign(vPrevouts.size(), -1);
+    std::atomic<bool> stop{false};
+
+    std::vector<CStakeKernelCheck> vChecks;
+    vChecks.reserve(vPrevouts.size());
+    for (size_t i = 0; i < vPrevouts.size(); ++i) {
+        vChecks.emplace_back(pindexPrev, nBits, nTime, vPrevouts[i], &vKernel[i], &stop);
+    }
+    CCheckQueueControl<CStakeKernelCheck> control(&stakeKernelQueue);
+    control.Add(vChecks);
+    control.Wait();
+
+    return !stop || std::find(vKernel.begin(), vKernel.end(), 1) != vKernel.end();
+}
+
 void StartThreadStakeMiner()
 {
     nMinStakeInterval = gArgs.GetArg("-minstakeinterval", 0);
@@ -182,20 +348,41 @@ void StartThreadStakeMiner()
         if (nWallets < 1) {
             return;
         }
-        size_t nThreads = std::min(nWallets, (size_t)gArgs.GetArg("-stakingthreads", 1));
+        for (const auto &wallet : vpwallets) {
+            g_stake_work_queue.Add(wallet);
+        }
 
-        size_t nPerThread = nWallets / nThreads;
+        // Wallets loaded later are shared out by the queue, the thread count doesn't depend on them
+        size_t nThreads = std::max((int64_t)1, gArgs.GetArg("-stakingthreads", 1));
         for (size_t i = 0; i < nThreads; ++i) {
-            size_t nStart = nPerThread * i;
-            size_t nEnd = (i == nThreads-1) ? nWallets : nPerThread * (i+1);
             StakeThread *t = new StakeThread();
             vStakeThreads.push_back(t);
-            GetParticlWallet(vpwallets[i].get())->nStakeThread = i;
             t->sName = strprintf("miner%d", i);
-            t->thread = std::thread(&TraceThread<std::function<void()> >, t->sName.c_str(), std::function<void()>(std::bind(&ThreadStakeMiner, i, vpwallets, nStart, nEnd)));
+            t->thread = std::thread(&TraceThread<std::function<void()> >, t->sName.c_str(), std::function<void()>(std::bind(&ThreadStakeMiner, i)));
+        }
+
+        int nKernelThreads = gArgs.GetArg("-stakingkernelthreads", DEFAULT_STAKING_KERNEL_THREADS);
+        if (nKernelThreads <= 0) {
+            nKernelThreads = GetNumCores();
         }
+        // The staking thread joins the workers while waiting for its checks
+        nKernelThreads = std::min(nKernelThreads, MAX_STAKING_KERNEL_THREADS) - 1;
+        if (nKernelThreads > 0 && stakeKernelThreads.empty()) {
+            LogPrintf("Using %d threads for kernel checks\n", nKernelThreads + 1);
+            for (int i = 0; i < nKernelThreads; ++i) {
+                stakeKernelThreads.emplace_back([i]() {
+                    util::ThreadRename(strprintf("stakekernel.%i", i));
+                    stakeKernelQueue.Thread();
+                });
+            }
+        }
+
+        g_stake_miner_notifications = std::make_shared<StakeMinerNotifications>();
+        RegisterSharedValidationInterface(g_stake_miner_notifications, "stakeminer");
+        g_stake_miner_connections_changed = uiInterface.NotifyNumConnectionsChanged_connect([](int) { WakeAllStakeThreads(); });
     }
 
+    LOCK(cs_stake_thread_wake);
     fStopMinerProc = false;
 };
 
@@ -206,7 +393,15 @@ void StopThreadStakeMiner()
         return;
     }
     LogPrint(BCLog::POS, "StopThreadStakeMiner\n");
-    fStopMinerProc = true;
+    {
+        LOCK(cs_stake_thread_wake);
+        fStopMinerProc = true;
+    }
+    g_stake_miner_connections_changed.disconnect();
+    if (g_stake_miner_notifications) {
+        UnregisterSharedValidationInterface(g_stake_miner_notifications);
+        g_stake_miner_notifications.reset();
+    }
 
     for (auto t : vStakeThreads) {
         t->m_thread_interrupt();
@@ -214,41 +409,72 @@ void StopThreadStakeMiner()
         delete t;
     }
     vStakeThreads.clear();
+    g_stake_work_queue.Clear();
+
+    // Cleared so a restart starts new workers
+    for (auto &thread : stakeKernelThreads) {
+        thread.interrupt();
+    }
+    for (auto &thread : stakeKernelThreads) {
+        thread.join();
+    }
+    stakeKernelThreads.clear();
 };
 
 void WakeThreadStakeMiner(CHDWallet *pwallet)
 {
     // Call when chain is synced, wallet unlocked or balance changed
-    size_t nStakeThread = 0;
     {
     LOCK(pwallet->cs_wallet);
-    nStakeThread = pwallet->nStakeThread;
-    if (nStakeThread >= vStakeThreads.size() || pwallet->IsScanning()) {
+    if (vStakeThreads.empty() || pwallet->IsScanning()) {
         return;
     }
     pwallet->nLastCoinStakeSearchTime = 0;
-    LogPrint(BCLog::POS, "WakeThreadStakeMiner: wallet %s, thread %d\n", pwallet->GetName(), nStakeThread);
+    LogPrint(BCLog::POS, "WakeThreadStakeMiner: wallet %s\n", pwallet->GetName());
     }
-    StakeThread *t = vStakeThreads[nStakeThread];
-    t->m_thread_interrupt();
+    // Any idle thread can pick the wallet up
+    g_stake_work_queue.Reset(pwallet);
+    WakeAllStakeThreads();
 };
 
+void AddWalletToStakeMiner(const std::shared_ptr<CWallet> &wallet)
+{
+    if (vStakeThreads.empty()) {
+        StartThreadStakeMiner();
+        return;
+    }
+    g_stake_work_queue.Add(wallet);
+    LogPrint(BCLog::POS, "%s: %s, %d wallets\n", __func__, wallet->GetName(), g_stake_work_queue.Size());
+    WakeAllStakeThreads();
+}
+
+void RemoveWalletFromStakeMiner(const CWallet *wallet)
+{
+    g_stake_work_queue.Remove(wallet);
+}
+
 bool ThreadStakeMinerStopped()
 {
     return fStopMinerProc;
 }
 
-static inline void condWaitFor(size_t nThreadID, int ms)
+static inline void condWaitFor(size_t nThreadID, int64_t ms)
 {
+    // Wakeups since the loop began return at once, see ThreadStakeMiner
     assert(vStakeThreads.size() > nThreadID);
     StakeThread *t = vStakeThreads[nThreadID];
-    t->m_thread_interrupt.reset();
     t->m_thread_interrupt.sleep_for(std::chrono::milliseconds(ms));
 };
 
-void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &vpwallets, size_t nStart, size_t nEnd)
+/** Milliseconds until the masked timestamp after nSearchTime. */
+static int64_t MillisToNextSearch(int64_t nSearchTime, int64_t nMask, int64_t nTime)
 {
-    LogPrintf("Starting staking thread %d, %d wallet%s.\n", nThreadID, nEnd - nStart, (nEnd - nStart) > 1 ? "s" : "");
+    return std::max((nSearchTime + nMask + 1 - nTime) * 1000 - GetTimeMillis() % 1000, (int64_t)1);
+}
+
+void ThreadStakeMiner(size_t nThreadID)
+{
+    LogPrintf("Starting staking thread %d.\n", nThreadID);
 
     int nBestHeight; // TODO: set from new block signal?
     int64_t nBestTime;
@@ -263,7 +489,17 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
     size_t stake_thread_cond_delay_ms = gArgs.GetArg("-stakethreadconddelayms", 60000);
     LogPrint(BCLog::POS, "Stake thread conditional delay set to %d.\n", stake_thread_cond_delay_ms);
 
+    // The block template is kept between search timestamps while the tip and mempool are unchanged,
+    // a found kernel then only needs the coinstake inserted and the block signed.
+    std::unique_ptr<CBlockTemplate> pblocktemplate;
+    uint256 template_tip;
+    CTxMemPool *template_mempool = nullptr;
+    unsigned int template_mempool_updated = 0;
+
+    // Sleeps are cut short by new tips, peer count changes and WakeThreadStakeMiner
     while (!fStopMinerProc) {
+        vStakeThreads[nThreadID]->m_thread_interrupt.reset();
+
         if (fReindex || fImporting || fBusyImporting) {
             fIsStaking = false;
             LogPrint(BCLog::POS, "%s: Block import/reindex.\n", __func__);
@@ -272,10 +508,12 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
         }
 
         int num_blocks_of_peers, num_nodes;
+        uint256 best_hash;
         {
             LOCK(cs_main);
             nBestHeight = ::ChainActive().Height();
             nBestTime = ::ChainActive().Tip()->nTime;
+            best_hash = ::ChainActive().Tip()->GetBlockHash();
             num_blocks_of_peers = GetNumBlocksOfPeers();
             num_nodes = GetNumPeers();
         }
@@ -294,14 +532,14 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
             fIsStaking = false;
             fTryToSync = true;
             LogPrint(BCLog::POS, "%s: IsInitialBlockDownload\n", __func__);
-            condWaitFor(nThreadID, 2000);
+            condWaitFor(nThreadID, 30000);
             continue;
         }
 
         if (nBestHeight < num_blocks_of_peers - 1 && gArgs.GetBoolArg("-checkpeerheight", true)) {
             fIsStaking = false;
             LogPrint(BCLog::POS, "%s: nBestHeight < GetNumBlocksOfPeers(), %d, %d\n", __func__, nBestHeight, num_blocks_of_peers);
-            condWaitFor(nThreadID, nMinerSleep * 4);
+            condWaitFor(nThreadID, 30000);
             continue;
         }
 
@@ -321,18 +559,30 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
                 continue;
             }
 
-            int64_t nNextSearch = nSearchTime + nMask;
-            condWaitFor(nThreadID, std::min(nMinerSleep + (nNextSearch - nTime) * 1000, (int64_t)10000));
+            condWaitFor(nThreadID, MillisToNextSearch(nSearchTime, nMask, nTime));
             continue;
         }
+        const int64_t nNextSearchMs = MillisToNextSearch(nSearchTime, nMask, nTime);
 
-        std::unique_ptr<CBlockTemplate> pblocktemplate;
+        if (pblocktemplate.get()
+            && (template_tip != best_hash
+                || !template_mempool
+                || template_mempool->GetTransactionsUpdated() != template_mempool_updated)) {
+            pblocktemplate.reset();
+        }
 
         size_t nWaitFor = stake_thread_cond_delay_ms;
         CAmount reserve_balance;
 
-        for (size_t i = nStart; i < nEnd; ++i) {
-            auto pwallet = GetParticlWallet(vpwallets[i].get());
+        size_t nClaimed = 0;
+        for (;;) {
+            StakeWorkClaim claim(g_stake_work_queue.Claim(nSearchTime));
+            if (!claim) {
+                break;
+            }
+            nClaimed++;
+            auto pwallet = GetParticlWallet(claim.get());
+            const int64_t nSearchDelayMs = GetTimeMillis() - nSearchTime * 1000;
 
             if (!pwallet->fStakingEnabled) {
                 pwallet->m_is_staking = CHDWallet::NOT_STAKING_DISABLED;
@@ -342,7 +592,7 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
             {
             LOCK(pwallet->cs_wallet);
             if (nSearchTime <= pwallet->nLastCoinStakeSearchTime) {
-                nWaitFor = std::min(nWaitFor, (size_t)nMinerSleep);
+                nWaitFor = std::min(nWaitFor, (size_t)nNextSearchMs);
                 continue;
             }
 
@@ -371,6 +621,10 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
             }
 
             if (!pblocktemplate.get()) {
+                // Read before assembling, a txn arriving meanwhile invalidates the template
+                template_mempool = pwallet->HaveChain() ? pwallet->chain().getMempool() : nullptr;
+                template_mempool_updated = template_mempool ? template_mempool->GetTransactionsUpdated() : 0;
+                template_tip = best_hash;
                 pblocktemplate = pwallet->CreateNewBlock();
                 if (!pblocktemplate.get()) {
                     fIsStaking = false;
@@ -384,16 +638,42 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
                     fIsStaking = false;
                     nWaitFor = std::min(nWaitFor, (size_t)30000);
                     LogPrint(BCLog::POS, "%s: ImportOutputs failed.\n", __func__);
+                    pblocktemplate.reset();
                     continue;
                 }
             }
             pwallet->m_is_staking = CHDWallet::IS_STAKING;
 
-            nWaitFor = nMinerSleep;
+            // The next timestamp can be tried at the next mask boundary
+            nWaitFor = std::min(nWaitFor, (size_t)nNextSearchMs);
             fIsStaking = true;
-            if (pwallet->SignBlock(pblocktemplate.get(), nBestHeight + 1, nSearchTime)) {
+            const int64_t nTimeSearch = GetTimeMicros();
+            const bool found = pwallet->SignBlock(pblocktemplate.get(), nBestHeight + 1, nSearchTime);
+            const int64_t nSearchMicros = GetTimeMicros() - nTimeSearch;
+            static MetricCounter &searches = g_metrics.Counter("ghost_staking_kernel_searches_total", "Timestamps searched for a kernel, per wallet");
+            static MetricCounter &kernels_found = g_metrics.Counter("ghost_staking_kernels_found_total", "Kernels found and blocks signed");
+            static MetricHistogram &search_seconds = g_metrics.Histogram("ghost_staking_kernel_search_seconds", "Time to search one timestamp of one wallet for a kernel");
+            searches.Inc();
+            if (found) {
+                kernels_found.Inc();
+            }
+            search_seconds.Observe(nSearchMicros);
+            TRACE5(staking, kernel_search, nThreadID, nBestHeight + 1, nSearchTime, found, nSearchMicros);
+            {
+                LOCK(pwallet->cs_wallet);
+                StakeSearchStats &stats = pwallet->m_stake_search_stats;
+                stats.nSearches++;
+                stats.nTotalMicros += nSearchMicros;
+                stats.nLastMicros = nSearchMicros;
+                stats.nMaxMicros = std::max(stats.nMaxMicros, nSearchMicros);
+                stats.nLastDelayMillis = nSearchDelayMs;
+            }
+            if (found) {
                 CBlock *pblock = &pblocktemplate->block;
-                if (CheckStake(pblock)) {
+                bool fAccepted = CheckStake(pblock);
+                // The coinbase was replaced by the coinstake
+                pblocktemplate.reset();
+                if (fAccepted) {
                      nTimeLastStake = GetTime();
                      break;
                 }
@@ -410,6 +690,10 @@ void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &v
                 }
             }
         }
+        if (nClaimed == 0) {
+            // The other threads have the wallets, or none are loaded
+            nWaitFor = std::min(nWaitFor, (size_t)nNextSearchMs);
+        }
 
         condWaitFor(nThreadID, nWaitFor);
     }
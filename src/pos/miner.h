@@ -7,7 +7,10 @@
 
 #include <thread>
 #include <threadinterrupt.h>
+#include <primitives/transaction.h>
+#include <sync.h>
 #include <atomic>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -16,6 +19,73 @@ class CBlock;
 class CWallet;
 class CHDWallet;
 
+//! Threads checking the kernels of one wallet's coins, including the staking thread, 0 for one per core
+static const int DEFAULT_STAKING_KERNEL_THREADS = 1;
+static const int MAX_STAKING_KERNEL_THREADS = 16;
+
+/** Kernel check of one staking coin, run on the kernel check queue by CheckStakeKernels. */
+class CStakeKernelCheck
+{
+private:
+    const CBlockIndex *m_pindex_prev = nullptr;
+    unsigned int m_bits = 0;
+    int64_t m_time = 0;
+    COutPoint m_prevout;
+    int8_t *m_result = nullptr;
+    std::atomic<bool> *m_stop = nullptr;
+
+public:
+    CStakeKernelCheck() {}
+    CStakeKernelCheck(const CBlockIndex *pindex_prev, unsigned int bits, int64_t time, const COutPoint &prevout, int8_t *result, std::atomic<bool> *stop)
+        : m_pindex_prev(pindex_prev), m_bits(bits), m_time(time), m_prevout(prevout), m_result(result), m_stop(stop) {}
+
+    bool operator()();
+
+    void swap(CStakeKernelCheck &check)
+    {
+        std::swap(m_pindex_prev, check.m_pindex_prev);
+        std::swap(m_bits, check.m_bits);
+        std::swap(m_time, check.m_time);
+        std::swap(m_prevout, check.m_prevout);
+        std::swap(m_result, check.m_result);
+        std::swap(m_stop, check.m_stop);
+    }
+};
+
+/**
+ * The wallets searched for kernels, shared by the stake threads. Idle threads
+ * claim the next wallet not yet searched at their search timestamp, so one slow
+ * wallet holds up only the thread searching it. Wallets are added and removed
+ * as they are loaded and unloaded.
+ */
+class StakeWorkQueue
+{
+public:
+    void Add(const std::shared_ptr<CWallet> &wallet);
+    void Remove(const CWallet *wallet);
+    void Clear();
+    /** Have the wallet searched again at the current timestamp */
+    void Reset(const CWallet *wallet);
+
+    /** Claim the next wallet not handed out for nSearchTime yet, null when there is none. */
+    std::shared_ptr<CWallet> Claim(int64_t nSearchTime);
+    void Release(const CWallet *wallet);
+
+    size_t Size() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<CWallet> wallet;
+        int64_t handed_out{0}; // Search timestamp the wallet was last claimed for
+        bool busy{false};
+    };
+    mutable Mutex m_mutex;
+    std::vector<Entry> m_entries GUARDED_BY(m_mutex);
+    size_t m_next GUARDED_BY(m_mutex){0};
+};
+
+extern StakeWorkQueue g_stake_work_queue;
+
 class StakeThread
 {
 public:
@@ -38,7 +108,18 @@ void StartThreadStakeMiner();
 void StopThreadStakeMiner();
 void WakeThreadStakeMiner(CHDWallet *pwallet);
 bool ThreadStakeMinerStopped();
+/** Queue a loaded wallet for the running stake threads, starting them if none are */
+void AddWalletToStakeMiner(const std::shared_ptr<CWallet> &wallet);
+void RemoveWalletFromStakeMiner(const CWallet *wallet);
+
+/**
+ * Check the kernels of vPrevouts at nTime on the kernel check threads.
+ * The search stops at the first kernel found, when staking stops or when the tip moves past pindexPrev.
+ * vKernel[i] is set to 1 if vPrevouts[i] is a kernel, 0 if not and stays -1 if it wasn't checked.
+ * Returns false if the search was cancelled before finding a kernel.
+ */
+bool CheckStakeKernels(const CBlockIndex *pindexPrev, unsigned int nBits, int64_t nTime, const std::vector<COutPoint> &vPrevouts, std::vector<int8_t> &vKernel);
 
-void ThreadStakeMiner(size_t nThreadID, std::vector<std::shared_ptr<CWallet>> &vpwallets, size_t nStart, size_t nEnd);
+void ThreadStakeMiner(size_t nThreadID);
 
 #endif // PARTICL_POS_MINER_H
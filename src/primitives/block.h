@@ -10,6 +10,8 @@
 #include <serialize.h>
 #include <uint256.h>
 
+#include <atomic>
+
 /** Nodes collect new transactions into a block, hash them into a hash tree,
  * and scan through nonce values to make the block's hash satisfy proof-of-work
  * requirements.  When they solve the proof-of-work, they broadcast the block
@@ -96,14 +98,42 @@ public:
     // pos block signature - signed by one of the coin stake txout[N]'s owner
     std::vector<uint8_t> vchBlockSig;
 
-    // memory only
-    mutable bool fChecked;
+    // memory only, atomic as blocks can be checked on several threads at once
+    mutable std::atomic<bool> fChecked;
 
     CBlock()
     {
         SetNull();
     }
 
+    CBlock(const CBlock &block)
+        : CBlockHeader(block), vtx(block.vtx), vchBlockSig(block.vchBlockSig), fChecked(block.fChecked.load())
+    {
+    }
+
+    CBlock(CBlock &&block)
+        : CBlockHeader(block), vtx(std::move(block.vtx)), vchBlockSig(std::move(block.vchBlockSig)), fChecked(block.fChecked.load())
+    {
+    }
+
+    CBlock &operator=(const CBlock &block)
+    {
+        CBlockHeader::operator=(block);
+        vtx = block.vtx;
+        vchBlockSig = block.vchBlockSig;
+        fChecked = block.fChecked.load();
+        return *this;
+    }
+
+    CBlock &operator=(CBlock &&block)
+    {
+        CBlockHeader::operator=(block);
+        vtx = std::move(block.vtx);
+        vchBlockSig = std::move(block.vchBlockSig);
+        fChecked = block.fChecked.load();
+        return *this;
+    }
+
     CBlock(const CBlockHeader &header)
     {
         SetNull();
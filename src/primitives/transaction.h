@@ -26,6 +26,14 @@
  */
 static const int SERIALIZE_TRANSACTION_NO_WITNESS = 0x40000000;
 
+/**
+ * A flag that is ORed into the version of a stream read from to step over the
+ * rangeproofs of confidential outputs instead of copying them, for readers of
+ * blocks that never verify or rewind them. Transactions read so have empty
+ * rangeproofs, their txids are right but their witness hashes and sizes are not.
+ */
+static const int SERIALIZE_TRANSACTION_NO_RANGEPROOF = 0x10000000;
+
 static const uint8_t GHOST_BLOCK_VERSION = 0xA0;
 static const uint8_t GHOST_TXN_VERSION = 0xA0;
 static const uint8_t MAX_GHOST_TXN_VERSION = 0xBF;
@@ -296,6 +304,7 @@ public:
     virtual const CScript *GetPScriptPubKey() const { return nullptr; };
 
     virtual secp256k1_pedersen_commitment *GetPCommitment() { return nullptr; };
+    virtual const secp256k1_pedersen_commitment *GetPCommitment() const { return nullptr; };
     virtual std::vector<uint8_t> *GetPRangeproof() { return nullptr; };
     virtual std::vector<uint8_t> *GetPData() { return nullptr; };
     virtual const std::vector<uint8_t> *GetPRangeproof() const { return nullptr; };
@@ -366,6 +375,23 @@ public:
     }
 };
 
+template<typename Stream>
+void UnserializeRangeproof(Stream &s, std::vector<uint8_t> &vRangeproof)
+{
+    if (!(s.GetVersion() & SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
+        s >> vRangeproof;
+        return;
+    }
+    vRangeproof.clear();
+    uint64_t nSize = ReadCompactSize(s);
+    char buf[4096];
+    while (nSize > 0) {
+        size_t n = std::min<uint64_t>(nSize, sizeof(buf));
+        s.read(buf, n);
+        nSize -= n;
+    }
+}
+
 class CTxOutCT : public CTxOutBase
 {
 public:
@@ -400,7 +426,7 @@ public:
         s >> vData;
         s >> *(CScriptBase*)(&scriptPubKey);
 
-        s >> vRangeproof;
+        UnserializeRangeproof(s, vRangeproof);
     }
 
     bool PutValue(std::vector<uint8_t> &vchAmount) const override
@@ -425,6 +451,10 @@ public:
     {
         return &commitment;
     }
+    const secp256k1_pedersen_commitment *GetPCommitment() const override
+    {
+        return &commitment;
+    }
 
     std::vector<uint8_t> *GetPRangeproof() override
     {
@@ -475,7 +505,7 @@ public:
         s.read((char*)pk.ncbegin(), 33);
         s.read((char*)commitment.data, 33);
         s >> vData;
-        s >> vRangeproof;
+        UnserializeRangeproof(s, vRangeproof);
     }
 
     bool PutValue(std::vector<uint8_t> &vchAmount) const override
@@ -489,6 +519,10 @@ public:
     {
         return &commitment;
     }
+    const secp256k1_pedersen_commitment *GetPCommitment() const override
+    {
+        return &commitment;
+    }
 
     std::vector<uint8_t> *GetPRangeproof() override
     {
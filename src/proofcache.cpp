@@ -0,0 +1,190 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <proofcache.h>
+
+#include <crypto/sha256.h>
+#include <random.h>
+#include <script/sigcache.h>
+#include <sync.h>
+#include <util/system.h>
+
+#include <cuckoocache.h>
+#include <boost/thread/shared_mutex.hpp>
+
+#include <atomic>
+#include <deque>
+#include <map>
+
+namespace {
+/**
+ * Entries are SHA256(nonce || 'T', 'R' or 'M' || 31 zero bytes || proof data),
+ * the proof data covering everything the verification reads. Transaction
+ * entries are keyed by the witness hash, which commits to every rangeproof
+ * and commitment of the transaction.
+ */
+class CProofCache
+{
+private:
+    CSHA256 m_salted_hasher_tx;
+    CSHA256 m_salted_hasher_rangeproof;
+    CSHA256 m_salted_hasher_mlsag;
+    typedef CuckooCache::cache<uint256, SignatureCacheHasher> map_type;
+    map_type setValid;
+    boost::shared_mutex cs_proofcache;
+
+public:
+    CProofCache()
+    {
+        uint256 nonce = GetRandHash();
+        static constexpr unsigned char PADDING_TX[32] = {'T'};
+        static constexpr unsigned char PADDING_RANGEPROOF[32] = {'R'};
+        static constexpr unsigned char PADDING_MLSAG[32] = {'M'};
+        m_salted_hasher_tx.Write(nonce.begin(), 32);
+        m_salted_hasher_tx.Write(PADDING_TX, 32);
+        m_salted_hasher_rangeproof.Write(nonce.begin(), 32);
+        m_salted_hasher_rangeproof.Write(PADDING_RANGEPROOF, 32);
+        m_salted_hasher_mlsag.Write(nonce.begin(), 32);
+        m_salted_hasher_mlsag.Write(PADDING_MLSAG, 32);
+    }
+
+    CSHA256 TxHasher() const { return m_salted_hasher_tx; }
+    CSHA256 RangeProofHasher() const { return m_salted_hasher_rangeproof; }
+    CSHA256 MLSAGHasher() const { return m_salted_hasher_mlsag; }
+
+    bool Get(const uint256 &entry, const bool erase)
+    {
+        boost::shared_lock<boost::shared_mutex> lock(cs_proofcache);
+        return setValid.contains(entry, erase);
+    }
+
+    void Set(const uint256 &entry)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(cs_proofcache);
+        setValid.insert(entry);
+    }
+
+    uint32_t setup_bytes(size_t n)
+    {
+        return setValid.setup_bytes(n);
+    }
+};
+
+/** Failed proofs are rare and only kept until the next check, a few are enough */
+static const size_t MAX_FAILED_PROOFS = 1000;
+
+class CFailedProofs
+{
+private:
+    Mutex m_mutex;
+    std::map<uint256, std::string> m_errors GUARDED_BY(m_mutex);
+    std::deque<uint256> m_order GUARDED_BY(m_mutex);
+
+public:
+    void Add(const uint256 &entry, const std::string &error)
+    {
+        LOCK(m_mutex);
+        if (!m_errors.emplace(entry, error).second) {
+            return;
+        }
+        m_order.push_back(entry);
+        while (m_order.size() > MAX_FAILED_PROOFS) {
+            m_errors.erase(m_order.front());
+            m_order.pop_front();
+        }
+    }
+
+    bool Take(const uint256 &entry, std::string &error)
+    {
+        LOCK(m_mutex);
+        auto it = m_errors.find(entry);
+        if (it == m_errors.end()) {
+            return false;
+        }
+        error = it->second;
+        m_errors.erase(it);
+        return true;
+    }
+};
+
+static CProofCache proofCache;
+static CFailedProofs failedProofs;
+static std::atomic<uint64_t> g_block_hits{0};
+static std::atomic<uint64_t> g_block_misses{0};
+} // namespace
+
+void InitProofCache()
+{
+    size_t nMaxCacheSize = std::min(std::max((int64_t)0, gArgs.GetArg("-maxproofcachesize", DEFAULT_MAX_PROOF_CACHE_SIZE)), MAX_MAX_PROOF_CACHE_SIZE) * ((size_t) 1 << 20);
+    size_t nElems = proofCache.setup_bytes(nMaxCacheSize);
+    LogPrintf("Using %zu MiB out of %zu requested for proof cache, able to store %zu elements\n",
+            (nElems*sizeof(uint256)) >>20, nMaxCacheSize>>20, nElems);
+}
+
+uint256 TxProofCacheEntry(const uint256 &wtxid, uint32_t flags)
+{
+    uint256 entry;
+    proofCache.TxHasher().Write(wtxid.begin(), 32).Write((const unsigned char*)&flags, sizeof(flags)).Finalize(entry.begin());
+    return entry;
+}
+
+uint256 RangeProofCacheEntry(bool bulletproof, const uint8_t *commitment, const std::vector<uint8_t> &proof)
+{
+    uint256 entry;
+    const uint8_t type = bulletproof ? 1 : 0;
+    proofCache.RangeProofHasher().Write(&type, 1).Write(commitment, 33).Write(proof.data(), proof.size()).Finalize(entry.begin());
+    return entry;
+}
+
+uint256 MLSAGCacheEntry(const uint8_t *preimage, size_t cols, size_t rows, const std::vector<uint8_t> &vM,
+    const std::vector<const uint8_t*> &in_commits, const std::vector<const uint8_t*> &out_commits,
+    const uint8_t *ki, const uint8_t *pc, const uint8_t *ss)
+{
+    uint256 entry;
+    CSHA256 hasher = proofCache.MLSAGHasher();
+    const uint32_t dims[4] = {(uint32_t)cols, (uint32_t)rows, (uint32_t)in_commits.size(), (uint32_t)out_commits.size()};
+    hasher.Write((const unsigned char*)dims, sizeof(dims));
+    hasher.Write(preimage, 32);
+    hasher.Write(vM.data(), vM.size());
+    for (const uint8_t *commit : in_commits) {
+        hasher.Write(commit, 33);
+    }
+    for (const uint8_t *commit : out_commits) {
+        hasher.Write(commit, 33);
+    }
+    hasher.Write(ki, (rows - 1) * 33);
+    hasher.Write(pc, 32);
+    hasher.Write(ss, cols * rows * 32).Finalize(entry.begin());
+    return entry;
+}
+
+bool ProofCacheContains(const uint256 &entry, bool erase)
+{
+    const bool found = proofCache.Get(entry, erase);
+    if (erase) {
+        (found ? g_block_hits : g_block_misses)++;
+    }
+    return found;
+}
+
+void ProofCacheAdd(const uint256 &entry)
+{
+    proofCache.Set(entry);
+}
+
+void ProofCacheAddFailed(const uint256 &entry, const std::string &error)
+{
+    failedProofs.Add(entry, error);
+}
+
+bool ProofCacheTakeFailed(const uint256 &entry, std::string &error)
+{
+    return failedProofs.Take(entry, error);
+}
+
+void GetProofCacheStats(uint64_t &hits, uint64_t &misses)
+{
+    hits = g_block_hits;
+    misses = g_block_misses;
+}
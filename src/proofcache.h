@@ -0,0 +1,53 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_PROOFCACHE_H
+#define BITCOIN_PROOFCACHE_H
+
+#include <uint256.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** Default for -maxproofcachesize, the memory in MiB held by the proof cache */
+static const int64_t DEFAULT_MAX_PROOF_CACHE_SIZE = 8;
+/** Maximum proof cache size allowed */
+static const int64_t MAX_MAX_PROOF_CACHE_SIZE = 4096;
+
+/**
+ * Rangeproofs and MLSAG ring signatures that verified, so transactions
+ * checked on entering the mempool aren't checked again in a block.
+ * Like the signature cache, mempool checks store entries and block checks
+ * erase the entries they find.
+ */
+void InitProofCache();
+
+/** Entry for all rangeproofs of a transaction, flags are the consensus rules they were verified under */
+uint256 TxProofCacheEntry(const uint256 &wtxid, uint32_t flags);
+
+/** Entry for the rangeproof of a blinded output */
+uint256 RangeProofCacheEntry(bool bulletproof, const uint8_t *commitment, const std::vector<uint8_t> &proof);
+
+/** Entry for a ring signature, must be computed before the check prepares vM */
+uint256 MLSAGCacheEntry(const uint8_t *preimage, size_t cols, size_t rows, const std::vector<uint8_t> &vM,
+    const std::vector<const uint8_t*> &in_commits, const std::vector<const uint8_t*> &out_commits,
+    const uint8_t *ki, const uint8_t *pc, const uint8_t *ss);
+
+/** Look up an entry, lookups erasing hits are made by block checks and counted */
+bool ProofCacheContains(const uint256 &entry, bool erase);
+void ProofCacheAdd(const uint256 &entry);
+
+/**
+ * Proofs that failed in a mempool check, with the reject reason. A relayed
+ * transaction pre-validated outside cs_main is checked again on entering the
+ * mempool, which takes the failure instead of verifying the proof twice.
+ */
+void ProofCacheAddFailed(const uint256 &entry, const std::string &error);
+bool ProofCacheTakeFailed(const uint256 &entry, std::string &error);
+
+/** Hits and misses of block checks since startup */
+void GetProofCacheStats(uint64_t &hits, uint64_t &misses);
+
+#endif // BITCOIN_PROOFCACHE_H
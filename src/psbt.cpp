@@ -4,6 +4,7 @@
 
 #include <psbt.h>
 #include <util/strencodings.h>
+#include <util/taskpool.h>
 
 
 PartiallySignedTransaction::PartiallySignedTransaction(const CMutableTransaction& tx) : tx(tx)
@@ -226,26 +227,14 @@ void UpdatePSBTOutput(const SigningProvider& provider, PartiallySignedTransactio
     psbt_out.FromSignatureData(sigdata);
 }
 
-bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction& psbt, int index, int sighash, SignatureData* out_sigdata, bool use_dummy)
+static bool GetPSBTInputSigningUTXO(const PartiallySignedTransaction& psbt, int index, CTxOut& utxo, bool& require_witness_sig)
 {
-    PSBTInput& input = psbt.inputs.at(index);
-    const CMutableTransaction& tx = *psbt.tx;
-
-    if (PSBTInputSigned(input)) {
-        return true;
-    }
-
-    // Fill SignatureData with input info
-    SignatureData sigdata;
-    input.FillSignatureData(sigdata);
-
-    // Get UTXO
-    bool require_witness_sig = false;
-    CTxOut utxo;
+    const PSBTInput& input = psbt.inputs.at(index);
+    require_witness_sig = false;
 
     if (input.non_witness_utxo) {
         // If we're taking our information from a non-witness UTXO, verify that it matches the prevout.
-        COutPoint prevout = tx.vin[index].prevout;
+        COutPoint prevout = psbt.tx->vin[index].prevout;
         if (prevout.n >= input.non_witness_utxo->vout.size()) {
             return false;
         }
@@ -263,6 +252,28 @@ bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction&
     } else {
         return false;
     }
+    return true;
+}
+
+bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction& psbt, int index, int sighash, SignatureData* out_sigdata, bool use_dummy, const PrecomputedTransactionData* txdata)
+{
+    PSBTInput& input = psbt.inputs.at(index);
+    const CMutableTransaction& tx = *psbt.tx;
+
+    if (PSBTInputSigned(input)) {
+        return true;
+    }
+
+    // Fill SignatureData with input info
+    SignatureData sigdata;
+    input.FillSignatureData(sigdata);
+
+    // Get UTXO
+    bool require_witness_sig;
+    CTxOut utxo;
+    if (!GetPSBTInputSigningUTXO(psbt, index, utxo, require_witness_sig)) {
+        return false;
+    }
 
     sigdata.witness = false;
     bool sig_complete;
@@ -271,7 +282,7 @@ bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction&
     } else {
         std::vector<uint8_t> amount(8);
         part::SetAmount(amount, utxo.nValue);
-        MutableTransactionSignatureCreator creator(&tx, index, amount, sighash);
+        MutableTransactionSignatureCreator creator(&tx, index, amount, sighash, txdata);
         sig_complete = ProduceSignature(provider, creator, utxo.scriptPubKey, sigdata);
     }
     // Verify that a witness signature was produced in case one was required.
@@ -296,6 +307,36 @@ bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction&
     return sig_complete;
 }
 
+void SignPSBTInputs(const SigningProvider& provider, PartiallySignedTransaction& psbt, const std::vector<unsigned int>& indices, int sighash)
+{
+    const CMutableTransaction& tx = *psbt.tx;
+    const PrecomputedTransactionData txdata(tx);
+
+    // Look up the keys and scripts on this thread, provider may take locks the caller holds
+    FlatSigningProvider keys;
+    for (unsigned int index : indices) {
+        const PSBTInput& input = psbt.inputs.at(index);
+        if (PSBTInputSigned(input)) {
+            continue;
+        }
+        SignatureData sigdata;
+        input.FillSignatureData(sigdata);
+        bool require_witness_sig;
+        CTxOut utxo;
+        if (!GetPSBTInputSigningUTXO(psbt, index, utxo, require_witness_sig)) {
+            continue;
+        }
+        std::vector<uint8_t> amount(8);
+        part::SetAmount(amount, utxo.nValue);
+        GatherSigningProvider(provider, MutableTransactionSignatureCreator(&tx, index, amount, sighash), utxo.scriptPubKey, sigdata, keys);
+    }
+
+    // Each input only writes its own PSBTInput
+    g_task_pool.ParallelFor(TaskPriority::HIGH, indices.size(), [&](size_t i) {
+        SignPSBTInput(keys, psbt, indices[i], sighash, nullptr, false, &txdata);
+    });
+}
+
 bool FinalizePSBT(PartiallySignedTransaction& psbtx)
 {
     // Finalize input signatures -- in case we have partial signatures that add up to a complete
@@ -569,8 +569,11 @@ std::string PSBTRoleName(PSBTRole role);
 /** Checks whether a PSBTInput is already signed. */
 bool PSBTInputSigned(const PSBTInput& input);
 
-/** Signs a PSBTInput, verifying that all provided data matches what is being signed. */
-bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction& psbt, int index, int sighash = SIGHASH_ALL, SignatureData* out_sigdata = nullptr, bool use_dummy = false);
+/** Signs a PSBTInput, verifying that all provided data matches what is being signed. txdata, when set, must be computed from psbt.tx. */
+bool SignPSBTInput(const SigningProvider& provider, PartiallySignedTransaction& psbt, int index, int sighash = SIGHASH_ALL, SignatureData* out_sigdata = nullptr, bool use_dummy = false, const PrecomputedTransactionData* txdata = nullptr);
+
+/** Signs the PSBTInputs at indices in parallel on the task pool, provider is only used on the calling thread. */
+void SignPSBTInputs(const SigningProvider& provider, PartiallySignedTransaction& psbt, const std::vector<unsigned int>& indices, int sighash = SIGHASH_ALL);
 
 /** Counts the unsigned inputs of a PSBT. */
 size_t CountPSBTUnsignedInputs(const PartiallySignedTransaction& psbt);
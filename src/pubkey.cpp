@@ -5,14 +5,77 @@
 
 #include <pubkey.h>
 
+#include <crypto/common.h>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <secp256k1_schnorrsig.h>
 
+#include <atomic>
+#include <mutex>
+
 namespace
 {
 /* Global secp256k1_context object used for verification. */
 secp256k1_context* secp256k1_context_verify = nullptr;
+
+/** Direct mapped cache of parsed compressed pubkeys, slots are picked from the
+ *  x coordinate and a colliding key simply replaces the entry. */
+class ParsedPubKeyCache
+{
+    static constexpr size_t SLOTS = 1024;
+    struct Entry {
+        bool used = false;
+        unsigned char key[CPubKey::COMPRESSED_SIZE];
+        secp256k1_pubkey parsed;
+    };
+    std::mutex m_mutex;
+    Entry m_entries[SLOTS];
+    size_t m_used = 0;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+
+    static size_t Slot(const unsigned char *key) { return ReadLE32(key + 1) % SLOTS; }
+
+public:
+    bool Get(const CPubKey &key, secp256k1_pubkey &out)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const Entry &e = m_entries[Slot(key.data())];
+            if (e.used && memcmp(e.key, key.data(), CPubKey::COMPRESSED_SIZE) == 0) {
+                out = e.parsed;
+                m_hits++;
+                return true;
+            }
+        }
+        m_misses++;
+        if (!secp256k1_ec_pubkey_parse(secp256k1_context_verify, &out, key.data(), key.size())) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Entry &e = m_entries[Slot(key.data())];
+        if (!e.used) {
+            m_used++;
+        }
+        e.used = true;
+        memcpy(e.key, key.data(), CPubKey::COMPRESSED_SIZE);
+        e.parsed = out;
+        return true;
+    }
+
+    PubKeyCacheStats Stats()
+    {
+        PubKeyCacheStats stats;
+        stats.hits = m_hits;
+        stats.misses = m_misses;
+        stats.slots = SLOTS;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        stats.entries = m_used;
+        return stats;
+    }
+};
+
+ParsedPubKeyCache g_parsed_pubkey_cache;
 } // namespace
 
 /** This function is taken from the libsecp256k1 distribution and implements
@@ -211,6 +274,28 @@ bool CPubKey::Verify(const uint256 &hash, const std::vector<unsigned char>& vchS
     return secp256k1_ecdsa_verify(secp256k1_context_verify, &sig, hash.begin(), &pubkey);
 }
 
+bool CPubKey::VerifyCached(const uint256 &hash, const std::vector<unsigned char>& vchSig) const {
+    if (!IsCompressed()) {
+        return Verify(hash, vchSig);
+    }
+    secp256k1_pubkey pubkey;
+    secp256k1_ecdsa_signature sig;
+    assert(secp256k1_context_verify && "secp256k1_context_verify must be initialized to use CPubKey.");
+    if (!ecdsa_signature_parse_der_lax(secp256k1_context_verify, &sig, vchSig.data(), vchSig.size())) {
+        return false;
+    }
+    if (!g_parsed_pubkey_cache.Get(*this, pubkey)) {
+        return false;
+    }
+    secp256k1_ecdsa_signature_normalize(secp256k1_context_verify, &sig, &sig);
+    return secp256k1_ecdsa_verify(secp256k1_context_verify, &sig, hash.begin(), &pubkey);
+}
+
+PubKeyCacheStats GetPubKeyCacheStats()
+{
+    return g_parsed_pubkey_cache.Stats();
+}
+
 bool CPubKey::RecoverCompact(const uint256 &hash, const std::vector<unsigned char>& vchSig) {
     if (vchSig.size() != COMPACT_SIGNATURE_SIZE)
         return false;
@@ -339,6 +424,65 @@ bool CExtPubKey::Derive(CExtPubKey &out, unsigned int _nChild) const {
     return pubkey.Derive(out.pubkey, out.chaincode, _nChild, chaincode);
 }
 */
+CPubKeyBatchDeriver::CPubKeyBatchDeriver(const CPubKey &parent, const unsigned char chaincode[32])
+    : m_hmac(chaincode, 32)
+{
+    static_assert(sizeof(m_point) == sizeof(secp256k1_pubkey), "Parsed point size mismatch");
+    assert(secp256k1_context_verify && "secp256k1_context_verify must be initialized to use CPubKey.");
+    if (!parent.IsCompressed()) {
+        return;
+    }
+    secp256k1_pubkey pubkey;
+    if (!secp256k1_ec_pubkey_parse(secp256k1_context_verify, &pubkey, parent.begin(), parent.size())) {
+        return;
+    }
+    memcpy(m_point, &pubkey, sizeof(m_point));
+    m_hmac.Write(parent.begin(), parent.size());
+    m_valid = true;
+}
+
+bool CPubKeyBatchDeriver::DeriveRaw(uint32_t nChild, unsigned char out[CPubKey::COMPRESSED_SIZE]) const
+{
+    if (!m_valid || (nChild >> 31) != 0) {
+        return false;
+    }
+    unsigned char num[4], tweak[64];
+    WriteBE32(num, nChild);
+    CHMAC_SHA512(m_hmac).Write(num, 4).Finalize(tweak);
+
+    secp256k1_pubkey pubkey;
+    memcpy(&pubkey, m_point, sizeof(m_point));
+    if (!secp256k1_ec_pubkey_tweak_add(secp256k1_context_verify, &pubkey, tweak)) {
+        return false;
+    }
+    size_t publen = CPubKey::COMPRESSED_SIZE;
+    secp256k1_ec_pubkey_serialize(secp256k1_context_verify, out, &publen, &pubkey, SECP256K1_EC_COMPRESSED);
+    return true;
+}
+
+bool CPubKeyBatchDeriver::Derive(CPubKey &out, uint32_t nChild) const
+{
+    unsigned char pub[CPubKey::COMPRESSED_SIZE];
+    if (!DeriveRaw(nChild, pub)) {
+        return false;
+    }
+    out.Set(pub, pub + CPubKey::COMPRESSED_SIZE);
+    return true;
+}
+
+size_t CPubKeyBatchDeriver::DeriveRange(uint32_t nBegin, uint32_t nEnd, unsigned char *out) const
+{
+    size_t nDerived = 0;
+    for (uint32_t i = nBegin; i < nEnd; ++i, out += CPubKey::COMPRESSED_SIZE) {
+        if (DeriveRaw(i, out)) {
+            nDerived++;
+        } else {
+            memset(out, 0, CPubKey::COMPRESSED_SIZE);
+        }
+    }
+    return nDerived;
+}
+
 /* static */ bool CPubKey::CheckLowS(const std::vector<unsigned char>& vchSig) {
     secp256k1_ecdsa_signature sig;
     assert(secp256k1_context_verify && "secp256k1_context_verify must be initialized to use CPubKey.");
@@ -348,6 +492,28 @@ bool CExtPubKey::Derive(CExtPubKey &out, unsigned int _nChild) const {
     return (!secp256k1_ecdsa_signature_normalize(secp256k1_context_verify, nullptr, &sig));
 }
 
+void GetKeyIDs(const std::vector<CPubKey> &pubkeys, std::vector<CKeyID> &ids)
+{
+    ids.resize(pubkeys.size());
+    std::vector<size_t> compressed;
+    std::vector<unsigned char> packed;
+    compressed.reserve(pubkeys.size());
+    packed.reserve(pubkeys.size() * CPubKey::COMPRESSED_SIZE);
+    for (size_t i = 0; i < pubkeys.size(); ++i) {
+        if (pubkeys[i].size() == CPubKey::COMPRESSED_SIZE) {
+            compressed.push_back(i);
+            packed.insert(packed.end(), pubkeys[i].begin(), pubkeys[i].end());
+        } else {
+            ids[i] = pubkeys[i].GetID();
+        }
+    }
+    std::vector<unsigned char> hashes(compressed.size() * CHash160::OUTPUT_SIZE);
+    Hash160Batch(hashes.data(), packed.data(), CPubKey::COMPRESSED_SIZE, compressed.size());
+    for (size_t k = 0; k < compressed.size(); ++k) {
+        memcpy(ids[compressed[k]].begin(), &hashes[k * CHash160::OUTPUT_SIZE], CHash160::OUTPUT_SIZE);
+    }
+}
+
 /* static */ int ECCVerifyHandle::refcount = 0;
 
 ECCVerifyHandle::ECCVerifyHandle()
@@ -7,6 +7,7 @@
 #ifndef BITCOIN_PUBKEY_H
 #define BITCOIN_PUBKEY_H
 
+#include <crypto/hmac_sha512.h>
 #include <hash.h>
 #include <serialize.h>
 #include <span.h>
@@ -206,6 +207,12 @@ public:
      */
     bool Verify(const uint256& hash, const std::vector<unsigned char>& vchSig) const;
 
+    /**
+     * Verify a DER signature, reusing the parsed point of a compressed key
+     * seen before. For keys that sign repeatedly, like stakers.
+     */
+    bool VerifyCached(const uint256& hash, const std::vector<unsigned char>& vchSig) const;
+
     /**
      * Check whether a signature is normalized (lower-S).
      */
@@ -414,6 +421,41 @@ struct CExtPubKey {
     bool Derive(CExtPubKey& out, unsigned int nChild) const;
 };
 */
+/** Derives non-hardened children of one parent pubkey and chaincode.
+ *  The parent point is parsed and the HMAC keyed and fed the parent once,
+ *  the derive functions are const and can run on split ranges from several threads.
+ */
+class CPubKeyBatchDeriver
+{
+public:
+    CPubKeyBatchDeriver(const CPubKey &parent, const unsigned char chaincode[32]);
+
+    bool IsValid() const { return m_valid; }
+    bool Derive(CPubKey &out, uint32_t nChild) const;
+    //! Write 33 byte compressed child pubkeys for [nBegin, nEnd) to out, children that can't be derived are left zeroed
+    size_t DeriveRange(uint32_t nBegin, uint32_t nEnd, unsigned char *out) const;
+
+private:
+    bool DeriveRaw(uint32_t nChild, unsigned char out[CPubKey::COMPRESSED_SIZE]) const;
+
+    CHMAC_SHA512 m_hmac;
+    unsigned char m_point[64]; // Parsed secp256k1_pubkey of the parent
+    bool m_valid = false;
+};
+
+/** Get the key ids of several pubkeys, compressed keys are hashed in batches. */
+void GetKeyIDs(const std::vector<CPubKey> &pubkeys, std::vector<CKeyID> &ids);
+
+struct PubKeyCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+    size_t slots = 0;
+};
+
+/** Get the counters of the parsed pubkey cache used by CPubKey::VerifyCached. */
+PubKeyCacheStats GetPubKeyCacheStats();
+
 /** Users of this module must hold an ECCVerifyHandle. The constructor and
  *  destructor of these are not allowed to run in parallel, though. */
 class ECCVerifyHandle
@@ -17,14 +17,18 @@
 #include <core_io.h>
 #include <interfaces/handler.h>
 #include <uint256.h>
+#include <util/threadnames.h>
 
 #include <algorithm>
+#include <map>
 
 #include <QColor>
 #include <QDateTime>
 #include <QDebug>
 #include <QIcon>
 #include <QList>
+#include <QThread>
+#include <QTimer>
 
 
 // Amount column is right-aligned it contains numbers
@@ -39,22 +43,8 @@ static int column_alignments[] = {
         Qt::AlignRight|Qt::AlignVCenter, /* amount */
     };
 
-// Comparison operator for sort/binary search of model tx list
-struct TxLessThan
-{
-    bool operator()(const TransactionRecord &a, const TransactionRecord &b) const
-    {
-        return a.hash < b.hash;
-    }
-    bool operator()(const TransactionRecord &a, const uint256 &b) const
-    {
-        return a.hash < b;
-    }
-    bool operator()(const uint256 &a, const TransactionRecord &b) const
-    {
-        return a < b.hash;
-    }
-};
+//! Transactions decomposed per page when loading the table
+static const int TX_LOAD_PAGE_SIZE = 1000;
 
 // queue notifications to show a non freezing progress dialog e.g. for rescan
 struct TransactionNotification
@@ -93,10 +83,21 @@ public:
     bool show_zero_value_coinstakes;
 
     /* Local cache of wallet.
-     * As it is in the same order as the CWallet, by definition
-     * this is sorted by sha256.
+     * In load order, with the records of a transaction adjacent. The views
+     * sort through a proxy model, so new rows are appended.
      */
     QList<TransactionRecord> cachedWallet;
+    //! First row in cachedWallet of each loaded transaction
+    std::map<uint256, int> mapFirstRow;
+
+    //! Hashes of the wallet transactions, newest first, loaded up to nPendingPos
+    std::vector<uint256> vPendingHashes;
+    size_t nPendingPos = 0;
+    //! A page from nLoadingPos is being decomposed on the load thread
+    bool fLoadingPage = false;
+    size_t nLoadingPos = 0;
+    //! Bumped on refresh so pages of an earlier refresh are dropped
+    int nLoadGeneration = 0;
 
     bool fQueueNotifications = false;
     std::vector< TransactionNotification > vQueueNotifications;
@@ -104,22 +105,80 @@ public:
     void NotifyTransactionChanged(const uint256 &hash, ChangeType status);
     void ShowProgress(const std::string &title, int nProgress);
 
-    /* Query entire wallet anew from core.
+    /* Decompose the transactions in hashes, safe to call off the GUI thread.
+     */
+    static QList<TransactionRecord> decomposePage(interfaces::Wallet& wallet, const std::vector<uint256>& hashes, bool show_zero_value_coinstakes)
+    {
+        QList<TransactionRecord> records;
+        if (!TransactionRecord::showTransaction()) {
+            return records;
+        }
+        for (const auto& wtx : wallet.getWalletTxs(hashes)) {
+            if (!show_zero_value_coinstakes && wtx.is_coinstake && wtx.credit == wtx.debit) {
+                continue;
+            }
+            records.append(TransactionRecord::decomposeTransaction(wtx));
+        }
+        return records;
+    }
+
+    bool havePending() const
+    {
+        return nPendingPos < vPendingHashes.size();
+    }
+
+    std::vector<uint256> takePage(size_t max_size)
+    {
+        const size_t end = std::min(vPendingHashes.size(), nPendingPos + max_size);
+        std::vector<uint256> hashes(vPendingHashes.begin() + nPendingPos, vPendingHashes.begin() + end);
+        nPendingPos = end;
+        return hashes;
+    }
+
+    void reindex()
+    {
+        mapFirstRow.clear();
+        for (int i = cachedWallet.size() - 1; i >= 0; --i) {
+            mapFirstRow[cachedWallet[i].hash] = i;
+        }
+    }
+
+    /* Append records not already in the model, which may have been added by
+     * a notification while their page was loading.
+     */
+    void appendRecords(const QList<TransactionRecord>& records, bool notify)
+    {
+        QList<TransactionRecord> toAppend;
+        for (const TransactionRecord &rec : records) {
+            if (!mapFirstRow.count(rec.hash)) {
+                toAppend.append(rec);
+            }
+        }
+        if (toAppend.isEmpty()) {
+            return;
+        }
+        const int first = cachedWallet.size();
+        if (notify) parent->beginInsertRows(QModelIndex(), first, first + toAppend.size() - 1);
+        cachedWallet.append(toAppend);
+        for (int i = cachedWallet.size() - 1; i >= first; --i) {
+            mapFirstRow[cachedWallet[i].hash] = i;
+        }
+        if (notify) parent->endInsertRows();
+    }
+
+    /* Query the wallet anew from core, loading the newest page now and the
+     * rest on demand.
      */
     void refreshWallet(interfaces::Wallet& wallet)
     {
         qDebug() << "TransactionTablePriv::refreshWallet";
         cachedWallet.clear();
-        {
-            for (const auto& wtx : wallet.getWalletTxs()) {
-                if (TransactionRecord::showTransaction()) {
-                    if (!show_zero_value_coinstakes && wtx.is_coinstake && wtx.credit == wtx.debit) {
-                        continue;
-                    }
-                    cachedWallet.append(TransactionRecord::decomposeTransaction(wtx));
-                }
-            }
-        }
+        mapFirstRow.clear();
+        vPendingHashes = wallet.getWalletTxHashes();
+        nPendingPos = 0;
+        fLoadingPage = false;
+        ++nLoadGeneration;
+        appendRecords(decomposePage(wallet, takePage(TX_LOAD_PAGE_SIZE), show_zero_value_coinstakes), false);
     }
 
     /* Update our model of the wallet incrementally, to synchronize our model of the wallet
@@ -132,13 +191,22 @@ public:
         qDebug() << "TransactionTablePriv::updateWallet: " + QString::fromStdString(hash.ToString()) + " " + QString::number(status);
 
         // Find bounds of this transaction in model
-        QList<TransactionRecord>::iterator lower = std::lower_bound(
-            cachedWallet.begin(), cachedWallet.end(), hash, TxLessThan());
-        QList<TransactionRecord>::iterator upper = std::upper_bound(
-            cachedWallet.begin(), cachedWallet.end(), hash, TxLessThan());
-        int lowerIndex = (lower - cachedWallet.begin());
-        int upperIndex = (upper - cachedWallet.begin());
-        bool inModel = (lower != upper);
+        auto findRows = [this](const uint256 &hash, int &lowerIndex, int &upperIndex) {
+            auto mi = mapFirstRow.find(hash);
+            lowerIndex = upperIndex = mi != mapFirstRow.end() ? mi->second : cachedWallet.size();
+            while (upperIndex < cachedWallet.size() && cachedWallet[upperIndex].hash == hash) {
+                upperIndex++;
+            }
+            return lowerIndex != upperIndex;
+        };
+        auto removeRows = [this](int lowerIndex, int upperIndex) {
+            parent->beginRemoveRows(QModelIndex(), lowerIndex, upperIndex-1);
+            cachedWallet.erase(cachedWallet.begin() + lowerIndex, cachedWallet.begin() + upperIndex);
+            reindex();
+            parent->endRemoveRows();
+        };
+        int lowerIndex, upperIndex;
+        bool inModel = findRows(hash, lowerIndex, upperIndex);
 
         if(status == CT_UPDATED)
         {
@@ -158,17 +226,8 @@ public:
             if(inModel)
             {
             // remove entire transaction from table
-                parent->beginRemoveRows(QModelIndex(), lowerIndex, upperIndex-1);
-                cachedWallet.erase(lower, upper);
-                parent->endRemoveRows();
-
-                lower = std::lower_bound(
-                    cachedWallet.begin(), cachedWallet.end(), hash, TxLessThan());
-                upper = std::upper_bound(
-                    cachedWallet.begin(), cachedWallet.end(), hash, TxLessThan());
-                lowerIndex = (lower - cachedWallet.begin());
-                upperIndex = (upper - cachedWallet.begin());
-                inModel = (lower != upper);
+                removeRows(lowerIndex, upperIndex);
+                inModel = findRows(hash, lowerIndex, upperIndex);
             }
             // drop through
         case CT_NEW:
@@ -191,32 +250,18 @@ public:
                     break;
                 }
 
-                // Added -- insert at the right position
-                QList<TransactionRecord> toInsert =
-                        TransactionRecord::decomposeTransaction(wtx);
-                if(!toInsert.isEmpty()) /* only if something to insert */
-                {
-                    parent->beginInsertRows(QModelIndex(), lowerIndex, lowerIndex+toInsert.size()-1);
-                    int insert_idx = lowerIndex;
-                    for (const TransactionRecord &rec : toInsert)
-                    {
-                        cachedWallet.insert(insert_idx, rec);
-                        insert_idx += 1;
-                    }
-                    parent->endInsertRows();
-                }
+                // Added -- append, a page still to load skips it
+                appendRecords(TransactionRecord::decomposeTransaction(wtx), true);
             }
             break;
         case CT_DELETED:
             if(!inModel)
             {
-                qWarning() << "TransactionTablePriv::updateWallet: Warning: Got CT_DELETED, but transaction is not in model";
+                // Not loaded yet, or hidden
                 break;
             }
             // Removed -- remove entire transaction from table
-            parent->beginRemoveRows(QModelIndex(), lowerIndex, upperIndex-1);
-            cachedWallet.erase(lower, upper);
-            parent->endRemoveRows();
+            removeRows(lowerIndex, upperIndex);
             break;
         case CT_UPDATED:
             // Miscellaneous updates -- nothing to do, status update will take care of this, and is only computed for
@@ -274,12 +319,22 @@ TransactionTableModel::TransactionTableModel(const PlatformStyle *_platformStyle
         walletModel(parent),
         priv(new TransactionTablePriv(this)),
         fProcessingQueuedTransactions(false),
-        platformStyle(_platformStyle)
+        platformStyle(_platformStyle),
+        m_load_thread(new QThread(this))
 {
     columns << QString() << QString() << tr("Date") << tr("Type") << tr("Label") << tr("In") << tr("Out") << BitcoinUnits::getAmountColumnTitle(walletModel->getOptionsModel()->getDisplayUnit());
     priv->show_zero_value_coinstakes = walletModel->getOptionsModel()->getShowZeroValueCoinstakes();
     priv->refreshWallet(walletModel->wallet());
 
+    // Pages after the first are decomposed on m_load_thread, in m_loader's context
+    m_loader = new QObject;
+    connect(m_load_thread, &QThread::finished, m_loader, &QObject::deleteLater);
+    m_loader->moveToThread(m_load_thread);
+    m_load_thread->start();
+    QTimer::singleShot(0, m_loader, []() {
+        util::ThreadRename("qt-txload");
+    });
+
     connect(walletModel->getOptionsModel(), &OptionsModel::displayUnitChanged, this, &TransactionTableModel::updateDisplayUnit);
     connect(walletModel->getOptionsModel(), &OptionsModel::txnViewOptionsChanged, this, &TransactionTableModel::updateOptions);
 
@@ -289,9 +344,57 @@ TransactionTableModel::TransactionTableModel(const PlatformStyle *_platformStyle
 TransactionTableModel::~TransactionTableModel()
 {
     unsubscribeFromCoreSignals();
+    m_load_thread->quit();
+    m_load_thread->wait();
     delete priv;
 }
 
+bool TransactionTableModel::canFetchMore(const QModelIndex &parent) const
+{
+    return !parent.isValid() && priv->havePending();
+}
+
+void TransactionTableModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.isValid() || priv->fLoadingPage || !priv->havePending()) {
+        return;
+    }
+    priv->fLoadingPage = true;
+    priv->nLoadingPos = priv->nPendingPos;
+    const std::vector<uint256> hashes = priv->takePage(TX_LOAD_PAGE_SIZE);
+    const int generation = priv->nLoadGeneration;
+    const bool show_zero_value_coinstakes = priv->show_zero_value_coinstakes;
+    QTimer::singleShot(0, m_loader, [this, hashes, generation, show_zero_value_coinstakes] {
+        QList<TransactionRecord> records = TransactionTablePriv::decomposePage(walletModel->wallet(), hashes, show_zero_value_coinstakes);
+        QTimer::singleShot(0, this, [this, records, generation] {
+            if (generation != priv->nLoadGeneration) {
+                return;
+            }
+            priv->fLoadingPage = false;
+            // Loaded rows are not new, suppress the incoming transaction notifications
+            const bool processing_queued = fProcessingQueuedTransactions;
+            fProcessingQueuedTransactions = true;
+            priv->appendRecords(records, true);
+            fProcessingQueuedTransactions = processing_queued;
+        });
+    });
+}
+
+void TransactionTableModel::loadAll()
+{
+    // A page in flight is loaded again here and skipped when it arrives
+    if (priv->fLoadingPage) {
+        priv->nPendingPos = priv->nLoadingPos;
+    }
+    if (!priv->havePending()) {
+        return;
+    }
+    const bool processing_queued = fProcessingQueuedTransactions;
+    fProcessingQueuedTransactions = true;
+    priv->appendRecords(TransactionTablePriv::decomposePage(walletModel->wallet(), priv->takePage(priv->vPendingHashes.size()), priv->show_zero_value_coinstakes), true);
+    fProcessingQueuedTransactions = processing_queued;
+}
+
 /** Updates the column title to "Amount (DisplayUnit)" and emits headerDataChanged() signal for table headers to react. */
 void TransactionTableModel::updateAmountColumnTitle()
 {
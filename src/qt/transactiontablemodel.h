@@ -22,6 +22,10 @@ class TransactionRecord;
 class TransactionTablePriv;
 class WalletModel;
 
+QT_BEGIN_NAMESPACE
+class QThread;
+QT_END_NAMESPACE
+
 /** UI model for the transaction table of a wallet.
  */
 class TransactionTableModel : public QAbstractTableModel
@@ -90,6 +94,12 @@ public:
     QModelIndex index(int row, int column, const QModelIndex & parent = QModelIndex()) const override;
     bool processingQueuedTransactions() const { return fProcessingQueuedTransactions; }
 
+    /** Rows are loaded in pages, newest first, as views scroll to them. */
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+    /** Load every remaining row now, e.g. before an export. */
+    void loadAll();
+
 private:
     WalletModel *walletModel;
     std::unique_ptr<interfaces::Handler> m_handler_transaction_changed;
@@ -98,6 +108,8 @@ private:
     TransactionTablePriv *priv;
     bool fProcessingQueuedTransactions;
     const PlatformStyle *platformStyle;
+    QThread* const m_load_thread;
+    QObject* m_loader;
 
     void subscribeToCoreSignals();
     void unsubscribeFromCoreSignals();
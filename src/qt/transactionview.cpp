@@ -362,6 +362,9 @@ void TransactionView::exportClicked()
     if (filename.isNull())
         return;
 
+    // Rows not yet scrolled to are not in the model
+    model->getTransactionTableModel()->loadAll();
+
     CSVModelWriter writer(filename);
 
     // name, column, role
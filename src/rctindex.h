@@ -36,6 +36,21 @@ public:
     }
 };
 
+//! Size of an anon output in the packed form of anonoutputs and REST
+static const size_t PACKED_ANON_OUTPUT_SIZE = 33 + 33 + 32 + 4 + 4 + 1;
+
+/** Write ao as publickey, commitment, txnhash, n (uint32 LE), blockheight (int32 LE), compromised */
+template<typename Stream>
+void PackAnonOutput(Stream &s, const CAnonOutput &ao)
+{
+    s.write((const char*)ao.pubkey.begin(), 33);
+    s.write((const char*)ao.commitment.data, 33);
+    s << ao.outpoint.hash;
+    ser_writedata32(s, ao.outpoint.n);
+    ser_writedata32(s, (uint32_t)ao.nBlockHeight);
+    ser_writedata8(s, ao.nCompromised);
+}
+
 class CAnonKeyImageInfo
 {
 public:
@@ -5,9 +5,13 @@
 
 #include <chain.h>
 #include <chainparams.h>
+#include <coldreward/coldrewardtracker.h>
 #include <core_io.h>
 #include <httpserver.h>
 #include <index/txindex.h>
+#include <insight/addressindex.h>
+#include <insight/balanceindex.h>
+#include <insight/insight.h>
 #include <node/context.h>
 #include <primitives/block.h>
 #include <primitives/transaction.h>
@@ -16,6 +20,7 @@
 #include <rpc/server.h>
 #include <streams.h>
 #include <sync.h>
+#include <txdb.h>
 #include <txmempool.h>
 #include <util/check.h>
 #include <util/ref.h>
@@ -30,6 +35,10 @@
 extern bool fParticlMode;
 
 static const size_t MAX_GETUTXOS_OUTPOINTS = 15; //allow a max of 15 outpoints to be queried at once
+static const int32_t MAX_REST_ANON_OUTPUTS = 100000;
+static const size_t MAX_REST_KEY_IMAGES = 10000;
+static const int32_t MAX_REST_BLOCK_BALANCES = 10000;
+static const size_t MAX_REST_ADDRESSES = 100;
 
 enum class RetFormat {
     UNDEF,
@@ -668,6 +677,348 @@ static bool rest_blockhash_by_height(const util::Ref& context, HTTPRequest* req,
     }
 }
 
+/** Reply with packed data as .bin or .hex */
+static bool WritePackedReply(HTTPRequest* req, RetFormat rf, const CDataStream& ss)
+{
+    if (rf == RetFormat::BINARY) {
+        req->WriteHeader("Content-Type", "application/octet-stream");
+        req->WriteReply(HTTP_OK, ss.str());
+    } else {
+        req->WriteHeader("Content-Type", "text/plain");
+        req->WriteReply(HTTP_OK, HexStr(ss) + "\n");
+    }
+    return true;
+}
+
+static bool WriteJSONReply(HTTPRequest* req, const UniValue& result)
+{
+    req->WriteHeader("Content-Type", "application/json");
+    req->WriteReply(HTTP_OK, result.write() + "\n");
+    return true;
+}
+
+/** Split param into at least min_parts '/' separated parts */
+static bool SplitURIParts(const std::string& param, size_t min_parts, std::vector<std::string>& parts)
+{
+    boost::split(parts, param, boost::is_any_of("/"));
+    return parts.size() >= min_parts && !parts.back().empty();
+}
+
+// Packed outputs as in the anonoutputs RPC, preceded by start (int64 LE) and count (uint32 LE)
+static bool rest_anon_outputs(const util::Ref& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req)) return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RetFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+
+    std::vector<std::string> path;
+    int64_t start;
+    int32_t count;
+    if (!SplitURIParts(param, 2, path) || path.size() != 2) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Use /rest/anonoutputs/<start>/<count>.<ext>");
+    }
+    if (!ParseInt64(path[0], &start) || start < 1) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid start: " + SanitizeString(path[0]));
+    }
+    if (!ParseInt32(path[1], &count) || count < 1 || count > MAX_REST_ANON_OUTPUTS) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Count out of range [1, %d]: %s", MAX_REST_ANON_OUTPUTS, SanitizeString(path[1])));
+    }
+
+    int64_t last_index;
+    {
+        LOCK(cs_main);
+        last_index = ::ChainActive().Tip()->nAnonOutputs;
+    }
+    const int64_t available = std::max(int64_t{0}, std::min<int64_t>(count, last_index - start + 1));
+    std::vector<CAnonOutput> vao;
+    if (available > 0 && !pblocktree->ReadRCTOutputRange(start, available, vao)) {
+        return RESTERR(req, HTTP_INTERNAL_SERVER_ERROR, "ReadRCTOutputRange failed");
+    }
+
+    if (rf == RetFormat::JSON) {
+        UniValue result(UniValue::VOBJ);
+        result.pushKV("start", start);
+        result.pushKV("lastindex", last_index);
+        UniValue outputs(UniValue::VARR);
+        int64_t index = start;
+        for (const auto& ao : vao) {
+            UniValue obj(UniValue::VOBJ);
+            obj.pushKV("index", index++);
+            obj.pushKV("publickey", HexStr(Span<const unsigned char>(ao.pubkey.begin(), 33)));
+            obj.pushKV("commitment", HexStr(Span<const unsigned char>(ao.commitment.data, 33)));
+            obj.pushKV("txnhash", ao.outpoint.hash.ToString());
+            obj.pushKV("n", (int)ao.outpoint.n);
+            obj.pushKV("blockheight", ao.nBlockHeight);
+            obj.pushKV("compromised", ao.nCompromised != 0);
+            outputs.push_back(obj);
+        }
+        result.pushKV("outputs", outputs);
+        return WriteJSONReply(req, result);
+    }
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss.reserve(12 + vao.size() * PACKED_ANON_OUTPUT_SIZE);
+    ser_writedata64(ss, (uint64_t)start);
+    ser_writedata32(ss, (uint32_t)vao.size());
+    for (const auto& ao : vao) {
+        PackAnonOutput(ss, ao);
+    }
+    return WritePackedReply(req, rf, ss);
+}
+
+// Key images from the URI or, for .bin and .hex, as 33 byte records in the body.
+// Each result is spent (1), txid (32) and height (int32 LE), zero when unspent.
+static bool rest_key_images(const util::Ref& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req)) return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RetFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+
+    std::vector<CCmpPubKey> key_images;
+    std::vector<std::string> path;
+    if (param.size() > 1 && SplitURIParts(param.substr(1), 1, path)) {
+        for (const std::string& part : path) {
+            if (part.size() != 66 || !IsHex(part)) {
+                return RESTERR(req, HTTP_BAD_REQUEST, "Invalid key image: " + SanitizeString(part));
+            }
+            std::vector<uint8_t> v = ParseHex(part);
+            key_images.emplace_back(v.begin(), v.end());
+        }
+    }
+    std::string body = req->ReadBody();
+    if (!body.empty()) {
+        if (rf == RetFormat::JSON || !key_images.empty()) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Key images can be posted to .bin or .hex only, and not with key images in the URI");
+        }
+        if (rf == RetFormat::HEX) {
+            std::vector<uint8_t> v = ParseHex(body);
+            body.assign(v.begin(), v.end());
+        }
+        if (body.size() % 33 != 0) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Parse error");
+        }
+        for (size_t i = 0; i < body.size(); i += 33) {
+            key_images.emplace_back((const uint8_t*)body.data() + i, (const uint8_t*)body.data() + i + 33);
+        }
+    }
+    if (key_images.empty()) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Error: empty request");
+    }
+    if (key_images.size() > MAX_REST_KEY_IMAGES) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Error: max key images exceeded (max: %d, tried: %d)", MAX_REST_KEY_IMAGES, key_images.size()));
+    }
+
+    std::vector<CAnonKeyImageInfo> ki_datas;
+    std::vector<bool> ki_spent;
+    pblocktree->ReadRCTKeyImages(key_images, ki_datas, ki_spent);
+
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    UniValue results(UniValue::VARR);
+    for (size_t k = 0; k < key_images.size(); ++k) {
+        const CCmpPubKey& ki = key_images[k];
+        const CAnonKeyImageInfo& ki_data = ki_datas[k];
+        const bool spent = ki_spent[k];
+        if (rf == RetFormat::JSON) {
+            UniValue obj(UniValue::VOBJ);
+            obj.pushKV("keyimage", HexStr(Span<const unsigned char>(ki.begin(), 33)));
+            obj.pushKV("spent", spent);
+            if (spent) {
+                obj.pushKV("txid", ki_data.txid.ToString());
+                if (ki_data.height > 0) {
+                    obj.pushKV("height", ki_data.height);
+                }
+            }
+            results.push_back(obj);
+            continue;
+        }
+        ser_writedata8(ss, spent ? 1 : 0);
+        ss << (spent ? ki_data.txid : uint256());
+        ser_writedata32(ss, spent ? (uint32_t)ki_data.height : 0);
+    }
+    if (rf == RetFormat::JSON) {
+        return WriteJSONReply(req, results);
+    }
+    return WritePackedReply(req, rf, ss);
+}
+
+// Balances of count blocks from height start, each height (int32 LE), blockhash (32) and
+// the plain, blind and anon balances (int64 LE satoshis)
+static bool rest_block_balances(const util::Ref& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req)) return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RetFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    if (!fBalancesIndex) {
+        return RESTERR(req, HTTP_NOT_FOUND, "Balances index is not enabled");
+    }
+
+    std::vector<std::string> path;
+    int32_t start, count;
+    if (!SplitURIParts(param, 2, path) || path.size() != 2) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Use /rest/blockbalances/<start>/<count>.<ext>");
+    }
+    if (!ParseInt32(path[0], &start) || start < 0) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid height: " + SanitizeString(path[0]));
+    }
+    if (!ParseInt32(path[1], &count) || count < 1 || count > MAX_REST_BLOCK_BALANCES) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Count out of range [1, %d]: %s", MAX_REST_BLOCK_BALANCES, SanitizeString(path[1])));
+    }
+
+    std::vector<uint256> hashes;
+    {
+        LOCK(cs_main);
+        for (int height = start; height - start < count && height <= ::ChainActive().Height(); ++height) {
+            hashes.push_back(::ChainActive()[height]->GetBlockHash());
+        }
+    }
+
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss.reserve(hashes.size() * (4 + 32 + 3 * 8));
+    UniValue results(UniValue::VARR);
+    int height = start;
+    for (const uint256& hash : hashes) {
+        BlockBalances balances;
+        if (!GetBlockBalances(hash, balances)) {
+            return RESTERR(req, HTTP_NOT_FOUND, "Balances not found for block " + hash.ToString());
+        }
+        if (rf == RetFormat::JSON) {
+            UniValue obj(UniValue::VOBJ);
+            obj.pushKV("height", height);
+            obj.pushKV("blockhash", hash.GetHex());
+            obj.pushKV("plain", balances.plain());
+            obj.pushKV("blind", balances.blind());
+            obj.pushKV("anon", balances.anon());
+            results.push_back(obj);
+        } else {
+            ser_writedata32(ss, (uint32_t)height);
+            ss << hash;
+            ser_writedata64(ss, (uint64_t)balances.plain());
+            ser_writedata64(ss, (uint64_t)balances.blind());
+            ser_writedata64(ss, (uint64_t)balances.anon());
+        }
+        height++;
+    }
+    if (rf == RetFormat::JSON) {
+        return WriteJSONReply(req, results);
+    }
+    return WritePackedReply(req, rf, ss);
+}
+
+// Address index deltas of the addresses between heights start and end, 0 and 0 for all.
+// Each delta is the position of its address in the request (uint32 LE), height (int32 LE),
+// blockindex (uint32 LE), txid (32), index (uint32 LE) and satoshis (int64 LE)
+static bool rest_address_deltas(const util::Ref& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req)) return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RetFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    if (!fAddressIndex) {
+        return RESTERR(req, HTTP_NOT_FOUND, "Address index is not enabled");
+    }
+
+    std::vector<std::string> path;
+    int32_t start, end;
+    if (!SplitURIParts(param, 3, path)) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Use /rest/addressdeltas/<start>/<end>/<address>[/<address>...].<ext>");
+    }
+    if (!ParseInt32(path[0], &start) || !ParseInt32(path[1], &end) || start < 0 || end < start || (start == 0) != (end == 0)) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid height range");
+    }
+    if (path.size() - 2 > MAX_REST_ADDRESSES) {
+        return RESTERR(req, HTTP_BAD_REQUEST, strprintf("Error: max addresses exceeded (max: %d, tried: %d)", MAX_REST_ADDRESSES, path.size() - 2));
+    }
+
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    UniValue results(UniValue::VARR);
+    for (size_t i = 2; i < path.size(); ++i) {
+        uint256 hash_bytes;
+        int type;
+        if (!getIndexKey(path[i], hash_bytes, type)) {
+            return RESTERR(req, HTTP_BAD_REQUEST, "Invalid address: " + SanitizeString(path[i]));
+        }
+        std::vector<std::pair<CAddressIndexKey, CAmount>> address_index;
+        if (!GetAddressIndex(hash_bytes, type, address_index, start, end)) {
+            return RESTERR(req, HTTP_NOT_FOUND, "No information available for address " + SanitizeString(path[i]));
+        }
+        for (const auto& delta : address_index) {
+            if (rf == RetFormat::JSON) {
+                UniValue obj(UniValue::VOBJ);
+                obj.pushKV("satoshis", delta.second);
+                obj.pushKV("txid", delta.first.txhash.GetHex());
+                obj.pushKV("index", (int)delta.first.index);
+                obj.pushKV("blockindex", (int)delta.first.txindex);
+                obj.pushKV("height", delta.first.blockHeight);
+                obj.pushKV("address", path[i]);
+                results.push_back(obj);
+                continue;
+            }
+            ser_writedata32(ss, (uint32_t)(i - 2));
+            ser_writedata32(ss, (uint32_t)delta.first.blockHeight);
+            ser_writedata32(ss, delta.first.txindex);
+            ss << delta.first.txhash;
+            ser_writedata32(ss, (uint32_t)delta.first.index);
+            ser_writedata64(ss, (uint64_t)delta.second);
+        }
+    }
+    if (rf == RetFormat::JSON) {
+        return WriteJSONReply(req, results);
+    }
+    return WritePackedReply(req, rf, ss);
+}
+
+// Cold reward eligible addresses at height, each the address (compact size prefixed),
+// multiplier (uint32 LE) and balance (int64 LE satoshis)
+static bool rest_cold_reward_eligible(const util::Ref& context, HTTPRequest* req, const std::string& strURIPart)
+{
+    if (!CheckWarmup(req)) return false;
+    std::string param;
+    const RetFormat rf = ParseDataFormat(param, strURIPart);
+    if (rf == RetFormat::UNDEF) {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: " + AvailableDataFormatsString() + ")");
+    }
+    int32_t height;
+    if (!ParseInt32(param, &height) || height < 0) {
+        return RESTERR(req, HTTP_BAD_REQUEST, "Invalid height: " + SanitizeString(param));
+    }
+
+    // The snapshot is shared until the next block, it's read without cs_main
+    std::shared_ptr<const std::vector<ColdRewardTracker::EligibleBalance>> snapshot;
+    {
+        LOCK(cs_main);
+        snapshot = initColdReward().getEligibleSnapshot(height);
+    }
+
+    if (rf == RetFormat::JSON) {
+        UniValue results(UniValue::VARR);
+        for (const auto& eligible : *snapshot) {
+            UniValue obj(UniValue::VOBJ);
+            obj.pushKV("address", std::string(eligible.address.begin(), eligible.address.end()));
+            obj.pushKV("multiplier", (int)eligible.multiplier);
+            obj.pushKV("balance", eligible.balance);
+            results.push_back(obj);
+        }
+        return WriteJSONReply(req, results);
+    }
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    for (const auto& eligible : *snapshot) {
+        ss << eligible.address;
+        ser_writedata32(ss, eligible.multiplier);
+        ser_writedata64(ss, (uint64_t)eligible.balance);
+    }
+    return WritePackedReply(req, rf, ss);
+}
+
 static const struct {
     const char* prefix;
     bool (*handler)(const util::Ref& context, HTTPRequest* req, const std::string& strReq);
@@ -681,6 +1032,11 @@ static const struct {
       {"/rest/headers/", rest_headers},
       {"/rest/getutxos", rest_getutxos},
       {"/rest/blockhashbyheight/", rest_blockhash_by_height},
+      {"/rest/anonoutputs/", rest_anon_outputs},
+      {"/rest/keyimages", rest_key_images},
+      {"/rest/blockbalances/", rest_block_balances},
+      {"/rest/addressdeltas/", rest_address_deltas},
+      {"/rest/coldrewardeligible/", rest_cold_reward_eligible},
 };
 
 void StartREST(const util::Ref& context)
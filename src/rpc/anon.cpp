@@ -5,8 +5,10 @@
 #include <rpc/server.h>
 #include <rpc/util.h>
 
+#include <rpc/blockchain.h>
 #include <validation.h>
 #include <txdb.h>
+#include <txmempool.h>
 #include <anon.h>
 
 
@@ -15,25 +17,74 @@ static bool IsDigits(const std::string &str)
     return str.length() && std::all_of(str.begin(), str.end(), ::isdigit);
 };
 
+//! Max number of outputs or key images looked up per anonoutput or checkkeyimage call
+static const size_t MAX_ANON_LOOKUPS_PER_CALL = 100000;
+
+static UniValue AnonOutputToJSON(int64_t nIndex, const CAnonOutput &ao)
+{
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("index", (int)nIndex);
+    result.pushKV("publickey", HexStr(Span<const unsigned char>(ao.pubkey.begin(), 33)));
+    result.pushKV("txnhash", ao.outpoint.hash.ToString());
+    result.pushKV("n", (int)ao.outpoint.n);
+    result.pushKV("blockheight", ao.nBlockHeight);
+    return result;
+}
+
+/** Parse an output given by index or publickey hex, returns an error message on failure */
+static std::string ParseAnonOutputRef(const std::string &sIn, int64_t &nIndex, CCmpPubKey &pk, bool &fByKey)
+{
+    fByKey = false;
+    if (IsDigits(sIn)) {
+        if (!ParseInt64(sIn, &nIndex)) {
+            return "Invalid index";
+        }
+        return "";
+    }
+    if (!IsHex(sIn)) {
+        return sIn + " is not a hexadecimal or decimal string.";
+    }
+    std::vector<uint8_t> vIn = ParseHex(sIn);
+    pk = CCmpPubKey(vIn.begin(), vIn.end());
+    if (!pk.IsValid()) {
+        return sIn + " is not a valid compressed public key.";
+    }
+    fByKey = true;
+    return "";
+}
+
 UniValue anonoutput(const JSONRPCRequest &request)
 {
             RPCHelpMan{"anonoutput",
                 "\nReturns an anon output at index or by publickey hex.\n"
-                "If no output is provided returns the last index.\n",
+                "If no output is provided returns the last index.\n"
+                "An array of outputs returns an array of results, publickeys are resolved from one index pass\n"
+                "and an output that can't be found has an error field instead of failing the call.\n",
                 {
-                    {"output", RPCArg::Type::STR, /* default */ "", "Output to view, specified by index or hex of publickey."},
+                    {"output", RPCArg::Type::STR, /* default */ "", "Output to view, specified by index or hex of publickey, or an array of them."},
+                },
+                {
+                    RPCResult{"for a single output",
+                        RPCResult::Type::OBJ, "", "", {
+                            {RPCResult::Type::NUM, "index", "Position in chain of anon output"},
+                            {RPCResult::Type::STR_HEX, "publickey", "Public key of anon out"},
+                            {RPCResult::Type::STR_HEX, "txnhash", "Hash of transaction found in"},
+                            {RPCResult::Type::NUM, "n", "Offset in transaction found in"},
+                            {RPCResult::Type::NUM, "blockheight", "Height of block found in"},
+                    }},
+                    RPCResult{"for an array of outputs",
+                        RPCResult::Type::ARR, "", "", {
+                            {RPCResult::Type::OBJ, "", "", {
+                                {RPCResult::Type::ELISION, "", "The fields of a single output"},
+                                {RPCResult::Type::STR, "output", /* optional */ true, "The output requested, when not found"},
+                                {RPCResult::Type::STR, "error", /* optional */ true, "Why the output was not found"},
+                            }},
+                    }},
                 },
-                RPCResult{
-                    RPCResult::Type::OBJ, "", "", {
-                        {RPCResult::Type::NUM, "index", "Position in chain of anon output"},
-                        {RPCResult::Type::STR_HEX, "publickey", "Public key of anon out"},
-                        {RPCResult::Type::STR_HEX, "txnhash", "Hash of transaction found in"},
-                        {RPCResult::Type::NUM, "n", "Offset in transaction found in"},
-                        {RPCResult::Type::NUM, "blockheight", "Height of block found in"},
-                }},
                 RPCExamples{
             HelpExampleCli("anonoutput", "\"1\"")
             + HelpExampleRpc("anonoutput", "\"2\"")
+            + HelpExampleRpc("anonoutput", "[\"1\", \"2\"]")
             },
         }.Check(request);
 
@@ -45,28 +96,65 @@ UniValue anonoutput(const JSONRPCRequest &request)
         return result;
     }
 
-    std::string sIn = request.params[0].get_str();
-
-    int64_t nIndex;
-    if (IsDigits(sIn)) {
-        if (!ParseInt64(sIn, &nIndex)) {
-            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid index");
+    if (request.params[0].isArray()) {
+        const UniValue &outputs = request.params[0].get_array();
+        if (outputs.size() > MAX_ANON_LOOKUPS_PER_CALL) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("At most %d outputs per call", MAX_ANON_LOOKUPS_PER_CALL));
         }
-    } else {
-        if (!IsHex(sIn)) {
-            throw JSONRPCError(RPC_INVALID_PARAMETER, sIn + " is not a hexadecimal or decimal string.");
+        std::vector<std::string> errors(outputs.size());
+        std::vector<int64_t> indices(outputs.size(), 0);
+        std::vector<CCmpPubKey> keys;
+        std::vector<size_t> key_positions;
+        for (size_t k = 0; k < outputs.size(); ++k) {
+            const std::string sIn = outputs[k].isNum() ? outputs[k].getValStr() : outputs[k].get_str();
+            CCmpPubKey pk;
+            bool fByKey;
+            errors[k] = ParseAnonOutputRef(sIn, indices[k], pk, fByKey);
+            if (fByKey) {
+                keys.push_back(pk);
+                key_positions.push_back(k);
+            }
         }
-        std::vector<uint8_t> vIn = ParseHex(sIn);
-
-        CCmpPubKey pk(vIn.begin(), vIn.end());
-
-        if (!pk.IsValid()) {
-            throw JSONRPCError(RPC_INVALID_PARAMETER, sIn + " is not a valid compressed public key.");
+        std::vector<int64_t> key_indices;
+        std::vector<bool> found;
+        pblocktree->ReadRCTOutputLinks(keys, key_indices, found);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            if (found[i]) {
+                indices[key_positions[i]] = key_indices[i];
+            } else {
+                errors[key_positions[i]] = "Output not indexed.";
+            }
         }
 
-        if (!pblocktree->ReadRCTOutputLink(pk, nIndex)) {
-            throw JSONRPCError(RPC_MISC_ERROR, "Output not indexed.");
+        UniValue results(UniValue::VARR);
+        for (size_t k = 0; k < outputs.size(); ++k) {
+            CAnonOutput ao;
+            if (errors[k].empty() && !pblocktree->ReadRCTOutput(indices[k], ao)) {
+                errors[k] = "Unknown index.";
+            }
+            if (!errors[k].empty()) {
+                UniValue entry(UniValue::VOBJ);
+                entry.pushKV("output", outputs[k].getValStr());
+                entry.pushKV("error", errors[k]);
+                results.push_back(entry);
+                continue;
+            }
+            results.push_back(AnonOutputToJSON(indices[k], ao));
         }
+        return results;
+    }
+
+    std::string sIn = request.params[0].get_str();
+
+    int64_t nIndex;
+    CCmpPubKey pk;
+    bool fByKey;
+    std::string sError = ParseAnonOutputRef(sIn, nIndex, pk, fByKey);
+    if (!sError.empty()) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, sError);
+    }
+    if (fByKey && !pblocktree->ReadRCTOutputLink(pk, nIndex)) {
+        throw JSONRPCError(RPC_MISC_ERROR, "Output not indexed.");
     }
 
     CAnonOutput ao;
@@ -74,11 +162,112 @@ UniValue anonoutput(const JSONRPCRequest &request)
         throw JSONRPCError(RPC_MISC_ERROR, "Unknown index.");
     }
 
-    result.pushKV("index", (int)nIndex);
-    result.pushKV("publickey", HexStr(Span<const unsigned char>(ao.pubkey.begin(), 33)));
-    result.pushKV("txnhash", ao.outpoint.hash.ToString());
-    result.pushKV("n", (int)ao.outpoint.n);
-    result.pushKV("blockheight", ao.nBlockHeight);
+    return AnonOutputToJSON(nIndex, ao);
+};
+
+//! Default and max number of outputs returned per anonoutputs call
+static const int64_t DEFAULT_ANON_OUTPUTS_PER_CALL = 1000;
+static const int64_t MAX_ANON_OUTPUTS_PER_CALL = 100000;
+
+UniValue anonoutputs(const JSONRPCRequest &request)
+{
+            RPCHelpMan{"anonoutputs",
+                "\nReturns a contiguous range of anon outputs starting at index.\n"
+                "The range ends early at the chain tip, pass \"next\" as start to continue.\n"
+                "In packed form each output is " + ToString(PACKED_ANON_OUTPUT_SIZE) + " bytes: publickey (33), commitment (33),\n"
+                "txnhash (32, internal byte order), n (uint32 LE), blockheight (int32 LE), compromised (1).\n",
+                {
+                    {"start", RPCArg::Type::NUM, RPCArg::Optional::NO, "Index of the first output."},
+                    {"count", RPCArg::Type::NUM, /* default */ ToString(DEFAULT_ANON_OUTPUTS_PER_CALL), "Max number of outputs to return, at most " + ToString(MAX_ANON_OUTPUTS_PER_CALL) + "."},
+                    {"verbose", RPCArg::Type::BOOL, /* default */ "false", "Return an array of objects instead of packed hex."},
+                },
+                {
+                    RPCResult{"for verbose = false",
+                        RPCResult::Type::OBJ, "", "", {
+                            {RPCResult::Type::NUM, "start", "Index of the first output returned"},
+                            {RPCResult::Type::NUM, "count", "Number of outputs returned"},
+                            {RPCResult::Type::NUM, "next", "Index to continue from"},
+                            {RPCResult::Type::NUM, "lastindex", "Last anon output index in the chain"},
+                            {RPCResult::Type::STR_HEX, "data", "Packed outputs"},
+                    }},
+                    RPCResult{"for verbose = true",
+                        RPCResult::Type::OBJ, "", "", {
+                            {RPCResult::Type::NUM, "start", "Index of the first output returned"},
+                            {RPCResult::Type::NUM, "count", "Number of outputs returned"},
+                            {RPCResult::Type::NUM, "next", "Index to continue from"},
+                            {RPCResult::Type::NUM, "lastindex", "Last anon output index in the chain"},
+                            {RPCResult::Type::ARR, "outputs", "", {
+                                {RPCResult::Type::OBJ, "", "", {
+                                    {RPCResult::Type::NUM, "index", "Position in chain of anon output"},
+                                    {RPCResult::Type::STR_HEX, "publickey", "Public key of anon out"},
+                                    {RPCResult::Type::STR_HEX, "commitment", "Pedersen commitment of anon out"},
+                                    {RPCResult::Type::STR_HEX, "txnhash", "Hash of transaction found in"},
+                                    {RPCResult::Type::NUM, "n", "Offset in transaction found in"},
+                                    {RPCResult::Type::NUM, "blockheight", "Height of block found in"},
+                                    {RPCResult::Type::BOOL, "compromised", "Output is marked as compromised"},
+                                }},
+                            }},
+                    }},
+                },
+                RPCExamples{
+            HelpExampleCli("anonoutputs", "1 1000")
+            + HelpExampleRpc("anonoutputs", "1, 1000")
+            },
+        }.Check(request);
+
+    RPCTypeCheck(request.params, {UniValue::VNUM, UniValue::VNUM, UniValue::VBOOL}, true);
+
+    int64_t start = request.params[0].get_int64();
+    if (start < 1) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "start must be at least 1");
+    }
+    int64_t count = request.params[1].isNull() ? DEFAULT_ANON_OUTPUTS_PER_CALL : request.params[1].get_int64();
+    if (count < 1 || count > MAX_ANON_OUTPUTS_PER_CALL) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("count must be in range [1, %d]", MAX_ANON_OUTPUTS_PER_CALL));
+    }
+    bool verbose = request.params[2].isNull() ? false : request.params[2].get_bool();
+
+    int64_t last_index;
+    {
+        LOCK(cs_main);
+        last_index = ::ChainActive().Tip()->nAnonOutputs;
+    }
+    count = std::max(int64_t{0}, std::min(count, last_index - start + 1));
+
+    std::vector<CAnonOutput> vao;
+    if (count > 0 && !pblocktree->ReadRCTOutputRange(start, count, vao)) {
+        throw JSONRPCError(RPC_DATABASE_ERROR, "ReadRCTOutputRange failed.");
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("start", start);
+    result.pushKV("count", (uint64_t)vao.size());
+    result.pushKV("next", start + (int64_t)vao.size());
+    result.pushKV("lastindex", last_index);
+
+    if (verbose) {
+        UniValue outputs(UniValue::VARR);
+        int64_t index = start;
+        for (const auto &ao : vao) {
+            UniValue obj(UniValue::VOBJ);
+            obj.pushKV("index", index++);
+            obj.pushKV("publickey", HexStr(Span<const unsigned char>(ao.pubkey.begin(), 33)));
+            obj.pushKV("commitment", HexStr(Span<const unsigned char>(ao.commitment.data, 33)));
+            obj.pushKV("txnhash", ao.outpoint.hash.ToString());
+            obj.pushKV("n", (int)ao.outpoint.n);
+            obj.pushKV("blockheight", ao.nBlockHeight);
+            obj.pushKV("compromised", ao.nCompromised != 0);
+            outputs.push_back(obj);
+        }
+        result.pushKV("outputs", outputs);
+    } else {
+        CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+        ss.reserve(vao.size() * PACKED_ANON_OUTPUT_SIZE);
+        for (const auto &ao : vao) {
+            PackAnonOutput(ss, ao);
+        }
+        result.pushKV("data", HexStr(ss));
+    }
 
     return result;
 };
@@ -86,45 +275,91 @@ UniValue anonoutput(const JSONRPCRequest &request)
 UniValue checkkeyimage(const JSONRPCRequest &request)
 {
         RPCHelpMan{"checkkeyimage",
-            "\nCheck if keyimage is spent in the chain.\n",
+            "\nCheck if keyimage is spent in the chain or by a transaction in the mempool.\n"
+            "An array of keyimages returns an array of results, looked up in one pass over the index.\n",
             {
-                {"keyimage", RPCArg::Type::STR, RPCArg::Optional::NO, "Hex encoded keyimage."},
+                {"keyimage", RPCArg::Type::STR, RPCArg::Optional::NO, "Hex encoded keyimage, or an array of them."},
+            },
+            {
+                RPCResult{"for a single keyimage",
+                    RPCResult::Type::OBJ, "", "", {
+                        {RPCResult::Type::BOOL, "spent", "Keyimage found in chain or not"},
+                        {RPCResult::Type::STR_HEX, "txid", /* optional */ true, "ID of spending transaction"},
+                        {RPCResult::Type::NUM, "height", /* optional */ true, "Chain height of containing block"},
+                        {RPCResult::Type::BOOL, "mempool", "Keyimage spent by a transaction in the mempool"},
+                        {RPCResult::Type::STR_HEX, "mempool_txid", /* optional */ true, "ID of the spending transaction in the mempool"},
+                }},
+                RPCResult{"for an array of keyimages",
+                    RPCResult::Type::ARR, "", "", {
+                        {RPCResult::Type::OBJ, "", "", {
+                            {RPCResult::Type::STR_HEX, "keyimage", "The keyimage"},
+                            {RPCResult::Type::ELISION, "", "The fields of a single keyimage"},
+                        }},
+                }},
             },
-            RPCResult{
-                RPCResult::Type::OBJ, "", "", {
-                    {RPCResult::Type::BOOL, "spent", "Keyimage found in chain or not"},
-                    {RPCResult::Type::STR_HEX, "txid", "ID of spending transaction"},
-                    {RPCResult::Type::NUM, "height", "Chain height of containing block"},
-            }},
             RPCExamples{
         HelpExampleCli("checkkeyimage", "\"keyimage\"")
         + HelpExampleRpc("checkkeyimage", "\"keyimage\"")
+        + HelpExampleRpc("checkkeyimage", "[\"keyimage\", \"keyimage\"]")
         },
     }.Check(request);
 
-    RPCTypeCheck(request.params, {UniValue::VSTR}, true);
-    UniValue result(UniValue::VOBJ);
+    const bool fBatch = request.params[0].isArray();
+    std::vector<UniValue> values = fBatch ? request.params[0].get_array().getValues() : std::vector<UniValue>{request.params[0]};
+    if (values.size() > MAX_ANON_LOOKUPS_PER_CALL) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("At most %d keyimages per call", MAX_ANON_LOOKUPS_PER_CALL));
+    }
 
-    std::string s = request.params[0].get_str();
-    if (!IsHex(s) || !(s.size() == 66)) {
-        throw JSONRPCError(RPC_INVALID_PARAMETER, "Keyimage must be 33 bytes and hex encoded.");
+    std::vector<CCmpPubKey> key_images;
+    for (const UniValue &value : values) {
+        const std::string &s = value.get_str();
+        if (!IsHex(s) || !(s.size() == 66)) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Keyimage must be 33 bytes and hex encoded.");
+        }
+        std::vector<uint8_t> v = ParseHex(s);
+        key_images.emplace_back(v.begin(), v.end());
     }
 
-    std::vector<uint8_t> v = ParseHex(s);
-    CCmpPubKey ki(v.begin(), v.end());
+    std::vector<CAnonKeyImageInfo> ki_data;
+    std::vector<bool> spent_in_chain;
+    pblocktree->ReadRCTKeyImages(key_images, ki_data, spent_in_chain);
 
-    CAnonKeyImageInfo ki_data;
-    bool spent_in_chain = pblocktree->ReadRCTKeyImage(ki, ki_data);
+    std::vector<uint256> mempool_txids(key_images.size());
+    {
+        const CTxMemPool &mempool = EnsureMemPool(request.context);
+        LOCK(mempool.cs);
+        for (size_t k = 0; k < key_images.size(); ++k) {
+            const auto it = mempool.mapKeyImages.find(key_images[k]);
+            if (it != mempool.mapKeyImages.end()) {
+                mempool_txids[k] = it->second;
+            }
+        }
+    }
 
-    result.pushKV("spent", spent_in_chain);
-    if (spent_in_chain) {
-        result.pushKV("txid", ki_data.txid.ToString());
-        if (ki_data.height > 0) {
-            result.pushKV("height", ki_data.height);
+    UniValue results(UniValue::VARR);
+    for (size_t k = 0; k < key_images.size(); ++k) {
+        UniValue result(UniValue::VOBJ);
+        if (fBatch) {
+            result.pushKV("keyimage", values[k].get_str());
         }
+        result.pushKV("spent", (bool)spent_in_chain[k]);
+        if (spent_in_chain[k]) {
+            result.pushKV("txid", ki_data[k].txid.ToString());
+            if (ki_data[k].height > 0) {
+                result.pushKV("height", ki_data[k].height);
+            }
+        }
+        result.pushKV("mempool", !mempool_txids[k].IsNull());
+        if (!mempool_txids[k].IsNull()) {
+            result.pushKV("mempool_txid", mempool_txids[k].ToString());
+        }
+        if (!fBatch) {
+            return result;
+        }
+        results.push_back(result);
     }
 
-    return result;
+    return results;
 };
 
 UniValue rollbackrctindex(const JSONRPCRequest &request)
@@ -136,6 +371,8 @@ UniValue rollbackrctindex(const JSONRPCRequest &request)
             RPCResult{
                 RPCResult::Type::OBJ, "", "", {
                     {RPCResult::Type::NUM, "height", "Current chain height"},
+                    {RPCResult::Type::NUM, "outputs_erased", "Number of anon outputs removed from the index"},
+                    {RPCResult::Type::NUM, "keyimages_erased", "Number of key images removed from the index"},
             }},
             RPCExamples{
         HelpExampleCli("rollbackrctindex", "")
@@ -148,10 +385,15 @@ UniValue rollbackrctindex(const JSONRPCRequest &request)
 
     std::set<CCmpPubKey> setKi; // unused
     int64_t nTestExists = 0;
-    RollBackRCTIndex(pindex->nAnonOutputs, nTestExists, pindex->nHeight, setKi);
+    RCTIndexRollbackStats stats;
+    if (!RollBackRCTIndex(pindex->nAnonOutputs, nTestExists, pindex->nHeight, setKi, &stats)) {
+        throw JSONRPCError(RPC_DATABASE_ERROR, "RollBackRCTIndex failed.");
+    }
 
     UniValue result(UniValue::VOBJ);
     result.pushKV("height", pindex->nHeight);
+    result.pushKV("outputs_erased", (uint64_t)stats.outputs_erased);
+    result.pushKV("keyimages_erased", (uint64_t)stats.key_images_erased);
 
     return result;
 };
@@ -160,6 +402,7 @@ static const CRPCCommand commands[] =
 { //  category              name                      actor (function)         argNames
   //  --------------------- ------------------------  -----------------------  ----------
     { "anon",               "anonoutput",             &anonoutput,             {"output"} },
+    { "anon",               "anonoutputs",            &anonoutputs,            {"start","count","verbose"} },
     { "anon",               "checkkeyimage",          &checkkeyimage,          {"keyimage"} },
     { "anon",               "rollbackrctindex",       &rollbackrctindex,       {} },
 };
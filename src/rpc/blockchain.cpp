@@ -18,9 +18,11 @@
 #include <node/context.h>
 #include <node/utxo_snapshot.h>
 #include <policy/feerate.h>
+#include <policy/fees.h>
 #include <policy/policy.h>
 #include <policy/rbf.h>
 #include <primitives/transaction.h>
+#include <rpc/jsonstream.h>
 #include <rpc/server.h>
 #include <rpc/util.h>
 #include <script/descriptor.h>
@@ -35,6 +37,7 @@
 #include <util/translation.h>
 #include <validation.h>
 #include <validationinterface.h>
+#include <validationstats.h>
 #include <warnings.h>
 
 #include <stdint.h>
@@ -209,6 +212,30 @@ UniValue blockToJSON(const CBlock& block, const CBlockIndex* tip, const CBlockIn
     return result;
 }
 
+/** Write blockToJSON with txDetails to stream, the transactions are converted one at a time */
+static void BlockToJSONStream(JSONStreamWriter& stream, const CBlock& block, const CBlockIndex* tip, const CBlockIndex* blockindex, bool coinstakeDetails) LOCKS_EXCLUDED(cs_main)
+{
+    const UniValue result = blockToJSON(block, tip, blockindex, false, coinstakeDetails);
+    const std::vector<std::string>& keys = result.getKeys();
+    const std::vector<UniValue>& values = result.getValues();
+    stream.BeginObject();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        stream.Key(keys[i]);
+        if (keys[i] != "tx") {
+            stream.Value(values[i]);
+            continue;
+        }
+        stream.BeginArray();
+        for (const auto& tx : block.vtx) {
+            UniValue objTx(UniValue::VOBJ);
+            TxToUniv(*tx, uint256(), objTx, true, RPCSerializationFlags());
+            stream.Value(objTx);
+        }
+        stream.EndArray();
+    }
+    stream.EndObject();
+}
+
 static RPCHelpMan getblockcount()
 {
     return RPCHelpMan{"getblockcount",
@@ -1042,6 +1069,10 @@ static RPCHelpMan getblock()
         return strHex;
     }
 
+    if (verbosity >= 2 && request.stream) {
+        BlockToJSONStream(*request.stream, block, tip, pblockindex, with_coinstakeinfo);
+        return NullUniValue;
+    }
     return blockToJSON(block, tip, pblockindex, verbosity >= 2, with_coinstakeinfo);
 },
     };
@@ -1569,6 +1600,12 @@ UniValue MempoolInfoToJSON(const CTxMemPool& pool)
     ret.pushKV("size", (int64_t)pool.size());
     ret.pushKV("bytes", (int64_t)pool.GetTotalTxSize());
     ret.pushKV("usage", (int64_t)pool.DynamicMemoryUsage());
+    UniValue usage_by_type(UniValue::VOBJ);
+    for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+        const FeeEstimateTxType tx_type = (FeeEstimateTxType)i;
+        usage_by_type.pushKV(StringForFeeEstimateTxType(tx_type), (int64_t)pool.DynamicMemoryUsage(tx_type));
+    }
+    ret.pushKV("usage_by_type", usage_by_type);
     size_t maxmempool = gArgs.GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
     ret.pushKV("maxmempool", (int64_t) maxmempool);
     ret.pushKV("mempoolminfee", ValueFromAmount(std::max(pool.GetMinFee(maxmempool), ::minRelayTxFee).GetFeePerK()));
@@ -1577,6 +1614,47 @@ UniValue MempoolInfoToJSON(const CTxMemPool& pool)
     return ret;
 }
 
+static RPCHelpMan getvalidationqueueinfo()
+{
+    return RPCHelpMan{"getvalidationqueueinfo",
+                "\nReturns the notification queue of each validation interface subscriber.\n"
+                "Validation waits for the subscribers while the deepest queue holds more than 10 notifications.\n",
+                {},
+                RPCResult{
+                    RPCResult::Type::ARR, "", "",
+                    {
+                        {RPCResult::Type::OBJ, "", "",
+                        {
+                            {RPCResult::Type::STR, "name", "The subscriber"},
+                            {RPCResult::Type::BOOL, "registered", "False for a queue left by an unregistered subscriber"},
+                            {RPCResult::Type::NUM, "depth", "Notifications queued or running"},
+                            {RPCResult::Type::NUM, "max_depth", "Deepest the queue has been"},
+                            {RPCResult::Type::NUM, "processed", "Notifications processed"},
+                            {RPCResult::Type::NUM, "busy_time", "Microseconds spent in the subscriber's callbacks"},
+                        }},
+                    }},
+                RPCExamples{
+                    HelpExampleCli("getvalidationqueueinfo", "")
+            + HelpExampleRpc("getvalidationqueueinfo", "")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    UniValue result(UniValue::VARR);
+    for (const ValidationQueueStats& stats : GetMainSignals().GetQueueStats()) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("name", stats.name);
+        entry.pushKV("registered", stats.registered);
+        entry.pushKV("depth", (uint64_t)stats.depth);
+        entry.pushKV("max_depth", (uint64_t)stats.max_depth);
+        entry.pushKV("processed", stats.processed);
+        entry.pushKV("busy_time", stats.busy_time);
+        result.push_back(entry);
+    }
+    return result;
+},
+    };
+}
+
 static RPCHelpMan getmempoolinfo()
 {
     return RPCHelpMan{"getmempoolinfo",
@@ -1589,6 +1667,12 @@ static RPCHelpMan getmempoolinfo()
                         {RPCResult::Type::NUM, "size", "Current tx count"},
                         {RPCResult::Type::NUM, "bytes", "Sum of all virtual transaction sizes as defined in BIP 141. Differs from actual serialized size because witness data is discounted"},
                         {RPCResult::Type::NUM, "usage", "Total memory usage for the mempool"},
+                        {RPCResult::Type::OBJ, "usage_by_type", "Memory used by the transactions of each type, not counting the indexes over them",
+                        {
+                            {RPCResult::Type::NUM, "plain", "Transactions with only plain inputs and outputs"},
+                            {RPCResult::Type::NUM, "blind", "Transactions with blinded outputs"},
+                            {RPCResult::Type::NUM, "anon", "Transactions spending anon outputs"},
+                        }},
                         {RPCResult::Type::NUM, "maxmempool", "Maximum memory usage for the mempool"},
                         {RPCResult::Type::STR_AMOUNT, "mempoolminfee", "Minimum fee rate in " + CURRENCY_UNIT + "/kB for tx to be accepted. Is the maximum of minrelaytxfee and minimum mempool fee"},
                         {RPCResult::Type::STR_AMOUNT, "minrelaytxfee", "Current minimum relay fee for transactions"},
@@ -2159,31 +2243,33 @@ static RPCHelpMan savemempool()
 }
 
 namespace {
-//! Search for a given set of pubkey scripts
-bool FindScriptPubKey(std::atomic<int>& scan_progress, const std::atomic<bool>& should_abort, int64_t& count, CCoinsViewCursor* cursor, const std::set<CScript>& needles, std::map<COutPoint, Coin>& out_results, std::function<void()>& interruption_point)
+//! Search for a given set of pubkey scripts, over ranges of the coins database on the -utxoscanthreads pool
+bool FindScriptPubKey(std::atomic<int>& scan_progress, const std::atomic<bool>& should_abort, int64_t& count, const CCoinsViewDB* coins_db, const std::set<CScript>& needles, std::map<COutPoint, Coin>& out_results, uint256& hash_block, std::function<void()>& interruption_point)
 {
     scan_progress = 0;
-    count = 0;
-    while (cursor->Valid()) {
-        COutPoint key;
-        Coin coin;
-        if (!cursor->GetKey(key) || !cursor->GetValue(coin)) return false;
-        if (++count % 8192 == 0) {
-            interruption_point();
-            if (should_abort) {
+    const int n_threads = GetUTXOScanThreads();
+    std::vector<std::map<COutPoint, Coin>> range_results(n_threads * 16);
+    std::atomic<int64_t> n_coins{0};
+    std::atomic<size_t> n_ranges_done{0};
+    bool res = coins_db->ForEachCoinParallel(range_results.size(), n_threads, [&](size_t range, const COutPoint& key, const Coin& coin) {
+            if (++n_coins % 8192 == 0 && should_abort) {
                 // allow to abort the scan via the abort reference
                 return false;
             }
-        }
-        if (count % 256 == 0) {
-            // update progress reference every 256 item
-            uint32_t high = 0x100 * *key.hash.begin() + *(key.hash.begin() + 1);
-            scan_progress = (int)(high * 100.0 / 65536.0 + 0.5);
-        }
-        if (needles.count(coin.out.scriptPubKey)) {
-            out_results.emplace(key, coin);
-        }
-        cursor->Next();
+            if (needles.count(coin.out.scriptPubKey)) {
+                range_results[range].emplace(key, coin);
+            }
+            return true;
+        }, [&](size_t range) {
+            scan_progress = (int)(++n_ranges_done * 100.0 / range_results.size() + 0.5);
+        }, hash_block);
+    count = n_coins;
+    interruption_point();
+    if (!res) {
+        return false;
+    }
+    for (auto& results : range_results) {
+        out_results.insert(results.begin(), results.end());
     }
     scan_progress = 100;
     return true;
@@ -2328,18 +2414,21 @@ static RPCHelpMan scantxoutset()
         std::map<COutPoint, Coin> coins;
         g_should_abort_scan = false;
         int64_t count = 0;
-        std::unique_ptr<CCoinsViewCursor> pcursor;
-        CBlockIndex* tip;
+        CCoinsViewDB* coins_db;
         {
             LOCK(cs_main);
             ::ChainstateActive().ForceFlushStateToDisk();
-            pcursor = std::unique_ptr<CCoinsViewCursor>(::ChainstateActive().CoinsDB().Cursor());
-            CHECK_NONFATAL(pcursor);
-            tip = ::ChainActive().Tip();
-            CHECK_NONFATAL(tip);
+            coins_db = &::ChainstateActive().CoinsDB();
         }
         NodeContext& node = EnsureNodeContext(request.context);
-        bool res = FindScriptPubKey(g_scan_progress, g_should_abort_scan, count, pcursor.get(), needles, coins, node.rpc_interruption_point);
+        uint256 hash_block;
+        bool res = FindScriptPubKey(g_scan_progress, g_should_abort_scan, count, coins_db, needles, coins, hash_block, node.rpc_interruption_point);
+        const CBlockIndex* tip;
+        {
+            LOCK(cs_main);
+            tip = LookupBlockIndex(hash_block);
+            CHECK_NONFATAL(tip);
+        }
         result.pushKV("success", res);
         result.pushKV("txouts", count);
         result.pushKV("height", tip->nHeight);
@@ -2497,6 +2586,278 @@ static RPCHelpMan getposdifficulty()
     };
 }
 
+static UniValue ValidationStageToJSON(const ValidationStats::StageStats& stats)
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("blocks", stats.blocks);
+    obj.pushKV("items", stats.items);
+    obj.pushKV("total_ms", stats.total_micros * 0.001);
+
+    std::vector<int64_t> window = stats.window;
+    std::sort(window.begin(), window.end());
+    int64_t sum = 0;
+    for (const int64_t micros : window) {
+        sum += micros;
+    }
+    const auto percentile = [&window](int p) {
+        return window[std::min(window.size() - 1, window.size() * p / 100)] * 0.001;
+    };
+    obj.pushKV("samples", (uint64_t)window.size());
+    if (!window.empty()) {
+        obj.pushKV("mean_ms", sum * 0.001 / window.size());
+        obj.pushKV("p50_ms", percentile(50));
+        obj.pushKV("p90_ms", percentile(90));
+        obj.pushKV("p99_ms", percentile(99));
+        obj.pushKV("max_ms", window.back() * 0.001);
+    }
+
+    // Power of two buckets from 1us, only the ones holding samples
+    UniValue histogram(UniValue::VARR);
+    int64_t bound = 1;
+    size_t i = 0;
+    while (i < window.size()) {
+        uint64_t count = 0;
+        for (; i < window.size() && window[i] <= bound; ++i) {
+            count++;
+        }
+        if (count) {
+            UniValue bucket(UniValue::VOBJ);
+            bucket.pushKV("le_ms", bound * 0.001);
+            bucket.pushKV("count", count);
+            histogram.push_back(bucket);
+        }
+        bound *= 2;
+    }
+    obj.pushKV("histogram", histogram);
+    return obj;
+}
+
+static RPCHelpMan getvalidationstats()
+{
+    return RPCHelpMan{"getvalidationstats",
+        "\nReturns the time spent in each stage of connecting blocks, for plain blocks and blocks with CT or RingCT transactions.\n"
+        "Rolling statistics cover the last " + ToString(VALIDATION_STATS_WINDOW) + " blocks a stage ran for.\n"
+        "Anon and rangeproof checks are summed across the script check threads.\n",
+        {
+            {"reset", RPCArg::Type::BOOL, /* default */ "false", "Clear the statistics after returning them."},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ_DYN, "", "",
+            {
+                {RPCResult::Type::OBJ_DYN, "kind", "the kind of block, plain or private",
+                {
+                    {RPCResult::Type::OBJ, "stage", "a stage of connecting a block",
+                    {
+                        {RPCResult::Type::NUM, "blocks", "blocks the stage ran for since startup"},
+                        {RPCResult::Type::NUM, "items", "transactions, checks or writes handled by the stage since startup"},
+                        {RPCResult::Type::NUM, "total_ms", "time spent by the stage since startup"},
+                        {RPCResult::Type::NUM, "samples", "number of blocks in the rolling window"},
+                        {RPCResult::Type::NUM, "mean_ms", /* optional */ true, "mean time per block in the window"},
+                        {RPCResult::Type::NUM, "p50_ms", /* optional */ true, "median time per block in the window"},
+                        {RPCResult::Type::NUM, "p90_ms", /* optional */ true, "90th percentile"},
+                        {RPCResult::Type::NUM, "p99_ms", /* optional */ true, "99th percentile"},
+                        {RPCResult::Type::NUM, "max_ms", /* optional */ true, "slowest block in the window"},
+                        {RPCResult::Type::ARR, "histogram", "blocks of the window by time",
+                        {
+                            {RPCResult::Type::OBJ, "", "",
+                            {
+                                {RPCResult::Type::NUM, "le_ms", "upper bound of the bucket"},
+                                {RPCResult::Type::NUM, "count", "blocks in the bucket"},
+                            }},
+                        }},
+                    }},
+                }},
+            }},
+        RPCExamples{
+            HelpExampleCli("getvalidationstats", "")
+    + HelpExampleRpc("getvalidationstats", "")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    UniValue result(UniValue::VOBJ);
+    for (int kind = 0; kind < (int)ValidationBlockKind::COUNT; ++kind) {
+        const auto stats = g_validation_stats.GetStats((ValidationBlockKind)kind);
+        UniValue stages(UniValue::VOBJ);
+        for (int stage = 0; stage < (int)ValidationStage::COUNT; ++stage) {
+            if (stats[stage].blocks == 0) {
+                continue;
+            }
+            stages.pushKV(ValidationStageName((ValidationStage)stage), ValidationStageToJSON(stats[stage]));
+        }
+        result.pushKV(ValidationBlockKindName((ValidationBlockKind)kind), stages);
+    }
+    if (!request.params[0].isNull() && request.params[0].get_bool()) {
+        g_validation_stats.Reset();
+    }
+    return result;
+},
+    };
+}
+
+static UniValue DBPrefixToJSON(uint8_t prefix)
+{
+    UniValue entry(UniValue::VOBJ);
+    entry.pushKV("prefix", strprintf("%02x", prefix));
+    if (prefix >= 0x20 && prefix < 0x7f) {
+        entry.pushKV("char", std::string(1, (char)prefix));
+    }
+    entry.pushKV("name", CBlockTreeDB::GetPrefixName(prefix));
+    return entry;
+}
+
+//! A key prefix as a single character, a hex byte or the name of the data stored under it
+static uint8_t ParseDBPrefix(const std::string &str)
+{
+    if (str.size() == 1) {
+        return str[0];
+    }
+    if (str.size() == 2 && IsHex(str)) {
+        return ParseHex(str)[0];
+    }
+    for (int prefix = 0; prefix < 256; ++prefix) {
+        if (!str.empty() && CBlockTreeDB::GetPrefixName(prefix) == str) {
+            return prefix;
+        }
+    }
+    throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Unknown prefix %s", str));
+}
+
+static RPCHelpMan getdbstats()
+{
+    return RPCHelpMan{"getdbstats",
+        "\nReturns statistics of the block tree database (blocks/index) by key prefix, including the insight index database if -insightdb is set.\n"
+        "Sizes are leveldb's estimate of the data on disk, recent writes still in memory are not included.\n"
+        "Reads count point lookups and writes count the puts and erasures written since startup.\n",
+        {
+            {"verbose", RPCArg::Type::BOOL, /* default */ "false", "Include leveldb's own compaction statistics."},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "approximate_size", "estimated bytes on disk of all prefixes"},
+                {RPCResult::Type::NUM, "memory_usage", "bytes used by leveldb's memtables and block cache"},
+                {RPCResult::Type::ARR, "prefixes", "",
+                {
+                    {RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::STR_HEX, "prefix", "first byte of the keys"},
+                        {RPCResult::Type::STR, "char", /* optional */ true, "the prefix as a character, if printable"},
+                        {RPCResult::Type::STR, "name", "data stored under the prefix, empty if unknown"},
+                        {RPCResult::Type::STR, "database", "\"index\" or \"insight\""},
+                        {RPCResult::Type::NUM, "approximate_size", "estimated bytes on disk"},
+                        {RPCResult::Type::NUM, "reads", "point reads since startup"},
+                        {RPCResult::Type::NUM, "writes", "puts and erasures written since startup"},
+                    }},
+                }},
+                {RPCResult::Type::OBJ, "rct_output_cache", "",
+                {
+                    {RPCResult::Type::NUM, "entries", "anon outputs in the cache"},
+                    {RPCResult::Type::NUM, "usage", "bytes used by the cache"},
+                    {RPCResult::Type::NUM, "hits", "lookups served from the cache since startup"},
+                    {RPCResult::Type::NUM, "misses", "lookups read from the db since startup"},
+                    {RPCResult::Type::NUM, "hit_rate", "hits / (hits + misses)"},
+                }},
+                {RPCResult::Type::STR, "leveldb_stats", /* optional */ true, "leveldb's compaction statistics, if verbose"},
+            }},
+        RPCExamples{
+            HelpExampleCli("getdbstats", "")
+    + HelpExampleRpc("getdbstats", "")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    if (!pblocktree) {
+        throw JSONRPCError(RPC_DATABASE_ERROR, "Block tree database is not open");
+    }
+
+    UniValue result(UniValue::VOBJ);
+    UniValue prefixes(UniValue::VARR);
+    uint64_t total_size = 0, memory_usage = 0;
+    for (const auto &db : {std::make_pair((CDBWrapper*)pblocktree.get(), "index"), std::make_pair(pblocktree->GetInsightDB(), "insight")}) {
+        if (!db.first) {
+            continue;
+        }
+        for (const auto &it : db.first->GetPrefixStats()) {
+            UniValue entry = DBPrefixToJSON(it.first);
+            entry.pushKV("database", db.second);
+            entry.pushKV("approximate_size", it.second.approximate_size);
+            entry.pushKV("reads", it.second.reads);
+            entry.pushKV("writes", it.second.writes);
+            prefixes.push_back(entry);
+            total_size += it.second.approximate_size;
+        }
+        memory_usage += db.first->DynamicMemoryUsage();
+    }
+    result.pushKV("approximate_size", total_size);
+    result.pushKV("memory_usage", memory_usage);
+    result.pushKV("prefixes", prefixes);
+
+    uint64_t hits, misses;
+    pblocktree->RCTOutputCacheHits(hits, misses);
+    UniValue rct_cache(UniValue::VOBJ);
+    rct_cache.pushKV("entries", (uint64_t)pblocktree->RCTOutputCacheCount());
+    rct_cache.pushKV("usage", (uint64_t)pblocktree->RCTOutputCacheUsage());
+    rct_cache.pushKV("hits", hits);
+    rct_cache.pushKV("misses", misses);
+    rct_cache.pushKV("hit_rate", hits + misses > 0 ? (double)hits / (hits + misses) : 0.0);
+    result.pushKV("rct_output_cache", rct_cache);
+
+    if (!request.params[0].isNull() && request.params[0].get_bool()) {
+        result.pushKV("leveldb_stats", pblocktree->GetLevelDBStats());
+    }
+    return result;
+},
+    };
+}
+
+static RPCHelpMan compactrange()
+{
+    return RPCHelpMan{"compactrange",
+        "\nCompact the keys of one prefix of the block tree database (blocks/index), such as an index after a rebuild.\n"
+        "Insight index prefixes are compacted in the insight index database if -insightdb is set.\n"
+        "Blocks until the compaction finishes, other database access continues meanwhile.\n",
+        {
+            {"prefix", RPCArg::Type::STR, RPCArg::Optional::NO, "The key prefix, as a character, a hex byte or a name listed by getdbstats."},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::STR_HEX, "prefix", "first byte of the keys"},
+                {RPCResult::Type::STR, "char", /* optional */ true, "the prefix as a character, if printable"},
+                {RPCResult::Type::STR, "name", "data stored under the prefix, empty if unknown"},
+                {RPCResult::Type::NUM, "size_before", "estimated bytes on disk before compacting"},
+                {RPCResult::Type::NUM, "size_after", "estimated bytes on disk after compacting"},
+                {RPCResult::Type::NUM, "time_ms", "time taken"},
+            }},
+        RPCExamples{
+            HelpExampleCli("compactrange", "\"rct_keyimage\"")
+    + HelpExampleCli("compactrange", "\"K\"")
+    + HelpExampleRpc("compactrange", "\"4b\"")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    if (!pblocktree) {
+        throw JSONRPCError(RPC_DATABASE_ERROR, "Block tree database is not open");
+    }
+    uint8_t prefix = ParseDBPrefix(request.params[0].get_str());
+    CDBWrapper &db = pblocktree->GetDBForPrefix(prefix);
+
+    auto prefix_size = [&db, prefix]() -> uint64_t {
+        auto stats = db.GetPrefixStats();
+        auto it = stats.find(prefix);
+        return it == stats.end() ? 0 : it->second.approximate_size;
+    };
+
+    UniValue result = DBPrefixToJSON(prefix);
+    result.pushKV("size_before", prefix_size());
+    int64_t time_start = GetTimeMillis();
+    db.CompactPrefix(prefix);
+    result.pushKV("size_after", prefix_size());
+    result.pushKV("time_ms", GetTimeMillis() - time_start);
+    return result;
+},
+    };
+}
+
 /**
  * Serialize the UTXO set to a file for loading elsewhere.
  *
@@ -2521,6 +2882,8 @@ static RPCHelpMan dumptxoutset()
                     {RPCResult::Type::STR_HEX, "base_hash", "the hash of the base of the snapshot"},
                     {RPCResult::Type::NUM, "base_height", "the height of the base of the snapshot"},
                     {RPCResult::Type::STR, "path", "the absolute path that the snapshot was written to"},
+                    {RPCResult::Type::NUM, "records_written", "the number of Particl state records written after the coins"},
+                    {RPCResult::Type::STR_HEX, "content_hash", "the hash of the coins and Particl state, see verifytxoutset"},
                 }
         },
         RPCExamples{
@@ -2543,6 +2906,7 @@ static RPCHelpMan dumptxoutset()
     FILE* file{fsbridge::fopen(temppath, "wb")};
     CAutoFile afile{file, SER_DISK, CLIENT_VERSION};
     std::unique_ptr<CCoinsViewCursor> pcursor;
+    std::unique_ptr<CDBIterator> pdbcursor;
     CCoinsStats stats;
     CBlockIndex* tip;
     NodeContext& node = EnsureNodeContext(request.context);
@@ -2569,6 +2933,8 @@ static RPCHelpMan dumptxoutset()
         }
 
         pcursor = std::unique_ptr<CCoinsViewCursor>(::ChainstateActive().CoinsDB().Cursor());
+        // The block tree is flushed with the coins, iterate the same state
+        pdbcursor = std::unique_ptr<CDBIterator>(pblocktree->NewIterator());
         tip = LookupBlockIndex(stats.hashBlock);
         CHECK_NONFATAL(tip);
     }
@@ -2577,6 +2943,7 @@ static RPCHelpMan dumptxoutset()
 
     afile << metadata;
 
+    CHashWriter hasher(SER_GETHASH, PROTOCOL_VERSION);
     COutPoint key;
     Coin coin;
     unsigned int iter{0};
@@ -2587,11 +2954,43 @@ static RPCHelpMan dumptxoutset()
         if (pcursor->GetKey(key) && pcursor->GetValue(coin)) {
             afile << key;
             afile << coin;
+            hasher << key << coin;
         }
 
         pcursor->Next();
     }
 
+    ParticlSnapshotState particl_state;
+    particl_state.m_money_supply = tip->nMoneySupply;
+    particl_state.m_anon_outputs = tip->nAnonOutputs;
+    particl_state.m_stake_modifier = tip->bnStakeModifier;
+    CBlock block;
+    if (fParticlMode && ReadBlockFromDisk(block, tip, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF) &&
+        block.IsProofOfStake()) {
+        block.vtx[0]->GetTreasuryFundCfwd(particl_state.m_treasury_cfwd);
+    }
+    afile << particl_state;
+    hasher << particl_state;
+
+    uint64_t records{0};
+    SnapshotDBRecord record;
+    SnapshotRawData raw_key{record.m_key}, raw_value{record.m_value};
+    for (const char prefix : SNAPSHOT_DB_PREFIXES) {
+        for (pdbcursor->Seek(prefix); pdbcursor->Valid(); pdbcursor->Next()) {
+            if (iter++ % 5000 == 0) node.rpc_interruption_point();
+            if (!pdbcursor->GetKey(raw_key) || record.m_key.empty() || (char)record.m_key[0] != prefix) {
+                break;
+            }
+            if (!pdbcursor->GetValue(raw_value)) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Unable to read block tree record");
+            }
+            afile << true << record;
+            hasher << record;
+            ++records;
+        }
+        afile << false;
+    }
+
     afile.fclose();
     fs::rename(temppath, path);
 
@@ -2600,6 +2999,118 @@ static RPCHelpMan dumptxoutset()
     result.pushKV("base_hash", tip->GetBlockHash().ToString());
     result.pushKV("base_height", tip->nHeight);
     result.pushKV("path", path.string());
+    result.pushKV("records_written", records);
+    result.pushKV("content_hash", hasher.GetHash().GetHex());
+    return result;
+},
+    };
+}
+
+static RPCHelpMan verifytxoutset()
+{
+    return RPCHelpMan{
+        "verifytxoutset",
+        "\nRead a UTXO snapshot written by dumptxoutset and check it is complete.\n",
+        {
+            {"path", RPCArg::Type::STR, RPCArg::Optional::NO, "path to the snapshot. If relative, will be prefixed by datadir."},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+                {
+                    {RPCResult::Type::STR_HEX, "base_hash", "the hash of the base of the snapshot"},
+                    {RPCResult::Type::NUM, "base_height", /* optional */ true, "the height of the base of the snapshot, if the block is known"},
+                    {RPCResult::Type::NUM, "coins_read", "the number of coins in the snapshot"},
+                    {RPCResult::Type::BOOL, "particl_state", "whether the snapshot carries the Particl state"},
+                    {RPCResult::Type::STR_AMOUNT, "money_supply", /* optional */ true, "the money supply at the base"},
+                    {RPCResult::Type::NUM, "anon_outputs", /* optional */ true, "the last anon output index at the base"},
+                    {RPCResult::Type::BOOL, "anon_index_complete", /* optional */ true, "whether every anon output up to the base is in the snapshot"},
+                    {RPCResult::Type::STR_AMOUNT, "treasury_cfwd", /* optional */ true, "the treasury fund carried forward at the base"},
+                    {RPCResult::Type::OBJ_DYN, "records", /* optional */ true, "the number of block tree records by prefix",
+                        {
+                            {RPCResult::Type::NUM, "prefix", "the number of records"},
+                        }},
+                    {RPCResult::Type::STR_HEX, "content_hash", "the hash of the coins and Particl state"},
+                }
+        },
+        RPCExamples{
+            HelpExampleCli("verifytxoutset", "utxo.dat")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    fs::path path = fs::absolute(request.params[0].get_str(), GetDataDir());
+    CAutoFile afile{fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION};
+    if (afile.IsNull()) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Unable to open " + path.string());
+    }
+    NodeContext& node = EnsureNodeContext(request.context);
+
+    UniValue result(UniValue::VOBJ);
+    CHashWriter hasher(SER_GETHASH, PROTOCOL_VERSION);
+    try {
+        SnapshotMetadata metadata;
+        afile >> metadata;
+        result.pushKV("base_hash", metadata.m_base_blockhash.GetHex());
+        {
+            LOCK(cs_main);
+            const CBlockIndex* base = LookupBlockIndex(metadata.m_base_blockhash);
+            if (base) {
+                result.pushKV("base_height", base->nHeight);
+            }
+        }
+
+        COutPoint key;
+        Coin coin;
+        for (uint64_t i = 0; i < metadata.m_coins_count; ++i) {
+            if (i % 5000 == 0) node.rpc_interruption_point();
+            afile >> key >> coin;
+            hasher << key << coin;
+        }
+        result.pushKV("coins_read", metadata.m_coins_count);
+
+        ParticlSnapshotState particl_state;
+        try {
+            afile >> particl_state;
+        } catch (const std::ios_base::failure&) {
+            // Snapshots without the Particl state end here
+            result.pushKV("particl_state", false);
+            result.pushKV("content_hash", hasher.GetHash().GetHex());
+            return result;
+        }
+        if (particl_state.m_version > ParticlSnapshotState::CURRENT_VERSION) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("Unknown snapshot state version %d", particl_state.m_version));
+        }
+        hasher << particl_state;
+
+        UniValue records(UniValue::VOBJ);
+        uint64_t anon_outputs{0};
+        SnapshotDBRecord record;
+        for (const char prefix : SNAPSHOT_DB_PREFIXES) {
+            uint64_t count{0};
+            bool more;
+            for (afile >> more; more; afile >> more) {
+                afile >> record;
+                if (record.m_key.empty() || (char)record.m_key[0] != prefix) {
+                    throw JSONRPCError(RPC_DESERIALIZATION_ERROR, strprintf("Unexpected record in the %c section", prefix));
+                }
+                hasher << record;
+                if (++count % 5000 == 0) node.rpc_interruption_point();
+            }
+            if (prefix == DB_RCTOUTPUT) {
+                anon_outputs = count;
+            }
+            records.pushKV(std::string(1, prefix), count);
+        }
+
+        result.pushKV("particl_state", true);
+        result.pushKV("money_supply", ValueFromAmount(particl_state.m_money_supply));
+        result.pushKV("anon_outputs", particl_state.m_anon_outputs);
+        result.pushKV("anon_index_complete", (int64_t)anon_outputs == particl_state.m_anon_outputs);
+        result.pushKV("treasury_cfwd", ValueFromAmount(particl_state.m_treasury_cfwd));
+        result.pushKV("records", records);
+    } catch (const std::ios_base::failure& e) {
+        throw JSONRPCError(RPC_DESERIALIZATION_ERROR, strprintf("Snapshot is truncated: %s", e.what()));
+    }
+    result.pushKV("content_hash", hasher.GetHash().GetHex());
     return result;
 },
     };
@@ -2626,6 +3137,7 @@ static const CRPCCommand commands[] =
     { "blockchain",         "getmempooldescendants",  &getmempooldescendants,  {"txid","verbose"} },
     { "blockchain",         "getmempoolentry",        &getmempoolentry,        {"txid"} },
     { "blockchain",         "getmempoolinfo",         &getmempoolinfo,         {} },
+    { "blockchain",         "getvalidationqueueinfo", &getvalidationqueueinfo, {} },
     { "blockchain",         "getrawmempool",          &getrawmempool,          {"verbose", "mempool_sequence"} },
     { "blockchain",         "gettxout",               &gettxout,               {"txid","n","include_mempool"} },
     { "blockchain",         "gettxoutsetinfo",        &gettxoutsetinfo,        {"hash_type"} },
@@ -2637,6 +3149,9 @@ static const CRPCCommand commands[] =
     { "blockchain",         "scantxoutset",           &scantxoutset,           {"action", "scanobjects"} },
     { "blockchain",         "getblockfilter",         &getblockfilter,         {"blockhash", "filtertype"} },
     { "blockchain",         "getposdifficulty",       &getposdifficulty,       {"height"} },
+    { "blockchain",         "getvalidationstats",     &getvalidationstats,     {"reset"} },
+    { "blockchain",         "getdbstats",             &getdbstats,             {"verbose"} },
+    { "blockchain",         "compactrange",           &compactrange,           {"prefix"} },
 
     /* Not shown in help */
     { "hidden",             "invalidateblock",        &invalidateblock,        {"blockhash"} },
@@ -2646,6 +3161,7 @@ static const CRPCCommand commands[] =
     { "hidden",             "waitforblockheight",     &waitforblockheight,     {"height","timeout"} },
     { "hidden",             "syncwithvalidationinterfacequeue", &syncwithvalidationinterfacequeue, {} },
     { "hidden",             "dumptxoutset",           &dumptxoutset,           {"path"} },
+    { "hidden",             "verifytxoutset",         &verifytxoutset,         {"path"} },
 };
 // clang-format on
     for (const auto& c : commands) {
@@ -113,6 +113,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "testmempoolaccept", 0, "rawtxs" },
     { "testmempoolaccept", 1, "maxfeerate" },
     { "testmempoolaccept", 2, "ignorelocks" },
+    { "testmempoolaccept", 3, "independent" },
+    { "getscanmatches", 1, "after" },
+    { "getscanmatches", 2, "timeout" },
     { "combinerawtransaction", 0, "txs" },
     { "fundrawtransaction", 1, "options" },
     { "fundrawtransaction", 2, "iswitness" },
@@ -180,7 +183,12 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "listcoldstakeunspent", 1, "height"},
     { "listcoldstakeunspent", 2, "options"},
     { "getblockreward", 0, "height"},
+    { "getblockrewards", 0, "start"},
+    { "getblockrewards", 1, "end"},
     { "getblockbalances", 1, "options"},
+    { "getblockbalancesrange", 0, "start"},
+    { "getblockbalancesrange", 1, "end"},
+    { "getblockbalancesrange", 2, "options"},
     { "bumpfee", 1, "options" },
     { "psbtbumpfee", 1, "options" },
 
@@ -189,6 +197,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "deriverangekeys", 0, "start" },
     { "deriverangekeys", 1, "end" },
     { "filtertransactions", 0, "options" },
+    { "archivewallettransactions", 0, "min_depth" },
+    { "archivewallettransactions", 1, "older_than" },
+    { "geteligibleaddresses", 2, "options" },
     { "filteraddresses", 0, "offset" },
     { "filteraddresses", 1, "count" },
     { "setvote", 0, "proposal" },
@@ -263,6 +274,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "listunspentblind", 4, "query_options" },
 
     { "rewindchain", 0, "height" },
+    { "anonoutputs", 0, "start" },
+    { "anonoutputs", 1, "count" },
+    { "anonoutputs", 2, "verbose" },
 
     { "createrawparttransaction", 0, "inputs" },
     { "createrawparttransaction", 1, "outputs" },
@@ -294,6 +308,7 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "smsgoutbox", 2, "options" },
     { "smsggetfeerate", 0, "height" },
     { "smsggetdifficulty", 0, "time" },
+    { "smsgscanchain", 0, "async" },
     { "smsgscanbuckets", 0, "options" },
     { "smsgpeers", 0, "index" },
     { "smsgzmqpush", 0, "options" },
@@ -314,6 +329,11 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "initaccountfromdevice", 4, "initstealthchain" },
 
     { "getposdifficulty", 0, "height" },
+    { "getvalidationstats", 0, "reset" },
+    { "getdbstats", 0, "verbose" },
+    { "getlockstats", 0, "count" },
+    { "getlockstats", 1, "reset" },
+    { "getlockstats", 2, "enable" },
 
 
     { "logging", 0, "include" },
@@ -340,6 +360,7 @@ static const CRPCConvertParam vRPCConvertParams[] =
     { "createwallet", 6, "load_on_startup"},
     { "createwallet", 7, "use_legacy"},
     { "loadwallet", 1, "load_on_startup"},
+    { "importwalletsnapshot", 2, "load_on_startup"},
     { "unloadwallet", 1, "load_on_startup"},
     { "getnodeaddresses", 0, "count"},
     { "addpeeraddress", 1, "port"},
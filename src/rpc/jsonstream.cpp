@@ -0,0 +1,128 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <rpc/jsonstream.h>
+
+#include <cassert>
+
+JSONStreamWriter::JSONStreamWriter(Sink sink, size_t flush_size)
+    : m_sink(std::move(sink)), m_flush_size(flush_size)
+{
+    m_buffer.reserve(m_flush_size);
+}
+
+void JSONStreamWriter::Put(const std::string& s)
+{
+    m_buffer += s;
+    if (m_buffer.size() >= m_flush_size) {
+        Flush();
+    }
+}
+
+void JSONStreamWriter::Separate()
+{
+    if (m_after_key) {
+        m_after_key = false;
+        return;
+    }
+    if (m_open.empty()) {
+        assert(!m_has_value);
+        m_has_value = true;
+        return;
+    }
+    // Object members start with Key()
+    assert(!m_open.back());
+    if (m_open_filled.back()) {
+        Put(",");
+    }
+    m_open_filled.back() = true;
+}
+
+void JSONStreamWriter::BeginObject()
+{
+    Separate();
+    Put("{");
+    m_open.push_back(true);
+    m_open_filled.push_back(false);
+}
+
+void JSONStreamWriter::EndObject()
+{
+    assert(!m_open.empty() && m_open.back() && !m_after_key);
+    m_open.pop_back();
+    m_open_filled.pop_back();
+    Put("}");
+}
+
+void JSONStreamWriter::BeginArray()
+{
+    Separate();
+    Put("[");
+    m_open.push_back(false);
+    m_open_filled.push_back(false);
+}
+
+void JSONStreamWriter::EndArray()
+{
+    assert(!m_open.empty() && !m_open.back());
+    m_open.pop_back();
+    m_open_filled.pop_back();
+    Put("]");
+}
+
+void JSONStreamWriter::Key(const std::string& key)
+{
+    assert(!m_open.empty() && m_open.back() && !m_after_key);
+    if (m_open_filled.back()) {
+        Put(",");
+    }
+    m_open_filled.back() = true;
+    // A string value is written quoted and escaped
+    Put(UniValue(key).write());
+    Put(":");
+    m_after_key = true;
+}
+
+void JSONStreamWriter::Value(const UniValue& value)
+{
+    switch (value.getType()) {
+    case UniValue::VOBJ: {
+        BeginObject();
+        const std::vector<std::string>& keys = value.getKeys();
+        const std::vector<UniValue>& values = value.getValues();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            Key(keys[i]);
+            Value(values[i]);
+        }
+        EndObject();
+        break;
+    }
+    case UniValue::VARR:
+        BeginArray();
+        for (const UniValue& item : value.getValues()) {
+            Value(item);
+        }
+        EndArray();
+        break;
+    default:
+        Separate();
+        Put(value.write());
+        break;
+    }
+}
+
+void JSONStreamWriter::Flush()
+{
+    if (m_buffer.empty()) {
+        return;
+    }
+    m_flushed += m_buffer.size();
+    m_sink(m_buffer);
+    m_buffer.clear();
+}
+
+void JSONStreamWriter::Discard()
+{
+    m_buffer.clear();
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_RPC_JSONSTREAM_H
+#define BITCOIN_RPC_JSONSTREAM_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <univalue.h>
+
+/** Bytes buffered before the writer hands a piece of output to its sink */
+static const size_t JSON_STREAM_FLUSH_SIZE = 64 * 1024;
+
+/**
+ * Writes compact JSON to a sink in pieces of about flush_size bytes, so a
+ * large RPC result can be sent while it's produced instead of being built as
+ * one UniValue tree and serialized into one string.
+ * Values go into the innermost open object or array, an object member is a
+ * Key() followed by a value.
+ */
+class JSONStreamWriter
+{
+public:
+    using Sink = std::function<void(const std::string&)>;
+
+    explicit JSONStreamWriter(Sink sink, size_t flush_size = JSON_STREAM_FLUSH_SIZE);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+    void Key(const std::string& key);
+    /** Write value, a tree is written node by node without serializing it into one string */
+    void Value(const UniValue& value);
+
+    /** Hand the buffered output to the sink. */
+    void Flush();
+    /** Drop output that hasn't reached the sink yet. */
+    void Discard();
+
+    /** Whether a complete top level value has been written */
+    bool HasValue() const { return m_has_value && m_open.empty(); }
+    /** Whether any output reached the sink */
+    bool Flushed() const { return m_flushed > 0; }
+
+private:
+    void Separate();
+    void Put(const std::string& s);
+
+    Sink m_sink;
+    size_t m_flush_size;
+    std::string m_buffer;
+    size_t m_flushed{0};
+    //! Open containers, true for an object, and whether each has a member yet
+    std::vector<bool> m_open;
+    std::vector<bool> m_open_filled;
+    bool m_after_key{false};
+    bool m_has_value{false};
+};
+
+#endif // BITCOIN_RPC_JSONSTREAM_H
@@ -1043,6 +1043,12 @@ static RPCHelpMan estimatesmartfee()
             "       \"UNSET\"\n"
             "       \"ECONOMICAL\"\n"
             "       \"CONSERVATIVE\""},
+                    {"tx_type", RPCArg::Type::STR, /* default */ "all", "Estimate from the transactions of one type only.\n"
+            "                   Anon fee rates are as paid, not scaled down by the anon fee multiplier.  Must be one of:\n"
+            "       \"all\"\n"
+            "       \"plain\"\n"
+            "       \"blind\"    (blinded outputs or a blinded fee)\n"
+            "       \"anon\"     (anon inputs)"},
                 },
                 RPCResult{
                     RPCResult::Type::OBJ, "", "",
@@ -1060,10 +1066,11 @@ static RPCHelpMan estimatesmartfee()
                     }},
                 RPCExamples{
                     HelpExampleCli("estimatesmartfee", "6")
+            + HelpExampleCli("estimatesmartfee", "6 ECONOMICAL anon")
                 },
         [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
 {
-    RPCTypeCheck(request.params, {UniValue::VNUM, UniValue::VSTR});
+    RPCTypeCheck(request.params, {UniValue::VNUM, UniValue::VSTR, UniValue::VSTR});
     RPCTypeCheckArgument(request.params[0], UniValue::VNUM);
     unsigned int max_target = ::feeEstimator.HighestTargetTracked(FeeEstimateHorizon::LONG_HALFLIFE);
     unsigned int conf_target = ParseConfirmTarget(request.params[0], max_target);
@@ -1075,11 +1082,20 @@ static RPCHelpMan estimatesmartfee()
         }
         if (fee_mode == FeeEstimateMode::ECONOMICAL) conservative = false;
     }
+    Optional<FeeEstimateTxType> tx_type;
+    if (!request.params[2].isNull() && request.params[2].get_str() != "all") {
+        FeeEstimateTxType type;
+        if (!FeeEstimateTxTypeFromString(request.params[2].get_str(), type)) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid tx_type parameter, must be one of: \"all\", \"plain\", \"blind\", \"anon\"");
+        }
+        tx_type = type;
+    }
 
     UniValue result(UniValue::VOBJ);
     UniValue errors(UniValue::VARR);
     FeeCalculation feeCalc;
-    CFeeRate feeRate = ::feeEstimator.estimateSmartFee(conf_target, &feeCalc, conservative);
+    CFeeRate feeRate = tx_type ? ::feeEstimator.estimateSmartFee(conf_target, &feeCalc, conservative, *tx_type)
+                               : ::feeEstimator.estimateSmartFee(conf_target, &feeCalc, conservative);
     if (feeRate != CFeeRate(0)) {
         result.pushKV("feerate", ValueFromAmount(feeRate.GetFeePerK()));
     } else {
@@ -1228,7 +1244,7 @@ static const CRPCCommand commands[] =
     { "generating",         "generatetodescriptor",   &generatetodescriptor,   {"num_blocks","descriptor","maxtries"} },
     { "generating",         "generateblock",          &generateblock,          {"output","transactions"} },
 
-    { "util",               "estimatesmartfee",       &estimatesmartfee,       {"conf_target", "estimate_mode"} },
+    { "util",               "estimatesmartfee",       &estimatesmartfee,       {"conf_target", "estimate_mode", "tx_type"} },
 
     { "hidden",             "estimaterawfee",         &estimaterawfee,         {"conf_target", "threshold"} },
     { "hidden",             "generate",               &generate,               {} },
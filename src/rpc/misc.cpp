@@ -5,11 +5,15 @@
 
 #include <httpserver.h>
 #include <index/blockfilterindex.h>
+#include <index/insightindex.h>
 #include <index/txindex.h>
 #include <interfaces/chain.h>
 #include <key_io.h>
+#include <node/blockcache.h>
 #include <node/context.h>
+#include <node/initstages.h>
 #include <outputtype.h>
+#include <pubkey.h>
 #include <rpc/blockchain.h>
 #include <rpc/server.h>
 #include <rpc/util.h>
@@ -27,6 +31,8 @@
 #include <rpc/client.h>
 
 #include <stdint.h>
+#include <array>
+#include <map>
 #include <tuple>
 #ifdef HAVE_MALLOC_INFO
 #include <malloc.h>
@@ -528,6 +534,29 @@ static UniValue RPCLockedMemoryInfo()
     return obj;
 }
 
+static UniValue RPCBlockCacheInfo()
+{
+    BlockCacheStats stats = g_block_cache.GetStats();
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("hits", stats.hits);
+    obj.pushKV("misses", stats.misses);
+    obj.pushKV("entries", uint64_t(stats.entries));
+    obj.pushKV("usage", uint64_t(stats.usage));
+    obj.pushKV("max_usage", uint64_t(stats.max_usage));
+    return obj;
+}
+
+static UniValue RPCPubKeyCacheInfo()
+{
+    PubKeyCacheStats stats = GetPubKeyCacheStats();
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("hits", stats.hits);
+    obj.pushKV("misses", stats.misses);
+    obj.pushKV("entries", uint64_t(stats.entries));
+    obj.pushKV("slots", uint64_t(stats.slots));
+    return obj;
+}
+
 #ifdef HAVE_MALLOC_INFO
 static std::string RPCMallocInfo()
 {
@@ -572,6 +601,21 @@ static RPCHelpMan getmemoryinfo()
                                 {RPCResult::Type::NUM, "chunks_used", "Number allocated chunks"},
                                 {RPCResult::Type::NUM, "chunks_free", "Number unused chunks"},
                             }},
+                            {RPCResult::Type::OBJ, "pubkeycache", "Information about the parsed pubkey cache used to verify staking signatures",
+                            {
+                                {RPCResult::Type::NUM, "hits", "Number of verifications that reused a parsed pubkey"},
+                                {RPCResult::Type::NUM, "misses", "Number of verifications that had to parse the pubkey"},
+                                {RPCResult::Type::NUM, "entries", "Number of cached pubkeys"},
+                                {RPCResult::Type::NUM, "slots", "Capacity of the cache"},
+                            }},
+                            {RPCResult::Type::OBJ, "blockcache", "Information about the cache of recently read blocks",
+                            {
+                                {RPCResult::Type::NUM, "hits", "Number of block reads served from the cache"},
+                                {RPCResult::Type::NUM, "misses", "Number of block reads that went to disk"},
+                                {RPCResult::Type::NUM, "entries", "Number of cached blocks"},
+                                {RPCResult::Type::NUM, "usage", "Estimated memory held by the cached blocks in bytes"},
+                                {RPCResult::Type::NUM, "max_usage", "Memory limit of the cache in bytes, 0 when disabled"},
+                            }},
                         }
                     },
                     RPCResult{"mode \"mallocinfo\"",
@@ -588,6 +632,8 @@ static RPCHelpMan getmemoryinfo()
     if (mode == "stats") {
         UniValue obj(UniValue::VOBJ);
         obj.pushKV("locked", RPCLockedMemoryInfo());
+        obj.pushKV("pubkeycache", RPCPubKeyCacheInfo());
+        obj.pushKV("blockcache", RPCBlockCacheInfo());
         return obj;
     } else if (mode == "mallocinfo") {
 #ifdef HAVE_MALLOC_INFO
@@ -602,6 +648,127 @@ static RPCHelpMan getmemoryinfo()
     };
 }
 
+static UniValue LockHistogramToJSON(const std::vector<uint64_t> &histogram)
+{
+    // Trailing empty buckets are left out
+    size_t len = histogram.size();
+    while (len > 0 && histogram[len - 1] == 0) {
+        len--;
+    }
+    UniValue rv(UniValue::VARR);
+    for (size_t i = 0; i < len; ++i) {
+        rv.push_back(histogram[i]);
+    }
+    return rv;
+}
+
+static RPCHelpMan getlockstats()
+{
+    return RPCHelpMan{"getlockstats",
+                "\nReturns the time spent waiting for and holding cs_main, cs_wallet, cs_smsg, cs_smsgDB and mempool.cs by lock site.\n"
+                "Recorded while lock profiling is enabled with -lockprofile or the enable argument.\n"
+                "Only the outermost lock of a mutex by a thread is timed, sites are ordered by total wait time.\n"
+                "Histogram bucket 0 counts times under 1us, bucket b times from 2^(b-1) up to 2^b us.\n",
+                {
+                    {"count", RPCArg::Type::NUM, /* default */ "20", "Maximum number of sites to return, 0 for all."},
+                    {"reset", RPCArg::Type::BOOL, /* default */ "false", "Clear the recorded stats after returning them."},
+                    {"enable", RPCArg::Type::BOOL, /* default */ "unchanged", "Turn lock profiling on or off."},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::BOOL, "enabled", "whether lock profiling is on"},
+                        {RPCResult::Type::OBJ_DYN, "locks", "totals by lock",
+                        {
+                            {RPCResult::Type::OBJ, "lock", "",
+                            {
+                                {RPCResult::Type::NUM, "acquisitions", "timed locks"},
+                                {RPCResult::Type::NUM, "contended", "locks that had to wait"},
+                                {RPCResult::Type::NUM, "wait_us", "total time waited"},
+                                {RPCResult::Type::NUM, "hold_us", "total time held"},
+                            }},
+                        }},
+                        {RPCResult::Type::ARR, "sites", "",
+                        {
+                            {RPCResult::Type::OBJ, "", "",
+                            {
+                                {RPCResult::Type::STR, "lock", "name of the mutex"},
+                                {RPCResult::Type::STR, "site", "file and line of the lock"},
+                                {RPCResult::Type::NUM, "acquisitions", "timed locks"},
+                                {RPCResult::Type::NUM, "contended", "locks that had to wait"},
+                                {RPCResult::Type::NUM, "wait_us", "total time waited"},
+                                {RPCResult::Type::NUM, "wait_max_us", "longest wait"},
+                                {RPCResult::Type::NUM, "hold_us", "total time held"},
+                                {RPCResult::Type::NUM, "hold_max_us", "longest hold"},
+                                {RPCResult::Type::ARR, "wait_histogram", "contended waits by bucket", {{RPCResult::Type::NUM, "", ""}}},
+                                {RPCResult::Type::ARR, "hold_histogram", "holds by bucket", {{RPCResult::Type::NUM, "", ""}}},
+                            }},
+                        }},
+                    }},
+                RPCExamples{
+                    HelpExampleCli("getlockstats", "")
+            + HelpExampleCli("getlockstats", "10 true")
+            + HelpExampleRpc("getlockstats", "0, false, true")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    const int count = request.params[0].isNull() ? 20 : request.params[0].get_int();
+    if (count < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "count must not be negative");
+    }
+    if (!request.params[2].isNull()) {
+        g_lock_profiling = request.params[2].get_bool();
+    }
+
+    const std::vector<LockProfileStats> sites = GetLockProfile();
+    if (!request.params[1].isNull() && request.params[1].get_bool()) {
+        ResetLockProfile();
+    }
+
+    std::map<std::string, std::array<uint64_t, 4> > totals;
+    UniValue sites_json(UniValue::VARR);
+    for (const auto &site : sites) {
+        auto &total = totals[site.lock_name];
+        total[0] += site.acquisitions;
+        total[1] += site.contended;
+        total[2] += site.wait_us;
+        total[3] += site.hold_us;
+        if (count > 0 && sites_json.size() >= (size_t)count) {
+            continue;
+        }
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("lock", site.lock_name);
+        entry.pushKV("site", strprintf("%s:%d", site.file, site.line));
+        entry.pushKV("acquisitions", site.acquisitions);
+        entry.pushKV("contended", site.contended);
+        entry.pushKV("wait_us", site.wait_us);
+        entry.pushKV("wait_max_us", site.wait_max_us);
+        entry.pushKV("hold_us", site.hold_us);
+        entry.pushKV("hold_max_us", site.hold_max_us);
+        entry.pushKV("wait_histogram", LockHistogramToJSON(site.wait_histogram));
+        entry.pushKV("hold_histogram", LockHistogramToJSON(site.hold_histogram));
+        sites_json.push_back(entry);
+    }
+
+    UniValue locks(UniValue::VOBJ);
+    for (const auto &it : totals) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("acquisitions", it.second[0]);
+        entry.pushKV("contended", it.second[1]);
+        entry.pushKV("wait_us", it.second[2]);
+        entry.pushKV("hold_us", it.second[3]);
+        locks.pushKV(it.first, entry);
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("enabled", g_lock_profiling.load());
+    result.pushKV("locks", locks);
+    result.pushKV("sites", sites_json);
+    return result;
+},
+    };
+}
+
 static void EnableOrDisableLogCategories(UniValue cats, bool enable) {
     cats = cats.get_array();
     for (unsigned int i = 0; i < cats.size(); ++i) {
@@ -620,6 +787,51 @@ static void EnableOrDisableLogCategories(UniValue cats, bool enable) {
     }
 }
 
+static RPCHelpMan getinitstages()
+{
+    return RPCHelpMan{"getinitstages",
+                "\nReturns how long the stages of the last startup took.\n"
+                "Background stages ran alongside the others, so the durations can add up to more than the total.\n",
+                {},
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::NUM, "total_ms", "milliseconds from the start of initialization until it finished"},
+                        {RPCResult::Type::ARR, "stages", "stages in the order they finished",
+                        {
+                            {RPCResult::Type::OBJ, "", "",
+                            {
+                                {RPCResult::Type::STR, "name", "the stage"},
+                                {RPCResult::Type::NUM, "start_ms", "milliseconds after initialization started"},
+                                {RPCResult::Type::NUM, "duration_ms", "milliseconds the stage took"},
+                                {RPCResult::Type::BOOL, "background", "whether the stage ran alongside the others"},
+                            }},
+                        }},
+                    }},
+                RPCExamples{
+                    HelpExampleCli("getinitstages", "")
+            + HelpExampleRpc("getinitstages", "")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    UniValue stages(UniValue::VARR);
+    for (const auto &stage : GetInitStages()) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("name", stage.name);
+        entry.pushKV("start_ms", stage.start);
+        entry.pushKV("duration_ms", stage.duration);
+        entry.pushKV("background", stage.background);
+        stages.push_back(entry);
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("total_ms", GetInitDuration());
+    result.pushKV("stages", stages);
+    return result;
+},
+    };
+}
+
 static RPCHelpMan logging()
 {
     return RPCHelpMan{"logging",
@@ -734,6 +946,7 @@ static UniValue SummaryToJSON(const IndexSummary&& summary, std::string index_na
     UniValue entry(UniValue::VOBJ);
     entry.pushKV("synced", summary.synced);
     entry.pushKV("best_block_height", summary.best_block_height);
+    entry.pushKV("progress", summary.progress);
     ret_summary.pushKV(summary.name, entry);
     return ret_summary;
 }
@@ -752,6 +965,7 @@ static RPCHelpMan getindexinfo()
                             {
                                 {RPCResult::Type::BOOL, "synced", "Whether the index is synced or not"},
                                 {RPCResult::Type::NUM, "best_block_height", "The block height to which the index is synced"},
+                                {RPCResult::Type::NUM, "progress", "Fraction of the active chain the index is synced to"},
                             }
                         },
                     },
@@ -771,6 +985,10 @@ static RPCHelpMan getindexinfo()
         result.pushKVs(SummaryToJSON(g_txindex->GetSummary(), index_name));
     }
 
+    if (g_insight_index) {
+        result.pushKVs(SummaryToJSON(g_insight_index->GetSummary(), index_name));
+    }
+
     ForEachBlockFilterIndex([&result, &index_name](const BlockFilterIndex& index) {
         result.pushKVs(SummaryToJSON(index.GetSummary(), index_name));
     });
@@ -841,6 +1059,8 @@ static const CRPCCommand commands[] =
   //  --------------------- ------------------------  -----------------------  ----------
     { "control",            "getmemoryinfo",          &getmemoryinfo,          {"mode"} },
     { "control",            "logging",                &logging,                {"include", "exclude"}},
+    { "control",            "getlockstats",           &getlockstats,           {"count", "reset", "enable"} },
+    { "control",            "getinitstages",          &getinitstages,          {} },
     { "util",               "validateaddress",        &validateaddress,        {"address","showaltversions"} },
     { "util",               "createmultisig",         &createmultisig,         {"nrequired","keys","address_type"} },
     { "util",               "deriveaddresses",        &deriveaddresses,        {"descriptor", "range"} },
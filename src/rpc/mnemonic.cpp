@@ -22,7 +22,7 @@
 UniValue mnemonicrpc(const JSONRPCRequest &request)
 {   //TODO update the menmonicrpc to latest rpc code style.
     std::string help = ""
-        "mnemonic new|decode|addchecksum|dumpwords|listlanguages\n"
+        "mnemonic new|decode|validate|addchecksum|dumpwords|listlanguages\n"
         "mnemonic new ( \"password\" language nBytesEntropy bip44 fLegacy )\n"
         "    Generate a new extended key and mnemonic\n"
         "    password, can be blank "", default blank\n"
@@ -33,6 +33,9 @@ UniValue mnemonicrpc(const JSONRPCRequest &request)
         "    Decode mnemonic\n"
         "    bip44,  true|false, default true\n"
         "    fLegacy,true|false, default false\n"
+        "mnemonic validate [\"mnemonic\",...] ( \"language\" )\n"
+        "    Check the words and checksum of each mnemonic without deriving keys.\n"
+        "    language, detected per mnemonic if not set\n"
         "mnemonic addchecksum \"mnemonic\"\n"
         "    Add checksum words to mnemonic.\n"
         "    Final no of words in mnemonic must be divisible by three.\n"
@@ -56,7 +59,7 @@ UniValue mnemonicrpc(const JSONRPCRequest &request)
         std::string s = request.params[0].get_str();
         std::string st = " " + s + " "; // Note the spaces
         std::transform(st.begin(), st.end(), st.begin(), ::tolower);
-        static const char *pmodes = " new decode addchecksum dumpwords listlanguages ";
+        static const char *pmodes = " new decode validate addchecksum dumpwords listlanguages ";
         if (strstr(pmodes, st.c_str()) != nullptr) {
             st.erase(std::remove(st.begin(), st.end(), ' '), st.end());
             mode = st;
@@ -202,6 +205,46 @@ UniValue mnemonicrpc(const JSONRPCRequest &request)
             memory_cleanse(&sPassword[0], sPassword.size());
         }
     } else
+    if (mode == "validate") {
+        if (request.params.size() < 2 || request.params.size() > 3) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Must provide an array of mnemonics.");
+        }
+        UniValue mnemonics = request.params[1];
+        if (mnemonics.isStr() && !mnemonics.read(request.params[1].get_str())) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Mnemonics must be a JSON array.");
+        }
+        if (!mnemonics.isArray()) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Mnemonics must be a JSON array.");
+        }
+        int nLanguageIn = request.params.size() > 2 ? mnemonic::GetLanguageOffset(request.params[2].get_str()) : -1;
+
+        UniValue results(UniValue::VARR);
+        size_t nValid = 0;
+        for (size_t i = 0; i < mnemonics.size(); ++i) {
+            std::string sMnemonic = mnemonics[i].get_str(), sError;
+            std::vector<uint8_t> vEntropy;
+            int nLanguage = nLanguageIn;
+            UniValue entry(UniValue::VOBJ);
+            if (0 == mnemonic::Decode(nLanguage, sMnemonic, vEntropy, sError)) {
+                entry.pushKV("valid", true);
+                entry.pushKV("language", mnemonic::GetLanguage(nLanguage));
+                nValid++;
+            } else {
+                entry.pushKV("valid", false);
+                entry.pushKV("error", sError);
+            }
+            results.push_back(entry);
+
+            if (sMnemonic.size() > 0) {
+                memory_cleanse(&sMnemonic[0], sMnemonic.size());
+            }
+            if (vEntropy.size() > 0) {
+                memory_cleanse(vEntropy.data(), vEntropy.size());
+            }
+        }
+        result.pushKV("results", results);
+        result.pushKV("num_valid", (int)nValid);
+    } else
     if (mode == "addchecksum") {
         std::string sMnemonicIn, sMnemonicOut, sError;
         if (request.params.size() != 2) {
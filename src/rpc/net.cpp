@@ -5,6 +5,7 @@
 #include <rpc/server.h>
 
 #include <banman.h>
+#include <blockencodings.h>
 #include <clientversion.h>
 #include <core_io.h>
 #include <net.h>
@@ -17,6 +18,7 @@
 #include <rpc/blockchain.h>
 #include <rpc/protocol.h>
 #include <rpc/util.h>
+#include <smsg/smessage.h>
 #include <sync.h>
 #include <timedata.h>
 #include <util/strencodings.h>
@@ -142,6 +144,10 @@ static RPCHelpMan getpeerinfo()
                             {
                                 {RPCResult::Type::NUM, "n", "The heights of blocks we're currently asking from this peer"},
                             }},
+                            {RPCResult::Type::NUM, "block_download_time", "Average time in microseconds the peer takes to serve a requested block, 0 if none was received"},
+                            {RPCResult::Type::NUM, "block_download_rate", "Average bytes per second of the blocks served by this peer"},
+                            {RPCResult::Type::NUM, "inflight_limit", "The number of blocks that can be in flight from this peer"},
+                            {RPCResult::Type::NUM, "txs_deferred", "The number of times the transactions from this peer went over their validation cost budget and were deferred"},
                             {RPCResult::Type::BOOL, "whitelisted", /* optional */ true, "Whether the peer is whitelisted with default permissions\n"
                                                                                         "(DEPRECATED, returned only if config option -deprecatedrpc=whitelisted is passed)"},
                             {RPCResult::Type::ARR, "permissions", "Any special permissions that have been granted to this peer",
@@ -242,8 +248,12 @@ static RPCHelpMan getpeerinfo()
                 heights.push_back(height);
             }
             obj.pushKV("inflight", heights);
+            obj.pushKV("block_download_time", statestats.m_block_download_time);
+            obj.pushKV("block_download_rate", statestats.m_block_download_rate);
+            obj.pushKV("inflight_limit", statestats.m_blocks_in_transit_limit);
             obj.pushKV("addr_processed", statestats.m_addr_processed);
             obj.pushKV("addr_rate_limited", statestats.m_addr_rate_limited);
+            obj.pushKV("txs_deferred", statestats.m_txs_deferred);
         }
         if (IsDeprecatedRPCEnabled("whitelisted")) {
             // whitelisted is deprecated in v0.21 for removal in v0.22
@@ -476,6 +486,15 @@ static RPCHelpMan getnettotals()
                            {RPCResult::Type::NUM, "bytes_left_in_cycle", "Bytes left in current time cycle"},
                            {RPCResult::Type::NUM, "time_left_in_cycle", "Seconds left in current time cycle"},
                         }},
+                       {RPCResult::Type::OBJ, "smsg", "Secure messaging relay traffic",
+                       {
+                           {RPCResult::Type::NUM, "inv_bytes_sent", "Bytes of bucket inventory sent"},
+                           {RPCResult::Type::NUM, "msg_bytes_sent", "Bytes of messages sent"},
+                           {RPCResult::Type::NUM, "inv_deferred", "Inventory sends held back by the upload limits"},
+                           {RPCResult::Type::NUM, "msg_deferred", "Message sends held back by the upload limits"},
+                           {RPCResult::Type::NUM, "target", "Target in bytes per 24h, 0 if unlimited (-smsgmaxuploadtarget)"},
+                           {RPCResult::Type::NUM, "peer_rate", "Limit in bytes per second sent to each peer, 0 if unlimited (-smsgpeeruploadrate)"},
+                        }},
                     }
                 },
                 RPCExamples{
@@ -501,6 +520,58 @@ static RPCHelpMan getnettotals()
     outboundLimit.pushKV("bytes_left_in_cycle", node.connman->GetOutboundTargetBytesLeft());
     outboundLimit.pushKV("time_left_in_cycle", node.connman->GetMaxOutboundTimeLeftInCycle());
     obj.pushKV("uploadtarget", outboundLimit);
+
+    UniValue smsg_totals(UniValue::VOBJ);
+    smsg_totals.pushKV("inv_bytes_sent", smsgModule.m_upload_inv_bytes.load());
+    smsg_totals.pushKV("msg_bytes_sent", smsgModule.m_upload_msg_bytes.load());
+    smsg_totals.pushKV("inv_deferred", smsgModule.m_upload_inv_deferred.load());
+    smsg_totals.pushKV("msg_deferred", smsgModule.m_upload_msg_deferred.load());
+    smsg_totals.pushKV("target", smsgModule.m_upload_target);
+    smsg_totals.pushKV("peer_rate", smsgModule.m_peer_upload_rate);
+    obj.pushKV("smsg", smsg_totals);
+    return obj;
+},
+    };
+}
+
+static RPCHelpMan getcompactblockstats()
+{
+    const std::vector<RPCResult> tx_counts{
+        {RPCResult::Type::NUM, "prefilled", "Transactions sent in the compact block"},
+        {RPCResult::Type::NUM, "mempool", "Transactions found in the mempool"},
+        {RPCResult::Type::NUM, "extra", "Transactions found in the extra pool of recently rejected and replaced transactions"},
+        {RPCResult::Type::NUM, "requested", "Transactions requested from the peer with getblocktxn"},
+    };
+    return RPCHelpMan{"getcompactblockstats",
+                "\nReturns where the transactions of compact blocks reconstructed since startup came from, by transaction type.\n",
+                {},
+                RPCResult{
+                   RPCResult::Type::OBJ, "", "",
+                   {
+                       {RPCResult::Type::NUM, "blocks", "Compact blocks reconstructed"},
+                       {RPCResult::Type::NUM, "blocks_without_request", "Compact blocks reconstructed without a getblocktxn round trip"},
+                       {RPCResult::Type::OBJ, "plain", "Transactions with only plain inputs and outputs", tx_counts},
+                       {RPCResult::Type::OBJ, "blind", "Transactions with blinded outputs", tx_counts},
+                       {RPCResult::Type::OBJ, "anon", "Transactions spending anon outputs", tx_counts},
+                    }
+                },
+                RPCExamples{
+                    HelpExampleCli("getcompactblockstats", "")
+            + HelpExampleRpc("getcompactblockstats", "")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("blocks", g_compact_block_stats.blocks.load());
+    obj.pushKV("blocks_without_request", g_compact_block_stats.blocks_no_request.load());
+    for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+        UniValue counts(UniValue::VOBJ);
+        counts.pushKV("prefilled", g_compact_block_stats.prefilled[i].load());
+        counts.pushKV("mempool", g_compact_block_stats.mempool[i].load());
+        counts.pushKV("extra", g_compact_block_stats.extra[i].load());
+        counts.pushKV("requested", g_compact_block_stats.requested[i].load());
+        obj.pushKV(StringForFeeEstimateTxType((FeeEstimateTxType)i), counts);
+    }
     return obj;
 },
     };
@@ -919,6 +990,7 @@ static const CRPCCommand commands[] =
     { "network",            "disconnectnode",         &disconnectnode,         {"address", "nodeid"} },
     { "network",            "getaddednodeinfo",       &getaddednodeinfo,       {"node"} },
     { "network",            "getnettotals",           &getnettotals,           {} },
+    { "network",            "getcompactblockstats",   &getcompactblockstats,   {} },
     { "network",            "getnetworkinfo",         &getnetworkinfo,         {} },
     { "network",            "setban",                 &setban,                 {"subnet", "command", "bantime", "absolute"} },
     { "network",            "listbanned",             &listbanned,             {} },
@@ -1045,21 +1045,25 @@ static RPCHelpMan testmempoolaccept()
                 "\nSee sendrawtransaction call.\n",
                 {
                     {"rawtxs", RPCArg::Type::ARR, RPCArg::Optional::NO, "An array of hex strings of raw transactions.\n"
-            "                                        Length must be one for now.",
+            "                                        More than one transaction is tested as a package, parents must come before\n"
+            "                                        their children and at most " + ToString(MAX_PACKAGE_COUNT) + " transactions are allowed.",
                         {
                             {"rawtx", RPCArg::Type::STR_HEX, RPCArg::Optional::OMITTED, ""},
                         },
                         },
                     {"maxfeerate", RPCArg::Type::AMOUNT, /* default */ FormatMoney(DEFAULT_MAX_RAW_TX_FEE_RATE.GetFeePerK()), "Reject transactions whose fee rate is higher than the specified value, expressed in " + CURRENCY_UNIT + "/kB\n"},
                     {"ignorelocks", RPCArg::Type::BOOL, /* default */ "false", "If true, ignore sequence locks when testing.\n"},
+                    {"independent", RPCArg::Type::BOOL, /* default */ "false", "If true, test each transaction on its own rather than as a package, up to " + ToString(MAX_INDEPENDENT_TEST_COUNT) + " transactions.\n"
+            "                                        The signatures, ring signatures and rangeproofs of all the transactions are verified together first."},
                 },
                 RPCResult{
                     RPCResult::Type::ARR, "", "The result of the mempool acceptance test for each raw transaction in the input array.\n"
-                        "Length is exactly one for now.",
+                        "Transactions of a package after the first one rejected only return their txid.",
                     {
                         {RPCResult::Type::OBJ, "", "",
                         {
                             {RPCResult::Type::STR_HEX, "txid", "The transaction hash in hex"},
+                            {RPCResult::Type::STR, "package-error", /* optional */ true, "Package validation error, if any"},
                             {RPCResult::Type::BOOL, "allowed", "If the mempool allows this tx to be inserted"},
                             {RPCResult::Type::NUM, "vsize", "Virtual transaction size as defined in BIP 141. This is different from actual serialized size for witness transactions as witness data is discounted (only present when 'allowed' is true)"},
                             {RPCResult::Type::OBJ, "fees", "Transaction fees (only present if 'allowed' is true)",
@@ -1067,6 +1071,7 @@ static RPCHelpMan testmempoolaccept()
                                 {RPCResult::Type::STR_AMOUNT, "base", "transaction fee in " + CURRENCY_UNIT},
                             }},
                             {RPCResult::Type::STR, "reject-reason", "Rejection string (only present when 'allowed' is false)"},
+                            {RPCResult::Type::NUM, "time", "Microseconds spent testing the transaction after the shared verification (only present when 'independent' is true)"},
                         }},
                     }
                 },
@@ -1086,18 +1091,25 @@ static RPCHelpMan testmempoolaccept()
         UniValue::VARR,
         UniValueType(), // VNUM or VSTR, checked inside AmountFromValue()
         UniValue::VBOOL,
+        UniValue::VBOOL,
     });
 
-    if (request.params[0].get_array().size() != 1) {
-        throw JSONRPCError(RPC_INVALID_PARAMETER, "Array must contain exactly one raw transaction for now");
+    const bool independent = !request.params[3].isNull() ? request.params[3].get_bool() : false;
+    const unsigned int max_count = independent ? MAX_INDEPENDENT_TEST_COUNT : MAX_PACKAGE_COUNT;
+    const UniValue& raw_transactions = request.params[0].get_array();
+    if (raw_transactions.size() < 1 || raw_transactions.size() > max_count) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER,
+                           "Array must contain between 1 and " + ToString(max_count) + " transactions.");
     }
 
-    CMutableTransaction mtx;
-    if (!DecodeHexTx(mtx, request.params[0].get_array()[0].get_str())) {
-        throw JSONRPCError(RPC_DESERIALIZATION_ERROR, "TX decode failed. Make sure the tx has at least one input.");
+    std::vector<CTransactionRef> txns;
+    for (const auto& rawtx : raw_transactions.getValues()) {
+        CMutableTransaction mtx;
+        if (!DecodeHexTx(mtx, rawtx.get_str())) {
+            throw JSONRPCError(RPC_DESERIALIZATION_ERROR, "TX decode failed: " + rawtx.get_str() + " Make sure the tx has at least one input.");
+        }
+        txns.emplace_back(MakeTransactionRef(std::move(mtx)));
     }
-    CTransactionRef tx(MakeTransactionRef(std::move(mtx)));
-    const uint256& tx_hash = tx->GetHash();
 
     const CFeeRate max_raw_tx_fee_rate = request.params[1].isNull() ?
                                              fParticlMode ? DEFAULT_MAX_RAW_TX_FEE_RATE : DEFAULT_MAX_RAW_TX_FEE_RATE_BTC :
@@ -1106,51 +1118,90 @@ static RPCHelpMan testmempoolaccept()
     bool ignore_locks = !request.params[2].isNull() ? request.params[2].get_bool() : false;
 
     CTxMemPool& mempool = EnsureMemPool(request.context);
-    int64_t virtual_size = GetVirtualTransactionSize(*tx);
-    CAmount max_raw_tx_fee = max_raw_tx_fee_rate.GetFee(virtual_size);
 
-    UniValue result(UniValue::VARR);
-    UniValue result_0(UniValue::VOBJ);
-    result_0.pushKV("txid", tx_hash.GetHex());
-
-    TxValidationState state;
-    bool test_accept_res;
-    CAmount fee{0};
-    {
+    TxValidationState package_state;
+    std::vector<TxValidationState> states(1);
+    std::vector<CAmount> fees(1, 0);
+    std::vector<int64_t> times;
+    bool test_accept_res = false;
+    if (independent) {
+        PreValidateTransactions(mempool, txns);
+        states.resize(txns.size());
+        fees.resize(txns.size(), 0);
         LOCK(cs_main);
-        test_accept_res = AcceptToMemoryPool(mempool, state, std::move(tx),
-            nullptr /* plTxnReplaced */, false /* bypass_limits */, /* test_accept */ true, &fee, /* ignore_locks */ ignore_locks);
-    }
-
-    // Check that fee does not exceed maximum fee
-    if (test_accept_res && max_raw_tx_fee && fee > max_raw_tx_fee) {
-        result_0.pushKV("allowed", false);
-        result_0.pushKV("reject-reason", "max-fee-exceeded");
-        result.push_back(std::move(result_0));
-        return result;
-    }
-    result_0.pushKV("allowed", test_accept_res);
-
-    // Only return the fee and vsize if the transaction would pass ATMP.
-    // These can be used to calculate the feerate.
-    if (test_accept_res) {
-        result_0.pushKV("vsize", virtual_size);
-        UniValue fees(UniValue::VOBJ);
-        fees.pushKV("base", ValueFromAmount(fee));
-        result_0.pushKV("fees", fees);
+        for (size_t i = 0; i < txns.size(); ++i) {
+            const int64_t start = GetTimeMicros();
+            AcceptToMemoryPool(mempool, states[i], txns[i],
+                nullptr /* plTxnReplaced */, false /* bypass_limits */, /* test_accept */ true, &fees[i], /* ignore_locks */ ignore_locks);
+            times.push_back(GetTimeMicros() - start);
+        }
     } else {
-        if (state.IsInvalid()) {
-            if (state.GetResult() == TxValidationResult::TX_MISSING_INPUTS) {
-                result_0.pushKV("reject-reason", "missing-inputs");
-            } else {
-                result_0.pushKV("reject-reason", strprintf("%s", state.GetRejectReason()));
-            }
+        LOCK(cs_main);
+        if (txns.size() == 1) {
+            test_accept_res = AcceptToMemoryPool(mempool, states[0], txns[0],
+                nullptr /* plTxnReplaced */, false /* bypass_limits */, /* test_accept */ true, &fees[0], /* ignore_locks */ ignore_locks);
         } else {
-            result_0.pushKV("reject-reason", state.GetRejectReason());
+            test_accept_res = ProcessNewPackage(mempool, txns, /* test_accept */ true, package_state, states, fees, ignore_locks);
         }
     }
 
-    result.push_back(std::move(result_0));
+    UniValue result(UniValue::VARR);
+    // Only a failed transaction fails a package after it was validated
+    const bool package_failed = package_state.IsInvalid() && package_state.GetRejectReason() != "package-tx-failed";
+    bool exit_early = false;
+    for (size_t i = 0; i < txns.size(); ++i) {
+        const CTransactionRef& tx = txns[i];
+        UniValue result_inner(UniValue::VOBJ);
+        result_inner.pushKV("txid", tx->GetHash().GetHex());
+        if (package_failed) {
+            result_inner.pushKV("package-error", package_state.GetRejectReason());
+        }
+        if (exit_early || package_failed || i >= states.size()) {
+            result.push_back(std::move(result_inner));
+            continue;
+        }
+        const TxValidationState& state = states[i];
+        const bool tx_valid = txns.size() == 1 && !independent ? test_accept_res : state.IsValid();
+        if (!tx_valid && !independent) {
+            exit_early = true;
+        }
+        if (independent) {
+            result_inner.pushKV("time", times[i]);
+        }
+
+        int64_t virtual_size = GetVirtualTransactionSize(*tx);
+        CAmount max_raw_tx_fee = max_raw_tx_fee_rate.GetFee(virtual_size);
+
+        // Check that fee does not exceed maximum fee
+        if (tx_valid && max_raw_tx_fee && fees[i] > max_raw_tx_fee) {
+            result_inner.pushKV("allowed", false);
+            result_inner.pushKV("reject-reason", "max-fee-exceeded");
+            result.push_back(std::move(result_inner));
+            exit_early = !independent;
+            continue;
+        }
+        result_inner.pushKV("allowed", tx_valid);
+
+        // Only return the fee and vsize if the transaction would pass ATMP.
+        // These can be used to calculate the feerate.
+        if (tx_valid) {
+            result_inner.pushKV("vsize", virtual_size);
+            UniValue fees_obj(UniValue::VOBJ);
+            fees_obj.pushKV("base", ValueFromAmount(fees[i]));
+            result_inner.pushKV("fees", fees_obj);
+        } else {
+            if (state.IsInvalid()) {
+                if (state.GetResult() == TxValidationResult::TX_MISSING_INPUTS) {
+                    result_inner.pushKV("reject-reason", "missing-inputs");
+                } else {
+                    result_inner.pushKV("reject-reason", strprintf("%s", state.GetRejectReason()));
+                }
+            } else {
+                result_inner.pushKV("reject-reason", state.GetRejectReason());
+            }
+        }
+        result.push_back(std::move(result_inner));
+    }
     return result;
 },
     };
@@ -2036,7 +2087,7 @@ static const CRPCCommand commands[] =
     { "rawtransactions",    "sendrawtransaction",           &sendrawtransaction,        {"hexstring","maxfeerate"} },
     { "rawtransactions",    "combinerawtransaction",        &combinerawtransaction,     {"txs"} },
     { "rawtransactions",    "signrawtransactionwithkey",    &signrawtransactionwithkey, {"hexstring","privkeys","prevtxs","sighashtype"} },
-    { "rawtransactions",    "testmempoolaccept",            &testmempoolaccept,         {"rawtxs","maxfeerate","ignorelocks"} },
+    { "rawtransactions",    "testmempoolaccept",            &testmempoolaccept,         {"rawtxs","maxfeerate","ignorelocks","independent"} },
     { "rawtransactions",    "decodepsbt",                   &decodepsbt,                {"psbt"} },
     { "rawtransactions",    "combinepsbt",                  &combinepsbt,               {"txs"} },
     { "rawtransactions",    "finalizepsbt",                 &finalizepsbt,              {"psbt", "extract"} },
@@ -23,6 +23,8 @@ void RegisterRawTransactionRPCCommands(CRPCTable &tableRPC);
 void RegisterMnemonicRPCCommands(CRPCTable &tableRPC);
 /** Register anon RPC commands */
 void RegisterAnonRPCCommands(CRPCTable &tableRPC);
+/** Register stealth scan server RPC commands */
+void RegisterStealthScanRPCCommands(CRPCTable &tableRPC);
 
 
 static inline void RegisterAllCoreRPCCommands(CRPCTable &t)
@@ -34,6 +36,7 @@ static inline void RegisterAllCoreRPCCommands(CRPCTable &t)
     RegisterRawTransactionRPCCommands(t);
     RegisterMnemonicRPCCommands(t);
     RegisterAnonRPCCommands(t);
+    RegisterStealthScanRPCCommands(t);
 }
 
 #endif // BITCOIN_RPC_REGISTER_H
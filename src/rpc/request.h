@@ -14,6 +14,8 @@ namespace util {
 class Ref;
 } // namespace util
 
+class JSONStreamWriter;
+
 UniValue JSONRPCRequestObj(const std::string& strMethod, const UniValue& params, const UniValue& id);
 UniValue JSONRPCReplyObj(const UniValue& result, const UniValue& error, const UniValue& id);
 std::string JSONRPCReply(const UniValue& result, const UniValue& error, const UniValue& id);
@@ -39,6 +41,9 @@ public:
     std::string URI;
     std::string authUser;
     std::string peerAddr;
+    //! Set when the transport sends the result as it's written. A handler may write its
+    //! result here instead of returning it, it should then return NullUniValue.
+    JSONStreamWriter* stream{nullptr};
     const util::Ref& context;
 
     JSONRPCRequest(const util::Ref& context) : id(NullUniValue), params(NullUniValue), fHelp(false), context(context) {}
@@ -48,7 +53,7 @@ public:
     //! added or removed above.
     JSONRPCRequest(const JSONRPCRequest& other, const util::Ref& context)
         : id(other.id), strMethod(other.strMethod), params(other.params), fHelp(other.fHelp), URI(other.URI),
-          authUser(other.authUser), peerAddr(other.peerAddr), context(context)
+          authUser(other.authUser), peerAddr(other.peerAddr), stream(other.stream), context(context)
     {
     }
 
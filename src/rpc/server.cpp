@@ -5,6 +5,8 @@
 
 #include <rpc/server.h>
 
+#include <httpserver.h>
+
 #include <rpc/util.h>
 #include <shutdown.h>
 #include <sync.h>
@@ -15,7 +17,9 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/signals2/signal.hpp>
 
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <memory> // for unique_ptr
 #include <mutex>
 #include <unordered_map>
@@ -216,6 +220,43 @@ static RPCHelpMan getrpcinfo()
                             }},
                         }},
                         {RPCResult::Type::STR, "logpath", "The complete file path to the debug log"},
+                        {RPCResult::Type::ARR, "work_queues", "The HTTP work queue classes, default first",
+                        {
+                            {RPCResult::Type::OBJ, "", "",
+                            {
+                                 {RPCResult::Type::STR, "name", "The queue class"},
+                                 {RPCResult::Type::NUM, "threads", "Worker threads serving the queue"},
+                                 {RPCResult::Type::NUM, "depth", "Requests waiting for a worker"},
+                                 {RPCResult::Type::NUM, "max_depth", "Requests that can wait before new ones are rejected"},
+                                 {RPCResult::Type::NUM, "served", "Requests taken by a worker"},
+                                 {RPCResult::Type::NUM, "rejected", "Requests rejected because the queue was full"},
+                                 {RPCResult::Type::NUM, "wait_max", "Longest wait for a worker in microseconds"},
+                                 {RPCResult::Type::ARR, "wait_histogram", "Requests by wait for a worker",
+                                 {
+                                     {RPCResult::Type::OBJ, "", "",
+                                     {
+                                         {RPCResult::Type::NUM, "le", /* optional */ true, "Upper bound of the wait in microseconds, absent for the last bucket"},
+                                         {RPCResult::Type::NUM, "count", "Requests in the bucket"},
+                                     }},
+                                 }},
+                            }},
+                        }},
+                        {RPCResult::Type::OBJ, "connections", "The HTTP connections",
+                        {
+                            {RPCResult::Type::NUM, "open", "Connections open"},
+                            {RPCResult::Type::NUM, "accepted", "Connections that sent a request"},
+                            {RPCResult::Type::NUM, "refused", "Connections closed because -rpcmaxconnections were open"},
+                            {RPCResult::Type::NUM, "requests", "Requests received"},
+                            {RPCResult::Type::NUM, "reused", "Requests on a connection that served a request before"},
+                            {RPCResult::Type::ARR, "requests_histogram", "Closed connections by the requests they served",
+                            {
+                                {RPCResult::Type::OBJ, "", "",
+                                {
+                                    {RPCResult::Type::NUM, "le", /* optional */ true, "Upper bound of the requests, absent for the last bucket"},
+                                    {RPCResult::Type::NUM, "count", "Connections in the bucket"},
+                                }},
+                            }},
+                        }},
                     }
                 },
                 RPCExamples{
@@ -239,6 +280,49 @@ static RPCHelpMan getrpcinfo()
     UniValue log_path(UniValue::VSTR, path);
     result.pushKV("logpath", log_path);
 
+    UniValue work_queues(UniValue::VARR);
+    for (const HTTPWorkQueueStats& stats : GetHTTPWorkQueueStats()) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("name", stats.name);
+        entry.pushKV("threads", stats.threads);
+        entry.pushKV("depth", (uint64_t)stats.depth);
+        entry.pushKV("max_depth", (uint64_t)stats.max_depth);
+        entry.pushKV("served", stats.served);
+        entry.pushKV("rejected", stats.rejected);
+        entry.pushKV("wait_max", stats.wait_max);
+        UniValue histogram(UniValue::VARR);
+        for (size_t i = 0; i < stats.wait_histogram.size(); ++i) {
+            UniValue bucket(UniValue::VOBJ);
+            if (i < HTTP_QUEUE_WAIT_BOUNDS.size()) {
+                bucket.pushKV("le", HTTP_QUEUE_WAIT_BOUNDS[i]);
+            }
+            bucket.pushKV("count", stats.wait_histogram[i]);
+            histogram.push_back(bucket);
+        }
+        entry.pushKV("wait_histogram", histogram);
+        work_queues.push_back(entry);
+    }
+    result.pushKV("work_queues", work_queues);
+
+    const HTTPConnectionStats conn_stats = GetHTTPConnectionStats();
+    UniValue connections(UniValue::VOBJ);
+    connections.pushKV("open", (uint64_t)conn_stats.open);
+    connections.pushKV("accepted", conn_stats.accepted);
+    connections.pushKV("refused", conn_stats.refused);
+    connections.pushKV("requests", conn_stats.requests);
+    connections.pushKV("reused", conn_stats.reused);
+    UniValue requests_histogram(UniValue::VARR);
+    for (size_t i = 0; i < conn_stats.requests_histogram.size(); ++i) {
+        UniValue bucket(UniValue::VOBJ);
+        if (i < HTTP_CONN_REQUEST_BOUNDS.size()) {
+            bucket.pushKV("le", HTTP_CONN_REQUEST_BOUNDS[i]);
+        }
+        bucket.pushKV("count", conn_stats.requests_histogram[i]);
+        requests_histogram.push_back(bucket);
+    }
+    connections.pushKV("requests_histogram", requests_histogram);
+    result.pushKV("connections", connections);
+
     return result;
 }
     };
@@ -375,12 +459,82 @@ static UniValue JSONRPCExecOne(JSONRPCRequest jreq, const UniValue& req)
     return rpc_result;
 }
 
+/** Whether the entries of a batch can run at the same time, wallet and smsg calls often depend on the calls before them */
+static bool IsParallelBatch(const UniValue& vReq)
+{
+    for (unsigned int reqIdx = 0; reqIdx < vReq.size(); reqIdx++) {
+        if (!vReq[reqIdx].isObject()) {
+            continue;
+        }
+        const UniValue& method = find_value(vReq[reqIdx].get_obj(), "method");
+        if (!method.isStr()) {
+            continue;
+        }
+        const std::string category = tableRPC.commandCategory(method.get_str());
+        if (category == "wallet" || category == "smsg") {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** A batch whose entries are claimed in order by the calling thread and by helpers on the HTTP workers */
+struct ParallelBatch
+{
+    ParallelBatch(const JSONRPCRequest& jreq_in, const UniValue& vReq_in)
+        : jreq(jreq_in), vReq(vReq_in), size(vReq_in.size()), results(vReq_in.size()) {}
+
+    //! Only used while an entry is unfinished, the caller waits for all of them
+    const JSONRPCRequest& jreq;
+    const UniValue& vReq;
+    const size_t size;
+    std::atomic<size_t> next{0};
+    Mutex mutex;
+    std::condition_variable cond;
+    std::vector<UniValue> results GUARDED_BY(mutex);
+    size_t done GUARDED_BY(mutex){0};
+
+    void Run()
+    {
+        size_t reqIdx;
+        while ((reqIdx = next++) < size) {
+            UniValue result = JSONRPCExecOne(jreq, vReq[reqIdx]);
+            LOCK(mutex);
+            results[reqIdx] = std::move(result);
+            if (++done == size) {
+                cond.notify_all();
+            }
+        }
+    }
+};
+
 std::string JSONRPCExecBatch(const JSONRPCRequest& jreq, const UniValue& vReq)
 {
     UniValue ret(UniValue::VARR);
-    for (unsigned int reqIdx = 0; reqIdx < vReq.size(); reqIdx++)
-        ret.push_back(JSONRPCExecOne(jreq, vReq[reqIdx]));
+    const int64_t concurrency = gArgs.GetArg("-rpcbatchconcurrency", DEFAULT_RPC_BATCH_CONCURRENCY);
+    if (concurrency < 2 || vReq.size() < 2 || !IsParallelBatch(vReq)) {
+        for (unsigned int reqIdx = 0; reqIdx < vReq.size(); reqIdx++)
+            ret.push_back(JSONRPCExecOne(jreq, vReq[reqIdx]));
 
+        return ret.write() + "\n";
+    }
+
+    // Helpers that find the work queue full or start after the last entry was
+    // claimed do nothing, this thread runs whatever is left
+    auto batch = std::make_shared<ParallelBatch>(jreq, vReq);
+    const size_t helpers = std::min<size_t>(concurrency - 1, vReq.size() - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        if (!EnqueueHTTPTask([batch] { batch->Run(); })) {
+            break;
+        }
+    }
+    batch->Run();
+
+    WAIT_LOCK(batch->mutex, lock);
+    batch->cond.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(batch->mutex) { return batch->done == batch->size; });
+    for (UniValue& result : batch->results) {
+        ret.push_back(std::move(result));
+    }
     return ret.write() + "\n";
 }
 
@@ -481,6 +635,15 @@ std::vector<std::string> CRPCTable::listCommands() const
     return commandList;
 }
 
+std::string CRPCTable::commandCategory(const std::string& name) const
+{
+    auto it = mapCommands.find(name);
+    if (it == mapCommands.end() || it->second.empty()) {
+        return "";
+    }
+    return it->second.front()->category;
+}
+
 void RPCSetTimerInterfaceIfUnset(RPCTimerInterface *iface)
 {
     if (!timerInterface)
@@ -18,6 +18,8 @@
 #include <univalue.h>
 
 static const unsigned int DEFAULT_RPC_SERIALIZE_VERSION = 1;
+//! Entries of a JSON-RPC batch run at the same time, 1 runs them one after another
+static const int DEFAULT_RPC_BATCH_CONCURRENCY = 4;
 
 class CRPCCommand;
 
@@ -157,6 +159,11 @@ public:
     */
     std::vector<std::string> listCommands() const;
 
+    /**
+    * Returns the category of a command, empty when it's not registered.
+    */
+    std::string commandCategory(const std::string& name) const;
+
 
     /**
      * Appends a CRPCCommand to the dispatch table.
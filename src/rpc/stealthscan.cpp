@@ -0,0 +1,211 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <key_io.h>
+#include <node/stealthscan.h>
+#include <rpc/server.h>
+#include <rpc/util.h>
+#include <util/strencodings.h>
+
+#include <univalue.h>
+
+static uint256 ParseScanKeyId(const UniValue &v)
+{
+    return ParseHashV(v, "id");
+}
+
+static RPCHelpMan registerscankey()
+{
+    return RPCHelpMan{"registerscankey",
+        "\nRegister the scan key of a stealth address with the stealth scan server (-stealthscanserver).\n"
+        "New blocks and mempool transactions are scanned for outputs paying it, which getscanmatches and\n"
+        "the stealthmatch ZMQ topic report. The spend key is not needed and the server can't spend.\n"
+        "Keys are only held in memory, earlier blocks are not scanned.\n",
+        {
+            {"address", RPCArg::Type::STR, RPCArg::Optional::NO, "The stealth address."},
+            {"scan_secret", RPCArg::Type::STR, RPCArg::Optional::NO, "The hex or WIF encoded scan secret of the address."},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::STR_HEX, "id", "The id of the key, the same for each registration of an address"},
+            }},
+        RPCExamples{
+            HelpExampleCli("registerscankey", "\"address\" \"scan_secret\"")
+            + HelpExampleRpc("registerscankey", "\"address\", \"scan_secret\"")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    CStealthAddress sx;
+    if (!sx.SetEncoded(request.params[0].get_str())) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid stealth address");
+    }
+
+    const std::string &secret = request.params[1].get_str();
+    if (IsHex(secret)) {
+        std::vector<uint8_t> vch = ParseHex(secret);
+        if (vch.size() != 32) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Scan secret is not 32 bytes");
+        }
+        sx.scan_secret.Set(vch.begin(), vch.end(), true);
+    } else {
+        sx.scan_secret = DecodeSecret(secret);
+    }
+
+    uint256 id;
+    std::string error;
+    if (!g_stealth_scan_server.AddKey(sx, id, error)) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, error);
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("id", id.GetHex());
+    return result;
+},
+    };
+}
+
+static RPCHelpMan unregisterscankey()
+{
+    return RPCHelpMan{"unregisterscankey",
+        "\nRemove a key from the stealth scan server, dropping its matches.\n",
+        {
+            {"id", RPCArg::Type::STR_HEX, RPCArg::Optional::NO, "The id returned by registerscankey."},
+        },
+        RPCResult{RPCResult::Type::BOOL, "", "false if the key was not registered"},
+        RPCExamples{
+            HelpExampleCli("unregisterscankey", "\"id\"")
+            + HelpExampleRpc("unregisterscankey", "\"id\"")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    return g_stealth_scan_server.RemoveKey(ParseScanKeyId(request.params[0]));
+},
+    };
+}
+
+static RPCHelpMan getscanmatches()
+{
+    return RPCHelpMan{"getscanmatches",
+        "\nGet the outputs found for a registered scan key after seq after, acknowledging and dropping those up to it.\n"
+        "With a timeout, waits for a match when there are none.\n",
+        {
+            {"id", RPCArg::Type::STR_HEX, RPCArg::Optional::NO, "The id returned by registerscankey."},
+            {"after", RPCArg::Type::NUM, /* default */ "0", "Return matches with a greater seq, pass the last seq handled."},
+            {"timeout", RPCArg::Type::NUM, /* default */ "0", strprintf("Seconds to wait for a match, up to %d.", MAX_STEALTH_SCAN_WAIT)},
+        },
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::NUM, "last", "The seq of the newest match of the server, for the next call when there are no matches"},
+                {RPCResult::Type::ARR, "matches", "",
+                {
+                    {RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::NUM, "seq", "The seq of the match"},
+                        {RPCResult::Type::STR_HEX, "txid", "The transaction id"},
+                        {RPCResult::Type::NUM, "n", "The output index"},
+                        {RPCResult::Type::STR, "type", "standard, blind or anon"},
+                        {RPCResult::Type::NUM, "height", "The height of the block, -1 for a mempool transaction"},
+                        {RPCResult::Type::STR_HEX, "blockhash", /* optional */ true, "The block hash"},
+                    }},
+                }},
+            }},
+        RPCExamples{
+            HelpExampleCli("getscanmatches", "\"id\" 0 60")
+            + HelpExampleRpc("getscanmatches", "\"id\", 0, 60")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    const uint256 id = ParseScanKeyId(request.params[0]);
+    const int64_t after = request.params[1].isNull() ? 0 : request.params[1].get_int64();
+    const int64_t timeout = request.params[2].isNull() ? 0 : request.params[2].get_int64();
+    if (after < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "after can't be negative");
+    }
+    if (timeout < 0 || timeout > MAX_STEALTH_SCAN_WAIT) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("timeout must be between 0 and %d", MAX_STEALTH_SCAN_WAIT));
+    }
+
+    std::vector<StealthScanMatch> matches;
+    uint64_t last;
+    if (!g_stealth_scan_server.GetMatches(id, after, std::chrono::seconds{timeout}, matches, last)) {
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Unknown scan key");
+    }
+
+    UniValue arr(UniValue::VARR);
+    for (const auto &match : matches) {
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("seq", match.seq);
+        entry.pushKV("txid", match.txid.GetHex());
+        entry.pushKV("n", (int)match.n);
+        entry.pushKV("type", match.type == OUTPUT_CT ? "blind" : match.type == OUTPUT_RINGCT ? "anon" : "standard");
+        entry.pushKV("height", match.height);
+        if (match.height >= 0) {
+            entry.pushKV("blockhash", match.block_hash.GetHex());
+        }
+        arr.push_back(entry);
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("last", last);
+    result.pushKV("matches", arr);
+    return result;
+},
+    };
+}
+
+static RPCHelpMan getscanserverinfo()
+{
+    return RPCHelpMan{"getscanserverinfo",
+        "\nReturns the state of the stealth scan server.\n",
+        {},
+        RPCResult{
+            RPCResult::Type::OBJ, "", "",
+            {
+                {RPCResult::Type::BOOL, "enabled", "Whether -stealthscanserver is set"},
+                {RPCResult::Type::NUM, "keys", "Registered scan keys"},
+                {RPCResult::Type::NUM, "blocks", "Blocks scanned"},
+                {RPCResult::Type::NUM, "transactions", "Transactions scanned, from blocks and the mempool"},
+                {RPCResult::Type::NUM, "outputs", "Stealth outputs decoded"},
+                {RPCResult::Type::NUM, "matches", "Outputs found"},
+                {RPCResult::Type::NUM, "scan_time", "Microseconds spent scanning"},
+            }},
+        RPCExamples{
+            HelpExampleCli("getscanserverinfo", "")
+            + HelpExampleRpc("getscanserverinfo", "")
+        },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    const StealthScanServer::Stats stats = g_stealth_scan_server.GetStats();
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("enabled", stats.running);
+    result.pushKV("keys", (uint64_t)stats.keys);
+    result.pushKV("blocks", stats.blocks);
+    result.pushKV("transactions", stats.txns);
+    result.pushKV("outputs", stats.outputs);
+    result.pushKV("matches", stats.matches);
+    result.pushKV("scan_time", stats.scan_time);
+    return result;
+},
+    };
+}
+
+void RegisterStealthScanRPCCommands(CRPCTable &t)
+{
+// clang-format off
+static const CRPCCommand commands[] =
+{ //  category              name                      actor (function)         argNames
+  //  --------------------- ------------------------  -----------------------  ----------
+    { "stealthscan",        "registerscankey",        &registerscankey,        {"address","scan_secret"} },
+    { "stealthscan",        "unregisterscankey",      &unregisterscankey,      {"id"} },
+    { "stealthscan",        "getscanmatches",         &getscanmatches,         {"id","after","timeout"} },
+    { "stealthscan",        "getscanserverinfo",      &getscanserverinfo,      {} },
+};
+// clang-format on
+    for (const auto& c : commands) {
+        t.appendCommand(c.name, &c);
+    }
+}
@@ -1473,6 +1473,10 @@ void PrecomputedTransactionData::Init(const T& txTo, std::vector<CTxOutSign>&& s
     // Determine which precomputation-impacting features this transaction uses.
     bool uses_bip143_segwit = false;
     bool uses_bip341_taproot = false;
+    // Particl transactions hash every input the BIP143 way, signed or not
+    if (txTo.IsParticlVersion()) {
+        uses_bip143_segwit = true;
+    }
     for (size_t inpos = 0; inpos < txTo.vin.size(); ++inpos) {
         if (!txTo.vin[inpos].scriptWitness.IsNull()) {
             if (m_spent_outputs_ready && m_spent_outputs[inpos].scriptPubKey.size() == 2 + WITNESS_V1_TAPROOT_SIZE &&
@@ -1697,6 +1701,10 @@ uint256 SignatureHash(const CScript& scriptCode, const T& txTo, unsigned int nIn
 template <class T>
 bool GenericTransactionSignatureChecker<T>::VerifyECDSASignature(const std::vector<unsigned char>& vchSig, const CPubKey& pubkey, const uint256& sighash) const
 {
+    // Coinstake inputs are signed by the same staking keys, including the cold staking path
+    if (txTo->IsCoinStake()) {
+        return pubkey.VerifyCached(sighash, vchSig);
+    }
     return pubkey.Verify(sighash, vchSig);
 }
 
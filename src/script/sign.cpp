@@ -11,11 +11,14 @@
 #include <script/signingprovider.h>
 #include <script/standard.h>
 #include <uint256.h>
+#include <util/taskpool.h>
 
 extern bool fParticlMode;
 typedef std::vector<unsigned char> valtype;
 
-MutableTransactionSignatureCreator::MutableTransactionSignatureCreator(const CMutableTransaction* txToIn, unsigned int nInIn, const std::vector<uint8_t>& amountIn, int nHashTypeIn) : txTo(txToIn), nIn(nInIn), nHashType(nHashTypeIn), amount(amountIn), checker(txTo, nIn, amountIn) {}
+MutableTransactionSignatureCreator::MutableTransactionSignatureCreator(const CMutableTransaction* txToIn, unsigned int nInIn, const std::vector<uint8_t>& amountIn, int nHashTypeIn, const PrecomputedTransactionData* txdataIn)
+    : txTo(txToIn), nIn(nInIn), nHashType(nHashTypeIn), amount(amountIn), txdata(txdataIn),
+      checker(txdataIn ? MutableTransactionSignatureChecker(txTo, nIn, amountIn, *txdataIn) : MutableTransactionSignatureChecker(txTo, nIn, amountIn)) {}
 
 bool MutableTransactionSignatureCreator::CreateSig(const SigningProvider& provider, std::vector<unsigned char>& vchSig, const CKeyID& address, const CScript& scriptCode, SigVersion sigversion) const
 {
@@ -27,7 +30,7 @@ bool MutableTransactionSignatureCreator::CreateSig(const SigningProvider& provid
     if (sigversion == SigVersion::WITNESS_V0 && !key.IsCompressed())
         return false;
 
-    uint256 hash = SignatureHash(scriptCode, *txTo, nIn, nHashType, amount, sigversion);
+    uint256 hash = SignatureHash(scriptCode, *txTo, nIn, nHashType, amount, sigversion, txdata);
     if (!key.Sign(hash, vchSig))
         return false;
     vchSig.push_back((unsigned char)nHashType);
@@ -522,6 +525,58 @@ public:
     bool IsParticlVersion() const override { return true; }
 };
 
+/** Passes what it finds in a provider on, keeping a copy. */
+class RecordingSigningProvider : public SigningProvider
+{
+    const SigningProvider& m_provider;
+    FlatSigningProvider& m_out;
+
+public:
+    RecordingSigningProvider(const SigningProvider& provider, FlatSigningProvider& out) : m_provider(provider), m_out(out) {}
+    bool GetCScript(const CScriptID& scriptid, CScript& script) const override
+    {
+        if (!m_provider.GetCScript(scriptid, script)) return false;
+        m_out.scripts[scriptid] = script;
+        return true;
+    }
+    bool GetPubKey(const CKeyID& keyid, CPubKey& pubkey) const override
+    {
+        if (!m_provider.GetPubKey(keyid, pubkey)) return false;
+        m_out.pubkeys[keyid] = pubkey;
+        return true;
+    }
+    bool GetKey(const CKeyID& keyid, CKey& key) const override
+    {
+        if (!m_provider.GetKey(keyid, key)) return false;
+        m_out.keys[keyid] = key;
+        return true;
+    }
+    bool GetKeyOrigin(const CKeyID& keyid, KeyOriginInfo& info) const override
+    {
+        if (!m_provider.GetKeyOrigin(keyid, info)) return false;
+        m_out.origins[keyid].second = info;
+        return true;
+    }
+};
+
+/** Takes the keys a creator would sign with, making dummy signatures. */
+class GatheringSignatureCreator : public DummySignatureCreator {
+    const BaseSignatureCreator& m_creator;
+
+public:
+    explicit GatheringSignatureCreator(const BaseSignatureCreator& creator) : DummySignatureCreator(32, 32), m_creator(creator) {}
+    const BaseSignatureChecker& Checker() const override { return m_creator.IsParticlVersion() ? DUMMY_CHECKER_PARTICL : DUMMY_CHECKER; }
+    bool IsParticlVersion() const override { return m_creator.IsParticlVersion(); }
+    bool IsCoinStake() const override { return m_creator.IsCoinStake(); }
+    bool CreateSig(const SigningProvider& provider, std::vector<unsigned char>& vchSig, const CKeyID& keyid, const CScript& scriptCode, SigVersion sigversion) const override
+    {
+        CKey key;
+        if (!provider.GetKey(keyid, key)) return false;
+        if (sigversion == SigVersion::WITNESS_V0 && !key.IsCompressed()) return false;
+        return DummySignatureCreator::CreateSig(provider, vchSig, keyid, scriptCode, sigversion);
+    }
+};
+
 template<typename M, typename K, typename V>
 bool LookupHelper(const M& map, const K& key, V& value)
 {
@@ -539,6 +594,12 @@ const BaseSignatureCreator& DUMMY_SIGNATURE_CREATOR = DummySignatureCreator(32,
 const BaseSignatureCreator& DUMMY_MAXIMUM_SIGNATURE_CREATOR = DummySignatureCreator(33, 32);
 const BaseSignatureCreator& DUMMY_SIGNATURE_CREATOR_PARTICL = DummySignatureCreatorParticl();
 
+void GatherSigningProvider(const SigningProvider& provider, const BaseSignatureCreator& creator, const CScript& scriptPubKey, const SignatureData& sigdata, FlatSigningProvider& out)
+{
+    SignatureData sigdata_copy = sigdata;
+    ProduceSignature(RecordingSigningProvider(provider, out), GatheringSignatureCreator(creator), scriptPubKey, sigdata_copy);
+}
+
 bool IsSolvable(const SigningProvider& provider, const CScript& script)
 {
     // This check is to make sure that the script we created can actually be solved for and signed by us
@@ -581,56 +642,93 @@ bool SignTransaction(CMutableTransaction& mtx, const SigningProvider* keystore,
     // Use CTransaction for the constant parts of the
     // transaction to avoid rehashing.
     const CTransaction txConst(mtx);
-    // Sign what we can:
+    // The midstates shared by the inputs are hashed once
+    const PrecomputedTransactionData txdata(txConst);
+
+    struct InputSigning {
+        bool found{false};
+        CAmount amount;
+        std::vector<uint8_t> vchAmount;
+        const CScript* prevPubKey{nullptr};
+        SignatureData sigdata;
+        std::string error;
+    };
+    std::vector<InputSigning> inputs(mtx.vin.size());
+
+    // Look up what each input needs from keystore here, it may take locks
+    // the caller holds
+    FlatSigningProvider keys;
     for (unsigned int i = 0; i < mtx.vin.size(); i++) {
-        CTxIn& txin = mtx.vin[i];
-        auto coin = coins.find(txin.prevout);
+        InputSigning& input = inputs[i];
+        auto coin = coins.find(mtx.vin[i].prevout);
         if (coin == coins.end() || coin->second.IsSpent()) {
             input_errors[i] = "Input not found or already spent";
             continue;
         }
-        const CScript& prevPubKey = coin->second.out.scriptPubKey;
-        CAmount amount;
-        std::vector<uint8_t> vchAmount;
+        input.prevPubKey = &coin->second.out.scriptPubKey;
         if (coin->second.nType == OUTPUT_STANDARD) {
-            amount = coin->second.out.nValue;
-            vchAmount.resize(8);
-            part::SetAmount(vchAmount, coin->second.out.nValue);
+            input.amount = coin->second.out.nValue;
+            input.vchAmount.resize(8);
+            part::SetAmount(input.vchAmount, coin->second.out.nValue);
         } else
         if (coin->second.nType == OUTPUT_CT) {
-            amount = 0; // Bypass amount check
-            vchAmount.resize(33);
-            memcpy(vchAmount.data(), coin->second.commitment.data, 33);
+            input.amount = 0; // Bypass amount check
+            input.vchAmount.resize(33);
+            memcpy(input.vchAmount.data(), coin->second.commitment.data, 33);
         } else {
             input_errors[i] = "Bad input type";
             continue;
         }
+        input.found = true;
 
-        SignatureData sigdata = DataFromTransaction(mtx, i, vchAmount, prevPubKey);
+        input.sigdata = DataFromTransaction(mtx, i, input.vchAmount, *input.prevPubKey);
         // Only sign SIGHASH_SINGLE if there's a corresponding output:
         if (!fHashSingle || (i < mtx.GetNumVOuts())) {
-            ProduceSignature(*keystore, MutableTransactionSignatureCreator(&mtx, i, vchAmount, nHashType), prevPubKey, sigdata);
+            GatherSigningProvider(*keystore, MutableTransactionSignatureCreator(&mtx, i, input.vchAmount, nHashType), *input.prevPubKey, input.sigdata, keys);
         }
+    }
 
-        UpdateInput(txin, sigdata);
+    // Sign what we can, each input only writes its own entry
+    g_task_pool.ParallelFor(TaskPriority::HIGH, inputs.size(), [&](size_t i) {
+        InputSigning& input = inputs[i];
+        if (!input.found) {
+            return;
+        }
+        if (!fHashSingle || (i < mtx.GetNumVOuts())) {
+            ProduceSignature(keys, MutableTransactionSignatureCreator(&mtx, i, input.vchAmount, nHashType, &txdata), *input.prevPubKey, input.sigdata);
+        }
+
+        CTxIn txin(mtx.vin[i].prevout, CScript(), mtx.vin[i].nSequence);
+        UpdateInput(txin, input.sigdata);
 
         // amount must be specified for valid segwit signature
-        if (amount == MAX_MONEY && !txin.scriptWitness.IsNull()) {
-            input_errors[i] = "Missing amount";
-            continue;
+        if (input.amount == MAX_MONEY && !txin.scriptWitness.IsNull()) {
+            input.error = "Missing amount";
+            return;
         }
 
         ScriptError serror = SCRIPT_ERR_OK;
-        if (!VerifyScript(txin.scriptSig, prevPubKey, &txin.scriptWitness, STANDARD_SCRIPT_VERIFY_FLAGS, TransactionSignatureChecker(&txConst, i, vchAmount), &serror)) {
+        if (!VerifyScript(txin.scriptSig, *input.prevPubKey, &txin.scriptWitness, STANDARD_SCRIPT_VERIFY_FLAGS, TransactionSignatureChecker(&txConst, i, input.vchAmount, txdata), &serror)) {
             if (serror == SCRIPT_ERR_INVALID_STACK_OPERATION) {
                 // Unable to sign input and verification failed (possible attempt to partially sign).
-                input_errors[i] = "Unable to sign input, invalid stack size (possibly missing key)";
+                input.error = "Unable to sign input, invalid stack size (possibly missing key)";
             } else if (serror == SCRIPT_ERR_SIG_NULLFAIL) {
                 // Verification failed (possibly due to insufficient signatures).
-                input_errors[i] = "CHECK(MULTI)SIG failing with non-zero signature (possibly need more signatures)";
+                input.error = "CHECK(MULTI)SIG failing with non-zero signature (possibly need more signatures)";
             } else {
-                input_errors[i] = ScriptErrorString(serror);
+                input.error = ScriptErrorString(serror);
             }
+        }
+    });
+
+    for (unsigned int i = 0; i < mtx.vin.size(); i++) {
+        const InputSigning& input = inputs[i];
+        if (!input.found) {
+            continue;
+        }
+        UpdateInput(mtx.vin[i], input.sigdata);
+        if (!input.error.empty()) {
+            input_errors[i] = input.error;
         } else {
             // If this input succeeds, make sure there is no error set for it
             input_errors.erase(i);
@@ -22,6 +22,7 @@ class CTransaction;
 class SigningProvider;
 
 struct CMutableTransaction;
+struct FlatSigningProvider;
 
 /** Interface for signature creators. */
 class BaseSignatureCreator {
@@ -42,10 +43,12 @@ class MutableTransactionSignatureCreator : public BaseSignatureCreator {
     unsigned int nIn;
     int nHashType;
     std::vector<uint8_t> amount;
+    const PrecomputedTransactionData* txdata;
     const MutableTransactionSignatureChecker checker;
 
 public:
-    MutableTransactionSignatureCreator(const CMutableTransaction* txToIn, unsigned int nInIn, const std::vector<uint8_t>& amountIn, int nHashTypeIn = SIGHASH_ALL);
+    /** txdata, when set, must be computed from txTo and outlive the creator. */
+    MutableTransactionSignatureCreator(const CMutableTransaction* txToIn, unsigned int nInIn, const std::vector<uint8_t>& amountIn, int nHashTypeIn = SIGHASH_ALL, const PrecomputedTransactionData* txdataIn = nullptr);
     const BaseSignatureChecker& Checker() const override { return checker; }
     bool CreateSig(const SigningProvider& provider, std::vector<unsigned char>& vchSig, const CKeyID& keyid, const CScript& scriptCode, SigVersion sigversion) const override;
 
@@ -160,6 +163,13 @@ void SerializeHDKeypaths(Stream& s, const std::map<CPubKey, KeyOriginInfo>& hd_k
 /** Produce a script signature using a generic signature creator. */
 bool ProduceSignature(const SigningProvider& provider, const BaseSignatureCreator& creator, const CScript& scriptPubKey, SignatureData& sigdata);
 
+/**
+ * Copy what ProduceSignature would look up in provider to sign scriptPubKey
+ * with creator into out, without making signatures. Signing from out needs
+ * none of the locks of provider, so inputs can be signed on other threads.
+ */
+void GatherSigningProvider(const SigningProvider& provider, const BaseSignatureCreator& creator, const CScript& scriptPubKey, const SignatureData& sigdata, FlatSigningProvider& out);
+
 /** Produce a script signature for a transaction. */
 bool SignSignature(const SigningProvider &provider, const CScript& fromPubKey, CMutableTransaction& txTo, unsigned int nIn, const std::vector<uint8_t>& amount, int nHashType);
 bool SignSignature(const SigningProvider &provider, const CScript& fromPubKey, CMutableTransaction& txTo, unsigned int nIn, CAmount amount, int nHashType);
@@ -179,7 +189,7 @@ bool IsSolvable(const SigningProvider& provider, const CScript& script);
 /** Check whether a scriptPubKey is known to be segwit. */
 bool IsSegWitOutput(const SigningProvider& provider, const CScript& script);
 
-/** Sign the CMutableTransaction */
+/** Sign the CMutableTransaction, the inputs in parallel on the task pool. provider is only used on the calling thread. */
 bool SignTransaction(CMutableTransaction& mtx, const SigningProvider* provider, const std::map<COutPoint, Coin>& coins, int sighash, std::map<int, std::string>& input_errors);
 
 #endif // BITCOIN_SCRIPT_SIGN_H
@@ -9,7 +9,9 @@
 #include <clientversion.h>
 #include <compat/endian.h>
 
+#include <leveldb/cache.h>
 #include <leveldb/db.h>
+#include <leveldb/filter_policy.h>
 #include <string.h>
 
 namespace smsg {
@@ -24,9 +26,17 @@ const std::string DBK_PURGED_TOKEN      = "pm";
 const std::string DBK_FUNDING_TX_DATA   = "fd";
 const std::string DBK_FUNDING_TX_LINK   = "fl";
 const std::string DBK_BEST_BLOCK        = "bb";
+const std::string DBK_BUCKET_INDEX      = "bi";
+const std::string DBK_SCAN_CHAIN        = "sc";
+const std::string DBK_INBOX_ADDRESS     = "ia";
+const std::string DBK_INBOX_UNREAD      = "iu";
+const std::string DBK_INBOX_INDEXED     = "ix";
 
 RecursiveMutex cs_smsgDB;
 leveldb::DB *smsgDB = nullptr;
+// Owns smsgDB with its cache and filter policy, snapshot readers keep a reference so closing never frees the db under them
+static Mutex cs_smsgDBRef;
+static std::shared_ptr<leveldb::DB> smsgDBRef GUARDED_BY(cs_smsgDBRef);
 
 bool SecMsgDB::Open(const char *pszMode)
 {
@@ -46,14 +56,35 @@ bool SecMsgDB::Open(const char *pszMode)
         return false;
     }
 
+    // Public keys and purged tokens are read by key far more often than messages are,
+    // the bloom filter saves the disk reads of lookups that miss, as in CDBWrapper
+    size_t nCacheSize = std::max(gArgs.GetArg("-smsgdbcache", DEFAULT_SMSGDB_CACHE), MIN_SMSGDB_CACHE) << 20;
+    leveldb::Cache *cache = leveldb::NewLRUCache(nCacheSize / 2);
+    const leveldb::FilterPolicy *filter_policy = leveldb::NewBloomFilterPolicy(10);
+
     leveldb::Options options;
     options.create_if_missing = fCreate;
+    options.block_cache = cache;
+    options.write_buffer_size = nCacheSize / 4;
+    options.filter_policy = filter_policy;
     leveldb::Status s = leveldb::DB::Open(options, fullpath.string(), &smsgDB);
 
     if (!s.ok()) {
         LogPrintf("%s: Error opening db: %s.\n", __func__, s.ToString());
+        smsgDB = nullptr;
+        delete cache;
+        delete filter_policy;
         return false;
     }
+    {
+        LOCK(cs_smsgDBRef);
+        smsgDBRef = std::shared_ptr<leveldb::DB>(smsgDB, [cache, filter_policy](leveldb::DB *db) {
+            delete db;
+            delete cache;
+            delete filter_policy;
+        });
+    }
+    LogPrintf("Opened smsgdb with %.1f MiB cache.\n", nCacheSize * (1.0 / 1024 / 1024));
 
     pdb = smsgDB;
 
@@ -61,6 +92,42 @@ bool SecMsgDB::Open(const char *pszMode)
 };
 
 
+bool SecMsgDB::OpenSnapshot()
+{
+    {
+        LOCK(cs_smsgDBRef);
+        m_db_ref = smsgDBRef;
+    }
+    if (!m_db_ref) {
+        return false;
+    }
+
+    pdb = m_db_ref.get();
+    m_read_options.snapshot = pdb->GetSnapshot();
+
+    return true;
+};
+
+void CloseDB()
+{
+    // Freed here unless a snapshot reader still holds it
+    LOCK(cs_smsgDBRef);
+    smsgDBRef.reset();
+    smsgDB = nullptr;
+}
+
+leveldb::Iterator *SecMsgDB::NewIterator() const
+{
+    return pdb->NewIterator(m_read_options);
+}
+
+leveldb::Iterator *SecMsgDB::NewScanIterator() const
+{
+    leveldb::ReadOptions readOptions = m_read_options;
+    readOptions.fill_cache = false;
+    return pdb->NewIterator(readOptions);
+}
+
 class SecMsgBatchScanner : public leveldb::WriteBatch::Handler
 {
 public:
@@ -189,7 +256,7 @@ bool SecMsgDB::ReadPK(const CKeyID &addr, CPubKey &pubkey)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound()) {
                 return false;
@@ -259,7 +326,7 @@ bool SecMsgDB::ExistsPK(const CKeyID &addr)
         }
     }
 
-    leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &unused);
+    leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &unused);
     return s.IsNotFound() == false;
 };
 
@@ -287,7 +354,7 @@ bool SecMsgDB::ReadKey(const CKeyID &idk, SecMsgKey &key)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound()) {
                 return false;
@@ -413,7 +480,7 @@ bool SecMsgDB::ReadSmesg(const uint8_t *chKey, SecMsgStored &smsgStored)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound()) {
                 return false;
@@ -433,6 +500,35 @@ bool SecMsgDB::ReadSmesg(const uint8_t *chKey, SecMsgStored &smsgStored)
     return true;
 };
 
+// Inbox messages are indexed by recipient and by unread status, index keys end in the message id and have no value
+static bool IsInboxKey(const uint8_t *chKey)
+{
+    return memcmp(chKey, DBK_INBOX.data(), 2) == 0;
+}
+
+static std::string InboxAddressKey(const uint8_t *chKey, const CKeyID &addrTo)
+{
+    std::string key = DBK_INBOX_ADDRESS;
+    key.append((const char*)addrTo.begin(), 20);
+    key.append((const char*)chKey + 2, 28);
+    return key;
+}
+
+static std::string InboxUnreadKey(const uint8_t *chKey)
+{
+    return DBK_INBOX_UNREAD + std::string((const char*)chKey + 2, 28);
+}
+
+static void PutInboxIndex(leveldb::WriteBatch &batch, const uint8_t *chKey, const SecMsgStored &smsgStored)
+{
+    batch.Put(InboxAddressKey(chKey, smsgStored.addrTo), leveldb::Slice());
+    if (smsgStored.status & SMSG_MASK_UNREAD) {
+        batch.Put(InboxUnreadKey(chKey), leveldb::Slice());
+    } else {
+        batch.Delete(InboxUnreadKey(chKey));
+    }
+}
+
 bool SecMsgDB::WriteSmesg(const uint8_t *chKey, const SecMsgStored &smsgStored)
 {
     if (!pdb) {
@@ -444,14 +540,62 @@ bool SecMsgDB::WriteSmesg(const uint8_t *chKey, const SecMsgStored &smsgStored)
     CDataStream ssValue(SER_DISK, CLIENT_VERSION);
     ssValue << smsgStored;
 
+    leveldb::WriteBatch batch;
+    leveldb::WriteBatch *pbatch = activeBatch ? activeBatch : &batch;
+    pbatch->Put(ssKey.str(), ssValue.str());
+    if (IsInboxKey(chKey)) {
+        PutInboxIndex(*pbatch, chKey, smsgStored);
+    }
     if (activeBatch) {
-        activeBatch->Put(ssKey.str(), ssValue.str());
         return true;
     }
 
     leveldb::WriteOptions writeOptions;
     writeOptions.sync = true;
-    leveldb::Status s = pdb->Put(writeOptions, ssKey.str(), ssValue.str());
+    leveldb::Status s = pdb->Write(writeOptions, &batch);
+    if (!s.ok()) {
+        return error("SecMsgDB write failed: %s\n", s.ToString());
+    }
+
+    return true;
+};
+
+bool SecMsgDB::WriteSmesg(const uint8_t *chKey, const SecMsgStored &smsgStored, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload)
+{
+    if (!pdb) {
+        return false;
+    }
+
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)chKey, 30);
+
+    // Same layout as SecMsgStored::Serialize, the message is copied only once into the value
+    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
+    ssValue.reserve(smsgStored.GetSerializeSize(SER_DISK, CLIENT_VERSION) + 9 + SMSG_HDR_LEN + nPayload);
+    ssValue << smsgStored.timeReceived;
+    ssValue << smsgStored.status;
+    ssValue << smsgStored.folderId;
+    ssValue << smsgStored.addrTo;
+    ssValue << smsgStored.addrOutbox;
+    WriteCompactSize(ssValue, SMSG_HDR_LEN + nPayload);
+    ssValue.write((const char*)pHeader, SMSG_HDR_LEN);
+    ssValue.write((const char*)pPayload, nPayload);
+
+    leveldb::Slice key(ssKey.data(), ssKey.size());
+    leveldb::Slice value(ssValue.data(), ssValue.size());
+    leveldb::WriteBatch batch;
+    leveldb::WriteBatch *pbatch = activeBatch ? activeBatch : &batch;
+    pbatch->Put(key, value);
+    if (IsInboxKey(chKey)) {
+        PutInboxIndex(*pbatch, chKey, smsgStored);
+    }
+    if (activeBatch) {
+        return true;
+    }
+
+    leveldb::WriteOptions writeOptions;
+    writeOptions.sync = true;
+    leveldb::Status s = pdb->Write(writeOptions, &batch);
     if (!s.ok()) {
         return error("SecMsgDB write failed: %s\n", s.ToString());
     }
@@ -476,7 +620,7 @@ bool SecMsgDB::ExistsSmesg(const uint8_t *chKey)
         }
     }
 
-    leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &unused);
+    leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &unused);
     return s.IsNotFound() == false;
 };
 
@@ -485,14 +629,21 @@ bool SecMsgDB::EraseSmesg(const uint8_t *chKey)
     CDataStream ssKey(SER_DISK, CLIENT_VERSION);
     ssKey.write((const char*)chKey, 30);
 
+    leveldb::WriteBatch batch;
+    leveldb::WriteBatch *pbatch = activeBatch ? activeBatch : &batch;
+    SecMsgStored smsgStored;
+    if (IsInboxKey(chKey) && ReadSmesg(chKey, smsgStored)) {
+        pbatch->Delete(InboxAddressKey(chKey, smsgStored.addrTo));
+        pbatch->Delete(InboxUnreadKey(chKey));
+    }
+    pbatch->Delete(ssKey.str());
     if (activeBatch) {
-        activeBatch->Delete(ssKey.str());
         return true;
     }
 
     leveldb::WriteOptions writeOptions;
     writeOptions.sync = true;
-    leveldb::Status s = pdb->Delete(writeOptions, ssKey.str());
+    leveldb::Status s = pdb->Write(writeOptions, &batch);
 
     if (s.ok() || s.IsNotFound()) {
         return true;
@@ -500,6 +651,84 @@ bool SecMsgDB::EraseSmesg(const uint8_t *chKey)
     return error("SecMsgDB erase failed: %s\n", s.ToString());
 };
 
+bool SecMsgDB::BuildInboxIndex()
+{
+    if (!pdb) {
+        return false;
+    }
+
+    std::string unused;
+    if (pdb->Get(m_read_options, DBK_INBOX_INDEXED, &unused).ok()) {
+        return true;
+    }
+
+    LogPrintf("Indexing smsg inbox.\n");
+    size_t nMessages = 0;
+    uint8_t chKey[30];
+    SecMsgStored smsgStored;
+    leveldb::WriteBatch batch;
+    std::unique_ptr<leveldb::Iterator> it(NewScanIterator());
+    while (NextSmesg(it.get(), DBK_INBOX, chKey, smsgStored)) {
+        PutInboxIndex(batch, chKey, smsgStored);
+        if (++nMessages % 1000 == 0) {
+            if (!CommitBatch(&batch)) {
+                return false;
+            }
+            batch.Clear();
+        }
+    }
+    batch.Put(DBK_INBOX_INDEXED, leveldb::Slice());
+    if (!CommitBatch(&batch)) {
+        return false;
+    }
+    LogPrintf("Indexed %u inbox messages.\n", nMessages);
+
+    return true;
+};
+
+bool SecMsgDB::ListMsgIds(const std::string &prefix, const SecMsgId *cursor, size_t count, bool reverse, std::vector<SecMsgId> &msgids)
+{
+    if (!pdb) {
+        return false;
+    }
+
+    std::string start = prefix;
+    if (cursor) {
+        start.append((const char*)cursor->data(), cursor->size());
+    } else
+    if (reverse) {
+        start.append(std::tuple_size<SecMsgId>::value, '\xff');
+    }
+
+    std::unique_ptr<leveldb::Iterator> it(NewScanIterator());
+    it->Seek(start);
+    if (reverse) {
+        if (!it->Valid()) {
+            it->SeekToLast();
+        }
+        while (it->Valid() && it->key().compare(start) >= 0) {
+            it->Prev();
+        }
+    } else
+    if (cursor && it->Valid() && it->key() == start) {
+        it->Next();
+    }
+
+    for (; it->Valid() && msgids.size() < count; reverse ? it->Prev() : it->Next()) {
+        leveldb::Slice key = it->key();
+        if (!key.starts_with(prefix)) {
+            break;
+        }
+        if (key.size() != prefix.size() + std::tuple_size<SecMsgId>::value) {
+            continue;
+        }
+        msgids.emplace_back();
+        memcpy(msgids.back().data(), key.data() + prefix.size(), msgids.back().size());
+    }
+
+    return true;
+};
+
 bool SecMsgDB::ReadPurged(const uint8_t *chKey, SecMsgPurged &smsgPurged)
 {
     if (!pdb) {
@@ -521,7 +750,7 @@ bool SecMsgDB::ReadPurged(const uint8_t *chKey, SecMsgPurged &smsgPurged)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound())
                 return false;
@@ -572,6 +801,45 @@ bool SecMsgDB::ErasePurged(const uint8_t *chKey)
 };
 
 
+static std::string TimeKey(const std::string &prefix, int64_t time)
+{
+    std::string key = prefix;
+    int64_t time_be = (int64_t)htobe64(time);
+    key.append((const char*)&time_be, 8);
+    return key;
+}
+
+bool SecMsgDB::EraseBefore(const std::string &prefix, int64_t time_before, size_t &erased)
+{
+    erased = 0;
+    if (!pdb) {
+        return false;
+    }
+    assert(prefix != DBK_INBOX);
+
+    const std::string end = TimeKey(prefix, time_before);
+    leveldb::WriteBatch batch;
+    std::unique_ptr<leveldb::Iterator> it(NewScanIterator());
+    for (it->Seek(prefix); it->Valid() && it->key().compare(end) < 0; it->Next()) {
+        batch.Delete(it->key());
+        erased++;
+    }
+    if (erased == 0) {
+        return true;
+    }
+    return CommitBatch(&batch);
+};
+
+void SecMsgDB::CompactBefore(const std::string &prefix, int64_t time_before)
+{
+    if (!pdb) {
+        return;
+    }
+    const std::string end = TimeKey(prefix, time_before);
+    leveldb::Slice begin_slice(prefix), end_slice(end);
+    pdb->CompactRange(&begin_slice, &end_slice);
+};
+
 bool SecMsgDB::NextPurged(leveldb::Iterator *it, const std::string &prefix, uint8_t *chKey, SecMsgPurged &smsgPurged)
 {
     if (!pdb) {
@@ -656,7 +924,7 @@ bool SecMsgDB::ReadFundingData(const uint256 &key, std::vector<uint8_t> &data)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound()) {
                 return false;
@@ -813,7 +1081,7 @@ bool SecMsgDB::ReadBestBlock(uint256 &block_hash, int &height)
     }
 
     if (readFromDb) {
-        leveldb::Status s = pdb->Get(leveldb::ReadOptions(), ssKey.str(), &strValue);
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
         if (!s.ok()) {
             if (s.IsNotFound()) {
                 return false;
@@ -853,6 +1121,137 @@ bool SecMsgDB::EraseBestBlock()
     return error("SecMsgDB erase failed: %s\n", s.ToString());
 };
 
+bool SecMsgDB::ReadScanChainProgress(uint256 &block_hash, int &height)
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_SCAN_CHAIN.data(), DBK_SCAN_CHAIN.size());
+    std::string strValue;
+
+    bool readFromDb = true;
+    if (activeBatch) {
+        // Check activeBatch first
+        bool deleted = false;
+        readFromDb = ScanBatch(ssKey, &strValue, &deleted) == false;
+        if (deleted) {
+            return false;
+        }
+    }
+
+    if (readFromDb) {
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
+        if (!s.ok()) {
+            if (s.IsNotFound()) {
+                return false;
+            }
+            return error("LevelDB read failure: %s\n", s.ToString());
+        }
+    }
+
+    try {
+        CDataStream ssValue(strValue.data(), strValue.data() + strValue.size(), SER_DISK, CLIENT_VERSION);
+        ssValue >> block_hash;
+        ssValue >> height;
+    } catch (std::exception &e) {
+        LogPrintf("%s unserialize threw: %s.\n", __func__, e.what());
+        return false;
+    }
+
+    return true;
+};
+
+bool SecMsgDB::EraseScanChainProgress()
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_SCAN_CHAIN.data(), DBK_SCAN_CHAIN.size());
+
+    if (activeBatch) {
+        activeBatch->Delete(ssKey.str());
+        return true;
+    }
+
+    leveldb::WriteOptions writeOptions;
+    writeOptions.sync = true;
+    leveldb::Status s = pdb->Delete(writeOptions, ssKey.str());
+    if (s.ok() || s.IsNotFound()) {
+        return true;
+    }
+    return error("SecMsgDB erase failed: %s\n", s.ToString());
+};
+
+bool SecMsgDB::WriteBucketIndex(const std::vector<uint8_t> &data)
+{
+    if (!pdb) {
+        return false;
+    }
+
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_BUCKET_INDEX.data(), DBK_BUCKET_INDEX.size());
+    leveldb::Slice value((const char*)data.data(), data.size());
+
+    if (activeBatch) {
+        activeBatch->Put(ssKey.str(), value);
+        return true;
+    }
+
+    leveldb::WriteOptions writeOptions;
+    writeOptions.sync = true;
+    leveldb::Status s = pdb->Put(writeOptions, ssKey.str(), value);
+    if (!s.ok()) {
+        return error("SecMsgDB write failed: %s\n", s.ToString());
+    }
+
+    return true;
+};
+
+bool SecMsgDB::ReadBucketIndex(std::vector<uint8_t> &data)
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_BUCKET_INDEX.data(), DBK_BUCKET_INDEX.size());
+    std::string strValue;
+
+    bool readFromDb = true;
+    if (activeBatch) {
+        // Check activeBatch first
+        bool deleted = false;
+        readFromDb = ScanBatch(ssKey, &strValue, &deleted) == false;
+        if (deleted) {
+            return false;
+        }
+    }
+
+    if (readFromDb) {
+        leveldb::Status s = pdb->Get(m_read_options, ssKey.str(), &strValue);
+        if (!s.ok()) {
+            if (s.IsNotFound()) {
+                return false;
+            }
+            return error("LevelDB read failure: %s\n", s.ToString());
+        }
+    }
+
+    data.assign(strValue.begin(), strValue.end());
+    return true;
+};
+
+bool SecMsgDB::EraseBucketIndex()
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_BUCKET_INDEX.data(), DBK_BUCKET_INDEX.size());
+
+    if (activeBatch) {
+        activeBatch->Delete(ssKey.str());
+        return true;
+    }
+
+    leveldb::WriteOptions writeOptions;
+    writeOptions.sync = true;
+    leveldb::Status s = pdb->Delete(writeOptions, ssKey.str());
+    if (s.ok() || s.IsNotFound()) {
+        return true;
+    }
+    return error("SecMsgDB erase failed: %s\n", s.ToString());
+};
+
 bool PutBestBlock(leveldb::WriteBatch *batch, const uint256 &block_hash, int height)
 {
     CDataStream ssKey(SER_DISK, CLIENT_VERSION);
@@ -865,6 +1264,33 @@ bool PutBestBlock(leveldb::WriteBatch *batch, const uint256 &block_hash, int hei
     return true;
 };
 
+bool PutPK(leveldb::WriteBatch *batch, const CKeyID &addr, const CPubKey &pubkey)
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.reserve(sizeof(addr) + 2);
+    ssKey << DBK_PUBLICKEY[0];
+    ssKey << DBK_PUBLICKEY[1];
+    ssKey << addr;
+    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
+    ssValue.reserve(sizeof(pubkey));
+    ssValue << pubkey;
+
+    batch->Put(ssKey.str(), ssValue.str());
+    return true;
+};
+
+bool PutScanChainProgress(leveldb::WriteBatch *batch, const uint256 &block_hash, int height)
+{
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    ssKey.write((const char*)DBK_SCAN_CHAIN.data(), DBK_SCAN_CHAIN.size());
+    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
+    ssValue << block_hash;
+    ssValue << height;
+
+    batch->Put(ssKey.str(), ssValue.str());
+    return true;
+};
+
 bool PutFundingData(leveldb::WriteBatch *batch, const uint256 &key, int height, const std::vector<uint8_t> &data)
 {
     CDataStream ssKey(SER_DISK, CLIENT_VERSION);
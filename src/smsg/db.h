@@ -11,6 +11,10 @@
 #include <sync.h>
 #include <pubkey.h>
 
+#include <array>
+#include <memory>
+#include <vector>
+
 class CDataStream;
 class uint256;
 
@@ -20,6 +24,13 @@ class SecMsgKey;
 class SecMsgStored;
 class SecMsgPurged;
 
+//! -smsgdbcache default and minimum (MiB)
+static const int64_t DEFAULT_SMSGDB_CACHE = 16;
+//! Keys erased by an expiry after which their range is compacted
+static const size_t SMSGDB_COMPACT_AFTER_ERASED = 1000;
+static const int64_t MIN_SMSGDB_CACHE = 2;
+
+/** Serialises the writers of smsgDB and guards its lifetime for them, readers use SecMsgDB::OpenSnapshot instead */
 extern RecursiveMutex cs_smsgDB;
 extern leveldb::DB *smsgDB;
 
@@ -29,9 +40,16 @@ extern const std::string DBK_INBOX;
 extern const std::string DBK_OUTBOX;
 extern const std::string DBK_QUEUED;
 extern const std::string DBK_STASHED;
+extern const std::string DBK_INBOX_ADDRESS;
+extern const std::string DBK_INBOX_UNREAD;
 extern const std::string DBK_PURGED_TOKEN;
 extern const std::string DBK_FUNDING_TX_DATA;
 extern const std::string DBK_FUNDING_TX_LINK;
+extern const std::string DBK_BUCKET_INDEX;
+extern const std::string DBK_SCAN_CHAIN;
+
+//! Big endian timestamp and hash of a message, its key after the two byte prefix
+typedef std::array<uint8_t, 28> SecMsgId;
 
 class SecMsgDB
 {
@@ -47,12 +65,21 @@ public:
         if (activeBatch) {
             delete activeBatch;
         }
+        if (m_read_options.snapshot) {
+            pdb->ReleaseSnapshot(m_read_options.snapshot);
+        }
     }
 
     bool Open(const char *pszMode="r+");
+    /** Read from a consistent view of the open db without cs_smsgDB, the write functions must not be used */
+    bool OpenSnapshot();
 
     bool ScanBatch(const CDataStream &key, std::string *value, bool *deleted) const;
 
+    leveldb::Iterator *NewIterator() const;
+    /** Iterator for bulk scans of stored messages, skips the block cache to leave it to the small hot records */
+    leveldb::Iterator *NewScanIterator() const;
+
     bool TxnBegin();
     bool TxnCommit();
     bool TxnAbort();
@@ -69,9 +96,16 @@ public:
     bool NextSmesgKey(leveldb::Iterator *it, const std::string &prefix, uint8_t *chKey);
     bool ReadSmesg(const uint8_t *chKey, SecMsgStored &smsgStored);
     bool WriteSmesg(const uint8_t *chKey, const SecMsgStored &smsgStored);
+    /** Write smsgStored with the message taken from pHeader and pPayload instead of smsgStored.vchMessage */
+    bool WriteSmesg(const uint8_t *chKey, const SecMsgStored &smsgStored, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload);
     bool ExistsSmesg(const uint8_t *chKey);
     bool EraseSmesg(const uint8_t *chKey);
 
+    /** Index the inbox by recipient and unread status, if not yet done */
+    bool BuildInboxIndex();
+    /** Up to count ids of the keys under prefix in key order, starting after cursor or at the first (last if reverse) key */
+    bool ListMsgIds(const std::string &prefix, const SecMsgId *cursor, size_t count, bool reverse, std::vector<SecMsgId> &msgids);
+
     bool NextPrivKey(leveldb::Iterator *it, const std::string &prefix, CKeyID &idk, SecMsgKey &key);
 
     bool ReadPurged(const uint8_t *chKey, SecMsgPurged &smsgPurged);
@@ -79,6 +113,15 @@ public:
     bool ErasePurged(const uint8_t *chKey);
     bool NextPurged(leveldb::Iterator *it, const std::string &prefix, uint8_t *chKey, SecMsgPurged &smsgPurged);
 
+    /**
+     * Erase the message keys under prefix timestamped before time_before in one batch. Message keys
+     * sort by time after the prefix, so the expired keys are one range at its start. Not for the
+     * inbox, whose index entries are keyed separately.
+     */
+    bool EraseBefore(const std::string &prefix, int64_t time_before, size_t &erased);
+    /** Compact the range EraseBefore erased, dropping its tombstones, also from a snapshot */
+    void CompactBefore(const std::string &prefix, int64_t time_before);
+
     bool ReadFundingData(const uint256 &key, std::vector<uint8_t> &data);
     bool WriteFundingData(const uint256 &key, int height, const std::vector<uint8_t> &data);
     bool EraseFundingData(int height, const uint256 &key);
@@ -88,11 +131,28 @@ public:
     bool ReadBestBlock(uint256 &hash, int &height);
     bool EraseBestBlock();
 
+    bool WriteBucketIndex(const std::vector<uint8_t> &data);
+    bool ReadBucketIndex(std::vector<uint8_t> &data);
+    bool EraseBucketIndex();
+
+    /** Last block committed by an interrupted chain scan for public keys */
+    bool ReadScanChainProgress(uint256 &block_hash, int &height);
+    bool EraseScanChainProgress();
+
     leveldb::DB *pdb; // points to the global instance
     leveldb::WriteBatch *activeBatch;
+
+private:
+    std::shared_ptr<leveldb::DB> m_db_ref; // set by OpenSnapshot
+    leveldb::ReadOptions m_read_options;
 };
 
+/** Close the global instance and free its cache and filter policy */
+void CloseDB();
+
 bool PutBestBlock(leveldb::WriteBatch *batch, const uint256 &block_hash, int height);
+bool PutPK(leveldb::WriteBatch *batch, const CKeyID &addr, const CPubKey &pubkey);
+bool PutScanChainProgress(leveldb::WriteBatch *batch, const uint256 &block_hash, int height);
 bool PutFundingData(leveldb::WriteBatch *batch, const uint256 &key, int height, const std::vector<uint8_t> &data);
 
 } // namespace smsg
@@ -8,6 +8,8 @@
 #include <sync.h>
 #include <threadsafety.h>
 
+#include <vector>
+
 const uint32_t SMSG_RCVCOUNT_REDUCE = 200;
 
 namespace SMSGMsgType {
@@ -19,6 +21,8 @@ extern const char *SHOW;
 extern const char *HAVE;
 extern const char *WANT;
 extern const char *MSG;
+extern const char *HAVES;
+extern const char *WANTS;
 extern const char *IGNORING;
 };
 
@@ -30,6 +34,78 @@ public:
     uint32_t m_hash;
 };
 
+/** Number of PeerBuckets slots, a slot per bucket time in the retention window */
+size_t SmsgPeerBucketSlots();
+
+/**
+ * Buckets a peer announced with more or other messages than this node has,
+ * and when the contents of each bucket were last shown to the peer. Held in
+ * one slot per bucket time of the retention window, a slot holding another
+ * time is free. The mutex is taken last, after cs_smsg and cs_smsg_net.
+ */
+class PeerBuckets
+{
+public:
+    /** Note a bucket the peer announced */
+    void SetPending(int64_t time, uint32_t active, uint32_t hash);
+    /** Snapshot of the announced buckets, oldest first */
+    std::vector<std::pair<int64_t, PeerBucket> > GetPending() const;
+    /** Drop an announced bucket, unless the peer announced it again since seen was taken */
+    void ErasePending(int64_t time, const PeerBucket &seen);
+    size_t NumPending() const;
+
+    int64_t GetLastShown(int64_t time) const;
+    void SetLastShown(int64_t time, int64_t now);
+    /** Forget when buckets older than cutoff were shown */
+    void ExpireShown(int64_t cutoff);
+    std::vector<std::pair<int64_t, int64_t> > GetShown() const;
+    size_t NumShown() const;
+
+    size_t DynamicMemoryUsage() const;
+
+private:
+    struct Slot {
+        int64_t time = 0;
+        int64_t last_shown = 0;
+        uint32_t active = 0;
+        uint32_t hash = 0;
+        bool pending = false;
+    };
+
+    const Slot *Find(int64_t time) const EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+    /** The slot of time, cleared if it held another time */
+    Slot &Claim(int64_t time) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    mutable Mutex m_mutex;
+    std::vector<Slot> m_slots GUARDED_BY(m_mutex);
+    size_t m_num_pending GUARDED_BY(m_mutex) = 0;
+};
+
+/**
+ * Token bucket limiting the bytes of smsg inventory and messages sent,
+ * refilled at a fixed rate up to a burst size. A rate of 0 is unlimited.
+ */
+class SmsgUploadBudget
+{
+public:
+    void SetRate(uint64_t bytes_per_second, uint64_t burst);
+    /** Whether bytes could be sent now, without taking them */
+    bool Available(size_t bytes, int64_t now_micros);
+    /** Take bytes if available, a send larger than the burst passes when the bucket is full */
+    bool Consume(size_t bytes, int64_t now_micros);
+    /** Return bytes taken for a send that didn't happen */
+    void Refund(size_t bytes);
+
+private:
+    void Refill(int64_t now_micros) EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    mutable Mutex m_mutex;
+    uint64_t m_rate GUARDED_BY(m_mutex) = 0;
+    double m_burst GUARDED_BY(m_mutex) = 0;
+    double m_tokens GUARDED_BY(m_mutex) = 0;
+    int64_t m_last_refill GUARDED_BY(m_mutex) = 0;
+};
+
 class SecMsgNode
 {
 public:
@@ -43,8 +119,8 @@ public:
     uint16_t m_ignored_counter = 0;
     bool fEnabled = false;
     int m_version = 0;
-    std::map<int64_t, PeerBucket> m_buckets GUARDED_BY(cs_smsg_net);
-    std::map<int64_t, int64_t> m_buckets_last_shown;
+    PeerBuckets m_buckets;
+    SmsgUploadBudget m_upload_budget;
 
     void DecSmsgMisbehaving() {
         LOCK(cs_smsg_net);
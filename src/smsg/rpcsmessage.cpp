@@ -6,6 +6,8 @@
 #include <rpc/server.h>
 
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <string>
 
 #include <smsg/smessage.h>
@@ -41,6 +43,85 @@ static void EnsureSMSGIsEnabled()
     }
 };
 
+//! Message ids read from the db at a time while filling a page
+static const size_t LIST_MSGIDS_STEP = 1000;
+
+/** Page of a message listing, the messages after cursor in key (time) order */
+struct ListPage
+{
+    size_t count = std::numeric_limits<size_t>::max();
+    bool have_cursor = false;
+    smsg::SecMsgId cursor;
+    bool newest_first = false;
+};
+
+static void ParseListPage(const UniValue &options, ListPage &page)
+{
+    if (options["count"].isNum()) {
+        int count = options["count"].get_int();
+        if (count < 1) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "count must be positive.");
+        }
+        page.count = count;
+    }
+    if (options["cursor"].isStr()) {
+        std::string sCursor = options["cursor"].get_str();
+        if (!IsHex(sCursor) || sCursor.size() != 56) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "cursor must be a msgid, 28 bytes in hex string.");
+        }
+        std::vector<uint8_t> vCursor = ParseHex(sCursor);
+        memcpy(page.cursor.data(), vCursor.data(), page.cursor.size());
+        page.have_cursor = true;
+    }
+    if (options["newest_first"].isBool()) {
+        page.newest_first = options["newest_first"].get_bool();
+    }
+};
+
+/** Walks the message ids of an index or message prefix a step at a time */
+class MsgIdPager
+{
+public:
+    MsgIdPager(smsg::SecMsgDB &db, const std::string &index_prefix, const ListPage &page)
+        : m_db(db), m_index_prefix(index_prefix), m_reverse(page.newest_first), m_have_cursor(page.have_cursor), m_cursor(page.cursor) {};
+
+    /** Set chKey to the message key under msg_prefix of the next id */
+    bool Next(const std::string &msg_prefix, uint8_t *chKey)
+    {
+        if (m_pos >= m_msgids.size()) {
+            if (m_done) {
+                return false;
+            }
+            m_msgids.clear();
+            m_pos = 0;
+            if (!m_db.ListMsgIds(m_index_prefix, m_have_cursor ? &m_cursor : nullptr, LIST_MSGIDS_STEP, m_reverse, m_msgids)) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not read DB");
+            }
+            m_done = m_msgids.size() < LIST_MSGIDS_STEP;
+            if (m_msgids.empty()) {
+                return false;
+            }
+        }
+        m_cursor = m_msgids[m_pos++];
+        m_have_cursor = true;
+        memcpy(chKey, msg_prefix.data(), 2);
+        memcpy(chKey + 2, m_cursor.data(), m_cursor.size());
+        return true;
+    };
+
+    const smsg::SecMsgId &MsgId() const { return m_cursor; };
+
+private:
+    smsg::SecMsgDB &m_db;
+    const std::string m_index_prefix;
+    const bool m_reverse;
+    bool m_have_cursor;
+    smsg::SecMsgId m_cursor;
+    std::vector<smsg::SecMsgId> m_msgids;
+    size_t m_pos = 0;
+    bool m_done = false;
+};
+
 static UniValue smsgenable(const JSONRPCRequest &request)
 {
             RPCHelpMan{"smsgenable",
@@ -484,10 +565,13 @@ static UniValue smsgscanchain(const JSONRPCRequest &request)
 {
             RPCHelpMan{"smsgscanchain",
                 "\nLook for public keys in the block chain.\n",
-                {},
+                {
+                    {"async", RPCArg::Type::BOOL, /* default */ "false", "Scan in the background, smsggetinfo shows the progress."},
+                },
                 RPCResults{},
                 RPCExamples{
                     HelpExampleCli("smsgscanchain", "")
+                    + HelpExampleCli("smsgscanchain", "true")
                     + HelpExampleRpc("smsgscanchain", "")
                 },
             }.Check(request);
@@ -495,6 +579,13 @@ static UniValue smsgscanchain(const JSONRPCRequest &request)
     EnsureSMSGIsEnabled();
 
     UniValue result(UniValue::VOBJ);
+    if (!request.params[0].isNull() && request.params[0].get_bool()) {
+        if (!smsgModule.StartScanChain()) {
+            result.pushKV("result", "Scan Chain Failed.");
+        } else {
+            result.pushKV("result", "Scan Chain Started.");
+        }
+    } else
     if (!smsgModule.ScanBlockChain()) {
         result.pushKV("result", "Scan Chain Failed.");
     } else {
@@ -1235,6 +1326,10 @@ static UniValue smsginbox(const JSONRPCRequest &request)
                         {
                             {"updatestatus", RPCArg::Type::BOOL, /* default */ "true", "Update read status if true."},
                             {"encoding", RPCArg::Type::STR, /* default */ "text", "Display message data in encoding, values: \"text\", \"hex\", \"none\"."},
+                            {"to", RPCArg::Type::STR, /* default */ "", "Only list messages received on address."},
+                            {"count", RPCArg::Type::NUM, /* default */ "all", "Number of messages to list, \"next_cursor\" is returned if the page is full."},
+                            {"cursor", RPCArg::Type::STR_HEX, /* default */ "", "List from after this msgid, \"next_cursor\" of the previous page."},
+                            {"newest_first", RPCArg::Type::BOOL, /* default */ "false", "List the most recently sent messages first."},
                         },
                         "options"},
                 },
@@ -1268,6 +1363,8 @@ static UniValue smsginbox(const JSONRPCRequest &request)
 
     std::string sEnc = "text";
     bool update_status = true;
+    CKeyID address_to;
+    ListPage page;
     if (request.params[2].isObject()) {
         UniValue options = request.params[2].get_obj();
         if (options["updatestatus"].isBool()) {
@@ -1276,6 +1373,13 @@ static UniValue smsginbox(const JSONRPCRequest &request)
         if (options["encoding"].isStr()) {
             sEnc = options["encoding"].get_str();
         }
+        if (options["to"].isStr()) {
+            CBitcoinAddress coinAddress(options["to"].get_str());
+            if (!coinAddress.IsValid() || !coinAddress.GetKeyID(address_to)) {
+                throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid to address.");
+            }
+        }
+        ParseListPage(options, page);
     }
 
     UniValue result(UniValue::VOBJ);
@@ -1283,18 +1387,17 @@ static UniValue smsginbox(const JSONRPCRequest &request)
     {
 
         smsg::SecMsgDB dbInbox;
-        if (!dbInbox.Open("cr+")) {
-            throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
-        }
-
         uint32_t nMessages = 0;
         uint8_t chKey[30];
 
         if (mode == "clear") {
             LOCK(smsg::cs_smsgDB);
+            if (!dbInbox.Open("cr+")) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
+            }
             dbInbox.TxnBegin();
 
-            leveldb::Iterator *it = dbInbox.pdb->NewIterator(leveldb::ReadOptions());
+            leveldb::Iterator *it = dbInbox.NewScanIterator();
             while (dbInbox.NextSmesgKey(it, smsg::DBK_INBOX, chKey)) {
                 dbInbox.EraseSmesg(chKey);
                 nMessages++;
@@ -1310,13 +1413,28 @@ static UniValue smsginbox(const JSONRPCRequest &request)
 
             smsg::SecMsgStored smsgStored;
             smsg::MessageData msg;
+            // Messages to mark as read once the listing is done, listing doesn't block the writers
+            std::vector<std::array<uint8_t, 30> > vMarkRead;
 
-            dbInbox.TxnBegin();
+            if (!dbInbox.OpenSnapshot()) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
+            }
 
-            leveldb::Iterator *it = dbInbox.pdb->NewIterator(leveldb::ReadOptions());
+            // Walk the smallest index, only the messages listed are decrypted
+            std::string index_prefix = smsg::DBK_INBOX;
+            if (!address_to.IsNull()) {
+                index_prefix = smsg::DBK_INBOX_ADDRESS + std::string((const char*)address_to.begin(), 20);
+            } else
+            if (fCheckReadStatus) {
+                index_prefix = smsg::DBK_INBOX_UNREAD;
+            }
+            MsgIdPager pager(dbInbox, index_prefix, page);
             UniValue messageList(UniValue::VARR);
 
-            while (dbInbox.NextSmesg(it, smsg::DBK_INBOX, chKey, smsgStored)) {
+            while (nMessages < page.count && pager.Next(smsg::DBK_INBOX, chKey)) {
+                if (!dbInbox.ReadSmesg(chKey, smsgStored)) {
+                    continue;
+                }
                 if (fCheckReadStatus
                     && !(smsgStored.status & SMSG_MASK_UNREAD)) {
                     continue;
@@ -1329,8 +1447,7 @@ static UniValue smsginbox(const JSONRPCRequest &request)
                 objM.pushKV("msgid", HexStr(Span<const unsigned char>(&chKey[2], 28))); // timestamp+hash
                 objM.pushKV("version", strprintf("%02x%02x", psmsg->version[0], psmsg->version[1]));
 
-                uint32_t nPayload = smsgStored.vchMessage.size() - smsg::SMSG_HDR_LEN;
-                int rv = smsgModule.Decrypt(false, smsgStored.addrTo, pHeader, pHeader + smsg::SMSG_HDR_LEN, nPayload, msg);
+                int rv = smsgModule.DecryptStored(pager.MsgId(), smsgStored.addrTo, smsgStored.vchMessage, msg);
                 if (rv == 0) {
                     std::string sAddrTo = EncodeDestination(PKHash(smsgStored.addrTo));
                     std::string sText = std::string((char*)msg.vchMessage.data());
@@ -1379,21 +1496,36 @@ static UniValue smsginbox(const JSONRPCRequest &request)
 
                 // Only set 'read' status if the message decrypted successfully and update_status is set
                 if (fCheckReadStatus && rv == 0 && update_status) {
-                    smsgStored.status &= ~SMSG_MASK_UNREAD;
-                    dbInbox.WriteSmesg(chKey, smsgStored);
+                    vMarkRead.emplace_back();
+                    memcpy(vMarkRead.back().data(), chKey, 30);
                 }
                 nMessages++;
             }
-            delete it;
-            dbInbox.TxnCommit();
+
+            if (!vMarkRead.empty()) {
+                LOCK(smsg::cs_smsgDB);
+                smsg::SecMsgDB dbWrite;
+                if (dbWrite.Open("cr+") && dbWrite.TxnBegin()) {
+                    for (const auto &key : vMarkRead) {
+                        if (dbWrite.ReadSmesg(key.data(), smsgStored)) {
+                            smsgStored.status &= ~SMSG_MASK_UNREAD;
+                            dbWrite.WriteSmesg(key.data(), smsgStored);
+                        }
+                    }
+                    dbWrite.TxnCommit();
+                }
+            }
 
             result.pushKV("messages", messageList);
             result.pushKV("result", strprintf("%u", nMessages));
+            if (nMessages == page.count) {
+                result.pushKV("next_cursor", HexStr(pager.MsgId()));
+            }
         } else {
             result.pushKV("result", "Unknown Mode.");
             result.pushKV("expected", "all|unread|clear.");
         }
-    } // cs_smsgDB
+    }
 
     return result;
 };
@@ -1411,6 +1543,9 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
                             {"encoding", RPCArg::Type::STR, /* default */ "text", "Display message data in encoding, values: \"text\", \"hex\", \"none\"."},
                             {"sending", RPCArg::Type::BOOL, /* default */ "false", "Display messages in sending queue."},
                             {"stashed", RPCArg::Type::BOOL, /* default */ "false", "Display stashed messages."},
+                            {"count", RPCArg::Type::NUM, /* default */ "all", "Number of messages to list, \"next_cursor\" is returned if the page is full."},
+                            {"cursor", RPCArg::Type::STR_HEX, /* default */ "", "List from after this msgid, \"next_cursor\" of the previous page."},
+                            {"newest_first", RPCArg::Type::BOOL, /* default */ "false", "List the most recently sent messages first."},
                         },
                         "options"},
                 },
@@ -1439,6 +1574,7 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
     bool show_sending = false;
     bool show_stashed = false;
     std::string sEnc = "text";
+    ListPage page;
     if (request.params[2].isObject()) {
         UniValue options = request.params[2].get_obj();
         if (options["encoding"].isStr()) {
@@ -1450,6 +1586,7 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
         if (options["stashed"].isBool()) {
             show_stashed = options["stashed"].get_bool();
         }
+        ParseListPage(options, page);
     }
 
     if (show_sending && show_stashed) {
@@ -1462,20 +1599,18 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
     memset(&chKey[0], 0, sizeof(chKey));
 
     {
-        LOCK(smsg::cs_smsgDB);
-
         smsg::SecMsgDB dbOutbox;
-        if (!dbOutbox.Open("cr+")) {
-            throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
-        }
-
         uint32_t nMessages = 0;
 
         std::string db_prefix = show_sending ? smsg::DBK_QUEUED : show_stashed ? smsg::DBK_STASHED : smsg::DBK_OUTBOX;
         if (mode == "clear") {
+            LOCK(smsg::cs_smsgDB);
+            if (!dbOutbox.Open("cr+")) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
+            }
             dbOutbox.TxnBegin();
 
-            leveldb::Iterator *it = dbOutbox.pdb->NewIterator(leveldb::ReadOptions());
+            leveldb::Iterator *it = dbOutbox.NewScanIterator();
             while (dbOutbox.NextSmesgKey(it, db_prefix, chKey)) {
                 dbOutbox.EraseSmesg(chKey);
                 nMessages++;
@@ -1488,11 +1623,17 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
         if (mode == "all") {
             smsg::SecMsgStored smsgStored;
             smsg::MessageData msg;
-            leveldb::Iterator *it = dbOutbox.pdb->NewIterator(leveldb::ReadOptions());
+            if (!dbOutbox.OpenSnapshot()) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
+            }
+            MsgIdPager pager(dbOutbox, db_prefix, page);
 
             UniValue messageList(UniValue::VARR);
 
-            while (dbOutbox.NextSmesg(it, db_prefix, chKey, smsgStored)) {
+            while (nMessages < page.count && pager.Next(db_prefix, chKey)) {
+                if (!dbOutbox.ReadSmesg(chKey, smsgStored)) {
+                    continue;
+                }
                 const unsigned char *pHeader = smsgStored.vchMessage.data();
                 smsg::SecureMessage smsg(pHeader);
                 const smsg::SecureMessage *psmsg = &smsg;
@@ -1501,8 +1642,7 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
                 objM.pushKV("msgid", HexStr(Span<const unsigned char>(&chKey[2], 28))); // timestamp+hash
                 objM.pushKV("version", strprintf("%02x%02x", psmsg->version[0], psmsg->version[1]));
 
-                uint32_t nPayload = smsgStored.vchMessage.size() - smsg::SMSG_HDR_LEN;
-                int rv = smsgModule.Decrypt(false, smsgStored.addrOutbox, pHeader, pHeader + smsg::SMSG_HDR_LEN, nPayload, msg);
+                int rv = smsgModule.DecryptStored(pager.MsgId(), smsgStored.addrOutbox, smsgStored.vchMessage, msg);
                 if (rv == 0) {
                     std::string sAddrTo = EncodeDestination(PKHash(smsgStored.addrTo));
                     std::string sText = std::string((char*)msg.vchMessage.data());
@@ -1548,10 +1688,12 @@ static UniValue smsgoutbox(const JSONRPCRequest &request)
                 messageList.push_back(objM);
                 nMessages++;
             }
-            delete it;
 
             result.pushKV("messages" ,messageList);
             result.pushKV("result", strprintf("%u", nMessages));
+            if (nMessages == page.count) {
+                result.pushKV("next_cursor", HexStr(pager.MsgId()));
+            }
         } else {
             result.pushKV("result", "Unknown Mode.");
             result.pushKV("expected", "all|clear.");
@@ -1593,13 +1735,13 @@ static UniValue smsgbuckets(const JSONRPCRequest &request)
         uint64_t nBytes = 0;
         {
             LOCK(smsgModule.cs_smsg);
-            std::map<int64_t, smsg::SecMsgBucket>::const_iterator it;
+            smsg::SecMsgBucketSet::const_iterator it;
             for (it = smsgModule.buckets.begin(); it != smsgModule.buckets.end(); ++it) {
-                const std::set<smsg::SecMsgToken> &tokenSet = it->second.setTokens;
+                const std::vector<smsg::SecMsgToken> &tokenSet = it->second.vTokens;
 
                 std::string sBucket = ToString(it->first);
                 std::string sFile = sBucket + "_01.dat";
-                std::string sHash = ToString((int64_t)it->second.hash);
+                std::string sHash = ToString((int64_t)it->second.GetHash());
 
                 size_t nActiveMessages = it->second.CountActive();
 
@@ -1654,7 +1796,7 @@ static UniValue smsgbuckets(const JSONRPCRequest &request)
     if (mode == "dump") {
         {
             LOCK(smsgModule.cs_smsg);
-            std::map<int64_t, smsg::SecMsgBucket>::iterator it;
+            smsg::SecMsgBucketSet::iterator it;
             for (it = smsgModule.buckets.begin(); it != smsgModule.buckets.end(); ++it) {
                 std::string sFile = ToString(it->first) + "_01.dat";
 
@@ -1836,9 +1978,8 @@ static UniValue smsgview(const JSONRPCRequest &request)
     size_t debugEmptySent = 0;
 
     {
-        LOCK(smsg::cs_smsgDB);
         smsg::SecMsgDB dbMsg;
-        if (!dbMsg.Open("cr")) {
+        if (!dbMsg.OpenSnapshot()) {
             throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
         }
 
@@ -1847,9 +1988,7 @@ static UniValue smsgview(const JSONRPCRequest &request)
         for (itp = vPrefixes.begin(); itp < vPrefixes.end(); ++itp) {
             bool fInbox = *itp == smsg::DBK_INBOX;
 
-            dbMsg.TxnBegin();
-
-            leveldb::Iterator *it = dbMsg.pdb->NewIterator(leveldb::ReadOptions());
+            leveldb::Iterator *it = dbMsg.NewScanIterator();
             smsg::SecMsgStored smsgStored;
             smsg::MessageData msg;
 
@@ -1931,10 +2070,8 @@ static UniValue smsgview(const JSONRPCRequest &request)
                 }
             }
             delete it;
-
-            dbMsg.TxnCommit();
         }
-    } // cs_smsgDB
+    }
 
 
     std::sort(vMessages.begin(), vMessages.end(), fDesc ? sortMsgDesc : sortMsgAsc);
@@ -2280,7 +2417,7 @@ static UniValue smsggetfeerate(const JSONRPCRequest &request)
 
             int64_t smsg_fee_rate_target;
             CBlock block;
-            if (!ReadBlockFromDisk(block, pTip, Params().GetConsensus())) {
+            if (!ReadBlockFromDisk(block, pTip, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
                 throw JSONRPCError(RPC_MISC_ERROR, "Block not found on disk");
             }
             block.vtx[0]->GetSmsgFeeRate(smsg_fee_rate_target);
@@ -2339,6 +2476,23 @@ static UniValue smsggetinfo(const JSONRPCRequest &request)
                     RPCResult::Type::OBJ, "", "", {
                         {RPCResult::Type::BOOL, "enabled", "True if SMSG is enabled"},
                         {RPCResult::Type::STR, "wallet", "name of the currently active wallet or \"None set\""},
+                        {RPCResult::Type::NUM, "pow_threads", "Number of threads used for proof of work"},
+                        {RPCResult::Type::NUM, "pow_queue_depth", "Number of messages waiting for proof of work"},
+                        {RPCResult::Type::NUM, "pow_hashes_per_sec", "Average proof of work hash rate since startup"},
+                        {RPCResult::Type::NUM, "num_buckets", "Number of buckets in the message store"},
+                        {RPCResult::Type::NUM, "bucket_store_bytes", "Approximate memory used by the bucket index"},
+                        {RPCResult::Type::NUM, "peer_bucket_state_bytes", "Approximate memory used by the bucket state kept for peers"},
+                        {RPCResult::Type::NUM, "funding_cache_size", "Number of funding transactions cached for paid message validation"},
+                        {RPCResult::Type::ARR, "dictionaries", "Ids of the compression dictionaries loaded", {
+                            {RPCResult::Type::STR_HEX, "", "dictionary id"}}},
+                        {RPCResult::Type::STR_HEX, "send_dictionary", /* optional */ true, "Id of the dictionary sent messages are compressed with"},
+                        {RPCResult::Type::OBJ, "scan_chain", "Progress of the last chain scan for public keys", {
+                            {RPCResult::Type::BOOL, "running", "True if the scan is in progress"},
+                            {RPCResult::Type::NUM, "height", "Last block scanned"},
+                            {RPCResult::Type::NUM, "tip_height", "Height of the chain when the last block was scanned"},
+                            {RPCResult::Type::NUM, "pubkeys", "Number of public keys added"},
+                            {RPCResult::Type::NUM, "duplicates", "Number of public keys already known"},
+                        }},
                     },
                 },
                 RPCExamples{
@@ -2360,6 +2514,46 @@ static UniValue smsggetinfo(const JSONRPCRequest &request)
         }
         obj.pushKV("enabled_wallets", wallet_names);
 #endif
+
+        size_t queue_depth = 0;
+        {
+            smsg::SecMsgDB dbOutbox;
+            if (dbOutbox.OpenSnapshot()) {
+                uint8_t chKey[30];
+                leveldb::Iterator *it = dbOutbox.NewScanIterator();
+                while (dbOutbox.NextSmesgKey(it, smsg::DBK_QUEUED, chKey)) {
+                    queue_depth++;
+                }
+                delete it;
+            }
+        }
+        int64_t pow_time = smsgModule.m_pow_time;
+        obj.pushKV("pow_threads", smsgModule.m_num_pow_threads + 1);
+        obj.pushKV("pow_queue_depth", (uint64_t)queue_depth);
+        obj.pushKV("pow_hashes_per_sec", pow_time > 0 ? (int64_t)(smsgModule.m_pow_hashes * 1e6 / pow_time) : 0);
+        {
+            LOCK(smsgModule.cs_smsg);
+            obj.pushKV("num_buckets", (uint64_t)smsgModule.buckets.size());
+            obj.pushKV("bucket_store_bytes", (uint64_t)smsgModule.buckets.DynamicMemoryUsage());
+        }
+        obj.pushKV("peer_bucket_state_bytes", (uint64_t)smsgModule.PeerBucketsMemoryUsage());
+        obj.pushKV("funding_cache_size", (uint64_t)smsgModule.FundingCacheCount());
+        UniValue dictionaries(UniValue::VARR);
+        for (uint32_t id : smsgModule.ListDictionaries()) {
+            dictionaries.push_back(strprintf("%08x", id));
+        }
+        obj.pushKV("dictionaries", dictionaries);
+        if (smsgModule.SendDictionary()) {
+            obj.pushKV("send_dictionary", strprintf("%08x", smsgModule.SendDictionary()));
+        }
+
+        UniValue scan_chain(UniValue::VOBJ);
+        scan_chain.pushKV("running", smsgModule.m_scan_chain_running.load());
+        scan_chain.pushKV("height", smsgModule.m_scan_chain_height.load());
+        scan_chain.pushKV("tip_height", smsgModule.m_scan_chain_tip.load());
+        scan_chain.pushKV("pubkeys", (uint64_t)smsgModule.m_scan_chain_pubkeys);
+        scan_chain.pushKV("duplicates", (uint64_t)smsgModule.m_scan_chain_duplicates);
+        obj.pushKV("scan_chain", scan_chain);
     }
 
     return obj;
@@ -2384,6 +2578,9 @@ static UniValue smsgpeers(const JSONRPCRequest &request)
                     {RPCResult::Type::NUM, "numwantsent", "Number of smsges requested from peer"},
                     {RPCResult::Type::NUM, "receivecounter", "Messages received from peer in window"},
                     {RPCResult::Type::NUM, "ignoredcounter", "Number of times peer has been ignored"},
+                    {RPCResult::Type::NUM, "num_pending_inv", "Number of buckets the peer announced that are yet to be requested"},
+                    {RPCResult::Type::NUM, "num_shown_buckets", "Number of buckets whose contents were shown to the peer"},
+                    {RPCResult::Type::NUM, "bucket_state_bytes", "Approximate memory used by the bucket state kept for the peer"},
                 }},
             }
         },
@@ -2458,16 +2655,14 @@ static UniValue smsgzmqpush(const JSONRPCRequest &request)
     }
 
     {
-        LOCK(smsg::cs_smsgDB);
-
         smsg::SecMsgDB dbInbox;
-        if (!dbInbox.Open("cr+")) {
+        if (!dbInbox.OpenSnapshot()) {
             throw JSONRPCError(RPC_INTERNAL_ERROR, "Could not open DB");
         }
 
         uint8_t chKey[30];
         smsg::SecMsgStored smsgStored;
-        leveldb::Iterator *it = dbInbox.pdb->NewIterator(leveldb::ReadOptions());
+        leveldb::Iterator *it = dbInbox.NewScanIterator();
         while (dbInbox.NextSmesg(it, smsg::DBK_INBOX, chKey, smsgStored)) {
             if (unreadonly
                 && !(smsgStored.status & SMSG_MASK_UNREAD)) {
@@ -2479,6 +2674,8 @@ static UniValue smsgzmqpush(const JSONRPCRequest &request)
             }
 
             smsg::SecureMessage smsg(smsgStored.vchMessage.data());
+            smsg.pPayload = smsgStored.vchMessage.data() + smsg::SMSG_HDR_LEN;
+            smsg.nPayload = smsgStored.vchMessage.size() - smsg::SMSG_HDR_LEN;
             const smsg::SecureMessage *psmsg = &smsg;
 
             std::vector<uint8_t> vchUint160;
@@ -2486,11 +2683,12 @@ static UniValue smsgzmqpush(const JSONRPCRequest &request)
             memcpy(vchUint160.data(), &chKey[10], 20);
             uint160 hash(vchUint160);
 
-            GetMainSignals().NewSecureMessage(psmsg, hash);
+            GetMainSignals().NewSecureMessage(psmsg, hash, smsgStored.addrTo);
+            smsg.pPayload = nullptr;
             num_sent++;
         }
         delete it;
-    } // cs_smsgDB
+    }
 
     UniValue result(UniValue::VOBJ);
 
@@ -2546,10 +2744,10 @@ static UniValue smsgdebug(const JSONRPCRequest &request)
 
         int num_messages = 0;
         LOCK(smsgModule.cs_smsg);
-        std::map<int64_t, smsg::SecMsgBucket>::const_iterator it;
+        smsg::SecMsgBucketSet::const_iterator it;
         std::vector<uint8_t> vch_msg;
         for (it = smsgModule.buckets.begin(); it != smsgModule.buckets.end(); ++it) {
-            const std::set<smsg::SecMsgToken> &token_set = it->second.setTokens;
+            const std::vector<smsg::SecMsgToken> &token_set = it->second.vTokens;
             for (auto token : token_set) {
                 if (active_only && token.timestamp + token.ttl < now) {
                     continue; // Skip expired
@@ -2629,7 +2827,7 @@ static const CRPCCommand commands[] =
     { "smsg",               "smsgdisable",            &smsgdisable,            {} },
     { "smsg",               "smsgoptions",            &smsgoptions,            {"mode","optname","value"} },
     { "smsg",               "smsglocalkeys",          &smsglocalkeys,          {"mode","optype","address"} },
-    { "smsg",               "smsgscanchain",          &smsgscanchain,          {} },
+    { "smsg",               "smsgscanchain",          &smsgscanchain,          {"async"} },
     { "smsg",               "smsgscanbuckets",        &smsgscanbuckets,        {"options"} },
     { "smsg",               "smsgaddaddress",         &smsgaddaddress,         {"address","pubkey"} },
     { "smsg",               "smsgaddlocaladdress",    &smsgaddlocaladdress,    {"address"} },
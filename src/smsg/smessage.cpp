@@ -27,6 +27,7 @@ Notes:
 #include <secp256k1.h>
 #include <secp256k1_ecdh.h>
 #include <crypto/hmac_sha256.h>
+#include <crypto/sha256.h>
 #include <crypto/sha512.h>
 #include <wallet/ismine.h>
 #include <support/allocators/secure.h>
@@ -38,14 +39,18 @@ Notes:
 #include <smsg/db.h>
 #include <random.h>
 #include <chain.h>
+#include <memusage.h>
 #include <netmessagemaker.h>
 #include <net.h>
 #include <net_processing.h>
 #include <streams.h>
 #include <univalue.h>
 #include <node/context.h>
+#include <node/initstages.h>
 #include <util/string.h>
 #include <util/system.h>
+#include <util/metrics.h>
+#include <util/trace.h>
 
 #ifdef ENABLE_WALLET
 #include <wallet/coincontrol.h>
@@ -57,8 +62,12 @@ Notes:
 
 #include <stdint.h>
 #include <time.h>
+#include <algorithm>
+#include <functional>
 #include <map>
+#include <set>
 #include <stdexcept>
+#include <tuple>
 #include <errno.h>
 #include <limits>
 
@@ -78,9 +87,11 @@ const char *HAVE="smsgHave";
 const char *WANT="smsgWant";
 const char *MSG="smsgMsg";
 const char *IGNORING="smsgIgnore";
+const char *HAVES="smsgHaves";
+const char *WANTS="smsgWants";
 
 const static std::string allTypes[] = {
-    PING, PONG, DISABLED, INV, SHOW, HAVE, WANT, MSG, IGNORING
+    PING, PONG, DISABLED, INV, SHOW, HAVE, WANT, MSG, IGNORING, HAVES, WANTS
 };
 } // namespace SMSGMsgType
 
@@ -98,6 +109,22 @@ uint32_t SMSG_RETENTION         = SMSG_MAX_PAID_TTL;
 const size_t MAX_BUNCH_MESSAGES = 500;
 const size_t MAX_BUNCH_BYTES = SMSG_MAX_MSG_BYTES_PAID * 4;
 const uint16_t MAX_WANT_SENT = 16000;
+const size_t RECEIVE_CHUNK_MESSAGES = 64; // Received messages validated in parallel and stored together
+
+static uint64_t UploadBurst(uint64_t rate)
+{
+    // A full bunch must fit, or a limited peer could never be sent one
+    return std::max(rate * SMSG_UPLOAD_BURST_SECONDS, (uint64_t)MAX_BUNCH_BYTES);
+}
+
+/** Inbox writes of a received chunk, written together and announced once written */
+class SecMsgInboxBatch
+{
+public:
+    SecMsgDB db;
+    size_t writes = 0;
+    std::vector<std::function<void()> > notify;
+};
 const size_t SMSG_MAX_SHOW = 64;
 
 boost::signals2::signal<void (SecMsgStored &inboxHdr)> NotifySecMsgInboxChanged;
@@ -119,7 +146,7 @@ inline static void memput_int64_le(uint8_t *p, int64_t v) {
     memcpy(p, &v, 8);
 }
 
-inline static uint32_t memget_int64_le(uint8_t *p) {
+inline static uint32_t memget_int64_le(const uint8_t *p) {
     int64_t v = 0;
     memcpy(&v, p, 8);
     v = (int64_t) le64toh((uint64_t) v);
@@ -131,44 +158,174 @@ inline static void memput_uint32_le(uint8_t *p, uint32_t v) {
     memcpy(p, &v, 4);
 }
 
-inline static uint32_t memget_uint32_le(uint8_t *p) {
+inline static uint32_t memget_uint32_le(const uint8_t *p) {
     uint32_t v = 0;
     memcpy(&v, p, 4);
     v = le32toh(v);
     return v;
 }
 
-void SecMsgBucket::hashBucket(int64_t bucket_time)
+static uint64_t TokenDigest(const SecMsgToken &token)
 {
-    XXH32_state_t *state = XXH32_createState();
-    XXH32_reset(state, 1);
+    uint64_t timestamp_le = htole64((uint64_t)token.timestamp);
+    return XXH64(token.sample, 8, timestamp_le);
+}
+
+void SecMsgBucket::SetActive(SecMsgToken &token, bool active)
+{
+    if (token.m_active == active) {
+        return;
+    }
+    token.m_active = active;
+    if (active) {
+        m_digest += TokenDigest(token);
+        nActive++;
+        m_expiry.emplace_back(token.timestamp + token.ttl, token);
+        std::push_heap(m_expiry.begin(), m_expiry.end(), std::greater<ExpiryEntry>());
+        if (token.ttl > 0 && (nLeastTTL == 0 || token.ttl < nLeastTTL)) {
+            nLeastTTL = token.ttl;
+        }
+    } else {
+        m_digest -= TokenDigest(token);
+        nActive--;
+    }
+    timeChanged = GetTime();
+}
 
+void SecMsgBucket::hashBucket(int64_t bucket_time)
+{
     int64_t now = GetAdjustedTime();
 
+    // Tokens loaded from disk are appended unsorted, keep the first of any duplicates
+    std::stable_sort(vTokens.begin(), vTokens.end());
+    vTokens.erase(std::unique(vTokens.begin(), vTokens.end(),
+        [](const SecMsgToken &a, const SecMsgToken &b) { return !(a < b) && !(b < a); }), vTokens.end());
+
+    m_digest = 0;
+    m_expiry.clear();
     nActive = 0;
     nLeastTTL = 0;
-    for (auto it = setTokens.begin(); it != setTokens.end(); ++it) {
-        if (it->timestamp + it->ttl < now) {
+    for (auto &token : vTokens) {
+        token.m_active = false;
+        if (token.timestamp + token.ttl < now) {
+            continue;
+        }
+        SetActive(token, true);
+    }
+
+    LogPrint(BCLog::SMSG, "Bucket %d hashed %u messages.\n", bucket_time, nActive);
+    return;
+};
+
+bool SecMsgBucket::AddToken(const SecMsgToken &token)
+{
+    auto it = std::lower_bound(vTokens.begin(), vTokens.end(), token);
+    if (it != vTokens.end() && !(token < *it)) {
+        return false;
+    }
+    it = vTokens.insert(it, token);
+    it->m_active = false;
+    if (token.timestamp + token.ttl >= GetAdjustedTime()) {
+        SetActive(*it, true);
+    }
+    return true;
+};
+
+void SecMsgBucket::AddTokens(std::vector<SecMsgToken> &tokens)
+{
+    if (tokens.empty()) {
+        return;
+    }
+    std::sort(tokens.begin(), tokens.end());
+    size_t nOld = vTokens.size();
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        if ((i > 0 && !(tokens[i - 1] < tokens[i])) ||
+            std::binary_search(vTokens.begin(), vTokens.begin() + nOld, tokens[i])) {
             continue;
         }
+        vTokens.push_back(tokens[i]);
+        vTokens.back().m_active = false;
+    }
+    size_t nAdded = vTokens.size() - nOld;
+    if (nAdded == 0) {
+        return;
+    }
+    std::vector<SecMsgToken> added(vTokens.begin() + nOld, vTokens.end());
+    std::inplace_merge(vTokens.begin(), vTokens.begin() + nOld, vTokens.end());
 
-        XXH32_update(state, it->sample, 8);
-        if (it->ttl > 0 && (nLeastTTL == 0 || it->ttl < nLeastTTL)) {
-            nLeastTTL = it->ttl;
+    int64_t now = GetAdjustedTime();
+    for (const auto &token : added) {
+        if (token.timestamp + token.ttl < now) {
+            continue;
+        }
+        auto it = FindToken(token);
+        if (it != vTokens.end()) {
+            SetActive(*it, true);
         }
-        nActive++;
     }
+};
 
-    uint32_t hash_new = XXH32_digest(state);
-    XXH32_freeState(state);
+void SecMsgBucket::PurgeToken(std::vector<SecMsgToken>::iterator it)
+{
+    // The expiry heap entry is dropped when it reaches the top
+    SetActive(*it, false);
+    it->ttl = 0;
+};
+
+void SecMsgBucket::ExpireTokens(int64_t now)
+{
+    while (!m_expiry.empty() && m_expiry.front().expiry < now) {
+        const ExpiryEntry &entry = m_expiry.front();
+        SecMsgToken token;
+        token.timestamp = entry.timestamp;
+        memcpy(token.sample, entry.sample, 8);
+        auto it = FindToken(token);
+        if (it != vTokens.end() && it->timestamp + it->ttl == entry.expiry) {
+            SetActive(*it, false);
+        }
+        std::pop_heap(m_expiry.begin(), m_expiry.end(), std::greater<ExpiryEntry>());
+        m_expiry.pop_back();
+    }
+};
 
-    if (hash != hash_new) {
-        LogPrint(BCLog::SMSG, "Bucket %d hashed %u messages updated from %u to %u.\n", bucket_time, nActive, hash, hash_new);
+std::vector<SecMsgToken>::iterator SecMsgBucket::FindToken(const SecMsgToken &token)
+{
+    auto it = std::lower_bound(vTokens.begin(), vTokens.end(), token);
+    if (it == vTokens.end() || token < *it) {
+        return vTokens.end();
+    }
+    return it;
+};
 
-        hash = hash_new;
-        timeChanged = GetTime();
+std::vector<SecMsgToken>::const_iterator SecMsgBucket::FindToken(const SecMsgToken &token) const
+{
+    auto it = std::lower_bound(vTokens.begin(), vTokens.end(), token);
+    if (it == vTokens.end() || token < *it) {
+        return vTokens.end();
     }
-    return;
+    return it;
+};
+
+uint32_t SecMsgBucket::GetHash() const
+{
+    if (m_hash_set && m_hash_digest == m_digest && m_hash_active == nActive) {
+        return m_hash;
+    }
+
+    XXH32_state_t *state = XXH32_createState();
+    XXH32_reset(state, 1);
+    for (const auto &token : vTokens) {
+        if (token.m_active) {
+            XXH32_update(state, token.sample, 8);
+        }
+    }
+    m_hash = XXH32_digest(state);
+    XXH32_freeState(state);
+
+    m_hash_digest = m_digest;
+    m_hash_active = nActive;
+    m_hash_set = true;
+    return m_hash;
 };
 
 size_t SecMsgBucket::CountActive() const
@@ -176,7 +333,7 @@ size_t SecMsgBucket::CountActive() const
     size_t nMessages = 0;
 
     int64_t now = GetAdjustedTime();
-    for (auto it = setTokens.begin(); it != setTokens.end(); ++it) {
+    for (auto it = vTokens.begin(); it != vTokens.end(); ++it) {
         if (it->timestamp + it->ttl < now) {
             continue;
         }
@@ -186,27 +343,157 @@ size_t SecMsgBucket::CountActive() const
     return nMessages;
 };
 
-/** Bucket management thread
+size_t SecMsgBucket::DynamicMemoryUsage() const
+{
+    return memusage::DynamicUsage(vTokens) + memusage::DynamicUsage(m_expiry);
+};
+
+size_t SecMsgBucketSet::NextUsed(size_t pos) const
+{
+    while (pos < m_span && !Slot(pos).used) {
+        pos++;
+    }
+    return pos;
+};
+
+size_t SecMsgBucketSet::Extend(int64_t time)
+{
+    if (m_span == 0) {
+        m_first_time = time;
+        m_head = 0;
+        m_span = 1;
+        if (m_slots.empty()) {
+            m_slots.resize(64);
+        }
+        return 0;
+    }
+
+    size_t prepend = 0, span = m_span;
+    if (time < m_first_time) {
+        prepend = (m_first_time - time) / SMSG_BUCKET_LEN;
+        span += prepend;
+    } else {
+        span = std::max(span, (size_t)((time - m_first_time) / SMSG_BUCKET_LEN) + 1);
+    }
+
+    if (span > m_slots.size()) {
+        std::vector<BucketSlot> slots(std::max(span, m_slots.size() * 2));
+        for (size_t i = 0; i < m_span; ++i) {
+            std::swap(slots[prepend + i], Slot(i));
+        }
+        m_slots.swap(slots);
+        m_head = 0;
+    } else {
+        m_head = (m_head + m_slots.size() - prepend) % m_slots.size();
+    }
+    m_span = span;
+    if (prepend) {
+        m_first_time = time;
+    }
+    return (time - m_first_time) / SMSG_BUCKET_LEN;
+};
+
+SecMsgBucketSet::iterator SecMsgBucketSet::find(int64_t time)
+{
+    if (m_span == 0 || time < m_first_time || time % SMSG_BUCKET_LEN) {
+        return end();
+    }
+    size_t pos = (time - m_first_time) / SMSG_BUCKET_LEN;
+    if (pos >= m_span || !Slot(pos).used) {
+        return end();
+    }
+    return iterator(this, pos);
+};
+
+SecMsgBucketSet::const_iterator SecMsgBucketSet::find(int64_t time) const
+{
+    if (m_span == 0 || time < m_first_time || time % SMSG_BUCKET_LEN) {
+        return end();
+    }
+    size_t pos = (time - m_first_time) / SMSG_BUCKET_LEN;
+    if (pos >= m_span || !Slot(pos).used) {
+        return end();
+    }
+    return const_iterator(this, pos);
+};
+
+SecMsgBucket &SecMsgBucketSet::operator[](int64_t time)
+{
+    assert(time % SMSG_BUCKET_LEN == 0);
+    BucketSlot &slot = Slot(Extend(time));
+    if (!slot.used) {
+        slot.used = true;
+        slot.value.first = time;
+        m_count++;
+    }
+    return slot.value.second;
+};
+
+SecMsgBucketSet::iterator SecMsgBucketSet::erase(iterator it)
+{
+    BucketSlot &slot = Slot(it.m_pos);
+    assert(slot.used);
+    slot.used = false;
+    slot.value.second = SecMsgBucket();
+    m_count--;
+
+    // Drop unused slots from both ends of the ring
+    size_t dropped = 0;
+    while (m_span > 0 && !Slot(0).used) {
+        m_head = (m_head + 1) % m_slots.size();
+        m_first_time += SMSG_BUCKET_LEN;
+        m_span--;
+        dropped++;
+    }
+    while (m_span > 0 && !Slot(m_span - 1).used) {
+        m_span--;
+    }
+    size_t pos = dropped > it.m_pos ? 0 : it.m_pos + 1 - dropped;
+    return iterator(this, NextUsed(std::min(pos, m_span)));
+};
+
+void SecMsgBucketSet::clear()
+{
+    m_slots.clear();
+    m_head = 0;
+    m_span = 0;
+    m_count = 0;
+    m_first_time = 0;
+};
+
+size_t SecMsgBucketSet::DynamicMemoryUsage() const
+{
+    size_t usage = memusage::DynamicUsage(m_slots);
+    for (const auto &slot : m_slots) {
+        if (slot.used) {
+            usage += slot.value.second.DynamicMemoryUsage();
+        }
+    }
+    return usage;
+};
+
+/** Bucket management, a periodic task on g_task_pool run every SMSG_THREAD_DELAY seconds
   */
-void ThreadSecureMsg(smsg::CSMSG *smsg_module)
+void SecureMsgHousekeeping(smsg::CSMSG *smsg_module)
 {
-    int64_t nLastPrunedFundingTxns = 0;
-    uint32_t nLoop = 0;
+    if (!fSecMsgEnabled) {
+        return;
+    }
     std::vector<std::pair<int64_t, NodeId> > vTimedOutLocks;
-    while (fSecMsgEnabled) {
-        nLoop++;
+    std::map<NodeId, size_t> mapExpiredWants;
+    {
+        uint32_t nLoop = ++smsg_module->m_housekeeping_runs;
         int64_t now = GetAdjustedTime();
 
-        vTimedOutLocks.resize(0);
         int64_t cutoffTime = now - SMSG_RETENTION;
         {
             LOCK(smsg_module->cs_smsg);
-            for (std::map<int64_t, SecMsgBucket>::iterator it(smsg_module->buckets.begin()); it != smsg_module->buckets.end(); ) {
+            for (SecMsgBucketSet::iterator it(smsg_module->buckets.begin()); it != smsg_module->buckets.end(); ) {
                 bool fErase = it->first < cutoffTime;
 
                 if (!fErase
                     && it->first + it->second.nLeastTTL < now) {
-                    it->second.hashBucket(it->first);
+                    it->second.ExpireTokens(now);
 
                     // TODO: periodically prune files
                     if (it->second.nActive < 1) {
@@ -238,7 +525,7 @@ void ThreadSecureMsg(smsg::CSMSG *smsg_module)
                         }
                     }
 
-                    smsg_module->buckets.erase(it++);
+                    it = smsg_module->buckets.erase(it);
                 } else {
                     if (it->second.nLockCount > 0) { // Tick down nLockCount, to eventually expire if peer never sends data
                         it->second.nLockCount--;
@@ -267,20 +554,36 @@ void ThreadSecureMsg(smsg::CSMSG *smsg_module)
                     }
                 }
             }
+
+            // Wanted messages that never arrived can be requested from another peer
+            int64_t local_time = GetTime();
+            for (auto it = smsg_module->m_wanted_tokens.begin(); it != smsg_module->m_wanted_tokens.end(); ) {
+                if (it->second.second < local_time) {
+                    mapExpiredWants[it->second.first]++;
+                    it = smsg_module->m_wanted_tokens.erase(it);
+                } else {
+                    ++it;
+                }
+            }
         } // cs_smsg
 
         if (nLoop % 20 == 0) {
             LOCK(smsg_module->m_node->connman->cs_vNodes);
             for (auto *pnode : smsg_module->m_node->connman->vNodes) {
-                LOCK(pnode->smsgData.cs_smsg_net);
-                int64_t cutoffTime = now - SMSG_SECONDS_IN_DAY;
-                for (auto it = pnode->smsgData.m_buckets_last_shown.begin(); it != pnode->smsgData.m_buckets_last_shown.end(); ) {
-                    if (it->first < cutoffTime) {
-                        it = pnode->smsgData.m_buckets_last_shown.erase(it);
-                    } else {
-                        ++it;
-                    }
+                pnode->smsgData.m_buckets.ExpireShown(now - SMSG_SECONDS_IN_DAY);
+            }
+        }
+
+        if (mapExpiredWants.size() > 0) {
+            LOCK(smsg_module->m_node->connman->cs_vNodes);
+            for (auto *pnode : smsg_module->m_node->connman->vNodes) {
+                const auto it = mapExpiredWants.find(pnode->GetId());
+                if (it == mapExpiredWants.end()) {
+                    continue;
                 }
+                LOCK(pnode->smsgData.cs_smsg_net);
+                LogPrint(BCLog::SMSG, "%u wanted messages from peer %d timed out.\n", it->second, it->first);
+                pnode->smsgData.m_num_want_sent -= std::min((size_t)pnode->smsgData.m_num_want_sent, it->second);
             }
         }
 
@@ -314,13 +617,10 @@ void ThreadSecureMsg(smsg::CSMSG *smsg_module)
             } // g_connman->cs_vNodes
         }
 
-        if (now > nLastPrunedFundingTxns + PRUNE_FUNDING_TX_DATA) {
+        if (now > smsg_module->m_housekeeping_pruned_funding + PRUNE_FUNDING_TX_DATA) {
             smsg_module->PruneFundingTxData();
-            nLastPrunedFundingTxns = now;
+            smsg_module->m_housekeeping_pruned_funding = now;
         }
-
-        // Check every SMSG_THREAD_DELAY seconds
-        smsg_module->m_thread_interrupt.sleep_for(std::chrono::milliseconds(SMSG_THREAD_DELAY * 1000));
     }
     return;
 };
@@ -348,7 +648,7 @@ void ThreadSecureMsgPow(smsg::CSMSG *smsg_module)
             }
 
             // fifo (smallest key first)
-            it = dbOutbox.pdb->NewIterator(leveldb::ReadOptions());
+            it = dbOutbox.NewScanIterator();
         }
         // Break up lock, SecureMsgSetHash will take long
 
@@ -406,7 +706,7 @@ void ThreadSecureMsgPow(smsg::CSMSG *smsg_module)
             // Add to message store
             {
                 LOCK(smsg_module->cs_smsg);
-                if (smsg_module->Store(pHeader, pPayload, smsg.nPayload, true) != 0) {
+                if (smsg_module->Store(pHeader, pPayload, smsg.nPayload) != 0) {
                     LogPrintf("SecMsgPow: Could not place message in buckets, message removed.\n");
                     continue;
                 }
@@ -434,7 +734,18 @@ void AddOptions(ArgsManager& argsman)
     argsman.AddArg("-smsgnotify=<cmd>", "Execute command when a message is received. (%s in cmd is replaced by receiving address)", ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
     argsman.AddArg("-smsgsaddnewkeys", "Scan for incoming messages on new wallet keys. (default: false)", ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
     argsman.AddArg("-smsgbantime=<n>", strprintf("Number of seconds to ignore misbehaving peers for (default: %u)", SMSG_DEFAULT_BANTIME), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgdbcache=<n>", strprintf("Cache and write buffer size of the smsg database in MiB, of which half is block cache (minimum %d, default: %d)", MIN_SMSGDB_CACHE, DEFAULT_SMSGDB_CACHE), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
     argsman.AddArg("-smsgmaxreceive=<n>", strprintf("Max number of data messages to tolerate from peers, counter decreases over time (default: %u)", SMSG_DEFAULT_MAXRCV), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgscanthreads=<n>", strprintf("Number of threads used to trial decrypt incoming messages (%d to %d, 0 = auto, <0 = leave that many cores free, default: %d)", -GetNumCores(), SMSG_MAX_SCAN_THREADS, SMSG_DEFAULT_SCAN_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgpowthreads=<n>", strprintf("Number of threads used for the proof of work of outgoing free messages (%d to %d, 0 = auto, <0 = leave that many cores free, default: %d)", -GetNumCores(), SMSG_MAX_POW_THREADS, SMSG_DEFAULT_POW_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgnetthreads=<n>", strprintf("Number of threads processing smsg messages from peers (1 to %d, default: %d)", SMSG_MAX_NET_THREADS, SMSG_DEFAULT_NET_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgmaxuploadtarget=<n>", strprintf("Tries to keep smsg inventory and messages sent to peers under the given target (in MiB per 24h), recent buckets and paid messages go first, 0 = no limit (default: %d)", SMSG_DEFAULT_MAX_UPLOAD_TARGET), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgpeeruploadrate=<n>", strprintf("Maximum rate of smsg inventory and messages sent to a single peer (in KiB/s), 0 = no limit (default: %d)", SMSG_DEFAULT_PEER_UPLOAD_RATE), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgdecryptcache=<n>", strprintf("Number of decrypted messages kept in memory for listing the inbox and outbox (default: %u)", SMSG_DEFAULT_DECRYPTED_CACHE), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgfundingcache=<n>", strprintf("Number of funding transactions kept in memory to validate paid messages (default: %u)", SMSG_DEFAULT_FUNDING_CACHE), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgdictionary=<file>", strprintf("Dictionary to decompress received messages with, messages compressed against it name it by the first %d bytes of its sha256. Can be specified multiple times (max %d bytes each)", SMSG_DICT_ID_LEN, SMSG_MAX_DICT_BYTES), ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgsenddictionary=<file>", "Compress sent messages against this dictionary, receivers need it as -smsgdictionary to read them and nodes older than this version can't.", ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
+    argsman.AddArg("-smsgrecipienthint", "Prefix sent messages with a short tag of the shared secret so receivers can skip them cheaply, not readable by nodes older than this version. (default: false)", ArgsManager::ALLOW_ANY, OptionsCategory::SMSG);
     argsman.AddArg("-smsgsregtestadjust", "Adjust durations in regtest (default: true)", ArgsManager::ALLOW_ANY, OptionsCategory::HIDDEN);
     return;
 };
@@ -475,6 +786,7 @@ const char *GetString(size_t errorCode)
         case SMSG_PURGED_MSG:                           return "Purged message";
         case SMSG_FUND_DATA_NOT_FOUND:                  return "Fund data not found";
         case SMSG_BATCH_NOT_INITIALISED:                return "Batch not initialised";
+        case SMSG_UNKNOWN_DICTIONARY:                   return "Unknown compression dictionary";
         default:
             return "Unknown error";
     }
@@ -498,9 +810,117 @@ static void ListenWalletAdded(CSMSG *ps, const std::shared_ptr<CWallet>& wallet)
 void CSMSG::ParseArgs(const ArgsManager& args)
 {
     m_track_funding_txns = args.GetBoolArg("-smsg", true);
+    m_add_recipient_hint = args.GetBoolArg("-smsgrecipienthint", false);
 }
 
-/* Build the bucket set by scanning the files in the smsgstore dir.
+static const uint32_t SMSG_BUCKET_INDEX_VERSION = 1;
+
+/* Snapshot the bucket tokens with the size of each bucket file so the next
+ * start can skip reading the files that are unchanged.
+ */
+int CSMSG::WriteBucketIndex()
+{
+    LogPrint(BCLog::SMSG, "%s\n", __func__);
+    LOCK2(cs_smsg, cs_smsgDB);
+
+    fs::path pathSmsgDir = GetDataDir() / STORE_DIR;
+    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
+    ssValue << SMSG_BUCKET_INDEX_VERSION;
+    ssValue << SMSG_BUCKET_LEN;
+
+    std::vector<std::pair<int64_t, uint64_t> > vFiles;
+    for (const auto &it : buckets) {
+        if (it.second.vTokens.empty()) {
+            continue;
+        }
+        boost::system::error_code ec;
+        uint64_t file_size = fs::file_size(pathSmsgDir / (ToString(it.first) + "_01.dat"), ec);
+        if (ec) {
+            continue;
+        }
+        vFiles.emplace_back(it.first, file_size);
+    }
+
+    size_t nTokens = 0;
+    WriteCompactSize(ssValue, vFiles.size());
+    for (const auto &file : vFiles) {
+        const SecMsgBucket &bucket = buckets.find(file.first)->second;
+        ssValue << file.first;
+        ssValue << file.second;
+        WriteCompactSize(ssValue, bucket.vTokens.size());
+        for (const auto &token : bucket.vTokens) {
+            ssValue << token.timestamp;
+            ssValue.write((const char*)token.sample, 8);
+            ssValue << token.offset;
+            ssValue << token.ttl;
+        }
+        nTokens += bucket.vTokens.size();
+    }
+
+    SecMsgDB db;
+    if (!db.Open("cr+")) {
+        return SMSG_GENERAL_ERROR;
+    }
+    std::vector<uint8_t> vIndex(ssValue.begin(), ssValue.end());
+    if (!db.WriteBucketIndex(vIndex)) {
+        return SMSG_GENERAL_ERROR;
+    }
+
+    LogPrint(BCLog::SMSG, "Wrote bucket index, %u buckets containing %u messages.\n", vFiles.size(), nTokens);
+    return SMSG_NO_ERROR;
+};
+
+/* Read and erase the bucket index, an index left from an unclean shutdown is never used.
+ */
+static void LoadBucketIndex(std::map<int64_t, std::pair<uint64_t, std::vector<SecMsgToken> > > &index)
+{
+    LOCK(cs_smsgDB);
+    SecMsgDB db;
+    if (!db.Open("cr+")) {
+        return;
+    }
+
+    std::vector<uint8_t> vIndex;
+    if (!db.ReadBucketIndex(vIndex)) {
+        return;
+    }
+    db.EraseBucketIndex();
+
+    try {
+        CDataStream ssValue(vIndex, SER_DISK, CLIENT_VERSION);
+        uint32_t version, bucket_len;
+        ssValue >> version;
+        ssValue >> bucket_len;
+        if (version != SMSG_BUCKET_INDEX_VERSION || bucket_len != SMSG_BUCKET_LEN) {
+            LogPrintf("Ignoring bucket index, version %u bucket length %u.\n", version, bucket_len);
+            return;
+        }
+        uint64_t nBuckets = ReadCompactSize(ssValue);
+        for (uint64_t i = 0; i < nBuckets; ++i) {
+            int64_t bucket_time;
+            ssValue >> bucket_time;
+            auto &entry = index[bucket_time];
+            ssValue >> entry.first;
+            uint64_t nTokens = ReadCompactSize(ssValue);
+            if (nTokens > ssValue.size() / 28) { // timestamp, sample, offset and ttl
+                throw std::ios_base::failure("token count out of range");
+            }
+            entry.second.resize(nTokens);
+            for (auto &token : entry.second) {
+                ssValue >> token.timestamp;
+                ssValue.read((char*)token.sample, 8);
+                ssValue >> token.offset;
+                ssValue >> token.ttl;
+            }
+        }
+    } catch (const std::exception &e) {
+        LogPrintf("%s: Ignoring bucket index, unserialize threw: %s.\n", __func__, e.what());
+        index.clear();
+    }
+};
+
+/* Build the bucket set from the bucket index and by scanning the files in the smsgstore dir
+ * that are missing from the index or have changed size.
  * buckets should be empty
  */
 int CSMSG::BuildBucketSet()
@@ -510,8 +930,12 @@ int CSMSG::BuildBucketSet()
     int64_t  now            = GetAdjustedTime();
     uint32_t nFiles         = 0;
     uint32_t nMessages      = 0;
+    uint32_t nIndexed       = 0;
     unsigned char header_buffer[SMSG_HDR_LEN];
 
+    std::map<int64_t, std::pair<uint64_t, std::vector<SecMsgToken> > > index;
+    LoadBucketIndex(index);
+
     fs::path pathSmsgDir = GetDataDir() / STORE_DIR;
     fs::directory_iterator itend;
 
@@ -550,6 +974,10 @@ int CSMSG::BuildBucketSet()
             LogPrintf("%s: ParseInt64 failed %s.\n", __func__, stime);
             continue;
         }
+        if (fileTime % SMSG_BUCKET_LEN) {
+            LogPrintf("%s: Not a valid bucket time %s.\n", __func__, stime);
+            continue;
+        }
 
         if (fileTime < now - SMSG_RETENTION) {
             LogPrintf("Dropping file %s, expired.\n", fileName);
@@ -567,12 +995,32 @@ int CSMSG::BuildBucketSet()
         }
 
         size_t nTokenSetSize = 0;
+        auto mi = index.find(fileTime);
+        if (mi != index.end()) {
+            boost::system::error_code ec;
+            uint64_t file_size = fs::file_size(itd->path(), ec);
+            if (!ec && file_size == mi->second.first
+                && fileName == ToString(fileTime) + "_01.dat") {
+                LOCK(cs_smsg);
+                SecMsgBucket &bucket = buckets[fileTime];
+                bucket.vTokens = std::move(mi->second.second);
+                for (auto &token : bucket.vTokens) {
+                    token.m_changed = now - fileTime;
+                }
+                bucket.hashBucket(fileTime);
+                nTokenSetSize = bucket.vTokens.size();
+                nMessages += nTokenSetSize;
+                nIndexed++;
+                LogPrint(BCLog::SMSG, "Bucket %d contains %u messages, from index.\n", fileTime, nTokenSetSize);
+                continue;
+            }
+        }
+
         SecureMessage smsg;
         {
             LOCK(cs_smsg);
 
             SecMsgBucket &bucket = buckets[fileTime];
-            std::set<SecMsgToken> &tokenSet = bucket.setTokens;
 
             FILE *fp;
             if (!(fp = fopen(itd->path().string().c_str(), "rb"))) {
@@ -598,9 +1046,6 @@ int CSMSG::BuildBucketSet()
                 token.ttl = smsg.version[0] == 0 && smsg.version[1] == 0 ? 0  // Purged message header
                     : smsg.m_ttl;
                 token.m_changed = now - fileTime;
-                if (smsg.m_ttl > 0 && (bucket.nLeastTTL == 0 || smsg.m_ttl < bucket.nLeastTTL)) {
-                    bucket.nLeastTTL = smsg.m_ttl;
-                }
                 if (smsg.nPayload < 8) {
                     continue;
                 }
@@ -612,19 +1057,19 @@ int CSMSG::BuildBucketSet()
                     LogPrintf("fseek failed: %s.\n", strerror(errno));
                     break;
                 }
-                tokenSet.insert(token);
+                bucket.vTokens.push_back(token);
             }
 
             fclose(fp);
             bucket.hashBucket(fileTime);
-            nTokenSetSize = tokenSet.size();
+            nTokenSetSize = bucket.vTokens.size();
         } // cs_smsg
 
         nMessages += nTokenSetSize;
         LogPrint(BCLog::SMSG, "Bucket %d contains %u messages.\n", fileTime, nTokenSetSize);
     }
 
-    LogPrintf("Processed %u files, loaded %u buckets containing %u messages.\n", nFiles, buckets.size(), nMessages);
+    LogPrintf("Processed %u files, loaded %u buckets containing %u messages, %u buckets from index.\n", nFiles, buckets.size(), nMessages, nIndexed);
     return SMSG_NO_ERROR;
 };
 
@@ -642,6 +1087,25 @@ int CSMSG::BuildPurgedSets()
     }
 
     int64_t now = GetTime();
+
+    // Markers of messages past the retention window are one key range, copies of them are no longer accepted
+    const int64_t cutoff_time = now - SMSG_RETENTION;
+    size_t nExpired = 0;
+    if (!db.EraseBefore(DBK_PURGED_TOKEN, cutoff_time, nExpired)) {
+        LogPrintf("%s: Failed to erase expired purged tokens.\n", __func__);
+    }
+    if (nExpired > 0) {
+        LogPrint(BCLog::SMSG, "Erased %u expired purged tokens.\n", nExpired);
+    }
+    if (nExpired >= SMSGDB_COMPACT_AFTER_ERASED) {
+        g_task_pool.Submit(TaskPriority::LOW, [cutoff_time]() {
+            SecMsgDB db;
+            if (db.OpenSnapshot()) {
+                db.CompactBefore(DBK_PURGED_TOKEN, cutoff_time);
+            }
+        });
+    }
+
     size_t nPurged = 0;
     uint8_t chKey[30];
     SecMsgPurged purged;
@@ -875,15 +1339,11 @@ int CSMSG::WriteIni()
     return SMSG_NO_ERROR;
 };
 
-bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_ptr<CWallet>> &vpwallets, bool fScanChain)
+static void AdjustRegtestTimes()
 {
-    LogPrintf("Secure messaging starting.\n");
-
-    if (fSecMsgEnabled) {
-        return error("%s: Secure messaging is already started.", __func__);
-    }
     if (Params().NetworkIDString() == "regtest" &&
-        gArgs.GetArg("-smsgsregtestadjust", true)) {
+        gArgs.GetArg("-smsgsregtestadjust", true)
+        && SMSG_SECONDS_IN_DAY != 600) {
         SMSG_SECONDS_IN_HOUR    = 60 * 2; // seconds
         SMSG_BUCKET_LEN         = 60 * 2; // seconds
         SMSG_SECONDS_IN_DAY     = 600;
@@ -893,8 +1353,43 @@ bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_pt
         SMSG_RETENTION          = SMSG_MAX_PAID_TTL;
         LogPrintf("Adjusted SMSG_SECONDS_IN_DAY to %d for regtest.\n", SMSG_SECONDS_IN_DAY);
     }
+}
+
+void CSMSG::StartPreload()
+{
+    if (fSecMsgEnabled || m_preload_thread.joinable()) {
+        return;
+    }
+    AdjustRegtestTimes();
+
+    // The sets only depend on the message store and smsgdb, not on the chain or wallets
+    m_preload_thread = std::thread(&TraceThread<std::function<void()> >, "smsg-load", std::function<void()>([this]() {
+        InitStageTimer timer("smsg bucket sets", true);
+        m_preload_buckets_result = BuildBucketSet();
+        m_preload_purged_result = m_preload_buckets_result == 0 ? BuildPurgedSets() : 0;
+        m_preloaded = true;
+    }));
+}
+
+bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_ptr<CWallet>> &vpwallets, bool fScanChain)
+{
+    LogPrintf("Secure messaging starting.\n");
+
+    if (fSecMsgEnabled) {
+        return error("%s: Secure messaging is already started.", __func__);
+    }
+    AdjustRegtestTimes();
+
+    if (m_preload_thread.joinable()) {
+        m_preload_thread.join();
+    }
+    // Only used once, a later Enable rebuilds the sets
+    const bool preloaded = m_preloaded;
+    m_preloaded = false;
 
     m_smsg_max_receive_count = gArgs.GetArg("-smsgmaxreceive", SMSG_DEFAULT_MAXRCV);
+    SetFundingCacheSize(std::max((int64_t)0, gArgs.GetArg("-smsgfundingcache", SMSG_DEFAULT_FUNDING_CACHE)));
+    SetDecryptedCacheSize(std::max((int64_t)0, gArgs.GetArg("-smsgdecryptcache", SMSG_DEFAULT_DECRYPTED_CACHE)));
 
 #ifdef ENABLE_WALLET
     UnloadAllWallets();
@@ -931,6 +1426,18 @@ bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_pt
         return error("%s: LoadKeyStore failed.", __func__);
     }
 
+    {
+        LOCK(cs_smsgDB);
+        SecMsgDB db;
+        if (!db.Open("cr+") || !db.BuildInboxIndex()) {
+            return error("%s: Could not index the inbox.", __func__);
+        }
+    }
+
+    if (!LoadDictionaries()) {
+        return false;
+    }
+
     if (secp256k1_context_smsg) {
         return error("%s: secp256k1_context_smsg already exists.", __func__);
     }
@@ -947,16 +1454,12 @@ bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_pt
         assert(ret);
     }
 
-    if (fScanChain) {
-        ScanBlockChain();
-    }
-
-    if (BuildBucketSet() != 0) {
+    if ((preloaded ? m_preload_buckets_result : BuildBucketSet()) != 0) {
         Disable();
         return error("%s: Could not load bucket sets, secure messaging disabled.", __func__);
     }
 
-    if (BuildPurgedSets() != 0) {
+    if ((preloaded ? m_preload_purged_result : BuildPurgedSets()) != 0) {
         Disable();
         return error("%s: Could not load purged sets, secure messaging disabled.", __func__);
     }
@@ -964,9 +1467,53 @@ bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_pt
     start_time = GetAdjustedTime();
 
     m_thread_interrupt.reset();
-    thread_smsg = std::thread(&TraceThread<std::function<void()> >, "smsg", std::function<void()>(std::bind(&ThreadSecureMsg, this)));
+    m_housekeeping_runs = 0;
+    m_housekeeping_pruned_funding = 0;
+    m_housekeeping_task = g_task_pool.AddPeriodic(TaskPriority::LOW, std::chrono::seconds(SMSG_THREAD_DELAY), [this]() { SecureMsgHousekeeping(this); });
+    if (!m_housekeeping_task) {
+        LogPrintf("%s: Task pool is not running, smsg bucket housekeeping is disabled.\n", __func__);
+    }
     thread_smsg_pow = std::thread(&TraceThread<std::function<void()> >, "smsg-pow", std::function<void()>(std::bind(&ThreadSecureMsgPow, this)));
 
+    // The thread calling ScanMessage takes part, it counts as one of the scan threads
+    m_num_scan_threads = gArgs.GetArg("-smsgscanthreads", SMSG_DEFAULT_SCAN_THREADS);
+    if (m_num_scan_threads <= 0) {
+        m_num_scan_threads += GetNumCores();
+    }
+    m_num_scan_threads = std::max(0, std::min({m_num_scan_threads, SMSG_MAX_SCAN_THREADS, g_task_pool.NumThreads() + 1}) - 1);
+    LogPrintf("Using %d task pool threads for smsg scanning\n", m_num_scan_threads);
+
+    // An interrupted scan is resumed even without -smsgscanchain
+    StartScanChain(!fScanChain);
+
+    // The smsg-pow thread works on a slice of the nonce space too
+    m_num_pow_threads = gArgs.GetArg("-smsgpowthreads", SMSG_DEFAULT_POW_THREADS);
+    if (m_num_pow_threads <= 0) {
+        m_num_pow_threads += GetNumCores();
+    }
+    m_num_pow_threads = std::max(0, std::min(m_num_pow_threads, SMSG_MAX_POW_THREADS) - 1);
+    LogPrintf("Using %d additional threads for smsg proof of work\n", m_num_pow_threads);
+    for (int i = 0; i < m_num_pow_threads; ++i) {
+        m_pow_threads.create_thread([this, i]() {
+            util::ThreadRename(strprintf("smsgpow.%i", i));
+            m_pow_queue.Thread();
+        });
+    }
+
+    m_upload_target = std::max((int64_t)0, gArgs.GetArg("-smsgmaxuploadtarget", SMSG_DEFAULT_MAX_UPLOAD_TARGET)) * 1024 * 1024;
+    uint64_t upload_rate = m_upload_target / (24 * 60 * 60);
+    m_upload_budget.SetRate(upload_rate, UploadBurst(upload_rate));
+    m_peer_upload_rate = std::max((int64_t)0, gArgs.GetArg("-smsgpeeruploadrate", SMSG_DEFAULT_PEER_UPLOAD_RATE)) * 1024;
+
+    int num_net_threads = std::max(1, std::min((int)gArgs.GetArg("-smsgnetthreads", SMSG_DEFAULT_NET_THREADS), SMSG_MAX_NET_THREADS));
+    {
+        LOCK(m_net_mutex);
+        m_net_running = true;
+    }
+    for (int i = 0; i < num_net_threads; ++i) {
+        m_net_threads.emplace_back(&TraceThread<std::function<void()> >, "smsgnet", std::function<void()>([this]() { ThreadNetWorker(); }));
+    }
+
 #ifdef ENABLE_WALLET
     m_wallet_load_handler = interfaces::MakeHandler(NotifyWalletAdded.connect(std::bind(&ListenWalletAdded, this, std::placeholders::_1)));
 #endif
@@ -976,17 +1523,24 @@ bool CSMSG::Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_pt
 
 bool CSMSG::Shutdown()
 {
+    if (m_preload_thread.joinable()) {
+        m_preload_thread.join();
+    }
     if (!fSecMsgEnabled) {
         return false;
     }
 
     LogPrintf("Stopping secure messaging.\n");
 
+    // Drop queued peer messages before the state they need is taken down
+    StopNetWorkers();
+
     if (m_connect_block_batch) {
         LogPrintf("%s: Closing uncommitted batch.\n", __func__);
         delete m_connect_block_batch;
         m_connect_block_batch = nullptr;
     }
+    m_connect_block_funding.clear();
 
     if (WriteIni() != 0) {
         LogPrintf("Failed to save smsg.ini\n");
@@ -996,16 +1550,32 @@ bool CSMSG::Shutdown()
     m_node->connman->SetLocalServices(ServiceFlags(m_node->connman->GetLocalServices() & ~NODE_SMSG));
 
     m_thread_interrupt();
-    thread_smsg.join();
+    g_task_pool.CancelPeriodic(m_housekeeping_task);
+    m_housekeeping_task = 0;
     thread_smsg_pow.join();
+    if (thread_smsg_scan_chain.joinable()) {
+        thread_smsg_scan_chain.join();
+    }
+    m_num_scan_threads = 0;
+    m_pow_threads.interrupt_all();
+    m_pow_threads.join_all();
+    m_num_pow_threads = 0;
+
+    if (smsgDB && WriteBucketIndex() != SMSG_NO_ERROR) {
+        LogPrintf("Failed to write bucket index.\n");
+    }
 
     if (smsgDB) {
         LOCK(cs_smsgDB);
-        delete smsgDB;
-        smsgDB = nullptr;
+        CloseDB();
     }
 
     keyStore.Clear();
+    {
+        LOCK(m_decrypted_cache_mutex);
+        m_decrypted_cache_list.clear();
+        m_decrypted_cache_map.clear();
+    }
 
     if (secp256k1_context_smsg) {
         secp256k1_context_destroy(secp256k1_context_smsg);
@@ -1051,7 +1621,7 @@ bool CSMSG::Enable(std::shared_ptr<CWallet> pactive_wallet, std::vector<std::sha
             m_node->connman->PushMessage(pnode,
                 CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::PING)); // smsgData.fEnabled will be set on receiving smsgPong response from peer
             m_node->connman->PushMessage(pnode,
-                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::PONG)); // Send pong as have missed initial ping sent by peer when it connected
+                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::PONG, SMSG_VERSION)); // Send pong as have missed initial ping sent by peer when it connected
         }
     }
 
@@ -1075,10 +1645,6 @@ bool CSMSG::Disable()
         }
 
         // Clear buckets
-        std::map<int64_t, SecMsgBucket>::iterator it;
-        for (it = buckets.begin(); it != buckets.end(); ++it) {
-            it->second.setTokens.clear();
-        }
         buckets.clear();
         addresses.clear();
     }
@@ -1210,22 +1776,29 @@ void CSMSG::GetNodesStats(int node_id, UniValue &result)
         obj.pushKV("numwantsent", (int) pnode->smsgData.m_num_want_sent);
         obj.pushKV("receivecounter", (int) pnode->smsgData.m_receive_counter);
         obj.pushKV("ignoredcounter", (int) pnode->smsgData.m_ignored_counter);
-        obj.pushKV("num_pending_inv", (int) pnode->smsgData.m_buckets.size());
-        obj.pushKV("num_shown_buckets", (int) pnode->smsgData.m_buckets_last_shown.size());
+        obj.pushKV("num_pending_inv", (int) pnode->smsgData.m_buckets.NumPending());
+        obj.pushKV("num_shown_buckets", (int) pnode->smsgData.m_buckets.NumShown());
+        obj.pushKV("bucket_state_bytes", (uint64_t) pnode->smsgData.m_buckets.DynamicMemoryUsage());
+        {
+            LOCK(m_net_mutex);
+            auto it = m_net_queue.find(pnode->GetId());
+            obj.pushKV("num_queued", it == m_net_queue.end() ? 0 : (int) it->second.items.size());
+        }
         if (node_id > -1) {
             UniValue pending_inv_buckets(UniValue::VARR);
-            for (auto it = pnode->smsgData.m_buckets.begin(); it != pnode->smsgData.m_buckets.end(); ++it) {
+            for (const auto &pending : pnode->smsgData.m_buckets.GetPending()) {
                 UniValue bucket(UniValue::VOBJ);
-                obj.pushKV("active", (int) it->second.m_active);
-                obj.pushKV("hash", ToString((int64_t)it->second.m_hash));
+                bucket.pushKV("time", pending.first);
+                bucket.pushKV("active", (int) pending.second.m_active);
+                bucket.pushKV("hash", ToString((int64_t)pending.second.m_hash));
                 pending_inv_buckets.push_back(bucket);
             }
             obj.pushKV("pending_inv_buckets", pending_inv_buckets);
             UniValue shown_buckets(UniValue::VARR);
-            for (auto it = pnode->smsgData.m_buckets_last_shown.begin(); it != pnode->smsgData.m_buckets_last_shown.end(); ++it) {
+            for (const auto &shown : pnode->smsgData.m_buckets.GetShown()) {
                 UniValue bucket(UniValue::VOBJ);
-                obj.pushKV("time", it->first);
-                obj.pushKV("last_shown", it->second);
+                bucket.pushKV("time", shown.first);
+                bucket.pushKV("last_shown", shown.second);
                 shown_buckets.push_back(bucket);
             }
             obj.pushKV("shown_buckets", shown_buckets);
@@ -1235,6 +1808,16 @@ void CSMSG::GetNodesStats(int node_id, UniValue &result)
     }
 };
 
+size_t CSMSG::PeerBucketsMemoryUsage()
+{
+    size_t usage = 0;
+    LOCK(m_node->connman->cs_vNodes);
+    for (auto *pnode : m_node->connman->vNodes) {
+        usage += pnode->smsgData.m_buckets.DynamicMemoryUsage();
+    }
+    return usage;
+};
+
 void CSMSG::ClearBanned()
 {
     LOCK(m_node->connman->cs_vNodes);
@@ -1250,11 +1833,10 @@ void CSMSG::ClearBanned()
 
 void CSMSG::ShowFundingTxns(UniValue &result)
 {
-    LOCK(cs_smsgDB);
     UniValue txns(UniValue::VARR);
 
     SecMsgDB db;
-    if (!db.Open("r")) {
+    if (!db.OpenSnapshot()) {
         result.pushKV("error", "Could not open db");
         LogPrintf("%s: ERROR Could not open db.\n", __func__);
         return;
@@ -1262,7 +1844,7 @@ void CSMSG::ShowFundingTxns(UniValue &result)
 
     int height = 0;
     uint256 key;
-    leveldb::Iterator *it = db.pdb->NewIterator(leveldb::ReadOptions());
+    leveldb::Iterator *it = db.NewIterator();
     while (db.NextFundingDataLink(it, height, key)) {
         UniValue obj(UniValue::VOBJ);
         obj.pushKV("height", height);
@@ -1277,6 +1859,173 @@ void CSMSG::ShowFundingTxns(UniValue &result)
 /** Called from ProcessMessage
   * Runs in ThreadMessageHandler2
   */
+bool CSMSG::ListBucketTokens(int64_t time, int64_t last_shown, std::vector<uint8_t> &vchOut)
+{
+    AssertLockHeld(cs_smsg);
+
+    const auto itb = buckets.find(time);
+    if (itb == buckets.end()) {
+        return false;
+    }
+
+    const std::vector<SecMsgToken> &tokenSet = itb->second.vTokens;
+    size_t sz = vchOut.size();
+    try { vchOut.resize(sz + 8 + 16 * tokenSet.size());
+    } catch (std::exception &e) {
+        LogPrintf("vchOut.resize %u threw: %s.\n", sz + 8 + 16 * tokenSet.size(), e.what());
+        return false;
+    }
+    memput_int64_le(&vchOut[sz], time);
+
+    int64_t now = GetAdjustedTime();
+    size_t nMessages = 0;
+    uint8_t *p = &vchOut[sz + 8];
+    for (const auto &token : tokenSet) {
+        if (token.timestamp + token.ttl < now) {
+            continue;
+        }
+        if (time + token.m_changed < last_shown) {
+            continue;
+        }
+        memput_int64_le(p, token.timestamp);
+        memcpy(p+8, &token.sample, 8);
+
+        p += 16;
+        nMessages++;
+    }
+    vchOut.resize(sz + 8 + 16 * nMessages);
+
+    return true;
+};
+
+size_t CSMSG::SiftBucketTokens(int64_t time, const uint8_t *pIn, size_t n, size_t max_tokens, NodeId peer_id, std::vector<uint8_t> &vchOut)
+{
+    AssertLockHeld(cs_smsg);
+
+    SecMsgBucket &bucket = buckets[time];
+    int64_t now = GetTime();
+    size_t nWanted = 0;
+    SecMsgToken token;
+    SecMsgPurged purgedToken;
+    for (size_t i = 0; i < n && nWanted < max_tokens; ++i, pIn += 16) {
+        token.timestamp = memget_int64_le(pIn);
+        memcpy(&token.sample, pIn+8, 8);
+
+        if (setPurgedTimestamps.find(token.timestamp) != setPurgedTimestamps.end()) {
+            purgedToken.timestamp = token.timestamp;
+            memcpy(&purgedToken.sample, pIn+8, 8);
+            if (setPurged.find(purgedToken) != setPurged.end()) {
+                continue;
+            }
+        }
+
+        if (bucket.FindToken(token) != bucket.vTokens.end()) {
+            continue;
+        }
+
+        // Already requested from another peer
+        auto it = m_wanted_tokens.find(token);
+        if (it != m_wanted_tokens.end()
+            && it->second.first != peer_id
+            && it->second.second > now) {
+            continue;
+        }
+        m_wanted_tokens[token] = std::make_pair(peer_id, now + SMSG_WANT_TIMEOUT);
+
+        size_t nd = vchOut.size();
+        try {
+            vchOut.resize(nd + 16);
+        } catch (std::exception &e) {
+            LogPrintf("vchOut.resize %d threw: %s.\n", nd + 16, e.what());
+            break;
+        }
+        memcpy(&vchOut[nd], pIn, 16);
+        nWanted++;
+    }
+
+    return nWanted;
+};
+
+size_t CSMSG::BunchBucketMessages(int64_t time, const uint8_t *pIn, size_t n, size_t max_bunches, std::vector<std::vector<uint8_t> > &vBunches)
+{
+    AssertLockHeld(cs_smsg);
+
+    auto itb = buckets.find(time);
+    if (itb == buckets.end() || max_bunches < 1) {
+        return 0;
+    }
+
+    SecMsgBucket &bucket = itb->second;
+    std::vector<uint8_t> vchOne, vchBunch(4 + 8); // nMessages + bucketTime
+    uint32_t nBunch = 0;
+    size_t nBunches = 0, nMessages = 0;
+
+    // Returns false once max_bunches are full
+    auto append = [&](const std::vector<uint8_t> &vchMsg) {
+        if (nBunch >= MAX_BUNCH_MESSAGES
+            || vchBunch.size() + vchMsg.size() >= MAX_BUNCH_BYTES) {
+            LogPrint(BCLog::SMSG, "Break bunch %u, %u.\n", nBunch, vchBunch.size());
+            if (nBunch > 0) {
+                memput_uint32_le(&vchBunch[0], nBunch);
+                memput_int64_le(&vchBunch[4], time);
+                vBunches.push_back(std::move(vchBunch));
+                nBunches++;
+            }
+            vchBunch.assign(4 + 8, 0);
+            nBunch = 0;
+            if (nBunches >= max_bunches) {
+                return false;
+            }
+        }
+        nBunch++;
+        nMessages++;
+        vchBunch.insert(vchBunch.end(), vchMsg.begin(), vchMsg.end()); // append
+        return true;
+    };
+
+    // Paid messages go first, free messages are held back until all paid messages are bunched
+    std::vector<std::vector<uint8_t> > vFree;
+    bool fFull = false;
+    SecMsgToken token;
+    for (size_t i = 0; i < n; ++i, pIn += 16) {
+        token.timestamp = memget_int64_le(pIn);
+        memcpy(&token.sample, pIn + 8, 8);
+
+        auto it = bucket.FindToken(token);
+        if (it == bucket.vTokens.end()) {
+            LogPrint(BCLog::SMSG, "Don't have wanted message %d.\n", token.timestamp);
+            continue;
+        }
+        token.offset = it->offset;
+
+        // Place in vchOne so if SecureMsgRetrieve fails it won't corrupt vchBunch
+        if (Retrieve(token, vchOne) != SMSG_NO_ERROR) {
+            LogPrintf("SecureMsgRetrieve failed %d.\n", token.timestamp);
+            continue;
+        }
+
+        if (vchOne.size() < SMSG_HDR_LEN || vchOne[8] != 3) { // version[0] of the header
+            vFree.push_back(std::move(vchOne));
+            continue;
+        }
+        if (!append(vchOne)) {
+            fFull = true;
+            break;
+        }
+    }
+    for (size_t i = 0; i < vFree.size() && !fFull; ++i) {
+        fFull = !append(vFree[i]);
+    }
+
+    if (nBunch > 0) {
+        memput_uint32_le(&vchBunch[0], nBunch);
+        memput_int64_le(&vchBunch[4], time);
+        vBunches.push_back(std::move(vchBunch));
+    }
+
+    return nMessages;
+};
+
 int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &strCommand, CDataStream &vRecv)
 {
     /*
@@ -1303,6 +2052,11 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
             (1) A list of the message hashes that a node does not have and wants to retrieve from the node which sent smsgHave
         + smsgMsg =
             (1) In response to
+        + smsgHaves =
+            (1) smsgHave for several buckets at once, sent in response to smsgShow to peers from SMSG_VERSION_BATCH.
+        + smsgWants =
+            (1) smsgWant for several buckets at once, answered with smsgMsg bunches capped by MAX_BUNCH_BYTES.
+            (2) Buckets are not locked, each wanted message is reserved for the peer it was requested from for SMSG_WANT_TIMEOUT.
         + smsgPing = ping request
         + smsgPong = pong response
     */
@@ -1425,7 +2179,7 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
                 if (LogAcceptCategory(BCLog::SMSG)) {
                     LogPrintf("Peer bucket %d %u %u.\n", time, ncontent, hash);
                     if (it_lb != buckets.end()) {
-                        LogPrintf("This bucket %d %u %u.\n", time, it_lb->second.setTokens.size(), it_lb->second.hash);
+                        LogPrintf("This bucket %d %u %u.\n", time, it_lb->second.vTokens.size(), it_lb->second.GetHash());
                     }
                 }
 
@@ -1441,13 +2195,8 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
                 if (it_lb == buckets.end()
                     || it_lb->second.nActive < ncontent
                     || (it_lb->second.nActive == ncontent
-                        && it_lb->second.hash != hash)) { // if same amount in buckets check hash
-                        LOCK(pfrom->smsgData.cs_smsg_net);
-                        auto nv = PeerBucket(ncontent, hash);
-                        auto ret = pfrom->smsgData.m_buckets.insert(std::pair<int64_t, PeerBucket>(time, nv));
-                        if (!ret.second) {
-                            ret.first->second = nv;
-                        }
+                        && it_lb->second.GetHash() != hash)) { // if same amount in buckets check hash
+                        pfrom->smsgData.m_buckets.SetPending(time, ncontent, hash);
                 }
             } // cs_smsg
         }
@@ -1468,72 +2217,67 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
 
         LogPrint(BCLog::SMSG, "Peer %d requests contents of %u buckets.\n", pfrom->GetId(), nBuckets);
 
-        std::map<int64_t, SecMsgBucket>::iterator itb;
-        std::set<SecMsgToken>::iterator it;
+        bool fBatch;
+        {
+            LOCK(pfrom->smsgData.cs_smsg_net);
+            fBatch = pfrom->smsgData.m_version >= SMSG_VERSION_BATCH;
+        }
 
-        std::vector<uint8_t> vchDataOut;
+        // A batch capable peer receives the contents of all requested buckets in as few smsgHaves as possible
+        std::vector<uint8_t> vchDataOut, vchBatch(4);
+        uint32_t nBatch = 0;
         int64_t time;
         uint8_t *pIn = &vchData[4];
         for (uint32_t i = 0; i < nBuckets; ++i, pIn += 8) {
             time = memget_int64_le(pIn);
 
-            int64_t last_shown = 0;
-            {
-                LOCK(pfrom->smsgData.cs_smsg_net);
-                auto it = pfrom->smsgData.m_buckets_last_shown.find(time);
-                if (it != pfrom->smsgData.m_buckets_last_shown.end()) {
-                    last_shown = it->second;
-                }
-            }
+            int64_t last_shown = pfrom->smsgData.m_buckets.GetLastShown(time);
 
+            vchDataOut.clear();
             {
                 LOCK(cs_smsg);
-                itb = buckets.find(time);
-                if (itb == buckets.end()) {
+                if (!ListBucketTokens(time, last_shown, vchDataOut)) {
                     LogPrint(BCLog::SMSG, "Don't have bucket %d.\n", time);
                     continue;
                 }
-
-                std::set<SecMsgToken> &tokenSet = itb->second.setTokens;
-
-                try { vchDataOut.resize(8 + 16 * tokenSet.size());
-                } catch (std::exception &e) {
-                    LogPrintf("vchDataOut.resize %u threw: %s.\n", 8 + 16 * tokenSet.size(), e.what());
-                    continue;
-                }
-                memput_int64_le(&vchDataOut[0], time);
-
-                int64_t now = GetAdjustedTime();
-                size_t nMessages = 0;
-                uint8_t *p = &vchDataOut[8];
-                for (it = tokenSet.begin(); it != tokenSet.end(); ++it) {
-                    if (it->timestamp + it->ttl < now) {
-                        continue;
-                    }
-                    if (time + it->m_changed < last_shown) {
-                        continue;
-                    }
-                    memput_int64_le(p, it->timestamp);
-                    memcpy(p+8, &it->sample, 8);
-
-                    p += 16;
-                    nMessages++;
-                }
-                if (nMessages != tokenSet.size()) {
-                    try { vchDataOut.resize(8 + 16 * nMessages);
-                    } catch (std::exception &e) {
-                        LogPrintf("vchDataOut.resize %u threw: %s.\n", 8 + 16 * nMessages, e.what());
-                        continue;
-                    }
-                }
             }
-            {
+            if (!ReserveUpload(pfrom, vchDataOut.size(), false)) {
+                // Offer the whole inventory again later, the peer asks for what it still misses
+                LogPrint(BCLog::SMSG, "Upload budget reached, not showing %u buckets to peer %d.\n", nBuckets - i, pfrom->GetId());
                 LOCK(pfrom->smsgData.cs_smsg_net);
-                pfrom->smsgData.m_buckets_last_shown[time] = now;
+                pfrom->smsgData.lastMatched = 0;
+                break;
             }
+            pfrom->smsgData.m_buckets.SetLastShown(time, now);
 
+            if (!fBatch) {
+                m_node->connman->PushMessage(pfrom,
+                    CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::HAVE, vchDataOut));
+                continue;
+            }
+
+            if (nBatch > 0 && vchBatch.size() + vchDataOut.size() + 4 > MAX_BUNCH_BYTES) {
+                memput_uint32_le(&vchBatch[0], nBatch);
+                m_node->connman->PushMessage(pfrom,
+                    CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::HAVES, vchBatch));
+                vchBatch.resize(4);
+                nBatch = 0;
+            }
+
+            // time, nTokens, tokens
+            size_t sz = vchBatch.size();
+            vchBatch.resize(sz + 12);
+            memcpy(&vchBatch[sz], &vchDataOut[0], 8);
+            memput_uint32_le(&vchBatch[sz + 8], (vchDataOut.size() - 8) / 16);
+            vchBatch.insert(vchBatch.end(), vchDataOut.begin() + 8, vchDataOut.end());
+            nBatch++;
+        }
+
+        if (nBatch > 0) {
+            LogPrint(BCLog::SMSG, "Sending contents of %u buckets to peer %d.\n", nBatch, pfrom->GetId());
+            memput_uint32_le(&vchBatch[0], nBatch);
             m_node->connman->PushMessage(pfrom,
-                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::HAVE, vchDataOut));
+                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::HAVES, vchBatch));
         }
     } else
     if (strCommand == SMSGMsgType::HAVE) {
@@ -1550,6 +2294,10 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
         int64_t time = memget_int64_le(&vchData[0]);
 
         // Check time valid:
+        if (time % SMSG_BUCKET_LEN) {
+            LogPrint(BCLog::SMSG, "Not a valid bucket time %d.\n", time);
+            return SMSG_GENERAL_ERROR;
+        }
         int64_t now = GetAdjustedTime();
         if (time < now - SMSG_RETENTION) {
             LogPrint(BCLog::SMSG, "Not interested in peer %d bucket %d, has expired.\n", pfrom->GetId(), time);
@@ -1583,39 +2331,9 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
             vchDataOut.resize(8);
             memcpy(&vchDataOut[0], &vchData[0], 8);
 
-            std::set<SecMsgToken> &tokenSet = bucket.setTokens;
-            SecMsgToken token;
-            SecMsgPurged purgedToken;
-            uint8_t *p = &vchData[8];
-
-            for (int i = 0; i < n; ++i, p += 16) {
-                token.timestamp = memget_int64_le(p);
-                memcpy(&token.sample, p+8, 8);
-
-                if (setPurgedTimestamps.find(token.timestamp) != setPurgedTimestamps.end()) {
-                    purgedToken.timestamp = memget_int64_le(p);
-                    memcpy(&purgedToken.sample, p+8, 8);
-                    if (setPurged.find(purgedToken) != setPurged.end()) {
-                        continue;
-                    }
-                }
-
-                std::set<SecMsgToken>::const_iterator it = tokenSet.find(token);
-                if (it == tokenSet.end()) {
-                    int nd = vchDataOut.size();
-                    try {
-                        vchDataOut.resize(nd + 16);
-                    } catch (std::exception &e) {
-                        LogPrintf("vchDataOut.resize %d threw: %s.\n", nd + 16, e.what());
-                        continue;
-                    }
-
-                    memcpy(&vchDataOut[nd], p, 16);
-                }
-            }
-
-            if (vchDataOut.size() > 8) {
-                size_t n_messages = (vchDataOut.size() - 8) / 16;
+            size_t n_messages = SiftBucketTokens(time, &vchData[8], n,
+                MAX_WANT_SENT - pfrom->smsgData.m_num_want_sent, pfrom->GetId(), vchDataOut);
+            if (n_messages > 0) {
                 pfrom->smsgData.m_num_want_sent += n_messages;
                 if (LogAcceptCategory(BCLog::SMSG)) {
                     LogPrintf("Asking peer for %u messages.\n", n_messages);
@@ -1628,79 +2346,196 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
             }
         } // cs_smsg
     } else
-    if (strCommand == SMSGMsgType::WANT) {
+    if (strCommand == SMSGMsgType::HAVES) {
+        // Peer has these messages in several buckets, buckets are not locked so the same bucket can be filled from several peers at once
         std::vector<uint8_t> vchData;
         vRecv >> vchData;
 
-        if (vchData.size() < 8) {
+        if (vchData.size() < 4) {
+            peerLogic->Misbehaving(pfrom->GetId(), 1, "smsg-format");
+            return SMSG_GENERAL_ERROR;
+        }
+
+        uint32_t nBuckets = memget_uint32_le(&vchData[0]);
+        if (nBuckets > (SMSG_RETENTION / SMSG_BUCKET_LEN) + 1) {
+            LogPrintf("Peer sent more buckets than possible %u, %u.\n", nBuckets, (SMSG_RETENTION / SMSG_BUCKET_LEN));
+            SmsgMisbehaving(pfrom, 10);
             return SMSG_GENERAL_ERROR;
         }
 
-        std::vector<uint8_t> vchOne, vchBunch;
+        std::vector<uint8_t> vchDataOut(4);
+        uint32_t nWantBuckets = 0;
+        size_t nWanted = 0;
+        {
+            LOCK2(cs_smsg, pfrom->smsgData.cs_smsg_net);
+
+            size_t ofs = 4;
+            for (uint32_t i = 0; i < nBuckets; ++i) {
+                if (vchData.size() - ofs < 12) {
+                    LogPrintf("Peer did not send enough data.\n");
+                    SmsgMisbehaving(pfrom, 10);
+                    break;
+                }
+                int64_t time = memget_int64_le(&vchData[ofs]);
+                uint32_t n = memget_uint32_le(&vchData[ofs + 8]);
+                ofs += 12;
+                if ((vchData.size() - ofs) / 16 < n) {
+                    LogPrintf("Peer did not send enough data.\n");
+                    SmsgMisbehaving(pfrom, 10);
+                    break;
+                }
+                const uint8_t *pIn = vchData.data() + ofs;
+                ofs += 16 * n;
+
+                if (time % SMSG_BUCKET_LEN) {
+                    LogPrint(BCLog::SMSG, "Not a valid bucket time %d.\n", time);
+                    SmsgMisbehaving(pfrom, 10);
+                    break;
+                }
+                if (time < now - SMSG_RETENTION
+                    || time > now + SMSG_TIME_LEEWAY) {
+                    LogPrint(BCLog::SMSG, "Not interested in peer %d bucket %d.\n", pfrom->GetId(), time);
+                    continue;
+                }
+                if (pfrom->smsgData.m_num_want_sent >= MAX_WANT_SENT) {
+                    LogPrint(BCLog::SMSG, "Too many messages already requested from peer: %d, %d.\n", pfrom->GetId(), pfrom->smsgData.m_num_want_sent);
+                    break;
+                }
+
+                const auto it_lb = buckets.find(time);
+                if (it_lb != buckets.end() && it_lb->second.nLockCount > 0) {
+                    LogPrint(BCLog::SMSG, "Bucket %d lock count %u, waiting for message data from peer %u.\n", time, it_lb->second.nLockCount, it_lb->second.nLockPeerId);
+                    continue;
+                }
+
+                size_t sz = vchDataOut.size();
+                vchDataOut.resize(sz + 12);
+                memput_int64_le(&vchDataOut[sz], time);
+                size_t n_messages = SiftBucketTokens(time, pIn, n,
+                    MAX_WANT_SENT - pfrom->smsgData.m_num_want_sent, pfrom->GetId(), vchDataOut);
+                if (n_messages == 0) {
+                    vchDataOut.resize(sz);
+                    continue;
+                }
+                memput_uint32_le(&vchDataOut[sz + 8], n_messages);
+                pfrom->smsgData.m_num_want_sent += n_messages;
+                nWanted += n_messages;
+                nWantBuckets++;
+            }
+
+            if (nWantBuckets > 0) {
+                LogPrint(BCLog::SMSG, "Asking peer %d for %u messages from %u buckets.\n", pfrom->GetId(), nWanted, nWantBuckets);
+                memput_uint32_le(&vchDataOut[0], nWantBuckets);
+                m_node->connman->PushMessage(pfrom,
+                    CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::WANTS, vchDataOut));
+            }
+        } // cs_smsg
+    } else
+    if (strCommand == SMSGMsgType::WANT) {
+        std::vector<uint8_t> vchData;
+        vRecv >> vchData;
 
-        vchBunch.resize(4 + 8); // nMessages + bucketTime
+        if (vchData.size() < 8) {
+            return SMSG_GENERAL_ERROR;
+        }
 
         int n = (vchData.size() - 8) / 16;
 
         int64_t time = memget_int64_le(&vchData[0]);
-        uint32_t nBunch = 0;
 
+        // Send a single bunch, peer will send more want messages if needed.
+        std::vector<std::vector<uint8_t> > vBunches;
         {
             LOCK(cs_smsg);
-            auto itb = buckets.find(time);
-            if (itb == buckets.end()) {
+            if (buckets.find(time) == buckets.end()) {
                 LogPrint(BCLog::SMSG, "Don't have bucket %d.\n", time);
                 return SMSG_GENERAL_ERROR;
             }
+            BunchBucketMessages(time, &vchData[8], n, 1, vBunches);
+        } // cs_smsg
 
-            std::set<SecMsgToken> &tokenSet = itb->second.setTokens;
-            std::set<SecMsgToken>::iterator it;
-            SecMsgToken token;
-            uint8_t *p = &vchData[8];
-            for (int i = 0; i < n; ++i) {
-                token.timestamp = memget_int64_le(p);
-                memcpy(&token.sample, p + 8, 8);
-
-                it = tokenSet.find(token);
-                if (it == tokenSet.end()) {
-                    LogPrint(BCLog::SMSG, "Don't have wanted message %d.\n", token.timestamp);
-                } else {
-                    token.offset = it->offset;
+        for (const auto &vchBunch : vBunches) {
+            if (!ReserveUpload(pfrom, vchBunch.size(), true)) {
+                LogPrint(BCLog::SMSG, "Upload budget reached, not sending messages of bucket %d to peer %d.\n", time, pfrom->GetId());
+                break;
+            }
+            LogPrint(BCLog::SMSG, "Sending block of %u messages for bucket %d.\n", memget_uint32_le(&vchBunch[0]), time);
+            m_node->connman->PushMessage(pfrom,
+                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::MSG, vchBunch));
+        }
+    } else
+    if (strCommand == SMSGMsgType::WANTS) {
+        std::vector<uint8_t> vchData;
+        vRecv >> vchData;
 
-                    // Place in vchOne so if SecureMsgRetrieve fails it won't corrupt vchBunch
-                    if (Retrieve(token, vchOne) != SMSG_NO_ERROR) {
-                        LogPrintf("SecureMsgRetrieve failed %d.\n", token.timestamp);
-                        continue;
-                    }
+        if (vchData.size() < 4) {
+            peerLogic->Misbehaving(pfrom->GetId(), 1, "smsg-format");
+            return SMSG_GENERAL_ERROR;
+        }
 
-                    if (nBunch >= MAX_BUNCH_MESSAGES
-                        || vchBunch.size() + vchOne.size() >= MAX_BUNCH_BYTES) {
-                        LogPrint(BCLog::SMSG, "Break bunch %u, %u.\n", nBunch, vchBunch.size());
-                        break; // end here, peer will send more want messages if needed.
-                    }
-                    nBunch++;
-                    vchBunch.insert(vchBunch.end(), vchOne.begin(), vchOne.end()); // append
+        uint32_t nBuckets = memget_uint32_le(&vchData[0]);
+
+        // Messages from all requested buckets are sent back to back in bunches capped by MAX_BUNCH_BYTES
+        std::vector<std::vector<uint8_t> > vBunches;
+        size_t nMessages = 0;
+        // Requested buckets by time, offset and number of tokens, the most recent are served first
+        std::vector<std::tuple<int64_t, size_t, size_t> > vRequested;
+        size_t ofs = 4;
+        for (uint32_t i = 0; i < nBuckets; ++i) {
+            if (vchData.size() - ofs < 12) {
+                break;
+            }
+            int64_t time = memget_int64_le(&vchData[ofs]);
+            size_t n = std::min((size_t)memget_uint32_le(&vchData[ofs + 8]), (vchData.size() - (ofs + 12)) / 16);
+            ofs += 12;
+            vRequested.emplace_back(time, ofs, n);
+            ofs += 16 * n;
+        }
+        std::stable_sort(vRequested.begin(), vRequested.end(), [](const std::tuple<int64_t, size_t, size_t> &a, const std::tuple<int64_t, size_t, size_t> &b) {
+            return std::get<0>(a) > std::get<0>(b);
+        });
+        {
+            LOCK(cs_smsg);
+            for (size_t i = 0; i < vRequested.size() && nMessages < MAX_WANT_SENT; ++i) {
+                int64_t time;
+                size_t ofs_tokens, n;
+                std::tie(time, ofs_tokens, n) = vRequested[i];
+                if (time % SMSG_BUCKET_LEN == 0 && buckets.find(time) != buckets.end()) {
+                    nMessages += BunchBucketMessages(time, vchData.data() + ofs_tokens, std::min(n, MAX_WANT_SENT - nMessages), MAX_WANT_SENT, vBunches);
+                } else {
+                    LogPrint(BCLog::SMSG, "Don't have bucket %d.\n", time);
                 }
-                p += 16;
             }
         } // cs_smsg
 
-        if (nBunch > 0) {
-            LogPrint(BCLog::SMSG, "Sending block of %u messages for bucket %d.\n", nBunch, time);
-
-            memput_uint32_le(&vchBunch[0], nBunch);
-            memput_int64_le(&vchBunch[4], time);
+        LogPrint(BCLog::SMSG, "Sending %u messages in %u bunches to peer %d.\n", nMessages, vBunches.size(), pfrom->GetId());
+        for (size_t i = 0; i < vBunches.size(); ++i) {
+            if (!ReserveUpload(pfrom, vBunches[i].size(), true)) {
+                // The peer is shown the held back buckets in full again, it wants the messages once more
+                LogPrint(BCLog::SMSG, "Upload budget reached, holding back %u bunches from peer %d.\n", vBunches.size() - i, pfrom->GetId());
+                for (; i < vBunches.size(); ++i) {
+                    pfrom->smsgData.m_buckets.SetLastShown(memget_int64_le(&vBunches[i][4]), 0);
+                }
+                LOCK(pfrom->smsgData.cs_smsg_net);
+                pfrom->smsgData.lastMatched = 0;
+                break;
+            }
             m_node->connman->PushMessage(pfrom,
-                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::MSG, vchBunch));
+                CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::MSG, vBunches[i]));
         }
     } else
     if (strCommand == SMSGMsgType::MSG) {
-        std::vector<uint8_t> vchData;
-        vRecv >> vchData;
+        // Messages are validated and stored straight from the receive buffer
+        uint64_t nData = ReadCompactSize(vRecv);
+        if (nData > vRecv.size()) {
+            peerLogic->Misbehaving(pfrom->GetId(), 1, "smsg-format");
+            return SMSG_GENERAL_ERROR;
+        }
 
-        LogPrint(BCLog::SMSG, "smsgMsg vchData.size() %u.\n", vchData.size());
+        LogPrint(BCLog::SMSG, "smsgMsg size %u.\n", nData);
 
-        Receive(peerLogic, pfrom, vchData);
+        Receive(peerLogic, pfrom, Span<const uint8_t>((const uint8_t*)vRecv.data(), nData));
+        vRecv.ignore(nData);
     } else
     if (strCommand == SMSGMsgType::PING) {
         // smsgPing is the initial message, send reply
@@ -1770,6 +2605,141 @@ int CSMSG::ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &
 /** Called from ProcessMessage
   * Runs in ThreadMessageHandler2
   */
+static bool IsSmsgMessageType(const std::string &strCommand)
+{
+    for (const auto &type : SMSGMsgType::allTypes) {
+        if (type == strCommand) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int CSMSG::QueueReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &strCommand, CDataStream &vRecv)
+{
+    if (!IsSmsgMessageType(strCommand)) {
+        return SMSG_UNKNOWN_MESSAGE;
+    }
+    {
+        LOCK(m_net_mutex);
+        if (m_net_running) {
+            const NodeId id = pfrom->GetId();
+            const size_t bytes = vRecv.size();
+            PeerNetQueue &queue = m_net_queue[id];
+            if (queue.items.size() >= SMSG_NET_QUEUE_PEER_MESSAGES ||
+                queue.bytes + bytes > SMSG_NET_QUEUE_PEER_BYTES) {
+                LogPrint(BCLog::SMSG, "Dropping %s from peer %d, %u messages queued.\n", strCommand, id, queue.items.size());
+                return SMSG_GENERAL_ERROR;
+            }
+            pfrom->AddRef();
+            queue.items.push_back(NetQueueItem{peerLogic, pfrom, strCommand, std::make_shared<CDataStream>(std::move(vRecv)), bytes});
+            queue.bytes += bytes;
+            if (queue.items.size() == 1 && !queue.busy) {
+                m_net_ready.push_back(id);
+                m_net_cv.notify_one();
+            }
+            return SMSG_NO_ERROR;
+        }
+    }
+    // Not started or shutting down, ReceiveData is cheap when disabled
+    return ReceiveData(peerLogic, pfrom, strCommand, vRecv);
+};
+
+void CSMSG::GetNetQueueDepth(size_t &messages, size_t &bytes)
+{
+    LOCK(m_net_mutex);
+    messages = 0;
+    bytes = 0;
+    for (const auto &it : m_net_queue) {
+        messages += it.second.items.size();
+        bytes += it.second.bytes;
+    }
+};
+
+void CSMSG::ThreadNetWorker()
+{
+    WAIT_LOCK(m_net_mutex, lock);
+    while (true) {
+        while (m_net_running && m_net_ready.empty()) {
+            m_net_cv.wait(lock);
+        }
+        if (!m_net_running) {
+            return;
+        }
+        const NodeId id = m_net_ready.front();
+        m_net_ready.pop_front();
+        PeerNetQueue &queue = m_net_queue[id];
+        NetQueueItem item = std::move(queue.items.front());
+        queue.items.pop_front();
+        queue.bytes -= item.bytes;
+        queue.busy = true;
+        {
+            REVERSE_LOCK(lock);
+            if (!item.pfrom->fDisconnect) {
+                try {
+                    ReceiveData(item.peer_logic, item.pfrom, item.command, *item.data);
+                } catch (const std::exception &e) {
+                    LogPrint(BCLog::SMSG, "%s: %s from peer %d: %s\n", __func__, item.command, id, e.what());
+                }
+            }
+            g_recv_buffer_pool.Release(item.data->TakeBuffer());
+            item.pfrom->Release();
+        }
+        // Other peers go first
+        queue.busy = false;
+        if (!queue.items.empty()) {
+            m_net_ready.push_back(id);
+        } else {
+            m_net_queue.erase(id);
+        }
+    }
+};
+
+void CSMSG::StopNetWorkers()
+{
+    {
+        LOCK(m_net_mutex);
+        m_net_running = false;
+    }
+    m_net_cv.notify_all();
+    for (auto &thread : m_net_threads) {
+        thread.join();
+    }
+    m_net_threads.clear();
+
+    LOCK(m_net_mutex);
+    for (auto &queue : m_net_queue) {
+        for (auto &item : queue.second.items) {
+            item.pfrom->Release();
+        }
+    }
+    m_net_queue.clear();
+    m_net_ready.clear();
+};
+
+bool CSMSG::UploadAvailable(CNode *pto, size_t bytes)
+{
+    int64_t now = GetTimeMicros();
+    return pto->smsgData.m_upload_budget.Available(bytes, now)
+        && m_upload_budget.Available(bytes, now);
+};
+
+bool CSMSG::ReserveUpload(CNode *pto, size_t bytes, bool is_msg)
+{
+    int64_t now = GetTimeMicros();
+    if (!pto->smsgData.m_upload_budget.Consume(bytes, now)) {
+        (is_msg ? m_upload_msg_deferred : m_upload_inv_deferred)++;
+        return false;
+    }
+    if (!m_upload_budget.Consume(bytes, now)) {
+        pto->smsgData.m_upload_budget.Refund(bytes);
+        (is_msg ? m_upload_msg_deferred : m_upload_inv_deferred)++;
+        return false;
+    }
+    (is_msg ? m_upload_msg_bytes : m_upload_inv_bytes) += bytes;
+    return true;
+};
+
 bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
 {
     if (::ChainstateActive().IsInitialBlockDownload()) { // Wait until chain synced
@@ -1790,9 +2760,10 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
             // Send smsgPong message if received smsgPing from peer while syncing chain
             if (pto->smsgData.lastSeen < 0) {
                 m_node->connman->PushMessage(pto,
-                    CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::PONG));
+                    CNetMsgMaker(INIT_PROTO_VERSION).Make(SMSGMsgType::PONG, SMSG_VERSION));
             }
 
+            pto->smsgData.m_upload_budget.SetRate(m_peer_upload_rate, UploadBurst(m_peer_upload_rate));
             pto->smsgData.lastSeen = GetTime();
             return true;
         } else
@@ -1808,9 +2779,14 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
     std::vector<uint8_t> vchData;
     {
         LOCK2(cs_smsg, pto->smsgData.cs_smsg_net);
+        // Don't walk the buckets for an inventory the upload budgets can't cover yet
+        if (pto->smsgData.lastMatched <= m_last_changed
+            && !UploadAvailable(pto, 4 + buckets.size() * 16)) {
+            m_upload_inv_deferred++;
+        } else
         if (pto->smsgData.lastMatched <= m_last_changed) {
 
-            std::map<int64_t, SecMsgBucket>::iterator it;
+            SecMsgBucketSet::iterator it;
 
             /*
             Get time before loop and after looping through messages set nLastMatched to time before loop.
@@ -1841,7 +2817,7 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
                     continue;
                 }
 
-                uint32_t hash = bkt.hash;
+                uint32_t hash = bkt.GetHash();
 
                 if (LogAcceptCategory(BCLog::SMSG)) {
                     LogPrintf("Preparing bucket with hash %d for transfer to node %d. timeChanged=%d > lastMatched=%d\n", hash, pto->GetId(), bkt.timeChanged, pto->smsgData.lastMatched);
@@ -1864,9 +2840,9 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
                 nBucketsShown++;
             }
         }
-        buckets_to_process = pto->smsgData.m_buckets.size();
+        buckets_to_process = pto->smsgData.m_buckets.NumPending();
     }
-    if (nBucketsShown > 0) {
+    if (nBucketsShown > 0 && ReserveUpload(pto, vchData.size(), false)) {
         LOCK(pto->smsgData.cs_smsg_net);
         memput_uint32_le(&vchData[0], nBucketsShown);
         LogPrint(BCLog::SMSG, "Sending %d bucket headers.\n", nBucketsShown);
@@ -1882,27 +2858,29 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
     size_t nBucketsContestReq = 0;
     if (buckets_to_process > 0) {
         LOCK2(cs_smsg, pto->smsgData.cs_smsg_net);
-        for (auto it = pto->smsgData.m_buckets.begin(); it != pto->smsgData.m_buckets.end();) {
+        // Buckets are only reserved for a single peer at a time when the peer can't send batches
+        bool fBatch = pto->smsgData.m_version >= SMSG_VERSION_BATCH;
+        for (const auto &pending : pto->smsgData.m_buckets.GetPending()) {
             if (nBucketsContestReq >= SMSG_MAX_SHOW) {
                  break;
             }
+            const int64_t bucket_time = pending.first;
+            const PeerBucket &bkt = pending.second;
 
-            const auto it_sr = m_show_requests.find(it->first);
-            if (it_sr != m_show_requests.end() && it_sr->second > now) {
-                ++it;
+            const auto it_sr = m_show_requests.find(bucket_time);
+            if (!fBatch && it_sr != m_show_requests.end() && it_sr->second > now) {
                 continue; // Waiting for peer response
             }
 
-            PeerBucket &bkt = it->second;
-            const auto it_lb = buckets.find(it->first);
+            const auto it_lb = buckets.find(bucket_time);
 
             if (it_lb == buckets.end()
                 || (it_lb->second.nLockPeerId < 0 || it_lb->second.nLockPeerId == pto->GetId())) {
                 if (it_lb != buckets.end() &&
-                    (it_lb->second.nActive > bkt.m_active || (it_lb->second.nActive == bkt.m_active && it_lb->second.hash == bkt.m_hash))) {
-                    LogPrint(BCLog::SMSG, "Not requesting list of bucket %d.\n", it->first);
+                    (it_lb->second.nActive > bkt.m_active || (it_lb->second.nActive == bkt.m_active && it_lb->second.GetHash() == bkt.m_hash))) {
+                    LogPrint(BCLog::SMSG, "Not requesting list of bucket %d.\n", bucket_time);
                 } else {
-                    LogPrint(BCLog::SMSG, "Requesting list of bucket %d from peer %d.\n", it->first, pto->GetId());
+                    LogPrint(BCLog::SMSG, "Requesting list of bucket %d from peer %d.\n", bucket_time, pto->GetId());
                     size_t sz = vchData.size();
                     try { vchData.resize(sz + 8 + (sz == 0 ? 4 : 0)); } catch (std::exception& e) {
                         LogPrintf("vchData.resize %u threw: %s.\n", vchData.size() + 8 + (sz == 0 ? 4 : 0), e.what());
@@ -1911,14 +2889,14 @@ bool CSMSG::SendData(CNode *pto, bool fSendTrickle)
                     if (sz == 0) {
                         sz = 4;
                     }
-                    memput_int64_le(&vchData[sz], it->first);
+                    memput_int64_le(&vchData[sz], bucket_time);
                     nBucketsContestReq++;
-                    m_show_requests[it->first] = now + 10;
+                    if (!fBatch) {
+                        m_show_requests[bucket_time] = now + 10;
+                    }
                 }
-                pto->smsgData.m_buckets.erase(it++);
-                continue;
+                pto->smsgData.m_buckets.ErasePending(bucket_time, bkt);
             }
-            ++it;
         }
     }
     if (nBucketsContestReq > 0) {
@@ -1972,14 +2950,9 @@ static int InsertAddress(CKeyID &hashKey, CPubKey &pubKey)
     return InsertAddress(hashKey, pubKey, addrpkdb);
 };
 
-static bool ScanBlock(CSMSG &smsg, const CBlock &block, SecMsgDB &addrpkdb,
-    uint32_t &nTransactions, uint32_t &nElements, uint32_t &nPubkeys, uint32_t &nDuplicates) EXCLUSIVE_LOCKS_REQUIRED(cs_smsgDB)
+/** Collect the public keys of the inputs of standard txns and coinstakes */
+static void GetBlockPubKeys(const CBlock &block, std::vector<CPubKey> &pubkeys, uint32_t &nTransactions)
 {
-    AssertLockHeld(cs_smsgDB);
-
-    std::string reason;
-
-    // Only scan inputs of standard txns and coinstakes
     for (const auto &tx : block.vtx) {
         // Harvest public keys from coinstake txns
 
@@ -2005,12 +2978,7 @@ static bool ScanBlock(CSMSG &smsg, const CBlock &block, SecMsgDB &addrpkdb,
                 LogPrintf("Public key is invalid %s.\n", HexStr(pubKey));
                 continue;
             }
-
-            CKeyID addrKey = pubKey.GetID();
-            switch (InsertAddress(addrKey, pubKey, addrpkdb)) {
-                case SMSG_NO_ERROR: nPubkeys++; break;          // added key
-                case SMSG_PUBKEY_EXISTS: nDuplicates++; break;  // duplicate key
-            }
+            pubkeys.push_back(pubKey);
 
             if (tx->IsCoinStake()) { // coinstake inputs are always from the same address/pubkey
                 break;
@@ -2018,9 +2986,37 @@ static bool ScanBlock(CSMSG &smsg, const CBlock &block, SecMsgDB &addrpkdb,
         }
 
         nTransactions++;
+    }
+};
 
-        if (nTransactions % 10000 == 0) { // for ScanChainForPublicKeys
-            LogPrintf("Scanning transaction no. %u.\n", nTransactions);
+bool CSMSGScanBlockCheck::operator()()
+{
+    CBlock block;
+    if (!ReadBlockFromDisk(block, m_pos, Params().GetConsensus(), SERIALIZE_TRANSACTION_NO_RANGEPROOF)) {
+        LogPrintf("%s: ReadBlockFromDisk failed.\n", __func__);
+        return true; // Keep scanning the other blocks
+    }
+    GetBlockPubKeys(block, *m_pubkeys, *m_num_txns);
+    return true;
+};
+
+static bool ScanBlock(CSMSG &smsg, const CBlock &block, SecMsgDB &addrpkdb,
+    uint32_t &nTransactions, uint32_t &nElements, uint32_t &nPubkeys, uint32_t &nDuplicates) EXCLUSIVE_LOCKS_REQUIRED(cs_smsgDB)
+{
+    AssertLockHeld(cs_smsgDB);
+
+    // Only scan inputs of standard txns and coinstakes
+    std::vector<CPubKey> pubkeys;
+    GetBlockPubKeys(block, pubkeys, nTransactions);
+    std::vector<CKeyID> ids;
+    GetKeyIDs(pubkeys, ids);
+
+    for (size_t i = 0; i < pubkeys.size(); ++i) {
+        CPubKey &pubKey = pubkeys[i];
+        CKeyID &addrKey = ids[i];
+        switch (InsertAddress(addrKey, pubKey, addrpkdb)) {
+            case SMSG_NO_ERROR: nPubkeys++; break;          // added key
+            case SMSG_PUBKEY_EXISTS: nDuplicates++; break;  // duplicate key
         }
     }
     return true;
@@ -2061,7 +3057,7 @@ bool CSMSG::ScanBlock(const CBlock &block)
     return true;
 };
 
-bool CSMSG::ScanChainForPublicKeys(CBlockIndex *pindexStart)
+bool CSMSG::ScanChain(const CBlockIndex *pindexStart)
 {
     LogPrintf("Scanning block chain for public keys.\n");
     int64_t nStart = GetTimeMillis();
@@ -2073,63 +3069,203 @@ bool CSMSG::ScanChainForPublicKeys(CBlockIndex *pindexStart)
 
     uint32_t nBlocks        = 0;
     uint32_t nTransactions  = 0;
-    uint32_t nInputs        = 0;
     uint32_t nPubkeys       = 0;
     uint32_t nDuplicates    = 0;
 
-    {
-        LOCK(cs_smsgDB);
+    m_scan_chain_height = pindexStart->nHeight - 1;
+    m_scan_chain_pubkeys = 0;
+    m_scan_chain_duplicates = 0;
 
-        SecMsgDB addrpkdb;
-        if (!addrpkdb.Open("cw")
-            || !addrpkdb.TxnBegin()) {
-            return false;
+    // Blocks are read in parallel a chunk at a time, the keys and progress of each chunk are committed in one batch
+    bool rv = true;
+    const CBlockIndex *pindex = pindexStart;
+    while (pindex && !m_thread_interrupt) {
+        std::vector<FlatFilePos> vPos;
+        const CBlockIndex *pindexLast = nullptr;
+        {
+            LOCK(cs_main);
+            if (!::ChainActive().Contains(pindex)) {
+                // Reorganised away since the last chunk, continue from the fork
+                const CBlockIndex *pindexFork = ::ChainActive().FindFork(pindex);
+                pindex = pindexFork ? ::ChainActive().Next(pindexFork) : ::ChainActive().Genesis();
+            }
+            while (pindex && vPos.size() < (size_t)SMSG_SCAN_CHAIN_CHUNK) {
+                if (pindex->nStatus & BLOCK_HAVE_DATA) {
+                    vPos.push_back(pindex->GetBlockPos());
+                }
+                pindexLast = pindex;
+                pindex = ::ChainActive().Next(pindex);
+            }
+            m_scan_chain_tip = ::ChainActive().Height();
+        }
+        if (!pindexLast) {
+            break;
         }
 
-        CBlockIndex *pindex = pindexStart;
-        while (pindex) {
-            nBlocks++;
-            CBlock block;
-            if (!ReadBlockFromDisk(block, pindex, Params().GetConsensus())) {
-                LogPrintf("%s: ReadBlockFromDisk failed.\n", __func__);
-            } else {
-                smsg::ScanBlock(*this, block, addrpkdb,
-                    nTransactions, nInputs, nPubkeys, nDuplicates);
+        std::vector<std::vector<CPubKey> > vPubkeys(vPos.size());
+        std::vector<uint32_t> vNumTxns(vPos.size(), 0);
+        {
+            std::vector<CSMSGScanBlockCheck> checks;
+            checks.reserve(vPos.size());
+            for (size_t i = 0; i < vPos.size(); ++i) {
+                checks.emplace_back(vPos[i], &vPubkeys[i], &vNumTxns[i]);
             }
+            g_task_pool.ParallelFor(TaskPriority::LOW, checks.size(), [&checks](size_t i) { checks[i](); }, m_num_scan_threads);
+        }
 
-            pindex = ::ChainActive().Next(pindex);
+        {
+            LOCK(cs_smsgDB);
+            SecMsgDB addrpkdb;
+            if (!addrpkdb.Open("cw")) {
+                rv = false;
+                break;
+            }
+
+            leveldb::WriteBatch batch;
+            std::set<CKeyID> setAdded;
+            std::vector<CKeyID> ids;
+            for (const auto &pubkeys : vPubkeys) {
+                GetKeyIDs(pubkeys, ids);
+                for (size_t i = 0; i < pubkeys.size(); ++i) {
+                    const CPubKey &pubKey = pubkeys[i];
+                    const CKeyID &addrKey = ids[i];
+                    if (!setAdded.insert(addrKey).second
+                        || addrpkdb.ExistsPK(addrKey)) {
+                        nDuplicates++;
+                        continue;
+                    }
+                    PutPK(&batch, addrKey, pubKey);
+                    nPubkeys++;
+                }
+            }
+            PutScanChainProgress(&batch, pindexLast->GetBlockHash(), pindexLast->nHeight);
+            if (!addrpkdb.CommitBatch(&batch)) {
+                rv = false;
+                break;
+            }
+        } // cs_smsgDB
+
+        nBlocks += vPos.size();
+        for (auto n : vNumTxns) {
+            nTransactions += n;
         }
+        m_scan_chain_height = pindexLast->nHeight;
+        m_scan_chain_pubkeys = nPubkeys;
+        m_scan_chain_duplicates = nDuplicates;
+        LogPrint(BCLog::SMSG, "Scanned to height %d of %d.\n", pindexLast->nHeight, m_scan_chain_tip);
+    }
 
-        addrpkdb.TxnCommit();
-    } // cs_smsgDB
+    if (rv && !pindex) {
+        LOCK(cs_smsgDB);
+        SecMsgDB addrpkdb;
+        if (addrpkdb.Open("cw")) {
+            addrpkdb.EraseScanChainProgress();
+        }
+    } else
+    if (rv) {
+        LogPrintf("Chain scan interrupted at height %d.\n", m_scan_chain_height);
+    }
 
-    LogPrintf("Scanned %u blocks, %u transactions, %u inputs\n", nBlocks, nTransactions, nInputs);
+    LogPrintf("Scanned %u blocks, %u transactions\n", nBlocks, nTransactions);
     LogPrintf("Found %u public keys, %u duplicates.\n", nPubkeys, nDuplicates);
     LogPrintf("Took %d ms\n", GetTimeMillis() - nStart);
 
-    return true;
+    return rv;
+};
+
+bool CSMSG::ScanChainForPublicKeys(const CBlockIndex *pindexStart)
+{
+    bool expected = false;
+    if (!m_scan_chain_running.compare_exchange_strong(expected, true)) {
+        return error("%s: A chain scan is already running.", __func__);
+    }
+    bool rv = ScanChain(pindexStart);
+    m_scan_chain_running = false;
+    return rv;
 };
 
 bool CSMSG::ScanBlockChain()
 {
-    TRY_LOCK(cs_main, lockMain);
-    if (lockMain) {
-        CBlockIndex *pindexScan = ::ChainActive().Genesis();
-        if (pindexScan == nullptr) {
-            return error("%s: pindexGenesisBlock not set.", __func__);
+    const CBlockIndex *pindexScan = nullptr;
+    {
+        LOCK(cs_main);
+        pindexScan = ::ChainActive().Genesis();
+    }
+    if (pindexScan == nullptr) {
+        return error("%s: pindexGenesisBlock not set.", __func__);
+    }
+
+    try { // In try to catch errors opening db,
+        if (!ScanChainForPublicKeys(pindexScan)) {
+            return false;
         }
+    } catch (std::exception &e) {
+        return error("%s: threw: %s.", __func__, e.what());
+    }
 
-        try { // In try to catch errors opening db,
-            if (!ScanChainForPublicKeys(pindexScan)) {
-                return false;
+    return true;
+};
+
+bool CSMSG::StartScanChain(bool resume_only)
+{
+    bool expected = false;
+    if (!m_scan_chain_running.compare_exchange_strong(expected, true)) {
+        return error("%s: A chain scan is already running.", __func__);
+    }
+    if (thread_smsg_scan_chain.joinable()) {
+        thread_smsg_scan_chain.join();
+    }
+
+    uint256 block_hash;
+    int height = 0;
+    bool resume = false;
+    {
+        LOCK(cs_smsgDB);
+        SecMsgDB addrpkdb;
+        resume = addrpkdb.Open("cw") && addrpkdb.ReadScanChainProgress(block_hash, height);
+    }
+    if (!resume && resume_only) {
+        m_scan_chain_running = false;
+        return true;
+    }
+
+    const CBlockIndex *pindexScan = nullptr;
+    {
+        LOCK(cs_main);
+        pindexScan = ::ChainActive().Genesis();
+        if (resume) {
+            BlockMap::iterator mi = g_chainman.BlockIndex().find(block_hash);
+            const CBlockIndex *pindexFork = mi != g_chainman.BlockIndex().end() ? ::ChainActive().FindFork(mi->second) : nullptr;
+            if (pindexFork) {
+                pindexScan = ::ChainActive().Next(pindexFork);
+                if (!pindexScan) {
+                    // Interrupted after the last chunk was committed
+                    LOCK(cs_smsgDB);
+                    SecMsgDB addrpkdb;
+                    if (addrpkdb.Open("cw")) {
+                        addrpkdb.EraseScanChainProgress();
+                    }
+                    m_scan_chain_running = false;
+                    return true;
+                }
             }
-        } catch (std::exception &e) {
-            return error("%s: threw: %s.", __func__, e.what());
         }
-    } else {
-        return error("%s: Could not lock main.", __func__);
+    }
+    if (pindexScan == nullptr) {
+        m_scan_chain_running = false;
+        return error("%s: pindexGenesisBlock not set.", __func__);
     }
 
+    LogPrintf("%s chain scan for public keys from height %d.\n", resume ? "Resuming" : "Starting", pindexScan->nHeight);
+    thread_smsg_scan_chain = std::thread(&TraceThread<std::function<void()> >, "smsg-scan", std::function<void()>([this, pindexScan]() {
+        try {
+            ScanChain(pindexScan);
+        } catch (std::exception &e) {
+            LogPrintf("%s: threw: %s.\n", __func__, e.what());
+        }
+        m_scan_chain_running = false;
+    }));
+
     return true;
 };
 
@@ -2450,29 +3586,127 @@ int CSMSG::WalletUnlocked(CWallet *pwallet)
     // Notify gui
     NotifySecMsgWalletUnlocked();
 #endif
-    return SMSG_NO_ERROR;
+    return SMSG_NO_ERROR;
+};
+
+/** When a key changes in the wallet, this function should be called to update the addresses vector.
+  *
+  * mode:
+  *  CT_NEW : a new key was added
+  *  CT_DELETED : delete an existing key from vector.
+  */
+int CSMSG::WalletKeyChanged(CKeyID &keyId, const std::string &sLabel, ChangeType mode)
+{
+    if (!fSecMsgEnabled) {
+        return SMSG_DISABLED;
+    }
+
+    LogPrintf("%s\n", __func__);
+
+    if (!gArgs.GetBoolArg("-smsgsaddnewkeys", false)) {
+        LogPrint(BCLog::SMSG, "%s smsgsaddnewkeys option is disabled.\n", __func__);
+        return SMSG_GENERAL_ERROR;
+    }
+
+    return ManageLocalKey(keyId, mode);
+};
+
+bool CSMSGValidateCheck::operator()()
+{
+    SecureMessage smsg(m_msg->m_header);
+    if (m_backdated_target && !smsg.IsPaidVersion() && smsg.timestamp < m_backdated_before) {
+        // If a free message is backdated, compare the hash to the current difficulty
+        uint256 msg_hash;
+        m_smsg->GetPowHash(&smsg, m_msg->m_payload, m_msg->m_payload_len, msg_hash);
+        if (UintToArith256(msg_hash) > *m_backdated_target) {
+            m_msg->m_refused = true;
+            return true;
+        }
+    }
+    m_msg->m_rv = m_smsg->Validate(&smsg, m_msg->m_payload, m_msg->m_payload_len);
+    m_msg->m_validated = m_msg->m_rv == SMSG_NO_ERROR;
+    return true; // Keep validating the other messages
+};
+
+bool CSMSGScanCheck::operator()()
+{
+    if (m_match->load(std::memory_order_relaxed) < m_index) {
+        return true; // An earlier key already matched
+    }
+
+    MessageData msg;
+    if (m_smsg->Decrypt(true, m_key->key, m_key->address, m_header, m_payload, m_payload_len, msg) != SMSG_NO_ERROR) {
+        return true;
+    }
+
+    size_t match = m_match->load();
+    while (m_index < match && !m_match->compare_exchange_weak(match, m_index)) {
+    }
+    return false;
+};
+
+void CSMSG::GetScanKeys(std::vector<SecMsgScanKey> &keys, bool &was_locked)
+{
+    AssertLockHeld(cs_smsg);
+
+    keys.clear();
+    for (const auto &p : keyStore.mapKeys) {
+        const auto &key = p.second;
+        if (!(key.nFlags & SMK_RECEIVE_ON)) {
+            continue;
+        }
+        keys.emplace_back(p.first, key.key, key.nFlags & SMK_RECEIVE_ANON);
+    }
+
+#ifdef ENABLE_WALLET
+    for (const auto &smsg_address : addresses) {
+        if (!smsg_address.fReceiveEnabled) {
+            continue;
+        }
+
+        CKey keyDest;
+        for (const auto &pw : m_vpwallets) {
+            if (pw->IsLocked()) {
+                if (pw->HaveKey(smsg_address.address)) {
+                    was_locked = true;
+                }
+                continue;
+            }
+            if (pw->GetKey(smsg_address.address, keyDest)) {
+                break;
+            }
+        }
+        if (!keyDest.IsValid()) {
+            continue;
+        }
+        keys.emplace_back(smsg_address.address, keyDest, smsg_address.fReceiveAnon);
+    }
+#endif
 };
 
-/** When a key changes in the wallet, this function should be called to update the addresses vector.
-  *
-  * mode:
-  *  CT_NEW : a new key was added
-  *  CT_DELETED : delete an existing key from vector.
-  */
-int CSMSG::WalletKeyChanged(CKeyID &keyId, const std::string &sLabel, ChangeType mode)
+size_t CSMSG::FindScanKey(const std::vector<SecMsgScanKey> &keys, size_t start, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload)
 {
-    if (!fSecMsgEnabled) {
-        return SMSG_DISABLED;
+    if (m_num_scan_threads < 1 || keys.size() - start < 2) {
+        MessageData msg; // placeholder
+        for (size_t i = start; i < keys.size(); ++i) {
+            if (Decrypt(true, keys[i].key, keys[i].address, pHeader, pPayload, nPayload, msg) == SMSG_NO_ERROR) {
+                return i;
+            }
+        }
+        return keys.size();
     }
 
-    LogPrintf("%s\n", __func__);
-
-    if (!gArgs.GetBoolArg("-smsgsaddnewkeys", false)) {
-        LogPrint(BCLog::SMSG, "%s smsgsaddnewkeys option is disabled.\n", __func__);
-        return SMSG_GENERAL_ERROR;
+    std::atomic<size_t> match{keys.size()};
+    std::vector<CSMSGScanCheck> checks;
+    checks.reserve(keys.size() - start);
+    for (size_t i = start; i < keys.size(); ++i) {
+        checks.emplace_back(this, &keys[i], i, pHeader, pPayload, nPayload, &match);
     }
 
-    return ManageLocalKey(keyId, mode);
+    // Keys are handed out in order, a match stops the trials of the later keys
+    g_task_pool.ParallelFor(TaskPriority::HIGH, checks.size(), [&checks](size_t i) { checks[i](); }, m_num_scan_threads);
+
+    return match.load();
 };
 
 /** Check if message belongs to this node.
@@ -2481,95 +3715,43 @@ int CSMSG::WalletKeyChanged(CKeyID &keyId, const std::string &sLabel, ChangeType
   * if !reportToGui don't fire NotifySecMsgInboxChanged
   *  - loads messages received when wallet locked in bulk.
   */
-int CSMSG::ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool reportToGui, bool &fOwnMessage, bool unlocking)
+int CSMSG::ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool reportToGui, bool &fOwnMessage, bool unlocking, SecMsgInboxBatch *batch)
 {
     LogPrint(BCLog::SMSG, "%s\n", __func__);
 
+    const int64_t nTimeStart = GetTimeMicros();
     fOwnMessage = false;
+
+    // Copy the receiving keys so the trial decryptions can run without cs_smsg
+    std::vector<SecMsgScanKey> scan_keys;
+    bool was_locked = false;
+    {
+        LOCK(cs_smsg);
+        GetScanKeys(scan_keys, was_locked);
+    }
+
     MessageData msg; // placeholder
     CKeyID addressTo;
-    for (auto &p : smsgModule.keyStore.mapKeys) {
-        auto &address = p.first;
-        auto &key = p.second;
+    for (size_t i = 0; (i = FindScanKey(scan_keys, i, pHeader, pPayload, nPayload)) < scan_keys.size(); ++i) {
+        const SecMsgScanKey &scan_key = scan_keys[i];
 
-        if (!(key.nFlags & SMK_RECEIVE_ON)) {
+        // Have to do full decrypt to see address from
+        if (!scan_key.receive_anon &&
+            (Decrypt(false, scan_key.key, scan_key.address, pHeader, pPayload, nPayload, msg) != 0 ||
+             msg.sFromAddress.compare("anon") == 0)) {
             continue;
         }
-
-        if (!(key.nFlags & SMK_RECEIVE_ANON)) {
-            // Have to do full decrypt to see address from
-            if (Decrypt(false, key.key, address, pHeader, pPayload, nPayload, msg) == 0) {
-                if (LogAcceptCategory(BCLog::SMSG)) {
-                    LogPrintf("Decrypted message with %s.\n", EncodeDestination(PKHash(addressTo)));
-                }
-                if (msg.sFromAddress.compare("anon") != 0) {
-                    fOwnMessage = true;
-                }
-                addressTo = address;
-                break;
-            }
-        } else {
-            if (Decrypt(true, key.key, address, pHeader, pPayload, nPayload, msg) == 0) {
-                if (LogAcceptCategory(BCLog::SMSG)) {
-                    LogPrintf("Decrypted message with %s.\n", EncodeDestination(PKHash(addressTo)));
-                }
-                fOwnMessage = true;
-                addressTo = address;
-                break;
-            }
-        }
-    }
-
-    bool was_locked = false;
-    if (!fOwnMessage) {
-#ifdef ENABLE_WALLET
-
-        for (std::vector<SecMsgAddress>::iterator it = addresses.begin(); it != addresses.end(); ++it) {
-            if (!it->fReceiveEnabled) {
-                continue;
-            }
-
-            addressTo = it->address;
-
-            CKey keyDest;
-            for (const auto &pw : m_vpwallets) {
-                if (pw->IsLocked()) {
-                    if (pw->HaveKey(addressTo)) {
-                        was_locked = true;
-                    }
-                    continue;
-                }
-                if (pw->GetKey(addressTo, keyDest)) {
-                    break;
-                }
-            }
-            if (!keyDest.IsValid()) {
-                continue;
-            }
-
-            if (!it->fReceiveAnon) {
-                // Have to do full decrypt to see address from
-                if (Decrypt(false, keyDest, addressTo, pHeader, pPayload, nPayload, msg) == 0) {
-                    if (LogAcceptCategory(BCLog::SMSG)) {
-                        LogPrintf("Decrypted message with %s.\n", EncodeDestination(PKHash(addressTo)));
-                    }
-                    if (msg.sFromAddress.compare("anon") != 0) {
-                        fOwnMessage = true;
-                    }
-                    break;
-                }
-            } else {
-                if (Decrypt(true, keyDest, addressTo, pHeader, pPayload, nPayload, msg) == 0) {
-                    if (LogAcceptCategory(BCLog::SMSG)) {
-                        LogPrintf("Decrypted message with %s.\n", EncodeDestination(PKHash(addressTo)));
-                    }
-                    fOwnMessage = true;
-                    break;
-                }
-            }
+        addressTo = scan_key.address;
+        if (LogAcceptCategory(BCLog::SMSG)) {
+            LogPrintf("Decrypted message with %s.\n", EncodeDestination(PKHash(addressTo)));
         }
-#endif
+        fOwnMessage = true;
+        break;
     }
+    static MetricHistogram &scan_seconds = g_metrics.Histogram("ghost_smsg_scan_seconds", "Time to trial decrypt a message with the local receiving keys");
+    const int64_t nScanMicros = GetTimeMicros() - nTimeStart;
+    scan_seconds.Observe(nScanMicros);
+    TRACE3(smsg, scan, scan_keys.size(), fOwnMessage, nScanMicros);
 
     if (!fOwnMessage && was_locked && !unlocking) {
         LogPrint(BCLog::SMSG, "%s: Wallet is locked, storing message to scan later.\n", __func__);
@@ -2600,25 +3782,31 @@ int CSMSG::ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t
         smsgInbox.status        = (SMSG_MASK_UNREAD) & 0xFF;
         smsgInbox.addrTo        = addressTo;
 
-        try { smsgInbox.vchMessage.resize(SMSG_HDR_LEN + nPayload); } catch (std::exception &e) {
-            return errorN(SMSG_ALLOCATE_FAILED, "%s: Could not resize vchData, %u, %s.", __func__, SMSG_HDR_LEN + nPayload, e.what());
-        }
-        memcpy(&smsgInbox.vchMessage[0], pHeader, SMSG_HDR_LEN);
-        memcpy(&smsgInbox.vchMessage[SMSG_HDR_LEN], pPayload, nPayload);
 
         bool fExisted = false;
         {
             LOCK(cs_smsgDB);
             SecMsgDB dbInbox;
+            SecMsgDB *pdb = batch ? &batch->db : &dbInbox;
 
-            if (dbInbox.Open("cw")) {
-                if (dbInbox.ExistsSmesg(chKey)) {
+            if (batch || dbInbox.Open("cw")) {
+                if (pdb->ExistsSmesg(chKey)) {
                     fExisted = true;
                     LogPrint(BCLog::SMSG, "Message already exists in inbox db.\n");
                 } else {
-                    dbInbox.WriteSmesg(chKey, smsgInbox);
-                    if (reportToGui) {
-                        NotifySecMsgInboxChanged(smsgInbox);
+                    // Written straight from pHeader and pPayload, vchMessage is only filled for listeners
+                    pdb->WriteSmesg(chKey, smsgInbox, pHeader, pPayload, nPayload);
+                    if (batch) {
+                        batch->writes++;
+                    }
+                    if (reportToGui && !NotifySecMsgInboxChanged.empty()) {
+                        smsgInbox.vchMessage.assign(pHeader, pHeader + SMSG_HDR_LEN);
+                        smsgInbox.vchMessage.insert(smsgInbox.vchMessage.end(), pPayload, pPayload + nPayload);
+                        if (batch) {
+                            batch->notify.push_back([smsgInbox]() mutable { NotifySecMsgInboxChanged(smsgInbox); });
+                        } else {
+                            NotifySecMsgInboxChanged(smsgInbox);
+                        }
                     }
                     LogPrintf("SecureMsg saved to inbox, received with %s.\n", EncodeDestination(PKHash(addressTo)));
                 }
@@ -2627,17 +3815,31 @@ int CSMSG::ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t
 
 #if HAVE_SYSTEM
         if (!fExisted) {
-            // notify an external script when a message comes in
-            std::string strCmd = gArgs.GetArg("-smsgnotify", "");
-
-            //TODO: Format message
-            if (!strCmd.empty()) {
-                boost::replace_all(strCmd, "%s", EncodeDestination(PKHash(addressTo)));
-                std::thread t(runCommand, strCmd);
-                t.detach(); // thread runs free
-            }
+            std::vector<uint8_t> vchHeader(pHeader, pHeader + SMSG_HDR_LEN);
+            std::vector<uint8_t> vchPayload(pPayload, pPayload + nPayload);
+            auto notify = [addressTo, vchHeader, vchPayload, hash]() {
+                // notify an external script when a message comes in
+                std::string strCmd = gArgs.GetArg("-smsgnotify", "");
+
+                //TODO: Format message
+                if (!strCmd.empty()) {
+                    boost::replace_all(strCmd, "%s", EncodeDestination(PKHash(addressTo)));
+                    std::thread t(runCommand, strCmd);
+                    t.detach(); // thread runs free
+                }
 
-            GetMainSignals().NewSecureMessage(&smsg, hash);
+                SecureMessage smsg(vchHeader.data());
+                // Borrowed for the call, the message must not free it
+                smsg.pPayload = (uint8_t*)vchPayload.data();
+                smsg.nPayload = vchPayload.size();
+                GetMainSignals().NewSecureMessage(&smsg, hash, addressTo);
+                smsg.pPayload = nullptr;
+            };
+            if (batch) {
+                batch->notify.push_back(notify);
+            } else {
+                notify();
+            }
         }
 #endif
     }
@@ -2710,10 +3912,9 @@ int CSMSG::GetStoredKey(const CKeyID &ckid, CPubKey &cpkOut)
     LogPrint(BCLog::SMSG, "%s\n", __func__);
 
     {
-        LOCK(cs_smsgDB);
         SecMsgDB addrpkdb;
 
-        if (!addrpkdb.Open("r")) {
+        if (!addrpkdb.OpenSnapshot()) {
             return SMSG_GENERAL_ERROR;
         }
 
@@ -2721,7 +3922,7 @@ int CSMSG::GetStoredKey(const CKeyID &ckid, CPubKey &cpkOut)
             //LogPrintf("addrpkdb.Read failed: %s.\n", coinAddress.ToString());
             return SMSG_PUBKEY_NOT_EXISTS;
         }
-    } // cs_smsgDB
+    }
 
     return SMSG_NO_ERROR;
 };
@@ -2825,10 +4026,8 @@ int CSMSG::ImportPrivkey(const CBitcoinSecret &vchSecret, const std::string &sLa
 
 int CSMSG::DumpPrivkey(const CKeyID &idk, CKey &key_out)
 {
-    LOCK(cs_smsgDB);
-
     SecMsgDB db;
-    if (!db.Open("cr+")) {
+    if (!db.OpenSnapshot()) {
         return SMSG_GENERAL_ERROR;
     }
 
@@ -2914,10 +4113,8 @@ bool CSMSG::SetSmsgAddressOption(const CKeyID &idk, std::string sOption, bool fV
 
 int CSMSG::ReadSmsgKey(const CKeyID &idk, CKey &key)
 {
-    LOCK(cs_smsgDB);
-
     SecMsgDB db;
-    if (!db.Open("cr+")) {
+    if (!db.OpenSnapshot()) {
         return SMSG_GENERAL_ERROR;
     }
 
@@ -3053,7 +4250,7 @@ int CSMSG::SmsgMisbehaving(CNode *pfrom, uint8_t n)
     return 0;
 };
 
-int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &vchData)
+int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, Span<const uint8_t> vchData)
 {
     LogPrint(BCLog::SMSG, "%s\n", __func__);
 
@@ -3061,8 +4258,8 @@ int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &v
         return errorN(SMSG_GENERAL_ERROR, "%s - Not enough data.", __func__);
     }
 
-    uint32_t nBunch = memget_uint32_le(&vchData[0]);
-    int64_t bktTime = memget_int64_le(&vchData[4]);
+    uint32_t nBunch = memget_uint32_le(vchData.data());
+    int64_t bktTime = memget_int64_le(vchData.data() + 4);
 
     // Check bktTime ()
     // Bucket may not exist yet - will be created when messages are added
@@ -3096,7 +4293,7 @@ int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &v
             LOCK(cs_smsg);
             // Release lock on bucket if it exists
             auto itb = buckets.find(bktTime);
-            if (itb != buckets.end()) {
+            if (itb != buckets.end() && itb->second.nLockPeerId == pfrom->GetId()) {
                 itb->second.nLockCount = 0;
                 itb->second.nLockPeerId = -1;
             }
@@ -3104,66 +4301,65 @@ int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &v
         return SMSG_GENERAL_ERROR;
     }
 
+    TRACE_TIME_START(trace_start);
     uint32_t n = 12;
+    bool fTruncated = false;
+    std::vector<SecMsgReceived> chunk;
+    chunk.reserve(std::min((size_t)nBunch, RECEIVE_CHUNK_MESSAGES));
+
+    for (uint32_t i = 0; i < nBunch && !fTruncated;) {
+        chunk.clear();
+        for (; i < nBunch && chunk.size() < RECEIVE_CHUNK_MESSAGES; ++i) {
+            if (vchData.size() - n < SMSG_HDR_LEN) {
+                LogPrintf("Error: not enough data sent, n = %u.\n", n);
+                fTruncated = true;
+                break;
+            }
 
-    for (uint32_t i = 0; i < nBunch; ++i) {
-        if (vchData.size() - n < SMSG_HDR_LEN) {
-            LogPrintf("Error: not enough data sent, n = %u.\n", n);
+            const uint8_t *pHeader = vchData.data() + n;
+            SecureMessage smsg(pHeader);
+            if (vchData.size() - n - SMSG_HDR_LEN < smsg.nPayload) {
+                LogPrintf("Error: not enough data sent for payload, n = %u.\n", n);
+                fTruncated = true;
+                break;
+            }
+            chunk.emplace_back(pHeader, pHeader + SMSG_HDR_LEN, smsg.nPayload);
+            n += SMSG_HDR_LEN + smsg.nPayload;
+        }
+        if (chunk.empty()) {
             break;
         }
 
-        SecureMessage smsg(&vchData[n]);
-        const uint8_t *pPayload = &vchData[n + SMSG_HDR_LEN];
-        if (!smsg.IsPaidVersion() &&
-            now - start_time > SMSG_BUCKET_LEN * 2) { // buckets should be fully matched after time
-            if (smsg.timestamp < now - SMSG_BUCKET_LEN * 3) {
-                // If a free message is backdated, compare the hash to the current difficulty
-
-                uint256 msg_hash;
-                arith_uint256 target;
-                GetPowHash(&smsg, pPayload, smsg.nPayload, msg_hash);
-                {
-                    LOCK(cs_main);
-                    target.SetCompact(GetSmsgDifficulty(now, true));
-                }
+        ReceiveChunk(chunk, now);
 
-                if (UintToArith256(msg_hash) > target) {
-                    LogPrint(BCLog::SMSG, "Refusing free message %d, in the past.\n", smsg.timestamp);
-                    continue;
-                }
+        // Penalties are summed over the chunk and applied once
+        int nInvalidHash = 0, nFundFailed = 0, nFormat = 0;
+        for (const auto &msg : chunk) {
+            if (msg.m_refused || msg.m_validated) {
+                continue;
             }
-        }
-
-        int rv;
-        if ((rv = Validate(&smsg, pPayload, smsg.nPayload)) != 0) {
-            // Message dropped
-            if (rv == SMSG_INVALID_HASH) { // Invalid proof of work
-                SmsgMisbehaving(pfrom, 10);
+            if (msg.m_rv == SMSG_INVALID_HASH) { // Invalid proof of work
+                nInvalidHash++;
             } else
-            if (rv == SMSG_FUND_FAILED) { // Bad funding tx
-                peerLogic->Misbehaving(pfrom->GetId(), 10, "smsg-fundtx");
+            if (msg.m_rv == SMSG_FUND_FAILED) { // Bad funding tx
+                nFundFailed++;
             } else {
-                peerLogic->Misbehaving(pfrom->GetId(), 1, "smsg-format");
+                nFormat++;
             }
-            continue;
         }
-
-        {
-            LOCK(cs_smsg);
-            // Store message, but don't hash bucket
-            if (Store(&vchData[n], &vchData[n + SMSG_HDR_LEN], smsg.nPayload, false) != 0) {
-                // Message dropped
-                break;
-            }
-
-            bool fOwnMessage;
-            if (ScanMessage(&vchData[n], &vchData[n + SMSG_HDR_LEN], smsg.nPayload, true, fOwnMessage) != 0) {
-                // message recipient is not this node (or failed)
-            }
-        } // cs_smsg
-
-        n += SMSG_HDR_LEN + smsg.nPayload;
+        if (nInvalidHash > 0) {
+            SmsgMisbehaving(pfrom, std::min(nInvalidHash * 10, 255));
+        }
+        if (nFundFailed > 0) {
+            peerLogic->Misbehaving(pfrom->GetId(), nFundFailed * 10, "smsg-fundtx");
+        }
+        if (nFormat > 0) {
+            peerLogic->Misbehaving(pfrom->GetId(), nFormat, "smsg-format");
+        }
     }
+    static MetricCounter &received = g_metrics.Counter("ghost_smsg_received_total", "Messages received from peers");
+    received.Inc(nBunch);
+    TRACE5(smsg, receive, pfrom->GetId(), bktTime, nBunch, vchData.size(), TRACE_TIME_ELAPSED(trace_start));
 
     {
         LOCK(cs_smsg);
@@ -3174,14 +4370,95 @@ int CSMSG::Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &v
             return SMSG_GENERAL_ERROR;
         }
 
-        itb->second.nLockCount  = 0; // This node has received data from peer, release lock
-        itb->second.nLockPeerId = -1;
-        itb->second.hashBucket(itb->first);
+        if (itb->second.nLockPeerId == pfrom->GetId()) {
+            itb->second.nLockCount  = 0; // This node has received data from peer, release lock
+            itb->second.nLockPeerId = -1;
+        }
     } // cs_smsg
 
     return SMSG_NO_ERROR;
 };
 
+void CSMSG::ReceiveChunk(std::vector<SecMsgReceived> &chunk, int64_t now)
+{
+    {
+        LOCK(cs_smsg);
+        for (const auto &msg : chunk) {
+            SecureMessage smsg(msg.m_header);
+            m_wanted_tokens.erase(SecMsgToken(smsg.timestamp, msg.m_payload, msg.m_payload_len, 0, 0));
+        }
+    } // cs_smsg
+
+    // Buckets should be fully matched after time, backdated free messages must meet the current difficulty
+    arith_uint256 backdated_target;
+    const arith_uint256 *pBackdatedTarget = nullptr;
+    if (now - start_time > SMSG_BUCKET_LEN * 2) {
+        LOCK(cs_main);
+        backdated_target.SetCompact(GetSmsgDifficulty(now, true));
+        pBackdatedTarget = &backdated_target;
+    }
+
+    std::vector<CSMSGValidateCheck> checks;
+    checks.reserve(chunk.size());
+    for (auto &msg : chunk) {
+        checks.emplace_back(this, &msg, pBackdatedTarget, now - SMSG_BUCKET_LEN * 3);
+    }
+    g_task_pool.ParallelFor(TaskPriority::NORMAL, checks.size(), [&checks](size_t i) { checks[i](); }, m_num_scan_threads);
+    for (const auto &msg : chunk) {
+        if (msg.m_refused) {
+            LogPrint(BCLog::SMSG, "Refusing free message %d, in the past.\n", SecureMessage(msg.m_header).timestamp);
+        }
+    }
+
+    size_t nStored;
+    {
+        LOCK(cs_smsg);
+        nStored = StoreChunk(chunk);
+    } // cs_smsg
+    if (nStored == 0) {
+        return;
+    }
+
+    SecMsgInboxBatch inbox;
+    bool fBatch;
+    {
+        LOCK(cs_smsgDB);
+        fBatch = inbox.db.Open("cw") && inbox.db.TxnBegin();
+    }
+    for (const auto &msg : chunk) {
+        if (!msg.m_validated || msg.m_rv != SMSG_NO_ERROR) {
+            continue;
+        }
+        bool fOwnMessage;
+        if (ScanMessage(msg.m_header, msg.m_payload, msg.m_payload_len, true, fOwnMessage, false, fBatch ? &inbox : nullptr) != 0) {
+            // message recipient is not this node (or failed)
+        }
+    }
+    if (fBatch) {
+        CommitInboxBatch(inbox);
+    }
+};
+
+void CSMSG::CommitInboxBatch(SecMsgInboxBatch &batch)
+{
+    {
+        LOCK(cs_smsgDB);
+        if (batch.writes == 0) {
+            batch.db.TxnAbort();
+        } else
+        if (!batch.db.TxnCommit()) {
+            LogPrintf("%s: Failed to write %u inbox messages.\n", __func__, batch.writes);
+            batch.notify.clear();
+        }
+    } // cs_smsgDB
+
+    for (auto &notify : batch.notify) {
+        notify();
+    }
+    batch.notify.clear();
+    batch.writes = 0;
+};
+
 int CSMSG::CheckPurged(const SecureMessage *psmsg, const uint8_t *pPayload)
 {
     int64_t ts = psmsg->timestamp; // ubsan
@@ -3196,10 +4473,10 @@ int CSMSG::CheckPurged(const SecureMessage *psmsg, const uint8_t *pPayload)
     chKey[1] = DBK_PURGED_TOKEN[1];
     memcpy(chKey+2, vMsgId.data(), 28);
 
-    LOCK2(cs_smsg, cs_smsgDB);
+    LOCK(cs_smsg);
 
     SecMsgDB db;
-    if (!db.Open("cr+")) {
+    if (!db.OpenSnapshot()) {
         return SMSG_GENERAL_ERROR;
     }
 
@@ -3273,10 +4550,11 @@ int CSMSG::StoreUnscanned(const uint8_t *pHeader, const uint8_t *pPayload, uint3
 };
 
 
-int CSMSG::Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool fHashBucket)
+int CSMSG::Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload)
 {
     LogPrint(BCLog::SMSG, "%s\n", __func__);
     AssertLockHeld(cs_smsg);
+    TRACE_TIME_START(trace_start);
 
     if (!pHeader || !pPayload) {
         return errorN(SMSG_GENERAL_ERROR, "Null pointer to header or payload.");
@@ -3311,8 +4589,7 @@ int CSMSG::Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayl
     token.m_changed = now - bucketTime;
 
     SecMsgBucket &bucket = buckets[bucketTime];
-    std::set<SecMsgToken> &tokenSet = bucket.setTokens;
-    if (tokenSet.find(token) != tokenSet.end()) {
+    if (bucket.FindToken(token) != bucket.vTokens.end()) {
         LogPrint(BCLog::SMSG, "Already have message.\n");
         if (LogAcceptCategory(BCLog::SMSG)) {
             LogPrintf("bucketTime: %d\n", bucketTime);
@@ -3347,28 +4624,131 @@ int CSMSG::Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayl
     fclose(fp);
 
     token.offset = ofs;
-    tokenSet.insert(token);
-
-    if (nTTL > 0 && (bucket.nLeastTTL == 0 || nTTL < bucket.nLeastTTL)) {
-        bucket.nLeastTTL = nTTL;
-    }
-
-    if (fHashBucket) {
-        bucket.hashBucket(bucketTime);
-    }
+    bucket.AddToken(token);
 
     LogPrint(BCLog::SMSG, "SecureMsg added to bucket %d.\n", bucketTime);
 
     m_last_changed = GetTime();
 
+    TRACE3(smsg, store, 1, 1, TRACE_TIME_ELAPSED(trace_start));
     return SMSG_NO_ERROR;
 };
 
-int CSMSG::Store(const SecureMessage &smsg, bool fHashBucket)
+int CSMSG::Store(const SecureMessage &smsg)
 {
     unsigned char header_buffer[SMSG_HDR_LEN];
     smsg.WriteHeader(header_buffer);
-    return Store(header_buffer, smsg.pPayload, smsg.nPayload, fHashBucket);
+    return Store(header_buffer, smsg.pPayload, smsg.nPayload);
+};
+
+size_t CSMSG::StoreChunk(std::vector<SecMsgReceived> &chunk)
+{
+    AssertLockHeld(cs_smsg);
+    TRACE_TIME_START(trace_start);
+
+    fs::path pathSmsgDir;
+    try {
+        pathSmsgDir = GetDataDir() / STORE_DIR;
+        fs::create_directory(pathSmsgDir);
+    } catch (const fs::filesystem_error &ex) {
+        LogPrintf("%s: Failed to create directory %s - %s.\n", __func__, pathSmsgDir.string(), ex.what());
+        for (auto &msg : chunk) {
+            msg.m_rv = SMSG_GENERAL_ERROR;
+        }
+        return 0;
+    }
+
+    int64_t now = GetAdjustedTime();
+    std::map<int64_t, std::vector<SecMsgReceived*> > mapBuckets;
+    for (auto &msg : chunk) {
+        if (!msg.m_validated) {
+            continue;
+        }
+        SecureMessage smsg(msg.m_header);
+        if (SMSG_NO_ERROR != CheckPurged(&smsg, msg.m_payload)) {
+            LogPrint(BCLog::SMSG, "%s: Purged message.\n", __func__);
+            msg.m_rv = SMSG_PURGED_MSG;
+            continue;
+        }
+        if (smsg.timestamp > now + SMSG_TIME_LEEWAY ||
+            smsg.timestamp < now - SMSG_RETENTION) {
+            LogPrint(BCLog::SMSG, "%s: Message time out of range %d.\n", __func__, smsg.timestamp);
+            msg.m_rv = SMSG_GENERAL_ERROR;
+            continue;
+        }
+        mapBuckets[smsg.timestamp - (smsg.timestamp % SMSG_BUCKET_LEN)].push_back(&msg);
+    }
+
+    // Each bucket file is appended to once and its tokens merged in one pass
+    size_t nStored = 0;
+    for (auto &mb : mapBuckets) {
+        const int64_t bucketTime = mb.first;
+        SecMsgBucket &bucket = buckets[bucketTime];
+
+        fs::path fullpath = pathSmsgDir / (ToString(bucketTime) + "_01.dat");
+        FILE *fp;
+        errno = 0;
+        if (!(fp = fopen(fullpath.string().c_str(), "ab"))) {
+            LogPrintf("%s: fopen failed: %s.\n", __func__, strerror(errno));
+            for (auto *msg : mb.second) {
+                msg->m_rv = SMSG_GENERAL_ERROR;
+            }
+            continue;
+        }
+        // On windows ftell will always return 0 after fopen(ab), call fseek to set.
+        errno = 0;
+        if (fseek(fp, 0, SEEK_END) != 0) {
+            LogPrintf("%s: fseek failed: %s.\n", __func__, strerror(errno));
+            fclose(fp);
+            for (auto *msg : mb.second) {
+                msg->m_rv = SMSG_GENERAL_ERROR;
+            }
+            continue;
+        }
+
+        long int ofs = ftell(fp);
+        bool fFailed = false;
+        std::set<SecMsgToken> setAdded;
+        std::vector<SecMsgToken> tokens;
+        for (auto *msg : mb.second) {
+            if (fFailed) {
+                msg->m_rv = SMSG_GENERAL_ERROR;
+                continue;
+            }
+            SecureMessage smsg(msg->m_header);
+            SecMsgToken token(smsg.timestamp, msg->m_payload, msg->m_payload_len, 0, smsg.m_ttl);
+            token.m_changed = now - bucketTime;
+            if (bucket.FindToken(token) != bucket.vTokens.end() || !setAdded.insert(token).second) {
+                LogPrint(BCLog::SMSG, "Already have message %s in bucket %d.\n", token.ToString(), bucketTime);
+                msg->m_rv = SMSG_GENERAL_ERROR;
+                continue;
+            }
+            if (fwrite(msg->m_header, sizeof(uint8_t), SMSG_HDR_LEN, fp) != (size_t)SMSG_HDR_LEN
+                || fwrite(msg->m_payload, sizeof(uint8_t), msg->m_payload_len, fp) != msg->m_payload_len) {
+                // The offsets of any later messages would be wrong
+                LogPrintf("%s: fwrite failed: %s.\n", __func__, strerror(errno));
+                msg->m_rv = SMSG_GENERAL_ERROR;
+                fFailed = true;
+                continue;
+            }
+            token.offset = ofs;
+            ofs += SMSG_HDR_LEN + msg->m_payload_len;
+            tokens.push_back(token);
+        }
+        fclose(fp);
+
+        nStored += tokens.size();
+        bucket.AddTokens(tokens);
+        LogPrint(BCLog::SMSG, "%u SecureMsgs added to bucket %d.\n", tokens.size(), bucketTime);
+    }
+
+    if (nStored > 0) {
+        m_last_changed = GetTime();
+    }
+    static MetricCounter &stored = g_metrics.Counter("ghost_smsg_stored_total", "Received messages stored in the buckets");
+    stored.Inc(nStored);
+    TRACE3(smsg, store, chunk.size(), nStored, TRACE_TIME_ELAPSED(trace_start));
+    return nStored;
 };
 
 int CSMSG::Purge(std::vector<uint8_t> &vMsgId, std::string &sError)
@@ -3397,10 +4777,8 @@ int CSMSG::Purge(std::vector<uint8_t> &vMsgId, std::string &sError)
     int64_t bucketTime = msgtime - (msgtime % SMSG_BUCKET_LEN);
 
     SecMsgBucket &bucket = buckets[bucketTime];
-    std::set<SecMsgToken> &tokenSet = bucket.setTokens;
-
     std::vector<uint8_t> vchOne;
-    for (auto it = tokenSet.begin(); it != tokenSet.end(); ++it) {
+    for (auto it = bucket.vTokens.begin(); it != bucket.vTokens.end(); ++it) {
         if (it->timestamp != msgtime) {
             continue;
         }
@@ -3420,7 +4798,7 @@ int CSMSG::Purge(std::vector<uint8_t> &vMsgId, std::string &sError)
             break;
         }
         //memcpy(purged.sample, vchOne.data() + SMSG_HDR_LEN, 8);
-        it->ttl = 0;
+        bucket.PurgeToken(it);
         LogPrint(BCLog::SMSG, "Purged message %s in bucket %d\n", it->ToString(), bucketTime);
         memcpy(purged.sample, it->sample, 8);
 
@@ -3476,6 +4854,7 @@ int CSMSG::StartConnectingBlock()
         delete m_connect_block_batch;
         m_connect_block_batch = nullptr;
     }
+    m_connect_block_funding.clear();
 
     m_connect_block_batch = new leveldb::WriteBatch();
 
@@ -3517,17 +4896,94 @@ int CSMSG::StoreFundingTx(const CTransaction &tx, const CBlockIndex *pindex)
         if (output_data.size() < 25 || output_data[0] != DO_FUND_MSG) {
             continue;
         }
-        size_t n = (output_data.size()-1) / 24;
-        db_data.insert(db_data.end(), output_data.begin()+1, output_data.begin()+1+n*24);
+        size_t n = (output_data.size()-1) / 24;
+        db_data.insert(db_data.end(), output_data.begin()+1, output_data.begin()+1+n*24);
+    }
+
+    // TODO: Get current fee-rate, GetSmsgFeeRate
+
+    if (!PutFundingData(m_connect_block_batch, tx.GetHash(), pindex->nHeight, db_data)) {
+        return errorN(SMSG_GENERAL_ERROR, "%s - PutFundingData failed.", __func__);
+    }
+    m_connect_block_funding.emplace_back(tx.GetHash(), SecMsgFundingData(pindex->nHeight, db_data));
+
+    return SMSG_NO_ERROR;
+}
+
+void CSMSG::AddFundingDataToCache(const uint256 &txid, const SecMsgFundingData &data)
+{
+    if (m_funding_cache_max == 0) {
+        return;
+    }
+    auto it = m_funding_cache_map.find(txid);
+    if (it != m_funding_cache_map.end()) {
+        it->second->second = data;
+        m_funding_cache_list.splice(m_funding_cache_list.begin(), m_funding_cache_list, it->second);
+        return;
+    }
+    m_funding_cache_list.emplace_front(txid, data);
+    m_funding_cache_map.emplace(txid, m_funding_cache_list.begin());
+    TrimFundingCache();
+}
+
+void CSMSG::TrimFundingCache()
+{
+    while (m_funding_cache_map.size() > m_funding_cache_max) {
+        m_funding_cache_map.erase(m_funding_cache_list.back().first);
+        m_funding_cache_list.pop_back();
+    }
+}
+
+int CSMSG::GetFundingData(const uint256 &txid, std::vector<uint8_t> &data)
+{
+    {
+        LOCK(m_funding_cache_mutex);
+        auto it = m_funding_cache_map.find(txid);
+        if (it != m_funding_cache_map.end()) {
+            m_funding_cache_list.splice(m_funding_cache_list.begin(), m_funding_cache_list, it->second);
+            data = it->second->second.m_data;
+            return SMSG_NO_ERROR;
+        }
+    }
+
+    {
+        SecMsgDB db;
+        if (!db.OpenSnapshot()) {
+            return SMSG_GENERAL_ERROR;
+        }
+        if (!db.ReadFundingData(txid, data)) {
+            return SMSG_FUND_DATA_NOT_FOUND;
+        }
+    }
+    if (data.size() < 32) {
+        return SMSG_GENERAL_ERROR;
+    }
+
+    // The height is only used to prune the cache, the block hash shows if the tx is still in the chain
+    int height = 0;
+    {
+        LOCK(cs_main);
+        BlockMap::iterator mi = g_chainman.BlockIndex().find(*((const uint256*) data.data()));
+        if (mi != g_chainman.BlockIndex().end() && mi->second) {
+            height = mi->second->nHeight;
+        }
     }
+    LOCK(m_funding_cache_mutex);
+    AddFundingDataToCache(txid, SecMsgFundingData(height, data));
+    return SMSG_NO_ERROR;
+}
 
-    // TODO: Get current fee-rate, GetSmsgFeeRate
-
-    if (!PutFundingData(m_connect_block_batch, tx.GetHash(), pindex->nHeight, db_data)) {
-        return errorN(SMSG_GENERAL_ERROR, "%s - PutFundingData failed.", __func__);
-    }
+void CSMSG::SetFundingCacheSize(size_t max_entries)
+{
+    LOCK(m_funding_cache_mutex);
+    m_funding_cache_max = max_entries;
+    TrimFundingCache();
+}
 
-    return SMSG_NO_ERROR;
+size_t CSMSG::FundingCacheCount()
+{
+    LOCK(m_funding_cache_mutex);
+    return m_funding_cache_map.size();
 }
 
 int CSMSG::CheckFundingTx(const Consensus::Params &consensusParams, const SecureMessage *psmsg, const uint8_t *pPayload)
@@ -3543,16 +4999,12 @@ int CSMSG::CheckFundingTx(const Consensus::Params &consensusParams, const Secure
     }
 
     std::vector<uint8_t> db_data;
-    {
-        LOCK(cs_smsgDB);
-        SecMsgDB db;
-        if (!db.Open("r")) {
-            return SMSG_GENERAL_ERROR;
-        }
-        if (!db.ReadFundingData(txid, db_data)) {
+    int rv = GetFundingData(txid, db_data);
+    if (rv != SMSG_NO_ERROR) {
+        if (rv == SMSG_FUND_DATA_NOT_FOUND) {
             LogPrint(BCLog::SMSG, "ReadFundingData failed for smsg: %s, txn: %s.\n", msgId.ToString(), txid.ToString());
-            return SMSG_FUND_DATA_NOT_FOUND;
         }
+        return rv;
     }
     const uint256 &hashBlock = *((const uint256*) db_data.data());
 
@@ -3645,6 +5097,17 @@ int CSMSG::PruneFundingTxData()
         }
         delete it;
     }
+    {
+        LOCK(m_funding_cache_mutex);
+        for (auto it = m_funding_cache_list.begin(); it != m_funding_cache_list.end(); ) {
+            if (it->second.m_height < min_height_to_keep) {
+                m_funding_cache_map.erase(it->first);
+                it = m_funding_cache_list.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
     LogPrint(BCLog::SMSG, "%s Removed: %d\n", __func__, num_removed);
 
     return 0;
@@ -3677,6 +5140,14 @@ int CSMSG::SetBestBlock(const uint256 &block_hash, int height, int64_t time)
     delete m_connect_block_batch;
     m_connect_block_batch = nullptr;
 
+    {
+        LOCK(m_funding_cache_mutex);
+        for (const auto &it : m_connect_block_funding) {
+            AddFundingDataToCache(it.first, it.second);
+        }
+    }
+    m_connect_block_funding.clear();
+
     return SMSG_NO_ERROR;
 }
 
@@ -3686,9 +5157,8 @@ int CSMSG::ReadBestBlock(uint256 &block_hash, int &height)
         return SMSG_DISABLED;
     }
 
-    LOCK(cs_smsgDB);
     SecMsgDB db;
-    if (!db.Open("r")) {
+    if (!db.OpenSnapshot()) {
         return SMSG_GENERAL_ERROR;
     }
 
@@ -3796,76 +5266,122 @@ int CSMSG::Validate(const SecureMessage *psmsg, const uint8_t *pPayload, uint32_
     return rv;
 };
 
-/** Proof of work and checksum
-  * May run in a thread, if shutdown detected, return.
-  */
-int CSMSG::SetHash(SecureMessage *psmsg, uint8_t *pPayload, uint32_t nPayload)
+bool CSMSGPowCheck::operator()()
 {
-    int64_t nStart = GetTimeMillis();
-    uint8_t civ[32];
-
-    bool found = false;
-
-    uint32_t nonce = 0;
-    memcpy(&nonce, &psmsg->nonce[0], 4);
+    uint8_t header_buffer[SMSG_HDR_LEN];
+    memcpy(header_buffer, m_header, SMSG_HDR_LEN);
 
+    uint8_t civ[32];
     uint256 msg_hash;
-    arith_uint256 target_difficulty;
-    {
-    LOCK(cs_main);
-    target_difficulty.SetCompact(GetSmsgDifficulty(psmsg->timestamp));
-    }
-
-    unsigned char header_buffer[SMSG_HDR_LEN];
-    psmsg->WriteHeader(header_buffer);
-
-    // Break for HMAC_CTX_cleanup
-    for (;;) {
-        if (!fSecMsgEnabled) {
+    uint64_t num_hashes = 0;
+    bool found = false;
+    uint64_t n = m_start;
+    for (; n <= 0xFFFFFFFFU; n += m_step) {
+        if (!fSecMsgEnabled || m_found->load(std::memory_order_relaxed)) {
            break;
         }
-        uint32_t tmp_le = htole32(nonce);
-        memcpy(psmsg->nonce, &tmp_le, 4);
+        uint32_t tmp_le = htole32((uint32_t)n);
         memcpy(header_buffer + 4, &tmp_le, 4);
 
         for (int i = 0; i < 32; i+=4) {
-            memcpy(civ+i, psmsg->nonce, 4);
+            memcpy(civ+i, &tmp_le, 4);
         }
 
         CHMAC_SHA256 ctx(&civ[0], 32);
         ctx.Write((uint8_t*) header_buffer+4, SMSG_HDR_LEN-4);
-        ctx.Write((uint8_t*) pPayload, nPayload);
+        ctx.Write((uint8_t*) m_payload, m_payload_len);
         ctx.Finalize(msg_hash.begin());
+        num_hashes++;
 
-        if (UintToArith256(msg_hash) <= target_difficulty) {
+        if (UintToArith256(msg_hash) <= *m_target) {
             found = true;
             break;
         }
+    }
+    *m_hashes += num_hashes;
 
-        if (nonce >= 0xFFFFFFFFU) {
-            LogPrint(BCLog::SMSG, "No match %u\n", nonce);
-            break;
+    bool expect = false;
+    if (!found || !m_found->compare_exchange_strong(expect, true)) {
+        return true;
+    }
+    *m_nonce_out = (uint32_t)n;
+    *m_hash_out = msg_hash;
+    return false;
+};
+
+/** Proof of work and checksum
+  * May run in a thread, if shutdown detected, return.
+  * The nonce space is split across the smsg pow threads, see -smsgpowthreads.
+  */
+int CSMSG::SetHash(SecureMessage *psmsg, uint8_t *pPayload, uint32_t nPayload)
+{
+    int64_t nStart = GetTimeMicros();
+
+    uint32_t nonce = 0;
+    memcpy(&nonce, &psmsg->nonce[0], 4);
+    nonce = le32toh(nonce);
+
+    arith_uint256 target_difficulty;
+    {
+    LOCK(cs_main);
+    target_difficulty.SetCompact(GetSmsgDifficulty(psmsg->timestamp));
+    }
+
+    unsigned char header_buffer[SMSG_HDR_LEN];
+    psmsg->WriteHeader(header_buffer);
+
+    std::atomic<bool> found{false};
+    std::atomic<uint64_t> num_hashes{0};
+    uint32_t nonce_found = 0;
+    uint256 msg_hash;
+    if (m_num_pow_threads < 1) {
+        CSMSGPowCheck(header_buffer, pPayload, nPayload, &target_difficulty,
+            nonce, 1, &found, &nonce_found, &msg_hash, &num_hashes)();
+    } else {
+        uint32_t num_slices = m_num_pow_threads + 1;
+        std::vector<CSMSGPowCheck> vChecks;
+        vChecks.reserve(num_slices);
+        for (uint32_t i = 0; i < num_slices; ++i) {
+            vChecks.emplace_back(header_buffer, pPayload, nPayload, &target_difficulty,
+                (uint64_t)nonce + i, num_slices, &found, &nonce_found, &msg_hash, &num_hashes);
         }
-        nonce++;
+        CCheckQueueControl<CSMSGPowCheck> control(&m_pow_queue);
+        control.Add(vChecks);
+        control.Wait();
     }
 
+    int64_t nTime = GetTimeMicros() - nStart;
+    m_pow_hashes += num_hashes;
+    m_pow_time += nTime;
+
     if (!fSecMsgEnabled) {
         LogPrint(BCLog::SMSG, "%s: Stopped, shutdown detected.\n", __func__);
         return SMSG_SHUTDOWN_DETECTED;
     }
 
     if (!found) {
-        LogPrint(BCLog::SMSG, "%s: Failed, took %d ms, nonce %u\n", __func__, GetTimeMillis() - nStart, nonce);
+        LogPrint(BCLog::SMSG, "%s: Failed, took %d ms, %u hashes\n", __func__, nTime / 1000, num_hashes.load());
         return SMSG_GENERAL_ERROR;
     }
 
+    uint32_t tmp_le = htole32(nonce_found);
+    memcpy(psmsg->nonce, &tmp_le, 4);
     memcpy(psmsg->hash, msg_hash.begin(), 4);
 
-    LogPrint(BCLog::SMSG, "%s: Took %d ms, nonce %u\n", __func__, GetTimeMillis() - nStart, nonce);
+    LogPrint(BCLog::SMSG, "%s: Took %d ms, nonce %u, %u hashes\n", __func__, nTime / 1000, nonce_found, num_hashes.load());
 
     return SMSG_NO_ERROR;
 };
 
+void GetRecipientHint(const uint256 &P, uint8_t *hint)
+{
+    // Domain separated from key_e and key_m, which are derived from SHA512(P)
+    static const uint8_t tag[] = {'s', 'm', 's', 'g', 'h', 'i', 'n', 't'};
+    uint8_t hashed[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(tag, sizeof(tag)).Write(P.begin(), 32).Finalize(hashed);
+    memcpy(hint, hashed, SMSG_HINT_LEN);
+};
+
 /** Create a secure message
   *
   * Using a similar method to bitmessage.
@@ -3875,6 +5391,95 @@ int CSMSG::SetHash(SecureMessage *psmsg, uint8_t *pPayload, uint32_t nPayload)
   * Some differences:
   * bitmessage uses curve sect283r1 this uses secp256k1
   */
+static uint32_t GetDictionaryId(const std::vector<uint8_t> &dictionary)
+{
+    uint8_t hash[CSHA256::OUTPUT_SIZE];
+    CSHA256().Write(dictionary.data(), dictionary.size()).Finalize(hash);
+    return memget_uint32_le(hash);
+};
+
+bool CSMSG::AddDictionary(const std::vector<uint8_t> &dictionary, bool use_to_send, uint32_t *dictionary_id)
+{
+    if (dictionary.empty() || dictionary.size() > SMSG_MAX_DICT_BYTES) {
+        return error("%s: Dictionary size %u out of range.", __func__, dictionary.size());
+    }
+    uint32_t id = GetDictionaryId(dictionary);
+    if (id == 0) {
+        return error("%s: Dictionary id is reserved.", __func__);
+    }
+
+    m_dictionaries[id] = dictionary;
+    if (use_to_send) {
+        m_send_dictionary = id;
+    }
+    if (dictionary_id) {
+        *dictionary_id = id;
+    }
+    return true;
+};
+
+bool CSMSG::LoadDictionaries()
+{
+    m_dictionaries.clear();
+    m_send_dictionary = 0;
+
+    std::vector<std::pair<std::string, bool>> files;
+    for (const auto &file : gArgs.GetArgs("-smsgdictionary")) {
+        files.emplace_back(file, false);
+    }
+    if (gArgs.IsArgSet("-smsgsenddictionary")) {
+        files.emplace_back(gArgs.GetArg("-smsgsenddictionary", ""), true);
+    }
+
+    for (const auto &file : files) {
+        fs::path path = AbsPathForConfigVal(fs::path(file.first));
+        FILE *fp = fsbridge::fopen(path, "rb");
+        if (!fp) {
+            return error("%s: Could not open dictionary %s.", __func__, path.string());
+        }
+        std::vector<uint8_t> dictionary(SMSG_MAX_DICT_BYTES + 1);
+        size_t nRead = fread(dictionary.data(), 1, dictionary.size(), fp);
+        fclose(fp);
+        dictionary.resize(nRead);
+
+        uint32_t id;
+        if (!AddDictionary(dictionary, file.second, &id)) {
+            return error("%s: Could not load dictionary %s.", __func__, path.string());
+        }
+        LogPrintf("Loaded smsg dictionary %08x from %s%s.\n", id, path.string(), file.second ? ", compressing sent messages" : "");
+    }
+    return true;
+};
+
+std::vector<uint32_t> CSMSG::ListDictionaries() const
+{
+    std::vector<uint32_t> ids;
+    for (const auto &d : m_dictionaries) {
+        ids.push_back(d.first);
+    }
+    return ids;
+};
+
+/** Compress against dictionary, the output starts with the dictionary id, returns 0 if the data doesn't fit */
+static int CompressWithDictionary(uint32_t id, const std::vector<uint8_t> &dictionary, const char *src, int srcSize, uint8_t *dst, int dstCapacity)
+{
+    if (dstCapacity <= (int)SMSG_DICT_ID_LEN) {
+        return 0;
+    }
+    LZ4_stream_t *stream = LZ4_createStream();
+    if (!stream) {
+        return 0;
+    }
+    LZ4_loadDict(stream, (const char*)dictionary.data(), dictionary.size());
+    int lenComp = LZ4_compress_fast_continue(stream, src, (char*)dst + SMSG_DICT_ID_LEN, srcSize, dstCapacity - SMSG_DICT_ID_LEN, 1);
+    LZ4_freeStream(stream);
+    if (lenComp < 1) {
+        return 0;
+    }
+    memput_uint32_le(dst, id);
+    return lenComp + SMSG_DICT_ID_LEN;
+};
+
 int CSMSG::Encrypt(SecureMessage &smsg, const CKeyID &addressFrom, const CKeyID &addressTo, const std::string &message)
 {
     bool fSendAnonymous = addressFrom.IsNull();
@@ -3955,7 +5560,16 @@ int CSMSG::Encrypt(SecureMessage &smsg, const CKeyID &addressFrom, const CKeyID
             return errorN(SMSG_ALLOCATE_FAILED, "%s: vchCompressed.resize %u threw: %s.", __func__, worstCase, e.what());
         }
 
-        int lenComp = LZ4_compress_default((char*)message.c_str(), (char*)vchCompressed.data(), lenMsg, worstCase);
+        // Against the shared dictionary if one is set, the payload still must not exceed the worst case without it
+        int lenComp = 0;
+        const auto it_dict = m_dictionaries.find(m_send_dictionary);
+        if (it_dict != m_dictionaries.end()) {
+            lenComp = CompressWithDictionary(it_dict->first, it_dict->second, message.c_str(), lenMsg, vchCompressed.data(), worstCase);
+        }
+        smsg.SetDictCompressed(lenComp > 0);
+        if (lenComp < 1) {
+            lenComp = LZ4_compress_default((char*)message.c_str(), (char*)vchCompressed.data(), lenMsg, worstCase);
+        }
         if (lenComp < 1) {
             return errorN(SMSG_COMPRESS_FAILED, "%s: Could not compress message data.", __func__);
         }
@@ -3964,6 +5578,7 @@ int CSMSG::Encrypt(SecureMessage &smsg, const CKeyID &addressFrom, const CKeyID
         lenMsgData = lenComp;
     } else {
         // No compression
+        smsg.SetDictCompressed(false);
         pMsgData = (uint8_t*)message.c_str();
         lenMsgData = lenMsg;
     }
@@ -4011,15 +5626,20 @@ int CSMSG::Encrypt(SecureMessage &smsg, const CKeyID &addressFrom, const CKeyID
     }
 
     bool fPaid = smsg.IsPaidVersion();
-    try { smsg.pPayload = new uint8_t[vchCiphertext.size() + (fPaid ? 32 : 0)]; } catch (std::exception &e) {
+    uint32_t nHint = (smsg.flags & SMSG_FLAG_RECIPIENT_HINT) ? SMSG_HINT_LEN : 0;
+    uint32_t nMacData = nHint + vchCiphertext.size();
+    try { smsg.pPayload = new uint8_t[nMacData + (fPaid ? 32 : 0)]; } catch (std::exception &e) {
         return errorN(SMSG_ALLOCATE_FAILED, "%s: Could not allocate pPayload, exception: %s.", __func__, e.what());
     }
 
-    memcpy(smsg.pPayload, vchCiphertext.data(), vchCiphertext.size());
-    smsg.nPayload = vchCiphertext.size() + (fPaid ? 32 : 0);
+    if (nHint) {
+        GetRecipientHint(P, smsg.pPayload);
+    }
+    memcpy(smsg.pPayload + nHint, vchCiphertext.data(), vchCiphertext.size());
+    smsg.nPayload = nMacData + (fPaid ? 32 : 0);
     if (fPaid) {
         // Clear the funding txid
-        memset(smsg.pPayload + vchCiphertext.size(), 0, 32);
+        memset(smsg.pPayload + nMacData, 0, 32);
     }
 
     // Calculate a 32 byte MAC with HMACSHA256, using key_m as salt
@@ -4028,7 +5648,7 @@ int CSMSG::Encrypt(SecureMessage &smsg, const CKeyID &addressFrom, const CKeyID
     int64_t tmp64 = htole64(smsg.timestamp);
     ctx.Write((uint8_t*) &tmp64, sizeof(tmp64));
     ctx.Write((uint8_t*) smsg.iv, sizeof(smsg.iv));
-    ctx.Write((uint8_t*) vchCiphertext.data(), vchCiphertext.size());
+    ctx.Write((uint8_t*) smsg.pPayload, nMacData);
     ctx.Finalize(smsg.mac);
 
     return SMSG_NO_ERROR;
@@ -4079,7 +5699,7 @@ int CSMSG::Import(SecureMessage *psmsg, std::string &sError, bool setread, bool
         return rv;
     }
 
-    Store(*psmsg, true);
+    Store(*psmsg);
 
     return SMSG_NO_ERROR;
 };
@@ -4149,6 +5769,9 @@ int CSMSG::Send(CKeyID &addressFrom, CKeyID &addressTo, std::string &message,
 
     int rv;
     smsg = SecureMessage(fPaid, nRetention);
+    if (m_add_recipient_hint) {
+        smsg.flags |= SMSG_FLAG_RECIPIENT_HINT;
+    }
     if ((rv = Encrypt(smsg, addressFrom, addressTo, sData)) != 0) {
         sError = GetString(rv);
         return errorN(rv, "%s: %s.", __func__, sError);
@@ -4219,6 +5842,7 @@ int CSMSG::Send(CKeyID &addressFrom, CKeyID &addressTo, std::string &message,
 
         SecureMessage smsgForOutbox(fPaid, nRetention);
         smsgForOutbox.timestamp = smsg.timestamp;
+        smsgForOutbox.flags = smsg.flags;
         if ((rv = Encrypt(smsgForOutbox, addressFrom, addressOutbox, sData)) != 0) {
             LogPrintf("%s: Encrypt for outbox failed, %d.\n", __func__, rv);
         } else {
@@ -4535,6 +6159,19 @@ int CSMSG::Decrypt(bool fTestOnly, const CKey &keyDest, const CKeyID &address, c
         return errorN(SMSG_GENERAL_ERROR, "%s: secp256k1_ecdh failed.", __func__);
     }
 
+    // Messages with a recipient hint can be rejected before the MAC is computed over the whole payload
+    uint32_t nHint = 0;
+    if (smsg.flags & SMSG_FLAG_RECIPIENT_HINT) {
+        nHint = SMSG_HINT_LEN;
+        uint8_t hint[SMSG_HINT_LEN];
+        GetRecipientHint(P, hint);
+        if (nPayload < nHint
+            || memcmp(hint, pPayload, nHint) != 0) {
+            LogPrint(BCLog::SMSG, "Recipient hint does not match.\n");
+            return SMSG_MAC_MISMATCH;
+        }
+    }
+
     // Use public key P to calculate the SHA512 hash H.
     //  The first 32 bytes of H are called key_e and the last 32 bytes are called key_m.
     std::vector<uint8_t> vchHashedDec;
@@ -4566,7 +6203,7 @@ int CSMSG::Decrypt(bool fTestOnly, const CKey &keyDest, const CKeyID &address, c
     SecMsgCrypter crypter;
     crypter.SetKey(key_e, smsg.iv);
     std::vector<uint8_t> vchPayload;
-    if (!crypter.Decrypt(pPayload, nPayload, vchPayload)) {
+    if (!crypter.Decrypt(pPayload + nHint, nPayload - nHint, vchPayload)) {
         return errorN(SMSG_GENERAL_ERROR, "%s: Decrypt failed.", __func__);
     }
 
@@ -4593,6 +6230,20 @@ int CSMSG::Decrypt(bool fTestOnly, const CKey &keyDest, const CKeyID &address, c
         return errorN(SMSG_ALLOCATE_FAILED, "%s: msg.vchMessage.resize %u threw: %s.", __func__, lenPlain + 1, e.what());
     }
 
+    if (lenPlain > 128 && smsg.IsDictCompressed()) {
+        if (lenData < SMSG_DICT_ID_LEN) {
+            return errorN(SMSG_GENERAL_ERROR, "%s: Could not decompress message data.", __func__);
+        }
+        uint32_t dictionary_id = memget_uint32_le(pMsgData);
+        const auto it_dict = m_dictionaries.find(dictionary_id);
+        if (it_dict == m_dictionaries.end()) {
+            return errorN(SMSG_UNKNOWN_DICTIONARY, "%s: Unknown compression dictionary %08x.", __func__, dictionary_id);
+        }
+        if (LZ4_decompress_safe_usingDict((char*) pMsgData + SMSG_DICT_ID_LEN, (char*) &msg.vchMessage[0], lenData - SMSG_DICT_ID_LEN, lenPlain,
+                (const char*) it_dict->second.data(), it_dict->second.size()) != (int) lenPlain) {
+            return errorN(SMSG_GENERAL_ERROR, "%s: Could not decompress message data.", __func__);
+        }
+    } else
     if (lenPlain > 128) {
         // Decompress
         if (LZ4_decompress_safe((char*) pMsgData, (char*) &msg.vchMessage[0], lenData, lenPlain) != (int) lenPlain) {
@@ -4675,10 +6326,8 @@ int CSMSG::Decrypt(bool fTestOnly, const CKey &keyDest, const CKeyID &address, c
     return CSMSG::Decrypt(fTestOnly, keyDest, address, header_buffer, smsg.pPayload, smsg.nPayload, msg);
 };
 
-int CSMSG::Decrypt(bool fTestOnly, const CKeyID &address, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, MessageData &msg)
+int CSMSG::GetDecryptKey(const CKeyID &address, CKey &keyDest)
 {
-    // Fetch private key k, used to decrypt
-    CKey keyDest;
     ReadSmsgKey(address, keyDest);
 
 #ifdef ENABLE_WALLET
@@ -4701,9 +6350,73 @@ int CSMSG::Decrypt(bool fTestOnly, const CKeyID &address, const uint8_t *pHeader
         return errorN(SMSG_UNKNOWN_KEY, "%s: Could not get private key for addressDest.", __func__);
     }
 
+    return SMSG_NO_ERROR;
+};
+
+int CSMSG::Decrypt(bool fTestOnly, const CKeyID &address, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, MessageData &msg)
+{
+    // Fetch private key k, used to decrypt
+    CKey keyDest;
+    int rv = GetDecryptKey(address, keyDest);
+    if (rv != SMSG_NO_ERROR) {
+        return rv;
+    }
+
     return CSMSG::Decrypt(fTestOnly, keyDest, address, pHeader, pPayload, nPayload, msg);
 };
 
+int CSMSG::DecryptStored(const SecMsgId &msgid, const CKeyID &address, const std::vector<uint8_t> &vchMessage, MessageData &msg)
+{
+    // A cached message is only returned while its key can be read, as when decrypting it again
+    CKey keyDest;
+    int rv = GetDecryptKey(address, keyDest);
+    if (rv != SMSG_NO_ERROR) {
+        return rv;
+    }
+
+    {
+        LOCK(m_decrypted_cache_mutex);
+        auto it = m_decrypted_cache_map.find(msgid);
+        if (it != m_decrypted_cache_map.end()) {
+            m_decrypted_cache_list.splice(m_decrypted_cache_list.begin(), m_decrypted_cache_list, it->second);
+            msg = it->second->second;
+            return SMSG_NO_ERROR;
+        }
+    }
+
+    if (vchMessage.size() < SMSG_HDR_LEN) {
+        return SMSG_GENERAL_ERROR;
+    }
+    rv = Decrypt(false, keyDest, address, vchMessage.data(), vchMessage.data() + SMSG_HDR_LEN, vchMessage.size() - SMSG_HDR_LEN, msg);
+    if (rv != SMSG_NO_ERROR) {
+        return rv;
+    }
+
+    LOCK(m_decrypted_cache_mutex);
+    if (m_decrypted_cache_max > 0 && m_decrypted_cache_map.count(msgid) == 0) {
+        m_decrypted_cache_list.emplace_front(msgid, msg);
+        m_decrypted_cache_map.emplace(msgid, m_decrypted_cache_list.begin());
+        TrimDecryptedCache();
+    }
+
+    return SMSG_NO_ERROR;
+};
+
+void CSMSG::TrimDecryptedCache()
+{
+    while (m_decrypted_cache_map.size() > m_decrypted_cache_max) {
+        m_decrypted_cache_map.erase(m_decrypted_cache_list.back().first);
+        m_decrypted_cache_list.pop_back();
+    }
+}
+
+void CSMSG::SetDecryptedCacheSize(size_t max_entries)
+{
+    LOCK(m_decrypted_cache_mutex);
+    m_decrypted_cache_max = max_entries;
+    TrimDecryptedCache();
+}
+
 int CSMSG::Decrypt(bool fTestOnly, const CKeyID &address, const SecureMessage &smsg, MessageData &msg)
 {
     unsigned char header_buffer[SMSG_HDR_LEN];
@@ -4732,3 +6445,180 @@ double GetDifficulty(uint32_t compact)
 }
 
 } // namespace smsg
+
+size_t SmsgPeerBucketSlots()
+{
+    return (smsg::SMSG_RETENTION + smsg::SMSG_TIME_LEEWAY) / smsg::SMSG_BUCKET_LEN + 2;
+};
+
+const PeerBuckets::Slot *PeerBuckets::Find(int64_t time) const
+{
+    if (m_slots.empty()) {
+        return nullptr;
+    }
+    const Slot &slot = m_slots[((uint64_t)time / smsg::SMSG_BUCKET_LEN) % m_slots.size()];
+    return slot.time == time ? &slot : nullptr;
+};
+
+PeerBuckets::Slot &PeerBuckets::Claim(int64_t time)
+{
+    if (m_slots.empty()) {
+        m_slots.resize(SmsgPeerBucketSlots());
+    }
+    Slot &slot = m_slots[((uint64_t)time / smsg::SMSG_BUCKET_LEN) % m_slots.size()];
+    if (slot.time != time) {
+        if (slot.pending) {
+            m_num_pending--;
+        }
+        slot = Slot();
+        slot.time = time;
+    }
+    return slot;
+};
+
+void PeerBuckets::SetPending(int64_t time, uint32_t active, uint32_t hash)
+{
+    LOCK(m_mutex);
+    Slot &slot = Claim(time);
+    if (!slot.pending) {
+        m_num_pending++;
+    }
+    slot.pending = true;
+    slot.active = active;
+    slot.hash = hash;
+};
+
+std::vector<std::pair<int64_t, PeerBucket> > PeerBuckets::GetPending() const
+{
+    std::vector<std::pair<int64_t, PeerBucket> > pending;
+    LOCK(m_mutex);
+    pending.reserve(m_num_pending);
+    for (const auto &slot : m_slots) {
+        if (slot.pending) {
+            pending.emplace_back(slot.time, PeerBucket(slot.active, slot.hash));
+        }
+    }
+    std::sort(pending.begin(), pending.end(), [](const std::pair<int64_t, PeerBucket> &a, const std::pair<int64_t, PeerBucket> &b) {
+        return a.first < b.first;
+    });
+    return pending;
+};
+
+void PeerBuckets::ErasePending(int64_t time, const PeerBucket &seen)
+{
+    LOCK(m_mutex);
+    if (m_slots.empty()) {
+        return;
+    }
+    Slot &slot = m_slots[((uint64_t)time / smsg::SMSG_BUCKET_LEN) % m_slots.size()];
+    if (slot.time != time || !slot.pending
+        || slot.active != seen.m_active || slot.hash != seen.m_hash) {
+        return;
+    }
+    slot.pending = false;
+    m_num_pending--;
+};
+
+size_t PeerBuckets::NumPending() const
+{
+    LOCK(m_mutex);
+    return m_num_pending;
+};
+
+int64_t PeerBuckets::GetLastShown(int64_t time) const
+{
+    LOCK(m_mutex);
+    const Slot *slot = Find(time);
+    return slot ? slot->last_shown : 0;
+};
+
+void PeerBuckets::SetLastShown(int64_t time, int64_t now)
+{
+    LOCK(m_mutex);
+    Claim(time).last_shown = now;
+};
+
+void PeerBuckets::ExpireShown(int64_t cutoff)
+{
+    LOCK(m_mutex);
+    for (auto &slot : m_slots) {
+        if (slot.time < cutoff) {
+            slot.last_shown = 0;
+        }
+    }
+};
+
+std::vector<std::pair<int64_t, int64_t> > PeerBuckets::GetShown() const
+{
+    std::vector<std::pair<int64_t, int64_t> > shown;
+    LOCK(m_mutex);
+    for (const auto &slot : m_slots) {
+        if (slot.last_shown > 0) {
+            shown.emplace_back(slot.time, slot.last_shown);
+        }
+    }
+    std::sort(shown.begin(), shown.end());
+    return shown;
+};
+
+size_t PeerBuckets::NumShown() const
+{
+    LOCK(m_mutex);
+    return std::count_if(m_slots.begin(), m_slots.end(), [](const Slot &slot) { return slot.last_shown > 0; });
+};
+
+size_t PeerBuckets::DynamicMemoryUsage() const
+{
+    LOCK(m_mutex);
+    return memusage::DynamicUsage(m_slots);
+};
+
+void SmsgUploadBudget::SetRate(uint64_t bytes_per_second, uint64_t burst)
+{
+    LOCK(m_mutex);
+    m_rate = bytes_per_second;
+    m_burst = burst;
+    m_tokens = burst;
+    m_last_refill = 0;
+};
+
+void SmsgUploadBudget::Refill(int64_t now_micros)
+{
+    if (m_last_refill > 0 && now_micros > m_last_refill) {
+        m_tokens = std::min(m_burst, m_tokens + (double)(now_micros - m_last_refill) * m_rate / 1000000);
+    }
+    m_last_refill = now_micros;
+};
+
+bool SmsgUploadBudget::Available(size_t bytes, int64_t now_micros)
+{
+    LOCK(m_mutex);
+    if (m_rate == 0) {
+        return true;
+    }
+    Refill(now_micros);
+    return m_tokens >= std::min((double)bytes, m_burst);
+};
+
+bool SmsgUploadBudget::Consume(size_t bytes, int64_t now_micros)
+{
+    LOCK(m_mutex);
+    if (m_rate == 0) {
+        return true;
+    }
+    Refill(now_micros);
+    if (m_tokens < std::min((double)bytes, m_burst)) {
+        return false;
+    }
+    m_tokens -= bytes;
+    return true;
+};
+
+void SmsgUploadBudget::Refund(size_t bytes)
+{
+    LOCK(m_mutex);
+    if (m_rate == 0) {
+        return;
+    }
+    m_tokens = std::min(m_burst, m_tokens + bytes);
+};
@@ -7,20 +7,30 @@
 #define PARTICL_SMSG_SMESSAGE_H
 
 #include <sync.h>
+#include <checkqueue.h>
+#include <flatfile.h>
 #include <threadinterrupt.h>
 #include <key_io.h>
 #include <serialize.h>
 #include <lz4/lz4.h>
+#include <smsg/db.h>
 #include <smsg/keystore.h>
+#include <smsg/net.h>
 #include <interfaces/handler.h>
 #include <interfaces/node.h>
+#include <util/taskpool.h>
 #include <util/ui_change_type.h>
 #include <leveldb/write_batch.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <boost/signals2/signal.hpp>
+#include <boost/thread/thread.hpp>
 
 class UniValue;
+class arith_uint256;
 class CDataStream;
 class CWallet;
 class CCoinControl;
@@ -33,7 +43,8 @@ extern RecursiveMutex cs_main;
 
 namespace smsg {
 
-const int SMSG_VERSION = 1;
+const int SMSG_VERSION = 2;
+const int SMSG_VERSION_BATCH = 2;  // Peers from this version exchange inventory with smsgHaves and smsgWants
 
 enum SecureMessageCodes {
     SMSG_NO_ERROR = 0,
@@ -70,11 +81,13 @@ enum SecureMessageCodes {
     SMSG_FUND_FAILED,
     SMSG_PURGED_MSG,
     SMSG_FUND_DATA_NOT_FOUND,
-    SMSG_BATCH_NOT_INITIALISED
+    SMSG_BATCH_NOT_INITIALISED,
+    SMSG_UNKNOWN_DICTIONARY
 };
 
 const uint32_t SMSG_HDR_LEN        = 108;               // length of unencrypted header, 4 + 4 + 2 + 1 + 8 + 4 + 16 + 33 + 32 + 4
 const uint32_t SMSG_PL_HDR_LEN     = 1+20+65+4;         // length of encrypted header in payload
+const uint32_t SMSG_HINT_LEN       = 4;                 // length of the recipient hint prepended to the payload
 
 extern uint32_t SMSG_BUCKET_LEN;                        // seconds
 extern uint32_t SMSG_SECONDS_IN_DAY;
@@ -90,8 +103,21 @@ const uint32_t SMSG_THREAD_DELAY   = 30;
 
 const uint32_t SMSG_TIME_LEEWAY    = 24;
 const uint32_t SMSG_TIME_IGNORE    = 90;                // seconds a peer is ignored for if they fail to deliver messages for a smsgWant
+const uint32_t SMSG_WANT_TIMEOUT   = SMSG_THREAD_DELAY * 3; // seconds a wanted message is reserved for the peer it was requested from
 const uint32_t SMSG_DEFAULT_BANTIME = 8 * 60 * 60;
 const uint32_t SMSG_DEFAULT_MAXRCV = 4000;
+const int SMSG_DEFAULT_SCAN_THREADS = 0;               // 0 = auto, like -par
+const int SMSG_MAX_SCAN_THREADS = 16;
+const int SMSG_DEFAULT_POW_THREADS = 1;
+const int SMSG_MAX_POW_THREADS = 16;
+const int SMSG_SCAN_CHAIN_CHUNK = 500;                  // blocks read in parallel and committed together by the chain scan
+const int SMSG_DEFAULT_NET_THREADS = 1;
+const int SMSG_MAX_NET_THREADS = 8;
+const size_t SMSG_NET_QUEUE_PEER_MESSAGES = 64;         // smsg p2p messages queued per peer before more are dropped
+const size_t SMSG_NET_QUEUE_PEER_BYTES = 16 * 1024 * 1024;
+const int64_t SMSG_DEFAULT_MAX_UPLOAD_TARGET = 0;       // MiB per 24h of smsg inventory and messages sent to all peers, 0 = no limit
+const int64_t SMSG_DEFAULT_PEER_UPLOAD_RATE = 0;        // KiB/s of smsg inventory and messages sent to a peer, 0 = no limit
+const int64_t SMSG_UPLOAD_BURST_SECONDS = 10;           // seconds of the upload rate that can be sent at once
 
 const uint32_t SMSG_MAX_MSG_BYTES  = 24000;             // the user input part
 const uint32_t SMSG_MAX_AMSG_BYTES = 512;               // the user input part (ANON)
@@ -101,9 +127,17 @@ const uint32_t SMSG_MAX_MSG_BYTES_PAID = 512 * 1024;    // the user input part (
 const uint32_t SMSG_MAX_MSG_WORST = LZ4_COMPRESSBOUND(SMSG_MAX_MSG_BYTES+SMSG_PL_HDR_LEN);
 const uint32_t SMSG_MAX_MSG_WORST_PAID = LZ4_COMPRESSBOUND(SMSG_MAX_MSG_BYTES_PAID+SMSG_PL_HDR_LEN);
 
+// Minor version of messages compressed against a shared dictionary, the compressed data starts with the dictionary id
+const uint8_t SMSG_VERSION_MINOR_DICT = 2;
+const uint8_t SMSG_VERSION_MINOR_DICT_PAID = 1;
+const size_t SMSG_DICT_ID_LEN = 4;
+const size_t SMSG_MAX_DICT_BYTES = 64 * 1024;           // LZ4 matches reach back at most 64KiB
+
 const int32_t ACCEPT_FUNDING_TX_DEPTH = 1;
 const int64_t KEEP_FUNDING_TX_DATA = 86400 * 31;
 const int64_t PRUNE_FUNDING_TX_DATA = 3600;
+const size_t SMSG_DEFAULT_FUNDING_CACHE = 10000;        // funding txns kept in memory
+const size_t SMSG_DEFAULT_DECRYPTED_CACHE = 0;          // decrypted messages kept in memory, off to keep plaintext out of memory
 
 static const int MIN_SMSG_PROTO_VERSION = 90010;
 
@@ -111,6 +145,9 @@ extern const std::string STORE_DIR;
 
 #define SMSG_MASK_UNREAD (1 << 0)
 
+// SecureMessage.flags
+#define SMSG_FLAG_RECIPIENT_HINT (1 << 0)   // Payload starts with SMSG_HINT_LEN bytes derived from the shared secret
+
 class SecMsgStored;
 
 // Inbox db changed, called with lock cs_smsgDB held.
@@ -122,6 +159,9 @@ extern boost::signals2::signal<void (SecMsgStored &outboxHdr)> NotifySecMsgOutbo
 // Wallet unlocked, called after all messages received while locked have been processed.
 extern boost::signals2::signal<void ()> NotifySecMsgWalletUnlocked;
 
+/** Short tag of the ECDH shared secret, lets receivers reject a message for a key without hashing the payload */
+void GetRecipientHint(const uint256 &P, uint8_t *hint);
+
 inline bool GetFundingTxid(const uint8_t *pPayload, size_t nPayload, uint256 &txid)
 {
     if (!pPayload || nPayload < 32) {
@@ -164,6 +204,20 @@ public:
         return version[0] == 3;
     };
 
+    bool IsDictCompressed() const
+    {
+        return version[1] == (IsPaidVersion() ? SMSG_VERSION_MINOR_DICT_PAID : SMSG_VERSION_MINOR_DICT);
+    };
+
+    void SetDictCompressed(bool dict)
+    {
+        if (IsPaidVersion()) {
+            version[1] = dict ? SMSG_VERSION_MINOR_DICT_PAID : 0;
+        } else {
+            version[1] = dict ? SMSG_VERSION_MINOR_DICT : 1;
+        }
+    };
+
     bool GetFundingTxid(uint256 &txid) const
     {
         if (version[0] != 3) {
@@ -267,6 +321,7 @@ public:
     int64_t offset;         // offset in file
     int m_changed = 0;      // time changed relative to timestamp
     mutable uint32_t ttl;   // seconds
+    bool m_active = false;  // counted in SecMsgBucket::nActive
 };
 
 class SecMsgPurged // Purged token marker
@@ -314,24 +369,131 @@ public:
     SecMsgBucket()
     {
         timeChanged     = 0;
-        hash            = 0;
         nLeastTTL       = 0;
         nActive         = 0;
         nLockCount      = 0;
         nLockPeerId     = -1;
     };
 
+    /** Sort vTokens and rebuild the active token state, O(n log n) */
     void hashBucket(int64_t bucket_time);
+    /** Insert a token into the sorted token list and update the active token state, returns false if already present */
+    bool AddToken(const SecMsgToken &token);
+    /** Merge tokens not yet in the bucket into the sorted token list in one pass, O(n + k log n) */
+    void AddTokens(std::vector<SecMsgToken> &tokens);
+    /** Set the ttl of a purged token to 0 and remove it from the active tokens */
+    void PurgeToken(std::vector<SecMsgToken>::iterator it);
+    /** Remove tokens that timed out before now from the active tokens, O(expired tokens) */
+    void ExpireTokens(int64_t now);
+    /** Hash of the active token samples sent to peers, derived on demand from the token list */
+    uint32_t GetHash() const;
     size_t CountActive() const;
+    size_t DynamicMemoryUsage() const;
+
+    std::vector<SecMsgToken>::iterator FindToken(const SecMsgToken &token);
+    std::vector<SecMsgToken>::const_iterator FindToken(const SecMsgToken &token) const;
 
     int64_t               timeChanged;
-    uint32_t              hash;           // token set should get ordered the same on each node
     uint32_t              nLeastTTL;      // lowest ttl in seconds of messages in bucket
     uint32_t              nActive;        // Number of untimedout messages in bucket
-    uint32_t              nLockCount;     // set when smsgWant first sent, unset at end of smsgMsg, ticks down in ThreadSecureMsg()
+    uint32_t              nLockCount;     // set when smsgWant first sent, unset at end of smsgMsg, ticks down in SecureMsgHousekeeping()
     NodeId                nLockPeerId;    // id of peer that bucket is locked for
 
-    std::set<SecMsgToken> setTokens;
+    std::vector<SecMsgToken> vTokens;     // sorted by SecMsgToken::operator<
+
+private:
+    class ExpiryEntry
+    {
+    public:
+        ExpiryEntry(int64_t expiry_, const SecMsgToken &token)
+            : expiry(expiry_), timestamp(token.timestamp)
+        {
+            memcpy(sample, token.sample, 8);
+        }
+        bool operator >(const ExpiryEntry &y) const { return expiry > y.expiry; }
+        int64_t expiry;
+        int64_t timestamp;
+        uint8_t sample[8];
+    };
+
+    void SetActive(SecMsgToken &token, bool active);
+
+    uint64_t              m_digest = 0;   // order independent sum of the active token hashes
+    std::vector<ExpiryEntry> m_expiry;    // min heap of active tokens by expiry time, purged tokens are skipped when popped
+
+    mutable uint32_t      m_hash = 0;     // token set should get ordered the same on each node
+    mutable uint64_t      m_hash_digest = 0;
+    mutable uint32_t      m_hash_active = 0;
+    mutable bool          m_hash_set = false;
+};
+
+/**
+ * Buckets by bucket time, kept in a ring buffer of consecutive bucket slots.
+ * Only times that are a multiple of SMSG_BUCKET_LEN can be stored.
+ * Iterates in time order, erasing the oldest buckets drops whole slots off the front of the ring.
+ */
+class SecMsgBucketSet
+{
+public:
+    typedef std::pair<int64_t, SecMsgBucket> value_type;
+
+    template <typename Set, typename Value>
+    class Iter
+    {
+    public:
+        Iter() : m_set(nullptr), m_pos(0) {}
+        Iter(Set *set, size_t pos) : m_set(set), m_pos(pos) {}
+        template <typename OtherSet, typename OtherValue>
+        Iter(const Iter<OtherSet, OtherValue> &other) : m_set(other.m_set), m_pos(other.m_pos) {}
+        Value &operator*() const { return m_set->Slot(m_pos).value; }
+        Value *operator->() const { return &m_set->Slot(m_pos).value; }
+        Iter &operator++() { m_pos = m_set->NextUsed(m_pos + 1); return *this; }
+        bool operator==(const Iter &y) const { return m_pos == y.m_pos; }
+        bool operator!=(const Iter &y) const { return m_pos != y.m_pos; }
+    private:
+        friend class SecMsgBucketSet;
+        template <typename, typename> friend class Iter;
+        Set *m_set;
+        size_t m_pos;   // slot offset from m_first_time, m_span at end
+    };
+    typedef Iter<SecMsgBucketSet, value_type> iterator;
+    typedef Iter<const SecMsgBucketSet, const value_type> const_iterator;
+
+    iterator begin() { return iterator(this, NextUsed(0)); }
+    iterator end() { return iterator(this, m_span); }
+    const_iterator begin() const { return const_iterator(this, NextUsed(0)); }
+    const_iterator end() const { return const_iterator(this, m_span); }
+
+    iterator find(int64_t time);
+    const_iterator find(int64_t time) const;
+    /** Get the bucket for time, creating it if it doesn't exist */
+    SecMsgBucket &operator[](int64_t time);
+    /** Remove the bucket, returns the next bucket in time order */
+    iterator erase(iterator it);
+    void clear();
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    size_t DynamicMemoryUsage() const;
+
+private:
+    struct BucketSlot
+    {
+        bool used = false;
+        value_type value;
+    };
+
+    BucketSlot &Slot(size_t pos) { return m_slots[(m_head + pos) % m_slots.size()]; }
+    const BucketSlot &Slot(size_t pos) const { return m_slots[(m_head + pos) % m_slots.size()]; }
+    size_t NextUsed(size_t pos) const;
+    /** Grow the ring so that it covers time, returns the slot offset of time */
+    size_t Extend(int64_t time);
+
+    std::vector<BucketSlot> m_slots;
+    size_t m_head = 0;                  // ring index of the slot for m_first_time
+    size_t m_span = 0;                  // number of slots from m_head covered by the buckets
+    size_t m_count = 0;                 // number of used slots
+    int64_t m_first_time = 0;
 };
 
 class SecMsgAddress
@@ -425,20 +587,194 @@ public:
 void AddOptions(ArgsManager& argsman);
 const char *GetString(size_t errorCode);
 
+/** A receiving key copied out of the keystore or a wallet so messages can be scanned without cs_smsg */
+class SecMsgScanKey
+{
+public:
+    SecMsgScanKey(const CKeyID &address_, const CKey &key_, bool receive_anon_)
+        : address(address_), key(key_), receive_anon(receive_anon_) {}
+    CKeyID address;
+    CKey key;
+    bool receive_anon;
+};
+
+class CSMSG;
+/**
+ * Trial decryption of a message with one receiving key, run on the task pool.
+ * Returns false on a match, keys after the lowest matching one are skipped.
+ */
+class CSMSGScanCheck
+{
+private:
+    CSMSG *m_smsg = nullptr;
+    const SecMsgScanKey *m_key = nullptr;
+    size_t m_index = 0;
+    const uint8_t *m_header = nullptr;
+    const uint8_t *m_payload = nullptr;
+    uint32_t m_payload_len = 0;
+    std::atomic<size_t> *m_match = nullptr;
+
+public:
+    CSMSGScanCheck() {}
+    CSMSGScanCheck(CSMSG *smsg, const SecMsgScanKey *key, size_t index,
+        const uint8_t *header, const uint8_t *payload, uint32_t payload_len, std::atomic<size_t> *match)
+        : m_smsg(smsg), m_key(key), m_index(index), m_header(header), m_payload(payload), m_payload_len(payload_len), m_match(match) {}
+
+    bool operator()();
+};
+
+/**
+ * Proof of work over one slice of the nonce space, every step'th nonce from start.
+ * Returns false when a nonce is found, the other slices stop at their next nonce.
+ */
+class CSMSGPowCheck
+{
+private:
+    const uint8_t *m_header = nullptr;
+    const uint8_t *m_payload = nullptr;
+    uint32_t m_payload_len = 0;
+    const arith_uint256 *m_target = nullptr;
+    uint64_t m_start = 0;
+    uint32_t m_step = 1;
+    std::atomic<bool> *m_found = nullptr;
+    uint32_t *m_nonce_out = nullptr;
+    uint256 *m_hash_out = nullptr;
+    std::atomic<uint64_t> *m_hashes = nullptr;
+
+public:
+    CSMSGPowCheck() {}
+    CSMSGPowCheck(const uint8_t *header, const uint8_t *payload, uint32_t payload_len, const arith_uint256 *target,
+        uint64_t start, uint32_t step, std::atomic<bool> *found, uint32_t *nonce_out, uint256 *hash_out, std::atomic<uint64_t> *hashes)
+        : m_header(header), m_payload(payload), m_payload_len(payload_len), m_target(target),
+          m_start(start), m_step(step), m_found(found), m_nonce_out(nonce_out), m_hash_out(hash_out), m_hashes(hashes) {}
+
+    bool operator()();
+
+    void swap(CSMSGPowCheck &check)
+    {
+        std::swap(m_header, check.m_header);
+        std::swap(m_payload, check.m_payload);
+        std::swap(m_payload_len, check.m_payload_len);
+        std::swap(m_target, check.m_target);
+        std::swap(m_start, check.m_start);
+        std::swap(m_step, check.m_step);
+        std::swap(m_found, check.m_found);
+        std::swap(m_nonce_out, check.m_nonce_out);
+        std::swap(m_hash_out, check.m_hash_out);
+        std::swap(m_hashes, check.m_hashes);
+    }
+};
+
+/**
+ * Read one block for the chain scan and collect the public keys of its inputs, run on the task pool.
+ * The block position is copied under cs_main so the check doesn't need it.
+ */
+class CSMSGScanBlockCheck
+{
+private:
+    FlatFilePos m_pos;
+    std::vector<CPubKey> *m_pubkeys = nullptr;
+    uint32_t *m_num_txns = nullptr;
+
+public:
+    CSMSGScanBlockCheck() {}
+    CSMSGScanBlockCheck(const FlatFilePos &pos, std::vector<CPubKey> *pubkeys, uint32_t *num_txns)
+        : m_pos(pos), m_pubkeys(pubkeys), m_num_txns(num_txns) {}
+
+    bool operator()();
+};
+
+/** A message of a received smsgMsg bunch, pointing into the receive buffer */
+class SecMsgReceived
+{
+public:
+    SecMsgReceived(const uint8_t *header, const uint8_t *payload, uint32_t payload_len)
+        : m_header(header), m_payload(payload), m_payload_len(payload_len) {}
+    const uint8_t *m_header = nullptr;
+    const uint8_t *m_payload = nullptr;
+    uint32_t m_payload_len = 0;
+    int m_rv = 0;             // Result of CSMSG::Validate, then of storing
+    bool m_validated = false; // Passed CSMSG::Validate, a later failure to store isn't the peer's fault
+    bool m_refused = false;   // Backdated free message over the current difficulty, dropped without penalty
+};
+
+/**
+ * Validation of one received message, run on the task pool for a chunk of a bunch.
+ * Free messages timestamped before backdated_before must also meet the current difficulty.
+ */
+class CSMSGValidateCheck
+{
+private:
+    CSMSG *m_smsg = nullptr;
+    SecMsgReceived *m_msg = nullptr;
+    const arith_uint256 *m_backdated_target = nullptr;
+    int64_t m_backdated_before = 0;
+
+public:
+    CSMSGValidateCheck() {}
+    CSMSGValidateCheck(CSMSG *smsg, SecMsgReceived *msg, const arith_uint256 *backdated_target, int64_t backdated_before)
+        : m_smsg(smsg), m_msg(msg), m_backdated_target(backdated_target), m_backdated_before(backdated_before) {}
+
+    bool operator()();
+};
+
+class SecMsgInboxBatch;
+
+/** Funding data of a tx as stored in the db, the block hash followed by 24 byte msgid, fee pairs */
+class SecMsgFundingData
+{
+public:
+    SecMsgFundingData() {};
+    SecMsgFundingData(int height, const std::vector<uint8_t> &data) : m_height(height), m_data(data) {};
+    int m_height = 0;
+    std::vector<uint8_t> m_data;
+};
+
 extern std::atomic<bool> fSecMsgEnabled;
 class CSMSG
 {
+private:
+    typedef std::list<std::pair<uint256, SecMsgFundingData> > FundingCacheList;
+
+    //! Least recently used funding txns, front is most recent
+    Mutex m_funding_cache_mutex;
+    size_t m_funding_cache_max GUARDED_BY(m_funding_cache_mutex) = SMSG_DEFAULT_FUNDING_CACHE;
+    FundingCacheList m_funding_cache_list GUARDED_BY(m_funding_cache_mutex);
+    std::map<uint256, FundingCacheList::iterator> m_funding_cache_map GUARDED_BY(m_funding_cache_mutex);
+    //! Funding data of the block being connected, cached once m_connect_block_batch is committed
+    std::vector<std::pair<uint256, SecMsgFundingData> > m_connect_block_funding;
+
+    bool ScanChain(const CBlockIndex *pindexStart);
+
+    void AddFundingDataToCache(const uint256 &txid, const SecMsgFundingData &data) EXCLUSIVE_LOCKS_REQUIRED(m_funding_cache_mutex);
+    void TrimFundingCache() EXCLUSIVE_LOCKS_REQUIRED(m_funding_cache_mutex);
+
+    typedef std::list<std::pair<SecMsgId, MessageData> > DecryptedCacheList;
+
+    //! Least recently used decrypted stored messages, front is most recent
+    Mutex m_decrypted_cache_mutex;
+    size_t m_decrypted_cache_max GUARDED_BY(m_decrypted_cache_mutex) = SMSG_DEFAULT_DECRYPTED_CACHE;
+    DecryptedCacheList m_decrypted_cache_list GUARDED_BY(m_decrypted_cache_mutex);
+    std::map<SecMsgId, DecryptedCacheList::iterator> m_decrypted_cache_map GUARDED_BY(m_decrypted_cache_mutex);
+
+    void TrimDecryptedCache() EXCLUSIVE_LOCKS_REQUIRED(m_decrypted_cache_mutex);
+    /** Private key of an owned address from the smsg key store or an unlocked wallet */
+    int GetDecryptKey(const CKeyID &address, CKey &keyDest);
+
 public:
     void ParseArgs(const ArgsManager& args);
 
     int BuildBucketSet();
     int BuildPurgedSets();
+    int WriteBucketIndex();
     int AddWalletAddresses();
     int LoadKeyStore();
 
     int ReadIni();
     int WriteIni();
 
+    /** Build the bucket and purged sets on a thread while the node loads the chain, Start waits for it. */
+    void StartPreload();
     bool Start(std::shared_ptr<CWallet> pwalletIn, std::vector<std::shared_ptr<CWallet>> &vpwallets, bool fScanChain);
     bool Shutdown();
 
@@ -453,22 +789,54 @@ public:
     std::string LookupLabel(PKHash &hash);
 
     void GetNodesStats(int node_id, UniValue &result);
+    /** Memory held by the bucket state of all peers */
+    size_t PeerBucketsMemoryUsage();
     void ClearBanned();
     void ShowFundingTxns(UniValue &result);
 
     int ReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &strCommand, CDataStream &vRecv);
+    /**
+     * Hand an smsg p2p message to the net worker threads, the message handler
+     * thread returns without waiting for it. Peers are served in turn, one
+     * message each, and messages over a peer's queue limits are dropped.
+     * Messages of other types return SMSG_UNKNOWN_MESSAGE.
+     */
+    int QueueReceiveData(PeerManager *peerLogic, CNode *pfrom, const std::string &strCommand, CDataStream &vRecv);
+    /** Messages and bytes waiting for the net worker threads */
+    void GetNetQueueDepth(size_t &messages, size_t &bytes);
     bool SendData(CNode *pto, bool fSendTrickle);
 
+    /** Whether the peer and global upload budgets could cover bytes now */
+    bool UploadAvailable(CNode *pto, size_t bytes);
+    /** Take bytes from the peer and global upload budgets and count them, false and counted as deferred if either falls short */
+    bool ReserveUpload(CNode *pto, size_t bytes, bool is_msg);
+
+    /** Append the bucket time and the timestamp and sample of each active token changed since last_shown, false if the bucket doesn't exist */
+    bool ListBucketTokens(int64_t time, int64_t last_shown, std::vector<uint8_t> &vchOut) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    /** Append the tokens from pIn missing from the bucket and not already wanted from another peer, returns the number appended */
+    size_t SiftBucketTokens(int64_t time, const uint8_t *pIn, size_t n, size_t max_tokens, NodeId peer_id, std::vector<uint8_t> &vchOut) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    /** Append smsgMsg bunches of up to MAX_BUNCH_MESSAGES and MAX_BUNCH_BYTES for the tokens in pIn, paid messages first, returns the number of messages added */
+    size_t BunchBucketMessages(int64_t time, const uint8_t *pIn, size_t n, size_t max_bunches, std::vector<std::vector<uint8_t> > &vBunches) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+
     bool ScanBlock(const CBlock &block);
-    bool ScanChainForPublicKeys(CBlockIndex *pindexStart);
+    /** Scan the active chain from pindexStart, progress is committed every SMSG_SCAN_CHAIN_CHUNK blocks so an interrupted scan resumes */
+    bool ScanChainForPublicKeys(const CBlockIndex *pindexStart);
     bool ScanBlockChain();
+    /** Scan the chain on a background thread, resuming an interrupted scan if there is one, if resume_only don't start a new scan */
+    bool StartScanChain(bool resume_only=false);
     bool ScanBuckets(bool scan_all);
 
     int ManageLocalKey(CKeyID &keyId, ChangeType mode);
     int WalletUnlocked(CWallet *pwallet);
     int WalletKeyChanged(CKeyID &keyId, const std::string &sLabel, ChangeType mode);
 
-    int ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool reportToGui, bool &received_msg, bool unlocking=false);
+    void GetScanKeys(std::vector<SecMsgScanKey> &keys, bool &was_locked) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    /** Return the index of the first key from start the message MAC verifies with, or keys.size() */
+    size_t FindScanKey(const std::vector<SecMsgScanKey> &keys, size_t start, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload);
+    /** If batch is set inbox writes go to its db batch and notifications wait for CommitInboxBatch */
+    int ScanMessage(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool reportToGui, bool &received_msg, bool unlocking=false, SecMsgInboxBatch *batch=nullptr);
+    /** Write the inbox batch in one db write and send the notifications held back for it */
+    void CommitInboxBatch(SecMsgInboxBatch &batch);
 
     int GetStoredKey(const CKeyID &ckid, CPubKey &cpkOut);
     int GetLocalKey(const CKeyID &ckid, CPubKey &cpkOut);
@@ -489,13 +857,17 @@ public:
     int Remove(const SecMsgToken &token) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
 
     int SmsgMisbehaving(CNode *pfrom, uint8_t n);
-    int Receive(PeerManager *peerLogic, CNode *pfrom, std::vector<uint8_t> &vchData);
+    int Receive(PeerManager *peerLogic, CNode *pfrom, Span<const uint8_t> vchData);
+    /** Validate, store and scan a chunk of received messages, the result of each is left in its m_rv */
+    void ReceiveChunk(std::vector<SecMsgReceived> &chunk, int64_t now);
 
     int CheckPurged(const SecureMessage *psmsg, const uint8_t *pPayload);
 
     int StoreUnscanned(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload);
-    int Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, bool fHashBucket) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
-    int Store(const SecureMessage &smsg, bool fHashBucket) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    int Store(const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    int Store(const SecureMessage &smsg) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
+    /** Store the messages of a chunk with m_rv unset, appending to each bucket file once, returns the number stored */
+    size_t StoreChunk(std::vector<SecMsgReceived> &chunk) EXCLUSIVE_LOCKS_REQUIRED(cs_smsg);
 
     int Purge(std::vector<uint8_t> &vMsgId, std::string &sError);
 
@@ -519,6 +891,10 @@ public:
 
     int StartConnectingBlock();
     int StoreFundingTx(const CTransaction &tx, const CBlockIndex *pindex) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+    /** Read the funding data of txid from the cache, or from the db and add it to the cache */
+    int GetFundingData(const uint256 &txid, std::vector<uint8_t> &data);
+    void SetFundingCacheSize(size_t max_entries);
+    size_t FundingCacheCount();
     int CheckFundingTx(const Consensus::Params &consensus_params, const SecureMessage *psmsg, const uint8_t *pPayload);
     int PruneFundingTxData();
     int SetBestBlock(const uint256 &block_hash, int height, int64_t time);
@@ -536,10 +912,19 @@ public:
     int Decrypt(bool fTestOnly, const CKeyID &address, const uint8_t *pHeader, const uint8_t *pPayload, uint32_t nPayload, MessageData &msg);
     int Decrypt(bool fTestOnly, const CKeyID &address, const SecureMessage &smsg, MessageData &msg);
 
+    /** Add a compression dictionary for received messages, and to compress sent messages if use_to_send is set */
+    bool AddDictionary(const std::vector<uint8_t> &dictionary, bool use_to_send, uint32_t *dictionary_id=nullptr);
+    bool LoadDictionaries();
+    std::vector<uint32_t> ListDictionaries() const;
+    uint32_t SendDictionary() const { return m_send_dictionary; };
+    /** Decrypt a stored message, through the cache of decrypted messages if -smsgdecryptcache is set */
+    int DecryptStored(const SecMsgId &msgid, const CKeyID &address, const std::vector<uint8_t> &vchMessage, MessageData &msg);
+    void SetDecryptedCacheSize(size_t max_entries);
+
     RecursiveMutex cs_smsg; // All except inbox and outbox
 
     SecMsgKeyStore keyStore;
-    std::map<int64_t, SecMsgBucket> buckets;
+    SecMsgBucketSet buckets;
     std::vector<SecMsgAddress> addresses;
     std::set<SecMsgPurged> setPurged;
     std::set<int64_t> setPurgedTimestamps;
@@ -556,12 +941,63 @@ public:
     uint16_t m_smsg_max_receive_count = SMSG_DEFAULT_MAXRCV;
 
     std::map<int64_t, int64_t> m_show_requests;
+    std::map<SecMsgToken, std::pair<NodeId, int64_t> > m_wanted_tokens; // Peer a token was requested from and when the request expires
+
+    struct NetQueueItem {
+        PeerManager *peer_logic;
+        CNode *pfrom; // Referenced until processed
+        std::string command;
+        std::shared_ptr<CDataStream> data;
+        size_t bytes;
+    };
+    struct PeerNetQueue {
+        std::deque<NetQueueItem> items;
+        size_t bytes = 0;
+        bool busy = false; // A worker holds a message of the peer, its messages are processed in order
+    };
+    void ThreadNetWorker();
+    void StopNetWorkers();
+
+    Mutex m_net_mutex;
+    std::condition_variable m_net_cv;
+    bool m_net_running GUARDED_BY(m_net_mutex) = false;
+    std::map<NodeId, PeerNetQueue> m_net_queue GUARDED_BY(m_net_mutex);
+    std::deque<NodeId> m_net_ready GUARDED_BY(m_net_mutex); // Peers with messages and no busy worker, in turn
+    std::vector<std::thread> m_net_threads;
 
     CThreadInterrupt m_thread_interrupt;
-    std::thread thread_smsg;
+    uint64_t m_housekeeping_task = 0;       // SecureMsgHousekeeping on g_task_pool
+    uint32_t m_housekeeping_runs = 0;
+    int64_t m_housekeeping_pruned_funding = 0;
     std::thread thread_smsg_pow;
+    int m_num_scan_threads = 0;             // Task pool workers joining a scan, decryption or validation
+    CCheckQueue<CSMSGPowCheck> m_pow_queue{1};
+    boost::thread_group m_pow_threads;
+    int m_num_pow_threads = 0;
+    std::atomic<uint64_t> m_pow_hashes{0};  // Hashes tried by SetHash
+    std::atomic<int64_t> m_pow_time{0};     // Microseconds spent in SetHash
+    SmsgUploadBudget m_upload_budget;       // Shared by all peers, from -smsgmaxuploadtarget
+    uint64_t m_upload_target = 0;           // Bytes per 24h, from -smsgmaxuploadtarget
+    uint64_t m_peer_upload_rate = 0;        // Bytes per second, from -smsgpeeruploadrate
+    std::atomic<uint64_t> m_upload_inv_bytes{0};    // Bytes of smsgInv, smsgHave(s) sent
+    std::atomic<uint64_t> m_upload_msg_bytes{0};    // Bytes of smsgMsg sent
+    std::atomic<uint64_t> m_upload_inv_deferred{0}; // Inventory sends held back by the upload budgets
+    std::atomic<uint64_t> m_upload_msg_deferred{0}; // Message bunches held back by the upload budgets
+    std::thread thread_smsg_scan_chain;
+    std::thread m_preload_thread;
+    bool m_preloaded{false};                // Set by the preload thread, read after joining it
+    int m_preload_buckets_result{0};
+    int m_preload_purged_result{0};
+    std::atomic<bool> m_scan_chain_running{false};
+    std::atomic<int> m_scan_chain_height{-1};   // Last block committed by the chain scan
+    std::atomic<int> m_scan_chain_tip{-1};
+    std::atomic<uint32_t> m_scan_chain_pubkeys{0};
+    std::atomic<uint32_t> m_scan_chain_duplicates{0};
 
     bool m_track_funding_txns{false};
+    bool m_add_recipient_hint{false};
+    std::map<uint32_t, std::vector<uint8_t>> m_dictionaries;   // Compression dictionaries by id, only changed while stopped
+    uint32_t m_send_dictionary{0};                             // Id of the dictionary sent messages are compressed with, 0 for none
     leveldb::WriteBatch *m_connect_block_batch{nullptr};
 
     NodeContext *m_node = nullptr;
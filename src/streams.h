@@ -194,6 +194,45 @@ public:
     }
 };
 
+/** Minimal stream for reading from memory that outlives it, like a mapped file
+ */
+class SpanReader
+{
+private:
+    const int m_type;
+    const int m_version;
+    Span<const unsigned char> m_data;
+
+public:
+    SpanReader(int type, int version, Span<const unsigned char> data)
+        : m_type(type), m_version(version), m_data(data) {}
+
+    template<typename T>
+    SpanReader& operator>>(T& obj)
+    {
+        ::Unserialize(*this, obj);
+        return (*this);
+    }
+
+    int GetVersion() const { return m_version; }
+    int GetType() const { return m_type; }
+
+    size_t size() const { return m_data.size(); }
+    bool empty() const { return m_data.empty(); }
+
+    void read(char* dst, size_t n)
+    {
+        if (n == 0) {
+            return;
+        }
+        if (n > m_data.size()) {
+            throw std::ios_base::failure("SpanReader::read(): end of data");
+        }
+        memcpy(dst, m_data.data(), n);
+        m_data = m_data.subspan(n);
+    }
+};
+
 /** Double ended buffer combining vector and stream-like interfaces.
  *
  * >> and << read and write unformatted data using the above serialization templates.
@@ -303,6 +342,7 @@ public:
     const_reference operator[](size_type pos) const  { return vch[pos + nReadPos]; }
     reference operator[](size_type pos)              { return vch[pos + nReadPos]; }
     void clear()                                     { vch.clear(); nReadPos = 0; }
+    size_type capacity() const                       { return vch.capacity(); }
     iterator insert(iterator it, const char x=char()) { return vch.insert(it, x); }
     void insert(iterator it, size_type n, const char x) { vch.insert(it, n, x); }
     value_type* data()                               { return vch.data() + nReadPos; }
@@ -379,6 +419,23 @@ public:
         nReadPos = 0;
     }
 
+    /** Take the underlying buffer, leaving the stream empty */
+    vector_type TakeBuffer()
+    {
+        vector_type buf;
+        buf.swap(vch);
+        nReadPos = 0;
+        return buf;
+    }
+
+    /** Read and write into buf from now on, its contents are dropped but its capacity kept */
+    void SetBuffer(vector_type&& buf)
+    {
+        vch = std::move(buf);
+        vch.clear();
+        nReadPos = 0;
+    }
+
     bool Rewind(size_type n)
     {
         // Rewind by n characters if the buffer hasn't been compacted yet
@@ -13,9 +13,12 @@
 #include <util/strencodings.h>
 #include <util/threadnames.h>
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <set>
 #include <system_error>
+#include <tuple>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -32,6 +35,230 @@ void PrintLockContention(const char* pszName, const char* pszFile, int nLine)
 }
 #endif /* DEBUG_LOCKCONTENTION */
 
+std::atomic<bool> g_lock_profiling{false};
+
+struct LockProfileSite {
+    const char* lock_name = nullptr;
+    const char* file = nullptr;
+    int line = 0;
+    std::atomic<uint64_t> acquisitions{0};
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> wait_us{0};
+    std::atomic<uint64_t> wait_max_us{0};
+    std::atomic<uint64_t> hold_us{0};
+    std::atomic<uint64_t> hold_max_us{0};
+    std::array<std::atomic<uint64_t>, LOCK_PROFILE_BUCKETS> wait_histogram{};
+    std::array<std::atomic<uint64_t>, LOCK_PROFILE_BUCKETS> hold_histogram{};
+};
+
+namespace {
+
+//! Registered mutexes, a slot is free while its mutex is null
+struct LockProfileMutex {
+    std::atomic<const void*> cs{nullptr};
+    std::atomic<const char*> name{nullptr};
+};
+static const size_t LOCK_PROFILE_MAX_MUTEXES = 32;
+LockProfileMutex g_lock_profile_mutexes[LOCK_PROFILE_MAX_MUTEXES];
+std::atomic<size_t> g_lock_profile_registered{0};
+
+//! Sites are never erased, the pointers handed out stay valid
+struct LockProfileData {
+    std::mutex m_mutex;
+    std::map<std::tuple<const char*, const char*, int>, LockProfileSite> m_sites;
+};
+
+LockProfileData& GetLockProfileData()
+{
+    // Leaked, registered mutexes may be destroyed after the statics of this file
+    static LockProfileData& data = *new LockProfileData();
+    return data;
+}
+
+//! Registered mutexes held by this thread through a timed lock, deeper nesting isn't timed
+static const int LOCK_PROFILE_MAX_HELD = 8;
+thread_local const void* g_lock_profile_held[LOCK_PROFILE_MAX_HELD];
+thread_local int g_lock_profile_num_held = 0;
+
+int LockProfileBucket(int64_t us)
+{
+    int bucket = 0;
+    while (us > 0 && bucket < LOCK_PROFILE_BUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void UpdateMax(std::atomic<uint64_t>& max, uint64_t value)
+{
+    uint64_t prev = max.load(std::memory_order_relaxed);
+    while (prev < value && !max.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+void RegisterLockProfile(const void* cs, const char* name)
+{
+    LockProfileData& data = GetLockProfileData();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    for (const auto& slot : g_lock_profile_mutexes) {
+        if (slot.cs.load() == cs) {
+            return;
+        }
+    }
+    for (auto& slot : g_lock_profile_mutexes) {
+        if (!slot.cs.load()) {
+            slot.name.store(name);
+            slot.cs.store(cs, std::memory_order_release);
+            g_lock_profile_registered++;
+            return;
+        }
+    }
+    LogPrintf("%s: Too many mutexes to profile, not profiling %s\n", __func__, name);
+}
+
+void UnregisterLockProfile(const void* cs)
+{
+    if (g_lock_profile_registered.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    for (auto& slot : g_lock_profile_mutexes) {
+        const void* expected = cs;
+        if (slot.cs.compare_exchange_strong(expected, nullptr)) {
+            g_lock_profile_registered--;
+            return;
+        }
+    }
+}
+
+LockProfileSite* LockProfileEnter(const void* cs, const char* pszFile, int nLine)
+{
+    const char* name = nullptr;
+    for (const auto& slot : g_lock_profile_mutexes) {
+        if (slot.cs.load(std::memory_order_acquire) == cs) {
+            name = slot.name.load();
+            break;
+        }
+    }
+    if (!name || g_lock_profile_num_held >= LOCK_PROFILE_MAX_HELD ||
+        std::find(g_lock_profile_held, g_lock_profile_held + g_lock_profile_num_held, cs) != g_lock_profile_held + g_lock_profile_num_held) {
+        return nullptr;
+    }
+
+    LockProfileSite* site;
+    {
+        LockProfileData& data = GetLockProfileData();
+        std::lock_guard<std::mutex> lock(data.m_mutex);
+        site = &data.m_sites[std::make_tuple(name, pszFile, nLine)];
+        if (!site->lock_name) {
+            site->lock_name = name;
+            site->file = pszFile;
+            site->line = nLine;
+        }
+    }
+    g_lock_profile_held[g_lock_profile_num_held++] = cs;
+    site->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    return site;
+}
+
+void LockProfileWaited(LockProfileSite* site, int64_t wait_us)
+{
+    site->contended.fetch_add(1, std::memory_order_relaxed);
+    site->wait_us.fetch_add(wait_us, std::memory_order_relaxed);
+    UpdateMax(site->wait_max_us, wait_us);
+    site->wait_histogram[LockProfileBucket(wait_us)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void LockProfileLeave(const void* cs, LockProfileSite* site, int64_t hold_us)
+{
+    const void** end = g_lock_profile_held + g_lock_profile_num_held;
+    const void** it = std::find(g_lock_profile_held, end, cs);
+    if (it != end) {
+        std::copy(it + 1, end, it);
+        g_lock_profile_num_held--;
+    }
+    if (hold_us < 0) {
+        return;
+    }
+    site->hold_us.fetch_add(hold_us, std::memory_order_relaxed);
+    UpdateMax(site->hold_max_us, hold_us);
+    site->hold_histogram[LockProfileBucket(hold_us)].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<LockProfileStats> GetLockProfile()
+{
+    // Sites of one file and line compiled into several translation units are merged
+    std::map<std::tuple<std::string, std::string, int>, LockProfileStats> merged;
+    {
+        LockProfileData& data = GetLockProfileData();
+        std::lock_guard<std::mutex> lock(data.m_mutex);
+        for (const auto& it : data.m_sites) {
+            const LockProfileSite& site = it.second;
+            LockProfileStats& stats = merged[std::make_tuple(std::string(site.lock_name), std::string(site.file), site.line)];
+            if (stats.wait_histogram.empty()) {
+                stats.lock_name = site.lock_name;
+                stats.file = site.file;
+                stats.line = site.line;
+                stats.wait_histogram.resize(LOCK_PROFILE_BUCKETS);
+                stats.hold_histogram.resize(LOCK_PROFILE_BUCKETS);
+            }
+            stats.acquisitions += site.acquisitions.load();
+            stats.contended += site.contended.load();
+            stats.wait_us += site.wait_us.load();
+            stats.wait_max_us = std::max(stats.wait_max_us, site.wait_max_us.load());
+            stats.hold_us += site.hold_us.load();
+            stats.hold_max_us = std::max(stats.hold_max_us, site.hold_max_us.load());
+            for (int b = 0; b < LOCK_PROFILE_BUCKETS; ++b) {
+                stats.wait_histogram[b] += site.wait_histogram[b].load();
+                stats.hold_histogram[b] += site.hold_histogram[b].load();
+            }
+        }
+    }
+
+    std::vector<LockProfileStats> result;
+    for (auto& it : merged) {
+        if (it.second.acquisitions > 0) {
+            result.push_back(std::move(it.second));
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const LockProfileStats& a, const LockProfileStats& b) {
+        return a.wait_us > b.wait_us;
+    });
+    return result;
+}
+
+void ResetLockProfile()
+{
+    LockProfileData& data = GetLockProfileData();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    for (auto& it : data.m_sites) {
+        LockProfileSite& site = it.second;
+        site.acquisitions = 0;
+        site.contended = 0;
+        site.wait_us = 0;
+        site.wait_max_us = 0;
+        site.hold_us = 0;
+        site.hold_max_us = 0;
+        for (int b = 0; b < LOCK_PROFILE_BUCKETS; ++b) {
+            site.wait_histogram[b] = 0;
+            site.hold_histogram[b] = 0;
+        }
+    }
+}
+
+void LogLockProfile(size_t max_sites)
+{
+    const std::vector<LockProfileStats> sites = GetLockProfile();
+    LogPrintf("Lock profile, %d sites by total wait:\n", std::min(max_sites, sites.size()));
+    for (size_t i = 0; i < sites.size() && i < max_sites; ++i) {
+        const LockProfileStats& s = sites[i];
+        LogPrintf("  %s at %s:%d: %d locks, %d contended, wait %dus (max %dus), hold %dus (max %dus)\n",
+            s.lock_name, s.file, s.line, s.acquisitions, s.contended, s.wait_us, s.wait_max_us, s.hold_us, s.hold_max_us);
+    }
+}
+
 #ifdef DEBUG_LOCKORDER
 //
 // Early deadlock detection.
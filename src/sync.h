@@ -9,10 +9,14 @@
 #include <threadsafety.h>
 #include <util/macros.h>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 ////////////////////////////////////////////////
 //                                            //
@@ -83,12 +87,15 @@ inline bool LockStackEmpty() { return true; }
  * Template mixin that adds -Wthread-safety locking annotations and lock order
  * checking to a subset of the mutex API.
  */
+void UnregisterLockProfile(const void* cs);
+
 template <typename PARENT>
 class LOCKABLE AnnotatedMixin : public PARENT
 {
 public:
     ~AnnotatedMixin() {
         DeleteLock((void*)this);
+        UnregisterLockProfile((const void*)this);
     }
 
     void lock() EXCLUSIVE_LOCK_FUNCTION()
@@ -128,14 +135,67 @@ typedef AnnotatedMixin<std::mutex> Mutex;
 void PrintLockContention(const char* pszName, const char* pszFile, int nLine);
 #endif
 
+/**
+ * Lock profiling, see -lockprofile. Registered mutexes have the time spent waiting for and holding
+ * them recorded per LOCK site. Only the outermost lock of a mutex by a thread is timed, TRY_LOCK isn't.
+ */
+//! Histogram buckets, bucket 0 counts times under 1us and bucket b times in [2^(b-1), 2^b) us
+static const int LOCK_PROFILE_BUCKETS = 24;
+extern std::atomic<bool> g_lock_profiling;
+struct LockProfileSite;
+//! Profile the mutex at cs under name, which must be a string literal. The mutex is dropped when destroyed.
+void RegisterLockProfile(const void* cs, const char* name);
+//! Site of a registered mutex not yet held by this thread, null otherwise
+LockProfileSite* LockProfileEnter(const void* cs, const char* pszFile, int nLine);
+void LockProfileWaited(LockProfileSite* site, int64_t wait_us);
+//! Record the hold time of a site from LockProfileEnter, hold_us < 0 when the lock was released elsewhere
+void LockProfileLeave(const void* cs, LockProfileSite* site, int64_t hold_us);
+
+struct LockProfileStats
+{
+    std::string lock_name;
+    std::string file;
+    int line = 0;
+    uint64_t acquisitions = 0;
+    uint64_t contended = 0;
+    uint64_t wait_us = 0;
+    uint64_t wait_max_us = 0;
+    uint64_t hold_us = 0;
+    uint64_t hold_max_us = 0;
+    std::vector<uint64_t> wait_histogram;
+    std::vector<uint64_t> hold_histogram;
+};
+//! Stats of all sites, ordered by total wait time
+std::vector<LockProfileStats> GetLockProfile();
+void ResetLockProfile();
+//! Log the max_sites sites with the most total wait time
+void LogLockProfile(size_t max_sites);
+
 /** Wrapper around std::unique_lock style lock for Mutex. */
 template <typename Mutex, typename Base = typename Mutex::UniqueLock>
 class SCOPED_LOCKABLE UniqueLock : public Base
 {
 private:
+    LockProfileSite* m_profile_site = nullptr;
+    std::chrono::steady_clock::time_point m_profile_start;
+
     void Enter(const char* pszName, const char* pszFile, int nLine)
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(Base::mutex()));
+        if (g_lock_profiling.load(std::memory_order_relaxed)) {
+            m_profile_site = LockProfileEnter((const void*)Base::mutex(), pszFile, nLine);
+            if (m_profile_site) {
+                if (!Base::try_lock()) {
+                    const auto wait_start = std::chrono::steady_clock::now();
+                    Base::lock();
+                    m_profile_start = std::chrono::steady_clock::now();
+                    LockProfileWaited(m_profile_site, std::chrono::duration_cast<std::chrono::microseconds>(m_profile_start - wait_start).count());
+                } else {
+                    m_profile_start = std::chrono::steady_clock::now();
+                }
+                return;
+            }
+        }
 #ifdef DEBUG_LOCKCONTENTION
         if (!Base::try_lock()) {
             PrintLockContention(pszName, pszFile, nLine);
@@ -146,6 +206,14 @@ private:
 #endif
     }
 
+    void ProfileLeave()
+    {
+        if (!m_profile_site) return;
+        const int64_t hold_us = Base::owns_lock() ? std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_profile_start).count() : -1;
+        LockProfileLeave((const void*)Base::mutex(), m_profile_site, hold_us);
+        m_profile_site = nullptr;
+    }
+
     bool TryEnter(const char* pszName, const char* pszFile, int nLine)
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(Base::mutex()), true);
@@ -177,6 +245,7 @@ public:
 
     ~UniqueLock() UNLOCK_FUNCTION()
     {
+        ProfileLeave();
         if (Base::owns_lock())
             LeaveCritical();
     }
@@ -198,6 +267,7 @@ public:
     public:
         explicit reverse_lock(UniqueLock& _lock, const char* _guardname, const char* _file, int _line) : lock(_lock), file(_file), line(_line) {
             CheckLastCritical((void*)lock.mutex(), lockname, _guardname, _file, _line);
+            lock.ProfileLeave();
             lock.unlock();
             LeaveCritical();
             lock.swap(templock);
@@ -0,0 +1,77 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <chain.h>
+#include <chainparams.h>
+#include <node/blockcache.h>
+#include <test/util/setup_common.h>
+#include <validation.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(blockcache_tests, TestChain100Setup)
+
+BOOST_AUTO_TEST_CASE(blockcache_shared_reads)
+{
+    const Consensus::Params& params = Params().GetConsensus();
+    std::vector<const CBlockIndex*> chain;
+    {
+        LOCK(cs_main);
+        for (int height = 0; height <= ::ChainActive().Height(); ++height) {
+            chain.push_back(::ChainActive()[height]);
+        }
+    }
+    BOOST_REQUIRE(chain.size() > 10);
+
+    g_block_cache.SetMaxMemory(1 << 20);
+    g_block_cache.Clear();
+    BlockCacheStats stats_start = g_block_cache.GetStats();
+
+    // The first read goes to disk, later readers share the decoded block
+    std::shared_ptr<const CBlock> block_a = ReadSharedBlockFromDisk(chain[5], params);
+    BOOST_REQUIRE(block_a);
+    BOOST_CHECK(block_a->GetHash() == chain[5]->GetBlockHash());
+    std::shared_ptr<const CBlock> block_b = ReadSharedBlockFromDisk(chain[5], params);
+    BOOST_CHECK(block_a == block_b);
+
+    CBlock block;
+    BOOST_REQUIRE(ReadBlockFromDisk(block, chain[5], params));
+    BOOST_CHECK(block.GetHash() == chain[5]->GetBlockHash());
+    BOOST_CHECK(block.vtx[0] == block_a->vtx[0]);
+
+    BlockCacheStats stats = g_block_cache.GetStats();
+    BOOST_CHECK_EQUAL(stats.hits - stats_start.hits, 2U);
+    BOOST_CHECK_EQUAL(stats.misses - stats_start.misses, 1U);
+    BOOST_CHECK_EQUAL(stats.entries, 1U);
+    BOOST_CHECK(stats.usage > 0);
+
+    // Blocks read without rangeproofs are not added, but are served from the cache
+    BOOST_REQUIRE(ReadBlockFromDisk(block, chain[6], params, SERIALIZE_TRANSACTION_NO_RANGEPROOF));
+    BOOST_CHECK(block.GetHash() == chain[6]->GetBlockHash());
+    BOOST_CHECK_EQUAL(g_block_cache.GetStats().entries, 1U);
+    BOOST_REQUIRE(ReadBlockFromDisk(block, chain[5], params, SERIALIZE_TRANSACTION_NO_RANGEPROOF));
+    BOOST_CHECK(block.GetHash() == chain[5]->GetBlockHash());
+
+    // The least recently used blocks are dropped to stay under the limit
+    for (size_t i = 0; i < chain.size(); ++i) {
+        BOOST_REQUIRE(ReadSharedBlockFromDisk(chain[i], params));
+    }
+    const size_t usage_one = stats.usage;
+    g_block_cache.SetMaxMemory(usage_one * 3);
+    stats = g_block_cache.GetStats();
+    BOOST_CHECK(stats.usage <= usage_one * 3);
+    BOOST_CHECK(stats.entries > 0);
+    BOOST_CHECK(g_block_cache.Get(chain.back()->GetBlockHash()));
+    BOOST_CHECK(!g_block_cache.Get(chain[0]->GetBlockHash()));
+
+    // Disabled, blocks are still read
+    g_block_cache.SetMaxMemory(0);
+    BOOST_CHECK_EQUAL(g_block_cache.GetStats().entries, 0U);
+    block_a = ReadSharedBlockFromDisk(chain[7], params);
+    BOOST_REQUIRE(block_a);
+    BOOST_CHECK(block_a->GetHash() == chain[7]->GetBlockHash());
+    BOOST_CHECK(!g_block_cache.Get(chain[7]->GetBlockHash()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
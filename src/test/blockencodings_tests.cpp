@@ -101,12 +101,26 @@ BOOST_AUTO_TEST_CASE(SimpleRoundTripTest)
         bool mutated;
         BOOST_CHECK(block.hashMerkleRoot != BlockMerkleRoot(block2, &mutated));
 
+        const int plain = (int)FeeEstimateTxType::PLAIN;
+        const uint64_t blocks = g_compact_block_stats.blocks;
+        const uint64_t blocks_no_request = g_compact_block_stats.blocks_no_request;
+        const uint64_t prefilled = g_compact_block_stats.prefilled[plain];
+        const uint64_t from_mempool = g_compact_block_stats.mempool[plain];
+        const uint64_t requested = g_compact_block_stats.requested[plain];
+
         CBlock block3;
         BOOST_CHECK(partialBlock.FillBlock(block3, {block.vtx[1]}) == READ_STATUS_OK);
 
         BOOST_CHECK_EQUAL(block.GetHash().ToString(), block3.GetHash().ToString());
         BOOST_CHECK_EQUAL(block.hashMerkleRoot.ToString(), BlockMerkleRoot(block3, &mutated).ToString());
         BOOST_CHECK(!mutated);
+
+        // Only the successful reconstruction is counted
+        BOOST_CHECK_EQUAL(g_compact_block_stats.blocks.load(), blocks + 1);
+        BOOST_CHECK_EQUAL(g_compact_block_stats.blocks_no_request.load(), blocks_no_request);
+        BOOST_CHECK_EQUAL(g_compact_block_stats.prefilled[plain].load(), prefilled + 1);
+        BOOST_CHECK_EQUAL(g_compact_block_stats.mempool[plain].load(), from_mempool + 1);
+        BOOST_CHECK_EQUAL(g_compact_block_stats.requested[plain].load(), requested + 1);
     }
 }
 
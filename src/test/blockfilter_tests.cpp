@@ -6,6 +6,7 @@
 #include <test/util/setup_common.h>
 
 #include <blockfilter.h>
+#include <compat/endian.h>
 #include <core_io.h>
 #include <serialize.h>
 #include <streams.h>
@@ -125,6 +126,89 @@ BOOST_AUTO_TEST_CASE(blockfilter_basic_test)
     BOOST_CHECK(default_ctor_block_filter_1.GetEncodedFilter() == default_ctor_block_filter_2.GetEncodedFilter());
 }
 
+BOOST_AUTO_TEST_CASE(blockfilter_particl_test)
+{
+    CScript script_standard, script_blind, script_spent, script_unrelated;
+    script_standard << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 1) << OP_EQUALVERIFY << OP_CHECKSIG;
+    script_blind << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 2) << OP_EQUALVERIFY << OP_CHECKSIG;
+    script_spent << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 3) << OP_EQUALVERIFY << OP_CHECKSIG;
+    script_unrelated << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 4) << OP_EQUALVERIFY << OP_CHECKSIG;
+
+    const uint32_t prefix_anon = 0xA1B2C3D4, prefix_standard = 0x01020304;
+    auto stealth_data = [](uint8_t marker, uint32_t prefix) {
+        std::vector<uint8_t> data;
+        if (marker) data.push_back(marker);
+        data.insert(data.end(), 33, 0x02);
+        data.push_back(DO_STEALTH_PREFIX);
+        const uint32_t tmp = htole32(prefix);
+        data.insert(data.end(), (const uint8_t*)&tmp, (const uint8_t*)&tmp + 4);
+        return data;
+    };
+
+    CMutableTransaction tx;
+    tx.nVersion = GHOST_TXN_VERSION;
+    tx.vpout.push_back(MAKE_OUTPUT<CTxOutData>(stealth_data(DO_STEALTH, prefix_standard)));
+    OUTPUT_PTR<CTxOutStandard> out_standard = MAKE_OUTPUT<CTxOutStandard>();
+    out_standard->scriptPubKey = script_standard;
+    tx.vpout.push_back(out_standard);
+    OUTPUT_PTR<CTxOutCT> out_blind = MAKE_OUTPUT<CTxOutCT>();
+    out_blind->scriptPubKey = script_blind;
+    out_blind->vData.assign(33, 0x03);
+    tx.vpout.push_back(out_blind);
+    OUTPUT_PTR<CTxOutRingCT> out_anon = MAKE_OUTPUT<CTxOutRingCT>();
+    std::vector<uint8_t> pk(33, 0x05);
+    pk[0] = 0x02;
+    memcpy(out_anon->pk.ncbegin(), pk.data(), 33);
+    out_anon->vData = stealth_data(0, prefix_anon);
+    tx.vpout.push_back(out_anon);
+
+    CTxIn txin;
+    txin.prevout.n = COutPoint::ANON_MARKER;
+    txin.SetAnonInfo(2, 3);
+    std::vector<uint8_t> key_images(2 * 33, 0x03);
+    key_images[33 + 1] = 0x07;
+    txin.scriptData.stack.push_back(key_images);
+    tx.vin.push_back(txin);
+
+    CBlock block;
+    block.vtx.push_back(MakeTransactionRef(tx));
+    CBlockUndo block_undo;
+    block_undo.vtxundo.emplace_back();
+    block_undo.vtxundo.back().vprevout.emplace_back(CTxOut(500, script_spent), 1000, false);
+
+    // Basic filters only see CTxOut scripts
+    BlockFilter basic_filter(BlockFilterType::BASIC, block, block_undo);
+    BOOST_CHECK(!basic_filter.GetFilter().Match(GCSFilter::Element(script_standard.begin(), script_standard.end())));
+
+    BlockFilter block_filter(BlockFilterType::PARTICL, block, block_undo);
+    const GCSFilter& filter = block_filter.GetFilter();
+    for (const CScript& script : {script_standard, script_blind, script_spent}) {
+        BOOST_CHECK(filter.Match(GCSFilter::Element(script.begin(), script.end())));
+    }
+    BOOST_CHECK(!filter.Match(GCSFilter::Element(script_unrelated.begin(), script_unrelated.end())));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(pk.begin(), pk.end())));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(key_images.begin(), key_images.begin() + 33)));
+    BOOST_CHECK(filter.Match(GCSFilter::Element(key_images.begin() + 33, key_images.end())));
+
+    // A wallet with a 4 bit prefix queries every 8 bit completion
+    GCSFilter::ElementSet prefix_query;
+    for (uint32_t high = 0; high < 16; ++high) {
+        prefix_query.insert(StealthPrefixFilterElement(8, (high << 4) | (prefix_anon & 0xF)));
+    }
+    BOOST_CHECK(filter.MatchAny(prefix_query));
+    BOOST_CHECK(filter.Match(StealthPrefixFilterElement(16, prefix_anon | 0xFFFF0000)));
+    BOOST_CHECK(filter.Match(StealthPrefixFilterElement(16, prefix_standard)));
+    BOOST_CHECK(!filter.Match(StealthPrefixFilterElement(16, prefix_standard ^ 0x100)));
+
+    // Serialization keeps the type
+    BlockFilter block_filter2;
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << block_filter;
+    stream >> block_filter2;
+    BOOST_CHECK_EQUAL(block_filter2.GetFilterType(), BlockFilterType::PARTICL);
+    BOOST_CHECK(block_filter.GetEncodedFilter() == block_filter2.GetEncodedFilter());
+}
+
 BOOST_AUTO_TEST_CASE(blockfilters_json_test)
 {
     UniValue json;
@@ -182,11 +266,14 @@ BOOST_AUTO_TEST_CASE(blockfilters_json_test)
 BOOST_AUTO_TEST_CASE(blockfilter_type_names)
 {
     BOOST_CHECK_EQUAL(BlockFilterTypeName(BlockFilterType::BASIC), "basic");
+    BOOST_CHECK_EQUAL(BlockFilterTypeName(BlockFilterType::PARTICL), "particl");
     BOOST_CHECK_EQUAL(BlockFilterTypeName(static_cast<BlockFilterType>(255)), "");
 
     BlockFilterType filter_type;
     BOOST_CHECK(BlockFilterTypeByName("basic", filter_type));
     BOOST_CHECK_EQUAL(filter_type, BlockFilterType::BASIC);
+    BOOST_CHECK(BlockFilterTypeByName("particl", filter_type));
+    BOOST_CHECK_EQUAL(filter_type, BlockFilterType::PARTICL);
 
     BOOST_CHECK(!BlockFilterTypeByName("unknown", filter_type));
 }
@@ -0,0 +1,58 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <chain.h>
+#include <chainparams.h>
+#include <node/blockprefetch.h>
+#include <test/util/setup_common.h>
+#include <util/time.h>
+#include <validation.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(blockprefetch_tests, TestChain100Setup)
+
+BOOST_AUTO_TEST_CASE(blockprefetch_sequential_reads)
+{
+    const Consensus::Params& params = Params().GetConsensus();
+    std::vector<const CBlockIndex*> chain;
+    {
+        LOCK(cs_main);
+        for (int height = 0; height <= ::ChainActive().Height(); ++height) {
+            chain.push_back(::ChainActive()[height]);
+        }
+    }
+    BOOST_REQUIRE(chain.size() > 10);
+
+    g_block_prefetcher.Start(2, 4, 1 << 20);
+
+    // Two reads of consecutive blocks start the read ahead
+    CBlock block;
+    BOOST_CHECK(ReadBlockFromDisk(block, chain[0], params));
+    BOOST_CHECK(ReadBlockFromDisk(block, chain[1], params));
+    for (int i = 0; i < 500 && g_block_prefetcher.Size() == 0; ++i) {
+        UninterruptibleSleep(std::chrono::milliseconds{10});
+    }
+    BOOST_CHECK(g_block_prefetcher.Size() > 0);
+    BOOST_CHECK(g_block_prefetcher.Size() <= 4);
+
+    // Blocks come back unchanged, whether read ahead or not
+    for (size_t i = 2; i < chain.size(); ++i) {
+        BOOST_REQUIRE(ReadBlockFromDisk(block, chain[i], params));
+        BOOST_CHECK(block.GetHash() == chain[i]->GetBlockHash());
+    }
+
+    // A random access reader gets the right block too
+    BOOST_REQUIRE(ReadBlockFromDisk(block, chain[5], params));
+    BOOST_CHECK(block.GetHash() == chain[5]->GetBlockHash());
+
+    g_block_prefetcher.Stop();
+    BOOST_CHECK_EQUAL(g_block_prefetcher.Size(), 0U);
+
+    // Stopped, reads go straight to disk
+    BOOST_REQUIRE(ReadBlockFromDisk(block, chain[6], params));
+    BOOST_CHECK(block.GetHash() == chain[6]->GetBlockHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -276,6 +276,115 @@ BOOST_AUTO_TEST_CASE(coins_cache_simulation_test)
     SimulationTest(&db_base, true);
 }
 
+BOOST_AUTO_TEST_CASE(coins_db_parallel_walk)
+{
+    CCoinsViewDB db{"test", /*nCacheSize*/ 1 << 23, /*fMemory*/ true, /*fWipe*/ false};
+    {
+        CCoinsViewCache cache(&db);
+        for (int i = 0; i < 1000; ++i) {
+            const uint256 txid = InsecureRand256();
+            for (uint32_t n = 0; n < 1 + InsecureRandBits(2); ++n) {
+                Coin coin;
+                coin.out.nValue = InsecureRand32();
+                coin.nHeight = 1;
+                cache.AddCoin(COutPoint(txid, n), std::move(coin), false);
+            }
+        }
+        cache.SetBestBlock(InsecureRand256(), 1);
+        BOOST_CHECK(cache.Flush());
+    }
+
+    std::vector<COutPoint> expected;
+    std::unique_ptr<CCoinsViewCursor> cursor(db.Cursor());
+    for (; cursor->Valid(); cursor->Next()) {
+        COutPoint key;
+        BOOST_CHECK(cursor->GetKey(key));
+        expected.push_back(key);
+    }
+
+    // Each range is walked in order and the ranges follow each other
+    std::vector<std::vector<COutPoint>> ranges(7);
+    std::vector<int> done(ranges.size(), 0);
+    uint256 hash_block;
+    BOOST_CHECK(db.ForEachCoinParallel(ranges.size(), 3, [&ranges](size_t range, const COutPoint& key, const Coin&) {
+            ranges[range].push_back(key);
+            return true;
+        }, [&done](size_t range) { done[range]++; }, hash_block));
+    BOOST_CHECK(hash_block == db.GetBestBlock());
+
+    std::vector<COutPoint> walked;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        BOOST_CHECK_EQUAL(done[i], 1);
+        walked.insert(walked.end(), ranges[i].begin(), ranges[i].end());
+    }
+    BOOST_CHECK(walked == expected);
+
+    // Returning false stops the walk
+    BOOST_CHECK(!db.ForEachCoinParallel(ranges.size(), 3, [](size_t, const COutPoint&, const Coin&) { return false; }, {}, hash_block));
+}
+
+BOOST_AUTO_TEST_CASE(coins_db_writeback)
+{
+    CCoinsViewDB db{"test", /*nCacheSize*/ 1 << 23, /*fMemory*/ true, /*fWipe*/ false};
+    CCoinsViewCache cache(&db);
+    cache.SetTrackDirty(true);
+
+    const uint256 block1 = InsecureRand256();
+    const uint256 block2 = InsecureRand256();
+    const uint256 block3 = InsecureRand256();
+    const COutPoint kept(InsecureRand256(), 0);
+    const COutPoint spent(InsecureRand256(), 0);
+    for (const COutPoint& outpoint : {kept, spent}) {
+        Coin coin;
+        coin.out.nValue = 1000;
+        coin.nHeight = 1;
+        cache.AddCoin(outpoint, std::move(coin), false);
+    }
+    cache.SetBestBlock(block1, 1);
+    BOOST_CHECK(cache.Flush());
+
+    // Change both coins and let a block pass
+    BOOST_CHECK(cache.SpendCoin(spent));
+    Coin coin;
+    coin.out.nValue = 2000;
+    coin.nHeight = 2;
+    cache.AddCoin(kept, std::move(coin), true);
+    CCoinsMap none;
+    BOOST_CHECK(cache.BatchWrite(none, block2));
+
+    CCoinsMap batch;
+    BOOST_CHECK_EQUAL(cache.TakeOldestDirty(batch, 10, 2), 0U);
+    BOOST_CHECK_EQUAL(cache.TakeOldestDirty(batch, 10, 1), 2U);
+    BOOST_CHECK_EQUAL(cache.cacheCoins.at(kept).flags, CCoinsCacheEntry::WRITING);
+
+    // Coins being written stay cached
+    cache.Uncache(kept);
+    BOOST_CHECK(cache.HaveCoinInCache(kept));
+
+    db.BeginWriteback();
+    BOOST_CHECK(db.BatchWritePartial(batch, block2));
+    db.EndWriteback(true);
+    cache.FinishWriteback(batch);
+    BOOST_CHECK_EQUAL(cache.cacheCoins.at(kept).flags, 0);
+    BOOST_CHECK_EQUAL(cache.cacheCoins.count(spent), 0U);
+
+    // The database is left in transition to the block the batch was taken at
+    BOOST_CHECK(db.HasPartialWrites());
+    BOOST_CHECK(db.GetBestBlock().IsNull());
+    BOOST_CHECK(db.GetHeadBlocks() == std::vector<uint256>({block2, block1}));
+    Coin read;
+    BOOST_CHECK(db.GetCoin(kept, read));
+    BOOST_CHECK_EQUAL(read.out.nValue, 2000);
+    BOOST_CHECK(!db.GetCoin(spent, read));
+
+    // A flush at a later block completes the transition
+    cache.SetBestBlock(block3, 3);
+    BOOST_CHECK(cache.Flush());
+    BOOST_CHECK(!db.HasPartialWrites());
+    BOOST_CHECK(db.GetBestBlock() == block3);
+    BOOST_CHECK(db.GetHeadBlocks().empty());
+}
+
 // Store of all necessary tx and undo data for next test
 typedef std::map<COutPoint, std::tuple<CTransaction,CTxUndo,Coin>> UtxoData;
 UtxoData utxoData;
@@ -16,6 +16,7 @@
 #include <boost/optional/optional_io.hpp>
 
 #include "coldreward/coldrewardtracker.h"
+#include <txdb.h>
 
 struct ColdRewardsSetup : public BasicTestingSetup {
     explicit ColdRewardsSetup()
@@ -1517,4 +1518,298 @@ BOOST_AUTO_TEST_CASE(extract_reward_multipliers_fuzz)
 }
 
 
+namespace {
+// The linear scan over all ranges, kept to check the lookup limited to the reward span window
+unsigned ExtractRewardMultiplierLinear(int currentBlockHeight, const std::vector<BlockHeightRange>& ar, int span)
+{
+    std::vector<unsigned> rewardMultipliers;
+    for (unsigned i = 0; i < ar.size(); i++) {
+        const unsigned idx = ar.size() - i - 1;
+        const int startDistance = currentBlockHeight - ar[idx].getStart();
+        const int endDistance = currentBlockHeight - ar[idx].getEnd();
+        if (ar[idx].getRewardMultiplier() > 0) {
+            if (startDistance == span) {
+                rewardMultipliers.push_back(ar[idx].getRewardMultiplier());
+            } else if (startDistance < span || endDistance < span) {
+                if (startDistance >= span) {
+                    rewardMultipliers.push_back(ar[idx].getRewardMultiplier());
+                } else {
+                    rewardMultipliers.push_back(std::min(ar[idx].getPrevRewardMultiplier(), ar[idx].getRewardMultiplier()));
+                }
+            } else if (rewardMultipliers.empty()) {
+                rewardMultipliers.push_back(ar[idx].getRewardMultiplier());
+                break;
+            }
+        } else {
+            if (startDistance <= span || endDistance <= span) {
+                rewardMultipliers.clear();
+            }
+            break;
+        }
+    }
+    return rewardMultipliers.empty() ? 0 : *std::min_element(rewardMultipliers.cbegin(), rewardMultipliers.cend());
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(extract_reward_multipliers_window)
+{
+    static constexpr int REWARD_SPAN = 100;
+    tracker.setMinRewardRangeSpan(REWARD_SPAN);
+
+    for (int i = 0; i < 2000; i++) {
+        // Long histories with short ranges and [h,h] markers sharing the end of the previous range
+        std::vector<BlockHeightRange> ranges;
+        int height = InsecureRandRange(50);
+        unsigned prevMultiplier = 0;
+        for (int n = InsecureRandRange(60); n > 0; n--) {
+            const int start = InsecureRandBool() && !ranges.empty() ? ranges.back().getEnd() : height + (int)InsecureRandRange(REWARD_SPAN / 2);
+            const int end = InsecureRandRange(4) == 0 ? start : start + (int)InsecureRandRange(REWARD_SPAN * 2);
+            const unsigned multiplier = InsecureRandRange(4);
+            ranges.emplace_back(start, end, multiplier, prevMultiplier);
+            prevMultiplier = multiplier;
+            height = end;
+        }
+
+        for (int h = 0; h <= height + REWARD_SPAN * 2; h += 1 + InsecureRandRange(REWARD_SPAN / 4)) {
+            BOOST_REQUIRE_EQUAL(tracker.ExtractRewardMultiplierFromRanges(h, ranges), ExtractRewardMultiplierLinear(h, ranges, REWARD_SPAN));
+        }
+        for (const BlockHeightRange& r : ranges) {
+            // exact window boundaries of both ends
+            for (int h : {r.getStart() + REWARD_SPAN, r.getEnd() + REWARD_SPAN, r.getEnd() + REWARD_SPAN + 1}) {
+                BOOST_REQUIRE_EQUAL(tracker.ExtractRewardMultiplierFromRanges(h, ranges), ExtractRewardMultiplierLinear(h, ranges, REWARD_SPAN));
+            }
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(write_back_changed_only)
+{
+    AddressType addr = VecUint8FromString("abc");
+    AddressType addr2 = VecUint8FromString("def");
+
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(1, addr, 20001 * COIN, checkpoints);
+    tracker.addAddressTransaction(1, addr2, 20001 * COIN, checkpoints);
+    tracker.endPersistedTransaction();
+
+    int numBalanceWrites = 0, numRangesWrites = 0, numEnds = 0, numAborts = 0;
+    tracker.setPersistedBalanceSetter([&](const AddressType& a, const CAmount& amount) { numBalanceWrites++; balances[a] = amount; });
+    tracker.setPersistedRangesSetter([&](const AddressType& a, const std::vector<BlockHeightRange>& r) { numRangesWrites++; ranges[a] = r; });
+    tracker.setPersisterTransactionEnder([&]() { numEnds++; });
+    tracker.setPersistedTransactionAborter([&]() { numAborts++; });
+
+    // The ranges of addr are read but unchanged when the balance goes negative
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(2, addr, -30000 * COIN, checkpoints);
+    tracker.endPersistedTransaction();
+    BOOST_CHECK_EQUAL(numBalanceWrites, 1);
+    BOOST_CHECK_EQUAL(numRangesWrites, 0);
+    BOOST_CHECK_EQUAL(numEnds, 1);
+    BOOST_CHECK_EQUAL(balances.at(addr), -9999 * COIN);
+
+    // A reverted transaction writes nothing
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(3, addr2, 1 * COIN, checkpoints);
+    tracker.revertPersistedTransaction();
+    BOOST_CHECK_EQUAL(numBalanceWrites, 1);
+    BOOST_CHECK_EQUAL(numRangesWrites, 0);
+    BOOST_CHECK_EQUAL(numEnds, 1);
+    BOOST_CHECK_EQUAL(numAborts, 1);
+    BOOST_CHECK_EQUAL(balances.at(addr2), 20001 * COIN);
+
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(3, addr2, 1 * COIN, checkpoints);
+    tracker.endPersistedTransaction();
+    BOOST_CHECK_EQUAL(numBalanceWrites, 2);
+    BOOST_CHECK_EQUAL(numRangesWrites, 1);
+    BOOST_CHECK_EQUAL(balances.at(addr2), 20002 * COIN);
+}
+
+BOOST_AUTO_TEST_CASE(eligible_addresses_incremental)
+{
+    // Short span so the multipliers change often
+    tracker.setMinRewardRangeSpan(10);
+
+    const auto expectedEligible = [this](int height) {
+        std::vector<std::pair<AddressType, unsigned>> result;
+        for (const auto& r : ranges) {
+            const unsigned multiplier = tracker.ExtractRewardMultiplierFromRanges(height, r.second);
+            if (multiplier > 0) {
+                result.push_back(std::make_pair(r.first, multiplier));
+            }
+        }
+        return result;
+    };
+
+    std::vector<std::vector<std::pair<AddressType, CAmount>>> blocks;
+    size_t numEligible = 0;
+    for (int height = 1; height < 300; height++) {
+        const bool disconnect = blocks.size() > 5 && InsecureRandRange(5) == 0;
+        tracker.startPersistedTransaction();
+        if (disconnect) {
+            height--;
+            for (const auto& change : blocks.back()) {
+                tracker.removeAddressTransaction(height, change.first, change.second);
+            }
+            blocks.pop_back();
+            height--;
+        } else {
+            blocks.emplace_back();
+            for (unsigned i = InsecureRandRange(4); i > 0; i--) {
+                const AddressType addr = VecUint8FromString("addr" + std::to_string(InsecureRandRange(8)));
+                const CAmount change = ((CAmount)InsecureRandRange(50000) - 20000) * COIN;
+                tracker.addAddressTransaction(height, addr, change, checkpoints);
+                blocks.back().emplace_back(addr, change);
+            }
+        }
+        tracker.endPersistedTransaction();
+
+        // Ask for the next block and some earlier ones
+        for (const int h : {height + 1, height + 1, height - 3, height + 1}) {
+            BOOST_REQUIRE(tracker.getEligibleAddresses(h) == expectedEligible(h));
+        }
+        numEligible += expectedEligible(height + 1).size();
+    }
+    BOOST_CHECK(numEligible > 0);
+
+    // Changing the span invalidates the cached multipliers
+    tracker.setMinRewardRangeSpan(25);
+    BOOST_CHECK(tracker.getEligibleAddresses(310) == expectedEligible(310));
+}
+
+BOOST_AUTO_TEST_CASE(keep_cache)
+{
+    tracker.setMinRewardRangeSpan(10);
+
+    // A tracker writing every transaction, to compare with
+    std::map<AddressType, CAmount> refBalances;
+    std::map<AddressType, std::vector<BlockHeightRange>> refRanges;
+    ColdRewardTracker reference(20000 * COIN, 10);
+    reference.setPersistedBalanceGetter([&](const AddressType& addr) { return refBalances.count(addr) ? refBalances.at(addr) : 0; });
+    reference.setPersistedBalanceSetter([&](const AddressType& addr, const CAmount& amount) { refBalances[addr] = amount; });
+    reference.setPersistedRangesGetter([&](const AddressType& addr) { return refRanges.count(addr) ? refRanges.at(addr) : std::vector<BlockHeightRange>(); });
+    reference.setPersistedRangesSetter([&](const AddressType& addr, const std::vector<BlockHeightRange>& r) { refRanges[addr] = r; });
+    reference.setPersistedCheckpointGetter([]() { return 0; });
+    reference.setPersistedCheckpointSetter([](int) {});
+    reference.setPersistedTransactionStarter([]() {});
+    reference.setPersisterTransactionEnder([]() {});
+    reference.setAllRangesGetter([&]() { return refRanges; });
+
+    tracker.setKeepCache(true);
+    for (int height = 1; height < 200; height++) {
+        const bool revert = InsecureRandRange(6) == 0;
+        tracker.startPersistedTransaction();
+        reference.startPersistedTransaction();
+        for (unsigned i = InsecureRandRange(4); i > 0; i--) {
+            const AddressType addr = VecUint8FromString("addr" + std::to_string(InsecureRandRange(8)));
+            const CAmount change = ((CAmount)InsecureRandRange(50000) - 20000) * COIN;
+            tracker.addAddressTransaction(height, addr, change, checkpoints);
+            reference.addAddressTransaction(height, addr, change, checkpoints);
+        }
+        if (revert) {
+            tracker.revertPersistedTransaction();
+            reference.revertPersistedTransaction();
+            height--;
+            continue;
+        }
+        tracker.endPersistedTransaction();
+        reference.endPersistedTransaction();
+        BOOST_REQUIRE(tracker.getEligibleAddresses(height + 1) == reference.getEligibleAddresses(height + 1));
+
+        // Nothing is written until the cache is flushed
+        BOOST_REQUIRE(balances.empty() && ranges.empty());
+        BOOST_REQUIRE(tracker.cacheSize() > 0 || refBalances.empty());
+    }
+
+    tracker.setKeepCache(false);
+    BOOST_CHECK_EQUAL(tracker.cacheSize(), 0U);
+    BOOST_CHECK(balances == refBalances);
+    BOOST_REQUIRE_EQUAL(ranges.size(), refRanges.size());
+    for (const auto& r : refRanges) {
+        const std::vector<BlockHeightRange>& ar = ranges.at(r.first);
+        BOOST_REQUIRE_EQUAL(ar.size(), r.second.size());
+        for (size_t i = 0; i < ar.size(); i++) {
+            BOOST_CHECK_EQUAL(ar[i].getStart(), r.second[i].getStart());
+            BOOST_CHECK_EQUAL(ar[i].getEnd(), r.second[i].getEnd());
+            BOOST_CHECK_EQUAL(ar[i].getRewardMultiplier(), r.second[i].getRewardMultiplier());
+            BOOST_CHECK_EQUAL(ar[i].getPrevRewardMultiplier(), r.second[i].getPrevRewardMultiplier());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(eligible_snapshot)
+{
+    tracker.setMinRewardRangeSpan(10);
+
+    const AddressType addr1 = VecUint8FromString("addr1");
+    const AddressType addr2 = VecUint8FromString("addr2");
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(1, addr2, 45000 * COIN, checkpoints);
+    tracker.addAddressTransaction(1, addr1, 25000 * COIN, checkpoints);
+    tracker.endPersistedTransaction();
+
+    const auto snapshot = tracker.getEligibleSnapshot(20);
+    BOOST_REQUIRE_EQUAL(snapshot->size(), 2U);
+    BOOST_CHECK(snapshot->at(0).address == addr1);
+    BOOST_CHECK_EQUAL(snapshot->at(0).multiplier, 1U);
+    BOOST_CHECK_EQUAL(snapshot->at(0).balance, 25000 * COIN);
+    BOOST_CHECK(snapshot->at(1).address == addr2);
+    BOOST_CHECK_EQUAL(snapshot->at(1).multiplier, 2U);
+    BOOST_CHECK_EQUAL(snapshot->at(1).balance, 45000 * COIN);
+
+    // Shared until the tracked data changes or another height is asked for
+    BOOST_CHECK(tracker.getEligibleSnapshot(20) == snapshot);
+    BOOST_CHECK(tracker.getEligibleSnapshot(21) != snapshot);
+
+    tracker.startPersistedTransaction();
+    tracker.addAddressTransaction(21, addr1, -10000 * COIN, checkpoints);
+    tracker.endPersistedTransaction();
+    const auto changed = tracker.getEligibleSnapshot(40);
+    BOOST_REQUIRE_EQUAL(changed->size(), 1U);
+    BOOST_CHECK(changed->at(0).address == addr2);
+    BOOST_CHECK_EQUAL(snapshot->size(), 2U);
+}
+
+BOOST_AUTO_TEST_CASE(erase_tracker_data)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+
+    CDBBatch batch(db);
+    ColdRewardUndo undo;
+    for (int i = 1; i <= 100; i++) {
+        const AddressType addr = VecUint8FromString("addr" + std::to_string(i));
+        batch.Write(std::make_pair(DB_GVR_BALANCE, addr), (CAmount)i * COIN);
+        batch.Write(std::make_pair(DB_GVR_RANGE, addr), std::vector<BlockHeightRange>{BlockHeightRange(i, i, 1, 0)});
+        undo.outputs[i].emplace_back(addr, (CAmount)i * COIN);
+        undo.inputs[i].emplace_back(addr, (CAmount)i * COIN);
+    }
+    batch.Write(std::make_pair(DB_GVR_CHECKPOINT, 0), 50);
+    db.WriteRewardTrackerUndo(batch, undo);
+    db.WriteLastTrackedHeight(batch, 100);
+    BOOST_CHECK(db.WriteBatch(batch));
+    BOOST_CHECK(db.WriteFlag("txindex", true));
+
+    BOOST_CHECK(db.EraseRewardTrackerData());
+
+    CAmount balance;
+    std::vector<BlockHeightRange> vranges;
+    std::int64_t height;
+    for (int i = 1; i <= 100; i++) {
+        const AddressType addr = VecUint8FromString("addr" + std::to_string(i));
+        BOOST_CHECK(!db.Read(std::make_pair(DB_GVR_BALANCE, addr), balance));
+        BOOST_CHECK(!db.Read(std::make_pair(DB_GVR_RANGE, addr), vranges));
+    }
+    undo = ColdRewardUndo();
+    BOOST_CHECK(db.ReadRewardTrackerUndo(undo, 1));
+    BOOST_CHECK(undo.inputs.empty() && undo.outputs.empty());
+    BOOST_CHECK(!db.ReadLastTrackedHeight(height));
+
+    // The checkpoint and other data are kept
+    int checkpoint = 0;
+    bool flag = false;
+    BOOST_CHECK(db.Read(std::make_pair(DB_GVR_CHECKPOINT, 0), checkpoint) && checkpoint == 50);
+    BOOST_CHECK(db.ReadFlag("txindex", flag) && flag);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
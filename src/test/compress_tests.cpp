@@ -2,9 +2,14 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <clientversion.h>
+#include <coins.h>
 #include <compressor.h>
+#include <streams.h>
 #include <script/standard.h>
 #include <test/util/setup_common.h>
+#include <txdb.h>
+#include <util/strencodings.h>
 
 #include <stdint.h>
 
@@ -134,4 +139,108 @@ BOOST_AUTO_TEST_CASE(compress_script_to_uncompressed_pubkey_id)
     BOOST_CHECK_EQUAL(out[0], 0x04 | (script[65] & 0x01)); // least significant bit (lsb) of last char of pubkey is mapped into out[0]
 }
 
+BOOST_AUTO_TEST_CASE(compress_particl_scripts)
+{
+    const uint160 stake_hash = uint160(ParseHex("0102030405060708090a0b0c0d0e0f1011121314"));
+    const uint160 spend_hash = uint160(ParseHex("1112131415161718191a1b1c1d1e1f2021222324"));
+    const uint256 spend_hash256 = uint256S("2122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f40");
+    const CScript stake = CScript() << OP_DUP << OP_HASH160 << ToByteVector(stake_hash) << OP_EQUALVERIFY << OP_CHECKSIG;
+
+    std::vector<std::pair<CScript, size_t>> cases;
+    cases.emplace_back(CScript() << OP_DUP << OP_SHA256 << ToByteVector(spend_hash256) << OP_EQUALVERIFY << OP_CHECKSIG, 33);
+    cases.emplace_back(CScript() << OP_SHA256 << ToByteVector(spend_hash256) << OP_EQUAL, 33);
+    for (const CScript& spend : {
+            CScript() << OP_DUP << OP_HASH160 << ToByteVector(spend_hash) << OP_EQUALVERIFY << OP_CHECKSIG,
+            CScript() << OP_HASH160 << ToByteVector(spend_hash) << OP_EQUAL,
+            CScript() << OP_DUP << OP_SHA256 << ToByteVector(spend_hash256) << OP_EQUALVERIFY << OP_CHECKSIG,
+            CScript() << OP_SHA256 << ToByteVector(spend_hash256) << OP_EQUAL}) {
+        CScript script = CScript() << OP_ISCOINSTAKE << OP_IF;
+        script.insert(script.end(), stake.begin(), stake.end());
+        script << OP_ELSE;
+        script.insert(script.end(), spend.begin(), spend.end());
+        script << OP_ENDIF;
+        cases.emplace_back(script, spend.size() == 25 || spend.size() == 23 ? 41 : 53);
+    }
+
+    for (const auto& c : cases) {
+        std::vector<unsigned char> out;
+        BOOST_REQUIRE(CompressParticlScript(c.first, out));
+        BOOST_CHECK_EQUAL(out.size(), c.second);
+        CScript script;
+        BOOST_CHECK(DecompressParticlScript(script, out[0], std::vector<unsigned char>(out.begin() + 1, out.end())));
+        BOOST_CHECK(script == c.first);
+    }
+
+    // Scripts handled by CompressScript or not at all
+    std::vector<unsigned char> out;
+    BOOST_CHECK(!CompressParticlScript(stake, out));
+    BOOST_CHECK(!CompressParticlScript(CScript() << OP_RETURN, out));
+    BOOST_CHECK(!CompressParticlScript(CScript() << OP_ISCOINSTAKE << OP_IF << OP_ELSE << OP_ENDIF, out));
+}
+
+BOOST_FIXTURE_TEST_CASE(compress_particl_coins, ParticlBasicTestingSetup)
+{
+    Coin coin;
+    coin.nHeight = 1000;
+    coin.out.nValue = 0;
+    coin.out.scriptPubKey = CScript() << OP_DUP << OP_SHA256 << ToByteVector(InsecureRand256()) << OP_EQUALVERIFY << OP_CHECKSIG;
+    coin.nType = OUTPUT_CT;
+    coin.commitment.data[0] = 0x09;
+    memcpy(&coin.commitment.data[1], InsecureRand256().begin(), 32);
+
+    // Entries written in the uncompressed layout still read back
+    CDataStream old_layout(SER_DISK, CLIENT_VERSION);
+    old_layout << VARINT(uint32_t{2000}) << Using<TxOutCompression>(coin.out) << coin.nType;
+    old_layout.write((char*)&coin.commitment.data[0], 33);
+    const size_t old_size = old_layout.size();
+
+    Coin read;
+    old_layout >> read;
+    BOOST_CHECK(read.out == coin.out);
+    BOOST_CHECK_EQUAL(read.nType, OUTPUT_CT);
+    BOOST_CHECK_EQUAL(memcmp(read.commitment.data, coin.commitment.data, 33), 0);
+
+    // Chainstates written by older versions keep being written in their layout
+    const bool compact_coins = fCompactCoins;
+    fCompactCoins = false;
+    CDataStream ss_legacy(SER_DISK, CLIENT_VERSION);
+    ss_legacy << coin;
+    BOOST_CHECK_EQUAL(ss_legacy.size(), old_size);
+
+    fCompactCoins = true;
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << coin;
+    fCompactCoins = compact_coins;
+    BOOST_CHECK_EQUAL(ss.size() + 5, old_size);
+    ss >> read;
+    BOOST_CHECK(ss.empty());
+    BOOST_CHECK(read.out == coin.out);
+    BOOST_CHECK_EQUAL(read.nHeight, 1000U);
+    BOOST_CHECK_EQUAL(read.nType, OUTPUT_CT);
+    BOOST_CHECK_EQUAL(memcmp(read.commitment.data, coin.commitment.data, 33), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(compress_coins_format, BasicTestingSetup)
+{
+    const bool compact_coins = fCompactCoins;
+    CBlockTreeDB db(1 << 20, true, true);
+
+    // A database without the format record was written in the legacy layout
+    BOOST_CHECK(db.LoadCoinsFormat(false));
+    BOOST_CHECK(!fCompactCoins);
+
+    // Rebuilding the chainstate moves to the compact layout, which is kept after
+    BOOST_CHECK(db.LoadCoinsFormat(true));
+    BOOST_CHECK(fCompactCoins);
+    BOOST_CHECK(db.LoadCoinsFormat(false));
+    BOOST_CHECK(fCompactCoins);
+
+    // Layouts of newer versions are refused, even when rebuilding the chainstate
+    BOOST_CHECK(db.Write(std::make_pair('F', std::string("coinsformat")), COINS_FORMAT_CURRENT + 1));
+    BOOST_CHECK(!db.LoadCoinsFormat(false));
+    BOOST_CHECK(!db.LoadCoinsFormat(true));
+
+    fCompactCoins = compact_coins;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -14,6 +14,7 @@
 #include <crypto/sha256.h>
 #include <crypto/sha3.h>
 #include <crypto/sha512.h>
+#include <hash.h>
 #include <random.h>
 #include <test/util/setup_common.h>
 #include <util/strencodings.h>
@@ -453,6 +454,30 @@ BOOST_AUTO_TEST_CASE(aes_cbc_testvectors) {
     TestAES256CBC("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4", \
                   "39F23369A9D9BACFA530E26304231461", true, "f69f2445df4f9b17ad2b417be66c3710", \
                   "b2eb05e2c39be9fcda6c19078c6a9d1b3f461796d6b0d6b2e0c2a72b4d80e644");
+
+    // All four blocks as one message
+    TestAES256CBC("603deb1015ca71be2b73aef0857d77811f352c073b6108d72d9810a30914dff4", \
+                  "000102030405060708090A0B0C0D0E0F", false, "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51" \
+                  "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710", \
+                  "f58c4c04d6e5f1ba779eabfb5f7bfbd69cfc4e967edb808d679f777bc6702c7d39f23369a9d9bacfa530e26304231461" \
+                  "b2eb05e2c39be9fcda6c19078c6a9d1b");
+}
+
+BOOST_AUTO_TEST_CASE(aes_cbc_multiblock)
+{
+    // Messages longer than one decryption chunk round trip, also when decrypted in place
+    std::vector<unsigned char> key(AES256_KEYSIZE), iv(AES_BLOCKSIZE);
+    for (auto &c : key) c = InsecureRandBits(8);
+    for (auto &c : iv) c = InsecureRandBits(8);
+    for (size_t size : {1, 63, 64, 65, 127, 128, 129, 300, 1000}) {
+        std::vector<unsigned char> in(size), cipher(size + AES_BLOCKSIZE), out(size + AES_BLOCKSIZE);
+        for (auto &c : in) c = InsecureRandBits(8);
+        cipher.resize(AES256CBCEncrypt(key.data(), iv.data(), true).Encrypt(in.data(), in.size(), cipher.data()));
+        BOOST_CHECK_EQUAL(AES256CBCDecrypt(key.data(), iv.data(), true).Decrypt(cipher.data(), cipher.size(), out.data()), (int)size);
+        BOOST_CHECK(std::equal(in.begin(), in.end(), out.begin()));
+        BOOST_CHECK_EQUAL(AES256CBCDecrypt(key.data(), iv.data(), true).Decrypt(cipher.data(), cipher.size(), cipher.data()), (int)size);
+        BOOST_CHECK(std::equal(in.begin(), in.end(), cipher.begin()));
+    }
 }
 
 
@@ -751,6 +776,24 @@ BOOST_AUTO_TEST_CASE(sha256d64)
     }
 }
 
+BOOST_AUTO_TEST_CASE(hash160_batch)
+{
+    // Short messages take the padded block path, 56 bytes and over fall back to the hasher
+    for (size_t len : {0, 20, 33, 55, 56, 65}) {
+        for (size_t n : {0, 1, 7, 8, 9, 17, 70}) {
+            std::vector<unsigned char> in(len * n), out1(20 * n), out2(20 * n);
+            for (auto &c : in) {
+                c = InsecureRandBits(8);
+            }
+            for (size_t j = 0; j < n; ++j) {
+                CHash160().Write({in.data() + len * j, len}).Finalize({out1.data() + 20 * j, 20});
+            }
+            Hash160Batch(out2.data(), in.data(), len, n);
+            BOOST_CHECK(out1 == out2);
+        }
+    }
+}
+
 static void TestSHA3_256(const std::string& input, const std::string& output)
 {
     const auto in_bytes = ParseHex(input);
@@ -14,7 +14,11 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <anon.h>
 #include <blind.h>
+#include <primitives/transaction.h>
+#include <proofcache.h>
+#include <util/taskpool.h>
 
 BOOST_FIXTURE_TEST_SUITE(ct_tests, BasicTestingSetup)
 
@@ -313,4 +317,218 @@ BOOST_AUTO_TEST_CASE(ct_commitment_test)
     secp256k1_context_destroy(ctx);
 }
 
+BOOST_AUTO_TEST_CASE(ct_rangeproof_batch)
+{
+    ECC_Start_Blinding();
+
+    const size_t num_proofs = RANGEPROOF_BATCH_SIZE + 4;
+    std::vector<secp256k1_pedersen_commitment> commitments(num_proofs);
+    std::vector<std::vector<uint8_t> > proofs(num_proofs);
+    for (size_t k = 0; k < num_proofs; ++k) {
+        uint64_t value = (k + 1) * COIN;
+        uint256 blind = InsecureRand256(), nonce = InsecureRand256();
+        BOOST_REQUIRE(secp256k1_pedersen_commit(secp256k1_ctx_blind, &commitments[k], blind.begin(), value, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+        const uint8_t *bp[1] = {blind.begin()};
+        size_t proof_len = 5134;
+        proofs[k].resize(proof_len);
+        BOOST_REQUIRE(secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+            proofs[k].data(), &proof_len, &value, nullptr, bp, 1, &secp256k1_generator_const_h, 64, nonce.begin(), nullptr, 0));
+        proofs[k].resize(proof_len);
+    }
+
+    // Equal length proofs share a check up to the batch size
+    std::vector<CRangeProofCheck> checks;
+    for (size_t k = 0; k < num_proofs; ++k) {
+        AddRangeProofCheck(checks, true, false, &commitments[k], &proofs[k], "bad-ctout-rangeproof-verify");
+    }
+    BOOST_REQUIRE_EQUAL(checks.size(), 2U);
+    BOOST_CHECK_EQUAL(checks[0].size(), RANGEPROOF_BATCH_SIZE);
+
+    // A full batch must fit in the thread scratch space, else every batch falls back to single proofs
+    std::vector<const unsigned char*> proof_ptrs;
+    std::vector<const secp256k1_pedersen_commitment*> commitment_ptrs;
+    std::vector<secp256k1_generator> value_gens(RANGEPROOF_BATCH_SIZE, secp256k1_generator_const_h);
+    for (size_t k = 0; k < RANGEPROOF_BATCH_SIZE; ++k) {
+        proof_ptrs.push_back(proofs[k].data());
+        commitment_ptrs.push_back(&commitments[k]);
+    }
+    BOOST_CHECK(secp256k1_bulletproof_rangeproof_verify_multi(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+        proof_ptrs.data(), RANGEPROOF_BATCH_SIZE, proofs[0].size(), nullptr, commitment_ptrs.data(), 1, 64, value_gens.data(), nullptr, nullptr));
+    for (auto &check : checks) {
+        BOOST_CHECK(check());
+        BOOST_CHECK(check.GetError().empty());
+    }
+
+    // A bad proof fails the batch and is found by the fallback
+    proofs[3][proofs[3].size() / 2] ^= 1;
+    CRangeProofCheck check(true);
+    for (size_t k = 0; k < 8; ++k) {
+        check.Add(&commitments[k], &proofs[k], k == 3 ? "bad-rctout-rangeproof-verify" : "bad-ctout-rangeproof-verify");
+    }
+    BOOST_CHECK(!check());
+    BOOST_CHECK_EQUAL(check.GetError(), "bad-rctout-rangeproof-verify");
+
+    ECC_Stop_Blinding();
+}
+
+BOOST_AUTO_TEST_CASE(ct_mlsag_check_copy)
+{
+    ECC_Start_Blinding();
+
+    uint256 blind = InsecureRand256();
+    secp256k1_pedersen_commitment commitment_out;
+    BOOST_REQUIRE(secp256k1_pedersen_commit(secp256k1_ctx_blind, &commitment_out, blind.begin(), 10 * COIN, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+    // The input commitment lives in the check's own buffer, copies must point at their own
+    std::vector<CMLSAGCheck> checks;
+    {
+        std::vector<uint8_t> commitments(commitment_out.data, commitment_out.data + 33);
+        std::vector<const uint8_t*> in_commits{commitments.data()};
+        std::vector<const uint8_t*> out_commits{commitment_out.data};
+        CMLSAGCheck check(std::move(commitments), in_commits, out_commits);
+        checks.push_back(check);
+        CMLSAGCheck assigned;
+        assigned = check;
+        checks.push_back(assigned);
+    }
+    std::vector<CMLSAGCheck> copies(checks);
+    checks.clear();
+    for (auto &check : copies) {
+        BOOST_CHECK(check());
+        BOOST_CHECK(check.GetError().empty());
+    }
+
+    ECC_Stop_Blinding();
+}
+
+BOOST_AUTO_TEST_CASE(ct_rangeproof_cache)
+{
+    ECC_Start_Blinding();
+
+    std::vector<secp256k1_pedersen_commitment> commitments(2);
+    std::vector<std::vector<uint8_t> > proofs(2);
+    for (size_t k = 0; k < 2; ++k) {
+        uint64_t value = (k + 1) * COIN;
+        uint256 blind = InsecureRand256(), nonce = InsecureRand256();
+        BOOST_REQUIRE(secp256k1_pedersen_commit(secp256k1_ctx_blind, &commitments[k], blind.begin(), value, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+        const uint8_t *bp[1] = {blind.begin()};
+        size_t proof_len = 5134;
+        proofs[k].resize(proof_len);
+        BOOST_REQUIRE(secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+            proofs[k].data(), &proof_len, &value, nullptr, bp, 1, &secp256k1_generator_const_h, 64, nonce.begin(), nullptr, 0));
+        proofs[k].resize(proof_len);
+    }
+
+    const uint256 entry = RangeProofCacheEntry(true, commitments[0].data, proofs[0]);
+    BOOST_CHECK(entry != RangeProofCacheEntry(false, commitments[0].data, proofs[0]));
+    BOOST_CHECK(entry != RangeProofCacheEntry(true, commitments[1].data, proofs[0]));
+    BOOST_CHECK(!ProofCacheContains(entry, false));
+
+    // Mempool checks store the proofs they verify, block checks don't join their batches
+    std::vector<CRangeProofCheck> checks;
+    AddRangeProofCheck(checks, true, true, &commitments[0], &proofs[0], "bad-ctout-rangeproof-verify");
+    AddRangeProofCheck(checks, true, false, &commitments[1], &proofs[1], "bad-ctout-rangeproof-verify");
+    BOOST_REQUIRE_EQUAL(checks.size(), 2U);
+    BOOST_CHECK(checks[0]());
+    BOOST_CHECK(ProofCacheContains(entry, false));
+    BOOST_CHECK(checks[1]());
+    BOOST_CHECK(!ProofCacheContains(RangeProofCacheEntry(true, commitments[1].data, proofs[1]), false));
+
+    // A block check skips the cached proof and verifies the rest
+    CRangeProofCheck check(true);
+    check.Add(&commitments[0], &proofs[0], "bad-ctout-rangeproof-verify");
+    check.Add(&commitments[1], &proofs[1], "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(check());
+    BOOST_CHECK_EQUAL(check.size(), 1U);
+
+    // A mempool check failing records the proof, the next mempool check takes the failure
+    std::vector<uint8_t> bad_proof = proofs[1];
+    bad_proof[bad_proof.size() / 2] ^= 1;
+    const uint256 bad_entry = RangeProofCacheEntry(true, commitments[1].data, bad_proof);
+    std::string error;
+    CRangeProofCheck check_failing(true, true);
+    check_failing.Add(&commitments[1], &bad_proof, "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(!check_failing());
+    BOOST_CHECK_EQUAL(check_failing.GetError(), "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(ProofCacheTakeFailed(bad_entry, error));
+    BOOST_CHECK_EQUAL(error, "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(!ProofCacheTakeFailed(bad_entry, error));
+    ProofCacheAddFailed(bad_entry, "bad-ctout-rangeproof-verify");
+    CRangeProofCheck check_failed(true, true);
+    check_failed.Add(&commitments[1], &bad_proof, "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(!check_failed());
+    BOOST_CHECK_EQUAL(check_failed.GetError(), "bad-ctout-rangeproof-verify");
+    BOOST_CHECK(!ProofCacheTakeFailed(bad_entry, error));
+
+    ECC_Stop_Blinding();
+}
+
+BOOST_AUTO_TEST_CASE(ct_proof_cache_tx_entries)
+{
+    const uint256 wtxid = InsecureRand256();
+    const uint256 entry = TxProofCacheEntry(wtxid, 1);
+    BOOST_CHECK(entry != TxProofCacheEntry(wtxid, 0));
+
+    uint64_t hits, misses, hits_after, misses_after;
+    GetProofCacheStats(hits, misses);
+
+    // Only block lookups are counted
+    BOOST_CHECK(!ProofCacheContains(entry, false));
+    ProofCacheAdd(entry);
+    BOOST_CHECK(ProofCacheContains(entry, true));
+    BOOST_CHECK(!ProofCacheContains(TxProofCacheEntry(wtxid, 0), true));
+
+    GetProofCacheStats(hits_after, misses_after);
+    BOOST_CHECK_EQUAL(hits_after - hits, 1U);
+    BOOST_CHECK_EQUAL(misses_after - misses, 1U);
+}
+
+BOOST_AUTO_TEST_CASE(ct_rewind_batch)
+{
+    ECC_Start_Blinding();
+
+    const size_t num_outputs = 16;
+    std::vector<CTxOutCT> txouts(num_outputs);
+    std::vector<uint256> blinds(num_outputs);
+    std::vector<RangeProofRewind> rewinds;
+    for (size_t k = 0; k < num_outputs; ++k) {
+        uint64_t value = (k + 1) * COIN;
+        uint256 nonce = InsecureRand256();
+        blinds[k] = InsecureRand256();
+        BOOST_REQUIRE(secp256k1_pedersen_commit(secp256k1_ctx_blind, &txouts[k].commitment, blinds[k].begin(), value, &secp256k1_generator_const_h, &secp256k1_generator_const_g));
+
+        const uint8_t *bp[1] = {blinds[k].begin()};
+        size_t proof_len = 5134;
+        txouts[k].vRangeproof.resize(proof_len);
+        BOOST_REQUIRE(secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
+            txouts[k].vRangeproof.data(), &proof_len, &value, nullptr, bp, 1, &secp256k1_generator_const_h, 64, nonce.begin(), nullptr, 0));
+        txouts[k].vRangeproof.resize(proof_len);
+
+        // Every fourth output is not ours
+        rewinds.emplace_back(&txouts[k], k, k % 4 == 3 ? InsecureRand256() : nonce);
+    }
+
+    g_task_pool.Start(4);
+    BOOST_CHECK_EQUAL(RewindRangeProofs(rewinds), num_outputs - num_outputs / 4);
+    g_task_pool.Stop();
+
+    for (const auto &r : rewinds) {
+        BOOST_CHECK_EQUAL(r.rewound, r.n % 4 != 3);
+        if (!r.rewound) {
+            continue;
+        }
+        BOOST_CHECK_EQUAL(r.value, (CAmount)((r.n + 1) * COIN));
+        BOOST_CHECK(memcmp(r.blind, blinds[r.n].begin(), 32) == 0);
+
+        std::vector<uint8_t> blind_out;
+        CAmount value_out;
+        BOOST_CHECK(RewindRangeProof(txouts[r.n].vRangeproof, std::vector<uint8_t>(txouts[r.n].commitment.data, txouts[r.n].commitment.data + 33), r.nonce, blind_out, value_out));
+        BOOST_CHECK_EQUAL(value_out, r.value);
+    }
+
+    ECC_Stop_Blinding();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
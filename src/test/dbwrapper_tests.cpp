@@ -242,6 +242,75 @@ BOOST_AUTO_TEST_CASE(dbwrapper_iterator)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dbwrapper_read_many)
+{
+    // Perform tests both obfuscated and non-obfuscated.
+    for (const bool obfuscate : {false, true}) {
+        fs::path ph = GetDataDir() / (obfuscate ? "dbwrapper_read_many_obfuscate_true" : "dbwrapper_read_many_obfuscate_false");
+        CDBWrapper dbw(ph, (1 << 20), true, false, obfuscate);
+
+        // Little endian keys, the db order differs from the numeric order
+        std::vector<uint256> in(300);
+        for (uint32_t i = 0; i < in.size(); ++i) {
+            in[i] = InsecureRand256();
+            BOOST_CHECK(dbw.Write(std::make_pair('m', i * 2), in[i]));
+        }
+
+        std::vector<std::pair<char, uint32_t>> keys;
+        for (uint32_t i : {598, 3, 0, 256, 1, 598, 40, 1000}) {
+            keys.emplace_back('m', i);
+        }
+        std::vector<uint256> values;
+        std::vector<bool> found;
+        BOOST_CHECK_EQUAL(dbw.ReadMany(keys, values, found), 5U);
+        BOOST_REQUIRE_EQUAL(values.size(), keys.size());
+        BOOST_REQUIRE_EQUAL(found.size(), keys.size());
+        for (size_t k = 0; k < keys.size(); ++k) {
+            uint32_t i = keys[k].second;
+            BOOST_CHECK_EQUAL(found[k], i % 2 == 0 && i / 2 < in.size());
+            if (found[k]) {
+                BOOST_CHECK_EQUAL(values[k].ToString(), in[i / 2].ToString());
+            }
+        }
+
+        keys.clear();
+        BOOST_CHECK_EQUAL(dbw.ReadMany(keys, values, found), 0U);
+        BOOST_CHECK(values.empty() && found.empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dbwrapper_prefix_stats)
+{
+    fs::path ph = GetDataDir() / "dbwrapper_prefix_stats";
+    CDBWrapper dbw(ph, (1 << 20), false, true, false);
+
+    CDBBatch batch(dbw);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        batch.Write(std::make_pair('a', i), InsecureRand256());
+    }
+    batch.Write(std::make_pair('b', (uint32_t)0), InsecureRand256());
+    batch.Erase(std::make_pair('b', (uint32_t)1));
+    BOOST_CHECK(dbw.WriteBatch(batch));
+
+    uint256 res;
+    BOOST_CHECK(dbw.Read(std::make_pair('a', (uint32_t)0), res));
+    BOOST_CHECK(!dbw.Read(std::make_pair('b', (uint32_t)1), res));
+    BOOST_CHECK(dbw.Exists(std::make_pair('b', (uint32_t)0)));
+
+    auto stats = dbw.GetPrefixStats();
+    BOOST_CHECK_EQUAL(stats['a'].writes, 1000U);
+    BOOST_CHECK_EQUAL(stats['a'].reads, 1U);
+    BOOST_CHECK_EQUAL(stats['b'].writes, 2U);
+    BOOST_CHECK_EQUAL(stats['b'].reads, 2U);
+    BOOST_CHECK(stats.count('c') == 0);
+
+    // Compacting moves the prefix out of the memtable, its size can be estimated
+    dbw.CompactPrefix('a');
+    stats = dbw.GetPrefixStats();
+    BOOST_CHECK(stats['a'].approximate_size > 0);
+    BOOST_CHECK(dbw.Read(std::make_pair('a', (uint32_t)999), res));
+}
+
 // Test that we do not obfuscation if there is existing data.
 BOOST_AUTO_TEST_CASE(existing_data_no_obfuscate)
 {
@@ -558,6 +558,75 @@ BOOST_AUTO_TEST_CASE(extkey_account)
     BOOST_CHECK(pak->nKey == 3);
 }
 
+BOOST_AUTO_TEST_CASE(extkey_derive_cache)
+{
+    CExtKey58 eKey58;
+    BOOST_CHECK(0 == eKey58.Set58("XGHSTPgtqERy21V7QzFk4zmx5aUdcDZzfY7D99B8X4kuQZdHq1pJzDg9KtMCoPixi1z6wzdyzGBnX84BgPU4RXXjP2nj4itNagLZ5FULLqCamzng"));
+    CStoredExtKey sek;
+    sek.kp = eKey58.GetKey().Neutered();
+
+    // Keys derived across threads match keys derived inline, including past the prepared range
+    const uint32_t nStart = 10, nKeys = MIN_THREADED_LOOKAHEAD;
+    CExtKeyDeriveCache derived(&sek, nStart, nKeys, 4);
+    for (uint32_t k = 0; k < nKeys + 8; ++k) {
+        CPubKey pk, pk_cached;
+        uint32_t nChildOut = 0, nChildOutCached = 0;
+        BOOST_CHECK(0 == sek.DeriveKey(pk, nStart + k, nChildOut, false));
+        BOOST_CHECK(0 == derived.DeriveKey(pk_cached, nStart + k, nChildOutCached));
+        BOOST_CHECK(pk == pk_cached);
+        BOOST_CHECK(nChildOut == nChildOutCached);
+        CKeyID id_cached;
+        BOOST_CHECK(0 == derived.DeriveKey(pk_cached, id_cached, nStart + k, nChildOutCached));
+        BOOST_CHECK(id_cached == pk.GetID());
+    }
+
+    // Packed ranges match single derivations, hardened children are not derived
+    CPubKeyBatchDeriver deriver(sek.kp.pubkey, sek.kp.chaincode);
+    BOOST_REQUIRE(deriver.IsValid());
+    std::vector<uint8_t> packed(4 * CPubKey::COMPRESSED_SIZE);
+    BOOST_CHECK(deriver.DeriveRange(nStart, nStart + 4, packed.data()) == 4);
+    for (uint32_t k = 0; k < 4; ++k) {
+        CPubKey pk_batch;
+        CExtPubKey ek_child;
+        BOOST_CHECK(sek.kp.GetExtPubKey().Derive(ek_child, nStart + k));
+        BOOST_CHECK(deriver.Derive(pk_batch, nStart + k));
+        BOOST_CHECK(pk_batch == ek_child.pubkey);
+        BOOST_CHECK(memcmp(&packed[k * CPubKey::COMPRESSED_SIZE], ek_child.pubkey.begin(), CPubKey::COMPRESSED_SIZE) == 0);
+    }
+    CPubKey pk_hardened;
+    BOOST_CHECK(!deriver.Derive(pk_hardened, nStart | (uint32_t)1 << 31));
+}
+
+BOOST_AUTO_TEST_CASE(extkey_key_filter)
+{
+    CExtKeyAccount sea;
+    std::vector<CKeyID> ids;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        uint256 h = InsecureRand256();
+        ids.emplace_back(uint160(h.begin(), 20));
+    }
+    for (uint32_t i = 0; i < 1000; ++i) {
+        sea.mapLookAhead[ids[i]] = CEKAKey(0, i);
+    }
+
+    // The filter is built on first use, later keys are added to it
+    BOOST_CHECK(sea.MayHaveKey(ids[0]));
+    BOOST_CHECK(!sea.m_key_filter.IsFull());
+    for (uint32_t i = 1000; i < 2000; ++i) {
+        sea.mapKeys[ids[i]] = CEKAKey(0, i);
+        sea.AddToKeyFilter(ids[i]);
+    }
+
+    // No false negatives, few false positives
+    size_t nFalsePositives = 0;
+    for (const auto &id : ids) {
+        BOOST_CHECK(sea.MayHaveKey(id));
+        uint256 h = InsecureRand256();
+        nFalsePositives += sea.MayHaveKey(CKeyID(uint160(h.begin(), 20))) ? 1 : 0;
+    }
+    BOOST_CHECK(nFalsePositives < 40);
+}
+
 BOOST_AUTO_TEST_CASE(extkey_misc_keys)
 {
     uint32_t nTest = 1;
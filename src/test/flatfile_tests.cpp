@@ -123,4 +123,48 @@ BOOST_AUTO_TEST_CASE(flatfile_flush)
     BOOST_CHECK_EQUAL(fs::file_size(seq.FileName(FlatFilePos(0, 1))), 1U);
 }
 
+#ifndef WIN32
+BOOST_AUTO_TEST_CASE(flatfile_map)
+{
+    const auto data_dir = GetDataDir();
+    FlatFileSeq seq(data_dir, "m", 16 * 1024);
+    FlatFileMapCache cache(2);
+
+    std::string line1("first"), line2("second");
+    size_t pos2 = GetSerializeSize(line1, CLIENT_VERSION);
+    {
+        CAutoFile file(seq.Open(FlatFilePos(0, 0)), SER_DISK, CLIENT_VERSION);
+        file << line1;
+    }
+    BOOST_CHECK(!cache.Map(seq, FlatFilePos(1, 0), 1));
+
+    auto mapped = cache.Map(seq, FlatFilePos(0, 0), pos2);
+    BOOST_REQUIRE(mapped);
+    BOOST_CHECK_EQUAL(mapped->size(), pos2);
+    std::string text;
+    SpanReader(SER_DISK, CLIENT_VERSION, Span<const unsigned char>(mapped->data(), mapped->size())) >> text;
+    BOOST_CHECK_EQUAL(text, line1);
+    BOOST_CHECK(cache.Map(seq, FlatFilePos(0, 0), pos2) == mapped);
+
+    // Asking for more than a cached mapping covers maps the grown file again
+    {
+        CAutoFile file(seq.Open(FlatFilePos(0, pos2)), SER_DISK, CLIENT_VERSION);
+        file << line2;
+    }
+    size_t end = pos2 + GetSerializeSize(line2, CLIENT_VERSION);
+    auto grown = cache.Map(seq, FlatFilePos(0, pos2), end);
+    BOOST_REQUIRE(grown);
+    BOOST_CHECK(grown != mapped);
+    SpanReader reader(SER_DISK, CLIENT_VERSION, Span<const unsigned char>(grown->data() + pos2, end - pos2));
+    reader >> text;
+    BOOST_CHECK_EQUAL(text, line2);
+    BOOST_CHECK(reader.empty());
+    BOOST_CHECK_THROW(reader >> text, std::ios_base::failure);
+
+    // The old mapping stays valid while it's held
+    BOOST_CHECK_EQUAL(mapped->data()[0], line1.size());
+    BOOST_CHECK(!cache.Map(seq, FlatFilePos(0, 0), end + 1));
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,7 +12,10 @@
 #include <key/extkey.h>
 #include <pos/kernel.h>
 #include <chainparams.h>
+#include <anon.h>
 #include <blind.h>
+#include <adapter.h>
+#include <chain/tx_whitelist.h>
 
 #include <script/sign.h>
 #include <policy/policy.h>
@@ -39,6 +42,22 @@ BOOST_AUTO_TEST_CASE(oldversion_test)
     BOOST_CHECK(blk.vtx[0]->nVersion == blkOut.vtx[0]->nVersion);
 }
 
+BOOST_AUTO_TEST_CASE(stake_kernel_hasher)
+{
+    // The precomputed prefix must hash as the full kernel serialization
+    const uint256 modifier = InsecureRand256();
+    const uint32_t nBlockFromTime = 1600000000;
+    const COutPoint prevout(InsecureRand256(), 3);
+    CStakeKernelHasher hasher(modifier, nBlockFromTime, prevout);
+
+    for (uint32_t nTime = nBlockFromTime; nTime < nBlockFromTime + 64; nTime += 16) {
+        CDataStream ss(SER_GETHASH, 0);
+        ss << modifier;
+        ss << nBlockFromTime << prevout.hash << prevout.n << nTime;
+        BOOST_CHECK(hasher.GetHash(nTime) == Hash(ss));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(signature_test)
 {
     SeedInsecureRand();
@@ -81,6 +100,54 @@ BOOST_AUTO_TEST_CASE(signature_test)
     BOOST_CHECK(serror == SCRIPT_ERR_OK);
 }
 
+BOOST_AUTO_TEST_CASE(sign_transaction_inputs)
+{
+    SeedInsecureRand();
+    FillableSigningProvider keystore;
+
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    OUTPUT_PTR<CTxOutStandard> out0 = MAKE_OUTPUT<CTxOutStandard>();
+    out0->nValue = 10000;
+    out0->scriptPubKey = CScript() << OP_RETURN;
+    txn.vpout.push_back(out0);
+
+    // Inputs from different keys, one unknown to the keystore
+    std::map<COutPoint, Coin> coins;
+    const size_t num_inputs = 16;
+    for (size_t i = 0; i < num_inputs; ++i) {
+        CKey k;
+        InsecureNewKey(k, true);
+        if (i != 5) {
+            keystore.AddKey(k);
+        }
+        COutPoint prevout(InsecureRand256(), i);
+        txn.vin.push_back(CTxIn(prevout));
+        coins.emplace(prevout, Coin(CTxOut(1000 + i, GetScriptForDestination(PKHash(k.GetPubKey()))), 1, false));
+    }
+
+    // Unsigned Particl transactions get their midstates precomputed
+    const PrecomputedTransactionData txdata(txn);
+    BOOST_CHECK(txdata.m_bip143_segwit_ready);
+    std::vector<uint8_t> vchAmount(8);
+    part::SetAmount(vchAmount, 1000);
+    const CScript &script0 = coins.at(txn.vin[0].prevout).out.scriptPubKey;
+    BOOST_CHECK(SignatureHash(script0, txn, 0, SIGHASH_ALL, vchAmount, SigVersion::BASE, &txdata) ==
+                SignatureHash(script0, txn, 0, SIGHASH_ALL, vchAmount, SigVersion::BASE));
+
+    std::map<int, std::string> input_errors;
+    BOOST_CHECK(!SignTransaction(txn, &keystore, coins, SIGHASH_ALL, input_errors));
+    BOOST_CHECK_EQUAL(input_errors.size(), 1U);
+    BOOST_CHECK(input_errors.count(5));
+
+    for (size_t i = 0; i < num_inputs; ++i) {
+        const CTxOut &prev = coins.at(txn.vin[i].prevout).out;
+        part::SetAmount(vchAmount, prev.nValue);
+        ScriptError serror = SCRIPT_ERR_OK;
+        BOOST_CHECK_EQUAL(VerifyScript(txn.vin[i].scriptSig, prev.scriptPubKey, &txn.vin[i].scriptWitness, STANDARD_SCRIPT_VERIFY_FLAGS, MutableTransactionSignatureChecker(&txn, i, vchAmount), &serror), i != 5);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(particlchain_test)
 {
     SeedInsecureRand();
@@ -293,6 +360,42 @@ BOOST_AUTO_TEST_CASE(mixed_output_types)
     ECC_Stop_Blinding();
 }
 
+BOOST_AUTO_TEST_CASE(read_without_rangeproofs)
+{
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    txn.vin.push_back(CTxIn(InsecureRand256(), 0));
+
+    OUTPUT_PTR<CTxOutCT> out_ct = MAKE_OUTPUT<CTxOutCT>();
+    out_ct->vData.resize(33, 0x02);
+    out_ct->vRangeproof.resize(5000, 0xaa);
+    txn.vpout.push_back(out_ct);
+    OUTPUT_PTR<CTxOutRingCT> out_rct = MAKE_OUTPUT<CTxOutRingCT>();
+    out_rct->vData.resize(33, 0x03);
+    out_rct->vRangeproof.resize(700, 0xbb);
+    txn.vpout.push_back(out_rct);
+    txn.vpout.push_back(MAKE_OUTPUT<CTxOutStandard>(1 * COIN, CScript() << OP_TRUE));
+    const CTransaction tx(txn);
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << tx;
+    CDataStream ss_skip(ss);
+    ss_skip.SetVersion(CLIENT_VERSION | SERIALIZE_TRANSACTION_NO_RANGEPROOF);
+
+    CMutableTransaction txn_full, txn_skip;
+    ss >> txn_full;
+    ss_skip >> txn_skip;
+    BOOST_CHECK(ss_skip.empty());
+    BOOST_CHECK_EQUAL(txn_full.vpout[0]->GetPRangeproof()->size(), 5000U);
+
+    // Everything but the rangeproofs is read, the txid is unchanged
+    BOOST_CHECK(txn_skip.vpout[0]->GetPRangeproof()->empty());
+    BOOST_CHECK(txn_skip.vpout[1]->GetPRangeproof()->empty());
+    BOOST_CHECK(*txn_skip.vpout[1]->GetPData() == out_rct->vData);
+    BOOST_CHECK_EQUAL(txn_skip.vpout[2]->GetValue(), 1 * COIN);
+    BOOST_CHECK(CTransaction(txn_skip).GetHash() == tx.GetHash());
+}
+
 BOOST_AUTO_TEST_CASE(op_iscoinstake_tests)
 {
     CKey k1, k2;
@@ -560,4 +663,107 @@ BOOST_AUTO_TEST_CASE(blockreward_at_year_test)
     BOOST_CHECK_EQUAL(Params().GetProofOfStakeRewardAtYear(50), 60000000);
 }
 
+BOOST_AUTO_TEST_CASE(tx_lists_test)
+{
+    // Lookups binary search the tables
+    auto less = [](const char *a, const char *b) { return strcmp(a, b) < 0; };
+    BOOST_CHECK(std::is_sorted(std::begin(tx_to_allow), std::end(tx_to_allow), less));
+    BOOST_CHECK(std::is_sorted(std::begin(txSpendingBlacklisted), std::end(txSpendingBlacklisted), less));
+    BOOST_CHECK(std::adjacent_find(std::begin(tx_to_allow), std::end(tx_to_allow),
+        [](const char *a, const char *b) { return strcmp(a, b) == 0; }) == std::end(tx_to_allow));
+
+    BOOST_CHECK(isTxSpendingBlacklisted(uint256S("7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ad")));
+    BOOST_CHECK(isTxSpendingBlacklisted(uint256S(txSpendingBlacklisted[0])));
+    BOOST_CHECK(!isTxSpendingBlacklisted(uint256S("7bc73dd12503e11312c80c57bad5683b10a27ab412082683468f0b82cb87c6ae")));
+
+    CMutableTransaction txn;
+    BOOST_CHECK(!ignoreTx(CTransaction(txn)));
+
+    const std::vector<std::uint64_t> &blacklist = Params().GetBlacklistedAnonOutputs();
+    BOOST_CHECK(std::is_sorted(blacklist.begin(), blacklist.end()));
+}
+
+BOOST_AUTO_TEST_CASE(ring_member_highest_index)
+{
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    BOOST_CHECK_EQUAL(GetHighestRingMemberIndex(CTransaction(txn)), -1);
+
+    // Two inputs with rings of 3
+    const std::vector<uint64_t> rings[2] = {{5, 900, 17, 3, 8, 1}, {12, 2, 40, 7, 6, 11}};
+    for (const auto &ring : rings) {
+        CTxIn txin;
+        txin.prevout.n = COutPoint::ANON_MARKER;
+        txin.SetAnonInfo(2, 3);
+        std::vector<uint8_t> vMI;
+        for (uint64_t index : ring) {
+            BOOST_CHECK(0 == part::PutVarInt(vMI, index));
+        }
+        txin.scriptWitness.stack.push_back(vMI);
+        txin.scriptWitness.stack.emplace_back();
+        txn.vin.push_back(txin);
+    }
+    BOOST_CHECK_EQUAL(GetHighestRingMemberIndex(CTransaction(txn)), 900);
+
+    // Truncated rings give the highest index that could be read
+    txn.vin[0].scriptWitness.stack[0].resize(1);
+    BOOST_CHECK_EQUAL(GetHighestRingMemberIndex(CTransaction(txn)), 40);
+}
+
+BOOST_AUTO_TEST_CASE(tx_validation_cost)
+{
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    txn.vin.emplace_back(COutPoint(uint256S("0x01"), 0));
+    txn.vpout.push_back(MAKE_OUTPUT<CTxOutStandard>(1 * COIN, CScript()));
+    BOOST_CHECK_EQUAL(GetTransactionValidationCost(CTransaction(txn)), TX_COST_PLAIN_INPUT);
+
+    // Each ring member of an anon input and each rangeproof adds to the estimate
+    CTxIn txin;
+    txin.prevout.n = COutPoint::ANON_MARKER;
+    txin.SetAnonInfo(2, 5);
+    txn.vin.push_back(txin);
+    txn.vpout.push_back(MAKE_OUTPUT<CTxOutCT>());
+    txn.vpout.push_back(MAKE_OUTPUT<CTxOutRingCT>());
+    BOOST_CHECK_EQUAL(GetTransactionValidationCost(CTransaction(txn)),
+        TX_COST_PLAIN_INPUT + 2 * 5 * TX_COST_RING_MEMBER + 2 * TX_COST_RANGEPROOF);
+
+    // Out of range counts are clamped
+    txn.vin[1].SetAnonInfo(1000000, 1000000);
+    BOOST_CHECK_EQUAL(GetTransactionValidationCost(CTransaction(txn)),
+        TX_COST_PLAIN_INPUT + (int64_t)(MAX_ANON_INPUTS * MAX_RINGSIZE) * TX_COST_RING_MEMBER + 2 * TX_COST_RANGEPROOF);
+}
+
+BOOST_AUTO_TEST_CASE(reward_schedule)
+{
+    const auto params = CreateChainParams(*m_node.args, CBaseChainParams::MAIN);
+    const int blocks_per_year = (365 * 24 * 60 * 60) / params->GetTargetSpacing();
+
+    // Treasury settings change at the listed heights, whatever order they were added in
+    BOOST_CHECK(params->GetTreasuryFundSettings(-1) == nullptr);
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(0)->nTreasuryOutputPeriod, 360);
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(40861)->sTreasuryFundAddresses, "GQtToV2LnHGhHy4LRVapLDMaukdDgzZZZV");
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(40862)->sTreasuryFundAddresses, "Ga7ECMeX8QUJTTvf9VUnYgTQUFxPChDqqU");
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(140536)->sTreasuryFundAddresses, "GQJ4unJi6hAzd881YM17rEzPNWaWZ4AR3f");
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(458742)->sTreasuryFundAddresses, "GQJ4unJi6hAzd881YM17rEzPNWaWZ4AR3f");
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(458743)->sTreasuryFundAddresses, "GgtiuDqVxAzg47yW7oSMmophe3tU8qoE1f");
+    BOOST_CHECK_EQUAL(params->GetTreasuryFundSettings(std::numeric_limits<int>::max())->sTreasuryFundAddresses, "GgtiuDqVxAzg47yW7oSMmophe3tU8qoE1f");
+
+    // Rewards follow the yearly percentages, doubled from nBlockRewardIncreaseHeight
+    const int increase_height = params->GetConsensus().nBlockRewardIncreaseHeight;
+    BOOST_CHECK_EQUAL(params->GetProofOfStakeRewardAtHeight(0), params->GetBaseBlockReward());
+    BOOST_CHECK_EQUAL(params->GetProofOfStakeRewardAtHeight(increase_height), 2 * params->GetBaseBlockReward());
+    for (int year : {1, 2, 10, 46, 47, 100}) {
+        const CAmount expect = 2 * params->GetBaseBlockReward() * params->GetCoinYearPercent(year) / 100;
+        BOOST_CHECK_EQUAL(params->GetProofOfStakeRewardAtHeight(year * blocks_per_year), expect);
+        BOOST_CHECK_EQUAL(params->GetProofOfStakeRewardAtHeight(year * blocks_per_year - 1), 2 * params->GetProofOfStakeRewardAtYear(year - 1));
+    }
+
+    const int64_t genesis_time = params->GenesisBlock().nTime;
+    const int64_t seconds_in_year = 365 * 24 * 60 * 60;
+    BOOST_CHECK_EQUAL(params->GetCoinYearReward(genesis_time), 5 * CENT);
+    BOOST_CHECK_EQUAL(params->GetCoinYearReward(genesis_time + 2 * seconds_in_year), 3 * CENT);
+    BOOST_CHECK_EQUAL(params->GetCoinYearReward(genesis_time + 3 * seconds_in_year), 2 * CENT);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,262 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <test/util/setup_common.h>
+
+#include <insight/addressindex.h>
+#include <insight/insight.h>
+#include <insight/rewardindex.h>
+#include <streams.h>
+#include <txdb.h>
+
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(insight_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(insight_address_balance)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    const bool fAddressBalanceIndexBefore = fAddressBalanceIndex;
+    fAddressBalanceIndex = true;
+
+    const uint256 address = uint256S("0xaa");
+    const uint256 other = uint256S("0xbb");
+    const CAddressIndexIteratorKey key(ADDR_INDT_PUBKEY_ADDRESS, address);
+
+    // Block 1 pays the address twice in one tx, block 2 spends one output and pays change back in one tx
+    std::vector<std::pair<CAddressIndexKey, CAmount> > block1, block2;
+    block1.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 1, 1, uint256S("0x01"), 0, false), 100));
+    block1.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 1, 1, uint256S("0x01"), 1, false), 50));
+    block1.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, other, 1, 1, uint256S("0x01"), 2, false), 7));
+    block2.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 2, 1, uint256S("0x02"), 0, true), -100));
+    block2.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 2, 1, uint256S("0x02"), 0, false), 30));
+
+    BOOST_CHECK(db.WriteAddressIndex(block1));
+    BOOST_CHECK(db.WriteAddressIndex(block2));
+
+    CAddressBalanceValue value;
+    BOOST_CHECK(db.ReadAddressBalance(key, value));
+    BOOST_CHECK_EQUAL(value.balance, 80);
+    BOOST_CHECK_EQUAL(value.received, 180);
+    BOOST_CHECK_EQUAL(value.txCount, 2U);
+    BOOST_CHECK_EQUAL(value.lastHeight, 2);
+
+    // Totals must match summing the deltas
+    std::vector<std::pair<CAddressIndexKey, CAmount> > deltas;
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, deltas));
+    CAmount balance = 0;
+    for (const auto &it : deltas) {
+        balance += it.second;
+    }
+    BOOST_CHECK_EQUAL(balance, value.balance);
+
+    // Disconnecting block 2 restores the totals and the last height from the remaining entries
+    BOOST_CHECK(db.EraseAddressIndex(block2));
+    BOOST_CHECK(db.ReadAddressBalance(key, value));
+    BOOST_CHECK_EQUAL(value.balance, 150);
+    BOOST_CHECK_EQUAL(value.received, 150);
+    BOOST_CHECK_EQUAL(value.txCount, 1U);
+    BOOST_CHECK_EQUAL(value.lastHeight, 1);
+
+    // The record goes away with the last entry
+    BOOST_CHECK(db.EraseAddressIndex(block1));
+    BOOST_CHECK(!db.ReadAddressBalance(key, value));
+    BOOST_CHECK(!db.ReadAddressBalance(CAddressIndexIteratorKey(ADDR_INDT_PUBKEY_ADDRESS, other), value));
+
+    fAddressBalanceIndex = fAddressBalanceIndexBefore;
+}
+
+BOOST_AUTO_TEST_CASE(insight_address_index_v2)
+{
+    // The compact integers sort like their values
+    std::vector<std::vector<uint8_t> > encoded;
+    for (uint32_t n : {0U, 1U, 255U, 256U, 65535U, 65536U, 0x7FFFFFFFU, 0xFFFFFFFFU}) {
+        CDataStream ss(SER_DISK, 0);
+        ser_writeordered32(ss, n);
+        BOOST_CHECK_EQUAL(ser_readordered32(ss), n);
+        encoded.emplace_back(ss.begin(), ss.end());
+    }
+    BOOST_CHECK(std::is_sorted(encoded.begin(), encoded.end()));
+
+    CBlockTreeDB db(1 << 20, true, true);
+    const bool fAddressIndexBefore = fAddressIndex;
+    const bool fAddressIndexV2Before = fAddressIndexV2;
+    const bool fAddressBalanceIndexBefore = fAddressBalanceIndex;
+    fAddressIndex = true;
+    fAddressIndexV2 = false;
+    fAddressBalanceIndex = true;
+
+    const uint256 address = uint256S("0xaa");
+    std::vector<std::pair<CAddressIndexKey, CAmount> > block1, block2;
+    block1.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 1, 1, uint256S("0x01"), 0, false), 100));
+    block1.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 1, 2, uint256S("0x03"), 1, false), 50));
+    block2.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 300, 1, uint256S("0x02"), 0, true), -100));
+    block2.push_back(std::make_pair(CAddressIndexKey(ADDR_INDT_PUBKEY_ADDRESS, address, 300, 1, uint256S("0x02"), 0, false), 30));
+    BOOST_CHECK(db.WriteAddressIndex(block1));
+    BOOST_CHECK(db.WriteAddressIndex(block2));
+
+    std::vector<std::pair<CAddressIndexKey, CAmount> > legacy, compact;
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, legacy));
+    BOOST_CHECK_EQUAL(legacy.size(), 4U);
+
+    // Without fMigrate a legacy index is left alone
+    BOOST_CHECK(db.UpgradeAddressIndex(false));
+    BOOST_CHECK(!fAddressIndexV2);
+
+    BOOST_CHECK(db.UpgradeAddressIndex(true));
+    BOOST_CHECK(fAddressIndexV2);
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, compact));
+    BOOST_REQUIRE_EQUAL(compact.size(), legacy.size());
+    for (size_t i = 0; i < legacy.size(); ++i) {
+        BOOST_CHECK(compact[i].first.hashBytes == legacy[i].first.hashBytes);
+        BOOST_CHECK_EQUAL(compact[i].first.blockHeight, legacy[i].first.blockHeight);
+        BOOST_CHECK_EQUAL(compact[i].first.txindex, legacy[i].first.txindex);
+        BOOST_CHECK(compact[i].first.txhash == legacy[i].first.txhash);
+        BOOST_CHECK_EQUAL(compact[i].first.index, legacy[i].first.index);
+        BOOST_CHECK_EQUAL(compact[i].first.spending, legacy[i].first.spending);
+        BOOST_CHECK_EQUAL(compact[i].second, legacy[i].second);
+    }
+
+    // Height ranges and disconnecting work on the compact encoding
+    compact.clear();
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, compact, 2, 300));
+    BOOST_CHECK_EQUAL(compact.size(), 2U);
+    BOOST_CHECK(db.EraseAddressIndex(block2));
+    CAddressBalanceValue value;
+    BOOST_CHECK(db.ReadAddressBalance(CAddressIndexIteratorKey(ADDR_INDT_PUBKEY_ADDRESS, address), value));
+    BOOST_CHECK_EQUAL(value.balance, 150);
+    BOOST_CHECK_EQUAL(value.lastHeight, 1);
+    compact.clear();
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, compact));
+    BOOST_CHECK_EQUAL(compact.size(), 2U);
+
+    // Reconnecting reuses the address id
+    BOOST_CHECK(db.WriteAddressIndex(block2));
+    compact.clear();
+    BOOST_CHECK(db.ReadAddressIndex(address, ADDR_INDT_PUBKEY_ADDRESS, compact));
+    BOOST_CHECK_EQUAL(compact.size(), 4U);
+
+    fAddressIndex = fAddressIndexBefore;
+    fAddressIndexV2 = fAddressIndexV2Before;
+    fAddressBalanceIndex = fAddressBalanceIndexBefore;
+}
+
+BOOST_AUTO_TEST_CASE(insight_vote_index)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    const uint256 voted = uint256S("0x01");
+    const uint256 abstained = uint256S("0x02");
+    const uint32_t token = (3 << 16) | 7; // option 3 of proposal 7
+
+    BOOST_CHECK(db.WriteBlockVoteIndex(voted, token));
+    BOOST_CHECK(db.WriteBlockVoteIndex(abstained, 0));
+
+    uint32_t vote_token = 1;
+    BOOST_CHECK(db.ReadBlockVoteIndex(voted, vote_token));
+    BOOST_CHECK_EQUAL(vote_token, token);
+    BOOST_CHECK(db.ReadBlockVoteIndex(abstained, vote_token));
+    BOOST_CHECK_EQUAL(vote_token, 0U);
+
+    // Blocks without a coinstake are never written
+    BOOST_CHECK(!db.ReadBlockVoteIndex(uint256S("0x03"), vote_token));
+}
+
+BOOST_AUTO_TEST_CASE(insight_reward_index)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    const uint256 block_hash = uint256S("0x01");
+
+    BlockRewardSummary summary;
+    summary.flags = BlockRewardSummary::HAVE_TREASURY | BlockRewardSummary::HAVE_FEES;
+    summary.coinstake = uint256S("0x02");
+    summary.stake_reward = 6 * COIN;
+    summary.block_reward = 5 * COIN + 1000;
+    summary.treasury_reward = COIN;
+    summary.fees = 1000;
+    summary.kernel_value = 2000 * COIN;
+    summary.kernel_script = CScript() << OP_TRUE;
+    summary.outputs.emplace_back(CScript() << OP_TRUE, 2005 * COIN + 1000);
+    BOOST_CHECK(db.WriteBlockRewardIndex(block_hash, summary));
+
+    BlockRewardSummary read;
+    BOOST_CHECK(db.ReadBlockRewardIndex(block_hash, read));
+    BOOST_CHECK_EQUAL(read.flags, summary.flags);
+    BOOST_CHECK(read.coinstake == summary.coinstake);
+    BOOST_CHECK_EQUAL(read.stake_reward, summary.stake_reward);
+    BOOST_CHECK_EQUAL(read.block_reward, summary.block_reward);
+    BOOST_CHECK_EQUAL(read.treasury_reward, summary.treasury_reward);
+    BOOST_CHECK_EQUAL(read.gvr_reward, 0);
+    BOOST_CHECK_EQUAL(read.fees, summary.fees);
+    BOOST_CHECK_EQUAL(read.kernel_value, summary.kernel_value);
+    BOOST_CHECK(read.kernel_script == summary.kernel_script);
+    BOOST_REQUIRE_EQUAL(read.outputs.size(), 1U);
+    BOOST_CHECK(read.outputs[0] == summary.outputs[0]);
+
+    BOOST_CHECK(!db.ReadBlockRewardIndex(uint256S("0x03"), read));
+}
+
+BOOST_AUTO_TEST_CASE(insight_db_split)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    const fs::path path = GetDataDir() / "insight_split";
+    const CSpentIndexKey spent_key(uint256S("0x01"), 0);
+    const uint256 block_hash = uint256S("0x02");
+
+    std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> > spent;
+    spent.emplace_back(spent_key, CSpentIndexValue(uint256S("0x03"), 1, 10, 5, 2, uint256S("0x04")));
+    BOOST_CHECK(db.UpdateSpentIndex(spent));
+    BOOST_CHECK(db.WriteTimestampBlockIndex(CTimestampBlockIndexKey(block_hash), CTimestampBlockIndexValue(1000)));
+    BOOST_CHECK(db.WriteBlockVoteIndex(block_hash, 7));
+
+    // Split off, the insight records move
+    BOOST_CHECK(db.OpenInsightDB(true, path, 1 << 20));
+    BOOST_REQUIRE(db.GetInsightDB());
+    BOOST_CHECK(!db.Exists(std::make_pair('p', spent_key)));
+    BOOST_CHECK(db.GetInsightDB()->Exists(std::make_pair('p', spent_key)));
+    BOOST_CHECK(&db.GetDBForPrefix('p') == db.GetInsightDB());
+    BOOST_CHECK(&db.GetDBForPrefix('W') == db.GetInsightDB());
+    BOOST_CHECK(&db.GetDBForPrefix('v') == &db);
+
+    CSpentIndexValue value;
+    unsigned int ltimestamp = 0;
+    uint32_t vote_token = 0;
+    BOOST_CHECK(db.ReadSpentIndex(spent_key, value));
+    BOOST_CHECK_EQUAL(value.blockHeight, 10);
+    BOOST_CHECK(db.ReadTimestampBlockIndex(block_hash, ltimestamp));
+    BOOST_CHECK_EQUAL(ltimestamp, 1000U);
+    BOOST_CHECK(db.ReadBlockVoteIndex(block_hash, vote_token));
+    BOOST_CHECK_EQUAL(vote_token, 7U);
+
+    // Vote records written while split are found there
+    const uint256 split_block_hash = uint256S("0x08");
+    BOOST_CHECK(db.WriteBlockVoteIndex(split_block_hash, 9));
+    BOOST_CHECK(db.GetInsightDB()->Exists(std::make_pair('W', split_block_hash)));
+    BOOST_CHECK(!db.Exists(std::make_pair('W', split_block_hash)));
+    BOOST_CHECK(db.ReadBlockVoteIndex(split_block_hash, vote_token));
+    BOOST_CHECK_EQUAL(vote_token, 9U);
+
+    // Reopening split doesn't move again, a different location is refused
+    BOOST_CHECK(db.OpenInsightDB(true, path, 1 << 20));
+    BOOST_CHECK(db.ReadSpentIndex(spent_key, value));
+    BOOST_CHECK(!db.OpenInsightDB(true, GetDataDir() / "insight_elsewhere", 1 << 20));
+
+    // Written while split and moved back
+    BOOST_CHECK(db.OpenInsightDB(true, path, 1 << 20));
+    spent.clear();
+    spent.emplace_back(CSpentIndexKey(uint256S("0x05"), 1), CSpentIndexValue(uint256S("0x06"), 0, 11, 3, 2, uint256S("0x07")));
+    BOOST_CHECK(db.UpdateSpentIndex(spent));
+    BOOST_CHECK(db.OpenInsightDB(false, fs::path(), 1 << 20));
+    BOOST_CHECK(!db.GetInsightDB());
+    BOOST_CHECK(!fs::exists(path));
+    BOOST_CHECK(db.ReadSpentIndex(spent_key, value));
+    BOOST_CHECK(db.ReadSpentIndex(CSpentIndexKey(uint256S("0x05"), 1), value));
+    BOOST_CHECK_EQUAL(value.blockHeight, 11);
+    BOOST_CHECK(db.ReadTimestampBlockIndex(block_hash, ltimestamp));
+    BOOST_CHECK(db.ReadBlockVoteIndex(split_block_hash, vote_token));
+    BOOST_CHECK_EQUAL(vote_token, 9U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,76 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <rpc/jsonstream.h>
+#include <test/util/setup_common.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(jsonstream_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(jsonstream_matches_write)
+{
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("str", "a \"quoted\"\nline");
+    obj.pushKV("num", 21000000);
+    obj.pushKV("real", UniValue(UniValue::VNUM, "0.00010000"));
+    obj.pushKV("null", NullUniValue);
+    obj.pushKV("empty_obj", UniValue(UniValue::VOBJ));
+    obj.pushKV("empty_arr", UniValue(UniValue::VARR));
+    UniValue arr(UniValue::VARR);
+    for (int i = 0; i < 100; ++i) {
+        UniValue item(UniValue::VOBJ);
+        item.pushKV("n", i);
+        item.pushKV("flag", i % 2 == 0);
+        arr.push_back(item);
+    }
+    obj.pushKV("arr", arr);
+
+    // Small pieces reach the sink as they're written, together they equal write()
+    std::string out;
+    size_t pieces = 0;
+    JSONStreamWriter stream([&](const std::string& chunk) {
+        BOOST_CHECK(!chunk.empty());
+        out += chunk;
+        pieces++;
+    }, 64);
+    stream.Value(obj);
+    BOOST_CHECK(stream.HasValue());
+    stream.Flush();
+    BOOST_CHECK_EQUAL(out, obj.write());
+    BOOST_CHECK(pieces > 10);
+
+    // Built up member by member
+    out.clear();
+    JSONStreamWriter stream_items([&](const std::string& chunk) { out += chunk; });
+    stream_items.BeginObject();
+    for (size_t i = 0; i < obj.getKeys().size(); ++i) {
+        stream_items.Key(obj.getKeys()[i]);
+        if (obj.getKeys()[i] == "arr") {
+            stream_items.BeginArray();
+            for (const UniValue& item : arr.getValues()) {
+                stream_items.Value(item);
+            }
+            stream_items.EndArray();
+        } else {
+            stream_items.Value(obj.getValues()[i]);
+        }
+    }
+    BOOST_CHECK(!stream_items.HasValue());
+    stream_items.EndObject();
+    BOOST_CHECK(stream_items.HasValue());
+    BOOST_CHECK(!stream_items.Flushed());
+    stream_items.Flush();
+    BOOST_CHECK(stream_items.Flushed());
+    BOOST_CHECK_EQUAL(out, obj.write());
+
+    // Nothing is written for a result that isn't streamed
+    out.clear();
+    JSONStreamWriter stream_unused([&](const std::string& chunk) { out += chunk; });
+    BOOST_CHECK(!stream_unused.HasValue());
+    stream_unused.Flush();
+    BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
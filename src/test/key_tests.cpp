@@ -273,6 +273,33 @@ static void CmpSerializationPubkey(const CPubKey& pubkey)
     BOOST_CHECK(pubkey == pubkey2);
 }
 
+BOOST_AUTO_TEST_CASE(pubkey_verify_cached)
+{
+    CKey key = DecodeSecret(strSecret1C);
+    CKey other = DecodeSecret(strSecret2C);
+    const CPubKey pubkey = key.GetPubKey();
+    const uint256 hash = uint256S("0x1234");
+    std::vector<unsigned char> sig, sig_other;
+    BOOST_CHECK(key.Sign(hash, sig));
+    BOOST_CHECK(other.Sign(hash, sig_other));
+
+    const PubKeyCacheStats before = GetPubKeyCacheStats();
+    BOOST_CHECK(pubkey.VerifyCached(hash, sig));
+    BOOST_CHECK(pubkey.VerifyCached(hash, sig));
+    // A cached key must still reject other signatures and hashes
+    BOOST_CHECK(!pubkey.VerifyCached(hash, sig_other));
+    BOOST_CHECK(!pubkey.VerifyCached(uint256S("0x4321"), sig));
+    BOOST_CHECK(other.GetPubKey().VerifyCached(hash, sig_other));
+    const PubKeyCacheStats after = GetPubKeyCacheStats();
+    BOOST_CHECK_GE(after.hits - before.hits, 3U);
+    BOOST_CHECK_GE(after.entries, 1U);
+
+    // Uncompressed keys bypass the cache
+    CKey uncompressed = DecodeSecret(strSecret1);
+    BOOST_CHECK(uncompressed.Sign(hash, sig));
+    BOOST_CHECK(uncompressed.GetPubKey().VerifyCached(hash, sig));
+}
+
 BOOST_AUTO_TEST_CASE(pubkey_unserialize)
 {
     for (uint8_t i = 2; i <= 7; ++i) {
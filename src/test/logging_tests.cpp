@@ -7,6 +7,11 @@
 #include <test/util/setup_common.h>
 
 #include <chrono>
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
@@ -33,4 +38,52 @@ BOOST_AUTO_TEST_CASE(logging_timer)
     SetMockTime(0);
 }
 
+BOOST_AUTO_TEST_CASE(logging_async)
+{
+    for (const bool drop : {false, true}) {
+        BCLog::Logger logger;
+        logger.m_log_timestamps = false;
+        std::string out;
+        logger.PushBackCallback([&](const std::string& s) { out += s; });
+        BOOST_CHECK(logger.StartLogging());
+        logger.StartAsync(4, drop, std::chrono::milliseconds{1});
+        BOOST_CHECK(logger.IsAsync());
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&logger, t] {
+                for (int i = 0; i < 500; ++i) {
+                    logger.LogPrintStr(strprintf("thread %d message %d\n", t, i));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        logger.StopAsync();
+        BOOST_CHECK(!logger.IsAsync());
+        logger.LogPrintStr("sync\n");
+
+        // Whole records in the order each thread logged them, the dropped ones are counted
+        std::map<int, int> next;
+        int records = 0, dropped = 0;
+        std::istringstream lines(out);
+        std::string line, last;
+        while (std::getline(lines, line)) {
+            int t, i, n;
+            if (sscanf(line.c_str(), "thread %d message %d", &t, &i) == 2) {
+                BOOST_CHECK(drop ? i >= next[t] : i == next[t]);
+                next[t] = i + 1;
+                records++;
+            } else if (sscanf(line.c_str(), "%d log messages dropped", &n) == 1) {
+                BOOST_CHECK(drop);
+                dropped += n;
+            }
+            last = line;
+        }
+        BOOST_CHECK_EQUAL(last, "sync");
+        BOOST_CHECK_EQUAL(records + dropped, 2000);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,7 +2,10 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <core_memusage.h>
+#include <insight/addressindex.h>
 #include <policy/policy.h>
+#include <script/standard.h>
 #include <txmempool.h>
 #include <util/system.h>
 #include <util/time.h>
@@ -788,4 +791,200 @@ BOOST_AUTO_TEST_CASE(MempoolAncestryTests)
     BOOST_CHECK_EQUAL(descendants, 4ULL);
 }
 
+static CMutableTransaction MakeAnonTx(uint8_t seed, size_t nInputs)
+{
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].prevout.n = COutPoint::ANON_MARKER;
+    tx.vin[0].SetAnonInfo(nInputs, 3);
+    std::vector<uint8_t> vKeyImages(nInputs * 33);
+    for (size_t k = 0; k < nInputs; ++k) {
+        vKeyImages[k * 33] = 0x02;
+        vKeyImages[k * 33 + 1] = seed;
+        vKeyImages[k * 33 + 2] = k;
+    }
+    tx.vin[0].scriptData.stack.push_back(vKeyImages);
+    tx.vout.resize(1);
+    tx.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    tx.vout[0].nValue = 10 * COIN;
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(MempoolKeyImageTest)
+{
+    TestMemPoolEntryHelper entry;
+    CTxMemPool pool;
+    LOCK2(cs_main, pool.cs);
+    pool.setSanityCheck(1.0);
+
+    CMutableTransaction tx1 = MakeAnonTx(1, 2);
+    CMutableTransaction tx2 = MakeAnonTx(2, 1);
+    CTxMemPoolEntry entry1 = entry.FromTx(tx1);
+    BOOST_CHECK_EQUAL(entry1.GetKeyImages().size(), 2U);
+
+    pool.addUnchecked(entry1);
+    pool.addUnchecked(entry.FromTx(tx2));
+    BOOST_CHECK_EQUAL(pool.mapKeyImages.size(), 3U);
+
+    uint256 txhash;
+    CCmpPubKey ki = entry1.GetKeyImages()[1];
+    BOOST_CHECK(pool.HaveKeyImage(ki, txhash));
+    BOOST_CHECK(txhash == tx1.GetHash());
+
+    // A block tx spending one of the key images evicts the mempool tx
+    CMutableTransaction tx3 = MakeAnonTx(1, 1);
+    tx3.vout[0].nValue = 9 * COIN;
+    pool.removeForBlock({MakeTransactionRef(tx3)}, 1);
+    BOOST_CHECK(!pool.exists(tx1.GetHash()));
+    BOOST_CHECK(!pool.HaveKeyImage(ki, txhash));
+    BOOST_CHECK_EQUAL(pool.mapKeyImages.size(), 1U);
+
+    pool.removeRecursive(CTransaction(tx2), REMOVAL_REASON_DUMMY);
+    BOOST_CHECK_EQUAL(pool.mapKeyImages.size(), 0U);
+}
+
+static CMutableTransaction MakeAddressTx(const CKeyID &id, CAmount nValue)
+{
+    CMutableTransaction tx;
+    tx.nVersion = GHOST_TXN_VERSION;
+    tx.SetType(TXN_STANDARD);
+    OUTPUT_PTR<CTxOutStandard> out = MAKE_OUTPUT<CTxOutStandard>();
+    out->nValue = nValue;
+    out->scriptPubKey = GetScriptForDestination(PKHash(id));
+    tx.vpout.push_back(out);
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(MempoolAddressIndexTest)
+{
+    TestMemPoolEntryHelper entry;
+    CTxMemPool pool;
+    LOCK2(cs_main, pool.cs);
+    CCoinsView view_dummy;
+    CCoinsViewCache view(&view_dummy);
+
+    CKeyID id1(uint160(std::vector<uint8_t>(20, 0x01)));
+    CKeyID id2(uint160(std::vector<uint8_t>(20, 0x02)));
+    uint256 hash1, hash2;
+    memcpy(hash1.begin(), id1.begin(), 20);
+    memcpy(hash2.begin(), id2.begin(), 20);
+    std::vector<std::pair<uint256, int> > addresses{{hash1, ADDR_INDT_PUBKEY_ADDRESS}};
+
+    CMutableTransaction tx1 = MakeAddressTx(id1, 1 * COIN);
+    CMutableTransaction tx2 = MakeAddressTx(id2, 2 * COIN);
+    CMutableTransaction tx3 = MakeAddressTx(id1, 3 * COIN);
+    pool.addAddressIndex(entry.FromTx(tx1), view);
+    pool.addAddressIndex(entry.FromTx(tx2), view);
+
+    std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > results;
+    uint64_t sequence = 0;
+    BOOST_CHECK(pool.getAddressIndex(addresses, 0, results, sequence));
+    BOOST_CHECK_EQUAL(results.size(), 1U);
+    BOOST_CHECK(results[0].first.txhash == tx1.GetHash());
+    BOOST_CHECK_EQUAL(results[0].second.amount, 1 * COIN);
+    BOOST_CHECK_EQUAL(sequence, 2U);
+
+    // Polling from the last sequence only returns deltas added after it
+    pool.addAddressIndex(entry.FromTx(tx3), view);
+    results.clear();
+    BOOST_CHECK(pool.getAddressIndex(addresses, sequence, results, sequence));
+    BOOST_CHECK_EQUAL(results.size(), 1U);
+    BOOST_CHECK(results[0].first.txhash == tx3.GetHash());
+    BOOST_CHECK_EQUAL(sequence, 3U);
+
+    // Removed transactions leave the per address lists
+    pool.removeAddressIndex(tx1.GetHash());
+    pool.removeAddressIndex(tx3.GetHash());
+    results.clear();
+    BOOST_CHECK(pool.getAddressIndex(addresses, results));
+    BOOST_CHECK(results.empty());
+    addresses.emplace_back(hash2, ADDR_INDT_PUBKEY_ADDRESS);
+    BOOST_CHECK(pool.getAddressIndex(addresses, results));
+    BOOST_CHECK_EQUAL(results.size(), 1U);
+    BOOST_CHECK(results[0].first.txhash == tx2.GetHash());
+}
+
+BOOST_AUTO_TEST_CASE(MempoolAddressIndexBlockRemovalTest)
+{
+    TestMemPoolEntryHelper entry;
+    CTxMemPool pool;
+    LOCK2(cs_main, pool.cs);
+    CCoinsView view_dummy;
+    CCoinsViewCache view(&view_dummy);
+
+    CKeyID id1(uint160(std::vector<uint8_t>(20, 0x01)));
+    CKeyID id2(uint160(std::vector<uint8_t>(20, 0x02)));
+    uint256 hash1, hash2;
+    memcpy(hash1.begin(), id1.begin(), 20);
+    memcpy(hash2.begin(), id2.begin(), 20);
+    std::vector<std::pair<uint256, int> > addresses{{hash1, ADDR_INDT_PUBKEY_ADDRESS}, {hash2, ADDR_INDT_PUBKEY_ADDRESS}};
+
+    // Several transactions paying the same address, some mined together
+    std::vector<CTransactionRef> block;
+    for (int i = 0; i < 6; ++i) {
+        CMutableTransaction tx = MakeAddressTx(i % 3 == 2 ? id2 : id1, (i + 1) * COIN);
+        pool.addUnchecked(entry.FromTx(tx));
+        pool.addInsightIndexes(entry.FromTx(tx), view, true, true);
+        if (i < 4) {
+            block.push_back(MakeTransactionRef(tx));
+        }
+    }
+
+    std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > results;
+    BOOST_CHECK(pool.getAddressIndex(addresses, results));
+    BOOST_CHECK_EQUAL(results.size(), 6U);
+
+    pool.removeForBlock(block, 1);
+    BOOST_CHECK_EQUAL(pool.size(), 2U);
+    results.clear();
+    BOOST_CHECK(pool.getAddressIndex(addresses, results));
+    BOOST_REQUIRE_EQUAL(results.size(), 2U);
+    for (const auto& result : results) {
+        BOOST_CHECK(pool.exists(result.first.txhash));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MempoolUsageByTxTypeTest)
+{
+    TestMemPoolEntryHelper entry;
+    CTxMemPool pool;
+    LOCK2(cs_main, pool.cs);
+    pool.setSanityCheck(1.0);
+
+    CMutableTransaction tx_plain = MakeAddressTx(CKeyID(uint160(std::vector<uint8_t>(20, 0x01))), 1 * COIN);
+    CMutableTransaction tx_blind = tx_plain;
+    OUTPUT_PTR<CTxOutCT> out = MAKE_OUTPUT<CTxOutCT>();
+    out->vData.resize(33);
+    out->vRangeproof.resize(5000);
+    out->scriptPubKey = *tx_plain.vpout[0]->GetPScriptPubKey();
+    tx_blind.vpout.push_back(out);
+    CMutableTransaction tx_anon = MakeAnonTx(1, 2);
+
+    // Rangeproof buffers and the output allocations are counted
+    const size_t usage_plain = RecursiveDynamicUsage(CTransaction(tx_plain));
+    const size_t usage_blind = RecursiveDynamicUsage(CTransaction(tx_blind));
+    BOOST_CHECK(usage_blind >= usage_plain + 5000 + 33 + sizeof(CTxOutCT));
+    BOOST_CHECK(usage_plain >= sizeof(CTxOutStandard));
+
+    pool.addUnchecked(entry.FromTx(tx_plain));
+    pool.addUnchecked(entry.FromTx(tx_blind));
+    pool.addUnchecked(entry.FromTx(tx_anon));
+    const size_t plain = pool.DynamicMemoryUsage(FeeEstimateTxType::PLAIN);
+    const size_t blind = pool.DynamicMemoryUsage(FeeEstimateTxType::BLIND);
+    const size_t anon = pool.DynamicMemoryUsage(FeeEstimateTxType::ANON);
+    BOOST_CHECK(plain >= usage_plain);
+    BOOST_CHECK(blind >= usage_blind);
+    BOOST_CHECK(blind > plain);
+    BOOST_CHECK(anon > 0);
+    BOOST_CHECK(plain + blind + anon <= pool.DynamicMemoryUsage());
+
+    pool.removeRecursive(CTransaction(tx_blind), REMOVAL_REASON_DUMMY);
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(FeeEstimateTxType::BLIND), 0U);
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(FeeEstimateTxType::PLAIN), plain);
+    pool.removeRecursive(CTransaction(tx_plain), REMOVAL_REASON_DUMMY);
+    pool.removeRecursive(CTransaction(tx_anon), REMOVAL_REASON_DUMMY);
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(FeeEstimateTxType::PLAIN), 0U);
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(FeeEstimateTxType::ANON), 0U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <util/metrics.h>
+#include <test/util/setup_common.h>
+
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(metrics_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(metrics_histogram)
+{
+    MetricHistogram histogram({10, 100}, 2);
+    for (int64_t value : {1, 10, 11, 100, 101, 1000}) {
+        histogram.Observe(value);
+    }
+    // Bounds are inclusive, the last bucket is over every bound
+    BOOST_CHECK(histogram.BucketCounts() == std::vector<uint64_t>({2, 2, 2}));
+    BOOST_CHECK_EQUAL(histogram.Count(), 6U);
+    BOOST_CHECK_EQUAL(histogram.Sum(), 1223);
+
+    MetricsWriter writer;
+    writer.Histogram("h", "a=\"b\"", histogram);
+    BOOST_CHECK_EQUAL(writer.Output(),
+        "h_bucket{a=\"b\",le=\"5\"} 2\n"
+        "h_bucket{a=\"b\",le=\"50\"} 4\n"
+        "h_bucket{a=\"b\",le=\"+Inf\"} 6\n"
+        "h_sum{a=\"b\"} 611.5\n"
+        "h_count{a=\"b\"} 6\n");
+}
+
+BOOST_AUTO_TEST_CASE(metrics_registry)
+{
+    MetricsRegistry registry;
+    MetricCounter& counter = registry.Counter("test_total", "A counter");
+    BOOST_CHECK_EQUAL(&counter, &registry.Counter("test_total", "A counter"));
+    registry.Gauge("test_gauge", "A gauge").Set(-3);
+
+    // Concurrent increments are not lost
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&counter] {
+            for (int n = 0; n < 1000; ++n) {
+                counter.Inc();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK_EQUAL(counter.Get(), 4000U);
+
+    registry.AddCollector("collected", [](MetricsWriter& writer) {
+        writer.Family("test_collected", "gauge", "A collected value");
+        writer.Sample("test_collected", "kind=\"x\"", 7);
+    });
+    BOOST_CHECK_EQUAL(registry.Render(),
+        "# HELP test_gauge A gauge\n# TYPE test_gauge gauge\ntest_gauge -3\n"
+        "# HELP test_total A counter\n# TYPE test_total counter\ntest_total 4000\n"
+        "# HELP test_collected A collected value\n# TYPE test_collected gauge\ntest_collected{kind=\"x\"} 7\n");
+
+    registry.RemoveCollector("collected");
+    BOOST_CHECK(registry.Render().find("test_collected") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -195,6 +195,23 @@ void MinerTestingSetup::TestPackageSelection(const CChainParams& chainparams, co
     m_node.mempool->addUnchecked(entry.Fee(10000).FromTx(tx));
     pblocktemplate = AssemblerForTest(chainparams).CreateNewBlock(scriptPubKey);
     BOOST_CHECK(pblocktemplate->block.vtx[8]->GetHash() == hashLowFeeTx2);
+
+    // Txs without relatives enter and leave the block candidates without a rebuild
+    BOOST_CHECK(!m_node.mempool->m_block_candidates.IsStale());
+    size_t num_packages = m_node.mempool->m_block_candidates.GetPackages().size();
+    tx.vin[0].prevout.hash = txFirst[3]->GetHash();
+    tx.vin[0].prevout.n = 0;
+    tx.vout[0].nValue = 5000000000LL - 1000000;
+    uint256 hashStandaloneTx = tx.GetHash();
+    m_node.mempool->addUnchecked(entry.Fee(1000000).SpendsCoinbase(true).FromTx(tx));
+    BOOST_CHECK(!m_node.mempool->m_block_candidates.IsStale());
+    BOOST_CHECK_EQUAL(m_node.mempool->m_block_candidates.GetPackages().size(), num_packages + 1);
+    pblocktemplate = AssemblerForTest(chainparams).CreateNewBlock(scriptPubKey);
+    BOOST_CHECK(pblocktemplate->block.vtx[1]->GetHash() == hashStandaloneTx);
+
+    m_node.mempool->removeRecursive(CTransaction(tx), MemPoolRemovalReason::REPLACED);
+    BOOST_CHECK(!m_node.mempool->m_block_candidates.IsStale());
+    BOOST_CHECK_EQUAL(m_node.mempool->m_block_candidates.GetPackages().size(), num_packages);
 }
 
 // NOTE: These tests rely on CreateNewBlock doing its own self-validation!
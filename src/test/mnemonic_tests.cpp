@@ -9,6 +9,7 @@
 #include <key/mnemonic.h>
 #include <key/extkey.h>
 #include <key_io.h>
+#include <random.h>
 #include <util/system.h>
 #include <util/strencodings.h>
 
@@ -32,6 +33,17 @@ BOOST_AUTO_TEST_CASE(mnemonic_test)
     BOOST_CHECK(0 == mnemonic::ToSeed(words, password, vSeed));
 
     BOOST_CHECK(HexStr(vSeed) == expect_seed);
+
+    // Batched candidates match single derivations, 5 covers the 4 way path and the remainder
+    std::vector<std::string> vPasswords{"", "a", "TREZOR", "passphrase", "b"};
+    std::vector<std::vector<uint8_t> > vSeeds;
+    BOOST_CHECK(0 == mnemonic::ToSeeds(words, vPasswords, vSeeds));
+    BOOST_REQUIRE(vSeeds.size() == vPasswords.size());
+    BOOST_CHECK(HexStr(vSeeds[0]) == expect_seed);
+    for (size_t i = 1; i < vPasswords.size(); ++i) {
+        BOOST_CHECK(0 == mnemonic::ToSeed(words, vPasswords[i], vSeed));
+        BOOST_CHECK(vSeeds[i] == vSeed);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(mnemonic_test_fails)
@@ -136,4 +148,29 @@ BOOST_AUTO_TEST_CASE(mnemonic_test_json)
     runTests(mnemonic::WLL_JAPANESE, tests_japanese);
 }
 
+BOOST_AUTO_TEST_CASE(mnemonic_word_index)
+{
+    std::string sError;
+    for (int l = 1; l < mnemonic::WLL_MAX; ++l) {
+        if (!mnemonic::HaveLanguage(l)) {
+            continue;
+        }
+        std::string sWord;
+        BOOST_CHECK(0 == mnemonic::GetWord(l, 0, sWord, sError));
+        BOOST_CHECK(0 == mnemonic::GetWord(l, 2047, sWord, sError));
+        BOOST_CHECK(0 != mnemonic::GetWord(l, 2048, sWord, sError));
+
+        // Random phrases round trip through the word index
+        std::vector<uint8_t> vEntropy(32), vDecoded;
+        for (size_t i = 0; i < 8; ++i) {
+            GetRandBytes(vEntropy.data(), vEntropy.size());
+            std::string sWords;
+            BOOST_REQUIRE(0 == mnemonic::Encode(l, vEntropy, sWords, sError));
+            int nLanguage = l;
+            BOOST_CHECK_MESSAGE(0 == mnemonic::Decode(nLanguage, sWords, vDecoded, sError), "Decode: " << sError);
+            BOOST_CHECK(vDecoded == vEntropy);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -769,4 +769,47 @@ BOOST_AUTO_TEST_CASE(PoissonNextSend)
     g_mock_deterministic_tests = false;
 }
 
+BOOST_AUTO_TEST_CASE(recv_buffer_pool)
+{
+    RecvBufferPool pool;
+    for (size_t capacity : {100, 1000, 10000}) {
+        CSerializeData buf;
+        buf.reserve(capacity);
+        buf.resize(10);
+        pool.Release(std::move(buf));
+    }
+    pool.Release(CSerializeData{});
+    BOOST_CHECK_EQUAL(pool.Size(), 3U);
+
+    // The smallest buffer that fits, else the largest
+    CSerializeData buf = pool.Acquire(500);
+    BOOST_CHECK(buf.empty());
+    BOOST_CHECK(buf.capacity() >= 1000 && buf.capacity() < 10000);
+    buf = pool.Acquire(50000);
+    BOOST_CHECK(buf.capacity() >= 10000);
+    buf = pool.Acquire(10);
+    BOOST_CHECK(buf.capacity() >= 100 && buf.capacity() < 1000);
+    BOOST_CHECK_EQUAL(pool.Size(), 0U);
+    BOOST_CHECK(pool.Acquire(10).capacity() == 0);
+
+    // A received payload goes back to the pool once the message is gone
+    CSerializedNetMsg msg;
+    msg.m_type = "ping";
+    msg.data.assign(8, 0x01);
+    std::vector<unsigned char> header;
+    V1TransportSerializer().prepareForTransport(msg, header);
+    V1TransportDeserializer deserializer(Params(), 0, SER_NETWORK, INIT_PROTO_VERSION);
+    BOOST_CHECK_EQUAL(deserializer.Read((const char*)header.data(), header.size()), (int)header.size());
+    BOOST_CHECK_EQUAL(deserializer.Read((const char*)msg.data.data(), msg.data.size()), (int)msg.data.size());
+    BOOST_REQUIRE(deserializer.Complete());
+    uint32_t err_raw_size{0};
+    const size_t pooled = g_recv_buffer_pool.Size();
+    {
+        Optional<CNetMessage> received{deserializer.GetMessage(std::chrono::microseconds{0}, err_raw_size)};
+        BOOST_REQUIRE(received);
+        BOOST_CHECK_EQUAL(received->m_recv.size(), 8U);
+    }
+    BOOST_CHECK(g_recv_buffer_pool.Size() == pooled + 1 || g_recv_buffer_pool.Size() == RECV_BUFFER_POOL_COUNT);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
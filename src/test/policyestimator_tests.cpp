@@ -2,8 +2,11 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <clientversion.h>
+#include <fs.h>
 #include <policy/fees.h>
 #include <policy/policy.h>
+#include <streams.h>
 #include <txmempool.h>
 #include <uint256.h>
 #include <util/time.h>
@@ -180,4 +183,52 @@ BOOST_AUTO_TEST_CASE(BlockPolicyEstimates)
     }
 }
 
+BOOST_AUTO_TEST_CASE(BlockPolicyEstimatesByTxType)
+{
+    CBlockPolicyEstimator feeEst;
+    CTxMemPool mpool(&feeEst);
+    TestMemPoolEntryHelper entry;
+
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vout.resize(1);
+    tx.vout[0].nValue = 0;
+    BOOST_CHECK(GetFeeEstimateTxType(CTransaction(tx)) == FeeEstimateTxType::PLAIN);
+
+    // Only plain txs, all confirming in the next block
+    int blocknum = 0;
+    while (blocknum < 50) {
+        std::vector<CTransactionRef> block;
+        {
+            LOCK2(cs_main, mpool.cs);
+            for (int k = 0; k < 10; k++) {
+                tx.vin[0].prevout.n = 100 * blocknum + k;
+                mpool.addUnchecked(entry.Fee(10000).Time(GetTime()).Height(blocknum).FromTx(tx));
+                block.push_back(mpool.get(tx.GetHash()));
+            }
+            mpool.removeForBlock(block, ++blocknum);
+        }
+    }
+
+    CFeeRate all_rate = feeEst.estimateSmartFee(2, nullptr, false);
+    BOOST_CHECK(all_rate != CFeeRate(0));
+    BOOST_CHECK(feeEst.estimateSmartFee(2, nullptr, false, FeeEstimateTxType::PLAIN) == all_rate);
+    BOOST_CHECK(feeEst.estimateSmartFee(2, nullptr, false, FeeEstimateTxType::BLIND) == CFeeRate(0));
+    BOOST_CHECK(feeEst.estimateSmartFee(2, nullptr, false, FeeEstimateTxType::ANON) == CFeeRate(0));
+
+    // The per type estimates are saved after the stats over all types
+    fs::path path = GetDataDir() / "fee_estimates_type_test.dat";
+    {
+        CAutoFile file(fsbridge::fopen(path, "wb"), SER_DISK, CLIENT_VERSION);
+        BOOST_REQUIRE(feeEst.Write(file));
+    }
+    CBlockPolicyEstimator feeEstRead;
+    {
+        CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+        BOOST_REQUIRE(feeEstRead.Read(file));
+    }
+    BOOST_CHECK(feeEstRead.estimateSmartFee(2, nullptr, false, FeeEstimateTxType::PLAIN) == all_rate);
+    BOOST_CHECK(feeEstRead.estimateSmartFee(2, nullptr, false, FeeEstimateTxType::ANON) == CFeeRate(0));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
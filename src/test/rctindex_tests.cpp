@@ -0,0 +1,257 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <test/util/setup_common.h>
+
+#include <anon.h>
+#include <chain.h>
+#include <rctindex.h>
+#include <txdb.h>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(rctindex_tests, BasicTestingSetup)
+
+static CAnonOutput MakeAnonOutput(int64_t i)
+{
+    uint8_t pk_data[33] = {0x02};
+    memcpy(pk_data + 1, &i, sizeof(i));
+    CCmpPubKey pk(pk_data, pk_data + 33);
+    secp256k1_pedersen_commitment commitment;
+    memset(commitment.data, 0, 33);
+    memcpy(commitment.data, &i, sizeof(i));
+    COutPoint op(uint256S("0x01"), (uint32_t)i);
+    return CAnonOutput(pk, commitment, op, (int)i, 0);
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_output_cache)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+
+    for (int64_t i = 1; i <= 100; ++i) {
+        BOOST_CHECK(db.WriteRCTOutput(i, MakeAnonOutput(i)));
+    }
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 100U);
+
+    CAnonOutput ao;
+    BOOST_CHECK(db.ReadRCTOutput(42, ao));
+    BOOST_CHECK(ao.outpoint.n == 42);
+    BOOST_CHECK_EQUAL(ao.nBlockHeight, 42);
+
+    // Erased outputs must not be served from the cache
+    BOOST_CHECK(db.EraseRCTOutput(42));
+    BOOST_CHECK(!db.ReadRCTOutput(42, ao));
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 99U);
+
+    // Shrinking the cache evicts the least recently used outputs, reads fall through to the db
+    BOOST_CHECK(db.ReadRCTOutput(1, ao));
+    size_t usage = db.RCTOutputCacheUsage();
+    db.SetRCTOutputCacheSize(usage / 2);
+    BOOST_CHECK(db.RCTOutputCacheUsage() <= usage / 2);
+    BOOST_CHECK(db.RCTOutputCacheCount() < 99U);
+    BOOST_CHECK(db.ReadRCTOutput(1, ao) && ao.nBlockHeight == 1);
+    BOOST_CHECK(db.ReadRCTOutput(2, ao) && ao.nBlockHeight == 2);
+
+    db.SetRCTOutputCacheSize(0);
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 0U);
+    BOOST_CHECK(db.ReadRCTOutput(100, ao) && ao.nBlockHeight == 100);
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_output_batch)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+
+    std::vector<std::pair<int64_t, CAnonOutput> > vao;
+    for (int64_t i = 1; i <= 10; ++i) {
+        vao.emplace_back(i, MakeAnonOutput(i));
+    }
+
+    // Outputs, links and key images of a block go in one batch
+    CCmpPubKey ki = MakeAnonOutput(1000).pubkey;
+    CDBBatch batch(db);
+    for (const auto &it : vao) {
+        batch.Write(std::make_pair(DB_RCTOUTPUT_LINK, it.second.pubkey), it.first);
+    }
+    batch.Write(std::make_pair(DB_RCTKEYIMAGE, ki), CAnonKeyImageInfo(uint256S("0x02"), 10));
+    BOOST_CHECK(db.WriteRCTOutputBatch(batch, vao, {}));
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 10U);
+
+    CAnonOutput ao;
+    int64_t index;
+    CAnonKeyImageInfo ki_data;
+    for (const auto &it : vao) {
+        BOOST_CHECK(db.ReadRCTOutput(it.first, ao) && ao.pubkey == it.second.pubkey);
+        BOOST_CHECK(db.ReadRCTOutputLink(it.second.pubkey, index) && index == it.first);
+    }
+    BOOST_CHECK(db.ReadRCTKeyImage(ki, ki_data) && ki_data.height == 10);
+
+    // Roll back the top half
+    batch.Clear();
+    std::vector<int64_t> vErase;
+    for (int64_t i = 6; i <= 10; ++i) {
+        vErase.push_back(i);
+        batch.Erase(std::make_pair(DB_RCTOUTPUT_LINK, vao[i-1].second.pubkey));
+    }
+    batch.Erase(std::make_pair(DB_RCTKEYIMAGE, ki));
+    BOOST_CHECK(db.WriteRCTOutputBatch(batch, {}, vErase));
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 5U);
+    for (const auto &it : vao) {
+        bool expect = it.first <= 5;
+        BOOST_CHECK(db.ReadRCTOutput(it.first, ao) == expect);
+        BOOST_CHECK(db.ReadRCTOutputLink(it.second.pubkey, index) == expect);
+    }
+    BOOST_CHECK(!db.ReadRCTKeyImage(ki, ki_data));
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_output_multiget)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    for (int64_t i = 1; i <= 20; ++i) {
+        BOOST_CHECK(db.WriteRCTOutput(i, MakeAnonOutput(i)));
+    }
+
+    // Mix of cached and uncached outputs, results keep the order of the request
+    db.SetRCTOutputCacheSize(0);
+    db.SetRCTOutputCacheSize(1 << 20);
+    CAnonOutput ao;
+    BOOST_CHECK(db.ReadRCTOutput(7, ao));
+    std::vector<int64_t> vIndices{12, 7, 1, 20};
+    std::vector<CAnonOutput> vao;
+    BOOST_CHECK(db.ReadRCTOutputs(vIndices, vao));
+    BOOST_CHECK_EQUAL(vao.size(), vIndices.size());
+    for (size_t k = 0; k < vIndices.size(); ++k) {
+        BOOST_CHECK_EQUAL(vao[k].nBlockHeight, vIndices[k]);
+    }
+    BOOST_CHECK_EQUAL(db.RCTOutputCacheCount(), 4U);
+
+    vIndices.push_back(21);
+    BOOST_CHECK(!db.ReadRCTOutputs(vIndices, vao));
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_output_range)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    for (int64_t i = 1; i <= 300; ++i) {
+        BOOST_CHECK(db.WriteRCTOutput(i, MakeAnonOutput(i)));
+    }
+    db.SetRCTOutputCacheSize(0);
+
+    std::vector<CAnonOutput> vao;
+    BOOST_CHECK(db.ReadRCTOutputRange(250, 20, vao));
+    BOOST_CHECK_EQUAL(vao.size(), 20U);
+    for (size_t k = 0; k < vao.size(); ++k) {
+        BOOST_CHECK_EQUAL(vao[k].nBlockHeight, 250 + (int)k);
+    }
+
+    // Stops at the last output and at gaps
+    BOOST_CHECK(db.ReadRCTOutputRange(290, 20, vao));
+    BOOST_CHECK_EQUAL(vao.size(), 11U);
+    BOOST_CHECK(db.EraseRCTOutput(105));
+    BOOST_CHECK(db.ReadRCTOutputRange(100, 20, vao));
+    BOOST_CHECK_EQUAL(vao.size(), 5U);
+    BOOST_CHECK(db.ReadRCTOutputRange(301, 20, vao));
+    BOOST_CHECK(vao.empty());
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_output_height)
+{
+    // Blocks 0 and 3 add no anon outputs
+    const int64_t last_index[] = {0, 2, 5, 5, 6, 10};
+    std::vector<CBlockIndex> blocks(6);
+    for (size_t h = 0; h < blocks.size(); ++h) {
+        blocks[h].nHeight = h;
+        blocks[h].nAnonOutputs = last_index[h];
+        blocks[h].pprev = h > 0 ? &blocks[h-1] : nullptr;
+    }
+    CChain chain;
+    BOOST_CHECK_EQUAL(GetAnonOutputHeight(chain, 1), -1);
+    chain.SetTip(&blocks.back());
+
+    const int expect_height[] = {-1, 1, 1, 2, 2, 2, 4, 5, 5, 5, 5, -1};
+    for (int64_t i = 0; i <= 11; ++i) {
+        BOOST_CHECK_EQUAL(GetAnonOutputHeight(chain, i), expect_height[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_keyimage_heights)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+
+    CDBBatch batch(db);
+    for (int64_t i = 1; i <= 10; ++i) {
+        db.WriteRCTKeyImage(batch, MakeAnonOutput(i).pubkey, CAnonKeyImageInfo(uint256S("0x02"), (int)i));
+    }
+    BOOST_CHECK(db.WriteBatch(batch));
+
+    size_t num_erased = 0;
+    BOOST_CHECK(db.EraseRCTKeyImagesAfterHeight(7, &num_erased));
+    BOOST_CHECK_EQUAL(num_erased, 3U);
+
+    // An erased key image no longer shows up in later range deletes
+    BOOST_CHECK(db.EraseRCTKeyImage(MakeAnonOutput(5).pubkey));
+    BOOST_CHECK(db.EraseRCTKeyImagesAfterHeight(3, &num_erased));
+    BOOST_CHECK_EQUAL(num_erased, 3U);
+
+    CAnonKeyImageInfo ki_data;
+    for (int64_t i = 1; i <= 10; ++i) {
+        BOOST_CHECK(db.ReadRCTKeyImage(MakeAnonOutput(i).pubkey, ki_data) == (i <= 3));
+    }
+
+    // Key images written without the secondary key are indexed by the upgrade
+    batch.Clear();
+    for (int64_t i = 20; i <= 25; ++i) {
+        batch.Write(std::make_pair(DB_RCTKEYIMAGE, MakeAnonOutput(i).pubkey), CAnonKeyImageInfo(uint256S("0x02"), (int)i));
+    }
+    BOOST_CHECK(db.WriteBatch(batch));
+    BOOST_CHECK(db.UpgradeRCTKeyImageHeights());
+    BOOST_CHECK(db.EraseRCTKeyImagesAfterHeight(22, &num_erased));
+    BOOST_CHECK_EQUAL(num_erased, 3U);
+    BOOST_CHECK(db.ReadRCTKeyImage(MakeAnonOutput(22).pubkey, ki_data));
+    BOOST_CHECK(!db.ReadRCTKeyImage(MakeAnonOutput(23).pubkey, ki_data));
+}
+
+BOOST_AUTO_TEST_CASE(rctindex_spent_cache_heights)
+{
+    CBlockTreeDB db(1 << 20, true, true);
+    const Coin coin(CTxOut(COIN, CScript() << OP_TRUE), 1, false);
+    const int num_heights = SPENT_CACHE_FRONT_HEIGHTS * 2;
+
+    CDBBatch batch(db);
+    for (int h = 1; h <= num_heights; ++h) {
+        db.WriteSpentCache(batch, COutPoint(uint256S("0x03"), h), SpentCoin(coin, h));
+    }
+    BOOST_CHECK(db.WriteBatch(batch));
+
+    // Heights dropped from the front cache are read from the database
+    SpentCoin spent_coin;
+    for (int h = 1; h <= num_heights; ++h) {
+        BOOST_CHECK(db.ReadSpentCache(COutPoint(uint256S("0x03"), h), spent_coin));
+        BOOST_CHECK_EQUAL(spent_coin.spent_height, (uint32_t)h);
+    }
+
+    batch.Clear();
+    db.PruneSpentCache(batch, num_heights - 10);
+    db.EraseSpentCache(batch, COutPoint(uint256S("0x03"), num_heights), SpentCoin(coin, num_heights));
+    BOOST_CHECK(db.WriteBatch(batch));
+    for (int h = 1; h <= num_heights; ++h) {
+        BOOST_CHECK(db.ReadSpentCache(COutPoint(uint256S("0x03"), h), spent_coin) == (h > num_heights - 10 && h < num_heights));
+    }
+
+    // Entries written without the height key are indexed by the upgrade
+    batch.Clear();
+    for (int h = 1; h <= 5; ++h) {
+        batch.Write(std::make_pair(DB_SPENTCACHE, COutPoint(uint256S("0x04"), h)), SpentCoin(coin, h));
+    }
+    BOOST_CHECK(db.WriteBatch(batch));
+    BOOST_CHECK(db.UpgradeSpentCacheHeights());
+    batch.Clear();
+    db.PruneSpentCache(batch, 5);
+    BOOST_CHECK(db.WriteBatch(batch));
+    for (int h = 1; h <= 5; ++h) {
+        BOOST_CHECK(!db.ReadSpentCache(COutPoint(uint256S("0x04"), h), spent_coin));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
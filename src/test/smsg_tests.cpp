@@ -2,11 +2,15 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include <smsg/db.h>
 #include <smsg/smessage.h>
 
 #include <test/util/setup_common.h>
 #include <net.h>
 #include <xxhash/xxhash.h>
+#include <crypto/hmac_sha256.h>
+#include <crypto/sha512.h>
+#include <random.h>
 #ifdef ENABLE_WALLET
 #include <wallet/hdwallet.h>
 #endif
@@ -39,8 +43,829 @@ BOOST_AUTO_TEST_CASE(smsg_test_ckeyId_inits_null)
     BOOST_CHECK(k.IsNull());
 }
 
+BOOST_AUTO_TEST_CASE(smsg_test_bucket_hash)
+{
+    SeedInsecureRand();
+    int64_t now = GetAdjustedTime();
+
+    std::vector<smsg::SecMsgToken> tokens;
+    for (size_t i = 0; i < 20; ++i) {
+        std::vector<uint8_t> sample = g_insecure_rand_ctx.randbytes(8);
+        uint32_t ttl = i < 5 ? 10 : 1000;
+        tokens.emplace_back(now - (int64_t)i, sample.data(), 8, 0, ttl);
+    }
+
+    // The same tokens added in a different order give the same wire hash as a full rehash
+    smsg::SecMsgBucket bucket_a, bucket_b;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        BOOST_CHECK(bucket_a.AddToken(tokens[i]));
+        BOOST_CHECK(bucket_b.AddToken(tokens[tokens.size() - 1 - i]));
+    }
+    BOOST_CHECK(!bucket_a.AddToken(tokens[0]));
+    BOOST_CHECK_EQUAL(bucket_a.nActive, 20U);
+    BOOST_CHECK_EQUAL(bucket_a.nLeastTTL, 10U);
+
+    XXH32_state_t *state = XXH32_createState();
+    XXH32_reset(state, 1);
+    for (const auto &token : bucket_a.vTokens) {
+        XXH32_update(state, token.sample, 8);
+    }
+    uint32_t hash_full = XXH32_digest(state);
+    BOOST_CHECK_EQUAL(bucket_a.GetHash(), hash_full);
+    BOOST_CHECK_EQUAL(bucket_b.GetHash(), hash_full);
+
+    // Tokens of a received chunk merged at once, duplicates within the chunk and with the bucket are dropped
+    smsg::SecMsgBucket bucket_c;
+    std::vector<smsg::SecMsgToken> chunk(tokens.begin(), tokens.begin() + 8);
+    bucket_c.AddTokens(chunk);
+    chunk.assign(tokens.begin() + 4, tokens.end());
+    chunk.push_back(tokens[12]);
+    bucket_c.AddTokens(chunk);
+    BOOST_CHECK_EQUAL(bucket_c.vTokens.size(), 20U);
+    BOOST_CHECK(std::is_sorted(bucket_c.vTokens.begin(), bucket_c.vTokens.end()));
+    BOOST_CHECK_EQUAL(bucket_c.nActive, 20U);
+    BOOST_CHECK_EQUAL(bucket_c.GetHash(), hash_full);
+
+    // Expiry and purge update the active tokens without a rehash
+    bucket_a.ExpireTokens(now + 11);
+    BOOST_CHECK_EQUAL(bucket_a.nActive, 15U);
+    bucket_a.PurgeToken(bucket_a.FindToken(tokens[10]));
+    BOOST_CHECK_EQUAL(bucket_a.nActive, 14U);
+
+    XXH32_reset(state, 1);
+    for (const auto &token : bucket_a.vTokens) {
+        if (token.timestamp + token.ttl >= now + 11) {
+            XXH32_update(state, token.sample, 8);
+        }
+    }
+    hash_full = XXH32_digest(state);
+    XXH32_freeState(state);
+    BOOST_CHECK_EQUAL(bucket_a.GetHash(), hash_full);
+    BOOST_CHECK(bucket_a.GetHash() != bucket_b.GetHash());
+
+    bucket_a.ExpireTokens(now + 2000);
+    BOOST_CHECK_EQUAL(bucket_a.nActive, 0U);
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_bucket_set)
+{
+    const int64_t len = smsg::SMSG_BUCKET_LEN;
+    const int64_t base = 1000 * len;
+    smsg::SecMsgBucketSet buckets;
+    BOOST_CHECK(buckets.begin() == buckets.end());
+    BOOST_CHECK(buckets.find(base) == buckets.end());
+
+    // Out of order inserts grow the ring at both ends
+    std::vector<int64_t> times{base, base + 2 * len, base - 3 * len, base + 100 * len, base - 50 * len};
+    for (size_t i = 0; i < times.size(); ++i) {
+        buckets[times[i]].nActive = i + 1;
+    }
+    BOOST_CHECK_EQUAL(buckets.size(), times.size());
+    BOOST_CHECK(buckets.find(base + len) == buckets.end());
+    BOOST_CHECK(buckets.find(base + 1) == buckets.end());
+    BOOST_CHECK(buckets.find(base + 200 * len) == buckets.end());
+    BOOST_CHECK_EQUAL(buckets.find(base + 2 * len)->second.nActive, 2U);
+    BOOST_CHECK_EQUAL(buckets[base - 3 * len].nActive, 3U);
+    BOOST_CHECK_EQUAL(buckets.size(), times.size());
+
+    std::vector<int64_t> sorted_times = times;
+    std::sort(sorted_times.begin(), sorted_times.end());
+    std::vector<int64_t> iterated;
+    for (const auto &it : buckets) {
+        iterated.push_back(it.first);
+    }
+    BOOST_CHECK(iterated == sorted_times);
+
+    // Erasing the oldest bucket drops its slots, iteration continues from the next bucket
+    auto it = buckets.erase(buckets.begin());
+    BOOST_CHECK(it != buckets.end() && it->first == base - 3 * len);
+    it = buckets.erase(buckets.find(base + 2 * len));
+    BOOST_CHECK(it != buckets.end() && it->first == base + 100 * len);
+    it = buckets.erase(it);
+    BOOST_CHECK(it == buckets.end());
+    BOOST_CHECK_EQUAL(buckets.size(), 2U);
+    BOOST_CHECK(buckets.find(base - 50 * len) == buckets.end());
+    BOOST_CHECK_EQUAL(buckets.find(base)->second.nActive, 1U);
+
+    smsg::SecMsgToken token(base, nullptr, 0, 0, 100);
+    buckets[base].AddToken(token);
+    size_t usage = buckets.DynamicMemoryUsage();
+    BOOST_CHECK(usage > 0);
+    for (int64_t i = 0; i < 1000; ++i) {
+        buckets[base + i * len];
+    }
+    BOOST_CHECK_EQUAL(buckets.size(), 1001U);
+    BOOST_CHECK(buckets.DynamicMemoryUsage() > usage);
+    BOOST_CHECK(buckets.find(base)->second.FindToken(token) != buckets.find(base)->second.vTokens.end());
+
+    buckets.clear();
+    BOOST_CHECK(buckets.empty());
+    BOOST_CHECK(buckets.begin() == buckets.end());
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_peer_buckets)
+{
+    const int64_t len = smsg::SMSG_BUCKET_LEN;
+    const int64_t base = 1000 * len;
+    PeerBuckets buckets;
+    BOOST_CHECK_EQUAL(buckets.NumPending(), 0U);
+    BOOST_CHECK_EQUAL(buckets.DynamicMemoryUsage(), 0U);
+
+    buckets.SetPending(base + 2 * len, 5, 7);
+    buckets.SetPending(base, 1, 2);
+    buckets.SetPending(base, 3, 4);
+    BOOST_CHECK_EQUAL(buckets.NumPending(), 2U);
+    auto pending = buckets.GetPending();
+    BOOST_REQUIRE_EQUAL(pending.size(), 2U);
+    BOOST_CHECK_EQUAL(pending[0].first, base);
+    BOOST_CHECK_EQUAL(pending[0].second.m_active, 3U);
+    BOOST_CHECK_EQUAL(pending[1].first, base + 2 * len);
+
+    // Announced again after the snapshot, the bucket stays
+    buckets.SetPending(base, 6, 8);
+    buckets.ErasePending(pending[0].first, pending[0].second);
+    buckets.ErasePending(pending[1].first, pending[1].second);
+    BOOST_CHECK_EQUAL(buckets.NumPending(), 1U);
+    BOOST_CHECK_EQUAL(buckets.GetPending()[0].second.m_hash, 8U);
+
+    // A bucket a full window later takes over the slot
+    const int64_t later = base + (int64_t)SmsgPeerBucketSlots() * len;
+    buckets.SetLastShown(base, 100);
+    BOOST_CHECK_EQUAL(buckets.GetLastShown(base), 100);
+    buckets.SetLastShown(later, 200);
+    BOOST_CHECK_EQUAL(buckets.GetLastShown(base), 0);
+    BOOST_CHECK_EQUAL(buckets.GetLastShown(later), 200);
+    BOOST_CHECK_EQUAL(buckets.NumPending(), 0U);
+    BOOST_CHECK_EQUAL(buckets.NumShown(), 1U);
+
+    buckets.SetLastShown(base + len, 300);
+    buckets.ExpireShown(later);
+    BOOST_CHECK_EQUAL(buckets.NumShown(), 1U);
+    BOOST_CHECK(buckets.GetShown()[0] == std::make_pair(later, (int64_t)200));
+    BOOST_CHECK(buckets.DynamicMemoryUsage() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_upload_budget)
+{
+    SmsgUploadBudget budget;
+    int64_t now = 1000000;
+    BOOST_CHECK(budget.Consume(1 << 30, now)); // Unlimited
+
+    // 1000 bytes per second, 5000 at once
+    budget.SetRate(1000, 5000);
+    BOOST_CHECK(budget.Consume(3000, now));
+    BOOST_CHECK(budget.Available(2000, now));
+    BOOST_CHECK(!budget.Available(2001, now));
+    BOOST_CHECK(!budget.Consume(2001, now));
+    BOOST_CHECK(budget.Consume(2000, now));
+    BOOST_CHECK(!budget.Consume(1, now));
+
+    now += 1500000;
+    BOOST_CHECK(budget.Consume(1500, now));
+    budget.Refund(500);
+    BOOST_CHECK(budget.Consume(500, now));
+    BOOST_CHECK(!budget.Consume(1, now));
+
+    // Refilled no further than the burst, which lets a larger send through
+    now += 60 * 1000000;
+    BOOST_CHECK(budget.Available(5000, now));
+    BOOST_CHECK(budget.Consume(8000, now));
+    BOOST_CHECK(!budget.Consume(1, now + 2000000));
+}
+
+/** Header and random payload with a valid MAC for pk_to, enough for the receive key scan which never decrypts the payload */
+static void MakeScanTestMessage(smsg::SecureMessage &smsg, std::vector<uint8_t> &payload, const CPubKey &pk_to, size_t payload_len = 1024, bool with_hint = false)
+{
+    smsg.timestamp = GetTime();
+    smsg.m_ttl = smsg::SMSG_MIN_TTL;
+    GetRandBytes(smsg.iv, 16);
+    payload = g_insecure_rand_ctx.randbytes(payload_len);
+    smsg.nPayload = payload.size();
+
+    CKey key_r;
+    InsecureNewKey(key_r, true);
+    memcpy(smsg.cpkR, key_r.GetPubKey().begin(), 33);
+    uint256 P = key_r.ECDH(pk_to);
+    if (with_hint) {
+        smsg.flags |= SMSG_FLAG_RECIPIENT_HINT;
+        smsg::GetRecipientHint(P, payload.data());
+    }
+
+    uint8_t hashed[64];
+    CSHA512().Write(P.begin(), 32).Finalize(hashed);
+    CHMAC_SHA256 ctx(&hashed[32], 32);
+    int64_t timestamp_le = htole64(smsg.timestamp);
+    ctx.Write((uint8_t*)&timestamp_le, 8);
+    ctx.Write(smsg.iv, 16);
+    ctx.Write(payload.data(), payload.size());
+    ctx.Finalize(smsg.mac);
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_scan_threads)
+{
+    SeedInsecureRand();
+    gArgs.ForceSetArg("-smsgscanthreads", "3");
+    g_task_pool.Start(4);
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+    BOOST_CHECK_EQUAL(smsgModule.m_num_scan_threads, 2);
+    BOOST_CHECK(smsgModule.m_housekeeping_task != 0);
+
+    const size_t num_keys = 40, key_to = 27;
+    std::vector<smsg::SecMsgScanKey> scan_keys;
+    for (size_t i = 0; i < num_keys; ++i) {
+        CKey key;
+        InsecureNewKey(key, true);
+        scan_keys.emplace_back(key.GetPubKey().GetID(), key, true);
+    }
+    BOOST_CHECK(0 == smsgModule.ImportPrivkey(CBitcoinSecret(scan_keys[key_to].key), ""));
+
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeScanTestMessage(smsg, payload, scan_keys[key_to].key.GetPubKey());
+    unsigned char header[smsg::SMSG_HDR_LEN];
+    smsg.WriteHeader(header);
+
+    // Keys are split across the task pool, the matching index is found from any start before it
+    BOOST_CHECK_EQUAL(smsgModule.FindScanKey(scan_keys, 0, header, payload.data(), payload.size()), key_to);
+    BOOST_CHECK_EQUAL(smsgModule.FindScanKey(scan_keys, key_to, header, payload.data(), payload.size()), key_to);
+    BOOST_CHECK_EQUAL(smsgModule.FindScanKey(scan_keys, key_to + 1, header, payload.data(), payload.size()), num_keys);
+
+    bool own_message = false;
+    BOOST_CHECK(0 == smsgModule.ScanMessage(header, payload.data(), payload.size(), false, own_message));
+    BOOST_CHECK(own_message);
+
+    smsgModule.Shutdown();
+    BOOST_CHECK_EQUAL(g_task_pool.GetStats().periodic, 0U);
+    g_task_pool.Stop();
+    gArgs.ForceSetArg("-smsgscanthreads", "0");
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_pow_threads)
+{
+    SeedInsecureRand();
+    gArgs.ForceSetArg("-smsgpowthreads", "3");
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+    BOOST_CHECK_EQUAL(smsgModule.m_num_pow_threads, 2);
+
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+    for (size_t i = 0; i < 4; ++i) {
+        smsg::SecureMessage smsg;
+        std::vector<uint8_t> payload;
+        MakeScanTestMessage(smsg, payload, key_to.GetPubKey());
+
+        // The nonce space is split across three slices, any of them can find the result
+        BOOST_CHECK(0 == smsgModule.SetHash(&smsg, payload.data(), payload.size()));
+        BOOST_CHECK(0 == smsgModule.Validate(&smsg, payload.data(), payload.size()));
+    }
+    BOOST_CHECK(smsgModule.m_pow_hashes > 0);
+
+    smsgModule.Shutdown();
+    gArgs.ForceSetArg("-smsgpowthreads", "1");
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_bucket_index)
+{
+    SeedInsecureRand();
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+    int64_t bucket_time = GetTime() - (GetTime() % smsg::SMSG_BUCKET_LEN);
+    unsigned char header[smsg::SMSG_HDR_LEN];
+    {
+        LOCK(smsgModule.cs_smsg);
+        for (size_t i = 0; i < 3; ++i) {
+            smsg::SecureMessage smsg;
+            std::vector<uint8_t> payload;
+            MakeScanTestMessage(smsg, payload, key_to.GetPubKey());
+            smsg.timestamp = bucket_time + i;
+            smsg.WriteHeader(header);
+            BOOST_CHECK(0 == smsgModule.Store(header, payload.data(), payload.size()));
+        }
+    }
+    uint32_t hash_stored = smsgModule.buckets[bucket_time].GetHash();
+    smsgModule.Shutdown();
+
+    // Buckets are restored from the index written at shutdown
+    smsgModule.buckets.clear();
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+    {
+        LOCK2(smsgModule.cs_smsg, smsg::cs_smsgDB);
+        BOOST_CHECK_EQUAL(smsgModule.buckets[bucket_time].vTokens.size(), 3U);
+        BOOST_CHECK_EQUAL(smsgModule.buckets[bucket_time].GetHash(), hash_stored);
+
+        // The index is consumed when loaded
+        smsg::SecMsgDB db;
+        std::vector<uint8_t> vIndex;
+        BOOST_CHECK(db.Open("cr+"));
+        BOOST_CHECK(!db.ReadBucketIndex(vIndex));
+    }
+    smsgModule.Shutdown();
+
+    // A message appended after the index was written forces a scan of the file
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeScanTestMessage(smsg, payload, key_to.GetPubKey());
+    smsg.timestamp = bucket_time;
+    smsg.WriteHeader(header);
+    fs::path path = GetDataDir() / smsg::STORE_DIR / (ToString(bucket_time) + "_01.dat");
+    FILE *fp = fopen(path.string().c_str(), "ab");
+    BOOST_REQUIRE(fp);
+    BOOST_CHECK(fwrite(header, 1, smsg::SMSG_HDR_LEN, fp) == (size_t)smsg::SMSG_HDR_LEN);
+    BOOST_CHECK(fwrite(payload.data(), 1, payload.size(), fp) == payload.size());
+    fclose(fp);
+
+    smsgModule.buckets.clear();
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+    {
+        LOCK(smsgModule.cs_smsg);
+        BOOST_CHECK_EQUAL(smsgModule.buckets[bucket_time].vTokens.size(), 4U);
+        BOOST_CHECK(smsgModule.buckets[bucket_time].GetHash() != hash_stored);
+    }
+    smsgModule.Shutdown();
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_inventory_batch)
+{
+    SeedInsecureRand();
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    smsgModule.buckets.clear();
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+    int64_t bucket_time = GetTime() - (GetTime() % smsg::SMSG_BUCKET_LEN);
+    {
+        LOCK(smsgModule.cs_smsg);
+        unsigned char header[smsg::SMSG_HDR_LEN];
+        for (size_t i = 0; i < 3; ++i) {
+            smsg::SecureMessage smsg;
+            std::vector<uint8_t> payload;
+            MakeScanTestMessage(smsg, payload, key_to.GetPubKey());
+            smsg.timestamp = bucket_time + i;
+            smsg.WriteHeader(header);
+            BOOST_CHECK(0 == smsgModule.Store(header, payload.data(), payload.size()));
+        }
+
+        std::vector<uint8_t> vchHave;
+        BOOST_CHECK(!smsgModule.ListBucketTokens(bucket_time + smsg::SMSG_BUCKET_LEN, 0, vchHave));
+        BOOST_CHECK(smsgModule.ListBucketTokens(bucket_time, 0, vchHave));
+        BOOST_REQUIRE_EQUAL(vchHave.size(), 8U + 3 * 16);
+
+        // Nothing is wanted from a peer with the same messages
+        std::vector<uint8_t> vchWant;
+        BOOST_CHECK_EQUAL(smsgModule.SiftBucketTokens(bucket_time, &vchHave[8], 3, 100, 1, vchWant), 0U);
+        BOOST_CHECK(vchWant.empty());
+
+        // Messages wanted from one peer are not requested again from another until the request expires
+        std::vector<uint8_t> vchMissing = g_insecure_rand_ctx.randbytes(5 * 16);
+        for (size_t i = 0; i < 5; ++i) {
+            memcpy(&vchMissing[i * 16], &vchHave[8], 8);
+        }
+        BOOST_CHECK_EQUAL(smsgModule.SiftBucketTokens(bucket_time, vchMissing.data(), 5, 2, 1, vchWant), 2U);
+        BOOST_CHECK_EQUAL(smsgModule.SiftBucketTokens(bucket_time, vchMissing.data(), 5, 100, 1, vchWant), 5U);
+        BOOST_CHECK_EQUAL(smsgModule.SiftBucketTokens(bucket_time, vchMissing.data(), 5, 100, 2, vchWant), 0U);
+        BOOST_CHECK_EQUAL(vchWant.size(), 7U * 16);
+        for (auto &it : smsgModule.m_wanted_tokens) {
+            it.second.second = GetTime() - 1;
+        }
+        BOOST_CHECK_EQUAL(smsgModule.SiftBucketTokens(bucket_time, vchMissing.data(), 5, 100, 2, vchWant), 5U);
+        smsgModule.m_wanted_tokens.clear();
+
+        // Unknown messages are skipped when bunching
+        std::vector<uint8_t> vchWanted(vchHave.begin() + 8, vchHave.end());
+        vchWanted.insert(vchWanted.end(), vchMissing.begin(), vchMissing.begin() + 16);
+        std::vector<std::vector<uint8_t> > vBunches;
+        BOOST_CHECK_EQUAL(smsgModule.BunchBucketMessages(bucket_time, vchWanted.data(), 4, 1, vBunches), 3U);
+        BOOST_REQUIRE_EQUAL(vBunches.size(), 1U);
+        BOOST_CHECK_EQUAL(vBunches[0][0], 3);
+        BOOST_CHECK_EQUAL(vBunches[0].size(), 12 + 3 * (smsg::SMSG_HDR_LEN + 1024));
+    }
+    smsgModule.Shutdown();
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_write_in_place)
+{
+    SeedInsecureRand();
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+    smsg::SecureMessage smsg;
+    std::vector<uint8_t> payload;
+    MakeScanTestMessage(smsg, payload, key_to.GetPubKey());
+    std::vector<uint8_t> vchMessage(smsg::SMSG_HDR_LEN);
+    smsg.WriteHeader(vchMessage.data());
+    vchMessage.insert(vchMessage.end(), payload.begin(), payload.end());
+
+    smsg::SecMsgStored stored, stored_in_place, stored_read;
+    stored.timeReceived = GetTime();
+    stored.status = SMSG_MASK_UNREAD;
+    stored.folderId = 0;
+    stored.addrTo = key_to.GetPubKey().GetID();
+    stored_in_place = stored;
+    stored.vchMessage = vchMessage;
+
+    // Both writes produce the same record
+    uint8_t chKey[30] = {0}, chKeyInPlace[30] = {1};
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(db.WriteSmesg(chKey, stored));
+        BOOST_CHECK(db.WriteSmesg(chKeyInPlace, stored_in_place, vchMessage.data(), payload.data(), payload.size()));
+        BOOST_CHECK(db.ReadSmesg(chKeyInPlace, stored_read));
+    }
+    BOOST_CHECK(stored_read.vchMessage == vchMessage);
+    BOOST_CHECK(stored_read.addrTo == stored.addrTo);
+    BOOST_CHECK_EQUAL(stored_read.timeReceived, stored.timeReceived);
+    BOOST_CHECK(stored_in_place.vchMessage.empty());
+
+    smsgModule.Shutdown();
+}
+
+static CTransaction MakeFundingTx(const uint160 &msg_id, uint32_t fee)
+{
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    std::vector<uint8_t> vData(1 + 24);
+    vData[0] = DO_FUND_MSG;
+    memcpy(&vData[1], msg_id.begin(), 20);
+    memcpy(&vData[21], &fee, 4);
+    OUTPUT_PTR<CTxOutData> out_smsg_fees = MAKE_OUTPUT<CTxOutData>();
+    out_smsg_fees->vData = vData;
+    txn.vpout.push_back(out_smsg_fees);
+    return CTransaction(txn);
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_funding_cache)
+{
+    // Not started, the smsg thread would prune the funding data against the genesis-only chain
+    SeedInsecureRand();
+    smsgModule.m_track_funding_txns = true;
+
+    uint256 block_hash = InsecureRand256();
+    CBlockIndex index;
+    index.nHeight = 10;
+    index.nTime = GetAdjustedTime();
+    index.phashBlock = &block_hash;
+
+    uint160 msg_id;
+    GetRandBytes(msg_id.begin(), 20);
+    CTransaction tx = MakeFundingTx(msg_id, 20000);
+    CTransaction tx_discarded = MakeFundingTx(msg_id, 30000);
+
+    // Funding data is cached when the block is committed
+    BOOST_CHECK(0 == smsgModule.StartConnectingBlock());
+    {
+        LOCK(cs_main);
+        BOOST_CHECK(0 == smsgModule.StoreFundingTx(tx, &index));
+    }
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 0U);
+    BOOST_CHECK(0 == smsgModule.SetBestBlock(block_hash, index.nHeight, index.nTime));
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 1U);
+
+    std::vector<uint8_t> data;
+    BOOST_CHECK(0 == smsgModule.GetFundingData(tx.GetHash(), data));
+    BOOST_REQUIRE_EQUAL(data.size(), 32U + 24);
+    BOOST_CHECK(memcmp(data.data(), block_hash.begin(), 32) == 0);
+    BOOST_CHECK(memcmp(&data[32], msg_id.begin(), 20) == 0);
+
+    // A cache miss reads the db and caches the result
+    smsgModule.SetFundingCacheSize(0);
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 0U);
+    smsgModule.SetFundingCacheSize(10);
+    data.clear();
+    BOOST_CHECK(0 == smsgModule.GetFundingData(tx.GetHash(), data));
+    BOOST_CHECK_EQUAL(data.size(), 32U + 24);
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 1U);
+
+    // Data from a block that never committed is neither cached nor stored
+    BOOST_CHECK(0 == smsgModule.StartConnectingBlock());
+    {
+        LOCK(cs_main);
+        BOOST_CHECK(0 == smsgModule.StoreFundingTx(tx_discarded, &index));
+    }
+    BOOST_CHECK(0 == smsgModule.StartConnectingBlock());
+    BOOST_CHECK(smsg::SMSG_FUND_DATA_NOT_FOUND == smsgModule.GetFundingData(tx_discarded.GetHash(), data));
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 1U);
+
+    // The chain tip is older than KEEP_FUNDING_TX_DATA, everything is pruned
+    BOOST_CHECK(0 == smsgModule.PruneFundingTxData());
+    BOOST_CHECK_EQUAL(smsgModule.FundingCacheCount(), 0U);
+    BOOST_CHECK(smsg::SMSG_FUND_DATA_NOT_FOUND == smsgModule.GetFundingData(tx.GetHash(), data));
+
+    smsgModule.m_track_funding_txns = false;
+    smsgModule.SetFundingCacheSize(smsg::SMSG_DEFAULT_FUNDING_CACHE);
+    LOCK(smsg::cs_smsgDB);
+    smsg::CloseDB();
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_scan_chain)
+{
+    std::vector<std::shared_ptr<CWallet> > temp_vpwallets;
+    BOOST_REQUIRE(smsgModule.Start(nullptr, temp_vpwallets, false));
+
+    // Public keys are taken from the witness of txn inputs
+    CKey key;
+    key.MakeNewKey(true);
+    CPubKey pubkey = key.GetPubKey();
+    CMutableTransaction txn;
+    txn.nVersion = GHOST_TXN_VERSION;
+    txn.vin.resize(2);
+    for (auto &txin : txn.vin) {
+        txin.scriptWitness.stack = {std::vector<uint8_t>(72), std::vector<uint8_t>(pubkey.begin(), pubkey.end())};
+    }
+    CBlock block;
+    block.vtx.push_back(MakeTransactionRef(txn));
+    smsgModule.options.fScanIncoming = true;
+    BOOST_CHECK(smsgModule.ScanBlock(block));
+    smsgModule.options.fScanIncoming = false;
+
+    uint256 block_hash;
+    int height;
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        CPubKey pubkey_read;
+        BOOST_CHECK(db.ReadPK(pubkey.GetID(), pubkey_read) && pubkey_read == pubkey);
+    }
+
+    // A completed scan leaves no progress to resume from
+    BOOST_CHECK(smsgModule.ScanBlockChain());
+    BOOST_CHECK(!smsgModule.m_scan_chain_running);
+    BOOST_CHECK_EQUAL(smsgModule.m_scan_chain_height, 0);
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(!db.ReadScanChainProgress(block_hash, height));
+
+        // Progress at the tip is cleared without starting a scan
+        leveldb::WriteBatch batch;
+        BOOST_CHECK(smsg::PutScanChainProgress(&batch, Params().GenesisBlock().GetHash(), 0));
+        BOOST_CHECK(db.CommitBatch(&batch));
+        BOOST_CHECK(db.ReadScanChainProgress(block_hash, height));
+    }
+    BOOST_CHECK(smsgModule.StartScanChain(true));
+    BOOST_CHECK(!smsgModule.m_scan_chain_running);
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(!db.ReadScanChainProgress(block_hash, height));
+    }
+
+    // Background scan from genesis
+    smsgModule.m_scan_chain_height = -1;
+    BOOST_CHECK(smsgModule.StartScanChain());
+    while (smsgModule.m_scan_chain_running) {
+        UninterruptibleSleep(std::chrono::milliseconds{10});
+    }
+    BOOST_CHECK_EQUAL(smsgModule.m_scan_chain_height, 0);
+
+    smsgModule.Shutdown();
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_db_snapshot)
+{
+    CKey key_a, key_b;
+    key_a.MakeNewKey(true);
+    key_b.MakeNewKey(true);
+    CPubKey pubkey_read;
+
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(db.WritePK(key_a.GetPubKey().GetID(), key_a.GetPubKey()));
+    }
+
+    smsg::SecMsgDB db_snapshot;
+    BOOST_REQUIRE(db_snapshot.OpenSnapshot());
+
+    // Writes after the snapshot was taken are not seen through it
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(db.WritePK(key_b.GetPubKey().GetID(), key_b.GetPubKey()));
+        BOOST_CHECK(db.ReadPK(key_b.GetPubKey().GetID(), pubkey_read));
+    }
+    BOOST_CHECK(db_snapshot.ReadPK(key_a.GetPubKey().GetID(), pubkey_read) && pubkey_read == key_a.GetPubKey());
+    BOOST_CHECK(!db_snapshot.ReadPK(key_b.GetPubKey().GetID(), pubkey_read));
+
+    // Closing the db leaves it open for the snapshot reader
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::CloseDB();
+    }
+    smsg::SecMsgDB db_closed;
+    BOOST_CHECK(!db_closed.OpenSnapshot());
+    BOOST_CHECK(db_snapshot.ReadPK(key_a.GetPubKey().GetID(), pubkey_read) && pubkey_read == key_a.GetPubKey());
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_inbox_index)
+{
+    const CKeyID addr_a(uint160(std::vector<uint8_t>(20, 0x0a)));
+    const CKeyID addr_b(uint160(std::vector<uint8_t>(20, 0x0b)));
+
+    LOCK(smsg::cs_smsgDB);
+    smsg::SecMsgDB db;
+    BOOST_REQUIRE(db.Open("cr+"));
+
+    // Messages 0..4, received on a, b, a, b, a, the odd ones read
+    std::vector<std::array<uint8_t, 30> > keys(5);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        uint8_t *chKey = keys[i].data();
+        memcpy(chKey, smsg::DBK_INBOX.data(), 2);
+        memset(chKey + 2, 0, 28);
+        chKey[9] = i + 1;
+        smsg::SecMsgStored smsgStored;
+        smsgStored.addrTo = i % 2 ? addr_b : addr_a;
+        smsgStored.status = i % 2 ? 0 : SMSG_MASK_UNREAD;
+        smsgStored.vchMessage.resize(smsg::SMSG_HDR_LEN);
+        BOOST_CHECK(db.WriteSmesg(chKey, smsgStored));
+    }
+    auto msgid = [&](size_t i) {
+        smsg::SecMsgId id;
+        memcpy(id.data(), keys[i].data() + 2, id.size());
+        return id;
+    };
+
+    std::vector<smsg::SecMsgId> msgids;
+    BOOST_CHECK(db.ListMsgIds(smsg::DBK_INBOX, nullptr, 10, false, msgids));
+    BOOST_REQUIRE(msgids.size() == 5);
+    BOOST_CHECK(msgids[0] == msgid(0) && msgids[4] == msgid(4));
+
+    msgids.clear();
+    std::string prefix_a = smsg::DBK_INBOX_ADDRESS + std::string((const char*)addr_a.begin(), 20);
+    BOOST_CHECK(db.ListMsgIds(prefix_a, nullptr, 10, false, msgids));
+    BOOST_REQUIRE(msgids.size() == 3);
+    BOOST_CHECK(msgids[0] == msgid(0) && msgids[1] == msgid(2) && msgids[2] == msgid(4));
+
+    // Pages continue after the cursor, in either direction
+    msgids.clear();
+    smsg::SecMsgId cursor = msgid(0);
+    BOOST_CHECK(db.ListMsgIds(prefix_a, &cursor, 1, false, msgids));
+    BOOST_REQUIRE(msgids.size() == 1);
+    BOOST_CHECK(msgids[0] == msgid(2));
+    msgids.clear();
+    BOOST_CHECK(db.ListMsgIds(prefix_a, nullptr, 2, true, msgids));
+    BOOST_REQUIRE(msgids.size() == 2);
+    BOOST_CHECK(msgids[0] == msgid(4) && msgids[1] == msgid(2));
+    msgids.clear();
+    cursor = msgid(2);
+    BOOST_CHECK(db.ListMsgIds(prefix_a, &cursor, 2, true, msgids));
+    BOOST_REQUIRE(msgids.size() == 1);
+    BOOST_CHECK(msgids[0] == msgid(0));
+
+    // Marking read and erasing drop the message from the unread index
+    smsg::SecMsgStored smsgStored;
+    BOOST_REQUIRE(db.ReadSmesg(keys[0].data(), smsgStored));
+    smsgStored.status &= ~SMSG_MASK_UNREAD;
+    BOOST_CHECK(db.WriteSmesg(keys[0].data(), smsgStored));
+    BOOST_CHECK(db.EraseSmesg(keys[4].data()));
+    msgids.clear();
+    BOOST_CHECK(db.ListMsgIds(smsg::DBK_INBOX_UNREAD, nullptr, 10, false, msgids));
+    BOOST_REQUIRE(msgids.size() == 1);
+    BOOST_CHECK(msgids[0] == msgid(2));
+    msgids.clear();
+    BOOST_CHECK(db.ListMsgIds(prefix_a, nullptr, 10, false, msgids));
+    BOOST_CHECK(msgids.size() == 2);
+
+    for (size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK(db.EraseSmesg(keys[i].data()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_erase_before)
+{
+    LOCK(smsg::cs_smsgDB);
+    smsg::SecMsgDB db;
+    BOOST_REQUIRE(db.Open("cr+"));
+
+    // Purged markers of messages at times 100..104
+    std::vector<std::array<uint8_t, 30> > keys(5);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        uint8_t *chKey = keys[i].data();
+        memcpy(chKey, smsg::DBK_PURGED_TOKEN.data(), 2);
+        int64_t timestamp_be = (int64_t)htobe64(100 + i);
+        memcpy(chKey + 2, &timestamp_be, 8);
+        memset(chKey + 10, 0xff, 20);
+        BOOST_CHECK(db.WritePurged(chKey, smsg::SecMsgPurged(100 + i, 200)));
+    }
+
+    size_t erased;
+    BOOST_CHECK(db.EraseBefore(smsg::DBK_PURGED_TOKEN, 103, erased));
+    BOOST_CHECK_EQUAL(erased, 3U);
+    db.CompactBefore(smsg::DBK_PURGED_TOKEN, 103);
+
+    smsg::SecMsgPurged purged;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        BOOST_CHECK(db.ReadPurged(keys[i].data(), purged) == (i >= 3));
+    }
+    BOOST_CHECK(db.EraseBefore(smsg::DBK_PURGED_TOKEN, 103, erased));
+    BOOST_CHECK_EQUAL(erased, 0U);
+
+    BOOST_CHECK(db.EraseBefore(smsg::DBK_PURGED_TOKEN, 105, erased));
+    BOOST_CHECK_EQUAL(erased, 2U);
+}
+
+BOOST_AUTO_TEST_CASE(smsg_test_recipient_hint)
+{
+    SeedInsecureRand();
+
+    const size_t num_keys = 100;
+    std::vector<CKey> keys(num_keys);
+    for (auto &key : keys) {
+        InsecureNewKey(key, true);
+    }
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+
+    smsg::MessageData msg;
+    int64_t cost_per_key[2];
+    for (bool with_hint : {false, true}) {
+        smsg::SecureMessage smsg;
+        std::vector<uint8_t> payload;
+        MakeScanTestMessage(smsg, payload, key_to.GetPubKey(), smsg::SMSG_MAX_MSG_WORST, with_hint);
+        unsigned char header[smsg::SMSG_HDR_LEN];
+        smsg.WriteHeader(header);
+
+        int64_t time_start = GetTimeMicros();
+        for (const auto &key : keys) {
+            BOOST_CHECK(smsg::SMSG_MAC_MISMATCH == smsgModule.Decrypt(true, key, key.GetPubKey().GetID(), header, payload.data(), payload.size(), msg));
+        }
+        cost_per_key[with_hint] = (GetTimeMicros() - time_start) / (int64_t)num_keys;
+        BOOST_CHECK(0 == smsgModule.Decrypt(true, key_to, key_to.GetPubKey().GetID(), header, payload.data(), payload.size(), msg));
+
+        // A corrupted hint rejects the message for its recipient too
+        if (with_hint) {
+            payload[0] ^= 1;
+            BOOST_CHECK(smsg::SMSG_MAC_MISMATCH == smsgModule.Decrypt(true, key_to, key_to.GetPubKey().GetID(), header, payload.data(), payload.size(), msg));
+        }
+    }
+    BOOST_TEST_MESSAGE(strprintf("Scan cost per key, %d byte payload: %d us without hint, %d us with hint.",
+        smsg::SMSG_MAX_MSG_WORST, cost_per_key[0], cost_per_key[1]));
+}
+
 #ifdef ENABLE_WALLET
 
+BOOST_AUTO_TEST_CASE(smsg_test_dictionary)
+{
+    CKey key_to;
+    InsecureNewKey(key_to, true);
+    const CKeyID id_to = key_to.GetPubKey().GetID();
+    {
+        LOCK(smsg::cs_smsgDB);
+        smsg::SecMsgDB db;
+        BOOST_REQUIRE(db.Open("cr+"));
+        BOOST_CHECK(db.WritePK(id_to, key_to.GetPubKey()));
+    }
+
+    std::string listing = "{\"category\":\"electronics\",\"shipping\":{\"domestic\":\"free\",\"international\":\"5.00\"},\"title\":\"";
+    const std::vector<uint8_t> dictionary(listing.begin(), listing.end());
+    listing += "Phone\",\"description\":\"Unlocked, boxed with charger and case, ships within two days\"}";
+    BOOST_REQUIRE(listing.size() > 128);
+
+    uint32_t dictionary_id;
+    BOOST_REQUIRE(smsgModule.AddDictionary(dictionary, false, &dictionary_id));
+
+    // Compressed without the dictionary until it is set to send with
+    CKeyID id_anon;
+    smsg::MessageData msg;
+    smsg::SecureMessage smsg_plain;
+    BOOST_CHECK(0 == smsgModule.Encrypt(smsg_plain, id_anon, id_to, listing));
+    BOOST_CHECK(!smsg_plain.IsDictCompressed());
+
+    BOOST_REQUIRE(smsgModule.AddDictionary(dictionary, true));
+    BOOST_CHECK(smsgModule.SendDictionary() == dictionary_id);
+    smsg::SecureMessage smsg_dict;
+    BOOST_CHECK(0 == smsgModule.Encrypt(smsg_dict, id_anon, id_to, listing));
+    BOOST_CHECK(smsg_dict.IsDictCompressed());
+    BOOST_CHECK(smsg_dict.nPayload < smsg_plain.nPayload);
+
+    BOOST_CHECK(0 == smsgModule.Decrypt(false, key_to, id_to, smsg_dict, msg));
+    BOOST_CHECK(std::string((const char*)msg.vchMessage.data()) == listing);
+
+    // Short messages are sent uncompressed, with the version older nodes read
+    smsg::SecureMessage smsg_short;
+    BOOST_CHECK(0 == smsgModule.Encrypt(smsg_short, id_anon, id_to, "short"));
+    BOOST_CHECK(!smsg_short.IsDictCompressed());
+
+    // Without the dictionary the message can't be read
+    BOOST_CHECK(smsgModule.LoadDictionaries());
+    BOOST_CHECK(smsgModule.ListDictionaries().empty());
+    BOOST_CHECK(smsg::SMSG_UNKNOWN_DICTIONARY == smsgModule.Decrypt(false, key_to, id_to, smsg_dict, msg));
+}
+
 void CheckValid(smsg::SecureMessage &smsg, CKeyID &kFrom, CKeyID &kTo, bool expect_pass)
 {
     int rv = 0;
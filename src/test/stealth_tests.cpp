@@ -218,6 +218,14 @@ BOOST_AUTO_TEST_CASE(stealth_key)
         BOOST_CHECK(pkSendTo == pkSendTo_verify);
         BOOST_CHECK(secretShared == secretShared_verify);
 
+        // Pre-parsed points must give the same result
+        secp256k1_pubkey ephem_point, spend_point;
+        BOOST_CHECK(StealthParsePoint(ephem_pubkey, ephem_point));
+        BOOST_CHECK(StealthParsePoint(sxAddr.spend_pubkey, spend_point));
+        BOOST_CHECK(StealthSecret(sxAddr.scan_secret, ephem_point, spend_point, secretShared_verify, pkSendTo_verify) == 0);
+        BOOST_CHECK(pkSendTo == pkSendTo_verify);
+        BOOST_CHECK(secretShared == secretShared_verify);
+
         CKeyID iSpend = sxAddr.GetSpendKeyID();
         CKey kSpend;
         BOOST_CHECK(keystore.GetKey(iSpend, kSpend));
@@ -235,4 +243,49 @@ BOOST_AUTO_TEST_CASE(stealth_key)
     ECC_Stop_Stealth();
 }
 
+BOOST_AUTO_TEST_CASE(stealth_batch)
+{
+    SeedInsecureRand();
+    FillableSigningProvider keystore;
+
+    ECC_Start_Stealth();
+
+    CStealthAddress sxOwned, sxOther;
+    makeNewStealthKey(sxOwned, keystore);
+    makeNewStealthKey(sxOther, keystore);
+    CStealthAddressPoints owned(sxOwned), other(sxOther);
+    BOOST_REQUIRE(owned.IsValid() && other.IsValid());
+
+    // Enough outputs to be split across threads, every third pays the owned address
+    std::vector<CStealthAddressPoints> addrs;
+    for (size_t i = 0; i < MIN_THREADED_STEALTH_OUTPUTS * 2; ++i) {
+        addrs.push_back(i % 3 == 0 ? owned : other);
+    }
+    std::vector<CStealthSendResult> results;
+    std::string sError;
+    BOOST_REQUIRE(MakeStealthOutputs(addrs, results, 4, sError) == 0);
+    BOOST_REQUIRE(results.size() == addrs.size());
+
+    std::vector<ec_point> ephem_pubkeys;
+    std::vector<CKeyID> output_ids;
+    for (const auto &r : results) {
+        ec_point ephem_pubkey;
+        SecretToPublicKey(r.sEphem, ephem_pubkey);
+        ephem_pubkeys.push_back(ephem_pubkey);
+        output_ids.push_back(CPubKey(r.pkSendTo).GetID());
+    }
+
+    std::vector<uint8_t> vMatch;
+    std::vector<CKey> vShared;
+    BOOST_CHECK(FindStealthOutputs(owned, sxOwned.scan_secret, ephem_pubkeys, output_ids, vMatch, vShared, 4) == 0);
+    for (size_t i = 0; i < results.size(); ++i) {
+        BOOST_CHECK_EQUAL(vMatch[i] != 0, i % 3 == 0);
+        if (vMatch[i]) {
+            BOOST_CHECK(vShared[i] == results[i].sShared);
+        }
+    }
+
+    ECC_Stop_Stealth();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,13 @@
 #include <sync.h>
 #include <test/util/setup_common.h>
 
+#include <util/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+
 #include <boost/test/unit_test.hpp>
 
 namespace {
@@ -55,4 +62,64 @@ BOOST_AUTO_TEST_CASE(potential_deadlock_detected)
     #endif
 }
 
+BOOST_AUTO_TEST_CASE(lock_profile)
+{
+    const bool prev = g_lock_profiling;
+    RecursiveMutex profiled, other;
+    RegisterLockProfile(&profiled, "profiled");
+    ResetLockProfile();
+    g_lock_profiling = true;
+
+    int line = 0;
+    {
+        LOCK(profiled); line = __LINE__;
+        // Nested locks of a held mutex aren't timed
+        LOCK(profiled);
+        LOCK(other);
+    }
+    {
+        TRY_LOCK(profiled, locked);
+        const bool got = locked;
+        BOOST_CHECK(got);
+    }
+    {
+        // Held by another thread until after the lock below starts waiting
+        std::atomic<bool> holding{false};
+        std::thread t([&] {
+            LOCK(profiled);
+            holding = true;
+            UninterruptibleSleep(std::chrono::milliseconds{50});
+        });
+        while (!holding) std::this_thread::yield();
+        LOCK(profiled);
+        t.join();
+    }
+    g_lock_profiling = false;
+    {
+        LOCK(profiled);
+    }
+
+    std::vector<LockProfileStats> sites;
+    for (const auto& site : GetLockProfile()) {
+        if (site.lock_name == "profiled") sites.push_back(site);
+    }
+    BOOST_REQUIRE_EQUAL(sites.size(), 3U);
+    // Ordered by wait, the contended lock comes first
+    BOOST_CHECK_EQUAL(sites[0].acquisitions, 1U);
+    BOOST_CHECK_EQUAL(sites[0].contended, 1U);
+    BOOST_CHECK(sites[0].wait_us > 0);
+    BOOST_CHECK_EQUAL(std::accumulate(sites[0].wait_histogram.begin(), sites[0].wait_histogram.end(), uint64_t{0}), 1U);
+    for (const auto& site : sites) {
+        BOOST_CHECK_EQUAL(site.acquisitions, 1U);
+        BOOST_CHECK_EQUAL(std::accumulate(site.hold_histogram.begin(), site.hold_histogram.end(), uint64_t{0}), 1U);
+    }
+    BOOST_CHECK(std::any_of(sites.begin(), sites.end(), [&](const LockProfileStats& s) { return s.line == line && s.contended == 0; }));
+
+    ResetLockProfile();
+    for (const auto& site : GetLockProfile()) {
+        BOOST_CHECK(site.lock_name != "profiled");
+    }
+    g_lock_profiling = prev;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
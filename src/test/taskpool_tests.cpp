@@ -0,0 +1,101 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <test/util/setup_common.h>
+#include <util/taskpool.h>
+#include <util/time.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(taskpool_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(taskpool_submit_and_priority)
+{
+    TaskPool pool;
+    BOOST_CHECK(!pool.Submit(TaskPriority::NORMAL, [] {}));
+
+    pool.Start(4);
+    BOOST_CHECK(pool.IsRunning());
+    std::atomic<int> count{0};
+    for (int i = 0; i < 1000; ++i) {
+        BOOST_CHECK(pool.Submit(TaskPriority::NORMAL, [&count] { ++count; }));
+    }
+    for (int i = 0; i < 1000 && count < 1000; ++i) {
+        UninterruptibleSleep(std::chrono::milliseconds{5});
+    }
+    BOOST_CHECK_EQUAL(count, 1000);
+
+    // With one worker busy the queued tasks run highest lane first
+    pool.Start(1);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    pool.Submit(TaskPriority::HIGH, [released] { released.wait(); });
+    UninterruptibleSleep(std::chrono::milliseconds{20});
+    Mutex order_mutex;
+    std::vector<int> order;
+    pool.Submit(TaskPriority::LOW, [&] { LOCK(order_mutex); order.push_back(2); });
+    pool.Submit(TaskPriority::NORMAL, [&] { LOCK(order_mutex); order.push_back(1); });
+    pool.Submit(TaskPriority::HIGH, [&] { LOCK(order_mutex); order.push_back(0); });
+    BOOST_CHECK_EQUAL(pool.GetStats().queued[(int)TaskPriority::LOW], 1U);
+    release.set_value();
+
+    // Stop runs what is queued
+    pool.Stop();
+    BOOST_CHECK(!pool.IsRunning());
+    BOOST_CHECK(order == std::vector<int>({0, 1, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(taskpool_parallel_for)
+{
+    TaskPool pool;
+    std::vector<std::atomic<int>> hits(1000);
+
+    // Inline while stopped
+    pool.ParallelFor(TaskPriority::NORMAL, hits.size(), [&](size_t i) { ++hits[i]; });
+
+    pool.Start(4);
+    pool.ParallelFor(TaskPriority::HIGH, hits.size(), [&](size_t i) { ++hits[i]; });
+    pool.ParallelFor(TaskPriority::LOW, hits.size(), [&](size_t i) { ++hits[i]; }, 1);
+
+    // Nested calls from the workers complete even with every worker busy
+    std::atomic<int> nested{0};
+    pool.ParallelFor(TaskPriority::NORMAL, 8, [&](size_t) {
+        pool.ParallelFor(TaskPriority::NORMAL, 16, [&](size_t) { ++nested; });
+    });
+    BOOST_CHECK_EQUAL(nested, 8 * 16);
+    pool.Stop();
+
+    for (const auto& hit : hits) {
+        BOOST_CHECK_EQUAL(hit, 3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(taskpool_periodic)
+{
+    TaskPool pool;
+    BOOST_CHECK_EQUAL(pool.AddPeriodic(TaskPriority::LOW, std::chrono::milliseconds{1}, [] {}), 0U);
+
+    pool.Start(2);
+    std::atomic<int> runs{0};
+    const uint64_t id = pool.AddPeriodic(TaskPriority::LOW, std::chrono::milliseconds{5}, [&runs] { ++runs; });
+    BOOST_CHECK(id != 0);
+    BOOST_CHECK_EQUAL(pool.GetStats().periodic, 1U);
+    for (int i = 0; i < 1000 && runs < 3; ++i) {
+        UninterruptibleSleep(std::chrono::milliseconds{5});
+    }
+    BOOST_CHECK(runs >= 3);
+
+    pool.CancelPeriodic(id);
+    BOOST_CHECK_EQUAL(pool.GetStats().periodic, 0U);
+    const int runs_cancelled = runs;
+    UninterruptibleSleep(std::chrono::milliseconds{30});
+    BOOST_CHECK_EQUAL(runs, runs_cancelled);
+    pool.Stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include <index/txindex.h>
 #include <script/standard.h>
 #include <test/util/setup_common.h>
+#include <util/taskpool.h>
 #include <util/time.h>
 
 #include <boost/test/unit_test.hpp>
@@ -74,4 +75,37 @@ BOOST_FIXTURE_TEST_CASE(txindex_initial_sync, TestChain100Setup)
     SyncWithValidationInterfaceQueue();
 }
 
+BOOST_FIXTURE_TEST_CASE(txindex_parallel_sync, TestChain100Setup)
+{
+    // Blocks are read ahead on the task pool while the pool has workers
+    g_task_pool.Start(4);
+    TxIndex txindex(1 << 20, true);
+    txindex.Start();
+
+    constexpr int64_t timeout_ms = 10 * 1000;
+    int64_t time_start = GetTimeMillis();
+    while (!txindex.BlockUntilSyncedToCurrentChain()) {
+        BOOST_REQUIRE(time_start + timeout_ms > GetTimeMillis());
+        UninterruptibleSleep(std::chrono::milliseconds{100});
+    }
+
+    IndexSummary summary = txindex.GetSummary();
+    BOOST_CHECK_EQUAL(summary.best_block_height, ::ChainActive().Height());
+    BOOST_CHECK_EQUAL(summary.progress, 1.0);
+
+    CTransactionRef tx_disk;
+    uint256 block_hash;
+    for (const auto& txn : m_coinbase_txns) {
+        if (!txindex.FindTx(txn->GetHash(), block_hash, tx_disk)) {
+            BOOST_ERROR("FindTx failed");
+        } else if (tx_disk->GetHash() != txn->GetHash()) {
+            BOOST_ERROR("Read incorrect tx");
+        }
+    }
+
+    txindex.Stop();
+    g_task_pool.Stop();
+    SyncWithValidationInterfaceQueue();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
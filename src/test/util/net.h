@@ -25,6 +25,13 @@ struct ConnmanTestMsg : public CConnman {
 
     void ProcessMessagesOnce(CNode& node) { m_msgproc->ProcessMessages(&node, flagInterruptMsgProc); }
 
+    void SetMessageHandlerShards(int shards) { m_num_msghand_shards = shards; }
+    bool ProcessShardOnce(int shard)
+    {
+        std::vector<CNode*> nodes = WITH_LOCK(cs_vNodes, return vNodes);
+        return ProcessMessageHandlerShard(shard, nodes);
+    }
+
     void NodeReceiveMsgBytes(CNode& node, const char* pch, unsigned int nBytes, bool& complete) const;
 
     bool ReceiveMsgFrom(CNode& node, CSerializedNetMsg& ser_msg) const;
@@ -9,8 +9,10 @@
 #include <consensus/validation.h>
 #include <miner.h>
 #include <pow.h>
+#include <protocol.h>
 #include <random.h>
 #include <script/standard.h>
+#include <streams.h>
 #include <test/util/setup_common.h>
 #include <util/time.h>
 #include <validation.h>
@@ -371,4 +373,45 @@ BOOST_AUTO_TEST_CASE(witness_commitment_index)
 
     BOOST_CHECK_EQUAL(GetWitnessCommitmentIndex(pblock), 2);
 }
+
+BOOST_AUTO_TEST_CASE(load_external_block_file_pipeline)
+{
+    std::vector<std::shared_ptr<const CBlock>> blocks;
+    uint256 tip = Params().GenesisBlock().GetHash();
+    for (int i = 0; i < 40; ++i) {
+        blocks.push_back(GoodBlock(tip));
+        tip = blocks.back()->GetHash();
+    }
+
+    const fs::path path = GetDataDir() / "bootstrap.dat";
+    {
+        CAutoFile file(fsbridge::fopen(path, "wb"), SER_DISK, CLIENT_VERSION);
+        for (const auto& block : blocks) {
+            // Junk between blocks is skipped by the parser
+            file << (uint8_t)0xfa;
+            file.write((const char*)Params().MessageStart(), CMessageHeader::MESSAGE_START_SIZE);
+            file << (unsigned int)::GetSerializeSize(*block, CLIENT_VERSION);
+            file << *block;
+        }
+    }
+
+    // Blocks reach AcceptBlock in file order whichever stage checked them
+    const int check_threads = g_reindex_check_threads;
+    g_reindex_check_threads = 2;
+    LoadExternalBlockFile(Params(), fsbridge::fopen(path, "rb"));
+    g_reindex_check_threads = check_threads;
+    {
+        LOCK(cs_main);
+        for (const auto& block : blocks) {
+            const CBlockIndex* pindex = LookupBlockIndex(block->GetHash());
+            BOOST_REQUIRE(pindex);
+            BOOST_CHECK(pindex->nStatus & BLOCK_HAVE_DATA);
+        }
+    }
+
+    BlockValidationState state;
+    BOOST_CHECK(ActivateBestChain(state, Params()));
+    LOCK(cs_main);
+    BOOST_CHECK_EQUAL(::ChainActive().Tip()->GetBlockHash(), tip);
+}
 BOOST_AUTO_TEST_SUITE_END()
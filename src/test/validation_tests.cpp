@@ -3,9 +3,12 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <chainparams.h>
+#include <consensus/validation.h>
 #include <net.h>
 #include <signet.h>
+#include <util/taskpool.h>
 #include <validation.h>
+#include <validationstats.h>
 
 #include <test/util/setup_common.h>
 
@@ -58,6 +61,43 @@ BOOST_AUTO_TEST_CASE(subsidy_limit_test)
     BOOST_CHECK_EQUAL(nSum, CAmount{2099999997690000});
 }
 
+BOOST_AUTO_TEST_CASE(checkblock_parallel_tx_checks)
+{
+    CBlock block;
+    CMutableTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].prevout.SetNull();
+    coinbase.vin[0].scriptSig = CScript() << OP_1 << OP_1;
+    coinbase.vout.resize(1);
+    coinbase.vout[0].nValue = 50 * COIN;
+    block.vtx.push_back(MakeTransactionRef(coinbase));
+    for (size_t i = 0; i < TX_CHECK_BATCH_SIZE * 4; ++i) {
+        CMutableTransaction mtx;
+        mtx.vin.resize(1);
+        mtx.vin[0].prevout = COutPoint(InsecureRand256(), 0);
+        mtx.vout.resize(1);
+        mtx.vout[0].nValue = COIN;
+        mtx.vout[0].scriptPubKey = CScript() << OP_TRUE;
+        block.vtx.push_back(MakeTransactionRef(mtx));
+    }
+    BlockValidationState state;
+    BOOST_CHECK(CheckBlock(block, state, Params().GetConsensus(), false, false));
+
+    // With failures in several batches the first one in block order is reported
+    CMutableTransaction negative(*block.vtx[TX_CHECK_BATCH_SIZE + 3]);
+    negative.vout[0].nValue = -1;
+    block.vtx[TX_CHECK_BATCH_SIZE + 3] = MakeTransactionRef(negative);
+    CMutableTransaction duplicate(*block.vtx[TX_CHECK_BATCH_SIZE * 3]);
+    duplicate.vin.push_back(duplicate.vin[0]);
+    block.vtx[TX_CHECK_BATCH_SIZE * 3] = MakeTransactionRef(duplicate);
+    for (int i = 0; i < 10; ++i) {
+        block.fChecked = false;
+        state = BlockValidationState();
+        BOOST_CHECK(!CheckBlock(block, state, Params().GetConsensus(), false, false));
+        BOOST_CHECK_EQUAL(state.GetRejectReason(), "bad-txns-vout-negative");
+    }
+}
+
 // BOOST_AUTO_TEST_CASE(signet_parse_tests)
 // {
 //     ArgsManager signet_argsman;
@@ -119,4 +159,88 @@ BOOST_AUTO_TEST_CASE(subsidy_limit_test)
 //     BOOST_CHECK(!CheckSignetBlockSolution(block, signet_params->GetConsensus()));
 // }
 
+BOOST_AUTO_TEST_CASE(validation_stats_window)
+{
+    ValidationStats stats;
+
+    // Times of a block that doesn't connect are dropped
+    stats.StartBlock();
+    stats.Add(ValidationStage::SANITY_CHECKS, 500);
+    stats.StartBlock();
+    stats.Add(ValidationStage::SANITY_CHECKS, 10);
+    stats.Add(ValidationStage::CONNECT_TRANSACTIONS, 40, 4);
+    stats.AddAsync(ValidationStage::ANON_CHECKS, 7);
+    stats.AddAsync(ValidationStage::ANON_CHECKS, 8);
+    stats.SetBlockKind(ValidationBlockKind::PRIVATE);
+    stats.FinishBlock();
+
+    auto plain = stats.GetStats(ValidationBlockKind::PLAIN);
+    auto priv = stats.GetStats(ValidationBlockKind::PRIVATE);
+    BOOST_CHECK_EQUAL(plain[(int)ValidationStage::SANITY_CHECKS].blocks, 0U);
+    BOOST_CHECK_EQUAL(priv[(int)ValidationStage::SANITY_CHECKS].total_micros, 10);
+    BOOST_CHECK_EQUAL(priv[(int)ValidationStage::CONNECT_TRANSACTIONS].items, 4U);
+    BOOST_CHECK_EQUAL(priv[(int)ValidationStage::ANON_CHECKS].items, 2U);
+    BOOST_CHECK_EQUAL(priv[(int)ValidationStage::ANON_CHECKS].total_micros, 15);
+    // Stages that didn't run take no sample
+    BOOST_CHECK_EQUAL(priv[(int)ValidationStage::TREASURY].blocks, 0U);
+    BOOST_CHECK(priv[(int)ValidationStage::TREASURY].window.empty());
+
+    // The window keeps the latest blocks, oldest first
+    for (size_t i = 0; i < VALIDATION_STATS_WINDOW + 5; ++i) {
+        stats.StartBlock();
+        stats.Add(ValidationStage::FORK_CHECKS, i);
+        stats.FinishBlock();
+    }
+    plain = stats.GetStats(ValidationBlockKind::PLAIN);
+    const auto& forks = plain[(int)ValidationStage::FORK_CHECKS];
+    BOOST_CHECK_EQUAL(forks.blocks, VALIDATION_STATS_WINDOW + 5);
+    BOOST_REQUIRE_EQUAL(forks.window.size(), VALIDATION_STATS_WINDOW);
+    BOOST_CHECK_EQUAL(forks.window.front(), 5);
+    BOOST_CHECK_EQUAL(forks.window.back(), (int64_t)VALIDATION_STATS_WINDOW + 4);
+
+    stats.Reset();
+    BOOST_CHECK_EQUAL(stats.GetStats(ValidationBlockKind::PLAIN)[(int)ValidationStage::FORK_CHECKS].blocks, 0U);
+}
+
+BOOST_FIXTURE_TEST_CASE(load_block_index_guts, TestChain100Setup)
+{
+    ::ChainstateActive().ForceFlushStateToDisk();
+
+    // Load into a separate map, with the header hashes computed on the task pool
+    g_task_pool.Start(3);
+    std::map<uint256, std::unique_ptr<CBlockIndex>> loaded;
+    auto insert = [&loaded](const uint256& hash) -> CBlockIndex* {
+        if (hash.IsNull()) return nullptr;
+        auto& entry = loaded[hash];
+        if (!entry) {
+            entry = MakeUnique<CBlockIndex>();
+        }
+        return entry.get();
+    };
+    BOOST_CHECK(pblocktree->LoadBlockIndexGuts(Params().GetConsensus(), insert));
+    g_task_pool.Stop();
+
+    LOCK(cs_main);
+    BOOST_CHECK_EQUAL(loaded.size(), g_chainman.BlockIndex().size());
+    for (const auto& item : g_chainman.BlockIndex()) {
+        const auto it = loaded.find(item.first);
+        BOOST_REQUIRE(it != loaded.end());
+        const CBlockIndex& a = *item.second;
+        const CBlockIndex& b = *it->second;
+        BOOST_CHECK_EQUAL(a.nHeight, b.nHeight);
+        BOOST_CHECK_EQUAL(a.nTime, b.nTime);
+        BOOST_CHECK_EQUAL(a.nBits, b.nBits);
+        BOOST_CHECK_EQUAL(a.nTx, b.nTx);
+        BOOST_CHECK(a.hashMerkleRoot == b.hashMerkleRoot);
+        BOOST_CHECK(a.bnStakeModifier == b.bnStakeModifier);
+        BOOST_CHECK_EQUAL(a.nMoneySupply, b.nMoneySupply);
+        if (a.pprev) {
+            BOOST_REQUIRE(b.pprev);
+            BOOST_CHECK(b.pprev == loaded[a.pprev->GetBlockHash()].get());
+        } else {
+            BOOST_CHECK(!b.pprev);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
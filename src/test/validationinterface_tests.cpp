@@ -10,6 +10,9 @@
 #include <util/check.h>
 #include <validationinterface.h>
 
+#include <atomic>
+#include <future>
+
 BOOST_FIXTURE_TEST_SUITE(validationinterface_tests, TestingSetup)
 
 struct TestSubscriberNoop final : public CValidationInterface {
@@ -91,4 +94,64 @@ BOOST_AUTO_TEST_CASE(unregister_all_during_call)
     BOOST_CHECK(destroyed);
 }
 
+class TestChainStateFlushed : public CValidationInterface
+{
+public:
+    explicit TestChainStateFlushed(std::function<void()> on_call) : m_on_call(std::move(on_call)) {}
+    void ChainStateFlushed(const CBlockLocator&) override { m_on_call(); }
+    std::function<void()> m_on_call;
+};
+
+BOOST_AUTO_TEST_CASE(slow_subscriber_queue)
+{
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> slow_calls{0}, fast_calls{0};
+    auto slow = std::make_shared<TestChainStateFlushed>([&] { released.wait(); ++slow_calls; });
+    auto fast = std::make_shared<TestChainStateFlushed>([&] { ++fast_calls; });
+    RegisterSharedValidationInterface(slow, "slow");
+    RegisterSharedValidationInterface(fast, "fast");
+
+    for (int i = 0; i < 5; ++i) {
+        GetMainSignals().ChainStateFlushed(CBlockLocator{});
+    }
+    // The fast subscriber gets through its queue while the slow one is stuck
+    for (int i = 0; i < 1000 && fast_calls < 5; ++i) {
+        UninterruptibleSleep(std::chrono::milliseconds{5});
+    }
+    BOOST_CHECK_EQUAL(fast_calls, 5);
+    BOOST_CHECK_EQUAL(slow_calls, 0);
+    BOOST_CHECK_EQUAL(GetMainSignals().CallbacksPending(), 5U);
+
+    std::atomic<bool> synced{false};
+    std::thread sync{[&] {
+        SyncWithValidationInterfaceQueue();
+        synced = true;
+    }};
+    UninterruptibleSleep(std::chrono::milliseconds{20});
+    BOOST_CHECK(!synced);
+    release.set_value();
+    sync.join();
+    BOOST_CHECK_EQUAL(slow_calls, 5);
+
+    bool found = false;
+    for (const auto& stats : GetMainSignals().GetQueueStats()) {
+        if (stats.name == "slow") {
+            found = true;
+            BOOST_CHECK_EQUAL(stats.depth, 0U);
+            BOOST_CHECK_EQUAL(stats.max_depth, 6U);
+            BOOST_CHECK_EQUAL(stats.processed, 6U); // The notifications and the sync
+        }
+    }
+    BOOST_CHECK(found);
+
+    // No notifications after unregistering
+    UnregisterSharedValidationInterface(fast);
+    GetMainSignals().ChainStateFlushed(CBlockLocator{});
+    SyncWithValidationInterfaceQueue();
+    BOOST_CHECK_EQUAL(fast_calls, 5);
+    BOOST_CHECK_EQUAL(slow_calls, 6);
+    UnregisterSharedValidationInterface(slow);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,8 @@
 
 #include <txdb.h>
 
+#include <compressor.h>
+#include <memusage.h>
 #include <node/ui_interface.h>
 #include <pow.h>
 #include <random.h>
@@ -12,6 +14,7 @@
 #include <uint256.h>
 #include <util/memory.h>
 #include <util/system.h>
+#include <util/taskpool.h>
 #include <util/translation.h>
 #include <util/vector.h>
 
@@ -21,6 +24,13 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <set>
+#include <thread>
+
 static const char DB_COIN = 'C';
 //static const char DB_COINS = 'c';
 static const char DB_BLOCK_FILES = 'f';
@@ -31,7 +41,20 @@ static const char DB_TIMESTAMPINDEX = 's';
 static const char DB_BLOCKHASHINDEX = 'z';
 static const char DB_SPENTINDEX = 'p';
 static const char DB_BALANCESINDEX = 'i';
+static const char DB_VOTEINDEX = 'W';
+static const char DB_ADDRESSBALANCEINDEX = 'w';
+static const char DB_ADDRESSINDEX_V2 = 'd';
+static const char DB_ADDRESSID = 'e';
+static const char DB_ADDRESSID_NEXT = 'n';
+static const char DB_TXPOSITION = 'x';
+static const char DB_REWARDINDEX = 'y';
 //static const char DB_TXINDEX_BLOCK = 'T';
+
+//! Prefixes moved to the insight index database with -insightdb
+static const char INSIGHT_DB_PREFIXES[] = {DB_ADDRESSINDEX, DB_ADDRESSUNSPENTINDEX, DB_TIMESTAMPINDEX, DB_BLOCKHASHINDEX,
+    DB_SPENTINDEX, DB_BALANCESINDEX, DB_VOTEINDEX, DB_ADDRESSBALANCEINDEX, DB_ADDRESSINDEX_V2, DB_ADDRESSID, DB_ADDRESSID_NEXT, DB_TXPOSITION, DB_REWARDINDEX};
+//! Records where the insight indexes were moved to, absent while they are kept in the block index database
+static const std::string INSIGHT_DB_PATH_FLAG = "insightdbpath";
 static const char DB_BLOCK_INDEX = 'b';
 
 static const char DB_BEST_BLOCK = 'B';
@@ -44,9 +67,14 @@ static const char DB_LAST_BLOCK = 'l';
 static const char DB_RCTOUTPUT = 'A';
 static const char DB_RCTOUTPUT_LINK = 'L';
 static const char DB_RCTKEYIMAGE = 'K';
+static const char DB_RCTKEYIMAGE_HEIGHT = 'k';
 static const char DB_SPENTCACHE = 'S';
+static const char DB_SPENTCACHE_HEIGHT = 'Q';
 */
 
+//! Block index entries LoadBlockIndexGuts decodes before linking them
+static const size_t BLOCK_INDEX_LOAD_BATCH = 16384;
+
 namespace {
 
 struct CoinEntry {
@@ -96,6 +124,75 @@ std::vector<uint256> CCoinsViewDB::GetHeadBlocks() const {
     return vhashHeadBlocks;
 }
 
+uint256 CCoinsViewDB::GetTransitionBase() const
+{
+    uint256 old_tip = GetBestBlock();
+    if (old_tip.IsNull()) {
+        // We may be in the middle of replaying or of background writeback.
+        std::vector<uint256> old_heads = GetHeadBlocks();
+        if (old_heads.size() == 2) {
+            old_tip = old_heads[1];
+        }
+    }
+    return old_tip;
+}
+
+void CCoinsViewDB::BeginWriteback()
+{
+    LOCK(m_writeback_mutex);
+    assert(!m_writeback_pending);
+    m_writeback_pending = true;
+}
+
+void CCoinsViewDB::EndWriteback(bool ok)
+{
+    {
+        LOCK(m_writeback_mutex);
+        m_writeback_pending = false;
+        if (!ok) {
+            // The cache no longer knows the coins are dirty, only a replay
+            // from the transition left in the database can restore them.
+            m_writeback_failed = true;
+        }
+    }
+    m_writeback_cv.notify_all();
+}
+
+bool CCoinsViewDB::HasPartialWrites()
+{
+    LOCK(m_writeback_mutex);
+    return m_partial_written;
+}
+
+bool CCoinsViewDB::BatchWritePartial(const CCoinsMap &mapCoins, const uint256 &hashBlock)
+{
+    assert(!hashBlock.IsNull());
+    {
+        LOCK(m_writeback_mutex);
+        if (m_writeback_failed) {
+            return false;
+        }
+    }
+    CDBBatch batch(*m_db);
+    batch.Erase(DB_BEST_BLOCK);
+    batch.Write(DB_HEAD_BLOCKS, Vector(hashBlock, GetTransitionBase()));
+    for (const auto& entry : mapCoins) {
+        CoinEntry key(&entry.first);
+        if (entry.second.coin.IsSpent()) {
+            batch.Erase(key);
+        } else {
+            batch.Write(key, entry.second.coin);
+        }
+    }
+    LogPrint(BCLog::COINDB, "Writing back %u transaction outputs (%.2f MiB)\n", (unsigned int)mapCoins.size(), batch.SizeEstimate() * (1.0 / 1048576.0));
+    bool ret = m_db->WriteBatch(batch);
+    if (ret) {
+        LOCK(m_writeback_mutex);
+        m_partial_written = true;
+    }
+    return ret;
+}
+
 bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) {
     CDBBatch batch(*m_db);
     size_t count = 0;
@@ -104,12 +201,25 @@ bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) {
     int crash_simulate = gArgs.GetArg("-dbcrashratio", 0);
     assert(!hashBlock.IsNull());
 
+    bool partial_written;
+    {
+        WAIT_LOCK(m_writeback_mutex, lock);
+        while (m_writeback_pending) {
+            m_writeback_cv.wait(lock);
+        }
+        if (m_writeback_failed) {
+            return false;
+        }
+        partial_written = m_partial_written;
+    }
+
     uint256 old_tip = GetBestBlock();
     if (old_tip.IsNull()) {
-        // We may be in the middle of replaying.
+        // We may be in the middle of replaying or of background writeback,
+        // writeback moves the transition along with the tip.
         std::vector<uint256> old_heads = GetHeadBlocks();
         if (old_heads.size() == 2) {
-            assert(old_heads[0] == hashBlock);
+            assert(partial_written || old_heads[0] == hashBlock);
             old_tip = old_heads[1];
         }
     }
@@ -153,6 +263,10 @@ bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) {
 
     LogPrint(BCLog::COINDB, "Writing final batch of %.2f MiB\n", batch.SizeEstimate() * (1.0 / 1048576.0));
     bool ret = m_db->WriteBatch(batch);
+    if (ret) {
+        LOCK(m_writeback_mutex);
+        m_partial_written = false;
+    }
     LogPrint(BCLog::COINDB, "Committed %u changed transaction outputs (out of %u) to coin database...\n", (unsigned int)changed, (unsigned int)count);
     return ret;
 }
@@ -165,6 +279,55 @@ size_t CCoinsViewDB::EstimateSize() const
 CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe, bool compression, int maxOpenFiles) : CDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe, false, compression, maxOpenFiles) {
 }
 
+std::string CBlockTreeDB::GetPrefixName(uint8_t prefix)
+{
+    switch ((char)prefix) {
+        case DB_BLOCK_FILES:            return "block_files";
+        case DB_BLOCK_INDEX:            return "block_index";
+        case DB_BEST_BLOCK:             return "best_block";
+        case DB_HEAD_BLOCKS:            return "head_blocks";
+        case DB_FLAG:                   return "flags";
+        case DB_REINDEX_FLAG:           return "reindex_flag";
+        case DB_LAST_BLOCK:             return "last_block";
+        case DB_ADDRESSINDEX:           return "address_index";
+        case DB_ADDRESSINDEX_V2:        return "address_index_v2";
+        case DB_ADDRESSID:              return "address_id";
+        case DB_ADDRESSID_NEXT:         return "address_id_next";
+        case DB_ADDRESSUNSPENTINDEX:    return "address_unspent_index";
+        case DB_ADDRESSBALANCEINDEX:    return "address_balance_index";
+        case DB_TIMESTAMPINDEX:         return "timestamp_index";
+        case DB_BLOCKHASHINDEX:         return "block_timestamp_index";
+        case DB_SPENTINDEX:             return "spent_index";
+        case DB_BALANCESINDEX:          return "balances_index";
+        case DB_VOTEINDEX:              return "vote_index";
+        case DB_TXPOSITION:             return "tx_position";
+        case DB_REWARDINDEX:            return "reward_index";
+        case DB_RCTOUTPUT:              return "rct_output";
+        case DB_RCTOUTPUT_LINK:         return "rct_output_link";
+        case DB_RCTKEYIMAGE:            return "rct_keyimage";
+        case DB_RCTKEYIMAGE_HEIGHT:     return "rct_keyimage_height";
+        case DB_SPENTCACHE:             return "spent_cache";
+        case DB_SPENTCACHE_HEIGHT:      return "spent_cache_height";
+        case DB_GVR_RANGE:              return "gvr_range";
+        case DB_GVR_BALANCE:            return "gvr_balance";
+        case DB_GVR_CHECKPOINT:         return "gvr_checkpoint";
+        case DB_TRACKER_INPUTS_UNDO:    return "tracker_inputs_undo";
+        case DB_TRACKER_OUTPUTS_UNDO:   return "tracker_outputs_undo";
+        case DB_LAST_TRACKED_HEIGHT:    return "last_tracked_height";
+        case '\0':                      return "obfuscate_key";
+        default:
+            return "";
+    }
+}
+
+CDBWrapper &CBlockTreeDB::GetDBForPrefix(uint8_t prefix)
+{
+    if (m_insight_db && std::find(std::begin(INSIGHT_DB_PREFIXES), std::end(INSIGHT_DB_PREFIXES), (char)prefix) != std::end(INSIGHT_DB_PREFIXES)) {
+        return *m_insight_db;
+    }
+    return *this;
+}
+
 bool CBlockTreeDB::ReadBlockFileInfo(int nFile, CBlockFileInfo &info) {
     return Read(std::make_pair(DB_BLOCK_FILES, nFile), info);
 }
@@ -202,6 +365,84 @@ CCoinsViewCursor *CCoinsViewDB::Cursor() const
     return i;
 }
 
+bool CCoinsViewDB::ForEachCoinParallel(size_t n_ranges, int n_threads, const std::function<bool(size_t, const COutPoint&, const Coin&)> &fn,
+                                       const std::function<void(size_t)> &range_done, uint256 &hashBlock) const
+{
+    assert(n_ranges > 0 && n_ranges <= 0x10000);
+    CDBWrapper::Snapshot snapshot(*m_db);
+
+    hashBlock.SetNull();
+    {
+        const std::unique_ptr<CDBIterator> pcursor(m_db->NewIterator(snapshot));
+        pcursor->Seek(DB_BEST_BLOCK);
+        char key;
+        if (pcursor->Valid() && pcursor->GetKey(key) && key == DB_BEST_BLOCK) {
+            pcursor->GetValue(hashBlock);
+        }
+    }
+
+    // Ranges are split on the first two serialized bytes of the txid
+    std::atomic<size_t> next_range{0};
+    std::atomic<bool> fAbort{false};
+    auto worker = [&]() {
+        size_t range;
+        while (!fAbort && (range = next_range++) < n_ranges) {
+            const uint32_t begin = range * 0x10000 / n_ranges;
+            const uint32_t end = (range + 1) * 0x10000 / n_ranges;
+            COutPoint outpoint;
+            outpoint.hash.begin()[0] = begin >> 8;
+            outpoint.hash.begin()[1] = begin & 0xFF;
+            outpoint.n = 0;
+
+            const std::unique_ptr<CDBIterator> pcursor(m_db->NewIterator(snapshot));
+            pcursor->Seek(CoinEntry(&outpoint));
+            size_t count = 0;
+            for (; pcursor->Valid(); pcursor->Next()) {
+                CoinEntry entry(&outpoint);
+                if (!pcursor->GetKey(entry) || entry.key != DB_COIN
+                    || (uint32_t)(outpoint.hash.begin()[0] << 8 | outpoint.hash.begin()[1]) >= end) {
+                    break;
+                }
+                Coin coin;
+                if (!pcursor->GetValue(coin)) {
+                    LogPrintf("%s: Unable to read value for %s\n", __func__, outpoint.ToString());
+                    fAbort = true;
+                    return;
+                }
+                if ((++count % 8192 == 0 && ShutdownRequested())
+                    || !fn(range, outpoint, coin)) {
+                    fAbort = true;
+                    return;
+                }
+            }
+            if (range_done) {
+                range_done(range);
+            }
+        }
+    };
+
+    n_threads = std::max(1, std::min<int>(n_threads, n_ranges));
+    std::vector<std::thread> threads;
+    for (int i = 1; i < n_threads; ++i) {
+        threads.emplace_back([&worker]() { TraceThread("utxoscan", worker); });
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    return !fAbort;
+}
+
+int GetUTXOScanThreads()
+{
+    int n_threads = gArgs.GetArg("-utxoscanthreads", DEFAULT_UTXO_SCAN_THREADS);
+    if (n_threads <= 0) {
+        n_threads += GetNumCores();
+    }
+    return std::max(1, std::min(n_threads, MAX_UTXO_SCAN_THREADS));
+}
+
 bool CCoinsViewDBCursor::GetKey(COutPoint &key) const
 {
     // Return cached key
@@ -251,11 +492,20 @@ bool CBlockTreeDB::WriteBatchSync(const std::vector<std::pair<int, const CBlockF
 }
 
 bool CBlockTreeDB::ReadSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value) {
-    return Read(std::make_pair(DB_SPENTINDEX, key), value);
+    return InsightDB().Read(std::make_pair(DB_SPENTINDEX, key), value);
+}
+
+bool CBlockTreeDB::WriteInsightBatch(CDBBatch &batch, InsightStatsType type, size_t nKeys)
+{
+    const size_t nBytes = batch.SizeEstimate();
+    const int64_t nStart = GetTimeMicros();
+    const bool rv = InsightDB().WriteBatch(batch);
+    RecordInsightWrite(type, nKeys, nBytes, GetTimeMicros() - nStart);
+    return rv;
 }
 
 bool CBlockTreeDB::UpdateSpentIndex(const std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> >&vect) {
-    CDBBatch batch(*this);
+    CDBBatch batch(InsightDB());
     for (std::vector<std::pair<CSpentIndexKey,CSpentIndexValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++) {
         if (it->second.IsNull()) {
             batch.Erase(std::make_pair(DB_SPENTINDEX, it->first));
@@ -263,11 +513,11 @@ bool CBlockTreeDB::UpdateSpentIndex(const std::vector<std::pair<CSpentIndexKey,
             batch.Write(std::make_pair(DB_SPENTINDEX, it->first), it->second);
         }
     }
-    return WriteBatch(batch);
+    return WriteInsightBatch(batch, INSIGHT_STATS_SPENT, vect.size());
 }
 
 bool CBlockTreeDB::UpdateAddressUnspentIndex(const std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue > >&vect) {
-    CDBBatch batch(*this);
+    CDBBatch batch(InsightDB());
     for (std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >::const_iterator it=vect.begin(); it!=vect.end(); it++) {
         if (it->second.IsNull()) {
             batch.Erase(std::make_pair(DB_ADDRESSUNSPENTINDEX, it->first));
@@ -275,12 +525,12 @@ bool CBlockTreeDB::UpdateAddressUnspentIndex(const std::vector<std::pair<CAddres
             batch.Write(std::make_pair(DB_ADDRESSUNSPENTINDEX, it->first), it->second);
         }
     }
-    return WriteBatch(batch);
+    return WriteInsightBatch(batch, INSIGHT_STATS_ADDRESSUNSPENT, vect.size());
 }
 
 bool CBlockTreeDB::ReadAddressUnspentIndex(uint256 addressHash, int type,
                                            std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &unspentOutputs) {
-    const std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
 
     pcursor->Seek(std::make_pair(DB_ADDRESSUNSPENTINDEX, CAddressIndexIteratorKey(type, addressHash)));
 
@@ -303,48 +553,341 @@ bool CBlockTreeDB::ReadAddressUnspentIndex(uint256 addressHash, int type,
     return true;
 }
 
+/**
+ * Apply the address index entries of one or more blocks to the running totals of their addresses.
+ * When erasing, the entries must still be in the database, the last height falls back to the
+ * height of the newest entry below the lowest erased one.
+ */
+bool CBlockTreeDB::UpdateAddressBalances(CDBBatch &batch, const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect, bool fErase)
+{
+    struct BalanceDelta {
+        CAmount balance = 0;
+        CAmount received = 0;
+        std::set<std::pair<int, uint256> > txns;
+        int minHeight = std::numeric_limits<int>::max();
+        int maxHeight = 0;
+    };
+    std::map<std::pair<unsigned int, uint256>, BalanceDelta> deltas;
+    for (const auto &it : vect) {
+        BalanceDelta &delta = deltas[std::make_pair(it.first.type, it.first.hashBytes)];
+        delta.balance += it.second;
+        if (it.second > 0) {
+            delta.received += it.second;
+        }
+        delta.txns.emplace(it.first.blockHeight, it.first.txhash);
+        delta.minHeight = std::min(delta.minHeight, it.first.blockHeight);
+        delta.maxHeight = std::max(delta.maxHeight, it.first.blockHeight);
+    }
+
+    for (const auto &it : deltas) {
+        const CAddressIndexIteratorKey key(it.first.first, it.first.second);
+        const BalanceDelta &delta = it.second;
+        CAddressBalanceValue value;
+        if (!ReadAddressBalance(key, value)) {
+            value.SetNull();
+        }
+
+        if (!fErase) {
+            value.balance += delta.balance;
+            value.received += delta.received;
+            value.txCount += delta.txns.size();
+            value.lastHeight = std::max(value.lastHeight, delta.maxHeight);
+            batch.Write(std::make_pair(DB_ADDRESSBALANCEINDEX, key), value);
+            continue;
+        }
+
+        if (value.txCount <= delta.txns.size()) {
+            batch.Erase(std::make_pair(DB_ADDRESSBALANCEINDEX, key));
+            continue;
+        }
+        value.balance -= delta.balance;
+        value.received -= delta.received;
+        value.txCount -= delta.txns.size();
+        if (value.lastHeight >= delta.minHeight) {
+            value.lastHeight = ReadLastAddressIndexHeight(key, delta.minHeight);
+        }
+        batch.Write(std::make_pair(DB_ADDRESSBALANCEINDEX, key), value);
+    }
+    return true;
+}
+
+int CBlockTreeDB::ReadLastAddressIndexHeight(const CAddressIndexIteratorKey &key, int below_height)
+{
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
+    if (fAddressIndexV2) {
+        uint32_t id;
+        if (!InsightDB().Read(std::make_pair(DB_ADDRESSID, key), id)) {
+            return 0;
+        }
+        pcursor->Seek(std::make_pair(DB_ADDRESSINDEX_V2, CAddressIndexIteratorKeyV2(id, below_height, 0)));
+        if (pcursor->Valid()) {
+            pcursor->Prev();
+            std::pair<char, CAddressIndexKeyV2> prev_key;
+            if (pcursor->Valid() && pcursor->GetKey(prev_key) && prev_key.first == DB_ADDRESSINDEX_V2
+                && prev_key.second.addressId == id) {
+                return prev_key.second.blockHeight;
+            }
+        }
+        return 0;
+    }
+
+    pcursor->Seek(std::make_pair(DB_ADDRESSINDEX, CAddressIndexIteratorHeightKey(key.type, key.hashBytes, below_height)));
+    if (pcursor->Valid()) {
+        pcursor->Prev();
+        std::pair<char, CAddressIndexKey> prev_key;
+        if (pcursor->Valid() && pcursor->GetKey(prev_key) && prev_key.first == DB_ADDRESSINDEX
+            && prev_key.second.type == key.type && prev_key.second.hashBytes == key.hashBytes) {
+            return prev_key.second.blockHeight;
+        }
+    }
+    return 0;
+}
+
+bool CBlockTreeDB::WriteAddressIndexV2(CDBBatch &batch, const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect)
+{
+    std::map<std::pair<unsigned int, uint256>, uint32_t> ids;
+    uint32_t next_id = 0;
+    bool fHaveNextId = false;
+    std::set<CTxPositionKey> positions;
+    for (const auto &it : vect) {
+        const CAddressIndexKey &key = it.first;
+        auto mi = ids.find(std::make_pair(key.type, key.hashBytes));
+        if (mi == ids.end()) {
+            const CAddressIndexIteratorKey address_key(key.type, key.hashBytes);
+            uint32_t id;
+            if (!InsightDB().Read(std::make_pair(DB_ADDRESSID, address_key), id)) {
+                if (!fHaveNextId) {
+                    if (!InsightDB().Read(DB_ADDRESSID_NEXT, next_id)) {
+                        next_id = 1;
+                    }
+                    fHaveNextId = true;
+                }
+                id = next_id++;
+                batch.Write(std::make_pair(DB_ADDRESSID, address_key), id);
+            }
+            mi = ids.emplace(std::make_pair(key.type, key.hashBytes), id).first;
+        }
+        batch.Write(std::make_pair(DB_ADDRESSINDEX_V2, CAddressIndexKeyV2(mi->second, key)), CAddressIndexValueV2(it.second));
+        if (positions.emplace(key.blockHeight, key.txindex).second) {
+            batch.Write(std::make_pair(DB_TXPOSITION, CTxPositionKey(key.blockHeight, key.txindex)), key.txhash);
+        }
+    }
+    if (fHaveNextId) {
+        batch.Write(DB_ADDRESSID_NEXT, next_id);
+    }
+    return true;
+}
+
 bool CBlockTreeDB::WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect) {
-    CDBBatch batch(*this);
-    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Write(std::make_pair(DB_ADDRESSINDEX, it->first), it->second);
-    return WriteBatch(batch);
+    CDBBatch batch(InsightDB());
+    LOCK(m_address_id_mutex);
+    if (fAddressIndexV2) {
+        if (!WriteAddressIndexV2(batch, vect)) {
+            return false;
+        }
+    } else {
+        for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
+            batch.Write(std::make_pair(DB_ADDRESSINDEX, it->first), it->second);
+    }
+    if (fAddressBalanceIndex && !UpdateAddressBalances(batch, vect, false)) {
+        return false;
+    }
+    return WriteInsightBatch(batch, INSIGHT_STATS_ADDRESS, vect.size());
 }
 
 bool CBlockTreeDB::EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount > >&vect) {
-    CDBBatch batch(*this);
-    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
-        batch.Erase(std::make_pair(DB_ADDRESSINDEX, it->first));
-    return WriteBatch(batch);
+    CDBBatch batch(InsightDB());
+    if (fAddressIndexV2) {
+        // Address ids stay assigned, the tx positions go with the entries of the block
+        std::map<std::pair<unsigned int, uint256>, uint32_t> ids;
+        std::set<CTxPositionKey> positions;
+        for (const auto &it : vect) {
+            const CAddressIndexKey &key = it.first;
+            auto mi = ids.find(std::make_pair(key.type, key.hashBytes));
+            if (mi == ids.end()) {
+                uint32_t id;
+                if (!InsightDB().Read(std::make_pair(DB_ADDRESSID, CAddressIndexIteratorKey(key.type, key.hashBytes)), id)) {
+                    continue;
+                }
+                mi = ids.emplace(std::make_pair(key.type, key.hashBytes), id).first;
+            }
+            batch.Erase(std::make_pair(DB_ADDRESSINDEX_V2, CAddressIndexKeyV2(mi->second, key)));
+            if (positions.emplace(key.blockHeight, key.txindex).second) {
+                batch.Erase(std::make_pair(DB_TXPOSITION, CTxPositionKey(key.blockHeight, key.txindex)));
+            }
+        }
+    } else {
+        for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it=vect.begin(); it!=vect.end(); it++)
+            batch.Erase(std::make_pair(DB_ADDRESSINDEX, it->first));
+    }
+    if (fAddressBalanceIndex && !UpdateAddressBalances(batch, vect, true)) {
+        return false;
+    }
+    return WriteInsightBatch(batch, INSIGHT_STATS_ADDRESS, vect.size());
+}
+
+bool CBlockTreeDB::UpgradeAddressIndex(bool fMigrate)
+{
+    if (!fAddressIndex) {
+        return true;
+    }
+    if (!fAddressIndexV2) {
+        if (!fMigrate) {
+            return true;
+        }
+        // Set first, an interrupted migration is resumed on the next start
+        fAddressIndexV2 = true;
+        if (!WriteFlag("addressindexv2", true)) {
+            return error("%s: failed to write flag", __func__);
+        }
+    }
+
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
+    pcursor->Seek(std::make_pair(DB_ADDRESSINDEX, CAddressIndexIteratorKey()));
+    if (!pcursor->Valid()) {
+        return true;
+    }
+    std::pair<char, CAddressIndexKey> key;
+    if (!pcursor->GetKey(key) || key.first != DB_ADDRESSINDEX) {
+        return true;
+    }
+
+    LogPrintf("Upgrading address index to the compact encoding...\n");
+    LOCK(m_address_id_mutex);
+    size_t count = 0;
+    std::vector<std::pair<CAddressIndexKey, CAmount> > vect;
+    CDBBatch batch(InsightDB());
+    for (;;) {
+        bool fDone = !pcursor->Valid() || !pcursor->GetKey(key) || key.first != DB_ADDRESSINDEX;
+        if (!fDone) {
+            if (ShutdownRequested()) {
+                return false;
+            }
+            CAmount nValue;
+            if (!pcursor->GetValue(nValue)) {
+                return error("%s: failed to read value", __func__);
+            }
+            vect.emplace_back(key.second, nValue);
+            batch.Erase(std::make_pair(DB_ADDRESSINDEX, key.second));
+            pcursor->Next();
+        }
+        if (!vect.empty() && (fDone || batch.SizeEstimate() > (size_t)nDefaultDbBatchSize)) {
+            if (!WriteAddressIndexV2(batch, vect) || !InsightDB().WriteBatch(batch)) {
+                return error("%s: WriteBatch failed", __func__);
+            }
+            count += vect.size();
+            LogPrintf("Upgraded %d address index entries\n", count);
+            vect.clear();
+            batch.Clear();
+        }
+        if (fDone) {
+            break;
+        }
+    }
+    LogPrintf("Address index upgrade done.\n");
+    return true;
+}
+
+bool CBlockTreeDB::ReadAddressBalance(const CAddressIndexIteratorKey &key, CAddressBalanceValue &value)
+{
+    return InsightDB().Read(std::make_pair(DB_ADDRESSBALANCEINDEX, key), value);
 }
 
 bool CBlockTreeDB::ReadAddressIndex(uint256 addressHash, int type,
                                     std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                                     int start, int end) {
-    const std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    const CAddressIndexIteratorTxKey start_key(type, addressHash, start > 0 && end > 0 ? start : 0, 0);
+    return ForEachAddressIndex(start_key, [&](const CAddressIndexKey &key, CAmount nValue) {
+        if (end > 0 && key.blockHeight > end) {
+            return false;
+        }
+        addressIndex.push_back(std::make_pair(key, nValue));
+        return true;
+    });
+}
 
-    if (start > 0 && end > 0) {
-        pcursor->Seek(std::make_pair(DB_ADDRESSINDEX, CAddressIndexIteratorHeightKey(type, addressHash, start)));
-    } else {
-        pcursor->Seek(std::make_pair(DB_ADDRESSINDEX, CAddressIndexIteratorKey(type, addressHash)));
-    }
+bool CBlockTreeDB::ForEachAddressIndex(const CAddressIndexIteratorTxKey &start_key, const std::function<bool(const CAddressIndexKey&, CAmount)> &fn)
+{
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
 
-    while (pcursor->Valid()) {
-        if (ShutdownRequested()) return false;
-        std::pair<char, CAddressIndexKey> key;
-        if (pcursor->GetKey(key) && key.first == DB_ADDRESSINDEX && key.second.hashBytes == addressHash) {
-            if (end > 0 && key.second.blockHeight > end) {
+    if (fAddressIndexV2) {
+        uint32_t id;
+        if (!InsightDB().Read(std::make_pair(DB_ADDRESSID, CAddressIndexIteratorKey(start_key.type, start_key.hashBytes)), id)) {
+            return true;
+        }
+        pcursor->Seek(std::make_pair(DB_ADDRESSINDEX_V2, CAddressIndexIteratorKeyV2(id, start_key.blockHeight, start_key.txindex)));
+
+        CAddressIndexKey key(start_key.type, start_key.hashBytes, -1, 0, uint256(), 0, false);
+        while (pcursor->Valid()) {
+            if (ShutdownRequested()) return false;
+            std::pair<char, CAddressIndexKeyV2> key_v2;
+            if (!pcursor->GetKey(key_v2) || key_v2.first != DB_ADDRESSINDEX_V2 || key_v2.second.addressId != id) {
                 break;
             }
-            CAmount nValue;
-            if (pcursor->GetValue(nValue)) {
-                addressIndex.push_back(std::make_pair(key.second, nValue));
-                pcursor->Next();
-            } else {
+            CAddressIndexValueV2 value;
+            if (!pcursor->GetValue(value)) {
                 return error("failed to get address index value");
             }
-        } else {
+            if (key.blockHeight != key_v2.second.blockHeight || key.txindex != key_v2.second.txindex) {
+                key.blockHeight = key_v2.second.blockHeight;
+                key.txindex = key_v2.second.txindex;
+                if (!InsightDB().Read(std::make_pair(DB_TXPOSITION, CTxPositionKey(key.blockHeight, key.txindex)), key.txhash)) {
+                    return error("failed to get tx position %d %d", key.blockHeight, key.txindex);
+                }
+            }
+            key.index = key_v2.second.index;
+            key.spending = key_v2.second.spending;
+            if (!fn(key, value.amount)) {
+                break;
+            }
+            pcursor->Next();
+        }
+        return true;
+    }
+
+    pcursor->Seek(std::make_pair(DB_ADDRESSINDEX, start_key));
+
+    while (pcursor->Valid()) {
+        if (ShutdownRequested()) return false;
+        std::pair<char, CAddressIndexKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_ADDRESSINDEX
+            || key.second.type != start_key.type || key.second.hashBytes != start_key.hashBytes) {
+            break;
+        }
+        CAmount nValue;
+        if (!pcursor->GetValue(nValue)) {
+            return error("failed to get address index value");
+        }
+        if (!fn(key.second, nValue)) {
+            break;
+        }
+        pcursor->Next();
+    }
+
+    return true;
+}
+
+bool CBlockTreeDB::ForEachAddressUnspent(const CAddressUnspentKey &start_key, const std::function<bool(const CAddressUnspentKey&, const CAddressUnspentValue&)> &fn)
+{
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
+
+    pcursor->Seek(std::make_pair(DB_ADDRESSUNSPENTINDEX, start_key));
+
+    while (pcursor->Valid()) {
+        if (ShutdownRequested()) return false;
+        std::pair<char, CAddressUnspentKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_ADDRESSUNSPENTINDEX
+            || key.second.type != start_key.type || key.second.hashBytes != start_key.hashBytes) {
             break;
         }
+        CAddressUnspentValue value;
+        if (!pcursor->GetValue(value)) {
+            return error("failed to get address unspent value");
+        }
+        if (!fn(key.second, value)) {
+            break;
+        }
+        pcursor->Next();
     }
 
     return true;
@@ -352,56 +895,52 @@ bool CBlockTreeDB::ReadAddressIndex(uint256 addressHash, int type,
 
 bool CBlockTreeDB::WriteTimestampIndex(const CTimestampIndexKey &timestampIndex)
 {
-    CDBBatch batch(*this);
+    CDBBatch batch(InsightDB());
     batch.Write(std::make_pair(DB_TIMESTAMPINDEX, timestampIndex), 0);
-    return WriteBatch(batch);
+    return WriteInsightBatch(batch, INSIGHT_STATS_TIMESTAMP, 1);
 }
 
 bool CBlockTreeDB::ReadTimestampIndex(const unsigned int &high, const unsigned int &low, const bool fActiveOnly, std::vector<std::pair<uint256, unsigned int> > &hashes)
 {
-    const std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    return ForEachTimestampIndex(low, high, [&](const CTimestampIndexKey &key) {
+        if (!fActiveOnly || HashOnchainActive(key.blockHash)) {
+            hashes.push_back(std::make_pair(key.blockHash, key.timestamp));
+        }
+        return true;
+    });
+}
+
+bool CBlockTreeDB::ForEachTimestampIndex(unsigned int low, unsigned int high, const std::function<bool(const CTimestampIndexKey&)> &fn)
+{
+    const std::unique_ptr<CDBIterator> pcursor(InsightDB().NewIterator());
 
     pcursor->Seek(std::make_pair(DB_TIMESTAMPINDEX, CTimestampIndexIteratorKey(low)));
 
-    if (fActiveOnly) {
-        while (pcursor->Valid()) {
-            if (ShutdownRequested()) return false;
-            std::pair<char, CTimestampIndexKey> key;
-            if (pcursor->GetKey(key) && key.first == DB_TIMESTAMPINDEX && key.second.timestamp < high) {
-                if (HashOnchainActive(key.second.blockHash)) {
-                    hashes.push_back(std::make_pair(key.second.blockHash, key.second.timestamp));
-                }
-                pcursor->Next();
-            } else {
-                break;
-            }
+    while (pcursor->Valid()) {
+        if (ShutdownRequested()) return false;
+        std::pair<char, CTimestampIndexKey> key;
+        if (!pcursor->GetKey(key) || key.first != DB_TIMESTAMPINDEX || key.second.timestamp >= high) {
+            break;
         }
-    } else {
-        while (pcursor->Valid()) {
-            if (ShutdownRequested()) return false;
-            std::pair<char, CTimestampIndexKey> key;
-            if (pcursor->GetKey(key) && key.first == DB_TIMESTAMPINDEX && key.second.timestamp < high) {
-                hashes.push_back(std::make_pair(key.second.blockHash, key.second.timestamp));
-                pcursor->Next();
-            } else {
-                break;
-            }
+        if (!fn(key.second)) {
+            break;
         }
+        pcursor->Next();
     }
 
     return true;
 }
 
 bool CBlockTreeDB::WriteTimestampBlockIndex(const CTimestampBlockIndexKey &blockhashIndex, const CTimestampBlockIndexValue &logicalts) {
-    CDBBatch batch(*this);
+    CDBBatch batch(InsightDB());
     batch.Write(std::make_pair(DB_BLOCKHASHINDEX, blockhashIndex), logicalts);
-    return WriteBatch(batch);
+    return WriteInsightBatch(batch, INSIGHT_STATS_TIMESTAMP, 1);
 }
 
 bool CBlockTreeDB::ReadTimestampBlockIndex(const uint256 &hash, unsigned int &ltimestamp) {
 
     CTimestampBlockIndexValue lts;
-    if (!Read(std::make_pair(DB_BLOCKHASHINDEX, hash), lts)) {
+    if (!InsightDB().Read(std::make_pair(DB_BLOCKHASHINDEX, hash), lts)) {
         return false;
     }
 
@@ -411,109 +950,354 @@ bool CBlockTreeDB::ReadTimestampBlockIndex(const uint256 &hash, unsigned int &lt
 
 bool CBlockTreeDB::WriteBlockBalancesIndex(const uint256 &key, const BlockBalances &value)
 {
-    CDBBatch batch(*this);
+    CDBBatch batch(InsightDB());
     batch.Write(std::make_pair(DB_BALANCESINDEX, key), value);
-    return WriteBatch(batch);
+    return WriteInsightBatch(batch, INSIGHT_STATS_BALANCES, 1);
 }
 
 bool CBlockTreeDB::ReadBlockBalancesIndex(const uint256 &key, BlockBalances &value)
 {
-    return Read(std::make_pair(DB_BALANCESINDEX, key), value);
+    return InsightDB().Read(std::make_pair(DB_BALANCESINDEX, key), value);
 }
 
-bool CBlockTreeDB::WriteFlag(const std::string &name, bool fValue) {
-    return Write(std::make_pair(DB_FLAG, name), fValue ? '1' : '0');
+bool CBlockTreeDB::WriteBlockVoteIndex(const uint256 &key, uint32_t vote_token)
+{
+    CDBBatch batch(InsightDB());
+    batch.Write(std::make_pair(DB_VOTEINDEX, key), vote_token);
+    return WriteInsightBatch(batch, INSIGHT_STATS_VOTES, 1);
 }
 
-bool CBlockTreeDB::ReadFlag(const std::string &name, bool &fValue) {
-    char ch;
-    if (!Read(std::make_pair(DB_FLAG, name), ch))
-        return false;
+bool CBlockTreeDB::ReadBlockVoteIndex(const uint256 &key, uint32_t &vote_token)
+{
+    return InsightDB().Read(std::make_pair(DB_VOTEINDEX, key), vote_token);
+}
+
+bool CBlockTreeDB::WriteBlockRewardIndex(const uint256 &key, const BlockRewardSummary &value)
+{
+    CDBBatch batch(InsightDB());
+    batch.Write(std::make_pair(DB_REWARDINDEX, key), value);
+    return WriteInsightBatch(batch, INSIGHT_STATS_REWARDS, 1);
+}
+
+bool CBlockTreeDB::ReadBlockRewardIndex(const uint256 &key, BlockRewardSummary &value)
+{
+    return InsightDB().Read(std::make_pair(DB_REWARDINDEX, key), value);
+}
+
+bool CBlockTreeDB::WriteFlag(const std::string &name, bool fValue) {
+    return Write(std::make_pair(DB_FLAG, name), fValue ? '1' : '0');
+}
+
+bool CBlockTreeDB::ReadFlag(const std::string &name, bool &fValue) {
+    char ch;
+    if (!Read(std::make_pair(DB_FLAG, name), ch))
+        return false;
     fValue = ch == '1';
     return true;
 }
 
+bool CBlockTreeDB::LoadCoinsFormat(bool fRebuilt)
+{
+    // Absent in databases written before the compact layout
+    int format = COINS_FORMAT_LEGACY;
+    Read(std::make_pair(DB_FLAG, std::string("coinsformat")), format);
+    if (format > COINS_FORMAT_CURRENT) {
+        return error("%s: coins format %d is newer than the supported format %d", __func__, format, COINS_FORMAT_CURRENT);
+    }
+    if (fRebuilt && format != COINS_FORMAT_CURRENT) {
+        format = COINS_FORMAT_CURRENT;
+        if (!Write(std::make_pair(DB_FLAG, std::string("coinsformat")), format)) {
+            return error("%s: failed to write coins format", __func__);
+        }
+    }
+    fCompactCoins = format >= COINS_FORMAT_COMPACT;
+    LogPrintf("Coins and undo data are written in the %s layout\n", fCompactCoins ? "compact" : "legacy");
+    return true;
+}
+
 bool CBlockTreeDB::LoadBlockIndexGuts(const Consensus::Params& consensusParams, std::function<CBlockIndex*(const uint256&)> insertBlockIndex)
 {
     std::unique_ptr<CDBIterator> pcursor(NewIterator());
 
     pcursor->Seek(std::make_pair(DB_BLOCK_INDEX, uint256()));
 
+    // Entries are read in batches, the header hashes of a batch are computed on the task pool
+    std::vector<CDiskBlockIndex> entries;
+    std::vector<uint256> hashes;
+    entries.reserve(BLOCK_INDEX_LOAD_BATCH);
+
     // Load m_block_index
-    while (pcursor->Valid()) {
+    bool more = true;
+    while (more) {
         if (ShutdownRequested()) return false;
-        std::pair<char, uint256> key;
-        if (pcursor->GetKey(key) && key.first == DB_BLOCK_INDEX) {
-            CDiskBlockIndex diskindex;
-            if (pcursor->GetValue(diskindex)) {
-                // Construct block index object
-                CBlockIndex* pindexNew  = insertBlockIndex(diskindex.GetBlockHash());
-                pindexNew->pprev                    = insertBlockIndex(diskindex.hashPrev);
-                pindexNew->nHeight                  = diskindex.nHeight;
-                pindexNew->nFile                    = diskindex.nFile;
-                pindexNew->nDataPos                 = diskindex.nDataPos;
-                pindexNew->nUndoPos                 = diskindex.nUndoPos;
-                pindexNew->nVersion                 = diskindex.nVersion;
-                pindexNew->hashMerkleRoot           = diskindex.hashMerkleRoot;
-                pindexNew->hashWitnessMerkleRoot    = diskindex.hashWitnessMerkleRoot;
-                pindexNew->nTime                    = diskindex.nTime;
-                pindexNew->nBits                    = diskindex.nBits;
-                pindexNew->nNonce                   = diskindex.nNonce;
-                pindexNew->nStatus                  = diskindex.nStatus;
-                pindexNew->nTx                      = diskindex.nTx;
-
-                pindexNew->nFlags                   = diskindex.nFlags & (uint32_t)~BLOCK_DELAYED;
-                pindexNew->bnStakeModifier          = diskindex.bnStakeModifier;
-                pindexNew->prevoutStake             = diskindex.prevoutStake;
-                //pindexNew->hashProof                = diskindex.hashProof;
-
-                pindexNew->nMoneySupply             = diskindex.nMoneySupply;
-                pindexNew->nAnonOutputs             = diskindex.nAnonOutputs;
-
-
-                if (pindexNew->nHeight == 0
-                    && pindexNew->GetBlockHash() != Params().GetConsensus().hashGenesisBlock)
-                    return error("LoadBlockIndex(): Genesis block hash incorrect: %s", pindexNew->ToString());
-
-                if (fParticlMode) {
-                    // only CheckProofOfWork for genesis blocks
-                    if (diskindex.hashPrev.IsNull() && !CheckProofOfWork(pindexNew->GetBlockHash(),
-                        pindexNew->nBits, Params().GetConsensus(), 0, Params().GetLastImportHeight()))
-                        return error("%s: CheckProofOfWork failed: %s", __func__, pindexNew->ToString());
-                } else
-                if (!CheckProofOfWork(pindexNew->GetBlockHash(), pindexNew->nBits, Params().GetConsensus())) {
-                    return error("%s: CheckProofOfWork failed: %s", __func__, pindexNew->ToString());
-                }
-
-                pcursor->Next();
-            } else {
+        entries.clear();
+        while (entries.size() < BLOCK_INDEX_LOAD_BATCH) {
+            std::pair<char, uint256> key;
+            if (!pcursor->Valid() || !pcursor->GetKey(key) || key.first != DB_BLOCK_INDEX) {
+                more = false;
+                break;
+            }
+            entries.emplace_back();
+            if (!pcursor->GetValue(entries.back())) {
                 return error("%s: failed to read value", __func__);
             }
-        } else {
-            break;
+            pcursor->Next();
+        }
+
+        hashes.resize(entries.size());
+        g_task_pool.ParallelFor(TaskPriority::HIGH, entries.size(), [&](size_t i) {
+            hashes[i] = entries[i].GetBlockHash();
+        });
+
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const CDiskBlockIndex& diskindex = entries[i];
+            // Construct block index object
+            CBlockIndex* pindexNew  = insertBlockIndex(hashes[i]);
+            pindexNew->pprev                    = insertBlockIndex(diskindex.hashPrev);
+            pindexNew->nHeight                  = diskindex.nHeight;
+            pindexNew->nFile                    = diskindex.nFile;
+            pindexNew->nDataPos                 = diskindex.nDataPos;
+            pindexNew->nUndoPos                 = diskindex.nUndoPos;
+            pindexNew->nVersion                 = diskindex.nVersion;
+            pindexNew->hashMerkleRoot           = diskindex.hashMerkleRoot;
+            pindexNew->hashWitnessMerkleRoot    = diskindex.hashWitnessMerkleRoot;
+            pindexNew->nTime                    = diskindex.nTime;
+            pindexNew->nBits                    = diskindex.nBits;
+            pindexNew->nNonce                   = diskindex.nNonce;
+            pindexNew->nStatus                  = diskindex.nStatus;
+            pindexNew->nTx                      = diskindex.nTx;
+
+            pindexNew->nFlags                   = diskindex.nFlags & (uint32_t)~BLOCK_DELAYED;
+            pindexNew->bnStakeModifier          = diskindex.bnStakeModifier;
+            pindexNew->prevoutStake             = diskindex.prevoutStake;
+            //pindexNew->hashProof                = diskindex.hashProof;
+
+            pindexNew->nMoneySupply             = diskindex.nMoneySupply;
+            pindexNew->nAnonOutputs             = diskindex.nAnonOutputs;
+
+
+            if (pindexNew->nHeight == 0
+                && hashes[i] != Params().GetConsensus().hashGenesisBlock)
+                return error("LoadBlockIndex(): Genesis block hash incorrect: %s", pindexNew->ToString());
+
+            if (fParticlMode) {
+                // only CheckProofOfWork for genesis blocks
+                if (diskindex.hashPrev.IsNull() && !CheckProofOfWork(hashes[i],
+                    pindexNew->nBits, Params().GetConsensus(), 0, Params().GetLastImportHeight()))
+                    return error("%s: CheckProofOfWork failed: %s", __func__, pindexNew->ToString());
+            } else
+            if (!CheckProofOfWork(hashes[i], pindexNew->nBits, Params().GetConsensus())) {
+                return error("%s: CheckProofOfWork failed: %s", __func__, pindexNew->ToString());
+            }
         }
     }
 
     return true;
 }
 
+static size_t RCTOutputCacheEntryUsage()
+{
+    // One list node and one hash map node per cached output
+    return memusage::MallocUsage(sizeof(std::pair<int64_t, CAnonOutput>) + 2 * sizeof(void*)) +
+           memusage::MallocUsage(sizeof(memusage::unordered_node<std::pair<const int64_t, void*> >));
+}
+
+size_t CBlockTreeDB::RCTOutputCacheUsageLocked() const
+{
+    return m_rct_cache_map.size() * RCTOutputCacheEntryUsage() +
+           memusage::MallocUsage(sizeof(void*) * m_rct_cache_map.bucket_count());
+}
+
+void CBlockTreeDB::TrimRCTOutputCache()
+{
+    while (!m_rct_cache_list.empty() && RCTOutputCacheUsageLocked() > m_rct_cache_max_usage) {
+        m_rct_cache_map.erase(m_rct_cache_list.back().first);
+        m_rct_cache_list.pop_back();
+    }
+}
+
+void CBlockTreeDB::AddRCTOutputToCache(int64_t i, const CAnonOutput &ao)
+{
+    if (m_rct_cache_max_usage == 0) {
+        return;
+    }
+    auto it = m_rct_cache_map.find(i);
+    if (it != m_rct_cache_map.end()) {
+        it->second->second = ao;
+        m_rct_cache_list.splice(m_rct_cache_list.begin(), m_rct_cache_list, it->second);
+        return;
+    }
+    m_rct_cache_list.emplace_front(i, ao);
+    m_rct_cache_map.emplace(i, m_rct_cache_list.begin());
+    TrimRCTOutputCache();
+}
+
+void CBlockTreeDB::SetRCTOutputCacheSize(size_t max_usage)
+{
+    LOCK(m_rct_cache_mutex);
+    m_rct_cache_max_usage = max_usage;
+    TrimRCTOutputCache();
+}
+
+size_t CBlockTreeDB::RCTOutputCacheUsage()
+{
+    LOCK(m_rct_cache_mutex);
+    return RCTOutputCacheUsageLocked();
+}
+
+size_t CBlockTreeDB::RCTOutputCacheCount()
+{
+    LOCK(m_rct_cache_mutex);
+    return m_rct_cache_map.size();
+}
+
+void CBlockTreeDB::RCTOutputCacheHits(uint64_t &hits, uint64_t &misses)
+{
+    LOCK(m_rct_cache_mutex);
+    hits = m_rct_cache_hits;
+    misses = m_rct_cache_misses;
+}
+
 bool CBlockTreeDB::ReadRCTOutput(int64_t i, CAnonOutput &ao)
 {
-    return Read(std::make_pair(DB_RCTOUTPUT, i), ao);
+    // Hold the cache lock over the db read so a concurrent erase can't leave a stale entry
+    LOCK(m_rct_cache_mutex);
+    auto it = m_rct_cache_map.find(i);
+    if (it != m_rct_cache_map.end()) {
+        m_rct_cache_list.splice(m_rct_cache_list.begin(), m_rct_cache_list, it->second);
+        ao = it->second->second;
+        m_rct_cache_hits++;
+        return true;
+    }
+    m_rct_cache_misses++;
+    if (!Read(std::make_pair(DB_RCTOUTPUT, i), ao)) {
+        return false;
+    }
+    AddRCTOutputToCache(i, ao);
+    return true;
+};
+
+bool CBlockTreeDB::ReadRCTOutputs(const std::vector<int64_t> &vIndices, std::vector<CAnonOutput> &vao)
+{
+    vao.resize(vIndices.size());
+    LOCK(m_rct_cache_mutex);
+    std::vector<std::pair<char, int64_t>> missed_keys;
+    std::vector<size_t> missed;
+    for (size_t k = 0; k < vIndices.size(); ++k) {
+        int64_t i = vIndices[k];
+        auto it = m_rct_cache_map.find(i);
+        if (it != m_rct_cache_map.end()) {
+            m_rct_cache_list.splice(m_rct_cache_list.begin(), m_rct_cache_list, it->second);
+            vao[k] = it->second->second;
+            m_rct_cache_hits++;
+            continue;
+        }
+        m_rct_cache_misses++;
+        missed_keys.emplace_back(DB_RCTOUTPUT, i);
+        missed.push_back(k);
+    }
+    if (missed.empty()) {
+        return true;
+    }
+
+    std::vector<CAnonOutput> missed_ao;
+    std::vector<bool> found;
+    if (ReadMany(missed_keys, missed_ao, found) != missed.size()) {
+        return false;
+    }
+    for (size_t m = 0; m < missed.size(); ++m) {
+        vao[missed[m]] = missed_ao[m];
+        AddRCTOutputToCache(missed_keys[m].second, missed_ao[m]);
+    }
+    return true;
+};
+
+bool CBlockTreeDB::ReadRCTOutputRange(int64_t first, size_t max_count, std::vector<CAnonOutput> &vao)
+{
+    vao.clear();
+    if (max_count == 0) {
+        return true;
+    }
+
+    // Keys are little endian, consecutive indices are not adjacent in the db.
+    // Visit the range in key order with one iterator, stepping with Next() and
+    // only seeking where another record lies between two indices of the range.
+    std::vector<std::pair<std::string, size_t>> keys(max_count);
+    for (size_t k = 0; k < max_count; ++k) {
+        CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+        ssKey << std::make_pair(DB_RCTOUTPUT, first + (int64_t)k);
+        keys[k] = std::make_pair(std::string(ssKey.begin(), ssKey.end()), k);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<CAnonOutput> range(max_count);
+    std::vector<bool> found(max_count, false);
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    bool at_previous = false;
+    for (const auto &k : keys) {
+        std::pair<char, int64_t> key = std::make_pair(DB_RCTOUTPUT, first + (int64_t)k.second), found_key;
+        if (at_previous) {
+            pcursor->Next();
+        }
+        if (!at_previous || !pcursor->Valid() || !pcursor->GetKey(found_key) || found_key != key) {
+            pcursor->Seek(key);
+        }
+        at_previous = pcursor->Valid() && pcursor->GetKey(found_key) && found_key == key;
+        if (!at_previous) {
+            continue;
+        }
+        if (!pcursor->GetValue(range[k.second])) {
+            return error("%s: failed to read value at %d", __func__, key.second);
+        }
+        found[k.second] = true;
+    }
+
+    // Stop at the first gap
+    for (size_t k = 0; k < max_count && found[k]; ++k) {
+        vao.push_back(std::move(range[k]));
+    }
+    return true;
 };
 
 bool CBlockTreeDB::WriteRCTOutput(int64_t i, const CAnonOutput &ao)
 {
+    LOCK(m_rct_cache_mutex);
     CDBBatch batch(*this);
     batch.Write(std::make_pair(DB_RCTOUTPUT, i), ao);
-    return WriteBatch(batch);
+    if (!WriteBatch(batch)) {
+        return false;
+    }
+    AddRCTOutputToCache(i, ao);
+    return true;
 };
 
 bool CBlockTreeDB::EraseRCTOutput(int64_t i)
 {
     CDBBatch batch(*this);
-    batch.Erase(std::make_pair(DB_RCTOUTPUT, i));
-    return WriteBatch(batch);
+    return WriteRCTOutputBatch(batch, {}, {i});
+};
+
+bool CBlockTreeDB::WriteRCTOutputBatch(CDBBatch &batch, const std::vector<std::pair<int64_t, CAnonOutput> > &vao, const std::vector<int64_t> &vErase)
+{
+    LOCK(m_rct_cache_mutex);
+    for (const auto i : vErase) {
+        auto it = m_rct_cache_map.find(i);
+        if (it != m_rct_cache_map.end()) {
+            m_rct_cache_list.erase(it->second);
+            m_rct_cache_map.erase(it);
+        }
+        batch.Erase(std::make_pair(DB_RCTOUTPUT, i));
+    }
+    for (const auto &it : vao) {
+        batch.Write(std::make_pair(DB_RCTOUTPUT, it.first), it.second);
+    }
+    if (!WriteBatch(batch)) {
+        return false;
+    }
+    for (const auto &it : vao) {
+        AddRCTOutputToCache(it.first, it.second);
+    }
+    return true;
 };
 
 
@@ -522,6 +1306,16 @@ bool CBlockTreeDB::ReadRCTOutputLink(const CCmpPubKey &pk, int64_t &i)
     return Read(std::make_pair(DB_RCTOUTPUT_LINK, pk), i);
 };
 
+void CBlockTreeDB::ReadRCTOutputLinks(const std::vector<CCmpPubKey> &vpk, std::vector<int64_t> &indices, std::vector<bool> &found)
+{
+    std::vector<std::pair<char, CCmpPubKey>> keys;
+    keys.reserve(vpk.size());
+    for (const auto &pk : vpk) {
+        keys.emplace_back(DB_RCTOUTPUT_LINK, pk);
+    }
+    ReadMany(keys, indices, found);
+};
+
 bool CBlockTreeDB::WriteRCTOutputLink(const CCmpPubKey &pk, int64_t i)
 {
     CDBBatch batch(*this);
@@ -536,81 +1330,319 @@ bool CBlockTreeDB::EraseRCTOutputLink(const CCmpPubKey &pk)
     return WriteBatch(batch);
 };
 
-bool CBlockTreeDB::ReadRCTKeyImage(const CCmpPubKey &ki, CAnonKeyImageInfo &data)
+namespace {
+//! Key image value as stored, versions before 0.19.2.15 store only the txid
+struct StoredKeyImageInfo
 {
-    // Versions before 0.19.2.15 store only the txid
-    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
-    if (!ReadStream(std::make_pair(DB_RCTKEYIMAGE, ki), ssValue)) {
-        return false;
-    }
-    try {
-        if (ssValue.size() < 36) {
-            ssValue >> data.txid;
+    CAnonKeyImageInfo data;
+
+    template<typename Stream>
+    void Unserialize(Stream &s)
+    {
+        if (s.size() < 36) {
+            s >> data.txid;
             data.height = -1; // unset
         } else {
-            ssValue >> data;
+            s >> data;
         }
-    } catch (const std::exception&) {
+    }
+};
+} // namespace
+
+void CBlockTreeDB::ReadRCTKeyImages(const std::vector<CCmpPubKey> &vki, std::vector<CAnonKeyImageInfo> &data, std::vector<bool> &found)
+{
+    std::vector<std::pair<char, CCmpPubKey>> keys;
+    keys.reserve(vki.size());
+    for (const auto &ki : vki) {
+        keys.emplace_back(DB_RCTKEYIMAGE, ki);
+    }
+    std::vector<StoredKeyImageInfo> values;
+    ReadMany(keys, values, found);
+    data.resize(vki.size());
+    for (size_t k = 0; k < vki.size(); ++k) {
+        data[k] = values[k].data;
+    }
+};
+
+bool CBlockTreeDB::ReadRCTKeyImage(const CCmpPubKey &ki, CAnonKeyImageInfo &data)
+{
+    StoredKeyImageInfo value;
+    if (!Read(std::make_pair(DB_RCTKEYIMAGE, ki), value)) {
         return false;
     }
+    data = value.data;
     return true;
 };
 
+namespace {
+
+//! Key images ordered by spend height, big endian so leveldb iterates them in height order
+struct RCTKeyImageHeightKey {
+    int height;
+    CCmpPubKey ki;
+
+    RCTKeyImageHeightKey() : height(0) {}
+    RCTKeyImageHeightKey(int height_in, const CCmpPubKey &ki_in) : height(height_in), ki(ki_in) {}
+
+    template<typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_RCTKEYIMAGE_HEIGHT);
+        ser_writedata32be(s, height);
+        s << ki;
+    }
+
+    template<typename Stream>
+    void Unserialize(Stream& s)
+    {
+        char prefix = ser_readdata8(s);
+        if (prefix != DB_RCTKEYIMAGE_HEIGHT) {
+            throw std::ios_base::failure("Invalid format for key image height key");
+        }
+        height = ser_readdata32be(s);
+        s >> ki;
+    }
+};
+
+//! Spent cache outpoints ordered by spend height, pruning the window walks the lowest heights
+struct SpentCacheHeightKey {
+    int height;
+    COutPoint outpoint;
+
+    SpentCacheHeightKey() : height(0) {}
+    SpentCacheHeightKey(int height_in, const COutPoint &outpoint_in) : height(height_in), outpoint(outpoint_in) {}
+
+    template<typename Stream>
+    void Serialize(Stream& s) const
+    {
+        ser_writedata8(s, DB_SPENTCACHE_HEIGHT);
+        ser_writedata32be(s, height);
+        s << outpoint;
+    }
+
+    template<typename Stream>
+    void Unserialize(Stream& s)
+    {
+        char prefix = ser_readdata8(s);
+        if (prefix != DB_SPENTCACHE_HEIGHT) {
+            throw std::ios_base::failure("Invalid format for spent cache height key");
+        }
+        height = ser_readdata32be(s);
+        s >> outpoint;
+    }
+};
+
+} // namespace
+
+void CBlockTreeDB::WriteRCTKeyImage(CDBBatch &batch, const CCmpPubKey &ki, const CAnonKeyImageInfo &data)
+{
+    batch.Write(std::make_pair(DB_RCTKEYIMAGE, ki), data);
+    if (data.height >= 0) {
+        batch.Write(RCTKeyImageHeightKey(data.height, ki), uint8_t{0});
+    }
+};
+
+void CBlockTreeDB::EraseRCTKeyImage(CDBBatch &batch, const CCmpPubKey &ki)
+{
+    CAnonKeyImageInfo data;
+    if (ReadRCTKeyImage(ki, data) && data.height >= 0) {
+        batch.Erase(RCTKeyImageHeightKey(data.height, ki));
+    }
+    batch.Erase(std::make_pair(DB_RCTKEYIMAGE, ki));
+};
+
 bool CBlockTreeDB::EraseRCTKeyImage(const CCmpPubKey &ki)
 {
     CDBBatch batch(*this);
-    batch.Erase(std::make_pair(DB_RCTKEYIMAGE, ki));
+    EraseRCTKeyImage(batch, ki);
     return WriteBatch(batch);
 };
 
-bool CBlockTreeDB::EraseRCTKeyImagesAfterHeight(int height)
+bool CBlockTreeDB::EraseRCTKeyImagesAfterHeight(int height, size_t *num_erased)
 {
     CDBBatch batch(*this);
-    size_t total = 0, removing = 0;
+    size_t removing = 0;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(RCTKeyImageHeightKey(std::max(0, height + 1), CCmpPubKey()));
+
+    RCTKeyImageHeightKey key;
+    while (pcursor->Valid() && pcursor->GetKey(key)) {
+        if (ShutdownRequested()) return false;
+        batch.Erase(std::make_pair(DB_RCTKEYIMAGE, key.ki));
+        batch.Erase(key);
+        removing++;
+        if (batch.SizeEstimate() > (size_t)nDefaultDbBatchSize) {
+            if (!WriteBatch(batch)) {
+                return error("%s: WriteBatch failed", __func__);
+            }
+            batch.Clear();
+            LogPrintf("Removed %d key images after height %d, reached height %d.\n", removing, height, key.height);
+        }
+        pcursor->Next();
+    }
+
+    LogPrintf("Removing %d key images after height %d.\n", removing, height);
+    if (num_erased) {
+        *num_erased = removing;
+    }
+    if (batch.SizeEstimate() == 0) {
+        return true;
+    }
+    return WriteBatch(batch);
+};
+
+bool CBlockTreeDB::UpgradeRCTKeyImageHeights()
+{
+    bool fUpgraded = false;
+    if (ReadFlag("rctkeyimageheights", fUpgraded) && fUpgraded) {
+        return true;
+    }
+
+    LogPrintf("Indexing key images by height...\n");
+    CDBBatch batch(*this);
+    size_t total = 0, indexed = 0;
     std::unique_ptr<CDBIterator> pcursor(NewIterator());
     pcursor->Seek(std::make_pair(DB_RCTKEYIMAGE, CCmpPubKey()));
 
     while (pcursor->Valid()) {
         if (ShutdownRequested()) return false;
         std::pair<char, CCmpPubKey> key;
-        if (pcursor->GetKey(key) && key.first == DB_RCTKEYIMAGE) {
+        if (!pcursor->GetKey(key) || key.first != DB_RCTKEYIMAGE) {
+            break;
+        }
+        total++;
+        // Versions before 0.19.2.15 store only the txid
+        if (pcursor->GetValueSize() >= 36) {
             CAnonKeyImageInfo ki_data;
-            total++;
-            if (pcursor->GetValueSize() >= 36) {
-                if (pcursor->GetValue(ki_data)) {
-                    if (height < ki_data.height) {
-                        removing++;
-                        batch.Erase(std::make_pair(DB_RCTKEYIMAGE, key.second));
-                    }
-                } else {
-                    return error("%s: failed to read value", __func__);
-                }
+            if (!pcursor->GetValue(ki_data)) {
+                return error("%s: failed to read value", __func__);
             }
-            pcursor->Next();
-        } else {
-            break;
+            batch.Write(RCTKeyImageHeightKey(ki_data.height, key.second), uint8_t{0});
+            indexed++;
+        }
+        if (batch.SizeEstimate() > (size_t)nDefaultDbBatchSize) {
+            if (!WriteBatch(batch)) {
+                return error("%s: WriteBatch failed", __func__);
+            }
+            batch.Clear();
         }
+        pcursor->Next();
     }
 
-    LogPrintf("Removing %d key images after height %d, total %d.\n", removing, height, total);
-    if (removing < 1) {
-        return true;
+    LogPrintf("Indexed %d of %d key images by height.\n", indexed, total);
+    if (!WriteBatch(batch)) {
+        return error("%s: WriteBatch failed", __func__);
     }
-    return WriteBatch(batch);
+    return WriteFlag("rctkeyimageheights", true);
 };
 
 bool CBlockTreeDB::ReadSpentCache(const COutPoint &outpoint, SpentCoin &coin)
 {
+    {
+        LOCK(m_spent_cache_mutex);
+        auto it = m_spent_front.find(outpoint);
+        if (it != m_spent_front.end()) {
+            coin = it->second;
+            return true;
+        }
+    }
     return Read(std::make_pair(DB_SPENTCACHE, outpoint), coin);
 };
 
+void CBlockTreeDB::WriteSpentCache(CDBBatch &batch, const COutPoint &outpoint, const SpentCoin &coin)
+{
+    batch.Write(std::make_pair(DB_SPENTCACHE, outpoint), coin);
+    batch.Write(SpentCacheHeightKey(coin.spent_height, outpoint), uint8_t{0});
+
+    LOCK(m_spent_cache_mutex);
+    m_spent_front[outpoint] = coin;
+    m_spent_front_heights[coin.spent_height].push_back(outpoint);
+    while (m_spent_front_heights.size() > 1 &&
+           m_spent_front_heights.begin()->first <= m_spent_front_heights.rbegin()->first - SPENT_CACHE_FRONT_HEIGHTS) {
+        for (const auto &op : m_spent_front_heights.begin()->second) {
+            m_spent_front.erase(op);
+        }
+        m_spent_front_heights.erase(m_spent_front_heights.begin());
+    }
+};
+
+void CBlockTreeDB::EraseSpentCache(CDBBatch &batch, const COutPoint &outpoint, const SpentCoin &coin)
+{
+    batch.Erase(std::make_pair(DB_SPENTCACHE, outpoint));
+    batch.Erase(SpentCacheHeightKey(coin.spent_height, outpoint));
+
+    LOCK(m_spent_cache_mutex);
+    // Entries are only looked up through m_spent_front, stale outpoints left in m_spent_front_heights are harmless
+    m_spent_front.erase(outpoint);
+};
+
 bool CBlockTreeDB::EraseSpentCache(const COutPoint &outpoint)
 {
     CDBBatch batch(*this);
-    batch.Erase(std::make_pair(DB_SPENTCACHE, outpoint));
+    SpentCoin coin;
+    if (ReadSpentCache(outpoint, coin)) {
+        EraseSpentCache(batch, outpoint, coin);
+    } else {
+        batch.Erase(std::make_pair(DB_SPENTCACHE, outpoint));
+    }
     return WriteBatch(batch);
 };
 
+void CBlockTreeDB::PruneSpentCache(CDBBatch &batch, int height)
+{
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(SpentCacheHeightKey(0, COutPoint()));
+
+    SpentCacheHeightKey key;
+    while (pcursor->Valid() && pcursor->GetKey(key) && key.height <= height) {
+        batch.Erase(std::make_pair(DB_SPENTCACHE, key.outpoint));
+        batch.Erase(key);
+        pcursor->Next();
+    }
+
+    LOCK(m_spent_cache_mutex);
+    while (!m_spent_front_heights.empty() && m_spent_front_heights.begin()->first <= height) {
+        for (const auto &op : m_spent_front_heights.begin()->second) {
+            m_spent_front.erase(op);
+        }
+        m_spent_front_heights.erase(m_spent_front_heights.begin());
+    }
+};
+
+bool CBlockTreeDB::UpgradeSpentCacheHeights()
+{
+    bool fUpgraded = false;
+    if (ReadFlag("spentcacheheights", fUpgraded) && fUpgraded) {
+        return true;
+    }
+
+    CDBBatch batch(*this);
+    size_t indexed = 0;
+    std::unique_ptr<CDBIterator> pcursor(NewIterator());
+    pcursor->Seek(std::make_pair(DB_SPENTCACHE, COutPoint()));
+
+    while (pcursor->Valid()) {
+        if (ShutdownRequested()) return false;
+        std::pair<char, COutPoint> key;
+        if (!pcursor->GetKey(key) || key.first != DB_SPENTCACHE) {
+            break;
+        }
+        SpentCoin coin;
+        if (!pcursor->GetValue(coin)) {
+            return error("%s: failed to read value", __func__);
+        }
+        batch.Write(SpentCacheHeightKey(coin.spent_height, key.second), uint8_t{0});
+        indexed++;
+        pcursor->Next();
+    }
+
+    LogPrintf("Indexed %d spent cache entries by height.\n", indexed);
+    if (!WriteBatch(batch)) {
+        return error("%s: WriteBatch failed", __func__);
+    }
+    return WriteFlag("spentcacheheights", true);
+};
+
 bool CBlockTreeDB::EraseRewardTrackerUndo(int nHeight)
 {
     CDBBatch batch(*this);
@@ -622,7 +1654,7 @@ bool CBlockTreeDB::EraseRewardTrackerUndo(int nHeight)
 bool CBlockTreeDB::ReadRewardTrackerUndo(ColdRewardUndo& rewardUndo, int nHeight)
 {
 
-    const std::unique_ptr<CDBIterator> pcursor(pblocktree->NewIterator());
+    const std::unique_ptr<CDBIterator> pcursor(NewIterator());
 
     pcursor->Seek(std::make_pair(DB_TRACKER_INPUTS_UNDO, std::vector<std::pair<AddressType, CAmount>>()));
 
@@ -665,7 +1697,12 @@ bool CBlockTreeDB::ReadRewardTrackerUndo(ColdRewardUndo& rewardUndo, int nHeight
 bool CBlockTreeDB::WriteRewardTrackerUndo(const ColdRewardUndo& rewardUndo)
 {
     CDBBatch batch(*this);
+    WriteRewardTrackerUndo(batch, rewardUndo);
+    return WriteBatch(batch);
+}
 
+void CBlockTreeDB::WriteRewardTrackerUndo(CDBBatch &batch, const ColdRewardUndo& rewardUndo)
+{
     for (const auto& inputs: rewardUndo.inputs) {
         batch.Write(std::make_pair(DB_TRACKER_INPUTS_UNDO, inputs.first), inputs.second);
     }
@@ -673,16 +1710,17 @@ bool CBlockTreeDB::WriteRewardTrackerUndo(const ColdRewardUndo& rewardUndo)
     for (const auto& outputs: rewardUndo.outputs) {
         batch.Write(std::make_pair(DB_TRACKER_OUTPUTS_UNDO, outputs.first), outputs.second);
     }
-
-    return WriteBatch(batch);
 }
 
 bool CBlockTreeDB::WriteLastTrackedHeight(std::int64_t lastHeight) {
     CDBBatch batch(*this);
-    LogPrintf("%s Writting last tracked height %d\n", __func__, lastHeight);
+    WriteLastTrackedHeight(batch, lastHeight);
+    return WriteBatch(batch);
+}
 
+void CBlockTreeDB::WriteLastTrackedHeight(CDBBatch &batch, std::int64_t lastHeight) {
+    LogPrintf("%s Writting last tracked height %d\n", __func__, lastHeight);
     batch.Write(std::make_pair(DB_LAST_TRACKED_HEIGHT, 0), lastHeight);
-    return WriteBatch(batch);
 }
 
 bool CBlockTreeDB::ReadLastTrackedHeight(std::int64_t& rv) {
@@ -696,6 +1734,167 @@ bool CBlockTreeDB::EraseLastTrackedHeight() {
     return WriteBatch(batch);
 }
 
+template <typename K>
+static bool ErasePrefix(CDBWrapper &db, CDBBatch &batch, char prefix, size_t &num_erased)
+{
+    std::unique_ptr<CDBIterator> pcursor(db.NewIterator());
+    pcursor->Seek(prefix);
+
+    std::pair<char, K> key;
+    while (pcursor->Valid() && pcursor->GetKey(key) && key.first == prefix) {
+        if (ShutdownRequested()) return false;
+        batch.Erase(key);
+        num_erased++;
+        if (batch.SizeEstimate() > (size_t)nDefaultDbBatchSize) {
+            if (!db.WriteBatch(batch)) {
+                return error("%s: WriteBatch failed", __func__);
+            }
+            batch.Clear();
+        }
+        pcursor->Next();
+    }
+    return true;
+}
+
+bool CBlockTreeDB::EraseRewardTrackerData()
+{
+    CDBBatch batch(*this);
+    size_t num_erased = 0;
+    if (!ErasePrefix<AddressType>(*this, batch, DB_GVR_RANGE, num_erased) ||
+        !ErasePrefix<AddressType>(*this, batch, DB_GVR_BALANCE, num_erased) ||
+        !ErasePrefix<int>(*this, batch, DB_TRACKER_INPUTS_UNDO, num_erased) ||
+        !ErasePrefix<int>(*this, batch, DB_TRACKER_OUTPUTS_UNDO, num_erased) ||
+        !ErasePrefix<int>(*this, batch, DB_LAST_TRACKED_HEIGHT, num_erased)) {
+        return false;
+    }
+    LogPrintf("Erasing %d reward tracker records.\n", num_erased);
+    return WriteBatch(batch);
+}
+
+namespace {
+
+//! The remainder of a database key or value, copied unchanged
+struct RawDBData
+{
+    std::vector<unsigned char> m_data;
+
+    template <typename Stream>
+    void Serialize(Stream &s) const
+    {
+        s.write((const char*)m_data.data(), m_data.size());
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream &s)
+    {
+        m_data.resize(s.size());
+        s.read((char*)m_data.data(), m_data.size());
+    }
+};
+
+//! Copy the records of the insight index prefixes, overwriting existing keys
+bool CopyInsightData(CDBWrapper &from, CDBWrapper &to)
+{
+    CDBBatch batch(to);
+    size_t count = 0;
+    std::pair<char, RawDBData> key;
+    RawDBData value;
+    for (const char prefix : INSIGHT_DB_PREFIXES) {
+        std::unique_ptr<CDBIterator> pcursor(from.NewIterator());
+        for (pcursor->Seek(prefix); pcursor->Valid(); pcursor->Next()) {
+            if (ShutdownRequested()) return false;
+            if (!pcursor->GetKey(key) || key.first != prefix) {
+                break;
+            }
+            if (!pcursor->GetValue(value)) {
+                return error("%s: failed to read value", __func__);
+            }
+            batch.Write(key, value);
+            count++;
+            if (batch.SizeEstimate() > (size_t)nDefaultDbBatchSize) {
+                if (!to.WriteBatch(batch)) {
+                    return error("%s: WriteBatch failed", __func__);
+                }
+                batch.Clear();
+                LogPrintf("Moved %d insight index records\n", count);
+            }
+        }
+    }
+    if (!to.WriteBatch(batch, true)) {
+        return error("%s: WriteBatch failed", __func__);
+    }
+    LogPrintf("Moved %d insight index records\n", count);
+    return true;
+}
+
+bool EraseInsightData(CDBWrapper &db)
+{
+    CDBBatch batch(db);
+    size_t num_erased = 0;
+    for (const char prefix : INSIGHT_DB_PREFIXES) {
+        if (!ErasePrefix<RawDBData>(db, batch, prefix, num_erased)) {
+            return false;
+        }
+    }
+    if (num_erased == 0) {
+        return true;
+    }
+    if (!db.WriteBatch(batch)) {
+        return error("%s: WriteBatch failed", __func__);
+    }
+    LogPrintf("Erased %d moved insight index records.\n", num_erased);
+    for (const char prefix : INSIGHT_DB_PREFIXES) {
+        db.CompactPrefix(prefix);
+    }
+    return true;
+}
+
+} // namespace
+
+bool CBlockTreeDB::OpenInsightDB(bool fSplit, const fs::path &path, size_t nCacheSize)
+{
+    m_insight_db.reset();
+    std::string stored_path;
+    const bool fWasSplit = Read(std::make_pair(DB_FLAG, INSIGHT_DB_PATH_FLAG), stored_path);
+
+    if (fSplit) {
+        if (fWasSplit && fs::path(stored_path) != path) {
+            return error("%s: The insight indexes are in %s, move the directory or set -insightdbdir to it", __func__, stored_path);
+        }
+        // A database left by an interrupted or reverted move is wiped before copying
+        m_insight_db = MakeUnique<CDBWrapper>(path, nCacheSize, false, !fWasSplit, false, true);
+        if (!fWasSplit) {
+            LogPrintf("Moving the insight indexes to %s...\n", path.string());
+            if (!CopyInsightData(*this, *m_insight_db) ||
+                !Write(std::make_pair(DB_FLAG, INSIGHT_DB_PATH_FLAG), path.string(), true)) {
+                m_insight_db.reset();
+                return error("%s: Failed to move the insight indexes", __func__);
+            }
+        }
+        // Also completes erasing after an interrupted move
+        return EraseInsightData(*this);
+    }
+
+    if (!fWasSplit) {
+        return true;
+    }
+    if (!fs::exists(stored_path)) {
+        return error("%s: The insight index database %s is missing", __func__, stored_path);
+    }
+    {
+        CDBWrapper insight_db(stored_path, nCacheSize, false, false, false, true);
+        LogPrintf("Moving the insight indexes back from %s...\n", stored_path);
+        // Clear what an interrupted move back left
+        if (!EraseInsightData(*this) ||
+            !CopyInsightData(insight_db, *this) ||
+            !Erase(std::make_pair(DB_FLAG, INSIGHT_DB_PATH_FLAG), true)) {
+            return error("%s: Failed to move the insight indexes", __func__);
+        }
+    }
+    fs::remove_all(stored_path);
+    return true;
+}
+
 
 bool CCoinsViewDB::Upgrade()
 {
@@ -13,12 +13,19 @@
 #include <insight/spentindex.h>
 #include <insight/timestampindex.h>
 #include <insight/balanceindex.h>
+#include <insight/rewardindex.h>
+#include <insight/insight.h>
 #include <rctindex.h>
 #include <primitives/block.h>
 
 #include "coldreward/coldrewardtracker.h"
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -29,7 +36,9 @@ class uint256;
 const char DB_RCTOUTPUT = 'A';
 const char DB_RCTOUTPUT_LINK = 'L';
 const char DB_RCTKEYIMAGE = 'K';
+const char DB_RCTKEYIMAGE_HEIGHT = 'k';
 const char DB_SPENTCACHE = 'S';
+const char DB_SPENTCACHE_HEIGHT = 'Q';
 const char DB_GVR_RANGE = 'g';
 const char DB_GVR_BALANCE = 'v';
 const char DB_GVR_CHECKPOINT = 'r';
@@ -55,6 +64,15 @@ static const int64_t nMaxTxIndexCache = 1024;
 static const int64_t max_filter_index_cache = 1024;
 //! Max memory allocated to coin DB specific cache (MiB)
 static const int64_t nMaxCoinsDBCache = 8;
+//! -rctindexcache default (MiB)
+static const int64_t DEFAULT_RCTINDEX_CACHE = 16;
+//! -insightdb default
+static const bool DEFAULT_INSIGHTDB = false;
+//! Number of most recent heights of spent cache entries kept in memory
+static const int SPENT_CACHE_FRONT_HEIGHTS = 64;
+//! -utxoscanthreads default, 0 = one per core
+static const int DEFAULT_UTXO_SCAN_THREADS = 0;
+static const int MAX_UTXO_SCAN_THREADS = 16;
 
 // Actually declared in validation.cpp; can't include because of circular dependency.
 extern RecursiveMutex cs_main;
@@ -66,6 +84,15 @@ protected:
     std::unique_ptr<CDBWrapper> m_db;
     fs::path m_ldb_path;
     bool m_is_memory;
+
+    //! Background writeback state, see BeginWriteback
+    Mutex m_writeback_mutex;
+    std::condition_variable m_writeback_cv;
+    bool m_writeback_pending GUARDED_BY(m_writeback_mutex){false};
+    bool m_writeback_failed GUARDED_BY(m_writeback_mutex){false};
+    bool m_partial_written GUARDED_BY(m_writeback_mutex){false};
+
+    uint256 GetTransitionBase() const;
 public:
     /**
      * @param[in] ldb_path    Location in the filesystem where leveldb data will be stored.
@@ -79,6 +106,32 @@ public:
     bool BatchWrite(CCoinsMap &mapCoins, const uint256 &hashBlock) override;
     CCoinsViewCursor *Cursor() const override;
 
+    /**
+     * A batch of coins was taken from the cache to be written in the background,
+     * BatchWrite waits for EndWriteback so that newer versions of the coins
+     * aren't overwritten.
+     */
+    void BeginWriteback();
+    void EndWriteback(bool ok);
+    /**
+     * Write a batch taken from a cache at hashBlock, leaving the database in
+     * transition to hashBlock as BatchWrite does while it writes. The next
+     * BatchWrite completes the transition, ReplayBlocks after a crash.
+     */
+    bool BatchWritePartial(const CCoinsMap &mapCoins, const uint256 &hashBlock);
+    //! Whether BatchWritePartial wrote coins since the last BatchWrite
+    bool HasPartialWrites();
+
+    /**
+     * Visit every coin of one snapshot of the database on n_threads threads.
+     * The txid space is split into n_ranges ranges of increasing txids, so all outputs of a tx are
+     * visited in order by one call to fn with the same range index, callers keep state per range.
+     * range_done is called after a range has been walked. Returns false if fn returned false or
+     * shutdown was requested, hashBlock is set to the best block of the snapshot.
+     */
+    bool ForEachCoinParallel(size_t n_ranges, int n_threads, const std::function<bool(size_t, const COutPoint&, const Coin&)> &fn,
+                             const std::function<void(size_t)> &range_done, uint256 &hashBlock) const;
+
     //! Attempt to update from an older database format. Returns whether an error occurred.
     bool Upgrade();
     size_t EstimateSize() const override;
@@ -109,9 +162,47 @@ private:
     friend class CCoinsViewDB;
 };
 
+//! Number of threads to scan the coins database with, from -utxoscanthreads
+int GetUTXOScanThreads();
+
 /** Access to the block database (blocks/index/) */
 class CBlockTreeDB : public CDBWrapper
 {
+private:
+    typedef std::list<std::pair<int64_t, CAnonOutput> > RCTOutputCacheList;
+
+    //! Least recently used anon outputs, front is most recent
+    Mutex m_rct_cache_mutex;
+    size_t m_rct_cache_max_usage GUARDED_BY(m_rct_cache_mutex) = DEFAULT_RCTINDEX_CACHE << 20;
+    RCTOutputCacheList m_rct_cache_list GUARDED_BY(m_rct_cache_mutex);
+    std::unordered_map<int64_t, RCTOutputCacheList::iterator> m_rct_cache_map GUARDED_BY(m_rct_cache_mutex);
+    uint64_t m_rct_cache_hits GUARDED_BY(m_rct_cache_mutex) = 0;
+    uint64_t m_rct_cache_misses GUARDED_BY(m_rct_cache_mutex) = 0;
+
+    void AddRCTOutputToCache(int64_t i, const CAnonOutput &ao) EXCLUSIVE_LOCKS_REQUIRED(m_rct_cache_mutex);
+    void TrimRCTOutputCache() EXCLUSIVE_LOCKS_REQUIRED(m_rct_cache_mutex);
+    size_t RCTOutputCacheUsageLocked() const EXCLUSIVE_LOCKS_REQUIRED(m_rct_cache_mutex);
+
+    //! The insight indexes when kept in their own database, see OpenInsightDB
+    std::unique_ptr<CDBWrapper> m_insight_db;
+    CDBWrapper &InsightDB() { return m_insight_db ? *m_insight_db : *this; }
+
+    //! Write batch of an insight index, recording its size and write time
+    bool WriteInsightBatch(CDBBatch &batch, InsightStatsType type, size_t nKeys);
+    bool UpdateAddressBalances(CDBBatch &batch, const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect, bool fErase);
+    //! Height of the newest address index entry of the address below below_height, 0 if none
+    int ReadLastAddressIndexHeight(const CAddressIndexIteratorKey &key, int below_height);
+
+    //! Spent cache entries of the most recent heights, GetKernelInfo looks these up constantly
+    Mutex m_spent_cache_mutex;
+    std::map<int, std::vector<COutPoint> > m_spent_front_heights GUARDED_BY(m_spent_cache_mutex);
+    std::unordered_map<COutPoint, SpentCoin, SaltedOutpointHasher> m_spent_front GUARDED_BY(m_spent_cache_mutex);
+
+    //! Serialises assigning short address ids
+    Mutex m_address_id_mutex;
+    //! Add the entries in the compact encoding to batch, assigning ids to new addresses
+    bool WriteAddressIndexV2(CDBBatch &batch, const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect) EXCLUSIVE_LOCKS_REQUIRED(m_address_id_mutex);
+
 public:
     explicit CBlockTreeDB(size_t nCacheSize, bool fMemory = false, bool fWipe = false, bool compression = true, int maxOpenFiles = 1000);
 
@@ -121,6 +212,17 @@ public:
     bool WriteReindexing(bool fReindexing);
     void ReadReindexing(bool &fReindexing);
 
+    /**
+     * Keep the address, spent, timestamp, balances and vote indexes in their own database at path when fSplit is set,
+     * or in this one otherwise. The index data is moved over on the first start after the setting changes,
+     * moving back reads the database recorded when the indexes were split off.
+     */
+    bool OpenInsightDB(bool fSplit, const fs::path &path, size_t nCacheSize);
+    //! The separate insight index database, null when the insight indexes are kept in this one
+    CDBWrapper *GetInsightDB() { return m_insight_db.get(); }
+    //! Database holding the keys of prefix
+    CDBWrapper &GetDBForPrefix(uint8_t prefix);
+
     bool ReadSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value);
     bool UpdateSpentIndex(const std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> >&vect);
     bool UpdateAddressUnspentIndex(const std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue > >&vect);
@@ -128,46 +230,125 @@ public:
                                  std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > &vect);
     bool WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect);
     bool EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> > &vect);
+    //! Read the running totals of an address, maintained with the address index when fAddressBalanceIndex is set
+    bool ReadAddressBalance(const CAddressIndexIteratorKey &key, CAddressBalanceValue &value);
     bool ReadAddressIndex(uint256 addressHash, int type,
                           std::vector<std::pair<CAddressIndexKey, CAmount> > &addressIndex,
                           int start = 0, int end = 0);
+    //! Walk the address index entries of the address in start_key from its height and txindex on, until fn returns false
+    bool ForEachAddressIndex(const CAddressIndexIteratorTxKey &start_key, const std::function<bool(const CAddressIndexKey&, CAmount)> &fn);
+    /**
+     * Switch a legacy address index to the compact encoding when fMigrate is set and convert any
+     * remaining legacy entries, resuming an interrupted migration. Sets fAddressIndexV2.
+     */
+    bool UpgradeAddressIndex(bool fMigrate);
+    /**
+     * Read the layout of stored coins and undo data, taking the current layout when fRebuilt is
+     * set for a chainstate built from scratch. Sets fCompactCoins, fails for an unknown layout.
+     */
+    bool LoadCoinsFormat(bool fRebuilt);
+    //! Walk the unspent outputs of the address in start_key from its txhash and index on, until fn returns false
+    bool ForEachAddressUnspent(const CAddressUnspentKey &start_key, const std::function<bool(const CAddressUnspentKey&, const CAddressUnspentValue&)> &fn);
     bool WriteTimestampIndex(const CTimestampIndexKey &timestampIndex);
     bool ReadTimestampIndex(const unsigned int &high, const unsigned int &low, const bool fActiveOnly, std::vector<std::pair<uint256, unsigned int> > &vect) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+    //! Walk the timestamp index entries in [low, high) in timestamp order until fn returns false, doesn't need cs_main
+    bool ForEachTimestampIndex(unsigned int low, unsigned int high, const std::function<bool(const CTimestampIndexKey&)> &fn);
     bool WriteTimestampBlockIndex(const CTimestampBlockIndexKey &blockhashIndex, const CTimestampBlockIndexValue &logicalts);
     bool ReadTimestampBlockIndex(const uint256 &hash, unsigned int &logicalTS);
 
     bool WriteBlockBalancesIndex(const uint256 &key, const BlockBalances &value);
     bool ReadBlockBalancesIndex(const uint256 &key, BlockBalances &value);
 
+    bool WriteBlockVoteIndex(const uint256 &key, uint32_t vote_token);
+    bool ReadBlockVoteIndex(const uint256 &key, uint32_t &vote_token);
+
+    bool WriteBlockRewardIndex(const uint256 &key, const BlockRewardSummary &value);
+    bool ReadBlockRewardIndex(const uint256 &key, BlockRewardSummary &value);
+
     bool WriteFlag(const std::string &name, bool fValue);
     bool ReadFlag(const std::string &name, bool &fValue);
     bool LoadBlockIndexGuts(const Consensus::Params& consensusParams, std::function<CBlockIndex*(const uint256&)> insertBlockIndex);
 
 
     bool ReadRCTOutput(int64_t i, CAnonOutput &ao);
+    //! Look up several anon outputs under one cache lock, the misses are read together, fails if any is missing
+    bool ReadRCTOutputs(const std::vector<int64_t> &vIndices, std::vector<CAnonOutput> &vao);
+    /**
+     * Read up to max_count consecutive anon outputs from index first, stopping at the first missing index.
+     * Served from one db iterator so the range is a consistent snapshot, bypasses the cache.
+     */
+    bool ReadRCTOutputRange(int64_t first, size_t max_count, std::vector<CAnonOutput> &vao);
     bool WriteRCTOutput(int64_t i, const CAnonOutput &ao);
     bool EraseRCTOutput(int64_t i);
 
+    /**
+     * Add the anon output writes and erasures to batch, which may already hold
+     * other rct index changes, and commit it in one write.
+     * The anon output cache is updated with the batch.
+     */
+    bool WriteRCTOutputBatch(CDBBatch &batch, const std::vector<std::pair<int64_t, CAnonOutput> > &vao, const std::vector<int64_t> &vErase);
+
+    //! Set the memory limit of the anon output cache, 0 disables the cache
+    void SetRCTOutputCacheSize(size_t max_usage);
+    size_t RCTOutputCacheUsage();
+    size_t RCTOutputCacheCount();
+    void RCTOutputCacheHits(uint64_t &hits, uint64_t &misses);
+
+    //! Name of the data stored under a key prefix, empty if unknown
+    static std::string GetPrefixName(uint8_t prefix);
+
     bool ReadRCTOutputLink(const CCmpPubKey &pk, int64_t &i);
+    /**
+     * Look up the indices of several anon output public keys from one db iterator, in key order.
+     * found[k] is set when vpk[k] is indexed.
+     */
+    void ReadRCTOutputLinks(const std::vector<CCmpPubKey> &vpk, std::vector<int64_t> &indices, std::vector<bool> &found);
     bool WriteRCTOutputLink(const CCmpPubKey &pk, int64_t i);
     bool EraseRCTOutputLink(const CCmpPubKey &pk);
 
     bool ReadRCTKeyImage(const CCmpPubKey &ki, CAnonKeyImageInfo &data);
+    /**
+     * Look up several key images from one db iterator, in key order so the reads walk the db forward
+     * over a consistent snapshot. found[k] is set when vki[k] is spent in the chain.
+     */
+    void ReadRCTKeyImages(const std::vector<CCmpPubKey> &vki, std::vector<CAnonKeyImageInfo> &data, std::vector<bool> &found);
+    //! Add the key image and its height ordered secondary key to batch
+    void WriteRCTKeyImage(CDBBatch &batch, const CCmpPubKey &ki, const CAnonKeyImageInfo &data);
+    //! Add erasing the key image and its height ordered secondary key to batch
+    void EraseRCTKeyImage(CDBBatch &batch, const CCmpPubKey &ki);
     bool EraseRCTKeyImage(const CCmpPubKey &ki);
-    bool EraseRCTKeyImagesAfterHeight(int height);
+    /**
+     * Erase the key images spent above height by walking the height ordered keys.
+     * Erasures are written in batches of nDefaultDbBatchSize.
+     */
+    bool EraseRCTKeyImagesAfterHeight(int height, size_t *num_erased = nullptr);
+    //! Add the height ordered key image keys missing from databases written by older versions
+    bool UpgradeRCTKeyImageHeights();
 
     bool ReadSpentCache(const COutPoint &outpoint, SpentCoin &coin);
+    //! Add the spent coin and its height ordered key to batch
+    void WriteSpentCache(CDBBatch &batch, const COutPoint &outpoint, const SpentCoin &coin);
+    void EraseSpentCache(CDBBatch &batch, const COutPoint &outpoint, const SpentCoin &coin);
     bool EraseSpentCache(const COutPoint &outpoint);
+    //! Add erasing the spent coins of all heights up to and including height to batch
+    void PruneSpentCache(CDBBatch &batch, int height);
+    //! Add the height ordered spent cache keys missing from databases written by older versions
+    bool UpgradeSpentCacheHeights();
 
     bool WriteRewardTrackerUndo(const ColdRewardUndo& ro);
+    void WriteRewardTrackerUndo(CDBBatch &batch, const ColdRewardUndo& ro);
     bool ReadRewardTrackerUndo(ColdRewardUndo& ro, int nHeight);
     bool EraseRewardTrackerUndo(int nHeight);
 
     bool WriteLastTrackedHeight(std::int64_t lastHeight);
+    void WriteLastTrackedHeight(CDBBatch &batch, std::int64_t lastHeight);
     bool ReadLastTrackedHeight(std::int64_t& rv);
     bool EraseLastTrackedHeight();
-
-    //bool WriteRCTOutputBatch(std::vector<std::pair<int64_t, CAnonOutput> > &vao);
+    /**
+     * Erase the tracked balances, ranges, undo data and last tracked height by walking their key prefixes.
+     * Erasures are written in batches of nDefaultDbBatchSize.
+     */
+    bool EraseRewardTrackerData();
 };
 
 #endif // BITCOIN_TXDB_H
@@ -24,10 +24,18 @@
 #include <anon.h>
 #include <chainparams.h>
 
+static std::vector<CCmpPubKey> ExtractKeyImages(const CTransaction &tx, bool &valid)
+{
+    std::vector<CCmpPubKey> vKeyImages;
+    valid = GetTxKeyImages(tx, vKeyImages);
+    return vKeyImages;
+}
+
 CTxMemPoolEntry::CTxMemPoolEntry(const CTransactionRef& _tx, const CAmount& _nFee,
                                  int64_t _nTime, unsigned int _entryHeight,
                                  bool _spendsCoinbase, int64_t _sigOpsCost, LockPoints lp)
-    : tx(_tx), nFee(_nFee), nTxWeight(GetTransactionWeight(*tx)), nUsageSize(RecursiveDynamicUsage(tx)), nTime(_nTime), entryHeight(_entryHeight),
+    : tx(_tx), m_key_images(ExtractKeyImages(*_tx, m_key_images_valid)), nFee(_nFee), nTxWeight(GetTransactionWeight(*tx)),
+    nUsageSize(RecursiveDynamicUsage(tx) + memusage::DynamicUsage(m_key_images)), nTime(_nTime), entryHeight(_entryHeight),
     spendsCoinbase(_spendsCoinbase), sigOpCost(_sigOpsCost), lockPoints(lp), m_epoch(0)
 {
     nCountWithDescendants = 1;
@@ -113,6 +121,8 @@ void CTxMemPool::UpdateForDescendants(txiter updateIt, cacheMap &cachedDescendan
 void CTxMemPool::UpdateTransactionsFromBlock(const std::vector<uint256> &vHashesToUpdate)
 {
     AssertLockHeld(cs);
+    // Txs back from a disconnected block gain in-mempool children
+    m_block_candidates.MarkStale();
     // For each entry in vHashesToUpdate, store the set of in-mempool, but not
     // in-vHashesToUpdate transactions, so that we don't have to recalculate
     // descendants when we come across a previously seen entry.
@@ -387,8 +397,12 @@ void CTxMemPool::addUnchecked(const CTxMemPoolEntry &entry, setEntries &setAnces
     // (When we update the entry for in-mempool parents, memory usage will be
     // further updated.)
     cachedInnerUsage += entry.DynamicMemoryUsage();
+    m_usage_by_type[(int)GetFeeEstimateTxType(entry.GetTx())] += EntryUsage(entry);
 
     const CTransaction& tx = newit->GetTx();
+    for (const auto &ki : newit->GetKeyImages()) {
+        mapKeyImages[ki] = tx.GetHash();
+    }
     std::set<uint256> setParentTransactions;
     for (unsigned int i = 0; i < tx.vin.size(); i++) {
         if (tx.vin[i].IsAnonInput())
@@ -416,9 +430,10 @@ void CTxMemPool::addUnchecked(const CTxMemPoolEntry &entry, setEntries &setAnces
 
     vTxHashes.emplace_back(tx.GetWitnessHash(), newit);
     newit->vTxHashesIdx = vTxHashes.size() - 1;
+    m_block_candidates.TxAdded(*newit);
 }
 
-void CTxMemPool::addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewCache &view)
+void CTxMemPool::addInsightIndexes(const CTxMemPoolEntry &entry, const CCoinsViewCache &view, bool address_index, bool spent_index)
 {
     LOCK(cs);
     const CTransaction& tx = entry.GetTx();
@@ -426,11 +441,29 @@ void CTxMemPool::addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewC
     if (!tx.IsParticlVersion())
         return;
 
-    std::vector<CMempoolAddressDeltaKey> inserted;
-
     uint256 txhash = tx.GetHash();
+    if (address_index && mapAddressInserted.count(txhash)) {
+        address_index = false;
+    }
+    if (spent_index && mapSpentInserted.count(txhash)) {
+        spent_index = false;
+    }
+    if (!address_index && !spent_index) {
+        return;
+    }
+
+    addressDeltaInsertedList inserted;
+    std::vector<CSpentIndexKey> spent_inserted;
+    const uint64_t sequence = address_index ? ++nAddressIndexSequence : 0;
+    auto insert = [&](const CMempoolAddressDeltaKey &key, const CMempoolAddressDelta &delta) {
+        std::pair<uint256, int> address(key.addressBytes, key.type);
+        addressDeltaList &deltas = mapAddress[address];
+        deltas.push_back(AddressDeltaEntry{key, delta, sequence});
+        inserted.emplace_back(address, std::prev(deltas.end()));
+    };
+
     for (unsigned int j = 0; j < tx.vin.size(); j++) {
-        const CTxIn input = tx.vin[j];
+        const CTxIn &input = tx.vin[j];
 
         if (input.IsAnonInput()) {
             continue;
@@ -444,17 +477,38 @@ void CTxMemPool::addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewC
         std::vector<uint8_t> hashBytes;
         const CScript *pScript = &coin.out.scriptPubKey;
         int scriptType = 0;
-        CAmount nValue = coin.nType == OUTPUT_CT ? 0 : coin.out.nValue;
 
-        if (!ExtractIndexInfo(pScript, scriptType, hashBytes)
-            || scriptType == 0) {
+        if (!ExtractIndexInfo(pScript, scriptType, hashBytes)) {
             continue;
         }
 
-        CMempoolAddressDeltaKey key(scriptType, uint256(hashBytes.data(), hashBytes.size()), txhash, j, 1);
-        CMempoolAddressDelta delta(count_seconds(entry.GetTime()), nValue * -1, input.prevout.hash, input.prevout.n);
-        mapAddress.insert(std::make_pair(key, delta));
-        inserted.push_back(key);
+        uint256 addressHash;
+        if (scriptType != 0) {
+            addressHash = uint256(hashBytes.data(), hashBytes.size());
+        }
+
+        if (address_index && scriptType != 0) {
+            CAmount nValue = coin.nType == OUTPUT_CT ? 0 : coin.out.nValue;
+            CMempoolAddressDeltaKey key(scriptType, addressHash, txhash, j, 1);
+            CMempoolAddressDelta delta(count_seconds(entry.GetTime()), nValue * -1, input.prevout.hash, input.prevout.n);
+            insert(key, delta);
+        }
+
+        if (spent_index) {
+            CAmount nValue = coin.nType == OUTPUT_CT ? -1 : coin.out.nValue;
+            CSpentIndexKey key = CSpentIndexKey(input.prevout.hash, input.prevout.n);
+            CSpentIndexValue value = CSpentIndexValue(txhash, j, -1, nValue, scriptType, addressHash);
+
+            mapSpent.insert(std::make_pair(key, value));
+            spent_inserted.push_back(key);
+        }
+    }
+
+    if (spent_index) {
+        mapSpentInserted.emplace(txhash, std::move(spent_inserted));
+    }
+    if (!address_index) {
+        return;
     }
 
     for (unsigned int k = 0; k < tx.vpout.size(); k++) {
@@ -479,24 +533,44 @@ void CTxMemPool::addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewC
             continue;
 
         CMempoolAddressDeltaKey key(scriptType, uint256(hashBytes.data(), hashBytes.size()), txhash, k, 0);
-        mapAddress.insert(std::make_pair(key, CMempoolAddressDelta(count_seconds(entry.GetTime()), nValue)));
-        inserted.push_back(key);
+        insert(key, CMempoolAddressDelta(count_seconds(entry.GetTime()), nValue));
     }
 
-    mapAddressInserted.insert(std::make_pair(txhash, inserted));
+    mapAddressInserted.emplace(txhash, std::move(inserted));
+}
+
+void CTxMemPool::addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewCache &view)
+{
+    addInsightIndexes(entry, view, true, false);
 }
 
 bool CTxMemPool::getAddressIndex(std::vector<std::pair<uint256, int> > &addresses,
                                  std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > &results) const
+{
+    uint64_t sequence;
+    return getAddressIndex(addresses, 0, results, sequence);
+}
+
+bool CTxMemPool::getAddressIndex(std::vector<std::pair<uint256, int> > &addresses, uint64_t since_sequence,
+                                 std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > &results, uint64_t &sequence) const
 {
     LOCK(cs);
     for (std::vector<std::pair<uint256, int> >::iterator it = addresses.begin(); it != addresses.end(); it++) {
-        addressDeltaMap::const_iterator ait = mapAddress.lower_bound(CMempoolAddressDeltaKey((*it).second, (*it).first));
-        while (ait != mapAddress.end() && (*ait).first.addressBytes == (*it).first && (*ait).first.type == (*it).second) {
-            results.push_back(*ait);
-            ait++;
+        addressDeltaMap::const_iterator ait = mapAddress.find(*it);
+        if (ait == mapAddress.end()) {
+            continue;
+        }
+        // Newest deltas are at the back
+        const addressDeltaList &deltas = ait->second;
+        addressDeltaList::const_iterator dit = deltas.end();
+        while (dit != deltas.begin() && std::prev(dit)->sequence > since_sequence) {
+            --dit;
+        }
+        for (; dit != deltas.end(); ++dit) {
+            results.emplace_back(dit->key, dit->delta);
         }
     }
+    sequence = nAddressIndexSequence;
     return true;
 }
 
@@ -506,9 +580,13 @@ bool CTxMemPool::removeAddressIndex(const uint256 txhash)
     addressDeltaMapInserted::iterator it = mapAddressInserted.find(txhash);
 
     if (it != mapAddressInserted.end()) {
-        std::vector<CMempoolAddressDeltaKey> keys = (*it).second;
-        for (std::vector<CMempoolAddressDeltaKey>::iterator mit = keys.begin(); mit != keys.end(); mit++) {
-            mapAddress.erase(*mit);
+        for (const auto &inserted : it->second) {
+            addressDeltaMap::iterator ait = mapAddress.find(inserted.first);
+            assert(ait != mapAddress.end());
+            ait->second.erase(inserted.second);
+            if (ait->second.empty()) {
+                mapAddress.erase(ait);
+            }
         }
         mapAddressInserted.erase(it);
     }
@@ -518,48 +596,7 @@ bool CTxMemPool::removeAddressIndex(const uint256 txhash)
 
 void CTxMemPool::addSpentIndex(const CTxMemPoolEntry &entry, const CCoinsViewCache &view)
 {
-    LOCK(cs);
-
-    const CTransaction& tx = entry.GetTx();
-
-    if (!tx.IsParticlVersion())
-        return;
-
-    std::vector<CSpentIndexKey> inserted;
-
-    uint256 txhash = tx.GetHash();
-    for (unsigned int j = 0; j < tx.vin.size(); j++) {
-        const CTxIn input = tx.vin[j];
-
-        if (input.IsAnonInput()) {
-            continue;
-        }
-
-        const Coin &coin = view.AccessCoin(input.prevout);
-        assert(coin.nType == OUTPUT_STANDARD || coin.nType == OUTPUT_CT);
-
-        std::vector<uint8_t> hashBytes;
-        const CScript *pScript = &coin.out.scriptPubKey;
-        int scriptType = 0;
-        CAmount nValue = coin.nType == OUTPUT_CT ? -1 : coin.out.nValue;
-
-        if (!ExtractIndexInfo(pScript, scriptType, hashBytes)) {
-            continue;
-        }
-
-        uint256 addressHash;
-        if (scriptType != 0) {
-            addressHash = uint256(hashBytes.data(), hashBytes.size());
-        }
-
-        CSpentIndexKey key = CSpentIndexKey(input.prevout.hash, input.prevout.n);
-        CSpentIndexValue value = CSpentIndexValue(txhash, j, -1, nValue, scriptType, addressHash);
-
-        mapSpent.insert(std::make_pair(key, value));
-        inserted.push_back(key);
-    }
-
-    mapSpentInserted.insert(std::make_pair(txhash, inserted));
+    addInsightIndexes(entry, view, false, true);
 }
 
 bool CTxMemPool::getSpentIndex(const CSpentIndexKey &key, CSpentIndexValue &value) const
@@ -578,9 +615,8 @@ bool CTxMemPool::removeSpentIndex(const uint256 &txhash)
     LOCK(cs);
     mapSpentIndexInserted::iterator it = mapSpentInserted.find(txhash);
     if (it != mapSpentInserted.end()) {
-        std::vector<CSpentIndexKey> keys = (*it).second;
-        for (std::vector<CSpentIndexKey>::iterator mit = keys.begin(); mit != keys.end(); mit++) {
-            mapSpent.erase(*mit);
+        for (const CSpentIndexKey &key : it->second) {
+            mapSpent.erase(key);
         }
         mapSpentInserted.erase(it);
     }
@@ -588,6 +624,44 @@ bool CTxMemPool::removeSpentIndex(const uint256 &txhash)
     return true;
 }
 
+void CTxMemPool::removeInsightIndexes(const std::vector<uint256>& txhashes)
+{
+    AssertLockHeld(cs);
+    typedef std::pair<std::pair<uint256, int>, addressDeltaList::iterator> AddressDelta;
+    std::vector<AddressDelta> address_deltas;
+    for (const uint256 &txhash : txhashes) {
+        auto ait = mapAddressInserted.find(txhash);
+        if (ait != mapAddressInserted.end()) {
+            address_deltas.insert(address_deltas.end(), ait->second.begin(), ait->second.end());
+            mapAddressInserted.erase(ait);
+        }
+        auto sit = mapSpentInserted.find(txhash);
+        if (sit != mapSpentInserted.end()) {
+            for (const CSpentIndexKey &key : sit->second) {
+                mapSpent.erase(key);
+            }
+            mapSpentInserted.erase(sit);
+        }
+    }
+
+    // Busy addresses appear in many transactions of a block, look each up once
+    std::sort(address_deltas.begin(), address_deltas.end(), [](const AddressDelta &a, const AddressDelta &b) {
+        return a.first < b.first;
+    });
+    for (auto it = address_deltas.begin(); it != address_deltas.end();) {
+        addressDeltaMap::iterator mit = mapAddress.find(it->first);
+        assert(mit != mapAddress.end());
+        auto end = it;
+        for (; end != address_deltas.end() && end->first == it->first; ++end) {
+            mit->second.erase(end->second);
+        }
+        if (mit->second.empty()) {
+            mapAddress.erase(mit);
+        }
+        it = end;
+    }
+}
+
 void CTxMemPool::removeUnchecked(txiter it, MemPoolRemovalReason reason)
 {
     // We increment mempool sequence value no matter removal reason
@@ -603,10 +677,12 @@ void CTxMemPool::removeUnchecked(txiter it, MemPoolRemovalReason reason)
     }
 
     const uint256 hash = it->GetTx().GetHash();
+    for (const auto &ki : it->GetKeyImages()) {
+        mapKeyImages.erase(ki);
+    }
     for (const CTxIn& txin : it->GetTx().vin)
     {
         if (txin.IsAnonInput()) {
-            RemoveKeyImagesFromMempool(hash, txin, *this);
             continue;
         }
         mapNextTx.erase(txin.prevout);
@@ -623,8 +699,10 @@ void CTxMemPool::removeUnchecked(txiter it, MemPoolRemovalReason reason)
     } else
         vTxHashes.clear();
 
+    m_block_candidates.TxRemoved(*it);
     totalTxSize -= it->GetTxSize();
     cachedInnerUsage -= it->DynamicMemoryUsage();
+    m_usage_by_type[(int)GetFeeEstimateTxType(it->GetTx())] -= EntryUsage(*it);
     cachedInnerUsage -= memusage::DynamicUsage(it->GetMemPoolParentsConst()) + memusage::DynamicUsage(it->GetMemPoolChildrenConst());
     mapTx.erase(it);
     nTransactionsUpdated++;
@@ -733,40 +811,51 @@ void CTxMemPool::removeForReorg(const CCoinsViewCache *pcoins, unsigned int nMem
     RemoveStaged(setAllRemoves, false, MemPoolRemovalReason::REORG);
 }
 
-void CTxMemPool::removeConflicts(const CTransaction &tx)
+void CTxMemPool::removeKeyImageConflicts(const std::vector<const CTransaction*>& vtx)
+{
+    AssertLockHeld(cs);
+    if (mapKeyImages.empty()) {
+        return;
+    }
+
+    // Collect the conflicts of all txs first, a tx double spending several key images is removed once
+    std::set<uint256> conflicts;
+    std::vector<CCmpPubKey> vKeyImages;
+    for (const auto& tx : vtx) {
+        GetTxKeyImages(*tx, vKeyImages);
+        for (const auto &ki : vKeyImages) {
+            auto mi = mapKeyImages.find(ki);
+            if (mi == mapKeyImages.end() || mi->second == tx->GetHash()) {
+                continue;
+            }
+            if (LogAcceptCategory(BCLog::RINGCT))
+                LogPrintf("Clearing conflicting anon tx from mempool, removed:%s, tx:%s\n", mi->second.ToString(), tx->GetHash().ToString());
+            conflicts.insert(mi->second);
+        }
+    }
+    for (const uint256 &hash : conflicts) {
+        txiter origit = mapTx.find(hash);
+        if (origit == mapTx.end()) {
+            // Already removed as a descendant of another conflict
+            continue;
+        }
+        CTransactionRef txConflict = origit->GetSharedTx();
+        ClearPrioritisation(hash);
+        removeRecursive(*txConflict, MemPoolRemovalReason::CONFLICT);
+    }
+}
+
+void CTxMemPool::removeConflicts(const CTransaction &tx, bool key_images)
 {
     // Remove transactions which depend on inputs of tx, recursively
     AssertLockHeld(cs);
+    if (key_images) {
+        removeKeyImageConflicts({&tx});
+    }
     for (const auto &txin : tx.vin) {
-        if (txin.IsAnonInput())
-        {
-            uint32_t nInputs, nRingSize;
-            txin.GetAnonInfo(nInputs, nRingSize);
-
-            const std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
-            for (size_t k = 0; k < nInputs; ++k)
-            {
-                const CCmpPubKey &ki = *((CCmpPubKey*)&vKeyImages[k*33]);
-                uint256 txhashKI;
-                if (HaveKeyImage(ki, txhashKI))
-                {
-                    txiter origit = mapTx.find(txhashKI);
-
-                    if (origit != mapTx.end())
-                    {
-                        const CTransaction& txConflict = origit->GetTx();
-                        if (txConflict != tx)
-                        {
-                            if (LogAcceptCategory(BCLog::RINGCT))
-                                LogPrintf("Clearing conflicting anon tx from mempool, removed:%s, tx:%s\n", txhashKI.ToString(), tx.GetHash().ToString());
-                            ClearPrioritisation(txConflict.GetHash());
-                            removeRecursive(txConflict, MemPoolRemovalReason::CONFLICT);
-                        };
-                    };
-                };
-            };
+        if (txin.IsAnonInput()) {
             continue;
-        };
+        }
         auto it = mapNextTx.find(txin.prevout);
         if (it != mapNextTx.end()) {
             const CTransaction &txConflict = *it->second;
@@ -796,6 +885,14 @@ void CTxMemPool::removeForBlock(const std::vector<CTransactionRef>& vtx, unsigne
     }
     // Before the txs in the new block have been removed from the mempool, update policy estimates
     if (minerPolicyEstimator) {minerPolicyEstimator->processBlock(nBlockHeight, entries);}
+    if (!mapAddressInserted.empty() || !mapSpentInserted.empty()) {
+        std::vector<uint256> txhashes;
+        txhashes.reserve(entries.size());
+        for (const CTxMemPoolEntry* entry : entries) {
+            txhashes.push_back(entry->GetTx().GetHash());
+        }
+        removeInsightIndexes(txhashes);
+    }
     for (const auto& tx : vtx)
     {
         txiter it = mapTx.find(tx->GetHash());
@@ -804,19 +901,37 @@ void CTxMemPool::removeForBlock(const std::vector<CTransactionRef>& vtx, unsigne
             stage.insert(it);
             RemoveStaged(stage, true, MemPoolRemovalReason::BLOCK);
         }
-        removeConflicts(*tx);
+        removeConflicts(*tx, false);
         ClearPrioritisation(tx->GetHash());
     }
+    // The key images of the block txs left the pool with them, what's left of the block's are conflicts
+    if (!mapKeyImages.empty()) {
+        std::vector<const CTransaction*> block_txs;
+        block_txs.reserve(vtx.size());
+        for (const auto& tx : vtx) {
+            block_txs.push_back(tx.get());
+        }
+        removeKeyImageConflicts(block_txs);
+    }
     lastRollingFeeUpdate = GetTime();
     blockSinceLastRollingFeeBump = true;
 }
 
 void CTxMemPool::_clear()
 {
+    m_block_candidates.MarkStale();
     mapTx.clear();
     mapNextTx.clear();
+    mapKeyImages.clear();
+    mapAddress.clear();
+    mapAddressInserted.clear();
+    mapSpent.clear();
+    mapSpentInserted.clear();
     totalTxSize = 0;
     cachedInnerUsage = 0;
+    for (auto& usage : m_usage_by_type) {
+        usage = 0;
+    }
     lastRollingFeeUpdate = GetTime();
     blockSinceLastRollingFeeBump = false;
     rollingMinimumFeeRate = 0;
@@ -857,16 +972,26 @@ void CTxMemPool::check(const CCoinsViewCache *pcoins) const
 
     uint64_t checkTotal = 0;
     uint64_t innerUsage = 0;
+    uint64_t usage_by_type[NUM_FEE_ESTIMATE_TX_TYPES] = {};
 
     CCoinsViewCache mempoolDuplicate(const_cast<CCoinsViewCache*>(pcoins));
     const int64_t spendheight = GetSpendHeight(mempoolDuplicate);
 
+    size_t nKeyImages = 0;
     std::list<const CTxMemPoolEntry*> waitingOnDependants;
     for (indexed_transaction_set::const_iterator it = mapTx.begin(); it != mapTx.end(); it++) {
         unsigned int i = 0;
+        // Check that the entry's key images are indexed
+        for (const auto &ki : it->GetKeyImages()) {
+            auto mi = mapKeyImages.find(ki);
+            assert(mi != mapKeyImages.end());
+            assert(mi->second == it->GetTx().GetHash());
+            nKeyImages++;
+        }
         checkTotal += it->GetTxSize();
         innerUsage += it->DynamicMemoryUsage();
         const CTransaction& tx = it->GetTx();
+        usage_by_type[(int)GetFeeEstimateTxType(tx)] += EntryUsage(*it);
         innerUsage += memusage::DynamicUsage(it->GetMemPoolParentsConst()) + memusage::DynamicUsage(it->GetMemPoolChildrenConst());
         bool fDependsWait = false;
         CTxMemPoolEntry::Parents setParentCheck;
@@ -966,8 +1091,12 @@ void CTxMemPool::check(const CCoinsViewCache *pcoins) const
         assert(&tx == it->second);
     }
 
+    assert(mapKeyImages.size() == nKeyImages);
     assert(totalTxSize == checkTotal);
     assert(innerUsage == cachedInnerUsage);
+    for (int i = 0; i < NUM_FEE_ESTIMATE_TX_TYPES; ++i) {
+        assert(usage_by_type[i] == m_usage_by_type[i]);
+    }
 }
 
 bool CTxMemPool::CompareDepthAndScore(const uint256& hasha, const uint256& hashb, bool wtxid)
@@ -1090,6 +1219,7 @@ void CTxMemPool::PrioritiseTransaction(const uint256& hash, const CAmount& nFeeD
             for (txiter descendantIt : setDescendants) {
                 mapTx.modify(descendantIt, update_ancestor_state(0, nFeeDelta, 0, 0));
             }
+            m_block_candidates.MarkStale();
             ++nTransactionsUpdated;
         }
     }
@@ -1116,14 +1246,11 @@ bool CTxMemPool::HaveKeyImage(const CCmpPubKey &ki, uint256 &hash) const
 {
     LOCK(cs);
 
-    std::map<CCmpPubKey, uint256>::const_iterator mi;
-    mi = mapKeyImages.find(ki);
-
-    if (mi != mapKeyImages.end())
-    {
+    auto mi = mapKeyImages.find(ki);
+    if (mi != mapKeyImages.end()) {
         hash = mi->second;
         return true;
-    };
+    }
 
     return false;
 };
@@ -1171,6 +1298,13 @@ bool CCoinsViewMemPool::GetCoin(const COutPoint &outpoint, Coin &coin) const {
     // conflict with the underlying cache, and it cannot have pruned entries (as it contains full)
     // transactions. First checking the underlying cache risks returning a pruned entry instead.
     CTransactionRef ptx = mempool.get(outpoint.hash);
+    if (!ptx) {
+        // Outputs of the earlier transactions of a package being tested
+        auto it = m_temp_added.find(outpoint.hash);
+        if (it != m_temp_added.end()) {
+            ptx = it->second;
+        }
+    }
     if (ptx) {
 
         if (ptx->IsParticlVersion())
@@ -1204,10 +1338,34 @@ bool CCoinsViewMemPool::GetCoin(const COutPoint &outpoint, Coin &coin) const {
     return base->GetCoin(outpoint, coin);
 }
 
+void CCoinsViewMemPool::PackageAddTransaction(const CTransactionRef& tx)
+{
+    m_temp_added.emplace(tx->GetHash(), tx);
+}
+
+size_t CTxMemPool::EntryUsage(const CTxMemPoolEntry& entry)
+{
+    // Estimate the overhead of mapTx to be 15 pointers + an allocation, as no exact formula for boost::multi_index_contained is implemented.
+    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) + entry.DynamicMemoryUsage();
+}
+
+/** An unordered map that never held an entry keeps its single bucket inline, nothing is allocated. */
+template <typename M>
+static size_t IndexUsage(const M& m)
+{
+    return m.empty() && m.bucket_count() <= 1 ? 0 : memusage::DynamicUsage(m);
+}
+
 size_t CTxMemPool::DynamicMemoryUsage() const {
     LOCK(cs);
-    // Estimate the overhead of mapTx to be 15 pointers + an allocation, as no exact formula for boost::multi_index_contained is implemented.
-    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(vTxHashes) + cachedInnerUsage;
+    return memusage::MallocUsage(sizeof(CTxMemPoolEntry) + 15 * sizeof(void*)) * mapTx.size() + memusage::DynamicUsage(mapNextTx) + memusage::DynamicUsage(mapDeltas) + memusage::DynamicUsage(vTxHashes) + IndexUsage(mapKeyImages) +
+           IndexUsage(mapAddress) + IndexUsage(mapAddressInserted) + IndexUsage(mapSpent) + IndexUsage(mapSpentInserted) +
+           memusage::DynamicUsage(m_unbroadcast_txids) + cachedInnerUsage;
+}
+
+size_t CTxMemPool::DynamicMemoryUsage(FeeEstimateTxType tx_type) const {
+    LOCK(cs);
+    return m_usage_by_type[(int)tx_type];
 }
 
 void CTxMemPool::RemoveUnbroadcastTx(const uint256& txid, const bool unchecked) {
@@ -1416,3 +1574,68 @@ CTxMemPool::EpochGuard::~EpochGuard()
 }
 
 SaltedTxidHasher::SaltedTxidHasher() : k0(GetRand(std::numeric_limits<uint64_t>::max())), k1(GetRand(std::numeric_limits<uint64_t>::max())) {}
+
+void BlockCandidateSet::MarkStale()
+{
+    m_stale = true;
+    m_packages.clear();
+    m_singles.clear();
+}
+
+void BlockCandidateSet::Set(std::vector<Package>&& packages)
+{
+    MarkStale();
+    Score prev{1, 0, 0};
+    for (auto& package : packages) {
+        Score score{package.fees, package.size, m_sequence++};
+        // A package can score higher than one selected before it once its ancestors are in,
+        // keep the order by taking the lower score.
+        if (prev.size > 0 && CompareScore()(score, prev)) {
+            score.fees = prev.fees;
+            score.size = prev.size;
+        }
+        prev = score;
+        auto it = m_packages.emplace_hint(m_packages.end(), score, std::move(package));
+        if (it->second.txs.size() == 1) {
+            m_singles.emplace(it->second.txs[0], it);
+        }
+    }
+    m_stale = false;
+}
+
+void BlockCandidateSet::TxAdded(const CTxMemPoolEntry& entry)
+{
+    if (m_stale) {
+        return;
+    }
+    if (entry.GetCountWithAncestors() != 1 || entry.GetCountWithDescendants() != 1) {
+        MarkStale();
+        return;
+    }
+    Package package;
+    package.txs.push_back(&entry);
+    package.fees = entry.GetModifiedFee();
+    package.size = entry.GetTxSize();
+    package.sigops = entry.GetSigOpCost();
+    Score score{package.fees, package.size, m_sequence++};
+    auto it = m_packages.emplace(score, std::move(package)).first;
+    m_singles.emplace(&entry, it);
+}
+
+void BlockCandidateSet::TxRemoved(const CTxMemPoolEntry& entry)
+{
+    if (m_stale) {
+        return;
+    }
+    auto it = m_singles.find(&entry);
+    if (it == m_singles.end() || entry.GetCountWithAncestors() != 1 || entry.GetCountWithDescendants() != 1) {
+        MarkStale();
+        return;
+    }
+    m_packages.erase(it->second);
+    m_singles.erase(it);
+}
+
+SaltedKeyImageHasher::SaltedKeyImageHasher() : k0(GetRand(std::numeric_limits<uint64_t>::max())), k1(GetRand(std::numeric_limits<uint64_t>::max())) {}
+
+SaltedInsightKeyHasher::SaltedInsightKeyHasher() : k0(GetRand(std::numeric_limits<uint64_t>::max())), k1(GetRand(std::numeric_limits<uint64_t>::max())) {}
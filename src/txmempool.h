@@ -7,9 +7,11 @@
 #define BITCOIN_TXMEMPOOL_H
 
 #include <atomic>
+#include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -22,6 +24,7 @@
 #include <indirectmap.h>
 #include <optional.h>
 #include <policy/feerate.h>
+#include <policy/fees.h>
 #include <primitives/transaction.h>
 #include <sync.h>
 #include <random.h>
@@ -95,6 +98,8 @@ public:
 
 private:
     const CTransactionRef tx;
+    bool m_key_images_valid;        //!< False if an anon input holds malformed key images, set with m_key_images
+    const std::vector<CCmpPubKey> m_key_images; //!< Key images of anon inputs, extracted once on entry
     mutable Parents m_parents;
     mutable Children m_children;
     const CAmount nFee;             //!< Cached to avoid expensive parent-transaction lookups
@@ -137,6 +142,8 @@ public:
     int64_t GetModifiedFee() const { return nFee + feeDelta; }
     size_t DynamicMemoryUsage() const { return nUsageSize; }
     const LockPoints& GetLockPoints() const { return lockPoints; }
+    const std::vector<CCmpPubKey>& GetKeyImages() const { return m_key_images; }
+    bool HasValidKeyImages() const { return m_key_images_valid; }
 
     // Adjusts the descendant state.
     void UpdateDescendantState(int64_t modifySize, CAmount modifyFee, int64_t modifyCount);
@@ -422,6 +429,98 @@ public:
     }
 };
 
+class SaltedKeyImageHasher
+{
+private:
+    /** Salt */
+    const uint64_t k0, k1;
+
+public:
+    SaltedKeyImageHasher();
+
+    size_t operator()(const CCmpPubKey& ki) const {
+        return CSipHasher(k0, k1).Write(ki.begin(), ki.size()).Finalize();
+    }
+};
+
+/** Salted hasher for the keys of the mempool address and spent indexes */
+class SaltedInsightKeyHasher
+{
+private:
+    /** Salt */
+    const uint64_t k0, k1;
+
+public:
+    SaltedInsightKeyHasher();
+
+    size_t operator()(const std::pair<uint256, int>& address) const {
+        return SipHashUint256Extra(k0, k1, address.first, address.second);
+    }
+
+    size_t operator()(const CSpentIndexKey& key) const {
+        return SipHashUint256Extra(k0, k1, key.txid, key.outputIndex);
+    }
+};
+
+/**
+ * Mempool transactions in the order BlockAssembler selects them when block
+ * limits don't get in the way, grouped into ancestor feerate packages.
+ *
+ * BlockAssembler rebuilds the set when it's stale and fills templates by
+ * walking it. Transactions without in-mempool ancestors or descendants are
+ * inserted and erased in place as they enter and leave the mempool, which
+ * matches where the package selection would have put them. Any other change
+ * to the mempool marks the set stale.
+ */
+class BlockCandidateSet
+{
+public:
+    struct Package {
+        //! In an order valid for a block
+        std::vector<const CTxMemPoolEntry*> txs;
+        CAmount fees{0};
+        int64_t size{0};
+        int64_t sigops{0};
+    };
+
+    /** Ancestor feerate a package was selected at, never above that of the packages before it */
+    struct Score {
+        CAmount fees;
+        int64_t size;
+        uint64_t sequence;
+    };
+
+    struct CompareScore {
+        bool operator()(const Score& a, const Score& b) const
+        {
+            double f1 = (double)a.fees * b.size;
+            double f2 = (double)b.fees * a.size;
+            if (f1 == f2) {
+                return a.sequence < b.sequence;
+            }
+            return f1 > f2;
+        }
+    };
+
+    typedef std::map<Score, Package, CompareScore> PackageMap;
+
+    bool IsStale() const { return m_stale; }
+    void MarkStale();
+    /** Replace the set with packages in the order they were selected */
+    void Set(std::vector<Package>&& packages);
+    void TxAdded(const CTxMemPoolEntry& entry);
+    void TxRemoved(const CTxMemPoolEntry& entry);
+
+    const PackageMap& GetPackages() const { return m_packages; }
+
+private:
+    PackageMap m_packages;
+    //! Packages of a single transaction
+    std::unordered_map<const CTxMemPoolEntry*, PackageMap::iterator> m_singles;
+    uint64_t m_sequence{0};
+    bool m_stale{true};
+};
+
 /**
  * CTxMemPool stores valid-according-to-the-current-best-chain transactions
  * that may be included in the next block.
@@ -504,6 +603,8 @@ private:
 
     uint64_t totalTxSize;      //!< sum of all mempool tx's virtual sizes. Differs from serialized tx size since witness data is discounted. Defined in BIP 141.
     uint64_t cachedInnerUsage; //!< sum of dynamic memory usage of all the map elements (NOT the maps themselves)
+    //! Usage of the entries and their transactions by FeeEstimateTxType
+    uint64_t m_usage_by_type[NUM_FEE_ESTIMATE_TX_TYPES] GUARDED_BY(cs){};
 
     mutable int64_t lastRollingFeeUpdate;
     mutable bool blockSinceLastRollingFeeBump;
@@ -585,6 +686,8 @@ public:
      */
     mutable RecursiveMutex cs;
     indexed_transaction_set mapTx GUARDED_BY(cs);
+    //! Kept up to date by the mempool, rebuilt by BlockAssembler when stale
+    mutable BlockCandidateSet m_block_candidates GUARDED_BY(cs);
 
     using txiter = indexed_transaction_set::nth_index<0>::type::const_iterator;
     std::vector<std::pair<uint256, txiter>> vTxHashes GUARDED_BY(cs); //!< All tx witness hashes/entries in mapTx, in random order
@@ -595,18 +698,37 @@ public:
 private:
     typedef std::map<txiter, setEntries, CompareIteratorByHash> cacheMap;
 
-    typedef std::map<CMempoolAddressDeltaKey, CMempoolAddressDelta, CMempoolAddressDeltaKeyCompare> addressDeltaMap;
+    /** Usage of an entry, its transaction and its mapTx node */
+    static size_t EntryUsage(const CTxMemPoolEntry& entry);
+
+    struct AddressDeltaEntry {
+        CMempoolAddressDeltaKey key;
+        CMempoolAddressDelta delta;
+        //! Value of nAddressIndexSequence when the transaction was added
+        uint64_t sequence;
+    };
+    //! The deltas of an address in the order their transactions were added
+    typedef std::list<AddressDeltaEntry> addressDeltaList;
+    typedef std::unordered_map<std::pair<uint256, int>, addressDeltaList, SaltedInsightKeyHasher> addressDeltaMap;
     addressDeltaMap mapAddress;
 
-    typedef std::map<uint256, std::vector<CMempoolAddressDeltaKey> > addressDeltaMapInserted;
+    typedef std::vector<std::pair<std::pair<uint256, int>, addressDeltaList::iterator> > addressDeltaInsertedList;
+    typedef std::unordered_map<uint256, addressDeltaInsertedList, SaltedTxidHasher> addressDeltaMapInserted;
     addressDeltaMapInserted mapAddressInserted;
 
-    typedef std::map<CSpentIndexKey, CSpentIndexValue, CSpentIndexKeyCompare> mapSpentIndex;
+    uint64_t nAddressIndexSequence = 0;
+
+    typedef std::unordered_map<CSpentIndexKey, CSpentIndexValue, SaltedInsightKeyHasher> mapSpentIndex;
     mapSpentIndex mapSpent;
 
-    typedef std::map<uint256, std::vector<CSpentIndexKey> > mapSpentIndexInserted;
+    typedef std::unordered_map<uint256, std::vector<CSpentIndexKey>, SaltedTxidHasher> mapSpentIndexInserted;
     mapSpentIndexInserted mapSpentInserted;
 
+    /** Remove the transactions spending key images of vtx in one pass over all their key images */
+    void removeKeyImageConflicts(const std::vector<const CTransaction*>& vtx) EXCLUSIVE_LOCKS_REQUIRED(cs);
+    /** Remove the address and spent index entries of many transactions, one lookup per address */
+    void removeInsightIndexes(const std::vector<uint256>& txhashes) EXCLUSIVE_LOCKS_REQUIRED(cs);
+
     void UpdateParent(txiter entry, txiter parent, bool add) EXCLUSIVE_LOCKS_REQUIRED(cs);
     void UpdateChild(txiter entry, txiter child, bool add) EXCLUSIVE_LOCKS_REQUIRED(cs);
 
@@ -622,7 +744,8 @@ public:
     indirectmap<COutPoint, const CTransaction*> mapNextTx GUARDED_BY(cs);
     std::map<uint256, CAmount> mapDeltas;
 
-    std::map<CCmpPubKey, uint256> mapKeyImages;
+    //! Key images spent by in-mempool transactions, filled from CTxMemPoolEntry::GetKeyImages
+    std::unordered_map<CCmpPubKey, uint256, SaltedKeyImageHasher> mapKeyImages;
 
 
     /** Create a new CTxMemPool.
@@ -648,9 +771,18 @@ public:
     void addUnchecked(const CTxMemPoolEntry& entry, bool validFeeEstimate = true) EXCLUSIVE_LOCKS_REQUIRED(cs, cs_main);
     void addUnchecked(const CTxMemPoolEntry& entry, setEntries& setAncestors, bool validFeeEstimate = true) EXCLUSIVE_LOCKS_REQUIRED(cs, cs_main);
 
+    /** Add the transaction to the address and/or spent index, reading each spent coin once */
+    void addInsightIndexes(const CTxMemPoolEntry &entry, const CCoinsViewCache &view, bool address_index, bool spent_index);
+
     void addAddressIndex(const CTxMemPoolEntry &entry, const CCoinsViewCache &view);
     bool getAddressIndex(std::vector<std::pair<uint256, int> > &addresses,
                          std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > &results) const;
+    /**
+     * Get the deltas of the addresses added after since_sequence, sequence is set to the current
+     * address index sequence. Deltas of removed transactions are not reported.
+     */
+    bool getAddressIndex(std::vector<std::pair<uint256, int> > &addresses, uint64_t since_sequence,
+                         std::vector<std::pair<CMempoolAddressDeltaKey, CMempoolAddressDelta> > &results, uint64_t &sequence) const;
     bool removeAddressIndex(const uint256 txhash);
 
     void addSpentIndex(const CTxMemPoolEntry &entry, const CCoinsViewCache &view);
@@ -659,7 +791,8 @@ public:
 
     void removeRecursive(const CTransaction& tx, MemPoolRemovalReason reason) EXCLUSIVE_LOCKS_REQUIRED(cs);
     void removeForReorg(const CCoinsViewCache* pcoins, unsigned int nMemPoolHeight, int flags) EXCLUSIVE_LOCKS_REQUIRED(cs, cs_main);
-    void removeConflicts(const CTransaction& tx) EXCLUSIVE_LOCKS_REQUIRED(cs);
+    /** Remove the transactions conflicting with tx, spending the same outpoints or, if key_images is set, key images */
+    void removeConflicts(const CTransaction& tx, bool key_images = true) EXCLUSIVE_LOCKS_REQUIRED(cs);
     void removeForBlock(const std::vector<CTransactionRef>& vtx, unsigned int nBlockHeight) EXCLUSIVE_LOCKS_REQUIRED(cs);
 
     void clear();
@@ -791,6 +924,8 @@ public:
     std::vector<TxMempoolInfo> infoAll() const;
 
     size_t DynamicMemoryUsage() const;
+    /** Memory used by the entries of one transaction type, not counting the maps indexing them */
+    size_t DynamicMemoryUsage(FeeEstimateTxType tx_type) const;
 
     /** Adds a transaction to the unbroadcast set */
     void AddUnbroadcastTx(const uint256& txid)
@@ -931,10 +1066,14 @@ class CCoinsViewMemPool : public CCoinsViewBacked
 {
 protected:
     const CTxMemPool& mempool;
+    /** Transactions of a package being tested, their outputs are seen as if they were in the mempool */
+    std::map<uint256, CTransactionRef> m_temp_added;
 
 public:
     CCoinsViewMemPool(CCoinsView* baseIn, const CTxMemPool& mempoolIn);
     bool GetCoin(const COutPoint &outpoint, Coin &coin) const override;
+    /** Make the outputs of tx available to the later transactions of a package */
+    void PackageAddTransaction(const CTransactionRef& tx);
 };
 
 /**
@@ -29,11 +29,7 @@ struct TxInUndoFormatter
             // Required to maintain compatibility with older undo format.
             ::Serialize(s, (unsigned char)0);
         }
-        ::Serialize(s, Using<TxOutCompression>(txout.out));
-        ::Serialize(s, txout.nType);
-        if (txout.nType == OUTPUT_CT) {
-            s.write((char*)&txout.commitment.data[0], 33);
-        }
+        ParticlCoinCompression::Ser(s, txout.out, txout.nType, txout.commitment);
     }
 
     template<typename Stream>
@@ -49,11 +45,7 @@ struct TxInUndoFormatter
             unsigned int nVersionDummy;
             ::Unserialize(s, VARINT(nVersionDummy));
         }
-        ::Unserialize(s, Using<TxOutCompression>(txout.out));
-        ::Unserialize(s, txout.nType);
-        if (txout.nType == OUTPUT_CT) {
-            s.read((char*)&txout.commitment.data[0], 33);
-        }
+        ParticlCoinCompression::Unser(s, txout.out, txout.nType, txout.commitment);
     }
 };
 
@@ -225,6 +225,9 @@ int CLedgerDevice::GetPubKey(const std::vector<uint32_t> &vPath, CPubKey &pk, bo
     if (vPath.size() < 1 || vPath.size() > MAX_BIP32_PATH) {
         return errorN(1, sError, __func__,"Path depth out of range.");
     }
+    if (!display && GetCachedPubKey(vPath, pk)) {
+        return 0;
+    }
     size_t lenPath = vPath.size();
     if (0 != Open()) {
         return errorN(1, sError, __func__, "Failed to open device.");
@@ -268,6 +271,7 @@ int CLedgerDevice::GetPubKey(const std::vector<uint32_t> &vPath, CPubKey &pk, bo
     if (lenPubkey == 65 && !pk.Compress()) {
         return errorN(1, sError, __func__, "Pubkey compression failed.");
     }
+    m_pubkey_cache[vPath] = pk;
 
     return 0;
 };
@@ -277,7 +281,16 @@ int CLedgerDevice::GetXPub(const std::vector<uint32_t> &vPath, CExtPubKey &ekp,
     if (vPath.size() < 1 || vPath.size() > MAX_BIP32_PATH) {
         return errorN(1, sError, __func__,"Path depth out of range.");
     }
+    if (GetCachedXPub(vPath, ekp)) {
+        return 0;
+    }
     size_t lenPath = vPath.size();
+
+    // The parent key is only needed for the fingerprint, skip reading it if known
+    std::vector<uint32_t> vPathParent(vPath.begin(), vPath.end() - 1);
+    CPubKey pkParent;
+    bool fHaveParent = lenPath > 1 && GetCachedPubKey(vPathParent, pkParent);
+
     if (0 != Open()) {
         return errorN(1, sError, __func__, "Failed to open device.");
     }
@@ -300,7 +313,7 @@ int CLedgerDevice::GetXPub(const std::vector<uint32_t> &vPath, CExtPubKey &ekp,
     int result = sendApduHidHidapi(handle, 1, in, apduSize, out, sizeof(out), &sw);
 
     // Get fingerprint
-    if (sw == SW_OK && lenPath > 1 && result > 65) {
+    if (sw == SW_OK && lenPath > 1 && !fHaveParent && result > 65) {
         size_t lenPathParent = lenPath-1;
         in[4] = 1 + 4 * lenPathParent; // num bytes to follow
         in[5] = lenPathParent;
@@ -338,19 +351,24 @@ int CLedgerDevice::GetXPub(const std::vector<uint32_t> &vPath, CExtPubKey &ekp,
 
     // Set fingerprint
     if (lenPath > 1) {
-        size_t ofs = 0;
-        size_t lenPubkey = outB[ofs++];
-        if (lenPubkey != 33 && lenPubkey != 65) {
-            return errorN(1, sError, __func__, "Bad pubkey size: %d", lenPubkey);
-        }
-        CPubKey pkParent(&outB[ofs], &outB[ofs+lenPubkey]);
+        if (!fHaveParent) {
+            size_t ofs = 0;
+            size_t lenPubkey = outB[ofs++];
+            if (lenPubkey != 33 && lenPubkey != 65) {
+                return errorN(1, sError, __func__, "Bad pubkey size: %d", lenPubkey);
+            }
+            pkParent.Set(&outB[ofs], &outB[ofs+lenPubkey]);
 
-        if (lenPubkey == 65 && !pkParent.Compress()) {
-            return errorN(1, sError, __func__, "Pubkey compression failed.");
+            if (lenPubkey == 65 && !pkParent.Compress()) {
+                return errorN(1, sError, __func__, "Pubkey compression failed.");
+            }
+            m_pubkey_cache[vPathParent] = pkParent;
         }
         CKeyID id = pkParent.GetID();
         memcpy(&ekp.vchFingerprint[0], &id, 4);
     }
+    m_pubkey_cache[vPath] = ekp.pubkey;
+    m_xpub_cache[vPath] = ekp;
 
     return 0;
 };
@@ -18,7 +18,7 @@ public:
     CLedgerDevice(const DeviceType *pType_, const char *cPath_, const char *cSerialNo_, int nInterface_)
         : CUSBDevice(pType_, cPath_, cSerialNo_, nInterface_) {};
 
-    void Cleanup() override { Close(); };
+    void Cleanup() override { Close(); ClearSession(); };
     int Open() override;
     int Close() override;
 
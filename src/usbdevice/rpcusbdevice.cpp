@@ -1079,12 +1079,43 @@ static UniValue devicegetnewstealthaddress(const JSONRPCRequest &request)
         }
         vSpendPath.push_back(WithHardenedBit(nSpendGenerated));
 
-        std::vector<std::unique_ptr<usb_device::CUSBDevice> > vDevices;
-        usb_device::CUSBDevice *pDevice = SelectDevice(vDevices);
-
+        // Hardened spend keys can't be derived from the stored xpub, read a
+        // batch from the device and keep the unused keys for the next addresses.
         CPubKey pkSpend;
-        if (0 != pDevice->GetPubKey(vSpendPath, pkSpend, false, sError)) {
-            throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Device GetPubKey failed %s.", sError));
+        std::vector<uint8_t> &vDeviceKeys = sekSpend->mapValue[EKVT_DEVICE_KEYS];
+        if (vDeviceKeys.size() >= 4 + 33) {
+            if (ReadLE32(vDeviceKeys.data()) == nSpendGenerated) {
+                pkSpend.Set(vDeviceKeys.begin() + 4, vDeviceKeys.begin() + 4 + 33);
+            }
+        }
+        if (pkSpend.IsValid()) {
+            vDeviceKeys.erase(vDeviceKeys.begin() + 4, vDeviceKeys.begin() + 4 + 33);
+        } else {
+            std::vector<std::unique_ptr<usb_device::CUSBDevice> > vDevices;
+            usb_device::CUSBDevice *pDevice = SelectDevice(vDevices);
+
+            if (0 != pDevice->GetPubKey(vSpendPath, pkSpend, false, sError)) {
+                throw JSONRPCError(RPC_INTERNAL_ERROR, strprintf("Device GetPubKey failed %s.", sError));
+            }
+
+            vDeviceKeys.clear();
+            for (uint32_t i = 1; i < usb_device::DEVICE_KEY_LOOKAHEAD; ++i) {
+                CPubKey pk;
+                vSpendPath.back() = WithHardenedBit(nSpendGenerated + i);
+                if (0 != pDevice->GetPubKey(vSpendPath, pk, false, sError) || pk.size() != 33) {
+                    break; // The keys read so far are still usable
+                }
+                vDeviceKeys.insert(vDeviceKeys.end(), pk.begin(), pk.end());
+            }
+            pDevice->Cleanup();
+            if (!vDeviceKeys.empty()) {
+                vDeviceKeys.insert(vDeviceKeys.begin(), 4, 0);
+            }
+        }
+        if (vDeviceKeys.size() < 4 + 33) {
+            sekSpend->mapValue.erase(EKVT_DEVICE_KEYS);
+        } else {
+            WriteLE32(vDeviceKeys.data(), nSpendGenerated + 1);
         }
 
         sekSpend->nHGenerated = nSpendGenerated+1;
@@ -14,6 +14,7 @@
 #include <util/system.h>
 #include <shutdown.h>
 #include <univalue.h>
+#include <tuple>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -32,6 +33,7 @@ void CTrezorDevice::Cleanup()
 
     m_cache.clear();
     m_tx_cache.clear();
+    ClearSession();
 }
 
 int CTrezorDevice::Open()
@@ -305,6 +307,10 @@ int CTrezorDevice::GetInfo(UniValue& info, std::string& sError)
 
 int CTrezorDevice::GetPubKey(const std::vector<uint32_t>& vPath, CPubKey& pk, bool display, std::string& sError)
 {
+    if (!display && GetCachedPubKey(vPath, pk)) {
+        return 0;
+    }
+
     tzr_proto::GetPublicKey msg_in;
     tzr_proto::PublicKey msg_out;
 
@@ -344,6 +350,7 @@ int CTrezorDevice::GetPubKey(const std::vector<uint32_t>& vPath, CPubKey& pk, bo
 
     size_t lenPubkey = msg_out.node().public_key().size();
     pk.Set(&msg_out.node().public_key().c_str()[0], &msg_out.node().public_key().c_str()[lenPubkey]);
+    m_pubkey_cache[vPath] = pk;
 
     return 0;
 };
@@ -353,6 +360,9 @@ int CTrezorDevice::GetXPub(const std::vector<uint32_t>& vPath, CExtPubKey& ekp,
     if (vPath.size() < 1 || vPath.size() > 10) {
         return errorN(1, sError, __func__, "Path depth out of range.");
     }
+    if (GetCachedXPub(vPath, ekp)) {
+        return 0;
+    }
     size_t lenPath = vPath.size();
 
     tzr_proto::GetPublicKey msg_in;
@@ -414,6 +424,8 @@ int CTrezorDevice::GetXPub(const std::vector<uint32_t>& vPath, CExtPubKey& ekp,
     if (lenPubkey == 65 && !ekp.pubkey.Compress()) {
         return errorN(1, sError, __func__, "Pubkey compression failed.");
     }
+    m_pubkey_cache[vPath] = ekp.pubkey;
+    m_xpub_cache[vPath] = ekp;
 
     return 0;
 };
@@ -588,6 +600,11 @@ int CTrezorDevice::CompleteTransaction(int change_pos, const std::vector<uint32_
 
     std::vector<uint8_t> vec_in, vec_out, serialised_tx;
 
+    // The device requests the same inputs and outputs several times while
+    // confirming and signing, each reply is built once and then resent.
+    typedef std::tuple<int, std::string, uint32_t> AckKey;
+    std::map<AckKey, std::vector<uint8_t> > ack_cache;
+
     vec_in.resize(msg_in.ByteSizeLong());
 
     if (!msg_in.SerializeToArray(vec_in.data(), vec_in.size())) {
@@ -650,6 +667,15 @@ int CTrezorDevice::CompleteTransaction(int change_pos, const std::vector<uint32_
             }
         }
 
+        AckKey ack_key(req.request_type(), req.details().tx_hash(), req.details().request_index());
+        const auto ack_it = ack_cache.find(ack_key);
+        if (ack_it != ack_cache.end()) {
+            if (0 != WriteV1(hw::trezor::messages::MessageType_TxAck, ack_it->second)) {
+                return errorN(1, m_error, __func__, "WriteV1 failed.");
+            }
+            continue;
+        }
+
         tzr_proto::TxAck msg;
         if (req.request_type() == tzr_proto::TxRequest::TXINPUT) {
             if (req.details().has_tx_hash()) {
@@ -900,6 +926,7 @@ int CTrezorDevice::CompleteTransaction(int change_pos, const std::vector<uint32_
         if (!msg.SerializeToArray(vec_in.data(), vec_in.size())) {
             return errorN(1, m_error, __func__, "SerializeToArray failed.");
         }
+        ack_cache[ack_key] = vec_in;
 
         if (0 != WriteV1(hw::trezor::messages::MessageType_TxAck, vec_in)) {
             return errorN(1, m_error, __func__, "WriteV1 failed.");
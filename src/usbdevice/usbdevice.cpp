@@ -195,6 +195,33 @@ CUSBDevice *SelectDevice(std::vector<std::unique_ptr<CUSBDevice> > &vDevices, st
     return vDevices[0].get();
 };
 
+void CUSBDevice::ClearSession()
+{
+    m_pubkey_cache.clear();
+    m_xpub_cache.clear();
+    m_signing_paths.clear();
+};
+
+bool CUSBDevice::GetCachedPubKey(const std::vector<uint32_t> &vPath, CPubKey &pk) const
+{
+    const auto mi = m_pubkey_cache.find(vPath);
+    if (mi == m_pubkey_cache.end()) {
+        return false;
+    }
+    pk = mi->second;
+    return true;
+};
+
+bool CUSBDevice::GetCachedXPub(const std::vector<uint32_t> &vPath, CExtPubKey &ekp) const
+{
+    const auto mi = m_xpub_cache.find(vPath);
+    if (mi == m_xpub_cache.end()) {
+        return false;
+    }
+    ekp = mi->second;
+    return true;
+};
+
 DeviceSignatureCreator::DeviceSignatureCreator(CUSBDevice *pDeviceIn, const CMutableTransaction *txToIn,
     unsigned int nInIn, const std::vector<uint8_t> &amountIn, int nHashTypeIn)
     : BaseSignatureCreator(), txTo(txToIn), nIn(nInIn), nHashType(nHashTypeIn), amount(amountIn), checker(txTo, nIn, amountIn), pDevice(pDeviceIn)
@@ -209,6 +236,14 @@ bool DeviceSignatureCreator::CreateSig(const SigningProvider &provider, std::vec
 
     const LegacyScriptPubKeyMan *pkm = dynamic_cast<const LegacyScriptPubKeyMan*>(&provider);
     if (pkm) {
+        const auto mi = pDevice->m_signing_paths.find(keyid);
+        if (mi != pDevice->m_signing_paths.end()) {
+            if (0 != pDevice->SignTransaction(mi->second.vPath, mi->second.vSharedSecret, txTo, nIn, scriptCode, nHashType, amount, sigversion, vchSig, pDevice->m_error)) {
+                return error("%s: SignTransaction failed.", __func__);
+            }
+            return true;
+        }
+
         //uint256 hash = SignatureHash(scriptCode, *txTo, nIn, nHashType, amount, sigversion);
         const CHDWallet *pw = dynamic_cast<const CHDWallet*>(&pkm->m_storage);
         if (pw) {
@@ -250,6 +285,9 @@ bool DeviceSignatureCreator::CreateSig(const SigningProvider &provider, std::vec
             } else {
                 return error("%s: HaveKey error.", __func__);
             }
+            CSigningPath &signing_path = pDevice->m_signing_paths[keyid];
+            signing_path.vPath = vPath;
+            signing_path.vSharedSecret = vSharedSecret;
             if (0 != pDevice->SignTransaction(vPath, vSharedSecret, txTo, nIn, scriptCode, nHashType, amount, sigversion, vchSig, pDevice->m_error)) {
                 return error("%s: SignTransaction failed.", __func__);
             }
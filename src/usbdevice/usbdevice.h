@@ -13,6 +13,7 @@
 #include <pubkey.h>
 #include <script/sign.h>
 #include <script/signingprovider.h>
+#include <map>
 #include <memory>
 
 struct CExtPubKey;
@@ -31,6 +32,9 @@ enum DeviceTypeID {
     USBDEVICE_SIZE,
 };
 
+/** Number of hardened keys read from the device at once and kept in the wallet for later use */
+static const uint32_t DEVICE_KEY_LOOKAHEAD = 10;
+
 void ShutdownHardwareIntegration();
 
 class CPathKey
@@ -40,6 +44,13 @@ public:
     CPubKey pk;
 };
 
+class CSigningPath
+{
+public:
+    std::vector<uint32_t> vPath;
+    std::vector<uint8_t> vSharedSecret;
+};
+
 class CPathKeyStore : public FillableSigningProvider
 {
 public:
@@ -116,7 +127,7 @@ public:
     };
 
     /** Close open connections and clear all cached data */
-    virtual void Cleanup() {};
+    virtual void Cleanup() { ClearSession(); };
     virtual int Open() { return 0; };
     virtual int Close() { return 0; };
 
@@ -148,6 +159,19 @@ public:
     virtual bool HavePrevTxn(const uint256 &txid) { return false; };
     virtual int AddPrevTxn(CTransactionRef tx) { return 0; };
 
+    /** Drop the keys and paths cached for the current session */
+    void ClearSession();
+    bool GetCachedPubKey(const std::vector<uint32_t> &vPath, CPubKey &pk) const;
+    bool GetCachedXPub(const std::vector<uint32_t> &vPath, CExtPubKey &ekp) const;
+
+    // Device round trips dominate signing, keys read from the device are
+    // kept until Cleanup so repeated paths are answered from the host.
+    std::map<std::vector<uint32_t>, CPubKey> m_pubkey_cache;
+    std::map<std::vector<uint32_t>, CExtPubKey> m_xpub_cache;
+    // Wallet key paths resolved by DeviceSignatureCreator, spending many
+    // outputs of one key looks the path up once.
+    std::map<CKeyID, CSigningPath> m_signing_paths;
+
     const DeviceType *pType = nullptr;
     char cPath[512];
     char cSerialNo[128];
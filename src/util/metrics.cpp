@@ -0,0 +1,150 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <util/metrics.h>
+
+#include <tinyformat.h>
+#include <util/memory.h>
+
+#include <algorithm>
+#include <cassert>
+
+const std::vector<int64_t> METRICS_DURATION_BOUNDS{100, 1000, 10000, 100000, 1000000, 10000000};
+
+MetricsRegistry g_metrics;
+
+MetricHistogram::MetricHistogram(std::vector<int64_t> bounds, double unit)
+    : m_bounds(std::move(bounds)), m_unit(unit), m_buckets(new std::atomic<uint64_t>[m_bounds.size() + 1])
+{
+    assert(std::is_sorted(m_bounds.begin(), m_bounds.end()));
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        m_buckets[i] = 0;
+    }
+}
+
+void MetricHistogram::Observe(int64_t value)
+{
+    const size_t bucket = std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin();
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<uint64_t> MetricHistogram::BucketCounts() const
+{
+    std::vector<uint64_t> counts(m_bounds.size() + 1);
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+void MetricsWriter::Family(const std::string& name, const std::string& type, const std::string& help)
+{
+    m_output += strprintf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void MetricsWriter::Sample(const std::string& name, const std::string& labels, double value)
+{
+    if (labels.empty()) {
+        m_output += strprintf("%s %.15g\n", name, value);
+    } else {
+        m_output += strprintf("%s{%s} %.15g\n", name, labels, value);
+    }
+}
+
+void MetricsWriter::Histogram(const std::string& name, const std::string& labels, const MetricHistogram& histogram)
+{
+    // Read the buckets first, the total count may be ahead of them while observations are made
+    const std::vector<uint64_t> counts = histogram.BucketCounts();
+    const std::string sep = labels.empty() ? "" : labels + ",";
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < histogram.Bounds().size(); ++i) {
+        cumulative += counts[i];
+        Sample(name + "_bucket", strprintf("%sle=\"%.15g\"", sep, histogram.Bounds()[i] / histogram.Unit()), cumulative);
+    }
+    cumulative += counts.back();
+    Sample(name + "_bucket", sep + "le=\"+Inf\"", cumulative);
+    Sample(name + "_sum", labels, histogram.Sum() / histogram.Unit());
+    Sample(name + "_count", labels, cumulative);
+}
+
+MetricCounter& MetricsRegistry::Counter(const std::string& name, const std::string& help)
+{
+    LOCK(m_mutex);
+    Entry& entry = m_entries[name];
+    if (!entry.counter) {
+        assert(!entry.gauge && !entry.histogram);
+        entry.help = help;
+        entry.counter = MakeUnique<MetricCounter>();
+    }
+    return *entry.counter;
+}
+
+MetricGauge& MetricsRegistry::Gauge(const std::string& name, const std::string& help)
+{
+    LOCK(m_mutex);
+    Entry& entry = m_entries[name];
+    if (!entry.gauge) {
+        assert(!entry.counter && !entry.histogram);
+        entry.help = help;
+        entry.gauge = MakeUnique<MetricGauge>();
+    }
+    return *entry.gauge;
+}
+
+MetricHistogram& MetricsRegistry::Histogram(const std::string& name, const std::string& help,
+    const std::vector<int64_t>& bounds, double unit)
+{
+    LOCK(m_mutex);
+    Entry& entry = m_entries[name];
+    if (!entry.histogram) {
+        assert(!entry.counter && !entry.gauge);
+        entry.help = help;
+        entry.histogram = MakeUnique<MetricHistogram>(bounds, unit);
+    }
+    return *entry.histogram;
+}
+
+void MetricsRegistry::AddCollector(const std::string& name, Collector collector)
+{
+    LOCK(m_mutex);
+    m_collectors[name] = std::move(collector);
+}
+
+void MetricsRegistry::RemoveCollector(const std::string& name)
+{
+    LOCK(m_mutex);
+    m_collectors.erase(name);
+}
+
+std::string MetricsRegistry::Render()
+{
+    MetricsWriter writer;
+    std::vector<Collector> collectors;
+    {
+        LOCK(m_mutex);
+        for (const auto& it : m_entries) {
+            const Entry& entry = it.second;
+            if (entry.counter) {
+                writer.Family(it.first, "counter", entry.help);
+                writer.Sample(it.first, "", entry.counter->Get());
+            } else if (entry.gauge) {
+                writer.Family(it.first, "gauge", entry.help);
+                writer.Sample(it.first, "", entry.gauge->Get());
+            } else if (entry.histogram) {
+                writer.Family(it.first, "histogram", entry.help);
+                writer.Histogram(it.first, "", *entry.histogram);
+            }
+        }
+        for (const auto& it : m_collectors) {
+            collectors.push_back(it.second);
+        }
+    }
+    // Collectors take the locks of what they read, which may be held while a metric is created
+    for (const auto& collector : collectors) {
+        collector(writer);
+    }
+    return writer.Output();
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTIL_METRICS_H
+#define BITCOIN_UTIL_METRICS_H
+
+#include <sync.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/** Bucket bounds in microseconds for the duration histograms */
+extern const std::vector<int64_t> METRICS_DURATION_BOUNDS;
+
+/** A value that only goes up, Inc() is a relaxed atomic add */
+class MetricCounter
+{
+public:
+    void Inc(uint64_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t Get() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_value{0};
+};
+
+/** A value that's set, or goes up and down */
+class MetricGauge
+{
+public:
+    void Set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    void Add(int64_t n) { m_value.fetch_add(n, std::memory_order_relaxed); }
+    int64_t Get() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+/**
+ * Counts of observed integer values, e.g. durations in microseconds, in
+ * cumulative buckets. Observe() is a few relaxed atomic adds, values are
+ * divided by unit when written out so durations are reported in seconds.
+ */
+class MetricHistogram
+{
+public:
+    MetricHistogram(std::vector<int64_t> bounds, double unit);
+
+    void Observe(int64_t value);
+
+    const std::vector<int64_t>& Bounds() const { return m_bounds; }
+    double Unit() const { return m_unit; }
+    /** Count of values in each bucket, the last is for values over every bound */
+    std::vector<uint64_t> BucketCounts() const;
+    uint64_t Count() const { return m_count.load(std::memory_order_relaxed); }
+    int64_t Sum() const { return m_sum.load(std::memory_order_relaxed); }
+
+private:
+    const std::vector<int64_t> m_bounds;
+    const double m_unit;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<int64_t> m_sum{0};
+};
+
+/**
+ * Writes metrics in the Prometheus text exposition format. The samples of a
+ * family follow its Family() call, labels are given preformatted, e.g.
+ * {"stage=\"anon_checks\""}.
+ */
+class MetricsWriter
+{
+public:
+    void Family(const std::string& name, const std::string& type, const std::string& help);
+    void Sample(const std::string& name, const std::string& labels, double value);
+    void Histogram(const std::string& name, const std::string& labels, const MetricHistogram& histogram);
+
+    const std::string& Output() const { return m_output; }
+
+private:
+    std::string m_output;
+};
+
+/**
+ * The metrics of the node. Counters, gauges and histograms are created once
+ * by name and the references kept by the code updating them, which never
+ * locks. Values that already exist elsewhere, like the mempool usage, are
+ * read by collectors when the metrics are written out instead.
+ */
+class MetricsRegistry
+{
+public:
+    /** Get the metric of name, creating it on the first call */
+    MetricCounter& Counter(const std::string& name, const std::string& help);
+    MetricGauge& Gauge(const std::string& name, const std::string& help);
+    MetricHistogram& Histogram(const std::string& name, const std::string& help,
+        const std::vector<int64_t>& bounds = METRICS_DURATION_BOUNDS, double unit = 1e6);
+
+    using Collector = std::function<void(MetricsWriter&)>;
+    /** Add a collector called on each Render(), it's removed by RemoveCollector(name) */
+    void AddCollector(const std::string& name, Collector collector);
+    void RemoveCollector(const std::string& name);
+
+    /** Write out all metrics */
+    std::string Render();
+
+private:
+    struct Entry {
+        std::string help;
+        std::unique_ptr<MetricCounter> counter;
+        std::unique_ptr<MetricGauge> gauge;
+        std::unique_ptr<MetricHistogram> histogram;
+    };
+
+    Mutex m_mutex;
+    std::map<std::string, Entry> m_entries GUARDED_BY(m_mutex);
+    std::map<std::string, Collector> m_collectors GUARDED_BY(m_mutex);
+};
+
+extern MetricsRegistry g_metrics;
+
+#endif // BITCOIN_UTIL_METRICS_H
@@ -0,0 +1,351 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <util/taskpool.h>
+
+#include <logging.h>
+#include <util/system.h>
+
+#include <algorithm>
+
+TaskPool g_task_pool;
+
+namespace {
+//! Pool and index of the worker running on this thread, to keep its own submissions local
+thread_local const TaskPool* g_worker_pool{nullptr};
+thread_local size_t g_worker_index{0};
+
+std::chrono::steady_clock::rep Ticks(std::chrono::steady_clock::time_point t)
+{
+    return t.time_since_epoch().count();
+}
+} // namespace
+
+TaskPool::~TaskPool()
+{
+    if (!m_threads.empty()) {
+        Stop();
+    }
+}
+
+void TaskPool::Start(int threads)
+{
+    Stop();
+    if (threads < 1) {
+        return;
+    }
+    {
+        LOCK(m_mutex);
+        m_stop = false;
+        for (int i = 0; i < threads; ++i) {
+            m_workers.emplace_back(new Worker);
+        }
+        m_num_threads = threads;
+        m_running = true;
+    }
+    for (int i = 0; i < threads; ++i) {
+        m_threads.emplace_back(&TraceThread<std::function<void()>>, "taskpool", [this, i] { ThreadWorker(i); });
+    }
+}
+
+void TaskPool::Stop()
+{
+    {
+        LOCK(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto& t : m_threads) {
+        t.join();
+    }
+    m_threads.clear();
+
+    LOCK(m_mutex);
+    m_running = false;
+    m_num_threads = 0;
+    m_workers.clear();
+    m_periodic.clear();
+    m_pending = 0;
+    m_next_periodic = Ticks(std::chrono::steady_clock::time_point::max());
+    m_periodic_cv.notify_all();
+}
+
+void TaskPool::Push(TaskPriority priority, Task&& task)
+{
+    const size_t index = g_worker_pool == this ? g_worker_index
+                       : m_next_worker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+    Worker& worker = *m_workers[index];
+    {
+        LOCK(worker.m_mutex);
+        worker.m_lanes[(int)priority].push_back(std::move(task));
+    }
+    ++m_pending;
+}
+
+bool TaskPool::Submit(TaskPriority priority, Task task)
+{
+    {
+        LOCK(m_mutex);
+        if (!m_running || m_stop) {
+            return false;
+        }
+        Push(priority, std::move(task));
+    }
+    m_cv.notify_one();
+    return true;
+}
+
+bool TaskPool::TryRun(size_t index)
+{
+    const size_t num_workers = m_workers.size();
+    for (int lane = 0; lane < NUM_TASK_PRIORITIES; ++lane) {
+        Task task;
+        bool stolen = false;
+        for (size_t i = 0; i < num_workers && !task; ++i) {
+            Worker& worker = *m_workers[(index + i) % num_workers];
+            LOCK(worker.m_mutex);
+            auto& queue = worker.m_lanes[lane];
+            if (!queue.empty()) {
+                task = std::move(queue.front());
+                queue.pop_front();
+                stolen = i > 0;
+            }
+        }
+        if (!task) {
+            continue;
+        }
+        --m_pending;
+        if (stolen) {
+            m_stolen.fetch_add(1, std::memory_order_relaxed);
+        }
+        try {
+            task();
+        } catch (const std::exception& e) {
+            LogPrintf("%s: Task threw: %s\n", __func__, e.what());
+        } catch (...) {
+            LogPrintf("%s: Task threw an unknown exception\n", __func__);
+        }
+        m_executed[lane].fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+std::chrono::steady_clock::time_point TaskPool::QueueDuePeriodic()
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto next = std::chrono::steady_clock::time_point::max();
+    for (auto& entry : m_periodic) {
+        Periodic& periodic = entry.second;
+        if (periodic.running) {
+            continue;
+        }
+        if (periodic.next <= now) {
+            periodic.running = true;
+            const uint64_t id = entry.first;
+            Push(periodic.priority, [this, id] { RunPeriodic(id); });
+            m_cv.notify_one();
+            continue;
+        }
+        next = std::min(next, periodic.next);
+    }
+    m_next_periodic = Ticks(next);
+    return next;
+}
+
+void TaskPool::RunPeriodic(uint64_t id)
+{
+    const Task* task;
+    {
+        LOCK(m_mutex);
+        auto it = m_periodic.find(id);
+        if (it == m_periodic.end()) {
+            return;
+        }
+        // A running entry is not erased, so the task can be called without the lock
+        task = m_stop ? nullptr : &it->second.task;
+    }
+    if (task) {
+        try {
+            (*task)();
+        } catch (const std::exception& e) {
+            LogPrintf("%s: Periodic task threw: %s\n", __func__, e.what());
+        } catch (...) {
+            LogPrintf("%s: Periodic task threw an unknown exception\n", __func__);
+        }
+    }
+    {
+        LOCK(m_mutex);
+        auto it = m_periodic.find(id);
+        if (it != m_periodic.end()) {
+            it->second.running = false;
+            it->second.next = std::chrono::steady_clock::now() + it->second.interval;
+            if (Ticks(it->second.next) < m_next_periodic) {
+                m_next_periodic = Ticks(it->second.next);
+            }
+        }
+    }
+    m_periodic_cv.notify_all();
+    // A sleeping worker may be waiting past the new due time
+    m_cv.notify_one();
+}
+
+void TaskPool::ThreadWorker(size_t index)
+{
+    g_worker_pool = this;
+    g_worker_index = index;
+    while (true) {
+        if (TryRun(index)) {
+            if (Ticks(std::chrono::steady_clock::now()) >= m_next_periodic) {
+                LOCK(m_mutex);
+                if (!m_stop) {
+                    QueueDuePeriodic();
+                }
+            }
+            continue;
+        }
+        WAIT_LOCK(m_mutex, lock);
+        const auto next = m_stop ? std::chrono::steady_clock::time_point::max() : QueueDuePeriodic();
+        if (m_pending > 0) {
+            continue;
+        }
+        if (m_stop) {
+            break;
+        }
+        if (next == std::chrono::steady_clock::time_point::max()) {
+            m_cv.wait(lock);
+        } else {
+            m_cv.wait_until(lock, next);
+        }
+    }
+    g_worker_pool = nullptr;
+}
+
+void TaskPool::ParallelFor(TaskPriority priority, size_t n, const std::function<void(size_t)>& fn, int max_helpers)
+{
+    size_t helpers = n > 1 ? std::min(n - 1, (size_t)m_num_threads.load()) : 0;
+    if (max_helpers >= 0) {
+        helpers = std::min(helpers, (size_t)max_helpers);
+    }
+    if (helpers == 0 || !m_running) {
+        for (size_t i = 0; i < n; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    // Shared with the helper tasks, which can outlive this call if they start late
+    struct State {
+        std::atomic<size_t> next{0};
+        Mutex mutex;
+        std::condition_variable cv;
+        int active GUARDED_BY(mutex){0};
+        bool closed GUARDED_BY(mutex){false};
+    };
+    auto state = std::make_shared<State>();
+    // fn is only called by helpers counted in active, which the caller waits for
+    const std::function<void(size_t)>* pfn = &fn;
+
+    for (size_t h = 0; h < helpers; ++h) {
+        const bool queued = Submit(priority, [state, pfn, n] {
+            {
+                LOCK(state->mutex);
+                if (state->closed) {
+                    return;
+                }
+                ++state->active;
+            }
+            struct Leave {
+                State& s;
+                ~Leave()
+                {
+                    {
+                        LOCK(s.mutex);
+                        --s.active;
+                    }
+                    s.cv.notify_all();
+                }
+            } leave{*state};
+            for (size_t i; (i = state->next.fetch_add(1)) < n;) {
+                (*pfn)(i);
+            }
+        });
+        if (!queued) {
+            break;
+        }
+    }
+
+    struct Join {
+        State& s;
+        ~Join()
+        {
+            WAIT_LOCK(s.mutex, lock);
+            s.closed = true;
+            while (s.active > 0) {
+                s.cv.wait(lock);
+            }
+        }
+    } join{*state};
+    for (size_t i; (i = state->next.fetch_add(1)) < n;) {
+        fn(i);
+    }
+}
+
+uint64_t TaskPool::AddPeriodic(TaskPriority priority, std::chrono::milliseconds interval, Task task)
+{
+    uint64_t id;
+    {
+        LOCK(m_mutex);
+        if (!m_running || m_stop) {
+            return 0;
+        }
+        id = ++m_periodic_id;
+        Periodic& periodic = m_periodic[id];
+        periodic.priority = priority;
+        periodic.interval = interval;
+        periodic.next = std::chrono::steady_clock::now() + interval;
+        periodic.task = std::move(task);
+        if (Ticks(periodic.next) < m_next_periodic) {
+            m_next_periodic = Ticks(periodic.next);
+        }
+    }
+    m_cv.notify_one();
+    return id;
+}
+
+void TaskPool::CancelPeriodic(uint64_t id)
+{
+    WAIT_LOCK(m_mutex, lock);
+    while (true) {
+        auto it = m_periodic.find(id);
+        if (it == m_periodic.end()) {
+            return;
+        }
+        if (!it->second.running) {
+            m_periodic.erase(it);
+            return;
+        }
+        m_periodic_cv.wait(lock);
+    }
+}
+
+TaskPool::Stats TaskPool::GetStats() const
+{
+    Stats stats;
+    stats.threads = m_num_threads;
+    for (int lane = 0; lane < NUM_TASK_PRIORITIES; ++lane) {
+        stats.executed[lane] = m_executed[lane].load(std::memory_order_relaxed);
+    }
+    stats.stolen = m_stolen.load(std::memory_order_relaxed);
+
+    LOCK(m_mutex);
+    stats.periodic = m_periodic.size();
+    for (const auto& worker : m_workers) {
+        LOCK(worker->m_mutex);
+        for (int lane = 0; lane < NUM_TASK_PRIORITIES; ++lane) {
+            stats.queued[lane] += worker->m_lanes[lane].size();
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTIL_TASKPOOL_H
+#define BITCOIN_UTIL_TASKPOOL_H
+
+#include <sync.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** Default for -taskpoolthreads, 0 = one per core */
+static const int DEFAULT_TASKPOOL_THREADS = 0;
+/** Maximum number of task pool threads */
+static const int MAX_TASKPOOL_THREADS = 16;
+
+/** Lanes of the task pool, a worker takes a task from the highest lane with work */
+enum class TaskPriority : int {
+    HIGH = 0,   // Work a caller or peer is waiting on
+    NORMAL = 1,
+    LOW = 2,    // Housekeeping and background scans
+};
+static const int NUM_TASK_PRIORITIES = 3;
+
+/**
+ * Shared worker threads for short background tasks of subsystems that used to
+ * run their own mostly idle threads.
+ *
+ * Each worker has a deque per lane. Tasks submitted from a worker go on its
+ * own deque, other threads spread tasks over the workers in turn. A worker
+ * runs the oldest task in a lane of its own deque and, when that lane is
+ * empty, steals from the other workers before moving down to a lower lane.
+ * Periodic tasks are queued by whichever worker notices they are due, so the
+ * pool needs no timer thread.
+ *
+ * Tasks must not block on long waits, loops that run for the life of the
+ * node or need a bounded latency keep their own threads.
+ */
+class TaskPool
+{
+public:
+    using Task = std::function<void()>;
+
+    struct Stats {
+        int threads{0};
+        uint64_t executed[NUM_TASK_PRIORITIES]{};
+        uint64_t stolen{0};
+        size_t queued[NUM_TASK_PRIORITIES]{};
+        size_t periodic{0};
+    };
+
+    ~TaskPool();
+
+    void Start(int threads);
+    /** Run the tasks already queued, then join the workers. Periodic tasks are dropped. */
+    void Stop();
+
+    bool IsRunning() const { return m_running; }
+    int NumThreads() const { return m_num_threads; }
+
+    /** Queue a task, false if the pool is stopped and the task was not queued. */
+    bool Submit(TaskPriority priority, Task task);
+
+    /**
+     * Call fn(i) for i in [0, n) on the calling thread and up to max_helpers
+     * workers, max_helpers < 0 for no limit. Returns once every call is done.
+     * Runs inline when the pool is stopped. Helpers that start after the calls
+     * are all taken return without running fn, so a caller never waits behind
+     * the queue and nested calls from a task can't deadlock.
+     */
+    void ParallelFor(TaskPriority priority, size_t n, const std::function<void(size_t)>& fn, int max_helpers = -1);
+
+    /**
+     * Run task every interval, first after one interval. A run is only queued
+     * once the previous has finished. Returns an id for CancelPeriodic, 0 if
+     * the pool is stopped.
+     */
+    uint64_t AddPeriodic(TaskPriority priority, std::chrono::milliseconds interval, Task task);
+    /** Remove a periodic task, waiting for a run in progress. Must not be called from the task itself. */
+    void CancelPeriodic(uint64_t id);
+
+    Stats GetStats() const;
+
+private:
+    struct Worker {
+        Mutex m_mutex;
+        std::deque<Task> m_lanes[NUM_TASK_PRIORITIES] GUARDED_BY(m_mutex);
+    };
+
+    struct Periodic {
+        TaskPriority priority;
+        std::chrono::milliseconds interval;
+        std::chrono::steady_clock::time_point next;
+        Task task;
+        bool running{false};
+    };
+
+    void ThreadWorker(size_t index);
+    void Push(TaskPriority priority, Task&& task);
+    bool TryRun(size_t index);
+    void RunPeriodic(uint64_t id);
+    /** Queue the periodic tasks that are due, returns when the next is due. */
+    std::chrono::steady_clock::time_point QueueDuePeriodic() EXCLUSIVE_LOCKS_REQUIRED(m_mutex);
+
+    std::atomic<bool> m_running{false};
+    std::atomic<int> m_num_threads{0};
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread> m_threads;
+    std::atomic<size_t> m_next_worker{0};
+    //! Tasks queued and not yet taken by a worker
+    std::atomic<size_t> m_pending{0};
+    std::atomic<uint64_t> m_executed[NUM_TASK_PRIORITIES]{};
+    std::atomic<uint64_t> m_stolen{0};
+    //! steady_clock ticks when the next periodic task is due
+    std::atomic<std::chrono::steady_clock::rep> m_next_periodic{std::chrono::steady_clock::time_point::max().time_since_epoch().count()};
+
+    mutable Mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_periodic_cv;
+    bool m_stop GUARDED_BY(m_mutex){false};
+    uint64_t m_periodic_id GUARDED_BY(m_mutex){0};
+    std::map<uint64_t, Periodic> m_periodic GUARDED_BY(m_mutex);
+};
+
+/** Pool shared by smsg and other subsystems, started in AppInitMain. */
+extern TaskPool g_task_pool;
+
+#endif // BITCOIN_UTIL_TASKPOOL_H
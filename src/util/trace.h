@@ -0,0 +1,54 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTIL_TRACE_H
+#define BITCOIN_UTIL_TRACE_H
+
+#if defined(HAVE_CONFIG_H)
+#include <config/bitcoin-config.h>
+#endif
+
+/**
+ * USDT tracepoints, see doc/tracing.md.
+ *
+ * Built with --enable-usdt each TRACEn(context, event, args...) leaves a nop
+ * and a note in the binary that a tracer like bpftrace can attach to, so an
+ * unattached probe costs next to nothing. Otherwise the macros and their
+ * arguments are compiled out entirely. Arguments must be integers or
+ * pointers, strings are passed as const char*.
+ */
+#ifdef ENABLE_TRACING
+
+#include <sys/sdt.h>
+
+#include <util/time.h>
+
+#define TRACE(context, event) DTRACE_PROBE(context, event)
+#define TRACE1(context, event, a) DTRACE_PROBE1(context, event, a)
+#define TRACE2(context, event, a, b) DTRACE_PROBE2(context, event, a, b)
+#define TRACE3(context, event, a, b, c) DTRACE_PROBE3(context, event, a, b, c)
+#define TRACE4(context, event, a, b, c, d) DTRACE_PROBE4(context, event, a, b, c, d)
+#define TRACE5(context, event, a, b, c, d, e) DTRACE_PROBE5(context, event, a, b, c, d, e)
+#define TRACE6(context, event, a, b, c, d, e, f) DTRACE_PROBE6(context, event, a, b, c, d, e, f)
+
+//! Start a timer whose elapsed microseconds are passed to a later probe
+#define TRACE_TIME_START(name) const int64_t name = GetTimeMicros()
+#define TRACE_TIME_ELAPSED(name) (GetTimeMicros() - (name))
+
+#else
+
+#define TRACE(context, event)
+#define TRACE1(context, event, a)
+#define TRACE2(context, event, a, b)
+#define TRACE3(context, event, a, b, c)
+#define TRACE4(context, event, a, b, c, d)
+#define TRACE5(context, event, a, b, c, d, e)
+#define TRACE6(context, event, a, b, c, d, e, f)
+
+#define TRACE_TIME_START(name)
+#define TRACE_TIME_ELAPSED(name)
+
+#endif
+
+#endif // BITCOIN_UTIL_TRACE_H
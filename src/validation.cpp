@@ -14,12 +14,15 @@
 #include <consensus/tx_check.h>
 #include <consensus/tx_verify.h>
 #include <consensus/validation.h>
+#include <crypto/hmac_sha256.h>
 #include <cuckoocache.h>
 #include <flatfile.h>
 #include <hash.h>
 #include <index/txindex.h>
 #include <logging.h>
 #include <logging/timer.h>
+#include <node/blockcache.h>
+#include <node/blockprefetch.h>
 #include <node/ui_interface.h>
 #include <optional.h>
 #include <policy/fees.h>
@@ -29,6 +32,7 @@
 #include <pos/diffalgo.h>
 #include <primitives/block.h>
 #include <primitives/transaction.h>
+#include <proofcache.h>
 #include <random.h>
 #include <reverse_iterator.h>
 #include <script/script.h>
@@ -47,8 +51,10 @@
 #include <util/rbf.h>
 #include <util/strencodings.h>
 #include <util/system.h>
+#include <util/trace.h>
 #include <util/translation.h>
 #include <validationinterface.h>
+#include <validationstats.h>
 #include <warnings.h>
 #include <smsg/smessage.h>
 #include <net.h>
@@ -57,8 +63,11 @@
 #include <rctindex.h>
 #include <insight/insight.h>
 #include <insight/balanceindex.h>
+#include <insight/rewardindex.h>
 #include "adapter.h"
+#include <condition_variable>
 #include <string>
+#include <thread>
 
 #include <boost/algorithm/string/replace.hpp>
 
@@ -147,6 +156,34 @@ std::map<uint256, StakeConflict> mapStakeConflict;
 std::map<COutPoint, uint256> mapStakeSeen;
 std::list<COutPoint> listStakeSeen;
 ColdRewardTracker rewardTracker;
+//! Reward tracker balances, ranges and undo data written since the tracker transaction started, see transactionEnder
+static std::unique_ptr<CDBBatch> rewardTrackerBatch;
+
+//! Reward tracker data of the transactions ended while rebuilding the tracked data, see StartRewardTrackerRebuild
+static std::unique_ptr<CDBBatch> rewardTrackerRebuildBatch;
+//! Flush the data kept while rebuilding once the batch or the tracker cache get this large
+static const size_t REWARD_TRACKER_REBUILD_BATCH_SIZE = 4 * nDefaultDbBatchSize;
+static const size_t REWARD_TRACKER_REBUILD_CACHE_SIZE = 1000000;
+
+static CDBBatch& RewardTrackerBatch()
+{
+    if (!rewardTrackerBatch) {
+        rewardTrackerBatch = MakeUnique<CDBBatch>(*pblocktree);
+    }
+    return *rewardTrackerBatch;
+}
+
+/** Write the balances, ranges, undo data and last tracked height kept while rebuilding. */
+static bool FlushRewardTrackerRebuild() EXCLUSIVE_LOCKS_REQUIRED(cs_main)
+{
+    if (!rewardTrackerRebuildBatch) {
+        return true;
+    }
+    rewardTracker.flushCache();
+    bool rv = pblocktree->WriteBatch(*rewardTrackerRebuildBatch);
+    rewardTrackerRebuildBatch->Clear();
+    return rv;
+}
 
 CoinStakeCache coinStakeCache GUARDED_BY(cs_main);
 
@@ -165,6 +202,9 @@ bool fRequireStandard = true;
 bool fCheckBlockIndex = false;
 bool fCheckpointsEnabled = DEFAULT_CHECKPOINTS_ENABLED;
 uint64_t nPruneTarget = 0;
+bool g_mmap_blocks = DEFAULT_MMAP_BLOCKS;
+int g_reindex_check_threads = DEFAULT_REINDEX_CHECK_THREADS;
+static FlatFileMapCache g_block_file_maps(MAX_MAPPED_BLOCK_FILES);
 unsigned int MIN_BLOCKS_TO_KEEP = 288;
 unsigned int NODE_NETWORK_LIMITED_MIN_BLOCKS = 288;
 int64_t nMaxTipAge = DEFAULT_MAX_TIP_AGE;
@@ -293,7 +333,7 @@ bool TestLockPointValidity(const LockPoints* lp)
     return true;
 }
 
-bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flags, LockPoints* lp, bool useExistingLockPoints)
+bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flags, LockPoints* lp, bool useExistingLockPoints, const CCoinsView* coins_view)
 {
     AssertLockHeld(cs_main);
     AssertLockHeld(pool.cs);
@@ -320,6 +360,7 @@ bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flag
     else {
         // CoinsTip() contains the UTXO set for ::ChainActive().Tip()
         CCoinsViewMemPool viewMemPool(&::ChainstateActive().CoinsTip(), pool);
+        const CCoinsView& view = coins_view ? *coins_view : viewMemPool;
         std::vector<int> prevheights;
         prevheights.resize(tx.vin.size());
         for (size_t txinIndex = 0; txinIndex < tx.vin.size(); txinIndex++) {
@@ -331,7 +372,7 @@ bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flag
             }
 
             Coin coin;
-            if (!viewMemPool.GetCoin(txin.prevout, coin)) {
+            if (!view.GetCoin(txin.prevout, coin)) {
                 return error("%s: Missing input", __func__);
             }
             if (coin.nHeight == MEMPOOL_HEIGHT) {
@@ -532,6 +573,14 @@ public:
     // Single transaction acceptance
     bool AcceptSingleTransaction(const CTransactionRef& ptx, ATMPArgs& args) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
+    /**
+     * Test a package for acceptance, only test_accept is supported. args.m_state is
+     * set if the package as a whole is rejected. Testing stops at the first
+     * transaction failing, its own state in tx_states holds the reason.
+     */
+    bool AcceptMultipleTransactions(const std::vector<CTransactionRef>& txns, ATMPArgs& args,
+        std::vector<TxValidationState>& tx_states, std::vector<CAmount>& fees) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+
 private:
     // All the intermediate state that gets passed between the various levels
     // of checking a given transaction.
@@ -628,6 +677,7 @@ bool MemPoolAccept::PreChecks(ATMPArgs& args, Workspace& ws)
 
     const Consensus::Params &consensus = Params().GetConsensus();
     state.SetStateInfo(nAcceptTime, ::ChainActive().Height(), consensus, fParticlMode, (fBusyImporting && fSkipRangeproof));
+    state.m_cache_store = true;
 
     if (!CheckTransaction(tx, state)) {
         return false; // state filled in by CheckTransaction
@@ -761,10 +811,10 @@ bool MemPoolAccept::PreChecks(ATMPArgs& args, Workspace& ws)
     // Only accept BIP68 sequence locked transactions that can be mined in the next
     // block; we don't want our mempool filled up with transactions that can't
     // be mined yet.
-    // Must keep pool.cs for this unless we change CheckSequenceLocks to take a
-    // CoinsViewCache instead of create its own
+    // Must keep pool.cs for this, inputs are looked up through m_viewmempool
+    // so the outputs of earlier package transactions are found
     if (!args.m_test_accept || !args.m_ignore_locks)
-    if (!CheckSequenceLocks(m_pool, tx, STANDARD_LOCKTIME_VERIFY_FLAGS, &lp))
+    if (!CheckSequenceLocks(m_pool, tx, STANDARD_LOCKTIME_VERIFY_FLAGS, &lp, false, &m_viewmempool))
         return state.Invalid(TxValidationResult::TX_PREMATURE_SPEND, "non-BIP68-final");
 
     CAmount nFees = 0;
@@ -1093,6 +1143,12 @@ bool MemPoolAccept::Finalize(ATMPArgs& args, Workspace& ws)
     const bool fReplacementTransaction = ws.m_replacement_transaction;
     std::unique_ptr<CTxMemPoolEntry>& entry = ws.m_entry;
 
+    // The pool indexes the key images the entry could extract, refuse the transaction if any are malformed
+    if (!entry->HasValidKeyImages()) {
+        LogPrintf("ERROR: %s: GetTxKeyImages failed.\n", __func__);
+        return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-keyimages");
+    }
+
     // Remove conflicting transactions from the mempool
     for (CTxMemPool::txiter it : allConflicting)
     {
@@ -1123,17 +1179,9 @@ bool MemPoolAccept::Finalize(ATMPArgs& args, Workspace& ws)
             return state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "mempool full");
     }
 
-    if (!AddKeyImagesToMempool(tx, m_pool)) {
-        LogPrintf("ERROR: %s: AddKeyImagesToMempool failed.\n", __func__);
-        return state.Invalid(TxValidationResult::TX_CONSENSUS, "bad-anonin-keyimages");
-    }
-
     // Update mempool indices
-    if (fAddressIndex) {
-        m_pool.addAddressIndex(*entry, m_view);
-    }
-    if (fSpentIndex) {
-        m_pool.addSpentIndex(*entry, m_view);
+    if (fAddressIndex || fSpentIndex) {
+        m_pool.addInsightIndexes(*entry, m_view, fAddressIndex, fSpentIndex);
     }
 
     return true;
@@ -1168,6 +1216,87 @@ bool MemPoolAccept::AcceptSingleTransaction(const CTransactionRef& ptx, ATMPArgs
     return true;
 }
 
+bool MemPoolAccept::AcceptMultipleTransactions(const std::vector<CTransactionRef>& txns, ATMPArgs& args,
+    std::vector<TxValidationState>& tx_states, std::vector<CAmount>& fees)
+{
+    AssertLockHeld(cs_main);
+    assert(args.m_test_accept);
+    TxValidationState &package_state = args.m_state;
+
+    if (txns.size() > MAX_PACKAGE_COUNT) {
+        return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-too-many-transactions");
+    }
+    int64_t package_size = 0;
+    std::set<uint256> later_txids;
+    for (const auto& tx : txns) {
+        package_size += GetVirtualTransactionSize(*tx);
+        later_txids.insert(tx->GetHash());
+    }
+    if (package_size > MAX_PACKAGE_SIZE * 1000) {
+        return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-too-large");
+    }
+    if (later_txids.size() != txns.size()) {
+        return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-contains-duplicates");
+    }
+
+    // Parents must come before their children and no two transactions may
+    // spend the same output or key image
+    std::set<COutPoint> spent_outpoints;
+    std::set<std::vector<uint8_t>> spent_key_images;
+    for (const auto& tx : txns) {
+        later_txids.erase(tx->GetHash());
+        for (const CTxIn& txin : tx->vin) {
+            if (txin.IsAnonInput()) {
+                if (txin.scriptData.stack.empty()) {
+                    continue;
+                }
+                const std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
+                for (size_t k = 0; k + 33 <= vKeyImages.size(); k += 33) {
+                    if (!spent_key_images.emplace(vKeyImages.begin() + k, vKeyImages.begin() + k + 33).second) {
+                        return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "conflict-in-package");
+                    }
+                }
+                continue;
+            }
+            if (later_txids.count(txin.prevout.hash)) {
+                return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-not-sorted");
+            }
+            if (!spent_outpoints.insert(txin.prevout).second) {
+                return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "conflict-in-package");
+            }
+        }
+    }
+
+    LOCK(m_pool.cs);
+    tx_states.assign(txns.size(), TxValidationState());
+    fees.assign(txns.size(), 0);
+
+    // All transactions share m_view, the coins looked up for one are there for the next
+    std::vector<Workspace> workspaces;
+    workspaces.reserve(txns.size());
+    for (size_t i = 0; i < txns.size(); ++i) {
+        workspaces.emplace_back(txns[i]);
+        ATMPArgs tx_args { args.m_chainparams, tx_states[i], args.m_accept_time, nullptr, args.m_bypass_limits,
+                           args.m_coins_to_uncache, true, &fees[i], args.m_ignore_locks };
+        if (!PreChecks(tx_args, workspaces.back())) {
+            return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-tx-failed");
+        }
+        m_viewmempool.PackageAddTransaction(txns[i]);
+    }
+
+    // Inputs from earlier package transactions aren't in the mempool, so the
+    // consensus flag rerun of ConsensusScriptChecks can't be done
+    for (size_t i = 0; i < txns.size(); ++i) {
+        ATMPArgs tx_args { args.m_chainparams, tx_states[i], args.m_accept_time, nullptr, args.m_bypass_limits,
+                           args.m_coins_to_uncache, true, &fees[i], args.m_ignore_locks };
+        PrecomputedTransactionData txdata;
+        if (!PolicyScriptChecks(tx_args, workspaces[i], txdata)) {
+            return package_state.Invalid(TxValidationResult::TX_MEMPOOL_POLICY, "package-tx-failed");
+        }
+    }
+    return true;
+}
+
 } // anon namespace
 
 /** (try to) add transaction to memory pool with a specified acceptance time **/
@@ -1177,8 +1306,10 @@ static bool AcceptToMemoryPoolWithTime(const CChainParams& chainparams, CTxMemPo
 {
     std::vector<COutPoint> coins_to_uncache;
     MemPoolAccept::ATMPArgs args { chainparams, state, nAcceptTime, plTxnReplaced, bypass_limits, coins_to_uncache, test_accept, fee_out, ignore_locks };
+    TRACE_TIME_START(trace_start);
     bool res = MemPoolAccept(pool).AcceptSingleTransaction(tx, args);
     if (!res) {
+        TRACE3(mempool, rejected, tx->GetHash().data(), state.GetRejectReason().c_str(), TRACE_TIME_ELAPSED(trace_start));
         // Remove coins that were not present in the coins cache before calling ATMPW;
         // this is to prevent memory DoS in case we receive a large number of
         // invalid transactions that attempt to overrun the in-memory coins cache
@@ -1186,6 +1317,8 @@ static bool AcceptToMemoryPoolWithTime(const CChainParams& chainparams, CTxMemPo
 
         for (const COutPoint& hashTx : coins_to_uncache)
             ::ChainstateActive().CoinsTip().Uncache(hashTx);
+    } else {
+        TRACE4(mempool, accepted, tx->GetHash().data(), GetVirtualTransactionSize(*tx), test_accept, TRACE_TIME_ELAPSED(trace_start));
     }
     // After we've (potentially) uncached entries, ensure our coins cache is still within its size limits
     BlockValidationState state_dummy;
@@ -1201,6 +1334,25 @@ bool AcceptToMemoryPool(CTxMemPool& pool, TxValidationState &state, const CTrans
     return AcceptToMemoryPoolWithTime(chainparams, pool, state, tx, GetTime(), plTxnReplaced, bypass_limits, test_accept, fee_out, ignore_locks);
 }
 
+bool ProcessNewPackage(CTxMemPool& pool, const std::vector<CTransactionRef>& package, bool test_accept,
+                       TxValidationState& package_state, std::vector<TxValidationState>& tx_states,
+                       std::vector<CAmount>& fees, bool ignore_locks)
+{
+    AssertLockHeld(cs_main);
+    assert(test_accept); // Only dry runs, as for the testmempoolaccept RPC
+    std::vector<COutPoint> coins_to_uncache;
+    MemPoolAccept::ATMPArgs args { Params(), package_state, GetTime(), nullptr, false, coins_to_uncache, test_accept, nullptr, ignore_locks };
+    const bool res = MemPoolAccept(pool).AcceptMultipleTransactions(package, args, tx_states, fees);
+
+    // Nothing was added to the mempool
+    for (const COutPoint& outpoint : coins_to_uncache) {
+        ::ChainstateActive().CoinsTip().Uncache(outpoint);
+    }
+    BlockValidationState state_dummy;
+    ::ChainstateActive().FlushStateToDisk(Params(), state_dummy, FlushStateMode::PERIODIC);
+    return res;
+}
+
 CTransactionRef GetTransaction(const CBlockIndex* const block_index, const CTxMemPool* const mempool, const uint256& hash, const Consensus::Params& consensusParams, uint256& hashBlock)
 {
     LOCK(cs_main);
@@ -1292,21 +1444,55 @@ static bool WriteBlockToDisk(const CBlock& block, FlatFilePos& pos, const CMessa
     return true;
 }
 
-bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams)
+/** Get the serialized block at pos from a mapping of its file, empty if the file can't be mapped */
+static Span<const unsigned char> MapBlockData(const FlatFilePos& pos, std::shared_ptr<const MappedFlatFile>& mapped)
+{
+    if (pos.nPos < 8) {
+        return {};
+    }
+    mapped = g_block_file_maps.Map(BlockFileSeq(), pos, pos.nPos);
+    if (!mapped) {
+        return {};
+    }
+    // The size is stored in the four bytes before the block
+    size_t size = ReadLE32(mapped->data() + pos.nPos - 4);
+    if (mapped->size() < pos.nPos + size) {
+        // The file may have grown since it was mapped
+        mapped = g_block_file_maps.Map(BlockFileSeq(), pos, pos.nPos + size);
+        if (!mapped) {
+            return {};
+        }
+    }
+    return Span<const unsigned char>(mapped->data() + pos.nPos, size);
+}
+
+bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams, int ser_flags)
 {
     block.SetNull();
 
-    // Open history file to read
-    CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
-    if (filein.IsNull())
-        return error("ReadBlockFromDisk: OpenBlockFile failed for %s", pos.ToString());
+    std::shared_ptr<const MappedFlatFile> mapped;
+    Span<const unsigned char> data = g_mmap_blocks ? MapBlockData(pos, mapped) : Span<const unsigned char>();
+    if (!data.empty()) {
+        try {
+            SpanReader filein(SER_DISK, CLIENT_VERSION | ser_flags, data);
+            filein >> block;
+        }
+        catch (const std::exception& e) {
+            return error("%s: Deserialize error - %s at %s", __func__, e.what(), pos.ToString());
+        }
+    } else {
+        // Open history file to read
+        CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION | ser_flags);
+        if (filein.IsNull())
+            return error("ReadBlockFromDisk: OpenBlockFile failed for %s", pos.ToString());
 
-    // Read block
-    try {
-        filein >> block;
-    }
-    catch (const std::exception& e) {
-        return error("%s: Deserialize or I/O error - %s at %s", __func__, e.what(), pos.ToString());
+        // Read block
+        try {
+            filein >> block;
+        }
+        catch (const std::exception& e) {
+            return error("%s: Deserialize or I/O error - %s at %s", __func__, e.what(), pos.ToString());
+        }
     }
 
     // Check the header
@@ -1329,7 +1515,7 @@ bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::P
     return true;
 }
 
-bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams)
+static bool ReadIndexedBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams, int ser_flags)
 {
     FlatFilePos blockPos;
     {
@@ -1337,7 +1523,7 @@ bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus
         blockPos = pindex->GetBlockPos();
     }
 
-    if (!ReadBlockFromDisk(block, blockPos, consensusParams))
+    if (!ReadBlockFromDisk(block, blockPos, consensusParams, ser_flags))
         return false;
     if (block.GetHash() != pindex->GetBlockHash())
         return error("ReadBlockFromDisk(CBlock&, CBlockIndex*): GetHash() doesn't match index for %s at %s",
@@ -1345,6 +1531,56 @@ bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus
     return true;
 }
 
+bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams, int ser_flags)
+{
+    if (g_block_prefetcher.Take(pindex, block)) {
+        return true;
+    }
+    // Copying a cached block only copies the references to its transactions
+    if (std::shared_ptr<const CBlock> cached = g_block_cache.Get(pindex->GetBlockHash())) {
+        block = *cached;
+        return true;
+    }
+
+    if (!ReadIndexedBlockFromDisk(block, pindex, consensusParams, ser_flags)) {
+        return false;
+    }
+    if (ser_flags == 0) {
+        g_block_cache.Insert(pindex->GetBlockHash(), std::make_shared<const CBlock>(block));
+    }
+    return true;
+}
+
+std::shared_ptr<const CBlock> ReadSharedBlockFromDisk(const CBlockIndex* pindex, const Consensus::Params& consensusParams)
+{
+    if (std::shared_ptr<const CBlock> cached = g_block_cache.Get(pindex->GetBlockHash())) {
+        return cached;
+    }
+    std::shared_ptr<CBlock> block = std::make_shared<CBlock>();
+    if (g_block_prefetcher.Take(pindex, *block)) {
+        return block;
+    }
+    if (!ReadIndexedBlockFromDisk(*block, pindex, consensusParams, 0)) {
+        return nullptr;
+    }
+    g_block_cache.Insert(pindex->GetBlockHash(), block);
+    return block;
+}
+
+template <typename Stream>
+static bool ReadTransactionFromStream(Stream& filein, int nIndex, CBlockHeader& blockHeader, int& nTxns, CTransactionRef& txOut)
+{
+    filein >> blockHeader;
+    nTxns = ReadCompactSize(filein);
+    if (nTxns <= nIndex || nIndex < 0) {
+        return false;
+    }
+    for (int k = 0; k <= nIndex; ++k) {
+        filein >> txOut;
+    }
+    return true;
+}
+
 bool ReadTransactionFromDiskBlock(const CBlockIndex* pindex, int nIndex, CTransactionRef &txOut)
 {
     FlatFilePos hpos;
@@ -1353,22 +1589,25 @@ bool ReadTransactionFromDiskBlock(const CBlockIndex* pindex, int nIndex, CTransa
         hpos = pindex->GetBlockPos();
     }
 
-    // Open history file to read
-    CAutoFile filein(OpenBlockFile(hpos, true), SER_DISK, CLIENT_VERSION);
-    if (filein.IsNull())
-        return error("%s: OpenBlockFile failed for %s", __func__, hpos.ToString());
-
     CBlockHeader blockHeader;
-    try {
-        filein >> blockHeader;
-
-        int nTxns = ReadCompactSize(filein);
+    int nTxns = 0;
 
-        if (nTxns <= nIndex || nIndex < 0)
+    std::shared_ptr<const MappedFlatFile> mapped;
+    Span<const unsigned char> data = g_mmap_blocks ? MapBlockData(hpos, mapped) : Span<const unsigned char>();
+    try {
+        bool found;
+        if (!data.empty()) {
+            SpanReader filein(SER_DISK, CLIENT_VERSION, data);
+            found = ReadTransactionFromStream(filein, nIndex, blockHeader, nTxns, txOut);
+        } else {
+            // Open history file to read
+            CAutoFile filein(OpenBlockFile(hpos, true), SER_DISK, CLIENT_VERSION);
+            if (filein.IsNull())
+                return error("%s: OpenBlockFile failed for %s", __func__, hpos.ToString());
+            found = ReadTransactionFromStream(filein, nIndex, blockHeader, nTxns, txOut);
+        }
+        if (!found)
             return error("%s: Block %s, txn %d not in available range %d.", __func__, pindex->GetBlockPos().ToString(), nIndex, nTxns);
-
-        for (int k = 0; k <= nIndex; ++k)
-            filein >> txOut;
     } catch (const std::exception& e)
     {
         return error("%s: Deserialize or I/O error - %s at %s", __func__, e.what(), hpos.ToString());
@@ -1797,6 +2036,21 @@ void UpdateCoins(const CTransaction& tx, CCoinsViewCache& inputs, int nHeight)
 }
 
 bool CScriptCheck::operator()() {
+    if (CMLSAGCheck *anon_check = boost::get<CMLSAGCheck>(&m_deferred)) {
+        const int64_t nTimeStart = GetTimeMicros();
+        const bool rv = (*anon_check)();
+        g_validation_stats.AddAsync(ValidationStage::ANON_CHECKS, GetTimeMicros() - nTimeStart);
+        return rv;
+    }
+    if (CRangeProofCheck *rangeproof_check = boost::get<CRangeProofCheck>(&m_deferred)) {
+        const int64_t nTimeStart = GetTimeMicros();
+        const bool rv = (*rangeproof_check)();
+        g_validation_stats.AddAsync(ValidationStage::RANGEPROOF_CHECKS, GetTimeMicros() - nTimeStart);
+        return rv;
+    }
+    if (CTxCheckBatch *tx_check = boost::get<CTxCheckBatch>(&m_deferred)) {
+        return (*tx_check)();
+    }
     const CScript &scriptSig = ptxTo->vin[nIn].scriptSig;
     const CScriptWitness *witness = &ptxTo->vin[nIn].scriptWitness;
 
@@ -1841,8 +2095,8 @@ void InitScriptExecutionCache() {
  * This involves ECDSA signature checks so can be computationally intensive. This function should
  * only be called after the cheap sanity checks in CheckTxInputs passed.
  *
- * If pvChecks is not nullptr, script checks are pushed onto it instead of being performed inline. Any
- * script checks which are not necessary (eg due to script execution cache hits) are, obviously,
+ * If pvChecks is not nullptr, script checks, and the ring signature checks of anon inputs, are pushed
+ * onto it instead of being performed inline. Any script checks which are not necessary (eg due to script execution cache hits) are, obviously,
  * not pushed onto pvChecks/run.
  *
  * Setting cacheSigStore/cacheFullScriptStore to false will remove elements from the corresponding cache
@@ -1957,9 +2211,14 @@ bool CheckInputScripts(const CTransaction& tx, TxValidationState &state, const C
     //    if (pindexPrev)
     //        nTime = pindexPrev->GetBlockHeader().nTime;
 
-    if (!ignoreTx(tx) && m_has_anon_input && fAnonChecks
-        && !VerifyMLSAG(tx, state)) {
-        return false;
+    if (!ignoreTx(tx) && m_has_anon_input && fAnonChecks) {
+        std::vector<CMLSAGCheck> vAnonChecks;
+        if (!VerifyMLSAG(tx, state, pvChecks ? &vAnonChecks : nullptr)) {
+            return false;
+        }
+        for (auto &anon_check : vAnonChecks) {
+            pvChecks->emplace_back(anon_check);
+        }
     }
 
     if (cacheFullScriptStore && !pvChecks) {
@@ -2094,6 +2353,9 @@ DisconnectResult CChainState::DisconnectBlock(const CBlock& block, const CBlockI
     assert(pindex->GetBlockHash() == view.GetBestBlock());
 
     bool fClean = true;
+    // With -insightindexasync g_insight_index undoes the address and spent indexes in Rewind
+    const bool fAddressIndexInline = fAddressIndex && !fInsightIndexAsync;
+    const bool fSpentIndexInline = fSpentIndex && !fInsightIndexAsync;
 
     CBlockUndo blockUndo;
     ColdRewardUndo rewardUndo;
@@ -2104,6 +2366,11 @@ DisconnectResult CChainState::DisconnectBlock(const CBlock& block, const CBlockI
         return DISCONNECT_FAILED;
     }
 
+    // The undo data is read from the db
+    if (!FlushRewardTrackerRebuild()) {
+        error("DisconnectBlock(): failure writing coldreward data");
+        return DISCONNECT_FAILED;
+    }
     if (pindex->nHeight >= consensus.automatedGvrActivationHeight && !pblocktree->ReadRewardTrackerUndo(rewardUndo, pindex->nHeight)) {
         error("DisconnectBlock(): failure reading coldreward undo data");
         return DISCONNECT_FAILED;
@@ -2238,7 +2505,7 @@ DisconnectResult CChainState::DisconnectBlock(const CBlock& block, const CBlockI
                 }
             }
 
-            if (!fAddressIndex ||
+            if (!fAddressIndexInline ||
                 (!out->IsType(OUTPUT_STANDARD) &&
                  !out->IsType(OUTPUT_CT))) {
                 continue;
@@ -2295,11 +2562,11 @@ DisconnectResult CChainState::DisconnectBlock(const CBlock& block, const CBlockI
 
                     const CTxIn input = tx.vin[j];
 
-                    if (fSpentIndex) { // undo and delete the spent index
+                    if (fSpentIndexInline) { // undo and delete the spent index
                         view.spentIndex.push_back(std::make_pair(CSpentIndexKey(input.prevout.hash, input.prevout.n), CSpentIndexValue()));
                     }
 
-                    if (fAddressIndex) {
+                    if (fAddressIndexInline) {
                         const Coin &coin = view.AccessCoin(tx.vin[j].prevout);
                         const CScript *pScript = &coin.out.scriptPubKey;
 
@@ -2377,7 +2644,11 @@ DisconnectResult CChainState::DisconnectBlock(const CBlock& block, const CBlockI
         }
     }
 
-    if (!fVerifyingDB) {
+    if (!fVerifyingDB && rewardTrackerRebuildBatch) {
+        if (pindex->nHeight >= consensus.automatedGvrActivationHeight) {
+            pblocktree->WriteLastTrackedHeight(RewardTrackerBatch(), pindex->pprev->nHeight);
+        }
+    } else if (!fVerifyingDB) {
         if (pindex->nHeight >= consensus.automatedGvrActivationHeight && 
             !pblocktree->WriteLastTrackedHeight(pindex->pprev->nHeight)) {
             return DISCONNECT_FAILED;
@@ -2463,6 +2734,91 @@ void ThreadScriptCheck(int worker_num) {
     scriptcheckqueue.Thread();
 }
 
+void PreValidateTransaction(CTxMemPool& pool, const CTransactionRef& ptx)
+{
+    PreValidateTransactions(pool, {ptx});
+}
+
+void PreValidateTransactions(CTxMemPool& pool, const std::vector<CTransactionRef>& txns)
+{
+    if (!g_parallel_script_checks) {
+        return;
+    }
+
+    std::vector<CScriptCheck> vChecks;
+    std::vector<CRangeProofCheck> vRangeProofChecks;
+    std::vector<PrecomputedTransactionData> txdatas(txns.size());
+    {
+        LOCK2(cs_main, pool.cs);
+        // Snapshot the spent outputs and ring members, leaving the coins cache as it was
+        CCoinsViewCache& coins_cache = ::ChainstateActive().CoinsTip();
+        CCoinsView dummy;
+        CCoinsViewCache view(&dummy);
+        CCoinsViewMemPool viewmempool(&coins_cache, pool);
+        std::vector<COutPoint> coins_to_uncache;
+        const int64_t now = GetTime();
+        const int chain_height = ::ChainActive().Height();
+
+        for (size_t i = 0; i < txns.size(); ++i) {
+            const CTransaction& tx = *txns[i];
+            if (tx.IsCoinBase() || tx.IsCoinStake() || pool.exists(tx.GetHash())) {
+                continue;
+            }
+            TxValidationState state;
+            state.SetStateInfo(now, chain_height, Params().GetConsensus(), fParticlMode, (fBusyImporting && fSkipRangeproof));
+            state.m_cache_store = true;
+            // Rangeproofs of a transaction failing CheckTransaction are dropped with it
+            std::vector<CRangeProofCheck> tx_rangeproof_checks;
+            state.m_rangeproof_checks = &tx_rangeproof_checks;
+            if (!CheckTransaction(tx, state)) {
+                continue;
+            }
+            for (auto &check : tx_rangeproof_checks) {
+                vRangeProofChecks.emplace_back();
+                vRangeProofChecks.back().swap(check);
+            }
+
+            bool have_inputs = true;
+            view.SetBackend(viewmempool);
+            for (const CTxIn& txin : tx.vin) {
+                if (txin.IsAnonInput()) {
+                    continue;
+                }
+                if (!coins_cache.HaveCoinInCache(txin.prevout)) {
+                    coins_to_uncache.push_back(txin.prevout);
+                }
+                if (!view.HaveCoin(txin.prevout)) {
+                    have_inputs = false;
+                    break;
+                }
+            }
+            view.SetBackend(dummy);
+            std::vector<CScriptCheck> tx_checks;
+            if (have_inputs &&
+                CheckInputScripts(tx, state, view, STANDARD_SCRIPT_VERIFY_FLAGS, true, true, txdatas[i], &tx_checks)) {
+                for (auto &check : tx_checks) {
+                    vChecks.emplace_back();
+                    vChecks.back().swap(check);
+                }
+            }
+        }
+        for (const COutPoint& outpoint : coins_to_uncache) {
+            coins_cache.Uncache(outpoint);
+        }
+    }
+
+    for (auto &check : vRangeProofChecks) {
+        vChecks.emplace_back(check);
+    }
+    if (vChecks.empty()) {
+        return;
+    }
+    // Failures are left to AcceptToMemoryPool to find and report
+    CCheckQueueControl<CScriptCheck> control(&scriptcheckqueue);
+    control.Add(vChecks);
+    control.Wait();
+}
+
 VersionBitsCache versionbitscache GUARDED_BY(cs_main);
 
 int32_t ComputeBlockVersion(const CBlockIndex* pindexPrev, const Consensus::Params& params)
@@ -2593,6 +2949,24 @@ static int64_t nTimeCallbacks = 0;
 static int64_t nTimeTotal = 0;
 static int64_t nBlocksTotal = 0;
 
+/** Private blocks carry CT or RingCT outputs or spend anon inputs */
+static ValidationBlockKind GetValidationBlockKind(const CBlock& block)
+{
+    for (const auto& tx : block.vtx) {
+        for (const auto& txout : tx->vpout) {
+            if (txout->IsType(OUTPUT_CT) || txout->IsType(OUTPUT_RINGCT)) {
+                return ValidationBlockKind::PRIVATE;
+            }
+        }
+        for (const auto& txin : tx->vin) {
+            if (txin.IsAnonInput()) {
+                return ValidationBlockKind::PRIVATE;
+            }
+        }
+    }
+    return ValidationBlockKind::PLAIN;
+}
+
 /** Apply the effects of this block (with given index) on the UTXO set represented by coins.
  *  Validity checks that depend on the UTXO set are also done; ConnectBlock()
  *  can fail if those validity checks fail (among other reasons). */
@@ -2603,8 +2977,12 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     assert(pindex);
     assert(*pindex->phashBlock == block.GetHash());
     int64_t nTimeStart = GetTimeMicros();
+    g_validation_stats.StartBlock();
 
     const Consensus::Params &consensus = Params().GetConsensus();
+    // With -insightindexasync g_insight_index builds the address and spent indexes from the block and undo data
+    const bool fAddressIndexInline = fAddressIndex && !fInsightIndexAsync;
+    const bool fSpentIndexInline = fSpentIndex && !fInsightIndexAsync;
     state.SetStateInfo(block.nTime, pindex->nHeight, consensus, fParticlMode, (fBusyImporting && fSkipRangeproof), true);
 
     // Check it again in case a previous version let a bad block in
@@ -2638,6 +3016,9 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
         if (!CheckProofOfStake(state, pindex->pprev, *block.vtx[0], block.nTime, block.nBits, hashProof, targetProofOfStake)) {
             return error("%s: Check proof of stake failed.", __func__);
         }
+        if (!fJustCheck) {
+            AddConnectedKernel(block.vtx[0]->vin[0].prevout, pindex);
+        }
     }
 
     // verify that the view's current state corresponds to the previous block
@@ -2691,6 +3072,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
 
 
     int64_t nTime1 = GetTimeMicros(); nTimeCheck += nTime1 - nTimeStart;
+    g_validation_stats.Add(ValidationStage::SANITY_CHECKS, nTime1 - nTimeStart);
     LogPrint(BCLog::BENCH, "    - Sanity checks: %.2fms [%.2fs (%.2fms/blk)]\n", MILLI * (nTime1 - nTimeStart), nTimeCheck * MICRO, nTimeCheck * MILLI / nBlocksTotal);
 
     // Do not allow blocks that contain transactions which 'overwrite' older transactions,
@@ -2760,6 +3142,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     unsigned int flags = GetBlockScriptFlags(pindex, chainparams.GetConsensus());
 
     int64_t nTime2 = GetTimeMicros(); nTimeForks += nTime2 - nTime1;
+    g_validation_stats.Add(ValidationStage::FORK_CHECKS, nTime2 - nTime1);
     LogPrint(BCLog::BENCH, "    - Fork checks: %.2fms [%.2fs (%.2fms/blk)]\n", MILLI * (nTime2 - nTime1), nTimeForks * MICRO, nTimeForks * MILLI / nBlocksTotal);
 
     smsgModule.StartConnectingBlock();
@@ -2865,7 +3248,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
                         // Cache recently spent coins for staking.
                         view.spent_cache.emplace_back(input.prevout, SpentCoin(coin, pindex->nHeight));
                     }
-                    if (!fAddressIndex && !fSpentIndex) {
+                    if (!fAddressIndexInline && !fSpentIndexInline) {
                         continue;
                     }
 
@@ -2882,13 +3265,13 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
                     if (scriptType > 0) {
                         hashAddress = uint256(hashBytes.data(), hashBytes.size());
                     }
-                    if (fAddressIndex && scriptType > 0) {
+                    if (fAddressIndexInline && scriptType > 0) {
                         // record spending activity
                         view.addressIndex.push_back(std::make_pair(CAddressIndexKey(scriptType, hashAddress, pindex->nHeight, i, txhash, j, true), nValue * -1));
                         // remove address from unspent index
                         view.addressUnspentIndex.push_back(std::make_pair(CAddressUnspentKey(scriptType, hashAddress, input.prevout.hash, input.prevout.n), CAddressUnspentValue()));
                     }
-                    if (fSpentIndex) {
+                    if (fSpentIndexInline) {
                         CAmount nValue = coin.nType == OUTPUT_CT ? -1 : coin.out.nValue;
                         // add the spent index to determine the txid and input that spent an output
                         // and to find the amount and address from an input
@@ -2897,7 +3280,9 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
                 }
 
                 if (tx_state.m_funds_smsg) {
+                    const int64_t nTimeSmsg = GetTimeMicros();
                     smsgModule.StoreFundingTx(tx, pindex);
+                    g_validation_stats.Add(ValidationStage::SMSG_FUNDING, GetTimeMicros() - nTimeSmsg);
                 }
             }
         } else {
@@ -2998,7 +3383,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
             }
         }
 
-        if (fAddressIndex) {
+        if (fAddressIndexInline) {
             // Update outputs for insight
             for (unsigned int k = 0; k < tx.vpout.size(); k++) {
                 const CTxOutBase *out = tx.vpout[k].get();
@@ -3031,6 +3416,8 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     }
 
     int64_t nTime3 = GetTimeMicros(); nTimeConnect += nTime3 - nTime2;
+    g_validation_stats.Add(ValidationStage::CONNECT_TRANSACTIONS, nTime3 - nTime2, block.vtx.size());
+    g_validation_stats.SetBlockKind(GetValidationBlockKind(block));
     LogPrint(BCLog::BENCH, "      - Connect %u transactions: %.2fms (%.3fms/tx, %.3fms/txin) [%.2fs (%.2fms/blk)]\n", (unsigned)block.vtx.size(), MILLI * (nTime3 - nTime2), MILLI * (nTime3 - nTime2) / block.vtx.size(), nInputs <= 1 ? 0 : MILLI * (nTime3 - nTime2) / (nInputs-1), nTimeConnect * MICRO, nTimeConnect * MILLI / nBlocksTotal);
 
 
@@ -3038,6 +3425,8 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
         LogPrintf("ERROR: %s: CheckQueue failed\n", __func__);
         return state.Invalid(BlockValidationResult::BLOCK_CONSENSUS, "block-validation-failed");
     }
+    int64_t nTimeTreasury = GetTimeMicros(), nTimeGvr = 0;
+    g_validation_stats.Add(ValidationStage::VERIFY_WAIT, nTimeTreasury - nTime3);
 
     if (fParticlMode) {
         if (block.nTime >= consensus.clamp_tx_version_time) {
@@ -3268,6 +3657,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
                 }
             }
 
+            nTimeGvr = GetTimeMicros();
             if (pindex->nHeight >= consensus.automatedGvrActivationHeight && pindex->nHeight > consensus.agvrStartPayingHeight) {
                 if (pindex->pprev->nHeight > 0) { // Genesis block is pow
                     if (!txPrevCoinstake
@@ -3383,10 +3773,17 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
         }
     }
 
+    int64_t nTimeColdReward = GetTimeMicros();
+    if (nTimeGvr) {
+        g_validation_stats.Add(ValidationStage::TREASURY, nTimeGvr - nTimeTreasury);
+        g_validation_stats.Add(ValidationStage::GVR_ELIGIBILITY, nTimeColdReward - nTimeGvr);
+    }
+
     std::int64_t readHeight;
 
     if (pindex->nHeight >= 1 && pindex->nHeight >= consensus.automatedGvrActivationHeight && !pblocktree->ReadLastTrackedHeight(readHeight)) {
-        if (pindex->nHeight == 1 || pindex->nHeight == consensus.automatedGvrActivationHeight) {
+        if (pindex->nHeight == 1 || pindex->nHeight == consensus.automatedGvrActivationHeight || rewardTrackerRebuildBatch) {
+            // Nothing tracked yet, or the last tracked height is still in rewardTrackerRebuildBatch
             readHeight = 0;
         } else {
             LogPrintf("%s Impossible to read last tracked height attempted height %s\n", __func__, pindex->nHeight);
@@ -3452,7 +3849,9 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
             }
         }
 
-        if (!fVerifyingDB) {
+        if (!fVerifyingDB && rewardTrackerRebuildBatch) {
+            pblocktree->WriteLastTrackedHeight(RewardTrackerBatch(), pindex->nHeight);
+        } else if (!fVerifyingDB) {
             if (!pblocktree->WriteLastTrackedHeight(pindex->nHeight)) {
                 LogPrintf("%s Impossible to write last tracked height attempted height %d\n", __func__, pindex->nHeight);
                 return false;
@@ -3467,7 +3866,17 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     
 
     int64_t nTime4 = GetTimeMicros(); nTimeVerify += nTime4 - nTime2;
+    if (pindex->nHeight >= consensus.automatedGvrActivationHeight) {
+        g_validation_stats.Add(ValidationStage::COLD_REWARD, nTime4 - nTimeColdReward);
+    }
     LogPrint(BCLog::BENCH, "    - Verify %u txins: %.2fms (%.3fms/txin) [%.2fs (%.2fms/blk)]\n", nInputs - 1, MILLI * (nTime4 - nTime2), nInputs <= 1 ? 0 : MILLI * (nTime4 - nTime2) / (nInputs-1), nTimeVerify * MICRO, nTimeVerify * MILLI / nBlocksTotal);
+    if (LogAcceptCategory(BCLog::BENCH)) {
+        uint64_t proof_cache_hits, proof_cache_misses;
+        GetProofCacheStats(proof_cache_hits, proof_cache_misses);
+        const uint64_t proof_cache_lookups = proof_cache_hits + proof_cache_misses;
+        LogPrintf("    - Proof cache: %u hits, %u misses [%.1f%% hit rate]\n", proof_cache_hits, proof_cache_misses,
+            proof_cache_lookups ? 100.0 * proof_cache_hits / proof_cache_lookups : 0.0);
+    }
 
     if (fJustCheck)
         return true;
@@ -3488,8 +3897,9 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
      && !WriteUndoDataForBlock(blockundo, state, pindex, chainparams))
         return false;
 
-    if (pindex->nHeight >= consensus.automatedGvrActivationHeight && !pblocktree->WriteRewardTrackerUndo(rewardUndo)) {
-        return false;
+    if (pindex->nHeight >= consensus.automatedGvrActivationHeight) {
+        // Committed with the tracked balances and ranges of this block
+        pblocktree->WriteRewardTrackerUndo(RewardTrackerBatch(), rewardUndo);
     }
 
     if (!pindex->IsValid(BLOCK_VALID_SCRIPTS)) {
@@ -3498,7 +3908,8 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     }
 
 
-    if (fTimestampIndex) {
+    const int64_t nTimeInsight = GetTimeMicros();
+    if (fTimestampIndex && !fInsightIndexAsync) {
         unsigned int logicalTS = pindex->nTime;
         if (!pblocktree->WriteTimestampIndex(CTimestampIndexKey(logicalTS, pindex->GetBlockHash()))) {
             return AbortNode(state, "Failed to write timestamp index");
@@ -3523,6 +3934,39 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
             return AbortNode(state, "Failed to write balances index");
         }
     }
+    if (fVoteIndex && block.IsProofOfStake()) {
+        uint32_t vote_token = 0;
+        const std::vector<uint8_t> &vData = ((CTxOutData*)block.vtx[0]->vpout[0].get())->vData;
+        if (vData.size() > 8 && vData[4] == DO_VOTE) {
+            memcpy(&vote_token, &vData[5], 4);
+            vote_token = le32toh(vote_token);
+        }
+        if (!pblocktree->WriteBlockVoteIndex(block.GetHash(), vote_token)) {
+            return AbortNode(state, "Failed to write vote index");
+        }
+    }
+    if (fRewardIndex && block.IsProofOfStake()) {
+        // The coins spent by the coinstake are in its undo data, no lookups needed
+        const CTransaction &coinstake = *block.vtx[0];
+        const std::vector<Coin> &spent = blockundo.vtxundo[0].vprevout;
+        CAmount value_in = 0;
+        for (const auto &coin : spent) {
+            value_in += coin.nType == OUTPUT_CT ? 0 : coin.out.nValue;
+        }
+        const bool have_kernel = !spent.empty() && !coinstake.vin[0].IsAnonInput();
+        BlockRewardSummary summary;
+        BuildBlockRewardSummary(coinstake, pindex, value_in,
+            have_kernel ? spent[0].out.nValue : 0, have_kernel ? spent[0].out.scriptPubKey : CScript(), summary);
+        summary.fees = nFees;
+        summary.flags |= BlockRewardSummary::HAVE_FEES;
+        if (!pblocktree->WriteBlockRewardIndex(block.GetHash(), summary)) {
+            return AbortNode(state, "Failed to write reward index");
+        }
+    }
+
+    if ((fTimestampIndex && !fInsightIndexAsync) || fBalancesIndex || fVoteIndex || fRewardIndex) {
+        g_validation_stats.Add(ValidationStage::INSIGHT_INDEX, GetTimeMicros() - nTimeInsight);
+    }
 
     assert(pindex->phashBlock);
 
@@ -3532,6 +3976,7 @@ bool CChainState::ConnectBlock(const CBlock& block, BlockValidationState& state,
     view.SetBestBlock(pindex->GetBlockHash(), pindex->nHeight);
 
     int64_t nTime5 = GetTimeMicros(); nTimeIndex += nTime5 - nTime4;
+    g_validation_stats.Add(ValidationStage::INDEX_WRITING, nTime5 - nTime4);
     LogPrint(BCLog::BENCH, "    - Index writing: %.2fms [%.2fs (%.2fms/blk)]\n", MILLI * (nTime5 - nTime4), nTimeIndex * MICRO, nTimeIndex * MILLI / nBlocksTotal);
 
     int64_t nTime6 = GetTimeMicros(); nTimeCallbacks += nTime6 - nTime5;
@@ -3572,6 +4017,45 @@ CoinsCacheSizeState CChainState::GetCoinsCacheSizeState(
     return CoinsCacheSizeState::OK;
 }
 
+/** Write block and undo data, then the block file information and block index referring to them. */
+static bool WriteBlockIndex(BlockValidationState &state) EXCLUSIVE_LOCKS_REQUIRED(cs_main, cs_LastBlockFile)
+{
+    // Depend on nMinDiskSpace to ensure we can write block index
+    if (!CheckDiskSpace(GetBlocksDir())) {
+        return AbortNode(state, "Disk space is too low!", _("Disk space is too low!"));
+    }
+    {
+        LOG_TIME_MILLIS_WITH_CATEGORY("write block and undo data to disk", BCLog::BENCH);
+
+        // First make sure all block and undo data is flushed to disk.
+        FlushBlockFile();
+    }
+
+    // Then update all block file information (which may refer to block and undo files).
+    {
+        LOG_TIME_MILLIS_WITH_CATEGORY("write block index to disk", BCLog::BENCH);
+
+        std::vector<std::pair<int, const CBlockFileInfo*> > vFiles;
+        vFiles.reserve(setDirtyFileInfo.size());
+        for (std::set<int>::iterator it = setDirtyFileInfo.begin(); it != setDirtyFileInfo.end(); ) {
+            vFiles.push_back(std::make_pair(*it, &vinfoBlockFile[*it]));
+            setDirtyFileInfo.erase(it++);
+        }
+        std::vector<const CBlockIndex*> vBlocks;
+        vBlocks.reserve(setDirtyBlockIndex.size());
+        for (std::set<CBlockIndex*>::iterator it = setDirtyBlockIndex.begin(); it != setDirtyBlockIndex.end(); ) {
+            if ((*it)->nFlags & BLOCK_ACCEPTED) {
+                vBlocks.push_back(*it);
+            }
+            setDirtyBlockIndex.erase(it++);
+        }
+        if (!pblocktree->WriteBatchSync(vFiles, nLastBlockFile, vBlocks)) {
+            return AbortNode(state, "Failed to write to block index database");
+        }
+    }
+    return true;
+}
+
 bool CChainState::FlushStateToDisk(
     const CChainParams& chainparams,
     BlockValidationState &state,
@@ -3631,40 +4115,18 @@ bool CChainState::FlushStateToDisk(
         bool fPeriodicFlush = mode == FlushStateMode::PERIODIC && nNow > nLastFlush + DATABASE_FLUSH_INTERVAL;
         // Combine all conditions that result in a full cache flush.
         fDoFullFlush = (mode == FlushStateMode::ALWAYS) || fCacheLarge || fCacheCritical || fPeriodicFlush || fFlushForPrune;
+        // The tracked data kept while rebuilding must not fall behind the chainstate
+        if (rewardTrackerRebuildBatch && (fDoFullFlush ||
+            rewardTrackerRebuildBatch->SizeEstimate() > REWARD_TRACKER_REBUILD_BATCH_SIZE ||
+            rewardTracker.cacheSize() > REWARD_TRACKER_REBUILD_CACHE_SIZE)) {
+            if (!FlushRewardTrackerRebuild()) {
+                return AbortNode(state, "Failed to write reward tracker data");
+            }
+        }
         // Write blocks and block index to disk.
         if (fDoFullFlush || fPeriodicWrite) {
-            // Depend on nMinDiskSpace to ensure we can write block index
-            if (!CheckDiskSpace(GetBlocksDir())) {
-                return AbortNode(state, "Disk space is too low!", _("Disk space is too low!"));
-            }
-            {
-                LOG_TIME_MILLIS_WITH_CATEGORY("write block and undo data to disk", BCLog::BENCH);
-
-                // First make sure all block and undo data is flushed to disk.
-                FlushBlockFile();
-            }
-
-            // Then update all block file information (which may refer to block and undo files).
-            {
-                LOG_TIME_MILLIS_WITH_CATEGORY("write block index to disk", BCLog::BENCH);
-
-                std::vector<std::pair<int, const CBlockFileInfo*> > vFiles;
-                vFiles.reserve(setDirtyFileInfo.size());
-                for (std::set<int>::iterator it = setDirtyFileInfo.begin(); it != setDirtyFileInfo.end(); ) {
-                    vFiles.push_back(std::make_pair(*it, &vinfoBlockFile[*it]));
-                    setDirtyFileInfo.erase(it++);
-                }
-                std::vector<const CBlockIndex*> vBlocks;
-                vBlocks.reserve(setDirtyBlockIndex.size());
-                for (std::set<CBlockIndex*>::iterator it = setDirtyBlockIndex.begin(); it != setDirtyBlockIndex.end(); ) {
-                    if ((*it)->nFlags & BLOCK_ACCEPTED) {
-                        vBlocks.push_back(*it);
-                    }
-                    setDirtyBlockIndex.erase(it++);
-                }
-                if (!pblocktree->WriteBatchSync(vFiles, nLastBlockFile, vBlocks)) {
-                    return AbortNode(state, "Failed to write to block index database");
-                }
+            if (!WriteBlockIndex(state)) {
+                return false;
             }
             // Finally remove any pruned files
             if (fFlushForPrune) {
@@ -3704,6 +4166,47 @@ bool CChainState::FlushStateToDisk(
     return true;
 }
 
+bool CChainState::WriteBackCoins(int min_usage_percent)
+{
+    CCoinsMap batch;
+    uint256 hash_block;
+    CCoinsViewDB* db;
+    {
+        LOCK(cs_main);
+        CCoinsViewCache& tip = CoinsTip();
+        if (tip.GetBestBlock().IsNull() ||
+            tip.DynamicMemoryUsage() * 100 < m_coinstip_cache_size_bytes * (size_t)min_usage_percent ||
+            tip.TakeOldestDirty(batch, COINS_WRITEBACK_BATCH, COINS_WRITEBACK_MIN_AGE) == 0) {
+            return false;
+        }
+        db = &CoinsDB();
+        db->BeginWriteback();
+        // A replay after a crash needs the blocks up to the tip
+        LOCK(cs_LastBlockFile);
+        BlockValidationState state;
+        if (!WriteBlockIndex(state)) {
+            db->EndWriteback(false);
+            return false;
+        }
+        hash_block = tip.GetBestBlock();
+    }
+
+    bool ok = false;
+    try {
+        ok = db->BatchWritePartial(batch, hash_block);
+    } catch (const std::runtime_error& e) {
+        LogPrintf("%s: %s\n", __func__, e.what());
+    }
+    db->EndWriteback(ok);
+    if (!ok) {
+        return AbortNode("Failed to write back to coin database");
+    }
+
+    LOCK(cs_main);
+    CoinsTip().FinishWriteback(batch);
+    return true;
+}
+
 void CChainState::ForceFlushStateToDisk() {
     BlockValidationState state;
     const CChainParams& chainparams = Params();
@@ -3732,52 +4235,16 @@ static void DoWarning(const bilingual_str& warning)
     }
 }
 
-static void ClearSpentCache(CDBBatch &batch, int height)
-{
-    CBlockIndex* pblockindex = ::ChainActive()[height];
-    if (!pblockindex) {
-        return;
-    }
-    CBlock block;
-    if (!ReadBlockFromDisk(block, pblockindex, Params().GetConsensus())) {
-        LogPrintf("%s: failed read block from disk (%d, %s)\n", __func__, height, pblockindex->GetBlockHash().ToString());
-        return;
-    }
-    for (int i = block.vtx.size() - 1; i >= 0; i--) {
-        const CTransaction &tx = *(block.vtx[i]);
-        for (const auto &txin : tx.vin) {
-            if (!txin.IsAnonInput()) {
-                batch.Erase(std::make_pair(DB_SPENTCACHE, txin.prevout));
-            }
-        }
-    }
-}
-
 void balanceSetter(const AddressType& addr, const CAmount& amount) {
-    CDBBatch batch(*pblocktree);
-    batch.Write(std::make_pair(DB_GVR_BALANCE, addr), amount);
-
-    if (!pblocktree->WriteBatch(batch)) {
-        LogPrintf("%s: Write index data failed.", __func__);
-    }
+    RewardTrackerBatch().Write(std::make_pair(DB_GVR_BALANCE, addr), amount);
 }
 
 void rangesSetter(const AddressType& addr, const std::vector<BlockHeightRange>& vranges) {
-    CDBBatch batch(*pblocktree);
-    batch.Write(std::make_pair(DB_GVR_RANGE, addr), vranges);
-
-    if (!pblocktree->WriteBatch(batch)) {
-        LogPrintf("%s: Write index data failed.", __func__);
-    }
+    RewardTrackerBatch().Write(std::make_pair(DB_GVR_RANGE, addr), vranges);
 }
 
 void checkpointSetter(int newCheckpoint) {
-    CDBBatch batch(*pblocktree);
-    batch.Write(std::make_pair(DB_GVR_CHECKPOINT, 0), newCheckpoint);
-
-    if (!pblocktree->WriteBatch(batch)) {
-        LogPrintf("%s: Write index data failed.", __func__);
-    }
+    RewardTrackerBatch().Write(std::make_pair(DB_GVR_CHECKPOINT, 0), newCheckpoint);
 }
 
 std::map<AddressType, std::vector<BlockHeightRange>> allRangesGetter() {
@@ -3805,33 +4272,31 @@ std::map<AddressType, std::vector<BlockHeightRange>> allRangesGetter() {
 }
 
 void clearTrackedData() {
-    auto allRanges = allRangesGetter();
+    bool erased = pblocktree->EraseRewardTrackerData();
+    assert(erased && "Tracked data not reset during -reindex-chainstate or -reindex");
+    rewardTracker.resetEligibleAddresses();
+    rewardTrackerBatch.reset();
+}
 
-    for (auto& range: allRanges) {
-        pblocktree->Erase(std::make_pair(DB_GVR_RANGE, range.first));
-        pblocktree->Erase(std::make_pair(DB_GVR_BALANCE, range.first));
+void StartRewardTrackerRebuild() {
+    LOCK(cs_main);
+    if (rewardTrackerRebuildBatch) {
+        return;
     }
+    initColdReward().setKeepCache(true);
+    rewardTrackerRebuildBatch = MakeUnique<CDBBatch>(*pblocktree);
+}
 
-    allRanges = allRangesGetter();
-    assert(allRanges.size() == 0 && "Tracked data not reset during -reindex-chainstate or -reindex");
-
-    ColdRewardUndo undoData;
-    pblocktree->ReadRewardTrackerUndo(undoData, 1);
-
-    for(auto& inputs: undoData.inputs) {
-        pblocktree->Erase(std::make_pair(DB_TRACKER_INPUTS_UNDO, inputs.first));
+void FinishRewardTrackerRebuild() {
+    LOCK(cs_main);
+    if (!rewardTrackerRebuildBatch) {
+        return;
     }
-
-    for(auto& outputs: undoData.outputs) {
-        pblocktree->Erase(std::make_pair(DB_TRACKER_OUTPUTS_UNDO, outputs.first));
+    rewardTracker.setKeepCache(false);
+    if (!pblocktree->WriteBatch(*rewardTrackerRebuildBatch)) {
+        LogPrintf("%s: Write reward tracker data failed.\n", __func__);
     }
-
-    undoData.inputs.clear();
-    undoData.outputs.clear();
-
-    pblocktree->ReadRewardTrackerUndo(undoData, 1);
-    assert(undoData.inputs.size() == 0 && "Undo inputs tracked data not reset during -reindex-chainstate or -reindex");
-    assert(undoData.outputs.size() == 0 && "Undo outputs tracked data not reset during -reindex-chainstate or -reindex");
+    rewardTrackerRebuildBatch.reset();
 }
 
 CAmount balanceGetter(const AddressType& addr) {
@@ -3853,7 +4318,25 @@ int checkpointGetter() {
 }
 
 void transactionStarter() {}
-void transactionEnder() {}
+
+void transactionEnder() {
+    if (!rewardTrackerBatch) {
+        return;
+    }
+    if (rewardTrackerRebuildBatch) {
+        rewardTrackerRebuildBatch->Append(*rewardTrackerBatch);
+        rewardTrackerBatch.reset();
+        return;
+    }
+    if (!pblocktree->WriteBatch(*rewardTrackerBatch)) {
+        LogPrintf("%s: Write index data failed.", __func__);
+    }
+    rewardTrackerBatch.reset();
+}
+
+void transactionAborter() {
+    rewardTrackerBatch.reset();
+}
 
 ColdRewardTracker& initColdReward() {
 
@@ -3868,6 +4351,7 @@ ColdRewardTracker& initColdReward() {
     rewardTracker.setPersistedCheckpointSetter(checkpointSetter);
     rewardTracker.setPersistedTransactionStarter(transactionStarter);
     rewardTracker.setPersisterTransactionEnder(transactionEnder);
+    rewardTracker.setPersistedTransactionAborter(transactionAborter);
     rewardTracker.setAllRangesGetter(allRangesGetter);
     return rewardTracker;
 }
@@ -3877,7 +4361,8 @@ bool FlushView(CCoinsViewCache *view, BlockValidationState& state, bool fDisconn
     if (!view->Flush())
         return false;
 
-    if (fAddressIndex) {
+    const int64_t nTimeInsight = GetTimeMicros();
+    if (fAddressIndex && !fInsightIndexAsync) {
         if (fDisconnecting) {
             if (!pblocktree->EraseAddressIndex(view->addressIndex)) {
                 return AbortNode(state, "Failed to delete address index");
@@ -3892,55 +4377,52 @@ bool FlushView(CCoinsViewCache *view, BlockValidationState& state, bool fDisconn
         }
     }
 
-    if (fSpentIndex) {
+    if (fSpentIndex && !fInsightIndexAsync) {
         if (!pblocktree->UpdateSpentIndex(view->spentIndex)) {
             return AbortNode(state, "Failed to write transaction index");
         }
     }
 
+    if (!fDisconnecting && (fAddressIndex || fSpentIndex) && !fInsightIndexAsync) {
+        g_validation_stats.Add(ValidationStage::INSIGHT_INDEX, GetTimeMicros() - nTimeInsight);
+    }
+
     view->addressIndex.clear();
     view->addressUnspentIndex.clear();
     view->spentIndex.clear();
 
+    // Commit all rct index and spent cache changes for the view in one batch
+    CDBBatch batch(*pblocktree);
     if (fDisconnecting) {
         for (const auto &it : view->keyImages) {
-            if (!pblocktree->EraseRCTKeyImage(it.first)) {
-                return error("%s: EraseRCTKeyImage failed, txn %s.", __func__, it.second.ToString());
-            }
+            pblocktree->EraseRCTKeyImage(batch, it.first);
         }
+        std::vector<int64_t> vEraseRCTOutputs;
+        vEraseRCTOutputs.reserve(view->anonOutputLinks.size());
         for (const auto &it : view->anonOutputLinks) {
-            if (!pblocktree->EraseRCTOutput(it.second)) {
-                return error("%s: EraseRCTOutput failed.", __func__);
-            }
-            if (!pblocktree->EraseRCTOutputLink(it.first)) {
-                return error("%s: EraseRCTOutputLink failed.", __func__);
-            }
+            vEraseRCTOutputs.push_back(it.second);
+            batch.Erase(std::make_pair(DB_RCTOUTPUT_LINK, it.first));
         }
         for (const auto &it : view->spent_cache) {
-            if (!pblocktree->EraseSpentCache(it.first)) {
-                return error("%s: EraseSpentCache failed.", __func__);
-            }
+            pblocktree->EraseSpentCache(batch, it.first, it.second);
+        }
+        if (!pblocktree->WriteRCTOutputBatch(batch, {}, vEraseRCTOutputs)) {
+            return error("%s: Erase index data failed.", __func__);
         }
     } else {
-        CDBBatch batch(*pblocktree);
-
         for (const auto &it : view->keyImages) {
-            CAnonKeyImageInfo data(it.second, state.m_spend_height);
-            batch.Write(std::make_pair(DB_RCTKEYIMAGE, it.first), data);
-        }
-        for (const auto &it : view->anonOutputs) {
-            batch.Write(std::make_pair(DB_RCTOUTPUT, it.first), it.second);
+            pblocktree->WriteRCTKeyImage(batch, it.first, CAnonKeyImageInfo(it.second, state.m_spend_height));
         }
         for (const auto &it : view->anonOutputLinks) {
             batch.Write(std::make_pair(DB_RCTOUTPUT_LINK, it.first), it.second);
         }
         for (const auto &it : view->spent_cache) {
-            batch.Write(std::make_pair(DB_SPENTCACHE, it.first), it.second);
+            pblocktree->WriteSpentCache(batch, it.first, it.second);
         }
         if (state.m_spend_height > (int)MIN_BLOCKS_TO_KEEP) {
-            ClearSpentCache(batch, state.m_spend_height - (MIN_BLOCKS_TO_KEEP+1));
+            pblocktree->PruneSpentCache(batch, state.m_spend_height - (MIN_BLOCKS_TO_KEEP+1));
         }
-        if (!pblocktree->WriteBatch(batch)) {
+        if (!pblocktree->WriteRCTOutputBatch(batch, view->anonOutputs, {})) {
             return error("%s: Write index data failed.", __func__);
         }
     }
@@ -4035,6 +4517,11 @@ bool CChainState::DisconnectTip(BlockValidationState& state, const CChainParams&
 
     CBlockIndex *pindexDelete = m_chain.Tip();
     assert(pindexDelete);
+    // ReplayBlocks only rolls coins written back in the background forward,
+    // the database must be consistent again before the tip moves back.
+    if (CoinsDB().HasPartialWrites() && !FlushStateToDisk(chainparams, state, FlushStateMode::ALWAYS)) {
+        return false;
+    }
     // Read block from disk.
     std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
     CBlock& block = *pblock;
@@ -4047,8 +4534,10 @@ bool CChainState::DisconnectTip(BlockValidationState& state, const CChainParams&
         ColdRewardTracker& tracker = initColdReward();
 
         assert(view.GetBestBlock() == pindexDelete->GetBlockHash());
-        if (DisconnectBlock(block, pindexDelete, view) != DISCONNECT_OK)
+        if (DisconnectBlock(block, pindexDelete, view) != DISCONNECT_OK) {
+            tracker.revertPersistedTransaction();
             return error("DisconnectTip(): DisconnectBlock %s failed", pindexDelete->GetBlockHash().ToString());
+        }
         bool flushed = FlushView(&view, state, true);
 
         tracker.endPersistedTransaction();
@@ -4165,6 +4654,8 @@ bool CChainState::ConnectTip(BlockValidationState& state, const CChainParams& ch
             state.nFlags |= BLOCK_FAILED_DUPLICATE_STAKE;
         GetMainSignals().BlockChecked(blockConnecting, state);
         if (!rv) {
+            // Drop the tracked balances and undo data of the failed block
+            tracker.revertPersistedTransaction();
             if (state.IsInvalid())
                 InvalidBlockFound(pindexNew, blockConnecting, state);
             return error("%s: ConnectBlock %s failed, %s", __func__, pindexNew->GetBlockHash().ToString(), state.ToString());
@@ -4176,6 +4667,8 @@ bool CChainState::ConnectTip(BlockValidationState& state, const CChainParams& ch
 
         tracker.endPersistedTransaction();
         assert(flushed);
+        g_validation_stats.FinishBlock();
+        TRACE4(validation, block_connected, pindexNew->GetBlockHash().data(), pindexNew->nHeight, blockConnecting.vtx.size(), nTime3 - nTime2);
     }
     int64_t nTime4 = GetTimeMicros(); nTimeFlush += nTime4 - nTime3;
     LogPrint(BCLog::BENCH, "  - Flush: %.2fms [%.2fs (%.2fms/blk)]\n", (nTime4 - nTime3) * MILLI, nTimeFlush * MICRO, nTimeFlush * MILLI / nBlocksTotal);
@@ -4198,6 +4691,11 @@ bool CChainState::ConnectTip(BlockValidationState& state, const CChainParams& ch
     LogPrint(BCLog::BENCH, "  - Connect postprocess: %.2fms [%.2fs (%.2fms/blk)]\n", (nTime6 - nTime5) * MILLI, nTimePostConnect * MICRO, nTimePostConnect * MILLI / nBlocksTotal);
     LogPrint(BCLog::BENCH, "- Connect block: %.2fms [%.2fs (%.2fms/blk)]\n", (nTime6 - nTime1) * MILLI, nTimeTotal * MICRO, nTimeTotal * MILLI / nBlocksTotal);
 
+    // Blocks at the tip are the ones zmq, explorers and the kernel lookups read next
+    if (!IsInitialBlockDownload()) {
+        g_block_cache.Insert(pindexNew->GetBlockHash(), pthisBlock);
+    }
+
     connectTrace.BlockConnected(pindexNew, std::move(pthisBlock));
     return true;
 }
@@ -4915,6 +5413,55 @@ static bool CheckBlockHeader(const CBlockHeader& block, BlockValidationState& st
 }
 
 
+bool CTxCheckBatch::operator()()
+{
+    for (size_t i = m_begin; i < m_end; ++i) {
+        TxValidationState &tx_state = (*m_states)[i];
+        tx_state.m_rangeproof_checks = m_rangeproof_checks;
+        if (!CheckTransaction(*m_block->vtx[i], tx_state)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Run the context free transaction checks on the script check threads.
+ *  Returns false if any transaction failed, the caller repeats the checks
+ *  serially so the reported error doesn't depend on thread timing. */
+static bool CheckTransactionsParallel(const CBlock &block, const Consensus::Params &consensusParams, std::vector<CRangeProofCheck> *rangeproof_checks)
+{
+    const size_t num_batches = (block.vtx.size() + TX_CHECK_BATCH_SIZE - 1) / TX_CHECK_BATCH_SIZE;
+    std::vector<TxValidationState> states(block.vtx.size());
+    for (auto &tx_state : states) {
+        tx_state.SetStateInfo(block.nTime, -1, consensusParams, fParticlMode, (fBusyImporting && fSkipRangeproof), true);
+    }
+    // Each batch collects its deferred rangeproofs separately
+    std::vector<std::vector<CRangeProofCheck> > batch_rangeproof_checks(num_batches);
+
+    std::vector<CScriptCheck> vChecks;
+    vChecks.reserve(num_batches);
+    for (size_t b = 0; b < num_batches; ++b) {
+        size_t begin = b * TX_CHECK_BATCH_SIZE;
+        size_t end = std::min(begin + TX_CHECK_BATCH_SIZE, block.vtx.size());
+        CTxCheckBatch check(block, begin, end, states, rangeproof_checks ? &batch_rangeproof_checks[b] : nullptr);
+        vChecks.emplace_back(check);
+    }
+    CCheckQueueControl<CScriptCheck> control(&scriptcheckqueue);
+    control.Add(vChecks);
+    if (!control.Wait()) {
+        return false;
+    }
+    if (rangeproof_checks) {
+        for (auto &batch : batch_rangeproof_checks) {
+            for (auto &check : batch) {
+                rangeproof_checks->emplace_back();
+                rangeproof_checks->back().swap(check);
+            }
+        }
+    }
+    return true;
+}
+
 bool CheckBlockSignature(const CBlock &block)
 {
     if (!block.IsProofOfStake())
@@ -4932,7 +5479,7 @@ bool CheckBlockSignature(const CBlock &block)
         return false;
 
     CPubKey pubKey(txin.scriptWitness.stack[1]);
-    return pubKey.Verify(block.GetHash(), block.vchBlockSig);
+    return pubKey.VerifyCached(block.GetHash(), block.vchBlockSig);
 };
 
 bool AddToMapStakeSeen(const COutPoint &kernel, const uint256 &blockHash)
@@ -5078,16 +5625,47 @@ bool CheckBlock(const CBlock& block, BlockValidationState& state, const Consensu
 
     // Check transactions
     // Must check for duplicate inputs (see CVE-2018-17144)
-    for (const auto& tx : block.vtx) {
-        TxValidationState tx_state;
-        tx_state.SetStateInfo(block.nTime, -1, consensusParams, fParticlMode, (fBusyImporting && fSkipRangeproof), true);
-        if (!CheckTransaction(*tx, tx_state)) {
-            // CheckBlock() does context-free validation checks. The only
-            // possible failures are consensus failures.
-            assert(tx_state.GetResult() == TxValidationResult::TX_CONSENSUS);
-            return state.Invalid(BlockValidationResult::BLOCK_CONSENSUS, tx_state.GetRejectReason(),
-                                 strprintf("Transaction check failed (tx hash %s) %s", tx->GetHash().ToString(), tx_state.GetDebugMessage()));
+    // Rangeproofs are collected across the block and verified in batches on the script check threads
+    std::vector<CRangeProofCheck> vRangeProofChecks;
+    bool defer_rangeproofs = fParticlMode && g_parallel_script_checks;
+    bool parallel_tx_checks = g_parallel_script_checks && block.vtx.size() > TX_CHECK_BATCH_SIZE;
+    for (int pass = 0; pass < 2; ++pass) {
+        if (!parallel_tx_checks ||
+            !CheckTransactionsParallel(block, consensusParams, defer_rangeproofs ? &vRangeProofChecks : nullptr)) {
+            // Serial checks report the first failure in block order
+            vRangeProofChecks.clear();
+            for (const auto& tx : block.vtx) {
+                TxValidationState tx_state;
+                tx_state.SetStateInfo(block.nTime, -1, consensusParams, fParticlMode, (fBusyImporting && fSkipRangeproof), true);
+                if (defer_rangeproofs) {
+                    tx_state.m_rangeproof_checks = &vRangeProofChecks;
+                }
+                if (!CheckTransaction(*tx, tx_state)) {
+                    // CheckBlock() does context-free validation checks. The only
+                    // possible failures are consensus failures.
+                    assert(tx_state.GetResult() == TxValidationResult::TX_CONSENSUS);
+                    return state.Invalid(BlockValidationResult::BLOCK_CONSENSUS, tx_state.GetRejectReason(),
+                                         strprintf("Transaction check failed (tx hash %s) %s", tx->GetHash().ToString(), tx_state.GetDebugMessage()));
+                }
+            }
+        }
+        if (vRangeProofChecks.empty()) {
+            break;
+        }
+        std::vector<CScriptCheck> vChecks;
+        vChecks.reserve(vRangeProofChecks.size());
+        for (auto &check : vRangeProofChecks) {
+            vChecks.emplace_back(check);
         }
+        vRangeProofChecks.clear();
+        CCheckQueueControl<CScriptCheck> control(&scriptcheckqueue);
+        control.Add(vChecks);
+        if (control.Wait()) {
+            break;
+        }
+        // A rangeproof failed, check again inline to report the offending transaction
+        defer_rangeproofs = false;
+        parallel_tx_checks = false;
     }
     unsigned int nSigOps = 0;
     for (const auto& tx : block.vtx)
@@ -6020,13 +6598,15 @@ bool ChainstateManager::ProcessNewBlock(const CChainParams& chainparams, const s
             state.nodeId = node_id;
         }
 
-        // CheckBlock() does not support multi-threaded block validation because CBlock::fChecked can cause data race.
-        // Therefore, the following critical section must include the CheckBlock() call as well.
-        LOCK(cs_main);
-
         // Ensure that CheckBlock() passes before calling AcceptBlock, as
         // belt-and-suspenders.
+        // CheckBlock() runs before cs_main is taken, so the block signature and
+        // transaction checks of blocks from peers on other message handler threads
+        // overlap with the block being accepted or connected. CBlock::fChecked is
+        // atomic, threads checking the same block at once only repeat the work.
         bool ret = CheckBlock(*pblock, state, chainparams.GetConsensus());
+
+        LOCK(cs_main);
         if (ret) {
             // Store to disk
             ret = ::ChainstateActive().AcceptBlock(pblock, state, chainparams, &pindex, fForceProcessing, nullptr, fNewBlock);
@@ -6156,6 +6736,7 @@ void UnlinkPrunedFiles(const std::set<int>& setFilesToPrune)
         fs::remove(UndoFileSeq().FileName(pos));
         LogPrintf("Prune: %s deleted blk/rev (%05u)\n", __func__, *it);
     }
+    g_block_file_maps.Clear();
 }
 
 void BlockManager::FindFilesToPruneManual(std::set<int>& setFilesToPrune, int nManualPruneHeight, int chain_tip_height)
@@ -6416,12 +6997,21 @@ bool static LoadBlockIndexDB(ChainstateManager& chainman, const CChainParams& ch
     // Check whether we have indices
     pblocktree->ReadFlag("addressindex", fAddressIndex);
     LogPrintf("%s: address index %s\n", __func__, fAddressIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("addressbalanceindex", fAddressBalanceIndex);
+    LogPrintf("%s: address balance index %s\n", __func__, fAddressBalanceIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("addressindexv2", fAddressIndexV2);
     pblocktree->ReadFlag("timestampindex", fTimestampIndex);
     LogPrintf("%s: timestamp index %s\n", __func__, fTimestampIndex ? "enabled" : "disabled");
     pblocktree->ReadFlag("spentindex", fSpentIndex);
     LogPrintf("%s: spent index %s\n", __func__, fSpentIndex ? "enabled" : "disabled");
     pblocktree->ReadFlag("balancesindex", fBalancesIndex);
     LogPrintf("%s: balances index %s\n", __func__, fBalancesIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("voteindex", fVoteIndex);
+    LogPrintf("%s: vote index %s\n", __func__, fVoteIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("rewardindex", fRewardIndex);
+    LogPrintf("%s: reward index %s\n", __func__, fRewardIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("insightindexasync", fInsightIndexAsync);
+    LogPrintf("%s: background insight index %s\n", __func__, fInsightIndexAsync ? "enabled" : "disabled");
 
     return true;
 }
@@ -6958,6 +7548,11 @@ bool ChainstateManager::LoadBlockIndex(const CChainParams& chainparams)
         fAddressIndex = gArgs.GetBoolArg("-addressindex", DEFAULT_ADDRESSINDEX);
         pblocktree->WriteFlag("addressindex", fAddressIndex);
         LogPrintf("%s: address index %s\n", __func__, fAddressIndex ? "enabled" : "disabled");
+        // Address index databases created before the running totals were added keep summing the deltas
+        fAddressBalanceIndex = fAddressIndex;
+        pblocktree->WriteFlag("addressbalanceindex", fAddressBalanceIndex);
+        fAddressIndexV2 = fAddressIndex && gArgs.GetBoolArg("-compactaddressindex", DEFAULT_COMPACTADDRESSINDEX);
+        pblocktree->WriteFlag("addressindexv2", fAddressIndexV2);
         fTimestampIndex = gArgs.GetBoolArg("-timestampindex", DEFAULT_TIMESTAMPINDEX);
         pblocktree->WriteFlag("timestampindex", fTimestampIndex);
         LogPrintf("%s: timestamp index %s\n", __func__, fTimestampIndex ? "enabled" : "disabled");
@@ -6967,6 +7562,15 @@ bool ChainstateManager::LoadBlockIndex(const CChainParams& chainparams)
         fBalancesIndex = gArgs.GetBoolArg("-balancesindex", DEFAULT_BALANCESINDEX);
         pblocktree->WriteFlag("balancesindex", fBalancesIndex);
         LogPrintf("%s: balances index %s\n", __func__, fBalancesIndex ? "enabled" : "disabled");
+        fVoteIndex = gArgs.GetBoolArg("-voteindex", DEFAULT_VOTEINDEX);
+        pblocktree->WriteFlag("voteindex", fVoteIndex);
+        LogPrintf("%s: vote index %s\n", __func__, fVoteIndex ? "enabled" : "disabled");
+        fRewardIndex = gArgs.GetBoolArg("-rewardindex", DEFAULT_REWARDINDEX);
+        pblocktree->WriteFlag("rewardindex", fRewardIndex);
+        LogPrintf("%s: reward index %s\n", __func__, fRewardIndex ? "enabled" : "disabled");
+        fInsightIndexAsync = gArgs.GetBoolArg("-insightindexasync", DEFAULT_INSIGHTINDEXASYNC);
+        pblocktree->WriteFlag("insightindexasync", fInsightIndexAsync);
+        LogPrintf("%s: background insight index %s\n", __func__, fInsightIndexAsync ? "enabled" : "disabled");
     }
     return true;
 }
@@ -7002,6 +7606,195 @@ bool LoadGenesisBlock(const CChainParams& chainparams)
     return ::ChainstateActive().LoadGenesisBlock(chainparams);
 }
 
+namespace {
+/**
+ * Feeds LoadExternalBlockFile. A parser thread scans the file for blocks,
+ * deserializes and hashes them, check threads run the context free
+ * CheckBlock on blocks in the window and the caller accepts them in file
+ * order. A block the caller reaches before a check thread does is checked
+ * again by AcceptBlock, so the check stage never holds the caller up.
+ */
+class ReindexPipeline
+{
+public:
+    struct Item {
+        std::shared_ptr<CBlock> block;
+        uint256 hash;
+        FlatFilePos pos;
+        bool checking{false};
+        bool checked{false};
+    };
+
+    ReindexPipeline(const CChainParams& chainparams, int check_threads)
+        : m_chainparams(chainparams)
+    {
+        for (int i = 0; i < check_threads; ++i) {
+            m_threads.emplace_back(&TraceThread<std::function<void()>>, "loadblkchk", [this] { ThreadCheck(); });
+        }
+    }
+
+    ~ReindexPipeline()
+    {
+        Stop();
+    }
+
+    void Start(FILE* fileIn, const FlatFilePos* dbp)
+    {
+        const FlatFilePos pos = dbp ? *dbp : FlatFilePos();
+        m_threads.emplace_back(&TraceThread<std::function<void()>>, "loadblkparse", [this, fileIn, pos] { ThreadParse(fileIn, pos); });
+    }
+
+    void Stop()
+    {
+        {
+            LOCK(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto& t : m_threads) {
+            t.join();
+        }
+        m_threads.clear();
+    }
+
+    /** Next block in file order, nullptr once the file is done. */
+    std::shared_ptr<Item> Pop()
+    {
+        WAIT_LOCK(m_mutex, lock);
+        while (!m_stop && (m_items.empty() ? !m_parsed : m_items.front()->checking && !m_items.front()->checked)) {
+            m_cv.wait(lock);
+        }
+        if (m_stop || m_items.empty()) {
+            return nullptr;
+        }
+        std::shared_ptr<Item> item = m_items.front();
+        m_items.pop_front();
+        m_cv.notify_all();
+        return item;
+    }
+
+    std::atomic<int64_t> m_parse_time{0};
+    std::atomic<int64_t> m_check_time{0};
+    std::atomic<int> m_checked{0};
+
+private:
+    void Push(std::shared_ptr<Item> item)
+    {
+        WAIT_LOCK(m_mutex, lock);
+        while (!m_stop && m_items.size() >= REINDEX_PIPELINE_DEPTH) {
+            m_cv.wait(lock);
+        }
+        m_items.push_back(std::move(item));
+        m_cv.notify_all();
+    }
+
+    bool Stopping()
+    {
+        LOCK(m_mutex);
+        return m_stop;
+    }
+
+    void ThreadParse(FILE* fileIn, FlatFilePos pos)
+    {
+        try {
+            // This takes over fileIn and calls fclose() on it in the CBufferedFile destructor
+            CBufferedFile blkdat(fileIn, 2*MAX_BLOCK_SERIALIZED_SIZE, MAX_BLOCK_SERIALIZED_SIZE+8, SER_DISK, CLIENT_VERSION);
+            uint64_t nRewind = blkdat.GetPos();
+            while (!blkdat.eof()) {
+                if (ShutdownRequested() || Stopping()) break;
+
+                int64_t nTimeStart = GetTimeMicros();
+                blkdat.SetPos(nRewind);
+                nRewind++; // start one byte further next time, in case of failure
+                blkdat.SetLimit(); // remove former limit
+                unsigned int nSize = 0;
+                try {
+                    // locate a header
+                    unsigned char buf[CMessageHeader::MESSAGE_START_SIZE];
+                    blkdat.FindByte(m_chainparams.MessageStart()[0]);
+                    nRewind = blkdat.GetPos()+1;
+                    blkdat >> buf;
+                    if (memcmp(buf, m_chainparams.MessageStart(), CMessageHeader::MESSAGE_START_SIZE))
+                        continue;
+                    // read size
+                    blkdat >> nSize;
+                    if (nSize < 80 || nSize > MAX_BLOCK_SERIALIZED_SIZE)
+                        continue;
+                } catch (const std::exception&) {
+                    // no valid block header found; don't complain
+                    break;
+                }
+                try {
+                    // read block
+                    uint64_t nBlockPos = blkdat.GetPos();
+                    auto item = std::make_shared<Item>();
+                    item->pos = pos;
+                    item->pos.nPos = nBlockPos;
+                    blkdat.SetLimit(nBlockPos + nSize);
+                    item->block = std::make_shared<CBlock>();
+                    blkdat >> *item->block;
+                    nRewind = blkdat.GetPos();
+                    item->hash = item->block->GetHash();
+                    m_parse_time += GetTimeMicros() - nTimeStart;
+                    Push(std::move(item));
+                } catch (const std::exception& e) {
+                    LogPrintf("%s: Deserialize or I/O error - %s\n", __func__, e.what());
+                }
+            }
+        } catch (const std::runtime_error& e) {
+            AbortNode(std::string("System error: ") + e.what());
+        }
+        LOCK(m_mutex);
+        m_parsed = true;
+        m_cv.notify_all();
+    }
+
+    void ThreadCheck()
+    {
+        WAIT_LOCK(m_mutex, lock);
+        while (true) {
+            std::shared_ptr<Item> item;
+            while (!m_stop) {
+                for (const auto& it : m_items) {
+                    if (!it->checking) {
+                        item = it;
+                        break;
+                    }
+                }
+                if (item) break;
+                m_cv.wait(lock);
+            }
+            if (m_stop) {
+                return;
+            }
+            item->checking = true;
+            {
+                REVERSE_LOCK(lock);
+                int64_t nTimeStart = GetTimeMicros();
+                BlockValidationState state;
+                if (!CheckBlock(*item->block, state, m_chainparams.GetConsensus()) ||
+                    (state.nFlags & BLOCK_FAILED_DUPLICATE_STAKE)) {
+                    // Leave it to AcceptBlock to report
+                    item->block->fChecked = false;
+                }
+                m_check_time += GetTimeMicros() - nTimeStart;
+                m_checked++;
+            }
+            item->checked = true;
+            m_cv.notify_all();
+        }
+    }
+
+    const CChainParams& m_chainparams;
+    Mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop GUARDED_BY(m_mutex){false};
+    bool m_parsed GUARDED_BY(m_mutex){false};
+    std::deque<std::shared_ptr<Item>> m_items GUARDED_BY(m_mutex);
+    std::vector<std::thread> m_threads;
+};
+} // namespace
+
 void LoadExternalBlockFile(const CChainParams& chainparams, FILE* fileIn, FlatFilePos* dbp)
 {
     // Map of disk positions for blocks with unknown parent (only used for reindex)
@@ -7012,47 +7805,33 @@ void LoadExternalBlockFile(const CChainParams& chainparams, FILE* fileIn, FlatFi
     fTimestampIndex = gArgs.GetBoolArg("-timestampindex", DEFAULT_TIMESTAMPINDEX);
     fSpentIndex = gArgs.GetBoolArg("-spentindex", DEFAULT_SPENTINDEX);
     fBalancesIndex = gArgs.GetBoolArg("-balancesindex", DEFAULT_BALANCESINDEX);
+    fVoteIndex = gArgs.GetBoolArg("-voteindex", DEFAULT_VOTEINDEX);
+    fRewardIndex = gArgs.GetBoolArg("-rewardindex", DEFAULT_REWARDINDEX);
+    fInsightIndexAsync = gArgs.GetBoolArg("-insightindexasync", DEFAULT_INSIGHTINDEXASYNC);
 
+    const int check_threads = std::max(0, std::min(g_reindex_check_threads, MAX_REINDEX_CHECK_THREADS));
     int nLoaded = 0;
+    int64_t nAcceptTime = 0, nWaitTime = 0;
+    ReindexPipeline pipeline(chainparams, check_threads);
     try {
-        // This takes over fileIn and calls fclose() on it in the CBufferedFile destructor
-        CBufferedFile blkdat(fileIn, 2*MAX_BLOCK_SERIALIZED_SIZE, MAX_BLOCK_SERIALIZED_SIZE+8, SER_DISK, CLIENT_VERSION);
-        uint64_t nRewind = blkdat.GetPos();
-        while (!blkdat.eof()) {
-            if (ShutdownRequested()) return;
-
-            blkdat.SetPos(nRewind);
-            nRewind++; // start one byte further next time, in case of failure
-            blkdat.SetLimit(); // remove former limit
-            unsigned int nSize = 0;
-            try {
-                // locate a header
-                unsigned char buf[CMessageHeader::MESSAGE_START_SIZE];
-                blkdat.FindByte(chainparams.MessageStart()[0]);
-                nRewind = blkdat.GetPos()+1;
-                blkdat >> buf;
-                if (memcmp(buf, chainparams.MessageStart(), CMessageHeader::MESSAGE_START_SIZE))
-                    continue;
-                // read size
-                blkdat >> nSize;
-                if (nSize < 80 || nSize > MAX_BLOCK_SERIALIZED_SIZE)
-                    continue;
-            } catch (const std::exception&) {
-                // no valid block header found; don't complain
-                break;
-            }
+        pipeline.Start(fileIn, dbp);
+        int64_t nTime = GetTimeMicros();
+        while (true) {
+            if (ShutdownRequested()) break;
+
+            int64_t nTimeWait = GetTimeMicros();
+            nAcceptTime += nTimeWait - nTime;
+            std::shared_ptr<ReindexPipeline::Item> item = pipeline.Pop();
+            nTime = GetTimeMicros();
+            nWaitTime += nTime - nTimeWait;
+            if (!item) break;
+
             try {
-                // read block
-                uint64_t nBlockPos = blkdat.GetPos();
                 if (dbp)
-                    dbp->nPos = nBlockPos;
-                blkdat.SetLimit(nBlockPos + nSize);
-                std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
+                    *dbp = item->pos;
+                std::shared_ptr<CBlock> pblock = item->block;
                 CBlock& block = *pblock;
-                blkdat >> block;
-                nRewind = blkdat.GetPos();
-
-                uint256 hash = block.GetHash();
+                const uint256& hash = item->hash;
                 {
                     LOCK(cs_main);
                     // detect out of order blocks, and store them for later
@@ -7120,10 +7899,15 @@ void LoadExternalBlockFile(const CChainParams& chainparams, FILE* fileIn, FlatFi
                 LogPrintf("%s: Deserialize or I/O error - %s\n", __func__, e.what());
             }
         }
+        nAcceptTime += GetTimeMicros() - nTime;
     } catch (const std::runtime_error& e) {
         AbortNode(std::string("System error: ") + e.what());
     }
+    pipeline.Stop();
     LogPrintf("Loaded %i blocks from external file in %dms\n", nLoaded, GetTimeMillis() - nStart);
+    LogPrint(BCLog::REINDEX, "%s: parse %.2fms, check %.2fms (%d blocks, %d threads), accept %.2fms, waiting for blocks %.2fms\n", __func__,
+        pipeline.m_parse_time * MILLI, pipeline.m_check_time * MILLI, pipeline.m_checked.load(), check_threads,
+        nAcceptTime * MILLI, nWaitTime * MILLI);
 }
 
 void CChainState::CheckBlockIndex(const Consensus::Params& consensusParams)
@@ -7381,7 +8165,40 @@ int VersionBitsTipStateSinceHeight(const Consensus::Params& params, Consensus::D
     return VersionBitsStateSinceHeight(::ChainActive().Tip(), params, pos, versionbitscache);
 }
 
-static const uint64_t MEMPOOL_DUMP_VERSION = 1;
+static const uint64_t MEMPOOL_DUMP_VERSION_NO_PROOFS = 1;
+static const uint64_t MEMPOOL_DUMP_VERSION = 2;
+
+/** Key authenticating the verified transactions listed in mempool.dat, kept apart from the file */
+static bool GetMempoolDumpKey(std::vector<unsigned char>& key)
+{
+    const fs::path path = GetDataDir() / "mempool.key";
+    key.assign(32, 0);
+    FILE* file = fsbridge::fopen(path, "rb");
+    if (file) {
+        const bool ok = fread(key.data(), 1, key.size(), file) == key.size();
+        fclose(file);
+        return ok;
+    }
+    GetStrongRandBytes(key.data(), key.size());
+    file = fsbridge::fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+    const bool ok = fwrite(key.data(), 1, key.size(), file) == key.size();
+    return fclose(file) == 0 && ok;
+}
+
+static uint256 MempoolDumpMAC(const std::vector<unsigned char>& key, const uint256& tip_hash, const std::vector<uint256>& wtxids)
+{
+    uint256 mac;
+    CHMAC_SHA256 hmac(key.data(), key.size());
+    hmac.Write(tip_hash.begin(), tip_hash.size());
+    for (const auto& wtxid : wtxids) {
+        hmac.Write(wtxid.begin(), wtxid.size());
+    }
+    hmac.Finalize(mac.begin());
+    return mac;
+}
 
 bool LoadMempool(CTxMemPool& pool)
 {
@@ -7399,14 +8216,35 @@ bool LoadMempool(CTxMemPool& pool)
     int64_t failed = 0;
     int64_t already_there = 0;
     int64_t unbroadcast = 0;
+    int64_t preverified = 0;
     int64_t nNow = GetTime();
 
     try {
         uint64_t version;
         file >> version;
-        if (version != MEMPOOL_DUMP_VERSION) {
+        if (version != MEMPOOL_DUMP_VERSION && version != MEMPOOL_DUMP_VERSION_NO_PROOFS) {
             return false;
         }
+        // Transactions that passed validation at the same tip skip their rangeproof and ring signature checks
+        uint256 verified_tip;
+        std::set<uint256> verified_wtxids;
+        if (version == MEMPOOL_DUMP_VERSION) {
+            uint256 mac;
+            std::vector<uint256> wtxids;
+            file >> verified_tip;
+            file >> wtxids;
+            file >> mac;
+            std::vector<unsigned char> key;
+            if (gArgs.GetBoolArg("-persistmempoolproofs", DEFAULT_PERSIST_MEMPOOL_PROOFS) && !wtxids.empty()) {
+                if (WITH_LOCK(cs_main, return ::ChainActive().Tip()->GetBlockHash()) != verified_tip) {
+                    LogPrintf("Mempool file was written at another chain tip, verifying all transactions.\n");
+                } else if (!GetMempoolDumpKey(key) || MempoolDumpMAC(key, verified_tip, wtxids) != mac) {
+                    LogPrintf("Mempool file proofs failed authentication, verifying all transactions.\n");
+                } else {
+                    verified_wtxids.insert(wtxids.begin(), wtxids.end());
+                }
+            }
+        }
         uint64_t num;
         file >> num;
         while (num--) {
@@ -7428,11 +8266,25 @@ bool LoadMempool(CTxMemPool& pool)
             state.SetStateInfo(tip->nTime, tip->nHeight, consensus, fParticlMode, (fBusyImporting && fSkipRangeproof));
             if (nTime > nNow - nExpiryTimeout) {
                 LOCK(cs_main);
+                const bool skip_proofs = verified_wtxids.count(tx->GetWitnessHash()) &&
+                                         ::ChainActive().Tip()->GetBlockHash() == verified_tip;
+                if (skip_proofs) {
+                    // Key images and ring members are still checked against the chain
+                    state.m_skip_mlsag = true;
+                    if (std::any_of(tx->vpout.begin(), tx->vpout.end(), [](const CTxOutBaseRef& txout) {
+                            return txout->IsType(OUTPUT_CT) || txout->IsType(OUTPUT_RINGCT);
+                        })) {
+                        ProofCacheAdd(TxProofCacheEntry(tx->GetWitnessHash(), nTime >= consensus.bulletproof_time ? 1 : 0));
+                    }
+                }
                 AcceptToMemoryPoolWithTime(chainparams, pool, state, tx, nTime,
                                            nullptr /* plTxnReplaced */, false /* bypass_limits */,
                                            false /* test_accept */, nullptr /* fee */, false /* ignore_locks */);
                 if (state.IsValid()) {
                     ++count;
+                    if (skip_proofs) {
+                        ++preverified;
+                    }
                 } else {
                     // mempool may contain the transaction already, e.g. from
                     // wallet(s) having loaded it while we were processing
@@ -7477,6 +8329,9 @@ bool LoadMempool(CTxMemPool& pool)
     }
 
     LogPrintf("Imported mempool transactions from disk: %i succeeded, %i failed, %i expired, %i already there, %i waiting for initial broadcast\n", count, failed, expired, already_there, unbroadcast);
+    if (preverified) {
+        LogPrintf("Imported %i mempool transactions with proofs verified before shutdown\n", preverified);
+    }
     return true;
 }
 
@@ -7487,17 +8342,21 @@ bool DumpMempool(const CTxMemPool& pool)
     std::map<uint256, CAmount> mapDeltas;
     std::vector<TxMempoolInfo> vinfo;
     std::set<uint256> unbroadcast_txids;
+    uint256 tip_hash;
 
     static Mutex dump_mutex;
     LOCK(dump_mutex);
 
     {
-        LOCK(pool.cs);
+        LOCK2(cs_main, pool.cs);
         for (const auto &i : pool.mapDeltas) {
             mapDeltas[i.first] = i.second;
         }
         vinfo = pool.infoAll();
         unbroadcast_txids = pool.GetUnbroadcastTxs();
+        if (::ChainActive().Tip()) {
+            tip_hash = ::ChainActive().Tip()->GetBlockHash();
+        }
     }
 
     int64_t mid = GetTimeMicros();
@@ -7510,9 +8369,27 @@ bool DumpMempool(const CTxMemPool& pool)
 
         CAutoFile file(filestr, SER_DISK, CLIENT_VERSION);
 
-        uint64_t version = MEMPOOL_DUMP_VERSION;
+        const bool persist_proofs = gArgs.GetBoolArg("-persistmempoolproofs", DEFAULT_PERSIST_MEMPOOL_PROOFS);
+        uint64_t version = persist_proofs ? MEMPOOL_DUMP_VERSION : MEMPOOL_DUMP_VERSION_NO_PROOFS;
         file << version;
 
+        if (persist_proofs) {
+            // Every transaction in the pool passed validation at tip_hash
+            std::vector<uint256> wtxids;
+            std::vector<unsigned char> key;
+            if (GetMempoolDumpKey(key)) {
+                wtxids.reserve(vinfo.size());
+                for (const auto& i : vinfo) {
+                    wtxids.push_back(i.tx->GetWitnessHash());
+                }
+            } else {
+                LogPrintf("Failed to read or create mempool.key, proofs are not persisted.\n");
+            }
+            file << tip_hash;
+            file << wtxids;
+            file << MempoolDumpMAC(key, tip_hash, wtxids);
+        }
+
         file << (uint64_t)vinfo.size();
         for (const auto& i : vinfo) {
             file << *(i.tx);
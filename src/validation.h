@@ -11,6 +11,8 @@
 #endif
 
 #include <amount.h>
+#include <anon.h>
+#include <blind.h>
 #include <coins.h>
 #include <crypto/common.h> // for ReadLE64
 #include <fs.h>
@@ -34,6 +36,8 @@
 #include <vector>
 #include "coldreward/coldrewardtracker.h"
 
+#include <boost/variant.hpp>
+
 class CChainState;
 class BlockValidationState;
 class CBlockIndex;
@@ -73,6 +77,8 @@ static const unsigned int MAX_BLOCKFILE_SIZE = 0x8000000; // 128 MiB
 static const int MAX_SCRIPTCHECK_THREADS = 15;
 /** -par default (number of script-checking threads, 0 = auto) */
 static const int DEFAULT_SCRIPTCHECK_THREADS = 0;
+/** Number of transactions in each batch of context free checks CheckBlock hands to the script check threads */
+static const size_t TX_CHECK_BATCH_SIZE = 16;
 static const int64_t DEFAULT_MAX_TIP_AGE = 24 * 60 * 60;
 static const bool DEFAULT_CHECKPOINTS_ENABLED = true;
 static const bool DEFAULT_TXINDEX = false;
@@ -80,6 +86,30 @@ static const bool DEFAULT_GHOSTDEBUG = false;
 static const char* const DEFAULT_BLOCKFILTERINDEX = "0";
 /** Default for -persistmempool */
 static const bool DEFAULT_PERSIST_MEMPOOL = true;
+/** Default for -persistmempoolproofs */
+static const bool DEFAULT_PERSIST_MEMPOOL_PROOFS = true;
+/** Default for -mmapblocks */
+static const bool DEFAULT_MMAP_BLOCKS = false;
+/** Number of block files kept mapped with -mmapblocks */
+static const size_t MAX_MAPPED_BLOCK_FILES = 8;
+/** Default for -reindexthreads */
+static const int DEFAULT_REINDEX_CHECK_THREADS = 2;
+/** Maximum number of block check threads used by LoadExternalBlockFile */
+static const int MAX_REINDEX_CHECK_THREADS = 16;
+/** Number of parsed blocks LoadExternalBlockFile holds ahead of AcceptBlock */
+static const size_t REINDEX_PIPELINE_DEPTH = 32;
+/** Default for -coinswriteback, the percentage of the coins cache above which dirty coins are written back, 0 disables */
+static const int DEFAULT_COINS_WRITEBACK = 0;
+/** Maximum number of coins in one background writeback batch */
+static const size_t COINS_WRITEBACK_BATCH = 50000;
+/** Coins changed in the most recent blocks aren't written back, they're likely to change again */
+static const uint32_t COINS_WRITEBACK_MIN_AGE = 100;
+/** Maximum number of transactions in a package tested by ProcessNewPackage */
+static const unsigned int MAX_PACKAGE_COUNT = 25;
+/** Maximum number of transactions tested on their own by one testmempoolaccept call */
+static const unsigned int MAX_INDEPENDENT_TEST_COUNT = 1000;
+/** Maximum summed virtual size of a package in kvB */
+static const unsigned int MAX_PACKAGE_SIZE = 101;
 /** Default for using fee filter */
 static const bool DEFAULT_FEEFILTER = true;
 
@@ -113,6 +143,10 @@ static const bool DEFAULT_ADDRESSINDEX = false;
 static const bool DEFAULT_TIMESTAMPINDEX = false;
 static const bool DEFAULT_SPENTINDEX = false;
 static const bool DEFAULT_BALANCESINDEX = false;
+static const bool DEFAULT_VOTEINDEX = false;
+static const bool DEFAULT_REWARDINDEX = false;
+static const bool DEFAULT_INSIGHTINDEXASYNC = false;
+static const bool DEFAULT_COMPACTADDRESSINDEX = true;
 static const unsigned int DEFAULT_DB_MAX_OPEN_FILES = 64; // set to 1000 for insight
 static const bool DEFAULT_DB_COMPRESSION = false; // set to true for insight
 static const unsigned int DEFAULT_BANSCORE_THRESHOLD = 100;
@@ -187,6 +221,10 @@ extern bool fHavePruned;
 extern bool fPruneMode;
 /** Number of MiB of block files that we're trying to stay below. */
 extern uint64_t nPruneTarget;
+/** True if blocks are read through read-only mappings of the block files (-mmapblocks). */
+extern bool g_mmap_blocks;
+/** Number of threads running CheckBlock ahead of AcceptBlock while loading block files (-reindexthreads). */
+extern int g_reindex_check_threads;
 /** Documentation for argument 'checklevel'. */
 extern const std::vector<std::string> CHECKLEVEL_DOC;
 
@@ -260,6 +298,27 @@ bool AcceptToMemoryPool(CTxMemPool& pool, TxValidationState &state, const CTrans
                         std::list<CTransactionRef>* plTxnReplaced,
                         bool bypass_limits, bool test_accept=false, CAmount* fee_out=nullptr, bool ignore_locks=false) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
 
+/**
+ * Test a package of transactions for mempool acceptance in one pass, only
+ * test_accept is supported. Transactions may spend outputs of transactions
+ * before them in the package, the coins view is shared between them.
+ * package_state is set when the package as a whole is rejected. tx_states
+ * and fees hold the outcome of each transaction in package order, the
+ * transactions after the first one failing aren't tested.
+ */
+bool ProcessNewPackage(CTxMemPool& pool, const std::vector<CTransactionRef>& package, bool test_accept,
+                       TxValidationState& package_state, std::vector<TxValidationState>& tx_states,
+                       std::vector<CAmount>& fees, bool ignore_locks=false) EXCLUSIVE_LOCKS_REQUIRED(cs_main);
+
+/** Verify the signatures, ring signatures and rangeproofs of tx on the script check threads
+ * before it's passed to AcceptToMemoryPool. The locks are only held while gathering the
+ * spent outputs and ring members, results are kept in the signature and proof caches. */
+void PreValidateTransaction(CTxMemPool& pool, const CTransactionRef& ptx) LOCKS_EXCLUDED(cs_main);
+
+/** PreValidateTransaction for independent transactions, read from one snapshot of the
+ * chain and mempool with the checks of all queued together. */
+void PreValidateTransactions(CTxMemPool& pool, const std::vector<CTransactionRef>& txns) LOCKS_EXCLUDED(cs_main);
+
 /** Get the BIP9 state for a given deployment at the current tip. */
 ThresholdState VersionBitsTipState(const Consensus::Params& params, Consensus::DeploymentPos pos);
 
@@ -294,14 +353,43 @@ bool TestLockPointValidity(const LockPoints* lp) EXCLUSIVE_LOCKS_REQUIRED(cs_mai
  * of the block needed for calculation or skips the calculation and uses the LockPoints
  * passed in for evaluation.
  * The LockPoints should not be considered valid if CheckSequenceLocks returns false.
+ * Inputs are looked up in coins_view if set, else in the mempool and the coins tip.
  *
  * See consensus/consensus.h for flag definitions.
  */
-bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flags, LockPoints* lp = nullptr, bool useExistingLockPoints = false) EXCLUSIVE_LOCKS_REQUIRED(::cs_main, pool.cs);
+bool CheckSequenceLocks(const CTxMemPool& pool, const CTransaction& tx, int flags, LockPoints* lp = nullptr, bool useExistingLockPoints = false, const CCoinsView* coins_view = nullptr) EXCLUSIVE_LOCKS_REQUIRED(::cs_main, pool.cs);
+
+/** Context free checks of a run of a block's transactions, on the script check threads */
+class CTxCheckBatch
+{
+private:
+    const CBlock *m_block = nullptr;
+    size_t m_begin = 0;
+    size_t m_end = 0;
+    std::vector<TxValidationState> *m_states = nullptr;
+    std::vector<CRangeProofCheck> *m_rangeproof_checks = nullptr;
+public:
+    CTxCheckBatch() {}
+    CTxCheckBatch(const CBlock &block, size_t begin, size_t end, std::vector<TxValidationState> &states, std::vector<CRangeProofCheck> *rangeproof_checks) :
+        m_block(&block), m_begin(begin), m_end(end), m_states(&states), m_rangeproof_checks(rangeproof_checks) {}
+
+    bool operator()();
+
+    void swap(CTxCheckBatch &check)
+    {
+        std::swap(m_block, check.m_block);
+        std::swap(m_begin, check.m_begin);
+        std::swap(m_end, check.m_end);
+        std::swap(m_states, check.m_states);
+        std::swap(m_rangeproof_checks, check.m_rangeproof_checks);
+    }
+};
 
 /**
  * Closure representing one script verification
  * Note that this stores references to the spending transaction
+ * Ring signature, rangeproof and transaction checks share the script check
+ * queue, held in m_deferred. Only the active one is stored, blank for a script.
  */
 class CScriptCheck
 {
@@ -316,6 +404,7 @@ private:
     bool cacheStore;
     ScriptError error;
     PrecomputedTransactionData *txdata;
+    boost::variant<boost::blank, CMLSAGCheck, CRangeProofCheck, CTxCheckBatch> m_deferred;
 public:
     CScriptCheck(const CScript& scriptPubKeyIn, const std::vector<uint8_t> &vchAmountIn, const CTransaction& txToIn, unsigned int nInIn, unsigned int nFlagsIn, bool cacheIn, PrecomputedTransactionData* txdataIn) :
         scriptPubKey(scriptPubKeyIn), vchAmount(vchAmountIn),
@@ -342,6 +431,24 @@ public:
         vchAmount = outIn.amount;
         scriptPubKey = outIn.scriptPubKey;
     };
+    /** Wrap a deferred ring signature or commitment tally check so it can share the script check queue */
+    explicit CScriptCheck(CMLSAGCheck &anon_check) :
+        amount(0), ptxTo(nullptr), nIn(0), nFlags(0), cacheStore(false), error(SCRIPT_ERR_UNKNOWN_ERROR), txdata(nullptr), m_deferred(CMLSAGCheck())
+    {
+        boost::get<CMLSAGCheck>(m_deferred).swap(anon_check);
+    };
+    /** Wrap a batch of deferred rangeproofs */
+    explicit CScriptCheck(CRangeProofCheck &rangeproof_check) :
+        amount(0), ptxTo(nullptr), nIn(0), nFlags(0), cacheStore(false), error(SCRIPT_ERR_UNKNOWN_ERROR), txdata(nullptr), m_deferred(CRangeProofCheck())
+    {
+        boost::get<CRangeProofCheck>(m_deferred).swap(rangeproof_check);
+    };
+    /** Wrap a batch of context free transaction checks */
+    explicit CScriptCheck(CTxCheckBatch &tx_check) :
+        amount(0), ptxTo(nullptr), nIn(0), nFlags(0), cacheStore(false), error(SCRIPT_ERR_UNKNOWN_ERROR), txdata(nullptr), m_deferred(CTxCheckBatch())
+    {
+        boost::get<CTxCheckBatch>(m_deferred).swap(tx_check);
+    };
 
     bool operator()();
 
@@ -356,6 +463,7 @@ public:
         std::swap(cacheStore, check.cacheStore);
         std::swap(error, check.error);
         std::swap(txdata, check.txdata);
+        m_deferred.swap(check.m_deferred);
     }
 
     ScriptError GetScriptError() const { return error; }
@@ -366,8 +474,11 @@ void InitScriptExecutionCache();
 
 
 /** Functions for disk access for blocks */
-bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams);
-bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams);
+/** ser_flags are ORed into the version of the stream read from, such as SERIALIZE_TRANSACTION_NO_RANGEPROOF */
+bool ReadBlockFromDisk(CBlock& block, const FlatFilePos& pos, const Consensus::Params& consensusParams, int ser_flags = 0);
+bool ReadBlockFromDisk(CBlock& block, const CBlockIndex* pindex, const Consensus::Params& consensusParams, int ser_flags = 0);
+/** Read a block through g_block_cache, returning the cached copy itself, null on failure */
+std::shared_ptr<const CBlock> ReadSharedBlockFromDisk(const CBlockIndex* pindex, const Consensus::Params& consensusParams);
 bool ReadTransactionFromDiskBlock(const CBlockIndex *pindex, int nIndex, CTransactionRef &txOut);
 
 bool ReadRawBlockFromDisk(std::vector<uint8_t>& block, const FlatFilePos& pos, const CMessageHeader::MessageStartChars& message_start);
@@ -738,6 +849,16 @@ public:
     //! if we pruned.
     void PruneAndFlush();
 
+    /**
+     * Write a batch of the oldest dirty coins of the tip cache to the coins
+     * database once the cache uses more than min_usage_percent of its size.
+     * Block files and the block index are written first, the batch itself
+     * is written without holding cs_main.
+     *
+     * @returns true if a batch was written, more may be waiting
+     */
+    bool WriteBackCoins(int min_usage_percent) LOCKS_EXCLUDED(cs_main);
+
     /**
      * Make the best chain active, in multiple steps. The result is either failure
      * or an activated best chain. pblock is either nullptr or a pointer to a block
@@ -1116,5 +1237,11 @@ void UpdateTip(CTxMemPool& mempool, const CBlockIndex *pindexNew, const CChainPa
 
 ColdRewardTracker& initColdReward();
 void clearTrackedData();
+/**
+ * Keep the tracked balances and ranges in memory while the blocks are connected after clearTrackedData(), they are
+ * written with the undo data and last tracked height when the chainstate is flushed and in FinishRewardTrackerRebuild().
+ */
+void StartRewardTrackerRebuild();
+void FinishRewardTrackerRebuild();
 
 #endif // BITCOIN_VALIDATION_H
@@ -11,8 +11,15 @@
 #include <primitives/block.h>
 #include <primitives/transaction.h>
 #include <scheduler.h>
+#include <tinyformat.h>
+#include <util/system.h>
+#include <util/time.h>
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <list>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -23,30 +30,116 @@
 //! registered, and a std::list is to used to store the callbacks that are
 //! currently registered as well as any callbacks that are just unregistered
 //! and about to be deleted when they are done executing.
+//!
+//! Each subscriber has its own queue (lane) for the background notifications,
+//! serviced by a scheduler with a thread per lane, so a slow subscriber only
+//! delays its own notifications. The callbacks of a lane still run in order
+//! and one at a time.
 struct MainSignalsInstance {
 private:
+    //! Lanes get a thread each up to this, beyond it they share the threads
+    static constexpr size_t MAX_LANE_THREADS{8};
+
+    //! A subscriber's notification queue. The scheduler keeps a pointer to the
+    //! queue, so lanes live as long as the instance. A lane left by an
+    //! unregistered subscriber is taken by the next one, preferably once it's
+    //! empty. Notifications left for the previous subscriber are skipped by
+    //! their generation.
+    struct Lane {
+        explicit Lane(CScheduler* pscheduler) : m_queue(pscheduler) {}
+
+        SingleThreadedSchedulerClient m_queue;
+        std::string m_name;
+        std::atomic<bool> m_registered{false};
+        std::atomic<uint64_t> m_generation{0};
+        std::atomic<size_t> m_depth{0}; // Queued and running
+        std::atomic<size_t> m_max_depth{0};
+        std::atomic<uint64_t> m_processed{0};
+        std::atomic<int64_t> m_busy_time{0};
+
+        void Add(std::function<void()> func)
+        {
+            const size_t depth = ++m_depth;
+            size_t max_depth = m_max_depth;
+            while (depth > max_depth && !m_max_depth.compare_exchange_weak(max_depth, depth)) {}
+            m_queue.AddToProcessQueue([this, func] {
+                const int64_t start = GetTimeMicros();
+                struct Done {
+                    Lane& lane;
+                    int64_t start;
+                    ~Done()
+                    {
+                        lane.m_busy_time += GetTimeMicros() - start;
+                        ++lane.m_processed;
+                        --lane.m_depth;
+                    }
+                } done{*this, start};
+                func();
+            });
+        }
+    };
+
     Mutex m_mutex;
     //! List entries consist of a callback pointer and reference count. The
     //! count is equal to the number of current executions of that entry, plus 1
     //! if it's registered. It cannot be 0 because that would imply it is
     //! unregistered and also not being executed (so shouldn't exist).
-    struct ListEntry { std::shared_ptr<CValidationInterface> callbacks; int count = 1; };
+    struct ListEntry { std::shared_ptr<CValidationInterface> callbacks; int count = 1; Lane* lane = nullptr; };
     std::list<ListEntry> m_list GUARDED_BY(m_mutex);
     std::unordered_map<CValidationInterface*, std::list<ListEntry>::iterator> m_map GUARDED_BY(m_mutex);
+    std::list<Lane> m_lanes GUARDED_BY(m_mutex);
+
+    CScheduler m_lane_scheduler;
+    std::vector<std::thread> m_lane_threads GUARDED_BY(m_mutex);
+    bool m_lanes_stopped GUARDED_BY(m_mutex){false};
+
+    Lane* TakeLane(const std::string& name) EXCLUSIVE_LOCKS_REQUIRED(m_mutex)
+    {
+        Lane* lane = nullptr;
+        for (auto& it : m_lanes) {
+            if (!it.m_registered && (!lane || it.m_depth < lane->m_depth)) {
+                lane = &it;
+            }
+        }
+        if (!lane) {
+            m_lanes.emplace_back(&m_lane_scheduler);
+            lane = &m_lanes.back();
+            if (!m_lanes_stopped && m_lane_threads.size() < MAX_LANE_THREADS) {
+                m_lane_threads.emplace_back(&TraceThread<std::function<void()>>, "valqueue", [this] { m_lane_scheduler.serviceQueue(); });
+            }
+        }
+        lane->m_name = name.empty() ? strprintf("lane%d", m_lanes.size()) : name;
+        lane->m_max_depth = lane->m_depth.load();
+        lane->m_processed = 0;
+        lane->m_busy_time = 0;
+        ++lane->m_generation;
+        lane->m_registered = true;
+        return lane;
+    }
 
 public:
     // We are not allowed to assume the scheduler only runs in one thread,
     // but must ensure all callbacks happen in-order, so we end up creating
     // our own queue here :(
+    // Only carries CallFunctionInValidationInterfaceQueue functions when no
+    // subscriber is registered.
     SingleThreadedSchedulerClient m_schedulerClient;
 
     explicit MainSignalsInstance(CScheduler *pscheduler) : m_schedulerClient(pscheduler) {}
 
-    void Register(std::shared_ptr<CValidationInterface> callbacks)
+    ~MainSignalsInstance()
+    {
+        StopLanes();
+    }
+
+    void Register(std::shared_ptr<CValidationInterface> callbacks, const std::string& name)
     {
         LOCK(m_mutex);
         auto inserted = m_map.emplace(callbacks.get(), m_list.end());
-        if (inserted.second) inserted.first->second = m_list.emplace(m_list.end());
+        if (inserted.second) {
+            inserted.first->second = m_list.emplace(m_list.end());
+            inserted.first->second->lane = TakeLane(name);
+        }
         inserted.first->second->callbacks = std::move(callbacks);
     }
 
@@ -55,6 +148,8 @@ public:
         LOCK(m_mutex);
         auto it = m_map.find(callbacks);
         if (it != m_map.end()) {
+            it->second->lane->m_registered = false;
+            ++it->second->lane->m_generation;
             if (!--it->second->count) m_list.erase(it->second);
             m_map.erase(it);
         }
@@ -68,6 +163,8 @@ public:
     {
         LOCK(m_mutex);
         for (const auto& entry : m_map) {
+            entry.second->lane->m_registered = false;
+            ++entry.second->lane->m_generation;
             if (!--entry.second->count) m_list.erase(entry.second);
         }
         m_map.clear();
@@ -85,6 +182,99 @@ public:
             it = --it->count ? std::next(it) : m_list.erase(it);
         }
     }
+
+    //! Queue f for each registered subscriber on its lane. The subscriber is
+    //! kept alive until it has run, and skipped if it unregisters before.
+    void Enqueue(std::function<void(CValidationInterface&)> f)
+    {
+        auto shared_f = std::make_shared<std::function<void(CValidationInterface&)>>(std::move(f));
+        LOCK(m_mutex);
+        for (const auto& entry : m_map) {
+            Lane* lane = entry.second->lane;
+            const uint64_t generation = lane->m_generation;
+            std::shared_ptr<CValidationInterface> callbacks = entry.second->callbacks;
+            lane->Add([lane, generation, callbacks, shared_f] {
+                if (lane->m_generation == generation) {
+                    (*shared_f)(*callbacks);
+                }
+            });
+        }
+    }
+
+    //! Call func once every lane has run the notifications queued before,
+    //! including those of subscribers unregistered since.
+    void EnqueueBarrier(std::function<void()> func)
+    {
+        LOCK(m_mutex);
+        auto remaining = std::make_shared<std::atomic<size_t>>(m_lanes.size() + 1);
+        auto shared_func = std::make_shared<std::function<void()>>(std::move(func));
+        auto arrive = [remaining, shared_func] {
+            if (--*remaining == 0) {
+                (*shared_func)();
+            }
+        };
+        for (auto& lane : m_lanes) {
+            lane.Add(arrive);
+        }
+        m_schedulerClient.AddToProcessQueue(arrive);
+    }
+
+    void StopLanes()
+    {
+        std::vector<std::thread> threads;
+        {
+            LOCK(m_mutex);
+            m_lanes_stopped = true;
+            threads.swap(m_lane_threads);
+        }
+        m_lane_scheduler.stop();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void EmptyQueues()
+    {
+        StopLanes();
+        m_schedulerClient.EmptyQueue();
+        std::vector<Lane*> lanes;
+        {
+            LOCK(m_mutex);
+            for (auto& lane : m_lanes) {
+                lanes.push_back(&lane);
+            }
+        }
+        for (Lane* lane : lanes) {
+            lane->m_queue.EmptyQueue();
+        }
+    }
+
+    size_t CallbacksPending()
+    {
+        size_t pending = m_schedulerClient.CallbacksPending();
+        LOCK(m_mutex);
+        for (const auto& lane : m_lanes) {
+            pending = std::max(pending, lane.m_depth.load());
+        }
+        return pending;
+    }
+
+    std::vector<ValidationQueueStats> GetQueueStats()
+    {
+        std::vector<ValidationQueueStats> result;
+        LOCK(m_mutex);
+        for (const auto& lane : m_lanes) {
+            ValidationQueueStats stats;
+            stats.name = lane.m_name;
+            stats.registered = lane.m_registered;
+            stats.depth = lane.m_depth;
+            stats.max_depth = lane.m_max_depth;
+            stats.processed = lane.m_processed;
+            stats.busy_time = lane.m_busy_time;
+            result.push_back(stats);
+        }
+        return result;
+    }
 };
 
 static CMainSignals g_signals;
@@ -103,14 +293,20 @@ void CMainSignals::UnregisterBackgroundSignalScheduler()
 void CMainSignals::FlushBackgroundCallbacks()
 {
     if (m_internals) {
-        m_internals->m_schedulerClient.EmptyQueue();
+        m_internals->EmptyQueues();
     }
 }
 
 size_t CMainSignals::CallbacksPending()
 {
     if (!m_internals) return 0;
-    return m_internals->m_schedulerClient.CallbacksPending();
+    return m_internals->CallbacksPending();
+}
+
+std::vector<ValidationQueueStats> CMainSignals::GetQueueStats()
+{
+    if (!m_internals) return {};
+    return m_internals->GetQueueStats();
 }
 
 CMainSignals& GetMainSignals()
@@ -118,18 +314,18 @@ CMainSignals& GetMainSignals()
     return g_signals;
 }
 
-void RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks)
+void RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks, const std::string& queue_name)
 {
     // Each connection captures the shared_ptr to ensure that each callback is
     // executed before the subscriber is destroyed. For more details see #18338.
-    g_signals.m_internals->Register(std::move(callbacks));
+    g_signals.m_internals->Register(std::move(callbacks), queue_name);
 }
 
-void RegisterValidationInterface(CValidationInterface* callbacks)
+void RegisterValidationInterface(CValidationInterface* callbacks, const std::string& queue_name)
 {
     // Create a shared_ptr with a no-op deleter - CValidationInterface lifecycle
     // is managed by the caller.
-    RegisterSharedValidationInterface({callbacks, [](CValidationInterface*){}});
+    RegisterSharedValidationInterface({callbacks, [](CValidationInterface*){}}, queue_name);
 }
 
 void UnregisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks)
@@ -154,7 +350,7 @@ void UnregisterAllValidationInterfaces()
 
 void CallFunctionInValidationInterfaceQueue(std::function<void()> func)
 {
-    g_signals.m_internals->m_schedulerClient.AddToProcessQueue(std::move(func));
+    g_signals.m_internals->EnqueueBarrier(std::move(func));
 }
 
 void SyncWithValidationInterfaceQueue()
@@ -176,10 +372,7 @@ void SyncWithValidationInterfaceQueue()
     do {                                                       \
         auto local_name = (name);                              \
         LOG_EVENT("Enqueuing " fmt, local_name, __VA_ARGS__);  \
-        m_internals->m_schedulerClient.AddToProcessQueue([=] { \
-            LOG_EVENT(fmt, local_name, __VA_ARGS__);           \
-            event();                                           \
-        });                                                    \
+        m_internals->Enqueue(event);                           \
     } while (0)
 
 #define LOG_EVENT(fmt, ...) \
@@ -190,8 +383,8 @@ void CMainSignals::UpdatedBlockTip(const CBlockIndex *pindexNew, const CBlockInd
     // the chain actually updates. One way to ensure this is for the caller to invoke this signal
     // in the same critical section where the chain is updated
 
-    auto event = [pindexNew, pindexFork, fInitialDownload, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.UpdatedBlockTip(pindexNew, pindexFork, fInitialDownload); });
+    auto event = [pindexNew, pindexFork, fInitialDownload](CValidationInterface& callbacks) {
+        callbacks.UpdatedBlockTip(pindexNew, pindexFork, fInitialDownload);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: new block hash=%s fork block hash=%s (in IBD=%s)", __func__,
                           pindexNew->GetBlockHash().ToString(),
@@ -200,8 +393,8 @@ void CMainSignals::UpdatedBlockTip(const CBlockIndex *pindexNew, const CBlockInd
 }
 
 void CMainSignals::TransactionAddedToMempool(const CTransactionRef& tx, uint64_t mempool_sequence) {
-    auto event = [tx, mempool_sequence, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.TransactionAddedToMempool(tx, mempool_sequence); });
+    auto event = [tx, mempool_sequence](CValidationInterface& callbacks) {
+        callbacks.TransactionAddedToMempool(tx, mempool_sequence);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: txid=%s wtxid=%s", __func__,
                           tx->GetHash().ToString(),
@@ -209,8 +402,8 @@ void CMainSignals::TransactionAddedToMempool(const CTransactionRef& tx, uint64_t
 }
 
 void CMainSignals::TransactionRemovedFromMempool(const CTransactionRef& tx, MemPoolRemovalReason reason, uint64_t mempool_sequence) {
-    auto event = [tx, reason, mempool_sequence, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.TransactionRemovedFromMempool(tx, reason, mempool_sequence); });
+    auto event = [tx, reason, mempool_sequence](CValidationInterface& callbacks) {
+        callbacks.TransactionRemovedFromMempool(tx, reason, mempool_sequence);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: txid=%s wtxid=%s", __func__,
                           tx->GetHash().ToString(),
@@ -218,8 +411,8 @@ void CMainSignals::TransactionRemovedFromMempool(const CTransactionRef& tx, MemP
 }
 
 void CMainSignals::BlockConnected(const std::shared_ptr<const CBlock> &pblock, const CBlockIndex *pindex) {
-    auto event = [pblock, pindex, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.BlockConnected(pblock, pindex); });
+    auto event = [pblock, pindex](CValidationInterface& callbacks) {
+        callbacks.BlockConnected(pblock, pindex);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: block hash=%s block height=%d", __func__,
                           pblock->GetHash().ToString(),
@@ -228,8 +421,8 @@ void CMainSignals::BlockConnected(const std::shared_ptr<const CBlock> &pblock, c
 
 void CMainSignals::BlockDisconnected(const std::shared_ptr<const CBlock>& pblock, const CBlockIndex* pindex)
 {
-    auto event = [pblock, pindex, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.BlockDisconnected(pblock, pindex); });
+    auto event = [pblock, pindex](CValidationInterface& callbacks) {
+        callbacks.BlockDisconnected(pblock, pindex);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: block hash=%s block height=%d", __func__,
                           pblock->GetHash().ToString(),
@@ -237,8 +430,8 @@ void CMainSignals::BlockDisconnected(const std::shared_ptr<const CBlock>& pblock
 }
 
 void CMainSignals::ChainStateFlushed(const CBlockLocator &locator) {
-    auto event = [locator, this] {
-        m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.ChainStateFlushed(locator); });
+    auto event = [locator](CValidationInterface& callbacks) {
+        callbacks.ChainStateFlushed(locator);
     };
     ENQUEUE_AND_LOG_EVENT(event, "%s: block hash=%s", __func__,
                           locator.IsNull() ? "null" : locator.vHave.front().ToString());
@@ -255,10 +448,14 @@ void CMainSignals::NewPoWValidBlock(const CBlockIndex *pindex, const std::shared
     m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.NewPoWValidBlock(pindex, block); });
 }
 
-void CMainSignals::TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx) {
-    m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.TransactionAddedToWallet(sWalletName, tx); });
+void CMainSignals::TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx, const std::string &record) {
+    m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.TransactionAddedToWallet(sWalletName, tx, record); });
+}
+
+void CMainSignals::NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to) {
+    m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.NewSecureMessage(psmsg, hash, address_to); });
 }
 
-void CMainSignals::NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash) {
-    m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.NewSecureMessage(psmsg, hash); });
+void CMainSignals::StealthOutputFound(const uint256 &key_id, const StealthScanMatch &match) {
+    m_internals->Iterate([&](CValidationInterface& callbacks) { callbacks.StealthOutputFound(key_id, match); });
 }
@@ -11,6 +11,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 extern RecursiveMutex cs_main;
 class BlockValidationState;
@@ -18,17 +20,19 @@ class CBlock;
 class CBlockIndex;
 struct CBlockLocator;
 class CConnman;
+class CKeyID;
 class CValidationInterface;
 class uint256;
 class CScheduler;
 enum class MemPoolRemovalReason;
+struct StealthScanMatch;
 
 namespace smsg {
 class SecureMessage;
 }
 
-/** Register subscriber */
-void RegisterValidationInterface(CValidationInterface* callbacks);
+/** Register subscriber, queue_name labels its notification queue in the queue stats */
+void RegisterValidationInterface(CValidationInterface* callbacks, const std::string& queue_name = "");
 /** Unregister subscriber. DEPRECATED. This is not safe to use when the RPC server or main message handler thread is running. */
 void UnregisterValidationInterface(CValidationInterface* callbacks);
 /** Unregister all subscribers */
@@ -39,13 +43,15 @@ void UnregisterAllValidationInterfaces();
 // unregistration is nonblocking and can return before the last notification is
 // processed.
 /** Register subscriber */
-void RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks);
+void RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks, const std::string& queue_name = "");
 /** Unregister subscriber */
 void UnregisterSharedValidationInterface(std::shared_ptr<CValidationInterface> callbacks);
 
 /**
- * Pushes a function to callback onto the notification queue, guaranteeing any
+ * Pushes a function to callback onto the notification queues, guaranteeing any
  * callbacks generated prior to now are finished when the function is called.
+ * Subscribers each have their own queue, so callbacks generated after may
+ * already be running on the queues that were ahead.
  *
  * Be very careful blocking on func to be called if any locks are held -
  * validation interface clients may not be able to make progress as they often
@@ -178,18 +184,32 @@ protected:
      * has been received and connected to the headers tree, though not validated yet */
     virtual void NewPoWValidBlock(const CBlockIndex *pindex, const std::shared_ptr<const CBlock>& block) {};
 
-    virtual void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx) {};
-    virtual void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash) {};
+    /** record is the serialized wallet record of tx, empty when the wallet keeps none */
+    virtual void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx, const std::string &record) {};
+    /** psmsg carries the payload when it's known, address_to is the receiving address */
+    virtual void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to) {};
+    /** An output paying the scan key registered as key_id was found by the stealth scan server */
+    virtual void StealthOutputFound(const uint256 &key_id, const StealthScanMatch &match) {};
 
     friend class CMainSignals;
 };
 
+/** Depth and timing of one subscriber's notification queue */
+struct ValidationQueueStats {
+    std::string name;
+    bool registered{false};
+    size_t depth{0};        // Notifications queued or running
+    size_t max_depth{0};    // Deepest the queue has been since the subscriber registered
+    uint64_t processed{0};
+    int64_t busy_time{0};   // Microseconds spent in the subscriber's callbacks
+};
+
 struct MainSignalsInstance;
 class CMainSignals {
 private:
     std::unique_ptr<MainSignalsInstance> m_internals;
 
-    friend void ::RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface>);
+    friend void ::RegisterSharedValidationInterface(std::shared_ptr<CValidationInterface>, const std::string&);
     friend void ::UnregisterValidationInterface(CValidationInterface*);
     friend void ::UnregisterAllValidationInterfaces();
     friend void ::CallFunctionInValidationInterfaceQueue(std::function<void ()> func);
@@ -202,7 +222,9 @@ public:
     /** Call any remaining callbacks on the calling thread */
     void FlushBackgroundCallbacks();
 
+    /** Notifications waiting in the deepest subscriber queue */
     size_t CallbacksPending();
+    std::vector<ValidationQueueStats> GetQueueStats();
 
 
     void UpdatedBlockTip(const CBlockIndex *, const CBlockIndex *, bool fInitialDownload);
@@ -214,8 +236,9 @@ public:
     void BlockChecked(const CBlock&, const BlockValidationState&);
     void NewPoWValidBlock(const CBlockIndex *, const std::shared_ptr<const CBlock>&);
 
-    void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx);
-    void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash);
+    void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx, const std::string &record);
+    void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to);
+    void StealthOutputFound(const uint256 &key_id, const StealthScanMatch &match);
 };
 
 CMainSignals& GetMainSignals();
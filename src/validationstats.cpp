@@ -0,0 +1,123 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <validationstats.h>
+
+#include <util/trace.h>
+
+ValidationStats g_validation_stats;
+
+const char* ValidationStageName(ValidationStage stage)
+{
+    switch (stage) {
+    case ValidationStage::SANITY_CHECKS: return "sanity_checks";
+    case ValidationStage::FORK_CHECKS: return "fork_checks";
+    case ValidationStage::CONNECT_TRANSACTIONS: return "connect_transactions";
+    case ValidationStage::SMSG_FUNDING: return "smsg_funding";
+    case ValidationStage::ANON_CHECKS: return "anon_checks";
+    case ValidationStage::RANGEPROOF_CHECKS: return "rangeproof_checks";
+    case ValidationStage::VERIFY_WAIT: return "verify_wait";
+    case ValidationStage::TREASURY: return "treasury";
+    case ValidationStage::GVR_ELIGIBILITY: return "gvr_eligibility";
+    case ValidationStage::COLD_REWARD: return "cold_reward";
+    case ValidationStage::INDEX_WRITING: return "index_writing";
+    case ValidationStage::INSIGHT_INDEX: return "insight_index";
+    case ValidationStage::COUNT: break;
+    }
+    return "unknown";
+}
+
+const char* ValidationBlockKindName(ValidationBlockKind kind)
+{
+    switch (kind) {
+    case ValidationBlockKind::PLAIN: return "plain";
+    case ValidationBlockKind::PRIVATE: return "private";
+    case ValidationBlockKind::COUNT: break;
+    }
+    return "unknown";
+}
+
+void ValidationStats::StartBlock()
+{
+    LOCK(m_mutex);
+    for (int i = 0; i < (int)ValidationStage::COUNT; ++i) {
+        m_pending_micros[i] = 0;
+        m_pending_items[i] = 0;
+        m_async_micros[i] = 0;
+        m_async_items[i] = 0;
+    }
+    m_pending_kind = ValidationBlockKind::PLAIN;
+}
+
+void ValidationStats::Add(ValidationStage stage, int64_t micros, uint64_t items)
+{
+    TRACE3(validation, stage, ValidationStageName(stage), micros, items);
+    LOCK(m_mutex);
+    m_pending_micros[(int)stage] += micros;
+    m_pending_items[(int)stage] += items;
+}
+
+void ValidationStats::AddAsync(ValidationStage stage, int64_t micros)
+{
+    TRACE2(validation, stage_async, ValidationStageName(stage), micros);
+    m_async_micros[(int)stage] += micros;
+    m_async_items[(int)stage]++;
+}
+
+void ValidationStats::SetBlockKind(ValidationBlockKind kind)
+{
+    LOCK(m_mutex);
+    m_pending_kind = kind;
+}
+
+void ValidationStats::FinishBlock()
+{
+    LOCK(m_mutex);
+    for (int i = 0; i < (int)ValidationStage::COUNT; ++i) {
+        const int64_t micros = m_pending_micros[i] + m_async_micros[i].exchange(0);
+        const uint64_t items = m_pending_items[i] + m_async_items[i].exchange(0);
+        m_pending_micros[i] = 0;
+        m_pending_items[i] = 0;
+        if (items == 0) {
+            // The stage didn't run for this block
+            continue;
+        }
+        Stage& stage = m_stages[(int)m_pending_kind][i];
+        stage.blocks++;
+        stage.items += items;
+        stage.total_micros += micros;
+        if (stage.window.size() < VALIDATION_STATS_WINDOW) {
+            stage.window.push_back(micros);
+        } else {
+            stage.window[stage.next] = micros;
+            stage.next = (stage.next + 1) % VALIDATION_STATS_WINDOW;
+        }
+    }
+    m_pending_kind = ValidationBlockKind::PLAIN;
+}
+
+std::vector<ValidationStats::StageStats> ValidationStats::GetStats(ValidationBlockKind kind)
+{
+    LOCK(m_mutex);
+    std::vector<StageStats> stats((int)ValidationStage::COUNT);
+    for (int i = 0; i < (int)ValidationStage::COUNT; ++i) {
+        const Stage& stage = m_stages[(int)kind][i];
+        stats[i].blocks = stage.blocks;
+        stats[i].items = stage.items;
+        stats[i].total_micros = stage.total_micros;
+        stats[i].window.assign(stage.window.begin() + stage.next, stage.window.end());
+        stats[i].window.insert(stats[i].window.end(), stage.window.begin(), stage.window.begin() + stage.next);
+    }
+    return stats;
+}
+
+void ValidationStats::Reset()
+{
+    LOCK(m_mutex);
+    for (auto& stages : m_stages) {
+        for (auto& stage : stages) {
+            stage = Stage();
+        }
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_VALIDATIONSTATS_H
+#define BITCOIN_VALIDATIONSTATS_H
+
+#include <sync.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/** Stages of connecting a block timed for getvalidationstats */
+enum class ValidationStage {
+    SANITY_CHECKS,
+    FORK_CHECKS,
+    CONNECT_TRANSACTIONS,
+    SMSG_FUNDING,
+    ANON_CHECKS,       //!< MLSAG checks run through the script check queue
+    RANGEPROOF_CHECKS, //!< Rangeproof checks run through the script check queue
+    VERIFY_WAIT,       //!< Waiting for the script check queue
+    TREASURY,
+    GVR_ELIGIBILITY,
+    COLD_REWARD,
+    INDEX_WRITING,
+    INSIGHT_INDEX,
+    COUNT
+};
+
+/** Blocks are sampled apart by whether they hold CT or RingCT transactions */
+enum class ValidationBlockKind {
+    PLAIN,
+    PRIVATE,
+    COUNT
+};
+
+/** Number of recent blocks each stage keeps samples of */
+static const size_t VALIDATION_STATS_WINDOW = 1000;
+
+const char* ValidationStageName(ValidationStage stage);
+const char* ValidationBlockKindName(ValidationBlockKind kind);
+
+/**
+ * Time spent in each stage of connecting a block. Stage times are gathered
+ * while a block connects and kept as one sample per stage once it's on the
+ * chain, failed and test blocks are dropped.
+ */
+class ValidationStats
+{
+public:
+    struct StageStats {
+        //! Blocks and items (transactions, checks, ...) seen by the stage since startup
+        uint64_t blocks{0};
+        uint64_t items{0};
+        int64_t total_micros{0};
+        //! Times of the last VALIDATION_STATS_WINDOW blocks, oldest first
+        std::vector<int64_t> window;
+    };
+
+    /** Drop the times gathered for a block that didn't connect. */
+    void StartBlock();
+    /** Add time spent by a stage of the connecting block. */
+    void Add(ValidationStage stage, int64_t micros, uint64_t items = 1);
+    /** Add time spent on the script check threads, safe from any thread. */
+    void AddAsync(ValidationStage stage, int64_t micros);
+    void SetBlockKind(ValidationBlockKind kind);
+    /** Keep the gathered times as samples of a connected block. */
+    void FinishBlock();
+
+    std::vector<StageStats> GetStats(ValidationBlockKind kind);
+    void Reset();
+
+private:
+    struct Stage {
+        uint64_t blocks{0};
+        uint64_t items{0};
+        int64_t total_micros{0};
+        std::vector<int64_t> window;
+        size_t next{0};
+    };
+
+    Mutex m_mutex;
+    Stage m_stages[(int)ValidationBlockKind::COUNT][(int)ValidationStage::COUNT] GUARDED_BY(m_mutex);
+    int64_t m_pending_micros[(int)ValidationStage::COUNT] GUARDED_BY(m_mutex){};
+    uint64_t m_pending_items[(int)ValidationStage::COUNT] GUARDED_BY(m_mutex){};
+    ValidationBlockKind m_pending_kind GUARDED_BY(m_mutex){ValidationBlockKind::PLAIN};
+
+    std::atomic<int64_t> m_async_micros[(int)ValidationStage::COUNT]{};
+    std::atomic<uint64_t> m_async_items[(int)ValidationStage::COUNT]{};
+};
+
+extern ValidationStats g_validation_stats;
+
+#endif // BITCOIN_VALIDATIONSTATS_H
@@ -170,6 +170,87 @@ bool SelectCoinsBnB(std::vector<OutputGroup>& utxo_pool, const CAmount& target_v
     return true;
 }
 
+bool SelectValuesBnB(const std::vector<CAmount>& effective_values, const CAmount& target_value, const CAmount& cost_of_change, std::vector<size_t>& selected)
+{
+    selected.clear();
+
+    std::vector<size_t> order;
+    order.reserve(effective_values.size());
+    CAmount curr_available_value = 0;
+    for (size_t i = 0; i < effective_values.size(); ++i) {
+        if (effective_values[i] <= 0) {
+            continue;
+        }
+        order.push_back(i);
+        curr_available_value += effective_values[i];
+    }
+    if (curr_available_value < target_value) {
+        return false;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return effective_values[a] > effective_values[b];
+    });
+
+    CAmount curr_value = 0;
+    std::vector<bool> curr_selection;
+    curr_selection.reserve(order.size());
+    std::vector<bool> best_selection;
+    CAmount best_waste = MAX_MONEY;
+
+    for (size_t i = 0; i < TOTAL_TRIES; ++i) {
+        bool backtrack = false;
+        if (curr_value + curr_available_value < target_value ||
+            curr_value > target_value + cost_of_change) {
+            backtrack = true;
+        } else if (curr_value >= target_value) {
+            const CAmount curr_waste = curr_value - target_value;
+            if (curr_waste <= best_waste) {
+                best_selection = curr_selection;
+                best_selection.resize(order.size());
+                best_waste = curr_waste;
+                if (best_waste == 0) {
+                    break;
+                }
+            }
+            backtrack = true;
+        }
+
+        if (backtrack) {
+            while (!curr_selection.empty() && !curr_selection.back()) {
+                curr_selection.pop_back();
+                curr_available_value += effective_values[order[curr_selection.size()]];
+            }
+            if (curr_selection.empty()) {
+                break;
+            }
+            curr_selection.back() = false;
+            curr_value -= effective_values[order[curr_selection.size() - 1]];
+        } else {
+            const CAmount value = effective_values[order[curr_selection.size()]];
+            curr_available_value -= value;
+
+            // Skip including a value equal to the omitted one before it, that branch was searched
+            if (!curr_selection.empty() && !curr_selection.back() &&
+                value == effective_values[order[curr_selection.size() - 1]]) {
+                curr_selection.push_back(false);
+            } else {
+                curr_selection.push_back(true);
+                curr_value += value;
+            }
+        }
+    }
+
+    if (best_selection.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < best_selection.size(); ++i) {
+        if (best_selection[i]) {
+            selected.push_back(order[i]);
+        }
+    }
+    return true;
+}
+
 static void ApproximateBestSubset(const std::vector<OutputGroup>& groups, const CAmount& nTotalLower, const CAmount& nTargetValue,
                                   std::vector<char>& vfBest, CAmount& nBest, int iterations = 1000)
 {
@@ -117,6 +117,13 @@ struct OutputGroup
 
 bool SelectCoinsBnB(std::vector<OutputGroup>& utxo_pool, const CAmount& target_value, const CAmount& cost_of_change, std::set<CInputCoin>& out_set, CAmount& value_ret, CAmount not_input_fees);
 
+/**
+ * Branch and bound over plain effective values, for the blinded and anon outputs of the wallet
+ * which aren't CInputCoins. The same search as SelectCoinsBnB with the waste taken as the excess
+ * over target_value. selected is set to the indices of the chosen values.
+ */
+bool SelectValuesBnB(const std::vector<CAmount>& effective_values, const CAmount& target_value, const CAmount& cost_of_change, std::vector<size_t>& selected);
+
 // Original coin selection algorithm as a fallback
 bool KnapsackSolver(const CAmount& nTargetValue, std::vector<OutputGroup>& groups, std::set<CInputCoin>& setCoinsRet, CAmount& nValueRet);
 
@@ -8,6 +8,7 @@
 #include <crypto/hmac_sha512.h>
 #include <crypto/sha256.h>
 
+#include <memusage.h>
 #include <random.h>
 #include <validation.h>
 #include <consensus/validation.h>
@@ -19,6 +20,8 @@
 #include <pos/kernel.h>
 #include <pos/miner.h>
 #include <util/moneystr.h>
+#include <util/taskpool.h>
+#include <util/trace.h>
 #include <util/translation.h>
 #include <script/script.h>
 #include <script/standard.h>
@@ -47,6 +50,11 @@
 #include <secp256k1_mlsag.h>
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <set>
 #include <thread>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -74,18 +82,6 @@ static uint8_t GetOutputType(const COutPoint &prevout)
     return 0;
 }
 
-static bool ExtractStealthPrefix(const std::vector<uint8_t> &vData, uint32_t &prefix, size_t offset = 33)
-{
-    prefix = 0;
-    if (vData.size() >= offset + 5 // Have prefix
-        && vData[offset] == DO_STEALTH_PREFIX) {
-        memcpy(&prefix, &vData[offset + 1], 4);
-        prefix = le32toh(prefix);
-        return true;
-    }
-    return false;
-}
-
 int CHDWallet::Finalise()
 {
     LOCK(cs_wallet);
@@ -93,11 +89,6 @@ int CHDWallet::Finalise()
 
     FreeExtKeyMaps();
     m_address_book.clear();
-
-    if (m_blind_scratch) {
-        secp256k1_scratch_space_destroy(secp256k1_ctx_blind, m_blind_scratch);
-        m_blind_scratch = nullptr;
-    }
     return 0;
 };
 
@@ -121,6 +112,7 @@ int CHDWallet::FreeExtKeyMaps()
 
     mapLooseKeys.clear();
     mapLooseLookAhead.clear();
+    m_loose_key_filter.Clear();
 
     return 0;
 };
@@ -131,11 +123,15 @@ void CHDWallet::AddOptions(ArgsManager& argsman)
     argsman.AddArg("-stealthv1lookaheadsize=<n>", strprintf("Number of V1 stealth keys to look ahead during a rescan. (default: %u)", DEFAULT_STEALTH_LOOKAHEAD_SIZE), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
     argsman.AddArg("-stealthv2lookaheadsize=<n>", strprintf("Number of V2 stealth keys to look ahead during a rescan. (default: %u)", DEFAULT_STEALTH_LOOKAHEAD_SIZE), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
     argsman.AddArg("-extkeysaveancestors", strprintf("On saving a key from the lookahead pool, save all unsaved keys leading up to it too. (default: %s)", "true"), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
+    argsman.AddArg("-walletloadthreads=<n>", strprintf("Number of threads used to deserialise transaction records and derive lookahead keys when loading a wallet (up to %d, 0 = auto, <0 = leave that many cores free, default: %d)", MAX_WALLET_LOAD_THREADS, DEFAULT_WALLET_LOAD_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
+    argsman.AddArg("-walletgroupcommit=<n>", strprintf("Write the transaction records found in a connected block in one database transaction, committing early once <n> records are pending. 0 writes each record on its own. (default: %u)", DEFAULT_WALLET_GROUP_COMMIT), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
     argsman.AddArg("-createdefaultmasterkey", strprintf("Generate a random master key and main account if no master key exists. (default: %s)", "false"), ArgsManager::ALLOW_ANY, OptionsCategory::PART_WALLET);
 
     argsman.AddArg("-staking", "Stake your coins to support network and gain reward (default: true)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
-    argsman.AddArg("-stakingthreads", "Number of threads to start for staking, max 1 per active wallet, will divide wallets evenly between threads (default: 1)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
+    argsman.AddArg("-stakingthreads", "Number of threads to start for staking, idle threads take the next wallet due a search (default: 1)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
+    argsman.AddArg("-stakingkernelthreads=<n>", strprintf("Number of threads checking the kernels of a wallet's coins, including the staking thread, 0 = one per core, max %d (default: %d)", MAX_STAKING_KERNEL_THREADS, DEFAULT_STAKING_KERNEL_THREADS), ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
     argsman.AddArg("-stakethreadconddelayms", "Number of milliseconds to delay staking for on error condition (default: 60000)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
+    argsman.AddArg("-coldstakingpool", "Keep the cold staking outputs this wallet stakes summed per delegator, listed by listcoldstakingdelegators (default: false)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
     argsman.AddArg("-minstakeinterval=<n>", "Minimum time in seconds between successful stakes (default: 0)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
     argsman.AddArg("-minersleep=<n>", "Milliseconds between stake attempts. Lowering this param will not result in more stakes. (default: 500)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
     argsman.AddArg("-reservebalance=<amount>", "Ensure available balance remains above reservebalance. (default: 0)", ArgsManager::ALLOW_ANY, OptionsCategory::PART_STAKING);
@@ -166,6 +162,7 @@ bool CHDWallet::ProcessStakingSettings(std::string &sError)
     nStakeCombineThreshold = 1000 * COIN;
     nStakeSplitThreshold = 2000 * COIN;
     m_min_stakeable_value = 1;
+    m_have_stake_candidates = false;
     nMaxStakeCombine = 3;
     nWalletTreasuryFundCedePercent = gArgs.GetArg("-treasurydonationpercent", 0);
     m_reward_address = CNoDestination();
@@ -750,6 +747,36 @@ bool CHDWallet::GetVote(int nHeight, uint32_t &token)
     return false;
 };
 
+int GetWalletLoadThreads()
+{
+    int n_threads = gArgs.GetArg("-walletloadthreads", DEFAULT_WALLET_LOAD_THREADS);
+    if (n_threads <= 0) {
+        n_threads += GetNumCores();
+    }
+    return std::max(1, std::min(n_threads, MAX_WALLET_LOAD_THREADS));
+}
+
+/** Run fn(i) for i in [0, n), spread over up to max_threads threads including the caller */
+static void WalletParallelFor(size_t n, int max_threads, const char *thread_name, const std::function<void(size_t)> &fn)
+{
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        size_t i;
+        while ((i = next++) < n) {
+            fn(i);
+        }
+    };
+    const int n_threads = std::min<int>(std::min(GetNumCores(), max_threads), n);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < n_threads; ++i) {
+        threads.emplace_back([&worker, thread_name]() { TraceThread(thread_name, worker); });
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+};
+
 bool CHDWallet::LoadTxRecords(CHDWalletDB *pwdb)
 {
     LogPrint(BCLog::HDWALLET, "Loading transaction records for %s.\n", GetName());
@@ -768,6 +795,44 @@ bool CHDWallet::LoadTxRecords(CHDWalletDB *pwdb)
     std::string strType, sPrefix = "rtx";
     uint256 txhash;
 
+    // The cursor is read sequentially, records are deserialised in batches
+    // across the load threads and inserted in cursor order.
+    const int n_threads = GetWalletLoadThreads();
+    std::vector<std::pair<uint256, CDataStream> > raw;
+    std::vector<CTransactionRecord> records;
+    auto DeserialiseBatch = [&]() {
+        records.clear();
+        records.resize(raw.size());
+        std::atomic<size_t> next{0};
+        std::atomic<bool> fAbort{false};
+        auto worker = [&]() {
+            size_t i;
+            while (!fAbort && (i = next++) < raw.size()) {
+                try {
+                    raw[i].second >> records[i];
+                } catch (const std::exception &e) {
+                    WalletLogPrintf("%s: Unable to read record %s: %s\n", __func__, raw[i].first.ToString(), e.what());
+                    fAbort = true;
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int i = 1; i < std::min<int>(n_threads, raw.size() / 64 + 1); ++i) {
+            threads.emplace_back([&worker]() { TraceThread("walletload", worker); });
+        }
+        worker();
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        if (fAbort) {
+            throw std::runtime_error(strprintf("%s: cannot deserialise transaction record", __func__).c_str());
+        }
+        for (size_t i = 0; i < raw.size(); ++i) {
+            LoadToWallet(raw[i].first, records[i]);
+        }
+        raw.clear();
+    };
+
     unsigned int fFlags = DB_SET_RANGE;
     ssKey << sPrefix;
     while (pwdb->ReadAtCursor(pcursor, ssKey, ssValue, fFlags) == 0) {
@@ -778,9 +843,13 @@ bool CHDWallet::LoadTxRecords(CHDWalletDB *pwdb)
         }
 
         ssKey >> txhash;
-        CTransactionRecord data;
-        ssValue >> data;
-        LoadToWallet(txhash, data);
+        raw.emplace_back(txhash, ssValue);
+        if (raw.size() >= WALLET_LOAD_BATCH_SIZE) {
+            DeserialiseBatch();
+        }
+    }
+    if (!raw.empty()) {
+        DeserialiseBatch();
     }
 
     pcursor->close();
@@ -1009,7 +1078,8 @@ bool CHDWallet::Unlock(const SecureString &strWalletPassphrase, bool accept_no_k
             if (!CWallet::Unlock(vMasterKeyNew, true)) {
                 return false;
             }
-            if (0 != ExtKeyUnlock(vMasterKeyNew)) {
+            // Only the keys needed to stake and receive are decrypted here, ProcessLockedExtKeys does the rest
+            if (0 != ExtKeyUnlockDefault(vMasterKeyNew)) {
                 if (fWasUnlocked) {
                     CWallet::Unlock(vMasterKeyOld, true);
                 }
@@ -1025,10 +1095,9 @@ bool CHDWallet::Unlock(const SecureString &strWalletPassphrase, bool accept_no_k
         if (fWasUnlocked) {
             return true;
         }
-
-        ProcessLockedStealthOutputs();
-        ProcessLockedBlindedOutputs();
     }
+    ProcessLockedExtKeys();
+    ProcessLockedOutputs();
     smsgModule.WalletUnlocked(this);
 
     WakeThreadStakeMiner(this);
@@ -1106,6 +1175,11 @@ isminetype CHDWallet::HaveKey(const CKeyID &address, const CEKAKey *&pak, const
         return ismine;
     }
 
+    if (!MayHaveLooseKey(address)) {
+        pa = nullptr;
+        return CWallet::IsMine(address);
+    }
+
     auto itl = mapLooseLookAhead.find(address);
     if (itl != mapLooseLookAhead.end()) {
         auto itek = mapExtKeys.find(itl->second.chain_id);
@@ -1138,6 +1212,29 @@ isminetype CHDWallet::HaveKey(const CKeyID &address, const CEKAKey *&pak, const
     return CWallet::IsMine(address);
 };
 
+bool CHDWallet::MayHaveLooseKey(const CKeyID &id) const
+{
+    AssertLockHeld(cs_wallet);
+
+    if (!m_loose_key_filter.IsValid() || m_loose_key_filter.IsFull()) {
+        m_loose_key_filter.Init((mapLooseKeys.size() + mapLooseLookAhead.size()) * 2 + 1024);
+        for (const auto &mi : mapLooseKeys) {
+            m_loose_key_filter.Insert(mi.first);
+        }
+        for (const auto &mi : mapLooseLookAhead) {
+            m_loose_key_filter.Insert(mi.first);
+        }
+    }
+    return m_loose_key_filter.MayContain(id);
+};
+
+void CHDWallet::AddToLooseKeyFilter(const CKeyID &id) const
+{
+    if (m_loose_key_filter.IsValid()) {
+        m_loose_key_filter.Insert(id);
+    }
+};
+
 isminetype CHDWallet::IsMine(const CKeyID &address) const
 {
     LOCK(cs_wallet);
@@ -1203,7 +1300,7 @@ bool CHDWallet::GetTransaction(const uint256 &txhash, CTransactionRef &tx) const
     const auto mri = mapRecords.find(txhash);
     if (mri != mapRecords.end()) {
         CStoredTransaction stx;
-        if (!CHDWalletDB(*database).ReadStoredTx(txhash, stx)) {
+        if (!ReadStoredTx(txhash, stx)) {
             WalletLogPrintf("%s: ReadStoredTx failed for %s.\n", __func__, txhash.ToString());
             return false;
         }
@@ -1515,6 +1612,8 @@ DBErrors CHDWallet::LoadWallet(bool& fFirstRunRet)
     m_rescan_stealth_v1_lookahead = gArgs.GetArg("-stealthv1lookaheadsize", DEFAULT_STEALTH_LOOKAHEAD_SIZE);
     m_rescan_stealth_v2_lookahead = gArgs.GetArg("-stealthv2lookaheadsize", DEFAULT_STEALTH_LOOKAHEAD_SIZE);
     m_default_lookahead = gArgs.GetArg("-defaultlookaheadsize", DEFAULT_LOOKAHEAD_SIZE);
+    m_cold_staking_pool = gArgs.GetBoolArg("-coldstakingpool", false);
+    m_group_commit_size = std::max(gArgs.GetArg("-walletgroupcommit", DEFAULT_WALLET_GROUP_COMMIT), (int64_t)0);
 
     std::string sError;
     ProcessStakingSettings(sError);
@@ -1522,6 +1621,7 @@ DBErrors CHDWallet::LoadWallet(bool& fFirstRunRet)
 
     LoadMasterKeys();
 
+    int64_t nStartTime = GetTimeMillis();
     {
         // Prepare extended keys
         ExtKeyLoadMaster();
@@ -1531,6 +1631,7 @@ DBErrors CHDWallet::LoadWallet(bool& fFirstRunRet)
         LoadStealthAddresses();
         PrepareLookahead(); // Must happen after ExtKeyLoadAccountPacks
     }
+    const int64_t nKeysTime = GetTimeMillis() - nStartTime;
 
     auto rv = CWallet::LoadWallet(fFirstRunRet);
     if (pEKMaster || !idDefaultAccount.IsNull()) {
@@ -1544,11 +1645,6 @@ DBErrors CHDWallet::LoadWallet(bool& fFirstRunRet)
     auto spk_man = GetOrCreateLegacyScriptPubKeyMan();
     assert(spk_man);
 
-    if (secp256k1_ctx_blind) {
-        m_blind_scratch = secp256k1_scratch_space_create(secp256k1_ctx_blind, 1024 * 1024);
-        assert(m_blind_scratch);
-    }
-
     PostProcessUnloadSpent();
 
     LOCK(cs_wallet);
@@ -1557,9 +1653,13 @@ DBErrors CHDWallet::LoadWallet(bool& fFirstRunRet)
         CHDWalletDB wdb(GetDBHandle());
 
         LoadAddressBook(&wdb);
+        nStartTime = GetTimeMillis();
         LoadTxRecords(&wdb);
+        WalletLogPrintf("Loaded keys in %dms, %u transaction records in %dms using %d threads.\n",
+            nKeysTime, mapRecords.size(), GetTimeMillis() - nStartTime, GetWalletLoadThreads());
         LoadVoteTokens(&wdb);
     }
+    m_have_used_destinations = false; // Rebuilt on the next IsSpentKey from the loaded destdata
 
     if (!pEKMaster) {
         if (gArgs.GetBoolArg("-createdefaultmasterkey", false)) {
@@ -2380,7 +2480,7 @@ CAmount CHDWallet::GetOutputValue(const COutPoint &op, bool fAllowTXIndex) const
             return rec->nValue;
         }
         CStoredTransaction stx;
-        if (!CHDWalletDB(*database).ReadStoredTx(op.hash, stx)) { // TODO: cache / use mapTempWallet
+        if (!ReadStoredTx(op.hash, stx)) { // TODO: cache / use mapTempWallet
             WalletLogPrintf("%s: ReadStoredTx failed for %s.\n", __func__, op.hash.ToString());
             return 0;
         }
@@ -2504,116 +2604,372 @@ bool CHDWallet::IsTrusted(const uint256 &txhash, const CTransactionRecord &rtx,
     return true;
 };
 
-CAmount CHDWallet::GetSpendableBalance() const
+CHDWallet::CachedTxBalance &CHDWallet::CachedTxBalance::operator+=(const CachedTxBalance &b)
 {
-    // Returns a value to be compared against reservebalance, includes stakeable watch-only balance.
-    if (m_have_spendable_balance_cached) {
-        return m_spendable_balance_cached;
-    }
+    bal += b.bal;
+    nSpendable += b.nSpendable;
+    nBlind += b.nBlind;
+    nAnon += b.nAnon;
+    return *this;
+};
 
-    CAmount nBalance = 0;
+CHDWallet::CachedTxBalance &CHDWallet::CachedTxBalance::operator-=(const CachedTxBalance &b)
+{
+    bal -= b.bal;
+    nSpendable -= b.nSpendable;
+    nBlind -= b.nBlind;
+    nAnon -= b.nAnon;
+    return *this;
+};
 
-    LOCK(cs_wallet);
+bool CHDWallet::GetTxBalance(const CWalletTx &wtx, CachedTxBalance &tb, bool avoid_reuse) const
+{
+    isminefilter reuse_filter = avoid_reuse ? 0 : ISMINE_USED;
+    CHDWalletBalances &bal = tb.bal;
 
-    for (const auto &ri : mapRecords) {
-        const auto &txhash = ri.first;
-        const auto &rtx = ri.second;
-        if (!IsTrusted(txhash, rtx)) {
-            continue;
-        }
+    bal.nPartImmature += wtx.GetImmatureCredit();
+    //bal.nPartWatchOnlyImmature += wtx.GetImmatureWatchOnlyCredit(*locked_chain);
 
-        for (const auto &r : rtx.vout) {
-            if (r.nType == OUTPUT_STANDARD
-                && (r.nFlags & ORF_OWNED || r.nFlags & ORF_STAKEONLY)
-                && !IsSpent(txhash, r.n)) {
-                nBalance += r.nValue;
+    int depth = wtx.GetDepthInMainChain();
+    bool fImmature = depth > 0 && wtx.GetBlocksToMaturity() > 0;
+    if (wtx.IsCoinStake() && fImmature) {
+        CAmount nSpendable, nWatchOnly;
+        CHDWallet::GetCredit(*wtx.tx, nSpendable, nWatchOnly);
+        bal.nPartStaked += nSpendable;
+        bal.nPartWatchOnlyStaked += nWatchOnly;
+    }
+
+    if (wtx.IsTrusted()) {
+        bal.nPart += wtx.GetAvailableCredit(true, ISMINE_SPENDABLE | reuse_filter);
+        bal.nPartWatchOnly += wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY | reuse_filter);
+
+        // Spendable balance includes stakeable watch-only outputs
+        tb.nSpendable += wtx.GetAvailableCredit();
+        if (wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY) > 0) {
+            for (unsigned int i = 0; i < wtx.tx->GetNumVOuts(); i++) {
+                if (!IsSpent(wtx.GetHash(), i)) {
+                    tb.nSpendable += GetCredit(wtx.tx->vpout[i].get(), ISMINE_WATCH_COLDSTAKE);
+                }
             }
         }
+    } else if (depth == 0 && wtx.InMempool()) {
+        bal.nPartUnconf += wtx.GetAvailableCredit(true, ISMINE_SPENDABLE | reuse_filter);
+        bal.nPartWatchOnlyUnconf += wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY | reuse_filter);
+    }
 
-        if (!MoneyRange(nBalance)) {
-            throw std::runtime_error(std::string(__func__) + ": value out of range");
+    return fImmature || (depth == 0 && !wtx.isAbandoned());
+};
+
+bool CHDWallet::GetTxBalance(const uint256 &txhash, const CTransactionRecord &rtx, CachedTxBalance &tb, bool avoid_reuse) const
+{
+    bool allow_used_addresses = !IsWalletFlagSet(WALLET_FLAG_AVOID_REUSE) || (!avoid_reuse);
+    const Consensus::Params &consensusParams = Params().GetConsensus();
+    CHDWalletBalances &bal = tb.bal;
+
+    int depth;
+    bool fTrusted = IsTrusted(txhash, rtx, &depth);
+    bool fInMempool = false;
+    if (!fTrusted) {
+        CTransactionRef ptx = nullptr;
+        if (HaveChain()) {
+            ptx = chain().transactionFromMempool(txhash);
         }
+        fInMempool = !ptx ? false : true;
     }
 
-    for (const auto &walletEntry : mapWallet) {
-        const auto &wtx = walletEntry.second;
-        if (!wtx.IsTrusted()) {
+    for (const auto &r : rtx.vout) {
+        if (IsSpent(txhash, r.n)) {
             continue;
         }
-        nBalance += wtx.GetAvailableCredit();
-        if (wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY) > 0) {
-            for (unsigned int i = 0; i < wtx.tx->GetNumVOuts(); i++) {
-                if (!IsSpent(wtx.GetHash(), i)) {
-                    nBalance += GetCredit(wtx.tx->vpout[i].get(), ISMINE_WATCH_COLDSTAKE);
-                    if (!MoneyRange(nBalance))
-                        throw std::runtime_error(std::string(__func__) + ": value out of range");
-                }
+        if (fTrusted) {
+            if (r.nType == OUTPUT_STANDARD && (r.nFlags & ORF_OWNED || r.nFlags & ORF_STAKEONLY)) {
+                tb.nSpendable += r.nValue;
+            } else
+            if (r.nType == OUTPUT_CT && r.nFlags & ORF_OWNED) {
+                tb.nBlind += r.nValue;
+            } else
+            if (r.nType == OUTPUT_RINGCT && r.nFlags & ORF_OWNED) {
+                tb.nAnon += r.nValue;
             }
         }
+        if (!(r.nFlags & ORF_OWN_ANY)) {
+            continue;
+        }
+        bool watch_only = r.nFlags & ORF_OWN_WATCH;
+        bool force_watch_only = false;
+#if !ENABLE_USBDEVICE
+        bool fNeedHardwareKey = (r.nFlags & ORF_HARDWARE_DEVICE);
+        if (fNeedHardwareKey) {
+            watch_only = true;
+            force_watch_only = true;
+        }
+#endif
+        switch (r.nType) {
+            case OUTPUT_RINGCT:
+                if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_OWN_WATCH)) {
+                    continue;
+                }
+                if (fTrusted) {
+                    if (depth >= consensusParams.nMinRCTOutputDepth) {
+                        if (watch_only) {
+                            bal.nAnonWatchOnly += r.nValue;
+                        } else {
+                            bal.nAnon += r.nValue;
+                        }
+                    } else {
+                        if (watch_only) {
+                            bal.nAnonWatchOnlyImmature += r.nValue;
+                        } else {
+                            bal.nAnonImmature += r.nValue;
+                        }
+                    }
+                } else
+                if (fInMempool) {
+                    if (watch_only) {
+                        bal.nAnonWatchOnlyUnconf += r.nValue;
+                    } else {
+                        bal.nAnonUnconf += r.nValue;
+                    }
+                }
+                break;
+            case OUTPUT_CT:
+                if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_OWN_WATCH)) {
+                    continue;
+                }
+                if (!allow_used_addresses && IsSpentKey(&r.scriptPubKey)) {
+                    continue;
+                }
+                if (fTrusted) {
+                    if (watch_only) {
+                        bal.nBlindWatchOnly += r.nValue;
+                    } else {
+                        bal.nBlind += r.nValue;
+                    }
+                } else
+                if (fInMempool) {
+                    if (watch_only) {
+                        bal.nBlindWatchOnlyUnconf += r.nValue;
+                    } else {
+                        bal.nBlindUnconf += r.nValue;
+                    }
+                }
+                break;
+            case OUTPUT_STANDARD:
+                if (!force_watch_only && (r.nFlags & ORF_OWNED)) {
+                    if (!allow_used_addresses && IsSpentKey(&r.scriptPubKey)) {
+                        continue;
+                    }
+                    if (fTrusted) {
+                        bal.nPart += r.nValue;
+                    } else
+                    if (fInMempool) {
+                        bal.nPartUnconf += r.nValue;
+                    }
+                } else
+                if (watch_only) {
+                    if (fTrusted) {
+                        bal.nPartWatchOnly += r.nValue;
+                    } else
+                    if (fInMempool) {
+                        bal.nPartWatchOnlyUnconf += r.nValue;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    return (depth == 0 && !rtx.IsAbandoned())
+        || (depth > 0 && depth < consensusParams.nMinRCTOutputDepth);
+};
+
+void CHDWallet::GetBalanceTotals(CachedTxBalance &totals, bool avoid_reuse) const
+{
+    AssertLockHeld(cs_wallet);
+
+    if (avoid_reuse && IsWalletFlagSet(WALLET_FLAG_AVOID_REUSE)) {
+        // Reused outputs depend on other txns, count the whole wallet.
+        m_balance_rebuild = true;
+        m_balance_dirty.clear();
+        totals = CachedTxBalance();
+        for (const auto &item : mapWallet) {
+            GetTxBalance(item.second, totals, avoid_reuse);
+        }
+        for (const auto &ri : mapRecords) {
+            GetTxBalance(ri.first, ri.second, totals, avoid_reuse);
+        }
+        return;
     }
 
-    m_spendable_balance_cached = nBalance;
-    m_have_spendable_balance_cached = true;
+    if (m_balance_rebuild) {
+        m_balance_txns.clear();
+        m_balance_dirty.clear();
+        m_balance_volatile.clear();
+        m_balance_total = CachedTxBalance();
+        m_balance_rebuild = false;
+        for (const auto &item : mapWallet) {
+            UpdateCachedTxBalance(item.first);
+        }
+        for (const auto &ri : mapRecords) {
+            UpdateCachedTxBalance(ri.first);
+        }
+    } else {
+        std::set<uint256> todo;
+        todo.swap(m_balance_dirty);
+        todo.insert(m_balance_volatile.begin(), m_balance_volatile.end());
+        for (const auto &txhash : todo) {
+            UpdateCachedTxBalance(txhash);
+        }
+    }
 
-    return m_spendable_balance_cached;
+    totals = m_balance_total;
 };
 
-CAmount CHDWallet::GetBlindBalance()
+void CHDWallet::UpdateCachedTxBalance(const uint256 &txhash) const
 {
-    CAmount nBalance = 0;
+    CachedTxBalance tb;
+    bool fVolatile = false;
+    MapWallet_t::const_iterator mwi;
+    MapRecords_t::const_iterator mri;
+    if ((mri = mapRecords.find(txhash)) != mapRecords.end()) {
+        fVolatile = GetTxBalance(txhash, mri->second, tb, false);
+    } else
+    if ((mwi = mapWallet.find(txhash)) != mapWallet.end()) {
+        fVolatile = GetTxBalance(mwi->second, tb, false);
+    }
 
-    LOCK(cs_wallet);
+    auto it = m_balance_txns.find(txhash);
+    if (it != m_balance_txns.end()) {
+        m_balance_total -= it->second;
+        m_balance_txns.erase(it);
+    }
+    if (!tb.IsNull()) {
+        m_balance_total += tb;
+        m_balance_txns.emplace(txhash, tb);
+    }
+    if (fVolatile) {
+        m_balance_volatile.insert(txhash);
+    } else {
+        m_balance_volatile.erase(txhash);
+    }
+};
 
-    for (const auto &ri : mapRecords) {
-        const auto &txhash = ri.first;
-        const auto &rtx = ri.second;
+void CHDWallet::MarkBalancesDirty(const uint256 &txhash)
+{
+    AssertLockHeld(cs_wallet);
+    if (m_have_unconfirmed_txns) {
+        m_unconfirmed_txns.insert(txhash);
+    }
+    if (m_balance_rebuild && !m_have_unspent_records) {
+        m_state_version++;
+        return;
+    }
 
-        if (!IsTrusted(txhash, rtx)) {
-            continue;
+    // The spent state of the prevouts may have changed
+    std::vector<uint256> txids{txhash};
+    MapWallet_t::const_iterator mwi;
+    MapRecords_t::const_iterator mri;
+    if ((mri = mapRecords.find(txhash)) != mapRecords.end()) {
+        for (const auto &prevout : mri->second.vin) {
+            txids.push_back(prevout.hash);
         }
-
-        for (const auto &r : rtx.vout) {
-            if (r.nType == OUTPUT_CT
-                && r.nFlags & ORF_OWNED && !IsSpent(txhash, r.n)) {
-                nBalance += r.nValue;
+    } else
+    if ((mwi = mapWallet.find(txhash)) != mapWallet.end()) {
+        for (const auto &txin : mwi->second.tx->vin) {
+            if (!txin.IsAnonInput()) {
+                txids.push_back(txin.prevout.hash);
             }
         }
+    }
 
-        if (!MoneyRange(nBalance)) {
-            throw std::runtime_error(std::string(__func__) + ": value out of range");
+    if (!m_balance_rebuild) {
+        m_balance_dirty.insert(txids.begin(), txids.end());
+    }
+    if (m_have_unspent_records) {
+        m_unspent_records_dirty.insert(txids.begin(), txids.end());
+    }
+    m_state_version++;
+};
+
+void CHDWallet::UpdateUnspentRecords(const uint256 &txid) const
+{
+    for (auto &records_by_type : m_unspent_records) {
+        records_by_type.second.erase(txid);
+    }
+
+    MapRecords_t::const_iterator mri = mapRecords.find(txid);
+    if (mri == mapRecords.end()) {
+        return;
+    }
+    for (const auto &r : mri->second.vout) {
+        if ((r.nType != OUTPUT_CT && r.nType != OUTPUT_RINGCT)
+            || !(r.nFlags & ORF_OWN_ANY)
+            || IsSpent(txid, r.n)) {
+            continue;
+        }
+        m_unspent_records[r.nType][txid].push_back(r.n);
+    }
+};
+
+const std::map<uint256, std::vector<uint32_t>> &CHDWallet::GetUnspentRecords(uint8_t output_type) const
+{
+    AssertLockHeld(cs_wallet);
+
+    if (!m_have_unspent_records) {
+        m_unspent_records.clear();
+        for (const auto &ri : mapRecords) {
+            UpdateUnspentRecords(ri.first);
+        }
+        m_have_unspent_records = true;
+    } else {
+        for (const auto &txid : m_unspent_records_dirty) {
+            UpdateUnspentRecords(txid);
         }
     }
+    m_unspent_records_dirty.clear();
 
-    return nBalance;
+    return m_unspent_records[output_type];
 };
 
-CAmount CHDWallet::GetAnonBalance()
+CAmount CHDWallet::GetSpendableBalance() const
 {
-    CAmount nBalance = 0;
+    // Returns a value to be compared against reservebalance, includes stakeable watch-only balance.
+    LOCK(cs_wallet);
+
+    CachedTxBalance totals;
+    GetBalanceTotals(totals, true);
+    if (!MoneyRange(totals.nSpendable)) {
+        throw std::runtime_error(std::string(__func__) + ": value out of range");
+    }
+
+    return totals.nSpendable;
+};
 
+CAmount CHDWallet::GetBlindBalance()
+{
     LOCK(cs_wallet);
 
-    for (const auto &ri : mapRecords) {
-        const auto &txhash = ri.first;
-        const auto &rtx = ri.second;
+    CachedTxBalance totals;
+    GetBalanceTotals(totals, true);
+    if (!MoneyRange(totals.nBlind)) {
+        throw std::runtime_error(std::string(__func__) + ": value out of range");
+    }
 
-        if (!IsTrusted(txhash, rtx)) {
-            continue;
-        }
+    return totals.nBlind;
+};
 
-        for (const auto &r : rtx.vout) {
-            if (r.nType == OUTPUT_RINGCT
-                && r.nFlags & ORF_OWNED && !IsSpent(txhash, r.n)) {
-                nBalance += r.nValue;
-            }
-        }
+CAmount CHDWallet::GetAnonBalance()
+{
+    LOCK(cs_wallet);
 
-        if (!MoneyRange(nBalance)) {
-            throw std::runtime_error(std::string(__func__) + ": value out of range");
-        }
+    CachedTxBalance totals;
+    GetBalanceTotals(totals, true);
+    if (!MoneyRange(totals.nAnon)) {
+        throw std::runtime_error(std::string(__func__) + ": value out of range");
     }
 
-    return nBalance;
+    return totals.nAnon;
 };
 
 /**
@@ -2693,165 +3049,29 @@ CWallet::Balance CHDWallet::GetBalance(const int min_depth, bool avoid_reuse) co
 
 bool CHDWallet::GetBalances(CHDWalletBalances &bal, bool avoid_reuse) const
 {
-    bal = CHDWalletBalances();
-
-    isminefilter reuse_filter = avoid_reuse ? 0 : ISMINE_USED;
-
-    bool allow_used_addresses = !IsWalletFlagSet(WALLET_FLAG_AVOID_REUSE) || (!avoid_reuse);
-
     LOCK(cs_wallet);
 
-    for (const auto &item : mapWallet) {
-        const CWalletTx &wtx = item.second;
+    CachedTxBalance totals;
+    GetBalanceTotals(totals, avoid_reuse);
+    bal = totals.bal;
 
-        bal.nPartImmature += wtx.GetImmatureCredit();
-        //bal.nPartWatchOnlyImmature += wtx.GetImmatureWatchOnlyCredit(*locked_chain);
+    return true;
+};
 
-        int depth;
-        if (wtx.IsCoinStake()
-            && (depth = wtx.GetDepthInMainChain()) > 0 // checks for hashunset
-            && wtx.GetBlocksToMaturity() > 0) {
-            CAmount nSpendable, nWatchOnly;
-            CHDWallet::GetCredit(*wtx.tx, nSpendable, nWatchOnly);
-            bal.nPartStaked += nSpendable;
-            bal.nPartWatchOnlyStaked += nWatchOnly;
-        }
+CAmount CHDWallet::GetAvailableBalance(const CCoinControl* coinControl) const
+{
+    LOCK(cs_wallet);
 
-        if (wtx.IsTrusted()) {
-            bal.nPart += wtx.GetAvailableCredit(true, ISMINE_SPENDABLE | reuse_filter);
-            bal.nPartWatchOnly += wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY | reuse_filter);
-        } else if (wtx.GetDepthInMainChain() == 0 && wtx.InMempool()) {
-            bal.nPartUnconf += wtx.GetAvailableCredit(true, ISMINE_SPENDABLE | reuse_filter);
-            bal.nPartWatchOnlyUnconf += wtx.GetAvailableCredit(true, ISMINE_WATCH_ONLY | reuse_filter);
+    CAmount balance = 0;
+    std::vector<COutput> vCoins;
+    AvailableCoins(vCoins, true, coinControl);
+    for (const COutput& out : vCoins) {
+        if (out.fSpendable) {
+            balance += out.tx->tx->vpout[out.i]->GetValue();
         }
     }
-
-    const Consensus::Params &consensusParams = Params().GetConsensus();
-    for (const auto &ri : mapRecords) {
-        const auto &txhash = ri.first;
-        const auto &rtx = ri.second;
-
-        int depth;
-        bool fTrusted = IsTrusted(txhash, rtx, &depth);
-        bool fInMempool = false;
-        if (!fTrusted) {
-            CTransactionRef ptx = nullptr;
-            if (HaveChain()) {
-                ptx = chain().transactionFromMempool(txhash);
-            }
-            fInMempool = !ptx ? false : true;
-        }
-
-        for (const auto &r : rtx.vout) {
-            if (!(r.nFlags & ORF_OWN_ANY)
-                || IsSpent(txhash, r.n)) {
-                continue;
-            }
-            bool watch_only = r.nFlags & ORF_OWN_WATCH;
-            bool force_watch_only = false;
-#if !ENABLE_USBDEVICE
-            bool fNeedHardwareKey = (r.nFlags & ORF_HARDWARE_DEVICE);
-            if (fNeedHardwareKey) {
-                watch_only = true;
-                force_watch_only = true;
-            }
-#endif
-            switch (r.nType) {
-                case OUTPUT_RINGCT:
-                    if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_OWN_WATCH)) {
-                        continue;
-                    }
-                    if (fTrusted) {
-                        if (depth >= consensusParams.nMinRCTOutputDepth) {
-                            if (watch_only) {
-                                bal.nAnonWatchOnly += r.nValue;
-                            } else {
-                                bal.nAnon += r.nValue;
-                            }
-                        } else {
-                            if (watch_only) {
-                                bal.nAnonWatchOnlyImmature += r.nValue;
-                            } else {
-                                bal.nAnonImmature += r.nValue;
-                            }
-                        }
-                    } else
-                    if (fInMempool) {
-                        if (watch_only) {
-                            bal.nAnonWatchOnlyUnconf += r.nValue;
-                        } else {
-                            bal.nAnonUnconf += r.nValue;
-                        }
-                    }
-                    break;
-                case OUTPUT_CT:
-                    if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_OWN_WATCH)) {
-                        continue;
-                    }
-                    if (!allow_used_addresses && IsSpentKey(&r.scriptPubKey)) {
-                        continue;
-                    }
-                    if (fTrusted) {
-                        if (watch_only) {
-                            bal.nBlindWatchOnly += r.nValue;
-                        } else {
-                            bal.nBlind += r.nValue;
-                        }
-                    } else
-                    if (fInMempool) {
-                        if (watch_only) {
-                            bal.nBlindWatchOnlyUnconf += r.nValue;
-                        } else {
-                            bal.nBlindUnconf += r.nValue;
-                        }
-                    }
-                    break;
-                case OUTPUT_STANDARD:
-                    if (!force_watch_only && (r.nFlags & ORF_OWNED)) {
-                        if (!allow_used_addresses && IsSpentKey(&r.scriptPubKey)) {
-                            continue;
-                        }
-                        if (fTrusted) {
-                            bal.nPart += r.nValue;
-                        } else
-                        if (fInMempool) {
-                            bal.nPartUnconf += r.nValue;
-                        }
-                    } else
-                    if (watch_only) {
-                        if (fTrusted) {
-                            bal.nPartWatchOnly += r.nValue;
-                        } else
-                        if (fInMempool) {
-                            bal.nPartWatchOnlyUnconf += r.nValue;
-                        }
-                    }
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
-    //if (!MoneyRange(nBalance))
-    //    throw std::runtime_error(std::string(__func__) + ": value out of range");
-
-    return true;
-};
-
-CAmount CHDWallet::GetAvailableBalance(const CCoinControl* coinControl) const
-{
-    LOCK(cs_wallet);
-
-    CAmount balance = 0;
-    std::vector<COutput> vCoins;
-    AvailableCoins(vCoins, true, coinControl);
-    for (const COutput& out : vCoins) {
-        if (out.fSpendable) {
-            balance += out.tx->tx->vpout[out.i]->GetValue();
-        }
-    }
-    return balance;
-}
+    return balance;
+}
 
 CAmount CHDWallet::GetAvailableAnonBalance(const CCoinControl* coinControl) const
 {
@@ -3076,6 +3296,24 @@ void CHDWallet::AddOutputRecordMetaData(CTransactionRecord &rtx, std::vector<CTe
 int CHDWallet::ExpandTempRecipients(std::vector<CTempRecipient> &vecSend, CStoredExtKey *pc, std::string &sError)
 {
     LOCK(cs_wallet);
+
+    // Stealth destinations are derived together, payouts to many addresses split the work across threads
+    std::vector<CStealthAddressPoints> stealth_points;
+    for (const auto &r : vecSend) {
+        if (r.nType == OUTPUT_STANDARD && r.address.type() == typeid(CStealthAddress)) {
+            stealth_points.emplace_back(boost::get<CStealthAddress>(r.address));
+            if (!stealth_points.back().IsValid()) {
+                return wserrorN(1, sError, __func__, "Invalid stealth address.");
+            }
+        }
+    }
+    std::vector<CStealthSendResult> stealth_sends;
+    if (!stealth_points.empty()
+        && 0 != MakeStealthOutputs(stealth_points, stealth_sends, GetWalletLoadThreads(), sError)) {
+        return wserrorN(1, sError, __func__, "Could not generate receiving public key.");
+    }
+    size_t nStealth = 0;
+
     for (size_t i = 0; i < vecSend.size(); ++i) {
         CTempRecipient &r = vecSend[i];
 
@@ -3084,19 +3322,10 @@ int CHDWallet::ExpandTempRecipients(std::vector<CTempRecipient> &vecSend, CStore
             if (r.address.type() == typeid(CStealthAddress)) {
                 CStealthAddress sx = boost::get<CStealthAddress>(r.address);
 
-                CKey sShared;
-                ec_point pkSendTo;
-
-                int k, nTries = 24;
-                for (k = 0; k < nTries; ++k) { // if StealthSecret fails try again with new ephem key
-                    r.sEphem.MakeNewKey(true);
-                    if (StealthSecret(r.sEphem, sx.scan_pubkey, sx.spend_pubkey, sShared, pkSendTo) == 0) {
-                        break;
-                    }
-                }
-                if (k >= nTries) {
-                    return wserrorN(1, sError, __func__, "Could not generate receiving public key.");
-                }
+                const CStealthSendResult &send = stealth_sends[nStealth++];
+                const CKey &sShared = send.sShared;
+                const ec_point &pkSendTo = send.pkSendTo;
+                r.sEphem = send.sEphem;
 
                 CPubKey pkEphem = r.sEphem.GetPubKey();
                 r.pkTo = CPubKey(pkSendTo);
@@ -3445,13 +3674,13 @@ int CHDWallet::AddCTData(const CCoinControl *coinControl, CTxOutBase *txout, CTe
         bp[0] = r.vBlind.data();
         assert(r.vBlind.size() == 32);
 
-        if (1 != secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, m_blind_scratch, blind_gens,
+        if (1 != secp256k1_bulletproof_rangeproof_prove(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
             pvRangeproof->data(), &nRangeProofLen, &nValue, nullptr, bp, 1,
             &secp256k1_generator_const_h, 64, nonce.begin(), nullptr, 0)) {
             return wserrorN(1, sError, __func__, "secp256k1_bulletproof_rangeproof_prove failed.");
         }
 
-        if (1 != secp256k1_bulletproof_rangeproof_verify(secp256k1_ctx_blind, m_blind_scratch, blind_gens,
+        if (1 != secp256k1_bulletproof_rangeproof_verify(secp256k1_ctx_blind, GetBlindScratch(), blind_gens,
             pvRangeproof->data(), nRangeProofLen, nullptr, pCommitment, 1, 64, &secp256k1_generator_const_h, nullptr, 0)) {
             return wserrorN(1, sError, __func__, "secp256k1_bulletproof_rangeproof_verify failed.");
         }
@@ -3533,6 +3762,23 @@ int CHDWallet::PostProcessTempRecipients(std::vector<CTempRecipient> &vecSend)
     return 0;
 };
 
+int CHDWallet::AddCTDataBatch(const CCoinControl *coinControl, std::vector<std::pair<CTxOutBase*, CTempRecipient*> > &vOutputs, std::string &sError)
+{
+    // Rangeproofs only touch their own output and recipient, cs_wallet is held by the caller throughout
+    std::vector<int> vRv(vOutputs.size(), 0);
+    std::vector<std::string> vErrors(vOutputs.size());
+    WalletParallelFor(vOutputs.size(), MAX_BLIND_SIGN_THREADS, "blindsign", [&](size_t i) NO_THREAD_SAFETY_ANALYSIS {
+        vRv[i] = AddCTData(coinControl, vOutputs[i].first, *vOutputs[i].second, vErrors[i]);
+    });
+    for (size_t i = 0; i < vOutputs.size(); ++i) {
+        if (vRv[i] != 0) {
+            sError = vErrors[i];
+            return vRv[i];
+        }
+    }
+    return 0;
+};
+
 static bool HaveAnonOutputs(std::vector<CTempRecipient> &vecSend)
 {
     for (const auto &r : vecSend)
@@ -4524,9 +4770,11 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
         std::vector<std::pair<MapRecords_t::const_iterator, unsigned int> > setCoins;
         std::vector<COutputR> vAvailableCoins;
         AvailableBlindedCoins(vAvailableCoins, true, coinControl);
+        BlindedSelectionParams bnb_params = GetBlindedSelectionParams(*coinControl);
 
         CAmount nValueOutPlain = 0;
         int nChangePosInOut = -1;
+        std::map<std::vector<uint8_t>, std::pair<CAmount, OUTPUT_PTR<CTxOutBase> > > mapCTOutputs; // By blinding factor
 
         nFeeRet = 0;
         size_t nSubFeeTries = 100;
@@ -4545,9 +4793,13 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
 
             // Choose coins to use
             if (pick_new_inputs) {
+                // The fee of the last round less its inputs is what the outputs need
+                if (nSubtractFeeFromAmount == 0) {
+                    bnb_params.target = nValue + std::max<CAmount>(0, nFeeRet - (CAmount)setCoins.size() * bnb_params.input_fee);
+                }
                 nValueIn = 0;
                 setCoins.clear();
-                if (!SelectBlindedCoins(vAvailableCoins, nValueToSelect, setCoins, nValueIn, coinControl)) {
+                if (!SelectBlindedCoins(vAvailableCoins, nValueToSelect, setCoins, nValueIn, coinControl, false, nSubtractFeeFromAmount == 0 ? &bnb_params : nullptr)) {
                     return wserrorN(1, sError, __func__, _("Insufficient funds.").translated);
                 }
             }
@@ -4631,12 +4883,19 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
             txNew.vpout.push_back(outFee);
 
             bool fFirst = true;
+            std::vector<std::pair<CTxOutBase*, CTempRecipient*> > vCTOutputs;
             for (size_t i = 0; i < vecSend.size(); ++i) {
                 auto &r = vecSend[i];
 
                 r.ApplySubFee(nFeeRet, nSubtractFeeFromAmount, fFirst);
 
                 OUTPUT_PTR<CTxOutBase> txbout;
+                auto mci = r.vBlind.size() == 32 ? mapCTOutputs.find(r.vBlind) : mapCTOutputs.end();
+                const bool fReuseOutput = mci != mapCTOutputs.end() && mci->second.first == r.nAmount;
+                if (fReuseOutput) {
+                    // Unchanged since the last fee iteration, reuse the output and its rangeproof
+                    txbout = mci->second.second;
+                } else
                 if (0 != CreateOutput(txbout, r, sError)) {
                     return 1; // sError will be set
                 }
@@ -4656,18 +4915,21 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 r.n = txNew.vpout.size();
                 txNew.vpout.push_back(txbout);
 
-                if (r.nType == OUTPUT_CT || r.nType == OUTPUT_RINGCT) {
+                if ((r.nType == OUTPUT_CT || r.nType == OUTPUT_RINGCT)
+                    && !fReuseOutput) {
                     // Need to know the fee before calculating the blind sum
                     if (r.vBlind.size() != 32) {
                         r.vBlind.resize(32);
                         GetStrongRandBytes(&r.vBlind[0], 32);
                     } // else already prefilled
 
-                    if (0 != AddCTData(coinControl, txbout.get(), r, sError)) {
-                        return 1; // sError will be set
-                    }
+                    vCTOutputs.emplace_back(txbout.get(), &r);
+                    mapCTOutputs[r.vBlind] = std::make_pair(r.nAmount, txbout);
                 }
             }
+            if (0 != AddCTDataBatch(coinControl, vCTOutputs, sError)) {
+                return 1; // sError will be set
+            }
 
             // Fill in dummy signatures for fee calculation.
             int nIn = 0;
@@ -4804,7 +5066,7 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 memcpy(&vInputBlinds[nIn * 32], it->second.blind.begin(), 32);
             } else {
                 CStoredTransaction stx;
-                if (!CHDWalletDB(*database).ReadStoredTx(txhash, stx)) {
+                if (!ReadStoredTx(txhash, stx)) {
                     return werrorN(1, "%s: ReadStoredTx failed for %s.\n", __func__, txhash.ToString().c_str());
                 }
                 if (!stx.GetBlind(coin.second, &vInputBlinds[nIn * 32])) {
@@ -4901,7 +5163,7 @@ int CHDWallet::AddBlindedInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 const CScript &scriptPubKey = oR->scriptPubKey;
 
                 CStoredTransaction stx;
-                if (!CHDWalletDB(*database).ReadStoredTx(txhash, stx)) {
+                if (!ReadStoredTx(txhash, stx)) {
                     return werrorN(1, "%s: ReadStoredTx failed for %s.\n", __func__, txhash.ToString().c_str());
                 }
                 std::vector<uint8_t> vchAmount;
@@ -5027,6 +5289,7 @@ int CHDWallet::PlaceRealOutputs(std::vector<std::vector<int64_t> > &vMI, size_t
 
     CHDWalletDB wdb(*database);
     vMI.resize(vCoins.size());
+    std::vector<CCmpPubKey> real_pks(vCoins.size());
 
     for (size_t k = 0; k < vCoins.size(); ++k) {
         vMI[k].resize(nRingSize);
@@ -5063,22 +5326,28 @@ int CHDWallet::PlaceRealOutputs(std::vector<std::vector<int64_t> > &vMI, size_t
                     }
                 }
                 assert(pk);
-
-                int64_t index;
-                if (!pblocktree->ReadRCTOutputLink(*pk, index)) {
-                    return wserrorN(1, sError, __func__, _("Anon pubkey not found in db, %s").translated, HexStr(*pk));
-                }
-                if (setHave.count(index)) {
-                    return wserrorN(1, sError, __func__, _("Duplicate index found, %d").translated, index);
-                }
-
-                vMI[k][i] = index;
-                setHave.insert(index);
-                continue;
+                real_pks[k] = *pk;
             }
         }
     }
 
+    // Look up the indices of all real outputs together
+    std::vector<int64_t> real_indices;
+    std::vector<bool> found;
+    pblocktree->ReadRCTOutputLinks(real_pks, real_indices, found);
+    for (size_t k = 0; k < vCoins.size(); ++k) {
+        if (!found[k]) {
+            return wserrorN(1, sError, __func__, _("Anon pubkey not found in db, %s").translated, HexStr(real_pks[k]));
+        }
+        int64_t index = real_indices[k];
+        if (setHave.count(index)) {
+            return wserrorN(1, sError, __func__, _("Duplicate index found, %d").translated, index);
+        }
+
+        vMI[k][nSecretColumn] = index;
+        setHave.insert(index);
+    }
+
     return 0;
 };
 
@@ -5095,6 +5364,8 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
             break;
         case MIXIN_SEL_FULL_RANGE:
             break;
+        case MIXIN_SEL_GAMMA: // gamma distributed output age
+            break;
         case MIXIN_SEL_DEBUG:
             break;
         default:
@@ -5109,20 +5380,8 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
 
     int nBestHeight = chain().getHeightInt();
     size_t nInputs = vMI.size();
-    int64_t nLastRCTOutIndex = chain().getAnonOutputs();
-
-    // Remove outputs without required depth
-    while (nLastRCTOutIndex > 1) {
-        CAnonOutput ao;
-        if (!pblocktree->ReadRCTOutput(nLastRCTOutIndex, ao)) {
-            return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, nLastRCTOutIndex);
-        }
-        if (nBestHeight - ao.nBlockHeight + 1 < consensusParams.nMinRCTOutputDepth) {
-            nLastRCTOutIndex--;
-            continue;
-        }
-        break;
-    }
+    // Outputs without required depth are excluded, the block index records the last anon output index at each height
+    int64_t nLastRCTOutIndex = chain().getMatureAnonOutputs(consensusParams.nMinRCTOutputDepth);
 
     if (LogAcceptCategory(BCLog::HDWALLET)) {
         WalletLogPrintf("%s: Last index %d, inputs %d, ring size %d, selection mode %d.\n", __func__, nLastRCTOutIndex, nInputs, nRingSize, coinControl->m_mixin_selection_mode);
@@ -5165,12 +5424,12 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
             ranges[j] = expect_aos_per_period * range_periods[j];
 
             int64_t output_id = nLastRCTOutIndex - std::min(nLastRCTOutIndex-1, std::max(min_anon_input, ranges[j]));
-            CAnonOutput ao;
-            if (!pblocktree->ReadRCTOutput(output_id, ao)) {
+            int output_height = chain().getAnonOutputHeight(output_id);
+            if (output_height < 0) {
                 return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, output_id);
             }
 
-            int num_blocks = nBestHeight - ao.nBlockHeight;
+            int num_blocks = nBestHeight - output_height;
             if (num_blocks) {
                 double ratio = ((double) range_periods[j] / ((double) num_blocks / 720.0));
                 if (ratio > 1.0) {
@@ -5184,6 +5443,11 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
         }
     }
 
+    // Log-age distribution of spent outputs, from "An Empirical Analysis of Traceability in the Monero Blockchain"
+    std::gamma_distribution<double> gamma_age(19.28, 1.0 / 1.61);
+    FastRandomContext rng;
+    int mature_height = nBestHeight - std::max(consensusParams.nMinRCTOutputDepth, 1) + 1;
+
     size_t used_presets = 0;
     for (size_t k = 0; k < nInputs; ++k)
     for (size_t i = 0; i < nRingSize; ++i) {
@@ -5246,14 +5510,15 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
                     select_max = std::min(nLastRCTOutIndex, select_near + select_range);
 
                     int64_t num_blocks, num_aos = select_max - select_min;
-                    CAnonOutput ao_min, ao_max;
-                    if (!pblocktree->ReadRCTOutput(select_min, ao_min)) {
+                    int height_min = chain().getAnonOutputHeight(select_min);
+                    if (height_min < 0) {
                         return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, select_min);
                     }
-                    if (!pblocktree->ReadRCTOutput(select_max, ao_max)) {
+                    int height_max = chain().getAnonOutputHeight(select_max);
+                    if (height_max < 0) {
                         return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, select_max);
                     }
-                    num_blocks = ao_max.nBlockHeight - ao_min.nBlockHeight;
+                    num_blocks = height_max - height_min;
 
                     if (num_blocks) {
                         double ratio = ((double) num_aos * 2.0) / ((double) num_blocks);
@@ -5267,6 +5532,21 @@ int CHDWallet::PickHidingOutputs(std::vector<std::vector<int64_t> > &vMI,
                         }
                     }
                 }
+            } else
+            if (coinControl->m_mixin_selection_mode == MIXIN_SEL_GAMMA) {
+                // Pick a block by the age of the output, spends are more likely to be recent
+                double age_seconds = std::exp(gamma_age(rng));
+                int64_t age_blocks = (int64_t)(age_seconds / Params().GetTargetSpacing());
+                if (age_blocks > mature_height) {
+                    continue; // Older than the chain, redraw
+                }
+                int height = mature_height - age_blocks;
+                select_min = std::max(min_anon_input, chain().getAnonOutputsAtHeight(height - 1) + 1);
+                int64_t last_in_block = std::min(nLastRCTOutIndex, chain().getAnonOutputsAtHeight(height));
+                if (last_in_block < select_min) {
+                    continue; // No usable anon outputs in block, redraw
+                }
+                select_max = last_in_block + 1;
             }
 
             int64_t nDecoy = select_min;
@@ -5341,6 +5621,7 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
         std::vector<std::pair<MapRecords_t::const_iterator, unsigned int> > setCoins;
         std::vector<COutputR> vAvailableCoins;
         AvailableAnonCoins(vAvailableCoins, true, coinControl);
+        BlindedSelectionParams bnb_params = GetBlindedSelectionParams(*coinControl, nRingSize, nInputsPerSig);
 
         CAmount nValueOutPlain = 0;
         int nChangePosInOut = -1;
@@ -5348,6 +5629,7 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
         std::vector<std::vector<std::vector<int64_t> > > vMI;
         std::vector<std::vector<uint8_t> > vInputBlinds;
         std::vector<size_t> vSecretColumns;
+        std::map<std::vector<uint8_t>, std::pair<CAmount, OUTPUT_PTR<CTxOutBase> > > mapCTOutputs; // By blinding factor
 
         size_t nSubFeeTries = 100;
         bool pick_new_inputs = true;
@@ -5365,9 +5647,13 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
 
             // Choose coins to use
             if (pick_new_inputs) {
+                // The fee of the last round less its inputs is what the outputs need
+                if (nSubtractFeeFromAmount == 0) {
+                    bnb_params.target = nValue + std::max<CAmount>(0, nFeeRet - (CAmount)setCoins.size() * bnb_params.input_fee);
+                }
                 nValueIn = 0;
                 setCoins.clear();
-                if (!SelectBlindedCoins(vAvailableCoins, nValueToSelect, setCoins, nValueIn, coinControl, true)) {
+                if (!SelectBlindedCoins(vAvailableCoins, nValueToSelect, setCoins, nValueIn, coinControl, true, nSubtractFeeFromAmount == 0 ? &bnb_params : nullptr)) {
                     return wserrorN(1, sError, __func__, _("Insufficient funds.").translated);
                 }
             }
@@ -5441,13 +5727,19 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
             txNew.vpout.push_back(outFee);
 
             bool fFirst = true;
+            std::vector<std::pair<CTxOutBase*, CTempRecipient*> > vCTOutputs;
             for (size_t i = 0; i < vecSend.size(); ++i) {
                 auto &r = vecSend[i];
 
                 r.ApplySubFee(nFeeRet, nSubtractFeeFromAmount, fFirst);
 
                 OUTPUT_PTR<CTxOutBase> txbout;
-
+                auto mci = r.vBlind.size() == 32 ? mapCTOutputs.find(r.vBlind) : mapCTOutputs.end();
+                const bool fReuseOutput = mci != mapCTOutputs.end() && mci->second.first == r.nAmount;
+                if (fReuseOutput) {
+                    // Unchanged since the last fee iteration, reuse the output and its rangeproof
+                    txbout = mci->second.second;
+                } else
                 if (0 != CreateOutput(txbout, r, sError)) {
                     return 1; // sError will be set
                 }
@@ -5463,17 +5755,20 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 r.n = txNew.vpout.size();
                 txNew.vpout.push_back(txbout);
 
-                if (r.nType == OUTPUT_CT || r.nType == OUTPUT_RINGCT) {
+                if ((r.nType == OUTPUT_CT || r.nType == OUTPUT_RINGCT)
+                    && !fReuseOutput) {
                     if (r.vBlind.size() != 32) {
                         r.vBlind.resize(32);
                         GetStrongRandBytes(&r.vBlind[0], 32);
                     } // else prefilled already
 
-                    if (0 != AddCTData(coinControl, txbout.get(), r, sError)) {
-                        return 1; // sError will be set
-                    }
+                    vCTOutputs.emplace_back(txbout.get(), &r);
+                    mapCTOutputs[r.vBlind] = std::make_pair(r.nAmount, txbout);
                 }
             }
+            if (0 != AddCTDataBatch(coinControl, vCTOutputs, sError)) {
+                return 1; // sError will be set
+            }
 
             std::set<int64_t> setHave; // Anon prev-outputs can only be used once per transaction.
             size_t nTotalInputs = 0;
@@ -5656,14 +5951,17 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
                 vKeyImages.resize(33 * nSigInputs);
 
+                std::vector<int64_t> vRealIndices(nSigInputs);
+                std::vector<CAnonOutput> vRealOutputs;
                 for (size_t k = 0; k < nSigInputs; ++k) {
-                    size_t i = vSecretColumns[l];
-                    int64_t nIndex = vMI[l][k][i];
+                    vRealIndices[k] = vMI[l][k][vSecretColumns[l]];
+                }
+                if (!pblocktree->ReadRCTOutputs(vRealIndices, vRealOutputs)) {
+                    return wserrorN(1, sError, __func__, _("Anon output not found in db, input %d").translated, l);
+                }
 
-                    CAnonOutput ao;
-                    if (!pblocktree->ReadRCTOutput(nIndex, ao)) {
-                        return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, nIndex);
-                    }
+                for (size_t k = 0; k < nSigInputs; ++k) {
+                    const CAnonOutput &ao = vRealOutputs[k];
 
                     CKeyID idk = ao.pubkey.GetID();
                     CKey key;
@@ -5678,34 +5976,53 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                 }
             }
 
+            // Rings are prepared in order, the split commitment blinding keys
+            // depend on the previous inputs. Signing is independent per ring.
+            struct MLSAGSignData {
+                size_t nCols, nRows;
+                uint8_t randSeed[32];
+                uint8_t blindSum[32] = {0};
+                std::vector<CKey> vsk;
+                std::vector<const uint8_t*> vpsk;
+                std::vector<uint8_t> vm;
+            };
+            std::vector<MLSAGSignData> vSignData(txNew.vin.size());
             for (size_t l = 0; l < txNew.vin.size(); ++l) {
                 auto &txin = txNew.vin[l];
 
                 uint32_t nSigInputs, nSigRingSize;
                 txin.GetAnonInfo(nSigInputs, nSigRingSize);
 
-                size_t nCols = nSigRingSize;
-                size_t nRows = nSigInputs + 1;
+                MLSAGSignData &sd = vSignData[l];
+                size_t nCols = sd.nCols = nSigRingSize;
+                size_t nRows = sd.nRows = nSigInputs + 1;
 
-                uint8_t randSeed[32];
-                GetStrongRandBytes(randSeed, 32);
+                GetStrongRandBytes(sd.randSeed, 32);
 
-                std::vector<CKey> vsk(nSigInputs);
-                std::vector<const uint8_t*> vpsk(nRows), vpBlinds, vpInCommits(nCols * nSigInputs);
-                std::vector<uint8_t> vm(nCols * nRows * 33);
-                std::vector<uint8_t> &vKeyImages = txin.scriptData.stack[0];
+                std::vector<CKey> &vsk = sd.vsk;
+                std::vector<const uint8_t*> &vpsk = sd.vpsk;
+                std::vector<uint8_t> &vm = sd.vm;
+                vsk.resize(nSigInputs);
+                vpsk.resize(nRows);
+                vm.resize(nCols * nRows * 33);
+                std::vector<const uint8_t*> vpBlinds, vpInCommits(nCols * nSigInputs);
                 std::vector<uint8_t> &vDL = txin.scriptWitness.stack[1];
                 std::vector<secp256k1_pedersen_commitment> vCommitments;
                 vCommitments.reserve(nCols * nSigInputs);
 
+                std::vector<int64_t> vRingIndices;
+                std::vector<CAnonOutput> vRingOutputs;
+                vRingIndices.reserve(nCols * nSigInputs);
+                for (size_t k = 0; k < nSigInputs; ++k) {
+                    vRingIndices.insert(vRingIndices.end(), vMI[l][k].begin(), vMI[l][k].begin() + nCols);
+                }
+                if (!pblocktree->ReadRCTOutputs(vRingIndices, vRingOutputs)) {
+                    return wserrorN(1, sError, __func__, _("Anon output not found in db, input %d").translated, l);
+                }
+
                 for (size_t k = 0; k < nSigInputs; ++k)
                 for (size_t i = 0; i < nCols; ++i) {
-                    int64_t nIndex = vMI[l][k][i];
-
-                    CAnonOutput ao;
-                    if (!pblocktree->ReadRCTOutput(nIndex, ao)) {
-                        return wserrorN(1, sError, __func__, _("Anon output not found in db, %d").translated, nIndex);
-                    }
+                    const CAnonOutput &ao = vRingOutputs[i+k*nCols];
 
                     memcpy(&vm[(i+k*nCols)*33], ao.pubkey.begin(), 33);
                     vCommitments.push_back(ao.commitment);
@@ -5721,7 +6038,7 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
                     }
                 }
 
-                uint8_t blindSum[32] = {0};
+                uint8_t *blindSum = sd.blindSum;
                 vpsk[nRows-1] = blindSum;
                 if (txNew.vin.size() == 1) {
                     vDL.resize((1 + (nSigInputs+1) * nSigRingSize) * 32); // extra element for C, extra row for commitment row
@@ -5780,11 +6097,21 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
 
                     vpBlinds.pop_back();
                 }
+            }
 
-                uint256 txhash = txNew.GetHash();
-                if (0 != (rv = secp256k1_generate_mlsag(secp256k1_ctx_blind, vKeyImages.data(), &vDL[0], &vDL[32],
-                    randSeed, txhash.begin(), nCols, nRows, vSecretColumns[l],
-                    &vpsk[0], &vm[0]))) {
+            // The txn hash doesn't cover the witness data written by the signatures
+            uint256 txhash = txNew.GetHash();
+            std::vector<int> vSignRv(txNew.vin.size(), 0);
+            WalletParallelFor(txNew.vin.size(), MAX_BLIND_SIGN_THREADS, "blindsign", [&](size_t l) {
+                auto &txin = txNew.vin[l];
+                MLSAGSignData &sd = vSignData[l];
+                std::vector<uint8_t> &vDL = txin.scriptWitness.stack[1];
+                vSignRv[l] = secp256k1_generate_mlsag(secp256k1_ctx_blind, txin.scriptData.stack[0].data(), &vDL[0], &vDL[32],
+                    sd.randSeed, txhash.begin(), sd.nCols, sd.nRows, vSecretColumns[l],
+                    &sd.vpsk[0], &sd.vm[0]);
+            });
+            for (size_t l = 0; l < vSignRv.size(); ++l) {
+                if (0 != (rv = vSignRv[l])) {
                     return wserrorN(1, sError, __func__, "secp256k1_generate_mlsag failed %d", rv);
                 }
             }
@@ -5881,11 +6208,113 @@ int CHDWallet::AddAnonInputs(CWalletTx &wtx, CTransactionRecord &rtx,
 void CHDWallet::ClearCachedBalances()
 {
     // Clear cache when a new txn is added to the wallet or a block is added or removed from the chain.
-    m_have_spendable_balance_cached = false;
     m_have_cached_stakeable_coins = false;
+    m_state_version++;
     return;
 }
 
+void CHDWallet::MarkDirty()
+{
+    {
+        LOCK(cs_wallet);
+        m_balance_rebuild = true;
+        m_have_unspent_records = false;
+        m_have_unconfirmed_txns = false;
+    }
+    m_state_version++;
+    CWallet::MarkDirty();
+}
+
+void CHDWallet::blockConnected(const CBlock& block, int height)
+{
+    {
+        LOCK(cs_wallet);
+        m_group_commit = m_group_commit_size > 0;
+        CWallet::blockConnected(block, height);
+        m_group_commit = false;
+
+        if (!CommitPendingRecords()) {
+            WalletLogPrintf("%s: Error: CommitPendingRecords failed for block %s.\n", __func__, block.GetHash().ToString());
+        }
+    }
+
+    // Depths changed, refresh the view if anyone is reading it
+    m_state_version++;
+    if (std::atomic_load(&m_read_view)) {
+        PublishReadView();
+    }
+}
+
+void CHDWallet::blockDisconnected(const CBlock& block, int height)
+{
+    CWallet::blockDisconnected(block, height);
+
+    // Spends can be undone
+    m_have_stake_candidates = false;
+    {
+        LOCK(cs_wallet);
+        m_balance_rebuild = true;
+        m_have_unspent_records = false;
+        // Txns of the block are unconfirmed again
+        m_have_unconfirmed_txns = false;
+    }
+
+    m_state_version++;
+    if (std::atomic_load(&m_read_view)) {
+        PublishReadView();
+    }
+}
+
+void CHDWallet::transactionAddedToMempool(const CTransactionRef& tx, uint64_t mempool_sequence)
+{
+    CWallet::transactionAddedToMempool(tx, mempool_sequence);
+    // Trusted balances depend on the mempool state of the wallet's own txns
+    m_state_version++;
+}
+
+void CHDWallet::transactionRemovedFromMempool(const CTransactionRef& tx, MemPoolRemovalReason reason, uint64_t mempool_sequence)
+{
+    CWallet::transactionRemovedFromMempool(tx, reason, mempool_sequence);
+    m_state_version++;
+}
+
+std::shared_ptr<const WalletReadView> CHDWallet::GetReadView() const
+{
+    std::shared_ptr<const WalletReadView> view = std::atomic_load(&m_read_view);
+    if (!view
+        || view->nVersion != m_state_version.load()
+        || view->nReserveBalance != nReserveBalance) {
+        return nullptr;
+    }
+    return view;
+}
+
+std::shared_ptr<const WalletReadView> CHDWallet::PublishReadView() const
+{
+    auto view = std::make_shared<WalletReadView>();
+    {
+        LOCK(cs_wallet);
+        // Read the version first, a change made while building leaves the view outdated
+        view->nVersion = m_state_version.load();
+        GetBalances(view->bal);
+        if (IsWalletFlagSet(WALLET_FLAG_AVOID_REUSE)) {
+            GetBalances(view->bal_full, false);
+        }
+        view->nReserveBalance = nReserveBalance;
+    }
+    view->nStakeWeight = GetStakeWeight();
+
+    std::shared_ptr<const WalletReadView> published = view;
+    std::atomic_store(&m_read_view, published);
+    return published;
+}
+
+std::shared_ptr<const WalletReadView> CHDWallet::GetOrPublishReadView() const
+{
+    std::shared_ptr<const WalletReadView> view = GetReadView();
+    return view ? view : PublishReadView();
+}
+
 bool CHDWallet::LoadToWallet(const uint256& hash, const UpdateWalletTxFn& fill_wtx)
 {
     CWallet::LoadToWallet(hash, fill_wtx);
@@ -5910,81 +6339,355 @@ bool CHDWallet::LoadToWallet(const uint256& hash, const UpdateWalletTxFn& fill_w
     return true;
 };
 
-void CHDWallet::LoadToWallet(const uint256 &hash, CTransactionRecord &rtx)
+bool CHDWallet::ReadStoredTx(const uint256 &txhash, CStoredTransaction &stx) const
+{
+    {
+        LOCK(cs_wallet);
+        const auto mi = m_pending_records.find(txhash);
+        if (mi != m_pending_records.end()) {
+            stx = mi->second.second;
+            return true;
+        }
+    }
+    return CHDWalletDB(*database).ReadStoredTx(txhash, stx);
+}
+
+bool CHDWallet::WriteTxRecordAndStx(CHDWalletDB *pwdb, const uint256 &txhash, const CTransactionRecord &rtx, const CStoredTransaction &stx)
+{
+    AssertLockHeld(cs_wallet);
+
+    if (!m_group_commit) {
+        return pwdb->WriteTxRecord(txhash, rtx)
+            && pwdb->WriteStoredTx(txhash, stx);
+    }
+
+    auto &pending = m_pending_records[txhash];
+    pending.first = rtx;
+    pending.second = stx;
+    if (m_pending_records.size() >= m_group_commit_size) {
+        return CommitPendingRecords();
+    }
+    return true;
+}
+
+bool CHDWallet::CommitPendingRecords()
+{
+    AssertLockHeld(cs_wallet);
+
+    if (m_pending_records.empty()) {
+        return true;
+    }
+
+    int64_t nStart = GetTimeMicros();
+    CHDWalletDB wdb(*database);
+    bool rv = wdb.TxnBegin();
+    if (rv) {
+        for (const auto &mi : m_pending_records) {
+            if (!wdb.WriteTxRecord(mi.first, mi.second.first)
+                || !wdb.WriteStoredTx(mi.first, mi.second.second)) {
+                rv = false;
+                break;
+            }
+        }
+        if (!rv) {
+            wdb.TxnAbort();
+        } else {
+            rv = wdb.TxnCommit();
+        }
+    }
+
+    if (!rv) {
+        // Fall back to writing each record on its own
+        m_commit_stats.nFailed++;
+        rv = true;
+        for (const auto &mi : m_pending_records) {
+            if (!wdb.WriteTxRecord(mi.first, mi.second.first)
+                || !wdb.WriteStoredTx(mi.first, mi.second.second)) {
+                WalletLogPrintf("%s: Error: Write failed for %s.\n", __func__, mi.first.ToString());
+                rv = false;
+            }
+        }
+    }
+
+    int64_t nTime = GetTimeMicros() - nStart;
+    m_commit_stats.nCommits++;
+    m_commit_stats.nRecords += m_pending_records.size();
+    m_commit_stats.nTotalMicros += nTime;
+    m_commit_stats.nLastMicros = nTime;
+    m_commit_stats.nMaxMicros = std::max(m_commit_stats.nMaxMicros, nTime);
+    if (LogAcceptCategory(BCLog::HDWALLET)) {
+        WalletLogPrintf("%s: %u records in %.2fms\n", __func__, m_pending_records.size(), nTime * 0.001);
+    }
+
+    m_pending_records.clear();
+    return rv;
+}
+
+size_t CHDWallet::RecordsDynamicMemoryUsage() const
+{
+    AssertLockHeld(cs_wallet);
+
+    size_t usage = memusage::DynamicUsage(mapRecords);
+    for (const auto &ri : mapRecords) {
+        const CTransactionRecord &rtx = ri.second;
+        usage += memusage::DynamicUsage(rtx.vin);
+        usage += memusage::DynamicUsage(rtx.vout);
+        usage += memusage::DynamicUsage(rtx.mapValue);
+        for (const auto &v : rtx.mapValue) {
+            usage += memusage::DynamicUsage(v.second);
+        }
+        for (const auto &r : rtx.vout) {
+            usage += memusage::DynamicUsage(r.scriptPubKey);
+            usage += memusage::DynamicUsage(r.vPath);
+            if (r.sNarration.capacity() > 15) { // Short strings are stored inline
+                usage += memusage::MallocUsage(r.sNarration.capacity() + 1);
+            }
+        }
+    }
+    usage += memusage::MallocUsage(sizeof(memusage::stl_tree_node<RtxOrdered_t::value_type>)) * rtxOrdered.size();
+
+    return usage;
+};
+
+void CHDWallet::LoadToWallet(const uint256 &hash, CTransactionRecord &rtx)
+{
+    Optional<int> block_height = chain().getBlockHeight(rtx.blockHash);
+    if (block_height) {
+        rtx.block_height = *block_height;
+    }
+
+    // rtx is not used by the caller after loading, move to avoid copying the output records
+    std::pair<MapRecords_t::iterator, bool> ret = mapRecords.emplace(hash, std::move(rtx));
+
+    MapRecords_t::iterator mri = ret.first;
+    rtxOrdered.insert(std::make_pair(mri->second.GetTxTime(), mri));
+
+    // TODO: Spend only owned inputs?
+
+    return;
+};
+
+void CHDWallet::RemoveFromTxSpends(const uint256 &hash, const CTransactionRef pt)
+{
+    for (const auto &txin : pt->vin) {
+        std::pair<TxSpends::iterator, TxSpends::iterator> ip = mapTxSpends.equal_range(txin.prevout);
+        for (auto it = ip.first; it != ip.second; ) {
+            if (it->second == hash) {
+                mapTxSpends.erase(it++);
+                continue;
+            }
+            ++it;
+        }
+    }
+    return;
+};
+
+int CHDWallet::UnloadTransaction(const uint256 &hash)
+{
+    // Remove txn from wallet, inc TxSpends
+    if (LogAcceptCategory(BCLog::HDWALLET)) {
+        WalletLogPrintf("%s: %s.\n", __func__, hash.ToString());
+    }
+
+    MarkBalancesDirty(hash);
+
+    MapWallet_t::iterator itw;
+    MapRecords_t::iterator itr;
+    if ((itw = mapWallet.find(hash)) != mapWallet.end()) {
+        CWalletTx *pcoin = &itw->second;
+
+        RemoveFromTxSpends(hash, pcoin->tx);
+
+        wtxOrdered.erase(pcoin->m_it_wtxOrdered);
+
+        mapWallet.erase(itw);
+    } else
+    if ((itr = mapRecords.find(hash)) != mapRecords.end()) {
+        CStoredTransaction stx;
+        if (!ReadStoredTx(hash, stx)) { // TODO: cache / use mapTempWallet
+            WalletLogPrintf("%s: ReadStoredTx failed for %s.\n", __func__, hash.ToString());
+        } else {
+            RemoveFromTxSpends(hash, stx.tx);
+        }
+
+        // Records are ordered by GetTxTime when loaded and by nTimeReceived when added,
+        // look in those ranges before walking all of rtxOrdered.
+        bool fErased = false;
+        for (int64_t nTime : {itr->second.GetTxTime(), itr->second.nTimeReceived}) {
+            auto range = rtxOrdered.equal_range(nTime);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == itr) {
+                    rtxOrdered.erase(it);
+                    fErased = true;
+                    break;
+                }
+            }
+            if (fErased) {
+                break;
+            }
+        }
+        for (auto it = rtxOrdered.cbegin(); !fErased && it != rtxOrdered.cend(); ++it) {
+            if (it->second == itr) {
+                rtxOrdered.erase(it);
+                break;
+            }
+        }
+
+        mapRecords.erase(itr);
+    } else {
+        WalletLogPrintf("Warning: %s - tx not found in wallet! %s.\n", __func__, hash.ToString());
+        return 1;
+    }
+
+    NotifyTransactionChanged(this, hash, CT_DELETED);
+    return 0;
+};
+
+bool CHDWallet::ArchiveRecords(int min_depth, int64_t max_time, size_t &nArchived)
+{
+    AssertLockHeld(cs_wallet);
+    nArchived = 0;
+
+    // Pending records are not on disk yet, their rtx entry must exist to be moved
+    if (!CommitPendingRecords()) {
+        return werror("%s: CommitPendingRecords failed.", __func__);
+    }
+
+    auto IsSpentDeep = [&](const COutPoint &outpoint) {
+        const auto range = mapTxSpends.equal_range(outpoint);
+        for (auto it = range.first; it != range.second; ++it) {
+            const auto mri = mapRecords.find(it->second);
+            if (mri != mapRecords.end()) {
+                if (!mri->second.IsAbandoned() && GetDepthInMainChain(mri->second) >= min_depth) {
+                    return true;
+                }
+                continue;
+            }
+            const auto mwi = mapWallet.find(it->second);
+            if (mwi != mapWallet.end() && mwi->second.GetDepthInMainChain() >= min_depth) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::set<uint256> setArchive;
+    for (const auto &ri : mapRecords) {
+        const CTransactionRecord &rtx = ri.second;
+        if (rtx.GetTxTime() > max_time || GetDepthInMainChain(rtx) < min_depth) {
+            continue;
+        }
+        bool fSpent = true;
+        for (const auto &r : rtx.vout) {
+            if ((r.nFlags & ORF_OWN_ANY) && !IsSpentDeep(COutPoint(ri.first, r.n))) {
+                fSpent = false;
+                break;
+            }
+        }
+        if (fSpent) {
+            setArchive.insert(ri.first);
+        }
+    }
+
+    // The spends of a loaded record are what mark the outputs it spends as
+    // spent, keep records spending from a transaction that stays loaded.
+    bool fChanged = true;
+    while (fChanged) {
+        fChanged = false;
+        for (auto it = setArchive.begin(); it != setArchive.end(); ) {
+            bool fKeep = false;
+            for (const auto &prevout : mapRecords.at(*it).vin) {
+                if (!setArchive.count(prevout.hash) && HaveTransaction(prevout.hash)) {
+                    fKeep = true;
+                    break;
+                }
+            }
+            if (fKeep) {
+                it = setArchive.erase(it);
+                fChanged = true;
+                continue;
+            }
+            ++it;
+        }
+    }
+    if (setArchive.empty()) {
+        return true;
+    }
+
+    CHDWalletDB wdb(*database);
+    if (!wdb.TxnBegin()) {
+        return werror("%s: TxnBegin failed.", __func__);
+    }
+    for (const auto &txhash : setArchive) {
+        if (!wdb.WriteArchivedTxRecord(txhash, mapRecords.at(txhash))
+            || !wdb.EraseTxRecord(txhash)) {
+            wdb.TxnAbort();
+            return werror("%s: Failed to archive %s.", __func__, txhash.ToString());
+        }
+    }
+    if (!wdb.TxnCommit()) {
+        return werror("%s: TxnCommit failed.", __func__);
+    }
+
+    for (const auto &txhash : setArchive) {
+        UnloadTransaction(txhash);
+    }
+    nArchived = setArchive.size();
+    WalletLogPrintf("Archived %u transaction records, %u remain loaded.\n", nArchived, mapRecords.size());
+
+    return true;
+};
+
+bool CHDWallet::ReadArchivedRecord(const uint256 &txhash, CTransactionRecord &rtx) const
 {
+    if (!CHDWalletDB(*database).ReadArchivedTxRecord(txhash, rtx)) {
+        return false;
+    }
     Optional<int> block_height = chain().getBlockHeight(rtx.blockHash);
     if (block_height) {
         rtx.block_height = *block_height;
     }
-
-    std::pair<MapRecords_t::iterator, bool> ret = mapRecords.insert(std::make_pair(hash, rtx));
-
-    MapRecords_t::iterator mri = ret.first;
-    rtxOrdered.insert(std::make_pair(rtx.GetTxTime(), mri));
-
-    // TODO: Spend only owned inputs?
-
-    return;
-};
-
-void CHDWallet::RemoveFromTxSpends(const uint256 &hash, const CTransactionRef pt)
-{
-    for (const auto &txin : pt->vin) {
-        std::pair<TxSpends::iterator, TxSpends::iterator> ip = mapTxSpends.equal_range(txin.prevout);
-        for (auto it = ip.first; it != ip.second; ) {
-            if (it->second == hash) {
-                mapTxSpends.erase(it++);
-                continue;
-            }
-            ++it;
-        }
-    }
-    return;
+    return true;
 };
 
-int CHDWallet::UnloadTransaction(const uint256 &hash)
+bool CHDWallet::ReadArchivedRecords(int64_t time_from, int64_t time_to, MapRecords_t &records) const
 {
-    // Remove txn from wallet, inc TxSpends
-    if (LogAcceptCategory(BCLog::HDWALLET)) {
-        WalletLogPrintf("%s: %s.\n", __func__, hash.ToString());
+    CHDWalletDB wdb(*database);
+    Dbc *pcursor;
+    if (!(pcursor = wdb.GetCursor())) {
+        return werror("%s: GetCursor failed.", __func__);
     }
 
-    MapWallet_t::iterator itw;
-    MapRecords_t::iterator itr;
-    if ((itw = mapWallet.find(hash)) != mapWallet.end()) {
-        CWalletTx *pcoin = &itw->second;
-
-        RemoveFromTxSpends(hash, pcoin->tx);
-
-        wtxOrdered.erase(pcoin->m_it_wtxOrdered);
+    CDataStream ssKey(SER_DISK, CLIENT_VERSION);
+    CDataStream ssValue(SER_DISK, CLIENT_VERSION);
+    std::string strType, sPrefix = "artx";
+    uint256 txhash;
 
-        mapWallet.erase(itw);
-    } else
-    if ((itr = mapRecords.find(hash)) != mapRecords.end()) {
-        CStoredTransaction stx;
-        if (!CHDWalletDB(*database).ReadStoredTx(hash, stx)) { // TODO: cache / use mapTempWallet
-            WalletLogPrintf("%s: ReadStoredTx failed for %s.\n", __func__, hash.ToString());
-        } else {
-            RemoveFromTxSpends(hash, stx.tx);
+    unsigned int fFlags = DB_SET_RANGE;
+    ssKey << sPrefix;
+    while (wdb.ReadAtCursor(pcursor, ssKey, ssValue, fFlags) == 0) {
+        fFlags = DB_NEXT;
+        ssKey >> strType;
+        if (strType != sPrefix) {
+            break;
         }
+        ssKey >> txhash;
 
-        for (auto it = rtxOrdered.cbegin(); it != rtxOrdered.cend(); ) {
-            //if (it->second->first == hash)
-            if (it->second == itr) {
-                rtxOrdered.erase(it++);
-                break;
-            }
-            ++it;
+        CTransactionRecord rtx;
+        ssValue >> rtx;
+        const int64_t nTime = rtx.GetTxTime();
+        if (nTime < time_from || nTime > time_to) {
+            continue;
         }
-
-        mapRecords.erase(itr);
-    } else {
-        WalletLogPrintf("Warning: %s - tx not found in wallet! %s.\n", __func__, hash.ToString());
-        return 1;
+        Optional<int> block_height = chain().getBlockHeight(rtx.blockHash);
+        if (block_height) {
+            rtx.block_height = *block_height;
+        }
+        records.emplace(txhash, std::move(rtx));
     }
+    pcursor->close();
 
-    NotifyTransactionChanged(this, hash, CT_DELETED);
-    return 0;
+    return true;
 };
 
 int CHDWallet::GetDefaultConfidentialChain(CHDWalletDB *pwdb, CExtKeyAccount *&sea, CStoredExtKey *&pc)
@@ -6956,6 +7659,20 @@ int CHDWallet::ExtKeyUnlock(CStoredExtKey *sek, const CKeyingMaterial &vMKey)
     return 0;
 };
 
+int CHDWallet::ExtKeyUnlock(const std::vector<CStoredExtKey*> &keys, const CKeyingMaterial &vMKey)
+{
+    // Each key is decrypted in place and touches nothing else, cs_wallet is held by the caller throughout
+    std::atomic<bool> failed{false};
+    const int max_threads = std::min<int>(GetWalletLoadThreads(), keys.size() / 32 + 1);
+    WalletParallelFor(keys.size(), max_threads, "extkeyunlock", [&](size_t i) NO_THREAD_SAFETY_ANALYSIS {
+        if (0 != ExtKeyUnlock(keys[i], vMKey)) {
+            failed = true;
+        }
+    });
+
+    return failed ? werrorN(1, "ExtKeyUnlock failed.") : 0;
+};
+
 int CHDWallet::ExtKeyUnlock(const CKeyingMaterial &vMKey)
 {
     LogPrint(BCLog::HDWALLET, "ExtKeyUnlock.\n");
@@ -6967,11 +7684,48 @@ int CHDWallet::ExtKeyUnlock(const CKeyingMaterial &vMKey)
         }
     }
 
+    std::vector<CStoredExtKey*> keys;
+    keys.reserve(mapExtKeys.size());
     for (auto &mi : mapExtKeys) {
-        CStoredExtKey *sek = mi.second;
-        if (0 != ExtKeyUnlock(sek, vMKey)) {
+        keys.push_back(mi.second);
+    }
+
+    return ExtKeyUnlock(keys, vMKey);
+};
+
+int CHDWallet::ExtKeyUnlockDefault(const CKeyingMaterial &vMKey)
+{
+    LogPrint(BCLog::HDWALLET, "ExtKeyUnlockDefault.\n");
+
+    bool checked_key = false;
+    if (pEKMaster
+        && pEKMaster->nFlags & EAF_IS_CRYPTED) {
+        if (ExtKeyUnlock(pEKMaster, vMKey) != 0) {
+            return 1;
+        }
+        checked_key = true;
+    }
+
+    ExtKeyAccountMap::iterator mi = mapExtAccounts.find(idDefaultAccount);
+    if (mi != mapExtAccounts.end()) {
+        if (0 != ExtKeyUnlock(mi->second, vMKey)) {
             return werrorN(1, "ExtKeyUnlock failed.");
         }
+        checked_key = true;
+    }
+
+    // Without a master key or default account verify the passphrase against any other key
+    if (!checked_key) {
+        for (auto &mi : mapExtKeys) {
+            CStoredExtKey *sek = mi.second;
+            if (!sek->IsEncrypted()) {
+                continue;
+            }
+            if (0 != ExtKeyUnlock(sek, vMKey)) {
+                return werrorN(1, "ExtKeyUnlock failed.");
+            }
+            break;
+        }
     }
 
     return 0;
@@ -7219,6 +7973,7 @@ int CHDWallet::ExtKeyLoadLoose()
             ssKey >> ckeyId;
             ssValue >> ekl;
             mapLooseKeys[ckeyId] = ekl;
+            AddToLooseKeyFilter(ckeyId);
         }
         pcursor->close();
         WalletLogPrintf("Loaded %d loose extkey derived keys.\n", mapLooseKeys.size());
@@ -7295,19 +8050,19 @@ int CHDWallet::ExtKeyAddLookAhead(CStoredExtKey *sek) const
 
     WalletLogPrintf("Adding %d keys to lookahead for loose chain %s from %d.\n", nLookAhead - nStart, HDKeyIDToString(idk), nChild);
 
+    CExtKeyDeriveCache derived(sek, nChild, nLookAhead > nStart ? nLookAhead - nStart : 0, GetWalletLoadThreads());
     for (uint32_t k = nStart; k < (uint32_t)nLookAhead; ++k) {
         bool fGotKey = false;
 
         uint32_t nMaxTries = 1000; // TODO: link to lookahead size
         for (uint32_t i = 0; i < nMaxTries; ++i) { // nMaxTries > lookahead pool
-            if (sek->DeriveKey(pk, nChild, nChildOut, false) != 0) {
+            if (derived.DeriveKey(pk, derivedId, nChild, nChildOut) != 0) {
                 WalletLogPrintf("Warning: %s - DeriveKey failed, chain %s, child %d.\n", __func__, HDKeyIDToString(idk), nChild);
                 nChild = nChildOut + 1;
                 continue;
             }
             nChild = nChildOut + 1;
 
-            derivedId = pk.GetID();
             if ((mi = mapLooseKeys.find(derivedId)) != mapLooseKeys.end()) {
                 if (LogAcceptCategory(BCLog::HDWALLET)) {
                     WalletLogPrintf("%s: key exists in map skipping %s.\n", __func__, EncodeDestination(PKHash(derivedId)));
@@ -7329,6 +8084,7 @@ int CHDWallet::ExtKeyAddLookAhead(CStoredExtKey *sek) const
         }
 
         mapLooseLookAhead[derivedId] = CEKLKey(idk, nChildOut);
+        AddToLooseKeyFilter(derivedId);
         sek->nLastLookAhead = nChildOut;
 
         if (LogAcceptCategory(BCLog::HDWALLET)) {
@@ -7357,6 +8113,7 @@ int CHDWallet::ExtKeyPromoteKey(CStoredExtKey *sek, uint32_t nChildKey) const
                 WalletLogPrintf("Promoting child key %d %s from loose extkey %s lookahead.\n",
                                 it->second.nKey, EncodeDestination(PKHash(it->first)), sek->GetIDString58());
                 mapLooseKeys[it->first] = it->second;
+                AddToLooseKeyFilter(it->first);
                 wdb.WriteEKLKey(it->first, it->second);
             }
             it = mapLooseLookAhead.erase(it);
@@ -7515,6 +8272,7 @@ int CHDWallet::ExtKeyLoadAccountPacks()
         for (it = ekPak.begin(); it != ekPak.end(); ++it) {
             nKeys++;
             sea->mapKeys[it->id] = it->ak;
+            sea->AddToKeyFilter(it->id);
         }
     }
 
@@ -7593,6 +8351,7 @@ int CHDWallet::ExtKeyLoadAccountPacks()
         for (auto it = asckPak.begin(); it != asckPak.end(); ++it) {
             nStealthChildKeys++;
             sea->mapStealthChildKeys[it->id] = it->asck;
+            sea->AddToKeyFilter(it->id);
         }
     }
 
@@ -7623,7 +8382,7 @@ int CHDWallet::PrepareLookahead()
                     nLookAhead = GetCompressedInt64(itV->second, nLookAhead);
                 }
 
-                sea->AddLookAhead(i, (uint32_t)nLookAhead);
+                sea->AddLookAhead(i, (uint32_t)nLookAhead, GetWalletLoadThreads());
             }
         }
     }
@@ -7710,6 +8469,7 @@ int CHDWallet::ExtKeySaveKey(CHDWalletDB *pwdb, CExtKeyAccount *sea, const CKeyI
         }
 
         sea->mapKeys[keyId] = ak;
+        sea->AddToKeyFilter(keyId);
         if (0 != ExtKeyAppendToPack(pwdb, sea, keyId, ak, fUpdateAccTmp)) {
             return werrorN(1, "%s ExtKeyAppendToPack failed.", __func__);
         }
@@ -7740,6 +8500,7 @@ int CHDWallet::ExtKeySaveKey(CHDWalletDB *pwdb, CExtKeyAccount *sea, const CKeyI
 
                     CEKAKey akExtra(nChain, nChildOut);
                     sea->mapKeys[idkExtra] = akExtra;
+                    sea->AddToKeyFilter(idkExtra);
                     if (0 != ExtKeyAppendToPack(pwdb, sea, idkExtra, akExtra, fUpdateAccTmp)) {
                         return werrorN(1, "%s ExtKeyAppendToPack failed.", __func__);
                     }
@@ -8877,10 +9638,17 @@ bool CHDWallet::SignTransaction(CMutableTransaction &tx) const
 {
     AssertLockHeld(cs_wallet); // mapWallet
 
-    // sign the new tx
-    int nIn = 0;
-    for (auto& input : tx.vin) {
-        CScript scriptPubKey;
+    auto provider = GetLegacyScriptPubKeyMan();
+    if (!provider) {
+        return false;
+    }
+
+    // Find the prevouts and keys under cs_wallet, then sign the inputs in parallel
+    std::vector<std::pair<CScript, std::vector<uint8_t>>> prevouts(tx.vin.size());
+    FlatSigningProvider keys;
+    for (size_t nIn = 0; nIn < tx.vin.size(); ++nIn) {
+        const CTxIn &input = tx.vin[nIn];
+        CScript &scriptPubKey = prevouts[nIn].first;
         CAmount amount;
 
         MapWallet_t::const_iterator mi = mapWallet.find(input.prevout.hash);
@@ -8916,19 +9684,25 @@ bool CHDWallet::SignTransaction(CMutableTransaction &tx) const
             amount = oR->nValue;
         }
 
-        SignatureData sigdata;
-
-        std::vector<uint8_t> vchAmount(8);
+        std::vector<uint8_t> &vchAmount = prevouts[nIn].second;
+        vchAmount.resize(8);
         part::SetAmount(vchAmount, amount);
-        auto provider = GetLegacyScriptPubKeyMan();
-        if (!provider) {
-            return false;
-        }
-        if (!ProduceSignature(*provider, MutableTransactionSignatureCreator(&tx, nIn, vchAmount, SIGHASH_ALL), scriptPubKey, sigdata)) {
-            return false;
+        GatherSigningProvider(*provider, MutableTransactionSignatureCreator(&tx, nIn, vchAmount, SIGHASH_ALL), scriptPubKey, SignatureData(), keys);
+    }
+
+    const PrecomputedTransactionData txdata(tx);
+    std::vector<SignatureData> sigdata(tx.vin.size());
+    std::atomic<bool> signed_all{true};
+    g_task_pool.ParallelFor(TaskPriority::HIGH, tx.vin.size(), [&](size_t nIn) {
+        if (!ProduceSignature(keys, MutableTransactionSignatureCreator(&tx, nIn, prevouts[nIn].second, SIGHASH_ALL, &txdata), prevouts[nIn].first, sigdata[nIn])) {
+            signed_all = false;
         }
-        UpdateInput(input, sigdata);
-        nIn++;
+    });
+    if (!signed_all) {
+        return false;
+    }
+    for (size_t nIn = 0; nIn < tx.vin.size(); ++nIn) {
+        UpdateInput(tx.vin[nIn], sigdata[nIn]);
     }
     return true;
 }
@@ -9375,10 +10149,76 @@ bool CHDWallet::GetStealthSecret(const CStealthAddress &sx, CKey &key_out) const
     return false;
 };
 
-bool CHDWallet::ProcessLockedStealthOutputs()
+void CHDWallet::ProcessLockedExtKeys()
+{
+    std::vector<CKeyID> pending;
+    {
+        LOCK(cs_wallet);
+        for (const auto &mi : mapExtKeys) {
+            if (mi.second->IsEncrypted() && mi.second->fLocked) {
+                pending.push_back(mi.first);
+            }
+        }
+    }
+
+    const int64_t nStartTime = GetTimeMillis();
+    std::vector<CStoredExtKey*> keys;
+    for (size_t i = 0; i < pending.size(); i += EXT_KEY_UNLOCK_BATCH_SIZE) {
+        LOCK(cs_wallet);
+        if (IsLocked()) {
+            return; // Remaining keys are decrypted on the next unlock
+        }
+        keys.clear();
+        for (size_t k = i; k < std::min(pending.size(), i + EXT_KEY_UNLOCK_BATCH_SIZE); ++k) {
+            ExtKeyMap::iterator mi = mapExtKeys.find(pending[k]);
+            if (mi != mapExtKeys.end() && mi->second->fLocked) {
+                keys.push_back(mi->second);
+            }
+        }
+        if (0 != ExtKeyUnlock(keys, vMasterKey)) {
+            WalletLogPrintf("%s: Failed to decrypt all ext keys.\n", __func__);
+        }
+    }
+
+    LogPrint(BCLog::HDWALLET, "%s: Decrypted %u ext keys in %dms.\n", __func__, pending.size(), GetTimeMillis() - nStartTime);
+};
+
+void CHDWallet::ProcessLockedOutputs()
+{
+    CKeyID resume_after;
+    int64_t earliest_anon_out_time = std::numeric_limits<int64_t>::max();
+    bool more_keys = true, more_outputs = true;
+    while (more_keys || more_outputs) {
+        LOCK(cs_wallet);
+        if (IsLocked()) {
+            return; // Remaining entries are processed on the next unlock
+        }
+        if (more_keys && !ProcessLockedStealthOutputs(LOCKED_OUTPUTS_BATCH_SIZE, resume_after, more_keys)) {
+            more_keys = false;
+        }
+        if (more_outputs && !ProcessLockedBlindedOutputs(LOCKED_OUTPUTS_BATCH_SIZE, more_outputs, earliest_anon_out_time)) {
+            more_outputs = false;
+        }
+    }
+
+    // Trigger a rescan from the deepest anon out, spend info may need to be updated
+    // Only possible if outputs were spent from a different wallet.
+    if (!m_is_only_instance
+        && earliest_anon_out_time != std::numeric_limits<int64_t>::max()) {
+        WalletRescanReserver reserver(*this);
+        if (!reserver.reserve()) {
+            WalletLogPrintf("%s: Wallet is currently rescanning.\n", __func__);
+        } else {
+            RescanFromTime(earliest_anon_out_time, reserver, true);
+        }
+    }
+};
+
+bool CHDWallet::ProcessLockedStealthOutputs(size_t max_keys, CKeyID &resume_after, bool &more)
 {
     LogPrint(BCLog::HDWALLET, "%s %s\n", GetDisplayName(), __func__);
     AssertLockHeld(cs_wallet);
+    more = false;
 
     CHDWalletDB wdb(*database);
 
@@ -9403,7 +10243,8 @@ bool CHDWallet::ProcessLockedStealthOutputs()
     size_t nProcessed = 0; // incl any failed attempts
     size_t nExpanded = 0;
     unsigned int fFlags = DB_SET_RANGE;
-    ssKey << std::string("sxkm");
+    // Failed entries stay queued, continue from the last key seen
+    ssKey << std::string("sxkm") << resume_after;
     while (wdb.ReadAtCursor(pcursor, ssKey, ssValue, fFlags) == 0) {
         fFlags = DB_NEXT;
         ssKey >> strType;
@@ -9411,9 +10252,17 @@ bool CHDWallet::ProcessLockedStealthOutputs()
             break;
         }
 
+        ssKey >> idk;
+        if (idk == resume_after && !idk.IsNull()) {
+            continue;
+        }
+        if (nProcessed >= max_keys) {
+            more = true;
+            break;
+        }
         nProcessed++;
+        resume_after = idk;
 
-        ssKey >> idk;
         ssValue >> sxKeyMeta;
 
         if (!GetPubKey(idk, pk)) {
@@ -9510,15 +10359,16 @@ bool CHDWallet::ProcessLockedStealthOutputs()
     return true;
 };
 
-bool CHDWallet::ProcessLockedBlindedOutputs()
+bool CHDWallet::ProcessLockedBlindedOutputs(size_t max_outputs, bool &more, int64_t &earliest_anon_out_time)
 {
     LogPrint(BCLog::HDWALLET, "%s %s\n", GetDisplayName(), __func__);
     AssertLockHeld(cs_wallet);
+    more = false;
 
     size_t nProcessed = 0; // incl any failed attempts
     size_t nExpanded = 0;
     std::set<uint256> setChanged;
-    int64_t earliest_anon_out_time = std::numeric_limits<int64_t>::max();
+    std::map<uint256, CStoredTransaction> mapStx; // Written once per txn at the end of the batch
 
     {
     CHDWalletDB wdb(*database);
@@ -9537,7 +10387,6 @@ bool CHDWallet::ProcessLockedBlindedOutputs()
     COutPoint op;
     std::string strType;
 
-    CStoredTransaction stx;
     unsigned int fFlags = DB_SET_RANGE;
     ssKey << std::string("lao");
     while (wdb.ReadKeyAtCursor(pcursor, ssKey, fFlags) == 0) {
@@ -9547,6 +10396,10 @@ bool CHDWallet::ProcessLockedBlindedOutputs()
             break;
         }
 
+        if (nProcessed >= max_outputs) {
+            more = true;
+            break;
+        }
         nProcessed++;
 
         ssKey >> op;
@@ -9559,12 +10412,20 @@ bool CHDWallet::ProcessLockedBlindedOutputs()
         MapRecords_t::iterator mir;
 
         mir = mapRecords.find(op.hash);
+        auto msi = mapStx.find(op.hash);
+        if (mir != mapRecords.end() && msi == mapStx.end()) {
+            CStoredTransaction stx_read;
+            if (wdb.ReadStoredTx(op.hash, stx_read)) {
+                msi = mapStx.emplace(op.hash, std::move(stx_read)).first;
+            }
+        }
         if (mir == mapRecords.end()
-            || !wdb.ReadStoredTx(op.hash, stx)) {
+            || msi == mapStx.end()) {
             WalletLogPrintf("%s: Error: mapRecord not found for %s.\n", __func__, op.ToString());
             continue;
         }
         CTransactionRecord &rtx = mir->second;
+        CStoredTransaction &stx = msi->second;
 
         if (stx.tx->vpout.size() < op.n) {
             WalletLogPrintf("%s: Error: Outpoint doesn't exist %s.\n", __func__, op.ToString());
@@ -9610,16 +10471,6 @@ bool CHDWallet::ProcessLockedBlindedOutputs()
         }
 
         if (fUpdated) {
-            // If txn has change, it must have been sent by this wallet
-            if (rtx.HaveChange()) {
-                ProcessPlaceholder(*stx.tx.get(), rtx);
-            }
-
-            if (!wdb.WriteTxRecord(op.hash, rtx)
-                || !wdb.WriteStoredTx(op.hash, stx)) {
-                return false;
-            }
-
             setChanged.insert(op.hash);
         }
 
@@ -9628,21 +10479,24 @@ bool CHDWallet::ProcessLockedBlindedOutputs()
 
     pcursor->close();
 
-    wdb.TxnCommit();
-    }
+    for (const auto &txhash : setChanged) {
+        CTransactionRecord &rtx = mapRecords[txhash];
+        const CStoredTransaction &stx = mapStx[txhash];
+        // If txn has change, it must have been sent by this wallet
+        if (rtx.HaveChange()) {
+            ProcessPlaceholder(*stx.tx.get(), rtx);
+        }
 
-    // Trigger a rescan from the deepest anon out, spend info may need to be updated
-    // Only possible if outputs were spent from a different wallet.
-    if (!m_is_only_instance
-        && earliest_anon_out_time != std::numeric_limits<int64_t>::max()) {
-        WalletRescanReserver reserver(*this);
-        if (!reserver.reserve()) {
-            WalletLogPrintf("%s: Wallet is currently rescanning.\n", __func__);
-        } else {
-            RescanFromTime(earliest_anon_out_time, reserver, true);
+        if (!wdb.WriteTxRecord(txhash, rtx)
+            || !wdb.WriteStoredTx(txhash, stx)) {
+            wdb.TxnAbort();
+            return false;
         }
     }
 
+    wdb.TxnCommit();
+    }
+
     // Notify UI of updated transaction
     for (const auto &hash : setChanged) {
         NotifyTransactionChanged(this, hash, CT_REPLACE);
@@ -9689,20 +10543,6 @@ bool CHDWallet::CountRecords(std::string sPrefix, int64_t rv)
     return true;
 };
 
-inline bool MatchPrefix(uint32_t nAddrBits, uint32_t addrPrefix, uint32_t outputPrefix, bool fHavePrefix)
-{
-    if (nAddrBits < 1) { // addresses without prefixes scan all incoming stealth outputs
-        return true;
-    }
-    if (!fHavePrefix) { // don't check when address has a prefix and no prefix on output
-        return false;
-    }
-
-    uint32_t mask = SetStealthMask(nAddrBits);
-
-    return (addrPrefix & mask) == (outputPrefix & mask);
-};
-
 void CHDWallet::ProcessStealthLookahead(CExtKeyAccount *ea, const CEKAStealthKey &aks, bool v2)
 {
     auto &use_set = v2 ? ea->setLookAheadStealthV2 : ea->setLookAheadStealth;
@@ -9789,6 +10629,25 @@ void CHDWallet::ProcessStealthLookahead(CExtKeyAccount *ea, const CEKAStealthKey
     }
 };
 
+bool CHDWallet::GetStealthSpendPoint(const ec_point &pkSpend, secp256k1_pubkey &out)
+{
+    AssertLockHeld(cs_wallet);
+
+    auto mi = m_stealth_spend_points.find(pkSpend);
+    if (mi != m_stealth_spend_points.end()) {
+        out = mi->second;
+        return true;
+    }
+    if (!StealthParsePoint(pkSpend, out)) {
+        return false;
+    }
+    if (m_stealth_spend_points.size() >= MAX_STEALTH_SPEND_POINTS) {
+        m_stealth_spend_points.clear();
+    }
+    m_stealth_spend_points.emplace(pkSpend, out);
+    return true;
+};
+
 bool CHDWallet::ProcessStealthOutput(const CTxDestination &address,
     std::vector<uint8_t> &vchEphemPK, uint32_t prefix, bool fHavePrefix, CKey &sShared, bool fNeedShared)
 {
@@ -9810,9 +10669,20 @@ bool CHDWallet::ProcessStealthOutput(const CTxDestination &address,
         return true;
     }
 
+    // Points are only parsed once a candidate passes the prefix filter,
+    // the ephemeral key once per output and spend keys once per wallet.
+    secp256k1_pubkey ephem_point, spend_point;
+    int ephem_parsed = 0;
+    auto GetEphemPoint = [&]() {
+        if (ephem_parsed == 0) {
+            ephem_parsed = StealthParsePoint(vchEphemPK, ephem_point) ? 1 : -1;
+        }
+        return ephem_parsed == 1;
+    };
+
     std::set<CStealthAddress>::iterator it;
     for (it = stealthAddresses.begin(); it != stealthAddresses.end(); ++it) {
-        if (!MatchPrefix(it->prefix.number_bits, it->prefix.bitfield, prefix, fHavePrefix)) {
+        if (!MatchStealthPrefix(it->prefix.number_bits, it->prefix.bitfield, prefix, fHavePrefix)) {
             continue;
         }
 
@@ -9820,7 +10690,9 @@ bool CHDWallet::ProcessStealthOutput(const CTxDestination &address,
             continue; // stealth address is not owned
         }
 
-        if (StealthSecret(it->scan_secret, vchEphemPK, it->spend_pubkey, sShared, pkExtracted) != 0) {
+        if (!GetEphemPoint()
+            || !GetStealthSpendPoint(it->spend_pubkey, spend_point)
+            || StealthSecret(it->scan_secret, ephem_point, spend_point, sShared, pkExtracted) != 0) {
             WalletLogPrintf("%s: StealthSecret failed.\n", __func__);
             continue;
         }
@@ -9934,13 +10806,15 @@ bool CHDWallet::ProcessStealthOutput(const CTxDestination &address,
         for (auto it = ea->mapStealthKeys.cbegin(); it != ea->mapStealthKeys.cend(); ++it) {
             const CEKAStealthKey &aks = it->second;
 
-            if (!MatchPrefix(aks.nPrefixBits, aks.nPrefix, prefix, fHavePrefix)) {
+            if (!MatchStealthPrefix(aks.nPrefixBits, aks.nPrefix, prefix, fHavePrefix)) {
                 continue;
             }
             if (!aks.skScan.IsValid()) {
                 continue;
             }
-            if (StealthSecret(aks.skScan, vchEphemPK, aks.pkSpend, sShared, pkExtracted) != 0) {
+            if (!GetEphemPoint()
+                || !GetStealthSpendPoint(aks.pkSpend, spend_point)
+                || StealthSecret(aks.skScan, ephem_point, spend_point, sShared, pkExtracted) != 0) {
                 WalletLogPrintf("%s: StealthSecret failed.\n", __func__);
                 continue;
             }
@@ -10345,6 +11219,8 @@ void CHDWallet::AddToSpends(const uint256& wtxid)
     auto it = mapWallet.find(wtxid);
     assert(it != mapWallet.end());
     CWalletTx& thisTx = it->second;
+    MarkStakeCandidatesDirty(*thisTx.tx);
+    MarkBalancesDirty(wtxid);
     if (thisTx.IsCoinBase()) // Coinbases don't spend anything!
         return;
 
@@ -10448,6 +11324,11 @@ bool CHDWallet::AddToWalletIfInvolvingMe(const CTransactionRef& ptx, CWalletTx::
             bool fExisted = mapRecords.count(tx.GetHash()) != 0;
             if (fExisted && !fUpdate) return false;
 
+            if (!fExisted && (fIsMine || fIsFromMe)
+                && CHDWalletDB(*database).HaveArchivedTxRecord(tx.GetHash())) {
+                return false; // Found again by a rescan
+            }
+
             if (fExisted || fIsMine || fIsFromMe) {
                 CTransactionRecord rtx;
                 bool rv = AddToRecord(rtx, tx, confirm, false);
@@ -10485,6 +11366,7 @@ bool CHDWallet::AddToWalletIfInvolvingMe(const CTransactionRef& ptx, CWalletTx::
             if (!mapNarr.empty()) {
                 wtx.mapValue.insert(mapNarr.begin(), mapNarr.end());
             }
+            MarkBalancesDirty(tx.GetHash());
 
             if (!confirm.hashBlock.IsNull()) {
                 WakeThreadStakeMiner(this);
@@ -10555,7 +11437,7 @@ int CHDWallet::InsertTempTxn(const uint256 &txid, const CTransactionRecord *rtx)
     LOCK(cs_wallet);
 
     CStoredTransaction stx;
-    if (!CHDWalletDB(*database).ReadStoredTx(txid, stx)) {
+    if (!ReadStoredTx(txid, stx)) {
         return werrorN(1, "%s: ReadStoredTx failed for %s.\n", __func__, txid.ToString().c_str());
     }
 
@@ -10756,6 +11638,16 @@ int CHDWallet::OwnBlindOut(CHDWalletDB *pwdb, const uint256 &txhash, const CTxOu
     memset(msg, 0, mlen);
     uint64_t amountOut = 0;
 
+    const auto mro = m_rewound_outputs.find(COutPoint(txhash, rout.n));
+    if (mro != m_rewound_outputs.end() && mro->second.nonce == nonce) {
+        amountOut = mro->second.value;
+        memcpy(blindOut, mro->second.blind, 32);
+        if (pout->vRangeproof.size() < 1000) {
+            ExtractNarration(nonce, pout->vData, rout.sNarration);
+        } else {
+            rout.sNarration = mro->second.message;
+        }
+    } else
     if (pout->vRangeproof.size() < 1000) {
         int rewind_rv = 0;
         if (!nonce.IsNull()) {
@@ -10892,6 +11784,16 @@ int CHDWallet::OwnAnonOut(CHDWalletDB *pwdb, const uint256 &txhash, const CTxOut
     memset(msg, 0, mlen);
     uint64_t amountOut = 0;
 
+    const auto mro = m_rewound_outputs.find(COutPoint(txhash, rout.n));
+    if (mro != m_rewound_outputs.end() && mro->second.nonce == nonce) {
+        amountOut = mro->second.value;
+        memcpy(blindOut, mro->second.blind, 32);
+        if (pout->vRangeproof.size() < 1000) {
+            ExtractNarration(nonce, pout->vData, rout.sNarration);
+        } else {
+            rout.sNarration = mro->second.message;
+        }
+    } else
     if (pout->vRangeproof.size() < 1000) {
         int rewind_rv = 0;
         if (!nonce.IsNull()) {
@@ -10979,13 +11881,81 @@ int CHDWallet::OwnAnonOut(CHDWalletDB *pwdb, const uint256 &txhash, const CTxOut
         WalletLogPrintf("Error: %s - WriteAnonKeyImage failed.\n", __func__);
     }
 
-    rout.nValue = amountOut;
-    rout.nFlags &= ~ORF_LOCKED;
+    rout.nValue = amountOut;
+    rout.nFlags &= ~ORF_LOCKED;
+
+    stx.InsertBlind(rout.n, blindOut);
+    fUpdated = true;
+
+    return 1;
+};
+
+void CHDWallet::GetOwnedRewinds(const CTransaction &tx, std::vector<RangeProofRewind> &rewinds)
+{
+    for (size_t i = 0; i < tx.vpout.size(); ++i) {
+        const CTxOutBase *txout = tx.vpout[i].get();
+        CKeyID idk;
+        if (txout->IsType(OUTPUT_CT)) {
+            const CEKAKey *pak = nullptr;
+            const CEKASCKey *pasc = nullptr;
+            CExtKeyAccount *pa = nullptr;
+            bool isInvalid = false;
+            if (!(IsMine(((CTxOutCT*)txout)->scriptPubKey, idk, pak, pasc, pa, isInvalid) & ISMINE_SPENDABLE)) {
+                continue;
+            }
+        } else
+        if (txout->IsType(OUTPUT_RINGCT)) {
+            idk = ((CTxOutRingCT*)txout)->pk.GetID();
+        } else {
+            continue;
+        }
+
+        const std::vector<uint8_t> *pvData = txout->GetPData();
+        CKey key;
+        if (!pvData || pvData->size() < 33 || !GetKey(idk, key)) {
+            continue;
+        }
+        CPubKey pkEphem;
+        pkEphem.Set(pvData->begin(), pvData->begin() + 33);
+        uint256 nonce = key.ECDH(pkEphem);
+        CSHA256().Write(nonce.begin(), 32).Finalize(nonce.begin());
+        rewinds.emplace_back(txout, i, nonce);
+    }
+};
+
+void CHDWallet::PrepareScanBlock(const CBlock &block)
+{
+    m_rewound_outputs.clear();
+    if (IsLocked()) {
+        return;
+    }
 
-    stx.InsertBlind(rout.n, blindOut);
-    fUpdated = true;
+    std::vector<RangeProofRewind> rewinds;
+    std::vector<std::pair<size_t, uint256>> tx_ends; // End of each txn's rewinds
+    for (const auto &tx : block.vtx) {
+        if (!tx->IsParticlVersion()) {
+            continue;
+        }
+        size_t num_before = rewinds.size();
+        GetOwnedRewinds(*tx, rewinds);
+        if (rewinds.size() > num_before) {
+            tx_ends.emplace_back(rewinds.size(), tx->GetHash());
+        }
+    }
+    if (rewinds.size() < 2) {
+        // Nothing to gain over rewinding in OwnBlindOut
+        return;
+    }
 
-    return 1;
+    RewindRangeProofs(rewinds);
+    size_t k = 0;
+    for (const auto &tx_end : tx_ends) {
+        for (; k < tx_end.first; ++k) {
+            if (rewinds[k].rewound) {
+                m_rewound_outputs.emplace(COutPoint(tx_end.second, rewinds[k].n), rewinds[k]);
+            }
+        }
+    }
 };
 
 bool CHDWallet::ProcessPlaceholder(const CTransaction &tx, CTransactionRecord &rtx)
@@ -11154,7 +12124,7 @@ bool CHDWallet::AddToRecord(CTransactionRecord &rtxIn, const CTransaction &tx, C
     }
 
     CStoredTransaction stx;
-    if (!wdb.ReadStoredTx(txhash, stx)) {
+    if (!ReadStoredTx(txhash, stx)) {
         stx.vBlinds.clear();
     }
 
@@ -11256,8 +12226,7 @@ bool CHDWallet::AddToRecord(CTransactionRecord &rtxIn, const CTransaction &tx, C
         }
 
         stx.tx = MakeTransactionRef(tx);
-        if (!wdb.WriteTxRecord(txhash, rtx)
-            || !wdb.WriteStoredTx(txhash, stx)) {
+        if (!WriteTxRecordAndStx(&wdb, txhash, rtx, stx)) {
             return false;
         }
     }
@@ -11278,7 +12247,12 @@ bool CHDWallet::AddToRecord(CTransactionRecord &rtxIn, const CTransaction &tx, C
 #endif
 
     std::string sName = GetName();
-    GetMainSignals().TransactionAddedToWallet(sName, MakeTransactionRef(tx));
+    // Listeners get the record with the amounts of owned blinded outputs
+    CDataStream ssRecord(SER_DISK, CLIENT_VERSION);
+    ssRecord << rtx;
+    GetMainSignals().TransactionAddedToWallet(sName, MakeTransactionRef(tx), ssRecord.str());
+    MarkStakeCandidatesDirty(tx);
+    MarkBalancesDirty(txhash);
     ClearCachedBalances();
 
     return true;
@@ -11353,6 +12327,11 @@ CWallet::ScanResult CHDWallet::ScanForWalletTransactions(const uint256& start_bl
     }
 
     ScanResult rv = CWallet::ScanForWalletTransactions(start_block, start_height, max_height, reserver, fUpdate);
+    WITH_LOCK(cs_wallet, m_rewound_outputs.clear());
+    // Outputs of known txns can become stakeable from new keys
+    m_have_stake_candidates = false;
+    WITH_LOCK(cs_wallet, m_balance_rebuild = true; m_have_unspent_records = false);
+    m_state_version++;
 
     // Remove lookahead keys
     if (sea) {
@@ -11369,26 +12348,64 @@ CWallet::ScanResult CHDWallet::ScanForWalletTransactions(const uint256& start_bl
     return rv;
 };
 
+void CHDWallet::RefreshUnconfirmedTxns()
+{
+    AssertLockHeld(cs_wallet);
+    if (m_have_unconfirmed_txns) {
+        return;
+    }
+
+    m_unconfirmed_txns.clear();
+    for (const auto &item : mapWallet) {
+        if (!item.second.isAbandoned() && item.second.GetDepthInMainChain() == 0) {
+            m_unconfirmed_txns.insert(item.first);
+        }
+    }
+    for (const auto &ri : mapRecords) {
+        if (!ri.second.IsAbandoned() && GetDepthInMainChain(ri.second) == 0) {
+            m_unconfirmed_txns.insert(ri.first);
+        }
+    }
+    m_have_unconfirmed_txns = true;
+};
+
 std::vector<uint256> CHDWallet::ResendRecordTransactionsBefore(int64_t nTime)
 {
     std::vector<uint256> result;
 
     LOCK(cs_wallet);
-
-    for (RtxOrdered_t::iterator it = rtxOrdered.begin(); it != rtxOrdered.end(); ++it) {
-        if (it->first > nTime) {
+    RefreshUnconfirmedTxns();
+
+    // Submit in the order received so parents are in the mempool before their children
+    std::vector<std::pair<int64_t, MapRecords_t::iterator> > vPending;
+    for (auto it = m_unconfirmed_txns.begin(); it != m_unconfirmed_txns.end(); ) {
+        MapRecords_t::iterator mri = mapRecords.find(*it);
+        if (mri == mapRecords.end()) {
+            if (mapWallet.count(*it) == 0) {
+                it = m_unconfirmed_txns.erase(it);
+                continue;
+            }
+            ++it;
             continue;
         }
-
-        const uint256 &txhash = it->second->first;
-        CTransactionRecord &rtx = it->second->second;
-
-        if (rtx.IsAbandoned()) {
+        const CTransactionRecord &rtx = mri->second;
+        if (rtx.IsAbandoned() || GetDepthInMainChain(rtx) != 0) {
+            it = m_unconfirmed_txns.erase(it);
             continue;
         }
-        if (GetDepthInMainChain(rtx) != 0) {
-            continue;
+        if (rtx.GetTxTime() <= nTime) {
+            vPending.emplace_back(rtx.GetTxTime(), mri);
         }
+        ++it;
+    }
+    std::stable_sort(vPending.begin(), vPending.end(),
+        [](const std::pair<int64_t, MapRecords_t::iterator> &a, const std::pair<int64_t, MapRecords_t::iterator> &b) {
+            return a.first < b.first;
+        });
+
+    for (const auto &pending : vPending) {
+        const uint256 &txhash = pending.second->first;
+        CTransactionRecord &rtx = pending.second->second;
 
         MapWallet_t::iterator twi = mapTempWallet.find(txhash);
         if (twi == mapTempWallet.end()) {
@@ -11427,15 +12444,34 @@ void CHDWallet::ResendWalletTransactions()
 
     {
         LOCK(cs_wallet);
+        RefreshUnconfirmedTxns();
 
         // Relay transactions
-        for (std::pair<const uint256, CWalletTx>& item : mapWallet) {
-            CWalletTx& wtx = item.second;
+        std::vector<CWalletTx*> vPending;
+        for (auto it = m_unconfirmed_txns.begin(); it != m_unconfirmed_txns.end(); ) {
+            MapWallet_t::iterator mwi = mapWallet.find(*it);
+            if (mwi == mapWallet.end()) {
+                ++it; // Records are handled by ResendRecordTransactionsBefore
+                continue;
+            }
+            CWalletTx &wtx = mwi->second;
+            if (wtx.isAbandoned() || wtx.GetDepthInMainChain() != 0) {
+                it = m_unconfirmed_txns.erase(it);
+                continue;
+            }
             // only rebroadcast unconfirmed txes older than 5 minutes before the
             // last block was found
-            if (wtx.nTimeReceived > m_best_block_time - 5 * 60) continue;
+            if (wtx.nTimeReceived <= m_best_block_time - 5 * 60) {
+                vPending.push_back(&wtx);
+            }
+            ++it;
+        }
+        std::stable_sort(vPending.begin(), vPending.end(), [](const CWalletTx *a, const CWalletTx *b) {
+            return a->nTimeReceived < b->nTimeReceived;
+        });
+        for (CWalletTx *pwtx : vPending) {
             std::string unused_err_string;
-            if (wtx.SubmitMemoryPoolAndRelay(unused_err_string, true)) ++relayed_tx_count;
+            if (pwtx->SubmitMemoryPoolAndRelay(unused_err_string, true)) ++relayed_tx_count;
         }
 
         std::vector<uint256> relayed_records = ResendRecordTransactionsBefore(m_best_block_time - 5 * 60);
@@ -11816,8 +12852,10 @@ void CHDWallet::AvailableBlindedCoins(std::vector<COutputR>& vCoins, bool fOnlyS
     bool allow_used_addresses = !IsWalletFlagSet(WALLET_FLAG_AVOID_REUSE) || (coinControl && !coinControl->m_avoid_address_reuse);
 
     const Consensus::Params &consensusParams = Params().GetConsensus();
-    for (MapRecords_t::const_iterator it = mapRecords.begin(); it != mapRecords.end(); ++it) {
-        const uint256 &txid = it->first;
+    for (const auto &unspent : GetUnspentRecords(OUTPUT_CT)) {
+        const uint256 &txid = unspent.first;
+        MapRecords_t::const_iterator it = mapRecords.find(txid);
+        assert(it != mapRecords.end());
         const CTransactionRecord &rtx = it->second;
 
         if (rtx.block_height > 0) { // height 0 is mempool
@@ -11920,7 +12958,7 @@ void CHDWallet::AvailableBlindedCoins(std::vector<COutputR>& vCoins, bool fOnlyS
     return;
 };
 
-bool CHDWallet::SelectBlindedCoins(const std::vector<COutputR> &vAvailableCoins, const CAmount &nTargetValue, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet, const CCoinControl *coinControl, bool random_selection) const
+bool CHDWallet::SelectBlindedCoins(const std::vector<COutputR> &vAvailableCoins, const CAmount &nTargetValue, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet, const CCoinControl *coinControl, bool random_selection, const BlindedSelectionParams *bnb_params) const
 {
     std::vector<COutputR> vCoins(vAvailableCoins);
 
@@ -11981,6 +13019,13 @@ bool CHDWallet::SelectBlindedCoins(const std::vector<COutputR> &vAvailableCoins,
     size_t max_descendants = (size_t)std::max<int64_t>(1, gArgs.GetArg("-limitdescendantcount", DEFAULT_DESCENDANT_LIMIT));
     bool fRejectLongChains = gArgs.GetBoolArg("-walletrejectlongchains", DEFAULT_WALLET_REJECT_LONG_CHAINS);
     bool res = nTargetValue <= nValueFromPresetInputs;
+    if (!res && bnb_params) {
+        // Preset inputs pay their own share of the fee
+        BlindedSelectionParams params = *bnb_params;
+        params.target -= nValueFromPresetInputs - (CAmount)vPresetCoins.size() * params.input_fee;
+        const CoinEligibilityFilter filter_standard(1, 6, 0);
+        res = SelectBlindedCoinsBnB(nTargetValue - nValueFromPresetInputs, random_selection ? nullptr : &filter_standard, params, vCoins, setCoinsRet, nValueRet);
+    }
     if (!res) {
         if (random_selection) {
             Shuffle(vCoins.begin(), vCoins.end(), FastRandomContext());
@@ -12071,8 +13116,10 @@ void CHDWallet::AvailableAnonCoins(std::vector<COutputR> &vCoins, bool fOnlySafe
 
     const Consensus::Params &consensusParams = Params().GetConsensus();
 
-    for (MapRecords_t::const_iterator it = mapRecords.begin(); it != mapRecords.end(); ++it) {
-        const uint256 &txid = it->first;
+    for (const auto &unspent : GetUnspentRecords(OUTPUT_RINGCT)) {
+        const uint256 &txid = unspent.first;
+        MapRecords_t::const_iterator it = mapRecords.find(txid);
+        assert(it != mapRecords.end());
         const CTransactionRecord &rtx = it->second;
 
         if (rtx.block_height > 0) { // height 0 is mempool
@@ -12321,6 +13368,91 @@ static void ApproximateBestSubset(std::vector<std::pair<CAmount, std::pair<MapRe
     return;
 }
 
+// Approximate marginal virtual sizes for the branch and bound selection of blinded and anon inputs
+static const size_t BLINDED_INPUT_VSIZE = 41 + (1 + 73 + 34 + 3) / WITNESS_SCALE_FACTOR; // prevout, sequence, signature and pubkey
+static const size_t BLINDED_CHANGE_OUTPUT_VSIZE = 1200; // Commitment, script, ephemeral pubkey and rangeproof
+static const size_t ANON_KEY_IMAGE_VSIZE = 33;
+static const size_t ANON_MEMBER_WITNESS_SIZE = 32 + 3; // MLSAG element and ring index of each ring member
+
+BlindedSelectionParams CHDWallet::GetBlindedSelectionParams(const CCoinControl &coin_control, size_t nRingSize, size_t nInputsPerSig) const
+{
+    BlindedSelectionParams params;
+    const CFeeRate feerate = GetMinimumFeeRate(*this, coin_control, nullptr);
+
+    size_t input_vsize = BLINDED_INPUT_VSIZE;
+    if (nRingSize > 0) {
+        // The key image and a row of the MLSAG, with a share of the signature's vin, C and commitment row
+        size_t row = nRingSize * ANON_MEMBER_WITNESS_SIZE;
+        size_t sig = 41 + (32 + nRingSize * 32 + 33) / WITNESS_SCALE_FACTOR;
+        input_vsize = ANON_KEY_IMAGE_VSIZE + (row + WITNESS_SCALE_FACTOR - 1) / WITNESS_SCALE_FACTOR
+            + (sig + nInputsPerSig - 1) / std::max(nInputsPerSig, (size_t)1);
+    }
+    params.input_fee = feerate.GetFee(input_vsize);
+
+    // Excess up to the cost of making and later spending a change output is better left as fee,
+    // but never more than the transaction code folds into the fee instead of a change output.
+    params.cost_of_change = std::min(feerate.GetFee(BLINDED_CHANGE_OUTPUT_VSIZE + input_vsize), ::minRelayTxFee.GetFee(2048));
+    return params;
+}
+
+bool CHDWallet::SelectBlindedCoinsBnB(const CAmount& nTargetValue, const CoinEligibilityFilter *eligibility_filter, const BlindedSelectionParams &params,
+    const std::vector<COutputR> &vCoins, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> >& setCoinsRet, CAmount& nValueRet) const
+{
+    setCoinsRet.clear();
+    nValueRet = 0;
+    if (params.target <= 0) {
+        return false;
+    }
+
+    std::vector<const COutputR*> eligible;
+    std::vector<CAmount> values, effective_values;
+    for (const auto &r : vCoins) {
+        const CTransactionRecord *rtx = &r.rtx->second;
+        const COutputRecord *oR = rtx->GetOutput(r.i);
+        if (!oR) {
+            return werror("%s: GetOutput failed, %s, %d.\n", r.txhash.ToString(), r.i);
+        }
+        if (eligibility_filter) {
+            const CWalletTx *pcoin = GetWalletOrTempTx(r.txhash, rtx);
+            if (!pcoin) {
+                return werror("%s: GetWalletOrTempTx failed.\n", __func__);
+            }
+            if (r.nDepth < (pcoin->IsFromMe(ISMINE_ALL) ? eligibility_filter->conf_mine : eligibility_filter->conf_theirs)) {
+                continue;
+            }
+            size_t ancestors, descendants;
+            chain().getTransactionAncestry(r.txhash, ancestors, descendants);
+            if (ancestors > eligibility_filter->max_ancestors || descendants > eligibility_filter->max_descendants) {
+                continue;
+            }
+        }
+        eligible.push_back(&r);
+        values.push_back(oR->nValue);
+        effective_values.push_back(oR->nValue - params.input_fee);
+    }
+
+    std::vector<size_t> selected;
+    if (!SelectValuesBnB(effective_values, params.target, params.cost_of_change, selected)) {
+        return false;
+    }
+    CAmount value = 0;
+    for (size_t i : selected) {
+        value += values[i];
+    }
+    // The fee of the last round may have been estimated for more inputs
+    if (value < nTargetValue) {
+        return false;
+    }
+    for (size_t i : selected) {
+        setCoinsRet.emplace_back(eligible[i]->rtx, eligible[i]->i);
+    }
+    nValueRet = value;
+    if (LogAcceptCategory(BCLog::HDWALLET)) {
+        WalletLogPrintf("%s: Selected %d inputs, excess %d.\n", __func__, selected.size(), value - nTargetValue);
+    }
+    return true;
+}
+
 bool CHDWallet::SelectCoinsMinConf(const CAmount& nTargetValue, const CoinEligibilityFilter& eligibility_filter,
     std::vector<COutputR> vCoins, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> >& setCoinsRet, CAmount& nValueRet) const
 {
@@ -12479,7 +13611,22 @@ bool CHDWallet::IsSpent(const uint256& hash, unsigned int n) const
 bool CHDWallet::IsSpentKey(const CScript *pscript) const
 {
     CTxDestination dst;
-    return pscript && ExtractDestination(*pscript, dst) && IsMine(dst) && GetDestData(dst, "used", nullptr);
+    if (!pscript || !ExtractDestination(*pscript, dst)) {
+        return false;
+    }
+    if (!m_have_used_destinations) {
+        m_used_destinations.Clear();
+        for (const auto &item : m_address_book) {
+            if (item.second.destdata.count("used")) {
+                m_used_destinations.Insert(GetScriptForDestination(item.first));
+            }
+        }
+        m_have_used_destinations = true;
+    }
+    if (!m_used_destinations.MayContain(GetScriptForDestination(dst))) {
+        return false;
+    }
+    return IsMine(dst) && GetDestData(dst, "used", nullptr);
 }
 
 bool CHDWallet::IsSpentKey(const uint256& hash, unsigned int n) const
@@ -12501,6 +13648,9 @@ void CHDWallet::SetSpentKeyState(const CScript *pscript, bool used)
         if (IsMine(dst)) {
             if (used && !GetDestData(dst, "used", nullptr)) {
                 AddDestData(batch, dst, "used", "p"); // p for "present", opposite of absent (null)
+                if (m_have_used_destinations) {
+                    m_used_destinations.Insert(GetScriptForDestination(dst));
+                }
             } else if (!used && GetDestData(dst, "used", nullptr)) {
                 EraseDestData(batch, dst, "used");
             }
@@ -12521,6 +13671,9 @@ void CHDWallet::SetSpentKeyState(WalletBatch& batch, const uint256& hash, unsign
                     if (AddDestData(batch, dst, "used", "p")) { // p for "present", opposite of absent (null)
                         tx_destinations.insert(dst);
                     }
+                    if (m_have_used_destinations) {
+                        m_used_destinations.Insert(GetScriptForDestination(dst));
+                    }
                 } else if (!used && GetDestData(dst, "used", nullptr)) {
                     EraseDestData(batch, dst, "used");
                 }
@@ -12581,6 +13734,10 @@ bool CHDWallet::TransactionCanBeAbandoned(const uint256& hashTx) const
 bool CHDWallet::AbandonTransaction(const uint256 &hashTx)
 {
     LOCK(cs_wallet);
+    m_have_stake_candidates = false;
+    m_balance_rebuild = true;
+    m_have_unspent_records = false;
+    m_state_version++;
 
     CHDWalletDB walletdb(*database);
 
@@ -12689,6 +13846,10 @@ void CHDWallet::MarkConflicted(const uint256 &hashBlock, int conflicting_height,
 {
     if (!m_chain) return;
     LOCK(cs_wallet);
+    m_have_stake_candidates = false;
+    m_balance_rebuild = true;
+    m_have_unspent_records = false;
+    m_state_version++;
 
     int conflictconfirms = (m_last_block_processed_height - conflicting_height + 1) * -1;
     // If number of conflict confirms cannot be determined, this means
@@ -12918,6 +14079,14 @@ size_t CHDWallet::CountColdstakeOutputs()
 {
     LOCK(cs_wallet);
 
+    if (m_cold_staking_pool) {
+        // Outputs staked for delegators are tracked already, scan for outputs delegated from this wallet if there are none
+        RefreshStakeCandidates();
+        if (m_delegated_num_outputs > 0) {
+            return m_delegated_num_outputs;
+        }
+    }
+
     size_t nColdstakeOutputs = 0;
     std::vector<COutput> vAvailableCoins;
     CAmount nMinimumAmount = 0, nMaximumAmount = MAX_MONEY, nMinimumSumAmount = 0;
@@ -13048,6 +14217,191 @@ uint64_t CHDWallet::GetStakeWeight() const
     return nWeight;
 };
 
+void CHDWallet::RemoveDelegatedOutputs(const uint256 &txid, const std::vector<uint32_t> *keep) const
+{
+    AssertLockHeld(cs_wallet);
+    auto mi = m_delegated_outputs.find(txid);
+    if (mi == m_delegated_outputs.end()) {
+        return;
+    }
+
+    std::vector<DelegatedOutput> &delegated = mi->second;
+    for (auto it = delegated.begin(); it != delegated.end(); ) {
+        if (keep && std::find(keep->begin(), keep->end(), it->n) != keep->end()) {
+            ++it;
+            continue;
+        }
+        auto di = m_delegators.find(it->address);
+        if (di != m_delegators.end()) {
+            ColdStakeDelegator &d = di->second;
+            d.nOutputs--;
+            d.nValue -= it->nValue;
+            auto hi = d.mapValueByHeight.find(it->nHeight);
+            if (hi != d.mapValueByHeight.end() && (hi->second -= it->nValue) <= 0) {
+                d.mapValueByHeight.erase(hi);
+            }
+            if (d.nOutputs == 0) {
+                m_delegators.erase(di);
+            }
+        }
+        auto hi = m_delegated_value_by_height.find(it->nHeight);
+        if (hi != m_delegated_value_by_height.end() && (hi->second -= it->nValue) <= 0) {
+            m_delegated_value_by_height.erase(hi);
+        }
+        m_delegated_num_outputs--;
+        it = delegated.erase(it);
+    }
+    if (delegated.empty()) {
+        m_delegated_outputs.erase(mi);
+    }
+};
+
+void CHDWallet::UpdateStakeCandidates(const uint256 &txid) const
+{
+    AssertLockHeld(cs_wallet);
+    m_stake_candidates.erase(txid);
+    if (m_cold_staking_pool) {
+        RemoveDelegatedOutputs(txid);
+    }
+
+    std::vector<uint32_t> outputs;
+    std::vector<DelegatedOutput> delegated;
+    bool fCoinStake = false;
+    auto AddDelegated = [&](uint32_t n, const CScript &script, CAmount nValue, int nHeight) {
+        CScript scriptStake, scriptSpend;
+        CTxDestination dest;
+        if (!m_cold_staking_pool
+            || !HasIsCoinstakeOp(script)
+            || !SplitConditionalCoinstakeScript(script, scriptStake, scriptSpend)
+            || !ExtractDestination(scriptSpend, dest)) {
+            return;
+        }
+        delegated.push_back({n, EncodeDestination(dest), nValue, nHeight});
+    };
+    MapWallet_t::const_iterator mwi;
+    MapRecords_t::const_iterator mri;
+    if ((mwi = mapWallet.find(txid)) != mapWallet.end()) {
+        const CTransactionRef &tx = mwi->second.tx;
+        for (size_t i = 0; i < tx->vpout.size(); ++i) {
+            const auto &txout = tx->vpout[i];
+            if (!txout->IsType(OUTPUT_STANDARD)) {
+                continue;
+            }
+            if (txout->GetValue() < m_min_stakeable_value) {
+                continue;
+            }
+            if (IsSpent(txid, i)) {
+                continue;
+            }
+
+            const CScript *pscriptPubKey = txout->GetPScriptPubKey();
+            CKeyID keyID;
+            if (!particl::ExtractStakingKeyID(*pscriptPubKey, keyID)) {
+                continue;
+            }
+
+            isminetype mine = IsMine(keyID);
+            if (!(mine & ISMINE_SPENDABLE)) {
+                continue;
+            }
+            if ((mine & ISMINE_HARDWARE_DEVICE)) {
+                continue;
+            }
+            outputs.push_back(i);
+            AddDelegated(i, *pscriptPubKey, txout->GetValue(), mwi->second.isConfirmed() ? mwi->second.m_confirm.block_height : 0);
+        }
+        fCoinStake = mwi->second.IsCoinStake();
+    } else
+    if ((mri = mapRecords.find(txid)) != mapRecords.end()) {
+        for (const auto &r : mri->second.vout) {
+            if (r.nType != OUTPUT_STANDARD) {
+                continue;
+            }
+            if (r.nValue < m_min_stakeable_value) {
+                continue;
+            }
+            if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_STAKEONLY)) {
+                continue;
+            }
+            if (IsSpent(txid, r.n)) {
+                continue;
+            }
+
+            CKeyID keyID;
+            if (!particl::ExtractStakingKeyID(r.scriptPubKey, keyID)) {
+                continue;
+            }
+
+            isminetype mine = IsMine(keyID);
+            if (!(mine & ISMINE_SPENDABLE)) {
+                continue;
+            }
+            if ((mine & ISMINE_HARDWARE_DEVICE)) {
+                continue;
+            }
+            outputs.push_back(r.n);
+            AddDelegated(r.n, r.scriptPubKey, r.nValue, (mri->second.HashUnset() || mri->second.nIndex < 0) ? 0 : mri->second.block_height);
+        }
+    }
+
+    if (!delegated.empty()) {
+        for (const auto &out : delegated) {
+            ColdStakeDelegator &d = m_delegators[out.address];
+            d.nOutputs++;
+            d.nValue += out.nValue;
+            d.mapValueByHeight[out.nHeight] += out.nValue;
+            if (fCoinStake && out.nHeight > d.nLastStakeHeight) {
+                d.nLastStakeHeight = out.nHeight;
+            }
+            m_delegated_value_by_height[out.nHeight] += out.nValue;
+            m_delegated_num_outputs++;
+        }
+        m_delegated_outputs.emplace(txid, std::move(delegated));
+    }
+    if (!outputs.empty()) {
+        m_stake_candidates.emplace(txid, std::move(outputs));
+    }
+};
+
+void CHDWallet::MarkStakeCandidatesDirty(const CTransaction &tx)
+{
+    AssertLockHeld(cs_wallet);
+    if (!m_have_stake_candidates) {
+        return;
+    }
+    m_stake_candidates_dirty.insert(tx.GetHash());
+    for (const auto &txin : tx.vin) {
+        if (!txin.IsAnonInput()) {
+            m_stake_candidates_dirty.insert(txin.prevout.hash);
+        }
+    }
+};
+
+void CHDWallet::RefreshStakeCandidates() const
+{
+    AssertLockHeld(cs_wallet);
+
+    if (!m_have_stake_candidates) {
+        m_stake_candidates.clear();
+        m_delegated_outputs.clear();
+        m_delegators.clear();
+        m_delegated_value_by_height.clear();
+        m_delegated_num_outputs = 0;
+        for (const auto &walletEntry : mapWallet) {
+            UpdateStakeCandidates(walletEntry.first);
+        }
+        for (const auto &ri : mapRecords) {
+            UpdateStakeCandidates(ri.first);
+        }
+        m_have_stake_candidates = true;
+    } else {
+        for (const auto &txid : m_stake_candidates_dirty) {
+            UpdateStakeCandidates(txid);
+        }
+    }
+    m_stake_candidates_dirty.clear();
+};
+
 void CHDWallet::AvailableCoinsForStaking(std::vector<COutput> &vCoins, int64_t nTime, int nHeight) const
 {
     vCoins.clear();
@@ -13055,124 +14409,82 @@ void CHDWallet::AvailableCoinsForStaking(std::vector<COutput> &vCoins, int64_t n
 
     {
         LOCK(cs_wallet);
+        RefreshStakeCandidates();
 
         int nHeight = ::ChainActive().Tip()->nHeight;
         int min_stake_confirmations = Params().GetStakeMinConfirmations();
         int nRequiredDepth = std::min(min_stake_confirmations-1, (int)(nHeight / 2));
 
-        for (const auto &walletEntry : mapWallet) {
-            const CWalletTx *pcoin = &walletEntry.second;
-            CTransactionRef tx = pcoin->tx;
+        for (auto it = m_stake_candidates.begin(); it != m_stake_candidates.end(); ) {
+            const uint256 &txid = it->first;
+            std::vector<uint32_t> &outputs = it->second;
+
+            const CWalletTx *pcoin = nullptr;
+            const CTransactionRecord *prtx = nullptr;
+            MapWallet_t::const_iterator mwi;
+            MapRecords_t::const_iterator mri;
+            if ((mwi = mapWallet.find(txid)) != mapWallet.end()) {
+                pcoin = &mwi->second;
+            } else
+            if ((mri = mapRecords.find(txid)) != mapRecords.end()) {
+                prtx = &mri->second;
+            } else {
+                RemoveDelegatedOutputs(txid);
+                it = m_stake_candidates.erase(it);
+                continue;
+            }
 
-            int nDepth = pcoin->GetDepthInMainChain();
+            int nDepth = pcoin ? pcoin->GetDepthInMainChain() : GetDepthInMainChain(*prtx);
             if (nDepth > m_greatest_txn_depth) {
                 m_greatest_txn_depth = nDepth;
             }
             if (nDepth < nRequiredDepth) {
+                ++it;
                 continue;
             }
-            if (pcoin->IsCoinStake() && min_stake_confirmations < COINBASE_MATURITY) {
+            if (pcoin && pcoin->IsCoinStake() && min_stake_confirmations < COINBASE_MATURITY) {
                 // min_stake_confirmations is only less than COINBASE_MATURITY in regtest mode
                 if (nDepth < std::min(COINBASE_MATURITY, (int)(nHeight / 2))) {
+                    ++it;
                     continue;
                 }
             }
 
-            const uint256 &wtxid = walletEntry.first;
-            for (size_t i = 0; i < tx->vpout.size(); ++i) {
-                const auto &txout = tx->vpout[i];
-                if (!txout->IsType(OUTPUT_STANDARD)) {
-                    continue;
-                }
-                if (txout->GetValue() < m_min_stakeable_value) {
-                    continue;
-                }
-                COutPoint kernel(wtxid, i);
-                if (!CheckStakeUnused(kernel)
-                     || IsSpent(wtxid, i)
-                     || IsLockedCoin(wtxid, i)) {
-                    continue;
-                }
-
-                const CScript *pscriptPubKey = txout->GetPScriptPubKey();
-                CKeyID keyID;
-                if (!particl::ExtractStakingKeyID(*pscriptPubKey, keyID)) {
-                    continue;
-                }
-
-                isminetype mine = IsMine(keyID);
-                if (!(mine & ISMINE_SPENDABLE)) {
-                    continue;
-                }
-
-                bool fSpendableIn = true;
-                bool fSolvableIn = true;
-                bool fNeedHardwareKey = (mine & ISMINE_HARDWARE_DEVICE);
-                if (fNeedHardwareKey) {
-                    continue;
-                }
-
-                vCoins.emplace_back(pcoin, i, nDepth, fSpendableIn, fSolvableIn, true, true, fNeedHardwareKey, false);
-            }
-        }
-
-        for (const auto &ri : mapRecords) {
-            const uint256 &txid = ri.first;
-            const CTransactionRecord &rtx = ri.second;
-
-            int nDepth = GetDepthInMainChain(rtx);
-            if (nDepth > m_greatest_txn_depth) {
-                m_greatest_txn_depth = nDepth;
+            // Spent outputs are dropped, AbandonTransaction and MarkConflicted rebuild the candidates
+            size_t nOutputs = outputs.size();
+            outputs.erase(std::remove_if(outputs.begin(), outputs.end(),
+                [&](uint32_t n) { return IsSpent(txid, n); }), outputs.end());
+            if (outputs.size() != nOutputs) {
+                RemoveDelegatedOutputs(txid, &outputs);
             }
-
-            if (nDepth < nRequiredDepth) {
+            if (outputs.empty()) {
+                it = m_stake_candidates.erase(it);
                 continue;
             }
 
-            MapWallet_t::const_iterator twi = mapTempWallet.end();
-            for (const auto &r : rtx.vout) {
-                if (r.nType != OUTPUT_STANDARD) {
-                    continue;
-                }
-                if (r.nValue < m_min_stakeable_value) {
-                    continue;
-                }
-                if (!(r.nFlags & ORF_OWNED || r.nFlags & ORF_STAKEONLY)) {
-                    continue;
-                }
-                COutPoint kernel(txid, r.n);
+            for (uint32_t n : outputs) {
+                COutPoint kernel(txid, n);
                 if (!CheckStakeUnused(kernel)
-                    || IsSpent(txid, r.n)
-                    || IsLockedCoin(txid, r.n)) {
+                    || IsLockedCoin(txid, n)) {
                     continue;
                 }
 
-                CKeyID keyID;
-                if (!particl::ExtractStakingKeyID(r.scriptPubKey, keyID)) {
+                if (pcoin) {
+                    vCoins.emplace_back(pcoin, n, nDepth, true, true, true, true, false, false);
                     continue;
                 }
 
-                isminetype mine = IsMine(keyID);
-                if (!(mine & ISMINE_SPENDABLE)) {
-                    continue;
-                }
-                if ((mine & ISMINE_HARDWARE_DEVICE)) {
-                    continue;
-                }
-
-                if (twi == mapTempWallet.end()
-                    && (twi = mapTempWallet.find(txid)) == mapTempWallet.end()) {
-                    if (0 != InsertTempTxn(txid, &rtx)
+                MapWallet_t::const_iterator twi = mapTempWallet.find(txid);
+                if (twi == mapTempWallet.end()) {
+                    if (0 != InsertTempTxn(txid, prtx)
                         || (twi = mapTempWallet.find(txid)) == mapTempWallet.end()) {
                         WalletLogPrintf("ERROR: %s - InsertTempTxn failed %s.\n", __func__, txid.ToString());
                         return;
                     }
                 }
-
-                bool fSpendableIn = true;
-                bool fNeedHardwareKey = false;
-                vCoins.emplace_back(&twi->second, r.n, nDepth, fSpendableIn, true, true, true, fNeedHardwareKey, false);
+                vCoins.emplace_back(&twi->second, n, nDepth, true, true, true, true, false, false);
             }
+            ++it;
         }
     }
 
@@ -13253,18 +14565,29 @@ bool CHDWallet::CreateCoinStake(unsigned int nBits, int64_t nTime, int nBlockHei
     CAmount nCredit = 0;
     CScript scriptPubKeyKernel;
 
+    // Search all coins on the kernel check threads, the loop only checks the coins after a kernel it can't use
+    std::vector<COutPoint> vPrevouts;
+    vPrevouts.reserve(setCoins.size());
+    for (const auto &pcoin : setCoins) {
+        vPrevouts.emplace_back(pcoin.first->GetHash(), pcoin.second);
+    }
+    std::vector<int8_t> vKernel;
+    if (!CheckStakeKernels(pindexPrev, nBits, nTime, vPrevouts, vKernel)) {
+        return false;
+    }
+
     std::set<std::pair<const CWalletTx*,unsigned int> >::iterator it = setCoins.begin();
 
-    for (; it != setCoins.end(); ++it) {
+    for (size_t nCoin = 0; it != setCoins.end(); ++it, ++nCoin) {
         auto pcoin = *it;
         if (ThreadStakeMinerStopped()) {
             return false;
         }
 
-        COutPoint prevoutStake = COutPoint(pcoin.first->GetHash(), pcoin.second);
+        const COutPoint &prevoutStake = vPrevouts[nCoin];
 
         int64_t nBlockTime;
-        if (CheckKernel(pindexPrev, nBits, nTime, prevoutStake, &nBlockTime)) {
+        if (vKernel[nCoin] == 1 || (vKernel[nCoin] == -1 && CheckKernel(pindexPrev, nBits, nTime, prevoutStake, &nBlockTime))) {
             LOCK(cs_wallet);
             // Found a kernel
             if (LogAcceptCategory(BCLog::POS)) {
@@ -13876,7 +15199,10 @@ bool CHDWallet::SignBlock(CBlockTemplate *pblocktemplate, int nHeight, int64_t n
     }
 
     CMutableTransaction txCoinStake;
-    if (CreateCoinStake(pblock->nBits, nSearchTime, nHeight, nFees, txCoinStake, key)) {
+    TRACE_TIME_START(trace_start);
+    const bool found = CreateCoinStake(pblock->nBits, nSearchTime, nHeight, nFees, txCoinStake, key);
+    TRACE4(staking, create_coinstake, nHeight, nSearchTime, found, TRACE_TIME_ELAPSED(trace_start));
+    if (found) {
         if (LogAcceptCategory(BCLog::POS)) {
             WalletLogPrintf("%s: Kernel found.\n", __func__);
         }
@@ -14060,10 +15386,16 @@ int64_t CalculateMaximumSignedTxSize(const CTransaction &tx, const CHDWallet *wa
     return GetVirtualTransactionSize(CTransaction(txNew));
 }
 
-void RestartStakingThreads()
+void AddStakingWallet(const std::shared_ptr<CWallet> &wallet)
+{
+    if (IsParticlWallet(wallet.get())) {
+        AddWalletToStakeMiner(wallet);
+    }
+};
+
+void RemoveStakingWallet(const CWallet *wallet)
 {
-    StopThreadStakeMiner();
-    StartThreadStakeMiner();
+    RemoveWalletFromStakeMiner(wallet);
 };
 
 bool IsParticlWallet(const WalletStorage *win)
@@ -9,11 +9,20 @@
 #include <wallet/hdwalletdb.h>
 #include <wallet/hdwallettypes.h>
 
+#include <anon.h>
 #include <key_io.h>
 #include <key/extkey.h>
 #include <key/stealth.h>
 
 static const size_t DEFAULT_STEALTH_LOOKAHEAD_SIZE = 5;
+static const int DEFAULT_WALLET_LOAD_THREADS = 0;
+static const int MAX_WALLET_LOAD_THREADS = 8;
+static const size_t WALLET_LOAD_BATCH_SIZE = 16384;
+static const size_t MAX_STEALTH_SPEND_POINTS = 100000;
+static const size_t LOCKED_OUTPUTS_BATCH_SIZE = 256;
+static const int MAX_BLIND_SIGN_THREADS = 8;
+static const size_t EXT_KEY_UNLOCK_BATCH_SIZE = 256;
+static const size_t DEFAULT_WALLET_GROUP_COMMIT = 1000;
 
 //! -fallbackfee default
 static const CAmount DEFAULT_FALLBACK_FEE_PART = 20000;
@@ -22,6 +31,49 @@ typedef std::map<CKeyID, CStealthKeyMetadata> StealthKeyMetaMap;
 typedef std::map<CKeyID, CExtKeyAccount*> ExtKeyAccountMap;
 typedef std::map<CKeyID, CStoredExtKey*> ExtKeyMap;
 
+/** Cold staking outputs staked by a pool wallet, summed per spend address of the delegator */
+struct ColdStakeDelegator {
+    size_t nOutputs = 0;
+    CAmount nValue = 0;
+    std::map<int, CAmount> mapValueByHeight; // by confirmed height, 0 while unconfirmed
+    int nLastStakeHeight = 0; // highest coinstake paying to the delegator among the tracked outputs
+};
+
+/** Grouped commits of transaction records since the wallet was loaded, reported by getwalletinfo */
+struct WalletCommitStats {
+    uint64_t nCommits = 0;
+    uint64_t nRecords = 0;
+    uint64_t nFailed = 0;
+    int64_t nTotalMicros = 0;
+    int64_t nMaxMicros = 0;
+    int64_t nLastMicros = 0;
+};
+
+/** Kernel searches of the wallet by the stake threads, reported by getstakinginfo */
+struct StakeSearchStats {
+    uint64_t nSearches = 0;
+    int64_t nTotalMicros = 0;
+    int64_t nLastMicros = 0;
+    int64_t nMaxMicros = 0;
+    int64_t nLastDelayMillis = 0; // From the start of the searched timestamp until a thread took the wallet
+};
+
+/** Immutable copy of the wallet totals, published after the wallet changes so RPC readers can skip cs_wallet */
+struct WalletReadView {
+    uint64_t nVersion = 0; // CHDWallet::m_state_version when the view was built
+    CHDWalletBalances bal;
+    CHDWalletBalances bal_full; // without avoid_reuse, set only when WALLET_FLAG_AVOID_REUSE is
+    uint64_t nStakeWeight = 0;
+    CAmount nReserveBalance = 0;
+};
+
+/** Fee model for the branch and bound selection of blinded and anon inputs, see GetBlindedSelectionParams */
+struct BlindedSelectionParams {
+    CAmount target = 0;         // Value the effective values of the inputs must cover, the outputs and the fee not paid by inputs
+    CAmount input_fee = 0;      // Fee for the marginal size of one input
+    CAmount cost_of_change = 0; // Largest excess left as fee instead of a change output
+};
+
 typedef std::map<uint256, CWalletTx> MapWallet_t;
 
 class UniValue;
@@ -93,6 +145,10 @@ public:
 
     isminetype HaveAddress(const CTxDestination &dest);
     isminetype HaveKey(const CKeyID &address, const CEKAKey *&pak, const CEKASCKey *&pasc, CExtKeyAccount *&pa) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** False if address is not in mapLooseKeys or mapLooseLookAhead, builds m_loose_key_filter on first use */
+    bool MayHaveLooseKey(const CKeyID &id) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Must be called for every id inserted into mapLooseKeys or mapLooseLookAhead */
+    void AddToLooseKeyFilter(const CKeyID &id) const;
     isminetype IsMine(const CKeyID &address) const override;
     bool HaveKey(const CKeyID &address) const override;
 
@@ -186,6 +242,8 @@ public:
     int ExpandTempRecipients(std::vector<CTempRecipient> &vecSend, CStoredExtKey *pc, std::string &sError);
 
     int AddCTData(const CCoinControl *coinControl, CTxOutBase *txout, CTempRecipient &r, std::string &sError) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Run AddCTData for each (output, recipient) pair across threads, sError is set from the first failure */
+    int AddCTDataBatch(const CCoinControl *coinControl, std::vector<std::pair<CTxOutBase*, CTempRecipient*> > &vOutputs, std::string &sError) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     bool SetChangeDest(const CCoinControl *coinControl, CTempRecipient &r, std::string &sError) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
@@ -220,6 +278,20 @@ public:
 
 
     void ClearCachedBalances() override;
+    void MarkDirty() override;
+    /** Queue a txn and the txns it spends from to be recounted at the next balance query or coin selection */
+    void MarkBalancesDirty(const uint256 &txhash) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    void blockConnected(const CBlock& block, int height) override;
+    void blockDisconnected(const CBlock& block, int height) override;
+    void transactionAddedToMempool(const CTransactionRef& tx, uint64_t mempool_sequence) override;
+    void transactionRemovedFromMempool(const CTransactionRef& tx, MemPoolRemovalReason reason, uint64_t mempool_sequence) override;
+
+    /** Returns the published view if no change was made to the wallet since it was built, else null */
+    std::shared_ptr<const WalletReadView> GetReadView() const;
+    /** Build a view of the current state and publish it for later readers */
+    std::shared_ptr<const WalletReadView> PublishReadView() const;
+    /** Returns the published view, rebuilding it first if it's out of date */
+    std::shared_ptr<const WalletReadView> GetOrPublishReadView() const;
     bool LoadToWallet(const uint256& hash, const UpdateWalletTxFn& fill_wtx) override EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     void LoadToWallet(const uint256 &hash, CTransactionRecord &rtx) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
@@ -227,6 +299,17 @@ public:
     void RemoveFromTxSpends(const uint256 &hash, const CTransactionRef pt) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     int UnloadTransaction(const uint256 &hash) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
+    /**
+     * Move records at least min_depth deep and no newer than max_time out of
+     * mapRecords into the archive store. Only records with every owned output
+     * spent by a transaction min_depth deep are moved, and not while they spend
+     * an output of a transaction staying loaded.
+     */
+    bool ArchiveRecords(int min_depth, int64_t max_time, size_t &nArchived) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    bool ReadArchivedRecord(const uint256 &txhash, CTransactionRecord &rtx) const;
+    /** Read the archived records with a time in [time_from, time_to]. */
+    bool ReadArchivedRecords(int64_t time_from, int64_t time_to, MapRecords_t &records) const;
+
     int GetDefaultConfidentialChain(CHDWalletDB *pwdb, CExtKeyAccount *&sea, CStoredExtKey *&pc);
 
     int MakeDefaultAccount(bool fLegacy);
@@ -257,7 +340,11 @@ public:
     int ExtKeyUnlock(CExtKeyAccount *sea, const CKeyingMaterial &vMKey) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     int ExtKeyUnlock(CStoredExtKey *sek) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     int ExtKeyUnlock(CStoredExtKey *sek, const CKeyingMaterial &vMKey) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Decrypt keys in parallel */
+    int ExtKeyUnlock(const std::vector<CStoredExtKey*> &keys, const CKeyingMaterial &vMKey) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     int ExtKeyUnlock(const CKeyingMaterial &vMKey) override EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Decrypt the master key and the default account, which staking and new addresses need first */
+    int ExtKeyUnlockDefault(const CKeyingMaterial &vMKey) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     int ExtKeyLoadMaster();
 
@@ -370,11 +457,19 @@ public:
     bool GetStealthByIndex(uint32_t sxId, CStealthAddress &sx) const;
     bool GetStealthLinked(const CKeyID &idK, CStealthAddress &sx) const;
     bool GetStealthSecret(const CStealthAddress &sx, CKey &key_out) const;
-    bool ProcessLockedStealthOutputs() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
-    bool ProcessLockedBlindedOutputs() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Expand up to max_keys queued stealth keys after resume_after, more is set if entries remain */
+    bool ProcessLockedStealthOutputs(size_t max_keys, CKeyID &resume_after, bool &more) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Process up to max_outputs queued blinded and anon outputs, more is set if entries remain */
+    bool ProcessLockedBlindedOutputs(size_t max_outputs, bool &more, int64_t &earliest_anon_out_time) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Decrypt the ext keys left locked by ExtKeyUnlockDefault in batches, releasing cs_wallet between batches */
+    void ProcessLockedExtKeys() LOCKS_EXCLUDED(cs_wallet);
+    /** Drain the locked output queues in batches, releasing cs_wallet between batches */
+    void ProcessLockedOutputs() LOCKS_EXCLUDED(cs_wallet);
     bool CountRecords(std::string sPrefix, int64_t rv);
 
     void ProcessStealthLookahead(CExtKeyAccount *ea, const CEKAStealthKey &aks, bool v2) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Parsed spend pubkey of a stealth address, cached in m_stealth_spend_points */
+    bool GetStealthSpendPoint(const ec_point &pkSpend, secp256k1_pubkey &out) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     bool ProcessStealthOutput(const CTxDestination &address,
         std::vector<uint8_t> &vchEphemPK, uint32_t prefix, bool fHavePrefix, CKey &sShared, bool fNeedShared=false);
 
@@ -405,11 +500,17 @@ public:
         COutputRecord &rout, CStoredTransaction &stx, bool &fUpdated) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     int OwnAnonOut(CHDWalletDB *pwdb, const uint256 &txhash, const CTxOutRingCT *pout, const CStoredExtKey *pc, uint32_t &nLastChild,
         COutputRecord &rout, CStoredTransaction &stx, bool &fUpdated) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Append a rewind for each blinded output of tx the wallet has the spend key for */
+    void GetOwnedRewinds(const CTransaction &tx, std::vector<RangeProofRewind> &rewinds) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Rewind the owned blinded outputs of the block in one batch, OwnBlindOut and OwnAnonOut take the results from m_rewound_outputs */
+    void PrepareScanBlock(const CBlock &block) override EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     bool ProcessPlaceholder(const CTransaction &tx, CTransactionRecord &rtx);
     bool AddToRecord(CTransactionRecord &rtxIn, const CTransaction &tx, CWalletTx::Confirmation confirm, bool fFlushOnClose=true) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     ScanResult ScanForWalletTransactions(const uint256& start_block, int start_height, Optional<int> max_height, const WalletRescanReserver& reserver, bool fUpdate) override;
+    /** Fill m_unconfirmed_txns if it was invalidated */
+    void RefreshUnconfirmedTxns() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     std::vector<uint256> ResendRecordTransactionsBefore(int64_t nTime);
     void ResendWalletTransactions() override;
 
@@ -421,7 +522,10 @@ public:
         const CCoinControl& coin_control, CoinSelectionParams& coin_selection_params, bool& bnb_used) const override EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     void AvailableBlindedCoins(std::vector<COutputR>& vCoins, bool fOnlySafe=true, const CCoinControl *coinControl = nullptr, const CAmount& nMinimumAmount = 1, const CAmount& nMaximumAmount = MAX_MONEY, const CAmount& nMinimumSumAmount = MAX_MONEY, const uint64_t& nMaximumCount = 0) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
-    bool SelectBlindedCoins(const std::vector<COutputR>& vAvailableCoins, const CAmount& nTargetValue, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet, const CCoinControl *coinControl = nullptr, bool random_selection = false) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** With bnb_params, a changeless selection by branch and bound is tried before the knapsack or random selection */
+    bool SelectBlindedCoins(const std::vector<COutputR>& vAvailableCoins, const CAmount& nTargetValue, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet, const CCoinControl *coinControl = nullptr, bool random_selection = false, const BlindedSelectionParams *bnb_params = nullptr) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Fee model of a blinded input, or of an anon input at nRingSize with nInputsPerSig inputs per signature when nRingSize is set */
+    BlindedSelectionParams GetBlindedSelectionParams(const CCoinControl &coin_control, size_t nRingSize = 0, size_t nInputsPerSig = 1) const;
 
     void AvailableAnonCoins(std::vector<COutputR> &vCoins, bool fOnlySafe=true, const CCoinControl *coinControl = nullptr, const CAmount& nMinimumAmount = 1, const CAmount& nMaximumAmount = MAX_MONEY, const CAmount& nMinimumSumAmount = MAX_MONEY, const uint64_t& nMaximumCount = 0) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
@@ -433,6 +537,8 @@ public:
     std::map<CTxDestination, std::vector<COutputR>> ListCoins(OutputTypes nType) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
     bool SelectCoinsMinConf(const CAmount& nTargetValue, const CoinEligibilityFilter& eligibility_filter, std::vector<COutputR> vCoins, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet) const;
+    /** Branch and bound over vCoins, eligible under eligibility_filter if set. The selection must also reach nTargetValue. */
+    bool SelectBlindedCoinsBnB(const CAmount& nTargetValue, const CoinEligibilityFilter *eligibility_filter, const BlindedSelectionParams &params, const std::vector<COutputR> &vCoins, std::vector<std::pair<MapRecords_t::const_iterator,unsigned int> > &setCoinsRet, CAmount &nValueRet) const;
 
     bool IsSpent(const uint256& hash, unsigned int n) const override EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
 
@@ -473,6 +579,16 @@ public:
     bool SetReserveBalance(CAmount nNewReserveBalance);
     void SetStakeLimitHeight(int stake_limit);
     uint64_t GetStakeWeight() const;
+    /** Refresh the stakeable outputs of txid in m_stake_candidates */
+    void UpdateStakeCandidates(const uint256 &txid) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    void MarkStakeCandidatesDirty(const CTransaction &tx) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Refresh the unspent owned blinded and anon outputs of txid in m_unspent_records */
+    void UpdateUnspentRecords(const uint256 &txid) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    const std::map<uint256, std::vector<uint32_t>> &GetUnspentRecords(uint8_t output_type) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Apply m_stake_candidates_dirty, or rebuild m_stake_candidates if m_have_stake_candidates is unset */
+    void RefreshStakeCandidates() const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Remove the m_delegators contributions of txid, except for outputs in keep */
+    void RemoveDelegatedOutputs(const uint256 &txid, const std::vector<uint32_t> *keep = nullptr) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
     void AvailableCoinsForStaking(std::vector<COutput> &vCoins, int64_t nTime, int nHeight) const;
     bool SelectCoinsForStaking(int64_t nTargetValue, int64_t nTime, int nHeight, std::set<std::pair<const CWalletTx*,unsigned int> > &setCoinsRet, int64_t &nValueRet) const;
     bool CreateCoinStake(unsigned int nBits, int64_t nTime, int nBlockHeight, int64_t nFees, CMutableTransaction &txNew, CKey &key);
@@ -482,16 +598,50 @@ public:
     boost::signals2::signal<void (CAmount nReservedBalance)> NotifyReservedBalanceChanged;
 
     size_t CountTxSpends() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet) { return mapTxSpends.size(); };
+    /** Heap memory used by mapRecords and rtxOrdered */
+    size_t RecordsDynamicMemoryUsage() const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+
+    /** Read a stored txn, including one written while connecting the current block and not yet committed */
+    bool ReadStoredTx(const uint256 &txhash, CStoredTransaction &stx) const;
+    /** Write a txn record and stored txn, deferred to CommitPendingRecords while connecting a block */
+    bool WriteTxRecordAndStx(CHDWalletDB *pwdb, const uint256 &txhash, const CTransactionRecord &rtx, const CStoredTransaction &stx) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Write all deferred txn records in one db transaction */
+    bool CommitPendingRecords() EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    WalletCommitStats GetCommitStats() const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet) { return m_commit_stats; };
 
     int64_t nLastCoinStakeSearchTime = 0;
     uint32_t nStealth, nFoundStealth; // for reporting, zero before use
     int64_t nReserveBalance = 0;
-    size_t nStakeThread = 9999999; // unset
+    StakeSearchStats m_stake_search_stats GUARDED_BY(cs_wallet);
 
     mutable int m_greatest_txn_depth = 0; // depth of most deep txn
     //mutable int m_least_txn_depth = 0; // depth of least deep txn
-    mutable std::atomic_bool m_have_spendable_balance_cached {false};
-    mutable CAmount m_spendable_balance_cached = 0;
+
+    /** Balance a single txn contributes, the wallet totals are the sum over all txns */
+    class CachedTxBalance
+    {
+    public:
+        CHDWalletBalances bal;
+        CAmount nSpendable = 0; // GetSpendableBalance
+        CAmount nBlind = 0; // GetBlindBalance
+        CAmount nAnon = 0; // GetAnonBalance
+
+        CachedTxBalance &operator+=(const CachedTxBalance &b);
+        CachedTxBalance &operator-=(const CachedTxBalance &b);
+        bool IsNull() const { return nSpendable == 0 && nBlind == 0 && nAnon == 0 && bal.IsNull(); };
+    };
+    /** Returns true if the balance of the txn can change without the txn or its spends changing */
+    bool GetTxBalance(const CWalletTx &wtx, CachedTxBalance &tb, bool avoid_reuse) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    bool GetTxBalance(const uint256 &txhash, const CTransactionRecord &rtx, CachedTxBalance &tb, bool avoid_reuse) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    void GetBalanceTotals(CachedTxBalance &totals, bool avoid_reuse) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    void UpdateCachedTxBalance(const uint256 &txhash) const EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+
+    // Txns with a zero balance that can only change through MarkBalancesDirty are not stored
+    mutable std::map<uint256, CachedTxBalance> m_balance_txns GUARDED_BY(cs_wallet);
+    mutable std::set<uint256> m_balance_dirty GUARDED_BY(cs_wallet);
+    mutable std::set<uint256> m_balance_volatile GUARDED_BY(cs_wallet); // Depend on depth or the mempool
+    mutable CachedTxBalance m_balance_total GUARDED_BY(cs_wallet);
+    mutable bool m_balance_rebuild GUARDED_BY(cs_wallet) = true;
 
     enum eStakingState {
         NOT_STAKING = 0,
@@ -512,6 +662,7 @@ public:
     ExtKeyMap mapExtKeys;
     mutable LooseKeyMap mapLooseKeys;       // Keys derived from extkeys not attached to an account
     mutable LooseKeyMap mapLooseLookAhead;
+    mutable CKeyIdFilter m_loose_key_filter; // ids of mapLooseKeys and mapLooseLookAhead
 
     mutable MapWallet_t mapTempWallet;
 
@@ -533,13 +684,51 @@ public:
     mutable std::atomic_bool m_have_cached_stakeable_coins {false};
     mutable std::vector<COutput> m_cached_stakeable_coins;
 
+    // Unspent outputs passing the checks that don't depend on the chain, by txid.
+    // Txns added or spending are refreshed through m_stake_candidates_dirty, m_have_stake_candidates = false rebuilds all.
+    mutable std::map<uint256, std::vector<uint32_t>> m_stake_candidates;
+    mutable std::set<uint256> m_stake_candidates_dirty;
+    mutable std::atomic_bool m_have_stake_candidates {false};
+
+    // With -coldstakingpool the cold staking candidates are also summed per delegator, maintained with m_stake_candidates
+    struct DelegatedOutput {
+        uint32_t n;
+        std::string address;
+        CAmount nValue;
+        int nHeight;
+    };
+    bool m_cold_staking_pool = false;
+    mutable std::map<uint256, std::vector<DelegatedOutput>> m_delegated_outputs GUARDED_BY(cs_wallet);
+    mutable std::map<std::string, ColdStakeDelegator> m_delegators GUARDED_BY(cs_wallet);
+    mutable std::map<int, CAmount> m_delegated_value_by_height GUARDED_BY(cs_wallet);
+    mutable size_t m_delegated_num_outputs GUARDED_BY(cs_wallet) = 0;
+
+    // Unspent owned outputs of mapRecords by output type and txid, only OUTPUT_CT and OUTPUT_RINGCT are tracked.
+    // Txns added or spending are refreshed through MarkBalancesDirty, m_have_unspent_records = false rebuilds all.
+    mutable std::map<uint8_t, std::map<uint256, std::vector<uint32_t>>> m_unspent_records GUARDED_BY(cs_wallet);
+    mutable std::set<uint256> m_unspent_records_dirty GUARDED_BY(cs_wallet);
+    mutable bool m_have_unspent_records GUARDED_BY(cs_wallet) = false;
+
+    // Txns and records that may be unconfirmed, the resend timer only visits these.
+    // Added through MarkBalancesDirty and pruned when found confirmed or abandoned,
+    // m_have_unconfirmed_txns = false rebuilds the set from the whole wallet.
+    std::set<uint256> m_unconfirmed_txns GUARDED_BY(cs_wallet);
+    bool m_have_unconfirmed_txns GUARDED_BY(cs_wallet) = false;
+
+    // Destinations with "used" destdata, lets IsSpentKey answer most outputs without the
+    // address book and IsMine lookups. Entries are never removed, hits are checked exactly.
+    mutable CScriptFingerprintSet m_used_destinations GUARDED_BY(cs_wallet);
+    mutable bool m_have_used_destinations GUARDED_BY(cs_wallet) = false;
+
+    // Spend pubkeys are decompressed once instead of on every stealth output scanned
+    std::map<ec_point, secp256k1_pubkey> m_stealth_spend_points GUARDED_BY(cs_wallet);
+
     bool fUnlockForStakingOnly = false; // Use coldstaking instead
 
     int64_t nRCTOutSelectionGroup1 = 5000;
     int64_t nRCTOutSelectionGroup2 = 50000;
     size_t prefer_max_num_anon_inputs = 5; // if > x anon inputs are randomly selected attempt to reduce
     int m_mixin_selection_mode_default = 1;
-    secp256k1_scratch_space *m_blind_scratch = nullptr;
 
     int m_collapse_spent_mode = 0;
     int m_min_collapse_depth = 3;
@@ -554,12 +743,25 @@ public:
     size_t m_rescan_stealth_v1_lookahead = DEFAULT_STEALTH_LOOKAHEAD_SIZE;
     size_t m_rescan_stealth_v2_lookahead = DEFAULT_STEALTH_LOOKAHEAD_SIZE;
     size_t m_default_lookahead = DEFAULT_LOOKAHEAD_SIZE;
+    size_t m_group_commit_size = DEFAULT_WALLET_GROUP_COMMIT; // 0 writes each txn record on its own
+
+    // Txn records written while connecting a block, committed together when the block is done or m_group_commit_size are pending
+    bool m_group_commit GUARDED_BY(cs_wallet) = false;
+    std::map<uint256, std::pair<CTransactionRecord, CStoredTransaction>> m_pending_records GUARDED_BY(cs_wallet);
+    WalletCommitStats m_commit_stats GUARDED_BY(cs_wallet);
+
+    // Incremented at each change that can alter the balances or stake weight.
+    // Readers use m_read_view only while its version matches, m_read_view is
+    // swapped with std::atomic_load/std::atomic_store.
+    mutable std::atomic<uint64_t> m_state_version{1};
+    mutable std::shared_ptr<const WalletReadView> m_read_view;
 
     bool m_smsg_enabled = true;
     CAmount m_min_stakeable_value = 1;  // Wallet will not try to stake outputs below this value
     CAmount m_min_owned_value = 0;      // Wallet will ignore outputs below this value
 
     std::map<CKeyID, uint32_t> m_derived_keys; // Allows multiple provisional derivations from the same extkey
+    std::map<COutPoint, RangeProofRewind> m_rewound_outputs GUARDED_BY(cs_wallet); // Outputs of the block being rescanned
 
 private:
     void ParseAddressForMetaData(const CTxDestination &addr, COutputRecord &rec);
@@ -603,7 +805,12 @@ void ExtractNarration(const uint256 &nonce, const std::vector<uint8_t> &vData, s
 int64_t CalculateMaximumSignedTxSize(const CTransaction &tx, const CHDWallet *wallet) EXCLUSIVE_LOCKS_REQUIRED(wallet->cs_wallet);
 int64_t CalculateMaximumSignedTxSize(const CTransaction &tx, const CHDWallet *wallet, const std::vector<CTxOutBaseRef>& txouts);
 
-void RestartStakingThreads();
+/** Hand a loaded wallet to the stake threads, or take an unloaded one from them */
+void AddStakingWallet(const std::shared_ptr<CWallet> &wallet);
+void RemoveStakingWallet(const CWallet *wallet);
+
+/** Number of threads used to load records and derive lookahead keys, from -walletloadthreads */
+int GetWalletLoadThreads();
 
 bool IsParticlWallet(const WalletStorage *win);
 CHDWallet *GetParticlWallet(WalletStorage *win);
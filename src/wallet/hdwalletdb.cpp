@@ -230,6 +230,26 @@ bool CHDWalletDB::EraseTxRecord(const uint256 &hash)
     return EraseIC(std::make_pair(std::string("rtx"), hash));
 };
 
+bool CHDWalletDB::HaveArchivedTxRecord(const uint256 &hash)
+{
+    return m_batch->Exists(std::make_pair(std::string("artx"), hash));
+};
+
+bool CHDWalletDB::ReadArchivedTxRecord(const uint256 &hash, CTransactionRecord &rtx, uint32_t nFlags)
+{
+    return m_batch->Read(std::make_pair(std::string("artx"), hash), rtx, nFlags);
+};
+
+bool CHDWalletDB::WriteArchivedTxRecord(const uint256 &hash, const CTransactionRecord &rtx)
+{
+    return WriteIC(std::make_pair(std::string("artx"), hash), rtx, true);
+};
+
+bool CHDWalletDB::EraseArchivedTxRecord(const uint256 &hash)
+{
+    return EraseIC(std::make_pair(std::string("artx"), hash));
+};
+
 
 bool CHDWalletDB::ReadStoredTx(const uint256 &hash, CStoredTransaction &stx, uint32_t nFlags)
 {
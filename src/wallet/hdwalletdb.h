@@ -32,6 +32,7 @@ prefixes
     acentry
 
     aki                 - anon key image: CPubKey - COutpoint
+    artx                - archived CTransactionRecord, not loaded into mapRecords
 
     bestblock
     bestblockheader
@@ -391,6 +392,11 @@ public:
     bool WriteTxRecord(const uint256 &hash, const CTransactionRecord &rtx);
     bool EraseTxRecord(const uint256 &hash);
 
+    bool HaveArchivedTxRecord(const uint256 &hash);
+    bool ReadArchivedTxRecord(const uint256 &hash, CTransactionRecord &rtx, uint32_t nFlags=DB_READ_UNCOMMITTED);
+    bool WriteArchivedTxRecord(const uint256 &hash, const CTransactionRecord &rtx);
+    bool EraseArchivedTxRecord(const uint256 &hash);
+
 
     bool ReadStoredTx(const uint256 &hash, CStoredTransaction &stx, uint32_t nFlags=DB_READ_UNCOMMITTED);
     bool WriteStoredTx(const uint256 &hash, const CStoredTransaction &stx);
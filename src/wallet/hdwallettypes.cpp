@@ -4,6 +4,11 @@
 
 #include <wallet/hdwallettypes.h>
 
+#include <crypto/siphash.h>
+#include <random.h>
+
+#include <limits>
+
 int CTransactionRecord::InsertOutput(COutputRecord &r)
 {
     for (size_t i = 0; i < vout.size(); ++i) {
@@ -73,6 +78,49 @@ const COutputRecord *CTransactionRecord::GetChangeOutput() const
     return nullptr;
 };
 
+template <typename Fn>
+static void ForEachBalance(CHDWalletBalances &a, const CHDWalletBalances &b, Fn fn)
+{
+    fn(a.nPart, b.nPart);
+    fn(a.nPartUnconf, b.nPartUnconf);
+    fn(a.nPartStaked, b.nPartStaked);
+    fn(a.nPartImmature, b.nPartImmature);
+    fn(a.nPartWatchOnly, b.nPartWatchOnly);
+    fn(a.nPartWatchOnlyUnconf, b.nPartWatchOnlyUnconf);
+    fn(a.nPartWatchOnlyStaked, b.nPartWatchOnlyStaked);
+    fn(a.nPartWatchOnlyImmature, b.nPartWatchOnlyImmature);
+    fn(a.nBlind, b.nBlind);
+    fn(a.nBlindUnconf, b.nBlindUnconf);
+    fn(a.nBlindWatchOnly, b.nBlindWatchOnly);
+    fn(a.nBlindWatchOnlyUnconf, b.nBlindWatchOnlyUnconf);
+    fn(a.nAnon, b.nAnon);
+    fn(a.nAnonUnconf, b.nAnonUnconf);
+    fn(a.nAnonImmature, b.nAnonImmature);
+    fn(a.nAnonWatchOnly, b.nAnonWatchOnly);
+    fn(a.nAnonWatchOnlyUnconf, b.nAnonWatchOnlyUnconf);
+    fn(a.nAnonWatchOnlyImmature, b.nAnonWatchOnlyImmature);
+}
+
+CHDWalletBalances &CHDWalletBalances::operator+=(const CHDWalletBalances &b)
+{
+    ForEachBalance(*this, b, [](CAmount &x, CAmount y) { x += y; });
+    return *this;
+}
+
+CHDWalletBalances &CHDWalletBalances::operator-=(const CHDWalletBalances &b)
+{
+    ForEachBalance(*this, b, [](CAmount &x, CAmount y) { x -= y; });
+    return *this;
+}
+
+bool CHDWalletBalances::IsNull() const
+{
+    CHDWalletBalances unused;
+    bool fNull = true;
+    ForEachBalance(unused, *this, [&fNull](CAmount &, CAmount y) { fNull = fNull && y == 0; });
+    return fNull;
+}
+
 bool CStoredTransaction::InsertBlind(int n, const uint8_t *p)
 {
     for (auto &bp : vBlinds) {
@@ -110,3 +158,62 @@ bool CStoredTransaction::GetAnonPubkey(int n, CCmpPubKey &anon_pubkey) const
     anon_pubkey = ((CTxOutRingCT*)pout)->pk;
     return true;
 }
+
+uint64_t CScriptFingerprintSet::Fingerprint(const CScript &script) const
+{
+    uint64_t fp = CSipHasher(m_k0, m_k1).Write(script.data(), script.size()).Finalize();
+    return fp ? fp : 1;
+}
+
+void CScriptFingerprintSet::InsertFingerprint(uint64_t fp)
+{
+    size_t mask = m_table.size() - 1;
+    for (size_t i = fp & mask;; i = (i + 1) & mask) {
+        if (m_table[i] == fp) {
+            return;
+        }
+        if (m_table[i] == 0) {
+            m_table[i] = fp;
+            m_elements++;
+            return;
+        }
+    }
+}
+
+void CScriptFingerprintSet::Insert(const CScript &script)
+{
+    if (m_table.empty()) {
+        m_k0 = GetRand(std::numeric_limits<uint64_t>::max());
+        m_k1 = GetRand(std::numeric_limits<uint64_t>::max());
+        m_table.resize(64, 0);
+    }
+    if ((m_elements + 1) * 2 > m_table.size()) {
+        // Keep the load under half so probe runs stay short
+        std::vector<uint64_t> old(m_table.size() * 2, 0);
+        old.swap(m_table);
+        m_elements = 0;
+        for (uint64_t fp : old) {
+            if (fp) {
+                InsertFingerprint(fp);
+            }
+        }
+    }
+    InsertFingerprint(Fingerprint(script));
+}
+
+bool CScriptFingerprintSet::MayContain(const CScript &script) const
+{
+    if (m_table.empty()) {
+        return false;
+    }
+    uint64_t fp = Fingerprint(script);
+    size_t mask = m_table.size() - 1;
+    for (size_t i = fp & mask;; i = (i + 1) & mask) {
+        if (m_table[i] == fp) {
+            return true;
+        }
+        if (m_table[i] == 0) {
+            return false;
+        }
+    }
+}
@@ -75,6 +75,7 @@ enum MixinSelectionModes
     MIXIN_SEL_RECENT         = 1,
     MIXIN_SEL_NEARBY         = 2,
     MIXIN_SEL_FULL_RANGE     = 3,
+    MIXIN_SEL_GAMMA          = 4,
     MIXIN_SEL_DEBUG          = 99,
 };
 
@@ -292,6 +293,29 @@ public:
     CAmount nAnonWatchOnly = 0;
     CAmount nAnonWatchOnlyUnconf = 0;
     CAmount nAnonWatchOnlyImmature = 0;
+
+    CHDWalletBalances &operator+=(const CHDWalletBalances &b);
+    CHDWalletBalances &operator-=(const CHDWalletBalances &b);
+    bool IsNull() const;
+};
+
+/** Open addressing set of salted script fingerprints.
+ *  A miss is exact, a hit can be a collision or a removed entry and must be confirmed by the caller. */
+class CScriptFingerprintSet
+{
+public:
+    void Clear() { m_table.clear(); m_elements = 0; };
+    void Insert(const CScript &script);
+    bool MayContain(const CScript &script) const;
+    size_t Size() const { return m_elements; };
+
+private:
+    uint64_t Fingerprint(const CScript &script) const;
+    void InsertFingerprint(uint64_t fp);
+
+    std::vector<uint64_t> m_table; // 0 marks an empty slot
+    size_t m_elements = 0;
+    uint64_t m_k0 = 0, m_k1 = 0;
 };
 
 class CStoredTransaction
@@ -16,8 +16,11 @@
 #include <util/system.h>
 #include <util/time.h>
 #include <util/translation.h>
+#include <wallet/context.h>
 #include <wallet/rpcwallet.h>
 #include <wallet/wallet.h>
+#include <wallet/walletsnapshot.h>
+#include <wallet/walletutil.h>
 
 #include <wallet/hdwallet.h>
 
@@ -941,6 +944,137 @@ RPCHelpMan dumpwallet()
     };
 }
 
+RPCHelpMan dumpwalletsnapshot()
+{
+    return RPCHelpMan{"dumpwalletsnapshot",
+                "\nWrites every record of the wallet database to a binary snapshot file on the server, to be loaded with importwalletsnapshot."
+                "\nThe wallet keeps running while the snapshot is written. This does not allow overwriting existing files.\n"
+                "Private keys are written encrypted if the wallet is encrypted.\n",
+                {
+                    {"filename", RPCArg::Type::STR, RPCArg::Optional::NO, "The filename with path (absolute path recommended)"},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::STR, "filename", "The filename with full absolute path"},
+                        {RPCResult::Type::NUM, "records", "Number of database records written"},
+                        {RPCResult::Type::NUM, "chunks", "Number of checksummed chunks written"},
+                        {RPCResult::Type::NUM, "bytes", "Size of the records written"},
+                    }
+                },
+                RPCExamples{
+                    HelpExampleCli("dumpwalletsnapshot", "\"test.snapshot\"")
+            + HelpExampleRpc("dumpwalletsnapshot", "\"test.snapshot\"")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    std::shared_ptr<CWallet> const pwallet = GetWalletForJSONRPCRequest(request);
+    if (!pwallet) return NullUniValue;
+
+    fs::path filepath = request.params[0].get_str();
+    filepath = fs::absolute(filepath);
+
+    // Prevent arbitrary files from being overwritten, as in dumpwallet
+    if (fs::exists(filepath)) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, filepath.string() + " already exists. If you are sure this is what you want, move it out of the way first");
+    }
+
+    WalletSnapshotStats stats;
+    bilingual_str error;
+    if (!DumpWalletSnapshot(*pwallet, filepath, stats, error)) {
+        throw JSONRPCError(RPC_WALLET_ERROR, error.original);
+    }
+
+    UniValue reply(UniValue::VOBJ);
+    reply.pushKV("filename", filepath.string());
+    reply.pushKV("records", stats.records);
+    reply.pushKV("chunks", stats.chunks);
+    reply.pushKV("bytes", stats.bytes);
+
+    return reply;
+},
+    };
+}
+
+RPCHelpMan importwalletsnapshot()
+{
+    return RPCHelpMan{"importwalletsnapshot",
+                "\nCreates a new wallet from a snapshot written by dumpwalletsnapshot and loads it."
+                "\nThe wallet is restored as it was when the snapshot was taken, including its transactions, so no rescan is needed."
+                "\nThe snapshot is verified as it is read, the new wallet is removed if it fails.\n",
+                {
+                    {"filename", RPCArg::Type::STR, RPCArg::Optional::NO, "The snapshot file"},
+                    {"wallet_name", RPCArg::Type::STR, RPCArg::Optional::NO, "The name for the new wallet, must not exist."},
+                    {"load_on_startup", RPCArg::Type::BOOL, /* default */ "null", "Save wallet name to persistent settings and load on startup. True to add wallet to startup list, false to remove, null to leave unchanged."},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::STR, "name", "The wallet name if loaded successfully."},
+                        {RPCResult::Type::NUM, "records", "Number of database records read"},
+                        {RPCResult::Type::NUM, "chunks", "Number of checksummed chunks read"},
+                        {RPCResult::Type::STR, "warning", "Warning message if wallet was not loaded cleanly."},
+                    }
+                },
+                RPCExamples{
+                    HelpExampleCli("importwalletsnapshot", "\"test.snapshot\" \"restored\"")
+            + HelpExampleRpc("importwalletsnapshot", "\"test.snapshot\", \"restored\"")
+                },
+        [&](const RPCHelpMan& self, const JSONRPCRequest& request) -> UniValue
+{
+    WalletContext& context = EnsureWalletContext(request.context);
+    const fs::path filepath = fs::absolute(request.params[0].get_str());
+    const std::string name(request.params[1].get_str());
+
+    bilingual_str error;
+    std::string format;
+    if (!ReadWalletSnapshotFormat(filepath, format, error)) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, error.original);
+    }
+
+    DatabaseOptions options;
+    DatabaseStatus status;
+    options.require_create = true;
+    options.require_format = format == "sqlite" ? DatabaseFormat::SQLITE : DatabaseFormat::BERKELEY;
+
+    const fs::path wallet_path = fs::absolute(name, GetWalletDir());
+    const bool existed = fs::exists(wallet_path);
+    std::unique_ptr<WalletDatabase> database = MakeWalletDatabase(name, options, status, error);
+    if (!database) {
+        throw JSONRPCError(RPC_WALLET_ERROR, error.original);
+    }
+
+    WalletSnapshotStats stats;
+    if (!ReadWalletSnapshot(filepath, *database, stats, error)) {
+        database.reset();
+        if (!existed) {
+            boost::system::error_code ec;
+            fs::remove_all(wallet_path, ec);
+        }
+        throw JSONRPCError(RPC_WALLET_ERROR, error.original);
+    }
+    database.reset();
+
+    DatabaseOptions load_options;
+    load_options.require_existing = true;
+    std::vector<bilingual_str> warnings;
+    Optional<bool> load_on_start = request.params[2].isNull() ? nullopt : Optional<bool>(request.params[2].get_bool());
+    std::shared_ptr<CWallet> const wallet = LoadWallet(*context.chain, name, load_on_start, load_options, status, error, warnings);
+    if (!wallet) {
+        throw JSONRPCError(RPC_WALLET_ERROR, error.original);
+    }
+
+    UniValue obj(UniValue::VOBJ);
+    obj.pushKV("name", wallet->GetName());
+    obj.pushKV("records", stats.records);
+    obj.pushKV("chunks", stats.chunks);
+    obj.pushKV("warning", Join(warnings, Untranslated("\n")).original);
+
+    return obj;
+},
+    };
+}
+
 struct ImportData
 {
     // Input data
@@ -23,6 +23,7 @@
 #include <timedata.h>
 #include <util/string.h>
 #include <txdb.h>
+#include <insight/insight.h>
 #include <blind.h>
 #include <anon.h>
 #include <util/strencodings.h>
@@ -2877,12 +2878,14 @@ static UniValue deriverangekeys(const JSONRPCRequest &request)
             }
         }
 
+        // Non-hardened ranges are derived up front from the parent prepared once
+        CExtKeyDeriveCache derived(sek, (uint32_t)nStart, fHardened ? 0 : (uint32_t)(nEnd - nStart) + 1, GetWalletLoadThreads());
         uint32_t nChildIn = (uint32_t)nStart;
         CPubKey newKey;
         for (int i = nStart; i <= nEnd; ++i) {
             nChildIn = (uint32_t)i;
             uint32_t nChildOut = 0;
-            if (0 != sek->DeriveKey(newKey, nChildIn, nChildOut, fHardened)) {
+            if (0 != (fHardened ? sek->DeriveKey(newKey, nChildIn, nChildOut, true) : derived.DeriveKey(newKey, nChildIn, nChildOut))) {
                 throw JSONRPCError(RPC_WALLET_ERROR, "DeriveKey failed.");
             }
             if (nChildIn != nChildOut) {
@@ -2937,7 +2940,7 @@ static UniValue clearwallettransactions(const JSONRPCRequest &request)
 {
             RPCHelpMan{"clearwallettransactions",
                 "\nDelete transactions from the wallet.\n"
-                "By default removes only failed stakes.\n"
+                "By default removes only failed stakes, remove_all includes archived records.\n"
                 "Warning: Backup your wallet before using!" +
                 HELP_REQUIRING_PASSPHRASE,
                 {
@@ -3039,6 +3042,23 @@ static UniValue clearwallettransactions(const JSONRPCRequest &request)
 
                 nRecordsRemoved++;
             }
+
+            fFlags = DB_SET_RANGE;
+            ssKey.clear();
+            ssKey << std::string("artx");
+            while (wdb.ReadKeyAtCursor(pcursor, ssKey, fFlags) == 0) {
+                fFlags = DB_NEXT;
+
+                ssKey >> strType;
+                if (strType != "artx")
+                    break;
+
+                if ((rv = pcursor->del(0)) != 0) {
+                    throw JSONRPCError(RPC_MISC_ERROR, "pcursor->del failed.");
+                }
+
+                nRecordsRemoved++;
+            }
         }
 
         pcursor->close();
@@ -3097,6 +3117,60 @@ static bool ParseOutput(
 
 extern void WalletTxToJSON(interfaces::Chain& chain, const CWalletTx& wtx, UniValue& entry, bool fFilterMode=false);
 
+static UniValue archivewallettransactions(const JSONRPCRequest &request)
+{
+            RPCHelpMan{"archivewallettransactions",
+                "\nMove old transaction records out of memory into the wallet's archive store.\n"
+                "Only records with every owned output spent are moved, unspent outputs stay loaded.\n"
+                "Archived records are still shown by gettransaction and by filtertransactions with include_archived.\n",
+                {
+                    {"min_depth", RPCArg::Type::NUM, /* default */ "10080", "Minimum depth of the records and their spends, at least " + ToString(MAX_REORG_DEPTH) + "."},
+                    {"older_than", RPCArg::Type::NUM, /* default */ "0", "Only move records older than this many seconds."},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "",
+                    {
+                        {RPCResult::Type::NUM, "records_archived", "Number of records moved to the archive"},
+                        {RPCResult::Type::NUM, "records_loaded", "Number of records still in memory"},
+                    }
+                },
+                RPCExamples{
+            HelpExampleCli("archivewallettransactions", "") +
+            HelpExampleCli("archivewallettransactions", "20000 31536000") +
+            "\nAs a JSON-RPC call\n"
+            + HelpExampleRpc("archivewallettransactions", "20000, 31536000")
+                },
+            }.Check(request);
+
+    std::shared_ptr<CWallet> const wallet = GetWalletForJSONRPCRequest(request);
+    if (!wallet) return NullUniValue;
+    CHDWallet *const pwallet = GetParticlWallet(wallet.get());
+
+    pwallet->BlockUntilSyncedToCurrentChain();
+
+    int min_depth = request.params[0].isNull() ? 10080 : request.params[0].get_int();
+    if (min_depth < MAX_REORG_DEPTH) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, strprintf("min_depth must be at least %d.", MAX_REORG_DEPTH));
+    }
+    int64_t older_than = request.params[1].isNull() ? 0 : request.params[1].get_int64();
+    if (older_than < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "older_than must be positive.");
+    }
+
+    LOCK(pwallet->cs_wallet);
+
+    size_t nArchived = 0;
+    if (!pwallet->ArchiveRecords(min_depth, GetTime() - older_than, nArchived)) {
+        throw JSONRPCError(RPC_WALLET_ERROR, "ArchiveRecords failed.");
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("records_archived", (int)nArchived);
+    result.pushKV("records_loaded", (int)pwallet->mapRecords.size());
+
+    return result;
+}
+
 static void ParseOutputs(
     UniValue            &entries,
     CWalletTx           &wtx,
@@ -3642,6 +3716,12 @@ static std::string getAddress(UniValue const & transaction)
     return std::string();
 }
 
+template <typename T>
+static void SortByTimeDesc(std::vector<std::pair<int64_t, T> > &v)
+{
+    std::stable_sort(v.begin(), v.end(), [](const std::pair<int64_t, T> &a, const std::pair<int64_t, T> &b) { return a.first > b.first; });
+}
+
 static UniValue filtertransactions(const JSONRPCRequest &request)
 {
             RPCHelpMan{"filtertransactions",
@@ -3677,6 +3757,7 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
                             {"show_anon_spends", RPCArg::Type::BOOL, /* default */ "false", "Display inputs for anon transactions"},
                             {"show_change", RPCArg::Type::BOOL, /* default */ "false", "Display change outputs (for anon and blind txns)"},
                             {"show_smsg_fees", RPCArg::Type::BOOL, /* default */ "false", "List the smsgids funded by the transactions"},
+                            {"include_archived", RPCArg::Type::BOOL, /* default */ "false", "Read records moved out of memory by archivewallettransactions"},
                         },
                         "options"},
                 },
@@ -3719,6 +3800,7 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
     bool show_anon_spends = false;
     bool show_change = false;
     bool show_smsg_fees = false;
+    bool include_archived = false;
 
     if (!request.params[0].isNull()) {
         const UniValue &options = request.params[0].get_obj();
@@ -3739,6 +3821,7 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
                 {"show_anon_spends",        UniValueType(UniValue::VBOOL)},
                 {"show_change",             UniValueType(UniValue::VBOOL)},
                 {"show_smsg_fees",       UniValueType(UniValue::VBOOL)},
+                {"include_archived",        UniValueType(UniValue::VBOOL)},
             },
             true, // allow null
             false // strict
@@ -3852,6 +3935,9 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
         if (options["show_smsg_fees"].isBool()) {
             show_smsg_fees = options["show_smsg_fees"].get_bool();
         }
+        if (options["include_archived"].isBool()) {
+            include_archived = options["include_archived"].get_bool();
+        }
     }
 
     if (show_blinding_factors || show_anon_spends) {
@@ -3874,7 +3960,13 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
     // for transactions and records
     UniValue transactions(UniValue::VARR);
 
+    // With the default time sort only the newest skip + count entries of each
+    // source can be on the page. Candidates are ordered by time before the
+    // costly parsing so each walk can stop once the page is covered.
+    const size_t nWanted = (sort == "time" && count > 0) ? (size_t)skip + count : 0;
+
     // transaction processing
+    std::vector<std::pair<int64_t, CWalletTx*> > vWtx;
     const CHDWallet::TxItems &txOrdered = pwallet->wtxOrdered;
     CWallet::TxItems::const_reverse_iterator tit = txOrdered.rbegin();
     if (type == "all" || type == "standard")
@@ -3883,47 +3975,70 @@ static UniValue filtertransactions(const JSONRPCRequest &request)
         int64_t txTime = pwtx->GetTxTime();
         if (txTime < timeFrom) break;
         if (txTime <= timeTo)
-            ParseOutputs(
-                transactions,
-                *pwtx,
-                pwallet,
-                watchonly,
-                search,
-                category,
-                fWithReward,
-                fBech32,
-                hide_zero_coinstakes,
-                vTreasuryFundScripts,
-                show_change,
-                show_smsg_fees);
+            vWtx.emplace_back(txTime, pwtx);
         tit++;
     }
+    SortByTimeDesc(vWtx);
+    for (size_t i = 0; i < vWtx.size(); ++i) {
+        if (nWanted && transactions.size() >= nWanted && vWtx[i].first < vWtx[i-1].first) {
+            break;
+        }
+        ParseOutputs(
+            transactions,
+            *vWtx[i].second,
+            pwallet,
+            watchonly,
+            search,
+            category,
+            fWithReward,
+            fBech32,
+            hide_zero_coinstakes,
+            vTreasuryFundScripts,
+            show_change,
+            show_smsg_fees);
+    }
 
     int type_i = WordToType(type);
     // records processing
+    const size_t nFromWtx = transactions.size();
+    std::vector<std::pair<int64_t, MapRecords_t::const_iterator> > vRtx;
     const RtxOrdered_t &rtxOrdered = pwallet->rtxOrdered;
     RtxOrdered_t::const_reverse_iterator rit = rtxOrdered.rbegin();
     while (rit != rtxOrdered.rend()) {
-        const uint256 &hash = rit->second->first;
-        const CTransactionRecord &rtx = rit->second->second;
-        int64_t txTime = rtx.GetTxTime();
+        int64_t txTime = rit->second->second.GetTxTime();
         if (txTime < timeFrom) break;
         if (txTime <= timeTo)
-            ParseRecords(
-                transactions,
-                hash,
-                rtx,
-                pwallet,
-                watchonly,
-                search,
-                category,
-                type_i,
-                show_blinding_factors,
-                show_anon_spends,
-                show_change,
-                show_smsg_fees);
+            vRtx.emplace_back(txTime, rit->second);
         rit++;
     }
+    MapRecords_t mapArchived;
+    if (include_archived) {
+        if (!pwallet->ReadArchivedRecords(timeFrom, timeTo, mapArchived)) {
+            throw JSONRPCError(RPC_WALLET_ERROR, "ReadArchivedRecords failed.");
+        }
+        for (auto mi = mapArchived.cbegin(); mi != mapArchived.cend(); ++mi) {
+            vRtx.emplace_back(mi->second.GetTxTime(), mi);
+        }
+    }
+    SortByTimeDesc(vRtx);
+    for (size_t i = 0; i < vRtx.size(); ++i) {
+        if (nWanted && transactions.size() - nFromWtx >= nWanted && vRtx[i].first < vRtx[i-1].first) {
+            break;
+        }
+        ParseRecords(
+            transactions,
+            vRtx[i].second->first,
+            vRtx[i].second->second,
+            pwallet,
+            watchonly,
+            search,
+            category,
+            type_i,
+            show_blinding_factors,
+            show_anon_spends,
+            show_change,
+            show_smsg_fees);
+    }
 
     // Sort
     std::vector<UniValue> values = transactions.getValues();
@@ -4397,6 +4512,14 @@ static UniValue getstakinginfo(const JSONRPCRequest &request)
                         {RPCResult::Type::NUM, "pooledtx", "The number of transactions in the mempool"},
                         {RPCResult::Type::NUM, "difficulty", "The current difficulty"},
                         {RPCResult::Type::NUM, "lastsearchtime", "The last time this wallet searched for a coinstake"},
+                        {RPCResult::Type::OBJ, "search", "Kernel searches of this wallet by the staking threads",
+                        {
+                            {RPCResult::Type::NUM, "searches", "Timestamps searched since the wallet was loaded"},
+                            {RPCResult::Type::NUM, "last_ms", "Duration of the last search"},
+                            {RPCResult::Type::NUM, "avg_ms", "Average duration of a search"},
+                            {RPCResult::Type::NUM, "max_ms", "Longest search"},
+                            {RPCResult::Type::NUM, "last_delay_ms", "Time from the start of the last searched timestamp until a staking thread took the wallet"},
+                        }},
                         {RPCResult::Type::NUM, "weight", "The current stake weight of this wallet"},
                         {RPCResult::Type::NUM, "netstakeweight", "The current stake weight of the network"},
                         {RPCResult::Type::NUM, "expectedtime", "Estimated time for next stake"},
@@ -4430,7 +4553,7 @@ static UniValue getstakinginfo(const JSONRPCRequest &request)
         nMoneySupply = pblockindex->nMoneySupply;
     }
 
-    uint64_t nWeight = pwallet->GetStakeWeight();
+    uint64_t nWeight = pwallet->GetOrPublishReadView()->nStakeWeight;
 
     uint64_t nNetworkWeight = GetPoSKernelPS(pblockindex);
 
@@ -4494,6 +4617,16 @@ static UniValue getstakinginfo(const JSONRPCRequest &request)
 
     obj.pushKV("difficulty", GetDifficulty(::ChainActive().Tip()));
     obj.pushKV("lastsearchtime", (uint64_t)pwallet->nLastCoinStakeSearchTime);
+    {
+        StakeSearchStats stats = WITH_LOCK(pwallet->cs_wallet, return pwallet->m_stake_search_stats);
+        UniValue search(UniValue::VOBJ);
+        search.pushKV("searches", stats.nSearches);
+        search.pushKV("last_ms", stats.nLastMicros / 1000.0);
+        search.pushKV("avg_ms", stats.nSearches ? stats.nTotalMicros / 1000.0 / stats.nSearches : 0.0);
+        search.pushKV("max_ms", stats.nMaxMicros / 1000.0);
+        search.pushKV("last_delay_ms", stats.nLastDelayMillis);
+        obj.pushKV("search", search);
+    }
 
     obj.pushKV("weight", (uint64_t)nWeight);
     obj.pushKV("netstakeweight", (uint64_t)nNetworkWeight);
@@ -4636,6 +4769,130 @@ static UniValue getcoldstakinginfo(const JSONRPCRequest &request)
 };
 
 
+static UniValue listcoldstakingdelegators(const JSONRPCRequest &request)
+{
+            RPCHelpMan{"listcoldstakingdelegators",
+                "\nList the cold staking outputs this wallet stakes, summed per delegator spend address.\n"
+                "Requires -coldstakingpool, the totals are kept up to date as transactions arrive.\n",
+                {
+                    {"offset", RPCArg::Type::NUM, /* default */ "0", "Number of delegators to skip, ordered by address"},
+                    {"count", RPCArg::Type::NUM, /* default */ "100", "Max no. of delegators to return"},
+                },
+                RPCResult{
+                    RPCResult::Type::OBJ, "", "", {
+                        {RPCResult::Type::NUM, "height", "The chain height the maturity is calculated at"},
+                        {RPCResult::Type::NUM, "num_delegators", "Total number of delegators"},
+                        {RPCResult::Type::NUM, "num_outputs", "Total number of delegated outputs"},
+                        {RPCResult::Type::STR_AMOUNT, "weight", "Total value of the delegated outputs"},
+                        {RPCResult::Type::STR_AMOUNT, "mature_weight", "Total value of the delegated outputs deep enough to stake"},
+                        {RPCResult::Type::ARR, "delegators", "", {
+                            {RPCResult::Type::OBJ, "", "", {
+                                {RPCResult::Type::STR, "address", "The spend address of the delegator"},
+                                {RPCResult::Type::NUM, "outputs", "Number of outputs"},
+                                {RPCResult::Type::STR_AMOUNT, "weight", "Value of the outputs"},
+                                {RPCResult::Type::STR_AMOUNT, "mature_weight", "Value of the outputs deep enough to stake"},
+                                {RPCResult::Type::ARR, "maturing", "Value becoming stakeable, by height", {
+                                    {RPCResult::Type::OBJ, "", "", {
+                                        {RPCResult::Type::NUM, "height", "Chain height the value can stake at, omitted for unconfirmed outputs"},
+                                        {RPCResult::Type::STR_AMOUNT, "amount", "The value"},
+                                    }},
+                                }},
+                                {RPCResult::Type::NUM, "last_stake_height", "Height of the latest coinstake paying to the delegator, 0 if none is tracked"},
+                            }},
+                        }},
+                }},
+                RPCExamples{
+            HelpExampleCli("listcoldstakingdelegators", "0 100") +
+            "\nAs a JSON-RPC call\n"
+            + HelpExampleRpc("listcoldstakingdelegators", "0, 100")
+                },
+            }.Check(request);
+
+    std::shared_ptr<CWallet> const wallet = GetWalletForJSONRPCRequest(request);
+    if (!wallet) return NullUniValue;
+    CHDWallet *const pwallet = GetParticlWallet(wallet.get());
+
+    if (!pwallet->m_cold_staking_pool) {
+        throw JSONRPCError(RPC_WALLET_ERROR, "Cold staking pool mode is not enabled, start with -coldstakingpool.");
+    }
+
+    // Make sure the results are valid at least up to the most recent block
+    // the user could have gotten from another RPC command prior to now
+    pwallet->BlockUntilSyncedToCurrentChain();
+
+    int nOffset = request.params[0].isNull() ? 0 : request.params[0].get_int();
+    int nCount = request.params[1].isNull() ? 100 : request.params[1].get_int();
+    if (nOffset < 0) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "offset must be 0 or greater.");
+    }
+    if (nCount < 1) {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "count must be 1 or greater.");
+    }
+
+    LOCK(pwallet->cs_wallet);
+    pwallet->RefreshStakeCandidates();
+
+    int nHeight = pwallet->chain().getHeight().get_value_or(0);
+    int nRequiredDepth = std::min((int)(Params().GetStakeMinConfirmations()-1), (int)(nHeight / 2));
+    // Outputs confirmed at or below nMatureHeight have nRequiredDepth confirmations
+    int nMatureHeight = nHeight + 1 - nRequiredDepth;
+
+    auto MatureValue = [nMatureHeight](const std::map<int, CAmount> &by_height) {
+        CAmount nValue = 0;
+        for (const auto &hv : by_height) {
+            if (hv.first > nMatureHeight) {
+                break;
+            }
+            if (hv.first > 0) {
+                nValue += hv.second;
+            }
+        }
+        return nValue;
+    };
+
+    CAmount nWeight = 0;
+    for (const auto &hv : pwallet->m_delegated_value_by_height) {
+        nWeight += hv.second;
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.pushKV("height", nHeight);
+    result.pushKV("num_delegators", (uint64_t)pwallet->m_delegators.size());
+    result.pushKV("num_outputs", (uint64_t)pwallet->m_delegated_num_outputs);
+    result.pushKV("weight", ValueFromAmount(nWeight));
+    result.pushKV("mature_weight", ValueFromAmount(MatureValue(pwallet->m_delegated_value_by_height)));
+
+    UniValue delegators(UniValue::VARR);
+    auto it = pwallet->m_delegators.begin();
+    std::advance(it, std::min((size_t)nOffset, pwallet->m_delegators.size()));
+    for (; it != pwallet->m_delegators.end() && (int)delegators.size() < nCount; ++it) {
+        const ColdStakeDelegator &d = it->second;
+        UniValue entry(UniValue::VOBJ);
+        entry.pushKV("address", it->first);
+        entry.pushKV("outputs", (uint64_t)d.nOutputs);
+        entry.pushKV("weight", ValueFromAmount(d.nValue));
+        entry.pushKV("mature_weight", ValueFromAmount(MatureValue(d.mapValueByHeight)));
+        UniValue maturing(UniValue::VARR);
+        for (const auto &hv : d.mapValueByHeight) {
+            if (hv.first > 0 && hv.first <= nMatureHeight) {
+                continue;
+            }
+            UniValue m(UniValue::VOBJ);
+            if (hv.first > 0) {
+                m.pushKV("height", hv.first + nRequiredDepth - 1);
+            }
+            m.pushKV("amount", ValueFromAmount(hv.second));
+            maturing.push_back(m);
+        }
+        entry.pushKV("maturing", maturing);
+        entry.pushKV("last_stake_height", d.nLastStakeHeight);
+        delegators.push_back(entry);
+    }
+    result.pushKV("delegators", delegators);
+
+    return result;
+};
+
 static UniValue listunspentanon(const JSONRPCRequest &request)
 {
             RPCHelpMan{"listunspentanon",
@@ -5888,7 +6145,7 @@ UniValue sendtypeto(const JSONRPCRequest &request)
                                     {"ao_index", RPCArg::Type::NUM, /* default */ "", "anonoutput index"},
                                 },
                             },
-                            {"mixin_selection_mode", RPCArg::Type::NUM, /* default */ "", "Mixin selection mode: 1 select from ranges, 2 select nearby, 3 random full range"},
+                            {"mixin_selection_mode", RPCArg::Type::NUM, /* default */ "", "Mixin selection mode: 1 select from ranges, 2 select nearby, 3 random full range, 4 gamma distributed age"},
                             {"show_hex", RPCArg::Type::BOOL, /* default */ "false", "Display the hex encoded tx"},
                             {"show_fee", RPCArg::Type::BOOL, /* default */ "false", "Return the fee"},
                             {"submit_tx", RPCArg::Type::BOOL, /* default */ "true", "Send the tx"},
@@ -7508,7 +7765,8 @@ static UniValue walletsettings(const JSONRPCRequest &request)
 static UniValue transactionblinds(const JSONRPCRequest &request)
 {
             RPCHelpMan{"transactionblinds",
-                "\nShow known blinding factors for transaction." +
+                "\nShow known blinding factors for transaction.\n"
+                "Blinding factors not stored are recovered by rewinding the rangeproofs of the owned outputs." +
                 HELP_REQUIRING_PASSPHRASE,
                 {
                     {"txnid", RPCArg::Type::STR_HEX, RPCArg::Optional::NO, "The transaction id."},
@@ -7544,10 +7802,32 @@ static UniValue transactionblinds(const JSONRPCRequest &request)
         throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No stored data found for txn");
     }
 
+    // Rewind the owned outputs with no stored blind together
+    std::vector<RangeProofRewind> rewinds;
+    {
+        LOCK(pwallet->cs_wallet);
+        pwallet->GetOwnedRewinds(*stx.tx, rewinds);
+    }
+    rewinds.erase(std::remove_if(rewinds.begin(), rewinds.end(), [&stx](const RangeProofRewind &r) {
+        uint8_t blind[32];
+        return stx.GetBlind(r.n, blind);
+    }), rewinds.end());
+    RewindRangeProofs(rewinds);
+    std::map<uint32_t, const RangeProofRewind*> rewound;
+    for (const auto &r : rewinds) {
+        if (r.rewound) {
+            rewound[r.n] = &r;
+        }
+    }
+
     for (size_t i = 0; i < stx.tx->vpout.size(); ++i) {
         uint256 tmp;
         if (stx.GetBlind(i, tmp.begin())) {
             result.pushKV(strprintf("%d", i), tmp.ToString());
+        } else
+        if (rewound.count(i)) {
+            memcpy(tmp.begin(), rewound[i]->blind, 32);
+            result.pushKV(strprintf("%d", i), tmp.ToString());
         }
     }
 
@@ -7975,23 +8255,36 @@ static UniValue tallyvotes(const JSONRPCRequest &request)
             break;
         }
         if (pindex->nHeight <= nEndHeight) {
-            if (!ReadBlockFromDisk(block, pindex, consensusParams)) {
-                continue;
-            }
+            uint32_t voteToken = 0;
+            if (fVoteIndex) {
+                // Blocks without a coinstake have no entry
+                if (!GetBlockVote(pindex->GetBlockHash(), voteToken)) {
+                    continue;
+                }
+            } else {
+                if (IsBlockPruned(pindex)) {
+                    throw JSONRPCError(RPC_MISC_ERROR, strprintf("Block %d is pruned, counting votes over pruned blocks needs -voteindex.", pindex->nHeight));
+                }
+                if (!ReadBlockFromDisk(block, pindex, consensusParams)) {
+                    continue;
+                }
 
-            if (block.vtx.size() < 1
-                || !block.vtx[0]->IsCoinStake()) {
-                continue;
+                if (block.vtx.size() < 1
+                    || !block.vtx[0]->IsCoinStake()) {
+                    continue;
+                }
+
+                std::vector<uint8_t> &vData = ((CTxOutData*)block.vtx[0]->vpout[0].get())->vData;
+                if (vData.size() > 8 && vData[4] == DO_VOTE) {
+                    memcpy(&voteToken, &vData[5], 4);
+                    voteToken = le32toh(voteToken);
+                }
             }
 
-            std::vector<uint8_t> &vData = ((CTxOutData*)block.vtx[0]->vpout[0].get())->vData;
-            if (vData.size() < 9 || vData[4] != DO_VOTE) {
+            if (voteToken == 0) {
                 ri = mapVotes.insert(std::pair<int, int>(0, 1));
                 if (!ri.second) ri.first->second++;
             } else {
-                uint32_t voteToken;
-                memcpy(&voteToken, &vData[5], 4);
-                voteToken = le32toh(voteToken);
                 int option = 0; // default to abstain
 
                 // count only if related to current issue:
@@ -9789,11 +10082,20 @@ static UniValue extkeyimportmasterlegacy(const JSONRPCRequest &request)
 static UniValue geteligibleaddresses(const JSONRPCRequest& request)
 {
     RPCHelpMan{"geteligibleaddresses",
-                "\nReturn the list of eligible addresses at the specified height" +
+                "\nReturn the list of eligible addresses at the specified height.\n"
+                "The eligible addresses are kept until the next block is connected, requests for that height don't read the database." +
                 HELP_REQUIRING_PASSPHRASE,
                 {
                     {"height", RPCArg::Type::NUM, /* default */ "0", "The height at which to return the eligble addresses"},
                     {"eligibleonly", RPCArg::Type::BOOL, /* default */ "1", "Whether to return eligible addresses only. When set to true height is the current height"},
+                    {"options", RPCArg::Type::OBJ, /* default */ "", "",
+                        {
+                            {"min_multiplier", RPCArg::Type::NUM, /* default */ "1", "Only return eligible addresses with at least this reward multiplier."},
+                            {"prefix", RPCArg::Type::STR, /* default */ "", "Only return addresses starting with prefix."},
+                            {"skip", RPCArg::Type::NUM, /* default */ "0", "Number of addresses to skip."},
+                            {"count", RPCArg::Type::NUM, /* default */ "0", "Number of addresses to return, 0 for unlimited."},
+                        },
+                        "options"},
                 },
              RPCResult{
                     RPCResult::Type::OBJ, "", "", {
@@ -9801,11 +10103,13 @@ static UniValue geteligibleaddresses(const JSONRPCRequest& request)
                         RPCResult::Type::OBJ, "", "", {
                             {RPCResult::Type::STR, "Address", "The address eligible"},
                             {RPCResult::Type::NUM, "Balance", "Balance of the eligible address"},
+                            {RPCResult::Type::NUM, "Multiplier", /* optional */ true, "Reward multiplier of the eligible address"},
                         }
                     }
                 }},
             RPCExamples{
                 HelpExampleCli("geteligibleaddresses", "4 1")
+                + HelpExampleRpc("geteligibleaddresses", "4, true, {\"prefix\":\"g\", \"count\":100}")
             },
         }.Check(request);
     
@@ -9822,35 +10126,84 @@ static UniValue geteligibleaddresses(const JSONRPCRequest& request)
         eligibleonly = request.params.size() > 1 ? std::stoi(request.params[1].get_str()) : true;
     }
 
-    auto& rewardTracker = initColdReward();
-
-    std::vector<std::pair<ColdRewardTracker::AddressType, CAmount>> addresses;
+    unsigned int min_multiplier = 1;
+    std::string prefix;
+    int skip = 0;
+    int count = 0;
+    if (!request.params[2].isNull()) {
+        const UniValue &options = request.params[2].get_obj();
+        RPCTypeCheckObj(options,
+            {
+                {"min_multiplier",      UniValueType(UniValue::VNUM)},
+                {"prefix",              UniValueType(UniValue::VSTR)},
+                {"skip",                UniValueType(UniValue::VNUM)},
+                {"count",               UniValueType(UniValue::VNUM)},
+            }, true, true);
+        if (options.exists("min_multiplier")) {
+            min_multiplier = options["min_multiplier"].get_int();
+        }
+        if (options.exists("prefix")) {
+            prefix = options["prefix"].get_str();
+        }
+        if (options.exists("skip")) {
+            skip = options["skip"].get_int();
+        }
+        if (options.exists("count")) {
+            count = options["count"].get_int();
+        }
+        if (skip < 0 || count < 0) {
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "skip and count must be positive.");
+        }
+    }
+    const ColdRewardTracker::AddressType addressPrefix(prefix.begin(), prefix.end());
+    const auto hasPrefix = [&addressPrefix](const ColdRewardTracker::AddressType& addr) {
+        return addr.size() >= addressPrefix.size() && std::equal(addressPrefix.begin(), addressPrefix.end(), addr.begin());
+    };
+    const auto addressEntry = [](const ColdRewardTracker::AddressType& addr, CAmount balance) {
+        UniValue innerResult(UniValue::VOBJ);
+        innerResult.pushKV("Address", std::string(addr.begin(), addr.end()));
+        innerResult.pushKV("Balance", ValueFromAmount(balance));
+        return innerResult;
+    };
 
     if (!eligibleonly) {
-        height = ::ChainActive().Tip()->nHeight;
-        addresses = rewardTracker.getBalances();
-    } else {
-        const auto addrMul = rewardTracker.getEligibleAddresses(height);
-        const auto balances = rewardTracker.getBalances();
-
-        for (const auto& b: balances) {
-            auto res = std::find_if(addrMul.begin(), addrMul.end(), [&b](const std::pair<ColdRewardTracker::AddressType, CAmount>& s){
-                return s.first == b.first;
-            });
-
-            if (res != addrMul.end()) {
-                addresses.push_back(std::make_pair(res->first, b.second));
+        std::vector<std::pair<ColdRewardTracker::AddressType, CAmount>> addresses;
+        {
+            LOCK(cs_main);
+            addresses = initColdReward().getBalances();
+        }
+        for (const auto& trackedAddr : addresses) {
+            if (!hasPrefix(trackedAddr.first) || skip-- > 0) {
+                continue;
+            }
+            result.push_back(addressEntry(trackedAddr.first, trackedAddr.second));
+            if (count > 0 && (int)result.size() >= count) {
+                break;
             }
         }
+        return result;
     }
 
-    for (const auto& trackedAddr : addresses) {
-        UniValue innerResult(UniValue::VOBJ);
-        innerResult.pushKV("Address", std::string(trackedAddr.first.begin(), trackedAddr.first.end()) );
-        innerResult.pushKV("Balance", ValueFromAmount(trackedAddr.second));
+    // The snapshot is shared with the other callers until the next block, walk it without cs_main
+    std::shared_ptr<const std::vector<ColdRewardTracker::EligibleBalance>> snapshot;
+    {
+        LOCK(cs_main);
+        snapshot = initColdReward().getEligibleSnapshot(height);
+    }
+    auto it = std::lower_bound(snapshot->begin(), snapshot->end(), addressPrefix,
+        [](const ColdRewardTracker::EligibleBalance& e, const ColdRewardTracker::AddressType& addr) { return e.address < addr; });
+    for (; it != snapshot->end() && hasPrefix(it->address); ++it) {
+        if (it->multiplier < min_multiplier || skip-- > 0) {
+            continue;
+        }
+        UniValue innerResult = addressEntry(it->address, it->balance);
+        innerResult.pushKV("Multiplier", (int)it->multiplier);
         result.push_back(innerResult);
+        if (count > 0 && (int)result.size() >= count) {
+            break;
+        }
     }
-    
+
     return result;
 }
 
@@ -9977,6 +10330,7 @@ static const CRPCCommand commands[] =
     { "wallet",             "reservebalance",                   &reservebalance,                {"enabled","amount"} },
     { "wallet",             "deriverangekeys",                  &deriverangekeys,               {"start","end","key/id","hardened","save","add_to_addressbook","256bithash"} },
     { "wallet",             "clearwallettransactions",          &clearwallettransactions,       {"remove_all"} },
+    { "wallet",             "archivewallettransactions",        &archivewallettransactions,     {"min_depth","older_than"} },
 
     { "wallet",             "filtertransactions",               &filtertransactions,            {"options"} },
     { "wallet",             "filteraddresses",                  &filteraddresses,               {"offset","count","sort_code","match_str","match_owned","show_path"} },
@@ -9984,6 +10338,7 @@ static const CRPCCommand commands[] =
 
     { "wallet",             "getstakinginfo",                   &getstakinginfo,                {} },
     { "wallet",             "getcoldstakinginfo",               &getcoldstakinginfo,            {} },
+    { "wallet",             "listcoldstakingdelegators",        &listcoldstakingdelegators,     {"offset","count"} },
 
     { "wallet",             "listunspentanon",                  &listunspentanon,               {"minconf","maxconf","addresses","include_unsafe","query_options"} },
     { "wallet",             "listunspentblind",                 &listunspentblind,              {"minconf","maxconf","addresses","include_unsafe","query_options"} },
@@ -10033,7 +10388,7 @@ static const CRPCCommand commands[] =
     { "blockchain",         "pruneorphanedblocks",              &pruneorphanedblocks,           {"testonly"} },
     { "blockchain",         "rehashblock",                      &rehashblock,                   {"blockhex","signwith","addtxns"} },
 
-    { "blockchain",         "geteligibleaddresses",             &geteligibleaddresses,          {"height", "eligibleonly"} },
+    { "blockchain",         "geteligibleaddresses",             &geteligibleaddresses,          {"height", "eligibleonly", "options"} },
 };
 // clang-format on
     return MakeSpan(commands);
@@ -2315,9 +2315,14 @@ UniValue gettransaction_inner(JSONRPCRequest const &request)
             LOCK_ASSERTION(phdw->cs_wallet);
             MapRecords_t::const_iterator mri = phdw->mapRecords.find(hash);
 
-            if (mri != phdw->mapRecords.end()) {
-                const CTransactionRecord &rtx = mri->second;
-                RecordTxToJSON(pwallet->chain(), phdw, mri->first, rtx, entry);
+            CTransactionRecord rtx_archived;
+            const bool archived = mri == phdw->mapRecords.end() && phdw->ReadArchivedRecord(hash, rtx_archived);
+            if (mri != phdw->mapRecords.end() || archived) {
+                const CTransactionRecord &rtx = archived ? rtx_archived : mri->second;
+                RecordTxToJSON(pwallet->chain(), phdw, hash, rtx, entry);
+                if (archived) {
+                    entry.pushKV("archived", true);
+                }
 
                 UniValue details(UniValue::VARR);
                 ListRecord(phdw, hash, rtx, "*", 0, false, details, filter);
@@ -3138,12 +3143,11 @@ static RPCHelpMan getbalances()
     // the user could have gotten from another RPC command prior to now
     wallet.BlockUntilSyncedToCurrentChain();
 
-    LOCK(wallet.cs_wallet);
-
     if (IsParticlWallet(&wallet)) {
+        // Read the published view, cs_wallet is only taken if the wallet changed since
         const CHDWallet *pwhd = GetParticlWallet(&wallet);
-        CHDWalletBalances bal;
-        pwhd->GetBalances(bal);
+        std::shared_ptr<const WalletReadView> view = pwhd->GetOrPublishReadView();
+        const CHDWalletBalances &bal = view->bal;
 
         UniValue balances{UniValue::VOBJ};
         {
@@ -3157,8 +3161,7 @@ static RPCHelpMan getbalances()
 
                 // If the AVOID_REUSE flag is set, bal has been set to just the un-reused address balance. Get
                 // the total balance, and then subtract bal to get the reused address balance.
-                CHDWalletBalances full_bal;
-                pwhd->GetBalances(full_bal, false);
+                const CHDWalletBalances &full_bal = view->bal_full;
                 balances_mine.pushKV("used", ValueFromAmount(full_bal.nPart + full_bal.nPartUnconf - bal.nPart - bal.nPartUnconf));
                 balances_mine.pushKV("blind_used", ValueFromAmount(full_bal.nBlind + full_bal.nBlindUnconf - bal.nBlind - bal.nBlindUnconf));
             }
@@ -3192,6 +3195,8 @@ static RPCHelpMan getbalances()
         return balances;
     }
 
+    LOCK(wallet.cs_wallet);
+
     const auto bal = wallet.GetBalance();
     UniValue balances{UniValue::VOBJ};
     {
@@ -3242,6 +3247,16 @@ static RPCHelpMan getwalletinfo()
                         {RPCResult::Type::STR_AMOUNT, "immature_anon_balance", "DEPRECATED. Identical to getbalances().mine.anon_immature"},
                         {RPCResult::Type::STR_AMOUNT, "reserve", "the reserve balance of the wallet in " + CURRENCY_UNIT},
                         {RPCResult::Type::NUM, "txcount", "the total number of transactions in the wallet"},
+                        {RPCResult::Type::NUM, "records_memory_usage", /* optional */ true, "heap memory used by the transaction records in bytes"},
+                        {RPCResult::Type::OBJ, "group_commit", /* optional */ true, "transaction records written in one database transaction per connected block",
+                        {
+                            {RPCResult::Type::NUM, "commits", "number of grouped commits"},
+                            {RPCResult::Type::NUM, "records", "number of transaction records written by them"},
+                            {RPCResult::Type::NUM, "failed", "number of commits that fell back to writing each record on its own"},
+                            {RPCResult::Type::NUM, "last_ms", "duration of the last commit in milliseconds"},
+                            {RPCResult::Type::NUM, "avg_ms", "average duration of a commit in milliseconds"},
+                            {RPCResult::Type::NUM, "max_ms", "longest commit in milliseconds"},
+                        }},
                         {RPCResult::Type::NUM_TIME, "keypoololdest", "the " + UNIX_EPOCH_TIME + " of the oldest pre-generated key in the key pool. Legacy wallets only."},
                         {RPCResult::Type::NUM, "keypoolsize", "how many new keys are pre-generated (only counts external keys)"},
                         {RPCResult::Type::NUM, "keypoolsize_hd_internal", "how many new keys are pre-generated for internal use (used for change outputs, only appears if the wallet is using this feature, otherwise external keys are used)"},
@@ -3326,6 +3341,17 @@ static RPCHelpMan getwalletinfo()
         obj.pushKV("keypoolsize",   pwhd->CountActiveAccountKeys());
 
         obj.pushKV("reserve",   ValueFromAmount(pwhd->nReserveBalance));
+        obj.pushKV("records_memory_usage", (uint64_t)pwhd->RecordsDynamicMemoryUsage());
+
+        const WalletCommitStats commit_stats = pwhd->GetCommitStats();
+        UniValue group_commit(UniValue::VOBJ);
+        group_commit.pushKV("commits", commit_stats.nCommits);
+        group_commit.pushKV("records", commit_stats.nRecords);
+        group_commit.pushKV("failed", commit_stats.nFailed);
+        group_commit.pushKV("last_ms", commit_stats.nLastMicros * 0.001);
+        group_commit.pushKV("avg_ms", commit_stats.nCommits ? (commit_stats.nTotalMicros * 0.001) / commit_stats.nCommits : 0.0);
+        group_commit.pushKV("max_ms", commit_stats.nMaxMicros * 0.001);
+        obj.pushKV("group_commit", group_commit);
 
         obj.pushKV("encryptionstatus", !pwhd->IsCrypted()
             ? "Unencrypted" : pwhd->IsLocked() ? "Locked" : pwhd->fUnlockForStakingOnly ? "Unlocked, staking only" : "Unlocked");
@@ -3683,7 +3709,7 @@ static RPCHelpMan unloadwallet()
     }
 
     if (fParticlMode) {
-        RestartStakingThreads();
+        RemoveStakingWallet(wallet.get());
     }
 
     UnloadWallet(std::move(wallet));
@@ -5644,6 +5670,8 @@ RPCHelpMan importaddress();
 RPCHelpMan importpubkey();
 RPCHelpMan dumpwallet();
 RPCHelpMan importwallet();
+RPCHelpMan dumpwalletsnapshot();
+RPCHelpMan importwalletsnapshot();
 RPCHelpMan importprunedfunds();
 RPCHelpMan removeprunedfunds();
 RPCHelpMan importmulti();
@@ -5666,6 +5694,7 @@ static const CRPCCommand commands[] =
     { "wallet",             "createwallet",                     &createwallet,                  {"wallet_name", "disable_private_keys", "blank", "passphrase", "avoid_reuse", "descriptors", "load_on_startup", "use_legacy"} },
     { "wallet",             "dumpprivkey",                      &dumpprivkey,                   {"address"}  },
     { "wallet",             "dumpwallet",                       &dumpwallet,                    {"filename"} },
+    { "wallet",             "dumpwalletsnapshot",               &dumpwalletsnapshot,            {"filename"} },
     { "wallet",             "encryptwallet",                    &encryptwallet,                 {"passphrase"} },
     { "wallet",             "getaddressesbylabel",              &getaddressesbylabel,           {"label"} },
     { "wallet",             "getaddressinfo",                   &getaddressinfo,                {"address"} },
@@ -5685,6 +5714,7 @@ static const CRPCCommand commands[] =
     { "wallet",             "importprunedfunds",                &importprunedfunds,             {"rawtransaction","txoutproof"} },
     { "wallet",             "importpubkey",                     &importpubkey,                  {"pubkey","label","rescan"} },
     { "wallet",             "importwallet",                     &importwallet,                  {"filename"} },
+    { "wallet",             "importwalletsnapshot",             &importwalletsnapshot,          {"filename","wallet_name","load_on_startup"} },
     { "wallet",             "keypoolrefill",                    &keypoolrefill,                 {"newsize"} },
     { "wallet",             "listaddressgroupings",             &listaddressgroupings,          {} },
     { "wallet",             "listlabels",                       &listlabels,                    {"purpose"} },
@@ -676,6 +676,7 @@ TransactionError LegacyScriptPubKeyMan::FillPSBT(PartiallySignedTransaction& psb
     if (n_signed) {
         *n_signed = 0;
     }
+    std::vector<unsigned int> to_sign;
     for (unsigned int i = 0; i < psbtx.tx->vin.size(); ++i) {
         const CTxIn& txin = psbtx.tx->vin[i];
         PSBTInput& input = psbtx.inputs.at(i);
@@ -698,11 +699,12 @@ TransactionError LegacyScriptPubKeyMan::FillPSBT(PartiallySignedTransaction& psb
             // There's no UTXO so we can just skip this now
             continue;
         }
-        SignatureData sigdata;
-        input.FillSignatureData(sigdata);
-        SignPSBTInput(HidingSigningProvider(this, !sign, !bip32derivs), psbtx, i, sighash_type);
+        to_sign.push_back(i);
+    }
+    SignPSBTInputs(HidingSigningProvider(this, !sign, !bip32derivs), psbtx, to_sign, sighash_type);
 
-        bool signed_one = PSBTInputSigned(input);
+    for (unsigned int i : to_sign) {
+        bool signed_one = PSBTInputSigned(psbtx.inputs.at(i));
         if (n_signed && (signed_one || !sign)) {
             // If sign is false, we assume that we _could_ sign if we get here. This
             // will never have false negatives; it is hard to tell under what i
@@ -307,6 +307,39 @@ BOOST_AUTO_TEST_CASE(bnb_search_test)
     }
 }
 
+BOOST_AUTO_TEST_CASE(bnb_values_test)
+{
+    std::vector<size_t> selected;
+    std::vector<CAmount> values{1 * CENT, 2 * CENT, 3 * CENT, 4 * CENT};
+
+    // Exact match
+    BOOST_CHECK(SelectValuesBnB(values, 5 * CENT, 0, selected));
+    CAmount total = 0;
+    for (size_t i : selected) {
+        total += values[i];
+    }
+    BOOST_CHECK_EQUAL(total, 5 * CENT);
+    BOOST_CHECK_EQUAL(selected.size(), 2U);
+
+    // Within the cost of change
+    BOOST_CHECK(SelectValuesBnB(values, 8.5 * CENT, 0.5 * CENT, selected));
+    BOOST_CHECK_EQUAL(selected.size(), 3U);
+
+    // No changeless solution
+    BOOST_CHECK(!SelectValuesBnB(values, 8.5 * CENT, 0.1 * CENT, selected));
+    BOOST_CHECK(selected.empty());
+    BOOST_CHECK(!SelectValuesBnB(values, 11 * CENT, 1 * CENT, selected));
+
+    // Values eaten by their input fee are skipped
+    values.push_back(-1);
+    values.push_back(0);
+    BOOST_CHECK(SelectValuesBnB(values, 10 * CENT, 0, selected));
+    BOOST_CHECK_EQUAL(selected.size(), 4U);
+    for (size_t i : selected) {
+        BOOST_CHECK(i < 4);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(knapsack_solver_test)
 {
     CoinSet setCoinsRet, setCoinsRet2;
@@ -629,4 +629,58 @@ BOOST_AUTO_TEST_CASE(opiscoinstake_test)
 }
 
 
+BOOST_AUTO_TEST_CASE(wallet_read_view)
+{
+    CHDWallet *pwallet = pwalletMain.get();
+
+    BOOST_CHECK(!pwallet->GetReadView());
+    std::shared_ptr<const WalletReadView> view = pwallet->GetOrPublishReadView();
+    BOOST_REQUIRE(view);
+    BOOST_CHECK(pwallet->GetReadView() == view);
+    BOOST_CHECK(pwallet->GetOrPublishReadView() == view);
+
+    // Any change to the wallet retires the view
+    pwallet->MarkDirty();
+    BOOST_CHECK(!pwallet->GetReadView());
+    std::shared_ptr<const WalletReadView> view2 = pwallet->GetOrPublishReadView();
+    BOOST_CHECK(view2 != view);
+    BOOST_CHECK(view2->nVersion > view->nVersion);
+
+    pwallet->nReserveBalance = 1;
+    BOOST_CHECK(!pwallet->GetReadView());
+    BOOST_CHECK_EQUAL(pwallet->GetOrPublishReadView()->nReserveBalance, 1);
+    pwallet->nReserveBalance = 0;
+}
+
+BOOST_AUTO_TEST_CASE(script_fingerprint_set)
+{
+    CScriptFingerprintSet set;
+    std::vector<CScript> scripts;
+    for (size_t i = 0; i < 1000; ++i) {
+        uint256 h = GetRandHash();
+        scripts.push_back(GetScriptForDestination(PKHash(uint160(h.begin(), 20))));
+    }
+
+    BOOST_CHECK(!set.MayContain(scripts[0]));
+    for (size_t i = 0; i < 500; ++i) {
+        set.Insert(scripts[i]);
+    }
+    set.Insert(scripts[0]);
+    BOOST_CHECK_EQUAL(set.Size(), 500U);
+
+    // Every inserted script is found after the table grew, the rest almost never are
+    size_t false_positives = 0;
+    for (size_t i = 0; i < scripts.size(); ++i) {
+        if (i < 500) {
+            BOOST_CHECK(set.MayContain(scripts[i]));
+        } else if (set.MayContain(scripts[i])) {
+            false_positives++;
+        }
+    }
+    BOOST_CHECK(false_positives < 2);
+
+    set.Clear();
+    BOOST_CHECK(!set.MayContain(scripts[0]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -166,6 +166,24 @@ BOOST_AUTO_TEST_CASE(rct_test)
     BOOST_REQUIRE(Consensus::CheckTxInputs(fail_tx, state, view, nSpendHeight, txfee));
     BOOST_REQUIRE(!VerifyMLSAG(fail_tx, state));
     BOOST_REQUIRE(state.GetRejectReason() == "bad-anonin-dup-i");
+
+    // Unknown ring members close to the tip are missing inputs, far past it they're invalid
+    const int64_t last_index = ::ChainActive().Tip()->nAnonOutputs;
+    for (int64_t unknown_index : {last_index + 1, last_index + MAX_RING_MEMBER_LOOKAHEAD + 1}) {
+        vMI.clear();
+        for (size_t i = 0; i < indices.size(); ++i) {
+            BOOST_REQUIRE(0 == part::PutVarInt(vMI, i == 1 ? unknown_index : indices[i]));
+        }
+        CTransaction unknown_tx(mtx);
+        TxValidationState unknown_state;
+        unknown_state.m_exploit_fix_1 = true;
+        unknown_state.m_exploit_fix_2 = true;
+        unknown_state.m_spend_height = nSpendHeight;
+        BOOST_REQUIRE(!VerifyMLSAG(unknown_tx, unknown_state));
+        BOOST_CHECK(unknown_state.GetRejectReason() == "bad-anonin-unknown-i");
+        BOOST_CHECK(unknown_state.GetResult() == (unknown_index == last_index + 1 ?
+            TxValidationResult::TX_MISSING_INPUTS : TxValidationResult::TX_CONSENSUS));
+    }
     }
     }
 
@@ -92,6 +92,16 @@ static void DisconnectTip(CTxMemPool& mempool, CBlock &block, CBlockIndex *pinde
     UpdateTip(mempool, pindexDelete->pprev, chainparams);
 }
 
+static bool HaveStakeCandidate(CHDWallet *pwallet, const COutPoint &prevout)
+{
+    std::vector<COutput> vCoins;
+    pwallet->AvailableCoinsForStaking(vCoins, GetTime(), WITH_LOCK(cs_main, return ::ChainActive().Height()));
+    LOCK(pwallet->cs_wallet);
+    const auto it = pwallet->m_stake_candidates.find(prevout.hash);
+    return it != pwallet->m_stake_candidates.end()
+        && std::find(it->second.begin(), it->second.end(), prevout.n) != it->second.end();
+}
+
 BOOST_AUTO_TEST_CASE(stake_test)
 {
     gArgs.ForceSetArg("-acceptanontxn", "1"); // TODO: remove
@@ -172,6 +182,8 @@ BOOST_AUTO_TEST_CASE(stake_test)
     LOCK(pwallet->cs_wallet);
     BOOST_REQUIRE(pwallet->IsSpent(txin.prevout.hash, txin.prevout.n));
     }
+    // The kernel is dropped from the cached staking candidates once spent
+    BOOST_CHECK(!HaveStakeCandidate(pwallet, txin.prevout));
 
     {
     LOCK(cs_main);
@@ -188,6 +200,8 @@ BOOST_AUTO_TEST_CASE(stake_test)
     LOCK(pwallet->cs_wallet);
     BOOST_REQUIRE(!pwallet->IsSpent(txin.prevout.hash, txin.prevout.n));
     }
+    // and comes back when the spend is undone
+    BOOST_CHECK(HaveStakeCandidate(pwallet, txin.prevout));
 
     {
     LOCK(cs_main);
@@ -221,6 +235,7 @@ BOOST_AUTO_TEST_CASE(stake_test)
     LOCK(pwallet->cs_wallet);
     BOOST_REQUIRE(pwallet->IsSpent(txin.prevout.hash, txin.prevout.n));
     }
+    BOOST_CHECK(!HaveStakeCandidate(pwallet, txin.prevout));
 
     CKey kRecv;
     InsecureNewKey(kRecv, true);
@@ -29,6 +29,7 @@
 #include <util/moneystr.h>
 #include <util/rbf.h>
 #include <util/string.h>
+#include <util/taskpool.h>
 #include <util/translation.h>
 #include <wallet/coincontrol.h>
 #include <wallet/fees.h>
@@ -37,6 +38,7 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <thread>
 
 #include <boost/algorithm/string/replace.hpp>
 
@@ -226,7 +228,7 @@ std::shared_ptr<CWallet> LoadWalletInternal(interfaces::Chain& chain, const std:
         UpdateWalletSetting(chain, name, load_on_start, warnings);
 
         if (fParticlMode) {
-            RestartStakingThreads();
+            AddStakingWallet(wallet);
         }
 
         return wallet;
@@ -336,7 +338,7 @@ std::shared_ptr<CWallet> CreateWallet(interfaces::Chain& chain, const std::strin
     UpdateWalletSetting(chain, name, load_on_start, warnings);
 
     if (fParticlMode) {
-        RestartStakingThreads();
+        AddStakingWallet(wallet);
     }
 
     status = DatabaseStatus::SUCCESS;
@@ -954,7 +956,7 @@ CWalletTx* CWallet::AddToWallet(CTransactionRef tx, const CWalletTx::Confirmatio
 #endif
 
     std::string sName = GetName();
-    GetMainSignals().TransactionAddedToWallet(sName, wtx.tx);
+    GetMainSignals().TransactionAddedToWallet(sName, wtx.tx, std::string());
     ClearCachedBalances();
 
     return &wtx;
@@ -1911,6 +1913,39 @@ CWallet::ScanResult CWallet::ScanForWalletTransactions(const uint256& start_bloc
     double progress_end = chain().guessVerificationProgress(end_hash);
     double progress_current = progress_begin;
     int block_height = start_height;
+
+    // The next block is read from disk on the task pool while the current one is
+    // scanned, transactions are still applied in block order on this thread.
+    // Shared with the read task, which can start after the scan has moved on.
+    struct ReadAhead {
+        uint256 hash;
+        CBlock block;
+        bool found{false};
+        Mutex mutex;
+        std::condition_variable cv;
+        bool started GUARDED_BY(mutex){false};
+        bool done GUARDED_BY(mutex){false};
+
+        //! Take the read over if no worker has started it, else wait for the worker to finish it
+        bool TakeOver()
+        {
+            WAIT_LOCK(mutex, lock);
+            if (!started) {
+                started = true;
+                return true;
+            }
+            while (!done) {
+                cv.wait(lock);
+            }
+            return false;
+        }
+    };
+    std::shared_ptr<ReadAhead> read_ahead;
+    struct ReadAheadJoiner {
+        std::shared_ptr<ReadAhead> &r;
+        ~ReadAheadJoiner() { if (r) r->TakeOver(); }
+    } read_ahead_joiner{read_ahead};
+
     while (!fAbortRescan && !chain().shutdownRequested()) {
         if (progress_end - progress_begin > 0.0) {
             m_scanning_progress = (progress_current - progress_begin) / (progress_end - progress_begin);
@@ -1929,9 +1964,39 @@ CWallet::ScanResult CWallet::ScanForWalletTransactions(const uint256& start_bloc
         bool next_block;
         uint256 next_block_hash;
         bool reorg = false;
-        if (chain().findBlock(block_hash, FoundBlock().data(block)) && !block.IsNull()) {
+        bool have_block;
+        if (read_ahead && !read_ahead->TakeOver()) {
+            block = std::move(read_ahead->block);
+            have_block = read_ahead->found;
+        } else {
+            have_block = chain().findBlock(block_hash, FoundBlock().data(block)) && !block.IsNull();
+        }
+        read_ahead.reset();
+        if (have_block) {
             LOCK(cs_wallet);
             next_block = chain().findNextBlock(block_hash, block_height, FoundBlock().hash(next_block_hash), &reorg);
+            if (next_block && !reorg && !(max_height && block_height >= *max_height)) {
+                std::shared_ptr<ReadAhead> r = std::make_shared<ReadAhead>();
+                r->hash = next_block_hash;
+                interfaces::Chain *pchain = &chain();
+                if (g_task_pool.Submit(TaskPriority::NORMAL, [r, pchain] {
+                        {
+                            LOCK(r->mutex);
+                            if (r->started) {
+                                return;
+                            }
+                            r->started = true;
+                        }
+                        r->found = pchain->findBlock(r->hash, FoundBlock().data(r->block)) && !r->block.IsNull();
+                        {
+                            LOCK(r->mutex);
+                            r->done = true;
+                        }
+                        r->cv.notify_all();
+                    })) {
+                    read_ahead = r;
+                }
+            }
             if (reorg) {
                 // Abort scan if current block is no longer active, to prevent
                 // marking transactions as coming from the wrong block.
@@ -1941,6 +2006,7 @@ CWallet::ScanResult CWallet::ScanForWalletTransactions(const uint256& start_bloc
                 result.status = ScanResult::FAILURE;
                 break;
             }
+            PrepareScanBlock(block);
             for (size_t posInBlock = 0; posInBlock < block.vtx.size(); ++posInBlock) {
                 SyncTransaction(block.vtx[posInBlock], {CWalletTx::Status::CONFIRMED, block_height, block_hash, (int)posInBlock}, fUpdate);
             }
@@ -4239,7 +4305,7 @@ std::shared_ptr<CWallet> CWallet::Create(interfaces::Chain& chain, const std::st
     // but we guarantee at least than wallet state is correct after notifications delivery.
     // This is temporary until rescan and notifications delivery are unified under same
     // interface.
-    walletInstance->m_chain_notifications_handler = walletInstance->chain().handleNotifications(walletInstance);
+    walletInstance->m_chain_notifications_handler = walletInstance->chain().handleNotifications(walletInstance, "wallet " + walletInstance->GetName());
 
     int rescan_height = 0;
     if (!gArgs.GetBoolArg("-rescan", false))
@@ -747,6 +747,8 @@ private:
      * posInBlock signals or by checking mempool presence when necessary.
      */
     virtual bool AddToWalletIfInvolvingMe(const CTransactionRef& tx, CWalletTx::Confirmation confirm, bool fUpdate) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet);
+    /** Called for each block of a rescan before its transactions are synced. */
+    virtual void PrepareScanBlock(const CBlock& block) EXCLUSIVE_LOCKS_REQUIRED(cs_wallet) {};
 
     /* Mark a transaction (and its in-wallet descendants) as conflicting with a particular block. */
     virtual void MarkConflicted(const uint256& hashBlock, int conflicting_height, const uint256& hashTx);
@@ -843,6 +845,7 @@ public:
           m_name(name),
           database(std::move(database))
     {
+        RegisterLockProfile(&cs_wallet, "cs_wallet");
         if (!fParticlMode) {
             m_min_fee = CFeeRate(DEFAULT_TRANSACTION_MINFEE_BTC);
             m_default_max_tx_fee = DEFAULT_TRANSACTION_MAXFEE_BTC;
@@ -974,7 +977,7 @@ public:
 
     //! For ParticlWallet, clear cached balances from wallet called at new block and adding new transaction
     virtual void ClearCachedBalances() {};
-    void MarkDirty();
+    virtual void MarkDirty();
 
     //! Callback for updating transaction metadata in mapWallet.
     //!
@@ -0,0 +1,268 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include <wallet/walletsnapshot.h>
+
+#include <clientversion.h>
+#include <hash.h>
+#include <logging.h>
+#include <random.h>
+#include <serialize.h>
+#include <span.h>
+#include <streams.h>
+#include <util/time.h>
+#include <util/translation.h>
+#include <wallet/db.h>
+#include <wallet/wallet.h>
+#include <wallet/walletutil.h>
+
+#include <cstring>
+
+static const char WALLET_SNAPSHOT_MAGIC[8] = {'g', 'h', 's', 't', 'w', 's', 'n', 'p'};
+
+static uint256 ChunkChecksum(const CDataStream &payload)
+{
+    uint256 checksum;
+    CHash256().Write({(const unsigned char*)payload.data(), payload.size()}).Finalize(checksum);
+    return checksum;
+}
+
+bool WriteWalletSnapshot(WalletDatabase& database, const fs::path& path, WalletSnapshotStats& stats, bilingual_str& error)
+{
+    const int64_t time_start = GetTimeMillis();
+    // Written beside the destination and moved into place when complete
+    const fs::path path_tmp = path.string() + ".tmp";
+    CAutoFile file(fsbridge::fopen(path_tmp, "wb"), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull()) {
+        error = strprintf(_("Cannot open %s for writing"), path_tmp.string());
+        return false;
+    }
+
+    stats = WalletSnapshotStats();
+    stats.format = database.Format();
+    std::unique_ptr<DatabaseBatch> batch = database.MakeBatch(false);
+    if (!batch->StartCursor()) {
+        error = _("Cannot read the wallet database");
+        return false;
+    }
+
+    CHashWriter chunks_hash(SER_GETHASH, 0);
+    CDataStream payload(SER_DISK, CLIENT_VERSION);
+    uint32_t chunk_records = 0;
+    auto write_chunk = [&]() {
+        const uint256 checksum = ChunkChecksum(payload);
+        file << chunk_records << (uint32_t)payload.size();
+        file.write(payload.data(), payload.size());
+        file << checksum;
+        chunks_hash << checksum;
+        stats.chunks++;
+        payload.clear();
+        chunk_records = 0;
+    };
+
+    try {
+        file.write(WALLET_SNAPSHOT_MAGIC, sizeof(WALLET_SNAPSHOT_MAGIC));
+        file << WALLET_SNAPSHOT_VERSION << stats.format << GetTime();
+
+        while (true) {
+            CDataStream key(SER_DISK, CLIENT_VERSION);
+            CDataStream value(SER_DISK, CLIENT_VERSION);
+            bool complete;
+            if (!batch->ReadAtCursor(key, value, complete)) {
+                batch->CloseCursor();
+                error = _("Error reading the wallet database");
+                return false;
+            }
+            if (complete) {
+                break;
+            }
+            WriteCompactSize(payload, key.size());
+            payload.write(key.data(), key.size());
+            WriteCompactSize(payload, value.size());
+            payload.write(value.data(), value.size());
+            stats.records++;
+            stats.bytes += key.size() + value.size();
+            if (++chunk_records >= WALLET_SNAPSHOT_CHUNK_RECORDS || payload.size() >= WALLET_SNAPSHOT_CHUNK_BYTES) {
+                write_chunk();
+            }
+        }
+        batch->CloseCursor();
+        if (chunk_records > 0) {
+            write_chunk();
+        }
+
+        // An empty chunk ends the records
+        file << (uint32_t)0 << (uint32_t)0 << stats.records << chunks_hash.GetHash();
+    } catch (const std::exception &e) {
+        batch->CloseCursor();
+        error = strprintf(_("Error writing %s: %s"), path_tmp.string(), e.what());
+        return false;
+    }
+
+    if (!FileCommit(file.Get())) {
+        error = strprintf(_("Error writing %s"), path_tmp.string());
+        return false;
+    }
+    file.fclose();
+    if (!RenameOver(path_tmp, path)) {
+        error = strprintf(_("Cannot move %s to %s"), path_tmp.string(), path.string());
+        return false;
+    }
+
+    LogPrintf("Wrote wallet snapshot %s, %u records in %u chunks (%u bytes) in %dms\n",
+        path.string(), stats.records, stats.chunks, stats.bytes, GetTimeMillis() - time_start);
+    return true;
+}
+
+bool DumpWalletSnapshot(const CWallet& wallet, const fs::path& path, WalletSnapshotStats& stats, bilingual_str& error)
+{
+    const fs::path backup_dir = GetWalletDir() / strprintf(".snapshot-%s", GetRandHash().GetHex().substr(0, 16));
+    bool rv = false;
+    try {
+        fs::create_directories(backup_dir);
+        if (!wallet.GetDatabase().Backup((backup_dir / "wallet.dat").string())) {
+            error = _("Wallet backup failed");
+        } else {
+            DatabaseOptions options;
+            options.require_existing = true;
+            DatabaseStatus status;
+            std::unique_ptr<WalletDatabase> database = MakeDatabase(backup_dir, options, status, error);
+            if (database) {
+                rv = WriteWalletSnapshot(*database, path, stats, error);
+            }
+        }
+        fs::remove_all(backup_dir);
+    } catch (const fs::filesystem_error &e) {
+        boost::system::error_code ec;
+        fs::remove_all(backup_dir, ec);
+        error = strprintf(_("Wallet snapshot failed: %s"), fsbridge::get_filesystem_error_message(e));
+        return false;
+    }
+    return rv;
+}
+
+static bool ReadSnapshotHeader(CAutoFile &file, std::string &format, bilingual_str &error)
+{
+    char magic[sizeof(WALLET_SNAPSHOT_MAGIC)];
+    uint32_t version;
+    int64_t time;
+    file.read(magic, sizeof(magic));
+    if (memcmp(magic, WALLET_SNAPSHOT_MAGIC, sizeof(magic)) != 0) {
+        error = _("Not a wallet snapshot");
+        return false;
+    }
+    file >> version;
+    if (version > WALLET_SNAPSHOT_VERSION) {
+        error = strprintf(_("Wallet snapshot version %u is not supported"), version);
+        return false;
+    }
+    file >> LIMITED_STRING(format, 16) >> time;
+    return true;
+}
+
+bool ReadWalletSnapshotFormat(const fs::path& path, std::string& format, bilingual_str& error)
+{
+    CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull()) {
+        error = strprintf(_("Cannot open %s"), path.string());
+        return false;
+    }
+    try {
+        return ReadSnapshotHeader(file, format, error);
+    } catch (const std::exception &e) {
+        error = strprintf(_("Error reading %s: %s"), path.string(), e.what());
+    }
+    return false;
+}
+
+bool ReadWalletSnapshot(const fs::path& path, WalletDatabase& database, WalletSnapshotStats& stats, bilingual_str& error)
+{
+    const int64_t time_start = GetTimeMillis();
+    CAutoFile file(fsbridge::fopen(path, "rb"), SER_DISK, CLIENT_VERSION);
+    if (file.IsNull()) {
+        error = strprintf(_("Cannot open %s"), path.string());
+        return false;
+    }
+
+    stats = WalletSnapshotStats();
+    std::unique_ptr<DatabaseBatch> batch = database.MakeBatch();
+    try {
+        if (!ReadSnapshotHeader(file, stats.format, error)) {
+            return false;
+        }
+
+        CHashWriter chunks_hash(SER_GETHASH, 0);
+        CDataStream payload(SER_DISK, CLIENT_VERSION);
+        while (true) {
+            uint32_t chunk_records, payload_size;
+            file >> chunk_records >> payload_size;
+            if (chunk_records == 0 && payload_size == 0) {
+                break;
+            }
+            if (payload_size > MAX_WALLET_SNAPSHOT_CHUNK_BYTES) {
+                error = strprintf(_("Wallet snapshot chunk %u is too large"), stats.chunks);
+                return false;
+            }
+            payload.clear();
+            payload.resize(payload_size);
+            file.read(payload.data(), payload_size);
+            uint256 checksum;
+            file >> checksum;
+            if (checksum != ChunkChecksum(payload)) {
+                error = strprintf(_("Wallet snapshot chunk %u is corrupt"), stats.chunks);
+                return false;
+            }
+            chunks_hash << checksum;
+
+            if (!batch->TxnBegin()) {
+                error = _("Cannot write to the wallet database");
+                return false;
+            }
+            uint32_t n = 0;
+            for (; !payload.empty(); ++n) {
+                const uint64_t key_size = ReadCompactSize(payload);
+                const Span<const unsigned char> key((const unsigned char*)payload.data(), std::min<uint64_t>(key_size, payload.size()));
+                payload.ignore(key_size);
+                const uint64_t value_size = ReadCompactSize(payload);
+                const Span<const unsigned char> value((const unsigned char*)payload.data(), std::min<uint64_t>(value_size, payload.size()));
+                payload.ignore(value_size);
+                if (!batch->Write(key, value)) {
+                    batch->TxnAbort();
+                    error = _("Error writing to the wallet database");
+                    return false;
+                }
+                stats.bytes += key_size + value_size;
+            }
+            if (n != chunk_records) {
+                batch->TxnAbort();
+                error = strprintf(_("Wallet snapshot chunk %u has %u records, expected %u"), stats.chunks, n, chunk_records);
+                return false;
+            }
+            if (!batch->TxnCommit()) {
+                error = _("Error writing to the wallet database");
+                return false;
+            }
+            stats.records += n;
+            stats.chunks++;
+        }
+
+        uint64_t total_records;
+        uint256 chunks_checksum;
+        file >> total_records >> chunks_checksum;
+        if (total_records != stats.records || chunks_checksum != chunks_hash.GetHash()) {
+            error = _("Wallet snapshot is incomplete");
+            return false;
+        }
+    } catch (const std::exception &e) {
+        // A record running past the end of its chunk throws here too, the checksum matched so the writer was at fault
+        batch->TxnAbort();
+        error = strprintf(_("Error reading %s: %s"), path.string(), e.what());
+        return false;
+    }
+    batch->Flush();
+
+    LogPrintf("Read wallet snapshot %s, %u records in %u chunks (%u bytes) in %dms\n",
+        path.string(), stats.records, stats.chunks, stats.bytes, GetTimeMillis() - time_start);
+    return true;
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2021 The Ghost Core developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_WALLET_WALLETSNAPSHOT_H
+#define BITCOIN_WALLET_WALLETSNAPSHOT_H
+
+#include <fs.h>
+
+#include <cstdint>
+#include <string>
+
+class CWallet;
+class WalletDatabase;
+struct bilingual_str;
+
+//! Version of the snapshot format written
+static const uint32_t WALLET_SNAPSHOT_VERSION = 1;
+//! A chunk is closed when it holds this many records or bytes
+static const uint32_t WALLET_SNAPSHOT_CHUNK_RECORDS = 4096;
+static const uint32_t WALLET_SNAPSHOT_CHUNK_BYTES = 4 * 1024 * 1024;
+//! Larger chunks are taken as corruption, a single record may exceed WALLET_SNAPSHOT_CHUNK_BYTES
+static const uint32_t MAX_WALLET_SNAPSHOT_CHUNK_BYTES = 256 * 1024 * 1024;
+
+struct WalletSnapshotStats {
+    std::string format;     // Database format of the source wallet
+    uint64_t records{0};
+    uint64_t chunks{0};
+    uint64_t bytes{0};      // Size of the records, without framing
+};
+
+/**
+ * Binary wallet snapshots, to move a wallet between hosts quicker than
+ * through DumpJson.
+ *
+ * A snapshot holds every record of the wallet database as is, so ext
+ * accounts, key packs, stealth addresses, transaction records and stored txs
+ * all come across, along with the best block, and the imported wallet needs
+ * no rescan. Private keys stay encrypted if the wallet is.
+ *
+ * The file is a header followed by chunks of records, each with a checksum
+ * that is verified before any of its records are written, then a trailer with
+ * the record count and a hash over the chunk checksums. A chunk is written to
+ * the new database in one transaction.
+ */
+
+/** Write a snapshot of every record in database to path, database must not be in use by a wallet */
+bool WriteWalletSnapshot(WalletDatabase& database, const fs::path& path, WalletSnapshotStats& stats, bilingual_str& error);
+
+/**
+ * Write a snapshot of the wallet to path while it keeps running. The records
+ * are read from a backup of the database taken first, which only holds the
+ * database for the time of a file copy.
+ */
+bool DumpWalletSnapshot(const CWallet& wallet, const fs::path& path, WalletSnapshotStats& stats, bilingual_str& error);
+
+/** Read the format of the wallet a snapshot was taken from, to create the database to import it into */
+bool ReadWalletSnapshotFormat(const fs::path& path, std::string& format, bilingual_str& error);
+
+/** Verify the snapshot at path and write its records to database, which should be new and empty */
+bool ReadWalletSnapshot(const fs::path& path, WalletDatabase& database, WalletSnapshotStats& stats, bilingual_str& error);
+
+#endif // BITCOIN_WALLET_WALLETSNAPSHOT_H
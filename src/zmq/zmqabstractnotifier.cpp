@@ -7,6 +7,7 @@
 #include <cassert>
 
 const int CZMQAbstractNotifier::DEFAULT_ZMQ_SNDHWM;
+const int CZMQAbstractNotifier::DEFAULT_ZMQ_QUEUE_SIZE;
 
 CZMQAbstractNotifier::~CZMQAbstractNotifier()
 {
@@ -43,12 +44,17 @@ bool CZMQAbstractNotifier::NotifyTransactionRemoval(const CTransaction &/*transa
     return true;
 }
 
-bool CZMQAbstractNotifier::NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &/*hash*/)
+bool CZMQAbstractNotifier::NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &/*hash*/, const CKeyID &/*address_to*/)
 {
     return true;
 }
 
-bool CZMQAbstractNotifier::NotifyTransaction(const std::string &sWalletName, const CTransaction &/*transaction*/)
+bool CZMQAbstractNotifier::NotifyTransaction(const std::string &sWalletName, const CTransaction &/*transaction*/, const std::string &/*record*/)
+{
+    return true;
+}
+
+bool CZMQAbstractNotifier::NotifyStealthMatch(const uint256 &/*key_id*/, const StealthScanMatch &/*match*/)
 {
     return true;
 }
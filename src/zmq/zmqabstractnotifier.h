@@ -7,23 +7,32 @@
 
 #include <util/memory.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 
 class CBlockIndex;
+class CKeyID;
 class CTransaction;
 namespace smsg {
 class SecureMessage;
 }
 class uint160;
+class uint256;
+struct StealthScanMatch;
 class CZMQAbstractNotifier;
+class CZMQSendQueue;
 
 using CZMQNotifierFactory = std::unique_ptr<CZMQAbstractNotifier> (*)();
 
 class CZMQAbstractNotifier
 {
+    friend class CZMQSendQueue;
+
 public:
     static const int DEFAULT_ZMQ_SNDHWM {1000};
+    //! Messages the send queue holds, 0 sends on the notifying thread
+    static const int DEFAULT_ZMQ_QUEUE_SIZE {10000};
 
     CZMQAbstractNotifier() : psocket(nullptr), outbound_message_high_water_mark(DEFAULT_ZMQ_SNDHWM) { }
     virtual ~CZMQAbstractNotifier();
@@ -45,6 +54,13 @@ public:
         }
     }
 
+    //! Send from the queue's thread instead of the notifying thread
+    void SetSendQueue(CZMQSendQueue *queue) { m_send_queue = queue; }
+    //! Messages waiting in the send queue, sent and dropped because the queue was full
+    size_t GetQueued() const { return m_queued; }
+    uint64_t GetSent() const { return m_sent; }
+    uint64_t GetDropped() const { return m_dropped; }
+
     virtual bool Initialize(void *pcontext) = 0;
     virtual void Shutdown() = 0;
 
@@ -61,14 +77,24 @@ public:
     // Notifies of transactions added to mempool or appearing in blocks
     virtual bool NotifyTransaction(const CTransaction &transaction);
 
-    virtual bool NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction);
-    virtual bool NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash);
+    // Notifies of transactions added to a wallet, record is the serialized wallet record or empty
+    virtual bool NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction, const std::string &record);
+    // Notifies of secure messages received, psmsg carries the payload when it's known
+    virtual bool NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to);
+    // Notifies of outputs found for a key registered with the stealth scan server
+    virtual bool NotifyStealthMatch(const uint256 &key_id, const StealthScanMatch &match);
 
 protected:
     void *psocket;
     std::string type;
     std::string address;
     int outbound_message_high_water_mark; // aka SNDHWM
+    CZMQSendQueue *m_send_queue{nullptr};
+    std::atomic<size_t> m_queued{0};
+    std::atomic<uint64_t> m_sent{0};
+    std::atomic<uint64_t> m_dropped{0};
+    //! Set by the send queue's thread when a send fails, the notifier is removed at its next notification
+    std::atomic<bool> m_send_failed{false};
 };
 
 #endif // BITCOIN_ZMQ_ZMQABSTRACTNOTIFIER_H
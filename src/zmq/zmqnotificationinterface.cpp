@@ -110,6 +110,9 @@ CZMQNotificationInterface* CZMQNotificationInterface::Create()
 
     factories["pubhashwtx"] = CZMQAbstractNotifier::Create<CZMQPublishHashWalletTransactionNotifier>;
     factories["pubsmsg"] = CZMQAbstractNotifier::Create<CZMQPublishSMSGNotifier>;
+    factories["pubrawwtx"] = CZMQAbstractNotifier::Create<CZMQPublishRawWalletTransactionNotifier>;
+    factories["pubrawsmsg"] = CZMQAbstractNotifier::Create<CZMQPublishRawSMSGNotifier>;
+    factories["pubstealthmatch"] = CZMQAbstractNotifier::Create<CZMQPublishStealthMatchNotifier>;
 
     std::list<std::unique_ptr<CZMQAbstractNotifier>> notifiers;
     for (const auto& entry : factories)
@@ -130,6 +133,19 @@ CZMQNotificationInterface* CZMQNotificationInterface::Create()
         std::unique_ptr<CZMQNotificationInterface> notificationInterface(new CZMQNotificationInterface());
         notificationInterface->notifiers = std::move(notifiers);
 
+        const int64_t queue_size = gArgs.GetArg("-zmqqueuesize", CZMQAbstractNotifier::DEFAULT_ZMQ_QUEUE_SIZE);
+        const std::string policy = gArgs.GetArg("-zmqqueuepolicy", DEFAULT_ZMQ_QUEUE_POLICY);
+        if (policy != "block" && policy != "drop") {
+            zmqError("Unknown -zmqqueuepolicy, expected block or drop");
+            return nullptr;
+        }
+        if (queue_size > 0) {
+            notificationInterface->m_send_queue = MakeUnique<CZMQSendQueue>(queue_size, policy == "drop");
+            for (auto& notifier : notificationInterface->notifiers) {
+                notifier->SetSendQueue(notificationInterface->m_send_queue.get());
+            }
+        }
+
         if (notificationInterface->Initialize()) {
             return notificationInterface.release();
         }
@@ -189,6 +205,11 @@ bool CZMQNotificationInterface::Initialize()
         }
     }
 
+    if (m_send_queue) {
+        LogPrint(BCLog::ZMQ, "zmq: Sending from a queue of %d messages, %s when full\n", m_send_queue->GetMaxSize(), m_send_queue->DropsWhenFull() ? "dropping" : "blocking");
+        m_send_queue->Start();
+    }
+
     return true;
 }
 
@@ -203,6 +224,10 @@ void CZMQNotificationInterface::Shutdown()
         threadZAP.join();
     };
 
+    if (m_send_queue) {
+        m_send_queue->Stop();
+    }
+
     if (pcontext)
     {
         for (auto& notifier : notifiers) {
@@ -292,19 +317,26 @@ void CZMQNotificationInterface::BlockDisconnected(const std::shared_ptr<const CB
     });
 }
 
-void CZMQNotificationInterface::TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& ptx)
+void CZMQNotificationInterface::TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& ptx, const std::string &record)
 {
     const CTransaction& tx = *ptx;
 
-    TryForEachAndRemoveFailed(notifiers, [sWalletName, &tx](CZMQAbstractNotifier* notifier) {
-        return notifier->NotifyTransaction(sWalletName, tx);
+    TryForEachAndRemoveFailed(notifiers, [&sWalletName, &tx, &record](CZMQAbstractNotifier* notifier) {
+        return notifier->NotifyTransaction(sWalletName, tx, record);
+    });
+}
+
+void CZMQNotificationInterface::NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to)
+{
+    TryForEachAndRemoveFailed(notifiers, [psmsg, &hash, &address_to](CZMQAbstractNotifier* notifier) {
+        return notifier->NotifySecureMessage(psmsg, hash, address_to);
     });
 }
 
-void CZMQNotificationInterface::NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash)
+void CZMQNotificationInterface::StealthOutputFound(const uint256 &key_id, const StealthScanMatch &match)
 {
-    TryForEachAndRemoveFailed(notifiers, [psmsg, &hash](CZMQAbstractNotifier* notifier) {
-        return notifier->NotifySecureMessage(psmsg, hash);
+    TryForEachAndRemoveFailed(notifiers, [&key_id, &match](CZMQAbstractNotifier* notifier) {
+        return notifier->NotifyStealthMatch(key_id, match);
     });
 }
 
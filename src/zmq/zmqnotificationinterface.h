@@ -17,6 +17,12 @@ namespace smsg {
 class SecureMessage;
 }
 class CZMQAbstractNotifier;
+class CZMQSendQueue;
+
+//! What the send queue does with a message when it's full, block or drop
+static const char* const DEFAULT_ZMQ_QUEUE_POLICY = "block";
+//! Whether rawsmsg notifications carry the plaintext of messages to owned addresses
+static const bool DEFAULT_ZMQ_RAWSMSG_DECRYPT = false;
 
 class CZMQNotificationInterface final : public CValidationInterface
 {
@@ -24,6 +30,8 @@ public:
     virtual ~CZMQNotificationInterface();
 
     std::list<const CZMQAbstractNotifier*> GetActiveNotifiers() const;
+    //! The queue the notifiers send from, null when they send on the notifying thread
+    const CZMQSendQueue* GetSendQueue() const { return m_send_queue.get(); }
 
     static CZMQNotificationInterface* Create();
 
@@ -38,14 +46,16 @@ protected:
     void BlockDisconnected(const std::shared_ptr<const CBlock>& pblock, const CBlockIndex* pindexDisconnected) override;
     void UpdatedBlockTip(const CBlockIndex *pindexNew, const CBlockIndex *pindexFork, bool fInitialDownload) override;
 
-    void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx) override;
-    void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash) override;
+    void TransactionAddedToWallet(const std::string &sWalletName, const CTransactionRef& tx, const std::string &record) override;
+    void NewSecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to) override;
+    void StealthOutputFound(const uint256 &key_id, const StealthScanMatch &match) override;
 
 private:
     CZMQNotificationInterface();
 
     void *pcontext;
     std::list<std::unique_ptr<CZMQAbstractNotifier>> notifiers;
+    std::unique_ptr<CZMQSendQueue> m_send_queue;
 
     bool IsWhitelistedRange(const CNetAddr &addr);
     void ThreadZAP();
@@ -6,17 +6,21 @@
 
 #include <chain.h>
 #include <chainparams.h>
+#include <key_io.h>
+#include <node/blockcache.h>
+#include <node/stealthscan.h>
 #include <rpc/server.h>
 #include <streams.h>
 #include <util/system.h>
 #include <util/strencodings.h>
+#include <util/threadnames.h>
 #include <smsg/smessage.h>
 #include <validation.h>
+#include <zmq/zmqnotificationinterface.h>
 #include <zmq/zmqutil.h>
 
 #include <zmq.h>
 
-#include <cstdarg>
 #include <cstddef>
 #include <map>
 #include <string>
@@ -31,51 +35,137 @@ static const char *MSG_RAWTX     = "rawtx";
 static const char *MSG_SEQUENCE  = "sequence";
 static const char *MSG_HASHWTX   = "hashwtx";
 static const char *MSG_SMSG      = "smsg";
+static const char *MSG_RAWWTX    = "rawwtx";
+static const char *MSG_RAWSMSG   = "rawsmsg";
+static const char *MSG_STEALTHMATCH = "stealthmatch";
 
-// Internal function to send multipart message
-static int zmq_send_multipart(void *sock, const void* data, size_t size, ...)
+// Internal function to send a small message part, copied into the zmq message
+static int zmq_send_part(void *sock, const void* data, size_t size, int flags)
 {
-    va_list args;
-    va_start(args, size);
+    zmq_msg_t msg;
 
-    while (1)
+    int rc = zmq_msg_init_size(&msg, size);
+    if (rc != 0)
     {
-        zmq_msg_t msg;
+        zmqError("Unable to initialize ZMQ msg");
+        return -1;
+    }
 
-        int rc = zmq_msg_init_size(&msg, size);
-        if (rc != 0)
-        {
-            zmqError("Unable to initialize ZMQ msg");
-            va_end(args);
-            return -1;
-        }
+    void *buf = zmq_msg_data(&msg);
+    memcpy(buf, data, size);
 
-        void *buf = zmq_msg_data(&msg);
-        memcpy(buf, data, size);
+    rc = zmq_msg_send(&msg, sock, flags);
+    if (rc == -1)
+    {
+        zmqError("Unable to send ZMQ msg");
+        zmq_msg_close(&msg);
+        return -1;
+    }
 
-        data = va_arg(args, const void*);
+    zmq_msg_close(&msg);
+    return 0;
+}
 
-        rc = zmq_msg_send(&msg, sock, data ? ZMQ_SNDMORE : 0);
-        if (rc == -1)
-        {
-            zmqError("Unable to send ZMQ msg");
-            zmq_msg_close(&msg);
-            va_end(args);
-            return -1;
-        }
+static void zmq_free_string(void * /*data*/, void *hint)
+{
+    delete static_cast<std::string*>(hint);
+}
 
-        zmq_msg_close(&msg);
+// Internal function to send a message part without copying it, zmq frees the
+// buffer once every subscriber's pipe is done with it
+static int zmq_send_owned_part(void *sock, std::string &&data, int flags)
+{
+    std::string *owned = new std::string(std::move(data));
+    zmq_msg_t msg;
 
-        if (!data)
-            break;
+    int rc = zmq_msg_init_data(&msg, &(*owned)[0], owned->size(), zmq_free_string, owned);
+    if (rc != 0)
+    {
+        delete owned;
+        zmqError("Unable to initialize ZMQ msg");
+        return -1;
+    }
 
-        size = va_arg(args, size_t);
+    rc = zmq_msg_send(&msg, sock, flags);
+    if (rc == -1)
+    {
+        zmqError("Unable to send ZMQ msg");
+        zmq_msg_close(&msg);
+        return -1;
     }
 
-    va_end(args);
+    zmq_msg_close(&msg);
     return 0;
 }
 
+void CZMQSendQueue::Start()
+{
+    m_thread = std::thread([this] {
+        util::ThreadRename("zmqsend");
+        ThreadSend();
+    });
+}
+
+void CZMQSendQueue::Stop()
+{
+    {
+        LOCK(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+bool CZMQSendQueue::Push(Message &&msg)
+{
+    WAIT_LOCK(m_mutex, lock);
+    if (m_queue.size() >= m_max_size) {
+        if (m_drop_when_full) {
+            return false;
+        }
+        m_cond.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return m_queue.size() < m_max_size || m_stop; });
+    }
+    m_queue.push_back(std::move(msg));
+    m_cond.notify_all();
+    return true;
+}
+
+void CZMQSendQueue::WaitIdle()
+{
+    WAIT_LOCK(m_mutex, lock);
+    m_cond.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return (m_queue.empty() && !m_sending) || !m_thread.joinable(); });
+}
+
+void CZMQSendQueue::ThreadSend()
+{
+    while (true) {
+        Message msg;
+        {
+            WAIT_LOCK(m_mutex, lock);
+            m_sending = false;
+            m_cond.notify_all();
+            m_cond.wait(lock, [&]() EXCLUSIVE_LOCKS_REQUIRED(m_mutex) { return !m_queue.empty() || m_stop; });
+            if (m_queue.empty()) {
+                // Stopping with everything sent
+                return;
+            }
+            msg = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_sending = true;
+            m_cond.notify_all();
+        }
+        CZMQAbstractPublishNotifier *notifier = msg.notifier;
+        bool ok = !msg.producer || msg.producer(msg.data);
+        ok = ok && notifier->SendNow(msg.command, std::move(msg.data), msg.sequence);
+        notifier->m_queued--;
+        if (!ok) {
+            notifier->m_send_failed = true;
+        }
+    }
+}
+
 bool CZMQAbstractPublishNotifier::Initialize(void *pcontext)
 {
     assert(!psocket);
@@ -163,6 +253,11 @@ void CZMQAbstractPublishNotifier::Shutdown()
     // Early return if Initialize was not called
     if (!psocket) return;
 
+    // Messages still queued use the socket
+    if (m_send_queue) {
+        m_send_queue->WaitIdle();
+    }
+
     int count = mapPublishNotifiers.count(address);
 
     // remove this notifier from the list of publishers using this address
@@ -192,17 +287,68 @@ void CZMQAbstractPublishNotifier::Shutdown()
 bool CZMQAbstractPublishNotifier::SendZmqMessage(const char *command, const void* data, size_t size)
 {
     assert(psocket);
+    if (m_send_failed) {
+        return false;
+    }
+    return SendZmqMessage(command, std::string((const char*)data, size));
+}
+
+bool CZMQAbstractPublishNotifier::SendZmqMessage(const char *command, std::string &&message)
+{
+    assert(psocket);
+    if (m_send_failed) {
+        return false;
+    }
+    if (!m_send_queue) {
+        if (!SendNow(command, std::move(message), nSequence)) {
+            return false;
+        }
+        /* increment memory only sequence number after sending */
+        nSequence++;
+        return true;
+    }
+    m_queued++;
+    if (!m_send_queue->Push({this, command, nSequence++, std::move(message), nullptr})) {
+        m_queued--;
+        m_dropped++;
+    }
+    return true;
+}
 
+bool CZMQAbstractPublishNotifier::SendZmqMessage(const char *command, std::function<bool(std::string&)> producer)
+{
+    assert(psocket);
+    if (m_send_failed) {
+        return false;
+    }
+    if (!m_send_queue) {
+        std::string message;
+        if (!producer(message) || !SendNow(command, std::move(message), nSequence)) {
+            return false;
+        }
+        nSequence++;
+        return true;
+    }
+    m_queued++;
+    if (!m_send_queue->Push({this, command, nSequence++, std::string(), std::move(producer)})) {
+        m_queued--;
+        m_dropped++;
+    }
+    return true;
+}
+
+bool CZMQAbstractPublishNotifier::SendNow(const char *command, std::string &&data, uint32_t sequence)
+{
     /* send three parts, command & data & a LE 4byte sequence number */
     unsigned char msgseq[sizeof(uint32_t)];
-    WriteLE32(&msgseq[0], nSequence);
-    int rc = zmq_send_multipart(psocket, command, strlen(command), data, size, msgseq, (size_t)sizeof(uint32_t), nullptr);
-    if (rc == -1)
+    WriteLE32(&msgseq[0], sequence);
+    if (zmq_send_part(psocket, command, strlen(command), ZMQ_SNDMORE) == -1 ||
+        zmq_send_owned_part(psocket, std::move(data), ZMQ_SNDMORE) == -1 ||
+        zmq_send_part(psocket, msgseq, sizeof(msgseq), 0) == -1) {
         return false;
+    }
 
-    /* increment memory only sequence number after sending */
-    nSequence++;
-
+    m_sent++;
     return true;
 }
 
@@ -230,21 +376,26 @@ bool CZMQPublishRawBlockNotifier::NotifyBlock(const CBlockIndex *pindex)
 {
     LogPrint(BCLog::ZMQ, "zmq: Publish rawblock %s to %s\n", pindex->GetBlockHash().GetHex(), this->address);
 
-    const Consensus::Params& consensusParams = Params().GetConsensus();
-    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
+    // The block is read and serialized on the send thread, from the position it has now
+    FlatFilePos pos;
     {
         LOCK(cs_main);
+        pos = pindex->GetBlockPos();
+    }
+    const uint256 hash = pindex->GetBlockHash();
+    const int serialize_flags = RPCSerializationFlags();
+    return SendZmqMessage(MSG_RAWBLOCK, [pos, hash, serialize_flags](std::string &data) {
+        std::shared_ptr<const CBlock> cached = g_block_cache.Get(hash);
         CBlock block;
-        if(!ReadBlockFromDisk(block, pindex, consensusParams))
-        {
+        if (!cached && (!ReadBlockFromDisk(block, pos, Params().GetConsensus()) || block.GetHash() != hash)) {
             zmqError("Can't read block from disk");
             return false;
         }
-
-        ss << block;
-    }
-
-    return SendZmqMessage(MSG_RAWBLOCK, &(*ss.begin()), ss.size());
+        CDataStream ss(SER_NETWORK, PROTOCOL_VERSION | serialize_flags);
+        ss << (cached ? *cached : block);
+        data = ss.str();
+        return true;
+    });
 }
 
 bool CZMQPublishRawTransactionNotifier::NotifyTransaction(const CTransaction &transaction)
@@ -253,7 +404,7 @@ bool CZMQPublishRawTransactionNotifier::NotifyTransaction(const CTransaction &tr
     LogPrint(BCLog::ZMQ, "zmq: Publish rawtx %s to %s\n", hash.GetHex(), this->address);
     CDataStream ss(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
     ss << transaction;
-    return SendZmqMessage(MSG_RAWTX, &(*ss.begin()), ss.size());
+    return SendZmqMessage(MSG_RAWTX, ss.str());
 }
 
 
@@ -304,7 +455,7 @@ bool CZMQPublishSequenceNotifier::NotifyTransactionRemoval(const CTransaction &t
     return SendZmqMessage(MSG_SEQUENCE, data, sizeof(data));
 }
 
-bool CZMQPublishHashWalletTransactionNotifier::NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction)
+bool CZMQPublishHashWalletTransactionNotifier::NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction, const std::string &/*record*/)
 {
     uint256 hash = transaction.GetHash();
     LogPrint(BCLog::ZMQ, "zmq: Publish hashwtx %s, %s\n", sWalletName, hash.GetHex());
@@ -319,7 +470,7 @@ bool CZMQPublishHashWalletTransactionNotifier::NotifyTransaction(const std::stri
     return SendZmqMessage(MSG_HASHWTX, data, 32 + nName);
 }
 
-bool CZMQPublishSMSGNotifier::NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash)
+bool CZMQPublishSMSGNotifier::NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &/*address_to*/)
 {
     LogPrint(BCLog::ZMQ, "zmq: Publish smsg %s\n", hash.GetHex());
     CDataStream ss(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
@@ -330,3 +481,66 @@ bool CZMQPublishSMSGNotifier::NotifySecureMessage(const smsg::SecureMessage *psm
     ss << hash;
     return SendZmqMessage(MSG_SMSG, &(*ss.begin()), ss.size());
 }
+
+bool CZMQPublishRawWalletTransactionNotifier::NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction, const std::string &record)
+{
+    uint256 hash = transaction.GetHash();
+    LogPrint(BCLog::ZMQ, "zmq: Publish rawwtx %s, %s\n", sWalletName, hash.GetHex());
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION | RPCSerializationFlags());
+    ss << sWalletName;
+    ss << transaction;
+    // The record, with the amounts of owned blinded outputs, takes the rest of the body
+    ss.write(record.data(), record.size());
+    return SendZmqMessage(MSG_RAWWTX, ss.str());
+}
+
+bool CZMQPublishRawSMSGNotifier::Initialize(void *pcontext)
+{
+    m_decrypt = gArgs.GetBoolArg("-zmqrawsmsgdecrypt", DEFAULT_ZMQ_RAWSMSG_DECRYPT);
+    return CZMQAbstractPublishNotifier::Initialize(pcontext);
+}
+
+bool CZMQPublishRawSMSGNotifier::NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to)
+{
+    LogPrint(BCLog::ZMQ, "zmq: Publish rawsmsg %s\n", hash.GetHex());
+    const uint32_t nPayload = psmsg->pPayload ? psmsg->nPayload : 0;
+    std::string data(20 + smsg::SMSG_HDR_LEN + nPayload, '\0');
+    memcpy(&data[0], hash.begin(), 20);
+    psmsg->WriteHeader((uint8_t*)&data[20]);
+    if (nPayload > 0) {
+        memcpy(&data[20 + smsg::SMSG_HDR_LEN], psmsg->pPayload, nPayload);
+    }
+
+    if (m_decrypt) {
+        // Decrypted here, smsg may be gone by the time the send thread runs
+        smsg::MessageData msg;
+        const uint8_t *pHeader = (const uint8_t*)&data[20];
+        CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+        if (nPayload > 0 &&
+            smsgModule.Decrypt(false, address_to, pHeader, pHeader + smsg::SMSG_HDR_LEN, nPayload, msg) == 0) {
+            ss << (uint8_t)1;
+            ss << msg.sFromAddress;
+            ss << EncodeDestination(PKHash(address_to));
+            ss << std::string((const char*)msg.vchMessage.data());
+        } else {
+            ss << (uint8_t)0;
+        }
+        data.append(ss.data(), ss.size());
+    }
+    return SendZmqMessage(MSG_RAWSMSG, std::move(data));
+}
+
+bool CZMQPublishStealthMatchNotifier::NotifyStealthMatch(const uint256 &key_id, const StealthScanMatch &match)
+{
+    LogPrint(BCLog::ZMQ, "zmq: Publish stealthmatch %s, %s:%d\n", key_id.GetHex(), match.txid.GetHex(), match.n);
+    // key id, txid, output, output type and height, -1 while in the mempool
+    uint8_t data[32 + 32 + 4 + 1 + 4];
+    for (unsigned int i = 0; i < 32; i++) {
+        data[31 - i] = key_id.begin()[i];
+        data[63 - i] = match.txid.begin()[i];
+    }
+    WriteLE32(&data[64], match.n);
+    data[68] = match.type;
+    WriteLE32(&data[69], (uint32_t)match.height);
+    return SendZmqMessage(MSG_STEALTHMATCH, data, sizeof(data));
+}
@@ -7,7 +7,60 @@
 
 #include <zmq/zmqabstractnotifier.h>
 
+#include <sync.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
 class CBlockIndex;
+class CZMQAbstractPublishNotifier;
+
+/**
+ * Bounded queue of messages sent by one thread, so the notifying threads don't
+ * serialize big messages or wait on the sockets.
+ * When the queue is full a message is dropped, or with backpressure the
+ * notifying thread waits for space.
+ */
+class CZMQSendQueue
+{
+public:
+    struct Message {
+        CZMQAbstractPublishNotifier *notifier;
+        const char *command;
+        uint32_t sequence;
+        std::string data;
+        //! Fills data on the send thread when set, returns false on failure
+        std::function<bool(std::string&)> producer;
+    };
+
+    CZMQSendQueue(size_t max_size, bool drop_when_full) : m_max_size(max_size), m_drop_when_full(drop_when_full) {}
+    ~CZMQSendQueue() { Stop(); }
+
+    void Start();
+    //! Send what's queued and stop the thread
+    void Stop();
+    //! Returns false when the message was dropped
+    bool Push(Message &&msg);
+    //! Wait until everything queued has been sent
+    void WaitIdle();
+
+    size_t GetMaxSize() const { return m_max_size; }
+    bool DropsWhenFull() const { return m_drop_when_full; }
+
+private:
+    void ThreadSend();
+
+    const size_t m_max_size;
+    const bool m_drop_when_full;
+    Mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<Message> m_queue GUARDED_BY(m_mutex);
+    bool m_sending GUARDED_BY(m_mutex){false};
+    bool m_stop GUARDED_BY(m_mutex){false};
+    std::thread m_thread;
+};
 
 class CZMQAbstractPublishNotifier : public CZMQAbstractNotifier
 {
@@ -21,8 +74,16 @@ public:
           * command
           * data
           * message sequence number
+       Queued messages take their sequence number when queued, a message dropped
+       from a full queue leaves a gap in the sequence.
     */
     bool SendZmqMessage(const char *command, const void* data, size_t size);
+    //! Queue a message, data is handed to zmq without another copy
+    bool SendZmqMessage(const char *command, std::string &&data);
+    //! Queue a message whose data is made on the send thread
+    bool SendZmqMessage(const char *command, std::function<bool(std::string&)> producer);
+    //! Send a message on the calling thread, zmq takes over the buffer of data
+    bool SendNow(const char *command, std::string &&data, uint32_t sequence);
 
     bool Initialize(void *pcontext) override;
     void Shutdown() override;
@@ -67,13 +128,37 @@ class CZMQPublishHashWalletTransactionNotifier : public CZMQAbstractPublishNotif
 {
 public:
     using CZMQAbstractPublishNotifier::NotifyTransaction;
-    bool NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction) override;
+    bool NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction, const std::string &record) override;
+};
+
+class CZMQPublishRawWalletTransactionNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    using CZMQAbstractPublishNotifier::NotifyTransaction;
+    bool NotifyTransaction(const std::string &sWalletName, const CTransaction &transaction, const std::string &record) override;
 };
 
 class CZMQPublishSMSGNotifier : public CZMQAbstractPublishNotifier
 {
 public:
-    bool NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash) override;
+    bool NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to) override;
+};
+
+class CZMQPublishRawSMSGNotifier : public CZMQAbstractPublishNotifier
+{
+private:
+    //! Append the plaintext of messages to owned addresses, -zmqrawsmsgdecrypt
+    bool m_decrypt{false};
+
+public:
+    bool Initialize(void *pcontext) override;
+    bool NotifySecureMessage(const smsg::SecureMessage *psmsg, const uint160 &hash, const CKeyID &address_to) override;
+};
+
+class CZMQPublishStealthMatchNotifier : public CZMQAbstractPublishNotifier
+{
+public:
+    bool NotifyStealthMatch(const uint256 &key_id, const StealthScanMatch &match) override;
 };
 
 #endif // BITCOIN_ZMQ_ZMQPUBLISHNOTIFIER_H
@@ -34,6 +34,9 @@ static RPCHelpMan getzmqnotifications()
                             {RPCResult::Type::STR, "type", "Type of notification"},
                             {RPCResult::Type::STR, "address", "Address of the publisher"},
                             {RPCResult::Type::NUM, "hwm", "Outbound message high water mark"},
+                            {RPCResult::Type::NUM, "queued", "Messages waiting in the send queue"},
+                            {RPCResult::Type::NUM, "sent", "Messages sent"},
+                            {RPCResult::Type::NUM, "dropped", "Messages dropped because the send queue was full"},
                         }},
                     }
                 },
@@ -50,6 +53,9 @@ static RPCHelpMan getzmqnotifications()
             obj.pushKV("type", n->GetType());
             obj.pushKV("address", n->GetAddress());
             obj.pushKV("hwm", n->GetOutboundMessageHighWaterMark());
+            obj.pushKV("queued", (uint64_t)n->GetQueued());
+            obj.pushKV("sent", n->GetSent());
+            obj.pushKV("dropped", n->GetDropped());
             result.push_back(obj);
         }
     }
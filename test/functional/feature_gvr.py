@@ -191,6 +191,11 @@ class GhostVeteranRewardTest(GhostTestFramework):
         # Now make sure treas_addr was elig
         elig_addresses = nodes[0].geteligibleaddresses(block_count)
         assert_equal(self.is_elig(treas_addr, elig_addresses), True)
+        # Filtered and paged from the same snapshot
+        assert_equal(nodes[0].geteligibleaddresses(block_count, True, {'prefix': treas_addr}), [e for e in elig_addresses if e['Address'] == treas_addr])
+        assert_equal(nodes[0].geteligibleaddresses(block_count, True, {'skip': 1}), elig_addresses[1:])
+        assert_equal(nodes[0].geteligibleaddresses(block_count, True, {'count': 1}), elig_addresses[:1])
+        assert_equal(nodes[0].geteligibleaddresses(block_count, True, {'min_multiplier': 1000}), [])
 
         # 3 = gvr from staked block 5
         # 0.96 = dev fund reward
@@ -11,7 +11,7 @@
 import time
 
 from test_framework.test_particl import GhostTestFramework
-from test_framework.util import assert_equal
+from test_framework.util import assert_equal, assert_raises_rpc_error
 
 
 class AddressIndexTest(GhostTestFramework):
@@ -205,12 +205,39 @@ class AddressIndexTest(GhostTestFramework):
         deltas = self.nodes[1].getaddressdeltas({"addresses": [address2], "start": 3, "end": 3})
         assert_equal(len(deltas), 1)
 
+        # Check that deltas and txids can be paged through
+        self.log.info("Testing paged queries...")
+        paged_deltas = []
+        page = {"cursor": None}
+        while "cursor" in page:
+            query = {"addresses": [address2], "limit": 1}
+            if page["cursor"] is not None:
+                query["cursor"] = page["cursor"]
+            page = self.nodes[1].getaddressdeltas(query)
+            paged_deltas += page["deltas"]
+        assert_equal(paged_deltas, deltasAll)
+
+        page = self.nodes[1].getaddresstxids({"addresses": ["r8L81gLiWg46j5EGfZSp2JHmA9hBgLbHuf", "pqZDE7YNWv5PJWidiaEG8tqfebkd6PNZDV"], "limit": 4})
+        assert_equal(len(page["txids"]), 4)
+        page = self.nodes[1].getaddresstxids({"addresses": ["r8L81gLiWg46j5EGfZSp2JHmA9hBgLbHuf", "pqZDE7YNWv5PJWidiaEG8tqfebkd6PNZDV"], "limit": 4, "cursor": page["cursor"]})
+        assert_equal(len(page["txids"]), 2)
+        assert("cursor" not in page)
+        deltas_cursor = self.nodes[1].getaddressdeltas({"addresses": [address2], "limit": 1})["cursor"]
+        assert_raises_rpc_error(-8, "Cursor is from a different query", self.nodes[1].getaddressutxos, {"addresses": [address2], "limit": 1, "cursor": deltas_cursor})
+
         # Check that unspent outputs can be queried
         self.log.info("Testing utxos...")
         utxos = self.nodes[1].getaddressutxos({"addresses": [address2]})
         assert_equal(len(utxos), 2)
         assert_equal(utxos[0]["satoshis"], 1500000000)
 
+        page = self.nodes[1].getaddressutxos({"addresses": [address2], "limit": 1})
+        assert_equal(len(page["utxos"]), 1)
+        page2 = self.nodes[1].getaddressutxos({"addresses": [address2], "limit": 1, "cursor": page["cursor"]})
+        assert_equal(len(page2["utxos"]), 1)
+        assert("cursor" not in page2)
+        assert_equal(sorted([page["utxos"][0]["txid"], page2["utxos"][0]["txid"]]), sorted([u["txid"] for u in utxos]))
+
         # Check that indexes will be updated with a reorg
         self.log.info("Testing reorg...")
         height_before = self.nodes[1].getblockcount()
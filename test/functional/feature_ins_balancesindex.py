@@ -68,6 +68,19 @@ class BalancesIndexTest(GhostTestFramework):
         txoutsetinfo = nodes[1].gettxoutsetinfo()
         assert(blockbalances['plain'] == txoutsetinfo['total_amount'])
 
+        r = nodes[1].getblockbalancesrange(0, 2)
+        assert(len(r) == 3)
+        assert(r[2]['blockhash'] == nodes[0].getblockhash(2))
+        assert(r[2]['blind'] == blockbalances['blind'])
+        assert(r[0]['plain_change'] == r[0]['plain'])
+        assert(r[2]['blind_change'] == r[2]['blind'] - r[1]['blind'])
+
+        r = nodes[1].getblockbalancesrange(1, 2, {'step': 5, 'in_sats': True})
+        assert(len(r) == 1)
+        assert(r[0]['height'] == 2)
+        assert(r[0]['anon_change'] == 1000000000)
+        assert(r[0]['blind_change'] == 900000000)
+
 
 if __name__ == '__main__':
     BalancesIndexTest().main()
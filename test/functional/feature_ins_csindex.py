@@ -118,6 +118,11 @@ class TxIndexTest(GhostTestFramework):
         self.stakeBlocks(1, nStakeNode=2)
         ro = nodes[2].listcoldstakeunspent(addrStake)
         assert(len(ro) == 3)
+        ro_totals = nodes[2].listcoldstakeunspent(addrStake, -1, {'by_spend_address': True})
+        assert(len(ro_totals) == 1)
+        assert(ro_totals[0]['addrspend'] == addrSpend)
+        assert(ro_totals[0]['num_outputs'] == 3)
+        assert(ro_totals[0]['value'] == sum(o['value'] for o in ro))
 
         ro = nodes[2].listcoldstakeunspent(addrStake, 4, {'mature_only': True})
         assert(len(ro) == 1)
@@ -14,14 +14,16 @@ from test_framework.util import assert_equal
 class SpentIndexTest(GhostTestFramework):
     def set_test_params(self):
         self.setup_clean_chain = True
-        self.num_nodes = 4
+        self.num_nodes = 5
         self.extra_args = [
             # Nodes 0/1 are "wallet" nodes
             ['-debug',],
             ['-debug','-spentindex'],
             # Nodes 2/3 are used for testing
             ['-debug','-spentindex'],
-            ['-debug','-spentindex', '-txindex'],]
+            ['-debug','-spentindex', '-txindex'],
+            # Node 4 builds the spent index in the background
+            ['-debug','-spentindex','-insightindexasync'],]
 
     def skip_test_if_missing_module(self):
         self.skip_if_no_wallet()
@@ -33,6 +35,7 @@ class SpentIndexTest(GhostTestFramework):
         self.connect_nodes(0, 1)
         self.connect_nodes(0, 2)
         self.connect_nodes(0, 3)
+        self.connect_nodes(0, 4)
 
         self.sync_all()
 
@@ -84,6 +87,10 @@ class SpentIndexTest(GhostTestFramework):
         assert_equal(info["index"], 0)
         assert_equal(info["height"], 1)
 
+        # Once caught up, the background index gives the same result
+        self.wait_until(lambda: self.nodes[4].getindexinfo('insightindex')['insightindex']['best_block_height'] == self.nodes[4].getblockcount())
+        assert_equal(self.nodes[4].getspentinfo({"txid": unspent[0]["txid"], "index": unspent[0]["vout"]}), info)
+
         print("Testing getrawtransaction method...")
 
         # Check that verbose raw transaction includes spent info
@@ -71,6 +71,9 @@ class TimestampIndexTest(GhostTestFramework):
 
         assert_equal(hashes, blockhashes)
 
+        hashes = self.nodes[1].getblockhashes(high, low, {'noOrphans': True, 'limit': 2})
+        assert_equal(hashes, blockhashes[:2])
+
         print('Passed\n')
 
 
@@ -3,7 +3,10 @@
 # Distributed under the MIT software license, see the accompanying
 # file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+import http.client
+import json
 import random
+import urllib.parse
 from test_framework.test_particl import GhostTestFramework
 from test_framework.util import assert_raises_rpc_error
 from test_framework.address import base58_to_byte
@@ -16,7 +19,7 @@ class AnonTest(GhostTestFramework):
     def set_test_params(self):
         self.setup_clean_chain = True
         self.num_nodes = 3
-        self.extra_args = [ ['-debug','-noacceptnonstdtxn', '-anonrestricted=0', '-reservebalance=10000000'] for i in range(self.num_nodes)]
+        self.extra_args = [ ['-debug','-noacceptnonstdtxn', '-anonrestricted=0', '-reservebalance=10000000', '-rest'] for i in range(self.num_nodes)]
 
     def skip_test_if_missing_module(self):
         self.skip_if_no_wallet()
@@ -82,6 +85,20 @@ class AnonTest(GhostTestFramework):
 
         assert(nodes[1].anonoutput()['lastindex'] == 28)
 
+        ro = nodes[1].anonoutputs(1, 100)
+        assert(ro['count'] == 28 and ro['next'] == 29)
+        assert(len(ro['data']) == 28 * 107 * 2)
+        ro = nodes[1].anonoutputs(27, 5, True)
+        assert(ro['count'] == 2)
+        assert(ro['outputs'][1]['publickey'] == nodes[1].anonoutput('28')['publickey'])
+        assert(ro['outputs'][1]['txnhash'] == nodes[1].anonoutput('28')['txnhash'])
+
+        self.log.info('Test REST anonoutputs')
+        rest_outputs = json.loads(self.rest_get(nodes[1], '/rest/anonoutputs/27/5.json'))
+        assert(rest_outputs['outputs'] == ro['outputs'])
+        rest_packed = self.rest_get(nodes[1], '/rest/anonoutputs/1/100.bin')
+        assert(rest_packed[12:].hex() == nodes[1].anonoutputs(1, 100)['data'])
+
         txnHashes.clear()
         txnHashes.append(nodes[1].sendanontoanon(sxAddrTo0_1, 101, '', '', False, 'node1 -> node0 a->a', 5, 1))
         txnHashes.append(nodes[1].sendanontoanon(sxAddrTo0_1, 0.1, '', '', False, '', 5, 2))
@@ -370,10 +387,33 @@ class AnonTest(GhostTestFramework):
         assert(spent['spent'] is True)
         assert(spent['txid'] == spending_txid)
 
+        batch = nodes[0].checkkeyimage([keyimage, used_keyimage])
+        assert(batch[0]['keyimage'] == keyimage and batch[0]['spent'] is False)
+        assert(batch[1]['spent'] is True and batch[1]['txid'] == spending_txid)
+        ro = nodes[0].anonoutput(['1', anon_pubkey, 'ff'])
+        assert(ro[0]['index'] == 1)
+        assert(ro[1]['publickey'] == anon_pubkey)
+        assert('error' in ro[2])
+
+        rest_spent = json.loads(self.rest_get(nodes[0], '/rest/keyimages/{}/{}.json'.format(keyimage, used_keyimage)))
+        assert(rest_spent[0]['spent'] is False)
+        assert(rest_spent[1]['txid'] == spending_txid)
+        rest_packed = self.rest_get(nodes[0], '/rest/keyimages.bin', bytes.fromhex(keyimage + used_keyimage))
+        assert(len(rest_packed) == 2 * 37 and rest_packed[0] == 0 and rest_packed[37] == 1)
+
         self.log.info('Test rollbackrctindex')
         nodes[0].rollbackrctindex()
 
 
+    def rest_get(self, node, uri, body=b''):
+        url = urllib.parse.urlparse(node.url)
+        conn = http.client.HTTPConnection(url.hostname, url.port)
+        conn.request('POST' if body else 'GET', uri, body)
+        resp = conn.getresponse()
+        assert(resp.status == 200)
+        return resp.read()
+
+
 if __name__ == '__main__':
     AnonTest().main()
 
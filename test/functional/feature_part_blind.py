@@ -85,6 +85,7 @@ class BlindTest(GhostTestFramework):
 
         ro = nodes[2].getwalletinfo()
         assert(isclose(ro['unconfirmed_blind'], 0.2))
+        assert(ro['records_memory_usage'] > 0)
 
         ro = nodes[2].listtransactions()
         assert(len(ro) == 1)
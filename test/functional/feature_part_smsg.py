@@ -114,6 +114,10 @@ class SmsgTest(GhostTestFramework):
 
         ro = nodes[0].smsgscanchain()
         assert('Completed' in ro['result'])
+        ro = nodes[0].smsgscanchain(True)
+        assert('Started' in ro['result'])
+        self.wait_until(lambda: nodes[0].smsggetinfo()['scan_chain']['running'] is False)
+        assert(nodes[0].smsggetinfo()['scan_chain']['height'] == nodes[0].getblockcount())
 
         self.log.info('Test smsgsend without submitmsg')
         sendoptions = {'submitmsg': False}
@@ -6,7 +6,7 @@
 import json
 
 from test_framework.test_particl import GhostTestFramework, isclose
-from test_framework.util import assert_raises_rpc_error
+from test_framework.util import assert_equal, assert_raises_rpc_error
 
 
 class StealthTest(GhostTestFramework):
@@ -14,6 +14,7 @@ class StealthTest(GhostTestFramework):
         self.setup_clean_chain = True
         self.num_nodes = 3
         self.extra_args = [ ['-debug','-noacceptnonstdtxn','-reservebalance=10000000'] for i in range(self.num_nodes)]
+        self.extra_args[0].append('-stealthscanserver')
 
     def skip_test_if_missing_module(self):
         self.skip_if_no_wallet()
@@ -67,11 +68,28 @@ class StealthTest(GhostTestFramework):
         assert(sxAddrTo1 in sro)
         assert(sxAddrTo2 in sro)
 
+        # Scan for the imported address on node0, which has only the scan secret
+        assert_raises_rpc_error(-8, 'Scan secret does not match the address', nodes[0].registerscankey, sxAddrTo2, '7uk8ELaUsop2r4vMg415wEGBfRd1MmY7JiXX7CRhwuwq5PaWXQ9N')
+        scan_id = nodes[0].registerscankey(sxAddrTo2, '7pJLDnLxoYmkwpMNDX69dWGT7tuZ45LHgMajQDD8JrXb9LHmzfBA')['id']
+        assert_equal(nodes[0].registerscankey(sxAddrTo2, '7pJLDnLxoYmkwpMNDX69dWGT7tuZ45LHgMajQDD8JrXb9LHmzfBA')['id'], scan_id)
+        assert_equal(nodes[0].getscanserverinfo()['keys'], 1)
+
         txnHash = nodes[0].sendtoaddress(sxAddrTo2, 0.2)
         txnHashes.append(txnHash)
 
         assert(self.wait_for_mempool(nodes[1], txnHash))
 
+        ro = nodes[0].getscanmatches(scan_id, 0, 30)
+        assert_equal(len(ro['matches']), 1)
+        match = ro['matches'][0]
+        assert_equal(match['txid'], txnHash)
+        assert_equal(match['type'], 'standard')
+        assert_equal(match['height'], -1)
+        # Handled matches are dropped
+        assert_equal(len(nodes[0].getscanmatches(scan_id, match['seq'])['matches']), 0)
+        assert(nodes[0].unregisterscankey(scan_id))
+        assert_raises_rpc_error(-5, 'Unknown scan key', nodes[0].getscanmatches, scan_id)
+
         ro = nodes[1].listtransactions()
 
         sxAddrTo3 = nodes[1].getnewstealthaddress()
@@ -17,6 +17,7 @@ class TreasuryFundTest(GhostTestFramework):
         self.setup_clean_chain = True
         self.num_nodes = 3
         self.extra_args = [['-debug', '-anonrestricted=0', '-noacceptnonstdtxn', '-reservebalance=10000000', '-stakethreadconddelayms=500', '-txindex=1', '-maxtxfee=1'] for i in range(self.num_nodes)]
+        self.extra_args[1].append('-rewardindex')
 
     def skip_test_if_missing_module(self):
         self.skip_if_no_wallet()
@@ -130,6 +131,19 @@ class TreasuryFundTest(GhostTestFramework):
         assert(block_reward_14['stakereward'] * COIN == expect_reward)
         assert(block_reward_14['blockreward'] * COIN == expect_reward - ((expect_reward * 10) // 100))
 
+        self.log.info('Test the reward index')
+        self.sync_all()
+        assert(nodes[1].getindexinfo()['rewardindex'] is True)
+        rewards_from_txindex = nodes[0].getblockrewards(1, 14)
+        rewards_from_index = nodes[1].getblockrewards(1, 14)
+        assert_equal(len(rewards_from_index), 14)
+        for from_txindex, from_index in zip(rewards_from_txindex, rewards_from_index):
+            assert('fees' not in from_txindex)
+            del from_index['fees']
+            assert_equal(from_txindex, from_index)
+        assert_equal(nodes[1].getblockreward(6)['fees'] * COIN, tx_fee)
+        assert_equal(nodes[1].getblockreward(5)['fees'], 0)
+
 
 if __name__ == '__main__':
     TreasuryFundTest().main()
@@ -13,6 +13,8 @@ import base64
 from test_framework.test_particl import GhostTestFramework
 from test_framework.test_framework import SkipTest
 
+SMSG_HDR_LEN = 108
+
 
 class ZMQTest(GhostTestFramework):
     def set_test_params(self):
@@ -49,6 +51,8 @@ class ZMQTest(GhostTestFramework):
         self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"rawtx")
         self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"hashwtx")
         self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"smsg")
+        self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"rawwtx")
+        self.zmqSubSocket.setsockopt(zmq.SUBSCRIBE, b"rawsmsg")
 
         public_key, secret_key = self.zmq.curve_keypair()
         self.zmqSubSocket.setsockopt(zmq.CURVE_PUBLICKEY, public_key)
@@ -65,7 +69,10 @@ class ZMQTest(GhostTestFramework):
                         '-zmqpubhashblock=%s' % ip_address, '-zmqpubhashtx=%s' % ip_address,
                         '-zmqpubrawblock=%s' % ip_address, '-zmqpubrawtx=%s' % ip_address,
                         '-zmqpubsmsg=%s' % ip_address,
-                        '-zmqpubhashwtx=%s' % ip_address],
+                        '-zmqpubhashwtx=%s' % ip_address,
+                        '-zmqpubrawwtx=%s' % ip_address,
+                        '-zmqpubrawsmsg=%s' % ip_address,
+                        '-zmqrawsmsgdecrypt'],
                        []]
         self.add_nodes(self.num_nodes, self.extra_args)
         self.start_nodes()
@@ -78,7 +85,9 @@ class ZMQTest(GhostTestFramework):
             self.log.debug("Destroying zmq context")
             self.zmqContext.destroy(linger=None)
 
-    def waitForZmqSmsg(self, msgid):
+    def waitForZmqSmsg(self, msgid, text):
+        fFound = False
+        fFoundRaw = False
         for count in range(0, 100):
             try:
                 msg = self.zmqSubSocket.recv_multipart(self.zmq.NOBLOCK)
@@ -92,6 +101,24 @@ class ZMQTest(GhostTestFramework):
                 zmqhash = msg[1].hex()
                 assert(zmqhash[:4] == '0300')  # version 3.0
                 assert(zmqhash[4:] == msgid)
+            elif topic == 'rawsmsg':
+                fFoundRaw = True
+                body = msg[1]
+                assert(body[:20].hex() == msgid[16:])
+                header = body[20:20 + SMSG_HDR_LEN]
+                assert(header[8:10].hex() == '0300')
+                payload_len = struct.unpack('<I', header[-4:])[0]
+                ofs = 20 + SMSG_HDR_LEN + payload_len
+                assert(body[ofs] == 1)  # Decrypted
+                ofs += 1
+                fields = []
+                for i in range(3):
+                    field_len = body[ofs]
+                    fields.append(body[ofs + 1:ofs + 1 + field_len].decode('utf-8'))
+                    ofs += 1 + field_len
+                assert(fields[2] == text)
+                assert(ofs == len(body))
+            if fFound and fFoundRaw:
                 return True
         return False
 
@@ -112,6 +139,7 @@ class ZMQTest(GhostTestFramework):
         fFound = False
         fFoundWtx = False
         fFoundRawTx = False
+        fFoundRawWtx = False
         for count in range(0, 100):
             try:
                 msg = self.zmqSubSocket.recv_multipart(self.zmq.NOBLOCK)
@@ -137,13 +165,21 @@ class ZMQTest(GhostTestFramework):
                 assert(zmqhash == txnHash)
                 walletName = msg[1][32:].decode('utf-8')
                 assert(walletName == 'wallet_test')
+            elif topic == 'rawwtx' and msgSequence == 0:
+                fFoundRawWtx = True
+                name_len = msg[1][0]
+                walletName = msg[1][1:1 + name_len].decode('utf-8')
+                assert(walletName == 'wallet_test')
+                # Followed by the transaction and the wallet record
+                assert(len(msg[1]) > 1 + name_len)
 
-            if fFound and fFoundRawTx and fFoundWtx:
+            if fFound and fFoundRawTx and fFoundWtx and fFoundRawWtx:
                 break
 
         assert(fFound)
         assert(fFoundRawTx)
         assert(fFoundWtx)
+        assert(fFoundRawWtx)
 
         self.stakeBlocks(1, nStakeNode=1)
         self.log.info("Wait for block")
@@ -182,14 +218,15 @@ class ZMQTest(GhostTestFramework):
         assert(ro['result'] == 'Public key added to db.')
 
 
-        ro = nodes[1].smsgsend(address1, address0, "['data':'test','value':1]", True, 4)
+        text = "['data':'test','value':1]"
+        ro = nodes[1].smsgsend(address1, address0, text, True, 4)
         msgid = ro['msgid']
         assert(ro['result'] == 'Sent.')
 
         self.stakeBlocks(1, nStakeNode=1)
         self.waitForSmsgExchange(1, 1, 0)
 
-        assert(self.waitForZmqSmsg(msgid))
+        assert(self.waitForZmqSmsg(msgid, text))
 
         ro = nodes[0].getnewzmqserverkeypair()
         assert(len(ro['server_secret_key']) == 40)
@@ -198,7 +235,7 @@ class ZMQTest(GhostTestFramework):
 
         ro = nodes[0].smsgzmqpush()
         assert(ro['numsent'] == 1)
-        assert(self.waitForZmqSmsg(msgid))
+        assert(self.waitForZmqSmsg(msgid, text))
 
         ro = nodes[0].smsgzmqpush({"timefrom": int(time.time()) + 1})
         assert(ro['numsent'] == 0)
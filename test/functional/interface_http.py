@@ -5,15 +5,18 @@
 """Test the RPC HTTP basics."""
 
 from test_framework.test_framework import BitcoinTestFramework
-from test_framework.util import assert_equal, str_to_b64str
+from test_framework.util import assert_equal, assert_greater_than_or_equal, str_to_b64str
 
 import http.client
+import os
+import socket
 import urllib.parse
 
 class HTTPBasicsTest (BitcoinTestFramework):
     def set_test_params(self):
         self.num_nodes = 3
         self.supports_cli = False
+        self.extra_args = [[], ["-rpckeepalive=0"], []]
 
     def setup_network(self):
         self.setup_nodes()
@@ -78,6 +81,7 @@ class HTTPBasicsTest (BitcoinTestFramework):
         conn.request('POST', '/', '{"method": "getbestblockhash"}', headers)
         out1 = conn.getresponse().read()
         assert b'"error":null' in out1
+        assert conn.sock is None  #connection must be closed because keep-alive is disabled
 
         #node2 (third node) is running with standard keep-alive parameters which means keep-alive is on
         urlNode2 = urllib.parse.urlparse(self.nodes[2].url)
@@ -104,6 +108,40 @@ class HTTPBasicsTest (BitcoinTestFramework):
         out1 = conn.getresponse()
         assert_equal(out1.status, http.client.BAD_REQUEST)
 
+        # Connection reuse is counted
+        connections = self.nodes[0].getrpcinfo()['connections']
+        assert_greater_than_or_equal(connections['accepted'], 3)
+        assert_greater_than_or_equal(connections['reused'], 2)
+        assert_greater_than_or_equal(connections['requests'], connections['accepted'])
+        assert_equal(connections['refused'], 0)
+
+        self.log.info("Test JSON-RPC over a Unix domain socket")
+        socket_path = os.path.join(self.nodes[2].datadir, 'rpc.sock')
+        self.restart_node(2, ['-rpcbind=unix:' + socket_path, '-rpcbind=127.0.0.1', '-rpcallowip=127.0.0.1'])
+        headers = {"Authorization": "Basic " + str_to_b64str(authpair)}
+        conn = http.client.HTTPConnection('localhost')
+        conn.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        conn.sock.connect(socket_path)
+        for _ in range(2):
+            conn.request('POST', '/', '{"method": "getbestblockhash"}', headers)
+            out1 = conn.getresponse()
+            assert_equal(out1.status, http.client.OK)
+            assert b'"error":null' in out1.read()
+        conn.close()
+
+        self.log.info("Test -rpcmaxconnections")
+        self.restart_node(2, ['-rpcmaxconnections=1'])
+        # The test framework holds the one connection
+        self.nodes[2].getblockcount()
+        conn = http.client.HTTPConnection(urlNode2.hostname, urlNode2.port)
+        conn.connect()
+        conn.request('POST', '/', '{"method": "getbestblockhash"}', headers)
+        out1 = conn.getresponse()
+        assert_equal(out1.status, http.client.SERVICE_UNAVAILABLE)
+        out1.read()
+        assert conn.sock is None
+        assert_equal(self.nodes[2].getrpcinfo()['connections']['refused'], 1)
+
 
 if __name__ == '__main__':
     HTTPBasicsTest ().main ()
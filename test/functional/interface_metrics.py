@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021 The Ghost Core developers
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+"""Test the /metrics endpoint."""
+
+from test_framework.test_framework import BitcoinTestFramework
+from test_framework.util import assert_equal
+
+import http.client
+import urllib.parse
+
+
+class MetricsTest(BitcoinTestFramework):
+    def set_test_params(self):
+        self.num_nodes = 2
+        self.extra_args = [['-metrics'], []]
+
+    def get_metrics(self, node, method='GET'):
+        url = urllib.parse.urlparse(node.url)
+        conn = http.client.HTTPConnection(url.hostname, url.port)
+        conn.request(method, '/metrics')
+        resp = conn.getresponse()
+        body = resp.read().decode('utf-8')
+        conn.close()
+        return resp, body
+
+    def parse_samples(self, body):
+        samples = {}
+        for line in body.splitlines():
+            if line.startswith('#'):
+                continue
+            name, value = line.rsplit(' ', 1)
+            samples[name] = float(value)
+        return samples
+
+    def run_test(self):
+        node = self.nodes[0]
+
+        self.log.info('Check the metrics are served in the text format')
+        resp, body = self.get_metrics(node)
+        assert_equal(resp.status, 200)
+        assert resp.getheader('Content-Type').startswith('text/plain')
+        samples = self.parse_samples(body)
+        assert_equal(samples['ghost_chain_height'], node.getblockcount())
+        assert_equal(samples['ghost_net_peers'], len(node.getpeerinfo()))
+        for tx_type in ('plain', 'blind', 'anon'):
+            assert 'ghost_mempool_usage_bytes{type="%s"}' % tx_type in samples
+        assert 'ghost_validation_stage_seconds_total{kind="plain",stage="connect_transactions"}' in samples
+        assert 'ghost_cache_lookups_total{cache="proof",result="hit"}' in samples
+        assert '# TYPE ghost_net_bytes_total counter' in body
+
+        self.log.info('Check only GET is accepted')
+        resp, _ = self.get_metrics(node, 'POST')
+        assert_equal(resp.status, 405)
+
+        self.log.info('Check the endpoint is off by default')
+        resp, _ = self.get_metrics(self.nodes[1])
+        assert_equal(resp.status, 404)
+
+
+if __name__ == '__main__':
+    MetricsTest().main()
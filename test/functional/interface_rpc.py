@@ -35,6 +35,13 @@ class RPCInterfaceTest(BitcoinTestFramework):
         assert_greater_than_or_equal(command['duration'], 0)
         assert_equal(info['logpath'], os.path.join(self.nodes[0].datadir, self.chain, 'debug.log'))
 
+        queues = {q['name']: q for q in info['work_queues']}
+        assert_equal(info['work_queues'][0]['name'], 'default')
+        assert 'fast' in queues and 'heavy' in queues and 'wallet' not in queues
+        # getrpcinfo itself is served by the fast queue
+        assert_greater_than_or_equal(queues['fast']['served'], 1)
+        assert_equal(len(queues['fast']['wait_histogram']), 7)
+
     def test_batch_request(self):
         self.log.info("Testing basic JSON-RPC batch request...")
 
@@ -61,6 +68,21 @@ class RPCInterfaceTest(BitcoinTestFramework):
         assert_equal(result_by_id[3]['error'], None)
         assert result_by_id[3]['result'] is not None
 
+        self.log.info("Testing parallel JSON-RPC batch request keeps the request order...")
+        requests = []
+        for i in range(200):
+            if i % 3 == 0:
+                requests.append({"method": "invalidmethod", "id": i})
+            else:
+                requests.append({"method": "getblockhash", "id": i, "params": [0]})
+        results = self.nodes[0].batch(requests)
+        assert_equal([res['id'] for res in results], list(range(200)))
+        for i, res in enumerate(results):
+            if i % 3 == 0:
+                assert_equal(res['error']['code'], -32601)
+            else:
+                assert_equal(res['result'], results[1]['result'])
+
     def test_http_status_codes(self):
         self.log.info("Testing HTTP status codes for JSON-RPC requests...")
 
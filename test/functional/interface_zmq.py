@@ -158,12 +158,16 @@ class ZMQTest (BitcoinTestFramework):
 
 
         self.log.info("Test the getzmqnotifications RPC")
-        assert_equal(self.nodes[0].getzmqnotifications(), [
+        notifications = self.nodes[0].getzmqnotifications()
+        assert_equal([{k: n[k] for k in ("type", "address", "hwm")} for n in notifications], [
             {"type": "pubhashblock", "address": address, "hwm": 1000},
             {"type": "pubhashtx", "address": address, "hwm": 1000},
             {"type": "pubrawblock", "address": address, "hwm": 1000},
             {"type": "pubrawtx", "address": address, "hwm": 1000},
         ])
+        for n in notifications:
+            assert_equal(n["dropped"], 0)
+            assert n["sent"] > 0
 
         assert_equal(self.nodes[1].getzmqnotifications(), [])
 
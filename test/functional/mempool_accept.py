@@ -65,7 +65,8 @@ class MempoolAcceptanceTest(BitcoinTestFramework):
 
         self.log.info('Should not accept garbage to testmempoolaccept')
         assert_raises_rpc_error(-3, 'Expected type array, got string', lambda: node.testmempoolaccept(rawtxs='ff00baar'))
-        assert_raises_rpc_error(-8, 'Array must contain exactly one raw transaction for now', lambda: node.testmempoolaccept(rawtxs=['ff00baar', 'ff22']))
+        assert_raises_rpc_error(-8, 'Array must contain between 1 and 25 transactions.', lambda: node.testmempoolaccept(rawtxs=['ff00baar'] * 26))
+        assert_raises_rpc_error(-22, 'TX decode failed', lambda: node.testmempoolaccept(rawtxs=['ff00baar', 'ff22']))
         assert_raises_rpc_error(-22, 'TX decode failed', lambda: node.testmempoolaccept(rawtxs=['ff00baar']))
 
         self.log.info('A transaction already in the blockchain')
@@ -332,6 +333,72 @@ class MempoolAcceptanceTest(BitcoinTestFramework):
             maxfeerate=0,
         )
 
+        self.log.info('A package of a transaction and its child')
+        coin = coins.pop()
+        fee = Decimal('0.0001')
+        parent_amount = coin['amount'] - fee
+        raw_parent = node.signrawtransactionwithwallet(node.createrawtransaction(
+            inputs=[{'txid': coin['txid'], 'vout': coin['vout']}],
+            outputs=[{node.getnewaddress(): parent_amount}],
+        ))['hex']
+        parent = node.decoderawtransaction(raw_parent)
+        raw_child = node.signrawtransactionwithwallet(node.createrawtransaction(
+            inputs=[{'txid': parent['txid'], 'vout': 0}],
+            outputs=[{node.getnewaddress(): parent_amount - fee}],
+        ), prevtxs=[{'txid': parent['txid'], 'vout': 0, 'scriptPubKey': parent['vout'][0]['scriptPubKey']['hex'], 'amount': parent_amount}])['hex']
+        child = node.decoderawtransaction(raw_child)
+        self.check_mempool_result(
+            result_expected=[{'txid': child['txid'], 'allowed': False, 'reject-reason': 'missing-inputs'}],
+            rawtxs=[raw_child],
+        )
+        self.check_mempool_result(
+            result_expected=[
+                {'txid': parent['txid'], 'allowed': True, 'vsize': parent['vsize'], 'fees': {'base': fee}},
+                {'txid': child['txid'], 'allowed': True, 'vsize': child['vsize'], 'fees': {'base': fee}},
+            ],
+            rawtxs=[raw_parent, raw_child],
+        )
+
+        self.log.info('A package with the child before its parent')
+        self.check_mempool_result(
+            result_expected=[
+                {'txid': child['txid'], 'package-error': 'package-not-sorted'},
+                {'txid': parent['txid'], 'package-error': 'package-not-sorted'},
+            ],
+            rawtxs=[raw_child, raw_parent],
+        )
+
+        self.log.info('A package spending the same output twice')
+        raw_child_2 = node.signrawtransactionwithwallet(node.createrawtransaction(
+            inputs=[{'txid': parent['txid'], 'vout': 0}],
+            outputs=[{node.getnewaddress(): parent_amount - 2 * fee}],
+        ), prevtxs=[{'txid': parent['txid'], 'vout': 0, 'scriptPubKey': parent['vout'][0]['scriptPubKey']['hex'], 'amount': parent_amount}])['hex']
+        child_2 = node.decoderawtransaction(raw_child_2)
+        self.check_mempool_result(
+            result_expected=[
+                {'txid': parent['txid'], 'package-error': 'conflict-in-package'},
+                {'txid': child['txid'], 'package-error': 'conflict-in-package'},
+                {'txid': child_2['txid'], 'package-error': 'conflict-in-package'},
+            ],
+            rawtxs=[raw_parent, raw_child, raw_child_2],
+        )
+        self.check_mempool_result(
+            result_expected=[
+                {'txid': parent['txid'], 'package-error': 'package-contains-duplicates'},
+                {'txid': parent['txid'], 'package-error': 'package-contains-duplicates'},
+            ],
+            rawtxs=[raw_parent, raw_parent],
+        )
+
+        self.log.info('Transactions tested independently')
+        result = node.testmempoolaccept(rawtxs=[raw_child, raw_parent, raw_child_2], independent=True)
+        assert all(r.pop('time') >= 0 for r in result)
+        assert_equal(result, [
+            {'txid': child['txid'], 'allowed': False, 'reject-reason': 'missing-inputs'},
+            {'txid': parent['txid'], 'allowed': True, 'vsize': parent['vsize'], 'fees': {'base': fee}},
+            {'txid': child_2['txid'], 'allowed': False, 'reject-reason': 'missing-inputs'},
+        ])
+
 
 if __name__ == '__main__':
     MempoolAcceptanceTest().main()
@@ -27,10 +27,13 @@ Test is as follows:
     the mempool is not loaded from disk on start up.
   - Restart node0 with -persistmempool. Verify that it has 5
     transactions in its mempool. This tests that -persistmempool=0
-    does not overwrite a previously valid mempool stored on disk.
+    does not overwrite a previously valid mempool stored on disk, and
+    that transactions loaded at the tip they were dumped at skip their
+    proof checks.
   - Remove node0 mempool.dat and verify savemempool RPC recreates it
     and verify that node1 can load it and has 5 transactions in its
-    mempool.
+    mempool. node1 doesn't share node0's mempool.key so it verifies
+    all of them.
   - Verify that savemempool throws when the RPC is called if
     node1 can't write to disk.
 
@@ -119,9 +122,10 @@ class MempoolPersistTest(BitcoinTestFramework):
         assert self.nodes[0].getmempoolinfo()["loaded"]
         assert_equal(len(self.nodes[0].getrawmempool()), 0)
 
-        self.log.debug("Stop-start node0. Verify that it has the transactions in its mempool.")
+        self.log.debug("Stop-start node0. Verify that it has the transactions in its mempool and skips verifying their proofs.")
         self.stop_nodes()
-        self.start_node(0)
+        with self.nodes[0].assert_debug_log(["mempool transactions with proofs verified before shutdown"]):
+            self.start_node(0)
         assert self.nodes[0].getmempoolinfo()["loaded"]
         assert_equal(len(self.nodes[0].getrawmempool()), 6)
 
@@ -132,10 +136,11 @@ class MempoolPersistTest(BitcoinTestFramework):
         self.nodes[0].savemempool()
         assert os.path.isfile(mempooldat0)
 
-        self.log.debug("Stop nodes, make node1 use mempool.dat from node0. Verify it has 6 transactions")
+        self.log.debug("Stop nodes, make node1 use mempool.dat from node0. Verify it has 6 transactions and verifies them all")
         os.rename(mempooldat0, mempooldat1)
         self.stop_nodes()
-        self.start_node(1, extra_args=[])
+        with self.nodes[1].assert_debug_log(["Mempool file proofs failed authentication"]):
+            self.start_node(1, extra_args=[])
         assert self.nodes[1].getmempoolinfo()["loaded"]
         assert_equal(len(self.nodes[1].getrawmempool()), 6)
 
@@ -7,7 +7,6 @@
 from test_framework.test_framework import BitcoinTestFramework
 from test_framework.util import assert_equal, assert_raises_rpc_error
 
-import hashlib
 from pathlib import Path
 
 
@@ -37,11 +36,22 @@ class DumptxoutsetTest(BitcoinTestFramework):
             out['base_hash'],
             '6fd417acba2a8738b06fee43330c50d58e6a725046c3d843c8dd7e51d46d1ed6')
 
+        # The Particl state follows the coins and is covered by the content hash
+        verified = node.verifytxoutset(FILENAME)
+        assert_equal(verified['base_hash'], out['base_hash'])
+        assert_equal(verified['base_height'], 100)
+        assert_equal(verified['coins_read'], 100)
+        assert_equal(verified['content_hash'], out['content_hash'])
+        assert verified['particl_state']
+        assert verified['anon_index_complete']
+
+        # A truncated snapshot is rejected
+        truncated = Path(node.datadir) / self.chain / 'truncated.dat'
         with open(str(expected_path), 'rb') as f:
-            digest = hashlib.sha256(f.read()).hexdigest()
-            # UTXO snapshot hash should be deterministic based on mocked time.
-            assert_equal(
-                digest, 'be032e5f248264ba08e11099ac09dbd001f6f87ffc68bf0f87043d8146d50664')
+            data = f.read()
+        with open(str(truncated), 'wb') as f:
+            f.write(data[:len(data) // 2])
+        assert_raises_rpc_error(-22, 'Snapshot is truncated', node.verifytxoutset, str(truncated))
 
         # Specifying a path to an existing file will fail.
         assert_raises_rpc_error(
@@ -61,6 +61,14 @@ class RpcMiscTest(BitcoinTestFramework):
         node.logging(include=['qt'])
         assert_equal(node.logging()['qt'], True)
 
+        self.log.info("test getinitstages")
+        init = node.getinitstages()
+        assert_greater_than_or_equal(init['total_ms'], 0)
+        stages = {s['name']: s for s in init['stages']}
+        for name in ['verify wallets', 'load block index', 'verify blocks', 'load wallets']:
+            assert_greater_than_or_equal(stages[name]['duration_ms'], 0)
+            assert_equal(stages[name]['background'], False)
+
         self.log.info("test getindexinfo")
         # Without any indices running the RPC returns an empty object
         assert_equal(node.getindexinfo(), {})
@@ -73,8 +81,8 @@ class RpcMiscTest(BitcoinTestFramework):
         assert_equal(
             node.getindexinfo(),
             {
-                "txindex": {"synced": True, "best_block_height": 200},
-                "basic block filter index": {"synced": True, "best_block_height": 200}
+                "txindex": {"synced": True, "best_block_height": 200, "progress": 1.0},
+                "basic block filter index": {"synced": True, "best_block_height": 200, "progress": 1.0}
             }
         )
 
@@ -82,7 +90,7 @@ class RpcMiscTest(BitcoinTestFramework):
         assert_equal(
             node.getindexinfo("txindex"),
             {
-                "txindex": {"synced": True, "best_block_height": 200},
+                "txindex": {"synced": True, "best_block_height": 200, "progress": 1.0},
             }
         )
 
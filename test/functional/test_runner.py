@@ -148,6 +148,7 @@ BASE_SCRIPTS = [
     'rpc_getchaintips.py',
     'rpc_misc.py',
     'interface_rest.py',
+    'interface_metrics.py',
     'mempool_spend_coinbase.py',
     'wallet_avoidreuse.py',
     'wallet_avoidreuse.py --descriptors',
@@ -3,6 +3,7 @@
 # Distributed under the MIT software license, see the accompanying
 # file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+import os
 import json
 import time
 import textwrap
@@ -811,6 +812,20 @@ class WalletParticlTest(GhostTestFramework):
         ro = nodes[0].mnemonic('decode', '', stdout.strip())
         assert(ro['language'] == 'Spanish')
 
+        self.log.info('Test wallet snapshots')
+        snapshot_path = os.path.join(tmpdir, 'node1', 'wallet.snapshot')
+        ro = nodes[1].dumpwalletsnapshot(snapshot_path)
+        assert(ro['records'] > 0)
+        assert_raises_rpc_error(-8, 'already exists', nodes[1].dumpwalletsnapshot, snapshot_path)
+        ro = nodes[2].importwalletsnapshot(snapshot_path, 'restored')
+        assert_equal(ro['name'], 'restored')
+        w_restored = nodes[2].get_wallet_rpc('restored')
+        assert_equal(w_restored.getwalletinfo()['encryptionstatus'], 'Locked')
+        assert_equal(w_restored.getwalletinfo()['total_balance'], nodes[1].getwalletinfo()['total_balance'])
+        assert_equal(len(w_restored.listtransactions('*', 1000)), len(nodes[1].listtransactions('*', 1000)))
+        assert_raises_rpc_error(-4, None, nodes[2].importwalletsnapshot, snapshot_path, 'restored')
+        nodes[2].unloadwallet('restored')
+
         self.log.info('Test sign and verifymessage')
         message = 'This is just a test message'
         sign_address = nodes[2].getnewaddress()